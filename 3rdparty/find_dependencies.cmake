@@ -1143,6 +1143,13 @@ open3d_import_3rdparty_library(3rdparty_zeromq
     LIBRARIES    ${ZEROMQ_LIBRARIES}
     DEPENDS      ext_zeromq ext_cppzmq
 )
+# The shared memory array transport uses shm_open.
+if(UNIX AND NOT APPLE)
+    find_library(RT_LIBRARY rt)
+    if(RT_LIBRARY)
+        target_link_libraries(3rdparty_zeromq INTERFACE ${RT_LIBRARY})
+    endif()
+endif()
 list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS Open3D::3rdparty_zeromq)
 if(DEFINED ZEROMQ_ADDITIONAL_LIBS)
     list(APPEND Open3D_3RDPARTY_PRIVATE_TARGETS ${ZEROMQ_ADDITIONAL_LIBS})
@@ -54,6 +54,13 @@ function(open3d_set_global_properties target)
     if (WITH_FAISS)
         target_compile_definitions(${target} PRIVATE WITH_FAISS)
     endif()
+    if (WITH_PROFILING)
+        target_compile_definitions(${target} PRIVATE WITH_PROFILING)
+    endif()
+    foreach(dtype IN LISTS OPEN3D_DISPATCH_SKIPPED_DTYPES)
+        string(TOUPPER ${dtype} dtype)
+        target_compile_definitions(${target} PRIVATE OPEN3D_DISPATCH_SKIP_${dtype})
+    endforeach()
     if (GLIBCXX_USE_CXX11_ABI)
         target_compile_definitions(${target} PUBLIC _GLIBCXX_USE_CXX11_ABI=1)
     else()
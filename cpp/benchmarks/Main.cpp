@@ -42,8 +42,29 @@
 #include "open3d/Open3D.h"
 
 int main(int argc, char** argv) {
-    open3d::utility::CPUInfo::GetInstance().Print();
-    open3d::utility::ISAInfo::GetInstance().Print();
+    const open3d::utility::CPUInfo& cpu_info =
+            open3d::utility::CPUInfo::GetInstance();
+    const open3d::utility::ISAInfo& isa_info =
+            open3d::utility::ISAInfo::GetInstance();
+    cpu_info.Print();
+    isa_info.Print();
+
+    // Recorded in the "context" of the JSON output, so that results from
+    // different machines are not compared by accident.
+    benchmark::AddCustomContext("open3d_version", OPEN3D_VERSION);
+    benchmark::AddCustomContext("cpu_cores",
+                                std::to_string(cpu_info.NumCores()));
+    benchmark::AddCustomContext("cpu_threads",
+                                std::to_string(cpu_info.NumThreads()));
+    benchmark::AddCustomContext("numa_nodes",
+                                std::to_string(cpu_info.NumNumaNodes()));
+    benchmark::AddCustomContext(
+            "isa_target",
+            open3d::utility::ToString(isa_info.SelectedTarget()));
+    benchmark::AddCustomContext(
+            "max_threads",
+            std::to_string(open3d::utility::EstimateMaxThreads()));
+
     benchmark::Initialize(&argc, argv);
     if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
         return 1;
@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "benchmarks/benchmark_utilities/StageTimer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/core/MemoryManagerStatistic.h"
+
+namespace open3d {
+namespace benchmarks {
+
+/// Nearest-rank percentile \p p in [0, 100] of the sorted \p values.
+static double Percentile(const std::vector<double>& values, double p) {
+    const size_t rank = static_cast<size_t>(
+            std::ceil(p / 100.0 * static_cast<double>(values.size())));
+    return values[std::max<size_t>(rank, 1) - 1];
+}
+
+StageTimer::StageTimer(const core::Device& device) : device_(device) {
+    core::cuda::Synchronize(device_);
+    // Allocations made before the reset are ignored on free, so the peak
+    // only covers the benchmark itself.
+    core::MemoryManagerStatistic::GetInstance().Reset();
+}
+
+void StageTimer::Report(benchmark::State& state, int64_t num_items) const {
+    for (const auto& kv : latencies_ms_) {
+        std::vector<double> sorted = kv.second;
+        if (sorted.empty()) {
+            continue;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        for (int p : {50, 90, 99}) {
+            state.counters[kv.first + "_p" + std::to_string(p) + "_ms"] =
+                    Percentile(sorted, p);
+        }
+    }
+    state.SetItemsProcessed(num_items);
+    state.counters["peak_memory_MB"] =
+            static_cast<double>(
+                    core::MemoryManagerStatistic::GetInstance()
+                            .GetPeakAllocatedBytes(device_)) /
+            (1024.0 * 1024.0);
+}
+
+}  // namespace benchmarks
+}  // namespace open3d
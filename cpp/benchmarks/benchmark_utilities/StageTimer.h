@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace benchmarks {
+
+/// \class StageTimer
+///
+/// \brief Records the latency of the stages of an end-to-end benchmark, e.g.
+/// tracking, integration and raycasting of each frame, and reports latency
+/// percentiles, throughput and peak memory as benchmark counters.
+class StageTimer {
+public:
+    /// Resets the peak memory statistics of \p device.
+    explicit StageTimer(const core::Device& device);
+
+    /// Runs \p func, waits for the device to finish its work and records the
+    /// elapsed time under \p stage.
+    template <typename func_t>
+    void Time(const std::string& stage, const func_t& func) {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        core::cuda::Synchronize(device_);
+        const auto end = std::chrono::steady_clock::now();
+        latencies_ms_[stage].push_back(
+                std::chrono::duration<double, std::milli>(end - start)
+                        .count());
+    }
+
+    /// Sets the counters <stage>_p50_ms, <stage>_p90_ms and <stage>_p99_ms of
+    /// all recorded stages, the rate of \p num_items processed in all
+    /// iterations as "items_per_second" and the peak number of bytes
+    /// allocated on the device as "peak_memory_MB".
+    void Report(benchmark::State& state, int64_t num_items) const;
+
+private:
+    core::Device device_;
+    std::map<std::string, std::vector<double>> latencies_ms_;
+};
+
+}  // namespace benchmarks
+}  // namespace open3d
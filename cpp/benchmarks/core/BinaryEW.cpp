@@ -140,6 +140,44 @@ void BinaryEW(benchmark::State& state,
     }
 }
 
+enum class BroadcastCase {
+    Row,     // (N, 3) op (3,)
+    Column,  // (N, 3) op (N, 1)
+    Scalar,  // (N, 3) op ()
+};
+
+void BinaryEWBroadcast(benchmark::State& state,
+                       int size,
+                       BinaryOpCode op_code,
+                       BroadcastCase broadcast_case,
+                       const Dtype& dtype,
+                       const Device& device) {
+    SizeVector rhs_shape;
+    switch (broadcast_case) {
+        case BroadcastCase::Row:
+            rhs_shape = {3};
+            break;
+        case BroadcastCase::Column:
+            rhs_shape = {size, 1};
+            break;
+        default:
+            break;
+    }
+    Tensor lhs = benchmarks::Rand({size, 3}, 1, {1, 127}, dtype, device);
+    Tensor rhs = benchmarks::Rand(rhs_shape, 2, {1, 127}, dtype, device);
+    auto op = MakeOperation(op_code);
+
+    Tensor result = op(lhs, rhs);
+    benchmark::DoNotOptimize(result);
+
+    for (auto _ : state) {
+        Tensor result = op(lhs, rhs);
+        benchmark::DoNotOptimize(result);
+
+        cuda::Synchronize(device);
+    }
+}
+
 #define ENUM_BM_SIZE(FN, OP, DEVICE, DEVICE_NAME, DTYPE)                   \
     BENCHMARK_CAPTURE(FN, OP##__##DEVICE_NAME##_##DTYPE##__100, 100,       \
                       BinaryOpCode::OP, DTYPE, DEVICE)                     \
@@ -207,5 +245,34 @@ ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Le)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Eq)
 ENUM_BM_TENSOR_WTIH_BOOL(BinaryEW, Neq)
 
+#define ENUM_BM_BROADCAST_SIZE(FN, OP, CASE, DEVICE, DEVICE_NAME, DTYPE)    \
+    BENCHMARK_CAPTURE(FN, OP##_##CASE##__##DEVICE_NAME##_##DTYPE##__100000, \
+                      100000, BinaryOpCode::OP, BroadcastCase::CASE, DTYPE, \
+                      DEVICE)                                               \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(FN,                                                   \
+                      OP##_##CASE##__##DEVICE_NAME##_##DTYPE##__10000000,   \
+                      10000000, BinaryOpCode::OP, BroadcastCase::CASE,      \
+                      DTYPE, DEVICE)                                        \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_BROADCAST_CASE(FN, OP, DEVICE, DEVICE_NAME, DTYPE)     \
+    ENUM_BM_BROADCAST_SIZE(FN, OP, Row, DEVICE, DEVICE_NAME, DTYPE)    \
+    ENUM_BM_BROADCAST_SIZE(FN, OP, Column, DEVICE, DEVICE_NAME, DTYPE) \
+    ENUM_BM_BROADCAST_SIZE(FN, OP, Scalar, DEVICE, DEVICE_NAME, DTYPE)
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_BM_BROADCAST(FN, OP)                                 \
+    ENUM_BM_BROADCAST_CASE(FN, OP, Device("CPU:0"), CPU, Float32) \
+    ENUM_BM_BROADCAST_CASE(FN, OP, Device("CUDA:0"), CUDA, Float32)
+#else
+#define ENUM_BM_BROADCAST(FN, OP) \
+    ENUM_BM_BROADCAST_CASE(FN, OP, Device("CPU:0"), CPU, Float32)
+#endif
+
+ENUM_BM_BROADCAST(BinaryEWBroadcast, Add)
+ENUM_BM_BROADCAST(BinaryEWBroadcast, Mul)
+ENUM_BM_BROADCAST(BinaryEWBroadcast, Div)
+
 }  // namespace core
 }  // namespace open3d
@@ -0,0 +1,264 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Hash map benchmarks on replayed voxel block key traces. Unlike the uniform
+// keys of HashMap.cpp, block keys of a depth stream are spatially clustered
+// and heavily duplicated within a batch, and consecutive batches overlap.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/DataManager.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+// Block size of a VoxelBlockGrid with 16^3 voxels of 3/512 m.
+static const float block_size = 16 * 3.f / 512.f;
+// Number of past batches kept in the map by the mixed benchmark.
+static const int erase_window = 3;
+
+/// Returns the voxel block keys, one {N, 3} Int32 batch per frame, of a
+/// recorded session. If OPEN3D_BENCHMARK_HASH_TRACE_DIR is set, the batches
+/// are the sorted .npy files in that directory, e.g. saved with
+/// Tensor::Save() from the points passed to
+/// VoxelBlockGrid::GetUniqueBlockCoordinates(). Otherwise the trace is
+/// recorded from the RGBD sequence of the common data root, with one key per
+/// valid depth pixel.
+static const std::vector<Tensor>& GetRecordedBlockKeys() {
+    static const std::vector<Tensor> batches = []() {
+        std::vector<Tensor> batches;
+        if (const char* dir = std::getenv("OPEN3D_BENCHMARK_HASH_TRACE_DIR")) {
+            std::vector<std::string> filenames;
+            utility::filesystem::ListFilesInDirectoryWithExtension(
+                    dir, "npy", filenames);
+            std::sort(filenames.begin(), filenames.end());
+            for (const std::string& filename : filenames) {
+                batches.push_back(Tensor::Load(filename).To(Int32));
+            }
+            return batches;
+        }
+
+        camera::PinholeCameraTrajectory trajectory;
+        io::ReadPinholeCameraTrajectory(
+                utility::GetDataPathCommon("RGBD/trajectory.log"), trajectory);
+        std::vector<std::string> depth_filenames;
+        utility::filesystem::ListFilesInDirectory(
+                utility::GetDataPathCommon("RGBD/depth"), depth_filenames);
+        std::sort(depth_filenames.begin(), depth_filenames.end());
+
+        const camera::PinholeCameraIntrinsic intrinsic(
+                camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+        const Tensor intrinsic_t = eigen_converter::EigenMatrixToTensor(
+                intrinsic.intrinsic_matrix_);
+        const size_t num_frames = std::min(depth_filenames.size(),
+                                           trajectory.parameters_.size());
+        for (size_t i = 0; i < num_frames; ++i) {
+            const t::geometry::PointCloud pcd =
+                    t::geometry::PointCloud::CreateFromDepthImage(
+                            *t::io::CreateImageFromFile(depth_filenames[i]),
+                            intrinsic_t,
+                            eigen_converter::EigenMatrixToTensor(
+                                    trajectory.parameters_[i].extrinsic_));
+            batches.push_back((pcd.GetPointPositions() / block_size)
+                                      .Floor()
+                                      .To(Int32));
+        }
+        return batches;
+    }();
+    return batches;
+}
+
+struct KeyTrace {
+    std::vector<Tensor> batches;
+    int64_t num_keys = 0;
+    int64_t num_unique_keys = 0;
+};
+
+/// Returns the recorded trace on \p device, keeping every \p stride-th key
+/// of each batch. Larger strides lower the duplicate ratio of a batch.
+static KeyTrace GetKeyTrace(int stride, const Device& device) {
+    const std::vector<Tensor>& recorded = GetRecordedBlockKeys();
+    if (recorded.empty()) {
+        utility::LogError("No hash map key trace found.");
+    }
+
+    KeyTrace trace;
+    HashSet unique_keys(1024, Int32, {3}, Device("CPU:0"));
+    for (const Tensor& batch : recorded) {
+        const Tensor keys =
+                batch.Slice(0, 0, batch.GetLength(), stride).Contiguous();
+        Tensor buf_indices, masks;
+        unique_keys.Insert(keys, buf_indices, masks);
+        trace.batches.push_back(keys.To(device));
+        trace.num_keys += keys.GetLength();
+    }
+    trace.num_unique_keys = unique_keys.Size();
+    return trace;
+}
+
+static int64_t GetCapacity(const KeyTrace& trace, int load_factor_pct) {
+    return std::max<int64_t>(
+            1, int64_t(std::ceil(trace.num_unique_keys * 100.0 /
+                                 load_factor_pct)));
+}
+
+static void ReportTrace(benchmark::State& state, const KeyTrace& trace) {
+    state.SetItemsProcessed(int64_t(state.iterations()) * trace.num_keys);
+    state.counters["keys"] = double(trace.num_keys);
+    state.counters["unique_keys"] = double(trace.num_unique_keys);
+    state.counters["duplicate_ratio"] =
+            1.0 - double(trace.num_unique_keys) / double(trace.num_keys);
+}
+
+/// Activates all batches of the trace, as VoxelBlockGrid does per frame.
+void HashTraceActivate(benchmark::State& state,
+                       int stride,
+                       int load_factor_pct,
+                       const Device& device,
+                       const HashBackendType& backend) {
+    const KeyTrace trace = GetKeyTrace(stride, device);
+    const int64_t capacity = GetCapacity(trace, load_factor_pct);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        HashMap hashmap(capacity, Int32, {3}, Float32, {1}, device, backend);
+        Tensor buf_indices, masks;
+        cuda::Synchronize(device);
+        state.ResumeTiming();
+
+        for (const Tensor& keys : trace.batches) {
+            hashmap.Activate(keys, buf_indices, masks);
+        }
+        cuda::Synchronize(device);
+    }
+    ReportTrace(state, trace);
+}
+
+/// Replays a sliding local map: each batch is activated and looked up, and
+/// the batch erase_window frames back is erased.
+void HashTraceMixed(benchmark::State& state,
+                    int stride,
+                    int load_factor_pct,
+                    const Device& device,
+                    const HashBackendType& backend) {
+    const KeyTrace trace = GetKeyTrace(stride, device);
+    const int64_t capacity = GetCapacity(trace, load_factor_pct);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        HashMap hashmap(capacity, Int32, {3}, Float32, {1}, device, backend);
+        Tensor buf_indices, masks;
+        cuda::Synchronize(device);
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < trace.batches.size(); ++i) {
+            hashmap.Activate(trace.batches[i], buf_indices, masks);
+            hashmap.Find(trace.batches[i], buf_indices, masks);
+            if (i >= size_t(erase_window)) {
+                hashmap.Erase(trace.batches[i - erase_window], masks);
+            }
+        }
+        cuda::Synchronize(device);
+    }
+    ReportTrace(state, trace);
+}
+
+/// Time to rehash a map that holds the whole trace at the given load factor
+/// into twice its capacity.
+void HashTraceRehash(benchmark::State& state,
+                     int stride,
+                     int load_factor_pct,
+                     const Device& device,
+                     const HashBackendType& backend) {
+    const KeyTrace trace = GetKeyTrace(stride, device);
+    const int64_t capacity = GetCapacity(trace, load_factor_pct);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        HashMap hashmap(capacity, Int32, {3}, Float32, {1}, device, backend);
+        Tensor buf_indices, masks;
+        for (const Tensor& keys : trace.batches) {
+            hashmap.Activate(keys, buf_indices, masks);
+        }
+        cuda::Synchronize(device);
+        state.ResumeTiming();
+
+        hashmap.Reserve(2 * capacity);
+        cuda::Synchronize(device);
+    }
+    ReportTrace(state, trace);
+}
+
+#define ENUM_BM_TRACE(FN, STRIDE, LOAD_FACTOR_PCT, DEVICE, BACKEND)           \
+    BENCHMARK_CAPTURE(FN, BACKEND##_stride##STRIDE##_load##LOAD_FACTOR_PCT,   \
+                      STRIDE, LOAD_FACTOR_PCT, DEVICE, BACKEND)               \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_TRACE_PARAMS(FN, DEVICE, BACKEND) \
+    ENUM_BM_TRACE(FN, 1, 50, DEVICE, BACKEND)     \
+    ENUM_BM_TRACE(FN, 1, 90, DEVICE, BACKEND)     \
+    ENUM_BM_TRACE(FN, 4, 50, DEVICE, BACKEND)     \
+    ENUM_BM_TRACE(FN, 4, 90, DEVICE, BACKEND)     \
+    ENUM_BM_TRACE(FN, 16, 50, DEVICE, BACKEND)    \
+    ENUM_BM_TRACE(FN, 16, 90, DEVICE, BACKEND)
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_BM_TRACE_BACKEND(FN)                                             \
+    ENUM_BM_TRACE_PARAMS(FN, Device("CPU:0"), HashBackendType::TBB)           \
+    ENUM_BM_TRACE_PARAMS(FN, Device("CPU:0"), HashBackendType::LinearProbing) \
+    ENUM_BM_TRACE_PARAMS(FN, Device("CUDA:0"), HashBackendType::Slab)         \
+    ENUM_BM_TRACE_PARAMS(FN, Device("CUDA:0"), HashBackendType::StdGPU)
+#else
+#define ENUM_BM_TRACE_BACKEND(FN)                                   \
+    ENUM_BM_TRACE_PARAMS(FN, Device("CPU:0"), HashBackendType::TBB) \
+    ENUM_BM_TRACE_PARAMS(FN, Device("CPU:0"), HashBackendType::LinearProbing)
+#endif
+
+ENUM_BM_TRACE_BACKEND(HashTraceActivate)
+ENUM_BM_TRACE_BACKEND(HashTraceMixed)
+ENUM_BM_TRACE_BACKEND(HashTraceRehash)
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+enum class NNSIndexType { KnnIndex, LBVHIndex };
+
+static void BuildIndex(nns::NearestNeighborSearch& nns,
+                       const NNSIndexType& index_type) {
+    bool ok = index_type == NNSIndexType::LBVHIndex ? nns.LBVHIndex()
+                                                    : nns.KnnIndex();
+    if (!ok) {
+        utility::LogError("Failed to build the nearest neighbor index.");
+    }
+}
+
+void KnnSearch(benchmark::State& state,
+               const Device& device,
+               const NNSIndexType& index_type) {
+    const int64_t num_points = state.range(0);
+    const int knn = 8;
+    std::vector<float> values(num_points * 3);
+    std::srand(0);
+    for (float& v : values) {
+        v = static_cast<float>(std::rand()) / RAND_MAX;
+    }
+    Tensor dataset_points =
+            Tensor(values, {num_points, 3}, Float32, Device("CPU:0"))
+                    .To(device);
+    Tensor query_points = dataset_points.Slice(0, 0, num_points, 10).Clone();
+
+    // Warm up.
+    {
+        nns::NearestNeighborSearch nns(dataset_points);
+        BuildIndex(nns, index_type);
+        nns.KnnSearch(query_points, knn);
+        core::cuda::Synchronize(device);
+    }
+
+    for (auto _ : state) {
+        nns::NearestNeighborSearch nns(dataset_points);
+        BuildIndex(nns, index_type);
+        nns.KnnSearch(query_points, knn);
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK_CAPTURE(KnnSearch,
+                  NanoFlann_CPU,
+                  Device("CPU:0"),
+                  NNSIndexType::KnnIndex)
+        ->RangeMultiplier(10)
+        ->Range(10000, 1000000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(KnnSearch,
+                  LBVH_CPU,
+                  Device("CPU:0"),
+                  NNSIndexType::LBVHIndex)
+        ->RangeMultiplier(10)
+        ->Range(10000, 1000000)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(KnnSearch,
+                  BruteForce_CUDA,
+                  Device("CUDA:0"),
+                  NNSIndexType::KnnIndex)
+        ->RangeMultiplier(10)
+        ->Range(10000, 1000000)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(KnnSearch,
+                  LBVH_CUDA,
+                  Device("CUDA:0"),
+                  NNSIndexType::LBVHIndex)
+        ->RangeMultiplier(10)
+        ->Range(10000, 1000000)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
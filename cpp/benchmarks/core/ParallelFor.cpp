@@ -28,8 +28,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Parallel.h"
+
 #ifdef BUILD_ISPC_MODULE
 #include "ParallelFor_ispc.h"
 #endif
@@ -89,6 +95,45 @@ void ParallelForVectorized(benchmark::State& state, int size) {
     }
 }
 
+/// Streams through two large host buffers under a NUMA placement policy and a
+/// thread affinity policy. The buffers are first touched by the calling thread
+/// only, so with NumaPolicy::FirstTouch all pages end up on a single node.
+void ParallelForNuma(benchmark::State& state,
+                     NumaPolicy policy,
+                     utility::ThreadAffinity affinity) {
+    const int64_t size = 1 << 26;
+    const NumaPolicy old_policy = CPUMemoryManager::GetNumaPolicy();
+    const int old_node = CPUMemoryManager::GetNumaNode();
+    const utility::ThreadAffinity old_affinity = utility::GetThreadAffinity();
+    CPUMemoryManager::SetNumaPolicy(policy, 0);
+    utility::SetThreadAffinity(affinity);
+
+    Tensor input = Tensor::Empty({size}, core::Float32, Device("CPU:0"));
+    Tensor output = Tensor::Empty({size}, core::Float32, Device("CPU:0"));
+    float* input_ptr = input.GetDataPtr<float>();
+    float* output_ptr = output.GetDataPtr<float>();
+    std::fill(input_ptr, input_ptr + size, 1.0f);
+    std::fill(output_ptr, output_ptr + size, 0.0f);
+
+    // Warmup.
+    {
+        core::ParallelFor(core::Device("CPU:0"), size, [&](int64_t idx) {
+            output_ptr[idx] = input_ptr[idx] * 2.0f;
+        });
+    }
+
+    for (auto _ : state) {
+        core::ParallelFor(core::Device("CPU:0"), size, [&](int64_t idx) {
+            output_ptr[idx] = input_ptr[idx] * 2.0f;
+        });
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * size * 2 *
+                            sizeof(float));
+
+    CPUMemoryManager::SetNumaPolicy(old_policy, old_node);
+    utility::SetThreadAffinity(old_affinity);
+}
+
 #define ENUM_BM_SIZE(FN)                                                       \
     BENCHMARK_CAPTURE(FN, CPU##100, 100)->Unit(benchmark::kMicrosecond);       \
     BENCHMARK_CAPTURE(FN, CPU##1000, 1000)->Unit(benchmark::kMicrosecond);     \
@@ -104,5 +149,26 @@ void ParallelForVectorized(benchmark::State& state, int size) {
 ENUM_BM_SIZE(ParallelForScalar)
 ENUM_BM_SIZE(ParallelForVectorized)
 
+BENCHMARK_CAPTURE(ParallelForNuma,
+                  FirstTouch_None,
+                  NumaPolicy::FirstTouch,
+                  utility::ThreadAffinity::None)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForNuma,
+                  FirstTouch_Scatter,
+                  NumaPolicy::FirstTouch,
+                  utility::ThreadAffinity::Scatter)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForNuma,
+                  Interleave_Scatter,
+                  NumaPolicy::Interleave,
+                  utility::ThreadAffinity::Scatter)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ParallelForNuma,
+                  Bind0_Compact,
+                  NumaPolicy::Bind,
+                  utility::ThreadAffinity::Compact)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace core
 }  // namespace open3d
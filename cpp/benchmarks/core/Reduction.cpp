@@ -26,6 +26,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "benchmarks/benchmark_utilities/Rand.h"
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dtype.h"
@@ -57,5 +58,87 @@ BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 #endif
 
+enum class ReductionOpCode { Sum, Min, ArgMax };
+
+enum class ReductionLayout {
+    Inner,    // (N / 64, 64) reduced over dim 1
+    Outer,    // (N / 3, 3) reduced over dim 0, e.g. point cloud bounds
+    Strided,  // Transposed (64, N / 64) reduced over dim 1
+};
+
+void ReductionLayouts(benchmark::State& state,
+                      int64_t size,
+                      ReductionOpCode op_code,
+                      ReductionLayout layout,
+                      const Dtype& dtype,
+                      const Device& device) {
+    Tensor src;
+    SizeVector dims;
+    switch (layout) {
+        case ReductionLayout::Inner:
+            src = benchmarks::Rand({size / 64, 64}, 1, {0, 127}, dtype, device);
+            dims = {1};
+            break;
+        case ReductionLayout::Outer:
+            src = benchmarks::Rand({size / 3, 3}, 1, {0, 127}, dtype, device);
+            dims = {0};
+            break;
+        case ReductionLayout::Strided:
+            src = benchmarks::Rand({size / 64, 64}, 1, {0, 127}, dtype, device)
+                          .T();
+            dims = {1};
+            break;
+    }
+    auto op = [&]() {
+        switch (op_code) {
+            case ReductionOpCode::Sum:
+                return src.Sum(dims);
+            case ReductionOpCode::Min:
+                return src.Min(dims);
+            default:
+                return src.ArgMax(dims);
+        }
+    };
+
+    Tensor result = op();
+    benchmark::DoNotOptimize(result);
+
+    for (auto _ : state) {
+        Tensor result = op();
+        benchmark::DoNotOptimize(result);
+
+        cuda::Synchronize(device);
+    }
+}
+
+#define ENUM_BM_REDUCTION_SIZE(FN, OP, LAYOUT, DEVICE, DEVICE_NAME, DTYPE)    \
+    BENCHMARK_CAPTURE(FN, OP##_##LAYOUT##__##DEVICE_NAME##_##DTYPE##__100000, \
+                      100000, ReductionOpCode::OP, ReductionLayout::LAYOUT,   \
+                      DTYPE, DEVICE)                                          \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN,                                                     \
+                      OP##_##LAYOUT##__##DEVICE_NAME##_##DTYPE##__30000000,   \
+                      30000000, ReductionOpCode::OP, ReductionLayout::LAYOUT, \
+                      DTYPE, DEVICE)                                          \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_REDUCTION_LAYOUT(FN, OP, DEVICE, DEVICE_NAME, DTYPE)  \
+    ENUM_BM_REDUCTION_SIZE(FN, OP, Inner, DEVICE, DEVICE_NAME, DTYPE) \
+    ENUM_BM_REDUCTION_SIZE(FN, OP, Outer, DEVICE, DEVICE_NAME, DTYPE) \
+    ENUM_BM_REDUCTION_SIZE(FN, OP, Strided, DEVICE, DEVICE_NAME, DTYPE)
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_BM_REDUCTION(FN, OP)                                   \
+    ENUM_BM_REDUCTION_LAYOUT(FN, OP, Device("CPU:0"), CPU, Float32) \
+    ENUM_BM_REDUCTION_LAYOUT(FN, OP, Device("CUDA:0"), CUDA, Float32)
+#else
+#define ENUM_BM_REDUCTION(FN, OP) \
+    ENUM_BM_REDUCTION_LAYOUT(FN, OP, Device("CPU:0"), CPU, Float32)
+#endif
+
+ENUM_BM_REDUCTION(ReductionLayouts, Sum)
+ENUM_BM_REDUCTION(ReductionLayouts, Min)
+ENUM_BM_REDUCTION(ReductionLayouts, ArgMax)
+
 }  // namespace core
 }  // namespace open3d
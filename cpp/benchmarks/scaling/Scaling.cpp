@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Strong and weak scaling of hot CPU kernels over the number of threads.
+//
+// Each benchmark runs with the thread counts 1, 2, 4, ... up to the number of
+// physical cores, passed as the "threads" argument. Strong scaling keeps the
+// problem size fixed, weak scaling grows it linearly with the thread count,
+// so ideal scaling shows up as a constant time per iteration. Run
+//     benchmarks --benchmark_filter=Scaling --benchmark_format=json
+// or util/run_benchmarks.py to record and compare the results.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmarks/benchmark_utilities/Rand.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+#include "open3d/utility/CPUInfo.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace benchmarks {
+
+/// Limits all parallel regions to a number of threads within a scope.
+class ScopedMaxThreads {
+public:
+    explicit ScopedMaxThreads(int num_threads) {
+        utility::SetMaxThreads(num_threads);
+    }
+    ~ScopedMaxThreads() { utility::SetMaxThreads(0); }
+};
+
+/// Adds the thread counts 1, 2, 4, ... and the number of physical cores.
+static void ThreadCounts(benchmark::internal::Benchmark* b) {
+    const int num_cores = utility::CPUInfo::GetInstance().NumCores();
+    b->ArgName("threads");
+    for (int threads = 1; threads < num_cores; threads *= 2) {
+        b->Arg(threads);
+    }
+    b->Arg(num_cores);
+}
+
+/// Returns the problem size for the "threads" argument of \p state.
+static int64_t ProblemSize(const benchmark::State& state,
+                           int64_t base_size,
+                           bool weak) {
+    return weak ? base_size * state.range(0) : base_size;
+}
+
+static void ReportScaling(benchmark::State& state, int64_t size) {
+    state.SetItemsProcessed(int64_t(state.iterations()) * size);
+    state.counters["size"] = double(size);
+}
+
+static void ScalingParallelFor(benchmark::State& state,
+                               int64_t base_size,
+                               bool weak) {
+    const int64_t size = ProblemSize(state, base_size, weak);
+    ScopedMaxThreads scoped_max_threads(int(state.range(0)));
+    const core::Device device("CPU:0");
+    core::Tensor input = Rand({size}, 0, {0.0, 1.0}, core::Float32, device);
+    core::Tensor output = core::Tensor::Empty({size}, core::Float32, device);
+    const float* input_ptr = input.GetDataPtr<float>();
+    float* output_ptr = output.GetDataPtr<float>();
+
+    for (auto _ : state) {
+        core::ParallelFor(device, size, [&](int64_t idx) {
+            output_ptr[idx] = input_ptr[idx] * input_ptr[idx] + 1.0f;
+        });
+    }
+    ReportScaling(state, size);
+}
+
+static void ScalingReduction(benchmark::State& state,
+                             int64_t base_size,
+                             bool weak) {
+    const int64_t size = ProblemSize(state, base_size, weak);
+    ScopedMaxThreads scoped_max_threads(int(state.range(0)));
+    core::Tensor src = Rand({size}, 0, {0.0, 1.0}, core::Float32,
+                            core::Device("CPU:0"));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(src.Sum({0}));
+    }
+    ReportScaling(state, size);
+}
+
+/// KNN queries against a fixed data set; the problem size is the number of
+/// queries.
+static void ScalingKnnSearch(benchmark::State& state,
+                             int64_t base_size,
+                             bool weak) {
+    const int64_t size = ProblemSize(state, base_size, weak);
+    ScopedMaxThreads scoped_max_threads(int(state.range(0)));
+    const core::Device device("CPU:0");
+    core::Tensor dataset =
+            Rand({1 << 18, 3}, 0, {0.0, 1.0}, core::Float32, device);
+    core::Tensor queries =
+            Rand({size, 3}, 1, {0.0, 1.0}, core::Float32, device);
+    core::nns::NearestNeighborSearch nns(dataset);
+    if (!nns.KnnIndex()) {
+        utility::LogError("Failed to build the nearest neighbor index.");
+    }
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nns.KnnSearch(queries, 8));
+    }
+    ReportScaling(state, size);
+}
+
+/// TSDF integration of a synthetic depth image of a plane at 1.5 m; the
+/// problem size is the number of pixels.
+static void ScalingVoxelBlockGrid(benchmark::State& state,
+                                  int64_t base_size,
+                                  bool weak) {
+    const int64_t size = ProblemSize(state, base_size, weak);
+    ScopedMaxThreads scoped_max_threads(int(state.range(0)));
+    const core::Device device("CPU:0");
+    const int64_t rows = 480;
+    const int64_t cols = std::max<int64_t>(size / rows, 1);
+    const t::geometry::Image depth(
+            core::Tensor::Full({rows, cols, 1}, 1500, core::UInt16, device));
+    const core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{double(rows), 0, cols / 2.0}, {0, double(rows), rows / 2.0},
+             {0, 0, 1}});
+    const core::Tensor extrinsic = core::Tensor::Eye(4, core::Float64, device);
+
+    t::geometry::VoxelBlockGrid grid({"tsdf", "weight"},
+                                     {core::Float32, core::Float32},
+                                     {{1}, {1}}, 3.f / 512.f, 16, 50000,
+                                     device);
+    for (auto _ : state) {
+        const core::Tensor block_coords =
+                grid.GetUniqueBlockCoordinates(depth, intrinsic, extrinsic);
+        grid.Integrate(block_coords, depth, intrinsic, extrinsic);
+    }
+    ReportScaling(state, rows * cols);
+}
+
+#define OPEN3D_SCALING_BENCHMARK(FN, STRONG_SIZE, WEAK_SIZE)      \
+    BENCHMARK_CAPTURE(FN, Strong, STRONG_SIZE, false)             \
+            ->Apply(ThreadCounts)                                 \
+            ->Unit(benchmark::kMillisecond)                       \
+            ->UseRealTime();                                      \
+    BENCHMARK_CAPTURE(FN, Weak, WEAK_SIZE, true)                  \
+            ->Apply(ThreadCounts)                                 \
+            ->Unit(benchmark::kMillisecond)                       \
+            ->UseRealTime();
+
+OPEN3D_SCALING_BENCHMARK(ScalingParallelFor, int64_t(1) << 26,
+                         int64_t(1) << 22)
+OPEN3D_SCALING_BENCHMARK(ScalingReduction, int64_t(1) << 26, int64_t(1) << 22)
+OPEN3D_SCALING_BENCHMARK(ScalingKnnSearch, int64_t(1) << 18, int64_t(1) << 15)
+OPEN3D_SCALING_BENCHMARK(ScalingVoxelBlockGrid,
+                         int64_t(640 * 480),
+                         int64_t(80 * 480))
+
+}  // namespace benchmarks
+}  // namespace open3d
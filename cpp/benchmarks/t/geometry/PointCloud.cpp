@@ -28,9 +28,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cstdlib>
+#include <vector>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/t/geometry/PointCloudBuilder.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/DataManager.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
@@ -75,6 +80,81 @@ void ToLegacyPointCloud(benchmark::State& state, const core::Device& device) {
     }
 }
 
+void AppendPointClouds(benchmark::State& state,
+                       const core::Device& device,
+                       bool use_builder) {
+    // 1000 scans of 1000 points each.
+    const int64_t num_scans = 1000;
+    PointCloud scan(device);
+    scan.SetPointPositions(core::Tensor({1000, 3}, core::Float32, device));
+    scan.SetPointColors(core::Tensor({1000, 3}, core::Float32, device));
+
+    for (auto _ : state) {
+        if (use_builder) {
+            PointCloudBuilder builder(device);
+            for (int64_t i = 0; i < num_scans; ++i) {
+                builder.Append(scan);
+            }
+            PointCloud pcd = builder.ToPointCloud();
+        } else {
+            PointCloud pcd = scan;
+            for (int64_t i = 1; i < num_scans; ++i) {
+                pcd = pcd.Append(scan);
+            }
+        }
+        core::cuda::Synchronize(device);
+    }
+}
+
+void UniformDownSampleAttributes(benchmark::State& state,
+                                 const core::Device& device) {
+    // 1M points with 12 attributes, gathered with a single launch.
+    const int64_t num_points = 1000000;
+    PointCloud pcd(device);
+    pcd.SetPointPositions(core::Tensor({num_points, 3}, core::Float32, device));
+    for (int i = 0; i < 11; ++i) {
+        pcd.SetPointAttr(fmt::format("attr_{}", i),
+                         core::Tensor({num_points, 1}, core::Float32, device));
+    }
+
+    // Warm up.
+    PointCloud pcd_down = pcd.UniformDownSample(2);
+    (void)pcd_down;
+
+    for (auto _ : state) {
+        PointCloud pcd_down = pcd.UniformDownSample(2);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void KnnSearchSpatialOrder(benchmark::State& state,
+                           bool sort,
+                           PointCloud::SpatialSortMethod method) {
+    // 1M points in sensor-like random order, all of which are queried.
+    const int64_t num_points = 1000000;
+    std::vector<float> values(num_points * 3);
+    std::srand(0);
+    for (float& v : values) {
+        v = static_cast<float>(std::rand()) / RAND_MAX;
+    }
+    PointCloud pcd(core::Tensor(values, {num_points, 3}, core::Float32,
+                                core::Device("CPU:0")));
+    if (sort) {
+        pcd = std::get<0>(pcd.SortBySpatialLocality(method));
+    }
+
+    core::nns::NearestNeighborSearch nns(pcd.GetPointPositions());
+    nns.KnnIndex();
+
+    // Warm up.
+    nns.KnnSearch(pcd.GetPointPositions(), 8);
+
+    for (auto _ : state) {
+        nns.KnnSearch(pcd.GetPointPositions(), 8);
+    }
+    state.SetItemsProcessed(state.iterations() * num_points);
+}
+
 static const std::string path = utility::GetDataPathCommon("fragment.ply");
 
 void LegacyVoxelDownSample(benchmark::State& state, float voxel_size) {
@@ -170,12 +250,42 @@ BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
 BENCHMARK_CAPTURE(ToLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_CAPTURE(AppendPointClouds, CPU_Append, core::Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(AppendPointClouds, CPU_Builder, core::Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UniformDownSampleAttributes, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(KnnSearchSpatialOrder,
+                  Unsorted,
+                  false,
+                  PointCloud::SpatialSortMethod::Morton)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(KnnSearchSpatialOrder,
+                  Morton,
+                  true,
+                  PointCloud::SpatialSortMethod::Morton)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(KnnSearchSpatialOrder,
+                  Hilbert,
+                  true,
+                  PointCloud::SpatialSortMethod::Hilbert)
+        ->Unit(benchmark::kMillisecond);
+
 #ifdef BUILD_CUDA_MODULE
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(ToLegacyPointCloud, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(AppendPointClouds, CUDA_Append, core::Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(AppendPointClouds, CUDA_Builder, core::Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(UniformDownSampleAttributes, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
 #endif
 
 #define ENUM_VOXELSIZE(DEVICE, BACKEND)                                       \
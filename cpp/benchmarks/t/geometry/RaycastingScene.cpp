@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PointCloud.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void CastRays(benchmark::State& state, const bool coherent) {
+    auto sphere = open3d::geometry::TriangleMesh::CreateSphere(1.0, 100);
+    RaycastingScene scene;
+    scene.AddTriangles(TriangleMesh::FromLegacy(*sphere));
+
+    // Camera rays in image order are coherent.
+    core::Tensor rays = RaycastingScene::CreateRaysPinhole(
+            90, core::Tensor::Init<float>({0, 0, 0}),
+            core::Tensor::Init<float>({3, 0, 0}),
+            core::Tensor::Init<float>({0, 0, 1}), 1280, 960);
+
+    // Warm up, this also builds the acceleration structure.
+    auto result = scene.CastRays(rays, 0, coherent);
+    (void)result;
+
+    for (auto _ : state) {
+        auto result = scene.CastRays(rays, 0, coherent);
+    }
+}
+
+void CastRaysRandom(benchmark::State& state, const bool coherent) {
+    auto sphere = open3d::geometry::TriangleMesh::CreateSphere(1.0, 100);
+    RaycastingScene scene;
+    scene.AddTriangles(TriangleMesh::FromLegacy(*sphere));
+
+    // Rays with random origins and directions are incoherent.
+    core::Tensor rays({1280 * 960, 6}, core::Float32);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    float* rays_ptr = rays.GetDataPtr<float>();
+    for (int64_t i = 0; i < rays.NumElements(); ++i) {
+        rays_ptr[i] = dist(rng);
+    }
+
+    // Warm up, this also builds the acceleration structure.
+    auto result = scene.CastRays(rays, 0, coherent);
+    (void)result;
+
+    for (auto _ : state) {
+        auto result = scene.CastRays(rays, 0, coherent);
+    }
+}
+
+void RenderDepth(benchmark::State& state) {
+    auto sphere = open3d::geometry::TriangleMesh::CreateSphere(1.0, 100);
+    RaycastingScene scene;
+    scene.AddTriangles(TriangleMesh::FromLegacy(*sphere));
+
+    // Same camera as in CastRays.
+    core::Tensor intrinsic_matrix = core::Tensor::Init<double>(
+            {{640, 0, 640}, {0, 640, 480}, {0, 0, 1}});
+    core::Tensor extrinsic_matrix = core::Tensor::Init<double>(
+            {{0, -1, 0, 0}, {0, 0, 1, 0}, {-1, 0, 0, 3}, {0, 0, 0, 1}});
+
+    // Warm up, this also builds the acceleration structure.
+    Image depth =
+            scene.RenderDepth(intrinsic_matrix, extrinsic_matrix, 1280, 960);
+    (void)depth;
+
+    for (auto _ : state) {
+        Image depth = scene.RenderDepth(intrinsic_matrix, extrinsic_matrix,
+                                        1280, 960);
+    }
+}
+
+BENCHMARK_CAPTURE(CastRays, Stream, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CastRays, Coherent, true)->Unit(benchmark::kMillisecond);
+BENCHMARK(RenderDepth)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CastRaysRandom, Stream, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CastRaysRandom, Coherent, true)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/TriangleMesh.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/DataManager.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static TriangleMesh LoadKnot(const core::Device& device) {
+    auto legacy = open3d::io::CreateMeshFromFile(
+            utility::GetDataPathCommon("knot.ply"));
+    return TriangleMesh::FromLegacy(*legacy, core::Float32, core::Int64,
+                                    device);
+}
+
+void SamplePointsUniformly(benchmark::State& state,
+                           const core::Device& device,
+                           int64_t number_of_points) {
+    const TriangleMesh mesh = LoadKnot(device);
+
+    // Warm up.
+    PointCloud pcd = mesh.SamplePointsUniformly(number_of_points);
+    (void)pcd;
+
+    for (auto _ : state) {
+        PointCloud pcd = mesh.SamplePointsUniformly(number_of_points);
+        core::cuda::Synchronize(device);
+    }
+}
+
+void SamplePointsPoissonDisk(benchmark::State& state,
+                             const core::Device& device,
+                             int64_t number_of_points) {
+    const TriangleMesh mesh = LoadKnot(device);
+
+    // Warm up.
+    PointCloud pcd = mesh.SamplePointsPoissonDisk(number_of_points);
+    (void)pcd;
+
+    for (auto _ : state) {
+        PointCloud pcd = mesh.SamplePointsPoissonDisk(number_of_points);
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK_CAPTURE(SamplePointsUniformly,
+                  CPU 1000,
+                  core::Device("CPU:0"),
+                  1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SamplePointsUniformly,
+                  CPU 1000000,
+                  core::Device("CPU:0"),
+                  1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SamplePointsPoissonDisk,
+                  CPU 1000,
+                  core::Device("CPU:0"),
+                  1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SamplePointsPoissonDisk,
+                  CPU 100000,
+                  core::Device("CPU:0"),
+                  100000)
+        ->Unit(benchmark::kMillisecond);
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SamplePointsUniformly,
+                  CUDA 1000,
+                  core::Device("CUDA:0"),
+                  1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SamplePointsUniformly,
+                  CUDA 1000000,
+                  core::Device("CUDA:0"),
+                  1000000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SamplePointsPoissonDisk,
+                  CUDA 1000,
+                  core::Device("CUDA:0"),
+                  1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SamplePointsPoissonDisk,
+                  CUDA 100000,
+                  core::Device("CUDA:0"),
+                  100000)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,299 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+// Read and write throughput of point cloud and image formats from 1M to 100M
+// points or pixels, with a cold or warm page cache.
+//
+// Files are written to OPEN3D_BENCHMARK_IO_DIR (default: the working
+// directory), so that the same matrix can be run on different storage media,
+// e.g. an SSD, a network share or tmpfs. The "bytes_per_second" column is the
+// file size over the time per iteration and "peak_rss_MB" the peak resident
+// memory of the process while the benchmark ran. To run the matrix:
+//     ./bin/benchmarks --benchmark_filter="IOMatrix.*"
+// Cold cache reads drop the file from the page cache before each iteration,
+// which is only supported on Linux.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+static std::string GetBenchmarkFilePath(const std::string& label,
+                                        int64_t size,
+                                        const std::string& extension) {
+    const char* dir = std::getenv("OPEN3D_BENCHMARK_IO_DIR");
+    return std::string(dir ? dir : ".") + "/io_matrix_" + label + "_" +
+           std::to_string(size) + "." + extension;
+}
+
+static int64_t GetFileSize(const std::string& path) {
+    utility::filesystem::CFile file;
+    return file.Open(path, "rb") ? file.GetFileSize() : 0;
+}
+
+/// Evicts \p path from the page cache, so that the next read hits the
+/// storage medium. Returns false if not supported.
+static bool DropFileCache(const std::string& path) {
+#ifdef __linux__
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    // Dirty pages are not evicted.
+    fdatasync(fd);
+    const bool ok = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+    close(fd);
+    return ok;
+#else
+    (void)path;
+    return false;
+#endif
+}
+
+/// Resets the peak resident set size of the process. Only supported on
+/// Linux.
+static void ResetPeakRSS() {
+#ifdef __linux__
+    std::ofstream("/proc/self/clear_refs") << "5";
+#endif
+}
+
+/// Returns the peak resident set size of the process in bytes, or 0 if
+/// unknown.
+static int64_t GetPeakRSS() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "VmHWM:") {
+            int64_t kb = 0;
+            status >> kb;
+            return kb * 1024;
+        }
+    }
+#endif
+    return 0;
+}
+
+static void ReportIO(benchmark::State& state, const std::string& path) {
+    state.SetBytesProcessed(int64_t(state.iterations()) * GetFileSize(path));
+    state.counters["file_size_MB"] = GetFileSize(path) / (1024.0 * 1024.0);
+    state.counters["peak_rss_MB"] = GetPeakRSS() / (1024.0 * 1024.0);
+}
+
+/// Synthetic scan with positions and, unless \p positions_only, UInt8
+/// colors.
+static geometry::PointCloud MakePointCloud(int64_t num_points,
+                                           bool positions_only) {
+    geometry::PointCloud pcd(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                    .Reshape({num_points, 3})
+                    .Div(float(num_points)));
+    if (!positions_only) {
+        pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1,
+                                                core::Int64)
+                                   .Reshape({num_points, 3})
+                                   .To(core::UInt8));
+    }
+    return pcd;
+}
+
+/// Square RGB image with about \p num_pixels pixels and a smooth gradient.
+static geometry::Image MakeImage(int64_t num_pixels) {
+    const int64_t side = int64_t(std::sqrt(double(num_pixels)));
+    return geometry::Image(core::Tensor::Arange(0, side * side * 3, 1,
+                                                core::Int64)
+                                   .Div(int64_t(side / 256 + 1))
+                                   .Reshape({side, side, 3})
+                                   .To(core::UInt8));
+}
+
+void IOMatrixWritePointCloud(benchmark::State& state,
+                             const std::string& label,
+                             const std::string& extension,
+                             bool write_ascii,
+                             bool write_compressed) {
+    const int64_t num_points = state.range(0);
+    const std::string path =
+            GetBenchmarkFilePath(label, num_points, extension);
+    const geometry::PointCloud pcd =
+            MakePointCloud(num_points, extension == "xyz");
+    const open3d::io::WritePointCloudOption option(write_ascii,
+                                                   write_compressed, false, {});
+
+    ResetPeakRSS();
+    for (auto _ : state) {
+        WritePointCloud(path, pcd, option);
+    }
+    ReportIO(state, path);
+    utility::filesystem::RemoveFile(path);
+}
+
+void IOMatrixReadPointCloud(benchmark::State& state,
+                            const std::string& label,
+                            const std::string& extension,
+                            bool write_ascii,
+                            bool write_compressed,
+                            bool cold_cache) {
+    const int64_t num_points = state.range(0);
+    const std::string path =
+            GetBenchmarkFilePath(label, num_points, extension);
+    WritePointCloud(path, MakePointCloud(num_points, extension == "xyz"),
+                    open3d::io::WritePointCloudOption(
+                            write_ascii, write_compressed, false, {}));
+
+    geometry::PointCloud pcd;
+    if (!cold_cache) {
+        ReadPointCloud(path, pcd, {"auto", false, false, false});
+    }
+    pcd.Clear();
+    ResetPeakRSS();
+    for (auto _ : state) {
+        if (cold_cache) {
+            state.PauseTiming();
+            pcd.Clear();
+            if (!DropFileCache(path)) {
+                state.SkipWithError("Cannot drop the page cache.");
+                break;
+            }
+            state.ResumeTiming();
+        }
+        ReadPointCloud(path, pcd, {"auto", false, false, false});
+    }
+    ReportIO(state, path);
+    utility::filesystem::RemoveFile(path);
+}
+
+void IOMatrixWriteImage(benchmark::State& state,
+                        const std::string& extension) {
+    const int64_t num_pixels = state.range(0);
+    const std::string path =
+            GetBenchmarkFilePath(extension, num_pixels, extension);
+    const geometry::Image image = MakeImage(num_pixels);
+
+    ResetPeakRSS();
+    for (auto _ : state) {
+        WriteImage(path, image);
+    }
+    ReportIO(state, path);
+    utility::filesystem::RemoveFile(path);
+}
+
+void IOMatrixReadImage(benchmark::State& state,
+                       const std::string& extension,
+                       bool cold_cache) {
+    const int64_t num_pixels = state.range(0);
+    const std::string path =
+            GetBenchmarkFilePath(extension, num_pixels, extension);
+    WriteImage(path, MakeImage(num_pixels));
+
+    geometry::Image image;
+    if (!cold_cache) {
+        ReadImage(path, image);
+    }
+    ResetPeakRSS();
+    for (auto _ : state) {
+        if (cold_cache) {
+            state.PauseTiming();
+            if (!DropFileCache(path)) {
+                state.SkipWithError("Cannot drop the page cache.");
+                break;
+            }
+            state.ResumeTiming();
+        }
+        ReadImage(path, image);
+    }
+    ReportIO(state, path);
+    utility::filesystem::RemoveFile(path);
+}
+
+static void Sizes(benchmark::internal::Benchmark* b) {
+    b->Arg(1000000)->Arg(10000000)->Arg(100000000);
+    b->Unit(benchmark::kMillisecond);
+}
+
+// ASCII formats are limited to 10M points, which already take minutes.
+static void AsciiSizes(benchmark::internal::Benchmark* b) {
+    b->Arg(1000000)->Arg(10000000);
+    b->Unit(benchmark::kMillisecond);
+}
+
+#define ENUM_BM_IO_MATRIX_POINT_CLOUD(LABEL, EXTENSION, ASCII, COMPRESSED, \
+                                      SIZES)                               \
+    BENCHMARK_CAPTURE(IOMatrixWritePointCloud, LABEL, #LABEL, EXTENSION,   \
+                      ASCII, COMPRESSED)                                   \
+            ->Apply(SIZES);                                                \
+    BENCHMARK_CAPTURE(IOMatrixReadPointCloud, LABEL##_warm, #LABEL,        \
+                      EXTENSION, ASCII, COMPRESSED, false)                 \
+            ->Apply(SIZES);                                                \
+    BENCHMARK_CAPTURE(IOMatrixReadPointCloud, LABEL##_cold, #LABEL,        \
+                      EXTENSION, ASCII, COMPRESSED, true)                  \
+            ->Apply(SIZES);
+
+ENUM_BM_IO_MATRIX_POINT_CLOUD(ply_ascii, "ply", true, false, AsciiSizes)
+ENUM_BM_IO_MATRIX_POINT_CLOUD(ply_binary, "ply", false, false, Sizes)
+ENUM_BM_IO_MATRIX_POINT_CLOUD(pcd_ascii, "pcd", true, false, AsciiSizes)
+ENUM_BM_IO_MATRIX_POINT_CLOUD(pcd_binary, "pcd", false, false, Sizes)
+ENUM_BM_IO_MATRIX_POINT_CLOUD(pcd_binary_compressed, "pcd", false, true, Sizes)
+ENUM_BM_IO_MATRIX_POINT_CLOUD(npz, "npz", false, false, Sizes)
+ENUM_BM_IO_MATRIX_POINT_CLOUD(xyz, "xyz", true, false, AsciiSizes)
+// Chunked formats with streaming readers.
+ENUM_BM_IO_MATRIX_POINT_CLOUD(o3dpc, "o3dpc", false, false, Sizes)
+ENUM_BM_IO_MATRIX_POINT_CLOUD(las, "las", false, false, Sizes)
+
+#define ENUM_BM_IO_MATRIX_IMAGE(EXTENSION)                                    \
+    BENCHMARK_CAPTURE(IOMatrixWriteImage, EXTENSION, #EXTENSION)              \
+            ->Apply(Sizes);                                                   \
+    BENCHMARK_CAPTURE(IOMatrixReadImage, EXTENSION##_warm, #EXTENSION, false) \
+            ->Apply(Sizes);                                                   \
+    BENCHMARK_CAPTURE(IOMatrixReadImage, EXTENSION##_cold, #EXTENSION, true)  \
+            ->Apply(Sizes);
+
+ENUM_BM_IO_MATRIX_IMAGE(png)
+ENUM_BM_IO_MATRIX_IMAGE(jpg)
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
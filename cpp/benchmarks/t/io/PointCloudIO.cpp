@@ -143,6 +143,57 @@ void IOReadTensorPointCloud(benchmark::State& state,
             std::string("pcd_bin_compressed") + std::string(EXTENSION),        \
             BINARY_COMPRESSED, false, true)
 
+// Synthetic point cloud with positions, normals and colors, used to measure
+// the binary_compressed PCD codec across file sizes.
+static t::geometry::PointCloud MakeCompressedPCDBenchmarkPointCloud(
+        int64_t num_points) {
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                    .Reshape({num_points, 3})
+                    .Div(num_points));
+    pcd.SetPointNormals(core::Tensor::Ones({num_points, 3}, core::Float32));
+    pcd.SetPointColors(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                    .Reshape({num_points, 3})
+                    .To(core::UInt8));
+    return pcd;
+}
+
+void IOWriteTensorCompressedPCD(benchmark::State& state) {
+    const std::string file_name = "tensor_pcd_bin_compressed_sized.pcd";
+    const t::geometry::PointCloud pcd =
+            MakeCompressedPCDBenchmarkPointCloud(state.range(0));
+    const open3d::io::WritePointCloudOption option(false, true, false, {});
+
+    for (auto _ : state) {
+        t::io::WritePointCloud(file_name, pcd, option);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void IOReadTensorCompressedPCD(benchmark::State& state) {
+    const std::string file_name = "tensor_pcd_bin_compressed_sized.pcd";
+    t::io::WritePointCloud(file_name,
+                           MakeCompressedPCDBenchmarkPointCloud(state.range(0)),
+                           open3d::io::WritePointCloudOption(false, true,
+                                                             false, {}));
+
+    t::geometry::PointCloud pcd;
+    for (auto _ : state) {
+        t::io::ReadPointCloud(file_name, pcd, {"auto", false, false, false});
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(IOWriteTensorCompressedPCD)
+        ->RangeMultiplier(8)
+        ->Range(1 << 12, 1 << 24)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(IOReadTensorCompressedPCD)
+        ->RangeMultiplier(8)
+        ->Range(1 << 12, 1 << 24)
+        ->Unit(benchmark::kMillisecond);
+
 ENUM_BM_IO_EXTENSION(PCD, ".pcd")
 ENUM_BM_IO_EXTENSION(PLY, ".ply")
 ENUM_BM_IO_EXTENSION(PTS, ".pts")
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <benchmark/benchmark.h>
+
+#include "benchmarks/benchmark_utilities/StageTimer.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/registration/Feature.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/DataManager.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+// Global registration parameters, with FPFH radius ~5x the voxel size.
+static const double voxel_size = 0.05;
+static const double fpfh_radius = 5 * voxel_size;
+static const int fpfh_max_nn = 100;
+static const double ransac_distance = 1.5 * voxel_size;
+static const double icp_distance = 0.4 * voxel_size;
+
+/// Registers a pair of fragments without an initial guess in each iteration:
+/// downsampling, FPFH features, feature-based RANSAC and point-to-plane ICP
+/// refinement.
+static void EndToEndGlobalRegistration(benchmark::State& state,
+                                       const core::Device& device) {
+    geometry::PointCloud source, target;
+    io::ReadPointCloud(utility::GetDataPathCommon("ICP/cloud_bin_0.pcd"),
+                       source, {"auto", false, false, true});
+    io::ReadPointCloud(utility::GetDataPathCommon("ICP/cloud_bin_1.pcd"),
+                       target, {"auto", false, false, true});
+    source = source.To(device);
+    target = target.To(device);
+
+    benchmarks::StageTimer timer(device);
+    int64_t num_pairs = 0;
+    for (auto _ : state) {
+        geometry::PointCloud source_down, target_down;
+        timer.Time("downsample", [&]() {
+            source_down = source.VoxelDownSample(voxel_size);
+            target_down = target.VoxelDownSample(voxel_size);
+        });
+        core::Tensor source_fpfh, target_fpfh;
+        timer.Time("fpfh", [&]() {
+            source_fpfh =
+                    ComputeFPFHFeature(source_down, fpfh_max_nn, fpfh_radius);
+            target_fpfh =
+                    ComputeFPFHFeature(target_down, fpfh_max_nn, fpfh_radius);
+        });
+        RegistrationResult result;
+        timer.Time("ransac", [&]() {
+            result = RANSACFromFeatures(source_down, target_down, source_fpfh,
+                                        target_fpfh, ransac_distance,
+                                        /*mutual_filter=*/true);
+        });
+        timer.Time("icp", [&]() {
+            result = ICP(source, target, icp_distance,
+                         result.transformation_,
+                         TransformationEstimationPointToPlane());
+        });
+        num_pairs++;
+    }
+    timer.Report(state, num_pairs);
+}
+
+BENCHMARK_CAPTURE(EndToEndGlobalRegistration, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(EndToEndGlobalRegistration, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <tuple>
+
+#include "benchmarks/benchmark_utilities/StageTimer.h"
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/slam/Model.h"
+#include "open3d/utility/DataManager.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+// Reconstruction parameters, as in examples/cpp/DenseSLAM.cpp.
+static const float voxel_size = 3.f / 512.f;
+static const int block_resolution = 16;
+static const int block_count = 40000;
+static const float depth_scale = 1000.f;
+static const float depth_max = 3.f;
+static const float depth_diff = 0.07f;
+
+/// Returns the sorted color and depth files of the RGBD sequence. The
+/// sequence in the common data root is used unless OPEN3D_BENCHMARK_RGBD_DIR
+/// points to a folder with "color" and "depth" subfolders, such as a
+/// downloaded TUM or Redwood sequence.
+static std::pair<std::vector<std::string>, std::vector<std::string>>
+ListRGBDSequence() {
+    const char* env = std::getenv("OPEN3D_BENCHMARK_RGBD_DIR");
+    const std::string root = env ? std::string(env)
+                                 : utility::GetDataPathCommon("RGBD");
+    std::vector<std::string> color_filenames, depth_filenames;
+    utility::filesystem::ListFilesInDirectory(root + "/color", color_filenames);
+    utility::filesystem::ListFilesInDirectory(root + "/depth", depth_filenames);
+    if (color_filenames.size() != depth_filenames.size()) {
+        utility::LogError("Numbers of color and depth files in {} mismatch.",
+                          root);
+    }
+    std::sort(color_filenames.begin(), color_filenames.end());
+    std::sort(depth_filenames.begin(), depth_filenames.end());
+    return std::make_pair(color_filenames, depth_filenames);
+}
+
+static core::Tensor CreateIntrinsicTensor() {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    return core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+}
+
+/// Runs the dense SLAM loop over the whole sequence in each iteration:
+/// tracking, integration and raycasting per frame, then point cloud and mesh
+/// extraction. Frames are decoded onto the device beforehand, so file IO is
+/// not measured.
+static void EndToEndSLAM(benchmark::State& state, const core::Device& device) {
+    std::vector<std::string> color_filenames, depth_filenames;
+    std::tie(color_filenames, depth_filenames) = ListRGBDSequence();
+    if (depth_filenames.empty()) {
+        state.SkipWithError("No RGBD frames found.");
+        return;
+    }
+
+    std::vector<geometry::Image> colors, depths;
+    for (size_t i = 0; i < depth_filenames.size(); ++i) {
+        colors.push_back(
+                t::io::CreateImageFromFile(color_filenames[i])->To(device));
+        depths.push_back(
+                t::io::CreateImageFromFile(depth_filenames[i])->To(device));
+    }
+    const core::Tensor intrinsic = CreateIntrinsicTensor();
+
+    benchmarks::StageTimer timer(device);
+    int64_t num_frames = 0;
+    for (auto _ : state) {
+        core::Tensor T_frame_to_model =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+        Model model(voxel_size, block_resolution, block_count,
+                    T_frame_to_model, device);
+        Frame input_frame(depths[0].GetRows(), depths[0].GetCols(), intrinsic,
+                          device);
+        Frame raycast_frame(depths[0].GetRows(), depths[0].GetCols(),
+                            intrinsic, device);
+
+        for (size_t i = 0; i < depths.size(); ++i) {
+            input_frame.SetDataFromImage("depth", depths[i]);
+            input_frame.SetDataFromImage("color", colors[i]);
+            if (i > 0) {
+                timer.Time("track", [&]() {
+                    odometry::OdometryResult result = model.TrackFrameToModel(
+                            input_frame, raycast_frame, depth_scale, depth_max,
+                            depth_diff);
+                    T_frame_to_model =
+                            T_frame_to_model.Matmul(result.transformation_);
+                });
+            }
+            model.UpdateFramePose(int(i), T_frame_to_model);
+            timer.Time("integrate", [&]() {
+                model.Integrate(input_frame, depth_scale, depth_max);
+            });
+            timer.Time("raycast", [&]() {
+                model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.1,
+                                           depth_max, false);
+            });
+        }
+        timer.Time("extract_pointcloud",
+                   [&]() { model.ExtractPointCloud(); });
+        timer.Time("extract_mesh", [&]() { model.ExtractTriangleMesh(); });
+        num_frames += int64_t(depths.size());
+    }
+    timer.Report(state, num_frames);
+}
+
+BENCHMARK_CAPTURE(EndToEndSLAM, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(EndToEndSLAM, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+#endif
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
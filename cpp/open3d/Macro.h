@@ -59,6 +59,24 @@
 #define OPEN3D_FUNCTION __PRETTY_FUNCTION__
 #endif
 
+// Function multiversioning for hot loops of CPU kernels. The function is
+// compiled for AVX-512, AVX2 and the baseline ISA, and the dynamic loader picks
+// the best version for the running CPU, so that distribution builds targeting
+// a baseline ISA still use wide vectors. See also
+// utility::ISAInfo::CPUDispatchTarget(). Expands to nothing where ifunc is not
+// available.
+// Usage:
+//     template <typename T>
+//     OPEN3D_CPU_DISPATCH static T Sum(const T* data, int64_t n);
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 6 && \
+        defined(__x86_64__) && defined(__linux__) && !defined(__CUDACC__)
+#define OPEN3D_CPU_DISPATCH_ENABLED
+#define OPEN3D_CPU_DISPATCH \
+    __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define OPEN3D_CPU_DISPATCH
+#endif
+
 // Assertion for CUDA device code.
 // Usage:
 //     OPEN3D_ASSERT(condition);
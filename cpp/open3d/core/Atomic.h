@@ -27,11 +27,19 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "open3d/core/CUDAUtils.h"
 
 #ifdef MSC_VER
 #include <intrin.h>
 #pragma intrinsic(_InterlockedExchangeAdd)
 #pragma intrinsic(_InterlockedExchangeAdd64)
+#pragma intrinsic(_InterlockedCompareExchange8)
+#pragma intrinsic(_InterlockedCompareExchange16)
+#pragma intrinsic(_InterlockedCompareExchange)
+#pragma intrinsic(_InterlockedCompareExchange64)
 #endif
 
 namespace open3d {
@@ -69,5 +77,275 @@ inline uint64_t AtomicFetchAddRelaxed(uint64_t* address, uint64_t val) {
 #endif
 }
 
+namespace atomic_detail {
+
+template <size_t N>
+struct Word;
+template <>
+struct Word<1> {
+    using type = uint8_t;
+};
+template <>
+struct Word<2> {
+    using type = uint16_t;
+};
+template <>
+struct Word<4> {
+    using type = uint32_t;
+};
+template <>
+struct Word<8> {
+    using type = uint64_t;
+};
+
+template <typename to_t, typename from_t>
+OPEN3D_HOST_DEVICE inline to_t BitCast(from_t from) {
+    static_assert(sizeof(to_t) == sizeof(from_t), "Size mismatch.");
+    to_t to;
+    memcpy(&to, &from, sizeof(to_t));
+    return to;
+}
+
+#if defined(__CUDA_ARCH__)
+template <typename scalar_t, typename func_t>
+__device__ inline void ApplyCAS(scalar_t* address,
+                                scalar_t val,
+                                func_t func,
+                                std::integral_constant<size_t, 4>) {
+    unsigned int* word = reinterpret_cast<unsigned int*>(address);
+    unsigned int old = *word;
+    unsigned int assumed;
+    do {
+        assumed = old;
+        const unsigned int desired = BitCast<unsigned int>(
+                func(BitCast<scalar_t>(assumed), val));
+        if (desired == assumed) {
+            return;
+        }
+        old = atomicCAS(word, assumed, desired);
+    } while (assumed != old);
+}
+
+template <typename scalar_t, typename func_t>
+__device__ inline void ApplyCAS(scalar_t* address,
+                                scalar_t val,
+                                func_t func,
+                                std::integral_constant<size_t, 8>) {
+    unsigned long long* word = reinterpret_cast<unsigned long long*>(address);
+    unsigned long long old = *word;
+    unsigned long long assumed;
+    do {
+        assumed = old;
+        const unsigned long long desired = BitCast<unsigned long long>(
+                func(BitCast<scalar_t>(assumed), val));
+        if (desired == assumed) {
+            return;
+        }
+        old = atomicCAS(word, assumed, desired);
+    } while (assumed != old);
+}
+
+/// 1 and 2 byte values are updated through a CAS on the enclosing aligned
+/// 32-bit word, since CUDA has no narrower atomicCAS on all architectures.
+template <typename scalar_t, typename func_t, size_t N>
+__device__ inline void ApplyCAS(scalar_t* address,
+                                scalar_t val,
+                                func_t func,
+                                std::integral_constant<size_t, N>) {
+    using bits_t = typename Word<N>::type;
+    const uintptr_t addr = reinterpret_cast<uintptr_t>(address);
+    unsigned int* word = reinterpret_cast<unsigned int*>(addr & ~uintptr_t(3));
+    const unsigned int shift = static_cast<unsigned int>(addr & 3) * 8;
+    const unsigned int mask = ((1u << (8 * N)) - 1) << shift;
+    unsigned int old = *word;
+    unsigned int assumed;
+    do {
+        assumed = old;
+        const bits_t old_bits = static_cast<bits_t>((assumed & mask) >> shift);
+        const bits_t new_bits =
+                BitCast<bits_t>(func(BitCast<scalar_t>(old_bits), val));
+        if (new_bits == old_bits) {
+            return;
+        }
+        const unsigned int desired =
+                (assumed & ~mask) |
+                (static_cast<unsigned int>(new_bits) << shift);
+        old = atomicCAS(word, assumed, desired);
+    } while (assumed != old);
+}
+#else
+template <typename bits_t>
+inline bits_t LoadRelaxed(bits_t* address) {
+#ifdef __GNUC__
+    return __atomic_load_n(address, __ATOMIC_RELAXED);
+#elif _MSC_VER
+    return *static_cast<volatile bits_t*>(address);
+#else
+    static_assert(false, "LoadRelaxed not implemented for platform");
+#endif
+}
+
+/// Stores \p desired at \p address if it still holds \p expected. Otherwise
+/// \p expected is updated with the stored value and false is returned.
+template <typename bits_t>
+inline bool CompareExchangeRelaxed(bits_t* address,
+                                   bits_t& expected,
+                                   bits_t desired) {
+#ifdef __GNUC__
+    return __atomic_compare_exchange_n(address, &expected, desired, true,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+#elif _MSC_VER
+    bits_t old;
+    switch (sizeof(bits_t)) {
+        case 1:
+            old = static_cast<bits_t>(_InterlockedCompareExchange8(
+                    reinterpret_cast<volatile char*>(address),
+                    static_cast<char>(desired), static_cast<char>(expected)));
+            break;
+        case 2:
+            old = static_cast<bits_t>(_InterlockedCompareExchange16(
+                    reinterpret_cast<volatile short*>(address),
+                    static_cast<short>(desired), static_cast<short>(expected)));
+            break;
+        case 4:
+            old = static_cast<bits_t>(_InterlockedCompareExchange(
+                    reinterpret_cast<volatile long*>(address),
+                    static_cast<long>(desired), static_cast<long>(expected)));
+            break;
+        default:
+            old = static_cast<bits_t>(_InterlockedCompareExchange64(
+                    reinterpret_cast<volatile int64_t*>(address),
+                    static_cast<int64_t>(desired),
+                    static_cast<int64_t>(expected)));
+            break;
+    }
+    if (old == expected) {
+        return true;
+    }
+    expected = old;
+    return false;
+#else
+    static_assert(false, "CompareExchangeRelaxed not implemented for platform");
+#endif
+}
+#endif
+
+struct AddOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(T a, T b) const {
+        return static_cast<T>(a + b);
+    }
+};
+
+struct MaxOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(T a, T b) const {
+        return a < b ? b : a;
+    }
+};
+
+struct MinOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(T a, T b) const {
+        return b < a ? b : a;
+    }
+};
+
+}  // namespace atomic_detail
+
+/// Replaces the value stored at \p address with func(stored, \p val) as an
+/// atomic operation, retrying with compare-and-swap until no other thread has
+/// modified the value in between. Works for any trivially copyable 1, 2, 4 or
+/// 8 byte type, including Float16 and BFloat16. This function does not impose
+/// any ordering on concurrent memory accesses.
+template <typename scalar_t, typename func_t>
+OPEN3D_HOST_DEVICE inline void AtomicApplyRelaxed(scalar_t* address,
+                                                  scalar_t val,
+                                                  func_t func) {
+    constexpr size_t size = sizeof(scalar_t);
+    static_assert(size == 1 || size == 2 || size == 4 || size == 8,
+                  "AtomicApplyRelaxed supports 1, 2, 4 or 8 byte types.");
+#if defined(__CUDA_ARCH__)
+    atomic_detail::ApplyCAS(address, val, func,
+                            std::integral_constant<size_t, size>());
+#else
+    using bits_t = typename atomic_detail::Word<size>::type;
+    bits_t* bits_address = reinterpret_cast<bits_t*>(address);
+    bits_t expected = atomic_detail::LoadRelaxed(bits_address);
+    while (true) {
+        const bits_t desired = atomic_detail::BitCast<bits_t>(
+                func(atomic_detail::BitCast<scalar_t>(expected), val));
+        if (desired == expected ||
+            atomic_detail::CompareExchangeRelaxed(bits_address, expected,
+                                                  desired)) {
+            return;
+        }
+    }
+#endif
+}
+
+/// Adds \p val to the value stored at \p address as an atomic operation. The
+/// order in which concurrent floating point additions are applied is not
+/// defined, so results may differ in the last bits between runs.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AtomicAddRelaxed(scalar_t* address,
+                                                scalar_t val) {
+    AtomicApplyRelaxed(address, val, atomic_detail::AddOp());
+}
+
+OPEN3D_HOST_DEVICE inline void AtomicAddRelaxed(float* address, float val) {
+#if defined(__CUDA_ARCH__)
+    atomicAdd(address, val);
+#else
+    AtomicApplyRelaxed(address, val, atomic_detail::AddOp());
+#endif
+}
+
+OPEN3D_HOST_DEVICE inline void AtomicAddRelaxed(double* address, double val) {
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 600
+    atomicAdd(address, val);
+#else
+    AtomicApplyRelaxed(address, val, atomic_detail::AddOp());
+#endif
+}
+
+OPEN3D_HOST_DEVICE inline void AtomicAddRelaxed(int32_t* address, int32_t val) {
+#if defined(__CUDA_ARCH__)
+    atomicAdd(reinterpret_cast<int*>(address), static_cast<int>(val));
+#elif defined(__GNUC__)
+    __atomic_fetch_add(address, val, __ATOMIC_RELAXED);
+#else
+    AtomicApplyRelaxed(address, val, atomic_detail::AddOp());
+#endif
+}
+
+OPEN3D_HOST_DEVICE inline void AtomicAddRelaxed(int64_t* address, int64_t val) {
+#if defined(__CUDA_ARCH__)
+    // Two's complement addition is the same for signed and unsigned words.
+    atomicAdd(reinterpret_cast<unsigned long long*>(address),
+              static_cast<unsigned long long>(val));
+#elif defined(__GNUC__)
+    __atomic_fetch_add(address, val, __ATOMIC_RELAXED);
+#else
+    AtomicApplyRelaxed(address, val, atomic_detail::AddOp());
+#endif
+}
+
+/// Stores the maximum of \p val and the value at \p address as an atomic
+/// operation.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AtomicMaxRelaxed(scalar_t* address,
+                                                scalar_t val) {
+    AtomicApplyRelaxed(address, val, atomic_detail::MaxOp());
+}
+
+/// Stores the minimum of \p val and the value at \p address as an atomic
+/// operation.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AtomicMinRelaxed(scalar_t* address,
+                                                scalar_t val) {
+    AtomicApplyRelaxed(address, val, atomic_detail::MinOp());
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -26,30 +26,65 @@
 
 #include "open3d/core/CUDAUtils.h"
 
+#include <cstdlib>
+
 #include "open3d/Macro.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 #ifdef BUILD_CUDA_MODULE
 #include "open3d/core/MemoryManager.h"
 #endif
 
+#ifdef BUILD_CUDA_MODULE
+#if CUDART_VERSION >= 11070
+namespace {
+
+// Enables lazy loading of CUDA modules: kernels are loaded on their first
+// launch instead of all at once when the CUDA context is created, which makes
+// the first CUDA call faster and saves device memory. The CUDA runtime reads
+// the variable when it initializes, so it is set when the library is loaded.
+// A value set by the user, e.g. CUDA_MODULE_LOADING=EAGER, is kept.
+struct EnableCUDALazyLoading {
+    EnableCUDALazyLoading() {
+#ifdef _WIN32
+        size_t size = 0;
+        if (getenv_s(&size, nullptr, 0, "CUDA_MODULE_LOADING") == 0 &&
+            size == 0) {
+            _putenv_s("CUDA_MODULE_LOADING", "LAZY");
+        }
+#else
+        setenv("CUDA_MODULE_LOADING", "LAZY", /*overwrite=*/0);
+#endif
+    }
+};
+static const EnableCUDALazyLoading g_enable_cuda_lazy_loading;
+
+}  // namespace
+#endif
+#endif
+
 namespace open3d {
 namespace core {
 namespace cuda {
 
 int DeviceCount() {
 #ifdef BUILD_CUDA_MODULE
-    try {
-        int num_devices;
-        OPEN3D_CUDA_CHECK(cudaGetDeviceCount(&num_devices));
-        return num_devices;
-
-    }
-    // This function is also used to detect CUDA support in our Python code.
-    // Thus, catch any errors if no GPU is available.
-    catch (const std::runtime_error&) {
-        return 0;
-    }
+    // Devices cannot be added to a running process, and the count is needed
+    // for every CUDAScopedDevice.
+    static const int num_devices = []() {
+        try {
+            int num_devices;
+            OPEN3D_CUDA_CHECK(cudaGetDeviceCount(&num_devices));
+            return num_devices;
+        }
+        // This function is also used to detect CUDA support in our Python
+        // code. Thus, catch any errors if no GPU is available.
+        catch (const std::runtime_error&) {
+            return 0;
+        }
+    }();
+    return num_devices;
 #else
     return 0;
 #endif
@@ -92,6 +127,54 @@ void Synchronize(const Device& device) {
 #endif
 }
 
+void StreamSynchronize() {
+#ifdef BUILD_CUDA_MODULE
+    const cudaStream_t stream = GetStream();
+    // Work recorded into a graph (see core::Graph) is not executed until the
+    // graph is replayed, and synchronizing would invalidate the capture.
+    cudaStreamCaptureStatus capture_status;
+    OPEN3D_CUDA_CHECK(cudaStreamIsCapturing(stream, &capture_status));
+    if (capture_status == cudaStreamCaptureStatusActive) {
+        return;
+    }
+    OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
+#endif
+}
+
+void SynchronizeDLPackStream(const Device& device, int64_t dlpack_stream) {
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() != Device::DeviceType::CUDA || dlpack_stream == -1) {
+        return;
+    }
+    cudaStream_t consumer = nullptr;
+    if (dlpack_stream == 1) {
+        consumer = cudaStreamLegacy;
+    } else if (dlpack_stream == 2) {
+        consumer = cudaStreamPerThread;
+    } else if (dlpack_stream > 2) {
+        consumer = reinterpret_cast<cudaStream_t>(
+                static_cast<intptr_t>(dlpack_stream));
+    } else {
+        utility::LogError("Invalid DLPack stream {} for CUDA tensors.",
+                          dlpack_stream);
+    }
+    CUDAScopedDevice scoped_device(device);
+    StreamWaitStream(consumer, GetStream());
+#endif
+}
+
+int64_t GetDLPackStream() {
+#ifdef BUILD_CUDA_MODULE
+    cudaStream_t stream = GetStream();
+    if (stream == GetDefaultStream()) {
+        return 1;
+    }
+    return static_cast<int64_t>(reinterpret_cast<intptr_t>(stream));
+#else
+    return 1;
+#endif
+}
+
 void AssertCUDADeviceAvailable(int device_id) {
 #ifdef BUILD_CUDA_MODULE
     int num_devices = cuda::DeviceCount();
@@ -129,6 +212,18 @@ void AssertCUDADeviceAvailable(const Device& device) {
 }
 
 #ifdef BUILD_CUDA_MODULE
+void StreamWaitStream(cudaStream_t consumer, cudaStream_t producer) {
+    if (consumer == producer) {
+        return;
+    }
+    cudaEvent_t event;
+    OPEN3D_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    OPEN3D_CUDA_CHECK(cudaEventRecord(event, producer));
+    OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(consumer, event, 0));
+    // Destroying the event does not cancel the pending wait.
+    OPEN3D_CUDA_CHECK(cudaEventDestroy(event));
+}
+
 int GetDevice() {
     int device;
     OPEN3D_CUDA_CHECK(cudaGetDevice(&device));
@@ -211,6 +306,49 @@ CUDAScopedStream::~CUDAScopedStream() {
     cuda::SetStream(prev_stream_);
 }
 
+CUDAProfileZone::CUDAProfileZone(const char* name,
+                                 const char* category,
+                                 const Device& device)
+    : name_(name), category_(category) {
+    if (!utility::Profiler::GetInstance().IsEnabled()) {
+        return;
+    }
+    device_id_ = device.GetID();
+    CUDAScopedDevice scoped_device(device_id_);
+    stream_ = cuda::GetStream();
+    OPEN3D_CUDA_CHECK(cudaEventCreate(&start_));
+    OPEN3D_CUDA_CHECK(cudaEventCreate(&stop_));
+    OPEN3D_CUDA_CHECK(cudaEventRecord(start_, stream_));
+    host_begin_ns_ = utility::Profiler::Now();
+}
+
+CUDAProfileZone::~CUDAProfileZone() {
+    if (!start_) {
+        return;
+    }
+    CUDAScopedDevice scoped_device(device_id_);
+    OPEN3D_CUDA_CHECK(cudaEventRecord(stop_, stream_));
+    const char* name = name_;
+    const char* category = category_;
+    const int device_id = device_id_;
+    const cudaEvent_t start = start_;
+    const cudaEvent_t stop = stop_;
+    const int64_t begin_ns = host_begin_ns_;
+    utility::Profiler::GetInstance().AddDeferred([=]() {
+        // Errors are ignored: this may run at exit, after the CUDA runtime
+        // has been shut down.
+        float ms = 0;
+        if (cudaEventSynchronize(stop) == cudaSuccess &&
+            cudaEventElapsedTime(&ms, start, stop) == cudaSuccess) {
+            utility::Profiler::GetInstance().RecordOnTrack(
+                    fmt::format("CUDA:{}", device_id), name, category,
+                    begin_ns, begin_ns + int64_t(double(ms) * 1e6));
+        }
+        cudaEventDestroy(start);
+        cudaEventDestroy(stop);
+    });
+}
+
 CUDAState& CUDAState::GetInstance() {
     static CUDAState instance;
     return instance;
@@ -34,6 +34,7 @@
 
 #include "open3d/core/Device.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Preprocessor.h"
 
 #ifdef BUILD_CUDA_MODULE
 
@@ -179,6 +180,34 @@ private:
     bool owns_new_stream_ = false;
 };
 
+/// \class CUDAProfileZone
+///
+/// Records the GPU time of the work enqueued on the current stream of a
+/// device during the lifetime of the object as a zone of utility::Profiler,
+/// on the track "CUDA:<device id>". The zone starts at the host time the work
+/// was enqueued; its duration is measured with CUDA events and read back
+/// when the trace is exported, so the host is not blocked. Use the
+/// OPEN3D_PROFILE_CUDA_ZONE() macro instead of this class.
+class CUDAProfileZone {
+public:
+    CUDAProfileZone(const char* name,
+                    const char* category,
+                    const Device& device);
+    ~CUDAProfileZone();
+
+    CUDAProfileZone(const CUDAProfileZone&) = delete;
+    CUDAProfileZone& operator=(const CUDAProfileZone&) = delete;
+
+private:
+    const char* name_;
+    const char* category_;
+    int device_id_ = -1;
+    cudaStream_t stream_ = nullptr;
+    cudaEvent_t start_ = nullptr;
+    cudaEvent_t stop_ = nullptr;
+    int64_t host_begin_ns_ = 0;
+};
+
 /// CUDAState is a lazy-evaluated singleton class that initializes and stores
 /// the states of CUDA devices.
 ///
@@ -228,7 +257,8 @@ int GetCUDACurrentDeviceTextureAlignment();
 namespace cuda {
 
 /// Returns the number of available CUDA devices. Returns 0 if Open3D is not
-/// compiled with CUDA support.
+/// compiled with CUDA support. The devices are queried once; this initializes
+/// the CUDA driver but does not create a CUDA context.
 int DeviceCount();
 
 /// Returns true if Open3D is compiled with CUDA support and at least one
@@ -248,6 +278,28 @@ void Synchronize();
 /// \param device The device to be synchronized.
 void Synchronize(const Device& device);
 
+/// Calls cudaStreamSynchronize() for the current stream of the calling thread.
+/// Unlike Synchronize(), work enqueued on other streams is not waited for,
+/// so that streams used by other threads or scopes keep running. While the
+/// current stream is captured into a core::Graph, this function has no effect.
+/// If Open3D is not compiled with CUDA this function has no effect.
+void StreamSynchronize();
+
+/// Makes work enqueued later on the consumer stream \p dlpack_stream wait for
+/// the work enqueued so far on the current stream, without blocking the host.
+/// This is the producer side of the DLPack `__dlpack__(stream=...)` protocol.
+/// \param device The device of the exchanged tensor. Nothing is done if it is
+/// not a CUDA device.
+/// \param dlpack_stream The consumer stream in DLPack encoding: 1 is the
+/// legacy default stream, 2 the per-thread default stream, -1 requests no
+/// synchronization and other positive values are cudaStream_t handles.
+void SynchronizeDLPackStream(const Device& device, int64_t dlpack_stream);
+
+/// Returns the current stream of the calling thread in DLPack encoding, to be
+/// passed to a producer's `__dlpack__(stream=...)`. Returns 1, the legacy
+/// default stream, if Open3D is not compiled with CUDA.
+int64_t GetDLPackStream();
+
 /// Checks if the CUDA device-ID is available and throws error if not. The CUDA
 /// device-ID must be between 0 to device count - 1.
 /// \param device_id The cuda device id to be checked.
@@ -264,6 +316,11 @@ int GetDevice();
 cudaStream_t GetStream();
 cudaStream_t GetDefaultStream();
 
+/// Makes work enqueued later on \p consumer wait for the work enqueued so far
+/// on \p producer by recording an event. Neither the host nor \p producer is
+/// blocked.
+void StreamWaitStream(cudaStream_t consumer, cudaStream_t producer);
+
 #endif
 
 }  // namespace cuda
@@ -286,3 +343,13 @@ void __OPEN3D_GET_LAST_CUDA_ERROR(const char* message,
 }  // namespace open3d
 
 #endif
+
+#if defined(BUILD_CUDA_MODULE) && defined(WITH_PROFILING)
+/// GPU counterpart of OPEN3D_PROFILE_ZONE(), see core::CUDAProfileZone.
+#define OPEN3D_PROFILE_CUDA_ZONE(category, name, device)            \
+    ::open3d::core::CUDAProfileZone OPEN3D_CONCAT(open3d_cuda_zone_, \
+                                                  __LINE__)(         \
+            name, category, device)
+#else
+#define OPEN3D_PROFILE_CUDA_ZONE(category, name, device)
+#endif
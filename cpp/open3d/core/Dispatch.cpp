@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Dispatch.h"
+
+#include "open3d/core/Dtype.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+bool IsDtypeDispatched(const Dtype &dtype) {
+#ifdef OPEN3D_DISPATCH_SKIP_FLOAT64
+    if (dtype == Float64) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_INT8
+    if (dtype == Int8) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_INT16
+    if (dtype == Int16) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_INT32
+    if (dtype == Int32) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT8
+    if (dtype == UInt8) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT16
+    if (dtype == UInt16) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT32
+    if (dtype == UInt32) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT64
+    if (dtype == UInt64) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_FLOAT16
+    if (dtype == Float16) return false;
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_BFLOAT16
+    if (dtype == BFloat16) return false;
+#endif
+    return true;
+}
+
+void LogDispatchError(const Dtype &dtype) {
+    if (!IsDtypeDispatched(dtype)) {
+        utility::LogError(
+                "Unsupported data type {}: it is not dispatched in this build, "
+                "see OPEN3D_DISPATCH_DTYPES.",
+                dtype.ToString());
+    }
+    utility::LogError("Unsupported data type.");
+}
+
+}  // namespace core
+}  // namespace open3d
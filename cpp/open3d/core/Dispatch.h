@@ -26,9 +26,100 @@
 
 #pragma once
 
+#include "open3d/Macro.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/utility/Logging.h"
 
+// The dtypes instantiated by the DISPATCH_* macros can be reduced at build time
+// with the OPEN3D_DISPATCH_DTYPES CMake option, which defines
+// OPEN3D_DISPATCH_SKIP_<DTYPE> for each dtype left out. The branches of the
+// skipped dtypes are removed by the preprocessor, so that kernels are not
+// instantiated for them, and dispatching them raises an error at runtime.
+// Float32, Int64 and Bool are always dispatched.
+#define OPEN3D_DISPATCH_CASE(DTYPE, DTYPE_VALUE, TYPE, ...) \
+    else if (DTYPE == open3d::core::DTYPE_VALUE) {          \
+        using scalar_t = TYPE;                              \
+        return __VA_ARGS__();                               \
+    }
+
+#ifdef OPEN3D_DISPATCH_SKIP_FLOAT64
+#define OPEN3D_DISPATCH_CASE_FLOAT64(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_FLOAT64(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, Float64, double, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_INT8
+#define OPEN3D_DISPATCH_CASE_INT8(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_INT8(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, Int8, int8_t, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_INT16
+#define OPEN3D_DISPATCH_CASE_INT16(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_INT16(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, Int16, int16_t, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_INT32
+#define OPEN3D_DISPATCH_CASE_INT32(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_INT32(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, Int32, int32_t, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT8
+#define OPEN3D_DISPATCH_CASE_UINT8(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_UINT8(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, UInt8, uint8_t, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT16
+#define OPEN3D_DISPATCH_CASE_UINT16(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_UINT16(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, UInt16, uint16_t, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT32
+#define OPEN3D_DISPATCH_CASE_UINT32(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_UINT32(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, UInt32, uint32_t, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_UINT64
+#define OPEN3D_DISPATCH_CASE_UINT64(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_UINT64(DTYPE, ...) \
+    OPEN3D_DISPATCH_CASE(DTYPE, UInt64, uint64_t, __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_FLOAT16
+#define OPEN3D_DISPATCH_CASE_FLOAT16(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_FLOAT16(DTYPE, ...)                 \
+    OPEN3D_DISPATCH_CASE(DTYPE, Float16, open3d::core::float16_t, \
+                         __VA_ARGS__)
+#endif
+#ifdef OPEN3D_DISPATCH_SKIP_BFLOAT16
+#define OPEN3D_DISPATCH_CASE_BFLOAT16(DTYPE, ...)
+#else
+#define OPEN3D_DISPATCH_CASE_BFLOAT16(DTYPE, ...)                  \
+    OPEN3D_DISPATCH_CASE(DTYPE, BFloat16, open3d::core::bfloat16_t, \
+                         __VA_ARGS__)
+#endif
+
+namespace open3d {
+namespace core {
+
+class Dtype;
+
+/// Returns true if the DISPATCH_* macros instantiate kernels for \p dtype in
+/// this build, see OPEN3D_DISPATCH_DTYPES.
+OPEN3D_API bool IsDtypeDispatched(const Dtype &dtype);
+
+/// Raises the error of a DISPATCH_* macro that has no branch for \p dtype.
+OPEN3D_API void LogDispatchError(const Dtype &dtype);
+
+}  // namespace core
+}  // namespace open3d
+
 /// Call a numerical templated function based on Dtype. Warp the function to
 /// a lambda function to use DISPATCH_DTYPE_TO_TEMPLATE.
 ///
@@ -46,41 +137,24 @@
 ///
 /// Inspired by:
 ///     https://github.com/pytorch/pytorch/blob/master/aten/src/ATen/Dispatch.h
-#define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)           \
-    [&] {                                                \
-        if (DTYPE == open3d::core::Float32) {            \
-            using scalar_t = float;                      \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Float64) {     \
-            using scalar_t = double;                     \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Int8) {        \
-            using scalar_t = int8_t;                     \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Int16) {       \
-            using scalar_t = int16_t;                    \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Int32) {       \
-            using scalar_t = int32_t;                    \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Int64) {       \
-            using scalar_t = int64_t;                    \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::UInt8) {       \
-            using scalar_t = uint8_t;                    \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::UInt16) {      \
-            using scalar_t = uint16_t;                   \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::UInt32) {      \
-            using scalar_t = uint32_t;                   \
-            return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::UInt64) {      \
-            using scalar_t = uint64_t;                   \
-            return __VA_ARGS__();                        \
-        } else {                                         \
-            utility::LogError("Unsupported data type."); \
-        }                                                \
+#define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)                   \
+    [&] {                                                        \
+        if (DTYPE == open3d::core::Float32) {                    \
+            using scalar_t = float;                              \
+            return __VA_ARGS__();                                \
+        }                                                        \
+        OPEN3D_DISPATCH_CASE_FLOAT64(DTYPE, __VA_ARGS__)         \
+        OPEN3D_DISPATCH_CASE_INT8(DTYPE, __VA_ARGS__)            \
+        OPEN3D_DISPATCH_CASE_INT16(DTYPE, __VA_ARGS__)           \
+        OPEN3D_DISPATCH_CASE_INT32(DTYPE, __VA_ARGS__)           \
+        OPEN3D_DISPATCH_CASE(DTYPE, Int64, int64_t, __VA_ARGS__) \
+        OPEN3D_DISPATCH_CASE_UINT8(DTYPE, __VA_ARGS__)           \
+        OPEN3D_DISPATCH_CASE_UINT16(DTYPE, __VA_ARGS__)          \
+        OPEN3D_DISPATCH_CASE_UINT32(DTYPE, __VA_ARGS__)          \
+        OPEN3D_DISPATCH_CASE_UINT64(DTYPE, __VA_ARGS__)          \
+        else {                                                   \
+            open3d::core::LogDispatchError(DTYPE);               \
+        }                                                        \
     }()
 
 #define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(DTYPE, ...)    \
@@ -98,10 +172,45 @@
         if (DTYPE == open3d::core::Float32) {            \
             using scalar_t = float;                      \
             return __VA_ARGS__();                        \
-        } else if (DTYPE == open3d::core::Float64) {     \
-            using scalar_t = double;                     \
-            return __VA_ARGS__();                        \
-        } else {                                         \
-            utility::LogError("Unsupported data type."); \
         }                                                \
+        OPEN3D_DISPATCH_CASE_FLOAT64(DTYPE, __VA_ARGS__) \
+        else {                                           \
+            open3d::core::LogDispatchError(DTYPE);       \
+        }                                                \
+    }()
+
+/// Dispatches Float16 and BFloat16 only. Half types are storage types that
+/// convert implicitly to float, so kernels dispatched with them compute in
+/// float and round once on store.
+#define DISPATCH_HALF_DTYPE_TO_TEMPLATE(DTYPE, ...)       \
+    [&] {                                                 \
+        if (false) {                                      \
+        }                                                 \
+        OPEN3D_DISPATCH_CASE_FLOAT16(DTYPE, __VA_ARGS__)  \
+        OPEN3D_DISPATCH_CASE_BFLOAT16(DTYPE, __VA_ARGS__) \
+        else {                                            \
+            open3d::core::LogDispatchError(DTYPE);        \
+        }                                                 \
+    }()
+
+/// DISPATCH_DTYPE_TO_TEMPLATE extended with Float16 and BFloat16. Only used by
+/// kernels that support half types; other callers keep rejecting them.
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, ...)         \
+    [&] {                                                        \
+        if (DTYPE == open3d::core::Float16 ||                    \
+            DTYPE == open3d::core::BFloat16) {                   \
+            DISPATCH_HALF_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__); \
+        } else {                                                 \
+            DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__);      \
+        }                                                        \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(DTYPE, ...)     \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Bool) {                            \
+            using scalar_t = bool;                                    \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, __VA_ARGS__); \
+        }                                                             \
     }()
@@ -28,7 +28,6 @@
 
 #include <type_traits>
 
-#include "open3d/core/Indexer.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/TensorCheck.h"
 
@@ -36,19 +35,16 @@ namespace open3d {
 namespace core {
 namespace eigen_converter {
 
-/// Fills tensor[:][i] with func(i).
-///
-/// \param indexer The input tensor and output tensor to the indexer are the
-/// same (as a hack), since the tensor are filled in-place.
-/// \param func A function that takes pointer location and
-/// workload index i, computes the value to fill, and fills the value at the
-/// pointer location.
-template <typename func_t>
-static void LaunchIndexFillKernel(const Indexer &indexer, const func_t &func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &func](int64_t i) {
-                    func(indexer.GetInputPtr(0, i), i);
-                });
+/// Returns a host tensor that stages copies from and to \p device. For CUDA
+/// devices the tensor is page-locked, such that the transfer is a single DMA
+/// copy instead of going through the driver's pageable bounce buffer.
+static core::Tensor EmptyHostStaging(const core::SizeVector &shape,
+                                     core::Dtype dtype,
+                                     const core::Device &device) {
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        return core::Tensor::EmptyPinned(shape, dtype);
+    }
+    return core::Tensor::Empty(shape, dtype, Device("CPU:0"));
 }
 
 template <typename T>
@@ -120,11 +116,41 @@ static std::vector<Eigen::Matrix<T, N, 1>> TensorToEigenVectorNxVector(
     // Eigen::VectorNx is not a "fixed-size vectorizable Eigen type" thus it is
     // safe to write directly into std vector memory, see:
     // https://eigen.tuxfamily.org/dox/group__TopicStlContainers.html.
-    std::vector<Eigen::Matrix<T, N, 1>> eigen_vector(tensor.GetLength());
-    const core::Tensor t = tensor.To(dtype).Contiguous();
-    MemoryManager::MemcpyToHost(eigen_vector.data(), t.GetDataPtr(),
-                                t.GetDevice(),
-                                t.GetDtype().ByteSize() * t.NumElements());
+    const int64_t num_values = tensor.GetLength();
+    std::vector<Eigen::Matrix<T, N, 1>> eigen_vector(num_values);
+    if (num_values == 0) {
+        return eigen_vector;
+    }
+    core::Tensor t = tensor.Contiguous();
+    if (t.GetDtype() == core::Float16 || t.GetDtype() == core::BFloat16) {
+        // Half types are storage-only and converted by the tensor kernels.
+        t = t.To(dtype);
+    }
+    const core::Device device = t.GetDevice();
+    if (t.GetDtype() == dtype) {
+        MemoryManager::MemcpyToHost(eigen_vector.data(), t.GetDataPtr(),
+                                    device, dtype.ByteSize() * num_values * N);
+        return eigen_vector;
+    }
+
+    // Transfer in the source dtype, which is usually the narrower one, and
+    // convert on the host straight into the vector's memory.
+    core::Tensor t_host = t;
+    if (device.GetType() != Device::DeviceType::CPU) {
+        t_host = EmptyHostStaging(t.GetShape(), t.GetDtype(), device);
+        MemoryManager::Memcpy(t_host.GetDataPtr(), t_host.GetDevice(),
+                              t.GetDataPtr(), device,
+                              t.GetDtype().ByteSize() * num_values * N);
+    }
+    T *dst = eigen_vector.data()->data();
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(t.GetDtype(), [&]() {
+        const scalar_t *src = t_host.GetDataPtr<scalar_t>();
+        ParallelFor(Device("CPU:0"), num_values, [&](int64_t i) {
+            for (int c = 0; c < N; ++c) {
+                dst[i * N + c] = static_cast<T>(src[i * N + c]);
+            }
+        });
+    });
     return eigen_vector;
 }
 
@@ -139,26 +165,39 @@ static core::Tensor EigenVectorNxVectorToTensor(
             (std::is_same<T, double>::value || std::is_same<T, int>::value) &&
                     N > 0,
             "Only supports double and int (VectorNd and VectorNi) with N>0.");
-    // Init CPU Tensor.
     int64_t num_values = static_cast<int64_t>(values.size());
-    core::Tensor tensor_cpu =
-            core::Tensor::Empty({num_values, N}, dtype, Device("CPU:0"));
+    if (dtype == core::Dtype::FromType<T>()) {
+        // Same dtype: a single copy straight from the vector's memory.
+        core::Tensor tensor =
+                core::Tensor::Empty({num_values, N}, dtype, device);
+        MemoryManager::MemcpyFromHost(tensor.GetDataPtr(), device,
+                                      values.data(),
+                                      dtype.ByteSize() * num_values * N);
+        return tensor;
+    }
 
-    // Fill Tensor. This takes care of dtype conversion at the same time.
-    core::Indexer indexer({tensor_cpu}, tensor_cpu,
-                          core::DtypePolicy::ALL_SAME);
+    // Convert and pack on the host in a single pass, into page-locked memory
+    // if the data is uploaded to a CUDA device afterwards.
+    core::Tensor tensor_host = EmptyHostStaging({num_values, N}, dtype, device);
     DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        LaunchIndexFillKernel(indexer, [&](void *ptr, int64_t workload_idx) {
-            // Fills the flattened tensor tensor_cpu[:] with dtype
-            // casting. tensor_cpu[:][i] corresponds to the (i/N)-th
-            // element's (i%N)-th coordinate value.
-            *static_cast<scalar_t *>(ptr) = static_cast<scalar_t>(
-                    values[workload_idx / N](workload_idx % N));
+        scalar_t *dst = tensor_host.GetDataPtr<scalar_t>();
+        ParallelFor(Device("CPU:0"), num_values, [&](int64_t i) {
+            for (int c = 0; c < N; ++c) {
+                dst[i * N + c] = static_cast<scalar_t>(values[i](c));
+            }
         });
     });
+    if (device.GetType() == Device::DeviceType::CPU) {
+        return tensor_host;
+    }
 
-    // Copy Tensor to device if necessary.
-    return tensor_cpu.To(device);
+    // The upload is enqueued on the current stream. Releasing the page-locked
+    // staging buffer waits for it to complete.
+    core::Tensor tensor = core::Tensor::Empty({num_values, N}, dtype, device);
+    MemoryManager::Memcpy(tensor.GetDataPtr(), device,
+                          tensor_host.GetDataPtr(), tensor_host.GetDevice(),
+                          dtype.ByteSize() * num_values * N);
+    return tensor;
 }
 
 std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(
@@ -183,6 +222,29 @@ core::Tensor EigenVector3dVectorToTensor(
     return EigenVectorNxVectorToTensor(values, dtype, device);
 }
 
+core::Tensor MoveEigenVector3dVectorToTensor(
+        std::vector<Eigen::Vector3d> &&values) {
+    static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double),
+                  "Eigen::Vector3d must be tightly packed.");
+    const int64_t num_values = static_cast<int64_t>(values.size());
+    if (num_values == 0) {
+        values.clear();
+        return core::Tensor::Empty({0, 3}, core::Float64, Device("CPU:0"));
+    }
+    // The blob owns the moved vector and releases it with the last tensor
+    // referencing the buffer.
+    auto holder = std::make_shared<std::vector<Eigen::Vector3d>>(
+            std::move(values));
+    values.clear();
+    void *data_ptr = holder->data();
+    auto blob = std::make_shared<core::Blob>(
+            Device("CPU:0"), data_ptr, [holder](void *) mutable {
+                holder.reset();
+            });
+    return core::Tensor({num_values, 3}, {3, 1}, data_ptr, core::Float64,
+                        blob);
+}
+
 core::Tensor EigenVector3iVectorToTensor(
         const std::vector<Eigen::Vector3i> &values,
         core::Dtype dtype,
@@ -114,6 +114,15 @@ core::Tensor EigenVector3dVectorToTensor(
         core::Dtype dtype,
         const core::Device &device);
 
+/// \brief Moves a vector of Eigen::Vector3d into a (N, 3) Float64 CPU tensor
+/// without copying. The tensor takes ownership of the vector's buffer, and
+/// \p values is left empty.
+///
+/// \param values A vector of Eigen::Vector3d values, e.g. a list of 3D points.
+/// \return A Float64 CPU tensor of shape (N, 3) backed by the moved buffer.
+core::Tensor MoveEigenVector3dVectorToTensor(
+        std::vector<Eigen::Vector3d> &&values);
+
 /// \brief Converts a vector of Eigen::Vector2i to a (N, 2) tensor. This
 /// function also takes care of dtype conversion and device transfer if
 /// necessary.
@@ -0,0 +1,226 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+/// \file Float16.h
+/// \brief Half-precision storage types for Float16 and BFloat16 tensors.
+///
+/// float16_t and bfloat16_t are storage-only types: they convert implicitly to
+/// and from float, so kernels written for float compute in float precision and
+/// round once when the result is stored.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+
+#ifdef __CUDACC__
+#include <cuda_fp16.h>
+#endif
+
+namespace open3d {
+namespace core {
+
+namespace float16_detail {
+
+OPEN3D_HOST_DEVICE inline uint32_t FloatToBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+OPEN3D_HOST_DEVICE inline float BitsToFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/// Converts float to IEEE 754 binary16 with round-to-nearest-even.
+OPEN3D_HOST_DEVICE inline uint16_t FloatToHalfBits(float value) {
+#ifdef __CUDA_ARCH__
+    return __half_as_ushort(__float2half_rn(value));
+#else
+    // Ref: https://gist.github.com/rygorous/2156668
+    uint32_t bits = FloatToBits(value);
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+    uint16_t half_bits;
+    if (bits >= 0x47800000u) {
+        // Overflow to Inf, or NaN (quieted).
+        half_bits = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+    } else if (bits < 0x38800000u) {
+        // Subnormal or zero: align the mantissa with a magic addition, which
+        // rounds to nearest even.
+        const float magic = BitsToFloat(0x3f000000u);
+        half_bits = static_cast<uint16_t>(
+                FloatToBits(BitsToFloat(bits) + magic) - 0x3f000000u);
+    } else {
+        const uint32_t mantissa_odd = (bits >> 13) & 1u;
+        bits += 0xc8000fffu + mantissa_odd;
+        half_bits = static_cast<uint16_t>(bits >> 13);
+    }
+    return static_cast<uint16_t>(half_bits | (sign >> 16));
+#endif
+}
+
+/// Converts IEEE 754 binary16 to float. The conversion is exact.
+OPEN3D_HOST_DEVICE inline float HalfBitsToFloat(uint16_t half_bits) {
+#ifdef __CUDA_ARCH__
+    return __half2float(__ushort_as_half(half_bits));
+#else
+    // Ref: https://gist.github.com/rygorous/2144712
+    const uint32_t shifted_exp = 0x7c00u << 13;
+    uint32_t bits = (half_bits & 0x7fffu) << 13;
+    const uint32_t exp = bits & shifted_exp;
+    bits += (127 - 15) << 23;
+    if (exp == shifted_exp) {
+        // Inf or NaN.
+        bits += (128 - 16) << 23;
+    } else if (exp == 0) {
+        // Zero or subnormal: renormalize.
+        bits += 1 << 23;
+        bits = FloatToBits(BitsToFloat(bits) - BitsToFloat(113u << 23));
+    }
+    return BitsToFloat(bits | ((half_bits & 0x8000u) << 16));
+#endif
+}
+
+/// Converts float to bfloat16 with round-to-nearest-even.
+OPEN3D_HOST_DEVICE inline uint16_t FloatToBFloat16Bits(float value) {
+    uint32_t bits = FloatToBits(value);
+    if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        // Keep NaN a (quiet) NaN after truncation.
+        return static_cast<uint16_t>((bits >> 16) | 0x40u);
+    }
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+/// Converts bfloat16 to float. The conversion is exact.
+OPEN3D_HOST_DEVICE inline float BFloat16BitsToFloat(uint16_t bits) {
+    return BitsToFloat(static_cast<uint32_t>(bits) << 16);
+}
+
+}  // namespace float16_detail
+
+/// IEEE 754 half-precision (binary16) floating point number, the element type
+/// of core::Float16 tensors.
+struct float16_t {
+    float16_t() = default;
+
+    OPEN3D_HOST_DEVICE float16_t(float value)
+        : bits_(float16_detail::FloatToHalfBits(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const {
+        return float16_detail::HalfBitsToFloat(bits_);
+    }
+
+    /// Creates a value from its binary16 bit pattern.
+    OPEN3D_HOST_DEVICE static float16_t FromBits(uint16_t bits) {
+        float16_t value;
+        value.bits_ = bits;
+        return value;
+    }
+
+    OPEN3D_HOST_DEVICE uint16_t GetBits() const { return bits_; }
+
+    uint16_t bits_;
+};
+
+/// Brain floating point number (8-bit exponent, 7-bit mantissa), the element
+/// type of core::BFloat16 tensors.
+struct bfloat16_t {
+    bfloat16_t() = default;
+
+    OPEN3D_HOST_DEVICE bfloat16_t(float value)
+        : bits_(float16_detail::FloatToBFloat16Bits(value)) {}
+
+    OPEN3D_HOST_DEVICE operator float() const {
+        return float16_detail::BFloat16BitsToFloat(bits_);
+    }
+
+    /// Creates a value from its bfloat16 bit pattern.
+    OPEN3D_HOST_DEVICE static bfloat16_t FromBits(uint16_t bits) {
+        bfloat16_t value;
+        value.bits_ = bits;
+        return value;
+    }
+
+    OPEN3D_HOST_DEVICE uint16_t GetBits() const { return bits_; }
+
+    uint16_t bits_;
+};
+
+static_assert(sizeof(float16_t) == 2, "float16_t must be 2 bytes.");
+static_assert(sizeof(bfloat16_t) == 2, "bfloat16_t must be 2 bytes.");
+
+}  // namespace core
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::core::float16_t> {
+public:
+    using T = open3d::core::float16_t;
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr int radix = 2;
+    static OPEN3D_HOST_DEVICE T min() { return T::FromBits(0x0400); }
+    static OPEN3D_HOST_DEVICE T max() { return T::FromBits(0x7bff); }
+    static OPEN3D_HOST_DEVICE T lowest() { return T::FromBits(0xfbff); }
+    static OPEN3D_HOST_DEVICE T epsilon() { return T::FromBits(0x1400); }
+    static OPEN3D_HOST_DEVICE T infinity() { return T::FromBits(0x7c00); }
+    static OPEN3D_HOST_DEVICE T quiet_NaN() { return T::FromBits(0x7e00); }
+};
+
+template <>
+class numeric_limits<open3d::core::bfloat16_t> {
+public:
+    using T = open3d::core::bfloat16_t;
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 8;
+    static constexpr int radix = 2;
+    static OPEN3D_HOST_DEVICE T min() { return T::FromBits(0x0080); }
+    static OPEN3D_HOST_DEVICE T max() { return T::FromBits(0x7f7f); }
+    static OPEN3D_HOST_DEVICE T lowest() { return T::FromBits(0xff7f); }
+    static OPEN3D_HOST_DEVICE T epsilon() { return T::FromBits(0x3c00); }
+    static OPEN3D_HOST_DEVICE T infinity() { return T::FromBits(0x7f80); }
+    static OPEN3D_HOST_DEVICE T quiet_NaN() { return T::FromBits(0x7fc0); }
+};
+
+}  // namespace std
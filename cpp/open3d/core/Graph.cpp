@@ -0,0 +1,268 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Graph.h"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/Stream.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+/// Device memory referenced by a recorded graph.
+struct GraphMemoryPool {
+    explicit GraphMemoryPool(const Device& device) : device_(device) {}
+
+    Device device_;
+    /// Allocated during the capture and not released yet.
+    std::unordered_set<void*> allocated_;
+    /// Released while referenced by the graph.
+    std::vector<void*> deferred_;
+};
+
+std::mutex& GetPoolMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// Pools of all recorded graphs, guarded by GetPoolMutex().
+std::unordered_set<GraphMemoryPool*>& GetLivePools() {
+    static std::unordered_set<GraphMemoryPool*> pools;
+    return pools;
+}
+
+/// Number of live pools, such that releases skip the lookup if no graph is
+/// recorded.
+std::atomic<int64_t> g_num_live_pools(0);
+
+/// Pool of the graph that the calling thread is capturing.
+thread_local GraphMemoryPool* g_capturing_pool = nullptr;
+
+}  // namespace
+
+struct Graph::Impl {
+    explicit Impl(const Device& device) : device_(device) {
+        if (device_.GetType() == Device::DeviceType::CUDA) {
+#ifndef BUILD_CUDA_MODULE
+            utility::LogError(
+                    "Not compiled with CUDA, but CUDA device is used.");
+#endif
+        } else if (device_.GetType() != Device::DeviceType::CPU) {
+            utility::LogError("Unimplemented device {}.", device_.ToString());
+        }
+    }
+
+    Device device_;
+    SizeVector signature_;
+    bool captured_ = false;
+    int64_t num_captures_ = 0;
+    /// The recorded function on CPU devices.
+    std::function<void()> func_;
+    std::unique_ptr<GraphMemoryPool> pool_;
+    std::unique_ptr<Event> replayed_;
+#ifdef BUILD_CUDA_MODULE
+    cudaGraphExec_t graph_exec_ = nullptr;
+#endif
+};
+
+Graph::Graph(const Device& device) : impl_(std::make_unique<Impl>(device)) {}
+
+Graph::~Graph() { Reset(); }
+
+Device Graph::GetDevice() const { return impl_->device_; }
+
+void Graph::Capture(const SizeVector& signature,
+                    const std::function<void()>& func) {
+    if (g_capturing_pool != nullptr) {
+        utility::LogError("Nested graph captures are not supported.");
+    }
+    Reset();
+    impl_->signature_ = signature;
+    impl_->num_captures_++;
+
+    if (impl_->device_.GetType() == Device::DeviceType::CPU) {
+        impl_->func_ = func;
+        impl_->captured_ = true;
+        return;
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    impl_->pool_ = std::make_unique<GraphMemoryPool>(impl_->device_);
+    {
+        std::lock_guard<std::mutex> lock(GetPoolMutex());
+        GetLivePools().insert(impl_->pool_.get());
+        g_num_live_pools++;
+    }
+
+    // Kernels launched on the legacy default stream cannot be captured, hence
+    // the work is recorded on a dedicated stream. Relaxed mode allows the
+    // memory managers to allocate during the capture.
+    Stream capture_stream(impl_->device_);
+    ScopedStream scoped_stream(capture_stream);
+    CUDAScopedDevice scoped_device(impl_->device_);
+    const cudaStream_t stream = capture_stream.GetCUDAStream();
+    OPEN3D_CUDA_CHECK(
+            cudaStreamBeginCapture(stream, cudaStreamCaptureModeRelaxed));
+    g_capturing_pool = impl_->pool_.get();
+    cudaGraph_t graph = nullptr;
+    try {
+        func();
+    } catch (...) {
+        g_capturing_pool = nullptr;
+        cudaStreamEndCapture(stream, &graph);
+        cudaGetLastError();
+        if (graph) {
+            cudaGraphDestroy(graph);
+        }
+        Reset();
+        throw;
+    }
+    g_capturing_pool = nullptr;
+
+    const cudaError_t err = cudaStreamEndCapture(stream, &graph);
+    if (err != cudaSuccess) {
+        cudaGetLastError();
+        if (graph) {
+            cudaGraphDestroy(graph);
+        }
+        Reset();
+        utility::LogError(
+                "Graph capture failed: {}. The captured function must not "
+                "synchronize with the host or use other streams.",
+                cudaGetErrorString(err));
+    }
+#if CUDART_VERSION >= 11040
+    OPEN3D_CUDA_CHECK(
+            cudaGraphInstantiateWithFlags(&impl_->graph_exec_, graph, 0));
+#else
+    OPEN3D_CUDA_CHECK(cudaGraphInstantiate(&impl_->graph_exec_, graph,
+                                           nullptr, nullptr, 0));
+#endif
+    OPEN3D_CUDA_CHECK(cudaGraphDestroy(graph));
+    impl_->captured_ = true;
+#endif
+}
+
+void Graph::Replay() {
+    if (!impl_->captured_) {
+        utility::LogError("Graph has not been captured.");
+    }
+    if (impl_->device_.GetType() == Device::DeviceType::CPU) {
+        impl_->func_();
+        return;
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    CUDAScopedDevice scoped_device(impl_->device_);
+    OPEN3D_CUDA_CHECK(cudaGraphLaunch(impl_->graph_exec_, cuda::GetStream()));
+    if (!impl_->replayed_) {
+        impl_->replayed_ = std::make_unique<Event>(impl_->device_);
+    }
+    impl_->replayed_->Record();
+#endif
+}
+
+bool Graph::IsCaptured() const { return impl_->captured_; }
+
+bool Graph::NeedsCapture(const SizeVector& signature) const {
+    return !impl_->captured_ || impl_->signature_ != signature;
+}
+
+int64_t Graph::GetNumCaptures() const { return impl_->num_captures_; }
+
+void Graph::Reset() {
+    if (impl_->replayed_) {
+        impl_->replayed_->Synchronize();
+        impl_->replayed_.reset();
+    }
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->graph_exec_) {
+        CUDAScopedDevice scoped_device(impl_->device_);
+        OPEN3D_CUDA_CHECK(cudaGraphExecDestroy(impl_->graph_exec_));
+        impl_->graph_exec_ = nullptr;
+    }
+#endif
+    impl_->func_ = nullptr;
+    impl_->captured_ = false;
+
+    if (impl_->pool_) {
+        {
+            std::lock_guard<std::mutex> lock(GetPoolMutex());
+            GetLivePools().erase(impl_->pool_.get());
+            g_num_live_pools--;
+        }
+        // Memory still in use outside of the graph is released by its owner.
+        for (void* ptr : impl_->pool_->deferred_) {
+            MemoryManager::Free(ptr, impl_->device_);
+        }
+        impl_->pool_.reset();
+    }
+}
+
+bool Graph::IsCapturing(const Device& device) {
+    return g_capturing_pool != nullptr && g_capturing_pool->device_ == device;
+}
+
+void Graph::RecordMalloc(void* ptr, const Device& device) {
+    if (ptr != nullptr && IsCapturing(device)) {
+        std::lock_guard<std::mutex> lock(GetPoolMutex());
+        g_capturing_pool->allocated_.insert(ptr);
+    }
+}
+
+bool Graph::DeferFree(void* ptr, const Device& device) {
+    if (ptr == nullptr || g_num_live_pools == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(GetPoolMutex());
+    // Memory released during a capture may still be read by the graph.
+    if (IsCapturing(device)) {
+        g_capturing_pool->allocated_.erase(ptr);
+        g_capturing_pool->deferred_.push_back(ptr);
+        return true;
+    }
+    // Memory allocated during a capture is written by every replay.
+    for (GraphMemoryPool* pool : GetLivePools()) {
+        if (pool->device_ == device && pool->allocated_.erase(ptr) > 0) {
+            pool->deferred_.push_back(ptr);
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace core
+}  // namespace open3d
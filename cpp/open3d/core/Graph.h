@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/SizeVector.h"
+
+namespace open3d {
+namespace core {
+
+/// \class Graph
+///
+/// Device-agnostic recording of a pipeline step that is replayed as a whole,
+/// e.g. per-frame preprocessing that launches dozens of small kernels with
+/// the same shapes on every frame.
+///
+/// On CUDA devices, Capture() runs the function on a capture stream and
+/// records the kernels and copies it enqueues into a CUDA graph, without
+/// executing them. Replay() launches the recorded graph on the current stream
+/// with a single call, which removes the per-kernel launch overhead. On CPU
+/// devices, Capture() stores the function and Replay() calls it.
+///
+/// A graph replays the kernel arguments and memory addresses of its capture:
+/// - Inputs must be copied into buffers that were allocated before the
+///   capture, and outputs are the tensors written during the capture.
+/// - Device memory allocated or released during the capture is kept alive by
+///   the graph until it is reset or destroyed.
+/// - Scalars and host data used by the function are baked into the graph.
+/// - The function must not consume device results on the host, e.g. with
+///   Tensor::Item(), since no work is executed while capturing.
+///
+/// The signature passed to Capture() describes what the graph depends on,
+/// e.g. shapes, capacities and parameters. NeedsCapture() compares it with the
+/// signature of the recorded graph to detect when a re-capture is needed.
+///
+/// Example:
+/// ```cpp
+/// core::Graph graph(device);
+/// core::Tensor input = core::Tensor::Empty({480, 640}, core::Float32, device);
+/// core::Tensor output;
+/// for (const core::Tensor& frame : frames) {
+///     input.CopyFrom(frame);
+///     if (graph.NeedsCapture(input.GetShape())) {
+///         graph.Capture(input.GetShape(), [&]() { output = Process(input); });
+///     }
+///     graph.Replay();
+///     // Use output.
+/// }
+/// ```
+class Graph {
+public:
+    /// Creates an empty graph on \p device.
+    explicit Graph(const Device& device);
+
+    /// Waits for the last replay and releases the memory held by the graph.
+    ~Graph();
+
+    Graph(const Graph&) = delete;
+    Graph& operator=(const Graph&) = delete;
+
+    /// Returns the device of the graph.
+    Device GetDevice() const;
+
+    /// Records \p func, replacing the previous recording. The work is not
+    /// executed until Replay() is called.
+    ///
+    /// \param signature Describes the state baked into the recording, see
+    /// NeedsCapture().
+    /// \param func The pipeline step to record.
+    void Capture(const SizeVector& signature,
+                 const std::function<void()>& func);
+
+    /// Executes the recorded work on the current stream.
+    void Replay();
+
+    /// Returns true if the graph holds a recording.
+    bool IsCaptured() const;
+
+    /// Returns true if the graph holds no recording or a recording with a
+    /// different signature than \p signature.
+    bool NeedsCapture(const SizeVector& signature) const;
+
+    /// Returns the number of captures since the creation of the graph.
+    int64_t GetNumCaptures() const;
+
+    /// Waits for the last replay, then drops the recording and releases the
+    /// memory held by the graph.
+    void Reset();
+
+    /// Returns true if the calling thread is capturing a graph on \p device.
+    static bool IsCapturing(const Device& device);
+
+    /// Called by the MemoryManager after allocating \p ptr on \p device.
+    static void RecordMalloc(void* ptr, const Device& device);
+
+    /// Called by the MemoryManager before releasing \p ptr on \p device.
+    /// Returns true if the release is deferred until the graph referencing
+    /// the memory is reset.
+    static bool DeferFree(void* ptr, const Device& device);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -154,9 +154,16 @@ Indexer::Indexer(const std::vector<Tensor>& input_tensors,
     // Theoretically, reduction can be mixed with broadcasting. For
     // simplicity, we require explicit broadcasting after reduction.
     if (reduction_dims.size() > 0) {
-        if (num_inputs_ != 1) {
-            utility::LogError(
-                    "Internal error: reduction op can only have 1 inputs.");
+        // Multiple inputs are allowed for fused reductions, as long as they
+        // are explicitly broadcasted to the same shape.
+        for (int64_t i = 1; i < num_inputs_; ++i) {
+            if (input_tensors[i].GetShape() != input_tensors[0].GetShape()) {
+                utility::LogError(
+                        "Internal error: reduction op inputs must have the "
+                        "same shape, but {} != {}.",
+                        input_tensors[i].GetShape(),
+                        input_tensors[0].GetShape());
+            }
         }
 
         for (int64_t i = 0; i < num_outputs_; ++i) {
@@ -571,6 +578,49 @@ void Indexer::ReorderDimensions(const SizeVector& reduction_dims) {
     }
 }
 
+BroadcastLayout Indexer::GetInputBroadcastLayout(int64_t input_idx) const {
+    const TensorRef& input = GetInput(input_idx);
+    if (num_outputs_ != 1 || !outputs_contiguous_[0] ||
+        input.ndims_ != ndims_) {
+        return BroadcastLayout::General;
+    }
+    if (inputs_contiguous_[input_idx]) {
+        return BroadcastLayout::Contiguous;
+    }
+
+    // Size-1 dimensions never contribute to the offset, so their strides are
+    // ignored below.
+    bool is_scalar = true;
+    bool is_row = true;
+    bool is_column = ndims_ > 0 && master_shape_[ndims_ - 1] > 1 &&
+                     input.byte_strides_[ndims_ - 1] == 0;
+    int64_t column_stride = input.dtype_byte_size_;
+    for (int64_t i = ndims_ - 1; i >= 0; --i) {
+        if (master_shape_[i] <= 1) {
+            continue;
+        }
+        const int64_t byte_stride = input.byte_strides_[i];
+        is_scalar = is_scalar && byte_stride == 0;
+        if (i == ndims_ - 1) {
+            is_row = is_row && byte_stride == input.dtype_byte_size_;
+        } else {
+            is_row = is_row && byte_stride == 0;
+            is_column = is_column && byte_stride == column_stride;
+            column_stride *= master_shape_[i];
+        }
+    }
+
+    if (is_scalar) {
+        return BroadcastLayout::Scalar;
+    } else if (is_row) {
+        return BroadcastLayout::Row;
+    } else if (is_column) {
+        return BroadcastLayout::Column;
+    } else {
+        return BroadcastLayout::General;
+    }
+}
+
 void Indexer::UpdateMasterStrides() {
     int64_t stride = 1;
     for (int64_t i = ndims_ - 1; i >= 0; --i) {
@@ -224,6 +224,36 @@ enum class DtypePolicy {
                             // have bool dtype.
 };
 
+/// Layout of an input over the master shape of a broadcasting Indexer, with
+/// the master shape viewed as a {rows, cols} matrix where cols is the size of
+/// the last dimension. Element-wise kernels use it to replace the generic
+/// per-element offset computation for the most common broadcasts.
+enum class BroadcastLayout {
+    General,     // Any other layout, use Indexer::GetInputPtr().
+    Contiguous,  // Same layout as the output, e.g. (N, 3) op (N, 3).
+    Row,         // One row broadcast to all rows, e.g. (N, 3) op (3,).
+    Column,      // One column broadcast to all cols, e.g. (N, 3) op (N, 1).
+    Scalar       // A single element, e.g. (N, 3) op ().
+};
+
+/// Returns the element index of an input with \p layout for \p workload_idx,
+/// given \p cols columns in the {rows, cols} view of the master shape. Not
+/// valid for BroadcastLayout::General.
+OPEN3D_HOST_DEVICE inline int64_t BroadcastElementIndex(BroadcastLayout layout,
+                                                        int64_t workload_idx,
+                                                        int64_t cols) {
+    switch (layout) {
+        case BroadcastLayout::Contiguous:
+            return workload_idx;
+        case BroadcastLayout::Row:
+            return workload_idx % cols;
+        case BroadcastLayout::Column:
+            return workload_idx / cols;
+        default:
+            return 0;
+    }
+}
+
 /// Indexer to one Tensor
 ///
 /// Example usage:
@@ -408,6 +438,17 @@ public:
         return GetOutput(0);
     }
 
+    /// Returns the BroadcastLayout of input \p input_idx. Returns
+    /// BroadcastLayout::General if the output is not contiguous, since the
+    /// specialized kernels write the output with the workload index.
+    BroadcastLayout GetInputBroadcastLayout(int64_t input_idx) const;
+
+    /// Returns the number of columns of the {rows, cols} view of the master
+    /// shape used by BroadcastLayout, i.e. the size of the last dimension.
+    int64_t NumBroadcastCols() const {
+        return ndims_ == 0 ? 1 : master_shape_[ndims_ - 1];
+    }
+
     /// Returns true if the \p dim -th dimension is reduced.
     bool IsReductionDim(int64_t dim) const {
         // All outputs have the same shape and reduction dims. Even if they
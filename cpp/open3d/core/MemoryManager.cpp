@@ -27,11 +27,13 @@
 #include "open3d/core/MemoryManager.h"
 
 #include <numeric>
-#include <unordered_map>
 
 #include "open3d/core/Blob.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/Graph.h"
 #include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/core/Stream.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
@@ -41,10 +43,15 @@ namespace core {
 void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
     void* ptr = GetDeviceMemoryManager(device)->Malloc(byte_size, device);
     MemoryManagerStatistic::GetInstance().CountMalloc(ptr, byte_size, device);
+    Graph::RecordMalloc(ptr, device);
     return ptr;
 }
 
 void MemoryManager::Free(void* ptr, const Device& device) {
+    // Memory referenced by a recorded graph is released with the graph.
+    if (Graph::DeferFree(ptr, device)) {
+        return;
+    }
     // Update statistics before freeing the memory. This ensures a consistent
     // order in case a subsequent Malloc requires the currently freed memory.
     MemoryManagerStatistic::GetInstance().CountFree(ptr, device);
@@ -81,6 +88,41 @@ void MemoryManager::Memcpy(void* dst_ptr,
     }
 
     device_mm->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
+
+    // Copies into page-locked host memory are asynchronous w.r.t. the host.
+    if (dst_device.GetType() == Device::DeviceType::CPU &&
+        src_device.GetType() == Device::DeviceType::CUDA) {
+        cuda::StreamSynchronize();
+    }
+}
+
+void MemoryManager::MemcpyAsync(void* dst_ptr,
+                                const Device& dst_device,
+                                const void* src_ptr,
+                                const Device& src_device,
+                                size_t num_bytes,
+                                const Stream& stream) {
+    if (num_bytes == 0) {
+        return;
+    } else if (src_ptr == nullptr || dst_ptr == nullptr) {
+        utility::LogError("src_ptr and dst_ptr cannot be nullptr.");
+    }
+    if (stream.GetDevice() != src_device && stream.GetDevice() != dst_device) {
+        utility::LogError(
+                "Stream on {} can only copy memory from or to its device, but "
+                "got {} to {}.",
+                stream.GetDevice().ToString(), src_device.ToString(),
+                dst_device.ToString());
+    }
+
+    ScopedStream scoped_stream(stream);
+    std::shared_ptr<DeviceMemoryManager> device_mm;
+    if (src_device.GetType() == Device::DeviceType::CUDA) {
+        device_mm = GetDeviceMemoryManager(src_device);
+    } else {
+        device_mm = GetDeviceMemoryManager(dst_device);
+    }
+    device_mm->Memcpy(dst_ptr, dst_device, src_ptr, src_device, num_bytes);
 }
 
 void MemoryManager::MemcpyFromHost(void* dst_ptr,
@@ -101,28 +143,30 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
 
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
-    static std::unordered_map<Device::DeviceType,
-                              std::shared_ptr<DeviceMemoryManager>,
-                              utility::hash_enum_class>
-            map_device_type_to_memory_manager = {
-                    {Device::DeviceType::CPU,
-                     std::make_shared<CPUMemoryManager>()},
+    // Each manager is created on the first use of its device type, so that
+    // programs which only use the CPU never set up CUDA state.
+    switch (device.GetType()) {
+        case Device::DeviceType::CPU: {
+            static const std::shared_ptr<DeviceMemoryManager> cpu_mm =
+                    std::make_shared<CPUMemoryManager>();
+            return cpu_mm;
+        }
 #ifdef BUILD_CUDA_MODULE
+        case Device::DeviceType::CUDA: {
 #ifdef BUILD_CACHED_CUDA_MANAGER
-                    {Device::DeviceType::CUDA,
-                     std::make_shared<CachedMemoryManager>(
-                             std::make_shared<CUDAMemoryManager>())},
+            static const std::shared_ptr<DeviceMemoryManager> cuda_mm =
+                    std::make_shared<CachedMemoryManager>(
+                            std::make_shared<CUDAMemoryManager>());
 #else
-                    {Device::DeviceType::CUDA,
-                     std::make_shared<CUDAMemoryManager>()},
+            static const std::shared_ptr<DeviceMemoryManager> cuda_mm =
+                    std::make_shared<CUDAMemoryManager>();
 #endif  // BUILD_CACHED_CUDA_MANAGER
+            return cuda_mm;
+        }
 #endif  // BUILD_CUDA_MODULE
-            };
-    if (map_device_type_to_memory_manager.find(device.GetType()) ==
-        map_device_type_to_memory_manager.end()) {
-        utility::LogError("Unimplemented device '{}'.", device.ToString());
+        default:
+            utility::LogError("Unimplemented device '{}'.", device.ToString());
     }
-    return map_device_type_to_memory_manager.at(device.GetType());
 }
 
 }  // namespace core
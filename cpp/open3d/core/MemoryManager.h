@@ -31,6 +31,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Device.h"
 
@@ -38,6 +39,7 @@ namespace open3d {
 namespace core {
 
 class DeviceMemoryManager;
+class Stream;
 
 /// Top-level memory interface. Calls to any of the member functions will
 /// automatically dispatch the appropriate DeviceMemoryManager instance based on
@@ -61,12 +63,29 @@ public:
 
     /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
     /// \p src_device to address \p dst_ptr on device \p dst_device.
+    ///
+    /// Copies between CUDA devices and from host to CUDA devices are enqueued
+    /// on the current stream. Copies to the host return once the data is
+    /// available.
     static void Memcpy(void* dst_ptr,
                        const Device& dst_device,
                        const void* src_ptr,
                        const Device& src_device,
                        size_t num_bytes);
 
+    /// Enqueues a copy of \p num_bytes bytes of memory at address \p src_ptr
+    /// on device \p src_device to address \p dst_ptr on device \p dst_device
+    /// on \p stream. If host memory is page-locked, the call returns before
+    /// the copy has completed and \p stream must be synchronized before the
+    /// memory is accessed or freed. For CPU streams, this is the same as
+    /// Memcpy.
+    static void MemcpyAsync(void* dst_ptr,
+                            const Device& dst_device,
+                            const void* src_ptr,
+                            const Device& src_device,
+                            size_t num_bytes,
+                            const Stream& stream);
+
     /// Same as Memcpy, but with host (CPU:0) as default src_device.
     static void MemcpyFromHost(void* dst_ptr,
                                const Device& dst_device,
@@ -106,6 +125,37 @@ public:
                         size_t num_bytes) = 0;
 };
 
+/// Usage and fragmentation statistics of the cache of a CachedMemoryManager
+/// for a single device. Peak values are high-water marks since the program
+/// start or the last call to CachedMemoryManager::ResetPeakStatistics.
+struct CachedMemoryStatistics {
+    /// Fraction of the free cached bytes outside of the largest free block,
+    /// in [0, 1]. A value close to 1 indicates that free memory is scattered
+    /// over many small blocks that cannot serve large requests.
+    double GetFragmentation() const;
+
+    /// Fraction of allocations served from cached blocks, in [0, 1].
+    double GetHitRate() const;
+
+    /// Bytes obtained from the direct memory manager.
+    size_t reserved_bytes_ = 0;
+    size_t peak_reserved_bytes_ = 0;
+    /// Maximum number of bytes that may be reserved.
+    size_t reserved_limit_ = 0;
+    /// Bytes currently handed out by the cache.
+    size_t allocated_bytes_ = 0;
+    size_t peak_allocated_bytes_ = 0;
+    /// Reserved bytes that are cached for reuse.
+    size_t free_bytes_ = 0;
+    size_t largest_free_block_bytes_ = 0;
+    size_t num_real_blocks_ = 0;
+    size_t num_free_blocks_ = 0;
+    /// Allocations served from cached blocks and from the direct memory
+    /// manager since the program start.
+    size_t num_cache_hits_ = 0;
+    size_t num_cache_misses_ = 0;
+};
+
 /// Generic cached memory manager. This class can be used to speed-up memory
 /// allocations and deallocations from arbitrary direct memory managers.
 ///
@@ -118,8 +168,12 @@ public:
 /// cache release is triggered.
 ///
 /// - (Partial) cache releases will be triggered either manually by calling
-/// \p ReleaseCache or automatically if a direct allocation fails after
-/// observing a cache miss.
+/// \p ReleaseCache or automatically if a direct allocation fails or would
+/// exceed the limit set by \p SetReservedLimit after observing a cache miss.
+///
+/// - Requests of 1 MiB and more are rounded up to geometric size classes (four
+/// per power of two) so that freed blocks can be reused by requests of similar
+/// sizes. This bounds the growth of fragmentation in long-running sessions.
 ///
 class CachedMemoryManager : public DeviceMemoryManager {
 public:
@@ -151,14 +205,55 @@ public:
     /// Note that this may also affect other instances of CachedMemoryManager.
     static void ReleaseCache();
 
+    /// Limits the memory that the cache reserves on device \p device to
+    /// \p byte_size bytes. Cached blocks are released to stay within the
+    /// limit. Allocations that cannot be served within the limit throw.
+    static void SetReservedLimit(const Device& device, size_t byte_size);
+
+    /// Returns the usage and fragmentation statistics of device \p device.
+    static CachedMemoryStatistics GetStatistics(const Device& device);
+
+    /// Resets the high-water marks of device \p device to the current usage.
+    static void ResetPeakStatistics(const Device& device);
+
+    /// Returns the devices that the cache has been used for.
+    static std::vector<Device> GetDevices();
+
 protected:
     std::shared_ptr<DeviceMemoryManager> device_mm_;
 };
 
+/// NUMA placement policy for allocations made by CPUMemoryManager.
+enum class NumaPolicy {
+    /// Pages are placed on the node of the thread that first touches them.
+    FirstTouch,
+    /// Pages are placed on the node of the allocating thread.
+    Local,
+    /// Pages are interleaved across all NUMA nodes.
+    Interleave,
+    /// Pages are bound to a single NUMA node.
+    Bind,
+};
+
 /// Direct memory manager which performs allocations and deallocations on the
 /// CPU via \p std::malloc and \p std::free.
+///
+/// On Linux systems with more than one NUMA node, allocations of at least one
+/// page follow the NUMA policy set by SetNumaPolicy(). Single-node systems and
+/// other platforms always use first-touch placement.
 class CPUMemoryManager : public DeviceMemoryManager {
 public:
+    /// Sets the NUMA placement policy of subsequent CPU allocations.
+    /// \param policy The placement policy.
+    /// \param node The NUMA node for NumaPolicy::Bind, ignored otherwise.
+    static void SetNumaPolicy(NumaPolicy policy, int node = 0);
+
+    /// Returns the current NUMA placement policy.
+    static NumaPolicy GetNumaPolicy();
+
+    /// Returns the NUMA node used by NumaPolicy::Bind.
+    static int GetNumaNode();
+
     /// Allocates memory of \p byte_size bytes on device \p device and returns a
     /// pointer to the beginning of the allocated memory block.
     void* Malloc(size_t byte_size, const Device& device) override;
@@ -198,6 +293,42 @@ public:
 protected:
     bool IsCUDAPointer(const void* ptr, const Device& device);
 };
+
+/// Direct memory manager which performs page-locked host allocations via
+/// \p cudaHostAlloc and \p cudaFreeHost. Host-device copies from and to
+/// page-locked memory skip the pageable staging buffer and can be truly
+/// asynchronous. If constructed with \p mapped, the memory is also mapped into
+/// the address space of all CUDA devices.
+class PinnedMemoryManager : public DeviceMemoryManager {
+public:
+    explicit PinnedMemoryManager(bool mapped = false);
+
+    /// Allocates memory of \p byte_size bytes on device \p device and returns a
+    /// pointer to the beginning of the allocated memory block. \p device must
+    /// be a CPU device.
+    void* Malloc(size_t byte_size, const Device& device) override;
+
+    /// Frees previously allocated memory at address \p ptr on device \p device.
+    void Free(void* ptr, const Device& device) override;
+
+    /// Copies \p num_bytes bytes of memory at address \p src_ptr on device
+    /// \p src_device to address \p dst_ptr on device \p dst_device.
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+    /// Returns true if \p ptr points to page-locked host memory.
+    static bool IsPinnedPointer(const void* ptr);
+
+    /// Returns the pointer under which the host-mapped memory at \p host_ptr
+    /// is accessible from the CUDA device \p device.
+    static void* GetMappedDevicePointer(void* host_ptr, const Device& device);
+
+protected:
+    bool mapped_;
+};
 #endif
 
 }  // namespace core
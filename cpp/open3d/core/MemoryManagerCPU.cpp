@@ -24,15 +24,111 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <atomic>
 #include <cstdlib>
+#include <vector>
+
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "open3d/core/MemoryManager.h"
+#include "open3d/utility/CPUInfo.h"
 
 namespace open3d {
 namespace core {
 
+static std::atomic<NumaPolicy> numa_policy(NumaPolicy::FirstTouch);
+static std::atomic<int> numa_node(0);
+
+#ifdef __linux__
+// Memory policy modes and flags of mbind(2), see linux/mempolicy.h. They are
+// defined here to avoid a dependency on libnuma.
+static constexpr int kMPolPreferred = 1;
+static constexpr int kMPolBind = 2;
+static constexpr int kMPolInterleave = 3;
+static constexpr unsigned kMPolMFMove = 1 << 1;
+
+/// Applies the current NUMA policy to the whole pages in [ptr, ptr + size).
+/// \p ptr must be page-aligned.
+static void ApplyNumaPolicy(void* ptr, size_t byte_size, size_t page_size) {
+    const utility::CPUInfo& cpu_info = utility::CPUInfo::GetInstance();
+    const int num_nodes = cpu_info.NumNumaNodes();
+    constexpr int bits_per_word = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> node_mask((num_nodes + bits_per_word - 1) /
+                                         bits_per_word);
+    auto set_node = [&node_mask](int node) {
+        node_mask[node / bits_per_word] |= 1UL << (node % bits_per_word);
+    };
+
+    int mode = 0;
+    switch (numa_policy.load()) {
+        case NumaPolicy::Local:
+            mode = kMPolPreferred;
+            set_node(cpu_info.NumaNodeOfCPU(sched_getcpu()));
+            break;
+        case NumaPolicy::Interleave:
+            mode = kMPolInterleave;
+            for (int node = 0; node < num_nodes; ++node) {
+                set_node(node);
+            }
+            break;
+        case NumaPolicy::Bind:
+            mode = kMPolBind;
+            set_node(numa_node.load());
+            break;
+        default:
+            return;
+    }
+
+    const size_t bind_size = byte_size / page_size * page_size;
+    if (syscall(SYS_mbind, ptr, bind_size, mode, node_mask.data(),
+                num_nodes + 1, kMPolMFMove) != 0) {
+        static std::atomic<bool> warned(false);
+        if (!warned.exchange(true)) {
+            utility::LogWarning(
+                    "mbind failed, CPU allocations fall back to first-touch "
+                    "NUMA placement.");
+        }
+    }
+}
+#endif
+
+void CPUMemoryManager::SetNumaPolicy(NumaPolicy policy, int node) {
+    if (policy == NumaPolicy::Bind) {
+        const int num_nodes = utility::CPUInfo::GetInstance().NumNumaNodes();
+        if (node < 0 || node >= num_nodes) {
+            utility::LogError(
+                    "Cannot bind to NUMA node {}, the system has {} node(s).",
+                    node, num_nodes);
+        }
+        numa_node = node;
+    }
+    numa_policy = policy;
+}
+
+NumaPolicy CPUMemoryManager::GetNumaPolicy() { return numa_policy.load(); }
+
+int CPUMemoryManager::GetNumaNode() { return numa_node.load(); }
+
 void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
     void* ptr;
+#ifdef __linux__
+    static const size_t page_size = sysconf(_SC_PAGESIZE);
+    if (numa_policy.load() != NumaPolicy::FirstTouch &&
+        byte_size >= page_size &&
+        utility::CPUInfo::GetInstance().NumNumaNodes() > 1) {
+        // Page alignment makes sure the policy only covers pages owned by this
+        // allocation. The block is still released with std::free.
+        if (posix_memalign(&ptr, page_size, byte_size) != 0) {
+            utility::LogError("CPU malloc failed");
+        }
+        ApplyNumaPolicy(ptr, byte_size, page_size);
+        return ptr;
+    }
+#endif
     ptr = std::malloc(byte_size);
     if (byte_size != 0 && !ptr) {
         utility::LogError("CPU malloc failed");
@@ -105,6 +105,25 @@ public:
         return ((byte_size + alignment - 1) / alignment) * alignment;
     }
 
+    /// Computes the internal byte size of a request. Small requests are only
+    /// aligned. Large requests are rounded up to one of
+    /// kSizeClassesPerPowerOfTwo geometric size classes, which bounds the
+    /// internal waste to 1 / kSizeClassesPerPowerOfTwo and lets freed blocks be
+    /// reused by requests of similar sizes instead of splitting them further.
+    static size_t SizeClassByteSize(size_t byte_size) {
+        byte_size = AlignByteSize(byte_size);
+        if (byte_size < kMinSizeClassByteSize) {
+            return byte_size;
+        }
+
+        size_t power_of_two = kMinSizeClassByteSize;
+        while (power_of_two <= byte_size / 2) {
+            power_of_two *= 2;
+        }
+        return AlignByteSize(byte_size,
+                             power_of_two / kSizeClassesPerPowerOfTwo);
+    }
+
     /// Allocates memory from the set of free virtual blocks.
     /// Returns nullptr if no suitable block was found.
     void* Malloc(size_t byte_size) {
@@ -113,11 +132,13 @@ public:
         auto free_block = ExtractFreeBlock(byte_size);
 
         if (free_block != nullptr) {
+            num_cache_hits_++;
             size_t remaining_size = free_block->byte_size_ - byte_size;
 
             if (remaining_size == 0) {
                 // No update of real block required for perfect fit.
                 allocated_virtual_blocks_.emplace(free_block->ptr_, free_block);
+                CountAllocated(free_block->byte_size_);
 
                 return free_block->ptr_;
             } else {
@@ -136,11 +157,13 @@ public:
 
                 allocated_virtual_blocks_.emplace(new_block->ptr_, new_block);
                 free_virtual_blocks_.insert(remaining_block);
+                CountAllocated(new_block->byte_size_);
 
                 return new_block->ptr_;
             }
         }
 
+        num_cache_misses_++;
         return nullptr;
     }
 
@@ -160,6 +183,7 @@ public:
 
         auto v_block = ptr_it->second;
         allocated_virtual_blocks_.erase(ptr_it);
+        allocated_bytes_ -= v_block->byte_size_;
 
         auto r_block = v_block->r_block_.lock();
         auto& v_block_set = r_block->v_blocks_;
@@ -238,6 +262,10 @@ public:
 
         real_blocks_.insert(r_block);
         allocated_virtual_blocks_.emplace(v_block->ptr_, v_block);
+
+        reserved_bytes_ += byte_size;
+        peak_reserved_bytes_ = std::max(peak_reserved_bytes_, reserved_bytes_);
+        CountAllocated(byte_size);
     }
 
     /// Releases ownership of unused real allocated blocks whose sizes sum up to
@@ -280,6 +308,7 @@ public:
             releasable_real_blocks.erase(r_block);
             released_pointers.emplace_back(r_block->ptr_, r_block->device_mm_);
             released_size += r_block->byte_size_;
+            reserved_bytes_ -= r_block->byte_size_;
         }
 
         return released_pointers;
@@ -297,7 +326,60 @@ public:
     /// True if the set of allocated real blocks is empty, false otherwise
     bool Empty() const { return Size() == 0; }
 
+    /// Returns the number of bytes held in real blocks.
+    size_t GetReservedBytes() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return reserved_bytes_;
+    }
+
+    /// Returns the maximum number of bytes that real blocks may hold.
+    size_t GetReservedLimit() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        return reserved_limit_;
+    }
+
+    /// Sets the maximum number of bytes that real blocks may hold.
+    void SetReservedLimit(size_t byte_size) {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        reserved_limit_ = byte_size;
+    }
+
+    /// Returns a snapshot of the usage and fragmentation of the cache.
+    CachedMemoryStatistics GetStatistics() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        CachedMemoryStatistics statistics;
+        statistics.reserved_bytes_ = reserved_bytes_;
+        statistics.peak_reserved_bytes_ = peak_reserved_bytes_;
+        statistics.reserved_limit_ = reserved_limit_;
+        statistics.allocated_bytes_ = allocated_bytes_;
+        statistics.peak_allocated_bytes_ = peak_allocated_bytes_;
+        statistics.free_bytes_ = reserved_bytes_ - allocated_bytes_;
+        statistics.largest_free_block_bytes_ =
+                free_virtual_blocks_.empty()
+                        ? 0
+                        : (*free_virtual_blocks_.rbegin())->byte_size_;
+        statistics.num_real_blocks_ = real_blocks_.size();
+        statistics.num_free_blocks_ = free_virtual_blocks_.size();
+        statistics.num_cache_hits_ = num_cache_hits_;
+        statistics.num_cache_misses_ = num_cache_misses_;
+        return statistics;
+    }
+
+    /// Resets the high-water marks to the current usage.
+    void ResetPeakStatistics() {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        peak_reserved_bytes_ = reserved_bytes_;
+        peak_allocated_bytes_ = allocated_bytes_;
+    }
+
 private:
+    void CountAllocated(size_t byte_size) {
+        allocated_bytes_ += byte_size;
+        peak_allocated_bytes_ =
+                std::max(peak_allocated_bytes_, allocated_bytes_);
+    }
+
     /// Finds and extracts a suitable free block from the cache.
     /// Strategy:
     ///  - Best fit: argmin_x { x.byte_size_ >= byte_size }.
@@ -349,6 +431,20 @@ private:
     /// Heuristic constant to bound fragmentation.
     const double kMaxFragmentation = 4.0;
 
+    /// Requests of at least this size are rounded up to size classes.
+    static constexpr size_t kMinSizeClassByteSize = 1 << 20;
+
+    /// Number of size classes between two consecutive powers of two.
+    static constexpr size_t kSizeClassesPerPowerOfTwo = 4;
+
+    size_t reserved_bytes_ = 0;
+    size_t peak_reserved_bytes_ = 0;
+    size_t allocated_bytes_ = 0;
+    size_t peak_allocated_bytes_ = 0;
+    size_t reserved_limit_ = std::numeric_limits<size_t>::max();
+    size_t num_cache_hits_ = 0;
+    size_t num_cache_misses_ = 0;
+
     std::set<std::shared_ptr<RealBlock>, SizeOrder<RealBlock>> real_blocks_;
 
     std::unordered_map<void*, std::shared_ptr<VirtualBlock>>
@@ -400,14 +496,33 @@ public:
                  const std::shared_ptr<DeviceMemoryManager>& device_mm) {
         Init(device);
 
-        size_t internal_byte_size = MemoryCache::AlignByteSize(byte_size);
+        size_t internal_byte_size = MemoryCache::SizeClassByteSize(byte_size);
 
         // Malloc from cache.
-        void* ptr = device_caches_.at(device).Malloc(internal_byte_size);
+        MemoryCache& cache = device_caches_.at(device);
+        void* ptr = cache.Malloc(internal_byte_size);
         if (ptr != nullptr) {
             return ptr;
         }
 
+        // Keep the reserved memory within the limit by releasing cached
+        // blocks first.
+        const size_t reserved_limit = cache.GetReservedLimit();
+        if (internal_byte_size > reserved_limit ||
+            cache.GetReservedBytes() > reserved_limit - internal_byte_size) {
+            FreeReleased(cache.Release(cache.GetReservedBytes() +
+                                       internal_byte_size - reserved_limit),
+                         device);
+            if (cache.GetReservedBytes() + internal_byte_size >
+                reserved_limit) {
+                utility::LogError(
+                        "Allocating {} bytes exceeds the cache limit of {} "
+                        "bytes on {} with {} bytes in use.",
+                        internal_byte_size, reserved_limit, device.ToString(),
+                        cache.GetReservedBytes());
+            }
+        }
+
         // Malloc from real memory manager.
         try {
             ptr = device_mm->Malloc(internal_byte_size, device);
@@ -416,21 +531,13 @@ public:
 
         // Free cached memory and try again.
         if (ptr == nullptr) {
-            auto old_ptrs =
-                    device_caches_.at(device).Release(internal_byte_size);
-            for (const auto& old_pair : old_ptrs) {
-                // Simulate C++17 structured bindings for better readability.
-                const auto& old_ptr = old_pair.first;
-                const auto& old_device_mm = old_pair.second;
-
-                old_device_mm->Free(old_ptr, device);
-            }
+            FreeReleased(cache.Release(internal_byte_size), device);
 
             // Do not catch the error if the allocation still fails.
             ptr = device_mm->Malloc(internal_byte_size, device);
         }
 
-        device_caches_.at(device).Acquire(ptr, internal_byte_size, device_mm);
+        cache.Acquire(ptr, internal_byte_size, device_mm);
 
         return ptr;
     }
@@ -444,36 +551,63 @@ public:
     void Clear(const Device& device) {
         Init(device);
 
-        auto old_ptrs = device_caches_.at(device).ReleaseAll();
-        for (const auto& old_pair : old_ptrs) {
-            // Simulate C++17 structured bindings for better readability.
-            const auto& old_ptr = old_pair.first;
-            const auto& old_device_mm = old_pair.second;
+        FreeReleased(device_caches_.at(device).ReleaseAll(), device);
+    }
 
-            old_device_mm->Free(old_ptr, device);
+    void Clear() {
+        for (const auto& device : GetDevices()) {
+            Clear(device);
         }
     }
 
-    void Clear() {
-        // Collect all devices in a thread-safe manner. This avoids potential
-        // issues with newly initialized/inserted elements while iterating over
-        // the container.
+    /// Collects all devices in a thread-safe manner. This avoids potential
+    /// issues with newly initialized/inserted elements while iterating over
+    /// the container.
+    std::vector<Device> GetDevices() {
         std::vector<Device> devices;
-        {
-            std::lock_guard<std::recursive_mutex> lock(init_mutex_);
-            for (const auto& cache_pair : device_caches_) {
-                devices.push_back(cache_pair.first);
-            }
+        std::lock_guard<std::recursive_mutex> lock(init_mutex_);
+        for (const auto& cache_pair : device_caches_) {
+            devices.push_back(cache_pair.first);
         }
+        return devices;
+    }
 
-        for (const auto& device : devices) {
-            Clear(device);
-        }
+    CachedMemoryStatistics GetStatistics(const Device& device) {
+        Init(device);
+
+        return device_caches_.at(device).GetStatistics();
+    }
+
+    void ResetPeakStatistics(const Device& device) {
+        Init(device);
+
+        device_caches_.at(device).ResetPeakStatistics();
+    }
+
+    void SetReservedLimit(const Device& device, size_t byte_size) {
+        Init(device);
+
+        device_caches_.at(device).SetReservedLimit(byte_size);
     }
 
 private:
     Cacher() = default;
 
+    /// Returns released real blocks to their direct memory managers.
+    static void FreeReleased(
+            const std::vector<std::pair<void*,
+                                        std::shared_ptr<DeviceMemoryManager>>>&
+                    old_ptrs,
+            const Device& device) {
+        for (const auto& old_pair : old_ptrs) {
+            // Simulate C++17 structured bindings for better readability.
+            const auto& old_ptr = old_pair.first;
+            const auto& old_device_mm = old_pair.second;
+
+            old_device_mm->Free(old_ptr, device);
+        }
+    }
+
     /// Resolves race conditions and avoids locking in the operations.
     /// Must be called at the beginning of all operations.
     void Init(const Device& device) {
@@ -529,5 +663,40 @@ void CachedMemoryManager::ReleaseCache(const Device& device) {
 
 void CachedMemoryManager::ReleaseCache() { Cacher::GetInstance().Clear(); }
 
+void CachedMemoryManager::SetReservedLimit(const Device& device,
+                                           size_t byte_size) {
+    Cacher::GetInstance().SetReservedLimit(device, byte_size);
+}
+
+CachedMemoryStatistics CachedMemoryManager::GetStatistics(
+        const Device& device) {
+    return Cacher::GetInstance().GetStatistics(device);
+}
+
+void CachedMemoryManager::ResetPeakStatistics(const Device& device) {
+    Cacher::GetInstance().ResetPeakStatistics(device);
+}
+
+std::vector<Device> CachedMemoryManager::GetDevices() {
+    return Cacher::GetInstance().GetDevices();
+}
+
+double CachedMemoryStatistics::GetFragmentation() const {
+    if (free_bytes_ == 0) {
+        return 0.0;
+    }
+    return 1.0 - static_cast<double>(largest_free_block_bytes_) /
+                         static_cast<double>(free_bytes_);
+}
+
+double CachedMemoryStatistics::GetHitRate() const {
+    const size_t num_mallocs = num_cache_hits_ + num_cache_misses_;
+    if (num_mallocs == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(num_cache_hits_) /
+           static_cast<double>(num_mallocs);
+}
+
 }  // namespace core
 }  // namespace open3d
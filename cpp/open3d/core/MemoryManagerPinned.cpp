@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <cstring>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+PinnedMemoryManager::PinnedMemoryManager(bool mapped) : mapped_(mapped) {}
+
+void* PinnedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("PinnedMemoryManager::Malloc: Unimplemented device.");
+    }
+
+    void* ptr = nullptr;
+    unsigned int flags = cudaHostAllocPortable;
+    if (mapped_) {
+        flags |= cudaHostAllocMapped;
+    }
+    OPEN3D_CUDA_CHECK(cudaHostAlloc(&ptr, byte_size, flags));
+    return ptr;
+}
+
+void PinnedMemoryManager::Free(void* ptr, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("PinnedMemoryManager::Free: Unimplemented device.");
+    }
+    if (ptr) {
+        OPEN3D_CUDA_CHECK(cudaFreeHost(ptr));
+    }
+}
+
+void PinnedMemoryManager::Memcpy(void* dst_ptr,
+                                 const Device& dst_device,
+                                 const void* src_ptr,
+                                 const Device& src_device,
+                                 size_t num_bytes) {
+    if (dst_device.GetType() != Device::DeviceType::CPU ||
+        src_device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("PinnedMemoryManager::Memcpy: Unimplemented device.");
+    }
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+bool PinnedMemoryManager::IsPinnedPointer(const void* ptr) {
+    cudaPointerAttributes attributes;
+    if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess) {
+        // Clear the error state for pointers unknown to CUDA.
+        cudaGetLastError();
+        return false;
+    }
+    return attributes.type == cudaMemoryTypeHost;
+}
+
+void* PinnedMemoryManager::GetMappedDevicePointer(void* host_ptr,
+                                                  const Device& device) {
+    CUDAScopedDevice scoped_device(device);
+
+    void* device_ptr = nullptr;
+    OPEN3D_CUDA_CHECK(cudaHostGetDevicePointer(&device_ptr, host_ptr, 0));
+    return device_ptr;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -85,8 +85,10 @@ void MemoryManagerStatistic::Print() const {
     auto old_level = utility::GetVerbosityLevel();
     utility::SetVerbosityLevel(utility::VerbosityLevel::Info);
 
-    utility::LogInfo("Memory Statistics: (Device) (#Malloc) (#Free)");
-    utility::LogInfo("---------------------------------------------");
+    utility::LogInfo(
+            "Memory Statistics: (Device) (#Malloc) (#Free) (Peak bytes)");
+    utility::LogInfo(
+            "----------------------------------------------------------");
     for (const auto& value_pair : statistics_) {
         // Simulate C++17 structured bindings for better readability.
         const auto& device = value_pair.first;
@@ -117,11 +119,13 @@ void MemoryManagerStatistic::Print() const {
                                     leak.second);
             }
         } else {
-            utility::LogInfo("{}: {} {}", device.ToString(),
-                             statistics.count_malloc_, statistics.count_free_);
+            utility::LogInfo("{}: {} {} {}", device.ToString(),
+                             statistics.count_malloc_, statistics.count_free_,
+                             statistics.peak_allocated_bytes_);
         }
     }
-    utility::LogInfo("---------------------------------------------");
+    utility::LogInfo(
+            "----------------------------------------------------------");
 
     // Restore old verbosity level.
     utility::SetVerbosityLevel(old_level);
@@ -144,9 +148,13 @@ void MemoryManagerStatistic::CountMalloc(void* ptr,
         return;
     }
 
-    auto it = statistics_[device].active_allocations_.emplace(ptr, byte_size);
+    MemoryStatistics& statistics = statistics_[device];
+    auto it = statistics.active_allocations_.emplace(ptr, byte_size);
     if (it.second) {
-        statistics_[device].count_malloc_++;
+        statistics.count_malloc_++;
+        statistics.allocated_bytes_ += byte_size;
+        statistics.peak_allocated_bytes_ = std::max(
+                statistics.peak_allocated_bytes_, statistics.allocated_bytes_);
         if (print_at_malloc_free_) {
             utility::LogInfo("[Malloc] {}: {} @ {} bytes",
                              fmt::sprintf("%6s", device.ToString()),
@@ -175,6 +183,8 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
                              fmt::ptr(ptr),
                              statistics_[device].active_allocations_.at(ptr));
         }
+        statistics_[device].allocated_bytes_ -=
+                statistics_[device].active_allocations_.at(ptr);
         statistics_[device].active_allocations_.erase(ptr);
         statistics_[device].count_free_++;
     } else if (num_to_erase == 0) {
@@ -188,6 +198,27 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
     }
 }
 
+size_t MemoryManagerStatistic::GetAllocatedBytes(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.allocated_bytes_;
+}
+
+size_t MemoryManagerStatistic::GetPeakAllocatedBytes(const Device& device) {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    return it == statistics_.end() ? 0 : it->second.peak_allocated_bytes_;
+}
+
+std::vector<Device> MemoryManagerStatistic::GetDevices() {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    std::vector<Device> devices;
+    for (const auto& kv : statistics_) {
+        devices.push_back(kv.first);
+    }
+    return devices;
+}
+
 void MemoryManagerStatistic::Reset() {
     std::lock_guard<std::mutex> lock(statistics_mutex_);
     statistics_.clear();
@@ -30,6 +30,7 @@
 #include <map>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Device.h"
 
@@ -73,6 +74,16 @@ public:
     /// otherwise.
     bool HasLeaks() const;
 
+    /// Returns the number of bytes currently allocated on \p device.
+    size_t GetAllocatedBytes(const Device& device);
+
+    /// Returns the maximum number of bytes allocated at the same time on
+    /// \p device since the last reset (high-water mark).
+    size_t GetPeakAllocatedBytes(const Device& device);
+
+    /// Returns the devices with recorded allocations since the last reset.
+    std::vector<Device> GetDevices();
+
     /// Adds the given allocation to the statistics.
     void CountMalloc(void* ptr, size_t byte_size, const Device& device);
 
@@ -92,6 +103,8 @@ private:
 
         int64_t count_malloc_ = 0;
         int64_t count_free_ = 0;
+        size_t allocated_bytes_ = 0;
+        size_t peak_allocated_bytes_ = 0;
         std::unordered_map<void*, size_t> active_allocations_;
     };
 
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Metrics.h"
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/utility/Metrics.h"
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+using utility::MetricFamily;
+using utility::MetricType;
+
+void AddSample(MetricFamily& family, const Device& device, double value) {
+    family.samples.push_back({family.name, {{"device", device.ToString()}},
+                              value});
+}
+
+MetricFamily MakeFamily(const std::string& name,
+                        const std::string& help,
+                        MetricType type = MetricType::Gauge) {
+    MetricFamily family;
+    family.name = name;
+    family.help = help;
+    family.type = type;
+    return family;
+}
+
+/// Reads the allocation and cache statistics of all devices seen so far.
+void CollectMemoryMetrics(std::vector<MetricFamily>& families) {
+    MemoryManagerStatistic& statistic = MemoryManagerStatistic::GetInstance();
+    MetricFamily allocated = MakeFamily("open3d_memory_allocated_bytes",
+                                        "Bytes currently allocated.");
+    MetricFamily peak = MakeFamily("open3d_memory_peak_allocated_bytes",
+                                   "Peak number of allocated bytes.");
+    for (const Device& device : statistic.GetDevices()) {
+        AddSample(allocated, device,
+                  double(statistic.GetAllocatedBytes(device)));
+        AddSample(peak, device,
+                  double(statistic.GetPeakAllocatedBytes(device)));
+    }
+
+    MetricFamily reserved = MakeFamily(
+            "open3d_cached_memory_reserved_bytes",
+            "Bytes reserved by the cached memory manager.");
+    MetricFamily limit = MakeFamily(
+            "open3d_cached_memory_reserved_limit_bytes",
+            "Maximum number of bytes the cached memory manager may reserve.");
+    MetricFamily free = MakeFamily("open3d_cached_memory_free_bytes",
+                                   "Reserved bytes that are cached for reuse.");
+    MetricFamily fragmentation = MakeFamily(
+            "open3d_cached_memory_fragmentation",
+            "Fraction of the free cached bytes outside of the largest free "
+            "block.");
+    MetricFamily hits = MakeFamily("open3d_cached_memory_hits_total",
+                                   "Allocations served from cached blocks.",
+                                   MetricType::Counter);
+    MetricFamily misses = MakeFamily(
+            "open3d_cached_memory_misses_total",
+            "Allocations served by the direct memory manager.",
+            MetricType::Counter);
+    MetricFamily hit_rate = MakeFamily(
+            "open3d_cached_memory_hit_rate",
+            "Fraction of allocations served from cached blocks.");
+    for (const Device& device : CachedMemoryManager::GetDevices()) {
+        const CachedMemoryStatistics stats =
+                CachedMemoryManager::GetStatistics(device);
+        AddSample(reserved, device, double(stats.reserved_bytes_));
+        AddSample(limit, device, double(stats.reserved_limit_));
+        AddSample(free, device, double(stats.free_bytes_));
+        AddSample(fragmentation, device, stats.GetFragmentation());
+        AddSample(hits, device, double(stats.num_cache_hits_));
+        AddSample(misses, device, double(stats.num_cache_misses_));
+        AddSample(hit_rate, device, stats.GetHitRate());
+    }
+
+    for (MetricFamily* family : {&allocated, &peak, &reserved, &limit, &free,
+                                 &fragmentation, &hits, &misses, &hit_rate}) {
+        if (!family->samples.empty()) {
+            families.push_back(std::move(*family));
+        }
+    }
+}
+
+const int memory_collector_id =
+        utility::MetricsRegistry::GetInstance().AddCollector(
+                CollectMemoryMetrics);
+
+utility::MetricLabels DeviceTypeLabels(Device::DeviceType type) {
+    return {{"device_type", type == Device::DeviceType::CUDA ? "CUDA" : "CPU"}};
+}
+
+}  // namespace
+
+void CountKernelLaunch(const Device& device) {
+    // The counters are looked up once, ParallelFor calls this per launch.
+    static const std::string help = "Number of launched ParallelFor kernels.";
+    static utility::Counter& cpu_launches =
+            utility::MetricsRegistry::GetInstance().GetCounter(
+                    "open3d_kernel_launches_total", help,
+                    DeviceTypeLabels(Device::DeviceType::CPU));
+    static utility::Counter& cuda_launches =
+            utility::MetricsRegistry::GetInstance().GetCounter(
+                    "open3d_kernel_launches_total", help,
+                    DeviceTypeLabels(Device::DeviceType::CUDA));
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        cuda_launches.Increment();
+    } else {
+        cpu_launches.Increment();
+    }
+}
+
+void ObserveHashMapInsert(const Device& device,
+                          int64_t new_size,
+                          int64_t capacity,
+                          bool rehashed) {
+    utility::MetricsRegistry& registry =
+            utility::MetricsRegistry::GetInstance();
+    const utility::MetricLabels labels = DeviceTypeLabels(device.GetType());
+    if (capacity > 0) {
+        registry.GetHistogram("open3d_hashmap_load_factor",
+                              "Hash map size over capacity on insertion, "
+                              "before rehashing.",
+                              {0.25, 0.5, 0.75, 0.9, 1.0, 2.0}, labels)
+                .Observe(double(new_size) / double(capacity));
+    }
+    if (rehashed) {
+        registry.GetCounter("open3d_hashmap_rehashes_total",
+                            "Number of hash map rehashes caused by "
+                            "insertions.",
+                            labels)
+                .Increment();
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
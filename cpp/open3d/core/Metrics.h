@@ -0,0 +1,52 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+/// Counts a kernel launch on \p device in the
+/// open3d_kernel_launches_total{device_type} counter of the
+/// utility::MetricsRegistry.
+void CountKernelLaunch(const Device& device);
+
+/// Records an insertion into a hash map on \p device that grows its size to
+/// \p new_size. The load factor new_size / \p capacity, taken before a
+/// possible rehash, is observed in open3d_hashmap_load_factor and
+/// \p rehashed is counted in open3d_hashmap_rehashes_total.
+void ObserveHashMapInsert(const Device& device,
+                          int64_t new_size,
+                          int64_t capacity,
+                          bool rehashed);
+
+}  // namespace core
+}  // namespace open3d
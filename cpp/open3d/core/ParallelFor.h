@@ -30,6 +30,7 @@
 #include <type_traits>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/Metrics.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Overload.h"
 #include "open3d/utility/Parallel.h"
@@ -75,6 +76,7 @@ void ParallelForCUDA_(const Device& device, int64_t n, const func_t& func) {
         return;
     }
 
+    CountKernelLaunch(device);
     CUDAScopedDevice scoped_device(device);
     int64_t items_per_block = OPEN3D_PARFOR_BLOCK * OPEN3D_PARFOR_THREAD;
     int64_t grid_size = (n + items_per_block - 1) / items_per_block;
@@ -87,7 +89,8 @@ void ParallelForCUDA_(const Device& device, int64_t n, const func_t& func) {
 
 #else
 
-/// Run a function in parallel on CPU.
+/// Run a function in parallel on CPU, using the work-stealing scheduler of
+/// utility::ParallelForRange(). Nested calls share the same thread pool.
 template <typename func_t>
 void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
     if (device.GetType() != Device::DeviceType::CPU) {
@@ -98,10 +101,12 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
         return;
     }
 
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
-    for (int64_t i = 0; i < n; ++i) {
-        func(i);
-    }
+    CountKernelLaunch(device);
+    utility::ParallelForRange(n, [&func](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            func(i);
+        }
+    });
 }
 
 #endif
@@ -113,8 +118,8 @@ void ParallelForCPU_(const Device& device, int64_t n, const func_t& func) {
 /// \param func The function to be executed in parallel. The function should
 /// take an int64_t workload index and returns void, i.e., `void func(int64_t)`.
 ///
-/// \note This is optimized for uniform work items, i.e. where each call to \p
-/// func takes the same time.
+/// \note On CPU, work items are scheduled by a work-stealing task arena, so
+/// non-uniform work items are balanced and ParallelFor may be nested.
 /// \note If you use a lambda function, capture only the required variables
 /// instead of all to prevent accidental race conditions. If you want the
 /// kernel to be used on both CPU and CUDA, capture the variables by value.
@@ -183,11 +188,12 @@ void ParallelFor(const Device& device,
 #ifdef __CUDACC__
     ParallelForCUDA_(device, n, func);
 #else
-    int num_threads = utility::EstimateMaxThreads();
-    ParallelForCPU_(device, num_threads, [&](int64_t i) {
-        int64_t start = n * i / num_threads;
-        int64_t end = std::min<int64_t>(n * (i + 1) / num_threads, n);
-        vec_func(start, end);
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError("ParallelFor for CPU cannot run on device {}.",
+                          device.ToString());
+    }
+    utility::ParallelForRange(n, [&vec_func](int64_t begin, int64_t end) {
+        vec_func(begin, end);
     });
 #endif
 
@@ -202,6 +208,33 @@ void ParallelFor(const Device& device,
 #endif
 }
 
+/// Internal marker for element types without a vectorized kernel, e.g.
+/// float16_t. ParallelFor() then runs the scalar function instead.
+struct ScalarFallback_ {};
+
+/// Run \p func in parallel since no vectorized function is available.
+template <typename func_t>
+void ParallelFor(const Device& device,
+                 int64_t n,
+                 const func_t& func,
+                 const ScalarFallback_&) {
+    ParallelFor(device, n, func);
+}
+
+/// Internal helper for OPEN3D_TEMPLATE_VECTORIZED. Returns \p vec_func for
+/// arithmetic types and ScalarFallback_ otherwise.
+template <typename T, typename vec_func_t>
+typename std::enable_if<std::is_arithmetic<T>::value, vec_func_t>::type
+TemplateVectorized_(const vec_func_t& vec_func) {
+    return vec_func;
+}
+
+template <typename T, typename vec_func_t>
+typename std::enable_if<!std::is_arithmetic<T>::value, ScalarFallback_>::type
+TemplateVectorized_(const vec_func_t&) {
+    return ScalarFallback_{};
+}
+
 #ifdef BUILD_ISPC_MODULE
 
 // Internal helper macro.
@@ -249,15 +282,16 @@ void ParallelFor(const Device& device,
 /// - unsigned + signed {8,16,32,64} bit integers,
 /// - float, double
 ///
+/// Other types, e.g. float16_t, have no vectorized kernel and make
+/// ParallelFor() fall back to the scalar function.
+///
 /// Use the OPEN3D_EXPORT_TEMPLATE_VECTORIZED macro to define the
 /// kernel in the ISPC source file.
 ///
 /// Note: The arguments to the kernel only have to exist if ISPC support is
 /// enabled via BUILD_ISPC_MODULE=ON.
 #define OPEN3D_TEMPLATE_VECTORIZED(T, ISPCKernel, ...)                        \
-    [&](int64_t start, int64_t end) {                                         \
-        static_assert(std::is_arithmetic<T>::value,                           \
-                      "Data type is not an arithmetic type");                 \
+    open3d::core::TemplateVectorized_<T>([&](int64_t start, int64_t end) {    \
         utility::Overload(                                                    \
                 OPEN3D_OVERLOADED_LAMBDA_(bool, ISPCKernel, __VA_ARGS__),     \
                 OPEN3D_OVERLOADED_LAMBDA_(uint8_t, ISPCKernel, __VA_ARGS__),  \
@@ -277,7 +311,7 @@ void ParallelFor(const Device& device,
                             typeid(generic).name(),                           \
                             OPEN3D_STRINGIFY(ISPCKernel));                    \
                 })(T{}, start, end);                                          \
-    }
+    })
 
 }  // namespace core
 }  // namespace open3d
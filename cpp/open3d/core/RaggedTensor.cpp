@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/RaggedTensor.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Returns Int64 row splits on \p device from the row lengths computed on the
+/// host.
+static Tensor RowSplitsFromLengths(const std::vector<int64_t>& row_lengths,
+                                   const Device& device) {
+    std::vector<int64_t> row_splits(row_lengths.size() + 1, 0);
+    std::partial_sum(row_lengths.begin(), row_lengths.end(),
+                     row_splits.begin() + 1);
+    return Tensor(row_splits, {int64_t(row_splits.size())}, Int64, device);
+}
+
+RaggedTensor::RaggedTensor()
+    : values_(Tensor::Empty({0}, Float32)),
+      row_splits_(Tensor::Zeros({1}, Int64)) {}
+
+RaggedTensor::RaggedTensor(const Tensor& values, const Tensor& row_splits)
+    : values_(values), row_splits_(row_splits) {
+    if (values_.NumDims() == 0) {
+        utility::LogError("values must have at least one dimension.");
+    }
+    AssertTensorDtype(row_splits_, Int64);
+    AssertTensorDevice(row_splits_, values_.GetDevice());
+    if (row_splits_.NumDims() != 1 || row_splits_.GetLength() == 0) {
+        utility::LogError(
+                "row_splits must be a 1-D tensor with at least one element, "
+                "but got shape {}.",
+                row_splits_.GetShape());
+    }
+    const std::vector<int64_t> splits = row_splits_.ToFlatVector<int64_t>();
+    if (splits.front() != 0 || splits.back() != values_.GetLength()) {
+        utility::LogError(
+                "row_splits must start with 0 and end with the number of "
+                "values {}, but got {} and {}.",
+                values_.GetLength(), splits.front(), splits.back());
+    }
+    if (!std::is_sorted(splits.begin(), splits.end())) {
+        utility::LogError("row_splits must be non-decreasing.");
+    }
+}
+
+RaggedTensor RaggedTensor::FromRowLengths(const Tensor& values,
+                                          const Tensor& row_lengths) {
+    AssertTensorDtype(row_lengths, Int64);
+    if (row_lengths.NumDims() != 1) {
+        utility::LogError("row_lengths must be a 1-D tensor, but got shape {}.",
+                          row_lengths.GetShape());
+    }
+    return RaggedTensor(values,
+                        RowSplitsFromLengths(
+                                row_lengths.ToFlatVector<int64_t>(),
+                                values.GetDevice()));
+}
+
+RaggedTensor RaggedTensor::FromTensors(const std::vector<Tensor>& tensors) {
+    if (tensors.empty()) {
+        utility::LogError("Expected at least one tensor.");
+    }
+    std::vector<int64_t> row_lengths;
+    for (const Tensor& tensor : tensors) {
+        if (tensor.NumDims() == 0) {
+            utility::LogError("Tensors must have at least one dimension.");
+        }
+        row_lengths.push_back(tensor.GetLength());
+    }
+    const Tensor values = tensors.size() == 1 ? tensors[0].Clone()
+                                              : core::Concatenate(tensors);
+    return RaggedTensor(values,
+                        RowSplitsFromLengths(row_lengths, values.GetDevice()));
+}
+
+RaggedTensor RaggedTensor::Concatenate(
+        const std::vector<RaggedTensor>& ragged_tensors) {
+    if (ragged_tensors.empty()) {
+        utility::LogError("Expected at least one ragged tensor.");
+    }
+    std::vector<Tensor> values;
+    std::vector<int64_t> row_lengths;
+    for (const RaggedTensor& ragged_tensor : ragged_tensors) {
+        values.push_back(ragged_tensor.values_);
+        const std::vector<int64_t> lengths =
+                ragged_tensor.GetRowLengths().ToFlatVector<int64_t>();
+        row_lengths.insert(row_lengths.end(), lengths.begin(), lengths.end());
+    }
+    const Tensor all_values = values.size() == 1 ? values[0].Clone()
+                                                 : core::Concatenate(values);
+    return RaggedTensor(all_values,
+                        RowSplitsFromLengths(row_lengths,
+                                             all_values.GetDevice()));
+}
+
+Tensor RaggedTensor::GetRowLengths() const {
+    const int64_t num_rows = GetNumRows();
+    return row_splits_.Slice(0, 1, num_rows + 1) -
+           row_splits_.Slice(0, 0, num_rows);
+}
+
+Tensor RaggedTensor::GetValueRowIds() const {
+    return kernel::SegmentIds(row_splits_);
+}
+
+Tensor RaggedTensor::operator[](int64_t i) const {
+    const int64_t num_rows = GetNumRows();
+    if (i < -num_rows || i >= num_rows) {
+        utility::LogError("Row index {} is out of range for {} rows.", i,
+                          num_rows);
+    }
+    if (i < 0) {
+        i += num_rows;
+    }
+    return values_.Slice(0, row_splits_[i].Item<int64_t>(),
+                         row_splits_[i + 1].Item<int64_t>());
+}
+
+std::vector<Tensor> RaggedTensor::ToTensors() const {
+    const std::vector<int64_t> splits = row_splits_.ToFlatVector<int64_t>();
+    std::vector<Tensor> tensors;
+    for (size_t i = 0; i + 1 < splits.size(); ++i) {
+        tensors.push_back(values_.Slice(0, splits[i], splits[i + 1]));
+    }
+    return tensors;
+}
+
+RaggedTensor RaggedTensor::Gather(const Tensor& row_indices) const {
+    AssertTensorDtype(row_indices, Int64);
+    AssertTensorDevice(row_indices, GetDevice());
+    if (row_indices.NumDims() != 1) {
+        utility::LogError("row_indices must be a 1-D tensor, but got shape {}.",
+                          row_indices.GetShape());
+    }
+    const Tensor out_row_lengths = GetRowLengths().IndexGet({row_indices});
+    const Tensor out_row_splits = RowSplitsFromLengths(
+            out_row_lengths.ToFlatVector<int64_t>(), GetDevice());
+    const int64_t num_values = out_row_splits[-1].Item<int64_t>();
+    if (num_values == 0) {
+        SizeVector shape = values_.GetShape();
+        shape[0] = 0;
+        return RaggedTensor(Tensor::Empty(shape, GetDtype(), GetDevice()),
+                            out_row_splits);
+    }
+
+    // Value j of output row r is value row_splits[row_indices[r]] + j -
+    // out_row_splits[r] of the input.
+    const Tensor out_row_ids = kernel::SegmentIds(out_row_splits);
+    const Tensor value_indices =
+            row_splits_.IndexGet({row_indices.IndexGet({out_row_ids})}) +
+            Tensor::Arange(0, num_values, 1, Int64, GetDevice()) -
+            out_row_splits.IndexGet({out_row_ids});
+    return RaggedTensor(values_.IndexGet({value_indices}), out_row_splits);
+}
+
+Tensor RaggedTensor::RowSum() const { return values_.SegmentSum(row_splits_); }
+
+Tensor RaggedTensor::RowMean() const {
+    return values_.SegmentMean(row_splits_);
+}
+
+Tensor RaggedTensor::RowMax() const { return values_.SegmentMax(row_splits_); }
+
+Tensor RaggedTensor::RowMin() const { return values_.SegmentMin(row_splits_); }
+
+RaggedTensor RaggedTensor::To(const Device& device, bool copy) const {
+    RaggedTensor ragged_tensor;
+    ragged_tensor.values_ = values_.To(device, copy);
+    ragged_tensor.row_splits_ = row_splits_.To(device, copy);
+    return ragged_tensor;
+}
+
+std::string RaggedTensor::ToString() const {
+    return fmt::format(
+            "RaggedTensor with {} rows, values shape {}, dtype {}, device {}.",
+            GetNumRows(), values_.GetShape().ToString(), GetDtype().ToString(),
+            GetDevice().ToString());
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// A RaggedTensor stores rows of different lengths, e.g. a batch of point
+/// clouds with different numbers of points, without padding. All rows are
+/// concatenated in one values tensor and an Int64 row_splits tensor marks
+/// where each row begins and ends:
+///
+/// - values     : shape {n, ...}
+/// - row_splits : shape {num_rows + 1}, starts with 0, ends with n and is
+///                non-decreasing. Row i is values[row_splits[i]:row_splits[i
+///                + 1]].
+///
+/// This is the layout of the ML ops (e.g. RaggedTensor in the PyTorch ops),
+/// so the tensors can be passed to and from them without conversion. Both
+/// tensors live on the same device and all operations run on that device.
+class RaggedTensor {
+public:
+    /// Constructs an empty Float32 ragged tensor with zero rows on the CPU.
+    RaggedTensor();
+
+    /// Constructs a ragged tensor from values and row splits. The tensors are
+    /// shared, not copied.
+    ///
+    /// \param values Tensor of shape {n, ...}.
+    /// \param row_splits Int64 1-D tensor of shape {num_rows + 1} on the
+    /// device of \p values.
+    RaggedTensor(const Tensor& values, const Tensor& row_splits);
+
+    /// Constructs a ragged tensor from values and the length of each row.
+    ///
+    /// \param values Tensor of shape {n, ...}.
+    /// \param row_lengths Int64 1-D tensor of shape {num_rows}, which sums up
+    /// to n.
+    static RaggedTensor FromRowLengths(const Tensor& values,
+                                       const Tensor& row_lengths);
+
+    /// Constructs a ragged tensor with one row per tensor. The tensors must
+    /// have the same dtype, device and shape except for the first dimension.
+    /// Values are copied.
+    static RaggedTensor FromTensors(const std::vector<Tensor>& tensors);
+
+    /// Appends the rows of all ragged tensors. The ragged tensors must have
+    /// the same dtype, device and value shape except for the first dimension.
+    static RaggedTensor Concatenate(
+            const std::vector<RaggedTensor>& ragged_tensors);
+
+    /// The concatenated rows with shape {n, ...}.
+    const Tensor& GetValues() const { return values_; }
+
+    /// The Int64 row splits with shape {num_rows + 1}.
+    const Tensor& GetRowSplits() const { return row_splits_; }
+
+    int64_t GetNumRows() const { return row_splits_.GetLength() - 1; }
+
+    Dtype GetDtype() const { return values_.GetDtype(); }
+
+    Device GetDevice() const { return values_.GetDevice(); }
+
+    /// Int64 tensor of shape {num_rows} with the length of each row.
+    Tensor GetRowLengths() const;
+
+    /// Int64 tensor of shape {n} with the row of each value.
+    Tensor GetValueRowIds() const;
+
+    /// Returns row \p i as a view of the values.
+    Tensor operator[](int64_t i) const;
+
+    /// Returns all rows as views of the values.
+    std::vector<Tensor> ToTensors() const;
+
+    /// Returns a ragged tensor with the rows \p row_indices in that order.
+    /// Rows may be repeated.
+    ///
+    /// \param row_indices Int64 1-D tensor with values in [0, num_rows).
+    RaggedTensor Gather(const Tensor& row_indices) const;
+
+    /// Sum of each row. Returns a tensor of shape {num_rows, ...}. Empty rows
+    /// are 0.
+    Tensor RowSum() const;
+
+    /// Mean of each row, see RowSum().
+    Tensor RowMean() const;
+
+    /// Maximum of each row, see RowSum().
+    Tensor RowMax() const;
+
+    /// Minimum of each row, see RowSum().
+    Tensor RowMin() const;
+
+    /// Copies the ragged tensor to \p device. If \p copy is false and the
+    /// ragged tensor already is on \p device, the tensors are shared.
+    RaggedTensor To(const Device& device, bool copy = false) const;
+
+    /// Returns a copy of the ragged tensor on the same device.
+    RaggedTensor Clone() const { return To(GetDevice(), /*copy=*/true); }
+
+    std::string ToString() const;
+
+private:
+    Tensor values_;
+    Tensor row_splits_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -51,6 +51,14 @@ public:
         scalar_type_ = ScalarType::Double;
         value_.d = static_cast<double>(v);
     }
+    Scalar(float16_t v) {
+        scalar_type_ = ScalarType::Double;
+        value_.d = static_cast<double>(static_cast<float>(v));
+    }
+    Scalar(bfloat16_t v) {
+        scalar_type_ = ScalarType::Double;
+        value_.d = static_cast<double>(static_cast<float>(v));
+    }
     Scalar(int8_t v) {
         scalar_type_ = ScalarType::Int64;
         value_.i = static_cast<int64_t>(v);
@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ScratchScope.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+constexpr size_t ScratchScope::kDefaultChunkByteSize;
+constexpr size_t ScratchScope::kAlignment;
+
+namespace {
+
+/// Contiguous block of device memory that is handed out by bumping offset_.
+struct ScratchChunk {
+    ScratchChunk(size_t byte_size, const Device& device)
+        : ptr_(MemoryManager::Malloc(byte_size + ScratchScope::kAlignment,
+                                     device)),
+          byte_size_(byte_size),
+          device_(device) {
+        // Host allocators only guarantee the alignment of fundamental types.
+        const uintptr_t address = reinterpret_cast<uintptr_t>(ptr_);
+        base_ = static_cast<char*>(ptr_) +
+                (ScratchScope::kAlignment -
+                 address % ScratchScope::kAlignment) %
+                        ScratchScope::kAlignment;
+    }
+
+    ~ScratchChunk() { MemoryManager::Free(ptr_, device_); }
+
+    ScratchChunk(const ScratchChunk&) = delete;
+    ScratchChunk& operator=(const ScratchChunk&) = delete;
+
+    void* ptr_ = nullptr;
+    char* base_ = nullptr;
+    size_t byte_size_ = 0;
+    size_t offset_ = 0;
+    Device device_;
+};
+
+/// Chunks used by a single open ScratchScope.
+struct ScratchFrame {
+    size_t chunk_byte_size_;
+    std::vector<std::shared_ptr<ScratchChunk>> chunks_;
+};
+
+struct ScratchArena {
+    /// Open scopes of the thread, the innermost scope is the last one.
+    std::vector<ScratchFrame> frames_;
+    /// Chunks of closed scopes that are ready for reuse.
+    std::vector<std::shared_ptr<ScratchChunk>> pool_;
+};
+
+std::unordered_map<Device, ScratchArena>& GetArenas() {
+    // Arenas are per thread, hence no locking is required.
+    static thread_local std::unordered_map<Device, ScratchArena> arenas;
+    return arenas;
+}
+
+std::shared_ptr<ScratchChunk> AcquireChunk(ScratchArena& arena,
+                                           size_t byte_size,
+                                           const Device& device) {
+    for (auto it = arena.pool_.begin(); it != arena.pool_.end(); ++it) {
+        if ((*it)->byte_size_ >= byte_size) {
+            std::shared_ptr<ScratchChunk> chunk = *it;
+            arena.pool_.erase(it);
+            return chunk;
+        }
+    }
+    return std::make_shared<ScratchChunk>(byte_size, device);
+}
+
+}  // namespace
+
+ScratchScope::ScratchScope(const Device& device, size_t chunk_byte_size)
+    : device_(device) {
+    if (chunk_byte_size == 0) {
+        utility::LogError("chunk_byte_size must be positive.");
+    }
+    GetArenas()[device_].frames_.push_back(ScratchFrame{chunk_byte_size, {}});
+}
+
+ScratchScope::~ScratchScope() {
+    ScratchArena& arena = GetArenas()[device_];
+    for (auto& chunk : arena.frames_.back().chunks_) {
+        // Chunks referenced by escaped tensors are left to those tensors.
+        if (chunk.use_count() == 1) {
+            chunk->offset_ = 0;
+            arena.pool_.push_back(std::move(chunk));
+        }
+    }
+    arena.frames_.pop_back();
+}
+
+bool ScratchScope::IsActive(const Device& device) {
+    auto& arenas = GetArenas();
+    auto it = arenas.find(device);
+    return it != arenas.end() && !it->second.frames_.empty();
+}
+
+Tensor ScratchScope::Empty(const SizeVector& shape,
+                           Dtype dtype,
+                           const Device& device) {
+    const size_t byte_size = shape.NumElements() * dtype.ByteSize();
+    if (byte_size == 0 || !IsActive(device)) {
+        return Tensor::Empty(shape, dtype, device);
+    }
+
+    ScratchArena& arena = GetArenas()[device];
+    ScratchFrame& frame = arena.frames_.back();
+    const size_t aligned_byte_size =
+            (byte_size + kAlignment - 1) / kAlignment * kAlignment;
+
+    if (frame.chunks_.empty() ||
+        frame.chunks_.back()->offset_ + aligned_byte_size >
+                frame.chunks_.back()->byte_size_) {
+        frame.chunks_.push_back(AcquireChunk(
+                arena, std::max(frame.chunk_byte_size_, aligned_byte_size),
+                device));
+    }
+
+    std::shared_ptr<ScratchChunk> chunk = frame.chunks_.back();
+    void* ptr = chunk->base_ + chunk->offset_;
+    chunk->offset_ += aligned_byte_size;
+
+    // The blob keeps the chunk alive, but never frees memory itself.
+    auto blob = std::make_shared<Blob>(device, ptr, [chunk](void*) {});
+    return Tensor(shape, shape_util::DefaultStrides(shape), ptr, dtype, blob);
+}
+
+Tensor ScratchScope::Zeros(const SizeVector& shape,
+                           Dtype dtype,
+                           const Device& device) {
+    Tensor tensor = Empty(shape, dtype, device);
+    tensor.Fill(0);
+    return tensor;
+}
+
+void ScratchScope::ReleasePool() {
+    for (auto& arena_pair : GetArenas()) {
+        arena_pair.second.pool_.clear();
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// \class ScratchScope
+///
+/// Per-thread arena for short-lived scratch tensors, e.g. reduction buffers
+/// that kernels allocate on every call.
+///
+/// While a ScratchScope for a device is alive, ScratchScope::Empty() and
+/// ScratchScope::Zeros() draw tensors of the calling thread from large arena
+/// chunks by bumping an offset instead of going through the MemoryManager.
+/// When the scope ends, all chunks are recycled in O(1) per chunk and are
+/// reused by the next scope of the same thread, so that iterative pipelines
+/// (e.g. per-frame odometry) do not allocate any scratch memory after the
+/// first iteration. Without an active scope, both functions fall back to
+/// Tensor::Empty() and Tensor::Zeros().
+///
+/// Scratch tensors that outlive their scope stay valid: the chunks they point
+/// into are kept alive by the tensors and are not recycled.
+///
+/// Example:
+/// ```cpp
+/// for (int iter = 0; iter < max_iter; ++iter) {
+///     core::ScratchScope scratch_scope(device);
+///     // Served from the arena from the second iteration on.
+///     core::Tensor buffer = core::ScratchScope::Zeros({29}, dtype, device);
+///     ...
+/// }
+/// ```
+class ScratchScope {
+public:
+    /// Opens a scratch scope for \p device on the calling thread. Chunks
+    /// allocated by the scope have at least \p chunk_byte_size bytes.
+    explicit ScratchScope(const Device& device,
+                          size_t chunk_byte_size = kDefaultChunkByteSize);
+
+    /// Recycles all chunks that are not referenced by escaped tensors.
+    ~ScratchScope();
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    /// Returns true if a scratch scope for \p device is open on the calling
+    /// thread.
+    static bool IsActive(const Device& device);
+
+    /// Creates an uninitialized tensor from the innermost scratch scope of
+    /// \p device, or a regular tensor if no scope is active.
+    static Tensor Empty(const SizeVector& shape,
+                        Dtype dtype,
+                        const Device& device);
+
+    /// Same as Empty(), but fills the tensor with zeros.
+    static Tensor Zeros(const SizeVector& shape,
+                        Dtype dtype,
+                        const Device& device);
+
+    /// Frees the recycled chunks of the calling thread for all devices.
+    /// Chunks of open scopes are not affected.
+    static void ReleasePool();
+
+    /// Default minimal size of an arena chunk.
+    static constexpr size_t kDefaultChunkByteSize = 4 << 20;
+
+    /// Alignment of scratch tensors in bytes.
+    static constexpr size_t kAlignment = 256;
+
+private:
+    Device device_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,267 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Stream.h"
+
+#include <chrono>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+struct Stream::Impl {
+    Impl(const Device& device, bool create_new) : device_(device) {
+        if (device_.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            CUDAScopedDevice scoped_device(device_);
+            if (create_new) {
+                OPEN3D_CUDA_CHECK(cudaStreamCreate(&stream_));
+                owns_stream_ = true;
+            }
+#else
+            utility::LogError(
+                    "Not compiled with CUDA, but CUDA device is used.");
+#endif
+        } else if (device_.GetType() != Device::DeviceType::CPU) {
+            utility::LogError("Unimplemented device {}.", device_.ToString());
+        }
+    }
+
+    ~Impl() {
+#ifdef BUILD_CUDA_MODULE
+        if (owns_stream_) {
+            CUDAScopedDevice scoped_device(device_);
+            OPEN3D_CUDA_CHECK(cudaStreamDestroy(stream_));
+        }
+#endif
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    Device device_;
+#ifdef BUILD_CUDA_MODULE
+    cudaStream_t stream_ = cuda::GetDefaultStream();
+#endif
+    bool owns_stream_ = false;
+};
+
+Stream::Stream(const Device& device)
+    : impl_(std::make_shared<Impl>(device, /*create_new=*/true)) {}
+
+Stream::Stream(const std::shared_ptr<Impl>& impl) : impl_(impl) {}
+
+Stream Stream::Default(const Device& device) {
+    return Stream(std::make_shared<Impl>(device, /*create_new=*/false));
+}
+
+Stream Stream::Current(const Device& device) {
+    auto impl = std::make_shared<Impl>(device, /*create_new=*/false);
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        impl->stream_ = cuda::GetStream();
+    }
+#endif
+    return Stream(impl);
+}
+
+Device Stream::GetDevice() const { return impl_->device_; }
+
+bool Stream::IsDefault() const {
+#ifdef BUILD_CUDA_MODULE
+    return impl_->stream_ == cuda::GetDefaultStream();
+#else
+    return true;
+#endif
+}
+
+void Stream::Synchronize() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->device_.GetType() == Device::DeviceType::CUDA) {
+        CUDAScopedDevice scoped_device(impl_->device_);
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(impl_->stream_));
+    }
+#endif
+}
+
+bool Stream::Query() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->device_.GetType() == Device::DeviceType::CUDA) {
+        CUDAScopedDevice scoped_device(impl_->device_);
+        cudaError_t err = cudaStreamQuery(impl_->stream_);
+        if (err == cudaErrorNotReady) {
+            return false;
+        }
+        OPEN3D_CUDA_CHECK(err);
+    }
+#endif
+    return true;
+}
+
+void Stream::WaitEvent(const Event& event) const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->device_.GetType() == Device::DeviceType::CUDA) {
+        if (event.GetDevice().GetType() == Device::DeviceType::CUDA) {
+            CUDAScopedDevice scoped_device(impl_->device_);
+            OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(impl_->stream_,
+                                                  event.GetCUDAEvent(), 0));
+        }
+        // CPU events complete as soon as they are recorded.
+        return;
+    }
+#endif
+    // CPU work is synchronous, hence the host has to wait for the event.
+    event.Synchronize();
+}
+
+#ifdef BUILD_CUDA_MODULE
+cudaStream_t Stream::GetCUDAStream() const { return impl_->stream_; }
+#endif
+
+struct Event::Impl {
+    explicit Impl(const Device& device) : device_(device) {
+        if (device_.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            CUDAScopedDevice scoped_device(device_);
+            OPEN3D_CUDA_CHECK(cudaEventCreate(&event_));
+#else
+            utility::LogError(
+                    "Not compiled with CUDA, but CUDA device is used.");
+#endif
+        } else if (device_.GetType() != Device::DeviceType::CPU) {
+            utility::LogError("Unimplemented device {}.", device_.ToString());
+        }
+    }
+
+    ~Impl() {
+#ifdef BUILD_CUDA_MODULE
+        if (device_.GetType() == Device::DeviceType::CUDA) {
+            CUDAScopedDevice scoped_device(device_);
+            OPEN3D_CUDA_CHECK(cudaEventDestroy(event_));
+        }
+#endif
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    Device device_;
+    bool recorded_ = false;
+    std::chrono::steady_clock::time_point host_time_;
+#ifdef BUILD_CUDA_MODULE
+    cudaEvent_t event_;
+#endif
+};
+
+Event::Event(const Device& device) : impl_(std::make_shared<Impl>(device)) {}
+
+Device Event::GetDevice() const { return impl_->device_; }
+
+void Event::Record(const Stream& stream) {
+    if (stream.GetDevice() != impl_->device_) {
+        utility::LogError("Event on {} cannot be recorded on a stream of {}.",
+                          impl_->device_.ToString(),
+                          stream.GetDevice().ToString());
+    }
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->device_.GetType() == Device::DeviceType::CUDA) {
+        CUDAScopedDevice scoped_device(impl_->device_);
+        OPEN3D_CUDA_CHECK(
+                cudaEventRecord(impl_->event_, stream.GetCUDAStream()));
+    }
+#endif
+    impl_->host_time_ = std::chrono::steady_clock::now();
+    impl_->recorded_ = true;
+}
+
+void Event::Record() { Record(Stream::Current(impl_->device_)); }
+
+void Event::Synchronize() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->device_.GetType() == Device::DeviceType::CUDA &&
+        impl_->recorded_) {
+        CUDAScopedDevice scoped_device(impl_->device_);
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(impl_->event_));
+    }
+#endif
+}
+
+bool Event::Query() const {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->device_.GetType() == Device::DeviceType::CUDA &&
+        impl_->recorded_) {
+        CUDAScopedDevice scoped_device(impl_->device_);
+        cudaError_t err = cudaEventQuery(impl_->event_);
+        if (err == cudaErrorNotReady) {
+            return false;
+        }
+        OPEN3D_CUDA_CHECK(err);
+    }
+#endif
+    return true;
+}
+
+float Event::ElapsedTime(const Event& end) const {
+    if (end.GetDevice() != impl_->device_) {
+        utility::LogError(
+                "Events must be on the same device, but got {} and {}.",
+                impl_->device_.ToString(), end.GetDevice().ToString());
+    }
+    if (!impl_->recorded_ || !end.impl_->recorded_) {
+        utility::LogError("Both events must be recorded.");
+    }
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->device_.GetType() == Device::DeviceType::CUDA) {
+        CUDAScopedDevice scoped_device(impl_->device_);
+        float ms;
+        OPEN3D_CUDA_CHECK(
+                cudaEventElapsedTime(&ms, impl_->event_, end.impl_->event_));
+        return ms;
+    }
+#endif
+    return std::chrono::duration<float, std::milli>(end.impl_->host_time_ -
+                                                    impl_->host_time_)
+            .count();
+}
+
+#ifdef BUILD_CUDA_MODULE
+cudaEvent_t Event::GetCUDAEvent() const { return impl_->event_; }
+#endif
+
+ScopedStream::ScopedStream(const Stream& stream) : stream_(stream) {
+#ifdef BUILD_CUDA_MODULE
+    if (stream_.GetDevice().GetType() == Device::DeviceType::CUDA) {
+        cuda_scoped_stream_ =
+                std::make_unique<CUDAScopedStream>(stream_.GetCUDAStream());
+    }
+#endif
+}
+
+ScopedStream::~ScopedStream() {}
+
+}  // namespace core
+}  // namespace open3d
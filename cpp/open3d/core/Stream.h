@@ -0,0 +1,172 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+class Event;
+
+/// \class Stream
+///
+/// Device-agnostic handle to an ordered queue of asynchronous work.
+///
+/// On CUDA devices, a Stream owns (or refers to) a cudaStream_t. Work is
+/// enqueued on a stream by making it the current stream with ScopedStream:
+/// all Tensor ops, MemoryManager copies and kernels (core and t::geometry)
+/// launched by the calling thread then run on that stream, so that e.g. the
+/// upload of the next frame can overlap with the integration of the current
+/// one.
+///
+/// On CPU devices, a Stream is a no-op: work executes synchronously and
+/// Synchronize() returns immediately.
+///
+/// Stream is a cheap, copyable handle. The underlying CUDA stream is
+/// destroyed when the last handle owning it goes out of scope.
+class Stream {
+public:
+    /// Creates a new non-default stream on \p device.
+    explicit Stream(const Device& device);
+
+    /// Returns the default stream of \p device.
+    static Stream Default(const Device& device);
+
+    /// Returns the stream currently used by the calling thread for \p device.
+    static Stream Current(const Device& device);
+
+    /// Returns the device of the stream.
+    Device GetDevice() const;
+
+    /// Returns true if this is the default stream of its device.
+    bool IsDefault() const;
+
+    /// Blocks the calling host thread until all work enqueued on the stream
+    /// has completed.
+    void Synchronize() const;
+
+    /// Returns true if all work enqueued on the stream has completed.
+    bool Query() const;
+
+    /// Makes all future work enqueued on this stream wait until \p event has
+    /// completed. This does not block the calling host thread.
+    void WaitEvent(const Event& event) const;
+
+#ifdef BUILD_CUDA_MODULE
+    /// Returns the underlying CUDA stream.
+    cudaStream_t GetCUDAStream() const;
+#endif
+
+private:
+    struct Impl;
+    explicit Stream(const std::shared_ptr<Impl>& impl);
+
+    std::shared_ptr<Impl> impl_;
+};
+
+/// \class Event
+///
+/// Synchronization marker recorded on a Stream. Events are used to express
+/// dependencies between streams (Stream::WaitEvent) and to time device work.
+///
+/// On CPU devices, an Event records the host time at which Record() is called.
+class Event {
+public:
+    /// Creates an event on \p device.
+    explicit Event(const Device& device);
+
+    /// Returns the device of the event.
+    Device GetDevice() const;
+
+    /// Records the event on \p stream. The event completes once all work
+    /// enqueued on \p stream before this call has completed.
+    void Record(const Stream& stream);
+
+    /// Records the event on the current stream of the event's device.
+    void Record();
+
+    /// Blocks the calling host thread until the event has completed.
+    void Synchronize() const;
+
+    /// Returns true if the event has completed.
+    bool Query() const;
+
+    /// Returns the elapsed time in milliseconds between this event and
+    /// \p end. Both events must have been recorded and must be on the same
+    /// device.
+    float ElapsedTime(const Event& end) const;
+
+#ifdef BUILD_CUDA_MODULE
+    /// Returns the underlying CUDA event.
+    cudaEvent_t GetCUDAEvent() const;
+#endif
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> impl_;
+};
+
+/// \class ScopedStream
+///
+/// Switch the current stream of the calling thread in the current scope. The
+/// previous stream will be restored once leaving the scope. For CPU streams,
+/// this has no effect.
+///
+/// Example:
+/// ```cpp
+/// core::Stream upload_stream(device);
+/// {
+///     core::ScopedStream scoped_stream(upload_stream);
+///     // Enqueued on upload_stream, overlapping with other streams.
+///     next_depth = next_depth_host.To(device);
+/// }
+/// core::Event uploaded(device);
+/// uploaded.Record(upload_stream);
+/// core::Stream::Current(device).WaitEvent(uploaded);
+/// ```
+class ScopedStream {
+public:
+    explicit ScopedStream(const Stream& stream);
+
+    ~ScopedStream();
+
+    ScopedStream(const ScopedStream&) = delete;
+    ScopedStream& operator=(const ScopedStream&) = delete;
+
+private:
+    Stream stream_;
+#ifdef BUILD_CUDA_MODULE
+    std::unique_ptr<CUDAScopedStream> cuda_scoped_stream_;
+#endif
+};
+
+}  // namespace core
+}  // namespace open3d
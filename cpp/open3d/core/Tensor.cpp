@@ -57,6 +57,7 @@ namespace open3d {
 namespace core {
 
 static DLDataTypeCode DtypeToDLDataTypeCode(const Dtype& dtype) {
+    if (dtype == core::Float16) return DLDataTypeCode::kDLFloat;
     if (dtype == core::Float32) return DLDataTypeCode::kDLFloat;
     if (dtype == core::Float64) return DLDataTypeCode::kDLFloat;
     if (dtype == core::Int8) return DLDataTypeCode::kDLInt;
@@ -109,6 +110,8 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (dltype.bits) {
+                case 16:
+                    return core::Float16;
                 case 32:
                     return core::Float32;
                 case 64:
@@ -377,6 +380,23 @@ Tensor Tensor::Empty(const SizeVector& shape,
     return Tensor(shape, dtype, device);
 }
 
+Tensor Tensor::EmptyPinned(const SizeVector& shape, Dtype dtype, bool mapped) {
+#ifdef BUILD_CUDA_MODULE
+    if (cuda::IsAvailable()) {
+        const Device host("CPU:0");
+        auto pinned_mm = std::make_shared<PinnedMemoryManager>(mapped);
+        void* ptr = pinned_mm->Malloc(shape.NumElements() * dtype.ByteSize(),
+                                      host);
+        auto blob = std::make_shared<Blob>(
+                host, ptr,
+                [pinned_mm, ptr, host](void*) { pinned_mm->Free(ptr, host); });
+        return Tensor(shape, shape_util::DefaultStrides(shape), ptr, dtype,
+                      blob);
+    }
+#endif
+    return Tensor(shape, dtype, Device("CPU:0"));
+}
+
 Tensor Tensor::Zeros(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
@@ -715,6 +735,49 @@ Tensor Tensor::Contiguous() const {
     }
 }
 
+Tensor Tensor::Pin(bool mapped) const {
+    Tensor dst_tensor = EmptyPinned(shape_, dtype_, mapped);
+    kernel::Copy(*this, dst_tensor);
+    return dst_tensor;
+}
+
+bool Tensor::IsPinned() const {
+#ifdef BUILD_CUDA_MODULE
+    if (GetDevice().GetType() == Device::DeviceType::CPU && blob_ != nullptr &&
+        cuda::IsAvailable()) {
+        return PinnedMemoryManager::IsPinnedPointer(blob_->GetDataPtr());
+    }
+#endif
+    return false;
+}
+
+Tensor Tensor::AsMappedDeviceTensor(const Device& device) const {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("Expected a CUDA device, but got {}.",
+                          device.ToString());
+    }
+    if (!IsPinned()) {
+        utility::LogError(
+                "Tensor is not in pinned host memory. Use EmptyPinned() or "
+                "Pin() with mapped = true.");
+    }
+#ifdef BUILD_CUDA_MODULE
+    char* host_base = static_cast<char*>(blob_->GetDataPtr());
+    char* device_base = static_cast<char*>(
+            PinnedMemoryManager::GetMappedDevicePointer(host_base, device));
+    void* device_data_ptr =
+            device_base + (static_cast<char*>(data_ptr_) - host_base);
+    // The device view aliases the host memory, hence it only needs to keep
+    // the host blob alive.
+    std::shared_ptr<Blob> host_blob = blob_;
+    auto blob = std::make_shared<Blob>(device, device_base,
+                                       [host_blob](void*) {});
+    return Tensor(shape_, strides_, device_data_ptr, dtype_, blob);
+#else
+    utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+}
+
 std::string Tensor::ToString(bool with_suffix,
                              const std::string& indent) const {
     std::ostringstream rc;
@@ -766,6 +829,11 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
         str = *static_cast<const unsigned char*>(ptr) ? "True" : "False";
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
+    } else if (dtype_ == core::Float16 || dtype_ == core::BFloat16) {
+        DISPATCH_HALF_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+            const float value = *static_cast<const scalar_t*>(ptr);
+            str = fmt::format("{}", value);
+        });
     } else {
         DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
@@ -912,9 +980,9 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                     src_tensor.NumElements());
         }
         if (index_tensors[0].IsNonZero()) {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_tensor.GetDtype(), [&]() {
-                AsRvalue() = src_tensor.Item<scalar_t>();
-            });
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(
+                    src_tensor.GetDtype(),
+                    [&]() { AsRvalue() = src_tensor.Item<scalar_t>(); });
         }
         return;
     }
@@ -926,6 +994,39 @@ void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                      aip.GetIndexedShape(), aip.GetIndexedStrides());
 }
 
+Tensor Tensor::IndexAdd_(int64_t dim,
+                         const Tensor& index,
+                         const Tensor& src,
+                         bool deterministic) {
+    kernel::IndexReduction(dim, index, src, *this,
+                           kernel::IndexReductionOpCode::Sum, true,
+                           deterministic);
+    return *this;
+}
+
+Tensor Tensor::IndexReduce_(int64_t dim,
+                            const Tensor& index,
+                            const Tensor& src,
+                            const std::string& reduce,
+                            bool include_self,
+                            bool deterministic) {
+    kernel::IndexReductionOpCode op_code = kernel::IndexReductionOpCode::Sum;
+    if (reduce == "mean") {
+        op_code = kernel::IndexReductionOpCode::Mean;
+    } else if (reduce == "max") {
+        op_code = kernel::IndexReductionOpCode::Max;
+    } else if (reduce == "min") {
+        op_code = kernel::IndexReductionOpCode::Min;
+    } else if (reduce != "sum") {
+        utility::LogError(
+                "Unsupported reduce \"{}\", expected sum, mean, max or min.",
+                reduce);
+    }
+    kernel::IndexReduction(dim, index, src, *this, op_code, include_self,
+                           deterministic);
+    return *this;
+}
+
 Tensor Tensor::Permute(const SizeVector& dims) const {
     // Check dimension size
     if (static_cast<int64_t>(dims.size()) != NumDims()) {
@@ -1007,7 +1108,7 @@ Tensor Tensor::Add(const Tensor& value) const {
 
 Tensor Tensor::Add(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Add(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1023,7 +1124,7 @@ Tensor Tensor::Add_(const Tensor& value) {
 }
 
 Tensor Tensor::Add_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Add_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1041,7 +1142,7 @@ Tensor Tensor::Sub(const Tensor& value) const {
 
 Tensor Tensor::Sub(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Sub(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1057,7 +1158,7 @@ Tensor Tensor::Sub_(const Tensor& value) {
 }
 
 Tensor Tensor::Sub_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Sub_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1075,7 +1176,7 @@ Tensor Tensor::Mul(const Tensor& value) const {
 
 Tensor Tensor::Mul(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Mul(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1091,7 +1192,7 @@ Tensor Tensor::Mul_(const Tensor& value) {
 }
 
 Tensor Tensor::Mul_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Mul_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1109,7 +1210,7 @@ Tensor Tensor::Div(const Tensor& value) const {
 
 Tensor Tensor::Div(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Div(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1125,7 +1226,7 @@ Tensor Tensor::Div_(const Tensor& value) {
 }
 
 Tensor Tensor::Div_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Div_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1187,6 +1288,62 @@ Tensor Tensor::ArgMax(const SizeVector& dims) const {
     return dst;
 }
 
+Tensor Tensor::SegmentSum(const Tensor& splits) const {
+    return kernel::SegmentReduction(*this, splits,
+                                    kernel::SegmentReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& splits) const {
+    return kernel::SegmentReduction(*this, splits,
+                                    kernel::SegmentReductionOpCode::Mean);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& splits) const {
+    return kernel::SegmentReduction(*this, splits,
+                                    kernel::SegmentReductionOpCode::Max);
+}
+
+Tensor Tensor::SegmentMin(const Tensor& splits) const {
+    return kernel::SegmentReduction(*this, splits,
+                                    kernel::SegmentReductionOpCode::Min);
+}
+
+Tensor Tensor::Sort() const { return IndexGet({Argsort()}); }
+
+Tensor Tensor::Argsort() const { return kernel::Argsort(*this); }
+
+Tensor Tensor::Unique() const {
+    return std::get<0>(UniqueWithInverseAndCounts());
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::UniqueWithInverseAndCounts() const {
+    const Tensor perm = Argsort();
+    const Tensor sorted = IndexGet({perm});
+    Tensor group_ids;
+    Tensor splits;
+    kernel::SortedGroups(sorted, group_ids, splits);
+
+    const int64_t num_unique = splits.GetLength() - 1;
+    Tensor unique = sorted.IndexGet({splits.Slice(0, 0, num_unique)});
+    Tensor inverse = Tensor::Empty({NumElements()}, core::Int64, GetDevice());
+    inverse.IndexSet({perm}, group_ids);
+    Tensor counts = splits.Slice(0, 1, num_unique + 1) -
+                    splits.Slice(0, 0, num_unique);
+    return std::make_tuple(unique, inverse, counts);
+}
+
+std::tuple<Tensor, Tensor> Tensor::SortByKey(const Tensor& keys,
+                                             const Tensor& values) {
+    AssertTensorDevice(values, keys.GetDevice());
+    if (values.NumDims() == 0 || values.GetLength() != keys.GetLength()) {
+        utility::LogError(
+                "SortByKey: values of shape {} do not match keys of shape {}.",
+                values.GetShape(), keys.GetShape());
+    }
+    const Tensor perm = keys.Argsort();
+    return std::make_tuple(keys.IndexGet({perm}), values.IndexGet({perm}));
+}
+
 Tensor Tensor::Sqrt() const {
     Tensor dst_tensor(shape_, dtype_, GetDevice());
     kernel::UnaryEW(*this, dst_tensor, kernel::UnaryEWOpCode::Sqrt);
@@ -1290,7 +1447,7 @@ Tensor Tensor::Clip(Scalar min_val, Scalar max_val) const {
 
 // TODO: Implement with kernel.
 Tensor Tensor::Clip_(Scalar min_val, Scalar max_val) {
-    DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype_, [&]() {
         scalar_t min_val_casted = min_val.To<scalar_t>();
         this->SetItem(TensorKey::IndexTensor(this->Lt(min_val_casted)),
                       Full({}, min_val_casted, dtype_, GetDevice()));
@@ -1356,7 +1513,7 @@ Tensor Tensor::LogicalAnd(const Tensor& value) const {
 
 Tensor Tensor::LogicalAnd(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalAnd(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1371,7 +1528,7 @@ Tensor Tensor::LogicalAnd_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalAnd_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalAnd_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1390,7 +1547,7 @@ Tensor Tensor::LogicalOr(const Tensor& value) const {
 
 Tensor Tensor::LogicalOr(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalOr(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1405,7 +1562,7 @@ Tensor Tensor::LogicalOr_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalOr_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalOr_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1423,7 +1580,7 @@ Tensor Tensor::LogicalXor(const Tensor& value) const {
 
 Tensor Tensor::LogicalXor(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalXor(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1438,7 +1595,7 @@ Tensor Tensor::LogicalXor_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalXor_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalXor_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1456,7 +1613,7 @@ Tensor Tensor::Gt(const Tensor& value) const {
 
 Tensor Tensor::Gt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Gt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1471,7 +1628,7 @@ Tensor Tensor::Gt_(const Tensor& value) {
 }
 
 Tensor Tensor::Gt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Gt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1488,7 +1645,7 @@ Tensor Tensor::Lt(const Tensor& value) const {
 
 Tensor Tensor::Lt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Lt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1503,7 +1660,7 @@ Tensor Tensor::Lt_(const Tensor& value) {
 }
 
 Tensor Tensor::Lt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Lt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1520,7 +1677,7 @@ Tensor Tensor::Ge(const Tensor& value) const {
 
 Tensor Tensor::Ge(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ge(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1535,7 +1692,7 @@ Tensor Tensor::Ge_(const Tensor& value) {
 }
 
 Tensor Tensor::Ge_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ge_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1552,7 +1709,7 @@ Tensor Tensor::Le(const Tensor& value) const {
 
 Tensor Tensor::Le(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Le(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1567,7 +1724,7 @@ Tensor Tensor::Le_(const Tensor& value) {
 }
 
 Tensor Tensor::Le_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Le_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1584,7 +1741,7 @@ Tensor Tensor::Eq(const Tensor& value) const {
 
 Tensor Tensor::Eq(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Eq(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1599,7 +1756,7 @@ Tensor Tensor::Eq_(const Tensor& value) {
 }
 
 Tensor Tensor::Eq_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Eq_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1616,7 +1773,7 @@ Tensor Tensor::Ne(const Tensor& value) const {
 
 Tensor Tensor::Ne(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ne(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1631,7 +1788,7 @@ Tensor Tensor::Ne_(const Tensor& value) {
 }
 
 Tensor Tensor::Ne_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ne_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1655,7 +1812,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
@@ -1679,6 +1836,11 @@ DLManagedTensor* Tensor::ToDLPack() const {
     return Open3DDLManagedTensor::Create(*this);
 }
 
+DLManagedTensor* Tensor::ToDLPack(int64_t consumer_stream) const {
+    cuda::SynchronizeDLPackStream(GetDevice(), consumer_stream);
+    return ToDLPack();
+}
+
 Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
     Device device;
     switch (src->dl_tensor.ctx.device_type) {
@@ -1727,8 +1889,8 @@ void Tensor::Save(const std::string& file_name) const {
     t::io::WriteNpy(file_name, *this);
 }
 
-Tensor Tensor::Load(const std::string& file_name) {
-    return t::io::ReadNpy(file_name);
+Tensor Tensor::Load(const std::string& file_name, bool use_mmap) {
+    return t::io::ReadNpy(file_name, use_mmap);
 }
 
 bool Tensor::AllEqual(const Tensor& other) const {
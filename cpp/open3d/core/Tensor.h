@@ -185,6 +185,16 @@ public:
                         Dtype dtype,
                         const Device& device = Device("CPU:0"));
 
+    /// Create a tensor with uninitialized values in page-locked (pinned) host
+    /// memory. Copies between pinned tensors and CUDA devices avoid the
+    /// pageable staging buffer and can overlap with kernels when issued on a
+    /// Stream. If \p mapped is true, the memory is also mapped into the
+    /// address space of CUDA devices, see AsMappedDeviceTensor(). If Open3D is
+    /// not compiled with CUDA, regular host memory is allocated.
+    static Tensor EmptyPinned(const SizeVector& shape,
+                              Dtype dtype,
+                              bool mapped = false);
+
     /// Create a tensor with uninitialized values with the same Dtype and Device
     /// as the other tensor.
     static Tensor EmptyLike(const Tensor& other) {
@@ -497,6 +507,40 @@ public:
     void IndexSet(const std::vector<Tensor>& index_tensors,
                   const Tensor& src_tensor);
 
+    /// \brief Accumulates slices of \p src into this tensor along \p dim.
+    ///
+    /// For a 2-D tensor and dim = 0, this computes
+    /// (*this)[index[i], :] += src[i, :] for every i. Repeated indices all
+    /// accumulate into the same slice.
+    ///
+    /// \param dim The dimension to index along.
+    /// \param index Int64 1-D tensor with values in [0, GetShape(dim)).
+    /// \param src Tensor with the dtype of this tensor and the same shape,
+    /// except that its size along \p dim equals the length of \p index.
+    /// \param deterministic By default repeated indices are accumulated with
+    /// atomics, so floating point sums may differ in the last bits between
+    /// runs. If true, the repeated indices are sorted and summed in a fixed
+    /// order, which is reproducible but slower.
+    Tensor IndexAdd_(int64_t dim,
+                     const Tensor& index,
+                     const Tensor& src,
+                     bool deterministic = false);
+
+    /// \brief Reduces slices of \p src into this tensor along \p dim, see
+    /// IndexAdd_().
+    ///
+    /// \param reduce One of "sum", "mean", "max" or "min". "mean" divides by
+    /// the number of values reduced into each slice.
+    /// \param include_self If false, the values at indexed positions are
+    /// replaced by the reduction of \p src alone. Positions that are not
+    /// indexed keep their values either way.
+    Tensor IndexReduce_(int64_t dim,
+                        const Tensor& index,
+                        const Tensor& src,
+                        const std::string& reduce,
+                        bool include_self = true,
+                        bool deterministic = false);
+
     /// \brief Permute (dimension shuffle) the Tensor, returns a view.
     ///
     /// \param dims The desired ordering of dimensions.
@@ -635,6 +679,46 @@ public:
     /// is into the flattend tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Sums consecutive segments of the tensor along its first dimension.
+    /// \p splits is an Int64 1-D tensor of shape {num_segments + 1} that starts
+    /// with 0 and ends with GetLength(); segment i spans rows
+    /// [splits[i], splits[i + 1]). Returns a tensor of shape
+    /// {num_segments, ...}. Empty segments sum to 0.
+    Tensor SegmentSum(const Tensor& splits) const;
+
+    /// Averages consecutive segments along the first dimension, see
+    /// SegmentSum(). Empty segments are 0.
+    Tensor SegmentMean(const Tensor& splits) const;
+
+    /// Maximum of consecutive segments along the first dimension, see
+    /// SegmentSum(). Empty segments are 0.
+    Tensor SegmentMax(const Tensor& splits) const;
+
+    /// Minimum of consecutive segments along the first dimension, see
+    /// SegmentSum(). Empty segments are 0.
+    Tensor SegmentMin(const Tensor& splits) const;
+
+    /// Returns the elements of a 1-D tensor sorted in ascending order. The
+    /// sort is a stable radix sort; floating point NaNs are ordered last.
+    Tensor Sort() const;
+
+    /// Returns the Int64 indices that stably sort a 1-D tensor in ascending
+    /// order, i.e. `t.IndexGet({t.Argsort()})` equals `t.Sort()`.
+    Tensor Argsort() const;
+
+    /// Returns the sorted unique elements of a 1-D tensor.
+    Tensor Unique() const;
+
+    /// Returns the sorted unique elements of a 1-D tensor, the Int64 inverse
+    /// indices such that `unique.IndexGet({inverse})` equals the tensor, and
+    /// the Int64 number of occurrences of each unique element.
+    std::tuple<Tensor, Tensor, Tensor> UniqueWithInverseAndCounts() const;
+
+    /// Stably sorts the 1-D tensor \p keys and reorders \p values along its
+    /// first dimension in the same way. Returns the sorted keys and values.
+    static std::tuple<Tensor, Tensor> SortByKey(const Tensor& keys,
+                                                const Tensor& values);
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
@@ -950,6 +1034,19 @@ public:
     /// used.
     Tensor Contiguous() const;
 
+    /// Returns a contiguous copy of the tensor in page-locked host memory, see
+    /// EmptyPinned().
+    Tensor Pin(bool mapped = false) const;
+
+    /// Returns true if the tensor resides in page-locked host memory.
+    bool IsPinned() const;
+
+    /// Returns a view of a host-mapped pinned tensor on the CUDA device
+    /// \p device. Kernels launched on the view read and write the host memory
+    /// directly over the bus without an explicit copy, which pays off for data
+    /// that is accessed only once. The view keeps the host memory alive.
+    Tensor AsMappedDeviceTensor(const Device& device) const;
+
     /// Computes matrix multiplication with *this and rhs and returns the
     /// result.
     Tensor Matmul(const Tensor& rhs) const;
@@ -1095,14 +1192,23 @@ public:
     /// Convert the Tensor to DLManagedTensor.
     DLManagedTensor* ToDLPack() const;
 
+    /// Convert the Tensor to DLManagedTensor for a consumer that uses it on
+    /// \p consumer_stream, following `__dlpack__(stream=...)`. For CUDA
+    /// tensors the consumer stream is made to wait for the work enqueued on
+    /// the current stream, so no device synchronization is needed. See
+    /// cuda::SynchronizeDLPackStream() for the stream encoding.
+    DLManagedTensor* ToDLPack(int64_t consumer_stream) const;
+
     /// Convert DLManagedTensor to Tensor.
     static Tensor FromDLPack(const DLManagedTensor* dlmt);
 
     /// Save tensor to numpy's npy format.
     void Save(const std::string& file_name) const;
 
-    /// Load tensor from numpy's npy format.
-    static Tensor Load(const std::string& file_name);
+    /// Load tensor from numpy's npy format. If \p use_mmap is true, the file
+    /// is memory-mapped copy-on-write instead of read, so only the accessed
+    /// pages are loaded and writes to the tensor do not change the file.
+    static Tensor Load(const std::string& file_name, bool use_mmap = false);
 
     /// Iterator for Tensor.
     struct Iterator {
@@ -1299,7 +1405,7 @@ inline bool Tensor::Item() const {
 
 template <typename S>
 inline void Tensor::Fill(S v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
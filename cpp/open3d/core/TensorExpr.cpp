@@ -0,0 +1,287 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+struct TensorExpr::Node {
+    kernel::FusedEWOpCode op_code_;
+    // Only used by FusedEWOpCode::Input.
+    Tensor tensor_;
+    // Only used by FusedEWOpCode::Scalar.
+    Scalar scalar_ = 0;
+    std::shared_ptr<const Node> lhs_;
+    std::shared_ptr<const Node> rhs_;
+    SizeVector shape_;
+    Dtype dtype_;
+    Device device_;
+};
+
+TensorExpr::TensorExpr(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->op_code_ = kernel::FusedEWOpCode::Input;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    node_ = node;
+}
+
+static std::shared_ptr<TensorExpr::Node> MakeUnaryNode(
+        kernel::FusedEWOpCode op_code,
+        const std::shared_ptr<const TensorExpr::Node>& src,
+        bool float_only) {
+    if (float_only && src->dtype_ != Float32 && src->dtype_ != Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          src->dtype_.ToString());
+    }
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = src;
+    node->shape_ = src->shape_;
+    node->dtype_ = src->dtype_;
+    node->device_ = src->device_;
+    return node;
+}
+
+static std::shared_ptr<TensorExpr::Node> MakeBinaryNode(
+        kernel::FusedEWOpCode op_code,
+        const std::shared_ptr<const TensorExpr::Node>& lhs,
+        const std::shared_ptr<const TensorExpr::Node>& rhs) {
+    if (lhs->device_ != rhs->device_) {
+        utility::LogError("Device mismatch {} != {}.",
+                          lhs->device_.ToString(), rhs->device_.ToString());
+    }
+    if (lhs->dtype_ != rhs->dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", lhs->dtype_.ToString(),
+                          rhs->dtype_.ToString());
+    }
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    node->shape_ = shape_util::BroadcastedShape(lhs->shape_, rhs->shape_);
+    node->dtype_ = lhs->dtype_;
+    node->device_ = lhs->device_;
+    return node;
+}
+
+static std::shared_ptr<TensorExpr::Node> MakeScalarNode(
+        Scalar value, const std::shared_ptr<const TensorExpr::Node>& like) {
+    if (like->dtype_ == Bool) {
+        utility::LogError("Fused expressions do not support Bool tensors.");
+    }
+    auto node = std::make_shared<TensorExpr::Node>();
+    node->op_code_ = kernel::FusedEWOpCode::Scalar;
+    node->scalar_ = value;
+    node->shape_ = SizeVector({});
+    node->dtype_ = like->dtype_;
+    node->device_ = like->device_;
+    return node;
+}
+
+/// Compiles the expression DAG rooted at \p node into \p program and returns
+/// the register that holds its value. Shared sub-expressions and repeated input
+/// tensors are only evaluated or read once.
+static int32_t CompileNode(
+        const std::shared_ptr<const TensorExpr::Node>& node,
+        std::vector<Tensor>& inputs,
+        kernel::FusedEWProgram& program,
+        std::unordered_map<const TensorExpr::Node*, int32_t>& node_to_reg) {
+    auto it = node_to_reg.find(node.get());
+    if (it != node_to_reg.end()) {
+        return it->second;
+    }
+
+    int32_t reg = -1;
+    if (node->op_code_ == kernel::FusedEWOpCode::Input) {
+        int32_t input_idx = -1;
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (inputs[i].IsSame(node->tensor_)) {
+                input_idx = static_cast<int32_t>(i);
+                break;
+            }
+        }
+        if (input_idx < 0) {
+            if (static_cast<int64_t>(inputs.size()) >= MAX_INPUTS) {
+                utility::LogError(
+                        "Fused expression cannot have more than {} input "
+                        "tensors.",
+                        MAX_INPUTS);
+            }
+            input_idx = static_cast<int32_t>(inputs.size());
+            inputs.push_back(node->tensor_);
+        }
+        reg = program.Append(kernel::FusedEWOpCode::Input, input_idx);
+    } else if (node->op_code_ == kernel::FusedEWOpCode::Scalar) {
+        reg = program.AppendScalar(node->scalar_);
+    } else if (node->rhs_ == nullptr) {
+        int32_t lhs = CompileNode(node->lhs_, inputs, program, node_to_reg);
+        reg = program.Append(node->op_code_, lhs);
+    } else {
+        int32_t lhs = CompileNode(node->lhs_, inputs, program, node_to_reg);
+        int32_t rhs = CompileNode(node->rhs_, inputs, program, node_to_reg);
+        reg = program.Append(node->op_code_, lhs, rhs);
+    }
+    node_to_reg[node.get()] = reg;
+    return reg;
+}
+
+static void Compile(const std::shared_ptr<const TensorExpr::Node>& node,
+                    std::vector<Tensor>& inputs,
+                    kernel::FusedEWProgram& program) {
+    if (node->dtype_ == Bool) {
+        utility::LogError("Fused expressions do not support Bool tensors.");
+    }
+    std::unordered_map<const TensorExpr::Node*, int32_t> node_to_reg;
+    int32_t reg = CompileNode(node, inputs, program, node_to_reg);
+    if (reg != program.NumInstructions() - 1) {
+        utility::LogError("Internal error: fused program result mismatch.");
+    }
+}
+
+TensorExpr TensorExpr::Add(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::FusedEWOpCode::Add, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Add(Scalar value) const {
+    return TensorExpr(MakeBinaryNode(kernel::FusedEWOpCode::Add, node_,
+                                     MakeScalarNode(value, node_)));
+}
+
+TensorExpr TensorExpr::Sub(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::FusedEWOpCode::Sub, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Sub(Scalar value) const {
+    return TensorExpr(MakeBinaryNode(kernel::FusedEWOpCode::Sub, node_,
+                                     MakeScalarNode(value, node_)));
+}
+
+TensorExpr TensorExpr::Mul(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::FusedEWOpCode::Mul, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Mul(Scalar value) const {
+    return TensorExpr(MakeBinaryNode(kernel::FusedEWOpCode::Mul, node_,
+                                     MakeScalarNode(value, node_)));
+}
+
+TensorExpr TensorExpr::Div(const TensorExpr& value) const {
+    return TensorExpr(
+            MakeBinaryNode(kernel::FusedEWOpCode::Div, node_, value.node_));
+}
+
+TensorExpr TensorExpr::Div(Scalar value) const {
+    return TensorExpr(MakeBinaryNode(kernel::FusedEWOpCode::Div, node_,
+                                     MakeScalarNode(value, node_)));
+}
+
+TensorExpr TensorExpr::Sqrt() const {
+    return TensorExpr(MakeUnaryNode(kernel::FusedEWOpCode::Sqrt, node_, true));
+}
+
+TensorExpr TensorExpr::Sin() const {
+    return TensorExpr(MakeUnaryNode(kernel::FusedEWOpCode::Sin, node_, true));
+}
+
+TensorExpr TensorExpr::Cos() const {
+    return TensorExpr(MakeUnaryNode(kernel::FusedEWOpCode::Cos, node_, true));
+}
+
+TensorExpr TensorExpr::Neg() const {
+    return TensorExpr(MakeUnaryNode(kernel::FusedEWOpCode::Neg, node_, false));
+}
+
+TensorExpr TensorExpr::Exp() const {
+    return TensorExpr(MakeUnaryNode(kernel::FusedEWOpCode::Exp, node_, true));
+}
+
+TensorExpr TensorExpr::Abs() const {
+    return TensorExpr(MakeUnaryNode(kernel::FusedEWOpCode::Abs, node_, false));
+}
+
+TensorExpr TensorExpr::Floor() const {
+    return TensorExpr(
+            MakeUnaryNode(kernel::FusedEWOpCode::Floor, node_, false));
+}
+
+TensorExpr TensorExpr::Ceil() const {
+    return TensorExpr(MakeUnaryNode(kernel::FusedEWOpCode::Ceil, node_, false));
+}
+
+TensorExpr TensorExpr::Round() const {
+    return TensorExpr(
+            MakeUnaryNode(kernel::FusedEWOpCode::Round, node_, false));
+}
+
+TensorExpr TensorExpr::Trunc() const {
+    return TensorExpr(
+            MakeUnaryNode(kernel::FusedEWOpCode::Trunc, node_, false));
+}
+
+Tensor TensorExpr::Eval() const {
+    std::vector<Tensor> inputs;
+    kernel::FusedEWProgram program;
+    Compile(node_, inputs, program);
+
+    Tensor dst(node_->shape_, node_->dtype_, node_->device_);
+    kernel::FusedEW(inputs, program, dst);
+    return dst;
+}
+
+Tensor TensorExpr::Sum(const SizeVector& dims, bool keepdim) const {
+    std::vector<Tensor> inputs;
+    kernel::FusedEWProgram program;
+    Compile(node_, inputs, program);
+
+    Tensor dst(shape_util::ReductionShape(node_->shape_, dims, keepdim),
+               node_->dtype_, node_->device_);
+    kernel::FusedEWSum(inputs, program, dst, dims, keepdim);
+    return dst;
+}
+
+SizeVector TensorExpr::GetShape() const { return node_->shape_; }
+
+Dtype TensorExpr::GetDtype() const { return node_->dtype_; }
+
+Device TensorExpr::GetDevice() const { return node_->device_; }
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Scalar.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// \class TensorExpr
+///
+/// Lazily evaluated chain of element-wise Tensor ops.
+///
+/// Operations on a TensorExpr only record the expression. Calling Eval() or
+/// Sum() compiles the recorded ops into a single fused kernel, which reads each
+/// input element once and does not materialize intermediate tensors.
+///
+/// Example:
+///
+/// \code
+/// // Equivalent to (a - b).Abs().Mul(w).Sum({0}), but in one pass.
+/// core::Tensor weighted_l1 =
+///         (core::TensorExpr(a) - b).Abs().Mul(w).Sum({0});
+/// \endcode
+///
+/// Tensors can be used directly as operands, e.g. `TensorExpr(a) - b`. The
+/// same dtype, device and broadcasting rules as the corresponding Tensor ops
+/// apply. An expression can use at most MAX_INPUTS distinct input tensors.
+class TensorExpr {
+public:
+    /// Creates an expression that reads \p tensor.
+    TensorExpr(const Tensor& tensor);
+
+    TensorExpr Add(const TensorExpr& value) const;
+    TensorExpr Add(Scalar value) const;
+    TensorExpr operator+(const TensorExpr& value) const { return Add(value); }
+    TensorExpr operator+(Scalar value) const { return Add(value); }
+    TensorExpr operator+(const Tensor& value) const {
+        return Add(TensorExpr(value));
+    }
+
+    TensorExpr Sub(const TensorExpr& value) const;
+    TensorExpr Sub(Scalar value) const;
+    TensorExpr operator-(const TensorExpr& value) const { return Sub(value); }
+    TensorExpr operator-(Scalar value) const { return Sub(value); }
+    TensorExpr operator-(const Tensor& value) const {
+        return Sub(TensorExpr(value));
+    }
+
+    TensorExpr Mul(const TensorExpr& value) const;
+    TensorExpr Mul(Scalar value) const;
+    TensorExpr operator*(const TensorExpr& value) const { return Mul(value); }
+    TensorExpr operator*(Scalar value) const { return Mul(value); }
+    TensorExpr operator*(const Tensor& value) const {
+        return Mul(TensorExpr(value));
+    }
+
+    TensorExpr Div(const TensorExpr& value) const;
+    TensorExpr Div(Scalar value) const;
+    TensorExpr operator/(const TensorExpr& value) const { return Div(value); }
+    TensorExpr operator/(Scalar value) const { return Div(value); }
+    TensorExpr operator/(const Tensor& value) const {
+        return Div(TensorExpr(value));
+    }
+
+    TensorExpr Sqrt() const;
+    TensorExpr Sin() const;
+    TensorExpr Cos() const;
+    TensorExpr Neg() const;
+    TensorExpr Exp() const;
+    TensorExpr Abs() const;
+    TensorExpr Floor() const;
+    TensorExpr Ceil() const;
+    TensorExpr Round() const;
+    TensorExpr Trunc() const;
+
+    /// Evaluates the expression with one fused kernel launch.
+    Tensor Eval() const;
+
+    /// Evaluates the expression and sums it over \p dims, with one fused
+    /// kernel launch.
+    Tensor Sum(const SizeVector& dims, bool keepdim = false) const;
+
+    /// Returns the broadcasted shape of the expression.
+    SizeVector GetShape() const;
+
+    Dtype GetDtype() const;
+
+    Device GetDevice() const;
+
+public:
+    /// Node of the recorded expression DAG, defined in TensorExpr.cpp.
+    struct Node;
+
+private:
+
+    explicit TensorExpr(const std::shared_ptr<const Node>& node)
+        : node_(node) {}
+
+    std::shared_ptr<const Node> node_;
+};
+
+}  // namespace core
+}  // namespace open3d
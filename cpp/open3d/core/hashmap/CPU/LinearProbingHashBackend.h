@@ -0,0 +1,415 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+#include "open3d/core/hashmap/CPU/CPUHashBackendBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashBackend.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+/// Open addressing CPU hash map with lock-free linear probing.
+///
+/// Keys are stored inline next to their buffer index in a power-of-two slot
+/// array, so a probe sequence walks contiguous memory instead of chasing
+/// nodes. Parallel insertions claim empty slots with a compare-and-swap;
+/// erased slots become tombstones that are dropped when the table is
+/// rebuilt. Insert, Find and Erase are each thread-safe, but different
+/// operations must not run concurrently, as for the other backends.
+template <typename Key, typename Hash, typename Eq>
+class LinearProbingHashBackend : public DeviceHashBackend {
+public:
+    LinearProbingHashBackend(int64_t init_capacity,
+                             int64_t key_dsize,
+                             const std::vector<int64_t>& value_dsizes,
+                             const Device& device);
+    ~LinearProbingHashBackend();
+
+    void Reserve(int64_t capacity) override;
+
+    void Insert(const void* input_keys,
+                const std::vector<const void*>& input_values_soa,
+                buf_index_t* output_buf_indices,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Find(const void* input_keys,
+              buf_index_t* output_buf_indices,
+              bool* output_masks,
+              int64_t count) override;
+
+    void FindAndGather(const void* input_keys,
+                       const std::vector<int64_t>& value_indices,
+                       const std::vector<void*>& output_values,
+                       buf_index_t* output_buf_indices,
+                       bool* output_masks,
+                       int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(buf_index_t* output_indices) override;
+
+    void Clear() override;
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    std::vector<int64_t> BucketSizes() const override;
+    float LoadFactor() const override;
+
+    void Allocate(int64_t capacity) override;
+    void Free() override{};
+
+protected:
+    /// Slot states besides a buffer index.
+    static constexpr int64_t kEmpty = -1;
+    static constexpr int64_t kBusy = -2;
+    static constexpr int64_t kTombstone = -3;
+
+    struct Slot {
+        Key key;
+        /// Buffer index of the entry, or one of the states above.
+        std::atomic<int64_t> state;
+    };
+
+    /// Returns the slot holding \p key, or -1.
+    int64_t FindSlot(const Key& key) const;
+
+    /// Rebuilds the slot array with \p bucket_count slots, dropping
+    /// tombstones.
+    void Rehash(int64_t bucket_count);
+
+    std::unique_ptr<Slot[]> slots_;
+    int64_t bucket_count_ = 0;
+    std::atomic<int64_t> size_{0};
+    std::atomic<int64_t> tombstones_{0};
+
+    std::shared_ptr<CPUHashBackendBufferAccessor> buffer_accessor_;
+};
+
+/// Keeps the load factor at most 1/2 for a given number of entries.
+inline int64_t LinearProbingBucketCount(int64_t capacity) {
+    int64_t bucket_count = 16;
+    while (bucket_count < 2 * capacity) {
+        bucket_count *= 2;
+    }
+    return bucket_count;
+}
+
+template <typename Key, typename Hash, typename Eq>
+LinearProbingHashBackend<Key, Hash, Eq>::LinearProbingHashBackend(
+        int64_t init_capacity,
+        int64_t key_dsize,
+        const std::vector<int64_t>& value_dsizes,
+        const Device& device)
+    : DeviceHashBackend(init_capacity, key_dsize, value_dsizes, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash, typename Eq>
+LinearProbingHashBackend<Key, Hash, Eq>::~LinearProbingHashBackend() {}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t LinearProbingHashBackend<Key, Hash, Eq>::FindSlot(
+        const Key& key) const {
+    const int64_t mask = bucket_count_ - 1;
+    const Eq eq;
+    for (int64_t slot = Hash()(key) & mask;; slot = (slot + 1) & mask) {
+        const int64_t state =
+                slots_[slot].state.load(std::memory_order_acquire);
+        if (state == kEmpty) {
+            return -1;
+        }
+        if (state >= 0 && eq(slots_[slot].key, key)) {
+            return slot;
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::Insert(
+        const void* input_keys,
+        const std::vector<const void*>& input_values_soa,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    size_t n_values = input_values_soa.size();
+
+    // Tombstones are never reused by concurrent insertions, which could
+    // otherwise insert the same key twice, so they are flushed here instead.
+    const int64_t required = size_ + tombstones_ + count;
+    if (4 * required > 3 * bucket_count_) {
+        Rehash(LinearProbingBucketCount(
+                std::max(this->capacity_, int64_t(size_ + count))));
+    }
+    const int64_t mask = bucket_count_ - 1;
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        output_buf_indices[i] = 0;
+        output_masks[i] = false;
+
+        const Key& key = input_keys_templated[i];
+        const Eq eq;
+        int64_t slot = Hash()(key) & mask;
+        while (true) {
+            Slot& s = slots_[slot];
+            int64_t state = s.state.load(std::memory_order_acquire);
+            if (state == kEmpty) {
+                if (!s.state.compare_exchange_strong(
+                            state, kBusy, std::memory_order_acq_rel)) {
+                    // Lost the race, re-examine the same slot.
+                    continue;
+                }
+                s.key = key;
+
+                buf_index_t buf_index = buffer_accessor_->DeviceAllocate();
+                *static_cast<Key*>(buffer_accessor_->GetKeyPtr(buf_index)) =
+                        key;
+                for (size_t j = 0; j < n_values; ++j) {
+                    uint8_t* dst_value = static_cast<uint8_t*>(
+                            buffer_accessor_->GetValuePtr(buf_index, j));
+                    const uint8_t* src_value =
+                            static_cast<const uint8_t*>(input_values_soa[j]) +
+                            this->value_dsizes_[j] * i;
+                    std::memcpy(dst_value, src_value, this->value_dsizes_[j]);
+                }
+                s.state.store(buf_index, std::memory_order_release);
+                size_.fetch_add(1, std::memory_order_relaxed);
+
+                output_buf_indices[i] = buf_index;
+                output_masks[i] = true;
+                break;
+            }
+            if (state == kBusy) {
+                // Another thread is writing this slot's key.
+                continue;
+            }
+            if (state >= 0 && eq(s.key, key)) {
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::Find(
+        const void* input_keys,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const int64_t slot = FindSlot(input_keys_templated[i]);
+        const bool flag = slot >= 0;
+        output_masks[i] = flag;
+        output_buf_indices[i] =
+                flag ? static_cast<buf_index_t>(slots_[slot].state.load(
+                               std::memory_order_relaxed))
+                     : 0;
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::FindAndGather(
+        const void* input_keys,
+        const std::vector<int64_t>& value_indices,
+        const std::vector<void*>& output_values,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const int64_t n_outputs = static_cast<int64_t>(value_indices.size());
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const int64_t slot = FindSlot(input_keys_templated[i]);
+        const bool flag = slot >= 0;
+        const buf_index_t buf_index =
+                flag ? static_cast<buf_index_t>(slots_[slot].state.load(
+                               std::memory_order_relaxed))
+                     : 0;
+        output_masks[i] = flag;
+        output_buf_indices[i] = buf_index;
+
+        for (int64_t j = 0; j < n_outputs; ++j) {
+            const int64_t dsize = this->value_dsizes_[value_indices[j]];
+            uint8_t* dst = static_cast<uint8_t*>(output_values[j]) + i * dsize;
+            if (flag) {
+                std::memcpy(dst,
+                            buffer_accessor_->GetValuePtr(buf_index,
+                                                          value_indices[j]),
+                            dsize);
+            } else {
+                std::memset(dst, 0, dsize);
+            }
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
+                                                    bool* output_masks,
+                                                    int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        output_masks[i] = false;
+        const int64_t slot = FindSlot(input_keys_templated[i]);
+        if (slot < 0) {
+            continue;
+        }
+
+        // Duplicated keys in the input race for the same slot.
+        int64_t state = slots_[slot].state.load(std::memory_order_acquire);
+        if (state >= 0 && slots_[slot].state.compare_exchange_strong(
+                                  state, kTombstone,
+                                  std::memory_order_acq_rel)) {
+            buffer_accessor_->DeviceFree(static_cast<buf_index_t>(state));
+            size_.fetch_sub(1, std::memory_order_relaxed);
+            tombstones_.fetch_add(1, std::memory_order_relaxed);
+            output_masks[i] = true;
+        }
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t LinearProbingHashBackend<Key, Hash, Eq>::GetActiveIndices(
+        buf_index_t* output_buf_indices) {
+    int64_t i = 0;
+    for (int64_t slot = 0; slot < bucket_count_; ++slot) {
+        const int64_t state =
+                slots_[slot].state.load(std::memory_order_relaxed);
+        if (state >= 0) {
+            output_buf_indices[i++] = static_cast<buf_index_t>(state);
+        }
+    }
+    return i;
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::Clear() {
+    for (int64_t slot = 0; slot < bucket_count_; ++slot) {
+        slots_[slot].state.store(kEmpty, std::memory_order_relaxed);
+    }
+    size_ = 0;
+    tombstones_ = 0;
+    this->buffer_->ResetHeap();
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::Reserve(int64_t capacity) {
+    const int64_t bucket_count = LinearProbingBucketCount(capacity);
+    if (bucket_count > bucket_count_) {
+        Rehash(bucket_count);
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::Rehash(int64_t bucket_count) {
+    std::unique_ptr<Slot[]> old_slots = std::move(slots_);
+    const int64_t old_bucket_count = bucket_count_;
+
+    slots_.reset(new Slot[bucket_count]);
+    bucket_count_ = bucket_count;
+    for (int64_t slot = 0; slot < bucket_count_; ++slot) {
+        slots_[slot].state.store(kEmpty, std::memory_order_relaxed);
+    }
+
+    const int64_t mask = bucket_count_ - 1;
+    for (int64_t old_slot = 0; old_slot < old_bucket_count; ++old_slot) {
+        const int64_t state =
+                old_slots[old_slot].state.load(std::memory_order_relaxed);
+        if (state < 0) {
+            continue;
+        }
+        const Key& key = old_slots[old_slot].key;
+        int64_t slot = Hash()(key) & mask;
+        while (slots_[slot].state.load(std::memory_order_relaxed) != kEmpty) {
+            slot = (slot + 1) & mask;
+        }
+        slots_[slot].key = key;
+        slots_[slot].state.store(state, std::memory_order_relaxed);
+    }
+    tombstones_ = 0;
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t LinearProbingHashBackend<Key, Hash, Eq>::Size() const {
+    return size_;
+}
+
+template <typename Key, typename Hash, typename Eq>
+int64_t LinearProbingHashBackend<Key, Hash, Eq>::GetBucketCount() const {
+    return bucket_count_;
+}
+
+template <typename Key, typename Hash, typename Eq>
+std::vector<int64_t> LinearProbingHashBackend<Key, Hash, Eq>::BucketSizes()
+        const {
+    std::vector<int64_t> ret(bucket_count_);
+    for (int64_t slot = 0; slot < bucket_count_; ++slot) {
+        ret[slot] = slots_[slot].state.load(std::memory_order_relaxed) >= 0;
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash, typename Eq>
+float LinearProbingHashBackend<Key, Hash, Eq>::LoadFactor() const {
+    return float(size_) / float(bucket_count_);
+}
+
+template <typename Key, typename Hash, typename Eq>
+void LinearProbingHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ = std::make_shared<HashBackendBuffer>(
+            this->capacity_, this->key_dsize_, this->value_dsizes_,
+            this->device_);
+
+    buffer_accessor_ =
+            std::make_shared<CPUHashBackendBufferAccessor>(*this->buffer_);
+
+    slots_.reset();
+    bucket_count_ = 0;
+    size_ = 0;
+    Rehash(LinearProbingBucketCount(capacity));
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <tbb/concurrent_unordered_map.h>
 
+#include <cstring>
 #include <limits>
 #include <unordered_map>
 
@@ -59,6 +60,13 @@ public:
               bool* output_masks,
               int64_t count) override;
 
+    void FindAndGather(const void* input_keys,
+                       const std::vector<int64_t>& value_indices,
+                       const std::vector<void*>& output_values,
+                       buf_index_t* output_buf_indices,
+                       bool* output_masks,
+                       int64_t count) override;
+
     void Erase(const void* input_keys,
                bool* output_masks,
                int64_t count) override;
@@ -123,6 +131,41 @@ void TBBHashBackend<Key, Hash, Eq>::Find(const void* input_keys,
     }
 }
 
+template <typename Key, typename Hash, typename Eq>
+void TBBHashBackend<Key, Hash, Eq>::FindAndGather(
+        const void* input_keys,
+        const std::vector<int64_t>& value_indices,
+        const std::vector<void*>& output_values,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const int64_t n_outputs = static_cast<int64_t>(value_indices.size());
+
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+
+        auto iter = impl_->find(key);
+        bool flag = (iter != impl_->end());
+        output_masks[i] = flag;
+        output_buf_indices[i] = flag ? iter->second : 0;
+
+        for (int64_t j = 0; j < n_outputs; ++j) {
+            const int64_t dsize = this->value_dsizes_[value_indices[j]];
+            uint8_t* dst = static_cast<uint8_t*>(output_values[j]) + i * dsize;
+            if (flag) {
+                std::memcpy(dst,
+                            buffer_accessor_->GetValuePtr(iter->second,
+                                                          value_indices[j]),
+                            dsize);
+            } else {
+                std::memset(dst, 0, dsize);
+            }
+        }
+    }
+}
+
 template <typename Key, typename Hash, typename Eq>
 void TBBHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
                                           bool* output_masks,
@@ -77,7 +77,9 @@ public:
         std::vector<uint8_t *> value_ptrs(n_values_);
         for (size_t i = 0; i < n_values_; ++i) {
             value_ptrs[i] = value_buffers[i].GetDataPtr<uint8_t>();
-            cudaMemset(value_ptrs[i], 0, capacity_ * value_dsizes_host[i]);
+            cudaMemsetAsync(value_ptrs[i], 0,
+                            capacity_ * value_dsizes_host[i],
+                            core::cuda::GetStream());
         }
         values_ = static_cast<uint8_t **>(
                 MemoryManager::Malloc(n_values_ * sizeof(uint8_t *), device));
@@ -85,7 +87,7 @@ public:
                                       n_values_ * sizeof(uint8_t *));
 
         heap_top_ = hashmap_buffer.GetHeapTop().cuda.GetDataPtr<int>();
-        cuda::Synchronize();
+        cuda::StreamSynchronize();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -129,5 +131,63 @@ public:
     int64_t capacity_;
 };
 
+/// Source and destination of one value array gathered by FindAndGather().
+struct ValueGatherTarget {
+    const uint8_t *src;
+    uint8_t *dst;
+    int64_t dsize;
+};
+
+/// Returns a device array of the gather targets of FindAndGather(), to be
+/// released with MemoryManager::Free().
+inline ValueGatherTarget *CreateValueGatherTargets(
+        HashBackendBuffer &hashmap_buffer,
+        const std::vector<int64_t> &value_indices,
+        const std::vector<void *> &output_values) {
+    std::vector<ValueGatherTarget> targets;
+    for (size_t i = 0; i < value_indices.size(); ++i) {
+        ValueGatherTarget target;
+        target.src = hashmap_buffer.GetValueBuffer(value_indices[i])
+                             .GetDataPtr<uint8_t>();
+        target.dst = static_cast<uint8_t *>(output_values[i]);
+        target.dsize = hashmap_buffer.GetValueDsizes()[value_indices[i]];
+        targets.push_back(target);
+    }
+
+    const Device device = hashmap_buffer.GetDevice();
+    ValueGatherTarget *targets_device =
+            static_cast<ValueGatherTarget *>(MemoryManager::Malloc(
+                    targets.size() * sizeof(ValueGatherTarget), device));
+    MemoryManager::MemcpyFromHost(targets_device, device, targets.data(),
+                                  targets.size() * sizeof(ValueGatherTarget));
+    return targets_device;
+}
+
+/// Copies the value of \p buf_index (or zeros if not \p found) to the slot of
+/// \p query in \p target. Threads offset by \p lane and striding by
+/// \p num_lanes share the copy, so a warp reads whole cache lines at once.
+__device__ inline void GatherValue(const ValueGatherTarget &target,
+                                   int64_t query,
+                                   buf_index_t buf_index,
+                                   bool found,
+                                   uint32_t lane,
+                                   uint32_t num_lanes) {
+    if (target.dsize % sizeof(int) == 0) {
+        const int64_t words = target.dsize / sizeof(int);
+        const int *src = reinterpret_cast<const int *>(target.src) +
+                         buf_index * words;
+        int *dst = reinterpret_cast<int *>(target.dst) + query * words;
+        for (int64_t w = lane; w < words; w += num_lanes) {
+            dst[w] = found ? src[w] : 0;
+        }
+    } else {
+        const uint8_t *src = target.src + buf_index * target.dsize;
+        uint8_t *dst = target.dst + query * target.dsize;
+        for (int64_t b = lane; b < target.dsize; b += num_lanes) {
+            dst[b] = found ? src[b] : 0;
+        }
+    }
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -58,6 +58,13 @@ public:
               bool* output_masks,
               int64_t count) override;
 
+    void FindAndGather(const void* input_keys,
+                       const std::vector<int64_t>& value_indices,
+                       const std::vector<void*>& output_values,
+                       buf_index_t* output_buf_indices,
+                       bool* output_masks,
+                       int64_t count) override;
+
     void Erase(const void* input_keys,
                bool* output_masks,
                int64_t count) override;
@@ -111,16 +118,46 @@ void SlabHashBackend<Key, Hash, Eq>::Find(const void* input_keys,
                                           int64_t count) {
     if (count == 0) return;
 
-    OPEN3D_CUDA_CHECK(cudaMemset(output_masks, 0, sizeof(bool) * count));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(output_masks, 0, sizeof(bool) * count,
+                                      core::cuda::GetStream()));
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     const int64_t num_blocks =
             (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
     FindKernel<<<num_blocks, kThreadsPerBlock, 0, core::cuda::GetStream()>>>(
             impl_, input_keys, output_buf_indices, output_masks, count);
-    cuda::Synchronize();
+    cuda::StreamSynchronize();
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+template <typename Key, typename Hash, typename Eq>
+void SlabHashBackend<Key, Hash, Eq>::FindAndGather(
+        const void* input_keys,
+        const std::vector<int64_t>& value_indices,
+        const std::vector<void*>& output_values,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    if (count == 0) return;
+
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(output_masks, 0, sizeof(bool) * count,
+                                      core::cuda::GetStream()));
+    ValueGatherTarget* targets =
+            CreateValueGatherTargets(*this->buffer_, value_indices,
+                                     output_values);
+    cuda::StreamSynchronize();
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+
+    const int64_t num_blocks =
+            (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    FindAndGatherKernel<<<num_blocks, kThreadsPerBlock, 0,
+                          core::cuda::GetStream()>>>(
+            impl_, input_keys, targets, value_indices.size(),
+            output_buf_indices, output_masks, count);
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
+    MemoryManager::Free(targets, this->device_);
 }
 
 template <typename Key, typename Hash, typename Eq>
@@ -129,8 +166,9 @@ void SlabHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
                                            int64_t count) {
     if (count == 0) return;
 
-    OPEN3D_CUDA_CHECK(cudaMemset(output_masks, 0, sizeof(bool) * count));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(output_masks, 0, sizeof(bool) * count,
+                                      core::cuda::GetStream()));
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
     auto buf_indices = static_cast<buf_index_t*>(
             MemoryManager::Malloc(sizeof(buf_index_t) * count, this->device_));
@@ -143,7 +181,7 @@ void SlabHashBackend<Key, Hash, Eq>::Erase(const void* input_keys,
     EraseKernelPass1<<<num_blocks, kThreadsPerBlock, 0,
                        core::cuda::GetStream()>>>(impl_, buf_indices,
                                                   output_masks, count);
-    cuda::Synchronize();
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     MemoryManager::Free(buf_indices, this->device_);
@@ -154,9 +192,10 @@ int64_t SlabHashBackend<Key, Hash, Eq>::GetActiveIndices(
         buf_index_t* output_buf_indices) {
     uint32_t* count = static_cast<uint32_t*>(
             MemoryManager::Malloc(sizeof(uint32_t), this->device_));
-    OPEN3D_CUDA_CHECK(cudaMemset(count, 0, sizeof(uint32_t)));
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(count, 0, sizeof(uint32_t),
+                                      core::cuda::GetStream()));
 
-    cuda::Synchronize();
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     const int64_t num_blocks =
@@ -165,7 +204,7 @@ int64_t SlabHashBackend<Key, Hash, Eq>::GetActiveIndices(
     GetActiveIndicesKernel<<<num_blocks, kThreadsPerBlock, 0,
                              core::cuda::GetStream()>>>(
             impl_, output_buf_indices, count);
-    cuda::Synchronize();
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     uint32_t ret;
@@ -181,9 +220,10 @@ void SlabHashBackend<Key, Hash, Eq>::Clear() {
     this->buffer_->ResetHeap();
 
     // Clear the linked list heads
-    OPEN3D_CUDA_CHECK(cudaMemset(impl_.bucket_list_head_, 0xFF,
-                                 sizeof(Slab) * this->bucket_count_));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(impl_.bucket_list_head_, 0xFF,
+                                      sizeof(Slab) * this->bucket_count_,
+                                      core::cuda::GetStream()));
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     // Clear the linked list nodes
@@ -211,7 +251,7 @@ std::vector<int64_t> SlabHashBackend<Key, Hash, Eq>::BucketSizes() const {
     CountElemsPerBucketKernel<<<num_blocks, kThreadsPerBlock, 0,
                                 core::cuda::GetStream()>>>(
             impl_, thrust::raw_pointer_cast(elems_per_bucket.data()));
-    cuda::Synchronize();
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     std::vector<int64_t> result(impl_.bucket_count_);
@@ -263,7 +303,7 @@ void SlabHashBackend<Key, Hash, Eq>::Insert(
                                 impl_, ptr_input_values_soa, output_buf_indices,
                                 output_masks, count, n_values);
             });
-    cuda::Synchronize();
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 }
 
@@ -284,9 +324,10 @@ void SlabHashBackend<Key, Hash, Eq>::Allocate(int64_t capacity) {
     // Allocate linked list heads.
     impl_.bucket_list_head_ = static_cast<Slab*>(MemoryManager::Malloc(
             sizeof(Slab) * this->bucket_count_, this->device_));
-    OPEN3D_CUDA_CHECK(cudaMemset(impl_.bucket_list_head_, 0xFF,
-                                 sizeof(Slab) * this->bucket_count_));
-    cuda::Synchronize();
+    OPEN3D_CUDA_CHECK(cudaMemsetAsync(impl_.bucket_list_head_, 0xFF,
+                                      sizeof(Slab) * this->bucket_count_,
+                                      core::cuda::GetStream()));
+    cuda::StreamSynchronize();
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 
     impl_.Setup(this->bucket_count_, node_mgr_->impl_, buffer_accessor_);
@@ -168,6 +168,15 @@ __global__ void FindKernel(SlabHashBackendImpl<Key, Hash, Eq> impl,
                            bool* output_masks,
                            int64_t count);
 
+template <typename Key, typename Hash, typename Eq>
+__global__ void FindAndGatherKernel(SlabHashBackendImpl<Key, Hash, Eq> impl,
+                                    const void* input_keys,
+                                    const ValueGatherTarget* targets,
+                                    int64_t n_targets,
+                                    buf_index_t* output_buf_indices,
+                                    bool* output_masks,
+                                    int64_t count);
+
 template <typename Key, typename Hash, typename Eq>
 __global__ void EraseKernelPass0(SlabHashBackendImpl<Key, Hash, Eq> impl,
                                  const void* input_keys,
@@ -616,6 +625,66 @@ __global__ void FindKernel(SlabHashBackendImpl<Key, Hash, Eq> impl,
     }
 }
 
+template <typename Key, typename Hash, typename Eq>
+__global__ void FindAndGatherKernel(SlabHashBackendImpl<Key, Hash, Eq> impl,
+                                    const void* input_keys,
+                                    const ValueGatherTarget* targets,
+                                    int64_t n_targets,
+                                    buf_index_t* output_buf_indices,
+                                    bool* output_masks,
+                                    int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    uint32_t lane_id = threadIdx.x & 0x1F;
+
+    // This warp is idle.
+    if ((tid - lane_id) >= count) {
+        return;
+    }
+
+    // Initialize the memory allocator on each warp.
+    impl.node_mgr_impl_.Init(tid, lane_id);
+
+    bool lane_active = false;
+    uint32_t bucket_id = 0;
+
+    // Dummy for warp sync
+    Key key;
+    Pair<buf_index_t, bool> result;
+
+    if (tid < count) {
+        lane_active = true;
+        key = input_keys_templated[tid];
+        bucket_id = impl.ComputeBucket(key);
+    }
+
+    result = impl.Find(lane_active, lane_id, bucket_id, key);
+
+    if (tid < count) {
+        output_buf_indices[tid] = result.first;
+        output_masks[tid] = result.second;
+    }
+
+    // The warp copies the values of its queries one at a time, each lane
+    // reading consecutive words of the same value.
+    const int64_t warp_begin = tid - lane_id;
+    for (uint32_t src_lane = 0; src_lane < kWarpSize; ++src_lane) {
+        const buf_index_t buf_index = __shfl_sync(
+                kSyncLanesMask, result.first, src_lane, kWarpSize);
+        const bool found = __shfl_sync(kSyncLanesMask,
+                                       static_cast<int>(result.second),
+                                       src_lane, kWarpSize);
+        const int64_t query = warp_begin + src_lane;
+        if (query >= count) {
+            break;
+        }
+        for (int64_t i = 0; i < n_targets; ++i) {
+            GatherValue(targets[i], query, buf_index, found, lane_id,
+                        kWarpSize);
+        }
+    }
+}
+
 template <typename Key, typename Hash, typename Eq>
 __global__ void EraseKernelPass0(SlabHashBackendImpl<Key, Hash, Eq> impl,
                                  const void* input_keys,
@@ -253,17 +253,19 @@ public:
     ~SlabNodeManager() { MemoryManager::Free(impl_.super_blocks_, device_); }
 
     void Reset() {
-        OPEN3D_CUDA_CHECK(cudaMemset(
+        OPEN3D_CUDA_CHECK(cudaMemsetAsync(
                 impl_.super_blocks_, 0xFF,
-                kUIntsPerSuperBlock * kSuperBlocks * sizeof(uint32_t)));
+                kUIntsPerSuperBlock * kSuperBlocks * sizeof(uint32_t),
+                core::cuda::GetStream()));
 
         for (uint32_t i = 0; i < kSuperBlocks; i++) {
             // setting bitmaps into zeros:
-            OPEN3D_CUDA_CHECK(cudaMemset(
+            OPEN3D_CUDA_CHECK(cudaMemsetAsync(
                     impl_.super_blocks_ + i * kUIntsPerSuperBlock, 0x00,
-                    kBlocksPerSuperBlock * kSlabsPerBlock * sizeof(uint32_t)));
+                    kBlocksPerSuperBlock * kSlabsPerBlock * sizeof(uint32_t),
+                    core::cuda::GetStream()));
         }
-        cuda::Synchronize();
+        cuda::StreamSynchronize();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -281,7 +283,7 @@ public:
         CountSlabsPerSuperblockKernel<<<num_cuda_blocks, kThreadsPerBlock, 0,
                                         core::cuda::GetStream()>>>(
                 impl_, thrust::raw_pointer_cast(slabs_per_superblock.data()));
-        cuda::Synchronize();
+        cuda::StreamSynchronize();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
 
         std::vector<int> result(num_super_blocks);
@@ -152,6 +152,13 @@ public:
               bool* output_masks,
               int64_t count) override;
 
+    void FindAndGather(const void* input_keys,
+                       const std::vector<int64_t>& value_indices,
+                       const std::vector<void*>& output_values,
+                       buf_index_t* output_buf_indices,
+                       bool* output_masks,
+                       int64_t count) override;
+
     void Erase(const void* input_keys,
                bool* output_masks,
                int64_t count) override;
@@ -231,6 +238,52 @@ void StdGPUHashBackend<Key, Hash, Eq>::Find(const void* input_keys,
     cuda::Synchronize(this->device_);
 }
 
+template <typename Key, typename Hash, typename Eq>
+__global__ void STDGPUFindAndGatherKernel(
+        InternalStdGPUHashBackend<Key, Hash, Eq> map,
+        const Key* input_keys,
+        const ValueGatherTarget* targets,
+        int64_t n_targets,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    if (tid >= count) return;
+
+    Key key = input_keys[tid];
+    auto iter = map.find(key);
+    bool flag = (iter != map.end());
+    buf_index_t buf_index = flag ? iter->second : 0;
+    output_masks[tid] = flag;
+    output_buf_indices[tid] = buf_index;
+    for (int64_t i = 0; i < n_targets; ++i) {
+        GatherValue(targets[i], tid, buf_index, flag, 0, 1);
+    }
+}
+
+template <typename Key, typename Hash, typename Eq>
+void StdGPUHashBackend<Key, Hash, Eq>::FindAndGather(
+        const void* input_keys,
+        const std::vector<int64_t>& value_indices,
+        const std::vector<void*>& output_values,
+        buf_index_t* output_buf_indices,
+        bool* output_masks,
+        int64_t count) {
+    if (count == 0) return;
+
+    ValueGatherTarget* targets =
+            CreateValueGatherTargets(*this->buffer_, value_indices,
+                                     output_values);
+    uint32_t threads = 128;
+    uint32_t blocks = (count + threads - 1) / threads;
+
+    STDGPUFindAndGatherKernel<<<blocks, threads, 0, core::cuda::GetStream()>>>(
+            impl_, static_cast<const Key*>(input_keys), targets,
+            value_indices.size(), output_buf_indices, output_masks, count);
+    cuda::Synchronize(this->device_);
+    MemoryManager::Free(targets, this->device_);
+}
+
 // Need an explicit kernel for non-const access to map
 template <typename Key, typename Hash, typename Eq>
 __global__ void STDGPUEraseKernel(InternalStdGPUHashBackend<Key, Hash, Eq> map,
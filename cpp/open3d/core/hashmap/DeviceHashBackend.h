@@ -69,6 +69,17 @@ public:
                       bool* output_masks,
                       int64_t count) = 0;
 
+    /// Parallel find a contiguous array of keys and copy the value arrays
+    /// \p value_indices of the found entries into \p output_values, one
+    /// contiguous array per selected value array, in the same pass. Outputs
+    /// of keys that are not found are zeroed.
+    virtual void FindAndGather(const void* input_keys,
+                               const std::vector<int64_t>& value_indices,
+                               const std::vector<void*>& output_values,
+                               buf_index_t* output_buf_indices,
+                               bool* output_masks,
+                               int64_t count) = 0;
+
     /// Parallel erase a contiguous array of keys.
     virtual void Erase(const void* input_keys,
                        bool* output_masks,
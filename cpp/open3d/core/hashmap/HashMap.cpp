@@ -26,7 +26,9 @@
 
 #include "open3d/core/hashmap/HashMap.h"
 
+#include "open3d/core/Metrics.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/core/hashmap/DeviceHashBackend.h"
 #include "open3d/t/io/HashMapIO.h"
 #include "open3d/utility/Helper.h"
@@ -35,6 +37,12 @@
 namespace open3d {
 namespace core {
 
+/// Concatenates recorded tensors along the first dimension. Concatenate()
+/// splits a single tensor instead, so that case is handled separately.
+static Tensor ConcatenateRecords(const std::vector<Tensor>& records) {
+    return records.size() == 1 ? records[0] : Concatenate(records, 0);
+}
+
 HashMap::HashMap(int64_t init_capacity,
                  const Dtype& key_dtype,
                  const SizeVector& key_element_shape,
@@ -84,6 +92,14 @@ void HashMap::Reserve(int64_t capacity) {
         }
     }
 
+    // Rehashing moves entries to new buffer indices, so the recorded changes
+    // are carried over by key.
+    Tensor dirty_keys;
+    if (change_log_) {
+        dirty_keys = GetKeyTensor().IndexGet({CollectDirtyIndices()});
+        change_log_->dirty_buf_indices.clear();
+    }
+
     device_hashmap_->Free();
     device_hashmap_->Allocate(capacity);
     device_hashmap_->Reserve(capacity);
@@ -93,6 +109,13 @@ void HashMap::Reserve(int64_t capacity) {
         InsertImpl(active_keys, active_values, output_buf_indices,
                    output_masks);
     }
+
+    if (change_log_ && dirty_keys.GetLength() > 0) {
+        Tensor dirty_buf_indices, dirty_masks;
+        Find(dirty_keys, dirty_buf_indices, dirty_masks);
+        change_log_->dirty_buf_indices.push_back(
+                dirty_buf_indices.To(core::Int64));
+    }
 }
 
 std::pair<Tensor, Tensor> HashMap::Insert(const Tensor& input_keys,
@@ -121,6 +144,15 @@ std::pair<Tensor, Tensor> HashMap::Find(const Tensor& input_keys) {
     return std::make_pair(output_buf_indices, output_masks);
 }
 
+std::pair<std::vector<Tensor>, Tensor> HashMap::FindAndGather(
+        const Tensor& input_keys, const std::vector<size_t>& value_indices) {
+    std::vector<Tensor> output_values;
+    Tensor output_buf_indices, output_masks;
+    FindAndGather(input_keys, value_indices, output_values, output_buf_indices,
+                  output_masks);
+    return std::make_pair(output_values, output_masks);
+}
+
 Tensor HashMap::Erase(const Tensor& input_keys) {
     Tensor output_masks;
     Erase(input_keys, output_masks);
@@ -175,10 +207,17 @@ void HashMap::Insert(const Tensor& input_keys,
     int64_t new_size = Size() + length;
     int64_t capacity = GetCapacity();
 
+    ObserveHashMapInsert(GetDevice(), new_size, capacity,
+                         new_size > capacity);
     if (new_size > capacity) {
         Reserve(std::max(new_size, capacity * 2));
     }
     InsertImpl(input_keys, input_values_soa, output_buf_indices, output_masks);
+
+    if (change_log_) {
+        change_log_->dirty_buf_indices.push_back(
+                output_buf_indices.IndexGet({output_masks}).To(core::Int64));
+    }
 }
 
 void HashMap::Activate(const Tensor& input_keys,
@@ -188,6 +227,8 @@ void HashMap::Activate(const Tensor& input_keys,
     int64_t new_size = Size() + length;
     int64_t capacity = GetCapacity();
 
+    ObserveHashMapInsert(GetDevice(), new_size, capacity,
+                         new_size > capacity);
     if (new_size > capacity) {
         Reserve(std::max(new_size, capacity * 2));
     }
@@ -195,6 +236,11 @@ void HashMap::Activate(const Tensor& input_keys,
     std::vector<Tensor> null_tensors_soa;
     InsertImpl(input_keys, null_tensors_soa, output_buf_indices, output_masks,
                /* is_activate_op */ true);
+
+    if (change_log_) {
+        change_log_->dirty_buf_indices.push_back(
+                output_buf_indices.IndexGet({output_masks}).To(core::Int64));
+    }
 }
 
 void HashMap::Find(const Tensor& input_keys,
@@ -213,6 +259,55 @@ void HashMap::Find(const Tensor& input_keys,
             output_masks.GetDataPtr<bool>(), length);
 }
 
+void HashMap::FindAndGather(const Tensor& input_keys,
+                            const std::vector<size_t>& value_indices,
+                            std::vector<Tensor>& output_values,
+                            Tensor& output_buf_indices,
+                            Tensor& output_masks) {
+    CheckKeyLength(input_keys);
+    CheckKeyCompatibility(input_keys);
+
+    std::vector<int64_t> selected;
+    if (value_indices.empty()) {
+        for (size_t i = 0; i < dtypes_value_.size(); ++i) {
+            selected.push_back(static_cast<int64_t>(i));
+        }
+    } else {
+        for (size_t i : value_indices) {
+            if (i >= dtypes_value_.size()) {
+                utility::LogError("Value index ({}) out of bound (>= {})", i,
+                                  dtypes_value_.size());
+            }
+            selected.push_back(static_cast<int64_t>(i));
+        }
+    }
+
+    int64_t length = input_keys.GetLength();
+    PrepareIndicesOutput(output_buf_indices, length);
+    PrepareMasksOutput(output_masks, length);
+
+    output_values.resize(selected.size());
+    std::vector<void*> output_values_ptrs;
+    for (size_t i = 0; i < selected.size(); ++i) {
+        SizeVector value_shape = element_shapes_value_[selected[i]];
+        value_shape.insert(value_shape.begin(), length);
+        const Dtype value_dtype = dtypes_value_[selected[i]];
+        Tensor& output_value = output_values[i];
+        if (output_value.GetShape() != value_shape ||
+            output_value.GetDtype() != value_dtype ||
+            output_value.GetDevice() != GetDevice() ||
+            !output_value.IsContiguous()) {
+            output_value = Tensor(value_shape, value_dtype, GetDevice());
+        }
+        output_values_ptrs.push_back(output_value.GetDataPtr());
+    }
+
+    device_hashmap_->FindAndGather(
+            input_keys.GetDataPtr(), selected, output_values_ptrs,
+            static_cast<buf_index_t*>(output_buf_indices.GetDataPtr()),
+            output_masks.GetDataPtr<bool>(), length);
+}
+
 void HashMap::Erase(const Tensor& input_keys, Tensor& output_masks) {
     CheckKeyLength(input_keys);
     CheckKeyCompatibility(input_keys);
@@ -222,6 +317,11 @@ void HashMap::Erase(const Tensor& input_keys, Tensor& output_masks) {
 
     device_hashmap_->Erase(input_keys.GetDataPtr(),
                            output_masks.GetDataPtr<bool>(), length);
+
+    if (change_log_) {
+        change_log_->erased_keys.push_back(
+                input_keys.IndexGet({output_masks}));
+    }
 }
 
 void HashMap::GetActiveIndices(Tensor& output_buf_indices) const {
@@ -232,18 +332,92 @@ void HashMap::GetActiveIndices(Tensor& output_buf_indices) const {
             static_cast<buf_index_t*>(output_buf_indices.GetDataPtr()));
 }
 
-void HashMap::Clear() { device_hashmap_->Clear(); }
+void HashMap::Clear() {
+    if (change_log_ && Size() > 0) {
+        change_log_->erased_keys.push_back(GetKeyTensor().IndexGet(
+                {GetActiveIndices().To(core::Int64)}));
+        change_log_->dirty_buf_indices.clear();
+    }
+    device_hashmap_->Clear();
+}
 
 void HashMap::Save(const std::string& file_name) {
     t::io::WriteHashMap(file_name, *this);
 }
 
-HashMap HashMap::Load(const std::string& file_name) {
-    return t::io::ReadHashMap(file_name);
+HashMap HashMap::Load(const std::string& file_name, const Device& device) {
+    return t::io::ReadHashMap(file_name, device);
 }
 
 HashMap HashMap::Clone() const { return To(GetDevice(), /*copy=*/true); }
 
+void HashMap::EnableDeltaTracking() {
+    if (!change_log_) {
+        change_log_ = std::make_shared<ChangeLog>();
+    }
+}
+
+void HashMap::MarkDirty(const Tensor& buf_indices) {
+    if (!change_log_) {
+        utility::LogError(
+                "Delta tracking is not enabled, call EnableDeltaTracking() "
+                "first.");
+    }
+    AssertTensorDtypes(buf_indices, {core::Int32, core::Int64});
+    AssertTensorDevice(buf_indices, GetDevice());
+    change_log_->dirty_buf_indices.push_back(
+            buf_indices.Reshape({-1}).To(core::Int64));
+}
+
+HashMapDelta HashMap::ExportDelta() {
+    if (!change_log_) {
+        utility::LogError(
+                "Delta tracking is not enabled, call EnableDeltaTracking() "
+                "first.");
+    }
+
+    HashMapDelta delta;
+    Tensor dirty_indices = CollectDirtyIndices();
+    delta.keys = GetKeyTensor().IndexGet({dirty_indices});
+    for (const Tensor& value_buffer : GetValueTensors()) {
+        delta.values.push_back(value_buffer.IndexGet({dirty_indices}));
+    }
+
+    if (change_log_->erased_keys.empty()) {
+        SizeVector key_shape = key_element_shape_;
+        key_shape.insert(key_shape.begin(), 0);
+        delta.erased_keys = Tensor::Empty(key_shape, key_dtype_, GetDevice());
+    } else {
+        delta.erased_keys = ConcatenateRecords(change_log_->erased_keys);
+    }
+    delta.epoch = change_log_->epoch++;
+
+    change_log_->dirty_buf_indices.clear();
+    change_log_->erased_keys.clear();
+    return delta;
+}
+
+void HashMap::ApplyDelta(const HashMapDelta& delta) {
+    CheckValueCompatibility(delta.values);
+
+    if (delta.erased_keys.GetLength() > 0) {
+        Erase(delta.erased_keys);
+    }
+    if (delta.keys.GetLength() > 0) {
+        CheckKeyValueLengthCompatibility(delta.keys, delta.values);
+
+        // Activate() does not report the buffer indices of existing keys, so
+        // they are looked up afterwards and all values are overwritten.
+        Tensor buf_indices, masks;
+        Activate(delta.keys, buf_indices, masks);
+        Find(delta.keys, buf_indices, masks);
+        Tensor indices = buf_indices.To(core::Int64);
+        for (size_t i = 0; i < delta.values.size(); ++i) {
+            GetValueTensor(i).IndexSet({indices}, delta.values[i]);
+        }
+    }
+}
+
 HashMap HashMap::To(const Device& device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
@@ -373,6 +547,24 @@ void HashMap::Init(int64_t init_capacity,
             element_shapes_value_, device, backend);
 }
 
+Tensor HashMap::CollectDirtyIndices() {
+    std::vector<Tensor>& dirty = change_log_->dirty_buf_indices;
+    Tensor indices =
+            dirty.empty() ? Tensor::Empty({0}, core::Int64, GetDevice())
+                          : ConcatenateRecords(dirty).Unique();
+    if (indices.GetLength() == 0) {
+        return indices;
+    }
+
+    // A recorded buffer index may have been freed by Erase() since; it is
+    // still current only if its key is found at the same index.
+    Tensor keys = GetKeyTensor().IndexGet({indices});
+    Tensor buf_indices, masks;
+    Find(keys, buf_indices, masks);
+    Tensor current = masks.LogicalAnd(buf_indices.To(core::Int64).Eq(indices));
+    return indices.IndexGet({current});
+}
+
 void HashMap::CheckKeyLength(const Tensor& input_keys) const {
     int64_t key_len = input_keys.GetLength();
     if (key_len == 0) {
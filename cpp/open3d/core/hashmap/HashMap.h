@@ -35,7 +35,20 @@ namespace core {
 
 class DeviceHashBackend;
 
-enum class HashBackendType { Slab, StdGPU, TBB, Default };
+enum class HashBackendType { Slab, StdGPU, TBB, LinearProbing, Default };
+
+/// Changes of a hash map between two calls to HashMap::ExportDelta().
+struct HashMapDelta {
+    /// Keys inserted, activated or marked dirty since the previous export.
+    Tensor keys;
+    /// Values of \p keys at the time of export, one tensor per value array.
+    std::vector<Tensor> values;
+    /// Keys erased since the previous export. A key that was erased and then
+    /// inserted again appears in both \p erased_keys and \p keys.
+    Tensor erased_keys;
+    /// Number of deltas exported before this one.
+    int64_t epoch = 0;
+};
 
 class HashMap {
 public:
@@ -97,6 +110,17 @@ public:
     /// not found).
     std::pair<Tensor, Tensor> Find(const Tensor& input_keys);
 
+    /// Parallel find an array of keys and gather the value arrays
+    /// \p value_indices of the found entries in the same pass, instead of a
+    /// Find() followed by an IndexGet() per value array. An empty
+    /// \p value_indices gathers all value arrays.
+    /// Return: output_values, one Tensor of shape {n, element_shape...} per
+    /// selected value array, zero for keys that are not found.
+    /// Return: output_masks, as in Find().
+    std::pair<std::vector<Tensor>, Tensor> FindAndGather(
+            const Tensor& input_keys,
+            const std::vector<size_t>& value_indices = {});
+
     /// Parallel erase an array of keys in Tensor.
     /// Return: output_masks stores if the erase is a success or failure (key
     /// not found all already erased in another thread).
@@ -137,6 +161,15 @@ public:
               Tensor& output_buf_indices,
               Tensor& output_masks);
 
+    /// Same as FindAndGather, but takes output_values, output_buf_indices and
+    /// output_masks as input. If their shapes and types match, reallocation
+    /// is not needed.
+    void FindAndGather(const Tensor& input_keys,
+                       const std::vector<size_t>& value_indices,
+                       std::vector<Tensor>& output_values,
+                       Tensor& output_buf_indices,
+                       Tensor& output_masks);
+
     /// Same as Erase, but takes output_masks as input. If its shape and
     /// type matches, reallocation is not needed.
     void Erase(const Tensor& input_keys, Tensor& output_masks);
@@ -151,16 +184,42 @@ public:
     /// Save active keys and values to a npz file at 'key' and 'value_{:03d}'.
     /// The number of values is stored in 'n_values'.
     /// The file name should end with 'npz', otherwise 'npz' will be added as an
-    /// extension.
+    /// extension. A file name ending with 'o3dhash' is saved in a raw binary
+    /// layout that loads faster.
     void Save(const std::string& file_name);
 
-    /// Load active keys and values from a npz file that contains 'key',
-    /// 'n_values', 'value_{:03d}'.
-    static HashMap Load(const std::string& file_name);
+    /// Load active keys and values from a .o3dhash file, or from a npz file
+    /// that contains 'key', 'n_values', 'value_{:03d}', into a hash map on
+    /// \p device.
+    static HashMap Load(const std::string& file_name,
+                        const Device& device = Device("CPU:0"));
 
     /// Clone the hash map with buffers.
     HashMap Clone() const;
 
+    /// Start recording changes for ExportDelta(). Insert(), Activate(),
+    /// Erase() and Clear() are recorded automatically; values written in
+    /// place through the value buffers must be reported with MarkDirty().
+    /// Copies of the hash map that share its buffers share the record.
+    void EnableDeltaTracking();
+
+    /// Return true if EnableDeltaTracking() has been called.
+    bool IsDeltaTrackingEnabled() const { return change_log_ != nullptr; }
+
+    /// Record that the values at \p buf_indices (Int32 or Int64, as returned
+    /// by Insert() or Find()) have been modified in place.
+    void MarkDirty(const Tensor& buf_indices);
+
+    /// Export the entries changed since the previous export and reset the
+    /// record. The cost is proportional to the number of changes rather than
+    /// to the size of the hash map, so a writer can hand frequent deltas to a
+    /// reader that keeps its own replica up to date with ApplyDelta().
+    HashMapDelta ExportDelta();
+
+    /// Apply a delta exported from a hash map with the same key and value
+    /// types: erase its erased keys, then insert or overwrite its entries.
+    void ApplyDelta(const HashMapDelta& delta);
+
     /// Convert the hash map to another device.
     HashMap To(const Device& device, bool copy = false) const;
 
@@ -226,8 +285,20 @@ protected:
 
     std::pair<int64_t, std::vector<int64_t>> GetCommonValueSizeDivisor();
 
+    /// Return the unique Int64 buffer indices recorded as changed that still
+    /// hold an active entry.
+    Tensor CollectDirtyIndices();
+
 private:
+    /// Changes recorded since the last ExportDelta().
+    struct ChangeLog {
+        std::vector<Tensor> dirty_buf_indices;
+        std::vector<Tensor> erased_keys;
+        int64_t epoch = 0;
+    };
+
     std::shared_ptr<DeviceHashBackend> device_hashmap_;
+    std::shared_ptr<ChangeLog> change_log_;
 
     Dtype key_dtype_;
     SizeVector key_element_shape_;
@@ -98,8 +98,8 @@ void HashSet::Save(const std::string& file_name) {
     t::io::WriteHashMap(file_name, *internal_);
 }
 
-HashSet HashSet::Load(const std::string& file_name) {
-    HashMap internal = t::io::ReadHashMap(file_name);
+HashSet HashSet::Load(const std::string& file_name, const Device& device) {
+    HashMap internal = t::io::ReadHashMap(file_name, device);
     return HashSet(internal);
 }
 
@@ -102,11 +102,14 @@ public:
 
     /// Save active keys to a npz file at 'key'.
     /// The file name should end with 'npz', otherwise 'npz' will be added as an
-    /// extension.
+    /// extension. A file name ending with 'o3dhash' is saved in a raw binary
+    /// layout that loads faster.
     void Save(const std::string& file_name);
 
-    /// Load active keys and values from a npz file that contains 'key'.
-    static HashSet Load(const std::string& file_name);
+    /// Load active keys from a .o3dhash file, or from a npz file that
+    /// contains 'key', into a hash set on \p device.
+    static HashSet Load(const std::string& file_name,
+                        const Device& device = Device("CPU:0"));
 
     /// Clone the hash set with buffers.
     HashSet Clone() const;
@@ -0,0 +1,240 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/PagedHashMap.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+PagedHashMap::PagedHashMap(int64_t device_capacity,
+                           const Dtype& key_dtype,
+                           const SizeVector& key_element_shape,
+                           const std::vector<Dtype>& dtypes_value,
+                           const std::vector<SizeVector>& element_shapes_value,
+                           const Device& device,
+                           const HashBackendType& backend)
+    : device_hashmap_(device_capacity,
+                      key_dtype,
+                      key_element_shape,
+                      dtypes_value,
+                      element_shapes_value,
+                      device,
+                      backend),
+      host_hashmap_(device_capacity,
+                    key_dtype,
+                    key_element_shape,
+                    dtypes_value,
+                    element_shapes_value,
+                    Device("CPU:0")) {
+    if (device_capacity <= 0) {
+        utility::LogError("Device capacity must be positive, but got {}.",
+                          device_capacity);
+    }
+    last_access_ = Tensor::Zeros({device_hashmap_.GetCapacity()}, core::Int64,
+                                 device);
+}
+
+std::pair<Tensor, Tensor> PagedHashMap::Insert(
+        const Tensor& input_keys, const std::vector<Tensor>& input_values_soa) {
+    return InsertImpl(input_keys, input_values_soa, /*is_activate_op=*/false);
+}
+
+std::pair<Tensor, Tensor> PagedHashMap::Activate(const Tensor& input_keys) {
+    return InsertImpl(input_keys, {}, /*is_activate_op=*/true);
+}
+
+std::pair<Tensor, Tensor> PagedHashMap::Find(const Tensor& input_keys) {
+    ++tick_;
+    const Tensor keys = input_keys.To(GetDevice());
+    Tensor buf_indices, masks;
+    device_hashmap_.Find(keys, buf_indices, masks);
+    Touch(buf_indices, masks);
+
+    if (!masks.All()) {
+        PageIn(keys);
+        device_hashmap_.Find(keys, buf_indices, masks);
+    }
+    return std::make_pair(buf_indices, masks);
+}
+
+Tensor PagedHashMap::Erase(const Tensor& input_keys) {
+    const Tensor keys = input_keys.To(GetDevice());
+    Tensor masks;
+    device_hashmap_.Erase(keys, masks);
+    if (HostSize() > 0) {
+        Tensor host_masks;
+        host_hashmap_.Erase(keys.To(host_hashmap_.GetDevice()), host_masks);
+        masks = masks.LogicalOr(host_masks.To(GetDevice()));
+    }
+    return masks;
+}
+
+int64_t PagedHashMap::Evict(int64_t count) {
+    ++tick_;
+    count = std::min(count, DeviceSize());
+    if (count > 0) {
+        EvictLRU(count);
+    }
+    return std::max<int64_t>(count, 0);
+}
+
+std::pair<Tensor, Tensor> PagedHashMap::InsertImpl(
+        const Tensor& input_keys,
+        const std::vector<Tensor>& input_values_soa,
+        bool is_activate_op) {
+    ++tick_;
+    const Tensor keys = input_keys.To(GetDevice());
+
+    // Resident keys of this batch are touched first, so that making room for
+    // the rest never evicts them.
+    Tensor buf_indices, found_masks;
+    device_hashmap_.Find(keys, buf_indices, found_masks);
+    Touch(buf_indices, found_masks);
+    if (!found_masks.All()) {
+        PageIn(keys);
+        device_hashmap_.Find(keys, buf_indices, found_masks);
+    }
+
+    Tensor masks = Tensor::Zeros({keys.GetLength()}, core::Bool, GetDevice());
+    const Tensor missing = found_masks.LogicalNot().NonZero()[0];
+    if (missing.GetLength() == 0) {
+        return std::make_pair(buf_indices, masks);
+    }
+
+    // Duplicates within the batch are counted, which may evict slightly more
+    // than strictly needed.
+    MakeRoom(missing.GetLength());
+    const Tensor missing_keys = keys.IndexGet({missing});
+    Tensor missing_buf_indices, missing_masks;
+    if (is_activate_op) {
+        device_hashmap_.Activate(missing_keys, missing_buf_indices,
+                                 missing_masks);
+    } else {
+        std::vector<Tensor> missing_values_soa;
+        for (const Tensor& input_value : input_values_soa) {
+            missing_values_soa.push_back(
+                    input_value.To(GetDevice()).IndexGet({missing}));
+        }
+        device_hashmap_.Insert(missing_keys, missing_values_soa,
+                               missing_buf_indices, missing_masks);
+    }
+    Touch(missing_buf_indices, missing_masks);
+
+    buf_indices.IndexSet({missing}, missing_buf_indices);
+    masks.IndexSet({missing}, missing_masks);
+    return std::make_pair(buf_indices, masks);
+}
+
+void PagedHashMap::Touch(const Tensor& buf_indices, const Tensor& masks) {
+    const Tensor found = masks.NonZero()[0];
+    if (found.GetLength() == 0) {
+        return;
+    }
+    const Tensor found_buf_indices =
+            buf_indices.IndexGet({found}).To(core::Int64);
+    last_access_.IndexSet({found_buf_indices},
+                          Tensor::Full({found.GetLength()}, tick_, core::Int64,
+                                       GetDevice()));
+}
+
+void PagedHashMap::PageIn(const Tensor& input_keys) {
+    if (HostSize() == 0) {
+        return;
+    }
+
+    const Device host = host_hashmap_.GetDevice();
+    const Tensor host_keys = input_keys.To(host);
+    Tensor host_buf_indices, host_masks;
+    host_hashmap_.Find(host_keys, host_buf_indices, host_masks);
+    const Tensor found = host_masks.NonZero()[0];
+    if (found.GetLength() == 0) {
+        return;
+    }
+
+    const Tensor paged_keys = host_keys.IndexGet({found});
+    const Tensor paged_buf_indices =
+            host_buf_indices.IndexGet({found}).To(core::Int64);
+    std::vector<Tensor> paged_values_soa;
+    for (const Tensor& value_buffer : host_hashmap_.GetValueTensors()) {
+        paged_values_soa.push_back(
+                value_buffer.IndexGet({paged_buf_indices}).To(GetDevice()));
+    }
+    host_hashmap_.Erase(paged_keys);
+
+    MakeRoom(found.GetLength());
+    Tensor buf_indices, masks;
+    device_hashmap_.Insert(paged_keys.To(GetDevice()), paged_values_soa,
+                           buf_indices, masks);
+    Touch(buf_indices, masks);
+}
+
+void PagedHashMap::MakeRoom(int64_t count) {
+    const int64_t capacity = device_hashmap_.GetCapacity();
+    if (count > capacity) {
+        utility::LogError(
+                "Cannot fit {} entries of one operation into a device "
+                "capacity of {}.",
+                count, capacity);
+    }
+    const int64_t excess = DeviceSize() + count - capacity;
+    if (excess > 0) {
+        EvictLRU(excess);
+    }
+}
+
+void PagedHashMap::EvictLRU(int64_t count) {
+    const Tensor active_indices =
+            device_hashmap_.GetActiveIndices().To(core::Int64);
+    const Tensor last_access = last_access_.IndexGet({active_indices});
+    const Tensor order = last_access.Argsort().Slice(0, 0, count);
+    const Tensor victims = active_indices.IndexGet({order});
+    if (last_access.IndexGet({order}).Max({0}).Item<int64_t>() >= tick_) {
+        utility::LogError(
+                "Cannot evict {} entries without evicting entries used by the "
+                "current operation, the device capacity {} is too small.",
+                count, device_hashmap_.GetCapacity());
+    }
+
+    const Device host = host_hashmap_.GetDevice();
+    const Tensor victim_keys =
+            device_hashmap_.GetKeyTensor().IndexGet({victims});
+    std::vector<Tensor> victim_values_soa;
+    for (const Tensor& value_buffer : device_hashmap_.GetValueTensors()) {
+        victim_values_soa.push_back(value_buffer.IndexGet({victims}).To(host));
+    }
+    Tensor buf_indices, masks;
+    host_hashmap_.Insert(victim_keys.To(host), victim_values_soa, buf_indices,
+                         masks);
+    device_hashmap_.Erase(victim_keys);
+    utility::LogDebug("Evicted {} hash map entries to the host.", count);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+
+namespace open3d {
+namespace core {
+
+/// A hash map with a fixed entry budget on its device and an unbounded spill
+/// map in host memory.
+///
+/// When an insertion would exceed the device capacity, the least recently
+/// used entries are evicted to the host map instead of growing the device
+/// buffers. Insert(), Activate() and Find() page the entries of their keys
+/// back in, so their buffer indices always refer to the device map, see
+/// GetDeviceHashMap(). Buffer indices stay valid until the next operation
+/// that pages entries in or out.
+class PagedHashMap {
+public:
+    /// Initialize a paged hash map that keeps at most \p device_capacity
+    /// entries on \p device.
+    PagedHashMap(int64_t device_capacity,
+                 const Dtype& key_dtype,
+                 const SizeVector& key_element_shape,
+                 const std::vector<Dtype>& dtypes_value,
+                 const std::vector<SizeVector>& element_shapes_value,
+                 const Device& device,
+                 const HashBackendType& backend = HashBackendType::Default);
+
+    /// Insert keys and a structure of value arrays. Keys that exist on the
+    /// device or on the host are paged in and left unchanged.
+    /// Return: output_buf_indices into the device map and output_masks, true
+    /// for newly inserted keys.
+    std::pair<Tensor, Tensor> Insert(
+            const Tensor& input_keys,
+            const std::vector<Tensor>& input_values_soa);
+
+    /// Activate keys without values.
+    /// Return: output_buf_indices and output_masks, as in Insert().
+    std::pair<Tensor, Tensor> Activate(const Tensor& input_keys);
+
+    /// Find keys, paging in those that were evicted to the host.
+    /// Return: output_buf_indices into the device map and output_masks.
+    std::pair<Tensor, Tensor> Find(const Tensor& input_keys);
+
+    /// Erase keys from the device and the host.
+    /// Return: output_masks on the device.
+    Tensor Erase(const Tensor& input_keys);
+
+    /// Evict up to \p count least recently used entries to the host.
+    /// Return: the number of evicted entries.
+    int64_t Evict(int64_t count);
+
+    /// Get the total number of entries on the device and the host.
+    int64_t Size() const { return DeviceSize() + HostSize(); }
+
+    /// Get the number of entries resident on the device.
+    int64_t DeviceSize() const { return device_hashmap_.Size(); }
+
+    /// Get the number of entries evicted to the host.
+    int64_t HostSize() const { return host_hashmap_.Size(); }
+
+    /// Get the device.
+    Device GetDevice() const { return device_hashmap_.GetDevice(); }
+
+    /// Get the device map, whose buffers are indexed by returned buf_indices.
+    HashMap& GetDeviceHashMap() { return device_hashmap_; }
+
+    /// Get the host map holding the evicted entries.
+    const HashMap& GetHostHashMap() const { return host_hashmap_; }
+
+protected:
+    /// Mark found entries as used by the current operation.
+    void Touch(const Tensor& buf_indices, const Tensor& masks);
+
+    /// Move the host entries of \p input_keys to the device.
+    void PageIn(const Tensor& input_keys);
+
+    /// Evict entries so that \p count more fit on the device.
+    void MakeRoom(int64_t count);
+
+    /// Evict the \p count least recently used entries, none of which may be
+    /// used by the current operation.
+    void EvictLRU(int64_t count);
+
+    std::pair<Tensor, Tensor> InsertImpl(
+            const Tensor& input_keys,
+            const std::vector<Tensor>& input_values_soa,
+            bool is_activate_op);
+
+private:
+    HashMap device_hashmap_;
+    HashMap host_hashmap_;
+
+    /// Int64 {capacity} tick of the last operation that used each buffer
+    /// index of the device map.
+    Tensor last_access_;
+    int64_t tick_ = 0;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,249 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/ShardedHashMap.h"
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+// Large primes of the spatial hash of Teschner et al., extended to the
+// maximum key dimension supported by the hash backends.
+static const int64_t kShardHashPrimes[] = {73856093, 19349669, 83492791,
+                                           25165843, 50331653, 100663319};
+
+ShardedHashMap::ShardedHashMap(
+        int64_t init_capacity_per_shard,
+        const Dtype& key_dtype,
+        const SizeVector& key_element_shape,
+        const std::vector<Dtype>& dtypes_value,
+        const std::vector<SizeVector>& element_shapes_value,
+        const std::vector<Device>& devices,
+        const HashBackendType& backend)
+    : key_dtype_(key_dtype), key_element_shape_(key_element_shape) {
+    if (devices.empty()) {
+        utility::LogError("At least one device is required, but got 0.");
+    }
+    if (key_element_shape.NumElements() >
+        static_cast<int64_t>(sizeof(kShardHashPrimes) / sizeof(int64_t))) {
+        utility::LogError("Unsupported key element shape {}.",
+                          key_element_shape);
+    }
+    for (const Device& device : devices) {
+        shards_.emplace_back(init_capacity_per_shard, key_dtype,
+                             key_element_shape, dtypes_value,
+                             element_shapes_value, device, backend);
+    }
+}
+
+std::pair<Tensor, Tensor> ShardedHashMap::Insert(
+        const Tensor& input_keys, const std::vector<Tensor>& input_values_soa) {
+    for (const Tensor& input_value : input_values_soa) {
+        if (input_value.GetLength() != input_keys.GetLength()) {
+            utility::LogError(
+                    "Input number of values {} mismatches with number of "
+                    "keys {}.",
+                    input_value.GetLength(), input_keys.GetLength());
+        }
+    }
+    std::vector<Tensor> outputs = RouteAndGather(
+            input_keys, input_values_soa,
+            [](HashMap& shard, const Tensor& keys,
+               const std::vector<Tensor>& values_soa) {
+                Tensor buf_indices, masks;
+                shard.Insert(keys, values_soa, buf_indices, masks);
+                return std::vector<Tensor>{buf_indices, masks};
+            });
+    return std::make_pair(outputs[0], outputs[1]);
+}
+
+std::pair<Tensor, Tensor> ShardedHashMap::Activate(const Tensor& input_keys) {
+    std::vector<Tensor> outputs = RouteAndGather(
+            input_keys, {},
+            [](HashMap& shard, const Tensor& keys,
+               const std::vector<Tensor>&) {
+                Tensor buf_indices, masks;
+                shard.Activate(keys, buf_indices, masks);
+                return std::vector<Tensor>{buf_indices, masks};
+            });
+    return std::make_pair(outputs[0], outputs[1]);
+}
+
+std::pair<Tensor, Tensor> ShardedHashMap::Find(const Tensor& input_keys) {
+    std::vector<Tensor> outputs = RouteAndGather(
+            input_keys, {},
+            [](HashMap& shard, const Tensor& keys,
+               const std::vector<Tensor>&) {
+                Tensor buf_indices, masks;
+                shard.Find(keys, buf_indices, masks);
+                return std::vector<Tensor>{buf_indices, masks};
+            });
+    return std::make_pair(outputs[0], outputs[1]);
+}
+
+std::pair<Tensor, Tensor> ShardedHashMap::FindValues(const Tensor& input_keys,
+                                                     size_t value_index) {
+    std::vector<Tensor> outputs = RouteAndGather(
+            input_keys, {},
+            [value_index](HashMap& shard, const Tensor& keys,
+                          const std::vector<Tensor>&) {
+                std::vector<Tensor> values;
+                Tensor masks;
+                std::tie(values, masks) =
+                        shard.FindAndGather(keys, {value_index});
+                return std::vector<Tensor>{values[0], masks};
+            });
+    return std::make_pair(outputs[0], outputs[1]);
+}
+
+Tensor ShardedHashMap::Erase(const Tensor& input_keys) {
+    std::vector<Tensor> outputs = RouteAndGather(
+            input_keys, {},
+            [](HashMap& shard, const Tensor& keys,
+               const std::vector<Tensor>&) {
+                Tensor masks;
+                shard.Erase(keys, masks);
+                return std::vector<Tensor>{masks};
+            });
+    return outputs[0];
+}
+
+void ShardedHashMap::Clear() {
+    for (HashMap& shard : shards_) {
+        shard.Clear();
+    }
+}
+
+Tensor ShardedHashMap::ComputeShardIndices(const Tensor& input_keys) const {
+    CheckKeys(input_keys);
+    const int64_t n = input_keys.GetLength();
+    const int64_t dim = key_element_shape_.NumElements();
+    const Tensor keys =
+            input_keys.Contiguous().Reshape({n, dim}).To(core::Int64);
+
+    Tensor hash = Tensor::Zeros({n}, core::Int64, input_keys.GetDevice());
+    for (int64_t i = 0; i < dim; ++i) {
+        hash.Add_(keys.Slice(1, i, i + 1).Reshape({n}).Mul(
+                kShardHashPrimes[i]));
+    }
+
+    // Integer division truncates towards zero, so negative remainders are
+    // shifted into [0, num_shards).
+    const int64_t num_shards = GetShardCount();
+    Tensor shard_indices = hash.Sub(hash.Div(num_shards).Mul(num_shards));
+    shard_indices.Add_(shard_indices.Lt(0).To(core::Int64).Mul(num_shards));
+    return shard_indices;
+}
+
+int64_t ShardedHashMap::Size() const {
+    int64_t size = 0;
+    for (const HashMap& shard : shards_) {
+        size += shard.Size();
+    }
+    return size;
+}
+
+HashMap& ShardedHashMap::GetShard(int64_t i) {
+    if (i < 0 || i >= GetShardCount()) {
+        utility::LogError("Shard index {} out of range [0, {}).", i,
+                          GetShardCount());
+    }
+    return shards_[i];
+}
+
+const HashMap& ShardedHashMap::GetShard(int64_t i) const {
+    if (i < 0 || i >= GetShardCount()) {
+        utility::LogError("Shard index {} out of range [0, {}).", i,
+                          GetShardCount());
+    }
+    return shards_[i];
+}
+
+std::vector<Tensor> ShardedHashMap::RouteAndGather(
+        const Tensor& input_keys,
+        const std::vector<Tensor>& input_values_soa,
+        const std::function<std::vector<Tensor>(
+                HashMap& shard,
+                const Tensor& shard_keys,
+                const std::vector<Tensor>& shard_values_soa)>& op) {
+    const Device device = input_keys.GetDevice();
+    const int64_t n = input_keys.GetLength();
+    const Tensor shard_indices = ComputeShardIndices(input_keys);
+
+    std::vector<Tensor> outputs;
+    for (int64_t s = 0; s < GetShardCount(); ++s) {
+        const Tensor positions = shard_indices.Eq(s).NonZero()[0];
+        if (positions.GetLength() == 0) {
+            continue;
+        }
+
+        HashMap& shard = shards_[s];
+        const Tensor shard_keys =
+                input_keys.IndexGet({positions}).To(shard.GetDevice());
+        std::vector<Tensor> shard_values_soa;
+        for (const Tensor& input_value : input_values_soa) {
+            shard_values_soa.push_back(
+                    input_value.IndexGet({positions}).To(shard.GetDevice()));
+        }
+
+        std::vector<Tensor> shard_outputs =
+                op(shard, shard_keys, shard_values_soa);
+        if (outputs.empty()) {
+            for (const Tensor& shard_output : shard_outputs) {
+                SizeVector shape = shard_output.GetShape();
+                shape[0] = n;
+                outputs.push_back(
+                        Tensor::Empty(shape, shard_output.GetDtype(), device));
+            }
+        }
+        for (size_t i = 0; i < shard_outputs.size(); ++i) {
+            outputs[i].IndexSet({positions}, shard_outputs[i].To(device));
+        }
+    }
+    return outputs;
+}
+
+void ShardedHashMap::CheckKeys(const Tensor& input_keys) const {
+    if (input_keys.GetLength() == 0) {
+        utility::LogError("Input number of keys should > 0, but got 0.");
+    }
+    if (input_keys.GetDtype() != key_dtype_) {
+        utility::LogError("Input key dtype {} mismatches with stored {}.",
+                          input_keys.GetDtype().ToString(),
+                          key_dtype_.ToString());
+    }
+    SizeVector key_element_shape = input_keys.GetShape();
+    key_element_shape.erase(key_element_shape.begin());
+    if (key_element_shape.NumElements() != key_element_shape_.NumElements()) {
+        utility::LogError(
+                "Input key element shape {} mismatches with stored {}.",
+                key_element_shape, key_element_shape_);
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
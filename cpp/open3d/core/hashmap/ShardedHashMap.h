@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+
+namespace open3d {
+namespace core {
+
+/// A hash map partitioned across several devices, e.g. all GPUs of a host,
+/// so that the capacity scales with the number of devices.
+///
+/// Each key is routed to a shard by a spatial hash of its elements, which
+/// ComputeShardIndices() exposes. Batched operations take keys on any device,
+/// route them to the shards and gather the per-key results back in input
+/// order on the device of the input keys. Buffer indices refer to the buffers
+/// of the shard the key belongs to, see GetShard().
+class ShardedHashMap {
+public:
+    /// Initialize one hash map shard per device in \p devices. A device may
+    /// appear more than once to split a map on a single device.
+    ShardedHashMap(int64_t init_capacity_per_shard,
+                   const Dtype& key_dtype,
+                   const SizeVector& key_element_shape,
+                   const std::vector<Dtype>& dtypes_value,
+                   const std::vector<SizeVector>& element_shapes_value,
+                   const std::vector<Device>& devices,
+                   const HashBackendType& backend = HashBackendType::Default);
+
+    /// Insert keys and a structure of value arrays.
+    /// Return: output_buf_indices (Int32, per shard) and output_masks, on the
+    /// device of \p input_keys.
+    std::pair<Tensor, Tensor> Insert(
+            const Tensor& input_keys,
+            const std::vector<Tensor>& input_values_soa);
+
+    /// Activate keys without values.
+    /// Return: output_buf_indices and output_masks, as in Insert().
+    std::pair<Tensor, Tensor> Activate(const Tensor& input_keys);
+
+    /// Find keys.
+    /// Return: output_buf_indices and output_masks, as in Insert().
+    std::pair<Tensor, Tensor> Find(const Tensor& input_keys);
+
+    /// Find keys and gather their values from the owning shards.
+    /// Return: the values of the \p value_index-th value array (zero for
+    /// missing keys) and output_masks, on the device of \p input_keys.
+    std::pair<Tensor, Tensor> FindValues(const Tensor& input_keys,
+                                         size_t value_index = 0);
+
+    /// Erase keys.
+    /// Return: output_masks on the device of \p input_keys.
+    Tensor Erase(const Tensor& input_keys);
+
+    /// Clear all shards without reallocating their buffers.
+    void Clear();
+
+    /// Return the Int64 shard index of each key, on the device of
+    /// \p input_keys.
+    Tensor ComputeShardIndices(const Tensor& input_keys) const;
+
+    /// Get the total number of active entries.
+    int64_t Size() const;
+
+    /// Get the number of shards.
+    int64_t GetShardCount() const {
+        return static_cast<int64_t>(shards_.size());
+    }
+
+    /// Get the i-th shard, e.g. to index its buffers with buf_indices.
+    HashMap& GetShard(int64_t i);
+    const HashMap& GetShard(int64_t i) const;
+
+protected:
+    /// Routes \p input_keys and \p input_values_soa to the shards, calls
+    /// \p op on each non-empty part and scatters its outputs back to input
+    /// order on the device of \p input_keys.
+    std::vector<Tensor> RouteAndGather(
+            const Tensor& input_keys,
+            const std::vector<Tensor>& input_values_soa,
+            const std::function<std::vector<Tensor>(
+                    HashMap& shard,
+                    const Tensor& shard_keys,
+                    const std::vector<Tensor>& shard_values_soa)>& op);
+
+    void CheckKeys(const Tensor& input_keys) const;
+
+private:
+    std::vector<HashMap> shards_;
+
+    Dtype key_dtype_;
+    SizeVector key_element_shape_;
+};
+
+}  // namespace core
+}  // namespace open3d
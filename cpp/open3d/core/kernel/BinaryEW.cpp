@@ -30,7 +30,9 @@
 
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/OpProfiler.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
@@ -45,10 +47,16 @@ const std::unordered_set<BinaryEWOpCode, utility::hash_enum_class>
                 BinaryEWOpCode::Ne,
         };
 
+// In the order of BinaryEWOpCode.
+static const char* const s_binary_ew_op_names[] = {
+        "Add", "Sub", "Mul", "Div", "LogicalAnd", "LogicalOr", "LogicalXor",
+        "Gt",  "Lt",  "Ge",  "Le",  "Eq",         "Ne"};
+
 void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
               BinaryEWOpCode op_code) {
+    OPEN3D_PROFILE_ZONE("core", "BinaryEW");
     // lhs, rhs and dst must be on the same device.
     for (auto device :
          std::vector<Device>({rhs.GetDevice(), dst.GetDevice()})) {
@@ -68,6 +76,8 @@ void BinaryEW(const Tensor& lhs,
                 broadcasted_input_shape, dst.GetShape());
     }
 
+    ScopedOpTimer op_timer("BinaryEW", s_binary_ew_op_names[int(op_code)],
+                           lhs.GetDevice(), {&lhs, &rhs}, dst);
     Device::DeviceType device_type = lhs.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         BinaryEWCPU(lhs, rhs, dst, op_code);
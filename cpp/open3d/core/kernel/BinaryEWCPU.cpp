@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Indexer.h"
@@ -70,6 +72,108 @@ static void LaunchBinaryEWKernel(const Indexer& indexer,
             vec_func);
 }
 
+/// Elements per task of the broadcast kernel when rows are long.
+static constexpr int64_t BROADCAST_BLOCK_SIZE = 4096;
+
+/// Applies \p op to \p size elements. A step of 0 repeats the first element
+/// of an input. Each branch is a plain loop the compiler can vectorize.
+template <typename scalar_t, typename op_t>
+static void BroadcastBinaryEWBlock(const scalar_t* lhs,
+                                   bool lhs_step,
+                                   const scalar_t* rhs,
+                                   bool rhs_step,
+                                   scalar_t* dst,
+                                   int64_t size,
+                                   const op_t& op) {
+    if (lhs_step && rhs_step) {
+        for (int64_t i = 0; i < size; ++i) {
+            dst[i] = op(lhs[i], rhs[i]);
+        }
+    } else if (lhs_step) {
+        const scalar_t rhs_val = *rhs;
+        for (int64_t i = 0; i < size; ++i) {
+            dst[i] = op(lhs[i], rhs_val);
+        }
+    } else if (rhs_step) {
+        const scalar_t lhs_val = *lhs;
+        for (int64_t i = 0; i < size; ++i) {
+            dst[i] = op(lhs_val, rhs[i]);
+        }
+    } else {
+        const scalar_t val = op(*lhs, *rhs);
+        for (int64_t i = 0; i < size; ++i) {
+            dst[i] = val;
+        }
+    }
+}
+
+/// Runs \p op with direct indexing if both inputs are contiguous, row-,
+/// column- or scalar-broadcast to a contiguous output. The master shape is
+/// processed as {rows, cols} blocks, so that e.g. (N, 3) + (3,) does not pay
+/// for the generic offset computation of every element.
+///
+/// Returns false without doing anything if the layouts are not supported, or
+/// if both inputs are contiguous and the generic kernel is already optimal.
+template <typename scalar_t, typename op_t>
+static bool TryLaunchBroadcastBinaryEWKernel(const Indexer& indexer,
+                                             const op_t& op) {
+    const BroadcastLayout lhs_layout = indexer.GetInputBroadcastLayout(0);
+    const BroadcastLayout rhs_layout = indexer.GetInputBroadcastLayout(1);
+    if (lhs_layout == BroadcastLayout::General ||
+        rhs_layout == BroadcastLayout::General ||
+        (lhs_layout == BroadcastLayout::Contiguous &&
+         rhs_layout == BroadcastLayout::Contiguous)) {
+        return false;
+    }
+
+    // Contiguous and scalar inputs do not depend on the row structure, so
+    // treat the whole tensor as a single row in that case.
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const bool has_rows = lhs_layout == BroadcastLayout::Row ||
+                          lhs_layout == BroadcastLayout::Column ||
+                          rhs_layout == BroadcastLayout::Row ||
+                          rhs_layout == BroadcastLayout::Column;
+    const int64_t cols = has_rows ? indexer.NumBroadcastCols() : num_workloads;
+    if (cols == 0) {
+        return true;
+    }
+    const int64_t rows = num_workloads / cols;
+    const int64_t blocks_per_row =
+            (cols + BROADCAST_BLOCK_SIZE - 1) / BROADCAST_BLOCK_SIZE;
+
+    // Offset of row r of an input is r * row_stride, elements advance with
+    // the column if step is true.
+    auto row_stride = [cols](BroadcastLayout layout) -> int64_t {
+        return layout == BroadcastLayout::Contiguous
+                       ? cols
+                       : (layout == BroadcastLayout::Column ? 1 : 0);
+    };
+    auto step = [](BroadcastLayout layout) -> bool {
+        return layout == BroadcastLayout::Contiguous ||
+               layout == BroadcastLayout::Row;
+    };
+    const int64_t lhs_row_stride = row_stride(lhs_layout);
+    const int64_t rhs_row_stride = row_stride(rhs_layout);
+    const bool lhs_step = step(lhs_layout);
+    const bool rhs_step = step(rhs_layout);
+    const scalar_t* lhs =
+            static_cast<const scalar_t*>(indexer.GetInput(0).data_ptr_);
+    const scalar_t* rhs =
+            static_cast<const scalar_t*>(indexer.GetInput(1).data_ptr_);
+    scalar_t* dst = static_cast<scalar_t*>(indexer.GetOutput().data_ptr_);
+
+    ParallelFor(Device("CPU:0"), rows * blocks_per_row, [&](int64_t i) {
+        const int64_t r = i / blocks_per_row;
+        const int64_t c = (i % blocks_per_row) * BROADCAST_BLOCK_SIZE;
+        const int64_t size = std::min(BROADCAST_BLOCK_SIZE, cols - c);
+        BroadcastBinaryEWBlock(lhs + r * lhs_row_stride + (lhs_step ? c : 0),
+                               lhs_step,
+                               rhs + r * rhs_row_stride + (rhs_step ? c : 0),
+                               rhs_step, dst + r * cols + c, size, op);
+    });
+    return true;
+}
+
 template <typename scalar_t>
 static void CPUAddElementKernel(const void* lhs, const void* rhs, void* dst) {
     *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) +
@@ -174,7 +278,7 @@ void BinaryEWCPU(const Tensor& lhs,
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 switch (op_code) {
                     case BinaryEWOpCode::LogicalAnd:
                         LaunchBinaryEWKernel<scalar_t, scalar_t>(
@@ -256,7 +360,7 @@ void BinaryEWCPU(const Tensor& lhs,
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 switch (op_code) {
                     case BinaryEWOpCode::LogicalAnd:
                         LaunchBinaryEWKernel<scalar_t, bool>(
@@ -347,34 +451,54 @@ void BinaryEWCPU(const Tensor& lhs,
 #ifdef BUILD_ISPC_MODULE
         ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUAddElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUAddElementKernel,
-                                                       &ispc_indexer));
+                    if (!TryLaunchBroadcastBinaryEWKernel<scalar_t>(
+                                indexer, [](scalar_t a, scalar_t b) {
+                                    return a + b;
+                                })) {
+                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                                indexer, CPUAddElementKernel<scalar_t>,
+                                OPEN3D_TEMPLATE_VECTORIZED(
+                                        scalar_t, CPUAddElementKernel,
+                                        &ispc_indexer));
+                    }
                     break;
                 case BinaryEWOpCode::Sub:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUSubElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUSubElementKernel,
-                                                       &ispc_indexer));
+                    if (!TryLaunchBroadcastBinaryEWKernel<scalar_t>(
+                                indexer, [](scalar_t a, scalar_t b) {
+                                    return a - b;
+                                })) {
+                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                                indexer, CPUSubElementKernel<scalar_t>,
+                                OPEN3D_TEMPLATE_VECTORIZED(
+                                        scalar_t, CPUSubElementKernel,
+                                        &ispc_indexer));
+                    }
                     break;
                 case BinaryEWOpCode::Mul:
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUMulElementKernel<scalar_t>,
-                            OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
-                                                       CPUMulElementKernel,
-                                                       &ispc_indexer));
+                    if (!TryLaunchBroadcastBinaryEWKernel<scalar_t>(
+                                indexer, [](scalar_t a, scalar_t b) {
+                                    return a * b;
+                                })) {
+                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                                indexer, CPUMulElementKernel<scalar_t>,
+                                OPEN3D_TEMPLATE_VECTORIZED(
+                                        scalar_t, CPUMulElementKernel,
+                                        &ispc_indexer));
+                    }
                     break;
                 case BinaryEWOpCode::Div:
                     // The vectorized Div kernel causes a crash in the Python
                     // tests, so use scalar version instead.
-                    LaunchBinaryEWKernel<scalar_t, scalar_t>(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                    if (!TryLaunchBroadcastBinaryEWKernel<scalar_t>(
+                                indexer, [](scalar_t a, scalar_t b) {
+                                    return a / b;
+                                })) {
+                        LaunchBinaryEWKernel<scalar_t, scalar_t>(
+                                indexer, CPUDivElementKernel<scalar_t>);
+                    }
                     break;
                 default:
                     break;
@@ -0,0 +1,175 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+int32_t FusedEWProgram::Append(FusedEWOpCode op_code,
+                               int32_t lhs,
+                               int32_t rhs) {
+    if (num_instructions_ >= MAX_FUSED_EW_INSTRUCTIONS) {
+        utility::LogError("Fused program cannot have more than {} ops.",
+                          MAX_FUSED_EW_INSTRUCTIONS);
+    }
+    FusedEWInstruction& instruction = instructions_[num_instructions_];
+    instruction.op_code_ = op_code;
+    instruction.lhs_ = lhs;
+    instruction.rhs_ = rhs;
+    instruction.scalar_double_ = 0;
+    instruction.scalar_int64_ = 0;
+    return static_cast<int32_t>(num_instructions_++);
+}
+
+int32_t FusedEWProgram::AppendScalar(Scalar value) {
+    int32_t reg = Append(FusedEWOpCode::Scalar);
+    instructions_[reg].scalar_double_ = value.To<double>();
+    instructions_[reg].scalar_int64_ = value.To<int64_t>();
+    return reg;
+}
+
+static void AssertFusedEWArguments(const std::vector<Tensor>& inputs,
+                                   const FusedEWProgram& program,
+                                   const Tensor& dst) {
+    if (inputs.empty()) {
+        utility::LogError("Fused op must have at least one input.");
+    }
+    if (program.NumInstructions() == 0) {
+        utility::LogError("Fused program is empty.");
+    }
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != dst.GetDevice()) {
+            utility::LogError("Source device {} != destination device {}.",
+                              input.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+        if (input.GetDtype() != dst.GetDtype()) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              input.GetDtype().ToString(),
+                              dst.GetDtype().ToString());
+        }
+    }
+    for (int64_t i = 0; i < program.NumInstructions(); ++i) {
+        const FusedEWInstruction& instruction = program.instructions_[i];
+        if (instruction.op_code_ == FusedEWOpCode::Input) {
+            if (instruction.lhs_ < 0 ||
+                instruction.lhs_ >= static_cast<int32_t>(inputs.size())) {
+                utility::LogError("Fused program reads invalid input {}.",
+                                  instruction.lhs_);
+            }
+        } else if (instruction.op_code_ != FusedEWOpCode::Scalar) {
+            // Registers can only be read after they are written.
+            if (instruction.lhs_ < 0 || instruction.lhs_ >= i ||
+                instruction.rhs_ >= i) {
+                utility::LogError("Fused program has invalid operands at {}.",
+                                  i);
+            }
+        }
+    }
+}
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst) {
+    AssertFusedEWArguments(inputs, program, dst);
+    for (const Tensor& input : inputs) {
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} can not be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWCUDA(inputs, program, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+void FusedEWSum(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst,
+                const SizeVector& dims,
+                bool keepdim) {
+    AssertFusedEWArguments(inputs, program, dst);
+
+    // The reduction Indexer requires all inputs to have the same shape, so
+    // broadcast them explicitly. Expand() only changes strides.
+    SizeVector shape = inputs[0].GetShape();
+    for (const Tensor& input : inputs) {
+        shape = shape_util::BroadcastedShape(shape, input.GetShape());
+    }
+    std::vector<Tensor> expanded_inputs;
+    for (const Tensor& input : inputs) {
+        expanded_inputs.push_back(input.Expand(shape));
+    }
+
+    SizeVector keepdim_shape = shape_util::ReductionShape(shape, dims, true);
+    SizeVector expected_shape =
+            shape_util::ReductionShape(shape, dims, keepdim);
+    if (dst.GetShape() != expected_shape) {
+        utility::LogError("Expected output shape {} but got {}.",
+                          expected_shape, dst.GetShape());
+    }
+    Tensor dst_keepdim = dst.Reshape(keepdim_shape);
+
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (dims.size() == 0 || shape.NumElements() == 0) {
+        // Nothing to reduce, or the sum of an empty tensor.
+        dst_keepdim.Fill(0);
+        if (dims.size() == 0) {
+            FusedEW(expanded_inputs, program, dst_keepdim);
+        }
+    } else if (device_type == Device::DeviceType::CPU) {
+        FusedEWSumCPU(expanded_inputs, program, dst_keepdim, dims);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWSumCUDA(expanded_inputs, program, dst_keepdim, dims);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEWSum: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class FusedEWOpCode : int32_t {
+    Input,   // Load the current element of input tensor lhs_.
+    Scalar,  // Load a constant.
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Sqrt,
+    Sin,
+    Cos,
+    Neg,
+    Exp,
+    Abs,
+    Floor,
+    Ceil,
+    Round,
+    Trunc
+};
+
+// Maximum number of instructions of a fused program. The program is captured
+// by value in the kernel, so it must stay small enough for the CUDA kernel
+// parameter space together with the Indexer.
+static constexpr int64_t MAX_FUSED_EW_INSTRUCTIONS = 32;
+
+/// A single instruction of a FusedEWProgram. The result of the i-th
+/// instruction is stored in register i. Unary ops read register lhs_, binary
+/// ops read registers lhs_ and rhs_.
+struct FusedEWInstruction {
+    FusedEWOpCode op_code_;
+    int32_t lhs_;
+    int32_t rhs_;
+    double scalar_double_;
+    int64_t scalar_int64_;
+};
+
+/// Straight-line program of element-wise ops, evaluated once per output
+/// element. The value of the last instruction is the result.
+struct FusedEWProgram {
+    /// Appends an instruction and returns its register index.
+    int32_t Append(FusedEWOpCode op_code, int32_t lhs = -1, int32_t rhs = -1);
+
+    /// Appends a constant load and returns its register index.
+    int32_t AppendScalar(Scalar value);
+
+    int64_t NumInstructions() const { return num_instructions_; }
+
+    int64_t num_instructions_ = 0;
+    FusedEWInstruction instructions_[MAX_FUSED_EW_INSTRUCTIONS];
+};
+
+/// Evaluates \p program for every element of the broadcasted inputs and
+/// writes the result to \p dst in a single pass. All inputs and \p dst must
+/// have the same dtype and device, and inputs must be broadcastable to \p dst.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const FusedEWProgram& program,
+             Tensor& dst);
+
+/// Same as FusedEW, but sums the evaluated values over \p dims without
+/// materializing the intermediate tensor.
+void FusedEWSum(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst,
+                const SizeVector& dims,
+                bool keepdim);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const FusedEWProgram& program,
+                Tensor& dst);
+
+void FusedEWSumCPU(const std::vector<Tensor>& inputs,
+                   const FusedEWProgram& program,
+                   Tensor& dst,
+                   const SizeVector& dims);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 const FusedEWProgram& program,
+                 Tensor& dst);
+
+void FusedEWSumCUDA(const std::vector<Tensor>& inputs,
+                    const FusedEWProgram& program,
+                    Tensor& dst,
+                    const SizeVector& dims);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,343 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#if defined(__CUDACC__)
+#include <cub/cub.cuh>
+#endif
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+#ifndef __CUDACC__
+using std::abs;
+using std::ceil;
+using std::cos;
+using std::exp;
+using std::floor;
+using std::round;
+using std::sin;
+using std::sqrt;
+using std::trunc;
+#endif
+
+/// Evaluates the fused program for a single workload. Register i holds the
+/// value of instruction i, the last register is returned.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE scalar_t EvaluateFusedEWProgram(
+        const FusedEWProgram& program,
+        const Indexer& indexer,
+        int64_t workload_idx) {
+    scalar_t regs[MAX_FUSED_EW_INSTRUCTIONS];
+    for (int64_t i = 0; i < program.num_instructions_; ++i) {
+        const FusedEWInstruction& ins = program.instructions_[i];
+        switch (ins.op_code_) {
+            case FusedEWOpCode::Input:
+                regs[i] = *indexer.GetInputPtr<scalar_t>(ins.lhs_,
+                                                         workload_idx);
+                break;
+            case FusedEWOpCode::Scalar:
+                regs[i] = std::is_floating_point<scalar_t>::value
+                                  ? static_cast<scalar_t>(ins.scalar_double_)
+                                  : static_cast<scalar_t>(ins.scalar_int64_);
+                break;
+            case FusedEWOpCode::Add:
+                regs[i] = regs[ins.lhs_] + regs[ins.rhs_];
+                break;
+            case FusedEWOpCode::Sub:
+                regs[i] = regs[ins.lhs_] - regs[ins.rhs_];
+                break;
+            case FusedEWOpCode::Mul:
+                regs[i] = regs[ins.lhs_] * regs[ins.rhs_];
+                break;
+            case FusedEWOpCode::Div:
+                regs[i] = regs[ins.lhs_] / regs[ins.rhs_];
+                break;
+            case FusedEWOpCode::Sqrt:
+                regs[i] = static_cast<scalar_t>(sqrt(regs[ins.lhs_]));
+                break;
+            case FusedEWOpCode::Sin:
+                regs[i] = static_cast<scalar_t>(sin(regs[ins.lhs_]));
+                break;
+            case FusedEWOpCode::Cos:
+                regs[i] = static_cast<scalar_t>(cos(regs[ins.lhs_]));
+                break;
+            case FusedEWOpCode::Neg:
+                regs[i] = static_cast<scalar_t>(-regs[ins.lhs_]);
+                break;
+            case FusedEWOpCode::Exp:
+                regs[i] = static_cast<scalar_t>(exp(regs[ins.lhs_]));
+                break;
+            case FusedEWOpCode::Abs:
+                regs[i] = static_cast<scalar_t>(
+                        abs(static_cast<double>(regs[ins.lhs_])));
+                break;
+            case FusedEWOpCode::Floor:
+                regs[i] = static_cast<scalar_t>(
+                        floor(static_cast<double>(regs[ins.lhs_])));
+                break;
+            case FusedEWOpCode::Ceil:
+                regs[i] = static_cast<scalar_t>(
+                        ceil(static_cast<double>(regs[ins.lhs_])));
+                break;
+            case FusedEWOpCode::Round:
+                regs[i] = static_cast<scalar_t>(
+                        round(static_cast<double>(regs[ins.lhs_])));
+                break;
+            case FusedEWOpCode::Trunc:
+                regs[i] = static_cast<scalar_t>(
+                        trunc(static_cast<double>(regs[ins.lhs_])));
+                break;
+            default:
+                regs[i] = 0;
+                break;
+        }
+    }
+    return regs[program.num_instructions_ - 1];
+}
+
+#if defined(__CUDACC__)
+/// Unsupported dtypes are rejected on the host before launching the kernel.
+template <typename scalar_t>
+OPEN3D_DEVICE inline void FusedEWAtomicAdd(scalar_t* address,
+                                           scalar_t value) {}
+
+OPEN3D_DEVICE inline void FusedEWAtomicAdd(float* address, float value) {
+    atomicAdd(address, value);
+}
+
+OPEN3D_DEVICE inline void FusedEWAtomicAdd(double* address, double value) {
+    atomicAdd(address, value);
+}
+
+OPEN3D_DEVICE inline void FusedEWAtomicAdd(int32_t* address, int32_t value) {
+    atomicAdd(address, value);
+}
+
+OPEN3D_DEVICE inline void FusedEWAtomicAdd(uint32_t* address,
+                                           uint32_t value) {
+    atomicAdd(address, value);
+}
+
+// Two's complement addition is sign agnostic.
+OPEN3D_DEVICE inline void FusedEWAtomicAdd(int64_t* address, int64_t value) {
+    atomicAdd(reinterpret_cast<unsigned long long*>(address),
+              static_cast<unsigned long long>(value));
+}
+
+OPEN3D_DEVICE inline void FusedEWAtomicAdd(uint64_t* address,
+                                           uint64_t value) {
+    atomicAdd(reinterpret_cast<unsigned long long*>(address),
+              static_cast<unsigned long long>(value));
+}
+
+static constexpr int FUSED_EW_SUM_BLOCK_SIZE = 256;
+static constexpr int64_t FUSED_EW_SUM_MAX_GRID_SIZE = 1024;
+
+/// Sums all workloads into a single output element. Each thread accumulates a
+/// strided range of workloads, each block reduces its threads in shared
+/// memory and only the block sums are added atomically.
+template <typename scalar_t>
+__global__ void FusedEWFullSumCUDAKernel(FusedEWProgram program,
+                                         Indexer indexer,
+                                         scalar_t* dst_ptr) {
+    typedef cub::BlockReduce<scalar_t, FUSED_EW_SUM_BLOCK_SIZE> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t stride = int64_t(blockDim.x) * gridDim.x;
+    scalar_t acc = 0;
+    for (int64_t workload_idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+         workload_idx < num_workloads; workload_idx += stride) {
+        acc += EvaluateFusedEWProgram<scalar_t>(program, indexer, workload_idx);
+    }
+    const scalar_t block_sum = BlockReduce(temp_storage).Sum(acc);
+    if (threadIdx.x == 0) {
+        FusedEWAtomicAdd(dst_ptr, block_sum);
+    }
+}
+#endif
+
+#if defined(__CUDACC__)
+void FusedEWCUDA
+#else
+void FusedEWCPU
+#endif
+        (const std::vector<Tensor>& inputs,
+         const FusedEWProgram& program,
+         Tensor& dst) {
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        ParallelFor(dst.GetDevice(), indexer.NumWorkloads(),
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        *indexer.GetOutputPtr<scalar_t>(workload_idx) =
+                                EvaluateFusedEWProgram<scalar_t>(
+                                        program, indexer, workload_idx);
+                    });
+    });
+}
+
+#ifndef __CUDACC__
+template <typename scalar_t>
+static void FusedEWSumSerialCPU(const FusedEWProgram& program,
+                                const Indexer& indexer) {
+    for (int64_t workload_idx = 0; workload_idx < indexer.NumWorkloads();
+         ++workload_idx) {
+        *indexer.GetOutputPtr<scalar_t>(workload_idx) +=
+                EvaluateFusedEWProgram<scalar_t>(program, indexer,
+                                                 workload_idx);
+    }
+}
+
+/// Follows the strategy of CPUReductionEngine: a two-pass reduction for a
+/// single output, otherwise parallelize over a non-reduction dimension such
+/// that no two threads write to the same output element.
+template <typename scalar_t>
+static void FusedEWSumCPUKernel(const FusedEWProgram& program,
+                                const Indexer& indexer) {
+    const int64_t num_threads = utility::EstimateMaxThreads();
+    if (num_threads == 1 || utility::InParallel()) {
+        FusedEWSumSerialCPU<scalar_t>(program, indexer);
+    } else if (indexer.NumOutputElements() <= 1) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        const int64_t workload_per_thread =
+                (num_workloads + num_threads - 1) / num_threads;
+        std::vector<scalar_t> thread_results(num_threads, 0);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            int64_t start = thread_idx * workload_per_thread;
+            int64_t end = std::min(start + workload_per_thread, num_workloads);
+            scalar_t acc = 0;
+            for (int64_t workload_idx = start; workload_idx < end;
+                 ++workload_idx) {
+                acc += EvaluateFusedEWProgram<scalar_t>(program, indexer,
+                                                        workload_idx);
+            }
+            thread_results[thread_idx] = acc;
+        }
+        scalar_t* dst_ptr = indexer.GetOutputPtr<scalar_t>(0);
+        for (const scalar_t& thread_result : thread_results) {
+            *dst_ptr += thread_result;
+        }
+    } else {
+        const int64_t* indexer_shape = indexer.GetMasterShape();
+        int64_t best_dim = indexer.NumDims() - 1;
+        while (best_dim >= 0 && indexer.IsReductionDim(best_dim)) {
+            best_dim--;
+        }
+        for (int64_t dim = best_dim; dim >= 0 && !indexer.IsReductionDim(dim);
+             --dim) {
+            if (indexer_shape[dim] >= num_threads) {
+                best_dim = dim;
+                break;
+            } else if (indexer_shape[dim] > indexer_shape[best_dim]) {
+                best_dim = dim;
+            }
+        }
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
+            Indexer sub_indexer(indexer);
+            sub_indexer.ShrinkDim(best_dim, i, 1);
+            FusedEWSumSerialCPU<scalar_t>(program, sub_indexer);
+        }
+    }
+}
+#endif
+
+#if defined(__CUDACC__)
+void FusedEWSumCUDA
+#else
+void FusedEWSumCPU
+#endif
+        (const std::vector<Tensor>& inputs,
+         const FusedEWProgram& program,
+         Tensor& dst,
+         const SizeVector& dims) {
+    dst.Fill(0);
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME, dims);
+
+#if defined(__CUDACC__)
+    // A full reduction is reduced per block first. Otherwise each workload
+    // accumulates its value into its output element atomically, the
+    // contention being spread over the output elements.
+    const Dtype dtype = dst.GetDtype();
+    if (dtype != Float32 && dtype != Float64 && dtype != Int32 &&
+        dtype != UInt32 && dtype != Int64 && dtype != UInt64) {
+        utility::LogError("Fused CUDA sum does not support dtype {}.",
+                          dtype.ToString());
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        if (indexer.NumOutputElements() <= 1) {
+            const int64_t num_workloads = indexer.NumWorkloads();
+            if (num_workloads == 0) {
+                return;
+            }
+            CountKernelLaunch(dst.GetDevice());
+            CUDAScopedDevice scoped_device(dst.GetDevice());
+            const int64_t grid_size =
+                    std::min((num_workloads + FUSED_EW_SUM_BLOCK_SIZE - 1) /
+                                     FUSED_EW_SUM_BLOCK_SIZE,
+                             FUSED_EW_SUM_MAX_GRID_SIZE);
+            FusedEWFullSumCUDAKernel<scalar_t>
+                    <<<grid_size, FUSED_EW_SUM_BLOCK_SIZE, 0,
+                       core::cuda::GetStream()>>>(
+                            program, indexer, dst.GetDataPtr<scalar_t>());
+            OPEN3D_GET_LAST_CUDA_ERROR("FusedEWSum failed.");
+        } else {
+            ParallelFor(dst.GetDevice(), indexer.NumWorkloads(),
+                        [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            FusedEWAtomicAdd(indexer.GetOutputPtr<scalar_t>(
+                                                     workload_idx),
+                                             EvaluateFusedEWProgram<scalar_t>(
+                                                     program, indexer,
+                                                     workload_idx));
+                        });
+        }
+    });
+#else
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        FusedEWSumCPUKernel<scalar_t>(program, indexer);
+    });
+#endif
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
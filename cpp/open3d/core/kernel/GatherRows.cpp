@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/GatherRows.h"
+
+#include <algorithm>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+std::vector<Tensor> GatherRows(const std::vector<Tensor>& srcs,
+                               const Tensor& index) {
+    const Device device = index.GetDevice();
+    AssertTensorDtype(index, core::Int64);
+    if (index.NumDims() != 1) {
+        utility::LogError("Index must be a 1-D tensor, but got shape {}.",
+                          index.GetShape());
+    }
+    if (srcs.empty()) {
+        return {};
+    }
+
+    const int64_t num_rows = index.GetLength();
+    int64_t min_length = srcs[0].NumDims() > 0 ? srcs[0].GetLength() : 0;
+    std::vector<Tensor> srcs_contiguous;
+    std::vector<Tensor> dsts;
+    for (const Tensor& src : srcs) {
+        AssertTensorDevice(src, device);
+        if (src.NumDims() == 0) {
+            utility::LogError("GatherRows does not support 0-D tensors.");
+        }
+        min_length = std::min(min_length, src.GetLength());
+        srcs_contiguous.push_back(src.Contiguous());
+        SizeVector dst_shape = src.GetShape();
+        dst_shape[0] = num_rows;
+        dsts.emplace_back(dst_shape, src.GetDtype(), device);
+    }
+    if (num_rows == 0) {
+        return dsts;
+    }
+    if (index.Min({0}).Item<int64_t>() < 0 ||
+        index.Max({0}).Item<int64_t>() >= min_length) {
+        utility::LogError("Index out of range for tensors of length {}.",
+                          min_length);
+    }
+
+    const Tensor index_contiguous = index.Contiguous();
+    if (device.GetType() == Device::DeviceType::CPU) {
+        GatherRowsCPU(srcs_contiguous, index_contiguous, dsts);
+    } else if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        GatherRowsCUDA(srcs_contiguous, index_contiguous, dsts);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("GatherRows: Unimplemented device");
+    }
+    return dsts;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
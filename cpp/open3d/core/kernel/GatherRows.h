@@ -0,0 +1,64 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Gathers rows of several tensors with a single kernel launch, i.e.
+/// dsts[t][i] = srcs[t][index[i]] for every tensor t. Replaces one IndexGet
+/// per tensor, e.g. per attribute of a geometry, when the tensors are indexed
+/// with the same index.
+///
+/// \param srcs Tensors with at least one dimension on the device of \p index.
+/// Their lengths, dtypes and element shapes may differ.
+/// \param index Int64 1-D tensor with values in [0, srcs[t].GetLength()) for
+/// every t.
+/// \return The gathered tensors, with shapes {index.GetLength(), ...}.
+std::vector<Tensor> GatherRows(const std::vector<Tensor>& srcs,
+                               const Tensor& index);
+
+/// Gathers the rows of the contiguous \p srcs into the contiguous \p dsts.
+void GatherRowsCPU(const std::vector<Tensor>& srcs,
+                   const Tensor& index,
+                   std::vector<Tensor>& dsts);
+
+#ifdef BUILD_CUDA_MODULE
+void GatherRowsCUDA(const std::vector<Tensor>& srcs,
+                    const Tensor& index,
+                    std::vector<Tensor>& dsts);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/GatherRows.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Copies the rows of all tensors in units of unit_t. \p table holds the
+/// source pointers, the destination pointers and the prefix sum of the number
+/// of units per row, i.e. 3 * num_tensors + 1 values.
+template <typename unit_t>
+static void GatherRowUnits(const Device& device,
+                           int64_t num_rows,
+                           int64_t num_tensors,
+                           int64_t units_per_row,
+                           const int64_t* table_ptr,
+                           const int64_t* index_ptr) {
+    // One workload per unit of the concatenated output rows, so consecutive
+    // workloads copy consecutive memory of one tensor.
+    ParallelFor(device, num_rows * units_per_row,
+                [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                    const int64_t i = workload_idx / units_per_row;
+                    const int64_t u = workload_idx % units_per_row;
+                    const int64_t* offsets = table_ptr + 2 * num_tensors;
+                    int64_t t = 0;
+                    while (u >= offsets[t + 1]) {
+                        ++t;
+                    }
+                    const int64_t row_units = offsets[t + 1] - offsets[t];
+                    const int64_t k = u - offsets[t];
+                    const unit_t* src =
+                            reinterpret_cast<const unit_t*>(table_ptr[t]);
+                    unit_t* dst = reinterpret_cast<unit_t*>(
+                            table_ptr[num_tensors + t]);
+                    dst[i * row_units + k] =
+                            src[index_ptr[i] * row_units + k];
+                });
+}
+
+#if defined(__CUDACC__)
+void GatherRowsCUDA
+#else
+void GatherRowsCPU
+#endif
+        (const std::vector<Tensor>& srcs,
+         const Tensor& index,
+         std::vector<Tensor>& dsts) {
+    const Device device = index.GetDevice();
+    const int64_t num_tensors = static_cast<int64_t>(srcs.size());
+    const int64_t num_rows = index.GetLength();
+
+    // Copy in the widest unit that divides all row sizes and keeps all
+    // pointers aligned.
+    std::vector<int64_t> row_bytes(num_tensors);
+    int64_t unit = 8;
+    for (int64_t t = 0; t < num_tensors; ++t) {
+        row_bytes[t] = srcs[t].GetDtype().ByteSize();
+        for (int64_t d = 1; d < srcs[t].NumDims(); ++d) {
+            row_bytes[t] *= srcs[t].GetShape(d);
+        }
+        const uintptr_t src_addr =
+                reinterpret_cast<uintptr_t>(srcs[t].GetDataPtr());
+        const uintptr_t dst_addr =
+                reinterpret_cast<uintptr_t>(dsts[t].GetDataPtr());
+        while (unit > 1 && (row_bytes[t] % unit != 0 || src_addr % unit != 0 ||
+                            dst_addr % unit != 0)) {
+            unit /= 2;
+        }
+    }
+
+    Tensor table({3 * num_tensors + 1}, core::Int64, Device("CPU:0"));
+    int64_t* table_ptr = table.GetDataPtr<int64_t>();
+    table_ptr[2 * num_tensors] = 0;
+    for (int64_t t = 0; t < num_tensors; ++t) {
+        table_ptr[t] = reinterpret_cast<int64_t>(srcs[t].GetDataPtr());
+        table_ptr[num_tensors + t] =
+                reinterpret_cast<int64_t>(dsts[t].GetDataPtr());
+        table_ptr[2 * num_tensors + t + 1] =
+                table_ptr[2 * num_tensors + t] + row_bytes[t] / unit;
+    }
+    const int64_t units_per_row = table_ptr[3 * num_tensors];
+    if (units_per_row == 0) {
+        return;
+    }
+    table = table.To(device);
+
+#if defined(__CUDACC__)
+    CUDAScopedDevice scoped_device(device);
+#endif
+    const int64_t* device_table_ptr = table.GetDataPtr<int64_t>();
+    const int64_t* index_ptr = index.GetDataPtr<int64_t>();
+    switch (unit) {
+        case 8:
+            GatherRowUnits<uint64_t>(device, num_rows, num_tensors,
+                                     units_per_row, device_table_ptr,
+                                     index_ptr);
+            break;
+        case 4:
+            GatherRowUnits<uint32_t>(device, num_rows, num_tensors,
+                                     units_per_row, device_table_ptr,
+                                     index_ptr);
+            break;
+        case 2:
+            GatherRowUnits<uint16_t>(device, num_rows, num_tensors,
+                                     units_per_row, device_table_ptr,
+                                     index_ptr);
+            break;
+        default:
+            GatherRowUnits<uint8_t>(device, num_rows, num_tensors,
+                                    units_per_row, device_table_ptr,
+                                    index_ptr);
+            break;
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/OpProfiler.h"
 #include "open3d/core/kernel/UnaryEW.h"
 #include "open3d/utility/Logging.h"
 
@@ -52,6 +53,8 @@ void IndexGet(const Tensor& src,
         return;
     }
 
+    ScopedOpTimer op_timer("IndexGet", nullptr, src.GetDevice(), {&src}, dst);
+    op_timer.AddInputs(index_tensors);
     if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexGetCPU(src, dst, index_tensors, indexed_shape, indexed_strides);
     } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
@@ -72,6 +75,10 @@ void IndexSet(const Tensor& src,
     // however, src may be on a different device.
     Tensor src_same_device = src.To(dst.GetDevice());
 
+    ScopedOpTimer op_timer("IndexSet", nullptr, dst.GetDevice(),
+                           {&src_same_device}, dst);
+    op_timer.AddInputs(index_tensors);
+
     if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
         IndexSetCPU(src_same_device, dst, index_tensors, indexed_shape,
                     indexed_strides);
@@ -0,0 +1,186 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/core/kernel/IndexReduction.h"
+
+#include <limits>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static void IndexReductionDevice(const Tensor& index,
+                                 const Tensor& src,
+                                 Tensor& dst,
+                                 int64_t dim,
+                                 IndexReductionOpCode op_code) {
+    Device::DeviceType device_type = dst.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        IndexReductionCPU(index, src, dst, dim, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexReductionCUDA(index, src, dst, dim, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("IndexReduction: Unimplemented device");
+    }
+}
+
+void IndexReduction(int64_t dim,
+                    const Tensor& index,
+                    const Tensor& src,
+                    Tensor& dst,
+                    IndexReductionOpCode op_code,
+                    bool include_self,
+                    bool deterministic) {
+    const Device device = dst.GetDevice();
+    const Dtype dtype = dst.GetDtype();
+    AssertTensorDevice(index, device);
+    AssertTensorDevice(src, device);
+    AssertTensorDtype(index, core::Int64);
+    AssertTensorDtype(src, dtype);
+    if (dst.NumDims() == 0) {
+        utility::LogError("Index reduction does not support 0-D tensors.");
+    }
+    dim = shape_util::WrapDim(dim, dst.NumDims());
+    if (index.NumDims() != 1) {
+        utility::LogError("Index must be a 1-D tensor, but got shape {}.",
+                          index.GetShape());
+    }
+    SizeVector expected_src_shape = dst.GetShape();
+    expected_src_shape[dim] = index.GetLength();
+    if (src.GetShape() != expected_src_shape) {
+        utility::LogError("Expected src of shape {}, but got shape {}.",
+                          expected_src_shape, src.GetShape());
+    }
+    const int64_t dim_size = dst.GetShape(dim);
+    const int64_t index_len = index.GetLength();
+    if (index_len == 0) {
+        return;
+    }
+    if (index.Min({0}).Item<int64_t>() < 0 ||
+        index.Max({0}).Item<int64_t>() >= dim_size) {
+        utility::LogError("Index out of range for dimension {} of size {}.",
+                          dim, dim_size);
+    }
+
+    // The reduction runs on the contiguous layout; dims_to_front moves dim to
+    // the first dimension where row-wise ops such as IndexSet apply.
+    Tensor dst_contiguous = dst.Contiguous();
+    const Tensor index_contiguous = index.Contiguous();
+    SizeVector dims_to_front{dim};
+    SizeVector dims_from_front(dst.NumDims());
+    for (int64_t d = 0; d < dst.NumDims(); ++d) {
+        if (d != dim) {
+            dims_to_front.push_back(d);
+        }
+    }
+    for (int64_t d = 0; d < dst.NumDims(); ++d) {
+        dims_from_front[dims_to_front[d]] = d;
+    }
+
+    if (!include_self) {
+        SizeVector fill_shape;
+        for (int64_t d : dims_to_front) {
+            fill_shape.push_back(src.GetShape(d));
+        }
+        Tensor fill;
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
+            scalar_t identity = scalar_t(0);
+            if (op_code == IndexReductionOpCode::Max) {
+                identity = std::numeric_limits<scalar_t>::lowest();
+            } else if (op_code == IndexReductionOpCode::Min) {
+                identity = std::numeric_limits<scalar_t>::max();
+            }
+            fill = Tensor::Full(fill_shape, identity, dtype, device);
+        });
+        dst_contiguous.Permute(dims_to_front).IndexSet({index_contiguous},
+                                                       fill);
+    }
+
+    if (deterministic) {
+        // Group equal indices with a stable sort and reduce each group in
+        // order. The groups then scatter to distinct positions, where the
+        // order of the atomic updates no longer matters.
+        const Tensor perm = Argsort(index_contiguous);
+        const Tensor sorted = index_contiguous.IndexGet({perm});
+        Tensor group_ids;
+        Tensor splits;
+        SortedGroups(sorted, group_ids, splits);
+        const Tensor unique =
+                sorted.IndexGet({splits.Slice(0, 0, splits.GetLength() - 1)});
+        SegmentReductionOpCode segment_op_code = SegmentReductionOpCode::Sum;
+        if (op_code == IndexReductionOpCode::Max) {
+            segment_op_code = SegmentReductionOpCode::Max;
+        } else if (op_code == IndexReductionOpCode::Min) {
+            segment_op_code = SegmentReductionOpCode::Min;
+        }
+        const Tensor reduced = SegmentReduction(
+                src.Permute(dims_to_front).IndexGet({perm}), splits,
+                segment_op_code);
+        IndexReductionDevice(unique,
+                             reduced.Permute(dims_from_front).Contiguous(),
+                             dst_contiguous, dim, op_code);
+    } else {
+        IndexReductionDevice(index_contiguous, src.Contiguous(), dst_contiguous,
+                             dim, op_code);
+    }
+
+    if (op_code == IndexReductionOpCode::Mean) {
+        // Integer counts are exact in any order.
+        Tensor counts = Tensor::Zeros({dim_size}, core::Int64, device);
+        IndexReductionDevice(index_contiguous,
+                             Tensor::Ones({index_len}, core::Int64, device),
+                             counts, 0, IndexReductionOpCode::Sum);
+        if (include_self) {
+            counts.Add_(1);
+        }
+        SizeVector counts_shape(dst.NumDims(), 1);
+        counts_shape[dim] = dim_size;
+        // Positions without any index keep their value.
+        dst_contiguous.Div_(counts.Clip_(1, std::numeric_limits<int64_t>::max())
+                                    .To(dtype)
+                                    .Reshape(counts_shape));
+    }
+
+    if (!dst.IsContiguous()) {
+        dst.AsRvalue() = dst_contiguous;
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class IndexReductionOpCode { Sum, Mean, Max, Min };
+
+/// Reduces slices of \p src into \p dst along \p dim at the positions given
+/// by \p index, i.e. dst[..., index[i], ...] = op(dst[..., index[i], ...],
+/// src[..., i, ...]). Repeated indices are all reduced into the same slice.
+///
+/// \param dim The dimension to index along.
+/// \param index Int64 1-D tensor with values in [0, dst.GetShape(dim)).
+/// \param src Tensor with the dtype of \p dst and the same shape, except that
+/// its size along \p dim equals the length of \p index.
+/// \param dst The tensor reduced into in place.
+/// \param op_code The reduction. Mean divides by the number of values reduced
+/// into each slice.
+/// \param include_self If false, the values of \p dst at indexed positions are
+/// ignored and replaced by the reduction of \p src alone.
+/// \param deterministic If true, the repeated indices are grouped with a
+/// stable sort and reduced in a fixed order instead of with atomics, so
+/// floating point results are reproducible across runs.
+void IndexReduction(int64_t dim,
+                    const Tensor& index,
+                    const Tensor& src,
+                    Tensor& dst,
+                    IndexReductionOpCode op_code,
+                    bool include_self,
+                    bool deterministic);
+
+/// Atomically reduces \p src into the contiguous \p dst along \p dim. Mean is
+/// treated as Sum, the division is done by IndexReduction().
+void IndexReductionCPU(const Tensor& index,
+                       const Tensor& src,
+                       Tensor& dst,
+                       int64_t dim,
+                       IndexReductionOpCode op_code);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexReductionCUDA(const Tensor& index,
+                        const Tensor& src,
+                        Tensor& dst,
+                        int64_t dim,
+                        IndexReductionOpCode op_code);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
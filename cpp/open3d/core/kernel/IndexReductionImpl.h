@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/core/Atomic.h"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/IndexReduction.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+#if defined(__CUDACC__)
+void IndexReductionCUDA
+#else
+void IndexReductionCPU
+#endif
+        (const Tensor& index,
+         const Tensor& src,
+         Tensor& dst,
+         int64_t dim,
+         IndexReductionOpCode op_code) {
+    if (src.NumElements() == 0) {
+        return;
+    }
+    // src is viewed as {outer, index_len, inner} and dst as
+    // {outer, dim_size, inner}.
+    int64_t inner = 1;
+    for (int64_t d = dim + 1; d < dst.NumDims(); ++d) {
+        inner *= dst.GetShape(d);
+    }
+    const int64_t index_len = index.GetLength();
+    const int64_t dim_size = dst.GetShape(dim);
+
+#if defined(__CUDACC__)
+    CUDAScopedDevice scoped_device(src.GetDevice());
+#endif
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src.GetDtype(), [&]() {
+        const int64_t* index_ptr = index.GetDataPtr<int64_t>();
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+
+        // One workload per src element. Workloads that share an index write
+        // the same dst element, hence the atomics.
+        ParallelFor(
+                src.GetDevice(), src.NumElements(),
+                [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                    const int64_t k = workload_idx % inner;
+                    const int64_t i = (workload_idx / inner) % index_len;
+                    const int64_t o = workload_idx / (inner * index_len);
+                    scalar_t* dst_elem =
+                            dst_ptr + (o * dim_size + index_ptr[i]) * inner + k;
+                    const scalar_t val = src_ptr[workload_idx];
+                    switch (op_code) {
+                        case IndexReductionOpCode::Sum:
+                        case IndexReductionOpCode::Mean:
+                            AtomicAddRelaxed(dst_elem, val);
+                            break;
+                        case IndexReductionOpCode::Max:
+                            AtomicMaxRelaxed(dst_elem, val);
+                            break;
+                        case IndexReductionOpCode::Min:
+                            AtomicMinRelaxed(dst_elem, val);
+                            break;
+                    }
+                });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -29,6 +29,7 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/zip_iterator.h>
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/kernel/NonZero.h"
 
@@ -89,7 +90,8 @@ Tensor NonZeroCUDA(const Tensor& src) {
         thrust::device_ptr<const scalar_t> src_ptr(static_cast<const scalar_t*>(
                 src_contiguous.GetBlob()->GetDataPtr()));
 
-        auto it = thrust::copy_if(index_first, index_last, src_ptr,
+        auto it = thrust::copy_if(thrust::cuda::par.on(cuda::GetStream()),
+                                  index_first, index_last, src_ptr,
                                   non_zero_indices.begin(),
                                   NonZeroFunctor<scalar_t>());
         non_zero_indices.resize(thrust::distance(non_zero_indices.begin(), it));
@@ -105,7 +107,7 @@ Tensor NonZeroCUDA(const Tensor& src) {
     TensorIterator result_iter(result);
 
     index_last = index_first + num_non_zeros;
-    thrust::for_each(thrust::device,
+    thrust::for_each(thrust::cuda::par.on(cuda::GetStream()),
                      thrust::make_zip_iterator(thrust::make_tuple(
                              index_first, non_zero_indices.begin())),
                      thrust::make_zip_iterator(thrust::make_tuple(
@@ -0,0 +1,225 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/OpProfiler.h"
+
+#include <algorithm>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+OpProfiler& OpProfiler::GetInstance() {
+    static OpProfiler instance;
+    return instance;
+}
+
+void OpProfiler::SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void OpProfiler::Record(const std::string& op,
+                        const std::string& dtype,
+                        const std::string& device,
+                        const std::string& shapes,
+                        double elapsed_ms,
+                        int64_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    OpStatistics& stats =
+            statistics_[std::make_tuple(op, dtype, device, shapes)];
+    if (stats.count_ == 0) {
+        stats.op_ = op;
+        stats.dtype_ = dtype;
+        stats.device_ = device;
+        stats.shapes_ = shapes;
+    }
+    stats.count_++;
+    stats.total_ms_ += elapsed_ms;
+    stats.max_ms_ = std::max(stats.max_ms_, elapsed_ms);
+    stats.bytes_ += bytes;
+}
+
+std::vector<OpStatistics> OpProfiler::GetStatistics(
+        bool group_by_shape) const {
+    std::vector<OpStatistics> result;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (group_by_shape) {
+            for (const auto& kv : statistics_) {
+                result.push_back(kv.second);
+            }
+        } else {
+            std::map<std::tuple<std::string, std::string, std::string>,
+                     OpStatistics>
+                    merged;
+            for (const auto& kv : statistics_) {
+                const OpStatistics& stats = kv.second;
+                OpStatistics& dst = merged[std::make_tuple(
+                        stats.op_, stats.dtype_, stats.device_)];
+                if (dst.count_ == 0) {
+                    dst.op_ = stats.op_;
+                    dst.dtype_ = stats.dtype_;
+                    dst.device_ = stats.device_;
+                }
+                dst.count_ += stats.count_;
+                dst.total_ms_ += stats.total_ms_;
+                dst.max_ms_ = std::max(dst.max_ms_, stats.max_ms_);
+                dst.bytes_ += stats.bytes_;
+            }
+            for (const auto& kv : merged) {
+                result.push_back(kv.second);
+            }
+        }
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const OpStatistics& a, const OpStatistics& b) {
+                         return a.total_ms_ > b.total_ms_;
+                     });
+    return result;
+}
+
+std::string OpProfiler::ToString(bool group_by_shape, int max_rows) const {
+    std::vector<OpStatistics> statistics = GetStatistics(group_by_shape);
+    if (max_rows > 0 && int(statistics.size()) > max_rows) {
+        statistics.resize(max_rows);
+    }
+    std::string table = fmt::format(
+            "{:<24} {:<8} {:<8} {:>8} {:>12} {:>10} {:>10} {:>12} {:>8}",
+            "Op", "Dtype", "Device", "Calls", "Total (ms)", "Mean (ms)",
+            "Max (ms)", "Bytes", "GB/s");
+    if (group_by_shape) {
+        table += "  Shapes";
+    }
+    table += "\n";
+    for (const OpStatistics& stats : statistics) {
+        table += fmt::format(
+                "{:<24} {:<8} {:<8} {:>8} {:>12.3f} {:>10.4f} {:>10.4f} "
+                "{:>12} {:>8.2f}",
+                stats.op_, stats.dtype_, stats.device_, stats.count_,
+                stats.total_ms_, stats.GetMeanMs(), stats.max_ms_,
+                stats.bytes_, stats.GetBandwidth());
+        if (group_by_shape) {
+            table += "  " + stats.shapes_;
+        }
+        table += "\n";
+    }
+    return table;
+}
+
+void OpProfiler::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    statistics_.clear();
+}
+
+ScopedOpTimer::ScopedOpTimer(const char* op,
+                             const char* variant,
+                             const Device& device,
+                             std::initializer_list<const Tensor*> inputs,
+                             const Tensor& output)
+    : enabled_(OpProfiler::GetInstance().IsEnabled()),
+      op_(op),
+      variant_(variant),
+      device_(device),
+      output_(output) {
+    if (!enabled_) {
+        return;
+    }
+    for (const Tensor* input : inputs) {
+        AddInput(*input);
+    }
+    if (device_.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CUDAScopedDevice scoped_device(device_);
+        cudaEvent_t start, stop;
+        OPEN3D_CUDA_CHECK(cudaEventCreate(&start));
+        OPEN3D_CUDA_CHECK(cudaEventCreate(&stop));
+        OPEN3D_CUDA_CHECK(cudaEventRecord(start, cuda::GetStream()));
+        start_event_ = start;
+        stop_event_ = stop;
+#endif
+    }
+    begin_ = std::chrono::steady_clock::now();
+}
+
+ScopedOpTimer::~ScopedOpTimer() {
+    if (!enabled_) {
+        return;
+    }
+    double elapsed_ms = 0;
+    if (start_event_) {
+#ifdef BUILD_CUDA_MODULE
+        CUDAScopedDevice scoped_device(device_);
+        cudaEvent_t start = static_cast<cudaEvent_t>(start_event_);
+        cudaEvent_t stop = static_cast<cudaEvent_t>(stop_event_);
+        float ms = 0;
+        OPEN3D_CUDA_CHECK(cudaEventRecord(stop, cuda::GetStream()));
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(stop));
+        OPEN3D_CUDA_CHECK(cudaEventElapsedTime(&ms, start, stop));
+        OPEN3D_CUDA_CHECK(cudaEventDestroy(start));
+        OPEN3D_CUDA_CHECK(cudaEventDestroy(stop));
+        elapsed_ms = ms;
+#endif
+    } else {
+        elapsed_ms = std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - begin_)
+                             .count();
+    }
+    const std::string op =
+            variant_ ? fmt::format("{}.{}", op_, variant_) : std::string(op_);
+    const std::string shapes = shapes_ + " -> " + output_.GetShape().ToString();
+    const int64_t bytes =
+            bytes_ + output_.NumElements() * output_.GetDtype().ByteSize();
+    OpProfiler::GetInstance().Record(op, dtype_, device_.ToString(), shapes,
+                                     elapsed_ms, bytes);
+}
+
+void ScopedOpTimer::AddInputs(const std::vector<Tensor>& inputs) {
+    if (!enabled_) {
+        return;
+    }
+    for (const Tensor& input : inputs) {
+        AddInput(input);
+    }
+}
+
+void ScopedOpTimer::AddInput(const Tensor& input) {
+    if (shapes_.empty()) {
+        dtype_ = input.GetDtype().ToString();
+    } else {
+        shapes_ += ", ";
+    }
+    shapes_ += input.GetShape().ToString();
+    bytes_ += input.NumElements() * input.GetDtype().ByteSize();
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+
+namespace open3d {
+namespace core {
+
+class Tensor;
+
+namespace kernel {
+
+/// Aggregated timings of the calls of one Tensor op, e.g. "BinaryEW.Add", with
+/// one dtype on one device. If the statistics are grouped by shape, \p shapes_
+/// holds the input and output shapes, e.g. "[100, 3], [3] -> [100, 3]";
+/// otherwise it is empty.
+struct OpStatistics {
+    std::string op_;
+    std::string dtype_;
+    std::string device_;
+    std::string shapes_;
+    int64_t count_ = 0;
+    double total_ms_ = 0;
+    double max_ms_ = 0;
+    /// Bytes of all inputs and outputs, summed over the calls.
+    int64_t bytes_ = 0;
+
+    double GetMeanMs() const { return count_ > 0 ? total_ms_ / count_ : 0; }
+    /// Effective bandwidth in GB/s.
+    double GetBandwidth() const {
+        return total_ms_ > 0 ? double(bytes_) / (total_ms_ * 1e6) : 0;
+    }
+};
+
+/// \class OpProfiler
+///
+/// Opt-in per-op timing of the Tensor kernel dispatch (UnaryEW, BinaryEW,
+/// Reduction, IndexGet, IndexSet, Matmul and BatchedMatmul). When enabled,
+/// each op records its dtype, device, shapes, bytes moved and elapsed time.
+/// CUDA ops are timed with CUDA events and synchronize the stream at the end
+/// of every op, so the timings are exact but the pipeline is serialized;
+/// enable the profiler only while chasing latency. When disabled, the cost
+/// per op is a relaxed atomic load.
+///
+/// \code
+/// kernel::OpProfiler::GetInstance().SetEnabled(true);
+/// RunFrame();
+/// utility::LogInfo("{}", kernel::OpProfiler::GetInstance().ToString());
+/// \endcode
+class OpProfiler {
+public:
+    static OpProfiler& GetInstance();
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Adds one call of \p op. Called by ScopedOpTimer.
+    void Record(const std::string& op,
+                const std::string& dtype,
+                const std::string& device,
+                const std::string& shapes,
+                double elapsed_ms,
+                int64_t bytes);
+
+    /// Returns the statistics sorted by total time in descending order. If
+    /// \p group_by_shape is false, calls with different shapes are merged.
+    std::vector<OpStatistics> GetStatistics(bool group_by_shape = false) const;
+
+    /// Formats GetStatistics() as a table. If \p max_rows > 0, only the
+    /// \p max_rows slowest entries are shown.
+    std::string ToString(bool group_by_shape = false, int max_rows = 0) const;
+
+    /// Clears all statistics.
+    void Reset();
+
+private:
+    OpProfiler() = default;
+
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_;
+    std::map<std::tuple<std::string, std::string, std::string, std::string>,
+             OpStatistics>
+            statistics_;
+};
+
+/// \class ScopedOpTimer
+///
+/// Times the op running during the lifetime of the object and records it in
+/// the OpProfiler. The op is named "<op>.<variant>", or "<op>" if \p variant
+/// is null. The shapes and bytes of the inputs are taken at construction and
+/// those of \p output at destruction, so \p output may be (re)allocated by
+/// the op. Does nothing if the OpProfiler is disabled.
+class ScopedOpTimer {
+public:
+    ScopedOpTimer(const char* op,
+                  const char* variant,
+                  const Device& device,
+                  std::initializer_list<const Tensor*> inputs,
+                  const Tensor& output);
+    ~ScopedOpTimer();
+
+    /// Adds \p inputs, e.g. index tensors, to the recorded inputs.
+    void AddInputs(const std::vector<Tensor>& inputs);
+
+    ScopedOpTimer(const ScopedOpTimer&) = delete;
+    ScopedOpTimer& operator=(const ScopedOpTimer&) = delete;
+
+private:
+    void AddInput(const Tensor& input);
+
+    bool enabled_ = false;
+    const char* op_;
+    const char* variant_;
+    Device device_;
+    const Tensor& output_;
+    std::string dtype_;
+    std::string shapes_;
+    int64_t bytes_ = 0;
+    std::chrono::steady_clock::time_point begin_;
+    void* start_event_ = nullptr;
+    void* stop_event_ = nullptr;
+};
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -27,16 +27,42 @@
 #include "open3d/core/kernel/Reduction.h"
 
 #include "open3d/core/SizeVector.h"
+#include "open3d/core/kernel/OpProfiler.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+// In the order of ReductionOpCode.
+static const char* const s_reduction_op_names[] = {
+        "Sum", "Prod", "Min", "Max", "ArgMin", "ArgMax", "All", "Any"};
+
+static void ReductionDevice(const Tensor& src,
+                            Tensor& dst,
+                            const SizeVector& dims,
+                            bool keepdim,
+                            ReductionOpCode op_code) {
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ReductionCPU(src, dst, dims, keepdim, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ReductionCUDA(src, dst, dims, keepdim, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
                bool keepdim,
                ReductionOpCode op_code) {
+    OPEN3D_PROFILE_ZONE("core", "Reduction");
     // For ArgMin and ArgMax, keepdim == false, and dims can only contain one or
     // all dimensions.
     if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
@@ -88,17 +114,22 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
-    Device::DeviceType device_type = src.GetDevice().GetType();
-    if (device_type == Device::DeviceType::CPU) {
-        ReductionCPU(src, dst, dims, keepdim, op_code);
-    } else if (device_type == Device::DeviceType::CUDA) {
-#ifdef BUILD_CUDA_MODULE
-        ReductionCUDA(src, dst, dims, keepdim, op_code);
-#else
-        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
-#endif
+    ScopedOpTimer op_timer("Reduction", s_reduction_op_names[int(op_code)],
+                           src.GetDevice(), {&src}, dst);
+    const Dtype src_dtype = src.GetDtype();
+    if (src_dtype == core::Float16 || src_dtype == core::BFloat16) {
+        // Accumulate half types in Float32 and round once when storing the
+        // result. Arg-reductions write Int64 indices directly.
+        const Tensor src_float = src.To(core::Float32);
+        if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
+            ReductionDevice(src_float, dst, dims, keepdim, op_code);
+        } else {
+            Tensor dst_float(dst.GetShape(), core::Float32, dst.GetDevice());
+            ReductionDevice(src_float, dst_float, dims, keepdim, op_code);
+            dst.AsRvalue() = dst_float;
+        }
     } else {
-        utility::LogError("Unimplemented device.");
+        ReductionDevice(src, dst, dims, keepdim, op_code);
     }
 
     if (!keepdim) {
@@ -24,8 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
 
+#include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
@@ -33,6 +38,10 @@
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 
+#ifdef BUILD_ISPC_MODULE
+#include "ReductionCPU_ispc.h"
+#endif
+
 namespace open3d {
 namespace core {
 namespace kernel {
@@ -85,6 +94,240 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Reduces src[0], src[stride], ..., src[(num_elements - 1) * stride] starting
+/// from \p identity. Keeps one partial result per lane of a 64-byte vector, so
+/// the loop vectorizes without reassociating floating-point operations, and is
+/// compiled for several ISAs. Used if the ISPC module is disabled.
+template <typename scalar_t, scalar_t (*reduce_func)(scalar_t, scalar_t)>
+OPEN3D_CPU_DISPATCH static scalar_t CPUReduceStrided(const scalar_t* src,
+                                                     int64_t num_elements,
+                                                     int64_t stride,
+                                                     scalar_t identity) {
+    constexpr int64_t kNumLanes = 64 / sizeof(scalar_t);
+    scalar_t lanes[kNumLanes];
+    std::fill(lanes, lanes + kNumLanes, identity);
+    int64_t i = 0;
+    if (stride == 1) {
+        for (; i + kNumLanes <= num_elements; i += kNumLanes) {
+            for (int64_t lane = 0; lane < kNumLanes; ++lane) {
+                lanes[lane] = reduce_func(src[i + lane], lanes[lane]);
+            }
+        }
+    } else {
+        for (; i + kNumLanes <= num_elements; i += kNumLanes) {
+            for (int64_t lane = 0; lane < kNumLanes; ++lane) {
+                lanes[lane] =
+                        reduce_func(src[(i + lane) * stride], lanes[lane]);
+            }
+        }
+    }
+    scalar_t result = identity;
+    for (; i < num_elements; ++i) {
+        result = reduce_func(src[i * stride], result);
+    }
+    for (int64_t lane = 0; lane < kNumLanes; ++lane) {
+        result = reduce_func(lanes[lane], result);
+    }
+    return result;
+}
+
+/// Arg-reduction counterpart of CPUReduceStrided(). Returns the index of the
+/// selected element and writes its value to \p value.
+template <typename scalar_t, typename func_t>
+static int64_t CPUArgReduceStrided(const scalar_t* src,
+                                   int64_t num_elements,
+                                   int64_t stride,
+                                   scalar_t identity,
+                                   func_t reduce_func,
+                                   scalar_t& value) {
+    int64_t index = 0;
+    value = identity;
+    for (int64_t i = 0; i < num_elements; ++i) {
+        std::tie(index, value) =
+                reduce_func(i, src[i * stride], index, value);
+    }
+    return index;
+}
+
+#ifdef BUILD_ISPC_MODULE
+/// Runs the ISPC reduction of \p op_code, see ReductionCPU.ispc. Returns false
+/// for types without ISPC kernels.
+template <typename scalar_t>
+static bool ISPCReduceStrided(ReductionOpCode op_code,
+                              const scalar_t* src,
+                              int64_t num_elements,
+                              int64_t stride,
+                              scalar_t identity,
+                              scalar_t& result) {
+    return false;
+}
+
+/// Arg-reduction counterpart of ISPCReduceStrided().
+template <typename scalar_t>
+static bool ISPCArgReduceStrided(ReductionOpCode op_code,
+                                 const scalar_t* src,
+                                 int64_t num_elements,
+                                 int64_t stride,
+                                 scalar_t identity,
+                                 scalar_t& value,
+                                 int64_t& index) {
+    return false;
+}
+
+#define OPEN3D_ISPC_REDUCE_STRIDED_(T)                                        \
+    static bool ISPCReduceStrided(ReductionOpCode op_code, const T* src,     \
+                                  int64_t num_elements, int64_t stride,      \
+                                  T identity, T& result) {                   \
+        using namespace ispc;                                                \
+        switch (op_code) {                                                   \
+            case ReductionOpCode::Sum:                                       \
+                result = CPUSumReduction_##T(src, num_elements, stride,      \
+                                             identity);                      \
+                return true;                                                 \
+            case ReductionOpCode::Prod:                                      \
+                result = CPUProdReduction_##T(src, num_elements, stride,     \
+                                              identity);                     \
+                return true;                                                 \
+            case ReductionOpCode::Min:                                       \
+                result = CPUMinReduction_##T(src, num_elements, stride,      \
+                                             identity);                      \
+                return true;                                                 \
+            case ReductionOpCode::Max:                                       \
+                result = CPUMaxReduction_##T(src, num_elements, stride,      \
+                                             identity);                      \
+                return true;                                                 \
+            case ReductionOpCode::All:                                       \
+                result = CPUAllReduction_##T(src, num_elements, stride,      \
+                                             identity);                      \
+                return true;                                                 \
+            case ReductionOpCode::Any:                                       \
+                result = CPUAnyReduction_##T(src, num_elements, stride,      \
+                                             identity);                      \
+                return true;                                                 \
+            default:                                                         \
+                return false;                                                \
+        }                                                                    \
+    }                                                                        \
+    static bool ISPCArgReduceStrided(ReductionOpCode op_code, const T* src,  \
+                                     int64_t num_elements, int64_t stride,   \
+                                     T identity, T& value, int64_t& index) { \
+        using namespace ispc;                                                \
+        switch (op_code) {                                                   \
+            case ReductionOpCode::ArgMin:                                    \
+                index = CPUArgMinReduction_##T(src, num_elements, stride,    \
+                                               identity, &value);            \
+                return true;                                                 \
+            case ReductionOpCode::ArgMax:                                    \
+                index = CPUArgMaxReduction_##T(src, num_elements, stride,    \
+                                               identity, &value);            \
+                return true;                                                 \
+            default:                                                         \
+                return false;                                                \
+        }                                                                    \
+    }
+
+OPEN3D_ISPC_REDUCE_STRIDED_(uint8_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(int8_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(uint16_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(int16_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(uint32_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(int32_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(uint64_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(int64_t)
+OPEN3D_ISPC_REDUCE_STRIDED_(float)
+OPEN3D_ISPC_REDUCE_STRIDED_(double)
+#undef OPEN3D_ISPC_REDUCE_STRIDED_
+#endif
+
+/// A reduction of a contiguous tensor, in which output element i reduces the
+/// num_reduced_ elements src[i * output_step_ + j * stride_].
+struct ContiguousReduction {
+    int64_t num_outputs_;
+    int64_t num_reduced_;
+    int64_t output_step_;
+    int64_t stride_;
+};
+
+/// Returns true if \p dims are the innermost or the outermost dims of the
+/// contiguous \p src and \p dst is contiguous. Reductions over the innermost
+/// dims reduce contiguous blocks; those over the outermost dims, e.g. the
+/// points of a (N, 3) tensor, reduce strided blocks.
+static bool GetContiguousReduction(const Tensor& src,
+                                   const Tensor& dst,
+                                   const SizeVector& dims,
+                                   ContiguousReduction& reduction) {
+    if (!src.IsContiguous() || !dst.IsContiguous() || dims.empty() ||
+        src.NumElements() == 0) {
+        return false;
+    }
+    SizeVector sorted_dims = dims;
+    std::sort(sorted_dims.begin(), sorted_dims.end());
+    const int64_t num_dims = src.NumDims();
+    const int64_t num_reduce_dims = int64_t(sorted_dims.size());
+    if (sorted_dims.front() == num_dims - num_reduce_dims &&
+        sorted_dims.back() == num_dims - 1) {
+        reduction.num_reduced_ = src.NumElements() / dst.NumElements();
+        reduction.num_outputs_ = dst.NumElements();
+        reduction.output_step_ = reduction.num_reduced_;
+        reduction.stride_ = 1;
+    } else if (sorted_dims.front() == 0 &&
+               sorted_dims.back() == num_reduce_dims - 1) {
+        reduction.num_outputs_ = dst.NumElements();
+        reduction.num_reduced_ = src.NumElements() / reduction.num_outputs_;
+        reduction.output_step_ = 1;
+        reduction.stride_ = reduction.num_outputs_;
+    } else {
+        return false;
+    }
+    // Sorted, unique dims spanning [first, last] are contiguous.
+    return std::adjacent_find(sorted_dims.begin(), sorted_dims.end()) ==
+           sorted_dims.end();
+}
+
+/// Runs \p reduce_block(output_idx, begin, count) -> result_t, the reduction
+/// of elements [begin, begin + count) of an output, for all outputs of
+/// \p reduction. Outputs are split into chunks if there are fewer outputs than
+/// threads; the partial results are merged in order with
+/// \p merge(earlier, later). \p store(output_idx, result) writes the result.
+template <typename result_t,
+          typename reduce_block_t,
+          typename merge_t,
+          typename store_t>
+static void LaunchContiguousReduction(const ContiguousReduction& reduction,
+                                      const reduce_block_t& reduce_block,
+                                      const merge_t& merge,
+                                      const store_t& store) {
+    const int64_t num_threads = utility::EstimateMaxThreads();
+    const int64_t num_outputs = reduction.num_outputs_;
+    const int64_t num_reduced = reduction.num_reduced_;
+    const bool serial = num_threads == 1 || utility::InParallel();
+    const int64_t num_chunks =
+            serial ? 1 : std::max<int64_t>(1, num_threads / num_outputs);
+    if (num_chunks == 1) {
+#pragma omp parallel for schedule(static) num_threads(num_threads) if (!serial)
+        for (int64_t output_idx = 0; output_idx < num_outputs; ++output_idx) {
+            store(output_idx, reduce_block(output_idx, 0, num_reduced));
+        }
+        return;
+    }
+    const int64_t chunk_size = (num_reduced + num_chunks - 1) / num_chunks;
+    std::vector<result_t> partials(num_outputs * num_chunks);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+    for (int64_t i = 0; i < num_outputs * num_chunks; ++i) {
+        const int64_t begin =
+                std::min((i % num_chunks) * chunk_size, num_reduced);
+        const int64_t end = std::min(begin + chunk_size, num_reduced);
+        partials[i] = reduce_block(i / num_chunks, begin, end - begin);
+    }
+    for (int64_t output_idx = 0; output_idx < num_outputs; ++output_idx) {
+        result_t result = partials[output_idx * num_chunks];
+        for (int64_t chunk = 1; chunk < num_chunks; ++chunk) {
+            result = merge(result, partials[output_idx * num_chunks + chunk]);
+        }
+        store(output_idx, result);
+    }
+}
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
@@ -105,6 +348,50 @@ public:
         }
     }
 
+    /// Runs the reduction \p op_code of \p src over \p dims into \p dst,
+    /// the tensors of the indexer. Reductions over the innermost or outermost
+    /// dims of contiguous tensors take a vectorized path.
+    template <typename scalar_t, scalar_t (*reduce_func)(scalar_t, scalar_t)>
+    void Run(ReductionOpCode op_code,
+             const Tensor& src,
+             Tensor& dst,
+             const SizeVector& dims,
+             scalar_t identity) {
+        ContiguousReduction reduction;
+        if (!GetContiguousReduction(src, dst, dims, reduction)) {
+            Run(reduce_func, identity);
+            return;
+        }
+        const scalar_t* src_ptr =
+                static_cast<const scalar_t*>(src.GetDataPtr());
+        scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
+        LaunchContiguousReduction<scalar_t>(
+                reduction,
+                [&](int64_t output_idx, int64_t begin, int64_t count) {
+                    const scalar_t* block =
+                            src_ptr + output_idx * reduction.output_step_ +
+                            begin * reduction.stride_;
+                    scalar_t result;
+#ifdef BUILD_ISPC_MODULE
+                    if (ISPCReduceStrided(op_code, block, count,
+                                          reduction.stride_, identity,
+                                          result)) {
+                        return result;
+                    }
+#endif
+                    result = CPUReduceStrided<scalar_t, reduce_func>(
+                            block, count, reduction.stride_, identity);
+                    return result;
+                },
+                [](scalar_t earlier, scalar_t later) {
+                    return reduce_func(later, earlier);
+                },
+                [&](int64_t output_idx, scalar_t result) {
+                    dst_ptr[output_idx] =
+                            reduce_func(result, dst_ptr[output_idx]);
+                });
+    }
+
 private:
     template <typename scalar_t, typename func_t>
     static void LaunchReductionKernelSerial(const Indexer& indexer,
@@ -196,6 +483,47 @@ private:
     Indexer indexer_;
 };
 
+/// Runs the arg-reduction \p op_code of \p reduction, see
+/// GetContiguousReduction(), with \p reduce_func, e.g.
+/// CPUArgMinReductionKernel.
+template <typename scalar_t, typename func_t>
+static void LaunchContiguousArgReduction(ReductionOpCode op_code,
+                                         const ContiguousReduction& reduction,
+                                         const Tensor& src,
+                                         Tensor& dst,
+                                         func_t reduce_func,
+                                         scalar_t identity) {
+    using result_t = std::pair<int64_t, scalar_t>;
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src.GetDataPtr());
+    int64_t* dst_ptr = dst.GetDataPtr<int64_t>();
+    LaunchContiguousReduction<result_t>(
+            reduction,
+            [&](int64_t output_idx, int64_t begin, int64_t count) {
+                const scalar_t* block = src_ptr +
+                                        output_idx * reduction.output_step_ +
+                                        begin * reduction.stride_;
+                scalar_t value;
+                int64_t index;
+#ifdef BUILD_ISPC_MODULE
+                if (ISPCArgReduceStrided(op_code, block, count,
+                                         reduction.stride_, identity, value,
+                                         index)) {
+                    return result_t(begin + index, value);
+                }
+#endif
+                index = CPUArgReduceStrided(block, count, reduction.stride_,
+                                            identity, reduce_func, value);
+                return result_t(begin + index, value);
+            },
+            [&](const result_t& earlier, const result_t& later) {
+                return reduce_func(later.first, later.second, earlier.first,
+                                   earlier.second);
+            },
+            [&](int64_t output_idx, const result_t& result) {
+                dst_ptr[output_idx] = result.first;
+            });
+}
+
 class CPUArgReductionEngine {
 public:
     CPUArgReductionEngine(const CPUArgReductionEngine&) = delete;
@@ -249,12 +577,14 @@ void ReductionCPU(const Tensor& src,
                 case ReductionOpCode::Sum:
                     identity = 0;
                     dst.Fill(identity);
-                    re.Run(CPUSumReductionKernel<scalar_t>, identity);
+                    re.Run<scalar_t, CPUSumReductionKernel<scalar_t>>(
+                            op_code, src, dst, dims, identity);
                     break;
                 case ReductionOpCode::Prod:
                     identity = 1;
                     dst.Fill(identity);
-                    re.Run(CPUProdReductionKernel<scalar_t>, identity);
+                    re.Run<scalar_t, CPUProdReductionKernel<scalar_t>>(
+                            op_code, src, dst, dims, identity);
                     break;
                 case ReductionOpCode::Min:
                     if (indexer.NumWorkloads() == 0) {
@@ -263,7 +593,8 @@ void ReductionCPU(const Tensor& src,
                     } else {
                         identity = std::numeric_limits<scalar_t>::max();
                         dst.Fill(identity);
-                        re.Run(CPUMinReductionKernel<scalar_t>, identity);
+                        re.Run<scalar_t, CPUMinReductionKernel<scalar_t>>(
+                                op_code, src, dst, dims, identity);
                     }
                     break;
                 case ReductionOpCode::Max:
@@ -273,7 +604,8 @@ void ReductionCPU(const Tensor& src,
                     } else {
                         identity = std::numeric_limits<scalar_t>::lowest();
                         dst.Fill(identity);
-                        re.Run(CPUMaxReductionKernel<scalar_t>, identity);
+                        re.Run<scalar_t, CPUMaxReductionKernel<scalar_t>>(
+                                op_code, src, dst, dims, identity);
                     }
                     break;
                 default:
@@ -285,6 +617,23 @@ void ReductionCPU(const Tensor& src,
         if (dst.GetDtype() != core::Int64) {
             utility::LogError("Arg-reduction must have int64 output dtype.");
         }
+        ContiguousReduction reduction;
+        if (GetContiguousReduction(src, dst, dims, reduction)) {
+            DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+                if (op_code == ReductionOpCode::ArgMin) {
+                    LaunchContiguousArgReduction(
+                            op_code, reduction, src, dst,
+                            CPUArgMinReductionKernel<scalar_t>,
+                            std::numeric_limits<scalar_t>::max());
+                } else {
+                    LaunchContiguousArgReduction(
+                            op_code, reduction, src, dst,
+                            CPUArgMaxReductionKernel<scalar_t>,
+                            std::numeric_limits<scalar_t>::lowest());
+                }
+            });
+            return;
+        }
         // Accumulation buffer to store temporary min/max values.
         Tensor dst_acc(dst.GetShape(), src.GetDtype(), src.GetDevice());
 
@@ -334,12 +683,14 @@ void ReductionCPU(const Tensor& src,
             case ReductionOpCode::All:
                 // Identity == true. 0-sized tensor, returns true.
                 dst.Fill(true);
-                re.Run(CPUAllReductionKernel, static_cast<uint8_t>(true));
+                re.Run<uint8_t, CPUAllReductionKernel>(
+                        op_code, src, dst, dims, static_cast<uint8_t>(true));
                 break;
             case ReductionOpCode::Any:
                 // Identity == false. 0-sized tensor, returns false.
                 dst.Fill(false);
-                re.Run(CPUAnyReductionKernel, static_cast<uint8_t>(false));
+                re.Run<uint8_t, CPUAnyReductionKernel>(
+                        op_code, src, dst, dims, static_cast<uint8_t>(false));
                 break;
             default:
                 utility::LogError("Unsupported op code.");
@@ -979,7 +979,8 @@ private:
             buffer = buffer_blob->GetDataPtr();
             semaphores = semaphores_blob->GetDataPtr();
             OPEN3D_CUDA_CHECK(
-                    cudaMemset(semaphores, 0, config.SemaphoreSize()));
+                    cudaMemsetAsync(semaphores, 0, config.SemaphoreSize(),
+                                    core::cuda::GetStream()));
         }
 
         OPEN3D_ASSERT(can_use_32bit_indexing);
@@ -999,7 +1000,7 @@ private:
         ReduceKernel<ReduceConfig::MAX_NUM_THREADS>
                 <<<config.GridDim(), config.BlockDim(), shared_memory,
                    core::cuda::GetStream()>>>(reduce_op);
-        cuda::Synchronize();
+        cuda::StreamSynchronize();
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -1012,6 +1013,7 @@ void ReductionCUDA(const Tensor& src,
                    const SizeVector& dims,
                    bool keepdim,
                    ReductionOpCode op_code) {
+    OPEN3D_PROFILE_CUDA_ZONE("core", "Reduction", src.GetDevice());
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CUDAReductionEngine re(indexer);
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/core/kernel/SegmentReduction.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+Tensor SegmentReduction(const Tensor& src,
+                        const Tensor& splits,
+                        SegmentReductionOpCode op_code) {
+    AssertTensorDevice(splits, src.GetDevice());
+    AssertTensorDtype(splits, core::Int64);
+    if (src.NumDims() == 0) {
+        utility::LogError("Segment reduction does not support 0-D tensors.");
+    }
+    if (splits.NumDims() != 1 || splits.GetLength() == 0) {
+        utility::LogError(
+                "Splits must be a 1-D tensor with at least one element, but "
+                "got shape {}.",
+                splits.GetShape());
+    }
+    const int64_t num_segments = splits.GetLength() - 1;
+    const int64_t num_rows = src.GetLength();
+    if (splits[0].Item<int64_t>() != 0 ||
+        splits[num_segments].Item<int64_t>() != num_rows) {
+        utility::LogError("Splits must start with 0 and end with {}.",
+                          num_rows);
+    }
+    if (num_segments > 0 && !splits.Slice(0, 1, num_segments + 1)
+                                     .Ge(splits.Slice(0, 0, num_segments))
+                                     .All()) {
+        utility::LogError("Splits must be non-decreasing.");
+    }
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentReductionCPU(src.Contiguous(), splits.Contiguous(), dst,
+                            op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentReductionCUDA(src.Contiguous(), splits.Contiguous(), dst,
+                             op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentReduction: Unimplemented device");
+    }
+    return dst;
+}
+
+Tensor SegmentIds(const Tensor& splits) {
+    AssertTensorDtype(splits, core::Int64);
+    const int64_t num_segments = splits.GetLength() - 1;
+    Tensor ids({splits[num_segments].Item<int64_t>()}, core::Int64,
+               splits.GetDevice());
+
+    Device::DeviceType device_type = splits.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentIdsCPU(splits.Contiguous(), ids);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentIdsCUDA(splits.Contiguous(), ids);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentIds: Unimplemented device");
+    }
+    return ids;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class SegmentReductionOpCode { Sum, Mean, Max, Min };
+
+/// Reduces \p src along its first dimension over consecutive segments.
+///
+/// \param src Tensor of shape {n, ...}.
+/// \param splits Int64 1-D tensor of shape {num_segments + 1}. It is an
+/// exclusive prefix sum of the segment lengths, starting with 0 and ending
+/// with n. Segment i spans src[splits[i]:splits[i + 1]].
+/// \param op_code The reduction applied to each segment. Empty segments
+/// reduce to 0 for all op codes.
+/// \return Tensor of shape {num_segments, ...} with the dtype of \p src.
+/// Float16 and BFloat16 segments are accumulated in float.
+Tensor SegmentReduction(const Tensor& src,
+                        const Tensor& splits,
+                        SegmentReductionOpCode op_code);
+
+/// Computes the segment of each row of a tensor that is split by \p splits.
+///
+/// \param splits Int64 1-D tensor of shape {num_segments + 1}, see
+/// SegmentReduction(). It is assumed to be valid.
+/// \return Int64 tensor of shape {splits[num_segments]} on the device of
+/// \p splits.
+Tensor SegmentIds(const Tensor& splits);
+
+void SegmentReductionCPU(const Tensor& src,
+                         const Tensor& splits,
+                         Tensor& dst,
+                         SegmentReductionOpCode op_code);
+
+void SegmentIdsCPU(const Tensor& splits, Tensor& ids);
+
+#ifdef BUILD_CUDA_MODULE
+void SegmentReductionCUDA(const Tensor& src,
+                          const Tensor& splits,
+                          Tensor& dst,
+                          SegmentReductionOpCode op_code);
+
+void SegmentIdsCUDA(const Tensor& splits, Tensor& ids);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <limits>
+#include <type_traits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/SegmentReduction.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+struct SegmentSumOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(T a, T b) const {
+        return a + b;
+    }
+};
+
+struct SegmentMaxOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(T a, T b) const {
+        return a > b ? a : b;
+    }
+};
+
+struct SegmentMinOp {
+    template <typename T>
+    OPEN3D_HOST_DEVICE T operator()(T a, T b) const {
+        return a < b ? a : b;
+    }
+};
+
+/// Reduces column \p col of rows [begin, end) of the row-major src with
+/// \p num_cols columns.
+template <typename acc_t, typename scalar_t, typename op_t>
+static OPEN3D_HOST_DEVICE acc_t ReduceSegment(const scalar_t* src_ptr,
+                                              int64_t begin,
+                                              int64_t end,
+                                              int64_t num_cols,
+                                              int64_t col,
+                                              acc_t identity,
+                                              op_t op) {
+    acc_t acc = identity;
+    for (int64_t row = begin; row < end; ++row) {
+        acc = op(acc, static_cast<acc_t>(src_ptr[row * num_cols + col]));
+    }
+    return acc;
+}
+
+#if defined(__CUDACC__)
+void SegmentReductionCUDA
+#else
+void SegmentReductionCPU
+#endif
+        (const Tensor& src,
+         const Tensor& splits,
+         Tensor& dst,
+         SegmentReductionOpCode op_code) {
+    if (dst.NumElements() == 0) {
+        return;
+    }
+    const int64_t num_cols = dst.NumElements() / dst.GetLength();
+
+#if defined(__CUDACC__)
+    CUDAScopedDevice scoped_device(src.GetDevice());
+#endif
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src.GetDtype(), [&]() {
+        // Half types accumulate in float.
+        using acc_t = typename std::conditional<
+                std::is_arithmetic<scalar_t>::value, scalar_t, float>::type;
+        const acc_t lowest = std::numeric_limits<acc_t>::lowest();
+        const acc_t max = std::numeric_limits<acc_t>::max();
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+
+        // One workload reduces one column of one segment, so no two
+        // workloads write the same output element.
+        ParallelFor(
+                dst.GetDevice(), dst.NumElements(),
+                [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                    const int64_t segment = workload_idx / num_cols;
+                    const int64_t col = workload_idx % num_cols;
+                    const int64_t begin = splits_ptr[segment];
+                    const int64_t end = splits_ptr[segment + 1];
+                    acc_t acc = 0;
+                    if (begin < end) {
+                        switch (op_code) {
+                            case SegmentReductionOpCode::Sum:
+                                acc = ReduceSegment(src_ptr, begin, end,
+                                                    num_cols, col, acc_t(0),
+                                                    SegmentSumOp());
+                                break;
+                            case SegmentReductionOpCode::Mean:
+                                acc = ReduceSegment(src_ptr, begin, end,
+                                                    num_cols, col, acc_t(0),
+                                                    SegmentSumOp()) /
+                                      static_cast<acc_t>(end - begin);
+                                break;
+                            case SegmentReductionOpCode::Max:
+                                acc = ReduceSegment(src_ptr, begin, end,
+                                                    num_cols, col, lowest,
+                                                    SegmentMaxOp());
+                                break;
+                            case SegmentReductionOpCode::Min:
+                                acc = ReduceSegment(src_ptr, begin, end,
+                                                    num_cols, col, max,
+                                                    SegmentMinOp());
+                                break;
+                        }
+                    }
+                    dst_ptr[workload_idx] = static_cast<scalar_t>(acc);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SegmentIdsCUDA
+#else
+void SegmentIdsCPU
+#endif
+        (const Tensor& splits, Tensor& ids) {
+    const int64_t num_ids = ids.GetLength();
+    if (num_ids == 0) {
+        return;
+    }
+    const int64_t num_segments = splits.GetLength() - 1;
+
+#if defined(__CUDACC__)
+    CUDAScopedDevice scoped_device(splits.GetDevice());
+#endif
+    const int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    int64_t* ids_ptr = ids.GetDataPtr<int64_t>();
+
+    // Binary search for the last segment starting at or before the row, which
+    // skips empty segments and balances the work for skewed segment sizes.
+    ParallelFor(ids.GetDevice(), num_ids,
+                [=] OPEN3D_HOST_DEVICE(int64_t workload_idx) {
+                    int64_t lo = 0;
+                    int64_t hi = num_segments;
+                    while (hi - lo > 1) {
+                        const int64_t mid = (lo + hi) / 2;
+                        if (splits_ptr[mid] <= workload_idx) {
+                            lo = mid;
+                        } else {
+                            hi = mid;
+                        }
+                    }
+                    ids_ptr[workload_idx] = lo;
+                });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
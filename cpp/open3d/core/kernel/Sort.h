@@ -0,0 +1,59 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns the Int64 permutation that stably sorts the 1-D tensor \p src in
+/// ascending order. Floating point NaNs are ordered last.
+Tensor Argsort(const Tensor& src);
+
+/// Groups equal elements of the sorted 1-D tensor \p sorted.
+///
+/// \param sorted Sorted 1-D tensor.
+/// \param group_ids Output Int64 tensor of shape {n}, the index of the group
+/// of each element of \p sorted.
+/// \param splits Output Int64 tensor of shape {num_groups + 1}. Group i spans
+/// sorted[splits[i]:splits[i + 1]].
+void SortedGroups(const Tensor& sorted, Tensor& group_ids, Tensor& splits);
+
+Tensor ArgsortCPU(const Tensor& src);
+
+void SortedGroupsCPU(const Tensor& sorted, Tensor& group_ids, Tensor& splits);
+
+#ifdef BUILD_CUDA_MODULE
+Tensor ArgsortCUDA(const Tensor& src);
+
+void SortedGroupsCUDA(const Tensor& sorted, Tensor& group_ids, Tensor& splits);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
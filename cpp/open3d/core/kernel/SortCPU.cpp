@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/core/kernel/SortImpl.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+static constexpr int kRadixBits = 8;
+static constexpr int64_t kRadixSize = 1 << kRadixBits;
+// Each chunk should be large enough to amortize its histogram.
+static constexpr int64_t kMinChunkSize = 1 << 14;
+
+/// Stable LSD radix sort of (keys, indices) pairs. Every pass histograms the
+/// chunks in parallel, turns the histograms into per-chunk scatter offsets
+/// and scatters the chunks in parallel. Passes in which all keys share the
+/// same digit are skipped.
+template <typename key_t>
+static void RadixSortPairs(std::vector<key_t>& keys,
+                           std::vector<int64_t>& indices) {
+    const int64_t n = static_cast<int64_t>(keys.size());
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(),
+                                 n / kMinChunkSize));
+    const int64_t chunk_size = (n + num_chunks - 1) / num_chunks;
+
+    std::vector<key_t> keys_tmp(n);
+    std::vector<int64_t> indices_tmp(n);
+    std::vector<int64_t> offsets(num_chunks * kRadixSize);
+
+    for (int shift = 0; shift < static_cast<int>(sizeof(key_t) * 8);
+         shift += kRadixBits) {
+        auto digit = [shift](key_t key) -> int64_t {
+            return static_cast<int64_t>((key >> shift) & (kRadixSize - 1));
+        };
+
+        std::fill(offsets.begin(), offsets.end(), 0);
+        utility::ParallelForRange(
+                num_chunks,
+                [&](int64_t chunk_begin, int64_t chunk_end) {
+                    for (int64_t c = chunk_begin; c < chunk_end; ++c) {
+                        int64_t* histogram = offsets.data() + c * kRadixSize;
+                        const int64_t end = std::min(n, (c + 1) * chunk_size);
+                        for (int64_t i = c * chunk_size; i < end; ++i) {
+                            histogram[digit(keys[i])]++;
+                        }
+                    }
+                },
+                1);
+
+        // Exclusive scan in (digit, chunk) order keeps the sort stable.
+        int64_t offset = 0;
+        bool single_digit = false;
+        for (int64_t d = 0; d < kRadixSize; ++d) {
+            const int64_t digit_begin = offset;
+            for (int64_t c = 0; c < num_chunks; ++c) {
+                const int64_t count = offsets[c * kRadixSize + d];
+                offsets[c * kRadixSize + d] = offset;
+                offset += count;
+            }
+            if (offset - digit_begin == n) {
+                single_digit = true;
+                break;
+            }
+        }
+        if (single_digit) {
+            continue;
+        }
+
+        utility::ParallelForRange(
+                num_chunks,
+                [&](int64_t chunk_begin, int64_t chunk_end) {
+                    for (int64_t c = chunk_begin; c < chunk_end; ++c) {
+                        int64_t* chunk_offsets =
+                                offsets.data() + c * kRadixSize;
+                        const int64_t end = std::min(n, (c + 1) * chunk_size);
+                        for (int64_t i = c * chunk_size; i < end; ++i) {
+                            const int64_t dst = chunk_offsets[digit(keys[i])]++;
+                            keys_tmp[dst] = keys[i];
+                            indices_tmp[dst] = indices[i];
+                        }
+                    }
+                },
+                1);
+        keys.swap(keys_tmp);
+        indices.swap(indices_tmp);
+    }
+}
+
+Tensor ArgsortCPU(const Tensor& src) {
+    const int64_t n = src.NumElements();
+    std::vector<int64_t> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src.GetDtype(), [&]() {
+        using key_t = typename RadixKey<scalar_t>::key_t;
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        std::vector<key_t> keys(n);
+        utility::ParallelForRange(n, [&](int64_t begin, int64_t end) {
+            for (int64_t i = begin; i < end; ++i) {
+                keys[i] = RadixKey<scalar_t>::ToKey(src_ptr[i]);
+            }
+        });
+        RadixSortPairs(keys, indices);
+    });
+
+    return Tensor(indices, {n}, core::Int64, src.GetDevice());
+}
+
+void SortedGroupsCPU(const Tensor& sorted, Tensor& group_ids, Tensor& splits) {
+    const int64_t n = sorted.NumElements();
+    group_ids = Tensor::Empty({n}, core::Int64, sorted.GetDevice());
+    int64_t* group_ids_ptr = group_ids.GetDataPtr<int64_t>();
+    std::vector<int64_t> splits_vec;
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(sorted.GetDtype(), [&]() {
+        const scalar_t* sorted_ptr = sorted.GetDataPtr<scalar_t>();
+        int64_t group_id = -1;
+        for (int64_t i = 0; i < n; ++i) {
+            if (i == 0 || sorted_ptr[i] != sorted_ptr[i - 1]) {
+                ++group_id;
+                splits_vec.push_back(i);
+            }
+            group_ids_ptr[i] = group_id;
+        }
+    });
+    splits_vec.push_back(n);
+
+    splits = Tensor(splits_vec, {static_cast<int64_t>(splits_vec.size())},
+                    core::Int64, sorted.GetDevice());
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
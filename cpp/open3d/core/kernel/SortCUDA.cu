@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <cub/cub.cuh>
+#include <limits>
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/core/kernel/SortImpl.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+Tensor ArgsortCUDA(const Tensor& src) {
+    const Device device = src.GetDevice();
+    const int64_t n = src.NumElements();
+    if (n > std::numeric_limits<int>::max()) {
+        utility::LogError("Argsort on CUDA supports at most {} elements.",
+                          std::numeric_limits<int>::max());
+    }
+
+    CUDAScopedDevice scoped_device(device);
+    Tensor indices = Tensor::Arange(0, n, 1, core::Int64, device);
+    Tensor sorted_indices = Tensor::Empty({n}, core::Int64, device);
+    if (n == 0) {
+        return sorted_indices;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src.GetDtype(), [&]() {
+        using key_t = typename RadixKey<scalar_t>::key_t;
+        const Dtype key_dtype = Dtype::FromType<key_t>();
+        Tensor keys = Tensor::Empty({n}, key_dtype, device);
+        Tensor sorted_keys = Tensor::Empty({n}, key_dtype, device);
+
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        key_t* keys_ptr = keys.GetDataPtr<key_t>();
+        ParallelFor(device, n, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+            keys_ptr[i] = RadixKey<scalar_t>::ToKey(src_ptr[i]);
+        });
+
+        size_t temp_bytes = 0;
+        OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairs(
+                nullptr, temp_bytes, keys_ptr, sorted_keys.GetDataPtr<key_t>(),
+                indices.GetDataPtr<int64_t>(),
+                sorted_indices.GetDataPtr<int64_t>(), static_cast<int>(n), 0,
+                sizeof(key_t) * 8, cuda::GetStream()));
+        Tensor temp = Tensor::Empty({static_cast<int64_t>(temp_bytes)},
+                                    core::UInt8, device);
+        OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairs(
+                temp.GetDataPtr(), temp_bytes, keys_ptr,
+                sorted_keys.GetDataPtr<key_t>(), indices.GetDataPtr<int64_t>(),
+                sorted_indices.GetDataPtr<int64_t>(), static_cast<int>(n), 0,
+                sizeof(key_t) * 8, cuda::GetStream()));
+    });
+
+    return sorted_indices;
+}
+
+void SortedGroupsCUDA(const Tensor& sorted, Tensor& group_ids, Tensor& splits) {
+    const Device device = sorted.GetDevice();
+    const int64_t n = sorted.NumElements();
+
+    CUDAScopedDevice scoped_device(device);
+    group_ids = Tensor::Empty({n}, core::Int64, device);
+    if (n == 0) {
+        splits = Tensor::Zeros({1}, core::Int64, device);
+        return;
+    }
+
+    // Flag the first element of every group, then scan the flags into
+    // 1-based group ids.
+    Tensor is_first = Tensor::Empty({n}, core::Int64, device);
+    int64_t* is_first_ptr = is_first.GetDataPtr<int64_t>();
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(sorted.GetDtype(), [&]() {
+        const scalar_t* sorted_ptr = sorted.GetDataPtr<scalar_t>();
+        ParallelFor(device, n, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+            is_first_ptr[i] =
+                    (i == 0 || sorted_ptr[i] != sorted_ptr[i - 1]) ? 1 : 0;
+        });
+    });
+
+    int64_t* group_ids_ptr = group_ids.GetDataPtr<int64_t>();
+    thrust::inclusive_scan(thrust::cuda::par.on(cuda::GetStream()),
+                           is_first_ptr, is_first_ptr + n, group_ids_ptr);
+    const int64_t num_groups = group_ids[n - 1].Item<int64_t>();
+
+    splits = Tensor::Empty({num_groups + 1}, core::Int64, device);
+    int64_t* splits_ptr = splits.GetDataPtr<int64_t>();
+    ParallelFor(device, n, [=] OPEN3D_HOST_DEVICE(int64_t i) {
+        const int64_t group_id = group_ids_ptr[i] - 1;
+        if (is_first_ptr[i]) {
+            splits_ptr[group_id] = i;
+        }
+        if (i == n - 1) {
+            splits_ptr[num_groups] = n;
+        }
+        group_ids_ptr[i] = group_id;
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Float16.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Maps a value to an unsigned integer key whose unsigned order is the order
+/// of the values, so that radix sorts only deal with unsigned keys.
+template <typename scalar_t, typename Enable = void>
+struct RadixKey;
+
+template <typename scalar_t>
+struct RadixKey<scalar_t,
+                typename std::enable_if<std::is_unsigned<scalar_t>::value &&
+                                        !std::is_same<scalar_t, bool>::value>::
+                        type> {
+    using key_t = scalar_t;
+    static OPEN3D_HOST_DEVICE key_t ToKey(scalar_t value) { return value; }
+};
+
+template <>
+struct RadixKey<bool> {
+    using key_t = uint8_t;
+    static OPEN3D_HOST_DEVICE key_t ToKey(bool value) { return value ? 1 : 0; }
+};
+
+/// Signed integers: flip the sign bit.
+template <typename scalar_t>
+struct RadixKey<
+        scalar_t,
+        typename std::enable_if<std::is_integral<scalar_t>::value &&
+                                std::is_signed<scalar_t>::value>::type> {
+    using key_t = typename std::make_unsigned<scalar_t>::type;
+    static OPEN3D_HOST_DEVICE key_t ToKey(scalar_t value) {
+        return static_cast<key_t>(value) ^
+               (static_cast<key_t>(1) << (sizeof(key_t) * 8 - 1));
+    }
+};
+
+/// IEEE floats: flip all bits of negative values and the sign bit of positive
+/// values. -0 orders before +0 and positive NaNs order after +inf.
+template <typename key_t>
+OPEN3D_HOST_DEVICE inline key_t FloatBitsToKey(key_t bits) {
+    const key_t sign_bit = static_cast<key_t>(1) << (sizeof(key_t) * 8 - 1);
+    return static_cast<key_t>((bits & sign_bit) ? ~bits : (bits | sign_bit));
+}
+
+template <>
+struct RadixKey<float> {
+    using key_t = uint32_t;
+    static OPEN3D_HOST_DEVICE key_t ToKey(float value) {
+        key_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return FloatBitsToKey(bits);
+    }
+};
+
+template <>
+struct RadixKey<double> {
+    using key_t = uint64_t;
+    static OPEN3D_HOST_DEVICE key_t ToKey(double value) {
+        key_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return FloatBitsToKey(bits);
+    }
+};
+
+template <>
+struct RadixKey<float16_t> {
+    using key_t = uint16_t;
+    static OPEN3D_HOST_DEVICE key_t ToKey(float16_t value) {
+        return FloatBitsToKey(value.GetBits());
+    }
+};
+
+template <>
+struct RadixKey<bfloat16_t> {
+    using key_t = uint16_t;
+    static OPEN3D_HOST_DEVICE key_t ToKey(bfloat16_t value) {
+        return FloatBitsToKey(value.GetBits());
+    }
+};
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
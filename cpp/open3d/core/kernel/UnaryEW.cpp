@@ -26,15 +26,26 @@
 
 #include "open3d/core/kernel/UnaryEW.h"
 
+#include <utility>
+#include <vector>
+
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/OpProfiler.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+// In the order of UnaryEWOpCode.
+static const char* const s_unary_ew_op_names[] = {
+        "Sqrt",  "Sin",      "Cos",   "Neg",  "Exp",   "Abs",   "IsNan",
+        "IsInf", "IsFinite", "Floor", "Ceil", "Round", "Trunc", "LogicalNot"};
+
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    OPEN3D_PROFILE_ZONE("core", "UnaryEW");
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
@@ -49,6 +60,8 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                           src_device.ToString(), dst_device.ToString());
     }
 
+    ScopedOpTimer op_timer("UnaryEW", s_unary_ew_op_names[int(op_code)],
+                           src_device, {&src}, dst);
     if (src_device.GetType() == Device::DeviceType::CPU) {
         UnaryEWCPU(src, dst, op_code);
     } else if (src_device.GetType() == Device::DeviceType::CUDA) {
@@ -62,6 +75,67 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     }
 }
 
+bool GetStridedCopy2D(const Tensor& src,
+                      const Tensor& dst,
+                      StridedCopy2D& copy) {
+    const Dtype dtype = src.GetDtype();
+    const int64_t byte_size = dtype.ByteSize();
+    if (src.GetShape() != dst.GetShape() || dtype != dst.GetDtype() ||
+        dtype.IsObject() || src.NumElements() == 0 ||
+        !(byte_size == 1 || byte_size == 2 || byte_size == 4 ||
+          byte_size == 8)) {
+        return false;
+    }
+
+    // Drop dimensions of size 1 and merge each dimension into the previous one
+    // if both tensors are contiguous across them.
+    std::vector<int64_t> shape, src_strides, dst_strides;
+    for (int64_t i = 0; i < src.NumDims(); ++i) {
+        const int64_t size = src.GetShape(i);
+        const int64_t src_stride = src.GetStride(i);
+        const int64_t dst_stride = dst.GetStride(i);
+        if (size == 1) {
+            continue;
+        }
+        if (!shape.empty() && src_strides.back() == src_stride * size &&
+            dst_strides.back() == dst_stride * size) {
+            shape.back() *= size;
+            src_strides.back() = src_stride;
+            dst_strides.back() = dst_stride;
+        } else {
+            shape.push_back(size);
+            src_strides.push_back(src_stride);
+            dst_strides.push_back(dst_stride);
+        }
+    }
+    if (shape.size() > 2) {
+        return false;
+    }
+    while (shape.size() < 2) {
+        // Prepend a single row.
+        const int64_t cols = shape.empty() ? 1 : shape[0];
+        const int64_t src_col_stride = src_strides.empty() ? 1 : src_strides[0];
+        const int64_t dst_col_stride = dst_strides.empty() ? 1 : dst_strides[0];
+        shape.insert(shape.begin(), 1);
+        src_strides.insert(src_strides.begin(), src_col_stride * cols);
+        dst_strides.insert(dst_strides.begin(), dst_col_stride * cols);
+    }
+    if (dst_strides[1] > dst_strides[0]) {
+        std::swap(shape[0], shape[1]);
+        std::swap(src_strides[0], src_strides[1]);
+        std::swap(dst_strides[0], dst_strides[1]);
+    }
+
+    copy.rows_ = shape[0];
+    copy.cols_ = shape[1];
+    copy.src_row_stride_ = src_strides[0];
+    copy.src_col_stride_ = src_strides[1];
+    copy.dst_row_stride_ = dst_strides[0];
+    copy.dst_col_stride_ = dst_strides[1];
+    copy.element_byte_size_ = byte_size;
+    return true;
+}
+
 void Copy(const Tensor& src, Tensor& dst) {
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
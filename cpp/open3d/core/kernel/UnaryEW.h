@@ -64,6 +64,35 @@ void Copy(const Tensor& src, Tensor& dst);
 
 void CopyCPU(const Tensor& src, Tensor& dst);
 
+/// A copy between two tensors whose elements form a 2D grid once the
+/// dimensions that are contiguous in both tensors are merged, e.g. a transpose
+/// or a copy from a column slice. Strides are in elements. The dimensions are
+/// ordered such that the column stride of dst is not larger than its row
+/// stride.
+struct StridedCopy2D {
+    int64_t rows_ = 0;
+    int64_t cols_ = 0;
+    int64_t src_row_stride_ = 0;
+    int64_t src_col_stride_ = 0;
+    int64_t dst_row_stride_ = 0;
+    int64_t dst_col_stride_ = 0;
+    int64_t element_byte_size_ = 0;
+
+    /// True if the rows are contiguous in both src and dst, so that the copy
+    /// is a sequence of memcpy's.
+    bool IsPitched() const {
+        return src_col_stride_ == 1 && dst_col_stride_ == 1 &&
+               src_row_stride_ >= cols_ && dst_row_stride_ >= cols_;
+    }
+};
+
+/// Returns true and fills \p copy if copying \p src to \p dst can be
+/// described by StridedCopy2D. This requires non-empty tensors of the same
+/// shape and dtype, with a non-object dtype of 1, 2, 4 or 8 bytes.
+bool GetStridedCopy2D(const Tensor& src,
+                      const Tensor& dst,
+                      StridedCopy2D& copy);
+
 #ifdef BUILD_CUDA_MODULE
 void CopyCUDA(const Tensor& src, Tensor& dst);
 #endif
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 
@@ -179,11 +180,55 @@ static void CPULogicalNotElementKernel(const void* src, void* dst) {
             !static_cast<bool>(*static_cast<const src_t*>(src)));
 }
 
+template <typename scalar_t>
+static void CopyStrided2DCPU(const StridedCopy2D& copy,
+                             const void* src,
+                             void* dst) {
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src);
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst);
+    const int64_t rows = copy.rows_;
+    const int64_t cols = copy.cols_;
+    const int64_t src_row_stride = copy.src_row_stride_;
+    const int64_t src_col_stride = copy.src_col_stride_;
+    const int64_t dst_row_stride = copy.dst_row_stride_;
+    const int64_t dst_col_stride = copy.dst_col_stride_;
+
+    // Copying whole rows is only worth it for rows of a few cache lines.
+    if (copy.IsPitched() && cols * int64_t(sizeof(scalar_t)) >= 256) {
+        ParallelFor(Device("CPU:0"), rows, [&](int64_t row) {
+            std::memcpy(dst_ptr + row * dst_row_stride,
+                        src_ptr + row * src_row_stride,
+                        cols * sizeof(scalar_t));
+        });
+        return;
+    }
+
+    // Tiles keep the lines read from src and written to dst in cache when
+    // the fast dimensions of src and dst differ, e.g. for transposes.
+    constexpr int64_t kTileDim = 32;
+    const int64_t row_tiles = (rows + kTileDim - 1) / kTileDim;
+    const int64_t col_tiles = (cols + kTileDim - 1) / kTileDim;
+    ParallelFor(Device("CPU:0"), row_tiles * col_tiles, [&](int64_t tile) {
+        const int64_t row_begin = (tile / col_tiles) * kTileDim;
+        const int64_t col_begin = (tile % col_tiles) * kTileDim;
+        const int64_t row_end = std::min(row_begin + kTileDim, rows);
+        const int64_t col_end = std::min(col_begin + kTileDim, cols);
+        for (int64_t row = row_begin; row < row_end; ++row) {
+            const scalar_t* src_row = src_ptr + row * src_row_stride;
+            scalar_t* dst_row = dst_ptr + row * dst_row_stride;
+            for (int64_t col = col_begin; col < col_end; ++col) {
+                dst_row[col * dst_col_stride] = src_row[col * src_col_stride];
+            }
+        }
+    });
+}
+
 void CopyCPU(const Tensor& src, Tensor& dst) {
     // src and dst have been checked to have the same shape, dtype, device
     SizeVector shape = src.GetShape();
     Dtype src_dtype = src.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
+    StridedCopy2D strided_copy;
     if (src.IsContiguous() && dst.IsContiguous() &&
         src.GetShape() == dst.GetShape() && src_dtype == dst_dtype) {
         MemoryManager::Memcpy(dst.GetDataPtr(), dst.GetDevice(),
@@ -193,7 +238,7 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                src.NumElements() == 1 && !src_dtype.IsObject()) {
         int64_t num_elements = dst.NumElements();
 
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
             scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
             scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
             ParallelFor(Device("CPU:0"), num_elements,
@@ -201,6 +246,25 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                             dst_ptr[workload_idx] = scalar_element;
                         });
         });
+    } else if (GetStridedCopy2D(src, dst, strided_copy)) {
+        switch (strided_copy.element_byte_size_) {
+            case 1:
+                CopyStrided2DCPU<uint8_t>(strided_copy, src.GetDataPtr(),
+                                          dst.GetDataPtr());
+                break;
+            case 2:
+                CopyStrided2DCPU<uint16_t>(strided_copy, src.GetDataPtr(),
+                                           dst.GetDataPtr());
+                break;
+            case 4:
+                CopyStrided2DCPU<uint32_t>(strided_copy, src.GetDataPtr(),
+                                           dst.GetDataPtr());
+                break;
+            default:
+                CopyStrided2DCPU<uint64_t>(strided_copy, src.GetDataPtr(),
+                                           dst.GetDataPtr());
+                break;
+        }
     } else {
         Indexer indexer({src}, dst, DtypePolicy::NONE);
         if (src.GetDtype().IsObject()) {
@@ -210,9 +274,9 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
             });
 
         } else {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 using src_t = scalar_t;
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
                     using dst_t = scalar_t;
                     LaunchUnaryEWKernel<src_t, dst_t>(
                             indexer, CPUCopyElementKernel<src_t, dst_t>);
@@ -228,9 +292,11 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != core::Float32 && dtype != core::Float64) {
+        if (dtype != core::Float32 && dtype != core::Float64 &&
+            dtype != core::Float16 && dtype != core::BFloat16) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float32, Float64, Float16 and BFloat16, but "
+                    "{} is used.",
                     dtype.ToString());
         }
     };
@@ -241,7 +307,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 LaunchUnaryEWKernel<scalar_t, scalar_t>(
                         indexer, CPULogicalNotElementKernel<scalar_t, scalar_t>,
                         OPEN3D_TEMPLATE_VECTORIZED(scalar_t,
@@ -253,7 +319,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
             ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                 LaunchUnaryEWKernel<scalar_t, bool>(
                         indexer, CPULogicalNotElementKernel<scalar_t, bool>,
                         OPEN3D_TEMPLATE_VECTORIZED(
@@ -273,7 +339,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
         ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
                 LaunchUnaryEWKernel<scalar_t, bool>(
                         indexer, CPUIsNanElementKernel<scalar_t>,
@@ -297,7 +363,7 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 #ifdef BUILD_ISPC_MODULE
         ispc::Indexer ispc_indexer = indexer.ToISPC();
 #endif
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
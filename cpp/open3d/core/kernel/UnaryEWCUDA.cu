@@ -27,6 +27,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
+#include "open3d/core/Metrics.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/UnaryEW.h"
@@ -175,6 +176,125 @@ static OPEN3D_HOST_DEVICE void CUDALogicalNotElementKernel(const void* src,
             !static_cast<bool>(*static_cast<const src_t*>(src)));
 }
 
+static constexpr int kCopyTileDim = 32;
+static constexpr int kCopyBlockRows = 8;
+
+// Transposing copy through shared memory. Rows are contiguous in src and
+// columns are contiguous in dst: a tile is read along its rows and written
+// along its columns, so that both the loads and the stores are coalesced.
+template <typename scalar_t>
+__global__ void CopyTransposeKernel(StridedCopy2D copy,
+                                    int64_t col_tiles,
+                                    const scalar_t* __restrict__ src,
+                                    scalar_t* __restrict__ dst) {
+    __shared__ scalar_t tile[kCopyTileDim][kCopyTileDim + 1];
+    const int64_t row_begin = (int64_t(blockIdx.x) / col_tiles) * kCopyTileDim;
+    const int64_t col_begin = (int64_t(blockIdx.x) % col_tiles) * kCopyTileDim;
+
+    for (int i = threadIdx.y; i < kCopyTileDim; i += kCopyBlockRows) {
+        const int64_t row = row_begin + threadIdx.x;
+        const int64_t col = col_begin + i;
+        if (row < copy.rows_ && col < copy.cols_) {
+            tile[threadIdx.x][i] = src[row * copy.src_row_stride_ +
+                                       col * copy.src_col_stride_];
+        }
+    }
+    __syncthreads();
+    for (int i = threadIdx.y; i < kCopyTileDim; i += kCopyBlockRows) {
+        const int64_t row = row_begin + i;
+        const int64_t col = col_begin + threadIdx.x;
+        if (row < copy.rows_ && col < copy.cols_) {
+            dst[row * copy.dst_row_stride_ + col * copy.dst_col_stride_] =
+                    tile[i][threadIdx.x];
+        }
+    }
+}
+
+// Cannot be a static function since on Windows a function enclosing
+// __host__ __device__ lambda function must have external linkage.
+template <typename scalar_t>
+void CopyStrided2DCUDA(const StridedCopy2D& copy,
+                       const void* src,
+                       void* dst,
+                       const Device& device) {
+    CUDAScopedDevice scoped_device(device);
+    const scalar_t* src_ptr = static_cast<const scalar_t*>(src);
+    scalar_t* dst_ptr = static_cast<scalar_t*>(dst);
+    const int64_t rows = copy.rows_;
+    const int64_t cols = copy.cols_;
+
+    // The copy engine is only efficient for rows of a few hundred bytes.
+    if (copy.IsPitched() && cols * int64_t(sizeof(scalar_t)) >= 256) {
+        OPEN3D_CUDA_CHECK(cudaMemcpy2DAsync(
+                dst_ptr, copy.dst_row_stride_ * sizeof(scalar_t), src_ptr,
+                copy.src_row_stride_ * sizeof(scalar_t),
+                cols * sizeof(scalar_t), rows, cudaMemcpyDeviceToDevice,
+                cuda::GetStream()));
+    } else if (copy.src_row_stride_ < copy.src_col_stride_ && rows > 1 &&
+               cols > 1) {
+        const int64_t row_tiles = (rows + kCopyTileDim - 1) / kCopyTileDim;
+        const int64_t col_tiles = (cols + kCopyTileDim - 1) / kCopyTileDim;
+        CountKernelLaunch(device);
+        CopyTransposeKernel<scalar_t>
+                <<<row_tiles * col_tiles, dim3(kCopyTileDim, kCopyBlockRows),
+                   0, cuda::GetStream()>>>(copy, col_tiles, src_ptr, dst_ptr);
+        OPEN3D_GET_LAST_CUDA_ERROR("CopyTransposeKernel failed.");
+    } else {
+        const int64_t src_row_stride = copy.src_row_stride_;
+        const int64_t src_col_stride = copy.src_col_stride_;
+        const int64_t dst_row_stride = copy.dst_row_stride_;
+        const int64_t dst_col_stride = copy.dst_col_stride_;
+        ParallelFor(device, rows * cols,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t row = workload_idx / cols;
+                        const int64_t col = workload_idx % cols;
+                        dst_ptr[row * dst_row_stride + col * dst_col_stride] =
+                                src_ptr[row * src_row_stride +
+                                        col * src_col_stride];
+                    });
+    }
+}
+
+static void CopyStrided2D(const StridedCopy2D& copy,
+                          const Tensor& src,
+                          Tensor& dst) {
+    switch (copy.element_byte_size_) {
+        case 1:
+            CopyStrided2DCUDA<uint8_t>(copy, src.GetDataPtr(),
+                                       dst.GetDataPtr(), src.GetDevice());
+            break;
+        case 2:
+            CopyStrided2DCUDA<uint16_t>(copy, src.GetDataPtr(),
+                                        dst.GetDataPtr(), src.GetDevice());
+            break;
+        case 4:
+            CopyStrided2DCUDA<uint32_t>(copy, src.GetDataPtr(),
+                                        dst.GetDataPtr(), src.GetDevice());
+            break;
+        default:
+            CopyStrided2DCUDA<uint64_t>(copy, src.GetDataPtr(),
+                                        dst.GetDataPtr(), src.GetDevice());
+            break;
+    }
+}
+
+// Copies rows between host and device memory with the copy engine, without
+// making either side contiguous first.
+static void CopyPitchedHostDevice(const StridedCopy2D& copy,
+                                  const Tensor& src,
+                                  Tensor& dst) {
+    const bool to_host = dst.GetDevice().GetType() == Device::DeviceType::CPU;
+    CUDAScopedDevice scoped_device(to_host ? src.GetDevice()
+                                           : dst.GetDevice());
+    const int64_t byte_size = copy.element_byte_size_;
+    OPEN3D_CUDA_CHECK(cudaMemcpy2DAsync(
+            dst.GetDataPtr(), copy.dst_row_stride_ * byte_size,
+            src.GetDataPtr(), copy.src_row_stride_ * byte_size,
+            copy.cols_ * byte_size, copy.rows_,
+            to_host ? cudaMemcpyDeviceToHost : cudaMemcpyHostToDevice,
+            cuda::GetStream()));
+}
+
 void CopyCUDA(const Tensor& src, Tensor& dst) {
     // It has been checked that
     // - src and dst have the same dtype
@@ -185,6 +305,7 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
 
     Device src_device = src.GetDevice();
     Device dst_device = dst.GetDevice();
+    StridedCopy2D strided_copy;
 
     if (src_device.GetType() == Device::DeviceType::CUDA &&
         dst_device.GetType() == Device::DeviceType::CUDA) {
@@ -198,7 +319,7 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                    src.NumElements() == 1 && !src_dtype.IsObject()) {
             int64_t num_elements = dst.NumElements();
 
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
                 scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
                 scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
                 ParallelFor(src_device, num_elements,
@@ -206,6 +327,9 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                                 dst_ptr[workload_idx] = scalar_element;
                             });
             });
+        } else if (src_device == dst_device &&
+                   GetStridedCopy2D(src, dst, strided_copy)) {
+            CopyStrided2D(strided_copy, src, dst);
         } else if (src_device == dst_device) {
             // For more optimized version, one can check if P2P from src to
             // dst is enabled, then put synchronization with streams on both
@@ -221,19 +345,22 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                         });
 
             } else {
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
                     using src_t = scalar_t;
-                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
-                        using dst_t = scalar_t;
-                        LaunchUnaryEWKernel<src_t, dst_t>(
-                                src_device, indexer,
-                                // Need to wrap as extended CUDA lambda function
-                                [] OPEN3D_HOST_DEVICE(const void* src,
-                                                      void* dst) {
-                                    CUDACopyElementKernel<src_t, dst_t>(src,
-                                                                        dst);
-                                });
-                    });
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(
+                            dst_dtype, [&]() {
+                                using dst_t = scalar_t;
+                                LaunchUnaryEWKernel<src_t, dst_t>(
+                                        src_device, indexer,
+                                        // Need to wrap as extended CUDA lambda
+                                        // function
+                                        [] OPEN3D_HOST_DEVICE(const void* src,
+                                                              void* dst) {
+                                            CUDACopyElementKernel<src_t,
+                                                                  dst_t>(src,
+                                                                         dst);
+                                        });
+                            });
                 });
             }
         } else {
@@ -243,9 +370,18 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
                        dst_device.GetType() == Device::DeviceType::CUDA ||
                src_device.GetType() == Device::DeviceType::CUDA &&
                        dst_device.GetType() == Device::DeviceType::CPU) {
-        Tensor src_conti = src.Contiguous();  // No op if already contiguous
-        if (dst.IsContiguous() && src.GetShape() == dst.GetShape() &&
-            src_dtype == dst_dtype) {
+        if (src.IsContiguous() && dst.IsContiguous() &&
+            src.GetShape() == dst.GetShape() && src_dtype == dst_dtype) {
+            MemoryManager::Memcpy(dst.GetDataPtr(), dst_device,
+                                  src.GetDataPtr(), src_device,
+                                  src_dtype.ByteSize() * shape.NumElements());
+        } else if (GetStridedCopy2D(src, dst, strided_copy) &&
+                   strided_copy.IsPitched()) {
+            CopyPitchedHostDevice(strided_copy, src, dst);
+        } else if (dst.IsContiguous() && src.GetShape() == dst.GetShape() &&
+                   src_dtype == dst_dtype) {
+            // Transposes are done on the src device.
+            Tensor src_conti = src.Contiguous();
             MemoryManager::Memcpy(dst.GetDataPtr(), dst_device,
                                   src_conti.GetDataPtr(), src_conti.GetDevice(),
                                   src_dtype.ByteSize() * shape.NumElements());
@@ -259,21 +395,24 @@ void CopyCUDA(const Tensor& src, Tensor& dst) {
 }
 
 void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    OPEN3D_PROFILE_CUDA_ZONE("core", "UnaryEW", src.GetDevice());
     // src and dst have been chaged to have the same shape, dtype, device.
     Dtype src_dtype = src.GetDtype();
     Dtype dst_dtype = dst.GetDtype();
     Device src_device = src.GetDevice();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != core::Float32 && dtype != core::Float64) {
+        if (dtype != core::Float32 && dtype != core::Float64 &&
+            dtype != core::Float16 && dtype != core::BFloat16) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float32, Float64, Float16 and BFloat16, but "
+                    "{} is used.",
                     dtype.ToString());
         }
     };
 
     if (op_code == UnaryEWOpCode::LogicalNot) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
                 LaunchUnaryEWKernel<scalar_t, scalar_t>(
@@ -302,7 +441,7 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                op_code == UnaryEWOpCode::IsFinite) {
         assert_dtype_is_float(src_dtype);
         Indexer indexer({src}, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
                 LaunchUnaryEWKernel<scalar_t, bool>(
                         src_device, indexer,
@@ -325,7 +464,7 @@ void UnaryEWCUDA(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
         });
     } else {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+#include "open3d/core/linalg/BatchedLinalgImpl.h"
+
+namespace open3d {
+namespace core {
+
+/// Checks that \p A is a batch of square matrices and returns their size.
+static int64_t CheckBatchedSquareMatrices(const Tensor& A) {
+    AssertTensorDtypes(A, {Float32, Float64});
+    const SizeVector& A_shape = A.GetShape();
+    if (A_shape.size() < 2) {
+        utility::LogError("Tensor A must be at least 2D, but got {}D.",
+                          A_shape.size());
+    }
+    const int64_t n = A_shape[A_shape.size() - 1];
+    if (A_shape[A_shape.size() - 2] != n) {
+        utility::LogError("Tensor A must be batches of square matrices, "
+                          "but got shape {}.",
+                          A_shape.ToString());
+    }
+    return n;
+}
+
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    const int64_t n = CheckBatchedSquareMatrices(A);
+    if (n != 3 && n != 4 && n != 6) {
+        utility::LogError("Only 3 x 3, 4 x 4 and 6 x 6 matrices are supported, "
+                          "but got {} x {}.",
+                          n, n);
+    }
+    AssertTensorDtype(B, A.GetDtype());
+    AssertTensorDevice(B, A.GetDevice());
+
+    // B is a batch of vectors if it has one dimension less than A.
+    const SizeVector& A_shape = A.GetShape();
+    const SizeVector& B_shape = B.GetShape();
+    const SizeVector batch_shape(A_shape.begin(), A_shape.end() - 2);
+    const bool is_vector = B_shape.size() + 1 == A_shape.size();
+    SizeVector expected_B_shape = batch_shape;
+    expected_B_shape.push_back(n);
+    if (!is_vector) {
+        expected_B_shape.push_back(B_shape.size() == A_shape.size()
+                                           ? B_shape[B_shape.size() - 1]
+                                           : 1);
+    }
+    if (B_shape != expected_B_shape) {
+        utility::LogError("Tensor B of shape {} does not match A of shape {}.",
+                          B_shape.ToString(), A_shape.ToString());
+    }
+
+    const int64_t batch_size = batch_shape.NumElements();
+    const int64_t k = is_vector ? 1 : B_shape[B_shape.size() - 1];
+    X = Tensor::Empty(B_shape, B.GetDtype(), B.GetDevice());
+    if (batch_size == 0 || k == 0) {
+        return;
+    }
+
+    const Tensor A_batch = A.Contiguous().Reshape({batch_size, n, n});
+    const Tensor B_batch = B.Contiguous().Reshape({batch_size, n, k});
+    Tensor X_batch = X.View({batch_size, n, k});
+    if (A.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedSolveCUDA(A_batch, B_batch, X_batch);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedSolveCPU(A_batch, B_batch, X_batch);
+    }
+}
+
+void BatchedInverse(const Tensor& A, Tensor& output) {
+    const int64_t n = CheckBatchedSquareMatrices(A);
+    if (n != 3 && n != 4 && n != 6) {
+        utility::LogError("Only 3 x 3, 4 x 4 and 6 x 6 matrices are supported, "
+                          "but got {} x {}.",
+                          n, n);
+    }
+
+    const int64_t batch_size = A.NumElements() / (n * n);
+    output = Tensor::Empty(A.GetShape(), A.GetDtype(), A.GetDevice());
+    if (batch_size == 0) {
+        return;
+    }
+
+    const Tensor A_batch = A.Contiguous().Reshape({batch_size, n, n});
+    Tensor output_batch = output.View({batch_size, n, n});
+    if (A.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedInverseCUDA(A_batch, output_batch);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedInverseCPU(A_batch, output_batch);
+    }
+}
+
+void BatchedSVD3x3(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    const int64_t n = CheckBatchedSquareMatrices(A);
+    if (n != 3) {
+        utility::LogError("Only 3 x 3 matrices are supported, but got {} x {}.",
+                          n, n);
+    }
+
+    const SizeVector& A_shape = A.GetShape();
+    const SizeVector S_shape(A_shape.begin(), A_shape.end() - 1);
+    const int64_t batch_size = A.NumElements() / 9;
+    U = Tensor::Empty(A_shape, A.GetDtype(), A.GetDevice());
+    S = Tensor::Empty(S_shape, A.GetDtype(), A.GetDevice());
+    VT = Tensor::Empty(A_shape, A.GetDtype(), A.GetDevice());
+    if (batch_size == 0) {
+        return;
+    }
+
+    const Tensor A_batch = A.Contiguous().Reshape({batch_size, 3, 3});
+    Tensor U_batch = U.View({batch_size, 3, 3});
+    Tensor S_batch = S.View({batch_size, 3});
+    Tensor VT_batch = VT.View({batch_size, 3, 3});
+    if (A.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedSVD3x3CUDA(A_batch, U_batch, S_batch, VT_batch);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedSVD3x3CPU(A_batch, U_batch, S_batch, VT_batch);
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
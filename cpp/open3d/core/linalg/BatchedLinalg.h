@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Solves A_i X_i = B_i for a batch of small square matrices with in-register
+/// LU factorizations, one matrix per thread. Prefer this over Solve() for
+/// many tiny systems, e.g. per-point or per-correspondence problems.
+///
+/// \param A Tensor of shape {..., n, n} with n in {3, 4, 6}. The leading
+/// dimensions are the batch dimensions.
+/// \param B Tensor of shape {..., n} (vectors) or {..., n, k} (matrices) with
+/// the same batch dimensions as \p A.
+/// \param X Output with the same shape as \p B.
+///
+/// Singular matrices are not detected, their solutions are non-finite.
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Computes A_i^{-1} for a batch of small square matrices.
+///
+/// \param A Tensor of shape {..., n, n} with n in {3, 4, 6}.
+/// \param output Output with the same shape as \p A.
+///
+/// Singular matrices are not detected, their inverses are non-finite.
+void BatchedInverse(const Tensor& A, Tensor& output);
+
+/// Computes A_i = U_i diag(S_i) VT_i for a batch of 3 x 3 matrices with the
+/// closed-form iterative method of McAdams et al.
+///
+/// \param A Tensor of shape {..., 3, 3}.
+/// \param U Output of shape {..., 3, 3}.
+/// \param S Output of shape {..., 3}, non-negative and in descending order.
+/// \param VT Output of shape {..., 3, 3}.
+void BatchedSVD3x3(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,176 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/BatchedLinalgImpl.h"
+#include "open3d/core/linalg/kernel/Matrix.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
+
+namespace open3d {
+namespace core {
+
+// The kernels cannot be static functions since on Windows a function enclosing
+// a __device__ lambda function must have external linkage.
+template <typename scalar_t, int N>
+void BatchedSolveCUDAKernel(const Tensor& A, const Tensor& B, Tensor& X) {
+    const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+    const scalar_t* B_ptr = B.GetDataPtr<scalar_t>();
+    scalar_t* X_ptr = X.GetDataPtr<scalar_t>();
+    const int64_t batch_size = A.GetShape(0);
+    const int64_t k = B.GetShape(2);
+
+    core::ParallelFor(
+            A.GetDevice(), batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                scalar_t LU[N * N];
+                int pivots[N];
+                for (int i = 0; i < N * N; ++i) {
+                    LU[i] = A_ptr[workload_idx * N * N + i];
+                }
+                linalg::kernel::lu_factor_nxn<scalar_t, N>(LU, pivots);
+
+                const int64_t offset = workload_idx * N * k;
+                for (int64_t j = 0; j < k; ++j) {
+                    scalar_t x[N];
+                    for (int i = 0; i < N; ++i) {
+                        x[i] = B_ptr[offset + i * k + j];
+                    }
+                    linalg::kernel::lu_solve_nxn<scalar_t, N>(LU, pivots, x);
+                    for (int i = 0; i < N; ++i) {
+                        X_ptr[offset + i * k + j] = x[i];
+                    }
+                }
+            });
+}
+
+template <typename scalar_t, int N>
+void BatchedInverseCUDAKernel(const Tensor& A, Tensor& output) {
+    const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+    scalar_t* output_ptr = output.GetDataPtr<scalar_t>();
+    const int64_t batch_size = A.GetShape(0);
+
+    core::ParallelFor(
+            A.GetDevice(), batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                scalar_t LU[N * N];
+                int pivots[N];
+                for (int i = 0; i < N * N; ++i) {
+                    LU[i] = A_ptr[workload_idx * N * N + i];
+                }
+                linalg::kernel::lu_factor_nxn<scalar_t, N>(LU, pivots);
+
+                // Solve for the columns of the identity matrix.
+                scalar_t* inv_ptr = output_ptr + workload_idx * N * N;
+                for (int j = 0; j < N; ++j) {
+                    scalar_t x[N];
+                    for (int i = 0; i < N; ++i) {
+                        x[i] = i == j ? 1 : 0;
+                    }
+                    linalg::kernel::lu_solve_nxn<scalar_t, N>(LU, pivots, x);
+                    for (int i = 0; i < N; ++i) {
+                        inv_ptr[i * N + j] = x[i];
+                    }
+                }
+            });
+}
+
+template <typename scalar_t>
+void BatchedSVD3x3CUDAKernel(const Tensor& A,
+                             Tensor& U,
+                             Tensor& S,
+                             Tensor& VT) {
+    const scalar_t* A_ptr = A.GetDataPtr<scalar_t>();
+    scalar_t* U_ptr = U.GetDataPtr<scalar_t>();
+    scalar_t* S_ptr = S.GetDataPtr<scalar_t>();
+    scalar_t* VT_ptr = VT.GetDataPtr<scalar_t>();
+    const int64_t batch_size = A.GetShape(0);
+
+    core::ParallelFor(
+            A.GetDevice(), batch_size, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                scalar_t* U_3x3 = U_ptr + workload_idx * 9;
+                scalar_t* S_3x1 = S_ptr + workload_idx * 3;
+                scalar_t V_3x3[9];
+                linalg::kernel::svd3x3(A_ptr + workload_idx * 9, U_3x3, S_3x1,
+                                       V_3x3, /*num_sweeps=*/6);
+                linalg::kernel::transpose3x3(V_3x3, VT_ptr + workload_idx * 9);
+
+                // U and V are rotations, so the smallest singular value is
+                // negative if det(A) < 0. Move the sign into U.
+                if (S_3x1[2] < 0) {
+                    S_3x1[2] = -S_3x1[2];
+                    U_3x3[2] = -U_3x3[2];
+                    U_3x3[5] = -U_3x3[5];
+                    U_3x3[8] = -U_3x3[8];
+                }
+            });
+}
+
+void BatchedSolveCUDA(const Tensor& A, const Tensor& B, Tensor& X) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        switch (A.GetShape(1)) {
+            case 3:
+                BatchedSolveCUDAKernel<scalar_t, 3>(A, B, X);
+                break;
+            case 4:
+                BatchedSolveCUDAKernel<scalar_t, 4>(A, B, X);
+                break;
+            case 6:
+                BatchedSolveCUDAKernel<scalar_t, 6>(A, B, X);
+                break;
+            default:
+                utility::LogError("Unsupported matrix size {}.",
+                                  A.GetShape(1));
+        }
+    });
+}
+
+void BatchedInverseCUDA(const Tensor& A, Tensor& output) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        switch (A.GetShape(1)) {
+            case 3:
+                BatchedInverseCUDAKernel<scalar_t, 3>(A, output);
+                break;
+            case 4:
+                BatchedInverseCUDAKernel<scalar_t, 4>(A, output);
+                break;
+            case 6:
+                BatchedInverseCUDAKernel<scalar_t, 6>(A, output);
+                break;
+            default:
+                utility::LogError("Unsupported matrix size {}.",
+                                  A.GetShape(1));
+        }
+    });
+}
+
+void BatchedSVD3x3CUDA(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        BatchedSVD3x3CUDAKernel<scalar_t>(A, U, S, VT);
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,51 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+namespace open3d {
+namespace core {
+
+// All tensors are contiguous. A is {batch, n, n}, B and X are {batch, n, k}.
+void BatchedSolveCPU(const Tensor& A, const Tensor& B, Tensor& X);
+
+void BatchedInverseCPU(const Tensor& A, Tensor& output);
+
+void BatchedSVD3x3CPU(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+#ifdef BUILD_CUDA_MODULE
+void BatchedSolveCUDA(const Tensor& A, const Tensor& B, Tensor& X);
+
+void BatchedInverseCUDA(const Tensor& A, Tensor& output);
+
+void BatchedSVD3x3CUDA(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -174,6 +174,141 @@ inline cublasStatus_t gemm_cuda<double>(cublasHandle_t handle,
                        beta, static_cast<double *>(C_data), ldc);
 }
 
+template <typename scalar_t>
+inline cublasStatus_t gemm_strided_batched_cuda(cublasHandle_t handle,
+                                                cublasOperation_t transa,
+                                                cublasOperation_t transb,
+                                                int m,
+                                                int n,
+                                                int k,
+                                                const scalar_t *alpha,
+                                                const scalar_t *A_data,
+                                                int lda,
+                                                long long int stride_A,
+                                                const scalar_t *B_data,
+                                                int ldb,
+                                                long long int stride_B,
+                                                const scalar_t *beta,
+                                                scalar_t *C_data,
+                                                int ldc,
+                                                long long int stride_C,
+                                                int batch_size) {
+    utility::LogError("Unsupported data type.");
+    return CUBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <>
+inline cublasStatus_t gemm_strided_batched_cuda<float>(
+        cublasHandle_t handle,
+        cublasOperation_t transa,
+        cublasOperation_t transb,
+        int m,
+        int n,
+        int k,
+        const float *alpha,
+        const float *A_data,
+        int lda,
+        long long int stride_A,
+        const float *B_data,
+        int ldb,
+        long long int stride_B,
+        const float *beta,
+        float *C_data,
+        int ldc,
+        long long int stride_C,
+        int batch_size) {
+    return cublasSgemmStridedBatched(handle, transa, transb, m, n, k, alpha,
+                                     A_data, lda, stride_A, B_data, ldb,
+                                     stride_B, beta, C_data, ldc, stride_C,
+                                     batch_size);
+}
+
+template <>
+inline cublasStatus_t gemm_strided_batched_cuda<double>(
+        cublasHandle_t handle,
+        cublasOperation_t transa,
+        cublasOperation_t transb,
+        int m,
+        int n,
+        int k,
+        const double *alpha,
+        const double *A_data,
+        int lda,
+        long long int stride_A,
+        const double *B_data,
+        int ldb,
+        long long int stride_B,
+        const double *beta,
+        double *C_data,
+        int ldc,
+        long long int stride_C,
+        int batch_size) {
+    return cublasDgemmStridedBatched(handle, transa, transb, m, n, k, alpha,
+                                     A_data, lda, stride_A, B_data, ldb,
+                                     stride_B, beta, C_data, ldc, stride_C,
+                                     batch_size);
+}
+
+/// GEMM on half-precision A, B and C of \p data_type (CUDA_R_16F or
+/// CUDA_R_16BF) with Float32 accumulation, using Tensor Cores if available.
+inline cublasStatus_t gemm_ex_cuda(cublasHandle_t handle,
+                                   cublasOperation_t transa,
+                                   cublasOperation_t transb,
+                                   int m,
+                                   int n,
+                                   int k,
+                                   const float *alpha,
+                                   const void *A_data,
+                                   int lda,
+                                   const void *B_data,
+                                   int ldb,
+                                   const float *beta,
+                                   void *C_data,
+                                   int ldc,
+                                   cudaDataType_t data_type) {
+#if CUDART_VERSION >= 11000
+    const cublasComputeType_t compute_type = CUBLAS_COMPUTE_32F;
+#else
+    const cudaDataType_t compute_type = CUDA_R_32F;
+#endif
+    return cublasGemmEx(handle, transa, transb, m, n, k, alpha, A_data,
+                        data_type, lda, B_data, data_type, ldb, beta, C_data,
+                        data_type, ldc, compute_type,
+                        CUBLAS_GEMM_DEFAULT_TENSOR_OP);
+}
+
+/// Strided batched version of gemm_ex_cuda().
+inline cublasStatus_t gemm_strided_batched_ex_cuda(cublasHandle_t handle,
+                                                   cublasOperation_t transa,
+                                                   cublasOperation_t transb,
+                                                   int m,
+                                                   int n,
+                                                   int k,
+                                                   const float *alpha,
+                                                   const void *A_data,
+                                                   int lda,
+                                                   long long int stride_A,
+                                                   const void *B_data,
+                                                   int ldb,
+                                                   long long int stride_B,
+                                                   const float *beta,
+                                                   void *C_data,
+                                                   int ldc,
+                                                   long long int stride_C,
+                                                   int batch_size,
+                                                   cudaDataType_t data_type) {
+#if CUDART_VERSION >= 11000
+    const cublasComputeType_t compute_type = CUBLAS_COMPUTE_32F;
+#else
+    const cudaDataType_t compute_type = CUDA_R_32F;
+#endif
+    return cublasGemmStridedBatchedEx(
+            handle, transa, transb, m, n, k, alpha, A_data, data_type, lda,
+            stride_A, B_data, data_type, ldb, stride_B, beta, C_data,
+            data_type, ldc, stride_C, batch_size, compute_type,
+            CUBLAS_GEMM_DEFAULT_TENSOR_OP);
+}
+
 template <>
 inline cublasStatus_t trsm_cuda<float>(cublasHandle_t handle,
                                        cublasSideMode_t side,
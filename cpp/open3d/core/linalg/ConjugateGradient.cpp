@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/ConjugateGradient.h"
+
+#include <cmath>
+
+namespace open3d {
+namespace core {
+
+/// Dot product of two 1D tensors, read back as a double.
+static double Dot(const Tensor& a, const Tensor& b) {
+    return a.Mul(b).Sum({0}).To(Float64).Item<double>();
+}
+
+Tensor SolveCG(const SparseMatrix& A,
+               const Tensor& b,
+               const Tensor& x0,
+               double relative_tolerance,
+               int64_t max_iterations,
+               bool use_jacobi_preconditioner) {
+    const int64_t n = A.GetNumRows();
+    if (A.GetNumCols() != n) {
+        utility::LogError("Matrix A must be square, but got {} x {}.", n,
+                          A.GetNumCols());
+    }
+    AssertTensorDtype(b, A.GetDtype());
+    AssertTensorDevice(b, A.GetDevice());
+    AssertTensorShape(b, {n});
+
+    std::function<Tensor(const Tensor&)> apply_preconditioner;
+    if (use_jacobi_preconditioner) {
+        const Tensor diagonal = A.Diagonal();
+        const Tensor safe_diagonal =
+                diagonal.Add(diagonal.Eq(0).To(A.GetDtype()));
+        const Tensor inv_diagonal =
+                Tensor::Ones({n}, A.GetDtype(), A.GetDevice())
+                        .Div(safe_diagonal);
+        apply_preconditioner = [inv_diagonal](const Tensor& r) {
+            return r.Mul(inv_diagonal);
+        };
+    }
+    return SolveCG([&A](const Tensor& x) { return A.SpMV(x); }, b, x0,
+                   relative_tolerance, max_iterations, apply_preconditioner);
+}
+
+Tensor SolveCG(const std::function<Tensor(const Tensor&)>& apply_A,
+               const Tensor& b,
+               const Tensor& x0,
+               double relative_tolerance,
+               int64_t max_iterations,
+               const std::function<Tensor(const Tensor&)>&
+                       apply_preconditioner) {
+    AssertTensorDtypes(b, {Float32, Float64});
+    if (b.NumDims() != 1) {
+        utility::LogError("b must be a 1D tensor, but got shape {}.",
+                          b.GetShape());
+    }
+    const int64_t n = b.GetLength();
+    if (max_iterations < 0) {
+        utility::LogError("max_iterations must be non-negative, but got {}.",
+                          max_iterations);
+    }
+
+    Tensor x;
+    if (x0.NumElements() == 0) {
+        x = Tensor::Zeros({n}, b.GetDtype(), b.GetDevice());
+    } else {
+        AssertTensorDtype(x0, b.GetDtype());
+        AssertTensorDevice(x0, b.GetDevice());
+        AssertTensorShape(x0, {n});
+        x = x0.Clone();
+    }
+
+    const double b_norm = std::sqrt(Dot(b, b));
+    if (b_norm == 0) {
+        return Tensor::Zeros({n}, b.GetDtype(), b.GetDevice());
+    }
+    const double threshold = relative_tolerance * b_norm;
+
+    auto precondition = [&](const Tensor& r) {
+        return apply_preconditioner ? apply_preconditioner(r) : r.Clone();
+    };
+
+    Tensor r = b.Sub(apply_A(x));
+    double r_norm = std::sqrt(Dot(r, r));
+    Tensor z = precondition(r);
+    Tensor p = z.Clone();
+    double rz = Dot(r, z);
+
+    int64_t iteration = 0;
+    for (; iteration < max_iterations && r_norm > threshold; ++iteration) {
+        const Tensor Ap = apply_A(p);
+        const double pAp = Dot(p, Ap);
+        if (pAp <= 0) {
+            utility::LogWarning(
+                    "SolveCG: p^T A p = {} is not positive, A is not "
+                    "positive definite.",
+                    pAp);
+            break;
+        }
+        const double alpha = rz / pAp;
+        x.Add_(p.Mul(alpha));
+        r.Sub_(Ap.Mul(alpha));
+        r_norm = std::sqrt(Dot(r, r));
+
+        z = precondition(r);
+        const double rz_new = Dot(r, z);
+        p = z.Add_(p.Mul(rz_new / rz));
+        rz = rz_new;
+    }
+
+    if (r_norm > threshold) {
+        utility::LogWarning(
+                "SolveCG did not converge after {} iterations, relative "
+                "residual {}.",
+                iteration, r_norm / b_norm);
+    } else {
+        utility::LogDebug("SolveCG converged after {} iterations.",
+                          iteration);
+    }
+    return x;
+}
+
+}  // namespace core
+}  // namespace open3d
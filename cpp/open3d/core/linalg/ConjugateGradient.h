@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/SparseMatrix.h"
+
+namespace open3d {
+namespace core {
+
+/// Solves A x = b for a symmetric positive definite sparse matrix A with the
+/// Jacobi (diagonal) preconditioned conjugate gradient method. All work
+/// stays on the device of \p A; only scalar reductions are read back.
+///
+/// \param A Square SPD sparse matrix, Float32 or Float64.
+/// \param b Tensor of shape {n} with the dtype and device of \p A.
+/// \param x0 Initial guess of shape {n}, or an empty Tensor to start from 0.
+/// \param relative_tolerance Stops when ||b - A x|| <= relative_tolerance *
+/// ||b||.
+/// \param max_iterations Maximum number of iterations.
+/// \param use_jacobi_preconditioner Scales residuals by the inverse diagonal
+/// of \p A. Rows with a zero diagonal are left unscaled.
+/// \return The solution x of shape {n}.
+Tensor SolveCG(const SparseMatrix& A,
+               const Tensor& b,
+               const Tensor& x0 = Tensor(),
+               double relative_tolerance = 1e-6,
+               int64_t max_iterations = 1000,
+               bool use_jacobi_preconditioner = true);
+
+/// Solves A x = b with the preconditioned conjugate gradient method, for a
+/// symmetric positive definite A given as an operator. This lets callers with
+/// their own matrix storage, e.g. block sparse matrices, share the solver.
+///
+/// \param apply_A Returns A x for a tensor x of shape {n}.
+/// \param b Float32 or Float64 tensor of shape {n}.
+/// \param x0 Initial guess of shape {n}, or an empty Tensor to start from 0.
+/// \param relative_tolerance Stops when ||b - A x|| <= relative_tolerance *
+/// ||b||.
+/// \param max_iterations Maximum number of iterations.
+/// \param apply_preconditioner Returns M^-1 r for a residual r, where M
+/// approximates A. Leave empty for no preconditioning.
+/// \return The solution x of shape {n}.
+Tensor SolveCG(const std::function<Tensor(const Tensor&)>& apply_A,
+               const Tensor& b,
+               const Tensor& x0 = Tensor(),
+               double relative_tolerance = 1e-6,
+               int64_t max_iterations = 1000,
+               const std::function<Tensor(const Tensor&)>&
+                       apply_preconditioner = nullptr);
+
+}  // namespace core
+}  // namespace open3d
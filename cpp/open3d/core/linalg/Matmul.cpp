@@ -28,24 +28,38 @@
 
 #include <unordered_map>
 
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/OpProfiler.h"
+#include "open3d/utility/Profiler.h"
+
 namespace open3d {
 namespace core {
 
+/// Returns the dtype the backends compute \p dtype in. cuBLAS multiplies
+/// Float16 and BFloat16 natively, everything else but Float32 and Float64 is
+/// converted to Float32.
+static Dtype GetMatmulDtype(const Dtype& dtype, const Device& device) {
+    if (dtype == core::Float32 || dtype == core::Float64) {
+        return dtype;
+    }
+    if ((dtype == core::Float16 || dtype == core::BFloat16) &&
+        device.GetType() == Device::DeviceType::CUDA) {
+        return dtype;
+    }
+    utility::LogDebug("Converting to Float32 dtype to from {}.",
+                      dtype.ToString());
+    return core::Float32;
+}
+
 void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
+    OPEN3D_PROFILE_ZONE("core", "Matmul");
     AssertTensorDevice(B, A.GetDevice());
     AssertTensorDtype(B, A.GetDtype());
 
     const Device device = A.GetDevice();
     const Dtype dtype_original = A.GetDtype();
-    Dtype dtype;
-
-    if (dtype_original != core::Float32 && dtype_original != core::Float64) {
-        utility::LogDebug("Converting to Float32 dtype to from {}.",
-                          dtype_original.ToString());
-        dtype = core::Float32;
-    } else {
-        dtype = dtype_original;
-    }
+    const Dtype dtype = GetMatmulDtype(dtype_original, device);
 
     // Check shapes
     SizeVector A_shape = A.GetShape();
@@ -74,6 +88,8 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
                 "Tensor shapes should not contain dimensions with zero.");
     }
 
+    kernel::ScopedOpTimer op_timer("Matmul", nullptr, device, {&A, &B},
+                                   output);
     Tensor A_contiguous = A.Contiguous().To(dtype);
     Tensor B_contiguous = B.Contiguous().To(dtype);
     void* A_data = A_contiguous.GetDataPtr();
@@ -84,6 +100,7 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
 
     if (device.GetType() == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
+        OPEN3D_PROFILE_CUDA_ZONE("core", "Matmul", device);
         MatmulCUDA(B_data, A_data, C_data, n, k, m, dtype);
 #else
         utility::LogError("Unimplemented device.");
@@ -95,5 +112,94 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
     output = output.To(dtype_original);
 };
 
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& output) {
+    OPEN3D_PROFILE_ZONE("core", "BatchedMatmul");
+    AssertTensorDevice(B, A.GetDevice());
+    AssertTensorDtype(B, A.GetDtype());
+
+    const Device device = A.GetDevice();
+    const Dtype dtype_original = A.GetDtype();
+    const Dtype dtype = GetMatmulDtype(dtype_original, device);
+
+    // Check shapes
+    const SizeVector A_shape = A.GetShape();
+    const SizeVector B_shape = B.GetShape();
+    if (A_shape.size() < 2) {
+        utility::LogError("Tensor A must be at least 2D, but got {}D.",
+                          A_shape.size());
+    }
+    if (B_shape.size() < 2) {
+        utility::LogError("Tensor B must be at least 2D, but got {}D.",
+                          B_shape.size());
+    }
+    const int64_t m = A_shape[A_shape.size() - 2];
+    const int64_t k = A_shape[A_shape.size() - 1];
+    const int64_t n = B_shape[B_shape.size() - 1];
+    if (B_shape[B_shape.size() - 2] != k) {
+        utility::LogError("Tensor A columns {} mismatch with Tensor B rows {}.",
+                          k, B_shape[B_shape.size() - 2]);
+    }
+
+    const SizeVector A_batch_shape(A_shape.begin(), A_shape.end() - 2);
+    const SizeVector B_batch_shape(B_shape.begin(), B_shape.end() - 2);
+    if (!shape_util::IsCompatibleBroadcastShape(A_batch_shape,
+                                                B_batch_shape)) {
+        utility::LogError("Batch shapes {} and {} are not broadcastable.",
+                          A_batch_shape.ToString(), B_batch_shape.ToString());
+    }
+    const SizeVector batch_shape =
+            shape_util::BroadcastedShape(A_batch_shape, B_batch_shape);
+    const int64_t batch_size = batch_shape.NumElements();
+
+    SizeVector output_shape = batch_shape;
+    output_shape.push_back(m);
+    output_shape.push_back(n);
+    if (batch_size == 0 || m == 0 || n == 0 || k == 0) {
+        output = Tensor::Zeros(output_shape, dtype_original, device);
+        return;
+    }
+
+    // A matrix shared by all batches gets a stride of 0, other operands are
+    // expanded to the full batch shape.
+    auto prepare = [&](const Tensor& t, const SizeVector& t_batch_shape,
+                       int64_t rows, int64_t cols, int64_t& stride) {
+        if (t_batch_shape.NumElements() == 1) {
+            stride = 0;
+            return t.Reshape({rows, cols}).Contiguous().To(dtype);
+        }
+        SizeVector expanded_shape = batch_shape;
+        expanded_shape.push_back(rows);
+        expanded_shape.push_back(cols);
+        stride = rows * cols;
+        return t.Expand(expanded_shape).Contiguous().To(dtype);
+    };
+    kernel::ScopedOpTimer op_timer("BatchedMatmul", nullptr, device, {&A, &B},
+                                   output);
+    int64_t stride_A, stride_B;
+    Tensor A_contiguous = prepare(A, A_batch_shape, m, k, stride_A);
+    Tensor B_contiguous = prepare(B, B_batch_shape, k, n, stride_B);
+    void* A_data = A_contiguous.GetDataPtr();
+    void* B_data = B_contiguous.GetDataPtr();
+
+    output = Tensor::Empty(output_shape, dtype, device);
+    void* C_data = output.GetDataPtr();
+
+    // Row-major C = AB is column-major C^T = B^T A^T.
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        OPEN3D_PROFILE_CUDA_ZONE("core", "BatchedMatmul", device);
+        BatchedMatmulCUDA(B_data, A_data, C_data, n, k, m, stride_B, stride_A,
+                          m * n, batch_size, dtype);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedMatmulCPU(B_data, A_data, C_data, n, k, m, stride_B, stride_A,
+                         m * n, batch_size, dtype);
+    }
+
+    output = output.To(dtype_original);
+}
+
 }  // namespace core
 }  // namespace open3d
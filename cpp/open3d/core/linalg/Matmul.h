@@ -32,8 +32,23 @@ namespace open3d {
 namespace core {
 
 /// Computes matrix multiplication C = AB.
+///
+/// On CUDA, Float16 and BFloat16 matrices are multiplied with cublasGemmEx
+/// with Float32 accumulation, which runs on Tensor Cores where available.
+/// Other dtypes than Float32 and Float64 are computed in Float32. C has the
+/// dtype of A and B.
 void Matmul(const Tensor& A, const Tensor& B, Tensor& C);
 
+/// Computes C_i = A_i B_i for stacks of matrices, e.g. for transforming many
+/// point sets by many poses.
+///
+/// \param A Tensor of shape {..., m, k}.
+/// \param B Tensor of shape {..., k, n}. The batch dimensions of A and B are
+/// broadcast against each other. A single matrix on either side is shared
+/// by all batches without being copied.
+/// \param C Output of shape {..., m, n}. Dtypes are handled as in Matmul().
+void BatchedMatmul(const Tensor& A, const Tensor& B, Tensor& C);
+
 #ifdef BUILD_CUDA_MODULE
 void MatmulCUDA(void* A_data,
                 void* B_data,
@@ -42,6 +57,18 @@ void MatmulCUDA(void* A_data,
                 int64_t k,
                 int64_t n,
                 Dtype dtype);
+
+void BatchedMatmulCUDA(void* A_data,
+                       void* B_data,
+                       void* C_data,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       int64_t stride_A,
+                       int64_t stride_B,
+                       int64_t stride_C,
+                       int64_t batch_size,
+                       Dtype dtype);
 #endif
 void MatmulCPU(void* A_data,
                void* B_data,
@@ -50,5 +77,17 @@ void MatmulCPU(void* A_data,
                int64_t k,
                int64_t n,
                Dtype dtype);
+
+void BatchedMatmulCPU(void* A_data,
+                      void* B_data,
+                      void* C_data,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      int64_t stride_A,
+                      int64_t stride_B,
+                      int64_t stride_C,
+                      int64_t batch_size,
+                      Dtype dtype);
 }  // namespace core
 }  // namespace open3d
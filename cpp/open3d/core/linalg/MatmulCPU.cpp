@@ -46,5 +46,30 @@ void MatmulCPU(void* A_data,
     });
 }
 
+void BatchedMatmulCPU(void* A_data,
+                      void* B_data,
+                      void* C_data,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      int64_t stride_A,
+                      int64_t stride_B,
+                      int64_t stride_C,
+                      int64_t batch_size,
+                      Dtype dtype) {
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t alpha = 1, beta = 0;
+        const scalar_t* A_ptr = static_cast<const scalar_t*>(A_data);
+        const scalar_t* B_ptr = static_cast<const scalar_t*>(B_data);
+        scalar_t* C_ptr = static_cast<scalar_t*>(C_data);
+        for (int64_t i = 0; i < batch_size; ++i) {
+            gemm_cpu<scalar_t>(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n,
+                               k, alpha, A_ptr + i * stride_A, m,
+                               B_ptr + i * stride_B, k, beta,
+                               C_ptr + i * stride_C, m);
+        }
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
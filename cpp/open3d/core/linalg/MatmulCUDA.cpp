@@ -32,6 +32,22 @@
 namespace open3d {
 namespace core {
 
+static bool IsHalfDtype(Dtype dtype) {
+    return dtype == core::Float16 || dtype == core::BFloat16;
+}
+
+static cudaDataType_t GetCUDAHalfDataType(Dtype dtype) {
+    if (dtype == core::Float16) {
+        return CUDA_R_16F;
+    }
+#if CUDART_VERSION >= 11000
+    return CUDA_R_16BF;
+#else
+    utility::LogError("BFloat16 Matmul requires CUDA 11 or newer.");
+    return CUDA_R_16F;
+#endif
+}
+
 void MatmulCUDA(void* A_data,
                 void* B_data,
                 void* C_data,
@@ -40,6 +56,15 @@ void MatmulCUDA(void* A_data,
                 int64_t n,
                 Dtype dtype) {
     cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    if (IsHalfDtype(dtype)) {
+        const float alpha = 1, beta = 0;
+        OPEN3D_CUBLAS_CHECK(
+                gemm_ex_cuda(handle, CUBLAS_OP_N, CUBLAS_OP_N, m, n, k, &alpha,
+                             A_data, m, B_data, k, &beta, C_data, m,
+                             GetCUDAHalfDataType(dtype)),
+                "cuda gemm failed");
+        return;
+    }
     DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t alpha = 1, beta = 0;
         OPEN3D_CUBLAS_CHECK(
@@ -52,5 +77,40 @@ void MatmulCUDA(void* A_data,
     });
 }
 
+void BatchedMatmulCUDA(void* A_data,
+                       void* B_data,
+                       void* C_data,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       int64_t stride_A,
+                       int64_t stride_B,
+                       int64_t stride_C,
+                       int64_t batch_size,
+                       Dtype dtype) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    if (IsHalfDtype(dtype)) {
+        const float alpha = 1, beta = 0;
+        OPEN3D_CUBLAS_CHECK(
+                gemm_strided_batched_ex_cuda(
+                        handle, CUBLAS_OP_N, CUBLAS_OP_N, m, n, k, &alpha,
+                        A_data, m, stride_A, B_data, k, stride_B, &beta, C_data,
+                        m, stride_C, batch_size, GetCUDAHalfDataType(dtype)),
+                "cuda batched gemm failed");
+        return;
+    }
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t alpha = 1, beta = 0;
+        OPEN3D_CUBLAS_CHECK(
+                gemm_strided_batched_cuda<scalar_t>(
+                        handle, CUBLAS_OP_N, CUBLAS_OP_N, m, n, k, &alpha,
+                        static_cast<const scalar_t*>(A_data), m, stride_A,
+                        static_cast<const scalar_t*>(B_data), k, stride_B,
+                        &beta, static_cast<scalar_t*>(C_data), m, stride_C,
+                        batch_size),
+                "cuda batched gemm failed");
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
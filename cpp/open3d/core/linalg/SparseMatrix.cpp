@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/SparseMatrix.h"
+
+#include <algorithm>
+
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/core/linalg/SparseMatrixImpl.h"
+
+namespace open3d {
+namespace core {
+
+SparseMatrix::SparseMatrix(const Tensor& row_offsets,
+                           const Tensor& col_indices,
+                           const Tensor& values,
+                           int64_t num_cols) {
+    AssertTensorDtype(row_offsets, Int64);
+    AssertTensorDtype(col_indices, Int64);
+    AssertTensorDtypes(values, {Float32, Float64});
+    AssertTensorDevice(row_offsets, values.GetDevice());
+    AssertTensorDevice(col_indices, values.GetDevice());
+    if (row_offsets.NumDims() != 1 || row_offsets.GetLength() < 1) {
+        utility::LogError(
+                "row_offsets must be of shape {{num_rows + 1}}, but got {}.",
+                row_offsets.GetShape());
+    }
+    if (values.NumDims() != 1) {
+        utility::LogError("values must be 1D, but got shape {}.",
+                          values.GetShape());
+    }
+    AssertTensorShape(col_indices, values.GetShape());
+    if (num_cols < 0) {
+        utility::LogError("num_cols must be non-negative, but got {}.",
+                          num_cols);
+    }
+
+    row_offsets_ = row_offsets.Contiguous();
+    col_indices_ = col_indices.Contiguous();
+    values_ = values.Contiguous();
+    num_rows_ = row_offsets.GetLength() - 1;
+    num_cols_ = num_cols;
+}
+
+SparseMatrix SparseMatrix::FromCOO(const Tensor& row_indices,
+                                   const Tensor& col_indices,
+                                   const Tensor& values,
+                                   int64_t num_rows,
+                                   int64_t num_cols) {
+    AssertTensorDtype(row_indices, Int64);
+    AssertTensorDtype(col_indices, Int64);
+    AssertTensorDtypes(values, {Float32, Float64});
+    AssertTensorDevice(row_indices, values.GetDevice());
+    AssertTensorDevice(col_indices, values.GetDevice());
+    if (values.NumDims() != 1) {
+        utility::LogError("values must be 1D, but got shape {}.",
+                          values.GetShape());
+    }
+    AssertTensorShape(row_indices, values.GetShape());
+    AssertTensorShape(col_indices, values.GetShape());
+    if (num_rows < 0 || num_cols < 0) {
+        utility::LogError("Invalid matrix size {} x {}.", num_rows, num_cols);
+    }
+
+    const Device device = values.GetDevice();
+    const int64_t n = values.GetLength();
+    if (n > 0) {
+        const int64_t min_row = row_indices.Min({0}).Item<int64_t>();
+        const int64_t max_row = row_indices.Max({0}).Item<int64_t>();
+        const int64_t min_col = col_indices.Min({0}).Item<int64_t>();
+        const int64_t max_col = col_indices.Max({0}).Item<int64_t>();
+        if (min_row < 0 || max_row >= num_rows || min_col < 0 ||
+            max_col >= num_cols) {
+            utility::LogError(
+                    "Indices out of range for a {} x {} matrix: rows in "
+                    "[{}, {}], cols in [{}, {}].",
+                    num_rows, num_cols, min_row, max_row, min_col, max_col);
+        }
+    }
+
+    // Sorting by the linear index orders entries by row, then by column, and
+    // makes duplicates adjacent so that they can be summed as segments.
+    const Tensor keys = row_indices.Mul(num_cols).Add(col_indices);
+    Tensor sorted_keys, sorted_values;
+    std::tie(sorted_keys, sorted_values) = Tensor::SortByKey(keys, values);
+
+    Tensor group_ids, splits;
+    kernel::SortedGroups(sorted_keys, group_ids, splits);
+    const int64_t nnz = splits.GetLength() - 1;
+    const Tensor unique_keys =
+            sorted_keys.IndexGet({splits.Slice(0, 0, nnz)});
+    const Tensor summed_values = sorted_values.SegmentSum(splits);
+    const Tensor rows = unique_keys.Div(num_cols);
+    const Tensor cols = unique_keys.Sub(rows.Mul(num_cols));
+
+    Tensor row_offsets = Tensor::Empty({num_rows + 1}, Int64, device);
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SparseMatrixRowOffsetsCUDA(rows, row_offsets);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        SparseMatrixRowOffsetsCPU(rows, row_offsets);
+    }
+    return SparseMatrix(row_offsets, cols, summed_values, num_cols);
+}
+
+SparseMatrix SparseMatrix::FromDense(const Tensor& dense) {
+    AssertTensorDtypes(dense, {Float32, Float64});
+    if (dense.NumDims() != 2) {
+        utility::LogError("Tensor must be 2D, but got {}D.", dense.NumDims());
+    }
+    // NonZero() returns row-major ordered indices, FromCOO() sorts anyway.
+    const Tensor indices = dense.NonZero();
+    const Tensor rows = indices[0];
+    const Tensor cols = indices[1];
+    return FromCOO(rows, cols, dense.IndexGet({rows, cols}), dense.GetShape(0),
+                   dense.GetShape(1));
+}
+
+Tensor SparseMatrix::ToDense() const {
+    Tensor dense = Tensor::Zeros({num_rows_, num_cols_}, GetDtype(),
+                                 GetDevice());
+    if (GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SparseMatrixToDenseCUDA(row_offsets_, col_indices_, values_, dense);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        SparseMatrixToDenseCPU(row_offsets_, col_indices_, values_, dense);
+    }
+    return dense;
+}
+
+SparseMatrix SparseMatrix::To(const Device& device, bool copy) const {
+    return SparseMatrix(row_offsets_.To(device, copy),
+                        col_indices_.To(device, copy),
+                        values_.To(device, copy), num_cols_);
+}
+
+Tensor SparseMatrix::SpMV(const Tensor& x) const {
+    AssertTensorDtype(x, GetDtype());
+    AssertTensorDevice(x, GetDevice());
+    if ((x.NumDims() != 1 && x.NumDims() != 2) || x.GetShape(0) != num_cols_) {
+        utility::LogError(
+                "Expected x of shape {{{}}} or {{{}, k}}, but got {}.",
+                num_cols_, num_cols_, x.GetShape());
+    }
+
+    const int64_t k = x.NumDims() == 2 ? x.GetShape(1) : 1;
+    const Tensor x_2d = x.Contiguous().Reshape({num_cols_, k});
+    Tensor y = Tensor::Empty({num_rows_, k}, GetDtype(), GetDevice());
+    if (GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SparseMatrixSpMVCUDA(row_offsets_, col_indices_, values_, x_2d, y);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        SparseMatrixSpMVCPU(row_offsets_, col_indices_, values_, x_2d, y);
+    }
+    return x.NumDims() == 1 ? y.Reshape({num_rows_}) : y;
+}
+
+Tensor SparseMatrix::Diagonal() const {
+    Tensor diagonal = Tensor::Empty({std::min(num_rows_, num_cols_)},
+                                    GetDtype(), GetDevice());
+    if (GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SparseMatrixDiagonalCUDA(row_offsets_, col_indices_, values_,
+                                 diagonal);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        SparseMatrixDiagonalCPU(row_offsets_, col_indices_, values_, diagonal);
+    }
+    return diagonal;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Sparse matrix in compressed sparse row (CSR) format, backed by Tensors so
+/// that it can be built, multiplied and solved on any device.
+///
+/// Row i stores its column indices and values in
+/// col_indices[row_offsets[i]:row_offsets[i + 1]] and
+/// values[row_offsets[i]:row_offsets[i + 1]].
+class SparseMatrix {
+public:
+    SparseMatrix() {}
+
+    /// Constructs a matrix from CSR arrays, which are shared, not copied.
+    ///
+    /// \param row_offsets Int64 tensor of shape {num_rows + 1}, starting with
+    /// 0 and ending with the number of stored entries.
+    /// \param col_indices Int64 tensor of shape {nnz}.
+    /// \param values Float32 or Float64 tensor of shape {nnz}.
+    /// \param num_cols Number of columns of the matrix.
+    SparseMatrix(const Tensor& row_offsets,
+                 const Tensor& col_indices,
+                 const Tensor& values,
+                 int64_t num_cols);
+
+    /// Builds a CSR matrix from coordinate (COO) triplets. The triplets may
+    /// be in any order; duplicate entries are summed, so assembling a system
+    /// from per-element contributions needs no extra reduction.
+    ///
+    /// \param row_indices Int64 tensor of shape {n}.
+    /// \param col_indices Int64 tensor of shape {n}.
+    /// \param values Float32 or Float64 tensor of shape {n}.
+    static SparseMatrix FromCOO(const Tensor& row_indices,
+                                const Tensor& col_indices,
+                                const Tensor& values,
+                                int64_t num_rows,
+                                int64_t num_cols);
+
+    /// Builds a CSR matrix from the non-zero entries of a 2D dense tensor.
+    static SparseMatrix FromDense(const Tensor& dense);
+
+    /// Returns the dense {num_rows, num_cols} tensor of the matrix.
+    Tensor ToDense() const;
+
+    /// Returns the matrix on \p device. The arrays are shared if the matrix
+    /// is already there and \p copy is false.
+    SparseMatrix To(const Device& device, bool copy = false) const;
+
+    /// Sparse matrix-vector product A x.
+    ///
+    /// \param x Tensor of shape {num_cols} or {num_cols, k}, with the dtype
+    /// and device of the matrix.
+    /// \return Tensor of shape {num_rows} or {num_rows, k}.
+    Tensor SpMV(const Tensor& x) const;
+
+    /// Returns the {min(num_rows, num_cols)} diagonal, 0 where not stored.
+    Tensor Diagonal() const;
+
+    int64_t GetNumRows() const { return num_rows_; }
+    int64_t GetNumCols() const { return num_cols_; }
+    int64_t GetNNZ() const { return values_.GetLength(); }
+    Dtype GetDtype() const { return values_.GetDtype(); }
+    Device GetDevice() const { return values_.GetDevice(); }
+
+    const Tensor& GetRowOffsets() const { return row_offsets_; }
+    const Tensor& GetColIndices() const { return col_indices_; }
+    const Tensor& GetValues() const { return values_; }
+
+private:
+    Tensor row_offsets_;
+    Tensor col_indices_;
+    Tensor values_;
+    int64_t num_rows_ = 0;
+    int64_t num_cols_ = 0;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/SparseMatrixImpl.h"
+
+namespace open3d {
+namespace core {
+
+void SparseMatrixSpMVCPU(const Tensor& row_offsets,
+                         const Tensor& col_indices,
+                         const Tensor& values,
+                         const Tensor& x,
+                         Tensor& y) {
+    const int64_t* row_offsets_ptr = row_offsets.GetDataPtr<int64_t>();
+    const int64_t* col_indices_ptr = col_indices.GetDataPtr<int64_t>();
+    const int64_t num_rows = y.GetShape(0);
+    const int64_t k = y.GetShape(1);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        const scalar_t* x_ptr = x.GetDataPtr<scalar_t>();
+        scalar_t* y_ptr = y.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                values.GetDevice(), num_rows * k,
+                [&] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t row = workload_idx / k;
+                    const int64_t j = workload_idx % k;
+                    scalar_t sum = 0;
+                    for (int64_t e = row_offsets_ptr[row];
+                         e < row_offsets_ptr[row + 1]; ++e) {
+                        sum += values_ptr[e] *
+                               x_ptr[col_indices_ptr[e] * k + j];
+                    }
+                    y_ptr[workload_idx] = sum;
+                });
+    });
+}
+
+void SparseMatrixToDenseCPU(const Tensor& row_offsets,
+                            const Tensor& col_indices,
+                            const Tensor& values,
+                            Tensor& dense) {
+    const int64_t* row_offsets_ptr = row_offsets.GetDataPtr<int64_t>();
+    const int64_t* col_indices_ptr = col_indices.GetDataPtr<int64_t>();
+    const int64_t num_rows = dense.GetShape(0);
+    const int64_t num_cols = dense.GetShape(1);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* dense_ptr = dense.GetDataPtr<scalar_t>();
+        // One workload per row, so duplicate entries are accumulated
+        // without atomics.
+        core::ParallelFor(
+                values.GetDevice(), num_rows,
+                [&] OPEN3D_DEVICE(int64_t workload_idx) {
+                    scalar_t* row_ptr = dense_ptr + workload_idx * num_cols;
+                    for (int64_t e = row_offsets_ptr[workload_idx];
+                         e < row_offsets_ptr[workload_idx + 1]; ++e) {
+                        row_ptr[col_indices_ptr[e]] += values_ptr[e];
+                    }
+                });
+    });
+}
+
+void SparseMatrixDiagonalCPU(const Tensor& row_offsets,
+                             const Tensor& col_indices,
+                             const Tensor& values,
+                             Tensor& diagonal) {
+    const int64_t* row_offsets_ptr = row_offsets.GetDataPtr<int64_t>();
+    const int64_t* col_indices_ptr = col_indices.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* diagonal_ptr = diagonal.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                values.GetDevice(), diagonal.GetLength(),
+                [&] OPEN3D_DEVICE(int64_t workload_idx) {
+                    scalar_t sum = 0;
+                    for (int64_t e = row_offsets_ptr[workload_idx];
+                         e < row_offsets_ptr[workload_idx + 1]; ++e) {
+                        if (col_indices_ptr[e] == workload_idx) {
+                            sum += values_ptr[e];
+                        }
+                    }
+                    diagonal_ptr[workload_idx] = sum;
+                });
+    });
+}
+
+void SparseMatrixRowOffsetsCPU(const Tensor& rows, Tensor& row_offsets) {
+    const int64_t* rows_ptr = rows.GetDataPtr<int64_t>();
+    int64_t* row_offsets_ptr = row_offsets.GetDataPtr<int64_t>();
+    const int64_t nnz = rows.GetLength();
+
+    // row_offsets[i] is the first entry with a row index >= i.
+    core::ParallelFor(
+            rows.GetDevice(), row_offsets.GetLength(),
+            [&] OPEN3D_DEVICE(int64_t workload_idx) {
+                int64_t lo = 0;
+                int64_t hi = nnz;
+                while (lo < hi) {
+                    const int64_t mid = lo + (hi - lo) / 2;
+                    if (rows_ptr[mid] < workload_idx) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                row_offsets_ptr[workload_idx] = lo;
+            });
+}
+
+}  // namespace core
+}  // namespace open3d
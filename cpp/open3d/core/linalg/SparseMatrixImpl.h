@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+// All tensors are contiguous and on the same device. row_offsets is
+// {num_rows + 1}, col_indices and values are {nnz}.
+
+// x is {num_cols, k}, y is {num_rows, k}.
+void SparseMatrixSpMVCPU(const Tensor& row_offsets,
+                         const Tensor& col_indices,
+                         const Tensor& values,
+                         const Tensor& x,
+                         Tensor& y);
+
+// dense is a zero-initialized {num_rows, num_cols} tensor.
+void SparseMatrixToDenseCPU(const Tensor& row_offsets,
+                            const Tensor& col_indices,
+                            const Tensor& values,
+                            Tensor& dense);
+
+// diagonal is {min(num_rows, num_cols)}.
+void SparseMatrixDiagonalCPU(const Tensor& row_offsets,
+                             const Tensor& col_indices,
+                             const Tensor& values,
+                             Tensor& diagonal);
+
+// rows is the sorted Int64 row index of each entry, row_offsets is
+// {num_rows + 1}.
+void SparseMatrixRowOffsetsCPU(const Tensor& rows, Tensor& row_offsets);
+
+#ifdef BUILD_CUDA_MODULE
+void SparseMatrixSpMVCUDA(const Tensor& row_offsets,
+                          const Tensor& col_indices,
+                          const Tensor& values,
+                          const Tensor& x,
+                          Tensor& y);
+
+void SparseMatrixToDenseCUDA(const Tensor& row_offsets,
+                             const Tensor& col_indices,
+                             const Tensor& values,
+                             Tensor& dense);
+
+void SparseMatrixDiagonalCUDA(const Tensor& row_offsets,
+                              const Tensor& col_indices,
+                              const Tensor& values,
+                              Tensor& diagonal);
+
+void SparseMatrixRowOffsetsCUDA(const Tensor& rows, Tensor& row_offsets);
+#endif
+
+}  // namespace core
+}  // namespace open3d
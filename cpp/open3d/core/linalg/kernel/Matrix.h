@@ -241,6 +241,79 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void transpose4x4(const scalar_t* A_4x4,
     output_4x4[15] = A_4x4[15];
 }
 
+// ---- Small LU ----
+// Fixed-size LU factorization with partial pivoting. All indices are known at
+// compile time once the loops are unrolled, so that the matrix stays in
+// registers on CUDA. Row swaps are therefore predicated instead of indexed.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void swap_rows_nxn(scalar_t* A_NxN,
+                                                          int row,
+                                                          int pivot_row,
+                                                          int num_cols) {
+    for (int i = row + 1; i < N; ++i) {
+        if (i == pivot_row) {
+            for (int j = 0; j < num_cols; ++j) {
+                scalar_t temp = A_NxN[row * num_cols + j];
+                A_NxN[row * num_cols + j] = A_NxN[i * num_cols + j];
+                A_NxN[i * num_cols + j] = temp;
+            }
+        }
+    }
+}
+
+/// In-place PA = LU of a row-major N x N matrix. L is unit lower triangular
+/// and stored below the diagonal, U on and above it. Row k was swapped with
+/// row pivots_N[k] >= k at step k. A singular matrix results in non-finite
+/// values.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void lu_factor_nxn(scalar_t* A_NxN,
+                                                          int* pivots_N) {
+    for (int k = 0; k < N; ++k) {
+        int pivot_row = k;
+        scalar_t pivot_abs = A_NxN[k * N + k] < 0 ? -A_NxN[k * N + k]
+                                                  : A_NxN[k * N + k];
+        for (int i = k + 1; i < N; ++i) {
+            const scalar_t val_abs =
+                    A_NxN[i * N + k] < 0 ? -A_NxN[i * N + k] : A_NxN[i * N + k];
+            if (val_abs > pivot_abs) {
+                pivot_abs = val_abs;
+                pivot_row = i;
+            }
+        }
+        pivots_N[k] = pivot_row;
+        swap_rows_nxn<scalar_t, N>(A_NxN, k, pivot_row, N);
+
+        const scalar_t pivot_inv = static_cast<scalar_t>(1) / A_NxN[k * N + k];
+        for (int i = k + 1; i < N; ++i) {
+            A_NxN[i * N + k] *= pivot_inv;
+            for (int j = k + 1; j < N; ++j) {
+                A_NxN[i * N + j] -= A_NxN[i * N + k] * A_NxN[k * N + j];
+            }
+        }
+    }
+}
+
+/// Solves Ax = b in-place in \p b_N, given the output of lu_factor_nxn().
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void lu_solve_nxn(const scalar_t* LU_NxN,
+                                                         const int* pivots_N,
+                                                         scalar_t* b_N) {
+    for (int k = 0; k < N; ++k) {
+        swap_rows_nxn<scalar_t, N>(b_N, k, pivots_N[k], 1);
+    }
+    for (int i = 1; i < N; ++i) {
+        for (int j = 0; j < i; ++j) {
+            b_N[i] -= LU_NxN[i * N + j] * b_N[j];
+        }
+    }
+    for (int i = N - 1; i >= 0; --i) {
+        for (int j = i + 1; j < N; ++j) {
+            b_N[i] -= LU_NxN[i * N + j] * b_N[j];
+        }
+        b_N[i] /= LU_NxN[i * N + i];
+    }
+}
+
 }  // namespace kernel
 }  // namespace linalg
 }  // namespace core
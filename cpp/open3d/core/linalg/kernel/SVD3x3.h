@@ -59,6 +59,11 @@
 #define gsine_pi_over_eight 1053028117
 
 #define gcosine_pi_over_eight 1064076127
+
+// Bit patterns of the constants above for double.
+#define gone_d 0x3ff0000000000000ull
+#define gsine_pi_over_eight_d 0x3fd87de2a6aea963ull
+#define gcosine_pi_over_eight_d 0x3fed906bcf328d46ull
 #define gtiny_number 1.e-20
 #define gfour_gamma_squared 5.8284273147583007813
 
@@ -102,17 +107,30 @@ union un {
     unsigned int ui;
 };
 
+// The bit masks must cover the whole double.
+template <>
+union un<double> {
+    double f;
+    unsigned long long ui;
+};
+
+/// Computes A = U diag(S) V^T, where U and V are rotations and S is sorted in
+/// descending order by absolute value (the last value is negative if
+/// det(A) < 0). The default 4 Jacobi sweeps are accurate to about 1e-2; 6
+/// sweeps converge to the precision of float and to about 1e-9 for double.
 template <typename scalar_t>
 OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3(const scalar_t *A_3x3,
                                               scalar_t *U_3x3,
                                               scalar_t *S_3x1,
-                                              scalar_t *V_3x3);
+                                              scalar_t *V_3x3,
+                                              int num_sweeps = 4);
 
 template <>
 OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
                                                       double *U_3x3,
                                                       double *S_3x1,
-                                                      double *V_3x3) {
+                                                      double *V_3x3,
+                                                      int num_sweeps) {
     double gsmall_number = 1.e-12;
 
     un<double> Sa11, Sa21, Sa31, Sa12, Sa22, Sa32, Sa13, Sa23, Sa33;
@@ -181,15 +199,15 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
     //###########################################################
     // Solve symmetric eigenproblem using Jacobi iteration
     //###########################################################
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < num_sweeps; i++) {
         Ssh.f = Ss21.f * 0.5f;
         Stmp5.f = __dsub_rn(Ss11.f, Ss22.f);
 
         Stmp2.f = Ssh.f * Ssh.f;
-        Stmp1.ui = (Stmp2.f >= gtiny_number) ? 0xffffffff : 0;
+        Stmp1.ui = (Stmp2.f >= gtiny_number) ? 0xffffffffffffffff : 0;
         Ssh.ui = Stmp1.ui & Ssh.ui;
         Sch.ui = Stmp1.ui & Stmp5.ui;
-        Stmp2.ui = ~Stmp1.ui & gone;
+        Stmp2.ui = ~Stmp1.ui & gone_d;
         Sch.ui = Sch.ui | Stmp2.ui;
 
         Stmp1.f = Ssh.f * Ssh.f;
@@ -200,12 +218,12 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
         Ssh.f = Stmp4.f * Ssh.f;
         Sch.f = Stmp4.f * Sch.f;
         Stmp1.f = gfour_gamma_squared * Stmp1.f;
-        Stmp1.ui = (Stmp2.f <= Stmp1.f) ? 0xffffffff : 0;
+        Stmp1.ui = (Stmp2.f <= Stmp1.f) ? 0xffffffffffffffff : 0;
 
-        Stmp2.ui = gsine_pi_over_eight & Stmp1.ui;
+        Stmp2.ui = gsine_pi_over_eight_d & Stmp1.ui;
         Ssh.ui = ~Stmp1.ui & Ssh.ui;
         Ssh.ui = Ssh.ui | Stmp2.ui;
-        Stmp2.ui = gcosine_pi_over_eight & Stmp1.ui;
+        Stmp2.ui = gcosine_pi_over_eight_d & Stmp1.ui;
         Sch.ui = ~Stmp1.ui & Sch.ui;
         Sch.ui = Sch.ui | Stmp2.ui;
 
@@ -291,10 +309,10 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
         Stmp5.f = __dsub_rn(Ss22.f, Ss33.f);
 
         Stmp2.f = Ssh.f * Ssh.f;
-        Stmp1.ui = (Stmp2.f >= gtiny_number) ? 0xffffffff : 0;
+        Stmp1.ui = (Stmp2.f >= gtiny_number) ? 0xffffffffffffffff : 0;
         Ssh.ui = Stmp1.ui & Ssh.ui;
         Sch.ui = Stmp1.ui & Stmp5.ui;
-        Stmp2.ui = ~Stmp1.ui & gone;
+        Stmp2.ui = ~Stmp1.ui & gone_d;
         Sch.ui = Sch.ui | Stmp2.ui;
 
         Stmp1.f = Ssh.f * Ssh.f;
@@ -305,12 +323,12 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
         Ssh.f = Stmp4.f * Ssh.f;
         Sch.f = Stmp4.f * Sch.f;
         Stmp1.f = gfour_gamma_squared * Stmp1.f;
-        Stmp1.ui = (Stmp2.f <= Stmp1.f) ? 0xffffffff : 0;
+        Stmp1.ui = (Stmp2.f <= Stmp1.f) ? 0xffffffffffffffff : 0;
 
-        Stmp2.ui = gsine_pi_over_eight & Stmp1.ui;
+        Stmp2.ui = gsine_pi_over_eight_d & Stmp1.ui;
         Ssh.ui = ~Stmp1.ui & Ssh.ui;
         Ssh.ui = Ssh.ui | Stmp2.ui;
-        Stmp2.ui = gcosine_pi_over_eight & Stmp1.ui;
+        Stmp2.ui = gcosine_pi_over_eight_d & Stmp1.ui;
         Sch.ui = ~Stmp1.ui & Sch.ui;
         Sch.ui = Sch.ui | Stmp2.ui;
 
@@ -398,10 +416,10 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
         Stmp5.f = __dsub_rn(Ss33.f, Ss11.f);
 
         Stmp2.f = Ssh.f * Ssh.f;
-        Stmp1.ui = (Stmp2.f >= gtiny_number) ? 0xffffffff : 0;
+        Stmp1.ui = (Stmp2.f >= gtiny_number) ? 0xffffffffffffffff : 0;
         Ssh.ui = Stmp1.ui & Ssh.ui;
         Sch.ui = Stmp1.ui & Stmp5.ui;
-        Stmp2.ui = ~Stmp1.ui & gone;
+        Stmp2.ui = ~Stmp1.ui & gone_d;
         Sch.ui = Sch.ui | Stmp2.ui;
 
         Stmp1.f = Ssh.f * Ssh.f;
@@ -412,12 +430,12 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
         Ssh.f = Stmp4.f * Ssh.f;
         Sch.f = Stmp4.f * Sch.f;
         Stmp1.f = gfour_gamma_squared * Stmp1.f;
-        Stmp1.ui = (Stmp2.f <= Stmp1.f) ? 0xffffffff : 0;
+        Stmp1.ui = (Stmp2.f <= Stmp1.f) ? 0xffffffffffffffff : 0;
 
-        Stmp2.ui = gsine_pi_over_eight & Stmp1.ui;
+        Stmp2.ui = gsine_pi_over_eight_d & Stmp1.ui;
         Ssh.ui = ~Stmp1.ui & Ssh.ui;
         Ssh.ui = Ssh.ui | Stmp2.ui;
-        Stmp2.ui = gcosine_pi_over_eight & Stmp1.ui;
+        Stmp2.ui = gcosine_pi_over_eight_d & Stmp1.ui;
         Sch.ui = ~Stmp1.ui & Sch.ui;
         Sch.ui = Sch.ui | Stmp2.ui;
 
@@ -633,7 +651,7 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
 
     // Swap columns 1-2 if necessary
 
-    Stmp4.ui = (Stmp1.f < Stmp2.f) ? 0xffffffff : 0;
+    Stmp4.ui = (Stmp1.f < Stmp2.f) ? 0xffffffffffffffff : 0;
     Stmp5.ui = Sa11.ui ^ Sa12.ui;
     Stmp5.ui = Stmp5.ui & Stmp4.ui;
     Sa11.ui = Sa11.ui ^ Stmp5.ui;
@@ -687,7 +705,7 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
 
     // Swap columns 1-3 if necessary
 
-    Stmp4.ui = (Stmp1.f < Stmp3.f) ? 0xffffffff : 0;
+    Stmp4.ui = (Stmp1.f < Stmp3.f) ? 0xffffffffffffffff : 0;
     Stmp5.ui = Sa11.ui ^ Sa13.ui;
     Stmp5.ui = Stmp5.ui & Stmp4.ui;
     Sa11.ui = Sa11.ui ^ Stmp5.ui;
@@ -741,7 +759,7 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
 
     // Swap columns 2-3 if necessary
 
-    Stmp4.ui = (Stmp2.f < Stmp3.f) ? 0xffffffff : 0;
+    Stmp4.ui = (Stmp2.f < Stmp3.f) ? 0xffffffffffffffff : 0;
     Stmp5.ui = Sa12.ui ^ Sa13.ui;
     Stmp5.ui = Stmp5.ui & Stmp4.ui;
     Sa12.ui = Sa12.ui ^ Stmp5.ui;
@@ -808,14 +826,14 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
     Su33.f = 1.f;
 
     Ssh.f = Sa21.f * Sa21.f;
-    Ssh.ui = (Ssh.f >= gsmall_number) ? 0xffffffff : 0;
+    Ssh.ui = (Ssh.f >= gsmall_number) ? 0xffffffffffffffff : 0;
     Ssh.ui = Ssh.ui & Sa21.ui;
 
     Stmp5.f = 0.f;
     Sch.f = __dsub_rn(Stmp5.f, Sa11.f);
     Sch.f = max(Sch.f, Sa11.f);
     Sch.f = max(Sch.f, gsmall_number);
-    Stmp5.ui = (Sa11.f >= Stmp5.f) ? 0xffffffff : 0;
+    Stmp5.ui = (Sa11.f >= Stmp5.f) ? 0xffffffffffffffff : 0;
 
     Stmp1.f = Sch.f * Sch.f;
     Stmp2.f = Ssh.f * Ssh.f;
@@ -913,14 +931,14 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
     // Second Givens rotation
 
     Ssh.f = Sa31.f * Sa31.f;
-    Ssh.ui = (Ssh.f >= gsmall_number) ? 0xffffffff : 0;
+    Ssh.ui = (Ssh.f >= gsmall_number) ? 0xffffffffffffffff : 0;
     Ssh.ui = Ssh.ui & Sa31.ui;
 
     Stmp5.f = 0.f;
     Sch.f = __dsub_rn(Stmp5.f, Sa11.f);
     Sch.f = max(Sch.f, Sa11.f);
     Sch.f = max(Sch.f, gsmall_number);
-    Stmp5.ui = (Sa11.f >= Stmp5.f) ? 0xffffffff : 0;
+    Stmp5.ui = (Sa11.f >= Stmp5.f) ? 0xffffffffffffffff : 0;
 
     Stmp1.f = Sch.f * Sch.f;
     Stmp2.f = Ssh.f * Ssh.f;
@@ -1018,14 +1036,14 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<double>(const double *A_3x3,
     // Third Givens Rotation
 
     Ssh.f = Sa32.f * Sa32.f;
-    Ssh.ui = (Ssh.f >= gsmall_number) ? 0xffffffff : 0;
+    Ssh.ui = (Ssh.f >= gsmall_number) ? 0xffffffffffffffff : 0;
     Ssh.ui = Ssh.ui & Sa32.ui;
 
     Stmp5.f = 0.f;
     Sch.f = __dsub_rn(Stmp5.f, Sa22.f);
     Sch.f = max(Sch.f, Sa22.f);
     Sch.f = max(Sch.f, gsmall_number);
-    Stmp5.ui = (Sa22.f >= Stmp5.f) ? 0xffffffff : 0;
+    Stmp5.ui = (Sa22.f >= Stmp5.f) ? 0xffffffffffffffff : 0;
 
     Stmp1.f = Sch.f * Sch.f;
     Stmp2.f = Ssh.f * Ssh.f;
@@ -1151,7 +1169,8 @@ template <>
 OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<float>(const float *A_3x3,
                                                      float *U_3x3,
                                                      float *S_3x1,
-                                                     float *V_3x3) {
+                                                     float *V_3x3,
+                                                     int num_sweeps) {
     float gsmall_number = 1.e-12;
 
     un<float> Sa11, Sa21, Sa31, Sa12, Sa22, Sa32, Sa13, Sa23, Sa33;
@@ -1220,7 +1239,7 @@ OPEN3D_DEVICE OPEN3D_FORCE_INLINE void svd3x3<float>(const float *A_3x3,
     //###########################################################
     // Solve symmetric eigenproblem using Jacobi iteration
     //###########################################################
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < num_sweeps; i++) {
         Ssh.f = Ss21.f * 0.5f;
         Stmp5.f = __fsub_rn(Ss11.f, Ss22.f);
 
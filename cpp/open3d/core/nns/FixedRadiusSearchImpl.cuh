@@ -361,13 +361,15 @@ __global__ void WriteNeighborsIndicesAndDistancesKernel(
         const T* const __restrict__ points,
         const T inv_voxel_size,
         const T radius,
-        const T threshold) {
+        const T threshold,
+        const size_t max_num_indices) {
     int query_idx = blockDim.x * blockIdx.x + threadIdx.x;
     if (query_idx >= num_queries) return;
 
     int count = 0;  // counts the number of neighbors for this query point
 
     size_t indices_offset = neighbors_row_splits[query_idx];
+    if (indices_offset >= max_num_indices) return;
 
     Vec3<T> query_pos(query_points[query_idx * 3 + 0],
                       query_points[query_idx * 3 + 1],
@@ -419,6 +421,7 @@ __global__ void WriteNeighborsIndicesAndDistancesKernel(
                     distances[indices_offset + count] = dist;
                 }
                 ++count;
+                if (indices_offset + count >= max_num_indices) return;
             }
         }
     }
@@ -467,6 +470,9 @@ __global__ void WriteNeighborsIndicesAndDistancesKernel(
 ///        distances for each neighbor to its query point in the same format
 ///        as the indices.
 ///        Note that for the L2 metric the squared distances will be returned!!
+///
+/// \param max_num_indices    The size of the \p indices and \p distances
+///        arrays. Neighbors beyond this size are not written.
 template <class T>
 void WriteNeighborsIndicesAndDistances(
         const cudaStream_t& stream,
@@ -483,7 +489,8 @@ void WriteNeighborsIndicesAndDistances(
         const T radius,
         const Metric metric,
         const bool ignore_query_point,
-        const bool return_distances) {
+        const bool return_distances,
+        const size_t max_num_indices) {
     const T threshold = (metric == L2 ? radius * radius : radius);
 
     const int BLOCKSIZE = 64;
@@ -495,7 +502,8 @@ void WriteNeighborsIndicesAndDistances(
 #define FN_PARAMETERS                                                          \
     indices, distances, neighbors_row_splits, point_index_table,               \
             hash_table_cell_splits, hash_table_cell_splits_size, query_points, \
-            num_queries, points, inv_voxel_size, radius, threshold
+            num_queries, points, inv_voxel_size, radius, threshold,            \
+            max_num_indices
 
 #define CALL_TEMPLATE(METRIC, IGNORE_QUERY_POINT, RETURN_DISTANCES)            \
     if (METRIC == metric && IGNORE_QUERY_POINT == ignore_query_point &&        \
@@ -884,6 +892,15 @@ void SortPairs(void* temp,
     }
 }
 
+/// Fixed radius search on the GPU. The output arrays are allocated with
+/// \p output_allocator after the number of neighbors has been copied to the
+/// host, which synchronizes the stream.
+///
+/// If \p max_num_indices is not negative the output arrays are allocated with
+/// this size instead and the function does not synchronize, which allows
+/// capturing it in a CUDA graph. Neighbors beyond \p max_num_indices are
+/// dropped, the last element of \p query_neighbors_row_splits still holds
+/// the total number of neighbors found.
 template <class T, class OUTPUT_ALLOCATOR>
 void FixedRadiusSearchCUDA(const cudaStream_t& stream,
                            void* temp,
@@ -906,8 +923,10 @@ void FixedRadiusSearchCUDA(const cudaStream_t& stream,
                            const Metric metric,
                            const bool ignore_query_point,
                            const bool return_distances,
-                           OUTPUT_ALLOCATOR& output_allocator) {
+                           OUTPUT_ALLOCATOR& output_allocator,
+                           const int64_t max_num_indices = -1) {
     const bool get_temp_size = !temp;
+    const bool sync_output_size = max_num_indices < 0;
 
     if (get_temp_size) {
         temp = (char*)1;  // worst case pointer alignment
@@ -918,11 +937,12 @@ void FixedRadiusSearchCUDA(const cudaStream_t& stream,
     if ((0 == num_points || 0 == num_queries) && !get_temp_size) {
         cudaMemsetAsync(query_neighbors_row_splits, 0,
                         sizeof(int64_t) * (num_queries + 1), stream);
+        const size_t num_indices = sync_output_size ? 0 : max_num_indices;
         int32_t* indices_ptr;
-        output_allocator.AllocIndices(&indices_ptr, 0);
+        output_allocator.AllocIndices(&indices_ptr, num_indices);
 
         T* distances_ptr;
-        output_allocator.AllocDistances(&distances_ptr, 0);
+        output_allocator.AllocDistances(&distances_ptr, num_indices);
 
         return;
     }
@@ -974,12 +994,18 @@ void FixedRadiusSearchCUDA(const cudaStream_t& stream,
                     query_neighbors_count.first, query_neighbors_row_splits + 1,
                     num_queries, stream);
 
-            // get the last value
-            cudaMemcpyAsync(&last_prefix_sum_entry,
-                            query_neighbors_row_splits + num_queries,
-                            sizeof(int64_t), cudaMemcpyDeviceToHost, stream);
-            // wait for the async copies
-            while (cudaErrorNotReady == cudaStreamQuery(stream)) { /*empty*/
+            if (sync_output_size) {
+                // get the last value
+                cudaMemcpyAsync(&last_prefix_sum_entry,
+                                query_neighbors_row_splits + num_queries,
+                                sizeof(int64_t), cudaMemcpyDeviceToHost,
+                                stream);
+                // wait for the async copies
+                while (cudaErrorNotReady == cudaStreamQuery(stream)) {
+                    /*empty*/
+                }
+            } else {
+                last_prefix_sum_entry = max_num_indices;
             }
         }
         mem_temp.Free(inclusive_scan_temp);
@@ -1015,7 +1041,7 @@ void FixedRadiusSearchCUDA(const cudaStream_t& stream,
                     hash_table_index, hash_table_cell_splits + first_cell_idx,
                     hash_table_size, queries_i, num_queries_i, points,
                     inv_voxel_size, radius, metric, ignore_query_point,
-                    return_distances);
+                    return_distances, num_indices);
         }
     }
 }
@@ -28,6 +28,7 @@
 
 #include <tbb/parallel_for.h>
 
+#include <algorithm>
 #include <set>
 
 #include "open3d/core/Atomic.h"
@@ -464,6 +465,135 @@ void _FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef VECSIZE
 }
 
+/// Implementation of HybridSearchCPU with template params for metrics.
+template <class T, class OUTPUT_ALLOCATOR, int METRIC>
+void _HybridSearchCPU(const size_t num_points,
+                      const T* const points,
+                      const size_t num_queries,
+                      const T* const queries,
+                      const T radius,
+                      const int max_knn,
+                      const size_t points_row_splits_size,
+                      const int64_t* const points_row_splits,
+                      const size_t queries_row_splits_size,
+                      const int64_t* const queries_row_splits,
+                      const uint32_t* const hash_table_splits,
+                      const size_t hash_table_cell_splits_size,
+                      const uint32_t* const hash_table_cell_splits,
+                      const uint32_t* const hash_table_index,
+                      OUTPUT_ALLOCATOR& output_allocator) {
+    typedef utility::MiniVec<T, 3> Vec3_t;
+
+    // The output has a fixed size of max_knn entries per query, so the
+    // neighbors are written in a single pass without counting them first.
+    const size_t num_indices = num_queries * max_knn;
+
+    int32_t* indices_ptr;
+    output_allocator.AllocIndices(&indices_ptr, num_indices, -1);
+
+    T* distances_ptr;
+    output_allocator.AllocDistances(&distances_ptr, num_indices, 0);
+
+    int32_t* counts_ptr;
+    output_allocator.AllocCounts(&counts_ptr, num_queries, 0);
+
+    if (0 == num_points || 0 == num_queries || max_knn <= 0) {
+        return;
+    }
+
+    const int batch_size = points_row_splits_size - 1;
+
+    // use squared radius for L2 to avoid sqrt
+    const T threshold = (METRIC == L2 ? radius * radius : radius);
+
+    const T voxel_size = 2 * radius;
+    const T inv_voxel_size = 1 / voxel_size;
+
+    auto distance = [](const Vec3_t& p, const T* const q) {
+        T dist = 0;
+        for (int d = 0; d < 3; ++d) {
+            const T diff = p[d] - q[d];
+            if (METRIC == Linf) {
+                dist = std::max(dist, std::abs(diff));
+            } else if (METRIC == L1) {
+                dist += std::abs(diff);
+            } else {
+                dist += diff * diff;
+            }
+        }
+        return dist;
+    };
+
+    for (int i = 0; i < batch_size; ++i) {
+        const size_t hash_table_size =
+                hash_table_splits[i + 1] - hash_table_splits[i];
+        const size_t first_cell_idx = hash_table_splits[i];
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(queries_row_splits[i],
+                                           queries_row_splits[i + 1]),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    // Max-heap of (distance, index) holding the max_knn
+                    // closest neighbors found so far.
+                    std::vector<std::pair<T, int32_t>> heap;
+                    heap.reserve(max_knn);
+                    for (size_t q = r.begin(); q != r.end(); ++q) {
+                        Vec3_t pos(queries + q * 3);
+
+                        size_t bins_to_visit[8];
+                        int num_bins = 0;
+                        auto add_bin = [&](const Vec3_t& p) {
+                            size_t bin = first_cell_idx +
+                                         SpatialHash(ComputeVoxelIndex(
+                                                 p, inv_voxel_size)) %
+                                                 hash_table_size;
+                            if (std::find(bins_to_visit,
+                                          bins_to_visit + num_bins,
+                                          bin) == bins_to_visit + num_bins) {
+                                bins_to_visit[num_bins++] = bin;
+                            }
+                        };
+                        add_bin(pos);
+                        for (int dz = -1; dz <= 1; dz += 2)
+                            for (int dy = -1; dy <= 1; dy += 2)
+                                for (int dx = -1; dx <= 1; dx += 2) {
+                                    add_bin(pos + radius * Vec3_t(T(dx), T(dy),
+                                                                  T(dz)));
+                                }
+
+                        heap.clear();
+                        for (int bin_i = 0; bin_i < num_bins; ++bin_i) {
+                            const size_t bin = bins_to_visit[bin_i];
+                            size_t begin_idx = hash_table_cell_splits[bin];
+                            size_t end_idx = hash_table_cell_splits[bin + 1];
+
+                            for (size_t j = begin_idx; j < end_idx; ++j) {
+                                uint32_t idx = hash_table_index[j];
+                                T dist = distance(pos, points + idx * 3);
+                                if (dist > threshold) continue;
+                                if (int(heap.size()) < max_knn) {
+                                    heap.emplace_back(dist, int32_t(idx));
+                                    std::push_heap(heap.begin(), heap.end());
+                                } else if (dist < heap.front().first) {
+                                    std::pop_heap(heap.begin(), heap.end());
+                                    heap.back() = std::make_pair(dist,
+                                                                 int32_t(idx));
+                                    std::push_heap(heap.begin(), heap.end());
+                                }
+                            }
+                        }
+                        std::sort_heap(heap.begin(), heap.end());
+
+                        const size_t offset = q * max_knn;
+                        for (size_t k = 0; k < heap.size(); ++k) {
+                            distances_ptr[offset + k] = heap[k].first;
+                            indices_ptr[offset + k] = heap[k].second;
+                        }
+                        counts_ptr[q] = int32_t(heap.size());
+                    }
+                });
+    }
+}
+
 }  // namespace
 
 /// Fixed radius search. This function computes a list of neighbor indices
@@ -597,6 +727,60 @@ void FixedRadiusSearchCPU(int64_t* query_neighbors_row_splits,
 #undef FN_PARAMETERS
 }
 
+/// Hybrid search. For each query point, finds up to \p max_knn nearest
+/// neighbors within \p radius and writes them to fixed-size output arrays of
+/// \p max_knn entries per query, sorted by distance, padded with -1 for the
+/// indices and 0 for the distances. The number of neighbors of each query is
+/// returned as well. Unlike FixedRadiusSearchCPU this does not need a pass to
+/// count the neighbors.
+///
+/// \tparam T    Floating-point data type for the point positions.
+///
+/// \tparam OUTPUT_ALLOCATOR    Type of the output_allocator. The object must
+///         implement AllocIndices(int32_t** ptr, size_t size, int32_t value),
+///         AllocDistances(T** ptr, size_t size, T value) and
+///         AllocCounts(int32_t** ptr, size_t size, int32_t value), filling the
+///         arrays with value.
+///
+/// The remaining parameters are the same as for FixedRadiusSearchCPU, with
+/// \p max_knn the maximum number of neighbors for each query. For the L2
+/// metric the squared distances are returned.
+template <class T, class OUTPUT_ALLOCATOR>
+void HybridSearchCPU(const size_t num_points,
+                     const T* const points,
+                     const size_t num_queries,
+                     const T* const queries,
+                     const T radius,
+                     const int max_knn,
+                     const size_t points_row_splits_size,
+                     const int64_t* const points_row_splits,
+                     const size_t queries_row_splits_size,
+                     const int64_t* const queries_row_splits,
+                     const uint32_t* const hash_table_splits,
+                     const size_t hash_table_cell_splits_size,
+                     const uint32_t* const hash_table_cell_splits,
+                     const uint32_t* const hash_table_index,
+                     const Metric metric,
+                     OUTPUT_ALLOCATOR& output_allocator) {
+#define FN_PARAMETERS                                                       \
+    num_points, points, num_queries, queries, radius, max_knn,              \
+            points_row_splits_size, points_row_splits,                      \
+            queries_row_splits_size, queries_row_splits, hash_table_splits, \
+            hash_table_cell_splits_size, hash_table_cell_splits,            \
+            hash_table_index, output_allocator
+
+#define CALL_TEMPLATE(METRIC)                                     \
+    if (METRIC == metric)                                         \
+        _HybridSearchCPU<T, OUTPUT_ALLOCATOR, METRIC>(FN_PARAMETERS);
+
+    CALL_TEMPLATE(L1)
+    CALL_TEMPLATE(L2)
+    CALL_TEMPLATE(Linf)
+
+#undef CALL_TEMPLATE
+#undef FN_PARAMETERS
+}
+
 }  // namespace impl
 }  // namespace nns
 }  // namespace core
@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/LBVHIndex.h"
+
+#include <limits>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+LBVHIndex::LBVHIndex() {}
+
+LBVHIndex::LBVHIndex(const Tensor& dataset_points) {
+    SetTensorData(dataset_points);
+}
+
+LBVHIndex::~LBVHIndex() {}
+
+bool LBVHIndex::SetTensorData(const Tensor& dataset_points) {
+    AssertTensorDtypes(dataset_points, {Float32, Float64});
+    AssertTensorShape(dataset_points, {utility::nullopt, 3});
+    if (dataset_points.GetLength() >= std::numeric_limits<int32_t>::max()) {
+        utility::LogError("LBVHIndex supports less than {} points, but got {}.",
+                          std::numeric_limits<int32_t>::max(),
+                          dataset_points.GetLength());
+    }
+
+    dataset_points_ = dataset_points.Contiguous();
+    if (GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+            BuildLBVHCUDA<scalar_t>(dataset_points_, sorted_indices_,
+                                    children_, aabbs_);
+        });
+#else
+        utility::LogError(
+                "-DBUILD_CUDA_MODULE=OFF. Please recompile Open3D with "
+                "-DBUILD_CUDA_MODULE=ON.");
+#endif
+    } else {
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+            BuildLBVHCPU<scalar_t>(dataset_points_, sorted_indices_, children_,
+                                   aabbs_);
+        });
+    }
+    return true;
+}
+
+bool LBVHIndex::SetTensorData(const Tensor& dataset_points, double radius) {
+    return SetTensorData(dataset_points);
+}
+
+void LBVHIndex::AssertQueryPoints(const Tensor& query_points) const {
+    if (aabbs_.NumDims() != 2) {
+        utility::LogError("LBVHIndex is not set with any points.");
+    }
+    AssertTensorDevice(query_points, GetDevice());
+    AssertTensorDtype(query_points, GetDtype());
+    AssertTensorShape(query_points, {utility::nullopt, 3});
+}
+
+std::pair<Tensor, Tensor> LBVHIndex::SearchKnn(const Tensor& query_points,
+                                               int knn) const {
+    AssertQueryPoints(query_points);
+    if (knn <= 0) {
+        utility::LogError("knn should be larger than 0.");
+    }
+    knn = static_cast<int>(
+            std::min(static_cast<int64_t>(GetDatasetSize()), int64_t(knn)));
+
+    Tensor indices, distances, counts;
+    std::tie(indices, distances, counts) = SearchKnnBounded(
+            query_points, knn, std::numeric_limits<double>::infinity());
+    return std::make_pair(indices, distances);
+}
+
+std::tuple<Tensor, Tensor, Tensor> LBVHIndex::SearchRadius(
+        const Tensor& query_points, const Tensor& radii, bool sort) const {
+    AssertQueryPoints(query_points);
+    AssertTensorDevice(radii, GetDevice());
+    AssertTensorDtype(radii, GetDtype());
+    AssertTensorShape(radii, {query_points.GetLength()});
+    if (radii.Le(0).Any()) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    const Tensor query_contiguous = query_points.Contiguous();
+    const Tensor radii_contiguous = radii.Contiguous();
+    Tensor indices, distances, row_splits;
+    if (GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+            RadiusSearchLBVHCUDA<scalar_t>(
+                    dataset_points_, sorted_indices_, children_, aabbs_,
+                    query_contiguous, radii_contiguous, sort, indices,
+                    distances, row_splits);
+        });
+#else
+        utility::LogError(
+                "-DBUILD_CUDA_MODULE=OFF. Please recompile Open3D with "
+                "-DBUILD_CUDA_MODULE=ON.");
+#endif
+    } else {
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+            RadiusSearchLBVHCPU<scalar_t>(
+                    dataset_points_, sorted_indices_, children_, aabbs_,
+                    query_contiguous, radii_contiguous, sort, indices,
+                    distances, row_splits);
+        });
+    }
+    return std::make_tuple(indices, distances, row_splits);
+}
+
+std::tuple<Tensor, Tensor, Tensor> LBVHIndex::SearchRadius(
+        const Tensor& query_points, double radius, bool sort) const {
+    AssertQueryPoints(query_points);
+    Tensor radii = Tensor::Full({query_points.GetLength()}, radius,
+                                GetDtype(), GetDevice());
+    return SearchRadius(query_points, radii, sort);
+}
+
+std::tuple<Tensor, Tensor, Tensor> LBVHIndex::SearchHybrid(
+        const Tensor& query_points, double radius, int max_knn) const {
+    AssertQueryPoints(query_points);
+    if (max_knn <= 0) {
+        utility::LogError("max_knn should be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    return SearchKnnBounded(query_points, max_knn, radius * radius);
+}
+
+std::tuple<Tensor, Tensor, Tensor> LBVHIndex::SearchKnnBounded(
+        const Tensor& query_points,
+        int knn,
+        double max_distance_squared) const {
+    const Tensor query_contiguous = query_points.Contiguous();
+    Tensor indices, distances, counts;
+    if (GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+            KnnSearchLBVHCUDA<scalar_t>(
+                    dataset_points_, sorted_indices_, children_, aabbs_,
+                    query_contiguous, knn,
+                    static_cast<scalar_t>(max_distance_squared), indices,
+                    distances, counts);
+        });
+#else
+        utility::LogError(
+                "-DBUILD_CUDA_MODULE=OFF. Please recompile Open3D with "
+                "-DBUILD_CUDA_MODULE=ON.");
+#endif
+    } else {
+        DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+            KnnSearchLBVHCPU<scalar_t>(
+                    dataset_points_, sorted_indices_, children_, aabbs_,
+                    query_contiguous, knn,
+                    static_cast<scalar_t>(max_distance_squared), indices,
+                    distances, counts);
+        });
+    }
+    return std::make_tuple(indices, distances, counts);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
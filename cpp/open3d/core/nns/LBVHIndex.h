@@ -0,0 +1,197 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+template <class T>
+void BuildLBVHCPU(const Tensor& points,
+                  Tensor& sorted_indices,
+                  Tensor& children,
+                  Tensor& aabbs);
+
+template <class T>
+void KnnSearchLBVHCPU(const Tensor& points,
+                      const Tensor& sorted_indices,
+                      const Tensor& children,
+                      const Tensor& aabbs,
+                      const Tensor& queries,
+                      int knn,
+                      T max_distance_squared,
+                      Tensor& indices,
+                      Tensor& distances,
+                      Tensor& counts);
+
+template <class T>
+void RadiusSearchLBVHCPU(const Tensor& points,
+                         const Tensor& sorted_indices,
+                         const Tensor& children,
+                         const Tensor& aabbs,
+                         const Tensor& queries,
+                         const Tensor& radii,
+                         bool sort,
+                         Tensor& indices,
+                         Tensor& distances,
+                         Tensor& row_splits);
+
+#ifdef BUILD_CUDA_MODULE
+template <class T>
+void BuildLBVHCUDA(const Tensor& points,
+                   Tensor& sorted_indices,
+                   Tensor& children,
+                   Tensor& aabbs);
+
+template <class T>
+void KnnSearchLBVHCUDA(const Tensor& points,
+                       const Tensor& sorted_indices,
+                       const Tensor& children,
+                       const Tensor& aabbs,
+                       const Tensor& queries,
+                       int knn,
+                       T max_distance_squared,
+                       Tensor& indices,
+                       Tensor& distances,
+                       Tensor& counts);
+
+template <class T>
+void RadiusSearchLBVHCUDA(const Tensor& points,
+                          const Tensor& sorted_indices,
+                          const Tensor& children,
+                          const Tensor& aabbs,
+                          const Tensor& queries,
+                          const Tensor& radii,
+                          bool sort,
+                          Tensor& indices,
+                          Tensor& distances,
+                          Tensor& row_splits);
+#endif
+
+/// \class LBVHIndex
+///
+/// \brief Linear bounding volume hierarchy over the Morton codes of 3D
+/// points, for nearest neighbor search on CPU and CUDA.
+///
+/// The tree is built in parallel in O(n log n) and each query traverses it
+/// nearest child first, which scales far better than brute force knn for
+/// large point clouds.
+class LBVHIndex : public NNSIndex {
+public:
+    LBVHIndex();
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides a set of data points as Tensor for BVH
+    /// construction. Must be 2D, with shape {n, 3}.
+    LBVHIndex(const Tensor& dataset_points);
+    ~LBVHIndex();
+    LBVHIndex(const LBVHIndex&) = delete;
+    LBVHIndex& operator=(const LBVHIndex&) = delete;
+
+public:
+    bool SetTensorData(const Tensor& dataset_points) override;
+
+    /// The radius is not needed to build the hierarchy and is ignored.
+    bool SetTensorData(const Tensor& dataset_points, double radius) override;
+
+    /// Perform K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}, same
+    /// dtype and device with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, min(knn, num_dataset_points)}, with
+    /// dtype Int32.
+    /// - distainces: Tensor of shape {n, min(knn, num_dataset_points)}, same
+    /// dtype with dataset_points. The distances are squared L2 distances.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor& query_points,
+                                        int knn) const override;
+
+    /// Perform radius search with multiple radii.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}, same
+    /// dtype and device with dataset_points.
+    /// \param radii list of radius. Must be 1D, with shape {n, }.
+    /// \return Tuple of Tensors: (indices, distances, row_splits):
+    /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int32.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - row_splits: Tensor of shape {n + 1,}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor& query_points,
+            const Tensor& radii,
+            bool sort = true) const override;
+
+    /// Perform radius search, all query points share the same radius.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor& query_points,
+            double radius,
+            bool sort = true) const override;
+
+    /// Perform hybrid search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query point.
+    /// \return Tuple of Tensors, (indices, distances, counts):
+    /// - indices: Tensor of shape {n, max_knn}, with dtype Int32, padded
+    /// with -1.
+    /// - distances: Tensor of shape {n, max_knn}, same dtype with
+    /// dataset_points, padded with 0.
+    /// - counts: Tensor of shape {n}, with dtype Int32.
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(const Tensor& query_points,
+                                                    double radius,
+                                                    int max_knn) const override;
+
+protected:
+    void AssertQueryPoints(const Tensor& query_points) const;
+
+    /// Knn search among the points closer than sqrt(max_distance_squared),
+    /// returning (indices, distances, counts) as SearchHybrid.
+    std::tuple<Tensor, Tensor, Tensor> SearchKnnBounded(
+            const Tensor& query_points,
+            int knn,
+            double max_distance_squared) const;
+
+    /// Positions of the dataset points in Morton order.
+    Tensor sorted_indices_;
+    /// {n - 1, 2} children of the internal nodes. Node 0 is the root and
+    /// leaf j is node n - 1 + j.
+    Tensor children_;
+    /// {2n - 1, 6} bounding boxes of the nodes, min xyz then max xyz.
+    Tensor aabbs_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
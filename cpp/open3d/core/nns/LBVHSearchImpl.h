@@ -0,0 +1,506 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Linear BVH over Morton codes, following T. Karras, "Maximizing Parallelism
+// in the Construction of BVHs, Octrees, and k-d Trees", HPG 2012.
+//
+// This header is compiled once for the CPU (LBVHSearchOps.cpp) and once for
+// CUDA (LBVHSearchOps.cu).
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#else
+#include <atomic>
+#endif
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+namespace {
+
+typedef int32_t index_t;
+
+/// Split prefixes strictly grow from a node to its children and are at most
+/// 62 bits long (30 Morton code bits and 32 index bits), which bounds the
+/// depth of the tree and hence the traversal stack.
+constexpr int kLBVHStackSize = 64;
+
+/// Spreads the lower 10 bits of v out to every third bit.
+OPEN3D_HOST_DEVICE inline uint32_t ExpandBits(uint32_t v) {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+OPEN3D_HOST_DEVICE inline int CountLeadingZeros(uint32_t x) {
+#if defined(__CUDA_ARCH__)
+    return __clz(x);
+#elif defined(__GNUC__)
+    return x == 0 ? 32 : __builtin_clz(x);
+#else
+    int count = 0;
+    for (uint32_t mask = 0x80000000u; mask != 0 && !(x & mask); mask >>= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/// Length of the common prefix of sorted leaves i and j, with the leaf
+/// position breaking ties between equal codes. Returns -1 if j is out of
+/// range.
+OPEN3D_HOST_DEVICE inline int CommonPrefix(const int64_t* codes,
+                                           int64_t n,
+                                           int64_t i,
+                                           int64_t j) {
+    if (j < 0 || j >= n) {
+        return -1;
+    }
+    uint32_t code_i = static_cast<uint32_t>(codes[i]);
+    uint32_t code_j = static_cast<uint32_t>(codes[j]);
+    if (code_i == code_j) {
+        return 32 + CountLeadingZeros(static_cast<uint32_t>(i ^ j));
+    }
+    return CountLeadingZeros(code_i ^ code_j);
+}
+
+template <typename T>
+OPEN3D_HOST_DEVICE inline T PointDistance(const T* a, const T* b) {
+    T dx = a[0] - b[0];
+    T dy = a[1] - b[1];
+    T dz = a[2] - b[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+/// Squared distance from a point to an axis-aligned box {min_xyz, max_xyz}.
+template <typename T>
+OPEN3D_HOST_DEVICE inline T BoxDistance(const T* aabb, const T* point) {
+    T dist = 0;
+    for (int c = 0; c < 3; ++c) {
+        T below = aabb[c] - point[c];
+        T above = point[c] - aabb[3 + c];
+        T d = below > 0 ? below : (above > 0 ? above : 0);
+        dist += d * d;
+    }
+    return dist;
+}
+
+template <typename T>
+OPEN3D_HOST_DEVICE inline void HeapSwap(T* dist, index_t* idx, int a, int b) {
+    T d = dist[a];
+    dist[a] = dist[b];
+    dist[b] = d;
+    index_t i = idx[a];
+    idx[a] = idx[b];
+    idx[b] = i;
+}
+
+/// Restores the max-heap property below pos.
+template <typename T>
+OPEN3D_HOST_DEVICE inline void HeapSiftDown(T* dist,
+                                            index_t* idx,
+                                            int count,
+                                            int pos) {
+    while (true) {
+        int largest = pos;
+        int left = 2 * pos + 1;
+        int right = left + 1;
+        if (left < count && dist[left] > dist[largest]) largest = left;
+        if (right < count && dist[right] > dist[largest]) largest = right;
+        if (largest == pos) return;
+        HeapSwap(dist, idx, pos, largest);
+        pos = largest;
+    }
+}
+
+template <typename T>
+OPEN3D_HOST_DEVICE inline void HeapPush(
+        T* dist, index_t* idx, int count, T d, index_t i) {
+    int pos = count;
+    while (pos > 0) {
+        int parent = (pos - 1) / 2;
+        if (dist[parent] >= d) break;
+        dist[pos] = dist[parent];
+        idx[pos] = idx[parent];
+        pos = parent;
+    }
+    dist[pos] = d;
+    idx[pos] = i;
+}
+
+/// Sorts a max-heap in ascending order in place.
+template <typename T>
+OPEN3D_HOST_DEVICE inline void HeapSort(T* dist, index_t* idx, int count) {
+    for (int end = count - 1; end > 0; --end) {
+        HeapSwap(dist, idx, 0, end);
+        HeapSiftDown(dist, idx, end, 0);
+    }
+}
+
+/// Calls visit(point_index, squared_distance) for all points strictly within
+/// the squared radius of the query.
+template <typename T, typename func_t>
+OPEN3D_HOST_DEVICE inline void TraverseRadius(const T* points,
+                                              const index_t* sorted_indices,
+                                              const index_t* children,
+                                              const T* aabbs,
+                                              int64_t n,
+                                              const T* query,
+                                              T radius_squared,
+                                              func_t visit) {
+    index_t stack[kLBVHStackSize];
+    int top = 0;
+    if (n > 0) {
+        stack[top++] = 0;
+    }
+    while (top > 0) {
+        index_t node = stack[--top];
+        if (BoxDistance(aabbs + 6 * node, query) >= radius_squared) {
+            continue;
+        }
+        if (node >= n - 1) {
+            index_t point_idx = sorted_indices[node - (n - 1)];
+            T d = PointDistance(points + 3 * point_idx, query);
+            if (d < radius_squared) {
+                visit(point_idx, d);
+            }
+        } else {
+            stack[top++] = children[2 * node];
+            stack[top++] = children[2 * node + 1];
+        }
+    }
+}
+
+template <typename T>
+void BuildLBVH(const Tensor& points,
+               Tensor& sorted_indices,
+               Tensor& children,
+               Tensor& aabbs) {
+    const Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t num_internal = n > 0 ? n - 1 : 0;
+    children = Tensor({num_internal, 2}, Int32, device);
+    aabbs = Tensor({num_internal + n, 6}, points.GetDtype(), device);
+    if (n == 0) {
+        sorted_indices = Tensor({0}, Int32, device);
+        return;
+    }
+
+    // Morton codes of the points quantized in their bounding box.
+    const Tensor min_bound = points.Min({0}).To(Device("CPU:0"));
+    const Tensor extent =
+            points.Max({0}).To(Device("CPU:0")).Sub(min_bound);
+    const T* min_ptr = min_bound.GetDataPtr<T>();
+    const T* extent_ptr = extent.GetDataPtr<T>();
+    const T min_x = min_ptr[0], min_y = min_ptr[1], min_z = min_ptr[2];
+    const T scale_x = extent_ptr[0] > 0 ? 1024 / extent_ptr[0] : 0;
+    const T scale_y = extent_ptr[1] > 0 ? 1024 / extent_ptr[1] : 0;
+    const T scale_z = extent_ptr[2] > 0 ? 1024 / extent_ptr[2] : 0;
+
+    const T* points_ptr = points.GetDataPtr<T>();
+    Tensor codes({n}, Int64, device);
+    int64_t* codes_ptr = codes.GetDataPtr<int64_t>();
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t i) {
+        auto quantize = [] OPEN3D_DEVICE(T v) -> uint32_t {
+            return v <= 0 ? 0u : (v >= 1023 ? 1023u : static_cast<uint32_t>(v));
+        };
+        uint32_t x = quantize((points_ptr[3 * i + 0] - min_x) * scale_x);
+        uint32_t y = quantize((points_ptr[3 * i + 1] - min_y) * scale_y);
+        uint32_t z = quantize((points_ptr[3 * i + 2] - min_z) * scale_z);
+        codes_ptr[i] = (ExpandBits(x) << 2) | (ExpandBits(y) << 1) |
+                       ExpandBits(z);
+    });
+
+    const Tensor order = codes.Argsort();
+    const Tensor sorted_codes = codes.IndexGet({order});
+    sorted_indices = order.To(Int32);
+
+    // Internal node i covers the leaf range found by Karras' method; node 0
+    // is the root. Leaf j is stored as node n - 1 + j.
+    const int64_t* sorted_codes_ptr = sorted_codes.GetDataPtr<int64_t>();
+    index_t* children_ptr = children.GetDataPtr<index_t>();
+    Tensor parents({num_internal + n}, Int32, device);
+    index_t* parents_ptr = parents.GetDataPtr<index_t>();
+    core::ParallelFor(device, num_internal, [=] OPEN3D_DEVICE(int64_t i) {
+        const int64_t* c = sorted_codes_ptr;
+        int d = CommonPrefix(c, n, i, i + 1) > CommonPrefix(c, n, i, i - 1)
+                        ? 1
+                        : -1;
+
+        // Upper bound and then exact length of the range.
+        int prefix_min = CommonPrefix(c, n, i, i - d);
+        int64_t length_max = 2;
+        while (CommonPrefix(c, n, i, i + length_max * d) > prefix_min) {
+            length_max *= 2;
+        }
+        int64_t length = 0;
+        for (int64_t t = length_max / 2; t >= 1; t /= 2) {
+            if (CommonPrefix(c, n, i, i + (length + t) * d) > prefix_min) {
+                length += t;
+            }
+        }
+        int64_t j = i + length * d;
+
+        // Split position within the range.
+        int prefix_node = CommonPrefix(c, n, i, j);
+        int64_t split = 0;
+        int64_t t = length;
+        do {
+            t = (t + 1) / 2;
+            if (CommonPrefix(c, n, i, i + (split + t) * d) > prefix_node) {
+                split += t;
+            }
+        } while (t > 1);
+        int64_t gamma = i + split * d + (d < 0 ? -1 : 0);
+
+        int64_t first = i < j ? i : j;
+        int64_t last = i < j ? j : i;
+        index_t left = static_cast<index_t>(
+                first == gamma ? num_internal + gamma : gamma);
+        index_t right = static_cast<index_t>(
+                last == gamma + 1 ? num_internal + gamma + 1 : gamma + 1);
+        children_ptr[2 * i] = left;
+        children_ptr[2 * i + 1] = right;
+        parents_ptr[left] = static_cast<index_t>(i);
+        parents_ptr[right] = static_cast<index_t>(i);
+    });
+
+    // Bounding boxes, bottom-up. The second child to reach a node merges
+    // both boxes and continues towards the root.
+    Tensor visits = Tensor::Zeros({num_internal}, Int32, device);
+    int* visits_ptr = visits.GetDataPtr<int>();
+    const index_t* sorted_indices_ptr = sorted_indices.GetDataPtr<index_t>();
+    T* aabbs_ptr = aabbs.GetDataPtr<T>();
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t j) {
+        int64_t node = num_internal + j;
+        const T* point = points_ptr + 3 * sorted_indices_ptr[j];
+        for (int c = 0; c < 3; ++c) {
+            aabbs_ptr[6 * node + c] = point[c];
+            aabbs_ptr[6 * node + 3 + c] = point[c];
+        }
+        while (node != 0) {
+            index_t parent = parents_ptr[node];
+#if defined(__CUDACC__)
+            __threadfence();
+            int visited = atomicAdd(visits_ptr + parent, 1);
+#else
+            int visited = reinterpret_cast<std::atomic<int>*>(visits_ptr +
+                                                              parent)
+                                  ->fetch_add(1);
+#endif
+            if (visited == 0) {
+                return;
+            }
+            const volatile T* left =
+                    aabbs_ptr + 6 * children_ptr[2 * parent];
+            const volatile T* right =
+                    aabbs_ptr + 6 * children_ptr[2 * parent + 1];
+            T* box = aabbs_ptr + 6 * parent;
+            for (int c = 0; c < 3; ++c) {
+                T lo_l = left[c], lo_r = right[c];
+                T hi_l = left[3 + c], hi_r = right[3 + c];
+                box[c] = lo_l < lo_r ? lo_l : lo_r;
+                box[3 + c] = hi_l > hi_r ? hi_l : hi_r;
+            }
+            node = parent;
+        }
+    });
+}
+
+template <typename T>
+void KnnSearchLBVH(const Tensor& points,
+                   const Tensor& sorted_indices,
+                   const Tensor& children,
+                   const Tensor& aabbs,
+                   const Tensor& queries,
+                   int knn,
+                   T max_distance_squared,
+                   Tensor& indices,
+                   Tensor& distances,
+                   Tensor& counts) {
+    const Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t num_queries = queries.GetLength();
+    indices = Tensor({num_queries, knn}, Int32, device);
+    distances = Tensor({num_queries, knn}, points.GetDtype(), device);
+    counts = Tensor({num_queries}, Int32, device);
+
+    const T* points_ptr = points.GetDataPtr<T>();
+    const index_t* sorted_indices_ptr = sorted_indices.GetDataPtr<index_t>();
+    const index_t* children_ptr = children.GetDataPtr<index_t>();
+    const T* aabbs_ptr = aabbs.GetDataPtr<T>();
+    const T* queries_ptr = queries.GetDataPtr<T>();
+    index_t* indices_ptr = indices.GetDataPtr<index_t>();
+    T* distances_ptr = distances.GetDataPtr<T>();
+    index_t* counts_ptr = counts.GetDataPtr<index_t>();
+
+    core::ParallelFor(device, num_queries, [=] OPEN3D_DEVICE(int64_t i) {
+        const T* query = queries_ptr + 3 * i;
+        index_t* idx = indices_ptr + i * knn;
+        T* dist = distances_ptr + i * knn;
+
+        // The results are kept as a max-heap on the output row.
+        int count = 0;
+        index_t stack[kLBVHStackSize];
+        int top = 0;
+        if (n > 0) {
+            stack[top++] = 0;
+        }
+        while (top > 0) {
+            index_t node = stack[--top];
+            T bound = count < knn ? max_distance_squared : dist[0];
+            if (BoxDistance(aabbs_ptr + 6 * node, query) >= bound) {
+                continue;
+            }
+            if (node >= n - 1) {
+                index_t point_idx = sorted_indices_ptr[node - (n - 1)];
+                T d = PointDistance(points_ptr + 3 * point_idx, query);
+                if (count < knn) {
+                    HeapPush(dist, idx, count++, d, point_idx);
+                } else {
+                    dist[0] = d;
+                    idx[0] = point_idx;
+                    HeapSiftDown(dist, idx, count, 0);
+                }
+                continue;
+            }
+
+            // Push the nearer child last so that it is visited first.
+            index_t left = children_ptr[2 * node];
+            index_t right = children_ptr[2 * node + 1];
+            T d_left = BoxDistance(aabbs_ptr + 6 * left, query);
+            T d_right = BoxDistance(aabbs_ptr + 6 * right, query);
+            index_t near = d_left < d_right ? left : right;
+            index_t far = d_left < d_right ? right : left;
+            T d_near = d_left < d_right ? d_left : d_right;
+            T d_far = d_left < d_right ? d_right : d_left;
+            if (d_far < bound) stack[top++] = far;
+            if (d_near < bound) stack[top++] = near;
+        }
+
+        HeapSort(dist, idx, count);
+        counts_ptr[i] = count;
+        for (int k = count; k < knn; ++k) {
+            idx[k] = -1;
+            dist[k] = 0;
+        }
+    });
+}
+
+template <typename T>
+void RadiusSearchLBVH(const Tensor& points,
+                      const Tensor& sorted_indices,
+                      const Tensor& children,
+                      const Tensor& aabbs,
+                      const Tensor& queries,
+                      const Tensor& radii,
+                      bool sort,
+                      Tensor& indices,
+                      Tensor& distances,
+                      Tensor& row_splits) {
+    const Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t num_queries = queries.GetLength();
+
+    const T* points_ptr = points.GetDataPtr<T>();
+    const index_t* sorted_indices_ptr = sorted_indices.GetDataPtr<index_t>();
+    const index_t* children_ptr = children.GetDataPtr<index_t>();
+    const T* aabbs_ptr = aabbs.GetDataPtr<T>();
+    const T* queries_ptr = queries.GetDataPtr<T>();
+    const T* radii_ptr = radii.GetDataPtr<T>();
+
+    // Count, scan, then fill the neighbors of each query.
+    Tensor counts({num_queries}, Int64, device);
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+    core::ParallelFor(device, num_queries, [=] OPEN3D_DEVICE(int64_t i) {
+        int64_t count = 0;
+        TraverseRadius(points_ptr, sorted_indices_ptr, children_ptr, aabbs_ptr,
+                       n, queries_ptr + 3 * i, radii_ptr[i] * radii_ptr[i],
+                       [&] OPEN3D_DEVICE(index_t, T) { ++count; });
+        counts_ptr[i] = count;
+    });
+
+    row_splits = Tensor::Zeros({num_queries + 1}, Int64, device);
+    int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::cuda::par.on(cuda::GetStream()), counts_ptr,
+                           counts_ptr + num_queries, row_splits_ptr + 1);
+#else
+    utility::InclusivePrefixSum(counts_ptr, counts_ptr + num_queries,
+                                row_splits_ptr + 1);
+#endif
+    const int64_t total = row_splits[num_queries].Item<int64_t>();
+
+    indices = Tensor({total}, Int32, device);
+    distances = Tensor({total}, points.GetDtype(), device);
+    index_t* indices_ptr = indices.GetDataPtr<index_t>();
+    T* distances_ptr = distances.GetDataPtr<T>();
+    core::ParallelFor(device, num_queries, [=] OPEN3D_DEVICE(int64_t i) {
+        const int64_t begin = row_splits_ptr[i];
+        int64_t offset = begin;
+        TraverseRadius(points_ptr, sorted_indices_ptr, children_ptr, aabbs_ptr,
+                       n, queries_ptr + 3 * i, radii_ptr[i] * radii_ptr[i],
+                       [&] OPEN3D_DEVICE(index_t point_idx, T d) {
+                           indices_ptr[offset] = point_idx;
+                           distances_ptr[offset] = d;
+                           ++offset;
+                       });
+        if (sort) {
+            // Insertion sort, the neighborhoods are small.
+            for (int64_t k = begin + 1; k < offset; ++k) {
+                T d = distances_ptr[k];
+                index_t point_idx = indices_ptr[k];
+                int64_t m = k;
+                while (m > begin && distances_ptr[m - 1] > d) {
+                    distances_ptr[m] = distances_ptr[m - 1];
+                    indices_ptr[m] = indices_ptr[m - 1];
+                    --m;
+                }
+                distances_ptr[m] = d;
+                indices_ptr[m] = point_idx;
+            }
+        }
+    });
+}
+
+}  // namespace
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,92 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/LBVHIndex.h"
+#include "open3d/core/nns/LBVHSearchImpl.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+template <class T>
+void BuildLBVHCPU(const Tensor& points,
+                  Tensor& sorted_indices,
+                  Tensor& children,
+                  Tensor& aabbs) {
+    BuildLBVH<T>(points, sorted_indices, children, aabbs);
+}
+
+template <class T>
+void KnnSearchLBVHCPU(const Tensor& points,
+                      const Tensor& sorted_indices,
+                      const Tensor& children,
+                      const Tensor& aabbs,
+                      const Tensor& queries,
+                      int knn,
+                      T max_distance_squared,
+                      Tensor& indices,
+                      Tensor& distances,
+                      Tensor& counts) {
+    KnnSearchLBVH<T>(points, sorted_indices, children, aabbs, queries, knn,
+                     max_distance_squared, indices, distances, counts);
+}
+
+template <class T>
+void RadiusSearchLBVHCPU(const Tensor& points,
+                         const Tensor& sorted_indices,
+                         const Tensor& children,
+                         const Tensor& aabbs,
+                         const Tensor& queries,
+                         const Tensor& radii,
+                         bool sort,
+                         Tensor& indices,
+                         Tensor& distances,
+                         Tensor& row_splits) {
+    RadiusSearchLBVH<T>(points, sorted_indices, children, aabbs, queries,
+                        radii, sort, indices, distances, row_splits);
+}
+
+#define INSTANTIATE(T)                                                         \
+    template void BuildLBVHCPU<T>(const Tensor& points,                        \
+                                  Tensor& sorted_indices, Tensor& children,    \
+                                  Tensor& aabbs);                              \
+    template void KnnSearchLBVHCPU<T>(                                         \
+            const Tensor& points, const Tensor& sorted_indices,                \
+            const Tensor& children, const Tensor& aabbs,                       \
+            const Tensor& queries, int knn, T max_distance_squared,            \
+            Tensor& indices, Tensor& distances, Tensor& counts);               \
+    template void RadiusSearchLBVHCPU<T>(                                      \
+            const Tensor& points, const Tensor& sorted_indices,                \
+            const Tensor& children, const Tensor& aabbs,                       \
+            const Tensor& queries, const Tensor& radii, bool sort,             \
+            Tensor& indices, Tensor& distances, Tensor& row_splits);
+
+INSTANTIATE(float)
+INSTANTIATE(double)
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
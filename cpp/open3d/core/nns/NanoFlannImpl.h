@@ -26,14 +26,24 @@
 #pragma once
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_sort.h>
 
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <nanoflann.hpp>
+#include <string>
+#include <unordered_map>
 
 #include "open3d/core/Atomic.h"
+#include "open3d/core/Tensor.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ParallelScan.h"
 
 namespace open3d {
@@ -43,31 +53,57 @@ namespace nns {
 typedef int32_t index_t;
 
 /// NanoFlann Index Holder.
+///
+/// Large datasets are split at the median of the widest bounding box
+/// dimension into spatially disjoint subsets, in parallel, and a kd-tree is
+/// built for each subset concurrently. Searches visit the subtrees in order of
+/// their bounding box distance to the query and skip the ones that cannot
+/// contain a neighbor.
+///
+/// A built holder can be written with Serialize() into flat arrays (dataset
+/// permutation, subtree table and nanoflann tree nodes) and restored without
+/// rebuilding. The permutation is used in place, so it may be a memory-mapped
+/// tensor shared by several processes.
 template <int METRIC, class TReal, class TIndex>
 struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
     /// This class is the Adaptor for connecting Open3D Tensor and NanoFlann.
+    /// It exposes the subset of points given by \p point_ids, with the
+    /// precomputed bounding box [min_bound, max_bound].
     struct DataAdaptor {
         DataAdaptor(size_t dataset_size,
                     int dimension,
-                    const TReal *const data_ptr)
+                    const TReal *const data_ptr,
+                    const TIndex *const point_ids,
+                    const TReal *const min_bound,
+                    const TReal *const max_bound)
             : dataset_size_(dataset_size),
               dimension_(dimension),
-              data_ptr_(data_ptr) {}
+              data_ptr_(data_ptr),
+              point_ids_(point_ids),
+              min_bound_(min_bound),
+              max_bound_(max_bound) {}
 
         inline size_t kdtree_get_point_count() const { return dataset_size_; }
 
         inline TReal kdtree_get_pt(const size_t idx, const size_t dim) const {
-            return data_ptr_[idx * dimension_ + dim];
+            return data_ptr_[point_ids_[idx] * dimension_ + dim];
         }
 
         template <class BBOX>
-        bool kdtree_get_bbox(BBOX &) const {
-            return false;
+        bool kdtree_get_bbox(BBOX &bbox) const {
+            for (int d = 0; d < dimension_; ++d) {
+                bbox[d].low = min_bound_[d];
+                bbox[d].high = max_bound_[d];
+            }
+            return true;
         }
 
         size_t dataset_size_ = 0;
         int dimension_ = 0;
         const TReal *const data_ptr_;
+        const TIndex *const point_ids_;
+        const TReal *const min_bound_;
+        const TReal *const max_bound_;
     };
 
     /// Adaptor Selector.
@@ -92,16 +128,363 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
             TIndex>
             KDTree_t;
 
+    /// A kd-tree over the points point_ids_[begin_, end_).
+    struct Subtree {
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        std::vector<TReal> min_bound_;
+        std::vector<TReal> max_bound_;
+        std::unique_ptr<DataAdaptor> adaptor_;
+        std::unique_ptr<KDTree_t> index_;
+    };
+
+    /// Forwards the neighbors found in a subtree to the result set of the
+    /// search, translating subtree indices to dataset indices.
+    template <class RESULTSET>
+    struct SubtreeResultSet {
+        typedef typename RESULTSET::DistanceType DistanceType;
+
+        inline DistanceType worstDist() const { return result_.worstDist(); }
+        inline bool full() const { return result_.full(); }
+        inline size_t size() const { return result_.size(); }
+        inline bool addPoint(DistanceType dist, TIndex index) {
+            result_.addPoint(dist, point_ids_[index]);
+            return true;
+        }
+
+        RESULTSET &result_;
+        const TIndex *const point_ids_;
+    };
+
+    /// Minimum number of points per subtree. Smaller datasets are built as a
+    /// single tree.
+    static constexpr size_t kMinSubtreeSize = 1 << 16;
+
     NanoFlannIndexHolder(size_t dataset_size,
                          int dimension,
-                         const TReal *data_ptr) {
-        adaptor_.reset(new DataAdaptor(dataset_size, dimension, data_ptr));
-        index_.reset(new KDTree_t(dimension, *adaptor_.get()));
-        index_->buildIndex();
+                         const TReal *data_ptr,
+                         size_t leaf_max_size = 10)
+        : dimension_(dimension), data_ptr_(data_ptr) {
+        point_ids_ = Tensor({static_cast<int64_t>(dataset_size)},
+                            Dtype::FromType<TIndex>());
+        TIndex *const point_ids = point_ids_.GetDataPtr<TIndex>();
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, dataset_size),
+                          [&](const tbb::blocked_range<size_t> &r) {
+                              for (size_t i = r.begin(); i != r.end(); ++i) {
+                                  point_ids[i] = static_cast<TIndex>(i);
+                              }
+                          });
+
+        // Use a power of two number of subtrees, about twice the number of
+        // threads so that the build stays balanced.
+        const size_t max_subtrees =
+                2 * static_cast<size_t>(utility::EstimateMaxThreads());
+        size_t num_subtrees = 1;
+        while (num_subtrees < max_subtrees &&
+               dataset_size / (2 * num_subtrees) >= kMinSubtreeSize) {
+            num_subtrees *= 2;
+        }
+        subtrees_.resize(num_subtrees);
+        Partition(0, dataset_size, 0, num_subtrees);
+
+        const nanoflann::KDTreeSingleIndexAdaptorParams params(leaf_max_size);
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_subtrees, 1),
+                [&](const tbb::blocked_range<size_t> &r) {
+                    for (size_t s = r.begin(); s != r.end(); ++s) {
+                        Subtree &subtree = subtrees_[s];
+                        InitSubtree(subtree, params);
+                        subtree.index_->buildIndex();
+                    }
+                });
+    }
+
+    /// Restores a holder from the arrays returned by Serialize(). \p data_ptr
+    /// must point to the same points the holder was built on.
+    NanoFlannIndexHolder(size_t dataset_size,
+                         int dimension,
+                         const TReal *data_ptr,
+                         const std::unordered_map<std::string, Tensor> &arrays)
+        : dimension_(dimension), data_ptr_(data_ptr) {
+        for (const char *key :
+             {"metric", "point_ids", "subtree_ranges", "subtree_bounds",
+              "tree_offsets", "trees"}) {
+            if (arrays.count(key) == 0) {
+                utility::LogError("Serialized index is missing array {}.",
+                                  key);
+            }
+        }
+        if (arrays.at("metric").To(Int64).Item<int64_t>() != METRIC) {
+            utility::LogError("Serialized index has a different metric.");
+        }
+        point_ids_ = arrays.at("point_ids").Contiguous();
+        if (point_ids_.GetDtype() != Dtype::FromType<TIndex>() ||
+            point_ids_.GetShape() !=
+                    SizeVector{static_cast<int64_t>(dataset_size)}) {
+            utility::LogError(
+                    "Serialized index does not match the dataset of {} "
+                    "points.",
+                    dataset_size);
+        }
+
+        const Tensor ranges = arrays.at("subtree_ranges").Contiguous();
+        const Tensor bounds =
+                arrays.at("subtree_bounds").To(Dtype::FromType<TReal>());
+        const Tensor offsets = arrays.at("tree_offsets").Contiguous();
+        const Tensor trees = arrays.at("trees").Contiguous();
+        const int64_t num_subtrees = ranges.GetLength();
+        if (ranges.GetShape() != SizeVector{num_subtrees, 2} ||
+            bounds.GetShape() != SizeVector{num_subtrees, 2, dimension} ||
+            offsets.GetShape() != SizeVector{num_subtrees + 1} ||
+            ranges.GetDtype() != Int64 || offsets.GetDtype() != Int64 ||
+            trees.GetDtype() != UInt8) {
+            utility::LogError("Serialized index has an invalid subtree table.");
+        }
+
+        const int64_t *const range_ptr = ranges.GetDataPtr<int64_t>();
+        const TReal *const bound_ptr = bounds.GetDataPtr<TReal>();
+        const int64_t *const offset_ptr = offsets.GetDataPtr<int64_t>();
+        const uint8_t *const tree_ptr = trees.GetDataPtr<uint8_t>();
+        subtrees_.resize(num_subtrees);
+        for (int64_t s = 0; s < num_subtrees; ++s) {
+            Subtree &subtree = subtrees_[s];
+            subtree.begin_ = static_cast<size_t>(range_ptr[2 * s]);
+            subtree.end_ = static_cast<size_t>(range_ptr[2 * s + 1]);
+            if (subtree.begin_ > subtree.end_ || subtree.end_ > dataset_size ||
+                offset_ptr[s] > offset_ptr[s + 1] ||
+                offset_ptr[s + 1] > trees.GetLength()) {
+                utility::LogError(
+                        "Serialized index has an invalid subtree table.");
+            }
+            const TReal *const subtree_bounds = bound_ptr + 2 * s * dimension;
+            subtree.min_bound_.assign(subtree_bounds,
+                                      subtree_bounds + dimension);
+            subtree.max_bound_.assign(subtree_bounds + dimension,
+                                      subtree_bounds + 2 * dimension);
+            InitSubtree(subtree, nanoflann::KDTreeSingleIndexAdaptorParams());
+
+            // nanoflann only reads trees from a stream.
+            FILE *stream = std::tmpfile();
+            if (stream == nullptr) {
+                utility::LogError("Failed to create a temporary file.");
+            }
+            const size_t num_bytes =
+                    static_cast<size_t>(offset_ptr[s + 1] - offset_ptr[s]);
+            if (std::fwrite(tree_ptr + offset_ptr[s], 1, num_bytes, stream) !=
+                num_bytes) {
+                std::fclose(stream);
+                utility::LogError("Failed to write a temporary file.");
+            }
+            std::rewind(stream);
+            subtree.index_->loadIndex(stream);
+            std::fclose(stream);
+        }
+    }
+
+    /// Returns the holder as flat arrays, to be written with WriteNpz and
+    /// passed back to the restoring constructor. The dataset points are not
+    /// included.
+    std::unordered_map<std::string, Tensor> Serialize() const {
+        const int64_t num_subtrees = static_cast<int64_t>(subtrees_.size());
+        Tensor ranges({num_subtrees, 2}, Int64);
+        Tensor bounds({num_subtrees, 2, dimension_},
+                      Dtype::FromType<TReal>());
+        Tensor offsets({num_subtrees + 1}, Int64);
+        int64_t *const range_ptr = ranges.GetDataPtr<int64_t>();
+        TReal *const bound_ptr = bounds.GetDataPtr<TReal>();
+        int64_t *const offset_ptr = offsets.GetDataPtr<int64_t>();
+
+        std::vector<uint8_t> tree_bytes;
+        offset_ptr[0] = 0;
+        for (int64_t s = 0; s < num_subtrees; ++s) {
+            const Subtree &subtree = subtrees_[s];
+            range_ptr[2 * s] = static_cast<int64_t>(subtree.begin_);
+            range_ptr[2 * s + 1] = static_cast<int64_t>(subtree.end_);
+            std::copy(subtree.min_bound_.begin(), subtree.min_bound_.end(),
+                      bound_ptr + 2 * s * dimension_);
+            std::copy(subtree.max_bound_.begin(), subtree.max_bound_.end(),
+                      bound_ptr + (2 * s + 1) * dimension_);
+
+            FILE *stream = std::tmpfile();
+            if (stream == nullptr) {
+                utility::LogError("Failed to create a temporary file.");
+            }
+            subtree.index_->saveIndex(stream);
+            const long num_bytes = std::ftell(stream);
+            std::rewind(stream);
+            const size_t tree_offset = tree_bytes.size();
+            tree_bytes.resize(tree_offset + num_bytes);
+            const size_t num_read = std::fread(tree_bytes.data() + tree_offset,
+                                               1, num_bytes, stream);
+            std::fclose(stream);
+            if (num_bytes < 0 || num_read != static_cast<size_t>(num_bytes)) {
+                utility::LogError("Failed to read a temporary file.");
+            }
+            offset_ptr[s + 1] = static_cast<int64_t>(tree_bytes.size());
+        }
+
+        std::unordered_map<std::string, Tensor> arrays;
+        arrays["metric"] = Tensor::Init<int64_t>(METRIC);
+        arrays["point_ids"] = point_ids_;
+        arrays["subtree_ranges"] = ranges;
+        arrays["subtree_bounds"] = bounds;
+        arrays["tree_offsets"] = offsets;
+        arrays["trees"] = Tensor(tree_bytes, {static_cast<int64_t>(
+                                                      tree_bytes.size())},
+                                 UInt8);
+        return arrays;
+    }
+
+    /// Runs a nanoflann search for \p query over all subtrees that may hold a
+    /// neighbor, adding the neighbors with their dataset indices to
+    /// \p result_set.
+    template <class RESULTSET>
+    void FindNeighbors(RESULTSET &result_set,
+                       const TReal *const query,
+                       const nanoflann::SearchParams &params) const {
+        if (subtrees_.size() == 1) {
+            SubtreeResultSet<RESULTSET> subtree_result{
+                    result_set, point_ids_.GetDataPtr<TIndex>()};
+            subtrees_[0].index_->findNeighbors(subtree_result, query, params);
+            return;
+        }
+
+        std::vector<std::pair<TReal, size_t>> order(subtrees_.size());
+        for (size_t s = 0; s < subtrees_.size(); ++s) {
+            order[s] = std::make_pair(BoxDistance(subtrees_[s], query), s);
+        }
+        std::sort(order.begin(), order.end());
+
+        const TReal eps_error = 1 + params.eps;
+        for (const auto &dist_subtree : order) {
+            if (dist_subtree.first * eps_error > result_set.worstDist()) {
+                break;
+            }
+            const Subtree &subtree = subtrees_[dist_subtree.second];
+            SubtreeResultSet<RESULTSET> subtree_result{
+                    result_set,
+                    point_ids_.GetDataPtr<TIndex>() + subtree.begin_};
+            subtree.index_->findNeighbors(subtree_result, query, params);
+        }
+    }
+
+    /// Finds the \p knn nearest neighbors of \p query. Returns the number of
+    /// neighbors found.
+    size_t knnSearch(const TReal *const query,
+                     size_t knn,
+                     TIndex *out_indices,
+                     TReal *out_distances,
+                     const nanoflann::SearchParams &params =
+                             nanoflann::SearchParams()) const {
+        nanoflann::KNNResultSet<TReal, TIndex> result_set(knn);
+        result_set.init(out_indices, out_distances);
+        FindNeighbors(result_set, query, params);
+        return result_set.size();
+    }
+
+    /// Finds the neighbors of \p query closer than \p radius, measured in the
+    /// metric's distance (squared for L2). Returns the number of neighbors.
+    size_t radiusSearch(const TReal *const query,
+                        TReal radius,
+                        std::vector<std::pair<TIndex, TReal>> &indices_dists,
+                        const nanoflann::SearchParams &params) const {
+        nanoflann::RadiusResultSet<TReal, TIndex> result_set(radius,
+                                                             indices_dists);
+        FindNeighbors(result_set, query, params);
+        if (params.sorted) {
+            std::sort(indices_dists.begin(), indices_dists.end(),
+                      nanoflann::IndexDist_Sorter());
+        }
+        return indices_dists.size();
+    }
+
+private:
+    /// Creates the (unbuilt) nanoflann index of \p subtree.
+    void InitSubtree(Subtree &subtree,
+                     const nanoflann::KDTreeSingleIndexAdaptorParams &params) {
+        subtree.adaptor_.reset(new DataAdaptor(
+                subtree.end_ - subtree.begin_, dimension_, data_ptr_,
+                point_ids_.GetDataPtr<TIndex>() + subtree.begin_,
+                subtree.min_bound_.data(), subtree.max_bound_.data()));
+        subtree.index_.reset(
+                new KDTree_t(dimension_, *subtree.adaptor_, params));
+    }
+
+    /// Splits point_ids_[begin, end) into num_subtrees subtrees, starting at
+    /// subtrees_[subtree_offset].
+    void Partition(size_t begin,
+                   size_t end,
+                   size_t subtree_offset,
+                   size_t num_subtrees) {
+        std::vector<TReal> min_bound, max_bound;
+        ComputeBounds(begin, end, min_bound, max_bound);
+        if (num_subtrees == 1) {
+            Subtree &subtree = subtrees_[subtree_offset];
+            subtree.begin_ = begin;
+            subtree.end_ = end;
+            subtree.min_bound_ = std::move(min_bound);
+            subtree.max_bound_ = std::move(max_bound);
+            return;
+        }
+
+        int split_dim = 0;
+        for (int d = 1; d < dimension_; ++d) {
+            if (max_bound[d] - min_bound[d] >
+                max_bound[split_dim] - min_bound[split_dim]) {
+                split_dim = d;
+            }
+        }
+        const size_t mid = begin + (end - begin) / 2;
+        TIndex *const point_ids = point_ids_.GetDataPtr<TIndex>();
+        std::nth_element(point_ids + begin, point_ids + mid, point_ids + end,
+                         [&](TIndex lhs, TIndex rhs) {
+                             return data_ptr_[lhs * dimension_ + split_dim] <
+                                    data_ptr_[rhs * dimension_ + split_dim];
+                         });
+
+        const size_t half = num_subtrees / 2;
+        tbb::parallel_invoke(
+                [&]() { Partition(begin, mid, subtree_offset, half); },
+                [&]() { Partition(mid, end, subtree_offset + half, half); });
     }
 
-    std::unique_ptr<KDTree_t> index_;
-    std::unique_ptr<DataAdaptor> adaptor_;
+    void ComputeBounds(size_t begin,
+                       size_t end,
+                       std::vector<TReal> &min_bound,
+                       std::vector<TReal> &max_bound) const {
+        min_bound.assign(dimension_, std::numeric_limits<TReal>::max());
+        max_bound.assign(dimension_, std::numeric_limits<TReal>::lowest());
+        const TIndex *const point_ids = point_ids_.GetDataPtr<TIndex>();
+        for (size_t i = begin; i < end; ++i) {
+            const TReal *const p = data_ptr_ + point_ids[i] * dimension_;
+            for (int d = 0; d < dimension_; ++d) {
+                min_bound[d] = std::min(min_bound[d], p[d]);
+                max_bound[d] = std::max(max_bound[d], p[d]);
+            }
+        }
+    }
+
+    /// Distance from \p query to the bounding box of \p subtree, in the same
+    /// units as the nanoflann metric.
+    TReal BoxDistance(const Subtree &subtree, const TReal *const query) const {
+        TReal dist = 0;
+        for (int d = 0; d < dimension_; ++d) {
+            TReal diff = 0;
+            if (query[d] < subtree.min_bound_[d]) {
+                diff = subtree.min_bound_[d] - query[d];
+            } else if (query[d] > subtree.max_bound_[d]) {
+                diff = query[d] - subtree.max_bound_[d];
+            }
+            dist += METRIC == L2 ? diff * diff : diff;
+        }
+        return dist;
+    }
+
+    int dimension_ = 0;
+    const TReal *data_ptr_;
+    /// Dataset indices ordered by subtree, with dtype TIndex.
+    Tensor point_ids_;
+    std::vector<Subtree> subtrees_;
 };
 namespace impl {
 
@@ -110,9 +493,71 @@ template <class T, int METRIC>
 void _BuildKdTree(size_t num_points,
                   const T *const points,
                   size_t dimension,
+                  size_t leaf_max_size,
                   NanoFlannIndexHolderBase **holder) {
-    *holder = new NanoFlannIndexHolder<METRIC, T, index_t>(num_points,
-                                                           dimension, points);
+    *holder = new NanoFlannIndexHolder<METRIC, T, index_t>(
+            num_points, dimension, points, leaf_max_size);
+}
+
+/// Number of consecutive queries handed to one task in the coherent query
+/// order, so that each task walks the same region of the tree.
+constexpr size_t kKnnQueryTileSize = 64;
+
+/// Spreads the lower 10 bits of v so that two zero bits sit between them.
+inline uint32_t _ExpandBits(uint32_t v) {
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+}
+
+/// Returns the query indices sorted by the Morton code of their first (up to)
+/// three coordinates, which places spatially close queries next to each other.
+template <class T>
+std::vector<size_t> _SortQueriesByMortonCode(size_t num_queries,
+                                             const T *const queries,
+                                             size_t dimension) {
+    const size_t num_dims = std::min<size_t>(dimension, 3);
+    std::array<T, 3> min_bound{}, max_bound{};
+    for (size_t d = 0; d < num_dims; ++d) {
+        min_bound[d] = max_bound[d] = queries[d];
+    }
+    for (size_t i = 1; i < num_queries; ++i) {
+        for (size_t d = 0; d < num_dims; ++d) {
+            const T x = queries[i * dimension + d];
+            min_bound[d] = std::min(min_bound[d], x);
+            max_bound[d] = std::max(max_bound[d], x);
+        }
+    }
+
+    std::vector<std::pair<uint32_t, size_t>> codes(num_queries);
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_queries),
+            [&](const tbb::blocked_range<size_t> &r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    uint32_t code = 0;
+                    for (size_t d = 0; d < num_dims; ++d) {
+                        const T extent = max_bound[d] - min_bound[d];
+                        uint32_t q = 0;
+                        if (extent > 0) {
+                            q = static_cast<uint32_t>(
+                                    (queries[i * dimension + d] -
+                                     min_bound[d]) /
+                                    extent * 1023);
+                        }
+                        code |= _ExpandBits(q) << (2 - d);
+                    }
+                    codes[i] = std::make_pair(code, i);
+                }
+            });
+    tbb::parallel_sort(codes.begin(), codes.end());
+
+    std::vector<size_t> order(num_queries);
+    for (size_t i = 0; i < num_queries; ++i) {
+        order[i] = codes[i].second;
+    }
+    return order;
 }
 
 template <class T, class OUTPUT_ALLOCATOR, int METRIC>
@@ -126,7 +571,9 @@ void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                    int knn,
                    bool ignore_query_point,
                    bool return_distances,
-                   OUTPUT_ALLOCATOR &output_allocator) {
+                   OUTPUT_ALLOCATOR &output_allocator,
+                   float eps,
+                   bool coherent_queries) {
     // return empty indices array if there are no points
     if (num_queries == 0 || num_points == 0 || holder == nullptr) {
         std::fill(query_neighbors_row_splits,
@@ -154,15 +601,32 @@ void _KnnSearchCPU(NanoFlannIndexHolderBase *holder,
     auto holder_ =
             static_cast<NanoFlannIndexHolder<METRIC, T, index_t> *>(holder);
 
+    const nanoflann::SearchParams params(-1, eps);
+
+    // Results are stored by query index, so processing the queries in a
+    // different order does not change the output.
+    std::vector<size_t> query_order;
+    if (coherent_queries) {
+        query_order =
+                _SortQueriesByMortonCode(num_queries, queries, dimension);
+    }
+
     tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, num_queries),
+            tbb::blocked_range<size_t>(0, num_queries,
+                                       coherent_queries ? kKnnQueryTileSize
+                                                        : size_t(1)),
             [&](const tbb::blocked_range<size_t> &r) {
                 std::vector<index_t> result_indices(knn);
                 std::vector<T> result_distances(knn);
-                for (size_t i = r.begin(); i != r.end(); ++i) {
-                    size_t num_valid = holder_->index_->knnSearch(
-                            &queries[i * dimension], knn, result_indices.data(),
-                            result_distances.data());
+                for (size_t r_i = r.begin(); r_i != r.end(); ++r_i) {
+                    const size_t i =
+                            coherent_queries ? query_order[r_i] : r_i;
+                    nanoflann::KNNResultSet<T, index_t> result_set(knn);
+                    result_set.init(result_indices.data(),
+                                    result_distances.data());
+                    holder_->FindNeighbors(result_set,
+                                           &queries[i * dimension], params);
+                    size_t num_valid = result_set.size();
 
                     int num_neighbors = 0;
                     for (size_t valid_i = 0; valid_i < num_valid; ++valid_i) {
@@ -269,9 +733,8 @@ void _RadiusSearchCPU(NanoFlannIndexHolderBase *holder,
                         radius = radius * radius;
                     }
 
-                    holder_->index_->radiusSearch(&queries[i * dimension],
-                                                  radius, search_result,
-                                                  params);
+                    holder_->radiusSearch(&queries[i * dimension], radius,
+                                          search_result, params);
 
                     int num_neighbors = 0;
                     for (const auto &idx_dist : search_result) {
@@ -377,7 +840,7 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
             [&](const tbb::blocked_range<size_t> &r) {
                 std::vector<std::pair<index_t, T>> ret_matches;
                 for (size_t i = r.begin(); i != r.end(); ++i) {
-                    size_t num_results = holder_->index_->radiusSearch(
+                    size_t num_results = holder_->radiusSearch(
                             &queries[i * dimension], radius_squared,
                             ret_matches, params);
                     ret_matches.resize(num_results);
@@ -419,13 +882,21 @@ void _HybridSearchCPU(NanoFlannIndexHolderBase *holder,
 /// \param metric   Onf of L1, L2. Defines the distance metric for the
 /// search
 ///
+/// \param leaf_max_size   Maximum number of points in a leaf of the tree.
+/// Larger leaves give a flatter tree that builds faster and suits batched
+/// queries, at the cost of more distance evaluations per query.
+///
+/// Large datasets are split into subtrees that are built in parallel.
+///
 template <class T>
-std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
-                                                      const T *const points,
-                                                      size_t dimension,
-                                                      const Metric metric) {
+std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(
+        size_t num_points,
+        const T *const points,
+        size_t dimension,
+        const Metric metric,
+        size_t leaf_max_size = 10) {
     NanoFlannIndexHolderBase *holder = nullptr;
-#define FN_PARAMETERS num_points, points, dimension, &holder
+#define FN_PARAMETERS num_points, points, dimension, leaf_max_size, &holder
 
 #define CALL_TEMPLATE(METRIC)                   \
     if (METRIC == metric) {                     \
@@ -445,6 +916,45 @@ std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
     return std::unique_ptr<NanoFlannIndexHolderBase>(holder);
 }
 
+/// Restores a kd-tree written with SerializeKdTree over the given dataset.
+///
+/// \param num_points The number of points.
+/// \param points Array with the point positions, as used for building.
+/// \param dimension The dimension of the points.
+/// \param metric One of L1, L2. Must match the serialized tree.
+/// \param arrays The arrays returned by SerializeKdTree.
+template <class T>
+std::unique_ptr<NanoFlannIndexHolderBase> LoadKdTree(
+        size_t num_points,
+        const T *const points,
+        size_t dimension,
+        const Metric metric,
+        const std::unordered_map<std::string, Tensor> &arrays) {
+    NanoFlannIndexHolderBase *holder = nullptr;
+    if (metric == L1) {
+        holder = new NanoFlannIndexHolder<L1, T, index_t>(
+                num_points, dimension, points, arrays);
+    } else if (metric == L2) {
+        holder = new NanoFlannIndexHolder<L2, T, index_t>(
+                num_points, dimension, points, arrays);
+    }
+    return std::unique_ptr<NanoFlannIndexHolderBase>(holder);
+}
+
+/// Returns the kd-tree built by BuildKdTree as flat arrays, without the
+/// dataset points.
+template <class T>
+std::unordered_map<std::string, Tensor> SerializeKdTree(
+        const NanoFlannIndexHolderBase *holder, const Metric metric) {
+    if (metric == L1) {
+        return static_cast<const NanoFlannIndexHolder<L1, T, index_t> *>(
+                       holder)
+                ->Serialize();
+    }
+    return static_cast<const NanoFlannIndexHolder<L2, T, index_t> *>(holder)
+            ->Serialize();
+}
+
 /// KNN search. This function computes a list of neighbor indices
 /// for each query point. The lists are stored linearly and an exclusive prefix
 /// sum defines the start and end of each list in the array.
@@ -497,6 +1007,15 @@ std::unique_ptr<NanoFlannIndexHolderBase> BuildKdTree(size_t num_points,
 ///         elements. Both functions must accept the argument size==0.
 ///         In this case ptr does not need to be set.
 ///
+/// \param eps    Approximation factor of the search. Subtrees are pruned once
+///        they cannot hold a neighbor closer than the current k-th distance
+///        divided by (1 + eps). 0 performs exact search.
+///
+/// \param coherent_queries    If true, the queries are processed in tiles
+///        of spatially close queries, ordered by Morton code, which reduces
+///        cache misses for dense queries such as full scans. The results are
+///        returned in the original query order.
+///
 template <class T, class OUTPUT_ALLOCATOR>
 void KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                   int64_t *query_neighbors_row_splits,
@@ -509,11 +1028,13 @@ void KnnSearchCPU(NanoFlannIndexHolderBase *holder,
                   const Metric metric,
                   bool ignore_query_point,
                   bool return_distances,
-                  OUTPUT_ALLOCATOR &output_allocator) {
+                  OUTPUT_ALLOCATOR &output_allocator,
+                  float eps = 0,
+                  bool coherent_queries = false) {
 #define FN_PARAMETERS                                                      \
     holder, query_neighbors_row_splits, num_points, points, num_queries,   \
             queries, dimension, knn, ignore_query_point, return_distances, \
-            output_allocator
+            output_allocator, eps, coherent_queries
 
 #define CALL_TEMPLATE(METRIC)                                      \
     if (METRIC == metric) {                                        \
@@ -31,6 +31,7 @@
 #include "open3d/core/nns/NanoFlannImpl.h"
 #include "open3d/core/nns/NeighborSearchAllocator.h"
 #include "open3d/core/nns/NeighborSearchCommon.h"
+#include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ParallelScan.h"
 
@@ -42,7 +43,11 @@ typedef int32_t index_t;
 
 NanoFlannIndex::NanoFlannIndex(){};
 
-NanoFlannIndex::NanoFlannIndex(const Tensor &dataset_points) {
+NanoFlannIndex::NanoFlannIndex(const Tensor &dataset_points, int leaf_size)
+    : leaf_size_(leaf_size) {
+    if (leaf_size <= 0) {
+        utility::LogError("leaf_size should be larger than 0.");
+    }
     SetTensorData(dataset_points);
 };
 
@@ -62,13 +67,58 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
         holder_ = impl::BuildKdTree<scalar_t>(
                 dataset_points_.GetShape(0),
                 dataset_points_.GetDataPtr<scalar_t>(),
-                dataset_points_.GetShape(1), /* metric */ L2);
+                dataset_points_.GetShape(1), /* metric */ L2, leaf_size_);
     });
     return true;
 };
 
+void NanoFlannIndex::Save(const std::string &file_name) const {
+    if (!holder_) {
+        utility::LogError("Cannot save an empty NanoFlannIndex.");
+    }
+    std::unordered_map<std::string, Tensor> arrays;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        arrays = impl::SerializeKdTree<scalar_t>(holder_.get(),
+                                                 /* metric */ L2);
+    });
+    arrays["dataset_points"] = dataset_points_;
+    t::io::WriteNpz(file_name, arrays);
+}
+
+void NanoFlannIndex::Load(const std::string &file_name, bool use_mmap) {
+    const t::io::NpzFile npz(file_name, use_mmap);
+    std::unordered_map<std::string, Tensor> arrays;
+    for (const std::string &key : npz.GetKeys()) {
+        arrays[key] = npz.Get(key);
+    }
+    if (arrays.count("dataset_points") == 0) {
+        utility::LogError("{} does not contain a NanoFlannIndex.", file_name);
+    }
+
+    const Tensor dataset_points = arrays.at("dataset_points").Contiguous();
+    AssertTensorDtypes(dataset_points, {Float32, Float64});
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "dataset_points must be 2D matrix, with shape "
+                "{n_dataset_points, d}.");
+    }
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dataset_points.GetDtype(), [&]() {
+        holder_ = impl::LoadKdTree<scalar_t>(
+                dataset_points.GetShape(0),
+                dataset_points.GetDataPtr<scalar_t>(),
+                dataset_points.GetShape(1), /* metric */ L2, arrays);
+    });
+    dataset_points_ = dataset_points;
+}
+
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
+    return SearchKnn(query_points, knn, 0.0);
+}
+
+std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
+                                                    int knn,
+                                                    double eps) const {
     const Dtype dtype = GetDtype();
     const Device device = GetDevice();
 
@@ -79,6 +129,9 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
     if (knn <= 0) {
         utility::LogError("knn should be larger than 0.");
     }
+    if (eps < 0) {
+        utility::LogError("eps should be non-negative.");
+    }
 
     const int64_t num_neighbors = std::min(
             static_cast<int64_t>(GetDatasetSize()), static_cast<int64_t>(knn));
@@ -98,7 +151,8 @@ std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                 query_contiguous.GetDataPtr<scalar_t>(),
                 query_contiguous.GetShape(1), num_neighbors, /* metric */ L2,
                 /* ignore_query_point */ false,
-                /* return_distances */ true, output_allocator);
+                /* return_distances */ true, output_allocator,
+                static_cast<float>(eps), /* coherent_queries */ true);
         indices = output_allocator.NeighborsIndex();
         distances = output_allocator.NeighborsDistance();
         indices = indices.View({num_query_points, num_neighbors});
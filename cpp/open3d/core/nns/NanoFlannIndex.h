@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
@@ -49,7 +50,10 @@ public:
     ///
     /// \param dataset_points Provides a set of data points as Tensor for KDTree
     /// construction.
-    NanoFlannIndex(const Tensor &dataset_points);
+    /// \param leaf_size Maximum number of points in a leaf of the KDTree.
+    /// Larger leaves give a flatter tree, which is faster to build and suits
+    /// large batches of queries.
+    NanoFlannIndex(const Tensor &dataset_points, int leaf_size = 10);
     ~NanoFlannIndex();
     NanoFlannIndex(const NanoFlannIndex &) = delete;
     NanoFlannIndex &operator=(const NanoFlannIndex &) = delete;
@@ -62,6 +66,18 @@ public:
                 "NanoFlannIndex::SetTensorData with radius not implemented.");
     }
 
+    /// Save the points and the built KDTree to a .npz file, so that the index
+    /// can be loaded without rebuilding.
+    void Save(const std::string &file_name) const;
+
+    /// Load an index saved with Save(), replacing the current one.
+    ///
+    /// \param file_name The .npz file to read from.
+    /// \param use_mmap If true, the points and the point permutation are
+    /// memory-mapped instead of read, so that processes loading the same file
+    /// share them through the page cache.
+    void Load(const std::string &file_name, bool use_mmap = false);
+
     /// Perform K nearest neighbor search.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}, same
@@ -73,6 +89,19 @@ public:
     std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
                                         int knn) const override;
 
+    /// Perform approximate K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \param eps Approximation factor. Larger values prune more of the tree,
+    /// trading recall for speed on high-dimensional data. 0 performs exact
+    /// search.
+    /// \return Pair of Tensors: (indices, distances), as in SearchKnn.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn,
+                                        double eps) const;
+
     /// Perform radius search with multiple radii.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}, same
@@ -121,6 +150,7 @@ public:
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
+    int leaf_size_ = 10;
 };
 }  // namespace nns
 }  // namespace core
@@ -106,10 +106,19 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
     }
 };
 
+bool NearestNeighborSearch::LBVHIndex() {
+    lbvh_index_.reset(new nns::LBVHIndex());
+    return lbvh_index_->SetTensorData(dataset_points_);
+}
+
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
+    if (lbvh_index_) {
+        return lbvh_index_->SearchKnn(query_points, knn);
+    }
+
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (query_points.GetShape()[1] == 3 && knn_index_) {
             return knn_index_->SearchKnn(query_points, knn);
@@ -131,6 +140,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         const Tensor& query_points, double radius, bool sort) {
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
+    if (lbvh_index_) {
+        return lbvh_index_->SearchRadius(query_points, radius, sort);
+    }
+
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius,
@@ -163,6 +176,10 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         const Tensor& query_points, double radius, int max_knn) {
     AssertTensorDevice(query_points, dataset_points_.GetDevice());
 
+    if (lbvh_index_) {
+        return lbvh_index_->SearchHybrid(query_points, radius, max_knn);
+    }
+
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchHybrid(query_points, radius,
@@ -32,6 +32,7 @@
 #include "open3d/core/nns/FaissIndex.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
 #include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/LBVHIndex.h"
 #include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Optional.h"
 
@@ -77,6 +78,13 @@ public:
     /// \return Returns true if building index success, otherwise false.
     bool HybridIndex(utility::optional<double> radius = {});
 
+    /// Set a linear BVH index for knn, fixed-radius and hybrid search, on
+    /// CPU or CUDA. Once set, it is used by these searches instead of the
+    /// other indices.
+    ///
+    /// \return Returns true if building index success, otherwise false.
+    bool LBVHIndex();
+
     /// Perform knn search.
     ///
     /// \param query_points Query points. Must be 2D, with shape {n, d}.
@@ -142,6 +150,7 @@ protected:
     std::unique_ptr<FaissIndex> faiss_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
     std::unique_ptr<nns::KnnIndex> knn_index_;
+    std::unique_ptr<nns::LBVHIndex> lbvh_index_;
     const Tensor dataset_points_;
 };
 }  // namespace nns
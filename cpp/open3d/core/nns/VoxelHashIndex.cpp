@@ -0,0 +1,520 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/VoxelHashIndex.h"
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+typedef int32_t index_t;
+
+namespace {
+
+using VoxelBuckets = std::unordered_map<Eigen::Vector3i,
+                                        std::vector<index_t>,
+                                        utility::hash_eigen<Eigen::Vector3i>>;
+
+template <typename T>
+Eigen::Vector3i ComputeVoxel(const T *point, double voxel_size) {
+    return Eigen::Vector3i(static_cast<int>(std::floor(point[0] / voxel_size)),
+                           static_cast<int>(std::floor(point[1] / voxel_size)),
+                           static_cast<int>(std::floor(point[2] / voxel_size)));
+}
+
+template <typename T>
+T SquaredDistance(const T *a, const T *b) {
+    T dx = a[0] - b[0];
+    T dy = a[1] - b[1];
+    T dz = a[2] - b[2];
+    return dx * dx + dy * dy + dz * dz;
+}
+
+int ChebyshevDistance(const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+    return (a - b).cwiseAbs().maxCoeff();
+}
+
+/// Finds the knn nearest points of a query by visiting voxel shells of
+/// growing Chebyshev radius around the query voxel. Requires knn to be at
+/// most the number of indexed points.
+template <typename T>
+void KnnQuery(const VoxelBuckets &buckets,
+              const T *points,
+              int64_t num_points,
+              double voxel_size,
+              const T *query,
+              int knn,
+              index_t *indices,
+              T *distances) {
+    using Match = std::pair<T, index_t>;
+    std::vector<Match> heap;
+    heap.reserve(knn);
+    int64_t num_visited = 0;
+    auto visit = [&](const std::vector<index_t> &bucket) {
+        for (index_t idx : bucket) {
+            T dist = SquaredDistance(query, points + 3 * idx);
+            if (static_cast<int>(heap.size()) < knn) {
+                heap.emplace_back(dist, idx);
+                std::push_heap(heap.begin(), heap.end());
+            } else if (dist < heap.front().first) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = Match(dist, idx);
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+        num_visited += bucket.size();
+    };
+    auto visit_voxel = [&](const Eigen::Vector3i &voxel) {
+        auto it = buckets.find(voxel);
+        if (it != buckets.end()) {
+            visit(it->second);
+        }
+    };
+
+    const Eigen::Vector3i center = ComputeVoxel(query, voxel_size);
+    for (int r = 0; num_visited < num_points; ++r) {
+        // Points outside shells [0, r) are farther than (r - 1) voxels.
+        if (r > 0 && static_cast<int>(heap.size()) == knn) {
+            T bound = static_cast<T>((r - 1) * voxel_size);
+            if (heap.front().first <= bound * bound) {
+                break;
+            }
+        }
+
+        // Scan the remaining voxels once a shell outgrows the hash map.
+        int64_t shell_size = r == 0 ? 1
+                                    : (2 * r + 1) * (2 * r + 1) * (2 * r + 1) -
+                                              (2 * r - 1) * (2 * r - 1) *
+                                                      (2 * r - 1);
+        if (shell_size > static_cast<int64_t>(buckets.size())) {
+            for (const auto &kv : buckets) {
+                if (ChebyshevDistance(kv.first, center) >= r) {
+                    visit(kv.second);
+                }
+            }
+            break;
+        }
+
+        for (int dx = -r; dx <= r; ++dx) {
+            for (int dy = -r; dy <= r; ++dy) {
+                if (std::abs(dx) == r || std::abs(dy) == r) {
+                    for (int dz = -r; dz <= r; ++dz) {
+                        visit_voxel(center + Eigen::Vector3i(dx, dy, dz));
+                    }
+                } else {
+                    visit_voxel(center + Eigen::Vector3i(dx, dy, -r));
+                    visit_voxel(center + Eigen::Vector3i(dx, dy, r));
+                }
+            }
+        }
+    }
+
+    std::sort_heap(heap.begin(), heap.end());
+    for (int k = 0; k < knn; ++k) {
+        distances[k] = heap[k].first;
+        indices[k] = heap[k].second;
+    }
+}
+
+/// Collects points strictly within radius of a query.
+template <typename T>
+void RadiusQuery(const VoxelBuckets &buckets,
+                 const T *points,
+                 double voxel_size,
+                 const T *query,
+                 T radius,
+                 bool sort,
+                 std::vector<std::pair<T, index_t>> &matches) {
+    const T radius_squared = radius * radius;
+    auto visit = [&](const std::vector<index_t> &bucket) {
+        for (index_t idx : bucket) {
+            T dist = SquaredDistance(query, points + 3 * idx);
+            if (dist < radius_squared) {
+                matches.emplace_back(dist, idx);
+            }
+        }
+    };
+
+    const T lower[3] = {query[0] - radius, query[1] - radius,
+                        query[2] - radius};
+    const T upper[3] = {query[0] + radius, query[1] + radius,
+                        query[2] + radius};
+    const Eigen::Vector3i voxel_min = ComputeVoxel(lower, voxel_size);
+    const Eigen::Vector3i voxel_max = ComputeVoxel(upper, voxel_size);
+    const Eigen::Array3i extent = (voxel_max - voxel_min).array() + 1;
+    const int64_t box_size = static_cast<int64_t>(extent[0]) * extent[1] *
+                             static_cast<int64_t>(extent[2]);
+
+    if (box_size > static_cast<int64_t>(buckets.size())) {
+        for (const auto &kv : buckets) {
+            if ((kv.first.array() >= voxel_min.array()).all() &&
+                (kv.first.array() <= voxel_max.array()).all()) {
+                visit(kv.second);
+            }
+        }
+    } else {
+        for (int x = voxel_min(0); x <= voxel_max(0); ++x) {
+            for (int y = voxel_min(1); y <= voxel_max(1); ++y) {
+                for (int z = voxel_min(2); z <= voxel_max(2); ++z) {
+                    auto it = buckets.find(Eigen::Vector3i(x, y, z));
+                    if (it != buckets.end()) {
+                        visit(it->second);
+                    }
+                }
+            }
+        }
+    }
+
+    if (sort) {
+        std::sort(matches.begin(), matches.end());
+    }
+}
+
+template <typename T>
+void KnnSearch(const VoxelBuckets &buckets,
+               const T *points,
+               int64_t num_points,
+               double voxel_size,
+               const T *queries,
+               int64_t num_queries,
+               int knn,
+               index_t *indices,
+               T *distances) {
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_queries; ++i) {
+        KnnQuery(buckets, points, num_points, voxel_size, queries + 3 * i, knn,
+                 indices + i * knn, distances + i * knn);
+    }
+}
+
+template <typename T>
+void RadiusSearch(const VoxelBuckets &buckets,
+                  const T *points,
+                  double voxel_size,
+                  const T *queries,
+                  int64_t num_queries,
+                  const T *radii,
+                  bool sort,
+                  int64_t *row_splits,
+                  Tensor &indices,
+                  Tensor &distances) {
+    std::vector<std::vector<std::pair<T, index_t>>> matches(num_queries);
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_queries; ++i) {
+        RadiusQuery(buckets, points, voxel_size, queries + 3 * i, radii[i],
+                    sort, matches[i]);
+    }
+
+    row_splits[0] = 0;
+    for (int64_t i = 0; i < num_queries; ++i) {
+        row_splits[i + 1] = row_splits[i] + matches[i].size();
+    }
+
+    const int64_t total = row_splits[num_queries];
+    indices = Tensor({total}, Int32);
+    distances = Tensor({total}, Dtype::FromType<T>());
+    index_t *indices_ptr = indices.GetDataPtr<index_t>();
+    T *distances_ptr = distances.GetDataPtr<T>();
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_queries; ++i) {
+        int64_t offset = row_splits[i];
+        for (const auto &match : matches[i]) {
+            distances_ptr[offset] = match.first;
+            indices_ptr[offset] = match.second;
+            ++offset;
+        }
+    }
+}
+
+template <typename T>
+void HybridSearch(const VoxelBuckets &buckets,
+                  const T *points,
+                  double voxel_size,
+                  const T *queries,
+                  int64_t num_queries,
+                  T radius,
+                  int max_knn,
+                  index_t *indices,
+                  T *distances,
+                  index_t *counts) {
+#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_queries; ++i) {
+        std::vector<std::pair<T, index_t>> matches;
+        RadiusQuery(buckets, points, voxel_size, queries + 3 * i, radius,
+                    /* sort */ true, matches);
+
+        int count = std::min(static_cast<int>(matches.size()), max_knn);
+        counts[i] = count;
+        for (int k = 0; k < max_knn; ++k) {
+            indices[i * max_knn + k] = k < count ? matches[k].second : -1;
+            distances[i * max_knn + k] = k < count ? matches[k].first : 0;
+        }
+    }
+}
+
+}  // namespace
+
+struct VoxelHashIndex::VoxelMap {
+    VoxelBuckets buckets;
+};
+
+VoxelHashIndex::VoxelHashIndex(double voxel_size)
+    : voxel_size_(voxel_size), voxel_map_(new VoxelMap()) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size should be larger than 0, but got {}.",
+                          voxel_size);
+    }
+}
+
+VoxelHashIndex::VoxelHashIndex(const Tensor &dataset_points, double voxel_size)
+    : VoxelHashIndex(voxel_size) {
+    SetTensorData(dataset_points);
+}
+
+VoxelHashIndex::~VoxelHashIndex() {}
+
+bool VoxelHashIndex::SetTensorData(const Tensor &dataset_points) {
+    points_buffer_ = Tensor();
+    dataset_points_ = Tensor();
+    num_points_ = 0;
+    voxel_map_->buckets.clear();
+    Insert(dataset_points);
+    return true;
+}
+
+bool VoxelHashIndex::SetTensorData(const Tensor &dataset_points,
+                                   double radius) {
+    if (radius <= 0) {
+        utility::LogError("radius should be larger than 0.");
+    }
+    voxel_size_ = radius;
+    return SetTensorData(dataset_points);
+}
+
+Tensor VoxelHashIndex::Insert(const Tensor &points) {
+    AssertTensorDtypes(points, {Float32, Float64});
+    AssertTensorShape(points, {utility::nullopt, 3});
+    if (points.GetDevice().GetType() != Device::DeviceType::CPU) {
+        utility::LogError("VoxelHashIndex only supports CPU tensors.");
+    }
+
+    const int64_t num_assigned =
+            points_buffer_.NumDims() == 2 ? dataset_points_.GetLength() : 0;
+    if (points_buffer_.NumDims() != 2) {
+        points_buffer_ = Tensor({16, 3}, points.GetDtype(), points.GetDevice());
+    } else {
+        AssertTensorDtype(points, GetDtype());
+        AssertTensorDevice(points, GetDevice());
+    }
+
+    const int64_t n = points.GetLength();
+    if (num_assigned + n > std::numeric_limits<index_t>::max()) {
+        utility::LogError(
+                "VoxelHashIndex supports at most {} insertions, but got {}.",
+                std::numeric_limits<index_t>::max(), num_assigned + n);
+    }
+
+    // Grow the storage geometrically so that insertion stays amortized
+    // proportional to the number of new points.
+    const int64_t capacity = points_buffer_.GetLength();
+    if (num_assigned + n > capacity) {
+        Tensor points_buffer(
+                {std::max(2 * capacity, num_assigned + n), 3},
+                points_buffer_.GetDtype(), points_buffer_.GetDevice());
+        points_buffer.Slice(0, 0, num_assigned) =
+                points_buffer_.Slice(0, 0, num_assigned);
+        points_buffer_ = points_buffer;
+    }
+    points_buffer_.Slice(0, num_assigned, num_assigned + n) = points;
+    dataset_points_ = points_buffer_.Slice(0, 0, num_assigned + n);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const scalar_t *points_ptr = points_buffer_.GetDataPtr<scalar_t>();
+        for (int64_t i = num_assigned; i < num_assigned + n; ++i) {
+            Eigen::Vector3i voxel =
+                    ComputeVoxel(points_ptr + 3 * i, voxel_size_);
+            voxel_map_->buckets[voxel].push_back(static_cast<index_t>(i));
+        }
+    });
+    num_points_ += n;
+
+    return Tensor::Arange(num_assigned, num_assigned + n, 1, Int32,
+                          GetDevice());
+}
+
+void VoxelHashIndex::Remove(const Tensor &indices) {
+    AssertTensorDtypes(indices, {Int32, Int64});
+    if (points_buffer_.NumDims() != 2) {
+        return;
+    }
+    AssertTensorDevice(indices, GetDevice());
+
+    const int64_t num_assigned = dataset_points_.GetLength();
+    const Tensor indices_contiguous = indices.To(Int64).Contiguous();
+    const int64_t *indices_ptr = indices_contiguous.GetDataPtr<int64_t>();
+    const int64_t n = indices_contiguous.NumElements();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const scalar_t *points_ptr = points_buffer_.GetDataPtr<scalar_t>();
+        for (int64_t i = 0; i < n; ++i) {
+            const int64_t idx = indices_ptr[i];
+            if (idx < 0 || idx >= num_assigned) {
+                continue;
+            }
+            auto it = voxel_map_->buckets.find(
+                    ComputeVoxel(points_ptr + 3 * idx, voxel_size_));
+            if (it == voxel_map_->buckets.end()) {
+                continue;
+            }
+            std::vector<index_t> &bucket = it->second;
+            auto pos = std::find(bucket.begin(), bucket.end(),
+                                 static_cast<index_t>(idx));
+            if (pos == bucket.end()) {
+                continue;
+            }
+            *pos = bucket.back();
+            bucket.pop_back();
+            if (bucket.empty()) {
+                voxel_map_->buckets.erase(it);
+            }
+            --num_points_;
+        }
+    });
+}
+
+void VoxelHashIndex::AssertQueryPoints(const Tensor &query_points) const {
+    if (points_buffer_.NumDims() != 2) {
+        utility::LogError("VoxelHashIndex is not set with any points.");
+    }
+    AssertTensorDevice(query_points, GetDevice());
+    AssertTensorDtype(query_points, GetDtype());
+    AssertTensorShape(query_points, {utility::nullopt, 3});
+}
+
+std::pair<Tensor, Tensor> VoxelHashIndex::SearchKnn(const Tensor &query_points,
+                                                    int knn) const {
+    AssertQueryPoints(query_points);
+    if (knn <= 0) {
+        utility::LogError("knn should be larger than 0.");
+    }
+
+    const int64_t num_neighbors =
+            std::min(num_points_, static_cast<int64_t>(knn));
+    const int64_t num_query_points = query_points.GetLength();
+
+    Tensor indices({num_query_points, num_neighbors}, Int32, GetDevice());
+    Tensor distances({num_query_points, num_neighbors}, GetDtype(),
+                     GetDevice());
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *points_ptr = points_buffer_.GetDataPtr<scalar_t>();
+        KnnSearch(voxel_map_->buckets, points_ptr, num_points_, voxel_size_,
+                  query_ptr, num_query_points, static_cast<int>(num_neighbors),
+                  indices.GetDataPtr<index_t>(),
+                  distances.GetDataPtr<scalar_t>());
+    });
+    return std::make_pair(indices, distances);
+}
+
+std::tuple<Tensor, Tensor, Tensor> VoxelHashIndex::SearchRadius(
+        const Tensor &query_points, const Tensor &radii, bool sort) const {
+    AssertQueryPoints(query_points);
+    const int64_t num_query_points = query_points.GetLength();
+    AssertTensorDevice(radii, GetDevice());
+    AssertTensorDtype(radii, GetDtype());
+    AssertTensorShape(radii, {num_query_points});
+    if (radii.Le(0).Any()) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    Tensor indices, distances;
+    Tensor row_splits({num_query_points + 1}, Int64, GetDevice());
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const Tensor radii_contiguous = radii.Contiguous();
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *radii_ptr = radii_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *points_ptr = points_buffer_.GetDataPtr<scalar_t>();
+
+        RadiusSearch(voxel_map_->buckets, points_ptr, voxel_size_, query_ptr,
+                     num_query_points, radii_ptr, sort,
+                     row_splits.GetDataPtr<int64_t>(), indices, distances);
+    });
+    return std::make_tuple(indices, distances, row_splits);
+}
+
+std::tuple<Tensor, Tensor, Tensor> VoxelHashIndex::SearchRadius(
+        const Tensor &query_points, double radius, bool sort) const {
+    AssertQueryPoints(query_points);
+    const int64_t num_query_points = query_points.GetLength();
+    Tensor radii = Tensor::Full({num_query_points}, radius, GetDtype(),
+                                GetDevice());
+    return SearchRadius(query_points, radii, sort);
+}
+
+std::tuple<Tensor, Tensor, Tensor> VoxelHashIndex::SearchHybrid(
+        const Tensor &query_points, double radius, int max_knn) const {
+    AssertQueryPoints(query_points);
+    if (max_knn <= 0) {
+        utility::LogError("max_knn should be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError("radius should be larger than 0.");
+    }
+
+    const int64_t num_query_points = query_points.GetLength();
+    Tensor indices({num_query_points, max_knn}, Int32, GetDevice());
+    Tensor distances({num_query_points, max_knn}, GetDtype(), GetDevice());
+    Tensor counts({num_query_points}, Int32, GetDevice());
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const Tensor query_contiguous = query_points.Contiguous();
+        const scalar_t *query_ptr = query_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *points_ptr = points_buffer_.GetDataPtr<scalar_t>();
+        HybridSearch(voxel_map_->buckets, points_ptr, voxel_size_, query_ptr,
+                     num_query_points, static_cast<scalar_t>(radius), max_knn,
+                     indices.GetDataPtr<index_t>(),
+                     distances.GetDataPtr<scalar_t>(),
+                     counts.GetDataPtr<index_t>());
+    });
+    return std::make_tuple(indices, distances, counts);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class VoxelHashIndex
+///
+/// \brief Hashed voxel grid for nearest neighbor search on 3D points that
+/// supports incremental insertion and removal.
+///
+/// Points are bucketed by voxel in a hash map, so inserting or removing a
+/// batch costs time proportional to the batch rather than to the indexed
+/// points. Each point keeps the index it was assigned at insertion for its
+/// lifetime, and search results refer to these indices. Indices of removed
+/// points are not reused. Only CPU tensors are supported.
+class VoxelHashIndex : public NNSIndex {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_size Edge length of the voxels. Searches are fastest
+    /// when it is close to the typical search radius.
+    VoxelHashIndex(double voxel_size);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Initial points, with shape {n, 3}.
+    /// \param voxel_size Edge length of the voxels.
+    VoxelHashIndex(const Tensor &dataset_points, double voxel_size);
+    ~VoxelHashIndex();
+    VoxelHashIndex(const VoxelHashIndex &) = delete;
+    VoxelHashIndex &operator=(const VoxelHashIndex &) = delete;
+
+public:
+    /// Replace all indexed points, keeping the voxel size.
+    bool SetTensorData(const Tensor &dataset_points) override;
+
+    /// Replace all indexed points and use \p radius as the voxel size.
+    bool SetTensorData(const Tensor &dataset_points, double radius) override;
+
+    /// Insert points into the index.
+    ///
+    /// \param points Points with shape {n, 3}, same dtype as the indexed
+    /// points.
+    /// \return Tensor of shape {n,}, dtype Int32, with the indices assigned
+    /// to the inserted points.
+    Tensor Insert(const Tensor &points);
+
+    /// Remove points from the index. Indices that are out of range or
+    /// already removed are ignored.
+    ///
+    /// \param indices Int32 or Int64 indices returned by Insert.
+    void Remove(const Tensor &indices);
+
+    /// Number of points currently in the index. GetDatasetSize() returns the
+    /// number of indices assigned so far, including removed points.
+    int64_t Size() const { return num_points_; }
+
+    /// Edge length of the voxels.
+    double GetVoxelSize() const { return voxel_size_; }
+
+    /// Perform K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, min(knn, Size())}, with dtype Int32.
+    /// - distainces: Tensor of shape {n, min(knn, Size())}, same dtype with
+    /// dataset_points.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    /// Perform radius search with multiple radii.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}, same
+    /// dtype with dataset_points.
+    /// \param radii list of radius. Must be 1D, with shape {n, }.
+    /// \return Tuple of Tensors: (indices, distances, row_splits):
+    /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int32.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - row_splits: Tensor of shape {n + 1,}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            const Tensor &radii,
+            bool sort = true) const override;
+
+    /// Perform radius search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}, same
+    /// dtype with dataset_points.
+    /// \param radius Radius.
+    /// \return Tuple of Tensors, (indices, distances, row_splits):
+    /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int32.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - row_splits: Tensor of shape {n + 1,}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            double radius,
+            bool sort = true) const override;
+
+    /// Perform hybrid search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, 3}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of
+    /// neighbor to search per query point.
+    /// \return Tuple of Tensors, (indices, distances, counts):
+    /// - indices: Tensor of shape {n, max_knn}, with dtype Int32, padded
+    /// with -1.
+    /// - distances: Tensor of shape {n, max_knn}, same dtype with
+    /// dataset_points, padded with 0.
+    /// - counts: Counts of neighbour for each query points. [Tensor
+    /// of shape {n}, with dtype Int32].
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                                    double radius,
+                                                    int max_knn) const override;
+
+protected:
+    /// Checks that query points match the indexed points.
+    void AssertQueryPoints(const Tensor &query_points) const;
+
+    struct VoxelMap;
+
+    double voxel_size_;
+    int64_t num_points_ = 0;
+    /// Point storage with spare capacity. dataset_points_ views the assigned
+    /// rows.
+    Tensor points_buffer_;
+    std::unique_ptr<VoxelMap> voxel_map_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -317,22 +317,24 @@ void PointCloud::EstimateNormals(
     } else {
         covariances = covariances_;
     }
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)covariances.size(); i++) {
-        auto normal = ComputeNormal(covariances[i], fast_normal_computation);
-        if (normal.norm() == 0.0) {
-            if (has_normal) {
-                normal = normals_[i];
-            } else {
-                normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-            }
-        }
-        if (has_normal && normal.dot(normals_[i]) < 0.0) {
-            normal *= -1.0;
-        }
-        normals_[i] = normal;
-    }
+    utility::ParallelForRange(
+            covariances.size(), [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    auto normal = ComputeNormal(covariances[i],
+                                                fast_normal_computation);
+                    if (normal.norm() == 0.0) {
+                        if (has_normal) {
+                            normal = normals_[i];
+                        } else {
+                            normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                        }
+                    }
+                    if (has_normal && normal.dot(normals_[i]) < 0.0) {
+                        normal *= -1.0;
+                    }
+                    normals_[i] = normal;
+                }
+            });
 }
 
 void PointCloud::OrientNormalsToAlignWithDirection(
@@ -343,16 +345,16 @@ void PointCloud::OrientNormalsToAlignWithDirection(
                 "[OrientNormalsToAlignWithDirection] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)points_.size(); i++) {
-        auto &normal = normals_[i];
-        if (normal.norm() == 0.0) {
-            normal = orientation_reference;
-        } else if (normal.dot(orientation_reference) < 0.0) {
-            normal *= -1.0;
+    utility::ParallelForRange(points_.size(), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            auto &normal = normals_[i];
+            if (normal.norm() == 0.0) {
+                normal = orientation_reference;
+            } else if (normal.dot(orientation_reference) < 0.0) {
+                normal *= -1.0;
+            }
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsTowardsCameraLocation(
@@ -362,22 +364,23 @@ void PointCloud::OrientNormalsTowardsCameraLocation(
                 "[OrientNormalsTowardsCameraLocation] No normals in the "
                 "PointCloud. Call EstimateNormals() first.");
     }
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)points_.size(); i++) {
-        Eigen::Vector3d orientation_reference = camera_location - points_[i];
-        auto &normal = normals_[i];
-        if (normal.norm() == 0.0) {
-            normal = orientation_reference;
+    utility::ParallelForRange(points_.size(), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            Eigen::Vector3d orientation_reference =
+                    camera_location - points_[i];
+            auto &normal = normals_[i];
             if (normal.norm() == 0.0) {
-                normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-            } else {
-                normal.normalize();
+                normal = orientation_reference;
+                if (normal.norm() == 0.0) {
+                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                } else {
+                    normal.normalize();
+                }
+            } else if (normal.dot(orientation_reference) < 0.0) {
+                normal *= -1.0;
             }
-        } else if (normal.dot(orientation_reference) < 0.0) {
-            normal *= -1.0;
         }
-    }
+    });
 }
 
 void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
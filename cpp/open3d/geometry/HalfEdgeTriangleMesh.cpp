@@ -26,11 +26,14 @@
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 
+#include <tbb/parallel_sort.h>
+
 #include <numeric>
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -100,10 +103,10 @@ std::vector<int> HalfEdgeTriangleMesh::BoundaryVerticesFromVertex(
 
 std::vector<std::vector<int>> HalfEdgeTriangleMesh::GetBoundaries() const {
     std::vector<std::vector<int>> boundaries;
-    std::unordered_set<int> visited;
+    std::vector<char> visited(vertices_.size(), 0);
 
     for (int vertex_ind = 0; vertex_ind < int(vertices_.size()); ++vertex_ind) {
-        if (visited.find(vertex_ind) != visited.end()) {
+        if (visited[vertex_ind]) {
             continue;
         }
         // It is guaranteed that if a vertex in on boundary, the starting
@@ -112,12 +115,12 @@ std::vector<std::vector<int>> HalfEdgeTriangleMesh::GetBoundaries() const {
         int first_half_edge_ind = ordered_half_edge_from_vertex_[vertex_ind][0];
         if (half_edges_[first_half_edge_ind].IsBoundary()) {
             std::vector<int> boundary = BoundaryVerticesFromVertex(vertex_ind);
-            boundaries.push_back(boundary);
             for (int boundary_vertex : boundary) {
-                visited.insert(boundary_vertex);
+                visited[boundary_vertex] = 1;
             }
+            boundaries.push_back(std::move(boundary));
         }
-        visited.insert(vertex_ind);
+        visited[vertex_ind] = 1;
     }
     return boundaries;
 }
@@ -171,113 +174,133 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->RemoveUnreferencedVertices();
     mesh_cpy->RemoveDegenerateTriangles();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0;
-         triangle_index < mesh_cpy->triangles_.size(); triangle_index++) {
+    // Half-edges are laid out 3 per triangle: half-edge 3 * i + j goes from
+    // corner j to corner (j + 1) % 3 of triangle i.
+    const int num_triangles = int(mesh_cpy->triangles_.size());
+    const int num_vertices = int(mesh_cpy->vertices_.size());
+    het_mesh->half_edges_.resize(3 * size_t(num_triangles));
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int triangle_index = 0; triangle_index < num_triangles;
+         triangle_index++) {
         const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
-        size_t num_half_edges = het_mesh->half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::LogError(
-                    "ComputeHalfEdges failed. Duplicated half-edges.");
+        for (int j = 0; j < 3; j++) {
+            het_mesh->half_edges_[3 * triangle_index + j] = HalfEdge(
+                    Eigen::Vector2i(triangle(j), triangle((j + 1) % 3)),
+                    triangle_index, 3 * triangle_index + (j + 1) % 3, -1);
         }
-
-        het_mesh->half_edges_.push_back(he_0);
-        het_mesh->half_edges_.push_back(he_1);
-        het_mesh->half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
     }
 
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < het_mesh->half_edges_.size();
-         this_he_index++) {
+    // Sort the half-edges by their undirected edge, so that twins end up
+    // next to each other. Check: for valid manifolds, there mustn't be
+    // duplicated half-edges, so an edge has at most one half-edge in each
+    // direction.
+    const int num_half_edges = int(het_mesh->half_edges_.size());
+    std::vector<std::pair<uint64_t, int>> edge_keys(num_half_edges);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int he_index = 0; he_index < num_half_edges; he_index++) {
+        const Eigen::Vector2i &vertex_indices =
+                het_mesh->half_edges_[he_index].vertex_indices_;
+        const uint64_t v0 = uint64_t(vertex_indices.minCoeff());
+        const uint64_t v1 = uint64_t(vertex_indices.maxCoeff());
+        edge_keys[he_index] = std::make_pair((v0 << 32) | v1, he_index);
+    }
+    tbb::parallel_sort(edge_keys.begin(), edge_keys.end());
+
+    // Fill twin half-edges from the pairs of sorted half-edges.
+    bool has_duplicates = false;
+#pragma omp parallel for schedule(static) reduction(|| : has_duplicates) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_half_edges - 1; i++) {
+        if (edge_keys[i].first != edge_keys[i + 1].first) {
+            continue;
+        }
+        const int this_he_index = edge_keys[i].second;
+        const int twin_he_index = edge_keys[i + 1].second;
         HalfEdge &this_he = het_mesh->half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
+        HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
+        if (this_he.vertex_indices_(0) == twin_he.vertex_indices_(0) ||
+            (i + 2 < num_half_edges &&
+             edge_keys[i + 2].first == edge_keys[i].first)) {
+            has_duplicates = true;
+        } else {
+            this_he.twin_ = twin_he_index;
+            twin_he.twin_ = this_he_index;
         }
     }
+    if (has_duplicates) {
+        utility::LogError("ComputeHalfEdges failed. Duplicated half-edges.");
+    }
 
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(
-            mesh_cpy->vertices_.size());
-    for (size_t half_edge_index = 0;
-         half_edge_index < het_mesh->half_edges_.size(); half_edge_index++) {
-        int src_vertex_index =
-                het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+    // Get out-going half-edges from each vertex, in the order of the
+    // half-edges, as offsets into a single array.
+    std::vector<int> half_edges_from_vertex_offsets(num_vertices + 1, 0);
+    for (const HalfEdge &he : het_mesh->half_edges_) {
+        half_edges_from_vertex_offsets[he.vertex_indices_(0) + 1]++;
+    }
+    std::partial_sum(half_edges_from_vertex_offsets.begin(),
+                     half_edges_from_vertex_offsets.end(),
+                     half_edges_from_vertex_offsets.begin());
+    std::vector<int> half_edges_from_vertex(num_half_edges);
+    {
+        std::vector<int> fill(half_edges_from_vertex_offsets.begin(),
+                              half_edges_from_vertex_offsets.end() - 1);
+        for (int he_index = 0; he_index < num_half_edges; he_index++) {
+            const int src_vertex_index =
+                    het_mesh->half_edges_[he_index].vertex_indices_(0);
+            half_edges_from_vertex[fill[src_vertex_index]++] = he_index;
+        }
     }
 
     // Find ordered half-edges from each vertex by traversal. To be a valid
     // manifold, there can be at most 1 boundary half-edge from each vertex.
-    het_mesh->ordered_half_edge_from_vertex_.resize(mesh_cpy->vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
-         vertex_index++) {
+    het_mesh->ordered_half_edge_from_vertex_.resize(num_vertices);
+    bool has_invalid_vertices = false;
+#pragma omp parallel for schedule(static) \
+        reduction(|| : has_invalid_vertices) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vertex_index = 0; vertex_index < num_vertices; vertex_index++) {
+        const int begin = half_edges_from_vertex_offsets[vertex_index];
+        const int end = half_edges_from_vertex_offsets[vertex_index + 1];
         size_t num_boundaries = 0;
         int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
+        for (int k = begin; k < end; k++) {
+            const int half_edge_index = half_edges_from_vertex[k];
             if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
                 num_boundaries++;
                 init_half_edge_index = half_edge_index;
             }
         }
         if (num_boundaries > 1) {
-            utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+            has_invalid_vertices = true;
+            continue;
         }
         // If there is a boundary edge, start from that; otherwise start
         // with any half-edge (default 0) started from this vertex.
         if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
+            init_half_edge_index = half_edges_from_vertex[begin];
         }
 
         // Push edges to ordered_half_edge_from_vertex_.
+        std::vector<int> &ordered_half_edges =
+                het_mesh->ordered_half_edge_from_vertex_[vertex_index];
+        ordered_half_edges.reserve(end - begin);
         int curr_he_index = init_half_edge_index;
-        het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                curr_he_index);
+        ordered_half_edges.push_back(curr_he_index);
         int next_next_twin_he_index =
                 het_mesh->NextHalfEdgeFromVertex(curr_he_index);
         curr_he_index = next_next_twin_he_index;
         while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
+            ordered_half_edges.push_back(curr_he_index);
             next_next_twin_he_index =
                     het_mesh->NextHalfEdgeFromVertex(curr_he_index);
             curr_he_index = next_next_twin_he_index;
         }
     }
+    if (has_invalid_vertices) {
+        utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
+    }
 
     mesh_cpy->ComputeVertexNormals();
     het_mesh->vertices_ = mesh_cpy->vertices_;
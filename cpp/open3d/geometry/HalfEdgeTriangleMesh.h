@@ -103,7 +103,9 @@ public:
     HalfEdgeTriangleMesh operator+(const HalfEdgeTriangleMesh &mesh) const;
 
     /// Convert HalfEdgeTriangleMesh from TriangleMesh. Throws exception if the
-    /// input mesh is not manifold.
+    /// input mesh is not manifold. The half-edges are built in parallel and
+    /// laid out 3 per triangle: half-edge 3 * i + j goes from corner j to
+    /// corner (j + 1) % 3 of triangle i of the purged mesh.
     static std::shared_ptr<HalfEdgeTriangleMesh> CreateFromTriangleMesh(
             const TriangleMesh &mesh);
 
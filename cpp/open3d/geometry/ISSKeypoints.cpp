@@ -125,9 +125,9 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
         }
     }
 
-    std::vector<size_t> kp_indices;
-    kp_indices.reserve(points.size());
-#pragma omp parallel for schedule(static) shared(kp_indices)
+    // Flag the keypoints in parallel and collect them in order afterwards.
+    std::vector<char> is_keypoint(points.size(), 0);
+#pragma omp parallel for schedule(dynamic, 256) shared(is_keypoint)
     for (int i = 0; i < (int)points.size(); i++) {
         if (third_eigen_values[i] > 0.0) {
             std::vector<int> nn_indices;
@@ -137,10 +137,16 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
 
             if (nb_neighbors >= min_neighbors &&
                 IsLocalMaxima(i, nn_indices, third_eigen_values)) {
-                kp_indices.emplace_back(i);
+                is_keypoint[i] = 1;
             }
         }
     }
+    std::vector<size_t> kp_indices;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (is_keypoint[i]) {
+            kp_indices.push_back(i);
+        }
+    }
 
     utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
                       kp_indices.size());
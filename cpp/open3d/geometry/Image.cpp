@@ -26,6 +26,8 @@
 
 #include "open3d/geometry/Image.h"
 
+#include <algorithm>
+
 #include "open3d/utility/Parallel.h"
 
 namespace {
@@ -37,6 +39,94 @@ const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
                                        0.21875, 0.109375, 0.03125};
 const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
 const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+/// Convolve every row of a single channel float image with \p kernel,
+/// replicating the border pixels. Products are rounded to float and summed in
+/// double, from the first to the last tap.
+void FilterRows(const float *in,
+                float *out,
+                int width,
+                int height,
+                const std::vector<float> &kernel) {
+    const int half = (int)kernel.size() / 2;
+#pragma omp parallel for schedule(static) \
+        num_threads(open3d::utility::EstimateMaxThreads())
+    for (int y = 0; y < height; y++) {
+        const float *row_in = in + (size_t)y * width;
+        float *row_out = out + (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            double temp = 0;
+            if (x >= half && x + half < width) {
+                const float *pi = row_in + x - half;
+                for (size_t i = 0; i < kernel.size(); i++) {
+                    temp += pi[i] * kernel[i];
+                }
+            } else {
+                for (int i = -half; i <= half; i++) {
+                    const int x_shift = std::min(std::max(x + i, 0), width - 1);
+                    temp += row_in[x_shift] * kernel[i + half];
+                }
+            }
+            row_out[x] = (float)temp;
+        }
+    }
+}
+
+/// Same as FilterRows along the columns. Whole rows are accumulated at once so
+/// that the inner loop runs over contiguous memory and vectorizes.
+void FilterColumns(const float *in,
+                   float *out,
+                   int width,
+                   int height,
+                   const std::vector<float> &kernel) {
+    const int half = (int)kernel.size() / 2;
+#pragma omp parallel num_threads(open3d::utility::EstimateMaxThreads())
+    {
+        std::vector<double> temp(width);
+#pragma omp for schedule(static)
+        for (int y = 0; y < height; y++) {
+            std::fill(temp.begin(), temp.end(), 0.0);
+            for (int i = -half; i <= half; i++) {
+                const int y_shift = std::min(std::max(y + i, 0), height - 1);
+                const float *row_in = in + (size_t)y_shift * width;
+                const float k = kernel[i + half];
+                for (int x = 0; x < width; x++) {
+                    temp[x] += row_in[x] * k;
+                }
+            }
+            float *row_out = out + (size_t)y * width;
+            for (int x = 0; x < width; x++) {
+                row_out[x] = (float)temp[x];
+            }
+        }
+    }
+}
+
+/// Sum over a window of 2 * \p half + 1 pixels along the rows, replicating
+/// the border pixels. The window is slid by adding the entering and removing
+/// the leaving pixel.
+void BoxSumRows(const float *in,
+                double *out,
+                int width,
+                int height,
+                int half) {
+#pragma omp parallel for schedule(static) \
+        num_threads(open3d::utility::EstimateMaxThreads())
+    for (int y = 0; y < height; y++) {
+        const float *row_in = in + (size_t)y * width;
+        double *row_out = out + (size_t)y * width;
+        double sum = 0;
+        for (int i = -half; i <= half; i++) {
+            sum += row_in[std::min(std::max(i, 0), width - 1)];
+        }
+        row_out[0] = sum;
+        for (int x = 1; x < width; x++) {
+            sum += row_in[std::min(x + half, width - 1)];
+            sum -= row_in[std::max(x - half - 1, 0)];
+            row_out[x] = sum;
+        }
+    }
+}
 }  // unnamed namespace
 
 namespace open3d {
@@ -187,29 +277,10 @@ std::shared_ptr<Image> Image::FilterHorizontal(
     }
     output->Prepare(width_, height_, 1, 4);
 
-    const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
-
-#ifdef _WIN32
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-#else
-#pragma omp parallel for collapse(2) schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-#endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *po = output->PointerAt<float>(x, y, 0);
-            double temp = 0;
-            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
-                int x_shift = x + i;
-                if (x_shift < 0) x_shift = 0;
-                if (x_shift > width_ - 1) x_shift = width_ - 1;
-                float *pi = PointerAt<float>(x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
-            }
-            *po = (float)temp;
-        }
-    }
+    const std::vector<float> kernel_f(kernel.begin(), kernel.end());
+    FilterRows(reinterpret_cast<const float *>(data_.data()),
+               reinterpret_cast<float *>(output->data_.data()), width_,
+               height_, kernel_f);
     return output;
 }
 
@@ -255,15 +326,81 @@ ImagePyramid Image::FilterPyramid(const ImagePyramid &input,
 std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
                                      const std::vector<double> &dy) const {
     auto output = std::make_shared<Image>();
+    if (num_of_channels_ != 1 || bytes_per_channel_ != 4 ||
+        dx.size() % 2 != 1 || dy.size() % 2 != 1) {
+        utility::LogError("[Filter] Unsupported image format or kernel size.");
+    }
+    output->Prepare(width_, height_, 1, 4);
+
+    // Rows first, then columns, without transposing the image.
+    const std::vector<float> dx_f(dx.begin(), dx.end());
+    const std::vector<float> dy_f(dy.begin(), dy.end());
+    std::vector<float> temp((size_t)width_ * height_);
+    FilterRows(reinterpret_cast<const float *>(data_.data()), temp.data(),
+               width_, height_, dx_f);
+    FilterColumns(temp.data(), reinterpret_cast<float *>(output->data_.data()),
+                  width_, height_, dy_f);
+    return output;
+}
+
+std::shared_ptr<Image> Image::FilterBox(int half_kernel_size) const {
+    auto output = std::make_shared<Image>();
     if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogError("[Filter] Unsupported image format.");
+        utility::LogError("[FilterBox] Unsupported image format.");
+    }
+    if (half_kernel_size < 0) {
+        utility::LogError("[FilterBox] Invalid half_kernel_size {}.",
+                          half_kernel_size);
+    }
+    output->Prepare(width_, height_, 1, 4);
+    if (IsEmpty()) {
+        return output;
     }
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Transpose();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Transpose();
-    return temp4;
+    // Running sums make the cost independent of the kernel size.
+    const int half = half_kernel_size;
+    const double norm = 1.0 / ((2.0 * half + 1) * (2.0 * half + 1));
+    std::vector<double> row_sum((size_t)width_ * height_);
+    BoxSumRows(reinterpret_cast<const float *>(data_.data()), row_sum.data(),
+               width_, height_, half);
+
+    float *out = reinterpret_cast<float *>(output->data_.data());
+    const int width = width_;
+    const int height = height_;
+    auto row = [&](int y) {
+        y = std::min(std::max(y, 0), height - 1);
+        return row_sum.data() + (size_t)y * width;
+    };
+    // Slide the column window down the image, one tile of columns per task.
+    const int tile = 64;
+    const int num_tiles = (width + tile - 1) / tile;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int t = 0; t < num_tiles; t++) {
+        const int x_begin = t * tile;
+        const int x_end = std::min(x_begin + tile, width);
+        double sum[tile] = {0};
+        for (int i = -half; i <= half; i++) {
+            const double *r = row(i);
+            for (int x = x_begin; x < x_end; x++) {
+                sum[x - x_begin] += r[x];
+            }
+        }
+        for (int y = 0; y < height; y++) {
+            if (y > 0) {
+                const double *r_in = row(y + half);
+                const double *r_out = row(y - half - 1);
+                for (int x = x_begin; x < x_end; x++) {
+                    sum[x - x_begin] += r_in[x] - r_out[x];
+                }
+            }
+            float *row_out = out + (size_t)y * width;
+            for (int x = x_begin; x < x_end; x++) {
+                row_out[x] = (float)(sum[x - x_begin] * norm);
+            }
+        }
+    }
+    return output;
 }
 
 std::shared_ptr<Image> Image::Transpose() const {
@@ -190,6 +190,11 @@ public:
     std::shared_ptr<Image> FilterHorizontal(
             const std::vector<double> &kernel) const;
 
+    /// Function to filter image with a normalized box filter of size
+    /// (2 * half_kernel_size + 1)^2, replicating the border pixels. The cost
+    /// does not depend on the kernel size.
+    std::shared_ptr<Image> FilterBox(int half_kernel_size = 1) const;
+
     /// Function to 2x image downsample using simple 2x2 averaging.
     std::shared_ptr<Image> Downsample() const;
 
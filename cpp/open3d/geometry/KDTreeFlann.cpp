@@ -31,11 +31,11 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
-#include <nanoflann.hpp>
-
+#include "open3d/core/nns/NanoFlannImpl.h"
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -43,11 +43,19 @@ namespace geometry {
 
 KDTreeFlann::KDTreeFlann() {}
 
-KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
+KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data, int leaf_size)
+    : leaf_size_(leaf_size) {
+    SetMatrixData(data);
+}
 
-KDTreeFlann::KDTreeFlann(const Geometry &geometry) { SetGeometry(geometry); }
+KDTreeFlann::KDTreeFlann(const Geometry &geometry, int leaf_size)
+    : leaf_size_(leaf_size) {
+    SetGeometry(geometry);
+}
 
-KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature) {
+KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature,
+                         int leaf_size)
+    : leaf_size_(leaf_size) {
     SetFeature(feature);
 }
 
@@ -112,22 +120,22 @@ template <typename T>
 int KDTreeFlann::SearchKNN(const T &query,
                            int knn,
                            std::vector<int> &indices,
-                           std::vector<double> &distance2) const {
+                           std::vector<double> &distance2,
+                           double eps) const {
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
-        size_t(query.rows()) != dimension_ || knn < 0) {
+    if (!nanoflann_index_ || dataset_size_ <= 0 ||
+        size_t(query.rows()) != dimension_ || knn < 0 || eps < 0.0) {
         return -1;
     }
     indices.resize(knn);
     distance2.resize(knn);
-    std::vector<Eigen::Index> indices_eigen(knn);
-    int k = nanoflann_index_->index->knnSearch(
-            query.data(), knn, indices_eigen.data(), distance2.data());
+    int k = static_cast<int>(nanoflann_index_->knnSearch(
+            query.data(), knn, indices.data(), distance2.data(),
+            nanoflann::SearchParams(-1, static_cast<float>(eps))));
     indices.resize(k);
     distance2.resize(k);
-    std::copy_n(indices_eigen.begin(), k, indices.begin());
     return k;
 }
 
@@ -140,12 +148,12 @@ int KDTreeFlann::SearchRadius(const T &query,
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if (!nanoflann_index_ || dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_) {
         return -1;
     }
-    std::vector<std::pair<Eigen::Index, double>> indices_dists;
-    int k = nanoflann_index_->index->radiusSearch(
+    std::vector<std::pair<int, double>> indices_dists;
+    int k = nanoflann_index_->radiusSearch(
             query.data(), radius * radius, indices_dists,
             nanoflann::SearchParams(-1, 0.0));
     indices.resize(k);
@@ -167,20 +175,24 @@ int KDTreeFlann::SearchHybrid(const T &query,
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if (!nanoflann_index_ || dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_ || max_nn < 0) {
         return -1;
     }
+    indices.resize(max_nn);
     distance2.resize(max_nn);
-    std::vector<Eigen::Index> indices_eigen(max_nn);
-    int k = nanoflann_index_->index->knnSearch(
-            query.data(), max_nn, indices_eigen.data(), distance2.data());
-    k = std::distance(distance2.begin(),
-                      std::lower_bound(distance2.begin(), distance2.begin() + k,
-                                       radius * radius));
+    nanoflann::KNNResultSet<double, int> result_set(max_nn);
+    result_set.init(indices.data(), distance2.data());
+    if (max_nn > 0) {
+        // Start from the radius as the worst distance, so that the search
+        // prunes the subtrees beyond it and keeps only closer neighbors.
+        distance2[max_nn - 1] = radius * radius;
+    }
+    nanoflann_index_->FindNeighbors(result_set, query.data(),
+                                    nanoflann::SearchParams());
+    int k = static_cast<int>(result_set.size());
     indices.resize(k);
     distance2.resize(k);
-    std::copy_n(indices_eigen.begin(), k, indices.begin());
     return k;
 }
 
@@ -191,13 +203,48 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
         return false;
     }
-    data_.resize(dataset_size_ * dimension_);
-    memcpy(data_.data(), data.data(),
+    data_ = core::Tensor({int64_t(dataset_size_), int64_t(dimension_)},
+                         core::Float64);
+    memcpy(data_.GetDataPtr<double>(), data.data(),
            dataset_size_ * dimension_ * sizeof(double));
-    data_interface_.reset(new Eigen::Map<const Eigen::MatrixXd>(data));
-    nanoflann_index_.reset(
-            new KDTree_t(dimension_, std::cref(*data_interface_), 15));
-    nanoflann_index_->index->buildIndex();
+    nanoflann_index_.reset(new KDTree_t(dataset_size_, int(dimension_),
+                                        data_.GetDataPtr<double>(),
+                                        leaf_size_));
+    return true;
+}
+
+bool KDTreeFlann::Save(const std::string &file_name) const {
+    if (!nanoflann_index_) {
+        utility::LogWarning("[KDTreeFlann::Save] The KDTree is empty.");
+        return false;
+    }
+    std::unordered_map<std::string, core::Tensor> arrays =
+            nanoflann_index_->Serialize();
+    arrays["data"] = data_;
+    t::io::WriteNpz(file_name, arrays);
+    return true;
+}
+
+bool KDTreeFlann::Load(const std::string &file_name, bool use_mmap) {
+    const t::io::NpzFile npz(file_name, use_mmap);
+    std::unordered_map<std::string, core::Tensor> arrays;
+    for (const std::string &key : npz.GetKeys()) {
+        arrays[key] = npz.Get(key);
+    }
+    if (arrays.count("data") == 0 ||
+        arrays.at("data").GetDtype() != core::Float64 ||
+        arrays.at("data").NumDims() != 2) {
+        utility::LogWarning("[KDTreeFlann::Load] {} has no KDTree data.",
+                            file_name);
+        return false;
+    }
+    const core::Tensor data = arrays.at("data").Contiguous();
+    nanoflann_index_.reset(new KDTree_t(data.GetLength(),
+                                        int(data.GetShape(1)),
+                                        data.GetDataPtr<double>(), arrays));
+    data_ = data;
+    dataset_size_ = data.GetLength();
+    dimension_ = data.GetShape(1);
     return true;
 }
 
@@ -210,7 +257,8 @@ template int KDTreeFlann::SearchKNN<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         int knn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps) const;
 template int KDTreeFlann::SearchRadius<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         double radius,
@@ -232,7 +280,8 @@ template int KDTreeFlann::SearchKNN<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         int knn,
         std::vector<int> &indices,
-        std::vector<double> &distance2) const;
+        std::vector<double> &distance2,
+        double eps) const;
 template int KDTreeFlann::SearchRadius<Eigen::VectorXd>(
         const Eigen::VectorXd &query,
         double radius,
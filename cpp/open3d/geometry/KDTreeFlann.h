@@ -28,18 +28,24 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/geometry/Geometry.h"
 #include "open3d/geometry/KDTreeSearchParam.h"
 #include "open3d/pipelines/registration/Feature.h"
 
 /// @cond
-namespace nanoflann {
-struct metric_L2;
-template <class MatrixType, int DIM, class Distance, bool row_major>
-struct KDTreeEigenMatrixAdaptor;
-}  // namespace nanoflann
+namespace open3d {
+namespace core {
+namespace nns {
+template <int METRIC, class TReal, class TIndex>
+struct NanoFlannIndexHolder;
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
 /// @endcond
 
 namespace open3d {
@@ -55,16 +61,22 @@ public:
     /// \brief Parameterized Constructor.
     ///
     /// \param data Provides set of data points for KDTree construction.
-    KDTreeFlann(const Eigen::MatrixXd &data);
+    /// \param leaf_size Maximum number of points in a leaf of the KDTree.
+    /// Larger leaves give a flatter tree, which is faster to build and suits
+    /// large batches of queries.
+    KDTreeFlann(const Eigen::MatrixXd &data, int leaf_size = 15);
     /// \brief Parameterized Constructor.
     ///
     /// \param geometry Provides geometry from which KDTree is constructed.
-    KDTreeFlann(const Geometry &geometry);
+    /// \param leaf_size Maximum number of points in a leaf of the KDTree.
+    KDTreeFlann(const Geometry &geometry, int leaf_size = 15);
     /// \brief Parameterized Constructor.
     ///
     /// \param feature Provides a set of features from which the KDTree is
     /// constructed.
-    KDTreeFlann(const pipelines::registration::Feature &feature);
+    /// \param leaf_size Maximum number of points in a leaf of the KDTree.
+    KDTreeFlann(const pipelines::registration::Feature &feature,
+                int leaf_size = 15);
     ~KDTreeFlann();
     KDTreeFlann(const KDTreeFlann &) = delete;
     KDTreeFlann &operator=(const KDTreeFlann &) = delete;
@@ -83,17 +95,36 @@ public:
     /// \param feature Set of features for KDTree construction.
     bool SetFeature(const pipelines::registration::Feature &feature);
 
+    /// Saves the data and the built KDTree to a .npz file.
+    ///
+    /// \param file_name The .npz file to write to.
+    bool Save(const std::string &file_name) const;
+    /// Loads a KDTree saved with Save() without rebuilding it.
+    ///
+    /// \param file_name The .npz file to read from.
+    /// \param use_mmap If true, the data points and the tree permutation are
+    /// memory-mapped, so that processes loading the same file share them
+    /// through the page cache.
+    bool Load(const std::string &file_name, bool use_mmap = false);
+
     template <typename T>
     int Search(const T &query,
                const KDTreeSearchParam &param,
                std::vector<int> &indices,
                std::vector<double> &distance2) const;
 
+    /// Searches the \p knn nearest neighbors of \p query.
+    ///
+    /// \param eps Approximation factor. Subtrees are pruned once they cannot
+    /// hold a neighbor closer than the current k-th distance divided by
+    /// (1 + eps), trading recall for speed on high-dimensional data such as
+    /// FPFH features. 0 performs exact search.
     template <typename T>
     int SearchKNN(const T &query,
                   int knn,
                   std::vector<int> &indices,
-                  std::vector<double> &distance2) const;
+                  std::vector<double> &distance2,
+                  double eps = 0.0) const;
 
     template <typename T>
     int SearchRadius(const T &query,
@@ -116,17 +147,16 @@ private:
     bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
 
 protected:
-    using KDTree_t = nanoflann::KDTreeEigenMatrixAdaptor<
-            Eigen::Map<const Eigen::MatrixXd>,
-            -1,
-            nanoflann::metric_L2,
-            false>;
-
-    std::vector<double> data_;
-    std::unique_ptr<Eigen::Map<const Eigen::MatrixXd>> data_interface_;
+    /// L2 nanoflann index, built in parallel for large datasets.
+    using KDTree_t =
+            core::nns::NanoFlannIndexHolder<core::nns::L2, double, int>;
+
+    /// (dataset_size_, dimension_) Float64 data points.
+    core::Tensor data_;
     std::unique_ptr<KDTree_t> nanoflann_index_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
+    int leaf_size_ = 15;
 };
 
 }  // namespace geometry
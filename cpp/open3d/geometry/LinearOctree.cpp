@@ -0,0 +1,265 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+// Spreads the lower 21 bits of v so that there are two zero bits between
+// consecutive bits.
+uint64_t SpreadBits(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+// Inverse of SpreadBits.
+uint64_t CompactBits(uint64_t v) {
+    v &= 0x1249249249249249;
+    v = (v ^ (v >> 2)) & 0x10c30c30c30c30c3;
+    v = (v ^ (v >> 4)) & 0x100f00f00f00f00f;
+    v = (v ^ (v >> 8)) & 0x1f0000ff0000ff;
+    v = (v ^ (v >> 16)) & 0x1f00000000ffff;
+    v = (v ^ (v >> 32)) & 0x1fffff;
+    return v;
+}
+
+}  // namespace
+
+constexpr size_t LinearOctree::kMaxDepth;
+
+void LinearOctree::CreateFromPointCloud(const PointCloud& point_cloud,
+                                        size_t max_depth,
+                                        double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    if (max_depth > kMaxDepth) {
+        utility::LogError("max_depth must be at most {}, but got {}.",
+                          kMaxDepth, max_depth);
+    }
+    const size_t num_points = point_cloud.points_.size();
+    if (num_points > std::numeric_limits<uint32_t>::max()) {
+        utility::LogError("Too many points for a LinearOctree: {}.",
+                          num_points);
+    }
+
+    // Set bounds as in Octree::ConvertFromPointCloud.
+    Clear();
+    max_depth_ = max_depth;
+    if (num_points == 0) {
+        return;
+    }
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    // Sort the points by the Morton code of their leaf cell. Ties keep the
+    // point order.
+    std::vector<std::pair<uint64_t, size_t>> sorted_codes(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < int64_t(num_points); ++idx) {
+        sorted_codes[idx] = std::make_pair(
+                ComputeMortonCode(point_cloud.points_[idx]), size_t(idx));
+    }
+    tbb::parallel_sort(sorted_codes.begin(), sorted_codes.end());
+    point_indices_.resize(num_points);
+    point_codes_.resize(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t idx = 0; idx < int64_t(num_points); ++idx) {
+        point_codes_[idx] = sorted_codes[idx].first;
+        point_indices_[idx] = sorted_codes[idx].second;
+    }
+    sorted_codes.clear();
+    sorted_codes.shrink_to_fit();
+
+    // Build the tree level by level. The children of a node split its point
+    // range at the Morton digit of the next level, so each node is processed
+    // independently with binary searches.
+    Node root;
+    root.point_end_ = uint32_t(num_points);
+    nodes_.push_back(root);
+    size_t level_begin = 0;
+    size_t level_end = 1;
+    std::vector<std::array<uint32_t, 9>> splits;
+    std::vector<size_t> child_offsets;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        const int64_t num_level_nodes = int64_t(level_end - level_begin);
+        const size_t shift = 3 * (max_depth_ - 1 - depth);
+        splits.resize(num_level_nodes);
+        child_offsets.resize(num_level_nodes + 1);
+        child_offsets[0] = 0;
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_level_nodes; ++i) {
+            Node& node = nodes_[level_begin + i];
+            const auto begin = point_codes_.begin() + node.point_begin_;
+            const auto end = point_codes_.begin() + node.point_end_;
+            std::array<uint32_t, 9>& split = splits[i];
+            split[0] = node.point_begin_;
+            for (uint64_t digit = 1; digit < 8; ++digit) {
+                auto it = std::partition_point(
+                        begin, end, [shift, digit](uint64_t code) {
+                            return ((code >> shift) & 7) < digit;
+                        });
+                split[digit] = uint32_t(it - point_codes_.begin());
+            }
+            split[8] = node.point_end_;
+            for (int digit = 0; digit < 8; ++digit) {
+                if (split[digit] < split[digit + 1]) {
+                    node.child_mask_ |= uint8_t(1 << digit);
+                }
+            }
+            child_offsets[i + 1] = std::bitset<8>(node.child_mask_).count();
+        }
+        std::partial_sum(child_offsets.begin(), child_offsets.end(),
+                         child_offsets.begin());
+
+        const size_t num_children = child_offsets.back();
+        if (level_end + num_children >
+            size_t(std::numeric_limits<int32_t>::max())) {
+            utility::LogError("Too many nodes for a LinearOctree.");
+        }
+        nodes_.resize(level_end + num_children);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_level_nodes; ++i) {
+            Node& node = nodes_[level_begin + i];
+            node.first_child_ = int32_t(level_end + child_offsets[i]);
+            int32_t child_idx = node.first_child_;
+            for (int digit = 0; digit < 8; ++digit) {
+                if (node.child_mask_ & (1 << digit)) {
+                    Node& child = nodes_[child_idx++];
+                    child.depth_ = uint8_t(depth + 1);
+                    child.child_index_ = uint8_t(digit);
+                    child.point_begin_ = splits[i][digit];
+                    child.point_end_ = splits[i][digit + 1];
+                }
+            }
+        }
+        level_begin = level_end;
+        level_end += num_children;
+    }
+    utility::LogDebug("LinearOctree: {:d} points, {:d} nodes, {:d} leaves.",
+                      num_points, nodes_.size(), level_end - level_begin);
+}
+
+LinearOctree& LinearOctree::Clear() {
+    origin_.setZero();
+    size_ = 0;
+    nodes_.clear();
+    point_indices_.clear();
+    point_codes_.clear();
+    return *this;
+}
+
+int64_t LinearOctree::LocateLeafNode(const Eigen::Vector3d& point) const {
+    if (nodes_.empty() || !Octree::IsPointInBound(point, origin_, size_)) {
+        return -1;
+    }
+    const uint64_t code = ComputeMortonCode(point);
+    int64_t node_idx = 0;
+    for (size_t depth = 0; depth < max_depth_; ++depth) {
+        const Node& node = nodes_[node_idx];
+        const int digit = int((code >> (3 * (max_depth_ - 1 - depth))) & 7);
+        if (!(node.child_mask_ & (1 << digit))) {
+            return -1;
+        }
+        node_idx = node.first_child_ +
+                   std::bitset<8>(node.child_mask_ & ((1 << digit) - 1))
+                           .count();
+    }
+    return node_idx;
+}
+
+Eigen::Vector3d LinearOctree::GetNodeOrigin(int64_t node_index) const {
+    const Node& node = nodes_.at(node_index);
+    const uint64_t prefix = point_codes_[node.point_begin_] >>
+                            (3 * (max_depth_ - node.depth_));
+    const Eigen::Vector3d cell(double(CompactBits(prefix)),
+                               double(CompactBits(prefix >> 1)),
+                               double(CompactBits(prefix >> 2)));
+    return origin_ + cell * GetNodeSize(node_index);
+}
+
+double LinearOctree::GetNodeSize(int64_t node_index) const {
+    return std::ldexp(size_, -int(nodes_.at(node_index).depth_));
+}
+
+std::vector<size_t> LinearOctree::GetNodePointIndices(
+        int64_t node_index) const {
+    const Node& node = nodes_.at(node_index);
+    return std::vector<size_t>(point_indices_.begin() + node.point_begin_,
+                               point_indices_.begin() + node.point_end_);
+}
+
+uint64_t LinearOctree::ComputeMortonCode(const Eigen::Vector3d& point) const {
+    const int64_t num_cells = int64_t(1) << max_depth_;
+    uint64_t cell[3];
+    for (int axis = 0; axis < 3; ++axis) {
+        int64_t c = int64_t(
+                std::floor((point(axis) - origin_(axis)) / size_ * num_cells));
+        cell[axis] = uint64_t(std::min(std::max(c, int64_t(0)), num_cells - 1));
+    }
+    return SpreadBits(cell[0]) | (SpreadBits(cell[1]) << 1) |
+           (SpreadBits(cell[2]) << 2);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+
+/// \class LinearOctree
+///
+/// \brief Pointerless octree over the points of a point cloud.
+///
+/// The points are sorted by the Morton code of their leaf cell, so the points
+/// of every node form a contiguous range of point_indices_. Nodes are stored
+/// in breadth-first order in one array, the children of a node are stored
+/// next to each other, and a node is addressed by its position in nodes_.
+/// The layout has no pointers, so it can be built in parallel and written
+/// out as is.
+///
+/// Child indices follow Octree: x + 2 * y + 4 * z, where x, y and z are 1 for
+/// the upper half of the parent along that axis.
+class LinearOctree {
+public:
+    /// Node of a LinearOctree.
+    struct Node {
+        /// Index of the first child in nodes_, or -1 for a leaf.
+        int32_t first_child_ = -1;
+        /// Bit i is set iff child i exists. Existing children are stored in
+        /// increasing child index order from first_child_.
+        uint8_t child_mask_ = 0;
+        /// Distance to the root node.
+        uint8_t depth_ = 0;
+        /// Child index of this node in its parent.
+        uint8_t child_index_ = 0;
+        /// The points in this node are point_indices_[point_begin_,
+        /// point_end_).
+        uint32_t point_begin_ = 0;
+        uint32_t point_end_ = 0;
+    };
+
+    /// The maximum supported depth, limited by the 64-bit Morton codes.
+    static constexpr size_t kMaxDepth = 21;
+
+public:
+    LinearOctree() : origin_(0, 0, 0), size_(0), max_depth_(0) {}
+
+    /// \brief Builds the octree from a point cloud in parallel.
+    ///
+    /// The bounds are chosen as in Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param max_depth Depth of the leaf nodes, at most kMaxDepth.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void CreateFromPointCloud(const PointCloud& point_cloud,
+                              size_t max_depth,
+                              double size_expand = 0.01);
+
+    /// Removes all nodes and points.
+    LinearOctree& Clear();
+
+    /// Returns true if the octree has no nodes.
+    bool IsEmpty() const { return nodes_.empty(); }
+
+    /// \brief Returns the index of the leaf node where \p point resides, or
+    /// -1 if the point is out of bounds or falls in an empty cell.
+    ///
+    /// \param point Coordinates of the point.
+    int64_t LocateLeafNode(const Eigen::Vector3d& point) const;
+
+    /// Returns the min bound of node \p node_index.
+    Eigen::Vector3d GetNodeOrigin(int64_t node_index) const;
+
+    /// Returns the edge size of node \p node_index.
+    double GetNodeSize(int64_t node_index) const;
+
+    /// Returns the indices of the points in node \p node_index.
+    std::vector<size_t> GetNodePointIndices(int64_t node_index) const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree.
+    double size_;
+
+    /// Depth of the leaf nodes.
+    size_t max_depth_;
+
+    /// Nodes in breadth-first order. nodes_[0] is the root.
+    std::vector<Node> nodes_;
+
+    /// Point indices sorted by the Morton code of their leaf cell.
+    std::vector<size_t> point_indices_;
+
+    /// Morton codes of the leaf cells, in the order of point_indices_.
+    std::vector<uint64_t> point_codes_;
+
+private:
+    /// Returns the Morton code of the leaf cell containing \p point, assuming
+    /// the point is within bounds.
+    uint64_t ComputeMortonCode(const Eigen::Vector3d& point) const;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -140,20 +140,20 @@ std::vector<double> PointCloud::ComputePointCloudDistance(
     std::vector<double> distances(points_.size());
     KDTreeFlann kdtree;
     kdtree.SetGeometry(target);
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices(1);
-        std::vector<double> dists(1);
-        if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
-            utility::LogDebug(
-                    "[ComputePointCloudToPointCloudDistance] Found a point "
-                    "without neighbors.");
-            distances[i] = 0.0;
-        } else {
-            distances[i] = std::sqrt(dists[0]);
+    utility::ParallelForRange(points_.size(), [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            std::vector<int> indices(1);
+            std::vector<double> dists(1);
+            if (kdtree.SearchKNN(points_[i], 1, indices, dists) == 0) {
+                utility::LogDebug(
+                        "[ComputePointCloudToPointCloudDistance] Found a point "
+                        "without neighbors.");
+                distances[i] = 0.0;
+            } else {
+                distances[i] = std::sqrt(dists[0]);
+            }
         }
-    }
+    });
     return distances;
 }
 
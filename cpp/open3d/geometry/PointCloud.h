@@ -314,7 +314,10 @@ public:
     /// in Large Spatial Databases with Noise", 1996
     ///
     /// Returns a list of point labels, -1 indicates noise according to
-    /// the algorithm.
+    /// the algorithm. Clusters are numbered in the order of their first core
+    /// point, and a border point joins the lowest-numbered adjacent cluster.
+    /// Neighbors are queried on the fly instead of being stored, so memory
+    /// use is linear in the number of points.
     ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
@@ -330,13 +333,38 @@ public:
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// Iterations stop early once this confidence is reached.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment up to \p max_planes planes by repeatedly running RANSAC
+    /// and removing the inliers of each detected plane.
+    ///
+    /// Extraction stops early when fewer than \p ransac_n points are left or
+    /// no valid plane is found.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param max_planes Maximum number of planes to extract.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Returns the plane models and the indices of their inliers, in
+    /// the order they were extracted.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> SegmentPlanes(
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const int max_planes = 10,
+            const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
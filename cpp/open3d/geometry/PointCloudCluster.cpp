@@ -25,7 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <atomic>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
@@ -35,77 +35,117 @@
 namespace open3d {
 namespace geometry {
 
+// Returns the root of |idx| with path halving. Every parent points to a smaller
+// or equal index, so the root of a set is its smallest member.
+static int FindRoot(std::vector<std::atomic<int>> &parents, int idx) {
+    while (true) {
+        int parent = parents[idx].load();
+        if (parent == idx) {
+            return idx;
+        }
+        int grand_parent = parents[parent].load();
+        if (parent != grand_parent) {
+            parents[idx].compare_exchange_weak(parent, grand_parent);
+        }
+        idx = grand_parent;
+    }
+}
+
+// Lock-free union that always links the larger root below the smaller one.
+static void UnionSets(std::vector<std::atomic<int>> &parents, int a, int b) {
+    while (true) {
+        a = FindRoot(parents, a);
+        b = FindRoot(parents, b);
+        if (a == b) {
+            return;
+        }
+        if (a < b) {
+            std::swap(a, b);
+        }
+        int expected = a;
+        if (parents[a].compare_exchange_strong(expected, b)) {
+            return;
+        }
+    }
+}
+
 std::vector<int> PointCloud::ClusterDBSCAN(double eps,
                                            size_t min_points,
                                            bool print_progress) const {
     KDTreeFlann kdtree(*this);
+    const int num_points = int(points_.size());
 
-    // Precompute all neighbors.
-    utility::LogDebug("Precompute neighbors.");
+    // Neighbors are queried on the fly in every pass and never stored, so the
+    // memory footprint stays linear in the number of points.
+    utility::LogDebug("Find core points.");
     utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute neighbors.", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
+            points_.size(), "Find core points", print_progress);
+    std::vector<char> is_core(num_points, 0);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
+    for (int idx = 0; idx < num_points; ++idx) {
+        std::vector<int> nbs;
         std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+        kdtree.SearchRadius(points_[idx], eps, nbs, dists2);
+        is_core[idx] = nbs.size() >= min_points;
 
 #pragma omp critical(ClusterDBSCAN)
         { ++progress_bar; }
     }
-    utility::LogDebug("Done Precompute neighbors.");
 
-    // Set all labels to undefined (-2).
+    // Merge neighboring core points with a concurrent union-find.
     utility::LogDebug("Compute Clusters");
     progress_bar.Reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
+    std::vector<std::atomic<int>> parents(num_points);
+    for (int idx = 0; idx < num_points; ++idx) {
+        parents[idx].store(idx);
+    }
+#pragma omp parallel for schedule(dynamic, 256) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            std::vector<int> nbs;
+            std::vector<double> dists2;
+            kdtree.SearchRadius(points_[idx], eps, nbs, dists2);
+            for (int nb : nbs) {
+                if (nb < idx && is_core[nb]) {
+                    UnionSets(parents, idx, nb);
+                }
+            }
+        }
+
+#pragma omp critical(ClusterDBSCAN)
+        { ++progress_bar; }
+    }
+
+    // Number the clusters by their smallest core point, which is the root.
+    std::vector<int> labels(num_points, -1);
     int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        // Label is not undefined.
-        if (labels[idx] != -2) {
-            continue;
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
+            int root = FindRoot(parents, idx);
+            labels[idx] = root == idx ? cluster_label++ : labels[root];
         }
+    }
 
-        // Check density.
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
+    // A border point joins the lowest-numbered cluster among its core
+    // neighbors, and is noise if it has none.
+#pragma omp parallel for schedule(dynamic, 256) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int idx = 0; idx < num_points; ++idx) {
+        if (is_core[idx]) {
             continue;
         }
-
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
-
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
-
-            // Noise label.
-            if (labels[nb] == -1) {
-                labels[nb] = cluster_label;
-                ++progress_bar;
-            }
-            // Not undefined label.
-            if (labels[nb] != -2) {
-                continue;
-            }
-            labels[nb] = cluster_label;
-            ++progress_bar;
-
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
-                    }
-                }
+        std::vector<int> nbs;
+        std::vector<double> dists2;
+        kdtree.SearchRadius(points_[idx], eps, nbs, dists2);
+        int label = -1;
+        for (int nb : nbs) {
+            if (is_core[nb] && (label == -1 || labels[nb] < label)) {
+                label = labels[nb];
             }
         }
-
-        cluster_label++;
+        labels[idx] = label;
     }
 
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
@@ -34,6 +34,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -51,39 +52,6 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
-    RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            error += distance;
-            inliers.emplace_back(idx);
-        }
-    }
-
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
-        result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
-    }
-    return result;
-}
-
 // Find the plane such that the summed squared distance from the
 // plane to all points is minimized.
 //
@@ -132,72 +100,100 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
+// Runs RANSAC plane fitting restricted to the points referenced by |indices|.
+// Hypotheses are drawn serially from |rng| and scored in parallel batches, so
+// the outcome does not depend on the number of threads. Iterations stop early
+// once a plane with the current best fitness would have been found with the
+// requested probability. The returned inliers index into |points|.
+static std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &indices,
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        std::mt19937 &rng) {
     RANSACResult result;
-    double error = 0;
-
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
+    const size_t num_points = indices.size();
+    std::vector<size_t> sample(num_points);
+    std::iota(std::begin(sample), std::end(sample), 0);
 
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
-
-    std::random_device rd;
-    std::mt19937 rng(rd());
+    const int batch_size = std::max(1, utility::EstimateMaxThreads());
+    std::vector<Eigen::Vector4d> batch_models;
+    std::vector<RANSACResult> batch_results;
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
+    int itr = 0;
+    while (itr < num_iterations) {
+        const int this_batch = std::min(batch_size, num_iterations - itr);
+        batch_models.resize(this_batch);
+        batch_results.assign(this_batch, RANSACResult());
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
+        // Fit model to 3 randomly selected points.
+        for (int b = 0; b < this_batch; ++b) {
+            for (int i = 0; i < ransac_n; ++i) {
+                std::swap(sample[i], sample[rng() % num_points]);
+            }
+            batch_models[b] = TriangleMesh::ComputeTrianglePlane(
+                    points[indices[sample[0]]], points[indices[sample[1]]],
+                    points[indices[sample[2]]]);
         }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int b = 0; b < this_batch; ++b) {
+            const Eigen::Vector4d &plane_model = batch_models[b];
+            if (plane_model.isZero(0)) {
+                continue;
+            }
+            size_t inlier_num = 0;
+            double error = 0;
+            for (size_t idx : indices) {
+                const Eigen::Vector3d &p = points[idx];
+                double distance =
+                        std::abs(plane_model.head<3>().dot(p) + plane_model(3));
+                if (distance < distance_threshold) {
+                    error += distance;
+                    ++inlier_num;
+                }
+            }
+            if (inlier_num > 0) {
+                batch_results[b].fitness_ =
+                        (double)inlier_num / (double)num_points;
+                batch_results[b].inlier_rmse_ =
+                        error / std::sqrt((double)inlier_num);
+            }
         }
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+        // Pick the best hypothesis in sampling order.
+        for (int b = 0; b < this_batch; ++b) {
+            const RANSACResult &this_result = batch_results[b];
+            if (this_result.fitness_ > result.fitness_ ||
+                (this_result.fitness_ == result.fitness_ &&
+                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = this_result;
+                best_plane_model = batch_models[b];
+            }
         }
+        itr += this_batch;
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+        if (result.fitness_ > 0) {
+            const double required_iterations =
+                    std::log(1 - probability) /
+                    std::log(1 - std::pow(result.fitness_, ransac_n));
+            if (double(itr) >= required_iterations) {
+                utility::LogDebug("RANSAC | Early exit after {:d} iterations.",
+                                  itr);
+                break;
+            }
         }
     }
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
+    std::vector<size_t> inliers;
+    for (size_t idx : indices) {
+        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(best_plane_model.dot(point));
 
@@ -207,12 +203,93 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
 
     utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
                       inliers.size(), result.fitness_, result.inlier_rmse_);
     return std::make_tuple(best_plane_model, inliers);
 }
 
+static void CheckRANSACParameters(int ransac_n,
+                                  int num_iterations,
+                                  double probability) {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (num_iterations < 0) {
+        utility::LogError("num_iterations must be non-negative, but got {}.",
+                          num_iterations);
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be in (0, 1], but got {}.",
+                          probability);
+    }
+}
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, num_iterations, probability);
+    const size_t num_points = points_.size();
+    if (num_points < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+
+    std::vector<size_t> indices(num_points);
+    std::iota(std::begin(indices), std::end(indices), 0);
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return SegmentPlaneRANSAC(points_, indices, distance_threshold, ransac_n,
+                              num_iterations, probability, rng);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const int max_planes /* = 10 */,
+                          const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, num_iterations, probability);
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+
+    // Indices of the points not yet assigned to a plane. Inliers are erased
+    // in place after each extraction; the point cloud itself is never copied.
+    std::vector<size_t> remaining(points_.size());
+    std::iota(std::begin(remaining), std::end(remaining), 0);
+    std::vector<bool> is_inlier(points_.size(), false);
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    while (int(planes.size()) < max_planes &&
+           remaining.size() >= size_t(ransac_n)) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = SegmentPlaneRANSAC(
+                points_, remaining, distance_threshold, ransac_n,
+                num_iterations, probability, rng);
+        if (plane_model.isZero(0) || inliers.size() < size_t(ransac_n)) {
+            break;
+        }
+
+        for (size_t idx : inliers) {
+            is_inlier[idx] = true;
+        }
+        remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                       [&is_inlier](size_t idx) {
+                                           return bool(is_inlier[idx]);
+                                       }),
+                        remaining.end());
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+
+    utility::LogDebug("RANSAC | Extracted {:d} planes, {:d} points remaining.",
+                      planes.size(), remaining.size());
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -26,64 +26,39 @@
 
 #include <Eigen/Dense>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <unordered_map>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
-        const PointCloud& pcd,
-        double alpha,
-        std::shared_ptr<TetraMesh> tetra_mesh,
-        std::vector<size_t>* pt_map) {
-    std::vector<size_t> pt_map_computed;
-    if (tetra_mesh == nullptr) {
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] "
-                "ComputeDelaunayTetrahedralization");
-        std::tie(tetra_mesh, pt_map_computed) =
-                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
-        pt_map = &pt_map_computed;
-        utility::LogDebug(
-                "[CreateFromPointCloudAlphaShape] done "
-                "ComputeDelaunayTetrahedralization");
-    }
+namespace {
 
-    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
-    auto mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_ = tetra_mesh->vertices_;
-    if (pcd.HasNormals()) {
-        mesh->vertex_normals_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
-        }
-    }
-    if (pcd.HasColors()) {
-        mesh->vertex_colors_.resize(mesh->vertices_.size());
-        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
-            mesh->vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
-        }
-    }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
-
-    std::vector<double> vsqn(tetra_mesh->vertices_.size());
+/// Returns the circumradius of each tetra, or infinity for degenerate tetras
+/// so that they never satisfy the alpha constraint.
+std::vector<double> ComputeTetraCircumradii(const TetraMesh& tetra_mesh) {
+    const auto& verts = tetra_mesh.vertices_;
+    std::vector<double> vsqn(verts.size());
     for (size_t vidx = 0; vidx < vsqn.size(); ++vidx) {
-        vsqn[vidx] = tetra_mesh->vertices_[vidx].squaredNorm();
+        vsqn[vidx] = verts[vidx].squaredNorm();
     }
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] add triangles from tetras that "
-            "satisfy constraint");
-    const auto& verts = tetra_mesh->vertices_;
-    for (size_t tidx = 0; tidx < tetra_mesh->tetras_.size(); ++tidx) {
-        const auto& tetra = tetra_mesh->tetras_[tidx];
+    const int num_tetras = int(tetra_mesh.tetras_.size());
+    std::vector<double> radii(num_tetras);
+    int num_invalid = 0;
+#pragma omp parallel for schedule(static) reduction(+ : num_invalid) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_tetras; ++tidx) {
+        const auto& tetra = tetra_mesh.tetras_[tidx];
         // clang-format off
         Eigen::Matrix4d tmp;
         tmp << verts[tetra(0)](0), verts[tetra(0)](1), verts[tetra(0)](2), 1,
@@ -113,67 +88,162 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
         double dz = tmp.determinant();
         // clang-format on
         if (a == 0) {
-            utility::LogWarning(
-                    "[CreateFromPointCloudAlphaShape] invalid tetra in "
-                    "TetraMesh");
+            radii[tidx] = std::numeric_limits<double>::infinity();
+            num_invalid++;
         } else {
-            double r = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
-                       (2 * std::abs(a));
-
-            if (r <= alpha) {
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(2)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(1), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(0), tetra(2), tetra(3)));
-                mesh->triangles_.push_back(TriangleMesh::GetOrderedTriangle(
-                        tetra(1), tetra(2), tetra(3)));
-            }
+            radii[tidx] = std::sqrt(dx * dx + dy * dy + dz * dz - 4 * a * c) /
+                          (2 * std::abs(a));
         }
     }
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done add triangles from tetras "
-            "that satisfy constraint");
+    if (num_invalid > 0) {
+        utility::LogWarning(
+                "[CreateFromPointCloudAlphaShape] {:d} invalid tetras in "
+                "TetraMesh",
+                num_invalid);
+    }
+    return radii;
+}
 
-    utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove triangles within "
-            "the mesh");
+/// Returns the ordered faces of each tetra, 4 per tetra.
+std::vector<Eigen::Vector3i> ComputeTetraFaces(const TetraMesh& tetra_mesh) {
+    std::vector<Eigen::Vector3i> faces(4 * tetra_mesh.tetras_.size());
+    for (size_t tidx = 0; tidx < tetra_mesh.tetras_.size(); ++tidx) {
+        const auto& tetra = tetra_mesh.tetras_[tidx];
+        faces[4 * tidx + 0] = TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(1), tetra(2));
+        faces[4 * tidx + 1] = TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(1), tetra(3));
+        faces[4 * tidx + 2] = TriangleMesh::GetOrderedTriangle(
+                tetra(0), tetra(2), tetra(3));
+        faces[4 * tidx + 3] = TriangleMesh::GetOrderedTriangle(
+                tetra(1), tetra(2), tetra(3));
+    }
+    return faces;
+}
+
+/// Returns for each face of ComputeTetraFaces the index of the other tetra
+/// sharing it, or -1 if the face is on the convex hull. Faces shared by more
+/// than two tetras, which a valid tetrahedralization does not have, are
+/// marked with -2 and never make it to the boundary.
+std::vector<int> ComputeFaceNeighbors(
+        const std::vector<Eigen::Vector3i>& faces) {
+    std::vector<int> neighbors(faces.size(), -1);
     std::unordered_map<Eigen::Vector3i, int,
                        utility::hash_eigen<Eigen::Vector3i>>
-            triangle_count;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count.count(triangle) == 0) {
-            triangle_count[triangle] = 1;
+            first_face;
+    first_face.reserve(faces.size());
+    for (int fidx = 0; fidx < int(faces.size()); ++fidx) {
+        auto it = first_face.emplace(faces[fidx], fidx);
+        if (it.second) {
+            continue;
+        }
+        const int other = it.first->second;
+        if (neighbors[other] == -1) {
+            neighbors[other] = fidx / 4;
+            neighbors[fidx] = other / 4;
         } else {
-            triangle_count[triangle] += 1;
+            neighbors[other] = -2;
+            neighbors[fidx] = -2;
         }
     }
+    return neighbors;
+}
+
+}  // unnamed namespace
 
-    size_t to_idx = 0;
-    for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-        Eigen::Vector3i triangle = mesh->triangles_[tidx];
-        if (triangle_count[triangle] == 1) {
-            mesh->triangles_[to_idx] = triangle;
-            to_idx++;
+std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudAlphaShape(
+        const PointCloud& pcd,
+        double alpha,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    return CreateFromPointCloudAlphaShapes(pcd, {alpha}, tetra_mesh,
+                                           pt_map)[0];
+}
+
+std::vector<std::shared_ptr<TriangleMesh>>
+TriangleMesh::CreateFromPointCloudAlphaShapes(
+        const PointCloud& pcd,
+        const std::vector<double>& alphas,
+        std::shared_ptr<TetraMesh> tetra_mesh,
+        std::vector<size_t>* pt_map) {
+    std::vector<size_t> pt_map_computed;
+    if (tetra_mesh == nullptr) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] "
+                "ComputeDelaunayTetrahedralization");
+        std::tie(tetra_mesh, pt_map_computed) =
+                Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+        pt_map = &pt_map_computed;
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] done "
+                "ComputeDelaunayTetrahedralization");
+    }
+
+    utility::LogDebug("[CreateFromPointCloudAlphaShape] init triangle mesh");
+    TriangleMesh base;
+    base.vertices_ = tetra_mesh->vertices_;
+    if (pcd.HasNormals()) {
+        base.vertex_normals_.resize(base.vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            base.vertex_normals_[idx] = pcd.normals_[(*pt_map)[idx]];
+        }
+    }
+    if (pcd.HasColors()) {
+        base.vertex_colors_.resize(base.vertices_.size());
+        for (size_t idx = 0; idx < (*pt_map).size(); ++idx) {
+            base.vertex_colors_[idx] = pcd.colors_[(*pt_map)[idx]];
         }
     }
-    mesh->triangles_.resize(to_idx);
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove triangles within "
-            "the mesh");
+            "[CreateFromPointCloudAlphaShape] done init triangle mesh");
 
+    // The circumradii and the face adjacency do not depend on alpha, so they
+    // are computed once for all the alpha values.
+    utility::LogDebug(
+            "[CreateFromPointCloudAlphaShape] compute circumradii and face "
+            "adjacency");
+    const std::vector<double> radii = ComputeTetraCircumradii(*tetra_mesh);
+    const std::vector<Eigen::Vector3i> faces = ComputeTetraFaces(*tetra_mesh);
+    const std::vector<int> neighbors = ComputeFaceNeighbors(faces);
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] remove duplicate triangles and "
-            "unreferenced vertices");
-    mesh->RemoveDuplicatedTriangles();
-    mesh->RemoveUnreferencedVertices();
+            "[CreateFromPointCloudAlphaShape] done compute circumradii and "
+            "face adjacency");
+
+    // A face of a tetra that satisfies the constraint is on the boundary iff
+    // the tetra on its other side does not, or there is none.
+    const int num_tetras = int(tetra_mesh->tetras_.size());
+    std::vector<char> face_mask(faces.size());
+    std::vector<std::shared_ptr<TriangleMesh>> meshes;
+    meshes.reserve(alphas.size());
+    for (const double alpha : alphas) {
+        utility::LogDebug(
+                "[CreateFromPointCloudAlphaShape] extract boundary for alpha "
+                "{}",
+                alpha);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int tidx = 0; tidx < num_tetras; ++tidx) {
+            for (int fidx = 4 * tidx; fidx < 4 * tidx + 4; ++fidx) {
+                const int other = neighbors[fidx];
+                face_mask[fidx] = radii[tidx] <= alpha &&
+                                  (other == -1 || (other >= 0 &&
+                                                   !(radii[other] <= alpha)));
+            }
+        }
+
+        auto mesh = std::make_shared<TriangleMesh>(base);
+        for (size_t fidx = 0; fidx < faces.size(); ++fidx) {
+            if (face_mask[fidx]) {
+                mesh->triangles_.push_back(faces[fidx]);
+            }
+        }
+        mesh->RemoveUnreferencedVertices();
+        meshes.push_back(mesh);
+    }
     utility::LogDebug(
-            "[CreateFromPointCloudAlphaShape] done remove duplicate triangles "
-            "and unreferenced vertices");
+            "[CreateFromPointCloudAlphaShape] done extract boundaries");
 
-    return mesh;
+    return meshes;
 }
 
 }  // namespace geometry
@@ -25,14 +25,18 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <list>
+#include <unordered_set>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -294,6 +298,7 @@ public:
                     Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
         }
         mesh_->triangle_normals_.push_back(face_normal);
+        ball_centers_.push_back(center);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
@@ -672,63 +677,66 @@ public:
         }
     }
 
+    // update radius => update border edges
+    void ReactivateBorderEdges(double radius) {
+        for (auto it = border_edges_.begin(); it != border_edges_.end();) {
+            BallPivotingEdgePtr edge = *it;
+            BallPivotingTrianglePtr triangle = edge->triangle0_;
+            utility::LogDebug(
+                    "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
+                    edge->source_->idx_, edge->target_->idx_,
+                    triangle->vert0_->idx_, triangle->vert1_->idx_,
+                    triangle->vert2_->idx_);
+
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle->vert0_->idx_,
+                                  triangle->vert1_->idx_,
+                                  triangle->vert2_->idx_, radius, center)) {
+                utility::LogDebug("[Run]   yes, we can work on this");
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                bool empty_ball = true;
+                for (auto idx : indices) {
+                    if (idx != triangle->vert0_->idx_ &&
+                        idx != triangle->vert1_->idx_ &&
+                        idx != triangle->vert2_->idx_) {
+                        utility::LogDebug(
+                                "[Run]   but no, the ball is not empty");
+                        empty_ball = false;
+                        break;
+                    }
+                }
+
+                if (empty_ball) {
+                    utility::LogDebug(
+                            "[Run]   yeah, add edge to edge_front_: {:d}",
+                            edge_front_.size());
+                    edge->type_ = BallPivotingEdge::Type::Front;
+                    edge_front_.push_back(edge);
+                    it = border_edges_.erase(it);
+                    continue;
+                }
+            }
+            ++it;
+        }
+    }
+
     std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
         if (!has_normals_) {
             utility::LogError("ReconstructBallPivoting requires normals");
         }
 
         mesh_->triangles_.clear();
+        ball_centers_.clear();
 
         for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
-            utility::LogDebug("[Run] change to radius {:.4f}", radius);
             if (radius <= 0) {
                 utility::LogError(
                         "got an invalid, negative radius as parameter");
             }
 
-            // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
-                }
-                ++it;
-            }
+            ReactivateBorderEdges(radius);
 
             // do the reconstruction
             if (edge_front_.empty()) {
@@ -744,6 +752,60 @@ public:
         return mesh_;
     }
 
+    /// Merges the triangles of independently reconstructed partitions and
+    /// pivots the ball over the open edges to close the seams between them.
+    /// Triangles that would make an edge or a vertex non-manifold are
+    /// dropped. \p centers holds the ball center of each triangle.
+    std::shared_ptr<TriangleMesh> Stitch(
+            const std::vector<Eigen::Vector3i>& triangles,
+            const std::vector<Eigen::Vector3d>& centers,
+            const std::vector<double>& radii) {
+        mesh_->triangles_.clear();
+        ball_centers_.clear();
+
+        for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+            const BallPivotingVertexPtr& v0 = vertices[triangles[tidx](0)];
+            const BallPivotingVertexPtr& v1 = vertices[triangles[tidx](1)];
+            const BallPivotingVertexPtr& v2 = vertices[triangles[tidx](2)];
+            if (v0->type_ == BallPivotingVertex::Type::Inner ||
+                v1->type_ == BallPivotingVertex::Type::Inner ||
+                v2->type_ == BallPivotingVertex::Type::Inner) {
+                continue;
+            }
+            BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
+            BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
+            BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
+            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
+                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front) ||
+                (e2 != nullptr && e2->type_ != BallPivotingEdge::Type::Front)) {
+                continue;
+            }
+            CreateTriangle(v0, v1, v2, centers[tidx]);
+        }
+
+        std::unordered_set<BallPivotingEdgePtr> front;
+        for (const BallPivotingVertexPtr& v : vertices) {
+            for (const BallPivotingEdgePtr& edge : v->edges_) {
+                if (edge->type_ == BallPivotingEdge::Type::Front &&
+                    front.insert(edge).second) {
+                    edge_front_.push_back(edge);
+                }
+            }
+        }
+        utility::LogDebug("[Stitch] merged {:d} triangles, {:d} open edges",
+                          mesh_->triangles_.size(), edge_front_.size());
+
+        for (double radius : radii) {
+            ReactivateBorderEdges(radius);
+            ExpandTriangulation(radius);
+        }
+        return mesh_;
+    }
+
+    const std::vector<Eigen::Vector3d>& GetBallCenters() const {
+        return ball_centers_;
+    }
+
 private:
     bool has_normals_;
     KDTreeFlann kdtree_;
@@ -751,6 +813,7 @@ private:
     std::list<BallPivotingEdgePtr> border_edges_;
     std::vector<BallPivotingVertexPtr> vertices;
     std::shared_ptr<TriangleMesh> mesh_;
+    std::vector<Eigen::Vector3d> ball_centers_;
 };
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
@@ -759,5 +822,128 @@ std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
     return bp.Run(radii);
 }
 
+std::shared_ptr<TriangleMesh>
+TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        double cell_size) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("ReconstructBallPivoting requires normals");
+    }
+    if (radii.empty()) {
+        utility::LogError("radii must not be empty");
+    }
+    for (double radius : radii) {
+        if (radius <= 0) {
+            utility::LogError("got an invalid, negative radius as parameter");
+        }
+    }
+    if (pcd.points_.empty()) {
+        return CreateFromPointCloudBallPivoting(pcd, radii);
+    }
+
+    // Each cell is reconstructed together with a margin large enough to
+    // contain every point that can touch a ball whose triangle has its
+    // centroid inside the cell.
+    const double max_radius = *std::max_element(radii.begin(), radii.end());
+    const double margin = 3 * max_radius;
+    const Eigen::Vector3d min_bound = pcd.GetMinBound();
+    const Eigen::Vector3d extent = pcd.GetMaxBound() - min_bound;
+    if (cell_size <= 0) {
+        // Aim for a few cells per thread, but keep the cells large compared
+        // to the margin so that the overlap stays a small fraction.
+        const int target_cells = 4 * utility::EstimateMaxThreads();
+        const Eigen::Vector3d clamped = extent.cwiseMax(max_radius);
+        cell_size = std::max(
+                std::cbrt(clamped.prod() / target_cells), 10 * margin);
+    }
+    const Eigen::Vector3i dims =
+            (extent / cell_size)
+                    .array()
+                    .floor()
+                    .cast<int>()
+                    .cwiseMax(0)
+                    .matrix() +
+            Eigen::Vector3i::Ones();
+    const int n_cells = dims.prod();
+    if (n_cells == 1) {
+        return CreateFromPointCloudBallPivoting(pcd, radii);
+    }
+
+    auto cell_coord = [&](double x, int dim) {
+        const int c = static_cast<int>(std::floor(x / cell_size));
+        return std::min(std::max(c, 0), dims(dim) - 1);
+    };
+    auto cell_index = [&](const Eigen::Vector3d& p) {
+        const Eigen::Vector3d q = p - min_bound;
+        return (cell_coord(q(2), 2) * dims(1) + cell_coord(q(1), 1)) *
+                       dims(0) +
+               cell_coord(q(0), 0);
+    };
+
+    std::vector<std::vector<size_t>> cell_points(n_cells);
+    for (size_t pidx = 0; pidx < pcd.points_.size(); ++pidx) {
+        const Eigen::Vector3d q = pcd.points_[pidx] - min_bound;
+        Eigen::Vector3i lo, hi;
+        for (int d = 0; d < 3; ++d) {
+            lo(d) = cell_coord(q(d) - margin, d);
+            hi(d) = cell_coord(q(d) + margin, d);
+        }
+        for (int z = lo(2); z <= hi(2); ++z) {
+            for (int y = lo(1); y <= hi(1); ++y) {
+                for (int x = lo(0); x <= hi(0); ++x) {
+                    cell_points[(z * dims(1) + y) * dims(0) + x].push_back(
+                            pidx);
+                }
+            }
+        }
+    }
+
+    std::vector<std::vector<Eigen::Vector3i>> cell_triangles(n_cells);
+    std::vector<std::vector<Eigen::Vector3d>> cell_centers(n_cells);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int cidx = 0; cidx < n_cells; ++cidx) {
+        const std::vector<size_t>& indices = cell_points[cidx];
+        if (indices.size() < 3) {
+            continue;
+        }
+        auto cell_pcd = pcd.SelectByIndex(indices);
+        BallPivoting bp(*cell_pcd);
+        auto cell_mesh = bp.Run(radii);
+        const std::vector<Eigen::Vector3d>& centers = bp.GetBallCenters();
+        for (size_t tidx = 0; tidx < cell_mesh->triangles_.size(); ++tidx) {
+            const Eigen::Vector3i& t = cell_mesh->triangles_[tidx];
+            Eigen::Vector3i triangle(int(indices[t(0)]), int(indices[t(1)]),
+                                     int(indices[t(2)]));
+            // Keep only the triangles owned by this cell.
+            const Eigen::Vector3d centroid = (pcd.points_[triangle(0)] +
+                                              pcd.points_[triangle(1)] +
+                                              pcd.points_[triangle(2)]) /
+                                             3.0;
+            if (cell_index(centroid) == cidx) {
+                cell_triangles[cidx].push_back(triangle);
+                cell_centers[cidx].push_back(centers[tidx]);
+            }
+        }
+    }
+
+    std::vector<Eigen::Vector3i> triangles;
+    std::vector<Eigen::Vector3d> centers;
+    for (int cidx = 0; cidx < n_cells; ++cidx) {
+        triangles.insert(triangles.end(), cell_triangles[cidx].begin(),
+                         cell_triangles[cidx].end());
+        centers.insert(centers.end(), cell_centers[cidx].begin(),
+                       cell_centers[cidx].end());
+    }
+    utility::LogDebug(
+            "[CreateFromPointCloudBallPivotingParallel] {:d} cells, {:d} "
+            "triangles before stitching",
+            n_cells, triangles.size());
+
+    BallPivoting bp(pcd);
+    return bp.Stitch(triangles, centers, radii);
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -31,6 +31,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <list>
+#include <mutex>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -419,6 +420,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
              size_t width,
              float scale,
              bool linear_fit,
+             const open3d::geometry::PoissonReconstructionOption& option,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -437,16 +439,16 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     xForm = XForm<Real, Dim + 1>::Identity();
 
     float datax = 32.f;
-    int base_depth = 0;
-    int base_v_cycles = 1;
-    float confidence = 0.f;
-    float point_weight = 2.f * DEFAULT_FEM_DEGREE;
+    int base_depth = option.base_depth_;
+    int base_v_cycles = option.base_v_cycles_;
+    float confidence = option.confidence_;
+    float point_weight = option.point_weight_;
     float confidence_bias = 0.f;
-    float samples_per_node = 1.5f;
-    float cg_solver_accuracy = 1e-3f;
-    int full_depth = 5;
-    int iters = 8;
-    bool exact_interpolation = false;
+    float samples_per_node = option.samples_per_node_;
+    float cg_solver_accuracy = option.cg_solver_accuracy_;
+    int full_depth = option.full_depth_;
+    int iters = option.iters_;
+    bool exact_interpolation = option.exact_interpolation_;
 
     double startTime = Time();
     Real isoValue = 0;
@@ -742,11 +744,13 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                                           size_t width,
                                           float scale,
                                           bool linear_fit,
-                                          int n_threads) {
+                                          int n_threads,
+                                          const PoissonReconstructionOption&
+                                                  option) {
     static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
             poisson::DIMENSION,
-            FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
+            FEMDegreeAndBType<poisson::DEFAULT_FEM_DEGREE, BType>::Signature>
             FEMSigs;
 
     if (!pcd.HasNormals()) {
@@ -757,6 +761,11 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
         n_threads = (int)std::thread::hardware_concurrency();
     }
 
+    // PoissonRecon keeps its thread pool and tree bookkeeping in global state,
+    // so concurrent reconstructions must not overlap.
+    static std::mutex poisson_mutex;
+    std::lock_guard<std::mutex> lock(poisson_mutex);
+
 #ifdef _OPENMP
     ThreadPool::Init((ThreadPool::ParallelType)(int)ThreadPool::OPEN_MP,
                      n_threads);
@@ -768,7 +777,7 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     auto mesh = std::make_shared<TriangleMesh>();
     std::vector<double> densities;
     poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+                            width, scale, linear_fit, option, FEMSigs());
 
     ThreadPool::Terminate();
 
@@ -44,6 +44,41 @@ namespace geometry {
 class PointCloud;
 class TetraMesh;
 
+/// \class PoissonReconstructionOption
+///
+/// \brief Octree and solver settings of
+/// TriangleMesh::CreateFromPointCloudPoisson. The defaults match the
+/// reference implementation.
+class PoissonReconstructionOption {
+public:
+    /// Minimum number of points that should fall within an octree node as the
+    /// octree construction is adapted to the sampling density. Use 1 to 5 for
+    /// noise-free samples and 15 to 20 for noisy ones.
+    float samples_per_node_ = 1.5f;
+    /// Importance of interpolating the point samples in the screened Poisson
+    /// equation. Set to 0 for the unscreened reconstruction.
+    float point_weight_ = 2.f;
+    /// Exponent of the normal length used as the sample confidence. 0 ignores
+    /// the normal lengths.
+    float confidence_ = 0.f;
+    /// Octree depth up to which the tree is complete. Coarser nodes are
+    /// solved densely regardless of the sampling density.
+    int full_depth_ = 5;
+    /// Coarsest depth of the multigrid solver. Below it the system is solved
+    /// directly.
+    int base_depth_ = 0;
+    /// Number of V-cycles at the base depth.
+    int base_v_cycles_ = 1;
+    /// Number of Gauss-Seidel relaxations per level.
+    int iters_ = 8;
+    /// Relative accuracy of the conjugate gradient solver at the coarsest
+    /// level.
+    float cg_solver_accuracy_ = 1e-3f;
+    /// If true, the point interpolation constraints are exact rather than
+    /// approximated with the B-spline basis. Slower, sometimes more accurate.
+    bool exact_interpolation_ = false;
+};
+
 /// \class TriangleMesh
 ///
 /// \brief Triangle mesh contains vertices and triangles represented by the
@@ -430,6 +465,25 @@ public:
             double maximum_error,
             double boundary_weight) const;
 
+    /// Parallel variant of SimplifyQuadricDecimation.
+    ///
+    /// Instead of collapsing one edge at a time from a global priority queue,
+    /// every vertex proposes its cheapest edge and each round collapses a set
+    /// of these edges whose neighborhoods do not overlap, giving cheaper
+    /// edges precedence. The result is comparable in quality but not
+    /// identical to SimplifyQuadricDecimation.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error defines the maximum error where a vertex is allowed
+    /// to be merged
+    /// \param boundary_weight a weight applied to edge vertices used to
+    /// preserve boundaries
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles,
+            double maximum_error,
+            double boundary_weight) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
@@ -534,6 +588,24 @@ public:
             std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
             std::vector<size_t> *pt_map = nullptr);
 
+    /// \brief Computes the alpha shapes of \p pcd for several alpha values,
+    /// e.g. to sweep alpha. The tetrahedralization, the circumradii of its
+    /// tetras and the face adjacency are computed once and shared by all the
+    /// alpha values, whose boundaries are then extracted in parallel.
+    /// \param pcd PointCloud for what the alpha shapes should be computed.
+    /// \param alphas parameters to control the shapes.
+    /// \param tetra_mesh If not a nullptr, then uses this to construct the
+    /// alpha shapes. Otherwise, ComputeDelaunayTetrahedralization is called.
+    /// \param pt_map Optional map from tetra_mesh vertex indices to pcd
+    /// points.
+    /// \return One TriangleMesh per alpha value, in the order of \p alphas.
+    static std::vector<std::shared_ptr<TriangleMesh>>
+    CreateFromPointCloudAlphaShapes(
+            const PointCloud &pcd,
+            const std::vector<double> &alphas,
+            std::shared_ptr<TetraMesh> tetra_mesh = nullptr,
+            std::vector<size_t> *pt_map = nullptr);
+
     /// Function that computes a triangle mesh from an oriented PointCloud \p
     /// pcd. This implements the Ball Pivoting algorithm proposed in F.
     /// Bernardini et al., "The ball-pivoting algorithm for surface
@@ -550,6 +622,24 @@ public:
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
             const PointCloud &pcd, const std::vector<double> &radii);
 
+    /// Parallel variant of CreateFromPointCloudBallPivoting for large point
+    /// clouds. The bounding box of \p pcd is split into cells that are
+    /// reconstructed independently, each together with an overlapping margin
+    /// of three times the largest radius. Every triangle is kept by the cell
+    /// that contains its centroid, and the merged triangles are stitched by
+    /// pivoting the ball over the remaining open edges. The result is close to
+    /// but not identical to the serial reconstruction.
+    /// \param pcd defines the PointCloud from which the TriangleMesh surface is
+    /// reconstructed. Has to contain normals.
+    /// \param radii defines the radii of the ball that are used for the
+    /// surface reconstruction.
+    /// \param cell_size defines the edge length of the cells. If not positive,
+    /// it is chosen from the extent of \p pcd and the number of threads.
+    static std::shared_ptr<TriangleMesh>
+    CreateFromPointCloudBallPivotingParallel(const PointCloud &pcd,
+                                             const std::vector<double> &radii,
+                                             double cell_size = 0.0);
+
     /// \brief Function that computes a triangle mesh from an oriented
     /// PointCloud pcd. This implements the Screened Poisson Reconstruction
     /// proposed in Kazhdan and Hoppe, "Screened Poisson Surface
@@ -571,6 +661,7 @@ public:
     /// linear interpolation to estimate the positions of iso-vertices.
     /// \param n_threads Number of threads used for reconstruction. Set to -1
     /// to automatically determine it.
+    /// \param option Octree and solver settings.
     /// \return The estimated TriangleMesh, and per vertex densitie values that
     /// can be used to to trim the mesh.
     static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -579,7 +670,9 @@ public:
                                 size_t width = 0,
                                 float scale = 1.1f,
                                 bool linear_fit = false,
-                                int n_threads = -1);
+                                int n_threads = -1,
+                                const PoissonReconstructionOption &option =
+                                        PoissonReconstructionOption());
 
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \p radius defines the
@@ -44,25 +44,39 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
     auto prime = std::make_shared<TriangleMesh>();
     prime->vertices_ = this->vertices_;
     prime->triangles_ = this->triangles_;
+    const int num_vertices = int(vertices_.size());
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
     prime->ComputeAdjacencyList();
     auto edges_to_vertices = prime->GetEdgeToVerticesMap();
     auto edge_weights =
             prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
+
+    // Flatten the adjacency with the edge weights, so that the iterations do
+    // not look up edges in hash maps.
+    std::vector<int> nb_offsets(num_vertices + 1, 0);
+    std::vector<int> nbs;
+    std::vector<double> nb_weights;
+    for (int i = 0; i < num_vertices; ++i) {
+        for (int j : prime->adjacency_list_[i]) {
+            nbs.push_back(j);
+            nb_weights.push_back(edge_weights[GetOrderedEdge(i, j)]);
+        }
+        nb_offsets[i + 1] = int(nbs.size());
+    }
     utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
 
-    std::unordered_map<int, Eigen::Vector3d> constraints;
+    std::vector<bool> is_constrained(num_vertices, false);
+    std::vector<Eigen::Vector3d> constraint_positions(num_vertices);
     for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
                          idx < constraint_vertex_positions.size();
          ++idx) {
-        constraints[constraint_vertex_indices[idx]] =
+        is_constrained[constraint_vertex_indices[idx]] = true;
+        constraint_positions[constraint_vertex_indices[idx]] =
                 constraint_vertex_positions[idx];
     }
 
     double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
     std::vector<Eigen::Matrix3d> Rs(vertices_.size());
     std::vector<Eigen::Matrix3d> Rs_old;
     if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
@@ -70,33 +84,51 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
         Rs_old.resize(vertices_.size());
     }
 
-    // Build system matrix L and its solver
+    // The constrained vertices are eliminated from the system, which leaves
+    // the symmetric positive definite Laplacian of the free vertices. It only
+    // depends on which vertices are constrained, so it is factorized once
+    // with a Cholesky decomposition; the constraint positions move to the
+    // right hand side.
     utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
+    std::vector<int> free_index(num_vertices, -1);
+    int num_free = 0;
+    for (int i = 0; i < num_vertices; ++i) {
+        if (!is_constrained[i]) {
+            free_index[i] = num_free++;
+        }
+    }
     std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
-        } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+    Eigen::MatrixX3d b_constraints = Eigen::MatrixX3d::Zero(num_free, 3);
+    for (int i = 0; i < num_vertices; ++i) {
+        if (is_constrained[i]) {
+            continue;
+        }
+        double W = 0;
+        for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+            const int j = nbs[k];
+            const double w = nb_weights[k];
+            if (is_constrained[j]) {
+                b_constraints.row(free_index[i]) +=
+                        w * constraint_positions[j].transpose();
+            } else {
+                triplets.push_back(Eigen::Triplet<double>(
+                        free_index[i], free_index[j], -w));
             }
+            W += w;
+        }
+        if (W > 0) {
+            triplets.push_back(
+                    Eigen::Triplet<double>(free_index[i], free_index[i], W));
         }
     }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
+    Eigen::SparseMatrix<double> L(num_free, num_free);
     L.setFromTriplets(triplets.begin(), triplets.end());
     utility::LogDebug(
             "[DeformAsRigidAsPossible] done setting up system matrix L");
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver;
+    solver.compute(L);
     if (solver.info() != Eigen::Success) {
         utility::LogError(
                 "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
@@ -105,9 +137,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
                 "[DeformAsRigidAsPossible] done setting up sparse solver");
     }
 
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
+    const bool log_energy =
+            utility::GetVerbosityLevel() >= utility::VerbosityLevel::Debug;
+    Eigen::MatrixX3d b(num_free, 3);
     for (size_t iter = 0; iter < max_iter; ++iter) {
         if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
             std::swap(Rs, Rs_old);
@@ -115,20 +147,19 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
 
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int i = 0; i < num_vertices; ++i) {
             // Update rotations
             Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
             Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
-            int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
+            const int n_nbs = nb_offsets[i + 1] - nb_offsets[i];
+            for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+                const int j = nbs[k];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                S += w * (e0 * e1.transpose());
+                S += nb_weights[k] * (e0 * e1.transpose());
                 if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
                     R += Rs_old[j];
                 }
-                n_nbs++;
             }
             if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed &&
                 iter > 0 && n_nbs > 0) {
@@ -152,45 +183,50 @@ std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
 
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int i = 0; i < num_vertices; ++i) {
             // Update Positions
+            if (is_constrained[i]) {
+                continue;
+            }
             Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
-            } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
-                    bi += w / 2 *
-                          ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
-                }
+            for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+                const int j = nbs[k];
+                bi += nb_weights[k] / 2 *
+                      ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
             }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
+            b.row(free_index[i]) =
+                    bi.transpose() + b_constraints.row(free_index[i]);
         }
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
         for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
+            Eigen::VectorXd p_prime = solver.solve(b.col(comp));
             if (solver.info() != Eigen::Success) {
                 utility::LogError(
                         "[DeformAsRigidAsPossible] Cholesky solve failed");
             }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
+            for (int i = 0; i < num_vertices; ++i) {
+                prime->vertices_[i](comp) =
+                        is_constrained[i] ? constraint_positions[i](comp)
+                                          : p_prime(free_index[i]);
             }
         }
 
         // Compute energy and log
+        if (!log_energy) {
+            continue;
+        }
         double energy = 0;
         double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
+#pragma omp parallel for schedule(static) reduction(+ : energy, reg) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < num_vertices; ++i) {
+            for (int k = nb_offsets[i]; k < nb_offsets[i + 1]; ++k) {
+                const int j = nbs[k];
                 Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
                 Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
                 Eigen::Vector3d diff = e1 - Rs[i] * e0;
-                energy += w * diff.squaredNorm();
+                energy += nb_weights[k] * diff.squaredNorm();
                 if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
                     reg += (Rs[i] - Rs[j]).squaredNorm();
                 }
@@ -25,11 +25,15 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <queue>
 #include <tuple>
 
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -88,6 +92,191 @@ public:
     double c_;
 };
 
+// Computes the per-vertex error quadrics from the triangle planes, weighted by
+// the triangle areas. Boundary edges additionally contribute a plane
+// perpendicular to the adjacent triangle, weighted by boundary_weight.
+static std::vector<Quadric> ComputeVertexQuadrics(const TriangleMesh& mesh,
+                                                  double boundary_weight) {
+    const auto& vertices = mesh.vertices_;
+    const auto& triangles = mesh.triangles_;
+
+    std::vector<std::vector<int>> vert_to_triangles(vertices.size());
+    for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+        vert_to_triangles[triangles[tidx](0)].push_back(int(tidx));
+        vert_to_triangles[triangles[tidx](1)].push_back(int(tidx));
+        vert_to_triangles[triangles[tidx](2)].push_back(int(tidx));
+    }
+    std::vector<Eigen::Vector4d> triangle_planes(triangles.size());
+    std::vector<double> triangle_areas(triangles.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        triangle_planes[tidx] = mesh.GetTrianglePlane(tidx);
+        triangle_areas[tidx] = mesh.GetTriangleArea(tidx);
+    }
+
+    std::vector<Quadric> Qs(vertices.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(vertices.size()); ++vidx) {
+        for (int tidx : vert_to_triangles[vidx]) {
+            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
+        }
+    }
+
+    // For boundary edges add perpendicular plane quadric
+    auto edge_triangle_count = mesh.GetEdgeToTrianglesMap();
+    auto AddPerpPlaneQuadric = [&](int vidx0, int vidx1, int vidx2,
+                                   double area) {
+        int min = std::min(vidx0, vidx1);
+        int max = std::max(vidx0, vidx1);
+        Eigen::Vector2i edge(min, max);
+        if (edge_triangle_count[edge].size() != 1) {
+            return;
+        }
+        const auto& vert0 = vertices[vidx0];
+        const auto& vert1 = vertices[vidx1];
+        const auto& vert2 = vertices[vidx2];
+        Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
+        Eigen::Vector4d plane =
+                TriangleMesh::ComputeTrianglePlane(vert0, vert1, vert2p);
+        Quadric quad(plane, area * boundary_weight);
+        Qs[vidx0] += quad;
+        Qs[vidx1] += quad;
+    };
+    for (size_t tidx = 0; tidx < triangles.size(); ++tidx) {
+        const auto& tria = triangles[tidx];
+        double area = triangle_areas[tidx];
+        AddPerpPlaneQuadric(tria(0), tria(1), tria(2), area);
+        AddPerpPlaneQuadric(tria(1), tria(2), tria(0), area);
+        AddPerpPlaneQuadric(tria(2), tria(0), tria(1), area);
+    }
+    return Qs;
+}
+
+// Returns the cost of collapsing the edge (v0, v1) and the optimal position of
+// the merged vertex in vbar.
+static double ComputeEdgeCollapseCost(const Quadric& Q0,
+                                      const Quadric& Q1,
+                                      const Eigen::Vector3d& v0,
+                                      const Eigen::Vector3d& v1,
+                                      Eigen::Vector3d& vbar) {
+    Quadric Qbar = Q0 + Q1;
+    double cost;
+    if (Qbar.IsInvertible()) {
+        vbar = Qbar.Minimum();
+        cost = Qbar.Eval(vbar);
+    } else {
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+    }
+    return cost;
+}
+
+// Returns true if moving vertex vidx1 of the triangles in tidxs to vbar flips
+// the normal of any triangle that does not also contain vidx0.
+template <typename TriangleIndices>
+static bool CollapseFlipsTriangle(const TriangleMesh& mesh,
+                                  const TriangleIndices& tidxs,
+                                  const std::vector<char>& triangles_deleted,
+                                  int vidx0,
+                                  int vidx1,
+                                  const Eigen::Vector3d& vbar) {
+    for (int tidx : tidxs) {
+        if (triangles_deleted[tidx]) {
+            continue;
+        }
+
+        const Eigen::Vector3i& tria = mesh.triangles_[tidx];
+        bool has_vidx0 =
+                vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2);
+        bool has_vidx1 =
+                vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2);
+        if (has_vidx0 && has_vidx1) {
+            continue;
+        }
+
+        Eigen::Vector3d vert0 = mesh.vertices_[tria(0)];
+        Eigen::Vector3d vert1 = mesh.vertices_[tria(1)];
+        Eigen::Vector3d vert2 = mesh.vertices_[tria(2)];
+        Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
+        norm_before /= norm_before.norm();
+
+        if (vidx1 == tria(0)) {
+            vert0 = vbar;
+        } else if (vidx1 == tria(1)) {
+            vert1 = vbar;
+        } else if (vidx1 == tria(2)) {
+            vert2 = vbar;
+        }
+
+        Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
+        norm_after /= norm_after.norm();
+        if (norm_before.dot(norm_after) < 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Removes the deleted vertices and triangles from the decimated mesh and
+// remaps the triangle indices accordingly.
+static void CompactDecimatedMesh(TriangleMesh& mesh,
+                                 const std::vector<char>& vertices_deleted,
+                                 const std::vector<char>& triangles_deleted,
+                                 bool recompute_triangle_normals) {
+    bool has_vert_normal = mesh.HasVertexNormals();
+    bool has_vert_color = mesh.HasVertexColors();
+    int next_free = 0;
+    std::vector<int> vert_remapping(mesh.vertices_.size(), -1);
+    for (size_t idx = 0; idx < mesh.vertices_.size(); ++idx) {
+        if (!vertices_deleted[idx]) {
+            vert_remapping[idx] = next_free;
+            mesh.vertices_[next_free] = mesh.vertices_[idx];
+            if (has_vert_normal) {
+                mesh.vertex_normals_[next_free] = mesh.vertex_normals_[idx];
+            }
+            if (has_vert_color) {
+                mesh.vertex_colors_[next_free] = mesh.vertex_colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    mesh.vertices_.resize(next_free);
+    if (has_vert_normal) {
+        mesh.vertex_normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        mesh.vertex_colors_.resize(next_free);
+    }
+
+    next_free = 0;
+    for (size_t idx = 0; idx < mesh.triangles_.size(); ++idx) {
+        if (!triangles_deleted[idx]) {
+            Eigen::Vector3i tria = mesh.triangles_[idx];
+            mesh.triangles_[next_free](0) = vert_remapping[tria(0)];
+            mesh.triangles_[next_free](1) = vert_remapping[tria(1)];
+            mesh.triangles_[next_free](2) = vert_remapping[tria(2)];
+            next_free++;
+        }
+    }
+    mesh.triangles_.resize(next_free);
+
+    if (recompute_triangle_normals) {
+        mesh.ComputeTriangleNormals();
+    }
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         SimplificationContraction
@@ -279,56 +468,19 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     mesh->vertex_colors_ = vertex_colors_;
     mesh->triangles_ = triangles_;
 
-    std::vector<bool> vertices_deleted(vertices_.size(), false);
-    std::vector<bool> triangles_deleted(triangles_.size(), false);
+    std::vector<char> vertices_deleted(vertices_.size(), 0);
+    std::vector<char> triangles_deleted(triangles_.size(), 0);
 
-    // Map vertices to triangles and compute triangle planes and areas
+    // Map vertices to triangles
     std::vector<std::unordered_set<int>> vert_to_triangles(vertices_.size());
-    std::vector<Eigen::Vector4d> triangle_planes(triangles_.size());
-    std::vector<double> triangle_areas(triangles_.size());
     for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
         vert_to_triangles[triangles_[tidx](0)].emplace(static_cast<int>(tidx));
         vert_to_triangles[triangles_[tidx](1)].emplace(static_cast<int>(tidx));
         vert_to_triangles[triangles_[tidx](2)].emplace(static_cast<int>(tidx));
-
-        triangle_planes[tidx] = GetTrianglePlane(tidx);
-        triangle_areas[tidx] = GetTriangleArea(tidx);
     }
 
     // Compute the error metric per vertex
-    std::vector<Quadric> Qs(vertices_.size());
-    for (size_t vidx = 0; vidx < vertices_.size(); ++vidx) {
-        for (int tidx : vert_to_triangles[vidx]) {
-            Qs[vidx] += Quadric(triangle_planes[tidx], triangle_areas[tidx]);
-        }
-    }
-
-    // For boundary edges add perpendicular plane quadric
-    auto edge_triangle_count = GetEdgeToTrianglesMap();
-    auto AddPerpPlaneQuadric = [&](int vidx0, int vidx1, int vidx2,
-                                   double area) {
-        int min = std::min(vidx0, vidx1);
-        int max = std::max(vidx0, vidx1);
-        Eigen::Vector2i edge(min, max);
-        if (edge_triangle_count[edge].size() != 1) {
-            return;
-        }
-        const auto& vert0 = mesh->vertices_[vidx0];
-        const auto& vert1 = mesh->vertices_[vidx1];
-        const auto& vert2 = mesh->vertices_[vidx2];
-        Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
-        Eigen::Vector4d plane = ComputeTrianglePlane(vert0, vert1, vert2p);
-        Quadric quad(plane, area * boundary_weight);
-        Qs[vidx0] += quad;
-        Qs[vidx1] += quad;
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        double area = triangle_areas[tidx];
-        AddPerpPlaneQuadric(tria(0), tria(1), tria(2), area);
-        AddPerpPlaneQuadric(tria(1), tria(2), tria(0), area);
-        AddPerpPlaneQuadric(tria(2), tria(0), tria(1), area);
-    }
+    std::vector<Quadric> Qs = ComputeVertexQuadrics(*this, boundary_weight);
 
     // Get valid edges and compute cost
     // Note: We could also select all vertex pairs as edges with dist < eps
@@ -349,30 +501,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
         int max = std::max(vidx0, vidx1);
         Eigen::Vector2i edge(min, max);
         if (update || vbars.count(edge) == 0) {
-            const Quadric& Q0 = Qs[min];
-            const Quadric& Q1 = Qs[max];
-            Quadric Qbar = Q0 + Q1;
-            double cost;
             Eigen::Vector3d vbar;
-            if (Qbar.IsInvertible()) {
-                vbar = Qbar.Minimum();
-                cost = Qbar.Eval(vbar);
-            } else {
-                const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
-                const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
-                Eigen::Vector3d vmid = (v0 + v1) / 2;
-                double cost0 = Qbar.Eval(v0);
-                double cost1 = Qbar.Eval(v1);
-                double costmid = Qbar.Eval(vmid);
-                cost = std::min(cost0, std::min(cost1, costmid));
-                if (cost == costmid) {
-                    vbar = vmid;
-                } else if (cost == cost0) {
-                    vbar = v0;
-                } else {
-                    vbar = v1;
-                }
-            }
+            double cost = ComputeEdgeCollapseCost(
+                    Qs[min], Qs[max], mesh->vertices_[vidx0],
+                    mesh->vertices_[vidx1], vbar);
             vbars[edge] = vbar;
             costs[edge] = cost;
             queue.push(CostEdge(cost, min, max));
@@ -410,43 +542,9 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
         }
 
         // avoid flip of triangle normal
-        bool flipped = false;
-        for (int tidx : vert_to_triangles[vidx1]) {
-            if (triangles_deleted[tidx]) {
-                continue;
-            }
-
-            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
-            bool has_vidx0 =
-                    vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2);
-            bool has_vidx1 =
-                    vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2);
-            if (has_vidx0 && has_vidx1) {
-                continue;
-            }
-
-            Eigen::Vector3d vert0 = mesh->vertices_[tria(0)];
-            Eigen::Vector3d vert1 = mesh->vertices_[tria(1)];
-            Eigen::Vector3d vert2 = mesh->vertices_[tria(2)];
-            Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
-            norm_before /= norm_before.norm();
-
-            if (vidx1 == tria(0)) {
-                vert0 = vbars[edge];
-            } else if (vidx1 == tria(1)) {
-                vert1 = vbars[edge];
-            } else if (vidx1 == tria(2)) {
-                vert2 = vbars[edge];
-            }
-
-            Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
-            norm_after /= norm_after.norm();
-            if (norm_before.dot(norm_after) < 0) {
-                flipped = true;
-                break;
-            }
-        }
-        if (flipped) {
+        if (CollapseFlipsTriangle(*mesh, vert_to_triangles[vidx1],
+                                  triangles_deleted, vidx0, vidx1,
+                                  vbars[edge])) {
             continue;
         }
 
@@ -463,7 +561,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
                     vidx1 == tria(0) || vidx1 == tria(1) || vidx1 == tria(2);
 
             if (has_vidx0 && has_vidx1) {
-                triangles_deleted[tidx] = true;
+                triangles_deleted[tidx] = 1;
                 n_triangles--;
                 continue;
             }
@@ -489,7 +587,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
             mesh->vertex_colors_[vidx0] = 0.5 * (mesh->vertex_colors_[vidx0] +
                                                  mesh->vertex_colors_[vidx1]);
         }
-        vertices_deleted[vidx1] = true;
+        vertices_deleted[vidx1] = 1;
 
         // Update edge costs for all triangles connecting to vidx0
         for (const auto& tidx : vert_to_triangles[vidx0]) {
@@ -510,45 +608,237 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     }
 
     // Apply changes to the triangle mesh
-    int next_free = 0;
-    std::unordered_map<int, int> vert_remapping;
-    for (size_t idx = 0; idx < mesh->vertices_.size(); ++idx) {
-        if (!vertices_deleted[idx]) {
-            vert_remapping[int(idx)] = next_free;
-            mesh->vertices_[next_free] = mesh->vertices_[idx];
-            if (has_vert_normal) {
-                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+    CompactDecimatedMesh(*mesh, vertices_deleted, triangles_deleted,
+                         HasTriangleNormals());
+
+    return mesh;
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles,
+        double maximum_error = std::numeric_limits<double>::infinity(),
+        double boundary_weight = 1.0) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimationParallel] This mesh contains "
+                "triangle uvs that are not handled in this function");
+    }
+    struct Collapse {
+        double cost;
+        int vidx0;
+        int vidx1;
+        Eigen::Vector3d vbar;
+    };
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+
+    const int num_vertices = int(vertices_.size());
+    std::vector<char> vertices_deleted(num_vertices, 0);
+    std::vector<char> triangles_deleted(triangles_.size(), 0);
+
+    // Map vertices to triangles. Entries of deleted triangles are skipped
+    // rather than erased.
+    std::vector<std::vector<int>> vert_to_triangles(num_vertices);
+    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
+        vert_to_triangles[triangles_[tidx](0)].push_back(int(tidx));
+        vert_to_triangles[triangles_[tidx](1)].push_back(int(tidx));
+        vert_to_triangles[triangles_[tidx](2)].push_back(int(tidx));
+    }
+
+    // Compute the error metric per vertex
+    std::vector<Quadric> Qs = ComputeVertexQuadrics(*this, boundary_weight);
+
+    // Calls func(vidx) for every vertex of the live triangles around the
+    // edge, i.e. the vertices a collapse of the edge reads or writes.
+    auto ForEachEdgeNeighbor = [&](int vidx0, int vidx1, auto func) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (int tidx : vert_to_triangles[vidx]) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                func(tria(0));
+                func(tria(1));
+                func(tria(2));
             }
-            if (has_vert_color) {
-                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+        }
+    };
+
+    // Lowers the owner of vertex vidx to rank.
+    std::vector<std::atomic<int>> owners(num_vertices);
+    auto ClaimVertex = [&](int vidx, int rank) {
+        int owner = owners[vidx].load();
+        while (rank < owner &&
+               !owners[vidx].compare_exchange_weak(owner, rank)) {
+        }
+    };
+
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    int n_triangles = int(triangles_.size());
+    std::vector<Collapse> best(num_vertices);
+    std::vector<Collapse> candidates;
+    std::vector<char> selected;
+    while (n_triangles > target_number_of_triangles) {
+        // Every vertex proposes its cheapest incident edge.
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            best[vidx].cost = std::numeric_limits<double>::infinity();
+            if (vertices_deleted[vidx]) {
+                continue;
+            }
+            for (int tidx : vert_to_triangles[vidx]) {
+                if (triangles_deleted[tidx]) {
+                    continue;
+                }
+                const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                for (int k = 0; k < 3; ++k) {
+                    int nb = tria(k);
+                    if (nb == vidx) {
+                        continue;
+                    }
+                    int min = std::min(vidx, nb);
+                    int max = std::max(vidx, nb);
+                    Eigen::Vector3d vbar;
+                    double cost = ComputeEdgeCollapseCost(
+                            Qs[min], Qs[max], mesh->vertices_[min],
+                            mesh->vertices_[max], vbar);
+                    if (cost < best[vidx].cost) {
+                        best[vidx] = {cost, min, max, vbar};
+                    }
+                }
             }
-            next_free++;
         }
-    }
-    mesh->vertices_.resize(next_free);
-    if (has_vert_normal) {
-        mesh->vertex_normals_.resize(next_free);
-    }
-    if (has_vert_color) {
-        mesh->vertex_colors_.resize(next_free);
-    }
 
-    next_free = 0;
-    for (size_t idx = 0; idx < mesh->triangles_.size(); ++idx) {
-        if (!triangles_deleted[idx]) {
-            Eigen::Vector3i tria = mesh->triangles_[idx];
-            mesh->triangles_[next_free](0) = vert_remapping[tria(0)];
-            mesh->triangles_[next_free](1) = vert_remapping[tria(1)];
-            mesh->triangles_[next_free](2) = vert_remapping[tria(2)];
-            next_free++;
+        candidates.clear();
+        for (const Collapse& collapse : best) {
+            if (collapse.cost <= maximum_error) {
+                candidates.push_back(collapse);
+            }
         }
-    }
-    mesh->triangles_.resize(next_free);
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Collapse& a, const Collapse& b) {
+                      return std::tie(a.cost, a.vidx0, a.vidx1) <
+                             std::tie(b.cost, b.vidx0, b.vidx1);
+                  });
+
+        // Each collapse removes about two triangles, so do not take more
+        // candidates than needed to reach the target. If every collapse of
+        // a window is rejected, move on to the next window.
+        const int budget =
+                std::max(1, (n_triangles - target_number_of_triangles) / 2);
+        int n_collapsed = 0;
+        for (int begin = 0; begin < int(candidates.size()) && n_collapsed == 0;
+             begin += budget) {
+            const int end = std::min(begin + budget, int(candidates.size()));
+
+            // Cheaper collapses claim their neighborhood first. A collapse is
+            // applied only if it owns its whole neighborhood, so all applied
+            // collapses of a round touch disjoint sets of vertices and
+            // triangles.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int vidx = 0; vidx < num_vertices; ++vidx) {
+                owners[vidx].store(std::numeric_limits<int>::max());
+            }
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int rank = begin; rank < end; ++rank) {
+                ForEachEdgeNeighbor(
+                        candidates[rank].vidx0, candidates[rank].vidx1,
+                        [&](int vidx) { ClaimVertex(vidx, rank); });
+            }
+            selected.assign(end - begin, 1);
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int rank = begin; rank < end; ++rank) {
+                ForEachEdgeNeighbor(
+                        candidates[rank].vidx0, candidates[rank].vidx1,
+                        [&](int vidx) {
+                            if (owners[vidx].load() != rank) {
+                                selected[rank - begin] = 0;
+                            }
+                        });
+            }
 
-    if (HasTriangleNormals()) {
-        mesh->ComputeTriangleNormals();
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads()) \
+        reduction(+ : n_triangles, n_collapsed)
+            for (int rank = begin; rank < end; ++rank) {
+                if (!selected[rank - begin]) {
+                    continue;
+                }
+                const Collapse& collapse = candidates[rank];
+                const int vidx0 = collapse.vidx0;
+                const int vidx1 = collapse.vidx1;
+
+                // avoid flip of triangle normal
+                if (CollapseFlipsTriangle(*mesh, vert_to_triangles[vidx1],
+                                          triangles_deleted, vidx0, vidx1,
+                                          collapse.vbar)) {
+                    continue;
+                }
+
+                // Connect triangles from vidx1 to vidx0, or mark deleted
+                for (int tidx : vert_to_triangles[vidx1]) {
+                    if (triangles_deleted[tidx]) {
+                        continue;
+                    }
+
+                    Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    bool has_vidx0 = vidx0 == tria(0) || vidx0 == tria(1) ||
+                                     vidx0 == tria(2);
+                    if (has_vidx0) {
+                        triangles_deleted[tidx] = 1;
+                        n_triangles--;
+                        continue;
+                    }
+
+                    if (vidx1 == tria(0)) {
+                        tria(0) = vidx0;
+                    } else if (vidx1 == tria(1)) {
+                        tria(1) = vidx0;
+                    } else if (vidx1 == tria(2)) {
+                        tria(2) = vidx0;
+                    }
+                    vert_to_triangles[vidx0].push_back(tidx);
+                }
+
+                // update vertex vidx0 to vbar
+                mesh->vertices_[vidx0] = collapse.vbar;
+                Qs[vidx0] += Qs[vidx1];
+                if (has_vert_normal) {
+                    mesh->vertex_normals_[vidx0] =
+                            0.5 * (mesh->vertex_normals_[vidx0] +
+                                   mesh->vertex_normals_[vidx1]);
+                }
+                if (has_vert_color) {
+                    mesh->vertex_colors_[vidx0] =
+                            0.5 * (mesh->vertex_colors_[vidx0] +
+                                   mesh->vertex_colors_[vidx1]);
+                }
+                vertices_deleted[vidx1] = 1;
+                n_collapsed++;
+            }
+        }
+        utility::LogDebug(
+                "[SimplifyQuadricDecimationParallel] Collapsed {:d} of {:d} "
+                "candidate edges, {:d} triangles left.",
+                n_collapsed, candidates.size(), n_triangles);
+        if (n_collapsed == 0) {
+            break;
+        }
     }
 
+    // Apply changes to the triangle mesh
+    CompactDecimatedMesh(*mesh, vertices_deleted, triangles_deleted,
+                         HasTriangleNormals());
+
     return mesh;
 }
 
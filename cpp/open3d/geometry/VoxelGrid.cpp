@@ -35,6 +35,7 @@
 #include "open3d/geometry/Octree.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -213,15 +214,15 @@ void VoxelGrid::AddVoxel(const Voxel &voxel) {
 
 std::vector<bool> VoxelGrid::CheckIfIncluded(
         const std::vector<Eigen::Vector3d> &queries) {
-    std::vector<bool> output;
-    output.resize(queries.size());
-    size_t i = 0;
-    for (auto &query_double : queries) {
-        auto query = GetVoxel(query_double);
-        output[i] = voxels_.count(query) > 0;
-        i++;
+    // Lookups are read-only and run in parallel. std::vector<bool> packs bits,
+    // so threads write bytes first.
+    std::vector<uint8_t> included(queries.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < (int64_t)queries.size(); i++) {
+        included[i] = voxels_.count(GetVoxel(queries[i])) > 0;
     }
-    return output;
+    return std::vector<bool>(included.begin(), included.end());
 }
 
 void VoxelGrid::CreateFromOctree(const Octree &octree) {
@@ -24,7 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <numeric>
+#include <tuple>
 #include <unordered_map>
 
 #include "open3d/geometry/IntersectionTest.h"
@@ -33,6 +36,7 @@
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -76,29 +80,64 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudWithinBounds(
     }
     output->voxel_size_ = voxel_size;
     output->origin_ = min_bound;
-    std::unordered_map<Eigen::Vector3i, AvgColorVoxel,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    bool has_colors = input.HasColors();
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        ref_coord = (input.points_[i] - min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        if (has_colors) {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index,
-                                                    input.colors_[i]);
-        } else {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index);
+
+    // Sort (voxel index, point index) pairs in parallel instead of inserting
+    // into a map point by point. Ties are broken by point index, so colors are
+    // accumulated in input order.
+    struct VoxelPoint {
+        Eigen::Vector3i voxel_index;
+        int point_index;
+        bool operator<(const VoxelPoint &other) const {
+            return std::tie(voxel_index(0), voxel_index(1), voxel_index(2),
+                            point_index) <
+                   std::tie(other.voxel_index(0), other.voxel_index(1),
+                            other.voxel_index(2), other.point_index);
+        }
+    };
+    const int num_points = (int)input.points_.size();
+    std::vector<VoxelPoint> voxel_points(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_points; i++) {
+        const Eigen::Vector3d ref_coord =
+                (input.points_[i] - min_bound) / voxel_size;
+        voxel_points[i].voxel_index << int(floor(ref_coord(0))),
+                int(floor(ref_coord(1))), int(floor(ref_coord(2)));
+        voxel_points[i].point_index = i;
+    }
+    tbb::parallel_sort(voxel_points.begin(), voxel_points.end());
+
+    std::vector<int> run_begins;
+    for (int i = 0; i < num_points; i++) {
+        if (i == 0 || voxel_points[i].voxel_index !=
+                              voxel_points[i - 1].voxel_index) {
+            run_begins.push_back(i);
         }
     }
-    for (auto accpoint : voxelindex_to_accpoint) {
-        const Eigen::Vector3i &grid_index = accpoint.second.GetVoxelIndex();
-        const Eigen::Vector3d &color =
-                has_colors ? accpoint.second.GetAverageColor()
-                           : Eigen::Vector3d(0, 0, 0);
-        output->AddVoxel(geometry::Voxel(grid_index, color));
+    run_begins.push_back(num_points);
+
+    const bool has_colors = input.HasColors();
+    const int num_voxels = (int)run_begins.size() - 1;
+    std::vector<Voxel> voxels(num_voxels);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int v = 0; v < num_voxels; v++) {
+        AvgColorVoxel accpoint;
+        for (int i = run_begins[v]; i < run_begins[v + 1]; i++) {
+            if (has_colors) {
+                accpoint.Add(voxel_points[i].voxel_index,
+                             input.colors_[voxel_points[i].point_index]);
+            } else {
+                accpoint.Add(voxel_points[i].voxel_index);
+            }
+        }
+        const Eigen::Vector3d color = has_colors ? accpoint.GetAverageColor()
+                                                 : Eigen::Vector3d(0, 0, 0);
+        voxels[v] = Voxel(accpoint.GetVoxelIndex(), color);
+    }
+    output->voxels_.reserve(num_voxels);
+    for (const Voxel &voxel : voxels) {
+        output->AddVoxel(voxel);
     }
     utility::LogDebug(
             "Pointcloud is voxelized from {:d} points to {:d} voxels.",
@@ -133,30 +172,54 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
     output->origin_ = min_bound;
 
     Eigen::Vector3d grid_size = max_bound - min_bound;
-    int num_w = int(std::round(grid_size(0) / voxel_size));
-    int num_h = int(std::round(grid_size(1) / voxel_size));
-    int num_d = int(std::round(grid_size(2) / voxel_size));
+    const Eigen::Vector3i num_voxels =
+            (grid_size / voxel_size).array().round().cast<int>();
     const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
                                         voxel_size / 2);
-    for (int widx = 0; widx < num_w; widx++) {
-        for (int hidx = 0; hidx < num_h; hidx++) {
-            for (int didx = 0; didx < num_d; didx++) {
-                const Eigen::Vector3d box_center =
-                        min_bound +
-                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
-                for (const Eigen::Vector3i &tria : input.triangles_) {
-                    const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
-                    const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
-                    const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
-                    if (IntersectionTest::TriangleAABB(
-                                box_center, box_half_size, v0, v1, v2)) {
-                        Eigen::Vector3i grid_index(widx, hidx, didx);
-                        output->AddVoxel(geometry::Voxel(grid_index));
-                        break;
+
+    // Only test the voxels overlapping the bounding box of each triangle, with
+    // one voxel of margin, instead of every triangle against every voxel.
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<Eigen::Vector3i> found;
+#pragma omp for schedule(dynamic)
+        for (int t = 0; t < (int)input.triangles_.size(); t++) {
+            const Eigen::Vector3i &tria = input.triangles_[t];
+            const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
+            const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
+            const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
+            const Eigen::Vector3d tria_min =
+                    (v0.cwiseMin(v1).cwiseMin(v2) - min_bound) / voxel_size;
+            const Eigen::Vector3d tria_max =
+                    (v0.cwiseMax(v1).cwiseMax(v2) - min_bound) / voxel_size;
+            Eigen::Vector3i begin, end;
+            for (int d = 0; d < 3; d++) {
+                // Clamp in double, the triangle may lie far outside of the
+                // bounds.
+                const double n = num_voxels(d);
+                begin(d) = int(std::min(
+                        std::max(std::floor(tria_min(d)) - 1, 0.0), n));
+                end(d) = int(std::min(std::max(std::ceil(tria_max(d)) + 2, 0.0),
+                                      n));
+            }
+            for (int widx = begin(0); widx < end(0); widx++) {
+                for (int hidx = begin(1); hidx < end(1); hidx++) {
+                    for (int didx = begin(2); didx < end(2); didx++) {
+                        const Eigen::Vector3d box_center =
+                                min_bound + Eigen::Vector3d(widx, hidx, didx) *
+                                                    voxel_size;
+                        if (IntersectionTest::TriangleAABB(
+                                    box_center, box_half_size, v0, v1, v2)) {
+                            found.emplace_back(widx, hidx, didx);
+                        }
                     }
                 }
             }
         }
+#pragma omp critical(CreateFromTriangleMeshWithinBounds)
+        for (const Eigen::Vector3i &grid_index : found) {
+            output->AddVoxel(geometry::Voxel(grid_index));
+        }
     }
 
     return output;
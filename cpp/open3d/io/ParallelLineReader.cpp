@@ -0,0 +1,287 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ParallelLineReader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+#include "open3d/t/io/MappedFile.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+// Chunks smaller than this are not worth a task.
+static constexpr int64_t kMinChunkSize = 1 << 16;
+
+ParallelLineReader::ParallelLineReader(const std::string &filename,
+                                       int64_t offset) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open file {}, error: {}.", filename,
+                          file.GetError());
+    }
+    const int64_t size = file.GetFileSize() - offset;
+    file.Close();
+    if (size <= 0) {
+        chunk_begins_.push_back(nullptr);
+        return;
+    }
+    blob_ = t::io::MapFileRegion(filename, offset, size);
+    const char *begin = static_cast<const char *>(blob_->GetDataPtr());
+    const char *end = begin + size;
+
+    // Several chunks per thread balance lines of different lengths.
+    const int64_t num_chunks =
+            std::max(int64_t(1),
+                     std::min(size / kMinChunkSize,
+                              int64_t(utility::EstimateMaxThreads()) * 4));
+    chunk_begins_.push_back(begin);
+    for (int64_t c = 1; c < num_chunks; ++c) {
+        const char *split =
+                std::max(begin + size * c / num_chunks, chunk_begins_.back());
+        const char *newline = static_cast<const char *>(
+                std::memchr(split, '\n', end - split));
+        if (!newline || newline + 1 == end) {
+            break;
+        }
+        if (newline + 1 > chunk_begins_.back()) {
+            chunk_begins_.push_back(newline + 1);
+        }
+    }
+    chunk_begins_.push_back(end);
+}
+
+void ParallelLineReader::ForEachLine(
+        const std::function<void(int64_t, const char *, const char *)> &func,
+        utility::CountingProgressReporter *reporter) const {
+    if (reporter) {
+        reporter->SetTotal(chunk_begins_.back() - chunk_begins_.front());
+    }
+    std::atomic<int64_t> num_bytes_done(0);
+    std::mutex reporter_mutex;
+    utility::ParallelForRange(
+            NumChunks(),
+            [&](int64_t chunk_begin, int64_t chunk_end) {
+                for (int64_t c = chunk_begin; c < chunk_end; ++c) {
+                    const char *line = chunk_begins_[c];
+                    const char *end = chunk_begins_[c + 1];
+                    const char *reported = line;
+                    int64_t num_lines = 0;
+                    while (line < end) {
+                        const char *newline = static_cast<const char *>(
+                                std::memchr(line, '\n', end - line));
+                        const char *line_end = newline ? newline : end;
+                        const bool has_cr =
+                                line_end > line && line_end[-1] == '\r';
+                        func(c, line, line_end - has_cr);
+                        line = line_end + 1;
+                        if (reporter && ++num_lines % 1000 == 0 &&
+                            line < end) {
+                            const int64_t done =
+                                    num_bytes_done += line - reported;
+                            reported = line;
+                            std::lock_guard<std::mutex> lock(reporter_mutex);
+                            reporter->Update(done);
+                        }
+                    }
+                    num_bytes_done += end - reported;
+                }
+            },
+            1);
+}
+
+static inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' ||
+           c == '\f';
+}
+
+static inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+bool ParseDouble(const char *&ptr, const char *end, double &value) {
+    // Powers of ten that are exact in double precision.
+    static const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                    1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                    1e18, 1e19, 1e20, 1e21, 1e22};
+    const char *p = ptr;
+    while (p < end && IsSpace(*p)) ++p;
+    const char *start = p;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = *p == '-';
+        ++p;
+    }
+    const bool is_hex =
+            end - p >= 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X');
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int64_t exponent = 0;
+    bool any_digit = false;
+    bool truncated = false;
+    for (; p < end && IsDigit(*p); ++p) {
+        any_digit = true;
+        if (mantissa == 0 && *p == '0') continue;
+        if (num_digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            ++num_digits;
+        } else {
+            ++exponent;
+            truncated = true;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (++p; p < end && IsDigit(*p); ++p) {
+            any_digit = true;
+            if (mantissa == 0 && *p == '0') {
+                --exponent;
+            } else if (num_digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                ++num_digits;
+                --exponent;
+            } else {
+                truncated = true;
+            }
+        }
+    }
+    if (any_digit && !is_hex && p < end && (*p == 'e' || *p == 'E')) {
+        const char *q = p + 1;
+        bool exponent_negative = false;
+        if (q < end && (*q == '-' || *q == '+')) {
+            exponent_negative = *q == '-';
+            ++q;
+        }
+        if (q < end && IsDigit(*q)) {
+            int64_t exponent_value = 0;
+            for (; q < end && IsDigit(*q); ++q) {
+                if (exponent_value < 100000) {
+                    exponent_value = exponent_value * 10 + (*q - '0');
+                }
+            }
+            exponent += exponent_negative ? -exponent_value : exponent_value;
+            p = q;
+        }
+    }
+
+    // A single rounding of an exact mantissa and power of ten is correctly
+    // rounded, as strtod is.
+    if (any_digit && !is_hex && !truncated &&
+        mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+        value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / kPow10[-exponent]
+                             : value * kPow10[exponent];
+        if (negative) value = -value;
+        ptr = p;
+        return true;
+    }
+
+    // Long mantissas, large exponents, hex, inf and nan.
+    char buffer[128];
+    const size_t length = std::min<size_t>(end - start, sizeof(buffer) - 1);
+    std::memcpy(buffer, start, length);
+    buffer[length] = '\0';
+    char *parsed_end;
+    value = std::strtod(buffer, &parsed_end);
+    if (parsed_end == buffer) {
+        return false;
+    }
+    ptr = start + (parsed_end - buffer);
+    return true;
+}
+
+int ParseDoubles(const char *begin,
+                 const char *end,
+                 double *values,
+                 int num_values) {
+    for (int i = 0; i < num_values; ++i) {
+        if (!ParseDouble(begin, end, values[i])) {
+            return i;
+        }
+    }
+    return num_values;
+}
+
+bool ParseRows(const ParallelLineReader &reader,
+               int num_columns,
+               int64_t num_lines,
+               std::vector<double> &values,
+               std::string &invalid_line,
+               utility::CountingProgressReporter *reporter) {
+    struct ChunkRows {
+        std::vector<double> values;
+        int64_t num_lines = 0;
+        // Line of the chunk that failed to parse, the chunk stops there.
+        int64_t invalid_index = -1;
+        std::string invalid_line;
+    };
+    std::vector<ChunkRows> chunks(reader.NumChunks());
+    reader.ForEachLine(
+            [&](int64_t c, const char *begin, const char *end) {
+                ChunkRows &chunk = chunks[c];
+                if (chunk.invalid_index < 0) {
+                    const size_t size = chunk.values.size();
+                    chunk.values.resize(size + num_columns);
+                    if (ParseDoubles(begin, end, chunk.values.data() + size,
+                                     num_columns) != num_columns) {
+                        chunk.values.resize(size);
+                        chunk.invalid_index = chunk.num_lines;
+                        chunk.invalid_line.assign(begin, end);
+                    }
+                }
+                ++chunk.num_lines;
+            },
+            reporter);
+
+    values.clear();
+    int64_t lines_before = 0;
+    for (ChunkRows &chunk : chunks) {
+        if (lines_before >= num_lines) break;
+        const int64_t num_rows =
+                std::min(int64_t(chunk.values.size()) / num_columns,
+                         num_lines - lines_before);
+        values.insert(values.end(), chunk.values.begin(),
+                      chunk.values.begin() + num_rows * num_columns);
+        if (chunk.invalid_index >= 0 &&
+            lines_before + chunk.invalid_index < num_lines) {
+            invalid_line = chunk.invalid_line;
+            return false;
+        }
+        lines_before += chunk.num_lines;
+        std::vector<double>().swap(chunk.values);
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+
+namespace open3d {
+namespace utility {
+class CountingProgressReporter;
+}  // namespace utility
+
+namespace io {
+
+/// \class ParallelLineReader
+///
+/// \brief Memory-maps a text file and parses its lines on all threads.
+///
+/// The file is split at newline boundaries into chunks of whole lines. Chunks
+/// are parsed concurrently and the lines of one chunk in order, so readers
+/// collect their results per chunk and concatenate them in chunk order to
+/// get the lines in file order.
+class ParallelLineReader {
+public:
+    /// \brief Map \p filename from byte \p offset to its end.
+    ParallelLineReader(const std::string &filename, int64_t offset = 0);
+
+    /// Number of chunks, 0 for an empty text.
+    int64_t NumChunks() const {
+        return static_cast<int64_t>(chunk_begins_.size()) - 1;
+    }
+
+    /// \brief Call \p func(chunk, line_begin, line_end) for all lines. The
+    /// line excludes its "\n" or "\r\n" line break.
+    ///
+    /// \param reporter If not null, progress is reported to it in bytes of
+    /// the text.
+    void ForEachLine(
+            const std::function<void(int64_t, const char *, const char *)>
+                    &func,
+            utility::CountingProgressReporter *reporter = nullptr) const;
+
+private:
+    std::shared_ptr<core::Blob> blob_;
+    /// Chunk c is [chunk_begins_[c], chunk_begins_[c + 1]).
+    std::vector<const char *> chunk_begins_;
+};
+
+/// \brief Parse a floating point number from [\p ptr, \p end), skipping
+/// leading whitespace, as strtod() does, and advance \p ptr past it.
+///
+/// Decimal numbers with up to 19 significant digits and small exponents, i.e.
+/// almost all numbers in point cloud exports, are converted exactly without
+/// going through the locale-aware C library.
+///
+/// \return false if there is no number at \p ptr.
+bool ParseDouble(const char *&ptr, const char *end, double &value);
+
+/// \brief Parse up to \p num_values whitespace separated numbers at the
+/// start of [\p begin, \p end) into \p values, like sscanf("%lf %lf ...").
+///
+/// \return The number of parsed numbers.
+int ParseDoubles(const char *begin,
+                 const char *end,
+                 double *values,
+                 int num_values);
+
+/// \brief Parse the first \p num_lines lines of \p reader as rows of \p
+/// num_columns numbers each, e.g. the data of a PTS file. Lines past
+/// num_lines are ignored.
+///
+/// \param values The rows before the first invalid line, row-major.
+/// \param invalid_line The first line among them that does not start with
+/// num_columns numbers.
+/// \return false if there is an invalid line.
+bool ParseRows(const ParallelLineReader &reader,
+               int num_columns,
+               int64_t num_lines,
+               std::vector<double> &values,
+               std::string &invalid_line,
+               utility::CountingProgressReporter *reporter = nullptr);
+
+/// Concatenate per-chunk results in chunk order.
+template <typename T>
+std::vector<T> ConcatenateChunks(std::vector<std::vector<T>> &chunks) {
+    size_t size = 0;
+    for (const auto &chunk : chunks) {
+        size += chunk.size();
+    }
+    std::vector<T> result;
+    result.reserve(size);
+    for (auto &chunk : chunks) {
+        result.insert(result.end(), chunk.begin(), chunk.end());
+        std::vector<T>().swap(chunk);
+    }
+    return result;
+}
+
+}  // namespace io
+}  // namespace open3d
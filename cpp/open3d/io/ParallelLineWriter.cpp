@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ParallelLineWriter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace io {
+
+// Lines per chunk, small enough to balance the threads and large enough to
+// amortize the task overhead.
+static constexpr int64_t kChunkSize = 1 << 14;
+// Lines formatted between two progress updates.
+static constexpr int64_t kReportInterval = 1000;
+
+bool WriteLinesInParallel(
+        FILE *file,
+        int64_t num_lines,
+        const std::function<void(int64_t, int64_t, std::string &)>
+                &format_lines,
+        utility::CountingProgressReporter *reporter) {
+    const int64_t num_chunks = (num_lines + kChunkSize - 1) / kChunkSize;
+    // Chunks formatted between two writes, bounding the buffered text.
+    const int64_t batch_size =
+            std::max<int64_t>(4 * utility::EstimateMaxThreads(), 1);
+
+    auto write_batch = [file](const std::vector<std::string> *texts) {
+        for (const std::string &text : *texts) {
+            if (fwrite(text.data(), 1, text.size(), file) != text.size()) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Two batches of texts, one being written while the other is formatted.
+    std::vector<std::string> texts[2];
+    std::future<bool> writing;
+    std::atomic<int64_t> num_lines_done(0);
+    std::mutex reporter_mutex;
+    bool success = true;
+    int parity = 0;
+    for (int64_t batch_begin = 0; batch_begin < num_chunks;
+         batch_begin += batch_size) {
+        const int64_t batch_end =
+                std::min(batch_begin + batch_size, num_chunks);
+        std::vector<std::string> &batch = texts[parity];
+        batch.resize(batch_end - batch_begin);
+        utility::ParallelForRange(
+                batch_end - batch_begin,
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t c = begin; c < end; ++c) {
+                        const int64_t chunk_end = std::min(
+                                (batch_begin + c + 1) * kChunkSize, num_lines);
+                        batch[c].clear();
+                        for (int64_t line = (batch_begin + c) * kChunkSize;
+                             line < chunk_end; line += kReportInterval) {
+                            const int64_t line_end =
+                                    std::min(line + kReportInterval, chunk_end);
+                            format_lines(line, line_end, batch[c]);
+                            if (reporter) {
+                                const int64_t done = num_lines_done +=
+                                        line_end - line;
+                                std::lock_guard<std::mutex> lock(
+                                        reporter_mutex);
+                                reporter->Update(done);
+                            }
+                        }
+                    }
+                },
+                1);
+
+        if (writing.valid() && !writing.get()) {
+            success = false;
+            break;
+        }
+        writing = std::async(std::launch::async, write_batch, &batch);
+        parity = 1 - parity;
+    }
+    if (writing.valid() && !writing.get()) {
+        success = false;
+    }
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,61 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+namespace open3d {
+namespace utility {
+class CountingProgressReporter;
+}  // namespace utility
+
+namespace io {
+
+/// \brief Format \p num_lines lines of text on all threads and write them to
+/// \p file in order.
+///
+/// The lines are split into chunks. \p format_lines(begin, end, text) appends
+/// lines [begin, end) to the text of one chunk and is called concurrently
+/// for different chunks. Chunks are written in order while the next ones are
+/// formatted. Format numbers with fmt, e.g. fmt::format_to(
+/// std::back_inserter(text), "{:.10f}", value), which is locale independent
+/// and gives the same digits as printf.
+///
+/// \param reporter If not null, progress is reported to it in lines.
+/// \return false if writing to \p file failed.
+bool WriteLinesInParallel(
+        FILE *file,
+        int64_t num_lines,
+        const std::function<void(int64_t, int64_t, std::string &)>
+                &format_lines,
+        utility::CountingProgressReporter *reporter = nullptr);
+
+}  // namespace io
+}  // namespace open3d
@@ -68,6 +68,17 @@ bool ReadTriangleMeshFromOBJ(const std::string& filename,
     }
 
     mesh.Clear();
+    size_t num_faces = 0;
+    for (const auto &shape : shapes) {
+        num_faces += shape.mesh.num_face_vertices.size();
+    }
+    mesh.vertices_.reserve(attrib.vertices.size() / 3);
+    mesh.vertex_colors_.reserve(attrib.colors.size() / 3);
+    mesh.triangles_.reserve(num_faces);
+    mesh.triangle_material_ids_.reserve(num_faces);
+    if (!attrib.texcoords.empty()) {
+        mesh.triangle_uvs_.reserve(3 * num_faces);
+    }
 
     // copy vertex and data
     for (size_t vidx = 0; vidx < attrib.vertices.size(); vidx += 3) {
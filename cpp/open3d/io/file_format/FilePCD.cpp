@@ -24,13 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <fmt/format.h>
 #include <liblzf/lzf.h>
 
 #include <cstdint>
 #include <cstdio>
+#include <iterator>
 #include <sstream>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelLineWriter.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -651,22 +654,30 @@ bool WritePCDData(FILE *file,
     utility::CountingProgressReporter reporter(params.update_progress);
     reporter.SetTotal(pointcloud.points_.size());
     if (header.datatype == PCD_DATA_ASCII) {
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            fprintf(file, "%.10g %.10g %.10g", point(0), point(1), point(2));
-            if (has_normal) {
-                const auto &normal = pointcloud.normals_[i];
-                fprintf(file, " %.10g %.10g %.10g", normal(0), normal(1),
-                        normal(2));
-            }
-            if (has_color) {
-                const auto &color = pointcloud.colors_[i];
-                fprintf(file, " %.10g", ConvertRGBToFloat(color));
-            }
-            fprintf(file, "\n");
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        auto format_lines = [&](int64_t begin, int64_t end,
+                                std::string &text) {
+            auto out = std::back_inserter(text);
+            for (int64_t i = begin; i < end; i++) {
+                const auto &point = pointcloud.points_[i];
+                fmt::format_to(out, "{:.10g} {:.10g} {:.10g}", point(0),
+                               point(1), point(2));
+                if (has_normal) {
+                    const auto &normal = pointcloud.normals_[i];
+                    fmt::format_to(out, " {:.10g} {:.10g} {:.10g}", normal(0),
+                                   normal(1), normal(2));
+                }
+                if (has_color) {
+                    const auto &color = pointcloud.colors_[i];
+                    fmt::format_to(out, " {:.10g}",
+                                   double(ConvertRGBToFloat(color)));
+                }
+                text += '\n';
             }
+        };
+        if (!WriteLinesInParallel(file, pointcloud.points_.size(),
+                                  format_lines, &reporter)) {
+            utility::LogWarning("Write PCD failed: unable to write data.");
+            return false;
         }
     } else if (header.datatype == PCD_DATA_BINARY) {
         std::unique_ptr<float[]> data(new float[header.elementnum]);
@@ -25,8 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <fmt/format.h>
+#include <iterator>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/io/ParallelLineWriter.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -61,7 +65,6 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_of_pts);
 
         pointcloud.Clear();
 
@@ -92,49 +95,31 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             }
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
+        file.Close();
 
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B
-            if (num_of_fields == 7 &&
-                sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                       &r, &g, &b) == 7) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z R G B
-            else if (num_of_fields == 6 &&
-                     sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z, &r,
-                            &g, &b) == 6) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-            }
-            // X Y Z I
-            else if (num_of_fields == 4 &&
-                     sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &i) ==
-                             4) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            }
-            // X Y Z
-            else if (num_of_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-            } else {
+        std::vector<double> values;
+        if (num_of_fields > 0) {
+            ParallelLineReader reader(filename, start_pos);
+            std::string invalid_line;
+            if (!ParseRows(reader, int(num_of_fields), int64_t(num_of_pts),
+                           values, invalid_line, &reporter)) {
                 utility::LogWarning("Read PTS failed at line: {}. ",
-                                    line_buffer);
+                                    invalid_line);
                 return false;
             }
-
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        }
+        const size_t num_rows =
+                num_of_fields > 0 ? values.size() / num_of_fields : 0;
+        for (size_t idx = 0; idx < num_rows; idx++) {
+            const double *row = values.data() + idx * num_of_fields;
+            pointcloud.points_[idx] = Eigen::Vector3d(row[0], row[1], row[2]);
+            // R G B are the last three fields of X Y Z I R G B and X Y Z R G B.
+            if (num_of_fields == 7 || num_of_fields == 6) {
+                const double *color = row + num_of_fields - 3;
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        int(color[0]), int(color[1]), int(color[2]));
             }
         }
-
         reporter.Finish();
         return true;
     } catch (const std::exception &e) {
@@ -162,31 +147,30 @@ bool WritePointCloudToPTS(const std::string &filename,
                                 filename);
             return false;
         }
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const auto &point = pointcloud.points_[i];
-            if (!pointcloud.HasColors()) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\r\n", point(0),
-                            point(1), point(2)) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-            } else {
-                auto color = utility::ColorToUint8(pointcloud.colors_[i]);
-                if (fprintf(file.GetFILE(),
-                            "%.10f %.10f %.10f %.10f %d %d %d\r\n", point(0),
-                            point(1), point(2), 0.0, (int)color(0),
-                            (int)color(1), (int)(color(2))) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
+        auto format_lines = [&](int64_t begin, int64_t end,
+                                std::string &text) {
+            for (int64_t i = begin; i < end; i++) {
+                const auto &point = pointcloud.points_[i];
+                if (!pointcloud.HasColors()) {
+                    fmt::format_to(std::back_inserter(text),
+                                   "{:.10f} {:.10f} {:.10f}\r\n", point(0),
+                                   point(1), point(2));
+                } else {
+                    auto color = utility::ColorToUint8(pointcloud.colors_[i]);
+                    fmt::format_to(std::back_inserter(text),
+                                   "{:.10f} {:.10f} {:.10f} {:.10f} {} {} "
+                                   "{}\r\n",
+                                   point(0), point(1), point(2), 0.0,
+                                   (int)color(0), (int)color(1),
+                                   (int)color(2));
                 }
             }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        };
+        if (!WriteLinesInParallel(file.GetFILE(), pointcloud.points_.size(),
+                                  format_lines, &reporter)) {
+            utility::LogWarning("Write PTS failed: unable to write file: {}",
+                                filename);
+            return false;
         }
         reporter.Finish();
         return true;
@@ -25,8 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <fmt/format.h>
+#include <iterator>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/io/ParallelLineWriter.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -50,20 +54,21 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        file.Close();
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        ParallelLineReader reader(filename);
+        std::vector<std::vector<Eigen::Vector3d>> points(reader.NumChunks());
+        reader.ForEachLine(
+                [&](int64_t chunk, const char *begin, const char *end) {
+                    double values[3];
+                    if (ParseDoubles(begin, end, values, 3) == 3) {
+                        points[chunk].emplace_back(values[0], values[1],
+                                                   values[2]);
+                    }
+                },
+                &reporter);
+        pointcloud.points_ = ConcatenateChunks(points);
         reporter.Finish();
 
         return true;
@@ -86,17 +91,20 @@ bool WritePointCloudToXYZ(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(pointcloud.points_.size());
 
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const Eigen::Vector3d &point = pointcloud.points_[i];
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\n", point(0),
-                        point(1), point(2)) < 0) {
-                utility::LogWarning(
-                        "Write XYZ failed: unable to write file: {}", filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        auto format_lines = [&](int64_t begin, int64_t end,
+                                std::string &text) {
+            for (int64_t i = begin; i < end; i++) {
+                const Eigen::Vector3d &point = pointcloud.points_[i];
+                fmt::format_to(std::back_inserter(text),
+                               "{:.10f} {:.10f} {:.10f}\n", point(0),
+                               point(1), point(2));
             }
+        };
+        if (!WriteLinesInParallel(file.GetFILE(), pointcloud.points_.size(),
+                                  format_lines, &reporter)) {
+            utility::LogWarning("Write XYZ failed: unable to write file: {}",
+                                filename);
+            return false;  // error happened during writing.
         }
         reporter.Finish();
         return true;
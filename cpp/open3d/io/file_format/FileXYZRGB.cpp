@@ -25,8 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <fmt/format.h>
+#include <iterator>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/io/ParallelLineWriter.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -50,22 +54,25 @@ bool ReadPointCloudFromXYZRGB(const std::string &filename,
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        file.Close();
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, r, g, b;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &r,
-                       &g, &b) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.colors_.push_back(Eigen::Vector3d(r, g, b));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        ParallelLineReader reader(filename);
+        std::vector<std::vector<Eigen::Vector3d>> points(reader.NumChunks());
+        std::vector<std::vector<Eigen::Vector3d>> colors(reader.NumChunks());
+        reader.ForEachLine(
+                [&](int64_t chunk, const char *begin, const char *end) {
+                    double values[6];
+                    if (ParseDoubles(begin, end, values, 6) == 6) {
+                        points[chunk].emplace_back(values[0], values[1],
+                                                   values[2]);
+                        colors[chunk].emplace_back(values[3], values[4],
+                                                   values[5]);
+                    }
+                },
+                &reporter);
+        pointcloud.points_ = ConcatenateChunks(points);
+        pointcloud.colors_ = ConcatenateChunks(colors);
         reporter.Finish();
 
         return true;
@@ -92,20 +99,23 @@ bool WritePointCloudToXYZRGB(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(pointcloud.points_.size());
 
-        for (size_t i = 0; i < pointcloud.points_.size(); i++) {
-            const Eigen::Vector3d &point = pointcloud.points_[i];
-            const Eigen::Vector3d &color = pointcloud.colors_[i];
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f %.10f %.10f\n",
-                        point(0), point(1), point(2), color(0), color(1),
-                        color(2)) < 0) {
-                utility::LogWarning(
-                        "Write XYZRGB failed: unable to write file: {}",
-                        filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        auto format_lines = [&](int64_t begin, int64_t end,
+                                std::string &text) {
+            for (int64_t i = begin; i < end; i++) {
+                const Eigen::Vector3d &point = pointcloud.points_[i];
+                const Eigen::Vector3d &color = pointcloud.colors_[i];
+                fmt::format_to(std::back_inserter(text),
+                               "{:.10f} {:.10f} {:.10f} {:.10f} {:.10f} "
+                               "{:.10f}\n",
+                               point(0), point(1), point(2), color(0), color(1),
+                               color(2));
             }
+        };
+        if (!WriteLinesInParallel(file.GetFILE(), pointcloud.points_.size(),
+                                  format_lines, &reporter)) {
+            utility::LogWarning("Write XYZRGB failed: unable to write file: {}",
+                                filename);
+            return false;  // error happened during writing.
         }
         reporter.Finish();
         return true;
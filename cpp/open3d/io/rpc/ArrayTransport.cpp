@@ -0,0 +1,268 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/ArrayTransport.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/utility/Logging.h"
+
+#ifndef WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace open3d::utility;
+
+namespace {
+
+/// Arrays smaller than this stay inline.
+constexpr int64_t kMinExternalBytes = 4096;
+/// Alignment of the arrays in a shared memory segment.
+constexpr int64_t kSharedMemoryAlignment = 64;
+/// Prefix of the shared memory segment names. The receiver only maps
+/// segments with this prefix.
+const std::string kSharedMemoryPrefix = "/open3d_rpc_";
+
+/// Frees the tensor reference of a zero-copy frame after ZeroMQ sent it.
+void ReleaseTensor(void*, void* hint) {
+    delete static_cast<open3d::core::Tensor*>(hint);
+}
+
+#ifndef WINDOWS
+/// Shared memory segment created by the sender. The segment is removed when
+/// this object is destroyed. Existing mappings stay valid.
+class SharedMemorySegment {
+public:
+    explicit SharedMemorySegment(const std::string& name) : name_(name) {}
+    ~SharedMemorySegment() { shm_unlink(name_.c_str()); }
+
+private:
+    std::string name_;
+};
+
+/// Read-only mapping of a shared memory segment on the receiver side.
+class SharedMemoryMapping {
+public:
+    explicit SharedMemoryMapping(const std::string& name) {
+        const int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            LogError("ResolveArrayData: failed to open shared memory {}: {}",
+                     name, std::strerror(errno));
+        }
+        struct stat status;
+        if (fstat(fd, &status) != 0) {
+            const int stat_errno = errno;
+            close(fd);
+            LogError("ResolveArrayData: failed to stat shared memory {}: {}",
+                     name, std::strerror(stat_errno));
+        }
+        size_ = status.st_size;
+        if (size_ > 0) {
+            data_ = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+        }
+        const int mmap_errno = errno;
+        close(fd);
+        if (data_ == MAP_FAILED) {
+            data_ = nullptr;
+            LogError("ResolveArrayData: failed to map shared memory {}: {}",
+                     name, std::strerror(mmap_errno));
+        }
+    }
+    ~SharedMemoryMapping() {
+        if (data_) {
+            munmap(data_, size_);
+        }
+    }
+
+    const char* Data() const { return static_cast<const char*>(data_); }
+    int64_t Size() const { return size_; }
+
+private:
+    void* data_ = nullptr;
+    int64_t size_ = 0;
+};
+#endif
+
+}  // namespace
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+bool IsLocalAddress(const std::string& address) {
+    auto starts_with = [&address](const std::string& prefix) {
+        return address.compare(0, prefix.size(), prefix) == 0;
+    };
+    return starts_with("ipc://") || starts_with("inproc://") ||
+           starts_with("tcp://127.") || starts_with("tcp://localhost:") ||
+           starts_with("tcp://[::1]:");
+}
+
+std::shared_ptr<void> MoveArrayData(messages::MeshData& mesh_data,
+                                    ArrayTransport transport,
+                                    std::vector<zmq::message_t>& frames) {
+    std::vector<messages::Array*> arrays;
+    mesh_data.ForEachArray([&arrays](const std::string&,
+                                     messages::Array& array) {
+        if (array.data.ptr && int64_t(array.data.size) >= kMinExternalBytes) {
+            arrays.push_back(&array);
+        }
+    });
+    if (transport == ArrayTransport::Inline || arrays.empty()) {
+        return nullptr;
+    }
+
+#ifdef WINDOWS
+    if (transport == ArrayTransport::SharedMemory) {
+        LogWarning(
+                "MoveArrayData: shared memory is not supported on Windows, "
+                "sending frames instead.");
+        transport = ArrayTransport::Frames;
+    }
+#endif
+
+    if (transport == ArrayTransport::Frames) {
+        for (messages::Array* array : arrays) {
+            void* ptr = const_cast<char*>(array->data.ptr);
+            if (array->tensor_.NumElements() &&
+                array->tensor_.GetDataPtr() == ptr) {
+                // The frame keeps the tensor alive until it has been sent.
+                frames.emplace_back(ptr, array->data.size, &ReleaseTensor,
+                                    new core::Tensor(array->tensor_));
+            } else {
+                frames.emplace_back(static_cast<const void*>(ptr),
+                                    size_t(array->data.size));
+            }
+            array->frame = int64_t(frames.size()) - 1;
+            array->data = msgpack::type::raw_ref();
+        }
+        return nullptr;
+    }
+
+#ifdef WINDOWS
+    return nullptr;
+#else
+    std::vector<int64_t> offsets;
+    int64_t size = 0;
+    for (const messages::Array* array : arrays) {
+        offsets.push_back(size);
+        size += (int64_t(array->data.size) + kSharedMemoryAlignment - 1) /
+                kSharedMemoryAlignment * kSharedMemoryAlignment;
+    }
+    static std::atomic<int64_t> segment_count(0);
+    const std::string name = fmt::format("{}{}_{}", kSharedMemoryPrefix,
+                                         getpid(), segment_count++);
+    const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        LogError("MoveArrayData: failed to create shared memory {}: {}", name,
+                 std::strerror(errno));
+    }
+    auto segment = std::make_shared<SharedMemorySegment>(name);
+    if (ftruncate(fd, size) != 0) {
+        const int truncate_errno = errno;
+        close(fd);
+        LogError("MoveArrayData: failed to resize shared memory {}: {}", name,
+                 std::strerror(truncate_errno));
+    }
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    const int mmap_errno = errno;
+    close(fd);
+    if (base == MAP_FAILED) {
+        LogError("MoveArrayData: failed to map shared memory {}: {}", name,
+                 std::strerror(mmap_errno));
+    }
+    for (size_t i = 0; i < arrays.size(); ++i) {
+        std::memcpy(static_cast<char*>(base) + offsets[i], arrays[i]->data.ptr,
+                    arrays[i]->data.size);
+        arrays[i]->shm = name;
+        arrays[i]->shm_offset = offsets[i];
+        arrays[i]->data = msgpack::type::raw_ref();
+    }
+    munmap(base, size);
+    return segment;
+#endif
+}
+
+void ResolveArrayData(messages::SetMeshData& msg,
+                      const std::vector<zmq::message_t>& frames,
+                      std::vector<std::shared_ptr<void>>& mappings) {
+#ifndef WINDOWS
+    std::map<std::string, std::shared_ptr<SharedMemoryMapping>> segments;
+#endif
+    msg.data.ForEachArray([&](const std::string&, messages::Array& array) {
+        const int64_t size = array.ByteSize();
+        if (array.frame >= 0) {
+            if (array.frame >= int64_t(frames.size()) ||
+                int64_t(frames[array.frame].size()) != size) {
+                LogError(
+                        "ResolveArrayData: frame {} does not hold an array "
+                        "of {} bytes",
+                        array.frame, size);
+            }
+            array.data.ptr =
+                    static_cast<const char*>(frames[array.frame].data());
+            array.data.size = uint32_t(size);
+        } else if (!array.shm.empty()) {
+#ifdef WINDOWS
+            LogError("ResolveArrayData: shared memory is not supported on "
+                     "Windows.");
+#else
+            if (array.shm.compare(0, kSharedMemoryPrefix.size(),
+                                  kSharedMemoryPrefix) != 0) {
+                LogError("ResolveArrayData: invalid shared memory name {}",
+                         array.shm);
+            }
+            std::shared_ptr<SharedMemoryMapping>& mapping =
+                    segments[array.shm];
+            if (!mapping) {
+                mapping = std::make_shared<SharedMemoryMapping>(array.shm);
+                mappings.push_back(mapping);
+            }
+            if (array.shm_offset < 0 ||
+                array.shm_offset + size > mapping->Size()) {
+                LogError(
+                        "ResolveArrayData: array of {} bytes at offset {} is "
+                        "out of the bounds of shared memory {}",
+                        size, array.shm_offset, array.shm);
+            }
+            array.data.ptr = mapping->Data() + array.shm_offset;
+            array.data.size = uint32_t(size);
+#endif
+        }
+    });
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace zmq {
+class message_t;
+}
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace messages {
+struct MeshData;
+struct SetMeshData;
+}  // namespace messages
+
+/// Defines how the arrays of geometry messages are transferred.
+enum class ArrayTransport {
+    /// Arrays are serialized into the msgpack message.
+    Inline,
+    /// Arrays are sent as additional frames of a multipart message. Frames of
+    /// tensors reference the tensor memory and are not copied.
+    Frames,
+    /// Arrays are copied to a shared memory segment which the receiver maps.
+    /// Sender and receiver must be on the same host.
+    SharedMemory,
+};
+
+/// Returns true if \p address can only be reached from the local host, i.e.
+/// it uses the ipc or inproc transport or a loopback tcp address.
+bool IsLocalAddress(const std::string& address);
+
+/// \brief Moves the data of the arrays of \p mesh_data out of the msgpack
+/// message, as defined by \p transport.
+///
+/// Arrays smaller than 4 KiB stay inline. For ArrayTransport::Frames the
+/// frames are appended to \p frames, which must follow the message frame.
+/// For ArrayTransport::SharedMemory the arrays are copied to a new shared
+/// memory segment.
+///
+/// \return An object owning the shared memory segment or the referenced
+/// data, which must be kept alive until the reply has been received.
+std::shared_ptr<void> MoveArrayData(messages::MeshData& mesh_data,
+                                    ArrayTransport transport,
+                                    std::vector<zmq::message_t>& frames);
+
+/// \brief Points the arrays of \p msg which refer to a message frame or a
+/// shared memory segment to their data.
+///
+/// \param frames The frames following the message frame.
+/// \param mappings Receives the shared memory mappings. The arrays are valid
+/// while \p frames and \p mappings are alive.
+void ResolveArrayData(messages::SetMeshData& msg,
+                      const std::vector<zmq::message_t>& frames,
+                      std::vector<std::shared_ptr<void>>& mappings);
+
+/// Messages without arrays are not changed.
+template <class T>
+void ResolveArrayData(T& msg,
+                      const std::vector<zmq::message_t>& frames,
+                      std::vector<std::shared_ptr<void>>& mappings) {}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -53,12 +53,22 @@ Connection::Connection()
 
 Connection::Connection(const std::string& address,
                        int connect_timeout,
-                       int timeout)
+                       int timeout,
+                       ArrayTransport array_transport)
     : context_(GetZMQContext()),
       socket_(new zmq::socket_t(*GetZMQContext(), ZMQ_REQ)),
       address_(address),
       connect_timeout_(connect_timeout),
-      timeout_(timeout) {
+      timeout_(timeout),
+      array_transport_(array_transport) {
+    if (array_transport_ == ArrayTransport::SharedMemory &&
+        !IsLocalAddress(address_)) {
+        LogWarning(
+                "Connection: shared memory needs a local address, sending "
+                "frames to {}",
+                address_);
+        array_transport_ = ArrayTransport::Frames;
+    }
     socket_->set(zmq::sockopt::linger, timeout_);
     socket_->set(zmq::sockopt::connect_timeout, connect_timeout_);
     socket_->set(zmq::sockopt::rcvtimeo, timeout_);
@@ -75,7 +85,27 @@ std::shared_ptr<zmq::message_t> Connection::Send(zmq::message_t& send_msg) {
             LogInfo("Connection::send() send failed with: {}", err.what());
         }
     }
+    return ReceiveReply();
+}
+
+std::shared_ptr<zmq::message_t> Connection::SendMultipart(
+        std::vector<zmq::message_t>& frames) {
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const zmq::send_flags flags = i + 1 < frames.size()
+                                              ? zmq::send_flags::sndmore
+                                              : zmq::send_flags::none;
+        if (!socket_->send(frames[i], flags)) {
+            zmq::error_t err;
+            if (err.num()) {
+                LogInfo("Connection::send() send failed with: {}",
+                        err.what());
+            }
+        }
+    }
+    return ReceiveReply();
+}
 
+std::shared_ptr<zmq::message_t> Connection::ReceiveReply() {
     std::shared_ptr<zmq::message_t> msg(new zmq::message_t());
     if (socket_->recv(*msg)) {
         LogDebug("Connection::send() received answer with {} bytes",
@@ -28,6 +28,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "open3d/io/rpc/ConnectionBase.h"
 #include "open3d/io/rpc/ZMQContext.h"
@@ -51,7 +52,14 @@ public:
     ///
     /// \param timeout          The timeout for sending data.
     ///
-    Connection(const std::string& address, int connect_timeout, int timeout);
+    /// \param array_transport  How the arrays of geometry messages are
+    /// transferred. ArrayTransport::SharedMemory falls back to
+    /// ArrayTransport::Frames for addresses which are not local.
+    ///
+    Connection(const std::string& address,
+               int connect_timeout,
+               int timeout,
+               ArrayTransport array_transport = ArrayTransport::Inline);
     ~Connection();
 
     /// Function for sending data wrapped in a zmq message object.
@@ -60,14 +68,25 @@ public:
     /// Function for sending raw data. Meant for testing purposes
     std::shared_ptr<zmq::message_t> Send(const void* data, size_t size);
 
+    /// Function for sending a multipart message. The first frame is the
+    /// message, the following frames hold array data.
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& frames);
+
+    ArrayTransport GetArrayTransport() const { return array_transport_; }
+
     static std::string DefaultAddress();
 
 private:
+    /// Receives the reply to the last sent message.
+    std::shared_ptr<zmq::message_t> ReceiveReply();
+
     std::shared_ptr<zmq::context_t> context_;
     std::unique_ptr<zmq::socket_t> socket_;
     const std::string address_;
     const int connect_timeout_;
     const int timeout_;
+    ArrayTransport array_transport_;
 };
 }  // namespace rpc
 }  // namespace io
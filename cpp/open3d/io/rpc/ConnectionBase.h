@@ -27,6 +27,11 @@
 #pragma once
 
 #include <memory>
+#include <vector>
+
+#include "open3d/io/rpc/ArrayTransport.h"
+#include "open3d/io/rpc/MeshDataEncoding.h"
+#include "open3d/utility/Logging.h"
 
 namespace zmq {
 class message_t;
@@ -47,6 +52,34 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Function for sending a multipart message. The first frame is the
+    /// message, the following frames hold array data.
+    virtual std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& frames) {
+        utility::LogError("SendMultipart is not supported by this connection");
+        return nullptr;
+    }
+
+    /// Returns how the arrays of geometry messages are transferred.
+    virtual ArrayTransport GetArrayTransport() const {
+        return ArrayTransport::Inline;
+    }
+
+    /// Sets how the arrays of SetMeshData messages are encoded. Delta updates
+    /// are relative to the previous message sent with this connection.
+    void SetMeshDataEncoding(const MeshDataEncodingOptions& options) {
+        encoder_ = std::make_shared<MeshDataEncoder>(options);
+    }
+
+    /// Returns the encoder for SetMeshData messages or nullptr if the arrays
+    /// are sent as they are.
+    std::shared_ptr<MeshDataEncoder> GetMeshDataEncoder() const {
+        return encoder_;
+    }
+
+private:
+    std::shared_ptr<MeshDataEncoder> encoder_;
 };
 }  // namespace rpc
 }  // namespace io
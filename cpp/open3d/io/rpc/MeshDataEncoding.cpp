@@ -0,0 +1,451 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/MeshDataEncoding.h"
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+using namespace open3d::utility;
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace {
+
+/// Arrays smaller than this are not compressed.
+constexpr int64_t kMinCompressBytes = 64;
+
+/// Returns a UInt8 tensor with a copy of \p size bytes at \p ptr.
+core::Tensor CopyBytes(const char* ptr, int64_t size) {
+    core::Tensor bytes({size}, core::UInt8);
+    std::memcpy(bytes.GetDataPtr(), ptr, size);
+    return bytes;
+}
+
+/// Points the data of \p array to \p bytes and keeps a reference to them.
+void SetArrayBytes(messages::Array& array, const core::Tensor& bytes) {
+    array.tensor_ = bytes;
+    array.data.ptr = static_cast<const char*>(bytes.GetDataPtr());
+    array.data.size = uint32_t(bytes.NumElements());
+}
+
+/// Number of values in the last dimension of \p array.
+int64_t NumChannels(const messages::Array& array) {
+    return array.shape.size() > 1 ? array.shape.back() : 1;
+}
+
+/// Size in bytes of block \p block of an array with \p size bytes.
+int64_t BlockSize(int64_t block, int64_t block_size, int64_t size) {
+    return std::min(block_size, size - block * block_size);
+}
+
+template <class TQ, class T>
+void QuantizeValues(const T* values,
+                    int64_t num,
+                    const std::vector<double>& offset,
+                    const std::vector<double>& scale,
+                    TQ* out) {
+    const int64_t channels = int64_t(offset.size());
+    const double max_value = std::numeric_limits<TQ>::max();
+    ParallelForRange(num, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            const int64_t c = i % channels;
+            const double q = std::round((values[i] - offset[c]) / scale[c]);
+            out[i] = TQ(std::min(std::max(q, 0.0), max_value));
+        }
+    });
+}
+
+template <class TQ, class T>
+void DequantizeValues(const TQ* values,
+                      int64_t num,
+                      const std::vector<double>& offset,
+                      const std::vector<double>& scale,
+                      T* out) {
+    const int64_t channels = int64_t(offset.size());
+    ParallelForRange(num, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            const int64_t c = i % channels;
+            out[i] = T(offset[c] + scale[c] * values[i]);
+        }
+    });
+}
+
+/// Quantizes the Float32 or Float64 \p array to \p TQ.
+template <class TQ>
+void QuantizeArray(messages::Array& array,
+                   const std::vector<double>& offset,
+                   const std::vector<double>& scale) {
+    const bool is_float = array.type == messages::TypeStr<float>();
+    const int64_t num = int64_t(array.data.size) /
+                        (is_float ? sizeof(float) : sizeof(double));
+    core::Tensor bytes({num * int64_t(sizeof(TQ))}, core::UInt8);
+    TQ* out = static_cast<TQ*>(bytes.GetDataPtr());
+    if (is_float) {
+        QuantizeValues(array.Ptr<float>(), num, offset, scale, out);
+    } else {
+        QuantizeValues(array.Ptr<double>(), num, offset, scale, out);
+    }
+    array.dequant_type = array.type;
+    array.dequant_offset = offset;
+    array.dequant_scale = scale;
+    array.type = messages::TypeStr<TQ>();
+    SetArrayBytes(array, bytes);
+}
+
+/// Quantizes positions to 16 bit in their bounding box.
+template <class T>
+void QuantizePositions(messages::Array& array) {
+    const int64_t channels = NumChannels(array);
+    const int64_t num = int64_t(array.data.size / sizeof(T));
+    const T* values = array.Ptr<T>();
+    std::vector<double> min_value(channels,
+                                  std::numeric_limits<double>::infinity());
+    std::vector<double> max_value(channels,
+                                  -std::numeric_limits<double>::infinity());
+    for (int64_t i = 0; i < num; ++i) {
+        const int64_t c = i % channels;
+        min_value[c] = std::min(min_value[c], double(values[i]));
+        max_value[c] = std::max(max_value[c], double(values[i]));
+    }
+    std::vector<double> scale(channels);
+    for (int64_t c = 0; c < channels; ++c) {
+        scale[c] = (max_value[c] - min_value[c]) /
+                   std::numeric_limits<uint16_t>::max();
+        if (!(scale[c] > 0)) {
+            scale[c] = 1;
+        }
+    }
+    QuantizeArray<uint16_t>(array, min_value, scale);
+}
+
+/// Restores the values of a quantized array.
+void DequantizeArray(messages::Array& array) {
+    const int64_t channels = NumChannels(array);
+    if (int64_t(array.dequant_offset.size()) != channels ||
+        int64_t(array.dequant_scale.size()) != channels) {
+        LogError("MeshDataDecoder: expected {} dequantization values",
+                 channels);
+    }
+    const std::vector<double>& offset = array.dequant_offset;
+    const std::vector<double>& scale = array.dequant_scale;
+    const bool is_u8 = array.type == messages::TypeStr<uint8_t>();
+    if (!is_u8 && array.type != messages::TypeStr<uint16_t>()) {
+        LogError("MeshDataDecoder: unsupported quantized type {}", array.type);
+    }
+    const int64_t num = int64_t(array.data.size) /
+                        (is_u8 ? sizeof(uint8_t) : sizeof(uint16_t));
+    if (array.dequant_type == messages::TypeStr<float>()) {
+        core::Tensor bytes({num * int64_t(sizeof(float))}, core::UInt8);
+        float* out = static_cast<float*>(bytes.GetDataPtr());
+        if (is_u8) {
+            DequantizeValues(array.Ptr<uint8_t>(), num, offset, scale, out);
+        } else {
+            DequantizeValues(array.Ptr<uint16_t>(), num, offset, scale, out);
+        }
+        SetArrayBytes(array, bytes);
+    } else if (array.dequant_type == messages::TypeStr<double>()) {
+        core::Tensor bytes({num * int64_t(sizeof(double))}, core::UInt8);
+        double* out = static_cast<double*>(bytes.GetDataPtr());
+        if (is_u8) {
+            DequantizeValues(array.Ptr<uint8_t>(), num, offset, scale, out);
+        } else {
+            DequantizeValues(array.Ptr<uint16_t>(), num, offset, scale, out);
+        }
+        SetArrayBytes(array, bytes);
+    } else {
+        LogError("MeshDataDecoder: unsupported dequantized type {}",
+                 array.dequant_type);
+    }
+    array.type = array.dequant_type;
+    array.dequant_type.clear();
+    array.dequant_offset.clear();
+    array.dequant_scale.clear();
+}
+
+/// Returns the blocks of \p array which differ from \p base.
+std::vector<int64_t> ChangedBlocks(const messages::Array& array,
+                                   const core::Tensor& base) {
+    const int64_t size = array.data.size;
+    const int64_t block_size = array.delta_block_size;
+    const int64_t num_blocks = (size + block_size - 1) / block_size;
+    const char* base_ptr = static_cast<const char*>(base.GetDataPtr());
+    const int64_t base_size = base.NumElements();
+    std::vector<char> changed(num_blocks);
+    ParallelForRange(num_blocks, [&](int64_t begin, int64_t end) {
+        for (int64_t b = begin; b < end; ++b) {
+            const int64_t offset = b * block_size;
+            const int64_t n = BlockSize(b, block_size, size);
+            changed[b] = offset + n > base_size ||
+                         std::memcmp(array.data.ptr + offset, base_ptr + offset,
+                                     n) != 0;
+        }
+    });
+    std::vector<int64_t> blocks;
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        if (changed[b]) {
+            blocks.push_back(b);
+        }
+    }
+    return blocks;
+}
+
+/// Replaces the data of \p array with its blocks \p blocks.
+void SetDeltaBlocks(messages::Array& array,
+                    int64_t base_time,
+                    const std::vector<int64_t>& blocks) {
+    const int64_t size = array.data.size;
+    const int64_t block_size = array.delta_block_size;
+    int64_t delta_size = 0;
+    for (int64_t b : blocks) {
+        delta_size += BlockSize(b, block_size, size);
+    }
+    core::Tensor bytes({delta_size}, core::UInt8);
+    char* out = static_cast<char*>(bytes.GetDataPtr());
+    for (int64_t b : blocks) {
+        const int64_t n = BlockSize(b, block_size, size);
+        std::memcpy(out, array.data.ptr + b * block_size, n);
+        out += n;
+    }
+    array.delta_base_time = base_time;
+    array.delta_blocks = blocks;
+    SetArrayBytes(array, bytes);
+}
+
+/// Restores the full data of the delta update \p array from \p base.
+void ApplyDeltaBlocks(messages::Array& array, const core::Tensor& base) {
+    const int64_t size = array.ByteSize();
+    const int64_t block_size = array.delta_block_size;
+    if (block_size <= 0) {
+        LogError("MeshDataDecoder: invalid delta block size {}", block_size);
+    }
+    const int64_t num_blocks = (size + block_size - 1) / block_size;
+    const char* base_ptr = static_cast<const char*>(base.GetDataPtr());
+    const int64_t base_size = base.NumElements();
+    core::Tensor bytes({size}, core::UInt8);
+    char* out = static_cast<char*>(bytes.GetDataPtr());
+    const char* delta = array.data.ptr;
+    const int64_t delta_size = array.data.size;
+    int64_t delta_offset = 0;
+    size_t next = 0;
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        const int64_t offset = b * block_size;
+        const int64_t n = BlockSize(b, block_size, size);
+        if (next < array.delta_blocks.size() && array.delta_blocks[next] == b) {
+            if (delta_offset + n > delta_size) {
+                LogError("MeshDataDecoder: delta update is too short");
+            }
+            std::memcpy(out + offset, delta + delta_offset, n);
+            delta_offset += n;
+            ++next;
+        } else {
+            if (offset + n > base_size) {
+                LogError("MeshDataDecoder: delta update exceeds its base");
+            }
+            std::memcpy(out + offset, base_ptr + offset, n);
+        }
+    }
+    if (next != array.delta_blocks.size() || delta_offset != delta_size) {
+        LogError("MeshDataDecoder: invalid delta blocks");
+    }
+    array.delta_base_time = -1;
+    array.delta_blocks.clear();
+    SetArrayBytes(array, bytes);
+}
+
+/// Compresses \p array with LZF if this makes it smaller.
+void CompressArray(messages::Array& array) {
+    const unsigned int size = array.data.size;
+    if (size < kMinCompressBytes) {
+        return;
+    }
+    core::Tensor bytes({int64_t(size)}, core::UInt8);
+    const unsigned int compressed_size =
+            lzf_compress(array.data.ptr, size, bytes.GetDataPtr(), size - 1);
+    if (compressed_size == 0) {
+        return;
+    }
+    array.codec = "lzf";
+    SetArrayBytes(array, bytes.Slice(0, 0, compressed_size));
+}
+
+/// Decompresses \p array to \p size bytes.
+void DecompressArray(messages::Array& array, int64_t size) {
+    if (array.codec != "lzf") {
+        LogError("MeshDataDecoder: unsupported codec {}", array.codec);
+    }
+    core::Tensor bytes({size}, core::UInt8);
+    if (size > 0 &&
+        int64_t(lzf_decompress(array.data.ptr, array.data.size,
+                               bytes.GetDataPtr(),
+                               (unsigned int)size)) != size) {
+        LogError("MeshDataDecoder: failed to decompress array");
+    }
+    array.codec.clear();
+    SetArrayBytes(array, bytes);
+}
+
+}  // namespace
+
+bool MeshDataEncoder::Encode(messages::SetMeshData& msg) {
+    bool has_delta = false;
+    msg.data.ForEachArray([&](const std::string& name,
+                              messages::Array& array) {
+        if (!array.data.ptr || array.data.size == 0) {
+            return;
+        }
+        const bool is_float = array.type == messages::TypeStr<float>() ||
+                              array.type == messages::TypeStr<double>();
+        bool owned = false;
+        if (is_float && name == "vertices" && options_.quantize_positions) {
+            if (array.type == messages::TypeStr<float>()) {
+                QuantizePositions<float>(array);
+            } else {
+                QuantizePositions<double>(array);
+            }
+            owned = true;
+        } else if (is_float && name == "vertex_attributes/colors" &&
+                   options_.colors_as_uint8) {
+            const int64_t channels = NumChannels(array);
+            QuantizeArray<uint8_t>(
+                    array, std::vector<double>(channels, 0.0),
+                    std::vector<double>(channels, 1.0 / 255.0));
+            owned = true;
+        }
+
+        if (options_.delta && options_.delta_block_size > 0) {
+            array.delta_block_size = options_.delta_block_size;
+            std::map<std::string, Base>& sent = sent_[msg.path];
+            std::vector<int64_t> blocks;
+            int64_t base_time = -1;
+            auto base = sent.find(name);
+            if (base != sent.end() && base->second.time != msg.time) {
+                blocks = ChangedBlocks(array, base->second.bytes);
+                base_time = base->second.time;
+            }
+            // The data of the caller may change after sending, keep a copy.
+            sent[name] = Base{msg.time,
+                              owned ? array.tensor_
+                                    : CopyBytes(array.data.ptr,
+                                                array.data.size)};
+            const int64_t num_blocks =
+                    (array.data.size + array.delta_block_size - 1) /
+                    array.delta_block_size;
+            if (base_time >= 0 && int64_t(blocks.size()) < num_blocks) {
+                SetDeltaBlocks(array, base_time, blocks);
+                has_delta = true;
+            }
+        }
+
+        if (options_.compress) {
+            CompressArray(array);
+        }
+    });
+    return has_delta;
+}
+
+void MeshDataDecoder::Decode(messages::SetMeshData& msg) {
+    msg.data.ForEachArray([&](const std::string& name,
+                              messages::Array& array) {
+        bool owned = false;
+        if (!array.codec.empty()) {
+            int64_t size = array.ByteSize();
+            if (array.delta_base_time >= 0) {
+                if (array.delta_block_size <= 0) {
+                    LogError("MeshDataDecoder: invalid delta block size {}",
+                             array.delta_block_size);
+                }
+                const int64_t num_blocks =
+                        (size + array.delta_block_size - 1) /
+                        array.delta_block_size;
+                int64_t delta_size = 0;
+                for (int64_t b : array.delta_blocks) {
+                    if (b < 0 || b >= num_blocks) {
+                        LogError("MeshDataDecoder: invalid delta block {}", b);
+                    }
+                    delta_size += BlockSize(b, array.delta_block_size, size);
+                }
+                size = delta_size;
+            }
+            DecompressArray(array, size);
+            owned = true;
+        }
+
+        if (array.delta_base_time >= 0) {
+            core::Tensor base;
+            bool has_base = false;
+            {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                auto& received = received_[msg.path];
+                auto it = received.find(name);
+                if (it != received.end() &&
+                    it->second.time == array.delta_base_time) {
+                    base = it->second.bytes;
+                    has_base = true;
+                }
+            }
+            if (!has_base) {
+                LogError(
+                        "MeshDataDecoder: missing base at time {} for the "
+                        "delta update of {} in {}",
+                        array.delta_base_time, name, msg.path);
+            }
+            ApplyDeltaBlocks(array, base);
+            owned = true;
+        }
+
+        if (array.delta_block_size > 0) {
+            core::Tensor bytes = owned ? array.tensor_
+                                       : CopyBytes(array.data.ptr,
+                                                   array.data.size);
+            const std::lock_guard<std::mutex> lock(mutex_);
+            received_[msg.path][name] = Base{msg.time, bytes};
+        }
+
+        if (!array.dequant_type.empty()) {
+            if (int64_t(array.data.size) != array.ByteSize()) {
+                LogError("MeshDataDecoder: array {} has {} bytes but expected "
+                         "{}",
+                         name, array.data.size, array.ByteSize());
+            }
+            DequantizeArray(array);
+        }
+    });
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,127 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace messages {
+struct SetMeshData;
+}  // namespace messages
+
+/// Options for encoding the arrays of SetMeshData messages, e.g. for
+/// streaming geometry over low bandwidth links.
+struct MeshDataEncodingOptions {
+    /// Quantize Float32 or Float64 vertex positions to 16 bit integers in the
+    /// bounding box of the message.
+    bool quantize_positions = false;
+    /// Send Float32 or Float64 vertex colors in [0,1] as UInt8.
+    bool colors_as_uint8 = false;
+    /// Compress the arrays with LZF.
+    bool compress = false;
+    /// Send only the blocks of an array which changed since the last message
+    /// with the same path, e.g. after extracting a mesh from a growing
+    /// reconstruction.
+    bool delta = false;
+    /// Block size in bytes for delta updates.
+    int64_t delta_block_size = 16384;
+};
+
+/// \class MeshDataEncoder
+///
+/// \brief Encodes the arrays of SetMeshData messages as defined by
+/// MeshDataEncodingOptions.
+///
+/// For delta updates the encoder keeps the last sent arrays of each path.
+/// All messages of a stream must therefore be encoded by the same encoder.
+class MeshDataEncoder {
+public:
+    explicit MeshDataEncoder(const MeshDataEncodingOptions& options)
+        : options_(options) {}
+
+    /// Encodes the arrays of \p msg in place. Encoded arrays keep a reference
+    /// to their data.
+    ///
+    /// \return true if at least one array is a delta update.
+    bool Encode(messages::SetMeshData& msg);
+
+    /// Forgets the arrays sent for \p path, such that the next message is
+    /// sent in full. Use this if the receiver rejected a delta update.
+    void Reset(const std::string& path) { sent_.erase(path); }
+
+    const MeshDataEncodingOptions& GetOptions() const { return options_; }
+
+private:
+    struct Base {
+        int64_t time;
+        core::Tensor bytes;
+    };
+
+    MeshDataEncodingOptions options_;
+    /// Last sent arrays by path and array name.
+    std::map<std::string, std::map<std::string, Base>> sent_;
+};
+
+/// \class MeshDataDecoder
+///
+/// \brief Decodes the arrays of SetMeshData messages encoded by
+/// MeshDataEncoder. Messages without encoded arrays are not changed.
+///
+/// The decoder keeps the arrays which are bases for delta updates. Messages
+/// with different paths can be decoded concurrently.
+class MeshDataDecoder {
+public:
+    /// Decodes the arrays of \p msg in place. Decoded arrays keep a reference
+    /// to their data. Throws if the data is invalid or the base of a delta
+    /// update is missing.
+    void Decode(messages::SetMeshData& msg);
+
+    /// Messages without arrays are not changed.
+    template <class T>
+    void Decode(T& msg) {}
+
+private:
+    struct Base {
+        int64_t time;
+        core::Tensor bytes;
+    };
+
+    std::mutex mutex_;
+    /// Last received arrays by path and array name.
+    std::map<std::string, std::map<std::string, Base>> received_;
+};
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
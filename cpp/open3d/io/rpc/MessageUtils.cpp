@@ -28,6 +28,7 @@
 
 #include <zmq.hpp>
 
+#include "open3d/io/rpc/MeshDataEncoding.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/visualization/rendering/Material.h"
@@ -382,6 +383,8 @@ DataBufferToMetaGeometry(std::string& data) {
             auto mesh_obj = oh.get();
             messages::SetMeshData msg;
             msg = mesh_obj.as<messages::SetMeshData>();
+            // Delta updates cannot be decoded without their base.
+            MeshDataDecoder().Decode(msg);
             auto result = MeshDataToGeometry(msg.data);
             double time = msg.time;
             return std::tie(msg.path, time, result);
@@ -160,6 +160,38 @@ struct Array {
     std::string type;
     std::vector<int64_t> shape;
     msgpack::type::raw_ref data;
+    /// If the data is not stored in \p data, the index of the frame after the
+    /// message frame that holds it, -1 otherwise.
+    int64_t frame = -1;
+    /// If the data is not stored in \p data, the name of the shared memory
+    /// segment that holds it at byte \p shm_offset, empty otherwise.
+    std::string shm;
+    int64_t shm_offset = 0;
+    /// Compression of \p data, empty or "lzf".
+    std::string codec;
+    /// If not empty, the data holds quantized values of \p type, which decode
+    /// to dequant_offset[c] + dequant_scale[c] * value of this type, with c
+    /// the index in the last dimension.
+    std::string dequant_type;
+    std::vector<double> dequant_offset;
+    std::vector<double> dequant_scale;
+    /// Block size in bytes if the receiver keeps the array as base for delta
+    /// updates, 0 otherwise.
+    int64_t delta_block_size = 0;
+    /// If not -1, the time of the base message with the same path and the
+    /// data only holds the blocks \p delta_blocks that changed.
+    int64_t delta_base_time = -1;
+    std::vector<int64_t> delta_blocks;
+
+    /// Returns the size of the data in bytes as given by type and shape.
+    int64_t ByteSize() const {
+        if (type.size() < 3) {
+            return 0;
+        }
+        int64_t num = std::stoll(type.substr(2));
+        for (int64_t n : shape) num *= n;
+        return num;
+    }
 
     template <class T>
     const T* Ptr() const {
@@ -267,7 +299,19 @@ struct Array {
     }
 
     // macro for creating the serialization/deserialization code
-    MSGPACK_DEFINE_MAP(type, shape, data);
+    MSGPACK_DEFINE_MAP(type,
+                       shape,
+                       data,
+                       frame,
+                       shm,
+                       shm_offset,
+                       codec,
+                       dequant_type,
+                       dequant_offset,
+                       dequant_scale,
+                       delta_block_size,
+                       delta_base_time,
+                       delta_blocks);
 };
 
 /// struct for storing MeshData, e.g., PointClouds, TriangleMesh, ..
@@ -316,6 +360,27 @@ struct MeshData {
     /// map of arrays that can be interpreted as textures
     std::map<std::string, Array> texture_maps;
 
+    /// Calls \p func with a unique name and a reference for each array, e.g.
+    /// "vertices" or "vertex_attributes/colors".
+    template <class TFunc>
+    void ForEachArray(TFunc func) {
+        func("vertices", vertices);
+        for (auto& item : vertex_attributes) {
+            func("vertex_attributes/" + item.first, item.second);
+        }
+        func("faces", faces);
+        for (auto& item : face_attributes) {
+            func("face_attributes/" + item.first, item.second);
+        }
+        func("lines", lines);
+        for (auto& item : line_attributes) {
+            func("line_attributes/" + item.first, item.second);
+        }
+        for (auto& item : texture_maps) {
+            func("texture_maps/" + item.first, item.second);
+        }
+    }
+
     void SetO3DTypeToPointCloud() { o3d_type = "PointCloud"; }
     void SetO3DTypeToLineSet() { o3d_type = "LineSet"; }
     void SetO3DTypeToTriangleMesh() { o3d_type = "TriangleMesh"; }
@@ -553,6 +618,9 @@ struct Status {
     static Status ErrorProcessingMessage() {
         return Status(3, "error while processing message");
     }
+    static Status OKSuperseded() {
+        return Status(0, "superseded by a newer message");
+    }
 
     /// return code. 0 means everything is OK.
     int32_t code;
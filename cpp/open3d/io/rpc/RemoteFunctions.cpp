@@ -41,6 +41,61 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+namespace {
+
+/// Sends \p msg with the array transport of \p connection.
+std::shared_ptr<zmq::message_t> SendEncodedMeshData(
+        messages::SetMeshData& msg, ConnectionBase& connection) {
+    std::vector<zmq::message_t> array_frames;
+    // Keeps the shared memory segment alive until the reply arrived.
+    std::shared_ptr<void> array_data = MoveArrayData(
+            msg.data, connection.GetArrayTransport(), array_frames);
+
+    msgpack::sbuffer sbuf;
+    messages::Request request{msg.MsgId()};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, msg);
+
+    if (array_frames.empty()) {
+        zmq::message_t send_msg(sbuf.data(), sbuf.size());
+        return connection.Send(send_msg);
+    }
+    std::vector<zmq::message_t> frames;
+    frames.emplace_back(sbuf.data(), sbuf.size());
+    for (zmq::message_t& frame : array_frames) {
+        frames.push_back(std::move(frame));
+    }
+    return connection.SendMultipart(frames);
+}
+
+/// Sends \p msg with the array encoding and transport of \p connection.
+bool SendMeshData(const messages::SetMeshData& msg,
+                  std::shared_ptr<ConnectionBase> connection) {
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    std::shared_ptr<MeshDataEncoder> encoder = connection->GetMeshDataEncoder();
+    bool has_delta = false;
+    auto send = [&]() {
+        messages::SetMeshData encoded = msg;
+        if (encoder) {
+            has_delta = encoder->Encode(encoded);
+        }
+        return ReplyIsOKStatus(*SendEncodedMeshData(encoded, *connection));
+    };
+    if (send()) {
+        return true;
+    }
+    if (has_delta) {
+        // The receiver may have lost the base of the delta update.
+        encoder->Reset(msg.path);
+        return send();
+    }
+    return false;
+}
+
+}  // namespace
+
 bool SetPointCloud(const geometry::PointCloud& pcd,
                    const std::string& path,
                    int time,
@@ -69,17 +124,7 @@ bool SetPointCloud(const geometry::PointCloud& pcd,
                 (double*)pcd.colors_.data(), {int64_t(pcd.colors_.size()), 3});
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMeshData(msg, connection);
 }
 
 bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
@@ -147,17 +192,7 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMeshData(msg, connection);
 }
 
 bool SetMeshData(const std::string& path,
@@ -298,17 +333,7 @@ bool SetMeshData(const std::string& path,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMeshData(msg, connection);
 }
 
 bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
@@ -26,8 +26,12 @@
 
 #include "open3d/io/rpc/ZMQReceiver.h"
 
+#include <algorithm>
+#include <chrono>
 #include <zmq.hpp>
 
+#include "open3d/io/rpc/ArrayTransport.h"
+#include "open3d/io/rpc/MeshDataEncoding.h"
 #include "open3d/io/rpc/MessageProcessorBase.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
@@ -46,19 +50,79 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+msgpack::unpack_limit UnpackLimits() {
+    return msgpack::unpack_limit(0xffffffff,  // array
+                                 0xffffffff,  // map
+                                 65536,       // str
+                                 0xffffffff,  // bin
+                                 0xffffffff,  // ext
+                                 100          // depth
+    );
+}
+
+/// References strings and binary data instead of copying them.
+bool ReferenceAll(msgpack::type::object_type, std::size_t, void*) {
+    return true;
+}
+
+/// Determines the priority of a request and, for a request with a single
+/// set_mesh_data message, its path. Only the small headers are converted.
+void ClassifyJob(const zmq::message_t& message,
+                 bool& high_priority,
+                 std::string& path) {
+    using namespace open3d::io::rpc;
+    const char* buffer = static_cast<const char*>(message.data());
+    const size_t buffer_size = message.size();
+    try {
+        size_t offset = 0;
+        auto req_handle = msgpack::unpack(buffer, buffer_size, offset,
+                                          nullptr, nullptr, UnpackLimits());
+        const auto req = req_handle.get().as<messages::Request>();
+        high_priority = req.msg_id != messages::SetMeshData::MsgId() &&
+                        req.msg_id != messages::GetMeshData::MsgId();
+        if (req.msg_id != messages::SetMeshData::MsgId()) {
+            return;
+        }
+        auto msg_handle = msgpack::unpack(buffer, buffer_size, offset,
+                                          &ReferenceAll, nullptr,
+                                          UnpackLimits());
+        const msgpack::object& msg = msg_handle.get();
+        if (offset != buffer_size || msg.type != msgpack::type::MAP) {
+            return;
+        }
+        for (uint32_t i = 0; i < msg.via.map.size; ++i) {
+            const msgpack::object_kv& kv = msg.via.map.ptr[i];
+            if (kv.key.type == msgpack::type::STR &&
+                kv.key.as<std::string>() == "path") {
+                path = kv.val.as<std::string>();
+            }
+        }
+    } catch (const std::exception&) {
+        // Invalid requests are rejected by the worker.
+        high_priority = true;
+        path.clear();
+    }
+}
 }  // namespace
 
 namespace open3d {
 namespace io {
 namespace rpc {
 
-ZMQReceiver::ZMQReceiver(const std::string& address, int timeout)
+ZMQReceiver::ZMQReceiver(const std::string& address,
+                         int timeout,
+                         int num_workers,
+                         int max_pending)
     : address_(address),
       timeout_(timeout),
       keep_running_(false),
       loop_running_(false),
       mainloop_error_code_(0),
-      mainloop_exception_("") {}
+      mainloop_exception_(""),
+      num_workers_(std::max(num_workers, 1)),
+      max_pending_(std::max(max_pending, 1)),
+      stop_workers_(false) {}
 
 ZMQReceiver::~ZMQReceiver() { Stop(); }
 
@@ -111,24 +175,33 @@ std::runtime_error ZMQReceiver::GetLastError() {
     return result;
 }
 
+struct ZMQReceiver::Job {
+    /// Routing frames of the request, up to the empty delimiter frame.
+    std::vector<zmq::message_t> envelope;
+    zmq::message_t message;
+    /// Frames following the message, which hold array data.
+    std::vector<zmq::message_t> frames;
+    /// Path of a request with a single set_mesh_data message, empty otherwise.
+    std::string path;
+    bool high_priority = true;
+};
+
 void ZMQReceiver::Mainloop() {
     context_ = GetZMQContext();
     socket_ = std::unique_ptr<zmq::socket_t>(
-            new zmq::socket_t(*context_, ZMQ_REP));
+            new zmq::socket_t(*context_, ZMQ_ROUTER));
 
     socket_->set(zmq::sockopt::linger, 0);
-    socket_->set(zmq::sockopt::rcvtimeo, 1000);
     socket_->set(zmq::sockopt::sndtimeo, timeout_);
 
-    auto limits = msgpack::unpack_limit(0xffffffff,  // array
-                                        0xffffffff,  // map
-                                        65536,       // str
-                                        0xffffffff,  // bin
-                                        0xffffffff,  // ext
-                                        100          // depth
-    );
+    // The workers send their replies to this socket.
+    const std::string reply_address =
+            fmt::format("inproc://open3d_zmq_receiver_{}", (void*)this);
+    zmq::socket_t reply_socket(*context_, ZMQ_PULL);
+    reply_socket.set(zmq::sockopt::linger, 0);
     try {
         socket_->bind(address_.c_str());
+        reply_socket.bind(reply_address.c_str());
     } catch (const zmq::error_t& err) {
         mainloop_exception_ = std::runtime_error(
                 "ZMQReceiver::Mainloop: Failed to bind address, " +
@@ -137,6 +210,21 @@ void ZMQReceiver::Mainloop() {
         return;
     }
 
+    decoder_ = std::make_shared<MeshDataDecoder>();
+    stop_workers_ = false;
+    for (int i = 0; i < num_workers_; ++i) {
+        workers_.emplace_back(&ZMQReceiver::WorkerLoop, this, reply_address);
+    }
+
+    auto forward_replies = [&]() {
+        zmq::message_t frame;
+        while (reply_socket.recv(frame, zmq::recv_flags::dontwait)) {
+            const bool more = frame.more();
+            socket_->send(frame, more ? zmq::send_flags::sndmore
+                                      : zmq::send_flags::none);
+        }
+    };
+
     loop_running_.store(true);
     while (true) {
         {
@@ -144,31 +232,180 @@ void ZMQReceiver::Mainloop() {
             if (!keep_running_) break;
         }
         try {
-            zmq::message_t message;
-            if (!socket_->recv(message)) {
+            size_t num_pending;
+            {
+                const std::lock_guard<std::mutex> lock(queue_mutex_);
+                num_pending =
+                        high_priority_jobs_.size() + low_priority_jobs_.size();
+            }
+            // Only wait for replies while too many requests are pending.
+            zmq::pollitem_t items[] = {
+                    {reply_socket.handle(), 0, ZMQ_POLLIN, 0},
+                    {socket_->handle(), 0, ZMQ_POLLIN, 0}};
+            const size_t num_items =
+                    num_pending < size_t(max_pending_) ? 2 : 1;
+            zmq::poll(items, num_items, std::chrono::milliseconds(1000));
+            if (items[0].revents & ZMQ_POLLIN) {
+                forward_replies();
+            }
+            if (num_items < 2 || !(items[1].revents & ZMQ_POLLIN)) {
                 continue;
             }
 
-            const char* buffer = (char*)message.data();
-            size_t buffer_size = message.size();
+            std::vector<zmq::message_t> parts;
+            do {
+                parts.emplace_back();
+                if (!socket_->recv(parts.back(), zmq::recv_flags::dontwait)) {
+                    parts.pop_back();
+                    break;
+                }
+            } while (parts.back().more());
+            size_t delimiter = 0;
+            while (delimiter < parts.size() && parts[delimiter].size()) {
+                ++delimiter;
+            }
+            if (delimiter + 1 >= parts.size()) {
+                LogInfo("ZMQReceiver::Mainloop: ignoring request without "
+                        "routing information");
+                continue;
+            }
+            auto job = std::make_shared<Job>();
+            for (size_t i = 0; i <= delimiter; ++i) {
+                job->envelope.push_back(std::move(parts[i]));
+            }
+            job->message = std::move(parts[delimiter + 1]);
+            for (size_t i = delimiter + 2; i < parts.size(); ++i) {
+                job->frames.push_back(std::move(parts[i]));
+            }
+            ClassifyJob(job->message, job->high_priority, job->path);
 
-            std::vector<std::shared_ptr<zmq::message_t>> replies;
+            std::shared_ptr<Job> superseded = Enqueue(job);
+            if (superseded) {
+                auto reply = CreateStatusMessage(
+                        messages::Status::OKSuperseded());
+                for (zmq::message_t& frame : superseded->envelope) {
+                    socket_->send(frame, zmq::send_flags::sndmore);
+                }
+                socket_->send(*reply, zmq::send_flags::none);
+            }
+        } catch (const zmq::error_t& err) {
+            LogInfo("ZMQReceiver::Mainloop: {}", err.what());
+        }
+    }
 
-            size_t offset = 0;
-            while (offset < buffer_size) {
-                messages::Request req;
-                try {
-                    auto obj_handle =
-                            msgpack::unpack(buffer, buffer_size, offset,
-                                            nullptr, nullptr, limits);
-                    auto obj = obj_handle.get();
-                    req = obj.as<messages::Request>();
+    // Process the received requests before closing the socket.
+    {
+        const std::lock_guard<std::mutex> lock(queue_mutex_);
+        stop_workers_ = true;
+    }
+    queue_changed_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+    try {
+        forward_replies();
+    } catch (const zmq::error_t& err) {
+        LogInfo("ZMQReceiver::Mainloop: {}", err.what());
+    }
+    reply_socket.close();
+    socket_->close();
+    decoder_.reset();
+    loop_running_.store(false);
+}
 
-                    if (!processor_) {
-                        LogError(
-                                "ZMQReceiver::Mainloop: message processor is "
-                                "null!");
+void ZMQReceiver::WorkerLoop(const std::string& reply_address) {
+    zmq::socket_t reply_socket(*context_, ZMQ_PUSH);
+    reply_socket.set(zmq::sockopt::linger, timeout_);
+    reply_socket.connect(reply_address.c_str());
+    while (std::shared_ptr<Job> job = Dequeue()) {
+        std::shared_ptr<zmq::message_t> reply = ProcessJob(*job);
+        if (!job->path.empty()) {
+            {
+                const std::lock_guard<std::mutex> lock(queue_mutex_);
+                busy_paths_.erase(job->path);
+            }
+            queue_changed_.notify_all();
+        }
+        try {
+            for (zmq::message_t& frame : job->envelope) {
+                reply_socket.send(frame, zmq::send_flags::sndmore);
+            }
+            reply_socket.send(*reply, zmq::send_flags::none);
+        } catch (const zmq::error_t& err) {
+            LogInfo("ZMQReceiver::WorkerLoop: {}", err.what());
+        }
+    }
+    reply_socket.close();
+}
+
+std::shared_ptr<ZMQReceiver::Job> ZMQReceiver::Enqueue(
+        std::shared_ptr<Job> job) {
+    std::shared_ptr<Job> superseded;
+    {
+        const std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (!job->path.empty()) {
+            for (std::shared_ptr<Job>& pending : low_priority_jobs_) {
+                if (pending->path == job->path) {
+                    superseded = pending;
+                    pending = job;
+                    break;
+                }
+            }
+        }
+        if (!superseded) {
+            (job->high_priority ? high_priority_jobs_ : low_priority_jobs_)
+                    .push_back(job);
+        }
+    }
+    queue_changed_.notify_one();
+    return superseded;
+}
+
+std::shared_ptr<ZMQReceiver::Job> ZMQReceiver::Dequeue() {
+    std::unique_lock<std::mutex> lock(queue_mutex_);
+    while (true) {
+        for (auto* jobs : {&high_priority_jobs_, &low_priority_jobs_}) {
+            for (auto it = jobs->begin(); it != jobs->end(); ++it) {
+                std::shared_ptr<Job> job = *it;
+                if (job->path.empty() || !busy_paths_.count(job->path)) {
+                    jobs->erase(it);
+                    if (!job->path.empty()) {
+                        busy_paths_.insert(job->path);
                     }
+                    return job;
+                }
+            }
+        }
+        if (stop_workers_ && high_priority_jobs_.empty() &&
+            low_priority_jobs_.empty()) {
+            return nullptr;
+        }
+        queue_changed_.wait(lock);
+    }
+}
+
+std::shared_ptr<zmq::message_t> ZMQReceiver::ProcessJob(Job& job) {
+    const char* buffer = (char*)job.message.data();
+    size_t buffer_size = job.message.size();
+    const std::vector<zmq::message_t>& frames = job.frames;
+    std::vector<std::shared_ptr<void>> mappings;
+    const msgpack::unpack_limit limits = UnpackLimits();
+
+    std::vector<std::shared_ptr<zmq::message_t>> replies;
+
+    size_t offset = 0;
+    while (offset < buffer_size) {
+        messages::Request req;
+        try {
+            auto obj_handle = msgpack::unpack(buffer, buffer_size, offset,
+                                              nullptr, nullptr, limits);
+            auto obj = obj_handle.get();
+            req = obj.as<messages::Request>();
+
+            if (!processor_) {
+                LogError("ZMQReceiver::Mainloop: message processor is null!");
+            }
 #define PROCESS_MESSAGE(MSGTYPE)                                        \
     else if (MSGTYPE::MsgId() == req.msg_id) {                          \
         auto oh = msgpack::unpack(buffer, buffer_size, offset, nullptr, \
@@ -176,6 +413,8 @@ void ZMQReceiver::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        ResolveArrayData(msg, frames, mappings);                        \
+        decoder_->Decode(msg);                                          \
         auto reply = processor_->ProcessMessage(req, msg, oh);          \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
@@ -184,49 +423,42 @@ void ZMQReceiver::Mainloop() {
                     messages::Status::ErrorProcessingMessage()));       \
         }                                                               \
     }
-                    PROCESS_MESSAGE(messages::SetMeshData)
-                    PROCESS_MESSAGE(messages::GetMeshData)
-                    PROCESS_MESSAGE(messages::SetCameraData)
-                    PROCESS_MESSAGE(messages::SetProperties)
-                    PROCESS_MESSAGE(messages::SetActiveCamera)
-                    PROCESS_MESSAGE(messages::SetTime)
-                    else {
-                        LogInfo("ZMQReceiver::Mainloop: unsupported msg "
-                                "id '{}'",
-                                req.msg_id);
-                        auto status = messages::Status::ErrorUnsupportedMsgId();
-                        replies.push_back(CreateStatusMessage(status));
-                        break;
-                    }
-                } catch (std::exception& err) {
-                    LogInfo("ZMQReceiver::Mainloop:a {}", err.what());
-                    auto status = messages::Status::ErrorUnpackingFailed();
-                    status.str += std::string(" with ") + err.what();
-                    replies.push_back(CreateStatusMessage(status));
-                    break;
-                }
+            PROCESS_MESSAGE(messages::SetMeshData)
+            PROCESS_MESSAGE(messages::GetMeshData)
+            PROCESS_MESSAGE(messages::SetCameraData)
+            PROCESS_MESSAGE(messages::SetProperties)
+            PROCESS_MESSAGE(messages::SetActiveCamera)
+            PROCESS_MESSAGE(messages::SetTime)
+            else {
+                LogInfo("ZMQReceiver::Mainloop: unsupported msg "
+                        "id '{}'",
+                        req.msg_id);
+                auto status = messages::Status::ErrorUnsupportedMsgId();
+                replies.push_back(CreateStatusMessage(status));
+                break;
             }
-            if (replies.size() == 1) {
-                socket_->send(*replies[0], zmq::send_flags::none);
-            } else {
-                size_t size = 0;
-                for (auto r : replies) {
-                    size += r->size();
-                }
-                zmq::message_t reply(size);
-                size_t offset = 0;
-                for (auto r : replies) {
-                    memcpy((char*)reply.data() + offset, r->data(), r->size());
-                    offset += r->size();
-                }
-                socket_->send(reply, zmq::send_flags::none);
-            }
-        } catch (const zmq::error_t& err) {
-            LogInfo("ZMQReceiver::Mainloop: {}", err.what());
+        } catch (std::exception& err) {
+            LogInfo("ZMQReceiver::Mainloop:a {}", err.what());
+            auto status = messages::Status::ErrorUnpackingFailed();
+            status.str += std::string(" with ") + err.what();
+            replies.push_back(CreateStatusMessage(status));
+            break;
         }
     }
-    socket_->close();
-    loop_running_.store(false);
+    if (replies.size() == 1) {
+        return replies[0];
+    }
+    size_t size = 0;
+    for (auto r : replies) {
+        size += r->size();
+    }
+    auto reply = std::make_shared<zmq::message_t>(size);
+    offset = 0;
+    for (auto r : replies) {
+        memcpy((char*)reply->data() + offset, r->data(), r->size());
+        offset += r->size();
+    }
+    return reply;
 }
 
 void ZMQReceiver::SetMessageProcessor(
@@ -27,8 +27,14 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "open3d/utility/Logging.h"
 
@@ -43,6 +49,7 @@ namespace io {
 namespace rpc {
 
 class MessageProcessorBase;
+class MeshDataDecoder;
 
 namespace messages {
 struct Request;
@@ -55,13 +62,25 @@ struct SetTime;
 }  // namespace messages
 
 /// Class for the server side receiving requests from a client.
+///
+/// The mainloop thread only receives requests and sends replies, while a pool
+/// of worker threads processes the requests. Requests without mesh data, e.g.
+/// camera updates, are processed first. A pending set_mesh_data request is
+/// dropped if a newer one for the same path arrives, and requests for the same
+/// path are processed in order. The receiver stops receiving while too many
+/// requests are pending, which blocks the senders.
 class ZMQReceiver {
 public:
     /// Constructs a receiver listening on the specified address.
     /// \param address  Address to listen on.
     /// \param timeout       Timeout in milliseconds for sending the reply.
+    /// \param num_workers   Number of threads processing requests. For more
+    /// than one thread the message processor must be thread safe.
+    /// \param max_pending   Maximum number of requests waiting for a worker.
     ZMQReceiver(const std::string& address = "tcp://127.0.0.1:51454",
-                int timeout = 10000);
+                int timeout = 10000,
+                int num_workers = 1,
+                int max_pending = 64);
 
     ZMQReceiver(const ZMQReceiver&) = delete;
     ZMQReceiver& operator=(const ZMQReceiver&) = delete;
@@ -83,7 +102,19 @@ public:
     void SetMessageProcessor(std::shared_ptr<MessageProcessorBase> processor);
 
 private:
+    struct Job;
+
     void Mainloop();
+    void WorkerLoop(const std::string& reply_address);
+
+    /// Queues \p job. Returns the pending job superseded by \p job or
+    /// nullptr.
+    std::shared_ptr<Job> Enqueue(std::shared_ptr<Job> job);
+    /// Waits for the next job whose path is not being processed. Returns
+    /// nullptr if the workers are stopped and no jobs are left.
+    std::shared_ptr<Job> Dequeue();
+    /// Processes the messages of \p job and returns the reply.
+    std::shared_ptr<zmq::message_t> ProcessJob(Job& job);
 
     const std::string address_;
     const int timeout_;
@@ -96,6 +127,19 @@ private:
     std::atomic<int> mainloop_error_code_;
     std::runtime_error mainloop_exception_;
     std::shared_ptr<MessageProcessorBase> processor_;
+
+    const int num_workers_;
+    const int max_pending_;
+    std::vector<std::thread> workers_;
+    /// Keeps the bases for delta updates of the arrays.
+    std::shared_ptr<MeshDataDecoder> decoder_;
+    std::mutex queue_mutex_;
+    std::condition_variable queue_changed_;
+    std::deque<std::shared_ptr<Job>> high_priority_jobs_;
+    std::deque<std::shared_ptr<Job>> low_priority_jobs_;
+    /// Paths of the set_mesh_data requests being processed.
+    std::set<std::string> busy_paths_;
+    bool stop_workers_;
 };
 
 }  // namespace rpc
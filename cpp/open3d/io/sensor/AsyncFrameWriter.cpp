@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/sensor/AsyncFrameWriter.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace io {
+
+std::string AsyncFrameWriterStatistics::ToString() const {
+    return fmt::format(
+            "AsyncFrameWriterStatistics: {} written, {} dropped, {} failed, "
+            "queue depth {} (max {})",
+            num_written, num_dropped, num_failed, queue_depth,
+            max_queue_depth);
+}
+
+AsyncFrameWriter::AsyncFrameWriter(size_t max_queue_size, bool block_when_full)
+    : max_queue_size_(std::max<size_t>(max_queue_size, 1)),
+      block_when_full_(block_when_full),
+      thread_(&AsyncFrameWriter::WriteLoop, this) {}
+
+AsyncFrameWriter::~AsyncFrameWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    frame_queued_.notify_one();
+    thread_.join();
+}
+
+bool AsyncFrameWriter::Submit(WriteFunction write) {
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (block_when_full_) {
+            frame_written_.wait(
+                    lock, [this] { return queue_.size() < max_queue_size_; });
+        } else if (queue_.size() >= max_queue_size_) {
+            ++statistics_.num_dropped;
+            return false;
+        }
+        queue_.push_back(std::move(write));
+        statistics_.max_queue_depth =
+                std::max(statistics_.max_queue_depth, queue_.size());
+    }
+    frame_queued_.notify_one();
+    return true;
+}
+
+void AsyncFrameWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    frame_written_.wait(lock,
+                        [this] { return queue_.empty() && !is_writing_; });
+}
+
+AsyncFrameWriterStatistics AsyncFrameWriter::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AsyncFrameWriterStatistics statistics = statistics_;
+    statistics.queue_depth = queue_.size();
+    return statistics;
+}
+
+void AsyncFrameWriter::WriteLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        frame_queued_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        // Queued frames are written before stopping.
+        if (queue_.empty()) {
+            return;
+        }
+        WriteFunction write = std::move(queue_.front());
+        queue_.pop_front();
+        is_writing_ = true;
+        lock.unlock();
+
+        bool success = false;
+        try {
+            success = write();
+        } catch (const std::exception &e) {
+            utility::LogWarning("Write frame failed with exception: {}",
+                                e.what());
+        }
+        // Release the frame before signaling Flush().
+        write = nullptr;
+
+        lock.lock();
+        is_writing_ = false;
+        if (success) {
+            ++statistics_.num_written;
+        } else {
+            ++statistics_.num_failed;
+        }
+        frame_written_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace open3d
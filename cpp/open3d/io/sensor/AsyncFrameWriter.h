@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace open3d {
+namespace io {
+
+/// Counters of an AsyncFrameWriter.
+struct AsyncFrameWriterStatistics {
+    /// Frames written successfully.
+    int64_t num_written = 0;
+    /// Frames dropped because the queue was full.
+    int64_t num_dropped = 0;
+    /// Frames whose write function failed.
+    int64_t num_failed = 0;
+    /// Frames waiting in the queue.
+    size_t queue_depth = 0;
+    /// Largest queue depth seen so far.
+    size_t max_queue_depth = 0;
+
+    std::string ToString() const;
+};
+
+/// \class AsyncFrameWriter
+///
+/// \brief Writes frames on a separate thread, so that stalls of the disk do
+/// not delay the capture thread.
+///
+/// Frames are submitted as write functions, which own the frame data, e.g.
+/// through a reference counted handle. The functions run in submission order.
+/// If the queue is full, new frames are dropped unless the writer blocks.
+class AsyncFrameWriter {
+public:
+    /// Write function, returns false if the frame could not be written.
+    typedef std::function<bool()> WriteFunction;
+
+    /// \param max_queue_size Maximum number of queued frames.
+    /// \param block_when_full Wait for a free queue slot in Submit() instead
+    /// of dropping the frame.
+    explicit AsyncFrameWriter(size_t max_queue_size = 30,
+                              bool block_when_full = false);
+    /// Writes all queued frames.
+    ~AsyncFrameWriter();
+
+    AsyncFrameWriter(const AsyncFrameWriter &) = delete;
+    AsyncFrameWriter &operator=(const AsyncFrameWriter &) = delete;
+
+    /// Queue a frame. Returns false if it was dropped, in which case \p write
+    /// is destroyed without being called.
+    bool Submit(WriteFunction write);
+
+    /// Wait until all queued frames are written.
+    void Flush();
+
+    AsyncFrameWriterStatistics GetStatistics() const;
+
+private:
+    void WriteLoop();
+
+    size_t max_queue_size_;
+    bool block_when_full_;
+    std::deque<WriteFunction> queue_;
+    /// A frame taken from the queue is being written.
+    bool is_writing_ = false;
+    bool stop_ = false;
+    AsyncFrameWriterStatistics statistics_;
+    mutable std::mutex mutex_;
+    /// Signals new frames and stop_ to the writer thread.
+    std::condition_variable frame_queued_;
+    /// Signals written frames to Submit() and Flush().
+    std::condition_variable frame_written_;
+    std::thread thread_;
+};
+
+}  // namespace io
+}  // namespace open3d
@@ -49,10 +49,13 @@ namespace open3d {
 namespace io {
 
 AzureKinectRecorder::AzureKinectRecorder(
-        const AzureKinectSensorConfig& sensor_config, size_t sensor_index)
+        const AzureKinectSensorConfig& sensor_config,
+        size_t sensor_index,
+        size_t write_queue_size)
     : RGBDRecorder(),
       sensor_(AzureKinectSensor(sensor_config)),
-      device_index_(sensor_index) {}
+      device_index_(sensor_index),
+      write_queue_size_(write_queue_size) {}
 
 AzureKinectRecorder::~AzureKinectRecorder() { CloseRecord(); }
 
@@ -76,6 +79,9 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
         }
         utility::LogInfo("Writing to header");
 
+        if (write_queue_size_ > 0) {
+            writer_.reset(new AsyncFrameWriter(write_queue_size_));
+        }
         is_record_created_ = true;
     }
     return true;
@@ -84,6 +90,11 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
 bool AzureKinectRecorder::CloseRecord() {
     if (is_record_created_) {
         utility::LogInfo("Saving recording...");
+        if (writer_) {
+            writer_->Flush();
+            utility::LogInfo("{}", writer_->GetStatistics().ToString());
+            writer_.reset();
+        }
         if (K4A_FAILED(k4a_plugin::k4a_record_flush(recording_))) {
             utility::LogWarning("Unable to flush record file");
             return false;
@@ -96,12 +107,30 @@ bool AzureKinectRecorder::CloseRecord() {
     return true;
 }
 
+AsyncFrameWriterStatistics AzureKinectRecorder::GetWriterStatistics() const {
+    return writer_ ? writer_->GetStatistics() : AsyncFrameWriterStatistics();
+}
+
 std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
         bool write, bool enable_align_depth_to_color) {
     k4a_capture_t capture = sensor_.CaptureRawFrame();
     if (capture != nullptr && is_record_created_ && write) {
-        if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(recording_,
-                                                            capture))) {
+        if (writer_) {
+            // The writer thread holds its own reference to the capture.
+            k4a_plugin::k4a_capture_reference(capture);
+            std::shared_ptr<_k4a_capture_t> held(
+                    capture, k4a_plugin::k4a_capture_release);
+            k4a_record_t recording = recording_;
+            writer_->Submit([recording, held]() {
+                if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(
+                            recording, held.get()))) {
+                    utility::LogWarning("Unable to write to capture");
+                    return false;
+                }
+                return true;
+            });
+        } else if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(
+                           recording_, capture))) {
             utility::LogError("Unable to write to capture");
         }
     }
@@ -110,11 +139,13 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
             capture, enable_align_depth_to_color
                              ? sensor_.transform_depth_to_color_
                              : nullptr);
+    if (capture != nullptr) {
+        k4a_plugin::k4a_capture_release(capture);
+    }
     if (im_rgbd == nullptr) {
         utility::LogInfo("Invalid capture, skipping this frame");
         return nullptr;
     }
-    k4a_plugin::k4a_capture_release(capture);
     return im_rgbd;
 }
 }  // namespace io
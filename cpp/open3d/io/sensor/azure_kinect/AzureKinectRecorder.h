@@ -30,6 +30,7 @@
 #include <memory>
 #include <string>
 
+#include "open3d/io/sensor/AsyncFrameWriter.h"
 #include "open3d/io/sensor/RGBDRecorder.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensor.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensorConfig.h"
@@ -50,8 +51,15 @@ namespace io {
 /// AzureKinect recorder.
 class AzureKinectRecorder : public RGBDRecorder {
 public:
+    /// \param sensor_config Sensor configuration. Its MJPG color format,
+    /// the default, has the color images compressed by the camera.
+    /// \param sensor_index Index of the device.
+    /// \param write_queue_size Frames are written to the mkv file by a
+    /// separate thread, with at most this many frames queued. New frames are
+    /// dropped while the queue is full. 0 writes on the capture thread.
     AzureKinectRecorder(const AzureKinectSensorConfig& sensor_config,
-                        size_t sensor_index);
+                        size_t sensor_index,
+                        size_t write_queue_size = 30);
     ~AzureKinectRecorder() override;
 
     /// Initialize sensor.
@@ -73,10 +81,16 @@ public:
     /// Check if the mkv file is created.
     bool IsRecordCreated() { return is_record_created_; }
 
+    /// Statistics of the writer thread of the current recording, e.g. to
+    /// monitor the queue depth and the dropped frames.
+    AsyncFrameWriterStatistics GetWriterStatistics() const;
+
 protected:
     AzureKinectSensor sensor_;
     _k4a_record_t* recording_;
     size_t device_index_;
+    size_t write_queue_size_;
+    std::unique_ptr<AsyncFrameWriter> writer_;
 
     bool is_record_created_ = false;
 };
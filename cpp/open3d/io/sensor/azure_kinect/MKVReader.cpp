@@ -32,14 +32,33 @@
 #include <k4arecord/record.h>
 #include <turbojpeg.h>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <limits>
 
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensor.h"
 #include "open3d/io/sensor/azure_kinect/K4aPlugin.h"
+#include "open3d/utility/FileSystem.h"
 
 namespace open3d {
 namespace io {
 
+namespace {
+
+const char kIndexMagic[8] = {'O', '3', 'D', 'M', 'K', 'V', 'I', '1'};
+
+/// Frames closer than this to the current position are reached by reading
+/// instead of seeking.
+const size_t kMaxFramesToSkip = 8;
+
+int64_t GetFileSize(const std::string &filename) {
+    utility::filesystem::CFile file;
+    return file.Open(filename, "rb") ? file.GetFileSize() : -1;
+}
+
+}  // namespace
+
 MKVReader::MKVReader() : handle_(nullptr), transformation_(nullptr) {}
 
 bool MKVReader::IsOpened() { return handle_ != nullptr; }
@@ -72,11 +91,24 @@ bool MKVReader::Open(const std::string &filename) {
 
     metadata_.ConvertFromJsonValue(GetMetadataJson());
     is_eof_ = false;
+    filename_ = filename;
+    frame_timestamps_.clear();
+    has_index_ = false;
+    next_frame_ = 0;
+    is_next_frame_known_ = true;
+    cache_.clear();
+    cache_map_.clear();
 
     return true;
 }
 
-void MKVReader::Close() { k4a_plugin::k4a_playback_close(handle_); }
+void MKVReader::Close() {
+    k4a_plugin::k4a_playback_close(handle_);
+    frame_timestamps_.clear();
+    has_index_ = false;
+    cache_.clear();
+    cache_map_.clear();
+}
 
 Json::Value MKVReader::GetMetadataJson() {
     static const std::unordered_map<std::string, std::pair<int, int>>
@@ -152,6 +184,13 @@ bool MKVReader::SeekTimestamp(size_t timestamp) {
         utility::LogWarning("Unable to go to timestamp {}", timestamp);
         return false;
     }
+    is_eof_ = false;
+    if (has_index_) {
+        next_frame_ = std::lower_bound(frame_timestamps_.begin(),
+                                       frame_timestamps_.end(), timestamp) -
+                      frame_timestamps_.begin();
+    }
+    is_next_frame_known_ = has_index_;
     return true;
 }
 
@@ -167,7 +206,9 @@ std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
         utility::LogInfo("EOF reached");
         is_eof_ = true;
         return nullptr;
-    } else if (K4A_STREAM_RESULT_FAILED == res) {
+    }
+    ++next_frame_;
+    if (K4A_STREAM_RESULT_FAILED == res) {
         utility::LogInfo("Empty frame encountered, skip");
         return nullptr;
     }
@@ -178,5 +219,220 @@ std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
 
     return rgbd;
 }
+
+size_t MKVReader::GetNumFrames() {
+    LoadIndex();
+    return frame_timestamps_.size();
+}
+
+size_t MKVReader::GetFrameTimestamp(size_t index) {
+    LoadIndex();
+    if (index >= frame_timestamps_.size()) {
+        utility::LogError("Frame {} exceeds the number of frames {}.", index,
+                          frame_timestamps_.size());
+    }
+    return frame_timestamps_[index];
+}
+
+bool MKVReader::SeekFrame(size_t index) {
+    LoadIndex();
+    if (index >= frame_timestamps_.size()) {
+        utility::LogWarning("Frame {} exceeds the number of frames {}.", index,
+                            frame_timestamps_.size());
+        return false;
+    }
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_seek_timestamp(
+                handle_, frame_timestamps_[index], K4A_PLAYBACK_SEEK_BEGIN)) {
+        utility::LogWarning("Unable to go to frame {}", index);
+        return false;
+    }
+    is_eof_ = false;
+    // Frames without images share the timestamp of the previous frame, so the
+    // seek may land before frame index.
+    next_frame_ = std::lower_bound(frame_timestamps_.begin(),
+                                   frame_timestamps_.end(),
+                                   frame_timestamps_[index]) -
+                  frame_timestamps_.begin();
+    is_next_frame_known_ = true;
+    return true;
+}
+
+std::shared_ptr<geometry::RGBDImage> MKVReader::GetFrame(size_t index) {
+    auto cached = cache_map_.find(index);
+    if (cached != cache_map_.end()) {
+        cache_.splice(cache_.begin(), cache_, cached->second);
+        return cached->second->second;
+    }
+
+    LoadIndex();
+    if (!is_next_frame_known_ || next_frame_ > index ||
+        next_frame_ + kMaxFramesToSkip < index) {
+        if (!SeekFrame(index)) {
+            return nullptr;
+        }
+    }
+    // Skip frames without decoding them.
+    while (next_frame_ < index) {
+        k4a_capture_t k4a_capture;
+        k4a_stream_result_t res = k4a_plugin::k4a_playback_get_next_capture(
+                handle_, &k4a_capture);
+        if (K4A_STREAM_RESULT_EOF == res) {
+            is_eof_ = true;
+            return nullptr;
+        }
+        if (K4A_STREAM_RESULT_SUCCEEDED == res) {
+            k4a_plugin::k4a_capture_release(k4a_capture);
+        }
+        ++next_frame_;
+    }
+
+    auto rgbd = NextFrame();
+    if (rgbd == nullptr || cache_size_ == 0) {
+        return rgbd;
+    }
+    // NextFrame() reuses its image buffers, so cache a copy.
+    rgbd = std::make_shared<geometry::RGBDImage>(*rgbd);
+    cache_.emplace_front(index, rgbd);
+    cache_map_[index] = cache_.begin();
+    if (cache_.size() > cache_size_) {
+        cache_map_.erase(cache_.back().first);
+        cache_.pop_back();
+    }
+    return rgbd;
+}
+
+void MKVReader::SetCacheSize(size_t cache_size) {
+    cache_size_ = cache_size;
+    while (cache_.size() > cache_size_) {
+        cache_map_.erase(cache_.back().first);
+        cache_.pop_back();
+    }
+}
+
+void MKVReader::LoadIndex() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    if (has_index_) {
+        return;
+    }
+    const std::string index_filename = filename_ + ".o3dindex";
+    if (ReadIndexFile(index_filename)) {
+        has_index_ = true;
+        return;
+    }
+
+    utility::LogInfo("Building frame index of {}", filename_);
+    k4a_record_configuration_t config;
+    if (K4A_RESULT_SUCCEEDED !=
+        k4a_plugin::k4a_playback_get_record_configuration(handle_, &config)) {
+        utility::LogError("Failed to get record configuration");
+    }
+    if (K4A_RESULT_SUCCEEDED != k4a_plugin::k4a_playback_seek_timestamp(
+                                        handle_, 0, K4A_PLAYBACK_SEEK_BEGIN)) {
+        utility::LogError("Unable to go to the beginning of {}", filename_);
+    }
+    frame_timestamps_.clear();
+    while (true) {
+        k4a_capture_t k4a_capture;
+        k4a_stream_result_t res = k4a_plugin::k4a_playback_get_next_capture(
+                handle_, &k4a_capture);
+        if (K4A_STREAM_RESULT_EOF == res) {
+            break;
+        }
+        uint64_t timestamp = std::numeric_limits<uint64_t>::max();
+        if (K4A_STREAM_RESULT_SUCCEEDED == res) {
+            for (k4a_image_t image :
+                 {k4a_plugin::k4a_capture_get_color_image(k4a_capture),
+                  k4a_plugin::k4a_capture_get_depth_image(k4a_capture)}) {
+                if (image != nullptr) {
+                    timestamp = std::min(
+                            timestamp,
+                            k4a_plugin::k4a_image_get_timestamp_usec(image));
+                    k4a_plugin::k4a_image_release(image);
+                }
+            }
+            k4a_plugin::k4a_capture_release(k4a_capture);
+        }
+        if (timestamp == std::numeric_limits<uint64_t>::max()) {
+            timestamp = frame_timestamps_.empty() ? 0
+                                                  : frame_timestamps_.back();
+        } else {
+            // Seeking from the beginning is relative to the first timestamp.
+            timestamp -= std::min<uint64_t>(timestamp,
+                                            config.start_timestamp_offset_usec);
+        }
+        frame_timestamps_.push_back(timestamp);
+    }
+    has_index_ = true;
+    if (!WriteIndexFile(index_filename)) {
+        utility::LogWarning("Unable to write frame index {}", index_filename);
+    }
+
+    // Go back to the frame NextFrame() would have returned.
+    const size_t next_frame = is_next_frame_known_ ? next_frame_ : 0;
+    if (next_frame < frame_timestamps_.size()) {
+        SeekFrame(next_frame);
+    } else {
+        next_frame_ = next_frame;
+        is_next_frame_known_ = true;
+    }
+}
+
+bool MKVReader::ReadIndexFile(const std::string &index_filename) {
+    if (!utility::filesystem::FileExists(index_filename)) {
+        return false;
+    }
+    utility::filesystem::CFile file;
+    if (!file.Open(index_filename, "rb")) {
+        return false;
+    }
+    // The header holds the mkv file size, the stream length and the number
+    // of frames.
+    char magic[sizeof(kIndexMagic)];
+    uint64_t header[3];
+    if (file.ReadData(magic, 1, sizeof(magic)) != sizeof(magic) ||
+        std::memcmp(magic, kIndexMagic, sizeof(magic)) != 0 ||
+        file.ReadData(header, sizeof(uint64_t), 3) != 3) {
+        utility::LogWarning("Invalid frame index {}", index_filename);
+        return false;
+    }
+    if (int64_t(header[0]) != GetFileSize(filename_) ||
+        header[1] != metadata_.stream_length_usec_) {
+        utility::LogInfo("Frame index {} is out of date.", index_filename);
+        return false;
+    }
+    frame_timestamps_.resize(header[2]);
+    if (file.ReadData(frame_timestamps_.data(), sizeof(uint64_t),
+                      frame_timestamps_.size()) != frame_timestamps_.size()) {
+        utility::LogWarning("Invalid frame index {}", index_filename);
+        frame_timestamps_.clear();
+        return false;
+    }
+    return true;
+}
+
+bool MKVReader::WriteIndexFile(const std::string &index_filename) {
+    FILE *file = utility::filesystem::FOpen(index_filename, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const uint64_t header[3] = {uint64_t(GetFileSize(filename_)),
+                                metadata_.stream_length_usec_,
+                                uint64_t(frame_timestamps_.size())};
+    bool success =
+            fwrite(kIndexMagic, 1, sizeof(kIndexMagic), file) ==
+                    sizeof(kIndexMagic) &&
+            fwrite(header, sizeof(uint64_t), 3, file) == 3 &&
+            fwrite(frame_timestamps_.data(), sizeof(uint64_t),
+                   frame_timestamps_.size(),
+                   file) == frame_timestamps_.size();
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        utility::filesystem::RemoveFile(index_filename);
+    }
+    return success;
+}
 }  // namespace io
 }  // namespace open3d
@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <list>
+#include <unordered_map>
+#include <vector>
+
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/sensor/azure_kinect/MKVMetadata.h"
 #include "open3d/utility/IJsonConvertible.h"
@@ -41,6 +45,11 @@ namespace io {
 /// \class MKVReader
 ///
 /// AzureKinect mkv file reader.
+///
+/// For random access, the reader keeps an index with the timestamp of every
+/// frame. The index is built by scanning the file on the first random access
+/// and stored next to it, in filename + ".o3dindex", for the next time the
+/// file is opened. Frames returned by GetFrame() are kept in an LRU cache.
 class MKVReader {
 public:
     /// \brief Default Constructor.
@@ -66,14 +75,45 @@ public:
     /// Get next frame from the mkv playback and returns the RGBD object.
     std::shared_ptr<geometry::RGBDImage> NextFrame();
 
+    /// Number of frames in the mkv playback. Loads or builds the index.
+    size_t GetNumFrames();
+    /// Timestamp (in us) of frame \p index. Loads or builds the index.
+    size_t GetFrameTimestamp(size_t index);
+    /// Seek to frame \p index. Loads or builds the index.
+    bool SeekFrame(size_t index);
+    /// Get frame \p index from the cache or from the mkv playback. Returns
+    /// nullptr if the frame has no color or depth image.
+    std::shared_ptr<geometry::RGBDImage> GetFrame(size_t index);
+    /// Set the maximum number of frames in the cache of GetFrame().
+    void SetCacheSize(size_t cache_size);
+
 private:
     _k4a_playback_t *handle_;
     _k4a_transformation_t *transformation_;
     MKVMetadata metadata_;
     bool is_eof_ = false;
+    std::string filename_;
+
+    /// Timestamp (in us) of each frame, empty until the index is loaded.
+    std::vector<uint64_t> frame_timestamps_;
+    bool has_index_ = false;
+    /// Index of the frame returned by the next NextFrame() call, if known.
+    size_t next_frame_ = 0;
+    bool is_next_frame_known_ = true;
+
+    /// Frames returned by GetFrame(), most recently used first.
+    typedef std::pair<size_t, std::shared_ptr<geometry::RGBDImage>>
+            CacheEntry;
+    std::list<CacheEntry> cache_;
+    std::unordered_map<size_t, std::list<CacheEntry>::iterator> cache_map_;
+    size_t cache_size_ = 16;
 
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
+    /// Load the index file or scan the playback and write it.
+    void LoadIndex();
+    bool ReadIndexFile(const std::string &index_filename);
+    bool WriteIndexFile(const std::string &index_filename);
 };
 }  // namespace io
 }  // namespace open3d
@@ -39,7 +39,8 @@ MKVWriter::MKVWriter() : handle_(nullptr) {}
 
 bool MKVWriter::Open(const std::string &filename,
                      const _k4a_device_configuration_t &config,
-                     k4a_device_t device) {
+                     k4a_device_t device,
+                     size_t write_queue_size) {
     if (IsOpened()) {
         Close();
     }
@@ -50,6 +51,9 @@ bool MKVWriter::Open(const std::string &filename,
         utility::LogWarning("Unable to open file {}", filename);
         return false;
     }
+    if (write_queue_size > 0) {
+        writer_.reset(new AsyncFrameWriter(write_queue_size));
+    }
 
     return true;
 }
@@ -67,6 +71,10 @@ bool MKVWriter::SetMetadata(const MKVMetadata &metadata) {
 }
 
 void MKVWriter::Close() {
+    if (writer_) {
+        writer_->Flush();
+        writer_.reset();
+    }
     if (K4A_RESULT_SUCCEEDED != k4a_plugin::k4a_record_flush(handle_)) {
         utility::LogWarning("Unable to flush before writing");
     }
@@ -79,6 +87,22 @@ bool MKVWriter::NextFrame(k4a_capture_t capture) {
         return false;
     }
 
+    if (writer_) {
+        // The writer thread holds its own reference to the capture.
+        k4a_plugin::k4a_capture_reference(capture);
+        std::shared_ptr<_k4a_capture_t> held(capture,
+                                             k4a_plugin::k4a_capture_release);
+        k4a_record_t handle = handle_;
+        return writer_->Submit([handle, held]() {
+            if (K4A_RESULT_SUCCEEDED !=
+                k4a_plugin::k4a_record_write_capture(handle, held.get())) {
+                utility::LogWarning("Unable to write frame to mkv.");
+                return false;
+            }
+            return true;
+        });
+    }
+
     if (K4A_RESULT_SUCCEEDED !=
         k4a_plugin::k4a_record_write_capture(handle_, capture)) {
         utility::LogWarning("Unable to write frame to mkv.");
@@ -87,5 +111,9 @@ bool MKVWriter::NextFrame(k4a_capture_t capture) {
 
     return true;
 }
+
+AsyncFrameWriterStatistics MKVWriter::GetWriterStatistics() const {
+    return writer_ ? writer_->GetStatistics() : AsyncFrameWriterStatistics();
+}
 }  // namespace io
 }  // namespace open3d
@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <memory>
+
 #include "open3d/geometry/RGBDImage.h"
+#include "open3d/io/sensor/AsyncFrameWriter.h"
 #include "open3d/io/sensor/azure_kinect/MKVMetadata.h"
 #include "open3d/utility/IJsonConvertible.h"
 
@@ -46,17 +49,25 @@ public:
     bool IsOpened();
 
     /* We assume device is already set properly according to config */
+    /* With write_queue_size > 0, NextFrame() queues frames for a writer
+     * thread and drops them while the queue is full. */
     bool Open(const std::string &filename,
               const _k4a_device_configuration_t &config,
-              _k4a_device_t *device);
+              _k4a_device_t *device,
+              size_t write_queue_size = 0);
     void Close();
 
     bool SetMetadata(const MKVMetadata &metadata);
+    /* Returns false if the frame was dropped or, when writing synchronously,
+     * could not be written. */
     bool NextFrame(_k4a_capture_t *);
 
+    AsyncFrameWriterStatistics GetWriterStatistics() const;
+
 private:
     _k4a_record_t *handle_;
     MKVMetadata metadata_;
+    std::unique_ptr<AsyncFrameWriter> writer_;
 };
 }  // namespace io
 }  // namespace open3d
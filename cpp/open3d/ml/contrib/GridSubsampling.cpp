@@ -130,29 +130,37 @@ void grid_subsampling(std::vector<PointXYZ>& original_points,
             std::cout << "\rSampled Map : " << std::setw(3) << i / nDisp << "%";
     }
 
+    // Visit the voxels in the order of their map index. This makes the output
+    // deterministic and identical to the CUDA implementation.
+    std::vector<size_t> keys;
+    keys.reserve(data.size());
+    for (auto& v : data) keys.push_back(v.first);
+    std::sort(keys.begin(), keys.end());
+
     // Divide for barycentre and transfer to a vector
     subsampled_points.reserve(data.size());
     if (use_feature) subsampled_features.reserve(data.size() * fdim);
     if (use_classes) subsampled_classes.reserve(data.size() * ldim);
-    for (auto& v : data) {
-        subsampled_points.push_back(v.second.point * (1.0f / v.second.count));
+    for (size_t key : keys) {
+        SampledData& v = data[key];
+        subsampled_points.push_back(v.point * (1.0f / v.count));
         if (use_feature) {
-            float count = (float)v.second.count;
-            transform(v.second.features.begin(), v.second.features.end(),
-                      v.second.features.begin(),
+            float count = (float)v.count;
+            transform(v.features.begin(), v.features.end(), v.features.begin(),
                       [count](float f) { return f / count; });
             subsampled_features.insert(subsampled_features.end(),
-                                       v.second.features.begin(),
-                                       v.second.features.end());
+                                       v.features.begin(), v.features.end());
         }
         if (use_classes) {
+            // Majority vote, ties go to the smallest label.
             for (int i = 0; i < static_cast<int>(ldim); i++)
                 subsampled_classes.push_back(
-                        max_element(v.second.labels[i].begin(),
-                                    v.second.labels[i].end(),
+                        max_element(v.labels[i].begin(), v.labels[i].end(),
                                     [](const std::pair<int, int>& a,
                                        const std::pair<int, int>& b) {
-                                        return a.second < b.second;
+                                        return a.second < b.second ||
+                                               (a.second == b.second &&
+                                                a.first > b.first);
                                     })
                                 ->first);
         }
@@ -208,8 +216,9 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
         if (original_classes.size() > 0) {
             b_o_classes =
                     std::vector<int>(original_classes.begin() + sum_b * ldim,
-                                     original_classes.begin() + sum_b +
-                                             original_batches[b] * ldim);
+                                     original_classes.begin() +
+                                             (sum_b + original_batches[b]) *
+                                                     ldim);
         }
 
         // Create result containers
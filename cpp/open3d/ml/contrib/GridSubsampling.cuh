@@ -0,0 +1,397 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <thrust/binary_search.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cub/cub.cuh>
+#include <vector>
+
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+namespace grid_subsampling {
+
+constexpr int BLOCK_SIZE = 256;
+
+/// Computes the grid origin and the number of cells in x and y direction for
+/// each batch item. One block processes one batch item. The arithmetic
+/// follows grid_subsampling() to get the same cells as on the CPU.
+__global__ void ComputeGridKernel(float* origins,
+                                  uint64_t* grid_dims,
+                                  const float* const points,
+                                  const int64_t* const batch_offsets,
+                                  float sampleDl) {
+    typedef cub::BlockReduce<float, BLOCK_SIZE> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    __shared__ float min_corner[3];
+    __shared__ float max_corner[3];
+
+    const int b = blockIdx.x;
+    const int64_t begin = batch_offsets[b];
+    const int64_t end = batch_offsets[b + 1];
+    if (begin == end) return;
+
+    for (int dim = 0; dim < 3; ++dim) {
+        float min_value = INFINITY;
+        float max_value = -INFINITY;
+        for (int64_t i = begin + threadIdx.x; i < end; i += blockDim.x) {
+            const float value = points[3 * i + dim];
+            min_value = fminf(min_value, value);
+            max_value = fmaxf(max_value, value);
+        }
+        min_value = BlockReduce(temp_storage).Reduce(min_value, cub::Min());
+        __syncthreads();
+        max_value = BlockReduce(temp_storage).Reduce(max_value, cub::Max());
+        __syncthreads();
+        if (threadIdx.x == 0) {
+            min_corner[dim] = min_value;
+            max_corner[dim] = max_value;
+        }
+    }
+
+    if (threadIdx.x == 0) {
+        float origin[3];
+        for (int dim = 0; dim < 3; ++dim) {
+            origin[dim] = floorf(min_corner[dim] * (1 / sampleDl)) * sampleDl;
+            origins[3 * b + dim] = origin[dim];
+        }
+        for (int dim = 0; dim < 2; ++dim) {
+            grid_dims[2 * b + dim] =
+                    uint64_t(floorf((max_corner[dim] - origin[dim]) /
+                                    sampleDl)) +
+                    1;
+        }
+    }
+}
+
+/// Computes the batch index and the cell index for each point.
+__global__ void ComputeCellIndexKernel(uint64_t* cell_index,
+                                       int32_t* batch_index,
+                                       const float* const points,
+                                       int64_t num_points,
+                                       const int64_t* const batch_offsets,
+                                       int num_batches,
+                                       const float* const origins,
+                                       const uint64_t* const grid_dims,
+                                       float sampleDl) {
+    const int64_t i = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (i >= num_points) return;
+
+    // Find the batch item with batch_offsets[b] <= i < batch_offsets[b+1].
+    int lo = 0;
+    int hi = num_batches;
+    while (hi - lo > 1) {
+        const int mid = (lo + hi) / 2;
+        if (batch_offsets[mid] <= i)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    const int b = lo;
+
+    uint64_t idx[3];
+    for (int dim = 0; dim < 3; ++dim) {
+        idx[dim] = uint64_t(
+                floorf((points[3 * i + dim] - origins[3 * b + dim]) /
+                       sampleDl));
+    }
+    const uint64_t nx = grid_dims[2 * b + 0];
+    const uint64_t ny = grid_dims[2 * b + 1];
+    cell_index[i] = idx[0] + nx * idx[1] + nx * ny * idx[2];
+    batch_index[i] = b;
+}
+
+/// Computes the barycenter, the mean features and the majority labels for
+/// each kept cell. The points of a cell are accumulated in their original
+/// order, which gives the same floating point results as the CPU code.
+__global__ void ReduceCellsKernel(float* out_points,
+                                  float* out_features,
+                                  int32_t* out_classes,
+                                  const float* const points,
+                                  const float* const features,
+                                  int64_t feature_dim,
+                                  const int32_t* const classes,
+                                  int64_t class_dim,
+                                  const int64_t* const sorted_point_index,
+                                  const int64_t* const cell_starts,
+                                  const int64_t* const cell_counts,
+                                  const int32_t* const cell_batch_index,
+                                  int64_t num_cells,
+                                  const int64_t* const batch_cell_offsets,
+                                  const int64_t* const out_batch_offsets,
+                                  int64_t max_p) {
+    const int64_t cell = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (cell >= num_cells) return;
+
+    const int b = cell_batch_index[cell];
+    const int64_t rank = cell - batch_cell_offsets[b];
+    if (rank >= max_p) return;
+    const int64_t out = out_batch_offsets[b] + rank;
+
+    const int64_t* const cell_points = sorted_point_index + cell_starts[cell];
+    const int64_t count = cell_counts[cell];
+
+    float sum[3] = {0, 0, 0};
+    for (int64_t j = 0; j < count; ++j) {
+        for (int dim = 0; dim < 3; ++dim) {
+            sum[dim] += points[3 * cell_points[j] + dim];
+        }
+    }
+    const float inv_count = 1.0f / count;
+    for (int dim = 0; dim < 3; ++dim) {
+        out_points[3 * out + dim] = sum[dim] * inv_count;
+    }
+
+    if (features) {
+        for (int64_t k = 0; k < feature_dim; ++k) {
+            float feature_sum = 0;
+            for (int64_t j = 0; j < count; ++j) {
+                feature_sum += features[feature_dim * cell_points[j] + k];
+            }
+            out_features[feature_dim * out + k] = feature_sum / float(count);
+        }
+    }
+
+    if (classes) {
+        // Majority vote, ties go to the smallest label. Cells are small for
+        // typical grid sizes, so the quadratic counting is cheap.
+        for (int64_t k = 0; k < class_dim; ++k) {
+            int32_t best_label = 0;
+            int64_t best_count = 0;
+            for (int64_t j = 0; j < count; ++j) {
+                const int32_t label = classes[class_dim * cell_points[j] + k];
+                int64_t label_count = 0;
+                for (int64_t l = 0; l < count; ++l) {
+                    if (classes[class_dim * cell_points[l] + k] == label)
+                        ++label_count;
+                }
+                if (label_count > best_count ||
+                    (label_count == best_count && label < best_label)) {
+                    best_label = label;
+                    best_count = label_count;
+                }
+            }
+            out_classes[class_dim * out + k] = best_label;
+        }
+    }
+}
+
+}  // namespace grid_subsampling
+
+/// CUDA implementation of batch_grid_subsampling().
+///
+/// The outputs are identical to the CPU implementation: cells are emitted in
+/// the order of their cell index within each batch item, and if a batch item
+/// has more than \p max_p cells only the first \p max_p cells are kept.
+///
+/// All pointer arguments point to device memory unless stated otherwise.
+///
+/// \param stream    The cuda stream for all kernel launches.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    The point positions with shape [num_points,3].
+///
+/// \param feature_dim    The number of feature channels.
+///
+/// \param features    Optional features with shape [num_points,feature_dim].
+///        Set to null to disable.
+///
+/// \param class_dim    The number of labels per point.
+///
+/// \param classes    Optional labels with shape [num_points,class_dim]. Set to
+///        null to disable.
+///
+/// \param num_batches    The number of batch items.
+///
+/// \param batches    The number of points for each batch item. The shape is
+///        [num_batches]. This pointer points to host memory!
+///
+/// \param sampleDl    The cell size of the grid.
+///
+/// \param max_p    The maximum number of cells per batch item. Values < 1
+///        disable the limit.
+///
+/// \param subsampled_batches    Output vector with the number of subsampled
+///        points for each batch item.
+///
+/// \param output_allocator    An object that implements the functions
+///        AllocSubPoints(float** ptr, int64_t num),
+///        AllocSubFeatures(float** ptr, int64_t num, int64_t dim) and
+///        AllocSubClasses(int32_t** ptr, int64_t num, int64_t dim). The
+///        functions allocate the outputs with shapes [num,3], [num,dim] and
+///        [num,dim] and must accept zero size arguments. Features and classes
+///        are only allocated if the respective inputs are given.
+///
+template <class OUTPUT_ALLOCATOR>
+void BatchGridSubsamplingCUDA(const cudaStream_t& stream,
+                              int64_t num_points,
+                              const float* const points,
+                              int64_t feature_dim,
+                              const float* const features,
+                              int64_t class_dim,
+                              const int32_t* const classes,
+                              int num_batches,
+                              const int32_t* const batches,
+                              float sampleDl,
+                              int max_p,
+                              std::vector<int32_t>& subsampled_batches,
+                              OUTPUT_ALLOCATOR& output_allocator) {
+    using namespace grid_subsampling;
+    using open3d::utility::DivUp;
+    const auto policy = thrust::cuda::par.on(stream);
+
+    if (max_p < 1) max_p = static_cast<int>(num_points);
+
+    std::vector<int64_t> batch_offsets(num_batches + 1, 0);
+    for (int b = 0; b < num_batches; ++b) {
+        batch_offsets[b + 1] = batch_offsets[b] + batches[b];
+    }
+
+    // Cell of each point.
+    thrust::device_vector<int64_t> batch_offsets_d(batch_offsets);
+    thrust::device_vector<float> origins(3 * num_batches);
+    thrust::device_vector<uint64_t> grid_dims(2 * num_batches);
+    thrust::device_vector<uint64_t> cell_index(num_points);
+    thrust::device_vector<int32_t> batch_index(num_points);
+    if (num_points > 0) {
+        ComputeGridKernel<<<num_batches, BLOCK_SIZE, 0, stream>>>(
+                origins.data().get(), grid_dims.data().get(), points,
+                batch_offsets_d.data().get(), sampleDl);
+        ComputeCellIndexKernel<<<DivUp(num_points, BLOCK_SIZE), BLOCK_SIZE, 0,
+                                 stream>>>(
+                cell_index.data().get(), batch_index.data().get(), points,
+                num_points, batch_offsets_d.data().get(), num_batches,
+                origins.data().get(), grid_dims.data().get(), sampleDl);
+    }
+
+    // Sort the points by (batch, cell). Both sorts are stable such that the
+    // points of each cell stay in their original order.
+    thrust::device_vector<int64_t> sorted_point_index(num_points);
+    thrust::sequence(policy, sorted_point_index.begin(),
+                     sorted_point_index.end());
+    thrust::stable_sort_by_key(policy, cell_index.begin(), cell_index.end(),
+                               sorted_point_index.begin());
+    thrust::device_vector<int32_t> sorted_batch_index(num_points);
+    thrust::gather(policy, sorted_point_index.begin(),
+                   sorted_point_index.end(), batch_index.begin(),
+                   sorted_batch_index.begin());
+    thrust::stable_sort_by_key(
+            policy, sorted_batch_index.begin(), sorted_batch_index.end(),
+            thrust::make_zip_iterator(thrust::make_tuple(
+                    cell_index.begin(), sorted_point_index.begin())));
+
+    // Find the cells and their sizes.
+    thrust::device_vector<int32_t> cell_batch_index(num_points);
+    thrust::device_vector<int64_t> cell_counts(num_points);
+    auto sorted_keys = thrust::make_zip_iterator(
+            thrust::make_tuple(sorted_batch_index.begin(), cell_index.begin()));
+    auto reduce_end = thrust::reduce_by_key(
+            policy, sorted_keys, sorted_keys + num_points,
+            thrust::make_constant_iterator<int64_t>(1),
+            thrust::make_zip_iterator(thrust::make_tuple(
+                    cell_batch_index.begin(), thrust::make_discard_iterator())),
+            cell_counts.begin());
+    const int64_t num_cells = reduce_end.second - cell_counts.begin();
+    thrust::device_vector<int64_t> cell_starts(num_cells);
+    thrust::exclusive_scan(policy, cell_counts.begin(),
+                           cell_counts.begin() + num_cells,
+                           cell_starts.begin());
+
+    // First cell of each batch item.
+    thrust::device_vector<int64_t> batch_cell_offsets_d(num_batches + 1);
+    thrust::lower_bound(policy, cell_batch_index.begin(),
+                        cell_batch_index.begin() + num_cells,
+                        thrust::make_counting_iterator<int32_t>(0),
+                        thrust::make_counting_iterator<int32_t>(num_batches +
+                                                                1),
+                        batch_cell_offsets_d.begin());
+    std::vector<int64_t> batch_cell_offsets(num_batches + 1);
+    cudaMemcpyAsync(batch_cell_offsets.data(),
+                    batch_cell_offsets_d.data().get(),
+                    sizeof(int64_t) * (num_batches + 1),
+                    cudaMemcpyDeviceToHost, stream);
+    cudaStreamSynchronize(stream);
+
+    // Apply max_p and compute the output layout.
+    subsampled_batches.resize(num_batches);
+    std::vector<int64_t> out_batch_offsets(num_batches + 1, 0);
+    for (int b = 0; b < num_batches; ++b) {
+        subsampled_batches[b] = static_cast<int32_t>(
+                std::min<int64_t>(batch_cell_offsets[b + 1] -
+                                          batch_cell_offsets[b],
+                                  max_p));
+        out_batch_offsets[b + 1] = out_batch_offsets[b] + subsampled_batches[b];
+    }
+    const int64_t num_out = out_batch_offsets[num_batches];
+
+    float* out_points = nullptr;
+    float* out_features = nullptr;
+    int32_t* out_classes = nullptr;
+    output_allocator.AllocSubPoints(&out_points, num_out);
+    if (features) {
+        output_allocator.AllocSubFeatures(&out_features, num_out, feature_dim);
+    }
+    if (classes) {
+        output_allocator.AllocSubClasses(&out_classes, num_out, class_dim);
+    }
+    if (num_out == 0) return;
+
+    thrust::device_vector<int64_t> out_batch_offsets_d(out_batch_offsets);
+    ReduceCellsKernel<<<DivUp(num_cells, BLOCK_SIZE), BLOCK_SIZE, 0,
+                        stream>>>(
+            out_points, out_features, out_classes, points, features,
+            feature_dim, classes, class_dim, sorted_point_index.data().get(),
+            cell_starts.data().get(), cell_counts.data().get(),
+            cell_batch_index.data().get(), num_cells,
+            batch_cell_offsets_d.data().get(),
+            out_batch_offsets_d.data().get(), max_p);
+    // Keep the temporaries alive until the kernel has finished.
+    cudaStreamSynchronize(stream);
+}
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
@@ -148,6 +148,54 @@ __global__ void three_interpolate_grad_kernel(
     atomicAdd(grad_points + idx[2], grad_out[0] * weight[2]);
 }
 
+__global__ void three_interpolate_grad_keys_kernel(
+        int b,
+        int n,
+        int m,
+        const int *__restrict__ idx,
+        int64_t *__restrict__ keys,
+        int *__restrict__ order) {
+    const int64_t num_entries = int64_t(b) * n * 3;
+    const int64_t e = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (e >= num_entries) return;
+
+    const int64_t bs_idx = e / (int64_t(n) * 3);
+    keys[e] = bs_idx * m + idx[e];
+    order[e] = int(e);
+}
+
+__global__ void three_interpolate_grad_sorted_kernel(
+        int b,
+        int c,
+        int n,
+        int m,
+        const float *__restrict__ grad_out,
+        const int *__restrict__ order,
+        const int64_t *__restrict__ point_splits,
+        const float *__restrict__ weight,
+        float *__restrict__ grad_points) {
+    // grad_out: (B, C, N)
+    // weight: (B, N, 3)
+    // output:
+    //      grad_points: (B, C, M)
+
+    const int64_t p = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    const int c_idx = blockIdx.y;
+    if (p >= int64_t(b) * m || c_idx >= c) return;
+
+    const int64_t bs_idx = p / m;
+    const int64_t pt_idx = p - bs_idx * m;
+    grad_out += (bs_idx * c + c_idx) * n;
+
+    float g = 0;
+    for (int64_t k = point_splits[p]; k < point_splits[p + 1]; ++k) {
+        // e is bs_idx * n * 3 + point * 3 + neighbor
+        const int e = order[k];
+        g += grad_out[(e / 3) % n] * weight[e];
+    }
+    grad_points[(bs_idx * c + c_idx) * m + pt_idx] = g;
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
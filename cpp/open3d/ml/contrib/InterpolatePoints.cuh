@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace open3d {
 namespace ml {
 namespace contrib {
@@ -57,6 +59,32 @@ __global__ void three_interpolate_grad_kernel(
         const float *__restrict__ weight,
         float *__restrict__ grad_points);
 
+/// Writes the key batch * m + idx of every (point, neighbor) entry of \p idx
+/// to \p keys and the entry index to \p order. Sorting \p order by \p keys
+/// groups the entries by the point they scatter to.
+__global__ void three_interpolate_grad_keys_kernel(
+        int b,
+        int n,
+        int m,
+        const int *__restrict__ idx,
+        int64_t *__restrict__ keys,
+        int *__restrict__ order);
+
+/// Computes the same gradient as three_interpolate_grad_kernel without
+/// atomics. The entries of point p are order[point_splits[p]:
+/// point_splits[p+1]], sorted by point. Each point and channel is written by
+/// a single thread in a fixed order, so the result is deterministic.
+__global__ void three_interpolate_grad_sorted_kernel(
+        int b,
+        int c,
+        int n,
+        int m,
+        const float *__restrict__ grad_out,
+        const int *__restrict__ order,
+        const int64_t *__restrict__ point_splits,
+        const float *__restrict__ weight,
+        float *__restrict__ grad_points);
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -159,6 +159,19 @@ OPEN3D_HOST_DEVICE inline float BoxOverlap(const float *box_a,
     Point center_a((a_x1 + a_x2) / 2, (a_y1 + a_y2) / 2);
     Point center_b((b_x1 + b_x2) / 2, (b_y1 + b_y2) / 2);
 
+    // Boxes do not overlap if their circumcircles do not overlap. This skips
+    // the polygon clipping for most pairs when there are many boxes.
+    const float radius_sum =
+            0.5f * (sqrt((a_x2 - a_x1) * (a_x2 - a_x1) +
+                         (a_y2 - a_y1) * (a_y2 - a_y1)) +
+                    sqrt((b_x2 - b_x1) * (b_x2 - b_x1) +
+                         (b_y2 - b_y1) * (b_y2 - b_y1)));
+    const Point center_diff = center_a - center_b;
+    if (center_diff.x_ * center_diff.x_ + center_diff.y_ * center_diff.y_ >
+        radius_sum * radius_sum) {
+        return 0.0f;
+    }
+
     Point box_a_corners[5];
     box_a_corners[0].set(a_x1, a_y1);
     box_a_corners[1].set(a_x2, a_y1);
@@ -217,7 +230,10 @@ OPEN3D_HOST_DEVICE inline float BoxOverlap(const float *box_a,
         }
     }
 
-    OPEN3D_ASSERT(cnt != 0 && "Invalid value: cnt==0.");
+    // Disjoint boxes have no intersections and no corners inside each other.
+    if (cnt == 0) {
+        return 0.0f;
+    }
 
     poly_center.x_ /= cnt;
     poly_center.y_ /= cnt;
@@ -317,6 +333,25 @@ OPEN3D_HOST_DEVICE inline float IoU3DWithCenterAndSize(const float *box_a,
     return iou_3d;
 }
 
+/// IoU for Nms with boxes (x_min, z_min, x_max, z_max, y_rotate).
+struct NmsBevIoU {
+    static constexpr int BOX_DIM = 5;
+    OPEN3D_HOST_DEVICE static float IoU(const float *box_a,
+                                        const float *box_b) {
+        return IoUBev2DWithMinAndMax(box_a, box_b);
+    }
+};
+
+/// IoU for Nms with rotated 3D boxes
+/// (x_center, y_max, z_center, x_size, y_size, z_size, y_rotate).
+struct Nms3DIoU {
+    static constexpr int BOX_DIM = 7;
+    OPEN3D_HOST_DEVICE static float IoU(const float *box_a,
+                                        const float *box_b) {
+        return IoU3DWithCenterAndSize(box_a, box_b);
+    }
+};
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
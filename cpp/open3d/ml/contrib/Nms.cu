@@ -33,181 +33,250 @@
 // Written by Shaoshuai Shi
 // All Rights Reserved 2019-2020.
 
+#include <thrust/copy.h>
 #include <thrust/device_vector.h>
-#include <thrust/iterator/counting_iterator.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 #include "open3d/ml/Helper.h"
 #include "open3d/ml/contrib/IoUImpl.h"
 #include "open3d/ml/contrib/Nms.h"
 #include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace ml {
 namespace contrib {
 
-template <typename T>
-static void SortIndices(T *values,
-                        int64_t *sort_indices,
-                        int64_t n,
-                        bool descending = false) {
-    // Cast to thrust device pointer.
-    thrust::device_ptr<T> values_dptr = thrust::device_pointer_cast(values);
-    thrust::device_ptr<int64_t> sort_indices_dptr =
-            thrust::device_pointer_cast(sort_indices);
-
-    // Fill sort_indices with 0, 1, ..., n-1.
-    thrust::sequence(sort_indices_dptr, sort_indices_dptr + n, 0);
-
-    // Sort values and sort_indices together.
-    if (descending) {
-        thrust::stable_sort_by_key(values_dptr, values_dptr + n,
-                                   sort_indices_dptr, thrust::greater<T>());
-    } else {
-        thrust::stable_sort_by_key(values_dptr, values_dptr + n,
-                                   sort_indices_dptr);
+/// Number of rows of the suppression mask that are computed at once. The mask
+/// of a tile has NMS_TILE_ROWS x ceil(n / NMS_BLOCK_SIZE) bits.
+constexpr int NMS_TILE_ROWS = 32 * NMS_BLOCK_SIZE;
+/// Number of threads for updating the suppression bitmap.
+constexpr int NMS_REDUCE_THREADS = 256;
+
+/// Computes the rows [row_begin, row_begin + gridDim.y * NMS_BLOCK_SIZE) of
+/// the suppression mask. mask[i, j] is a 64-bit integer where mask[i, j][k]
+/// (k counted from right) is 1 iff box[i] overlaps with box[BS*j+k] and
+/// BS*j+k > i. Rows and columns of boxes that are already suppressed are
+/// skipped and remain 0.
+template <class IOU>
+__global__ void NmsTileKernel(const float *boxes,
+                              const int64_t *sort_indices,
+                              const int64_t *sorted_labels,
+                              const uint64_t *removed,
+                              uint64_t *mask,
+                              const int n,
+                              const double nms_overlap_thresh,
+                              const int num_block_cols,
+                              const int row_begin) {
+    constexpr int BOX_DIM = IOU::BOX_DIM;
+    const int block_row_idx = row_begin / NMS_BLOCK_SIZE + blockIdx.y;
+    const int block_col_idx = row_begin / NMS_BLOCK_SIZE + blockIdx.x;
+    // Only the upper triangle of the mask is used.
+    if (block_col_idx < block_row_idx || block_row_idx >= num_block_cols) {
+        return;
     }
-}
 
-__global__ void NmsKernel(const float *boxes,
-                          const int64_t *sort_indices,
-                          uint64_t *mask,
-                          const int n,
-                          const double nms_overlap_thresh,
-                          const int num_block_cols) {
-    // Row-wise block index.
-    const int block_row_idx = blockIdx.y;
-    // Column-wise block index.
-    const int block_col_idx = blockIdx.x;
-
-    // Local block row size.
     const int row_size =
-            fminf(n - block_row_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
-    // Local block col size.
+            min(n - block_row_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
     const int col_size =
-            fminf(n - block_col_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
-
-    // Fill local block_boxes by fetching the global box memory.
-    // block_boxes = boxes[NBS*block_col_idx : NBS*block_col_idx+col_size, :].
-    //
-    // TODO: It is also possible to load the comparison target to the shared
-    // memory as well.
-    __shared__ float block_boxes[NMS_BLOCK_SIZE * 5];
+            min(n - block_col_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
+
+    // The boxes are sorted by label. No box in the row block has the label of
+    // a box in the column block.
+    if (sorted_labels &&
+        sorted_labels[block_row_idx * NMS_BLOCK_SIZE + row_size - 1] <
+                sorted_labels[block_col_idx * NMS_BLOCK_SIZE]) {
+        return;
+    }
+
+    __shared__ float block_boxes[NMS_BLOCK_SIZE * BOX_DIM];
     if (threadIdx.x < col_size) {
-        float *dst = block_boxes + threadIdx.x * 5;
+        float *dst = block_boxes + threadIdx.x * BOX_DIM;
         const int src_idx = NMS_BLOCK_SIZE * block_col_idx + threadIdx.x;
-        const float *src = boxes + sort_indices[src_idx] * 5;
-        dst[0] = src[0];
-        dst[1] = src[1];
-        dst[2] = src[2];
-        dst[3] = src[3];
-        dst[4] = src[4];
+        const float *src = boxes + sort_indices[src_idx] * BOX_DIM;
+        for (int d = 0; d < BOX_DIM; ++d) {
+            dst[d] = src[d];
+        }
     }
     __syncthreads();
 
-    // Comparing src and dst. In one block, the following src and dst indices
-    // are compared:
-    // - src: BS * block_row_idx : BS * block_row_idx + row_size
-    // - dst: BS * block_col_idx : BS * block_col_idx + col_size
-    //
-    // With all blocks, all src and dst indices are compared.
-    //
-    // Result:
-    // mask[i, j] is a 64-bit integer where mask[i, j][k] (k counted from right)
-    // is 1 iff box[i] overlaps with box[BS*j+k].
     if (threadIdx.x < row_size) {
-        // src_idx indices the global memory.
         const int src_idx = NMS_BLOCK_SIZE * block_row_idx + threadIdx.x;
-        // dst_idx indices the shared memory.
+        if (removed[block_row_idx] & (1ULL << threadIdx.x)) {
+            return;
+        }
+        const uint64_t col_removed = removed[block_col_idx];
+        const float *src_box = boxes + sort_indices[src_idx] * BOX_DIM;
         int dst_idx = block_row_idx == block_col_idx ? threadIdx.x + 1 : 0;
 
         uint64_t t = 0;
-        while (dst_idx < col_size) {
-            if (IoUBev2DWithMinAndMax(boxes + sort_indices[src_idx] * 5,
-                                      block_boxes + dst_idx * 5) >
+        for (; dst_idx < col_size; dst_idx++) {
+            if (col_removed & (1ULL << dst_idx)) {
+                continue;
+            }
+            if (sorted_labels &&
+                sorted_labels[src_idx] !=
+                        sorted_labels[NMS_BLOCK_SIZE * block_col_idx +
+                                      dst_idx]) {
+                continue;
+            }
+            if (IOU::IoU(src_box, block_boxes + dst_idx * BOX_DIM) >
                 nms_overlap_thresh) {
                 t |= 1ULL << dst_idx;
             }
-            dst_idx++;
         }
-        mask[src_idx * num_block_cols + block_col_idx] = t;
+        mask[(src_idx - row_begin) * num_block_cols + block_col_idx] = t;
     }
 }
 
+/// Selects the boxes of the rows [row_begin, row_end) in score order and adds
+/// the boxes they overlap with to the removed bitmap. Also counts the boxes
+/// after row_end that are not yet removed. Runs with a single block.
+__global__ void NmsTileReduceKernel(const uint64_t *mask,
+                                    uint64_t *removed,
+                                    uint8_t *keep,
+                                    const int n,
+                                    const int num_block_cols,
+                                    const int row_begin,
+                                    const int row_end,
+                                    int *num_remaining) {
+    for (int i = row_begin; i < row_end; i++) {
+        const int block_col_idx = i / NMS_BLOCK_SIZE;
+        __syncthreads();
+        const bool is_removed =
+                removed[block_col_idx] & (1ULL << (i % NMS_BLOCK_SIZE));
+        __syncthreads();
+        if (is_removed) {
+            continue;
+        }
+        if (threadIdx.x == 0) {
+            keep[i] = 1;
+        }
+        const uint64_t *p = mask + (i - row_begin) * num_block_cols;
+        for (int j = block_col_idx + threadIdx.x; j < num_block_cols;
+             j += blockDim.x) {
+            removed[j] |= p[j];
+        }
+    }
+    __syncthreads();
+
+    // Count the remaining boxes for early termination.
+    int count = 0;
+    for (int i = row_end + threadIdx.x; i < n; i += blockDim.x) {
+        if (!(removed[i / NMS_BLOCK_SIZE] & (1ULL << (i % NMS_BLOCK_SIZE)))) {
+            count++;
+        }
+    }
+    atomicAdd(num_remaining, count);
+}
+
+struct IsKept {
+    __device__ bool operator()(const uint8_t keep) const { return keep != 0; }
+};
+
+template <class IOU>
+static std::vector<int64_t> NmsCUDA(const float *boxes,
+                                    const float *scores,
+                                    int n,
+                                    double nms_overlap_thresh,
+                                    const int64_t *labels) {
+    const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
+
+    // Sort by decreasing score. With labels the boxes are additionally
+    // grouped by label, which allows skipping blocks of boxes with different
+    // labels.
+    thrust::device_vector<float> sorted_scores(
+            thrust::device_pointer_cast(scores),
+            thrust::device_pointer_cast(scores) + n);
+    thrust::device_vector<int64_t> sort_indices(n);
+    thrust::sequence(sort_indices.begin(), sort_indices.end(), 0);
+    thrust::stable_sort_by_key(sorted_scores.begin(), sorted_scores.end(),
+                               sort_indices.begin(), thrust::greater<float>());
+    thrust::device_vector<int64_t> sorted_labels;
+    if (labels) {
+        sorted_labels.resize(n);
+        thrust::gather(sort_indices.begin(), sort_indices.end(),
+                       thrust::device_pointer_cast(labels),
+                       sorted_labels.begin());
+        thrust::stable_sort_by_key(sorted_labels.begin(), sorted_labels.end(),
+                                   sort_indices.begin());
+    }
+
+    // The mask is computed and reduced tile by tile. Boxes that are
+    // suppressed by earlier tiles are skipped, and we stop as soon as all
+    // remaining boxes are suppressed.
+    const int tile_rows = std::min(n, NMS_TILE_ROWS);
+    thrust::device_vector<uint64_t> mask(size_t(tile_rows) * num_block_cols);
+    thrust::device_vector<uint64_t> removed(num_block_cols, 0);
+    thrust::device_vector<uint8_t> keep(n, 0);
+    thrust::device_vector<int> num_remaining(1);
+    for (int row_begin = 0; row_begin < n; row_begin += tile_rows) {
+        const int row_end = std::min(n, row_begin + tile_rows);
+        OPEN3D_CUDA_CHECK(cudaMemset(mask.data().get(), 0,
+                                     mask.size() * sizeof(uint64_t)));
+        dim3 blocks(num_block_cols - row_begin / NMS_BLOCK_SIZE,
+                    utility::DivUp(row_end - row_begin, NMS_BLOCK_SIZE));
+        NmsTileKernel<IOU><<<blocks, NMS_BLOCK_SIZE>>>(
+                boxes, sort_indices.data().get(),
+                labels ? sorted_labels.data().get() : nullptr,
+                removed.data().get(), mask.data().get(), n,
+                nms_overlap_thresh, num_block_cols, row_begin);
+        num_remaining[0] = 0;
+        NmsTileReduceKernel<<<1, NMS_REDUCE_THREADS>>>(
+                mask.data().get(), removed.data().get(), keep.data().get(), n,
+                num_block_cols, row_begin, row_end,
+                num_remaining.data().get());
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+        if (num_remaining[0] == 0) {
+            break;
+        }
+    }
+
+    thrust::device_vector<int64_t> keep_indices(n);
+    keep_indices.resize(thrust::copy_if(sort_indices.begin(),
+                                        sort_indices.end(), keep.begin(),
+                                        keep_indices.begin(), IsKept()) -
+                        keep_indices.begin());
+    if (labels) {
+        // Restore the order by decreasing score.
+        thrust::sort(keep_indices.begin(), keep_indices.end());
+        thrust::device_vector<float> keep_scores(keep_indices.size());
+        thrust::gather(keep_indices.begin(), keep_indices.end(),
+                       thrust::device_pointer_cast(scores),
+                       keep_scores.begin());
+        thrust::stable_sort_by_key(keep_scores.begin(), keep_scores.end(),
+                                   keep_indices.begin(),
+                                   thrust::greater<float>());
+    }
+
+    std::vector<int64_t> keep_indices_cpu(keep_indices.size());
+    thrust::copy(keep_indices.begin(), keep_indices.end(),
+                 keep_indices_cpu.begin());
+    return keep_indices_cpu;
+}
+
 std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
-                                   double nms_overlap_thresh) {
+                                   double nms_overlap_thresh,
+                                   int box_dim,
+                                   const int64_t *labels) {
     if (n == 0) {
         return {};
     }
-
-    // Cololum-wise number of blocks.
-    const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
-
-    // Compute sort indices.
-    float *scores_copy = nullptr;
-    OPEN3D_CUDA_CHECK(cudaMalloc((void **)&scores_copy, n * sizeof(float)));
-    OPEN3D_CUDA_CHECK(cudaMemcpy(scores_copy, scores, n * sizeof(float),
-                                 cudaMemcpyDeviceToDevice));
-    int64_t *sort_indices = nullptr;
-    OPEN3D_CUDA_CHECK(cudaMalloc((void **)&sort_indices, n * sizeof(int64_t)));
-    SortIndices(scores_copy, sort_indices, n, true);
-    OPEN3D_CUDA_CHECK(cudaFree(scores_copy));
-
-    // Allocate masks on device.
-    uint64_t *mask_ptr = nullptr;
-    OPEN3D_CUDA_CHECK(cudaMalloc((void **)&mask_ptr,
-                                 n * num_block_cols * sizeof(uint64_t)));
-
-    // Launch kernel.
-    dim3 blocks(utility::DivUp(n, NMS_BLOCK_SIZE),
-                utility::DivUp(n, NMS_BLOCK_SIZE));
-    dim3 threads(NMS_BLOCK_SIZE);
-    NmsKernel<<<blocks, threads>>>(boxes, sort_indices, mask_ptr, n,
-                                   nms_overlap_thresh, num_block_cols);
-
-    // Copy cuda masks to cpu.
-    std::vector<uint64_t> mask_vec(n * num_block_cols);
-    uint64_t *mask = mask_vec.data();
-    OPEN3D_CUDA_CHECK(cudaMemcpy(mask_vec.data(), mask_ptr,
-                                 n * num_block_cols * sizeof(uint64_t),
-                                 cudaMemcpyDeviceToHost));
-    OPEN3D_CUDA_CHECK(cudaFree(mask_ptr));
-
-    // Copy sort_indices to cpu.
-    std::vector<int64_t> sort_indices_cpu(n);
-    OPEN3D_CUDA_CHECK(cudaMemcpy(sort_indices_cpu.data(), sort_indices,
-                                 n * sizeof(int64_t), cudaMemcpyDeviceToHost));
-
-    // Write to keep_indices in CPU.
-    // remv_cpu has n bits in total. If the bit is 1, the corresponding
-    // box will be removed.
-    // TODO: This part can be implemented in CUDA. We use the original author's
-    // implementation here.
-    std::vector<uint64_t> remv_cpu(num_block_cols, 0);
-    std::vector<int64_t> keep_indices;
-    for (int i = 0; i < n; i++) {
-        int block_col_idx = i / NMS_BLOCK_SIZE;
-        int inner_block_col_idx = i % NMS_BLOCK_SIZE;  // threadIdx.x
-
-        // Querying the i-th bit in remv_cpu, counted from the right.
-        // - remv_cpu[block_col_idx]: the block bitmap containing the query
-        // - 1ULL << inner_block_col_idx: the one-hot bitmap to extract i
-        if (!(remv_cpu[block_col_idx] & (1ULL << inner_block_col_idx))) {
-            // Keep the i-th box.
-            keep_indices.push_back(sort_indices_cpu[i]);
-
-            // Any box that overlaps with the i-th box will be removed.
-            uint64_t *p = mask + i * num_block_cols;
-            for (int j = block_col_idx; j < num_block_cols; j++) {
-                remv_cpu[j] |= p[j];
-            }
-        }
+    if (box_dim == NmsBevIoU::BOX_DIM) {
+        return NmsCUDA<NmsBevIoU>(boxes, scores, n, nms_overlap_thresh,
+                                  labels);
+    } else if (box_dim == Nms3DIoU::BOX_DIM) {
+        return NmsCUDA<Nms3DIoU>(boxes, scores, n, nms_overlap_thresh, labels);
     }
-    OPEN3D_CUDA_CHECK(cudaFree(sort_indices));
-    return keep_indices;
+    utility::LogError("Nms: box_dim must be 5 or 7 but got {}.", box_dim);
+    return {};
 }
 
 }  // namespace contrib
@@ -44,28 +44,40 @@ namespace contrib {
 
 #ifdef BUILD_CUDA_MODULE
 
-/// \param boxes (n, 5) float32.
+/// \param boxes (n, 5) or (n, 7) float32.
 /// \param scores (n,) float32.
 /// \param n Number of boxes.
 /// \param nms_overlap_thresh When a high-score box is selected, other remaining
 /// boxes with IoU > nms_overlap_thresh will be discarded.
-/// \return Selected box indices to keep.
+/// \param box_dim 5 for bird's eye view boxes (x0, y0, x1, y1, rotate) or 7
+/// for rotated 3D boxes (x, y_max, z, x_size, y_size, z_size, y_rotate).
+/// \param labels Optional (n,) int64 class labels. If set, only boxes with the
+/// same label suppress each other.
+/// \return Selected box indices to keep, sorted by decreasing score.
 std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
-                                   double nms_overlap_thresh);
+                                   double nms_overlap_thresh,
+                                   int box_dim = 5,
+                                   const int64_t *labels = nullptr);
 #endif
 
-/// \param boxes (n, 5) float32.
+/// \param boxes (n, 5) or (n, 7) float32.
 /// \param scores (n,) float32.
 /// \param n Number of boxes.
 /// \param nms_overlap_thresh When a high-score box is selected, other remaining
 /// boxes with IoU > nms_overlap_thresh will be discarded.
-/// \return Selected box indices to keep.
+/// \param box_dim 5 for bird's eye view boxes (x0, y0, x1, y1, rotate) or 7
+/// for rotated 3D boxes (x, y_max, z, x_size, y_size, z_size, y_rotate).
+/// \param labels Optional (n,) int64 class labels. If set, only boxes with the
+/// same label suppress each other.
+/// \return Selected box indices to keep, sorted by decreasing score.
 std::vector<int64_t> NmsCPUKernel(const float *boxes,
                                   const float *scores,
                                   int n,
-                                  double nms_overlap_thresh);
+                                  double nms_overlap_thresh,
+                                  int box_dim = 5,
+                                  const int64_t *labels = nullptr);
 
 }  // namespace contrib
 }  // namespace ml
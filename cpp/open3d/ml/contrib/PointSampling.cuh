@@ -26,6 +26,13 @@
 
 #pragma once
 
+#include <cooperative_groups.h>
+
+#include <algorithm>
+#include <cub/cub.cuh>
+
+#include "open3d/ml/contrib/cuda_utils.h"
+
 namespace open3d {
 namespace ml {
 namespace contrib {
@@ -162,6 +169,148 @@ __global__ void furthest_point_sampling_kernel(
     }
 }
 
+/// Number of threads per block of furthest_point_sampling_multi_block_kernel.
+constexpr int FPS_MULTI_BLOCK_THREADS = 512;
+
+/// Minimum number of points per thread for which splitting a batch item over
+/// multiple blocks pays off.
+constexpr int FPS_MULTI_BLOCK_MIN_POINTS_PER_THREAD = 4;
+
+/// Furthest point sampling with multiple blocks per batch item. This keeps
+/// the whole GPU busy for small batches of large point clouds.
+///
+/// Each block reduces its part of the points and writes the local maximum to
+/// \p block_dists and \p block_dists_i, which have shape
+/// (2, B, gridDim.x). After a grid wide barrier every block reduces the local
+/// maxima of its batch item. The two halves of the buffers are used in turns
+/// such that a single barrier per sample suffices. The kernel must be launched
+/// with cudaLaunchCooperativeKernel, see
+/// LaunchFurthestPointSamplingMultiBlock().
+template <unsigned int block_size>
+__global__ void furthest_point_sampling_multi_block_kernel(
+        int b,
+        int n,
+        int m,
+        const float *__restrict__ dataset,
+        float *__restrict__ temp,
+        float *__restrict__ block_dists,
+        int *__restrict__ block_dists_i,
+        int *__restrict__ idxs) {
+    // dataset: (B, N, 3)
+    // tmp: (B, N)
+    // output:
+    //      idx: (B, M)
+
+    if (m <= 0) return;
+    typedef cub::KeyValuePair<int, float> IndexDist;
+    typedef cub::BlockReduce<IndexDist, block_size> BlockReduce;
+    __shared__ typename BlockReduce::TempStorage temp_storage;
+    __shared__ int selected;
+
+    cooperative_groups::grid_group grid = cooperative_groups::this_grid();
+
+    const int num_blocks = gridDim.x;
+    const int batch_index = blockIdx.y;
+    dataset += batch_index * n * 3;
+    temp += batch_index * n;
+    idxs += batch_index * m;
+
+    int old = 0;
+    if (blockIdx.x == 0 && threadIdx.x == 0) idxs[0] = old;
+
+    for (int j = 1; j < m; j++) {
+        const int buffer_offset =
+                ((j & 1) * b + batch_index) * num_blocks;
+        float x1 = dataset[old * 3 + 0];
+        float y1 = dataset[old * 3 + 1];
+        float z1 = dataset[old * 3 + 2];
+        IndexDist best(0, -1);
+        for (int k = blockIdx.x * block_size + threadIdx.x; k < n;
+             k += num_blocks * block_size) {
+            float x2 = dataset[k * 3 + 0];
+            float y2 = dataset[k * 3 + 1];
+            float z2 = dataset[k * 3 + 2];
+            float d = (x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1) +
+                      (z2 - z1) * (z2 - z1);
+            float d2 = min(d, temp[k]);
+            temp[k] = d2;
+            if (d2 > best.value) best = IndexDist(k, d2);
+        }
+        best = BlockReduce(temp_storage).Reduce(best, cub::ArgMax());
+        if (threadIdx.x == 0) {
+            block_dists[buffer_offset + blockIdx.x] = best.value;
+            block_dists_i[buffer_offset + blockIdx.x] = best.key;
+        }
+
+        grid.sync();
+
+        best = IndexDist(0, -1);
+        for (int i = threadIdx.x; i < num_blocks; i += block_size) {
+            best = cub::ArgMax()(best,
+                                 IndexDist(block_dists_i[buffer_offset + i],
+                                           block_dists[buffer_offset + i]));
+        }
+        __syncthreads();
+        best = BlockReduce(temp_storage).Reduce(best, cub::ArgMax());
+        if (threadIdx.x == 0) selected = best.key;
+        __syncthreads();
+
+        old = selected;
+        if (blockIdx.x == 0 && threadIdx.x == 0) idxs[j] = old;
+    }
+}
+
+/// Returns the number of blocks per batch item to use with
+/// furthest_point_sampling_multi_block_kernel. Returns 0 if the single block
+/// kernel should be used instead, e.g. for large batches or if the device
+/// does not support cooperative launches.
+inline int FurthestPointSamplingNumBlocks(int b, int n) {
+    int device;
+    cudaGetDevice(&device);
+    int cooperative_launch = 0;
+    cudaDeviceGetAttribute(&cooperative_launch, cudaDevAttrCooperativeLaunch,
+                           device);
+    if (!cooperative_launch || b <= 0) return 0;
+
+    // All blocks must be resident at the same time for the grid barrier.
+    int num_sms = 0;
+    cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device);
+    int blocks_per_sm = 0;
+    cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+            &blocks_per_sm,
+            furthest_point_sampling_multi_block_kernel<FPS_MULTI_BLOCK_THREADS>,
+            FPS_MULTI_BLOCK_THREADS, 0);
+
+    const int num_blocks = std::min(
+            DIVUP(n, FPS_MULTI_BLOCK_THREADS *
+                             FPS_MULTI_BLOCK_MIN_POINTS_PER_THREAD),
+            num_sms * blocks_per_sm / b);
+    return num_blocks > 1 ? num_blocks : 0;
+}
+
+/// Launches furthest_point_sampling_multi_block_kernel with \p num_blocks
+/// blocks per batch item as returned by FurthestPointSamplingNumBlocks().
+/// \p block_dists and \p block_dists_i must have 2 * b * num_blocks elements.
+inline cudaError_t LaunchFurthestPointSamplingMultiBlock(
+        cudaStream_t stream,
+        int num_blocks,
+        int b,
+        int n,
+        int m,
+        const float *dataset,
+        float *temp,
+        float *block_dists,
+        int *block_dists_i,
+        int *idxs) {
+    void *args[] = {&b,    &n,          &m,            &dataset,
+                    &temp, &block_dists, &block_dists_i, &idxs};
+    return cudaLaunchCooperativeKernel(
+            (void *)furthest_point_sampling_multi_block_kernel<
+                    FPS_MULTI_BLOCK_THREADS>,
+            dim3(num_blocks, b), dim3(FPS_MULTI_BLOCK_THREADS), args, 0,
+            stream);
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -54,6 +54,25 @@ namespace open3d {
 namespace ml {
 namespace contrib {
 
+namespace {
+
+__device__ inline float ToFloat(float x) { return x; }
+__device__ inline float ToFloat(__half x) { return __half2float(x); }
+
+template <class T>
+__device__ inline T FromFloat(float x);
+template <>
+__device__ inline float FromFloat<float>(float x) {
+    return x;
+}
+template <>
+__device__ inline __half FromFloat<__half>(float x) {
+    return __float2half(x);
+}
+
+}  // namespace
+
+template <class T>
 __global__ void TrilinearDevoxelizeKernel(int b,
                                           int c,
                                           int n,
@@ -62,10 +81,10 @@ __global__ void TrilinearDevoxelizeKernel(int b,
                                           int r3,
                                           bool is_training,
                                           const float *__restrict__ coords,
-                                          const float *__restrict__ feat,
+                                          const T *__restrict__ feat,
                                           int *__restrict__ inds,
                                           float *__restrict__ wgts,
-                                          float *__restrict__ outs) {
+                                          T *__restrict__ outs) {
     int batch_index = blockIdx.x;
     int stride = blockDim.x;
     int index = threadIdx.x;
@@ -136,15 +155,46 @@ __global__ void TrilinearDevoxelizeKernel(int b,
 
         for (int j = 0; j < c; j++) {
             int jr3 = j * r3;
-            outs[j * n + i] =
-                    wgt000 * feat[jr3 + idx000] + wgt001 * feat[jr3 + idx001] +
-                    wgt010 * feat[jr3 + idx010] + wgt011 * feat[jr3 + idx011] +
-                    wgt100 * feat[jr3 + idx100] + wgt101 * feat[jr3 + idx101] +
-                    wgt110 * feat[jr3 + idx110] + wgt111 * feat[jr3 + idx111];
+            float out = wgt000 * ToFloat(feat[jr3 + idx000]) +
+                        wgt001 * ToFloat(feat[jr3 + idx001]) +
+                        wgt010 * ToFloat(feat[jr3 + idx010]) +
+                        wgt011 * ToFloat(feat[jr3 + idx011]) +
+                        wgt100 * ToFloat(feat[jr3 + idx100]) +
+                        wgt101 * ToFloat(feat[jr3 + idx101]) +
+                        wgt110 * ToFloat(feat[jr3 + idx110]) +
+                        wgt111 * ToFloat(feat[jr3 + idx111]);
+            outs[j * n + i] = FromFloat<T>(out);
         }
     }
 }
 
+template __global__ void TrilinearDevoxelizeKernel<float>(
+        int b,
+        int c,
+        int n,
+        int r,
+        int r2,
+        int r3,
+        bool is_training,
+        const float *__restrict__ coords,
+        const float *__restrict__ feat,
+        int *__restrict__ inds,
+        float *__restrict__ wgts,
+        float *__restrict__ outs);
+template __global__ void TrilinearDevoxelizeKernel<__half>(
+        int b,
+        int c,
+        int n,
+        int r,
+        int r2,
+        int r3,
+        bool is_training,
+        const float *__restrict__ coords,
+        const __half *__restrict__ feat,
+        int *__restrict__ inds,
+        float *__restrict__ wgts,
+        __half *__restrict__ outs);
+
 __global__ void TrilinearDevoxelizeGradKernel(int b,
                                               int c,
                                               int n,
@@ -194,6 +244,74 @@ __global__ void TrilinearDevoxelizeGradKernel(int b,
     }
 }
 
+__global__ void TrilinearDevoxelizeGradKeysKernel(int b,
+                                                  int n,
+                                                  int r3,
+                                                  const int *__restrict__ inds,
+                                                  int64_t *__restrict__ keys,
+                                                  int *__restrict__ order) {
+    const int64_t num_entries = int64_t(b) * 8 * n;
+    const int64_t e = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (e >= num_entries) return;
+
+    const int64_t batch_index = e / (8 * n);
+    keys[e] = batch_index * r3 + inds[e];
+    order[e] = int(e);
+}
+
+template <class T>
+__global__ void TrilinearDevoxelizeGradSortedKernel(
+        int b,
+        int c,
+        int n,
+        int r3,
+        const int *__restrict__ order,
+        const int64_t *__restrict__ voxel_splits,
+        const float *__restrict__ wgts,
+        const T *__restrict__ grad_y,
+        T *__restrict__ grad_x) {
+    const int64_t v = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (v >= int64_t(b) * r3) return;
+
+    const int64_t batch_index = v / r3;
+    const int64_t voxel = v - batch_index * r3;
+    grad_x += batch_index * c * r3 + voxel;
+    grad_y += batch_index * c * n;
+
+    const int64_t begin = voxel_splits[v];
+    const int64_t end = voxel_splits[v + 1];
+    for (int j = 0; j < c; j++) {
+        float g = 0;
+        for (int64_t k = begin; k < end; ++k) {
+            const int e = order[k];
+            // e is batch_index * 8 * n + corner * n + point
+            g += wgts[e] * ToFloat(grad_y[int64_t(j) * n + e % n]);
+        }
+        grad_x[int64_t(j) * r3] = FromFloat<T>(g);
+    }
+}
+
+template __global__ void TrilinearDevoxelizeGradSortedKernel<float>(
+        int b,
+        int c,
+        int n,
+        int r3,
+        const int *__restrict__ order,
+        const int64_t *__restrict__ voxel_splits,
+        const float *__restrict__ wgts,
+        const float *__restrict__ grad_y,
+        float *__restrict__ grad_x);
+template __global__ void TrilinearDevoxelizeGradSortedKernel<__half>(
+        int b,
+        int c,
+        int n,
+        int r3,
+        const int *__restrict__ order,
+        const int64_t *__restrict__ voxel_splits,
+        const float *__restrict__ wgts,
+        const __half *__restrict__ grad_y,
+        __half *__restrict__ grad_x);
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
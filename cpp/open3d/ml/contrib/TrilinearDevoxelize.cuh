@@ -50,10 +50,17 @@
 
 #pragma once
 
+#include <cuda_fp16.h>
+
+#include <cstdint>
+
 namespace open3d {
 namespace ml {
 namespace contrib {
 
+/// Interpolates the voxel features \p feat at the point positions \p coords.
+/// \p T is float or __half. Weights and interpolation are computed in float.
+template <class T>
 __global__ void TrilinearDevoxelizeKernel(int b,
                                           int c,
                                           int n,
@@ -62,11 +69,12 @@ __global__ void TrilinearDevoxelizeKernel(int b,
                                           int r3,
                                           bool is_training,
                                           const float *__restrict__ coords,
-                                          const float *__restrict__ feat,
+                                          const T *__restrict__ feat,
                                           int *__restrict__ inds,
                                           float *__restrict__ wgts,
-                                          float *__restrict__ outs);
+                                          T *__restrict__ outs);
 
+/// Scatters the gradient of each point to its 8 voxels with atomicAdd.
 __global__ void TrilinearDevoxelizeGradKernel(int b,
                                               int c,
                                               int n,
@@ -76,6 +84,31 @@ __global__ void TrilinearDevoxelizeGradKernel(int b,
                                               const float *__restrict__ grad_y,
                                               float *__restrict__ grad_x);
 
+/// Writes the sort key batch * r3 + voxel and the entry index for each of the
+/// b * 8 * n entries of \p inds.
+__global__ void TrilinearDevoxelizeGradKeysKernel(int b,
+                                                  int n,
+                                                  int r3,
+                                                  const int *__restrict__ inds,
+                                                  int64_t *__restrict__ keys,
+                                                  int *__restrict__ order);
+
+/// Gathers the gradient for each voxel from the entries in \p order, which
+/// are sorted by voxel. The entries of voxel v are
+/// order[voxel_splits[v]:voxel_splits[v+1]]. Each voxel is written by a single
+/// thread, so no atomics are needed and the result is deterministic.
+template <class T>
+__global__ void TrilinearDevoxelizeGradSortedKernel(
+        int b,
+        int c,
+        int n,
+        int r3,
+        const int *__restrict__ order,
+        const int64_t *__restrict__ voxel_splits,
+        const float *__restrict__ wgts,
+        const T *__restrict__ grad_y,
+        T *__restrict__ grad_x);
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
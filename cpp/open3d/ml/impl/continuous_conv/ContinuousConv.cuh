@@ -183,6 +183,32 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
     const size_t min_temp_size_bytes = min_num_cols_per_run * bytes_per_column;
     const size_t max_temp_size_bytes = max_num_cols_per_run * bytes_per_column;
 
+    // If the columns of a few output points fit into shared memory use the
+    // fused kernel, which does not write the columns to global memory.
+    const int fused_tile_size =
+            bytes_per_column ? int(std::min(size_t(FUSED_CONV_MAX_TILE_SIZE),
+                                            FUSED_CONV_MAX_SHARED_MEM_SIZE /
+                                                    bytes_per_column))
+                             : 0;
+    if (fused_tile_size > 0) {
+        if (get_temp_size) {
+            // Request a minimal segment such that temp is not null when the
+            // caller runs the operation.
+            mem_temp.Alloc<char>(1);
+            temp_size = mem_temp.MaxUsed();
+            max_temp_size = temp_size;
+            return;
+        }
+        FusedConv<TFeat, TOut, TReal, TIndex>(
+                stream, out_features, filter, in_channels, out_channels,
+                fused_tile_size, num_out, out_positions, inp_positions,
+                inp_features, inp_importance, neighbors_index,
+                neighbors_importance, neighbors_row_splits, extents, offsets,
+                filter_dims, interpolation, coordinate_mapping, align_corners,
+                individual_extent, isotropic_extent, normalize);
+        return;
+    }
+
     if (get_temp_size) {
         std::pair<char*, size_t> tmp =
                 mem_temp.Alloc<char>(min_temp_size_bytes);
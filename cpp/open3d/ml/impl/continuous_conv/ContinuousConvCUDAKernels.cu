@@ -33,25 +33,26 @@ namespace open3d {
 namespace ml {
 namespace impl {
 
-/// Kernel for FillColumn
+/// Accumulates the column of the output point \p out_idx into \p out_column.
+/// The column is processed by \p num_lanes threads of the same warp, which
+/// must be active together. Thread \p lane handles every num_lanes-th input
+/// channel.
 template <class TFeat,
           class TReal,
           class TIndex,
           bool ALIGN_CORNERS,
           CoordinateMapping MAPPING,
           InterpolationMode INTERPOLATION>
-__global__ void FillColumnKernel(
-        TFeat* columns,
+inline __device__ void FillColumnForPoint(
+        TFeat* out_column,
+        TIndex out_idx,
+        int lane,
+        int num_lanes,
         int in_channels,
-        TIndex begin_idx,
-        TIndex end_idx,
-        TIndex num_out,
         const TReal* const __restrict__ out_positions,
-        TIndex num_inp,
         const TReal* const __restrict__ inp_positions,
         const TFeat* const __restrict__ inp_features,
         const TFeat* const __restrict__ inp_importance,
-        size_t neighbors_index_size,
         const TIndex* const __restrict__ neighbors_index,
         const TFeat* const __restrict__ neighbors_importance,
         const int64_t* const __restrict__ neighbors_row_splits,
@@ -65,8 +66,6 @@ __global__ void FillColumnKernel(
         bool NORMALIZE,
         bool POINT_IMPORTANCE,
         bool NEIGHBOR_IMPORTANCE) {
-    TIndex out_idx = begin_idx + blockIdx.x;
-    if (out_idx >= end_idx) return;
     const int NUM_INTERP_VALUES =
             (INTERPOLATION == InterpolationMode::LINEAR ||
                              INTERPOLATION == InterpolationMode::LINEAR_BORDER
@@ -77,9 +76,6 @@ __global__ void FillColumnKernel(
 
     TReal offset[3] = {offsets[0], offsets[1], offsets[2]};
 
-    const TIndex col_idx = out_idx - begin_idx;
-    TFeat* out_column = columns + filter_size_x * filter_size_y *
-                                          filter_size_z * in_channels * col_idx;
     const int64_t neighbor_start = neighbors_row_splits[out_idx];
     const int64_t neighbor_end = neighbors_row_splits[out_idx + 1];
 
@@ -113,13 +109,13 @@ __global__ void FillColumnKernel(
     TReal normalizer = TReal(0);
     if (NORMALIZE) {
         if (NEIGHBOR_IMPORTANCE) {
-            for (int64_t n_idx = neighbor_start + threadIdx.x;
-                 n_idx < neighbor_end; n_idx += blockDim.x) {
+            for (int64_t n_idx = neighbor_start + lane; n_idx < neighbor_end;
+                 n_idx += num_lanes) {
                 TReal n_importance = neighbors_importance[n_idx];
                 normalizer += n_importance;
             }
             unsigned int mask = __activemask();
-            for (int offset = blockDim.x / 2; offset > 0; offset /= 2)
+            for (int offset = num_lanes / 2; offset > 0; offset /= 2)
                 normalizer += __shfl_down_sync(mask, normalizer, offset);
             normalizer = __shfl_sync(mask, normalizer, 0);
         } else {
@@ -151,7 +147,7 @@ __global__ void FillColumnKernel(
         if (NEIGHBOR_IMPORTANCE) importance *= n_importance;
         if (NORMALIZE && normalizer != 0) importance /= normalizer;
 
-        for (int ic = threadIdx.x; ic < in_channels; ic += blockDim.x) {
+        for (int ic = lane; ic < in_channels; ic += num_lanes) {
             infeat = importance * inp_features[inp_idx * in_channels + ic];
             for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
                 TFeat value = interp_weights[j] * infeat;
@@ -161,6 +157,54 @@ __global__ void FillColumnKernel(
     }  // for n
 }
 
+/// Kernel for FillColumn
+template <class TFeat,
+          class TReal,
+          class TIndex,
+          bool ALIGN_CORNERS,
+          CoordinateMapping MAPPING,
+          InterpolationMode INTERPOLATION>
+__global__ void FillColumnKernel(
+        TFeat* columns,
+        int in_channels,
+        TIndex begin_idx,
+        TIndex end_idx,
+        TIndex num_out,
+        const TReal* const __restrict__ out_positions,
+        TIndex num_inp,
+        const TReal* const __restrict__ inp_positions,
+        const TFeat* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_importance,
+        size_t neighbors_index_size,
+        const TIndex* const __restrict__ neighbors_index,
+        const TFeat* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const TReal* const __restrict__ extents,
+        const TReal* const __restrict__ offsets,
+        int filter_size_x,
+        int filter_size_y,
+        int filter_size_z,
+        bool INDIVIDUAL_EXTENT,
+        bool ISOTROPIC_EXTENT,
+        bool NORMALIZE,
+        bool POINT_IMPORTANCE,
+        bool NEIGHBOR_IMPORTANCE) {
+    TIndex out_idx = begin_idx + blockIdx.x;
+    if (out_idx >= end_idx) return;
+
+    const TIndex col_idx = out_idx - begin_idx;
+    TFeat* out_column = columns + filter_size_x * filter_size_y *
+                                          filter_size_z * in_channels * col_idx;
+    FillColumnForPoint<TFeat, TReal, TIndex, ALIGN_CORNERS, MAPPING,
+                       INTERPOLATION>(
+            out_column, out_idx, threadIdx.x, blockDim.x, in_channels,
+            out_positions, inp_positions, inp_features, inp_importance,
+            neighbors_index, neighbors_importance, neighbors_row_splits,
+            extents, offsets, filter_size_x, filter_size_y, filter_size_z,
+            INDIVIDUAL_EXTENT, ISOTROPIC_EXTENT, NORMALIZE, POINT_IMPORTANCE,
+            NEIGHBOR_IMPORTANCE);
+}
+
 template <class TFeat, class TReal, class TIndex>
 void FillColumn(const cudaStream_t& stream,
                 TFeat* columns,
@@ -271,6 +315,199 @@ template void FillColumn<float, float, int32_t>(
         bool isotropic_extent,
         bool normalize);
 
+/// Kernel for FusedConv. Each block computes the output features of
+/// \p tile_size consecutive output points. The columns of the tile are
+/// accumulated in shared memory, one warp per output point, and multiplied
+/// with the filter without going through global memory.
+template <class TFeat,
+          class TOut,
+          class TReal,
+          class TIndex,
+          bool ALIGN_CORNERS,
+          CoordinateMapping MAPPING,
+          InterpolationMode INTERPOLATION>
+__global__ void FusedConvKernel(
+        TOut* out_features,
+        const TFeat* const __restrict__ filter,
+        int in_channels,
+        int out_channels,
+        int tile_size,
+        TIndex num_out,
+        const TReal* const __restrict__ out_positions,
+        const TReal* const __restrict__ inp_positions,
+        const TFeat* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_importance,
+        const TIndex* const __restrict__ neighbors_index,
+        const TFeat* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const TReal* const __restrict__ extents,
+        const TReal* const __restrict__ offsets,
+        int filter_size_x,
+        int filter_size_y,
+        int filter_size_z,
+        bool INDIVIDUAL_EXTENT,
+        bool ISOTROPIC_EXTENT,
+        bool NORMALIZE,
+        bool POINT_IMPORTANCE,
+        bool NEIGHBOR_IMPORTANCE) {
+    extern __shared__ char shared_mem[];
+    TFeat* columns = reinterpret_cast<TFeat*>(shared_mem);
+
+    const int column_size =
+            filter_size_x * filter_size_y * filter_size_z * in_channels;
+    const TIndex tile_begin = TIndex(blockIdx.x) * tile_size;
+    const int num_points = min(TIndex(tile_size), num_out - tile_begin);
+
+    for (int i = threadIdx.x; i < num_points * column_size; i += blockDim.x) {
+        columns[i] = TFeat(0);
+    }
+    __syncthreads();
+
+    const int warp_size = 32;
+    const int num_warps = blockDim.x / warp_size;
+    const int lane = threadIdx.x % warp_size;
+    for (int t = threadIdx.x / warp_size; t < num_points; t += num_warps) {
+        FillColumnForPoint<TFeat, TReal, TIndex, ALIGN_CORNERS, MAPPING,
+                           INTERPOLATION>(
+                columns + t * column_size, tile_begin + t, lane, warp_size,
+                in_channels, out_positions, inp_positions, inp_features,
+                inp_importance, neighbors_index, neighbors_importance,
+                neighbors_row_splits, extents, offsets, filter_size_x,
+                filter_size_y, filter_size_z, INDIVIDUAL_EXTENT,
+                ISOTROPIC_EXTENT, NORMALIZE, POINT_IMPORTANCE,
+                NEIGHBOR_IMPORTANCE);
+    }
+    __syncthreads();
+
+    // The filter has the layout [spatial filter dims, in_channels,
+    // out_channels]. Consecutive threads read consecutive filter values while
+    // all threads read the same column value.
+    for (int oc = threadIdx.x; oc < out_channels; oc += blockDim.x) {
+        TOut acc[FUSED_CONV_MAX_TILE_SIZE];
+#pragma unroll
+        for (int t = 0; t < FUSED_CONV_MAX_TILE_SIZE; ++t) acc[t] = TOut(0);
+
+        for (int k = 0; k < column_size; ++k) {
+            const TOut w = filter[int64_t(k) * out_channels + oc];
+#pragma unroll
+            for (int t = 0; t < FUSED_CONV_MAX_TILE_SIZE; ++t) {
+                if (t < num_points) acc[t] += w * columns[t * column_size + k];
+            }
+        }
+
+#pragma unroll
+        for (int t = 0; t < FUSED_CONV_MAX_TILE_SIZE; ++t) {
+            if (t < num_points) {
+                out_features[int64_t(tile_begin + t) * out_channels + oc] =
+                        acc[t];
+            }
+        }
+    }
+}
+
+template <class TFeat, class TOut, class TReal, class TIndex>
+void FusedConv(const cudaStream_t& stream,
+               TOut* out_features,
+               const TFeat* const __restrict__ filter,
+               int in_channels,
+               int out_channels,
+               int tile_size,
+               TIndex num_out,
+               const TReal* const __restrict__ out_positions,
+               const TReal* const __restrict__ inp_positions,
+               const TFeat* const __restrict__ inp_features,
+               const TFeat* const __restrict__ inp_importance,
+               const TIndex* const __restrict__ neighbors_index,
+               const TFeat* const __restrict__ neighbors_importance,
+               const int64_t* const __restrict__ neighbors_row_splits,
+               const TReal* const __restrict__ extents,
+               const TReal* const __restrict__ offsets,
+               const std::vector<int>& filter_dims,
+               InterpolationMode interpolation,
+               CoordinateMapping coordinate_mapping,
+               bool align_corners,
+               bool individual_extent,
+               bool isotropic_extent,
+               bool normalize) {
+    const int filter_size_z = filter_dims[0];
+    const int filter_size_y = filter_dims[1];
+    const int filter_size_x = filter_dims[2];
+    const size_t shared_mem_size = sizeof(TFeat) * tile_size * filter_size_x *
+                                   filter_size_y * filter_size_z * in_channels;
+
+    const int BLOCKSIZE = 128;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = DivUp(num_out, tile_size);
+
+#define FN_PARAMETERS                                                      \
+    out_features, filter, in_channels, out_channels, tile_size, num_out,   \
+            out_positions, inp_positions, inp_features, inp_importance,    \
+            neighbors_index, neighbors_importance, neighbors_row_splits,   \
+            extents, offsets, filter_size_x, filter_size_y, filter_size_z, \
+            individual_extent, isotropic_extent, normalize,                \
+            inp_importance != nullptr, neighbors_importance != nullptr
+
+#define CALL_TEMPLATE(INTERPOLATION, MAPPING, ALIGN_CORNERS)                \
+    if (INTERPOLATION == interpolation && MAPPING == coordinate_mapping &&  \
+        ALIGN_CORNERS == align_corners)                                     \
+        FusedConvKernel<TFeat, TOut, TReal, TIndex, ALIGN_CORNERS, MAPPING, \
+                        INTERPOLATION>                                      \
+                <<<grid, block, shared_mem_size, stream>>>(FN_PARAMETERS);
+
+#define CALL_TEMPLATE2(INTERPOLATION, MAPPING)  \
+    CALL_TEMPLATE(INTERPOLATION, MAPPING, true) \
+    CALL_TEMPLATE(INTERPOLATION, MAPPING, false)
+
+#define CALL_TEMPLATE3(INTERPOLATION)                                     \
+    CALL_TEMPLATE2(INTERPOLATION, CoordinateMapping::BALL_TO_CUBE_RADIAL) \
+    CALL_TEMPLATE2(INTERPOLATION,                                         \
+                   CoordinateMapping::BALL_TO_CUBE_VOLUME_PRESERVING)     \
+    CALL_TEMPLATE2(INTERPOLATION, CoordinateMapping::IDENTITY)
+
+#define CALL_TEMPLATE4                               \
+    CALL_TEMPLATE3(InterpolationMode::LINEAR)        \
+    CALL_TEMPLATE3(InterpolationMode::LINEAR_BORDER) \
+    CALL_TEMPLATE3(InterpolationMode::NEAREST_NEIGHBOR)
+
+    if (grid.x) {
+        CALL_TEMPLATE4
+        /*CHECK_CUDA_ERROR*/
+    }
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+#undef CALL_TEMPLATE3
+#undef CALL_TEMPLATE4
+
+#undef FN_PARAMETERS
+}
+
+template void FusedConv<float, float, float, int32_t>(
+        const cudaStream_t& stream,
+        float* out_features,
+        const float* const __restrict__ filter,
+        int in_channels,
+        int out_channels,
+        int tile_size,
+        int32_t num_out,
+        const float* const __restrict__ out_positions,
+        const float* const __restrict__ inp_positions,
+        const float* const __restrict__ inp_features,
+        const float* const __restrict__ inp_importance,
+        const int32_t* const __restrict__ neighbors_index,
+        const float* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const float* const __restrict__ extents,
+        const float* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize);
+
 template <class TFeat,
           class TReal,
           class TIndex,
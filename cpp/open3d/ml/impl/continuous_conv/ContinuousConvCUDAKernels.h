@@ -138,6 +138,59 @@ void FillColumn(const cudaStream_t& stream,
                 bool isotropic_extent,
                 bool normalize);
 
+/// The maximum number of output points that FusedConv processes per block.
+constexpr int FUSED_CONV_MAX_TILE_SIZE = 8;
+
+/// The shared memory budget per block for the columns in FusedConv.
+constexpr size_t FUSED_CONV_MAX_SHARED_MEM_SIZE = 48 * 1024;
+
+/// Computes the output features of a continuous convolution without
+/// materializing the columns in global memory. The columns of \p tile_size
+/// output points are accumulated in shared memory and multiplied with the
+/// filter by the same block.
+///
+/// \tparam TFeat    Type for the features and weights
+/// \tparam TOut     Type for the output features
+/// \tparam TReal    Type for point positions and extents
+/// \tparam TIndex   Type for neighbor indexing
+///
+/// \param out_features    Output array for the computed features with shape
+///        [num_out, out_channels]. All values will be overwritten.
+///
+/// \param filter    The filter with shape
+///        [depth, height, width, in_channels, out_channels].
+///
+/// \param tile_size    The number of output points per block. Must be in
+///        [1, FUSED_CONV_MAX_TILE_SIZE] and the columns of the tile must fit
+///        into FUSED_CONV_MAX_SHARED_MEM_SIZE bytes.
+///
+/// For all other parameters see FillColumn.
+///
+template <class TFeat, class TOut, class TReal, class TIndex>
+void FusedConv(const cudaStream_t& stream,
+               TOut* out_features,
+               const TFeat* const __restrict__ filter,
+               int in_channels,
+               int out_channels,
+               int tile_size,
+               TIndex num_out,
+               const TReal* const __restrict__ out_positions,
+               const TReal* const __restrict__ inp_positions,
+               const TFeat* const __restrict__ inp_features,
+               const TFeat* const __restrict__ inp_importance,
+               const TIndex* const __restrict__ neighbors_index,
+               const TFeat* const __restrict__ neighbors_importance,
+               const int64_t* const __restrict__ neighbors_row_splits,
+               const TReal* const __restrict__ extents,
+               const TReal* const __restrict__ offsets,
+               const std::vector<int>& filter_dims,
+               InterpolationMode interpolation,
+               CoordinateMapping coordinate_mapping,
+               bool align_corners,
+               bool individual_extent,
+               bool isotropic_extent,
+               bool normalize);
+
 template <class TFeat, class TReal, class TIndex>
 void FillColumnTranspose(
         const cudaStream_t& stream,
@@ -0,0 +1,290 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <vector>
+
+#include "open3d/ml/impl/misc/VoxelizePoolingCommon.h"
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+namespace voxelize_pooling {
+
+constexpr int BLOCK_SIZE = 256;
+
+/// Computes the voxel hash of each point and initializes the point indices.
+template <class T, int NDIM>
+__global__ void ComputeHashesKernel(
+        const VoxelHasher<T, NDIM> hasher,
+        const int64_t num_points,
+        const T* const __restrict__ points,
+        const int64_t batch_size,
+        const int64_t* const __restrict__ row_splits,
+        int64_t* __restrict__ hashes,
+        int64_t* __restrict__ indices) {
+    const int64_t idx = blockDim.x * int64_t(blockIdx.x) + threadIdx.x;
+    if (idx >= num_points) return;
+
+    // Find the batch item with row_splits[b] <= idx < row_splits[b+1].
+    int64_t lo = 0;
+    int64_t hi = batch_size;
+    while (hi - lo > 1) {
+        const int64_t mid = (lo + hi) / 2;
+        if (row_splits[mid] <= idx) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    typedef utility::MiniVec<T, NDIM> Vec_t;
+    hashes[idx] = hasher.Hash(Vec_t(points + NDIM * idx), lo);
+    indices[idx] = idx;
+}
+
+/// Predicate for the first entry of each voxel in the sorted hashes.
+struct IsVoxelStart {
+    const int64_t* hashes;
+
+    __device__ bool operator()(const int64_t i) const {
+        return i == 0 || hashes[i] != hashes[i - 1];
+    }
+};
+
+/// Computes the coordinates and the pooled position of each voxel and the
+/// voxel index of each point. One thread processes one voxel.
+template <class T, int NDIM>
+__global__ void PoolPositionsKernel(
+        const VoxelHasher<T, NDIM> hasher,
+        const int64_t num_voxels,
+        const int64_t* const __restrict__ voxel_starts,
+        const int64_t* const __restrict__ indices,
+        const T* const __restrict__ points,
+        const VoxelPositionFn position_fn,
+        int32_t* __restrict__ out_voxel_coords,
+        T* __restrict__ out_positions,
+        int64_t* __restrict__ point_voxel_index) {
+    const int64_t voxel_i = blockDim.x * int64_t(blockIdx.x) + threadIdx.x;
+    if (voxel_i >= num_voxels) return;
+
+    typedef utility::MiniVec<T, NDIM> Vec_t;
+    const int64_t begin = voxel_starts[voxel_i];
+    const int64_t end = voxel_starts[voxel_i + 1];
+
+    const auto coords = hasher.Coords(Vec_t(points + NDIM * indices[begin]));
+    for (int d = 0; d < NDIM; ++d) {
+        out_voxel_coords[voxel_i * NDIM + d] = coords[d];
+    }
+
+    Vec_t position(T(0));
+    for (int64_t j = begin; j < end; ++j) {
+        point_voxel_index[indices[j]] = voxel_i;
+        if (position_fn == VoxelPositionFn::AVERAGE) {
+            position += Vec_t(points + NDIM * indices[j]);
+        }
+    }
+    if (position_fn == VoxelPositionFn::CENTER) {
+        position = hasher.Center(coords);
+    } else {
+        position *= T(1) / T(end - begin);
+    }
+    for (int d = 0; d < NDIM; ++d) {
+        out_positions[voxel_i * NDIM + d] = position[d];
+    }
+}
+
+/// Computes the pooled features. One thread processes one channel of one
+/// voxel.
+template <class TFeat>
+__global__ void PoolFeaturesKernel(
+        const int64_t num_voxels,
+        const int64_t num_channels,
+        const int64_t* const __restrict__ voxel_starts,
+        const int64_t* const __restrict__ indices,
+        const TFeat* const __restrict__ features,
+        const VoxelFeatureFn feature_fn,
+        TFeat* __restrict__ out_features) {
+    const int64_t idx = blockDim.x * int64_t(blockIdx.x) + threadIdx.x;
+    if (idx >= num_voxels * num_channels) return;
+    const int64_t voxel_i = idx / num_channels;
+    const int64_t c = idx % num_channels;
+
+    const int64_t begin = voxel_starts[voxel_i];
+    const int64_t end = voxel_starts[voxel_i + 1];
+    TFeat result = features[indices[begin] * num_channels + c];
+    for (int64_t j = begin + 1; j < end; ++j) {
+        const TFeat feat = features[indices[j] * num_channels + c];
+        if (feature_fn == VoxelFeatureFn::MAX) {
+            result = max(result, feat);
+        } else {
+            result += feat;
+        }
+    }
+    if (feature_fn == VoxelFeatureFn::AVERAGE) {
+        result /= TFeat(end - begin);
+    }
+    out_features[idx] = result;
+}
+
+/// Sets the voxel index of the points outside of the domain to -1.
+__global__ void InvalidatePointsKernel(
+        const int64_t num_invalid_points,
+        const int64_t* const __restrict__ indices,
+        int64_t* __restrict__ point_voxel_index) {
+    const int64_t idx = blockDim.x * int64_t(blockIdx.x) + threadIdx.x;
+    if (idx >= num_invalid_points) return;
+    point_voxel_index[indices[idx]] = -1;
+}
+
+}  // namespace voxelize_pooling
+
+/// This function voxelizes a point cloud and pools the positions and features
+/// of the points in each voxel. This is the CUDA version of
+/// VoxelizePoolingCPU() and returns the same voxels in the same order.
+///
+/// All pointer arguments point to device memory unless stated otherwise.
+///
+/// \param stream    The cuda stream for all kernel launches.
+///
+/// For the other parameters see VoxelizePoolingCPU(). The arrays returned by
+/// \p output_allocator must be device memory.
+///
+template <class T, class TFeat, int NDIM, class OUTPUT_ALLOCATOR>
+void VoxelizePoolingCUDA(const cudaStream_t& stream,
+                         const size_t num_points,
+                         const T* const points,
+                         const size_t batch_size,
+                         const int64_t* const row_splits,
+                         const size_t num_channels,
+                         const TFeat* const features,
+                         const T* const voxel_size,
+                         const T* const points_range_min,
+                         const T* const points_range_max,
+                         const VoxelPositionFn position_fn,
+                         const VoxelFeatureFn feature_fn,
+                         int64_t* point_voxel_index,
+                         OUTPUT_ALLOCATOR& output_allocator) {
+    using namespace voxelize_pooling;
+    using open3d::utility::DivUp;
+    const auto policy = thrust::cuda::par.on(stream);
+    const VoxelHasher<T, NDIM> hasher(voxel_size, points_range_min,
+                                      points_range_max, batch_size);
+
+    // Sort the points by their voxel. The radix sort is stable and keeps
+    // the points of a voxel ordered by their index.
+    thrust::device_vector<int64_t> hashes(num_points);
+    thrust::device_vector<int64_t> indices(num_points);
+    if (num_points > 0) {
+        ComputeHashesKernel<T, NDIM>
+                <<<DivUp(num_points, BLOCK_SIZE), BLOCK_SIZE, 0, stream>>>(
+                        hasher, num_points, points, batch_size, row_splits,
+                        hashes.data().get(), indices.data().get());
+    }
+    thrust::stable_sort_by_key(policy, hashes.begin(), hashes.end(),
+                               indices.begin());
+
+    // The points inside the domain are at the front.
+    const int64_t num_valid_points =
+            thrust::lower_bound(policy, hashes.begin(), hashes.end(),
+                                hasher.invalid_hash) -
+            hashes.begin();
+
+    thrust::device_vector<int64_t> voxel_starts(num_valid_points + 1);
+    const int64_t num_voxels =
+            thrust::copy_if(policy, thrust::counting_iterator<int64_t>(0),
+                            thrust::counting_iterator<int64_t>(
+                                    num_valid_points),
+                            voxel_starts.begin(),
+                            IsVoxelStart{hashes.data().get()}) -
+            voxel_starts.begin();
+    voxel_starts[num_voxels] = num_valid_points;
+
+    // The voxels are sorted by hash and the hashes of batch item b start at
+    // b * batch_hash.
+    int64_t* out_batch_splits = nullptr;
+    output_allocator.AllocVoxelBatchSplits(&out_batch_splits, batch_size + 1);
+    {
+        thrust::device_vector<int64_t> voxel_hashes(num_voxels);
+        thrust::gather(policy, voxel_starts.begin(),
+                       voxel_starts.begin() + num_voxels, hashes.begin(),
+                       voxel_hashes.begin());
+        std::vector<int64_t> batch_hashes(batch_size + 1);
+        for (size_t b = 0; b <= batch_size; ++b) {
+            batch_hashes[b] = b * hasher.batch_hash;
+        }
+        thrust::device_vector<int64_t> batch_hashes_d(batch_hashes);
+        thrust::lower_bound(policy, voxel_hashes.begin(), voxel_hashes.end(),
+                            batch_hashes_d.begin(), batch_hashes_d.end(),
+                            thrust::device_pointer_cast(out_batch_splits));
+    }
+
+    int32_t* out_voxel_coords = nullptr;
+    output_allocator.AllocVoxelCoords(&out_voxel_coords, num_voxels, NDIM);
+    T* out_positions = nullptr;
+    output_allocator.AllocPooledPositions(&out_positions, num_voxels, NDIM);
+    TFeat* out_features = nullptr;
+    output_allocator.AllocPooledFeatures(&out_features, num_voxels,
+                                         num_channels);
+
+    if (num_voxels > 0) {
+        PoolPositionsKernel<T, NDIM>
+                <<<DivUp(num_voxels, BLOCK_SIZE), BLOCK_SIZE, 0, stream>>>(
+                        hasher, num_voxels, voxel_starts.data().get(),
+                        indices.data().get(), points, position_fn,
+                        out_voxel_coords, out_positions, point_voxel_index);
+    }
+    if (num_voxels * num_channels > 0) {
+        PoolFeaturesKernel<TFeat>
+                <<<DivUp(num_voxels * num_channels, BLOCK_SIZE), BLOCK_SIZE,
+                   0, stream>>>(num_voxels, num_channels,
+                                voxel_starts.data().get(),
+                                indices.data().get(), features, feature_fn,
+                                out_features);
+    }
+    const int64_t num_invalid_points = num_points - num_valid_points;
+    if (num_invalid_points > 0) {
+        InvalidatePointsKernel<<<DivUp(num_invalid_points, BLOCK_SIZE),
+                                 BLOCK_SIZE, 0, stream>>>(
+                num_invalid_points, indices.data().get() + num_valid_points,
+                point_voxel_index);
+    }
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
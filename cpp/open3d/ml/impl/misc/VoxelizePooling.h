@@ -0,0 +1,241 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "open3d/ml/impl/misc/VoxelizePoolingCommon.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+/// This function voxelizes a point cloud and pools the positions and features
+/// of the points in each voxel. In contrast to running Voxelize and
+/// VoxelPooling after each other the points are sorted into voxels only once.
+/// The voxels are ordered like the voxels of VoxelizeCPU.
+///
+/// \tparam T    Floating-point data type for the point positions.
+///
+/// \tparam TFeat    Floating-point data type for the features.
+///
+/// \tparam NDIM    The number of dimensions of the points.
+///
+/// \tparam OUTPUT_ALLOCATOR    Type of the output_allocator. See
+///         \p output_allocator for more information.
+///
+/// \param num_points    The number of points.
+///
+/// \param points    Array with the point positions. The shape is
+///        [num_points,NDIM].
+///
+/// \param batch_size    The batch size of points.
+///
+/// \param row_splits    row_splits for defining batches.
+///
+/// \param num_channels    The number of feature channels.
+///
+/// \param features    Array with the point features. The shape is
+///        [num_points,num_channels].
+///
+/// \param voxel_size    The edge lengths of the voxel. The shape is
+///        [NDIM]. This pointer points to host memory!
+///
+/// \param points_range_min    The lower bound of the domain to be voxelized.
+///        The shape is [NDIM]. This pointer points to host memory!
+///
+/// \param points_range_max    The upper bound of the domain to be voxelized.
+///        The shape is [NDIM]. This pointer points to host memory!
+///
+/// \param position_fn    Defines how the pooled positions are computed.
+///
+/// \param feature_fn    Defines how the pooled features are computed.
+///
+/// \param point_voxel_index    Output array with the voxel index of each
+///        point or -1 for points outside of the domain. The shape is
+///        [num_points]. This can be used to scatter the pooled features back
+///        to the points.
+///
+/// \param output_allocator    An object that implements functions for
+///         allocating the output arrays. The object must implement
+///         functions AllocVoxelCoords(int32_t** ptr, int64_t rows,
+///         int64_t cols), AllocPooledPositions(T** ptr, int64_t rows,
+///         int64_t cols), AllocPooledFeatures(TFeat** ptr, int64_t rows,
+///         int64_t cols) and AllocVoxelBatchSplits(int64_t** ptr, int64_t
+///         size). All functions should allocate memory and return a pointer
+///         to that memory in ptr. The argments size, rows, and cols
+///         define the size of the array as the number of elements.
+///         All functions must accept zero size arguments. In this case
+///         ptr does not need to be set.
+///
+template <class T, class TFeat, int NDIM, class OUTPUT_ALLOCATOR>
+void VoxelizePoolingCPU(const size_t num_points,
+                        const T* const points,
+                        const size_t batch_size,
+                        const int64_t* const row_splits,
+                        const size_t num_channels,
+                        const TFeat* const features,
+                        const T* const voxel_size,
+                        const T* const points_range_min,
+                        const T* const points_range_max,
+                        const VoxelPositionFn position_fn,
+                        const VoxelFeatureFn feature_fn,
+                        int64_t* point_voxel_index,
+                        OUTPUT_ALLOCATOR& output_allocator) {
+    typedef utility::MiniVec<T, NDIM> Vec_t;
+    const VoxelHasher<T, NDIM> hasher(voxel_size, points_range_min,
+                                      points_range_max, batch_size);
+
+    // Sort the points by their voxel. Points with the same hash are ordered
+    // by their index, which makes the reductions deterministic.
+    std::vector<std::pair<int64_t, int64_t>> hashes_indices(num_points);
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, batch_size),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t b = r.begin(); b != r.end(); ++b) {
+                    for (int64_t i = row_splits[b]; i < row_splits[b + 1];
+                         ++i) {
+                        hashes_indices[i].first =
+                                hasher.Hash(Vec_t(points + NDIM * i), b);
+                        hashes_indices[i].second = i;
+                    }
+                }
+            });
+    tbb::parallel_sort(hashes_indices);
+
+    // The points inside the domain are at the front.
+    const int64_t num_valid_points =
+            std::lower_bound(hashes_indices.begin(), hashes_indices.end(),
+                             std::make_pair(hasher.invalid_hash, int64_t(0))) -
+            hashes_indices.begin();
+
+    // voxel_starts[i] is the first entry of voxel i in hashes_indices.
+    std::vector<int64_t> voxel_starts;
+    for (int64_t i = 0; i < num_valid_points; ++i) {
+        if (i == 0 || hashes_indices[i].first != hashes_indices[i - 1].first) {
+            voxel_starts.push_back(i);
+        }
+    }
+    const int64_t num_voxels = voxel_starts.size();
+    voxel_starts.push_back(num_valid_points);
+
+    int64_t* out_batch_splits = nullptr;
+    output_allocator.AllocVoxelBatchSplits(&out_batch_splits, batch_size + 1);
+    for (size_t b = 0; b <= batch_size; ++b) {
+        out_batch_splits[b] =
+                std::lower_bound(voxel_starts.begin(),
+                                 voxel_starts.begin() + num_voxels,
+                                 int64_t(b) * hasher.batch_hash,
+                                 [&](const int64_t start, const int64_t hash) {
+                                     return hashes_indices[start].first < hash;
+                                 }) -
+                voxel_starts.begin();
+    }
+
+    int32_t* out_voxel_coords = nullptr;
+    output_allocator.AllocVoxelCoords(&out_voxel_coords, num_voxels, NDIM);
+    T* out_positions = nullptr;
+    output_allocator.AllocPooledPositions(&out_positions, num_voxels, NDIM);
+    TFeat* out_features = nullptr;
+    output_allocator.AllocPooledFeatures(&out_features, num_voxels,
+                                         num_channels);
+
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(num_valid_points, num_points),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                    point_voxel_index[hashes_indices[i].second] = -1;
+                }
+            });
+
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_voxels),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t voxel_i = r.begin(); voxel_i != r.end();
+                     ++voxel_i) {
+                    const int64_t begin = voxel_starts[voxel_i];
+                    const int64_t end = voxel_starts[voxel_i + 1];
+                    const T inv_count = T(1) / T(end - begin);
+
+                    const int64_t first_idx = hashes_indices[begin].second;
+                    const auto coords =
+                            hasher.Coords(Vec_t(points + NDIM * first_idx));
+                    for (int d = 0; d < NDIM; ++d) {
+                        out_voxel_coords[voxel_i * NDIM + d] = coords[d];
+                    }
+
+                    Vec_t position(T(0));
+                    if (position_fn == VoxelPositionFn::CENTER) {
+                        position = hasher.Center(coords);
+                    } else {
+                        for (int64_t j = begin; j < end; ++j) {
+                            position += Vec_t(points + NDIM * hashes_indices[j]
+                                                                      .second);
+                        }
+                        position *= inv_count;
+                    }
+                    for (int d = 0; d < NDIM; ++d) {
+                        out_positions[voxel_i * NDIM + d] = position[d];
+                    }
+
+                    TFeat* out_feat = out_features + voxel_i * num_channels;
+                    for (size_t c = 0; c < num_channels; ++c) {
+                        out_feat[c] = feature_fn == VoxelFeatureFn::MAX
+                                              ? std::numeric_limits<
+                                                        TFeat>::lowest()
+                                              : TFeat(0);
+                    }
+                    for (int64_t j = begin; j < end; ++j) {
+                        const int64_t point_idx = hashes_indices[j].second;
+                        point_voxel_index[point_idx] = voxel_i;
+                        const TFeat* feat = features + point_idx * num_channels;
+                        for (size_t c = 0; c < num_channels; ++c) {
+                            if (feature_fn == VoxelFeatureFn::MAX) {
+                                out_feat[c] = std::max(out_feat[c], feat[c]);
+                            } else {
+                                out_feat[c] += feat[c];
+                            }
+                        }
+                    }
+                    if (feature_fn == VoxelFeatureFn::AVERAGE) {
+                        for (size_t c = 0; c < num_channels; ++c) {
+                            out_feat[c] /= TFeat(end - begin);
+                        }
+                    }
+                }
+            });
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
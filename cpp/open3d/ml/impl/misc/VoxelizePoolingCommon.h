@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/utility/MiniVec.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+/// Reduction for the positions of the points in a voxel.
+enum class VoxelPositionFn { AVERAGE = 0, CENTER };
+
+/// Reduction for the features of the points in a voxel.
+enum class VoxelFeatureFn { AVERAGE = 0, MAX };
+
+#ifdef __CUDACC__
+#define HOST_DEVICE __host__ __device__
+#else
+#define HOST_DEVICE
+#endif
+
+/// Maps points to linear voxel indices with the same layout as the Voxelize
+/// op. The index of a voxel is the dot product of its integer coordinates with
+/// the strides plus batch_id * batch_hash. Points outside of
+/// [points_range_min, points_range_max] map to invalid_hash, which is larger
+/// than all valid indices.
+template <class T, int NDIM>
+struct VoxelHasher {
+    typedef utility::MiniVec<T, NDIM> Vec_t;
+
+    VoxelHasher(const T* const voxel_size,
+                const T* const points_range_min,
+                const T* const points_range_max,
+                const int64_t batch_size)
+        : voxel_size(voxel_size),
+          inv_voxel_size(T(1) / Vec_t(voxel_size)),
+          range_min(points_range_min),
+          range_max(points_range_max) {
+        const utility::MiniVec<int32_t, NDIM> extents =
+                ceil((range_max - range_min) * inv_voxel_size)
+                        .template cast<int32_t>();
+        for (int i = 0; i < NDIM; ++i) {
+            strides[i] = 1;
+            for (int j = 0; j < i; ++j) {
+                strides[i] *= extents[j];
+            }
+        }
+        batch_hash = strides[NDIM - 1] * extents[NDIM - 1];
+        invalid_hash = batch_hash * batch_size;
+    }
+
+    HOST_DEVICE utility::MiniVec<int64_t, NDIM> Coords(
+            const Vec_t& point) const {
+        return ((point - range_min) * inv_voxel_size).template cast<int64_t>();
+    }
+
+    HOST_DEVICE int64_t Hash(const Vec_t& point,
+                             const int64_t batch_id) const {
+        if ((point >= range_min && point <= range_max).all()) {
+            return Coords(point).dot(strides) + batch_id * batch_hash;
+        }
+        return invalid_hash;
+    }
+
+    /// Returns the center of the voxel with the integer coordinates \p coords.
+    HOST_DEVICE Vec_t Center(
+            const utility::MiniVec<int64_t, NDIM>& coords) const {
+        return range_min + (coords.template cast<T>() + T(0.5)) * voxel_size;
+    }
+
+    Vec_t voxel_size;
+    Vec_t inv_voxel_size;
+    Vec_t range_min;
+    Vec_t range_max;
+    utility::MiniVec<int64_t, NDIM> strides;
+    int64_t batch_hash;
+    int64_t invalid_hash;
+};
+
+#undef HOST_DEVICE
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
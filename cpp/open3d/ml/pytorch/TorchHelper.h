@@ -136,6 +136,17 @@ inline bool SameDtype(std::initializer_list<torch::Tensor> tensors) {
     return true;
 }
 
+// convenience function to check if any tensor is a half or bfloat16 tensor
+inline bool AnyReducedPrecision(std::initializer_list<torch::Tensor> tensors) {
+    for (auto t : tensors) {
+        if (t.scalar_type() == torch::kHalf ||
+            t.scalar_type() == torch::kBFloat16) {
+            return true;
+        }
+    }
+    return false;
+}
+
 inline std::string TensorInfoStr(std::initializer_list<torch::Tensor> tensors) {
     std::stringstream sstr;
     size_t count = 0;
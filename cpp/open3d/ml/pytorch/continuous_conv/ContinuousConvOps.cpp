@@ -55,6 +55,9 @@ public:
                             Variable neighbors_index,
                             Variable neighbors_importance,
                             Variable neighbors_row_splits,
+                            Variable inv_neighbors_index,
+                            Variable inv_neighbors_row_splits,
+                            Variable inv_arange,
                             const bool align_corners,
                             const std::string& coordinate_mapping_str,
                             const bool normalize,
@@ -82,6 +85,9 @@ public:
         neighbors_index = neighbors_index.contiguous();
         neighbors_importance = neighbors_importance.contiguous();
         neighbors_row_splits = neighbors_row_splits.contiguous();
+        inv_neighbors_index = inv_neighbors_index.contiguous();
+        inv_neighbors_row_splits = inv_neighbors_row_splits.contiguous();
+        inv_arange = inv_arange.contiguous();
 
         // check input shapes
         using namespace open3d::ml::op_util;
@@ -105,6 +111,13 @@ public:
         CHECK_SHAPE(neighbors_index, num_neighbors);
         CHECK_SHAPE(neighbors_importance, num_neighbors || 0);
         CHECK_SHAPE(neighbors_row_splits, num_out_points + 1);
+        if (inv_neighbors_row_splits.size(0)) {
+            CHECK_TYPE(inv_neighbors_row_splits, kInt64);
+            CHECK_TYPE(inv_arange, kInt64);
+            CHECK_SHAPE(inv_neighbors_index, num_neighbors);
+            CHECK_SHAPE(inv_neighbors_row_splits, num_inp_points + 1);
+            CHECK_SHAPE(inv_arange, num_neighbors);
+        }
 
         // make sure that these are on the same device as the filters, positions
         // and feats
@@ -114,6 +127,9 @@ public:
         neighbors_index = neighbors_index.to(device);
         neighbors_importance = neighbors_importance.to(device);
         neighbors_row_splits = neighbors_row_splits.to(device);
+        inv_neighbors_index = inv_neighbors_index.to(device);
+        inv_neighbors_row_splits = inv_neighbors_row_splits.to(device);
+        inv_arange = inv_arange.to(device);
 
         ctx->saved_data["align_corners"] = align_corners;
         ctx->saved_data["coordinate_mapping_str"] = coordinate_mapping_str;
@@ -124,7 +140,8 @@ public:
         ctx->save_for_backward({filters, out_positions, extents, offset,
                                 inp_positions, inp_features, inp_importance,
                                 neighbors_index, neighbors_importance,
-                                neighbors_row_splits});
+                                neighbors_row_splits, inv_neighbors_index,
+                                inv_neighbors_row_splits, inv_arange});
 
         const auto& feat_dtype = filters.dtype();
         const auto& real_dtype = inp_positions.dtype();
@@ -196,6 +213,9 @@ public:
         auto neighbors_index = saved_vars[7];
         auto neighbors_importance = saved_vars[8];
         auto neighbors_row_splits = saved_vars[9];
+        auto inv_neighbors_index = saved_vars[10];
+        auto inv_neighbors_row_splits = saved_vars[11];
+        auto inv_arange = saved_vars[12];
 
         auto device = inp_features.device();
         const auto& feat_dtype = filters.dtype();
@@ -205,6 +225,21 @@ public:
         CHECK_SAME_DTYPE(out_features_gradient, inp_features, filters);
         CHECK_SAME_DEVICE_TYPE(out_features_gradient, inp_features, filters);
 
+        torch::Tensor inv_neighbors_importance;
+        if (inv_neighbors_row_splits.size(0) == 0) {
+            // The caller did not pass the inverted neighbors list.
+            std::tie(inv_neighbors_index, inv_neighbors_row_splits,
+                     inv_neighbors_importance) =
+                    InvertNeighborsList(inp_positions.size(0), neighbors_index,
+                                        neighbors_row_splits,
+                                        neighbors_importance);
+        } else if (neighbors_importance.size(0) > 0) {
+            inv_neighbors_importance =
+                    neighbors_importance.index({inv_arange}).contiguous();
+        } else {
+            inv_neighbors_importance = neighbors_importance;
+        }
+
         // output vars
         torch::Tensor filters_backprop;
         torch::Tensor inp_features_backprop;
@@ -223,13 +258,6 @@ public:
                 out_features_gradient, align_corners, coordinate_mapping,      \
                 normalize, interpolation, max_temp_mem_MB, filters_backprop);  \
                                                                                \
-        torch::Tensor inv_neighbors_index, inv_neighbors_row_splits,           \
-                inv_neighbors_importance;                                      \
-        std::tie(inv_neighbors_index, inv_neighbors_row_splits,                \
-                 inv_neighbors_importance) =                                   \
-                InvertNeighborsList(inp_positions.size(0), neighbors_index,    \
-                                    neighbors_row_splits,                      \
-                                    neighbors_importance);                     \
         auto neighbors_importance_sum = ReduceSubarraysSum(                    \
                 neighbors_importance, neighbors_row_splits);                   \
         inp_features_backprop =                                                \
@@ -271,29 +299,62 @@ public:
                 Variable(),       Variable(), inp_features_backprop,
                 Variable(),       Variable(), Variable(),
                 Variable(),       Variable(), Variable(),
+                Variable(),       Variable(), Variable(),
                 Variable(),       Variable(), Variable()};
     }
 };
-torch::Tensor ContinuousConv(const torch::Tensor& filters,
-                             const torch::Tensor& out_positions,
-                             const torch::Tensor& extents,
-                             const torch::Tensor& offset,
-                             const torch::Tensor& inp_positions,
-                             const torch::Tensor& inp_features,
-                             const torch::Tensor& inp_importance,
-                             const torch::Tensor& neighbors_index,
-                             const torch::Tensor& neighbors_importance,
-                             const torch::Tensor& neighbors_row_splits,
-                             const bool align_corners,
-                             const std::string& coordinate_mapping_str,
-                             const bool normalize,
-                             const std::string& interpolation_str,
-                             const int64_t max_temp_mem_MB) {
+torch::Tensor ContinuousConv(
+        const torch::Tensor& filters,
+        const torch::Tensor& out_positions,
+        const torch::Tensor& extents,
+        const torch::Tensor& offset,
+        const torch::Tensor& inp_positions,
+        const torch::Tensor& inp_features,
+        const torch::Tensor& inp_importance,
+        const torch::Tensor& neighbors_index,
+        const torch::Tensor& neighbors_importance,
+        const torch::Tensor& neighbors_row_splits,
+        const bool align_corners,
+        const std::string& coordinate_mapping_str,
+        const bool normalize,
+        const std::string& interpolation_str,
+        const int64_t max_temp_mem_MB,
+        const c10::optional<torch::Tensor>& inv_neighbors_index,
+        const c10::optional<torch::Tensor>& inv_neighbors_row_splits,
+        const c10::optional<torch::Tensor>& inv_arange) {
+    if (AnyReducedPrecision({filters, inp_features, out_positions,
+                             inp_positions})) {
+        // There are only float32 kernels. Upcast so that the op can be used
+        // under AMP; this is for compatibility and is not faster than
+        // float32. Autograd casts the gradients back to the input dtypes.
+        return ContinuousConv(filters.to(torch::kFloat32),
+                              out_positions.to(torch::kFloat32),
+                              extents.to(torch::kFloat32),
+                              offset.to(torch::kFloat32),
+                              inp_positions.to(torch::kFloat32),
+                              inp_features.to(torch::kFloat32),
+                              inp_importance.to(torch::kFloat32),
+                              neighbors_index,
+                              neighbors_importance.to(torch::kFloat32),
+                              neighbors_row_splits, align_corners,
+                              coordinate_mapping_str, normalize,
+                              interpolation_str, max_temp_mem_MB,
+                              inv_neighbors_index, inv_neighbors_row_splits,
+                              inv_arange)
+                .to(inp_features.scalar_type());
+    }
+    // An empty inverted neighbors list is computed in the backward pass.
+    torch::Tensor empty_index = torch::empty({0}, neighbors_index.options());
+    torch::Tensor empty_int64 = torch::empty(
+            {0}, torch::dtype(torch::kInt64).device(neighbors_index.device()));
     auto ans = ContinuousConvFunction::apply(
             filters, out_positions, extents, offset, inp_positions,
             inp_features, inp_importance, neighbors_index, neighbors_importance,
-            neighbors_row_splits, align_corners, coordinate_mapping_str,
-            normalize, interpolation_str, max_temp_mem_MB);
+            neighbors_row_splits, inv_neighbors_index.value_or(empty_index),
+            inv_neighbors_row_splits.value_or(empty_int64),
+            inv_arange.value_or(empty_int64), align_corners,
+            coordinate_mapping_str, normalize, interpolation_str,
+            max_temp_mem_MB);
     return ans;
 }
 
@@ -304,5 +365,6 @@ static auto registry = torch::RegisterOperators(
         "neighbors_importance, Tensor neighbors_row_splits, bool "
         "align_corners=False, str coordinate_mapping=\"ball_to_cube_radial\", "
         "bool normalize=False, str interpolation=\"linear\", int "
-        "max_temp_mem_MB=64) -> Tensor",
+        "max_temp_mem_MB=64, Tensor? inv_neighbors_index=None, Tensor? "
+        "inv_neighbors_row_splits=None, Tensor? inv_arange=None) -> Tensor",
         &::ContinuousConv);
@@ -326,6 +326,26 @@ torch::Tensor ContinuousConvTranspose(
         const bool normalize,
         const std::string& interpolation_str,
         const int64_t max_temp_mem_MB) {
+    if (AnyReducedPrecision({filters, inp_features, out_positions,
+                             inp_positions})) {
+        // There are only float32 kernels. Upcast so that the op can be used
+        // under AMP; this is for compatibility and is not faster than
+        // float32. Autograd casts the gradients back to the input dtypes.
+        return ContinuousConvTranspose(
+                       filters.to(torch::kFloat32),
+                       out_positions.to(torch::kFloat32),
+                       out_importance.to(torch::kFloat32),
+                       extents.to(torch::kFloat32), offset.to(torch::kFloat32),
+                       inp_positions.to(torch::kFloat32),
+                       inp_features.to(torch::kFloat32), inp_neighbors_index,
+                       inp_neighbors_importance_sum.to(torch::kFloat32),
+                       inp_neighbors_row_splits, neighbors_index,
+                       neighbors_importance.to(torch::kFloat32),
+                       neighbors_row_splits, align_corners,
+                       coordinate_mapping_str, normalize, interpolation_str,
+                       max_temp_mem_MB)
+                .to(inp_features.scalar_type());
+    }
     auto ans = ContinuousConvTransposeFunction::apply(
             filters, out_positions, out_importance, extents, offset,
             inp_positions, inp_features, inp_neighbors_index,
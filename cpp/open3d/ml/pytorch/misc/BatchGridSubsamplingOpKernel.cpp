@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/ml/contrib/GridSubsampling.h"
+#include "open3d/ml/pytorch/misc/BatchGridSubsamplingOpKernel.h"
+#include "torch/script.h"
+
+using namespace open3d::ml::contrib;
+
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+BatchGridSubsamplingCPU(const torch::Tensor& points,
+                        const torch::Tensor& batches,
+                        const torch::Tensor& features,
+                        const torch::Tensor& classes,
+                        double sampleDl,
+                        int64_t max_p) {
+    const int64_t num_points = points.size(0);
+    std::vector<PointXYZ> original_points(
+            reinterpret_cast<const PointXYZ*>(points.data_ptr<float>()),
+            reinterpret_cast<const PointXYZ*>(points.data_ptr<float>()) +
+                    num_points);
+    std::vector<int> original_batches(
+            batches.data_ptr<int32_t>(),
+            batches.data_ptr<int32_t>() + batches.size(0));
+    std::vector<float> original_features(
+            features.data_ptr<float>(),
+            features.data_ptr<float>() + features.numel());
+    std::vector<int> original_classes(
+            classes.data_ptr<int32_t>(),
+            classes.data_ptr<int32_t>() + classes.numel());
+
+    std::vector<PointXYZ> subsampled_points;
+    std::vector<float> subsampled_features;
+    std::vector<int> subsampled_classes;
+    std::vector<int> subsampled_batches;
+    batch_grid_subsampling(original_points, subsampled_points,
+                           original_features, subsampled_features,
+                           original_classes, subsampled_classes,
+                           original_batches, subsampled_batches,
+                           float(sampleDl), int(max_p));
+
+    const int64_t num_out = subsampled_points.size();
+    auto float_opts = torch::dtype(torch::kFloat32);
+    auto int_opts = torch::dtype(torch::kInt32);
+    torch::Tensor sub_points = torch::empty({num_out, 3}, float_opts);
+    std::copy_n(reinterpret_cast<const float*>(subsampled_points.data()),
+                3 * num_out, sub_points.data_ptr<float>());
+    torch::Tensor sub_batches = torch::empty(
+            {int64_t(subsampled_batches.size())}, int_opts);
+    std::copy(subsampled_batches.begin(), subsampled_batches.end(),
+              sub_batches.data_ptr<int32_t>());
+    torch::Tensor sub_features = torch::empty({0}, float_opts);
+    if (features.numel()) {
+        sub_features = torch::empty({num_out, features.size(1)}, float_opts);
+        std::copy(subsampled_features.begin(), subsampled_features.end(),
+                  sub_features.data_ptr<float>());
+    }
+    torch::Tensor sub_classes = torch::empty({0}, int_opts);
+    if (classes.numel()) {
+        sub_classes = torch::empty({num_out}, int_opts);
+        std::copy(subsampled_classes.begin(), subsampled_classes.end(),
+                  sub_classes.data_ptr<int32_t>());
+    }
+    return std::make_tuple(sub_points, sub_batches, sub_features, sub_classes);
+}
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "ATen/cuda/CUDAContext.h"
+#include "open3d/ml/contrib/GridSubsampling.cuh"
+#include "open3d/ml/pytorch/misc/BatchGridSubsamplingOpKernel.h"
+#include "torch/script.h"
+
+using namespace open3d::ml::contrib;
+
+namespace {
+
+class OutputAllocator {
+public:
+    explicit OutputAllocator(const torch::Device& device) : device(device) {}
+
+    void AllocSubPoints(float** ptr, int64_t num) {
+        sub_points = torch::empty(
+                {num, 3}, torch::dtype(torch::kFloat32).device(device));
+        *ptr = sub_points.data_ptr<float>();
+    }
+
+    void AllocSubFeatures(float** ptr, int64_t num, int64_t dim) {
+        sub_features = torch::empty(
+                {num, dim}, torch::dtype(torch::kFloat32).device(device));
+        *ptr = sub_features.data_ptr<float>();
+    }
+
+    void AllocSubClasses(int32_t** ptr, int64_t num, int64_t dim) {
+        sub_classes = torch::empty(
+                {num}, torch::dtype(torch::kInt32).device(device));
+        *ptr = sub_classes.data_ptr<int32_t>();
+    }
+
+    torch::Device device;
+    torch::Tensor sub_points;
+    torch::Tensor sub_features;
+    torch::Tensor sub_classes;
+};
+
+}  // namespace
+
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+BatchGridSubsamplingCUDA(const torch::Tensor& points,
+                         const torch::Tensor& batches,
+                         const torch::Tensor& features,
+                         const torch::Tensor& classes,
+                         double sampleDl,
+                         int64_t max_p) {
+    auto stream = at::cuda::getCurrentCUDAStream();
+    OutputAllocator output_allocator(points.device());
+
+    // batch lengths are needed on the host to compute the output layout
+    torch::Tensor batches_cpu = batches.to(torch::kCPU).contiguous();
+    std::vector<int32_t> subsampled_batches;
+    BatchGridSubsamplingCUDA(
+            stream, points.size(0), points.data_ptr<float>(),
+            features.numel() ? features.size(1) : 0,
+            features.numel() ? features.data_ptr<float>() : nullptr, 1,
+            classes.numel() ? classes.data_ptr<int32_t>() : nullptr,
+            int(batches_cpu.size(0)), batches_cpu.data_ptr<int32_t>(),
+            float(sampleDl), int(max_p), subsampled_batches,
+            output_allocator);
+
+    torch::Tensor sub_batches =
+            torch::tensor(subsampled_batches, torch::dtype(torch::kInt32))
+                    .to(batches.device());
+    torch::Tensor sub_features =
+            features.numel() ? output_allocator.sub_features
+                             : torch::empty({0}, features.options());
+    torch::Tensor sub_classes =
+            classes.numel() ? output_allocator.sub_classes
+                            : torch::empty({0}, classes.options());
+    return std::make_tuple(output_allocator.sub_points, sub_batches,
+                           sub_features, sub_classes);
+}
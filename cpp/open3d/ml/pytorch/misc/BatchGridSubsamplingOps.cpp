@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <vector>
+
+#include "open3d/ml/pytorch/TorchHelper.h"
+#include "open3d/ml/pytorch/misc/BatchGridSubsamplingOpKernel.h"
+#include "torch/script.h"
+
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+BatchGridSubsampling(torch::Tensor points,
+                     torch::Tensor batches,
+                     const double sampleDl,
+                     const c10::optional<torch::Tensor>& features,
+                     const c10::optional<torch::Tensor>& classes,
+                     const int64_t max_p) {
+    points = points.contiguous();
+    CHECK_TYPE(points, kFloat32);
+    CHECK_TYPE(batches, kInt32);
+
+    torch::Tensor features_t =
+            features.has_value()
+                    ? features.value().contiguous()
+                    : torch::empty({0, 0}, points.options());
+    torch::Tensor classes_t =
+            classes.has_value()
+                    ? classes.value().contiguous()
+                    : torch::empty({0}, points.options().dtype(torch::kInt32));
+    CHECK_TYPE(features_t, kFloat32);
+    CHECK_TYPE(classes_t, kInt32);
+    CHECK_SAME_DEVICE_TYPE(points, features_t, classes_t);
+
+    // check input shapes
+    {
+        using namespace open3d::ml::op_util;
+        Dim num_points("num_points");
+        Dim feature_dim("feature_dim");
+        CHECK_SHAPE(points, num_points, 3);
+        CHECK_SHAPE(batches, Dim("num_batches"));
+        if (features.has_value()) {
+            CHECK_SHAPE(features_t, num_points, feature_dim);
+        }
+        if (classes.has_value()) {
+            CHECK_SHAPE(classes_t, num_points);
+        }
+    }
+
+    if (points.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+        return BatchGridSubsamplingCUDA(points, batches, features_t,
+                                        classes_t, sampleDl, max_p);
+#else
+        TORCH_CHECK(false,
+                    "BatchGridSubsampling was not compiled with CUDA support")
+#endif
+    }
+    auto result = BatchGridSubsamplingCPU(
+            points, batches.to(torch::kCPU).contiguous(), features_t,
+            classes_t, sampleDl, max_p);
+    std::get<1>(result) = std::get<1>(result).to(batches.device());
+    return result;
+}
+
+static auto registry = torch::RegisterOperators(
+        "open3d::batch_grid_subsampling(Tensor points, Tensor batches, "
+        "float sampleDl, Tensor? features=None, Tensor? classes=None, "
+        "int max_p=0) -> (Tensor sub_points, Tensor sub_batches, "
+        "Tensor sub_features, Tensor sub_classes)",
+        &BatchGridSubsampling);
@@ -45,6 +45,7 @@ void FixedRadiusSearchCPU(const torch::Tensor& points,
                           const Metric metric,
                           const bool ignore_query_point,
                           const bool return_distances,
+                          const int64_t max_num_neighbors,
                           torch::Tensor& neighbors_index,
                           torch::Tensor& neighbors_row_splits,
                           torch::Tensor& neighbors_distance) {
@@ -65,6 +66,23 @@ void FixedRadiusSearchCPU(const torch::Tensor& points,
 
     neighbors_index = output_allocator.NeighborsIndex();
     neighbors_distance = output_allocator.NeighborsDistance();
+
+    // Match the fixed output size of the CUDA op by truncating or padding.
+    if (max_num_neighbors >= 0) {
+        auto resize = [max_num_neighbors](const torch::Tensor& t) {
+            if (t.size(0) >= max_num_neighbors) {
+                return t.slice(0, 0, max_num_neighbors);
+            }
+            torch::Tensor result =
+                    torch::zeros({max_num_neighbors}, t.options());
+            result.slice(0, 0, t.size(0)).copy_(t);
+            return result;
+        };
+        neighbors_index = resize(neighbors_index);
+        if (return_distances) {
+            neighbors_distance = resize(neighbors_distance);
+        }
+    }
 }
 
 #define INSTANTIATE(T)                                                        \
@@ -76,7 +94,7 @@ void FixedRadiusSearchCPU(const torch::Tensor& points,
             const torch::Tensor& hash_table_index,                            \
             const torch::Tensor& hash_table_cell_splits, const Metric metric, \
             const bool ignore_query_point, const bool return_distances,       \
-            torch::Tensor& neighbors_index,                                   \
+            const int64_t max_num_neighbors, torch::Tensor& neighbors_index,  \
             torch::Tensor& neighbors_row_splits,                              \
             torch::Tensor& neighbors_distance);
 
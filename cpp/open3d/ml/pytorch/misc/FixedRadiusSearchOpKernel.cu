@@ -46,6 +46,7 @@ void FixedRadiusSearchCUDA(const torch::Tensor& points,
                            const Metric metric,
                            const bool ignore_query_point,
                            const bool return_distances,
+                           const int64_t max_num_neighbors,
                            torch::Tensor& neighbors_index,
                            torch::Tensor& neighbors_row_splits,
                            torch::Tensor& neighbors_distance) {
@@ -72,7 +73,8 @@ void FixedRadiusSearchCUDA(const torch::Tensor& points,
             hash_table_cell_splits.size(0),
             (uint32_t*)hash_table_cell_splits.data_ptr<int32_t>(),
             (uint32_t*)hash_table_index.data_ptr<int32_t>(), metric,
-            ignore_query_point, return_distances, output_allocator);
+            ignore_query_point, return_distances, output_allocator,
+            max_num_neighbors);
 
     auto temp_tensor = CreateTempTensor(temp_size, points.device(), &temp_ptr);
 
@@ -88,7 +90,8 @@ void FixedRadiusSearchCUDA(const torch::Tensor& points,
             hash_table_cell_splits.size(0),
             (uint32_t*)hash_table_cell_splits.data_ptr<int32_t>(),
             (uint32_t*)hash_table_index.data_ptr<int32_t>(), metric,
-            ignore_query_point, return_distances, output_allocator);
+            ignore_query_point, return_distances, output_allocator,
+            max_num_neighbors);
 
     neighbors_index = output_allocator.NeighborsIndex();
     neighbors_distance = output_allocator.NeighborsDistance();
@@ -103,7 +106,7 @@ void FixedRadiusSearchCUDA(const torch::Tensor& points,
             const torch::Tensor& hash_table_index,                            \
             const torch::Tensor& hash_table_cell_splits, const Metric metric, \
             const bool ignore_query_point, const bool return_distances,       \
-            torch::Tensor& neighbors_index,                                   \
+            const int64_t max_num_neighbors, torch::Tensor& neighbors_index,  \
             torch::Tensor& neighbors_row_splits,                              \
             torch::Tensor& neighbors_distance);
 
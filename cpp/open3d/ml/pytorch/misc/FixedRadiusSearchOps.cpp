@@ -45,6 +45,7 @@ void FixedRadiusSearchCPU(const torch::Tensor& points,
                           const Metric metric,
                           const bool ignore_query_point,
                           const bool return_distances,
+                          const int64_t max_num_neighbors,
                           torch::Tensor& neighbors_index,
                           torch::Tensor& neighbors_row_splits,
                           torch::Tensor& neighbors_distance);
@@ -61,6 +62,7 @@ void FixedRadiusSearchCUDA(const torch::Tensor& points,
                            const Metric metric,
                            const bool ignore_query_point,
                            const bool return_distances,
+                           const int64_t max_num_neighbors,
                            torch::Tensor& neighbors_index,
                            torch::Tensor& neighbors_row_splits,
                            torch::Tensor& neighbors_distance);
@@ -77,7 +79,8 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> FixedRadiusSearch(
         torch::Tensor hash_table_cell_splits,
         const std::string& metric_str,
         const bool ignore_query_point,
-        const bool return_distances) {
+        const bool return_distances,
+        const int64_t max_num_neighbors) {
     Metric metric = L2;
     if (metric_str == "L1") {
         metric = L1;
@@ -136,8 +139,9 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> FixedRadiusSearch(
 #define FN_PARAMETERS                                                      \
     points, queries, radius, points_row_splits, queries_row_splits,        \
             hash_table_splits, hash_table_index, hash_table_cell_splits,   \
-            metric, ignore_query_point, return_distances, neighbors_index, \
-            neighbors_row_splits, neighbors_distance
+            metric, ignore_query_point, return_distances,                  \
+            max_num_neighbors, neighbors_index, neighbors_row_splits,      \
+            neighbors_distance
 
 #define CALL(type, fn)                                                \
     if (CompareTorchDtype<type>(point_type)) {                        \
@@ -168,6 +172,7 @@ static auto registry = torch::RegisterOperators(
         "radius, Tensor points_row_splits, Tensor queries_row_splits, Tensor "
         "hash_table_splits, Tensor hash_table_index, Tensor "
         "hash_table_cell_splits, str metric=\"L2\", bool ignore_query_point="
-        "False, bool return_distances=False) -> (Tensor neighbors_index, "
-        "Tensor neighbors_row_splits, Tensor neighbors_distance)",
+        "False, bool return_distances=False, int max_num_neighbors=-1) -> "
+        "(Tensor neighbors_index, Tensor neighbors_row_splits, Tensor "
+        "neighbors_distance)",
         &FixedRadiusSearch);
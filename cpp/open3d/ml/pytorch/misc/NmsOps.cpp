@@ -32,16 +32,37 @@
 
 torch::Tensor Nms(torch::Tensor boxes,
                   torch::Tensor scores,
-                  double nms_overlap_thresh) {
+                  double nms_overlap_thresh,
+                  c10::optional<torch::Tensor> labels) {
     boxes = boxes.contiguous();
+    scores = scores.contiguous();
     CHECK_TYPE(boxes, kFloat);
     CHECK_TYPE(scores, kFloat);
+    {
+        using namespace open3d::ml::op_util;
+        Dim num_boxes("num_boxes");
+        Dim box_dim("box_dim");
+        CHECK_SHAPE(boxes, num_boxes, box_dim);
+        CHECK_SHAPE(scores, num_boxes);
+        TORCH_CHECK(box_dim.value() == 5 || box_dim.value() == 7,
+                    "boxes must have 5 or 7 columns");
+        if (labels.has_value()) {
+            CHECK_SHAPE(labels.value(), num_boxes);
+        }
+    }
+    const int64_t* labels_ptr = nullptr;
+    if (labels.has_value()) {
+        labels = labels.value().contiguous();
+        CHECK_TYPE(labels.value(), kInt64);
+        CHECK_SAME_DEVICE_TYPE(boxes, labels.value());
+        labels_ptr = labels.value().data_ptr<int64_t>();
+    }
 
     if (boxes.is_cuda()) {
 #ifdef BUILD_CUDA_MODULE
         std::vector<int64_t> keep_indices = open3d::ml::contrib::NmsCUDAKernel(
                 boxes.data_ptr<float>(), scores.data_ptr<float>(),
-                boxes.size(0), nms_overlap_thresh);
+                boxes.size(0), nms_overlap_thresh, boxes.size(1), labels_ptr);
         return torch::from_blob(keep_indices.data(),
                                 {static_cast<int64_t>(keep_indices.size())},
                                 torch::TensorOptions().dtype(torch::kLong))
@@ -53,7 +74,7 @@ torch::Tensor Nms(torch::Tensor boxes,
     } else {
         std::vector<int64_t> keep_indices = open3d::ml::contrib::NmsCPUKernel(
                 boxes.data_ptr<float>(), scores.data_ptr<float>(),
-                boxes.size(0), nms_overlap_thresh);
+                boxes.size(0), nms_overlap_thresh, boxes.size(1), labels_ptr);
         return torch::from_blob(keep_indices.data(),
                                 {static_cast<int64_t>(keep_indices.size())},
                                 torch::TensorOptions().dtype(torch::kLong))
@@ -63,6 +84,6 @@ torch::Tensor Nms(torch::Tensor boxes,
 
 static auto registry = torch::RegisterOperators(
         "open3d::nms(Tensor boxes, Tensor scores, float "
-        "nms_overlap_thresh) -> "
+        "nms_overlap_thresh, Tensor? labels=None) -> "
         "Tensor keep_indices",
         &Nms);
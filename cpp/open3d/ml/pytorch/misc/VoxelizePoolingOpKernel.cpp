@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/ml/pytorch/misc/VoxelizePoolingOpKernel.h"
+
+#include "open3d/ml/impl/misc/VoxelizePooling.h"
+#include "open3d/ml/pytorch/TorchHelper.h"
+#include "torch/script.h"
+
+using namespace open3d::ml::impl;
+
+template <class T, class TFeat>
+void VoxelizePoolingCPU(const torch::Tensor& points,
+                        const torch::Tensor& row_splits,
+                        const torch::Tensor& features,
+                        const torch::Tensor& voxel_size,
+                        const torch::Tensor& points_range_min,
+                        const torch::Tensor& points_range_max,
+                        const VoxelPositionFn position_fn,
+                        const VoxelFeatureFn feature_fn,
+                        torch::Tensor& voxel_coords,
+                        torch::Tensor& pooled_positions,
+                        torch::Tensor& pooled_features,
+                        torch::Tensor& point_voxel_index,
+                        torch::Tensor& voxel_batch_splits) {
+    VoxelizePoolingOutputAllocator<T, TFeat> output_allocator(
+            points.device().type(), points.device().index());
+
+    switch (points.size(1)) {
+#define CASE(NDIM)                                                            \
+    case NDIM:                                                                \
+        VoxelizePoolingCPU<T, TFeat, NDIM>(                                   \
+                points.size(0), points.data_ptr<T>(), row_splits.size(0) - 1, \
+                row_splits.data_ptr<int64_t>(), features.size(1),             \
+                features.data_ptr<TFeat>(), voxel_size.data_ptr<T>(),         \
+                points_range_min.data_ptr<T>(),                               \
+                points_range_max.data_ptr<T>(), position_fn, feature_fn,      \
+                point_voxel_index.data_ptr<int64_t>(), output_allocator);     \
+        break;
+        CASE(1)
+        CASE(2)
+        CASE(3)
+        CASE(4)
+        CASE(5)
+        CASE(6)
+        CASE(7)
+        CASE(8)
+        default:
+            break;  // will be handled by the generic torch function
+
+#undef CASE
+    }
+
+    voxel_coords = output_allocator.VoxelCoords();
+    pooled_positions = output_allocator.PooledPositions();
+    pooled_features = output_allocator.PooledFeatures();
+    voxel_batch_splits = output_allocator.VoxelBatchSplits();
+}
+
+#define INSTANTIATE(T, TFeat)                                                \
+    template void VoxelizePoolingCPU<T, TFeat>(                              \
+            const torch::Tensor& points, const torch::Tensor& row_splits,    \
+            const torch::Tensor& features, const torch::Tensor& voxel_size,  \
+            const torch::Tensor& points_range_min,                           \
+            const torch::Tensor& points_range_max,                           \
+            const VoxelPositionFn position_fn,                               \
+            const VoxelFeatureFn feature_fn, torch::Tensor& voxel_coords,    \
+            torch::Tensor& pooled_positions, torch::Tensor& pooled_features, \
+            torch::Tensor& point_voxel_index,                                \
+            torch::Tensor& voxel_batch_splits);
+
+INSTANTIATE(float, float)
+INSTANTIATE(float, double)
+INSTANTIATE(double, float)
+INSTANTIATE(double, double)
@@ -0,0 +1,222 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <vector>
+
+#include "open3d/ml/pytorch/TorchHelper.h"
+#include "open3d/ml/pytorch/misc/VoxelizePoolingOpKernel.h"
+#include "torch/script.h"
+
+using namespace open3d::ml::impl;
+using torch::autograd::AutogradContext;
+using torch::autograd::Function;
+using torch::autograd::Variable;
+using torch::autograd::variable_list;
+
+class VoxelizePoolingFunction : public Function<VoxelizePoolingFunction> {
+public:
+    static variable_list forward(AutogradContext* ctx,
+                                 Variable points,
+                                 Variable row_splits,
+                                 Variable features,
+                                 Variable voxel_size,
+                                 Variable points_range_min,
+                                 Variable points_range_max,
+                                 const std::string& position_fn_str,
+                                 const std::string& feature_fn_str) {
+        VoxelPositionFn position_fn = VoxelPositionFn::AVERAGE;
+        if (position_fn_str == "average") {
+            position_fn = VoxelPositionFn::AVERAGE;
+        } else if (position_fn_str == "center") {
+            position_fn = VoxelPositionFn::CENTER;
+        } else {
+            TORCH_CHECK(false,
+                        "position_fn must be one of ('average', 'center') but "
+                        "got " + position_fn_str);
+        }
+        VoxelFeatureFn feature_fn = VoxelFeatureFn::AVERAGE;
+        if (feature_fn_str == "average") {
+            feature_fn = VoxelFeatureFn::AVERAGE;
+        } else if (feature_fn_str == "max") {
+            feature_fn = VoxelFeatureFn::MAX;
+        } else {
+            TORCH_CHECK(false,
+                        "feature_fn must be one of ('average', 'max') but "
+                        "got " + feature_fn_str);
+        }
+
+        points = points.contiguous();
+        row_splits = row_splits.contiguous();
+        features = features.contiguous();
+        CHECK_TYPE(row_splits, kInt64);
+
+        // make sure that these tensors are on the cpu
+        voxel_size = voxel_size.to(torch::kCPU).contiguous();
+        points_range_min = points_range_min.to(torch::kCPU).contiguous();
+        points_range_max = points_range_max.to(torch::kCPU).contiguous();
+
+        CHECK_SAME_DTYPE(points, voxel_size, points_range_min,
+                         points_range_max);
+        CHECK_SAME_DEVICE_TYPE(points, row_splits, features);
+
+        // check input shapes
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_points("num_points");
+            Dim ndim("ndim");
+            Dim num_channels("num_channels");
+            CHECK_SHAPE(points, num_points, ndim);
+            CHECK_SHAPE(features, num_points, num_channels);
+            CHECK_SHAPE(voxel_size, ndim);
+            CHECK_SHAPE(points_range_min, ndim);
+            CHECK_SHAPE(points_range_max, ndim);
+            TORCH_CHECK(0 < ndim.value() && ndim.value() < 9,
+                        "the number of dimensions must be in [1,..,8]");
+        }
+
+        const auto& points_dtype = points.dtype();
+        const auto& features_dtype = features.dtype();
+
+        // output tensors
+        torch::Tensor voxel_coords, pooled_positions, pooled_features,
+                voxel_batch_splits;
+        torch::Tensor point_voxel_index =
+                torch::empty({points.size(0)},
+                             torch::dtype(torch::kInt64)
+                                     .device(points.device().type(),
+                                             points.device().index()));
+
+#define CALL(point_t, feat_t, fn)                                            \
+    if (CompareTorchDtype<point_t>(points_dtype) &&                          \
+        CompareTorchDtype<feat_t>(features_dtype)) {                         \
+        fn<point_t, feat_t>(points, row_splits, features, voxel_size,        \
+                            points_range_min, points_range_max, position_fn, \
+                            feature_fn, voxel_coords, pooled_positions,      \
+                            pooled_features, point_voxel_index,              \
+                            voxel_batch_splits);                             \
+        ctx->save_for_backward(                                              \
+                {features, pooled_features, point_voxel_index});             \
+        ctx->saved_data["feature_fn_str"] = feature_fn_str;                  \
+        ctx->mark_non_differentiable({voxel_coords, pooled_positions,        \
+                                      point_voxel_index,                     \
+                                      voxel_batch_splits});                  \
+        return {voxel_coords, pooled_positions, pooled_features,             \
+                point_voxel_index, voxel_batch_splits};                      \
+    }
+
+        if (points.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+            // pass to cuda function
+            CALL(float, float, VoxelizePoolingCUDA)
+            CALL(float, double, VoxelizePoolingCUDA)
+            CALL(double, float, VoxelizePoolingCUDA)
+            CALL(double, double, VoxelizePoolingCUDA)
+#else
+            TORCH_CHECK(false,
+                        "VoxelizePooling was not compiled with CUDA support")
+#endif
+        } else {
+            CALL(float, float, VoxelizePoolingCPU)
+            CALL(float, double, VoxelizePoolingCPU)
+            CALL(double, float, VoxelizePoolingCPU)
+            CALL(double, double, VoxelizePoolingCPU)
+        }
+#undef CALL
+
+        TORCH_CHECK(false,
+                    "VoxelizePooling does not support " + points.toString() +
+                            " as input for points and " +
+                            features.toString() + " as input for features")
+        return {};
+    }
+
+    static variable_list backward(AutogradContext* ctx,
+                                  variable_list grad_output) {
+        const std::string feature_fn_str =
+                ctx->saved_data["feature_fn_str"].toStringRef();
+        auto saved_vars = ctx->get_saved_variables();
+        auto features = saved_vars[0];
+        auto pooled_features = saved_vars[1];
+        auto point_voxel_index = saved_vars[2];
+        auto pooled_features_gradient = grad_output[2];
+
+        // Scatter the gradient of each voxel back to its points. Points
+        // outside of the domain have the voxel index -1 and get no gradient.
+        torch::Tensor features_backprop = torch::zeros_like(features);
+        if (pooled_features.size(0) > 0) {
+            const auto valid =
+                    point_voxel_index.ge(0).unsqueeze(1).to(features.dtype());
+            const auto voxel_index = point_voxel_index.clamp_min(0);
+            auto weights = valid;
+            if (feature_fn_str == "max") {
+                // Distribute the gradient evenly among the maximal points.
+                const auto is_max = features.eq(
+                        pooled_features.index_select(0, voxel_index));
+                weights = weights * is_max.to(features.dtype());
+            }
+            const auto weight_sums =
+                    torch::zeros_like(pooled_features)
+                            .index_add_(0, voxel_index,
+                                        weights.expand_as(features));
+            features_backprop =
+                    pooled_features_gradient.index_select(0, voxel_index) *
+                    weights /
+                    weight_sums.index_select(0, voxel_index).clamp_min(1);
+        }
+
+        return {Variable(), Variable(), features_backprop, Variable(),
+                Variable(), Variable(), Variable(),        Variable()};
+    }
+};
+
+std::tuple<torch::Tensor,
+           torch::Tensor,
+           torch::Tensor,
+           torch::Tensor,
+           torch::Tensor>
+VoxelizePooling(const torch::Tensor& points,
+                const torch::Tensor& row_splits,
+                const torch::Tensor& features,
+                const torch::Tensor& voxel_size,
+                const torch::Tensor& points_range_min,
+                const torch::Tensor& points_range_max,
+                const std::string& position_fn_str,
+                const std::string& feature_fn_str) {
+    auto ans = VoxelizePoolingFunction::apply(
+            points, row_splits, features, voxel_size, points_range_min,
+            points_range_max, position_fn_str, feature_fn_str);
+    return std::make_tuple(ans[0], ans[1], ans[2], ans[3], ans[4]);
+}
+
+static auto registry = torch::RegisterOperators(
+        "open3d::voxelize_pooling(Tensor points, Tensor row_splits, Tensor "
+        "features, Tensor voxel_size, Tensor points_range_min, Tensor "
+        "points_range_max, str position_fn=\"average\", str "
+        "feature_fn=\"average\") -> (Tensor voxel_coords, Tensor "
+        "pooled_positions, Tensor pooled_features, Tensor point_voxel_index, "
+        "Tensor voxel_batch_splits)",
+        &::VoxelizePooling);
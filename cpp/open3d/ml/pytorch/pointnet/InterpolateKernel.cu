@@ -53,6 +53,10 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
 
 #include <vector>
 
@@ -154,3 +158,54 @@ void three_interpolate_grad_launcher(int b,
         exit(-1);
     }
 }
+
+void three_interpolate_grad_sorted_launcher(int b,
+                                            int c,
+                                            int n,
+                                            int m,
+                                            const float *grad_out,
+                                            const int *idx,
+                                            const float *weight,
+                                            float *grad_points,
+                                            int64_t *keys,
+                                            int *order,
+                                            int64_t *point_splits) {
+    // grad_out: (B, C, N)
+    // weight: (B, N, 3)
+    // output:
+    //      grad_points: (B, C, M)
+
+    cudaError_t err;
+
+    auto stream = at::cuda::getCurrentCUDAStream();
+    const auto policy = thrust::cuda::par.on(stream);
+
+    const int64_t num_entries = int64_t(b) * n * 3;
+    const int64_t num_points = int64_t(b) * m;
+
+    if (num_entries) {
+        three_interpolate_grad_keys_kernel<<<DIVUP(num_entries,
+                                                   THREADS_PER_BLOCK),
+                                             THREADS_PER_BLOCK, 0, stream>>>(
+                b, n, m, idx, keys, order);
+        thrust::sort_by_key(policy, keys, keys + num_entries, order);
+    }
+    thrust::lower_bound(policy, keys, keys + num_entries,
+                        thrust::counting_iterator<int64_t>(0),
+                        thrust::counting_iterator<int64_t>(num_points + 1),
+                        point_splits);
+
+    if (num_points && c) {
+        dim3 blocks(DIVUP(num_points, THREADS_PER_BLOCK), c);
+        dim3 threads(THREADS_PER_BLOCK);
+        three_interpolate_grad_sorted_kernel<<<blocks, threads, 0, stream>>>(
+                b, c, n, m, grad_out, order, point_splits, weight,
+                grad_points);
+    }
+
+    err = cudaGetLastError();
+    if (cudaSuccess != err) {
+        fprintf(stderr, "CUDA kernel failed : %s\n", cudaGetErrorString(err));
+        exit(-1);
+    }
+}
@@ -52,6 +52,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 void three_nn_launcher(int b,
                        int n,
                        int m,
@@ -77,3 +79,23 @@ void three_interpolate_grad_launcher(int b,
                                      const int *idx,
                                      const float *weight,
                                      float *grad_points);
+
+/// Computes the same gradient as three_interpolate_grad_launcher without
+/// atomics. The (point, neighbor) entries are sorted by the point they
+/// scatter to and each point sums its entries in a fixed order, which gives
+/// deterministic results.
+///
+/// \param keys    Temporary array with b * n * 3 elements.
+/// \param order    Temporary array with b * n * 3 elements.
+/// \param point_splits    Temporary array with b * m + 1 elements.
+void three_interpolate_grad_sorted_launcher(int b,
+                                            int c,
+                                            int n,
+                                            int m,
+                                            const float *grad_out,
+                                            const int *idx,
+                                            const float *weight,
+                                            float *grad_points,
+                                            int64_t *keys,
+                                            int *order,
+                                            int64_t *point_splits);
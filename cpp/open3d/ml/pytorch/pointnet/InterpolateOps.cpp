@@ -59,6 +59,7 @@
 
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "open3d/ml/pytorch/pointnet/InterpolateKernel.h"
+#include "open3d/utility/Parallel.h"
 #include "torch/script.h"
 
 #ifdef BUILD_CUDA_MODULE
@@ -131,6 +132,25 @@ torch::Tensor three_interpolate_grad(torch::Tensor grad_out,
 
     float *out_data = out.data_ptr<float>();
 
+    if (open3d::utility::IsDeterministic() ||
+        at::globalContext().deterministicAlgorithms()) {
+        // Sort the (point, neighbor) entries by point and reduce each point
+        // in a single thread instead of using atomics.
+        const int64_t num_entries = int64_t(batch_size) * N * 3;
+        torch::Tensor keys = torch::empty(
+                {num_entries}, torch::dtype(torch::kInt64).device(device));
+        torch::Tensor order = torch::empty(
+                {num_entries}, torch::dtype(torch::kInt32).device(device));
+        torch::Tensor point_splits =
+                torch::empty({int64_t(batch_size) * M + 1},
+                             torch::dtype(torch::kInt64).device(device));
+        three_interpolate_grad_sorted_launcher(
+                batch_size, C, N, M, grad_out_data, idx_data, weights_data,
+                out_data, keys.data_ptr<int64_t>(), order.data_ptr<int>(),
+                point_splits.data_ptr<int64_t>());
+        return out;
+    }
+
     three_interpolate_grad_launcher(batch_size, C, N, M, grad_out_data,
                                     idx_data, weights_data, out_data);
 
@@ -73,6 +73,27 @@ void furthest_point_sampling_launcher(
 
     auto stream = at::cuda::getCurrentCUDAStream();
 
+    // Small batches of large point clouds use multiple blocks per batch item.
+    const int num_blocks = FurthestPointSamplingNumBlocks(b, n);
+    if (num_blocks) {
+        auto options = at::TensorOptions().device(at::kCUDA,
+                                                  at::cuda::current_device());
+        at::Tensor block_dists =
+                at::empty({2 * b * num_blocks}, options.dtype(at::kFloat));
+        at::Tensor block_dists_i =
+                at::empty({2 * b * num_blocks}, options.dtype(at::kInt));
+        err = LaunchFurthestPointSamplingMultiBlock(
+                stream, num_blocks, b, n, m, dataset, temp,
+                block_dists.data_ptr<float>(), block_dists_i.data_ptr<int>(),
+                idxs);
+        if (cudaSuccess != err) {
+            fprintf(stderr, "CUDA kernel failed : %s\n",
+                    cudaGetErrorString(err));
+            exit(-1);
+        }
+        return;
+    }
+
     unsigned int n_threads = OptNumThreads(n);
 
     switch (n_threads) {
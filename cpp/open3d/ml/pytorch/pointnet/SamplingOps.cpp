@@ -54,10 +54,9 @@
 
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "open3d/ml/pytorch/pointnet/SamplingKernel.h"
+#include "open3d/t/geometry/kernel/FarthestPointSampling.h"
 #include "torch/script.h"
 
-#ifdef BUILD_CUDA_MODULE
-
 torch::Tensor furthest_point_sampling(torch::Tensor points,
                                       const int64_t sample_size) {
     int batch_size = points.size(0);
@@ -67,6 +66,20 @@ torch::Tensor furthest_point_sampling(torch::Tensor points,
     torch::Tensor out =
             torch::zeros({batch_size, sample_size},
                          torch::dtype(ToTorchDtype<int>()).device(device));
+
+    if (!points.is_cuda()) {
+        // shares the implementation with t::geometry::PointCloud
+        points = points.contiguous();
+        for (int b = 0; b < batch_size; ++b) {
+            open3d::t::geometry::kernel::pointcloud::FarthestPointSample(
+                    points.data_ptr<float>() + int64_t(b) * pts_size * 3,
+                    pts_size, std::min<int64_t>(sample_size, pts_size),
+                    out.data_ptr<int>() + int64_t(b) * sample_size);
+        }
+        return out;
+    }
+
+#ifdef BUILD_CUDA_MODULE
     torch::Tensor temp =
             torch::full({batch_size, pts_size}, 1e10,
                         torch::dtype(ToTorchDtype<float>()).device(device));
@@ -77,7 +90,10 @@ torch::Tensor furthest_point_sampling(torch::Tensor points,
 
     furthest_point_sampling_launcher(batch_size, pts_size, sample_size,
                                      points_data, temp_data, out_data);
-
+#else
+    TORCH_CHECK(false,
+                "furthest_point_sampling was not compiled with CUDA support")
+#endif
     return out;
 }
 
@@ -85,4 +101,3 @@ static auto registry_fp = torch::RegisterOperators(
         "open3d::furthest_point_sampling(Tensor points, int sample_siz)"
         " -> Tensor out",
         &furthest_point_sampling);
-#endif
@@ -51,6 +51,10 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
 
 #include "ATen/cuda/CUDAContext.h"
 #include "open3d/ml/contrib/TrilinearDevoxelize.cuh"
@@ -59,6 +63,21 @@
 
 using namespace open3d::ml::contrib;
 
+namespace {
+
+// Maps at::Half to the CUDA half type used by the kernels.
+template <class T>
+struct KernelType {
+    typedef T type;
+};
+template <>
+struct KernelType<at::Half> {
+    typedef __half type;
+};
+
+}  // namespace
+
+template <class T>
 void TrilinearDevoxelize(int b,
                          int c,
                          int n,
@@ -67,16 +86,19 @@ void TrilinearDevoxelize(int b,
                          int r3,
                          bool training,
                          const float *coords,
-                         const float *feat,
+                         const T *feat,
                          int *inds,
                          float *wgts,
-                         float *outs) {
+                         T *outs) {
+    typedef typename KernelType<T>::type TKernel;
     cudaError_t err;
 
     auto stream = at::cuda::getCurrentCUDAStream();
 
-    TrilinearDevoxelizeKernel<<<b, OptNumThreads(n), 0, stream>>>(
-            b, c, n, r, r2, r3, training, coords, feat, inds, wgts, outs);
+    TrilinearDevoxelizeKernel<TKernel><<<b, OptNumThreads(n), 0, stream>>>(
+            b, c, n, r, r2, r3, training, coords,
+            reinterpret_cast<const TKernel *>(feat), inds, wgts,
+            reinterpret_cast<TKernel *>(outs));
 
     err = cudaGetLastError();
     if (cudaSuccess != err) {
@@ -106,3 +128,65 @@ void TrilinearDevoxelizeGrad(int b,
         exit(-1);
     }
 }
+
+template <class T>
+void TrilinearDevoxelizeGradSorted(int b,
+                                   int c,
+                                   int n,
+                                   int r3,
+                                   const int *inds,
+                                   const float *wgts,
+                                   const T *grad_y,
+                                   T *grad_x,
+                                   int64_t *keys,
+                                   int *order,
+                                   int64_t *voxel_splits) {
+    typedef typename KernelType<T>::type TKernel;
+    cudaError_t err;
+
+    auto stream = at::cuda::getCurrentCUDAStream();
+    const auto policy = thrust::cuda::par.on(stream);
+
+    const int64_t num_entries = int64_t(b) * 8 * n;
+    const int64_t num_voxels = int64_t(b) * r3;
+    const int block_size = 256;
+
+    if (num_entries) {
+        TrilinearDevoxelizeGradKeysKernel<<<(num_entries + block_size - 1) /
+                                                    block_size,
+                                            block_size, 0, stream>>>(
+                b, n, r3, inds, keys, order);
+        thrust::sort_by_key(policy, keys, keys + num_entries, order);
+    }
+    thrust::lower_bound(policy, keys, keys + num_entries,
+                        thrust::counting_iterator<int64_t>(0),
+                        thrust::counting_iterator<int64_t>(num_voxels + 1),
+                        voxel_splits);
+
+    if (num_voxels) {
+        TrilinearDevoxelizeGradSortedKernel<TKernel>
+                <<<(num_voxels + block_size - 1) / block_size, block_size, 0,
+                   stream>>>(b, c, n, r3, order, voxel_splits, wgts,
+                             reinterpret_cast<const TKernel *>(grad_y),
+                             reinterpret_cast<TKernel *>(grad_x));
+    }
+
+    err = cudaGetLastError();
+    if (cudaSuccess != err) {
+        fprintf(stderr, "CUDA kernel failed : %s\n", cudaGetErrorString(err));
+        exit(-1);
+    }
+}
+
+#define INSTANTIATE(T)                                                       \
+    template void TrilinearDevoxelize<T>(                                    \
+            int b, int c, int n, int r, int r2, int r3, bool training,       \
+            const float *coords, const T *feat, int *inds, float *wgts,      \
+            T *outs);                                                        \
+    template void TrilinearDevoxelizeGradSorted<T>(                          \
+            int b, int c, int n, int r3, const int *inds, const float *wgts, \
+            const T *grad_y, T *grad_x, int64_t *keys, int *order,           \
+            int64_t *voxel_splits);
+
+INSTANTIATE(float)
+INSTANTIATE(at::Half)
@@ -50,6 +50,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 /// This function performs trilinear devoxelization operation.
 /// It computes aggregated features from the voxel grid for each
 /// point passed in the input.
@@ -61,6 +63,7 @@
 /// \param r2   r squared.
 /// \param r3   r cubed.
 /// \param is_training  Whether model is in training phase.
+/// \tparam T   The feature type. Either float or at::Half.
 /// \param coords   Array with the point positions. The shape is
 ///        [b, 3, n]
 /// \param feat    Aray with the voxel grid. The shape is
@@ -69,6 +72,7 @@
 /// \param wgts    weight for trilinear interpolation [b, 8, n]
 /// \param outs    Outputs, FloatTensor[b, c, n]
 ///
+template <class T>
 void TrilinearDevoxelize(int b,
                          int c,
                          int n,
@@ -77,10 +81,10 @@ void TrilinearDevoxelize(int b,
                          int r3,
                          bool is_training,
                          const float *coords,
-                         const float *feat,
+                         const T *feat,
                          int *inds,
                          float *wgts,
-                         float *outs);
+                         T *outs);
 
 /// This function computes gradient for trilinear devoxelization op.
 /// It computes gradient for the input voxelgrid.
@@ -102,3 +106,35 @@ void TrilinearDevoxelizeGrad(int b,
                              const float *wgts,
                              const float *grad_y,
                              float *grad_x);
+
+/// This function computes the same gradient as TrilinearDevoxelizeGrad but
+/// without atomics. The (point, corner) entries are sorted by voxel and each
+/// voxel sums its entries, which avoids contention when many points share
+/// voxels and gives deterministic results.
+///
+/// \param b    The batch size.
+/// \param c    Feature dimension of voxel grid.
+/// \param n    Number of points per batch.
+/// \param r3   resolution cubed.
+/// \param inds    The voxel coordinates of point cube [b, 8, n]
+/// \param wgts    weight for trilinear interpolation [b, 8, n]
+/// \param grad_y    The gradient passed from top.
+/// \param grad_x   The computed gradient for voxelgrid. All entries are
+///        written.
+/// \param keys    Temporary array with b * 8 * n elements.
+/// \param order    Temporary array with b * 8 * n elements.
+/// \param voxel_splits    Temporary array with b * r3 + 1 elements.
+/// \tparam T   The feature type. Either float or at::Half.
+///
+template <class T>
+void TrilinearDevoxelizeGradSorted(int b,
+                                   int c,
+                                   int n,
+                                   int r3,
+                                   const int *inds,
+                                   const float *wgts,
+                                   const T *grad_y,
+                                   T *grad_x,
+                                   int64_t *keys,
+                                   int *order,
+                                   int64_t *voxel_splits);
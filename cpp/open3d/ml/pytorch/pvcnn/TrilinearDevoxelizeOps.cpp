@@ -52,6 +52,7 @@
 
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "open3d/ml/pytorch/pvcnn/TrilinearDevoxelizeKernel.h"
+#include "open3d/utility/Parallel.h"
 #include "torch/script.h"
 
 #ifdef BUILD_CUDA_MODULE
@@ -64,10 +65,10 @@ std::vector<at::Tensor> trilinear_devoxelize_forward(
     CHECK_CUDA(coords);
     CHECK_CONTIGUOUS(features);
     CHECK_CONTIGUOUS(coords);
-    CHECK_TYPE(features, kFloat32);
     CHECK_TYPE(coords, kFloat32);
-
-    CHECK_SAME_DTYPE(features, coords);
+    TORCH_CHECK(features.dtype() == torch::kFloat32 ||
+                        features.dtype() == torch::kFloat16,
+                "features must be float32 or float16");
 
     // check input shapes
     {
@@ -86,37 +87,36 @@ std::vector<at::Tensor> trilinear_devoxelize_forward(
     int n = coords.size(2);
     int r2 = r * r;
     int r3 = r2 * r;
-    at::Tensor outs = torch::zeros(
-            {b, c, n},
+    at::Tensor outs = torch::zeros({b, c, n}, features.options());
+    // indices and weights are only needed for the backward pass
+    const std::vector<int64_t> inds_shape =
+            is_training ? std::vector<int64_t>{b, 8, n}
+                        : std::vector<int64_t>{1};
+    at::Tensor inds = torch::zeros(
+            inds_shape,
+            at::device(features.device()).dtype(at::ScalarType::Int));
+    at::Tensor wgts = torch::zeros(
+            inds_shape,
             at::device(features.device()).dtype(at::ScalarType::Float));
-    if (is_training) {
-        at::Tensor inds = torch::zeros(
-                {b, 8, n},
-                at::device(features.device()).dtype(at::ScalarType::Int));
-        at::Tensor wgts = torch::zeros(
-                {b, 8, n},
-                at::device(features.device()).dtype(at::ScalarType::Float));
-        TrilinearDevoxelize(b, c, n, r, r2, r3, true, coords.data_ptr<float>(),
-                            features.data_ptr<float>(), inds.data_ptr<int>(),
-                            wgts.data_ptr<float>(), outs.data_ptr<float>());
-        return {outs, inds, wgts};
+    if (features.dtype() == torch::kFloat16) {
+        TrilinearDevoxelize(b, c, n, r, r2, r3, is_training,
+                            coords.data_ptr<float>(),
+                            features.data_ptr<at::Half>(), inds.data_ptr<int>(),
+                            wgts.data_ptr<float>(), outs.data_ptr<at::Half>());
     } else {
-        at::Tensor inds = torch::zeros(
-                {1}, at::device(features.device()).dtype(at::ScalarType::Int));
-        at::Tensor wgts = torch::zeros(
-                {1},
-                at::device(features.device()).dtype(at::ScalarType::Float));
-        TrilinearDevoxelize(b, c, n, r, r2, r3, false, coords.data_ptr<float>(),
+        TrilinearDevoxelize(b, c, n, r, r2, r3, is_training,
+                            coords.data_ptr<float>(),
                             features.data_ptr<float>(), inds.data_ptr<int>(),
                             wgts.data_ptr<float>(), outs.data_ptr<float>());
-        return {outs, inds, wgts};
     }
+    return {outs, inds, wgts};
 }
 
 at::Tensor trilinear_devoxelize_backward(const at::Tensor grad_y,
                                          const at::Tensor indices,
                                          const at::Tensor weights,
-                                         const int64_t r) {
+                                         const int64_t r,
+                                         const bool sort_by_voxel) {
     CHECK_CUDA(grad_y);
     CHECK_CUDA(weights);
     CHECK_CUDA(indices);
@@ -124,10 +124,10 @@ at::Tensor trilinear_devoxelize_backward(const at::Tensor grad_y,
     CHECK_CONTIGUOUS(weights);
     CHECK_CONTIGUOUS(indices);
     CHECK_TYPE(indices, kInt32);
-    CHECK_TYPE(grad_y, kFloat32);
     CHECK_TYPE(weights, kFloat32);
-
-    CHECK_SAME_DTYPE(weights, grad_y);
+    TORCH_CHECK(grad_y.dtype() == torch::kFloat32 ||
+                        grad_y.dtype() == torch::kFloat16,
+                "grad_y must be float32 or float16");
 
     // check input shapes
     {
@@ -144,13 +144,46 @@ at::Tensor trilinear_devoxelize_backward(const at::Tensor grad_y,
     int c = grad_y.size(1);
     int n = grad_y.size(2);
     int r3 = r * r * r;
+    if (sort_by_voxel || open3d::utility::IsDeterministic() ||
+        at::globalContext().deterministicAlgorithms()) {
+        // Sort the (point, corner) entries by voxel and reduce each voxel in
+        // a single thread instead of using atomics.
+        at::Tensor grad_x = torch::empty({b, c, r3}, grad_y.options());
+        at::Tensor keys = torch::empty(
+                {int64_t(b) * 8 * n},
+                at::device(grad_y.device()).dtype(at::ScalarType::Long));
+        at::Tensor order = torch::empty(
+                {int64_t(b) * 8 * n},
+                at::device(grad_y.device()).dtype(at::ScalarType::Int));
+        at::Tensor voxel_splits = torch::empty(
+                {int64_t(b) * r3 + 1},
+                at::device(grad_y.device()).dtype(at::ScalarType::Long));
+        if (grad_y.dtype() == torch::kFloat16) {
+            TrilinearDevoxelizeGradSorted(
+                    b, c, n, r3, indices.data_ptr<int>(),
+                    weights.data_ptr<float>(), grad_y.data_ptr<at::Half>(),
+                    grad_x.data_ptr<at::Half>(), keys.data_ptr<int64_t>(),
+                    order.data_ptr<int>(), voxel_splits.data_ptr<int64_t>());
+        } else {
+            TrilinearDevoxelizeGradSorted(
+                    b, c, n, r3, indices.data_ptr<int>(),
+                    weights.data_ptr<float>(), grad_y.data_ptr<float>(),
+                    grad_x.data_ptr<float>(), keys.data_ptr<int64_t>(),
+                    order.data_ptr<int>(), voxel_splits.data_ptr<int64_t>());
+        }
+        return grad_x;
+    }
+
+    // The atomic version accumulates in float32.
+    const at::Tensor grad_y_float = grad_y.to(torch::kFloat32).contiguous();
     at::Tensor grad_x = torch::zeros(
             {b, c, r3},
             at::device(grad_y.device()).dtype(at::ScalarType::Float));
     TrilinearDevoxelizeGrad(b, c, n, r3, indices.data_ptr<int>(),
-                            weights.data_ptr<float>(), grad_y.data_ptr<float>(),
+                            weights.data_ptr<float>(),
+                            grad_y_float.data_ptr<float>(),
                             grad_x.data_ptr<float>());
-    return grad_x;
+    return grad_x.to(grad_y.dtype());
 }
 
 static auto registry = torch::RegisterOperators(
@@ -161,7 +194,7 @@ static auto registry = torch::RegisterOperators(
 
 static auto registry_grad = torch::RegisterOperators(
         "open3d::trilinear_devoxelize_backward(Tensor grad_y,"
-        "Tensor indices, Tensor weights, int r)"
+        "Tensor indices, Tensor weights, int r, bool sort_by_voxel=True)"
         " -> Tensor grad_x",
         &trilinear_devoxelize_backward);
 
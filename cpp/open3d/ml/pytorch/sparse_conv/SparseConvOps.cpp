@@ -51,6 +51,9 @@ public:
                             Variable neighbors_kernel_index,
                             Variable neighbors_importance,
                             Variable neighbors_row_splits,
+                            Variable inv_neighbors_index,
+                            Variable inv_neighbors_row_splits,
+                            Variable inv_arange,
                             const bool normalize,
                             const int64_t max_temp_mem_MB) {
         CHECK_TYPE(neighbors_row_splits, kInt64);
@@ -65,6 +68,9 @@ public:
         neighbors_kernel_index = neighbors_kernel_index.contiguous();
         neighbors_importance = neighbors_importance.contiguous();
         neighbors_row_splits = neighbors_row_splits.contiguous();
+        inv_neighbors_index = inv_neighbors_index.contiguous();
+        inv_neighbors_row_splits = inv_neighbors_row_splits.contiguous();
+        inv_arange = inv_arange.contiguous();
 
         // check input shapes
         using namespace open3d::ml::op_util;
@@ -83,6 +89,13 @@ public:
         CHECK_SHAPE(neighbors_kernel_index, num_neighbors);
         CHECK_SHAPE(neighbors_importance, num_neighbors || 0);
         CHECK_SHAPE(neighbors_row_splits, num_out_points + 1);
+        if (inv_neighbors_row_splits.size(0)) {
+            CHECK_TYPE(inv_neighbors_row_splits, kInt64);
+            CHECK_TYPE(inv_arange, kInt64);
+            CHECK_SHAPE(inv_neighbors_index, num_neighbors);
+            CHECK_SHAPE(inv_neighbors_row_splits, num_inp_points + 1);
+            CHECK_SHAPE(inv_arange, num_neighbors);
+        }
 
         // make sure that these are on the same device as the filters and feats
         auto device = inp_features.device();
@@ -90,13 +103,18 @@ public:
         neighbors_kernel_index = neighbors_kernel_index.to(device);
         neighbors_importance = neighbors_importance.to(device);
         neighbors_row_splits = neighbors_row_splits.to(device);
+        inv_neighbors_index = inv_neighbors_index.to(device);
+        inv_neighbors_row_splits = inv_neighbors_row_splits.to(device);
+        inv_arange = inv_arange.to(device);
 
         ctx->saved_data["normalize"] = normalize;
         ctx->saved_data["max_temp_mem_MB"] = max_temp_mem_MB;
 
         ctx->save_for_backward({filters, inp_features, inp_importance,
                                 neighbors_index, neighbors_kernel_index,
-                                neighbors_importance, neighbors_row_splits});
+                                neighbors_importance, neighbors_row_splits,
+                                inv_neighbors_index, inv_neighbors_row_splits,
+                                inv_arange});
 
         const auto& feat_dtype = filters.dtype();
         const auto& index_dtype = neighbors_index.dtype();
@@ -154,6 +172,9 @@ public:
         auto neighbors_kernel_index = saved_vars[4];
         auto neighbors_importance = saved_vars[5];
         auto neighbors_row_splits = saved_vars[6];
+        auto inv_neighbors_index = saved_vars[7];
+        auto inv_neighbors_row_splits = saved_vars[8];
+        auto inv_arange = saved_vars[9];
 
         auto device = inp_features.device();
         const auto& feat_dtype = filters.dtype();
@@ -163,6 +184,17 @@ public:
         CHECK_SAME_DTYPE(out_features_gradient, inp_features, filters);
         CHECK_SAME_DEVICE_TYPE(out_features_gradient, inp_features, filters);
 
+        if (inv_neighbors_row_splits.size(0) == 0) {
+            // The caller did not pass the inverted neighbors list.
+            torch::Tensor arange = torch::arange(neighbors_index.size(0),
+                                                 torch::device(device));
+            std::tie(inv_neighbors_index, inv_neighbors_row_splits,
+                     inv_arange) = InvertNeighborsList(inp_features.size(0),
+                                                       neighbors_index,
+                                                       neighbors_row_splits,
+                                                       arange);
+        }
+
         // output vars
         torch::Tensor filters_backprop;
         torch::Tensor inp_features_backprop;
@@ -180,13 +212,7 @@ public:
                 neighbors_row_splits, out_features_gradient, normalize,        \
                 max_temp_mem_MB, filters_backprop);                            \
                                                                                \
-        torch::Tensor inv_neighbors_index, inv_neighbors_row_splits,           \
-                inv_neighbors_importance, inv_arange;                          \
-        torch::Tensor arange =                                                 \
-                torch::arange(neighbors_index.size(0), torch::device(device)); \
-        std::tie(inv_neighbors_index, inv_neighbors_row_splits, inv_arange) =  \
-                InvertNeighborsList(inp_features.size(0), neighbors_index,     \
-                                    neighbors_row_splits, arange);             \
+        torch::Tensor inv_neighbors_importance;                                \
         torch::Tensor inv_neighbors_kernel_index =                             \
                 neighbors_kernel_index.index({inv_arange}).contiguous();       \
         if (neighbors_importance.size(0) > 0) {                                \
@@ -239,22 +265,47 @@ public:
                 Variable(),       Variable(),
                 Variable(),       Variable(),
                 Variable(),       Variable(),
-                Variable()};
+                Variable(),       Variable(),
+                Variable(),       Variable()};
     }
 };
-torch::Tensor SparseConv(const torch::Tensor& filters,
-                         const torch::Tensor& inp_features,
-                         const torch::Tensor& inp_importance,
-                         const torch::Tensor& neighbors_index,
-                         const torch::Tensor& neighbors_kernel_index,
-                         const torch::Tensor& neighbors_importance,
-                         const torch::Tensor& neighbors_row_splits,
-                         const bool normalize,
-                         const int64_t max_temp_mem_MB) {
+torch::Tensor SparseConv(
+        const torch::Tensor& filters,
+        const torch::Tensor& inp_features,
+        const torch::Tensor& inp_importance,
+        const torch::Tensor& neighbors_index,
+        const torch::Tensor& neighbors_kernel_index,
+        const torch::Tensor& neighbors_importance,
+        const torch::Tensor& neighbors_row_splits,
+        const bool normalize,
+        const int64_t max_temp_mem_MB,
+        const c10::optional<torch::Tensor>& inv_neighbors_index,
+        const c10::optional<torch::Tensor>& inv_neighbors_row_splits,
+        const c10::optional<torch::Tensor>& inv_arange) {
+    if (AnyReducedPrecision({filters, inp_features})) {
+        // There are only float32 kernels. Upcast so that the op can be used
+        // under AMP; this is for compatibility and is not faster than
+        // float32. Autograd casts the gradients back to the input dtypes.
+        return SparseConv(filters.to(torch::kFloat32),
+                          inp_features.to(torch::kFloat32),
+                          inp_importance.to(torch::kFloat32), neighbors_index,
+                          neighbors_kernel_index,
+                          neighbors_importance.to(torch::kFloat32),
+                          neighbors_row_splits, normalize, max_temp_mem_MB,
+                          inv_neighbors_index, inv_neighbors_row_splits,
+                          inv_arange)
+                .to(inp_features.scalar_type());
+    }
+    // An empty inverted neighbors list is computed in the backward pass.
+    torch::Tensor empty_index = torch::empty({0}, neighbors_index.options());
+    torch::Tensor empty_int64 = torch::empty(
+            {0}, torch::dtype(torch::kInt64).device(neighbors_index.device()));
     auto ans = SparseConvFunction::apply(
             filters, inp_features, inp_importance, neighbors_index,
             neighbors_kernel_index, neighbors_importance, neighbors_row_splits,
-            normalize, max_temp_mem_MB);
+            inv_neighbors_index.value_or(empty_index),
+            inv_neighbors_row_splits.value_or(empty_int64),
+            inv_arange.value_or(empty_int64), normalize, max_temp_mem_MB);
     return ans;
 }
 
@@ -262,6 +313,7 @@ static auto registry = torch::RegisterOperators(
         "open3d::sparse_conv(Tensor filters, Tensor inp_features, Tensor "
         "inp_importance, Tensor neighbors_index, Tensor "
         "neighbors_kernel_index, Tensor neighbors_importance, Tensor "
-        "neighbors_row_splits, bool normalize=False, int max_temp_mem_MB=64) "
-        "-> Tensor",
+        "neighbors_row_splits, bool normalize=False, int max_temp_mem_MB=64, "
+        "Tensor? inv_neighbors_index=None, Tensor? "
+        "inv_neighbors_row_splits=None, Tensor? inv_arange=None) -> Tensor",
         &::SparseConv);
@@ -269,6 +269,21 @@ torch::Tensor SparseConvTranspose(
         const torch::Tensor& neighbors_row_splits,
         const bool normalize,
         const int64_t max_temp_mem_MB) {
+    if (AnyReducedPrecision({filters, inp_features})) {
+        // There are only float32 kernels. Upcast so that the op can be used
+        // under AMP; this is for compatibility and is not faster than
+        // float32. Autograd casts the gradients back to the input dtypes.
+        return SparseConvTranspose(
+                       filters.to(torch::kFloat32),
+                       out_importance.to(torch::kFloat32),
+                       inp_features.to(torch::kFloat32), inp_neighbors_index,
+                       inp_neighbors_importance_sum.to(torch::kFloat32),
+                       inp_neighbors_row_splits, neighbors_index,
+                       neighbors_kernel_index,
+                       neighbors_importance.to(torch::kFloat32),
+                       neighbors_row_splits, normalize, max_temp_mem_MB)
+                .to(inp_features.scalar_type());
+    }
     auto ans = SparseConvTransposeFunction::apply(
             filters, out_importance, inp_features, inp_neighbors_index,
             inp_neighbors_importance_sum, inp_neighbors_row_splits,
@@ -219,6 +219,13 @@ hash_table_index: Stores the values of the hash table, which are the indices of
 
 hash_table_cell_splits: Defines the start and end of each hash table cell.
 
+max_num_neighbors:
+  This argument is only available for PyTorch. If not negative the outputs
+  'neighbors_index' and 'neighbors_distance' have this fixed size and the CUDA
+  op does not synchronize with the host, which allows capturing it in a CUDA
+  graph. Neighbors beyond this size are dropped and the last element of
+  'neighbors_row_splits' is the total number of neighbors found.
+
 neighbors_index:
   The compact list of indices of the neighbors. The corresponding query point
   can be inferred from the 'neighbor_count_row_splits' vector.
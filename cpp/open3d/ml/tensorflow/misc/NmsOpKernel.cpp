@@ -41,7 +41,8 @@ public:
                 const tensorflow::Tensor& scores) {
         std::vector<int64_t> keep_indices = open3d::ml::contrib::NmsCPUKernel(
                 boxes.flat<float>().data(), scores.flat<float>().data(),
-                boxes.dim_size(0), this->nms_overlap_thresh);
+                boxes.dim_size(0), this->nms_overlap_thresh,
+                boxes.dim_size(1));
 
         OutputAllocator output_allocator(context);
         int64_t* ret_keep_indices = nullptr;
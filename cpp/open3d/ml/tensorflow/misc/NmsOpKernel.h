@@ -72,9 +72,13 @@ public:
         {
             using namespace open3d::ml::op_util;
             Dim num_points("num_points");
-            Dim five(5, "five");
-            CHECK_SHAPE(context, boxes, num_points, five);
+            Dim box_dim("box_dim");
+            CHECK_SHAPE(context, boxes, num_points, box_dim);
             CHECK_SHAPE(context, scores, num_points);
+            OP_REQUIRES(context, box_dim.value() == 5 || box_dim.value() == 7,
+                        errors::InvalidArgument(
+                                "boxes must have 5 or 7 columns but got ",
+                                box_dim.value()));
         }
 
         Kernel(context, boxes, scores);
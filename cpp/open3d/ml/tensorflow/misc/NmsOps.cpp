@@ -47,8 +47,8 @@ REGISTER_OP("Open3DNms")
             TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &scores));
 
             Dim num_points("num_points");
-            Dim five(5, "five");
-            CHECK_SHAPE_HANDLE(c, boxes, num_points, five);
+            Dim box_dim("box_dim");
+            CHECK_SHAPE_HANDLE(c, boxes, num_points, box_dim);
             CHECK_SHAPE_HANDLE(c, scores, num_points);
 
             keep_indices = c->MakeShape({c->UnknownDim()});
@@ -94,7 +94,9 @@ Minimal example::
   keep_indices = ml3d.ops.nms(boxes, scores, nms_overlap_thresh)
   print(keep_indices)
 
-boxes: (N, 5) float32 tensor. Bounding boxes are represented as (x0, y0, x1, y1, rotate).
+boxes: (N, 5) or (N, 7) float32 tensor. Bird's eye view bounding boxes are
+  represented as (x0, y0, x1, y1, rotate). Rotated 3D bounding boxes are
+  represented as (x, y_max, z, x_size, y_size, z_size, y_rotate).
 
 scores: (N,) float32 tensor. A higher score means a more confident bounding box.
 
@@ -102,5 +104,9 @@ nms_overlap_thresh: float value between 0 and 1. When a high-score box is
   selected, other remaining boxes with IoU > nms_overlap_thresh will be discarded.
   A higher nms_overlap_thresh means more boxes will be kept.
 
-keep_indices: (M,) int64 tensor. The selected box indices.
+labels: (N,) int64 tensor. Optional class labels. If given, only boxes with the
+  same label suppress each other. This argument is only available for PyTorch.
+
+keep_indices: (M,) int64 tensor. The selected box indices sorted by decreasing
+  score.
 )doc");
@@ -61,6 +61,33 @@ public:
 
         cudaError_t err;
 
+        // Small batches of large point clouds use multiple blocks per batch
+        // item.
+        const int num_blocks = FurthestPointSamplingNumBlocks(b, n);
+        if (num_blocks) {
+            Tensor block_dists, block_dists_i;
+            OP_REQUIRES_OK(context,
+                           context->allocate_temp(
+                                   DataTypeToEnum<float>::value,
+                                   TensorShape{2 * b * num_blocks},
+                                   &block_dists));
+            OP_REQUIRES_OK(context,
+                           context->allocate_temp(
+                                   DataTypeToEnum<int>::value,
+                                   TensorShape{2 * b * num_blocks},
+                                   &block_dists_i));
+            err = LaunchFurthestPointSamplingMultiBlock(
+                    stream, num_blocks, b, n, m, dataset, temp,
+                    block_dists.flat<float>().data(),
+                    block_dists_i.flat<int>().data(), idxs);
+            if (cudaSuccess != err) {
+                fprintf(stderr, "CUDA kernel failed : %s\n",
+                        cudaGetErrorString(err));
+                exit(-1);
+            }
+            return;
+        }
+
         unsigned int n_threads = OptNumThreads(n);
 
         switch (n_threads) {
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#define EIGEN_USE_GPU
+#include "open3d/ml/contrib/GridSubsampling.cuh"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+
+using namespace tensorflow;
+using namespace open3d::ml::contrib;
+
+class BatchGridSubsamplingOpCUDA : public OpKernel {
+public:
+    explicit BatchGridSubsamplingOpCUDA(OpKernelConstruction* context)
+        : OpKernel(context) {}
+
+    class OutputAllocator {
+    public:
+        explicit OutputAllocator(OpKernelContext* context)
+            : context(context) {}
+
+        void AllocSubPoints(float** ptr, int64_t num) {
+            Tensor* tensor = nullptr;
+            OP_REQUIRES_OK(context, context->allocate_output(
+                                            0, TensorShape({num, 3}), &tensor));
+            *ptr = tensor->flat<float>().data();
+        }
+
+        // Features and labels are not supported by this op.
+        void AllocSubFeatures(float** ptr, int64_t num, int64_t dim) {}
+        void AllocSubClasses(int32_t** ptr, int64_t num, int64_t dim) {}
+
+    private:
+        OpKernelContext* context;
+    };
+
+    void Compute(OpKernelContext* context) override {
+        const Tensor& points_tensor = context->input(0);
+        const Tensor& batches_tensor = context->input(1);
+        const Tensor& dl_tensor = context->input(2);
+
+        OP_REQUIRES(context,
+                    points_tensor.dims() == 2 &&
+                            points_tensor.dim_size(1) == 3,
+                    errors::InvalidArgument("points must have shape [N,3]"));
+        OP_REQUIRES(context, batches_tensor.dims() == 1,
+                    errors::InvalidArgument("batches must be a vector"));
+
+        const float sampleDl = dl_tensor.flat<float>().data()[0];
+        const int num_batches = int(batches_tensor.dim_size(0));
+
+        auto device = context->eigen_gpu_device();
+        OutputAllocator output_allocator(context);
+        std::vector<int32_t> subsampled_batches;
+        BatchGridSubsamplingCUDA(
+                device.stream(), points_tensor.dim_size(0),
+                points_tensor.flat<float>().data(), 0, nullptr, 0, nullptr,
+                num_batches, batches_tensor.flat<int32_t>().data(), sampleDl,
+                0, subsampled_batches, output_allocator);
+
+        Tensor* sub_batches_output = nullptr;
+        OP_REQUIRES_OK(context,
+                       context->allocate_output(1, TensorShape({num_batches}),
+                                                &sub_batches_output));
+        std::copy(subsampled_batches.begin(), subsampled_batches.end(),
+                  sub_batches_output->flat<int32_t>().data());
+    }
+};
+
+REGISTER_KERNEL_BUILDER(Name("Open3DBatchGridSubsampling")
+                                .Device(DEVICE_GPU)
+                                .HostMemory("batches")
+                                .HostMemory("dl")
+                                .HostMemory("sub_batches"),
+                        BatchGridSubsamplingOpCUDA);
@@ -27,11 +27,14 @@
 #include "open3d/pipelines/color_map/ColorMapUtils.h"
 
 #include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/pipelines/color_map/ImageWarpingField.h"
+#include "open3d/t/geometry/Image.h"
 #include "open3d/utility/Parallel.h"
 
 namespace open3d {
@@ -131,6 +134,73 @@ std::vector<geometry::Image> CreateDepthBoundaryMasks(
     return masks;
 }
 
+/// Tensor version of the visibility test of CreateVertexAndImageVisibility()
+/// for one camera. \p vertices is a (N, 3) Float64 tensor on the device that
+/// runs the test. Returns the ids of the visible vertices in increasing order.
+static std::vector<int> ComputeVisibleVertices(
+        const core::Tensor& vertices,
+        const geometry::Image& image_depth,
+        const geometry::Image& image_mask,
+        const camera::PinholeCameraParameters& camera_parameter,
+        double maximum_allowable_depth,
+        double depth_threshold_for_visibility_check) {
+    const core::Device& device = vertices.GetDevice();
+    const core::Tensor extrinsic =
+            core::eigen_converter::EigenMatrixToTensor(
+                    camera_parameter.extrinsic_)
+                    .To(device);
+    const core::Tensor points =
+            vertices.Matmul(extrinsic.Slice(0, 0, 3).Slice(1, 0, 3).T()) +
+            extrinsic.Slice(0, 0, 3).Slice(1, 3, 4).T();
+    const core::Tensor x = points.Slice(1, 0, 1).Reshape({-1});
+    const core::Tensor y = points.Slice(1, 1, 2).Reshape({-1});
+    const core::Tensor z = points.Slice(1, 2, 3).Reshape({-1});
+
+    // Same rounding as Project3DPointAndGetUVDepth() followed by round().
+    std::pair<double, double> f = camera_parameter.intrinsic_.GetFocalLength();
+    std::pair<double, double> p =
+            camera_parameter.intrinsic_.GetPrincipalPoint();
+    const core::Tensor u = (x * f.first / z + p.first)
+                                   .To(core::Float32)
+                                   .Round()
+                                   .To(core::Int64);
+    const core::Tensor v = (y * f.second / z + p.second)
+                                   .To(core::Float32)
+                                   .Round()
+                                   .To(core::Int64);
+    const core::Tensor d = z.To(core::Float32);
+
+    const int64_t width = image_depth.width_;
+    const int64_t height = image_depth.height_;
+    core::Tensor visible = d.Ge(0.0)
+                                   .LogicalAnd(u.Ge(0))
+                                   .LogicalAnd(u.Lt(width))
+                                   .LogicalAnd(v.Ge(0))
+                                   .LogicalAnd(v.Lt(height));
+    // Pixels of vertices outside the image are clamped, and masked out above.
+    const core::Tensor pixel =
+            v.Clip(0, height - 1) * width + u.Clip(0, width - 1);
+    const core::Tensor d_sensor =
+            t::geometry::Image::FromLegacy(image_depth, device)
+                    .AsTensor()
+                    .Reshape({-1})
+                    .IndexGet({pixel});
+    const core::Tensor mask =
+            t::geometry::Image::FromLegacy(image_mask, device)
+                    .AsTensor()
+                    .Reshape({-1})
+                    .IndexGet({pixel});
+    visible = visible.LogicalAnd(d_sensor.Le(maximum_allowable_depth))
+                      .LogicalAnd(mask.Ne(255))
+                      .LogicalAnd((d - d_sensor).Abs().Lt(
+                              depth_threshold_for_visibility_check));
+    return visible.NonZero()
+            .Reshape({-1})
+            .To(core::Int32)
+            .To(core::Device("CPU:0"))
+            .ToFlatVector<int>();
+}
+
 std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
 CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
@@ -138,7 +208,8 @@ CreateVertexAndImageVisibility(
         const std::vector<geometry::Image>& images_mask,
         const camera::PinholeCameraTrajectory& camera_trajectory,
         double maximum_allowable_depth,
-        double depth_threshold_for_visibility_check) {
+        double depth_threshold_for_visibility_check,
+        const core::Device& device) {
     size_t n_camera = camera_trajectory.parameters_.size();
     size_t n_vertex = mesh.vertices_.size();
     // visibility_image_to_vertex[c]: vertices visible by camera c.
@@ -148,40 +219,59 @@ CreateVertexAndImageVisibility(
     std::vector<std::vector<int>> visibility_vertex_to_image;
     visibility_vertex_to_image.resize(n_vertex);
 
+    if (device.GetType() == core::Device::DeviceType::CPU) {
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
-        for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
-            Eigen::Vector3d X = mesh.vertices_[vertex_id];
-            float u, v, d;
-            std::tie(u, v, d) = Project3DPointAndGetUVDepth(
-                    X, camera_trajectory.parameters_[camera_id]);
-            int u_d = int(round(u)), v_d = int(round(v));
-            // Skip if vertex in image boundary.
-            if (d < 0.0 ||
-                !images_depth[camera_id].TestImageBoundary(u_d, v_d)) {
-                continue;
-            }
-            // Skip if vertex's depth is too large (e.g. background).
-            float d_sensor =
-                    *images_depth[camera_id].PointerAt<float>(u_d, v_d);
-            if (d_sensor > maximum_allowable_depth) {
-                continue;
-            }
-            // Check depth boundary mask. If a vertex is located at the boundary
-            // of an object, its color will be highly diverse from different
-            // viewing angles.
-            if (*images_mask[camera_id].PointerAt<uint8_t>(u_d, v_d) == 255) {
-                continue;
+        for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+            for (int vertex_id = 0; vertex_id < int(n_vertex); vertex_id++) {
+                Eigen::Vector3d X = mesh.vertices_[vertex_id];
+                float u, v, d;
+                std::tie(u, v, d) = Project3DPointAndGetUVDepth(
+                        X, camera_trajectory.parameters_[camera_id]);
+                int u_d = int(round(u)), v_d = int(round(v));
+                // Skip if vertex in image boundary.
+                if (d < 0.0 ||
+                    !images_depth[camera_id].TestImageBoundary(u_d, v_d)) {
+                    continue;
+                }
+                // Skip if vertex's depth is too large (e.g. background).
+                float d_sensor =
+                        *images_depth[camera_id].PointerAt<float>(u_d, v_d);
+                if (d_sensor > maximum_allowable_depth) {
+                    continue;
+                }
+                // Check depth boundary mask. If a vertex is located at the
+                // boundary of an object, its color will be highly diverse
+                // from different viewing angles.
+                if (*images_mask[camera_id].PointerAt<uint8_t>(u_d, v_d) ==
+                    255) {
+                    continue;
+                }
+                // Check depth errors.
+                if (std::fabs(d - d_sensor) >=
+                    depth_threshold_for_visibility_check) {
+                    continue;
+                }
+                visibility_image_to_vertex[camera_id].push_back(vertex_id);
             }
-            // Check depth errors.
-            if (std::fabs(d - d_sensor) >=
-                depth_threshold_for_visibility_check) {
-                continue;
-            }
-            visibility_image_to_vertex[camera_id].push_back(vertex_id);
-#pragma omp critical(CreateVertexAndImageVisibility)
-            { visibility_vertex_to_image[vertex_id].push_back(camera_id); }
+        }
+    } else {
+        const core::Tensor vertices =
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        mesh.vertices_, core::Float64, device);
+        for (size_t camera_id = 0; camera_id < n_camera; camera_id++) {
+            visibility_image_to_vertex[camera_id] = ComputeVisibleVertices(
+                    vertices, images_depth[camera_id], images_mask[camera_id],
+                    camera_trajectory.parameters_[camera_id],
+                    maximum_allowable_depth,
+                    depth_threshold_for_visibility_check);
+        }
+    }
+    // Inverting the per camera lists keeps the cameras of each vertex in
+    // increasing order, without synchronizing the threads above.
+    for (int camera_id = 0; camera_id < int(n_camera); camera_id++) {
+        for (int vertex_id : visibility_image_to_vertex[camera_id]) {
+            visibility_vertex_to_image[vertex_id].push_back(camera_id);
         }
     }
 
@@ -252,8 +342,7 @@ void SetGeometryColorAverage(
     size_t n_vertex = mesh.vertices_.size();
     mesh.vertex_colors_.clear();
     mesh.vertex_colors_.resize(n_vertex);
-    std::vector<size_t> valid_vertices;
-    std::vector<size_t> invalid_vertices;
+    std::vector<uint8_t> is_valid(n_vertex, 0);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
     for (int i = 0; i < (int)n_vertex; i++) {
@@ -287,14 +376,18 @@ void SetGeometryColorAverage(
                 sum += 1.0;
             }
         }
-#pragma omp critical(SetGeometryColorAverage)
-        {
-            if (sum > 0.0) {
-                mesh.vertex_colors_[i] /= sum;
-                valid_vertices.push_back(i);
-            } else {
-                invalid_vertices.push_back(i);
-            }
+        if (sum > 0.0) {
+            mesh.vertex_colors_[i] /= sum;
+            is_valid[i] = 1;
+        }
+    }
+    std::vector<size_t> valid_vertices;
+    std::vector<size_t> invalid_vertices;
+    for (size_t i = 0; i < n_vertex; i++) {
+        if (is_valid[i]) {
+            valid_vertices.push_back(i);
+        } else {
+            invalid_vertices.push_back(i);
         }
     }
     if (invisible_vertex_color_knn > 0) {
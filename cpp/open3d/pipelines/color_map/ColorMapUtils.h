@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/Device.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -53,6 +54,9 @@ std::vector<geometry::Image> CreateDepthBoundaryMasks(
         double depth_threshold_for_discontinuity_check,
         int half_dilation_kernel_size_for_discontinuity_map);
 
+/// Computes the vertices visible by each camera and the cameras seeing each
+/// vertex. Both lists are sorted. The test runs with OpenMP over the cameras
+/// on a CPU \p device, and with tensor operations over the vertices otherwise.
 std::tuple<std::vector<std::vector<int>>, std::vector<std::vector<int>>>
 CreateVertexAndImageVisibility(
         const geometry::TriangleMesh& mesh,
@@ -60,7 +64,8 @@ CreateVertexAndImageVisibility(
         const std::vector<geometry::Image>& images_mask,
         const camera::PinholeCameraTrajectory& camera_trajectory,
         double maximum_allowable_depth,
-        double depth_threshold_for_visibility_check);
+        double depth_threshold_for_visibility_check,
+        const core::Device& device = core::Device("CPU:0"));
 
 void SetProxyIntensityForVertex(
         const geometry::TriangleMesh& mesh,
@@ -285,7 +285,8 @@ geometry::TriangleMesh RunNonRigidOptimizer(
             CreateVertexAndImageVisibility(
                     opt_mesh, images_depth, images_mask, opt_camera_trajectory,
                     option.maximum_allowable_depth_,
-                    option.depth_threshold_for_visibility_check_);
+                    option.depth_threshold_for_visibility_check_,
+                    option.device_);
 
     utility::LogDebug("[ColorMapOptimization] Non-Rigid Optimization");
     warping_fields = CreateWarpingFields(images_gray,
@@ -303,8 +304,8 @@ geometry::TriangleMesh RunNonRigidOptimizer(
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
         double residual_reg = 0.0;
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
+#pragma omp parallel for reduction(+ : residual, residual_reg) \
+        schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int c = 0; c < n_camera; c++) {
             int nonrigidval = warping_fields[c].anchor_w_ *
                               warping_fields[c].anchor_h_ * 2;
@@ -364,11 +365,8 @@ geometry::TriangleMesh RunNonRigidOptimizer(
             }
             opt_camera_trajectory.parameters_[c].extrinsic_ = pose;
 
-#pragma omp critical(RunNonRigidOptimizer)
-            {
-                residual += r2;
-                residual_reg += rr_reg;
-            }
+            residual += r2;
+            residual_reg += rr_reg;
         }
         utility::LogDebug("Residual error : {:.6f}, reg : {:.6f}", residual,
                           residual_reg);
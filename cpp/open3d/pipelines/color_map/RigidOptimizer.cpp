@@ -151,7 +151,8 @@ geometry::TriangleMesh RunRigidOptimizer(
             CreateVertexAndImageVisibility(
                     opt_mesh, images_depth, images_mask, opt_camera_trajectory,
                     option.maximum_allowable_depth_,
-                    option.depth_threshold_for_visibility_check_);
+                    option.depth_threshold_for_visibility_check_,
+                    option.device_);
 
     utility::LogDebug("[ColorMapOptimization] Rigid Optimization");
     std::vector<double> proxy_intensity;
@@ -165,8 +166,8 @@ geometry::TriangleMesh RunRigidOptimizer(
         utility::LogDebug("[Iteration {:04d}] ", itr + 1);
         double residual = 0.0;
         total_num_ = 0;
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
+#pragma omp parallel for reduction(+ : residual, total_num_) \
+        schedule(static) num_threads(utility::EstimateMaxThreads())
         for (int c = 0; c < n_camera; c++) {
             Eigen::Matrix4d pose;
             pose = opt_camera_trajectory.parameters_[c].extrinsic_;
@@ -202,11 +203,8 @@ geometry::TriangleMesh RunRigidOptimizer(
                                                                          JTr);
             pose = delta * pose;
             opt_camera_trajectory.parameters_[c].extrinsic_ = pose;
-#pragma omp critical(RunRigidOptimizer)
-            {
-                residual += r2;
-                total_num_ += int(visibility_image_to_vertex[c].size());
-            }
+            residual += r2;
+            total_num_ += int(visibility_image_to_vertex[c].size());
         }
         if (total_num_ > 0) {
             utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})",
@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/Device.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -84,6 +85,10 @@ struct RigidOptimizerOption {
     /// output dir. Existing files will be overwritten if the names are the
     /// same.
     std::string debug_output_dir_ = "";
+
+    /// Device of the visibility check. On a CUDA device the vertices are
+    /// tested against each depth image with tensor operations.
+    core::Device device_ = core::Device("CPU:0");
 };
 
 geometry::TriangleMesh RunRigidOptimizer(
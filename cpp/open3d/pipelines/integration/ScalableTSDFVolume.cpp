@@ -32,6 +32,7 @@
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -94,8 +95,12 @@ void ScalableTSDFVolume::Integrate(
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
+    // Collect the touched units first, so that they can be integrated
+    // concurrently. Opening a unit modifies volume_units_, so it is done
+    // before the parallel loop.
     std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
             touched_volume_units_;
+    std::vector<std::shared_ptr<UniformTSDFVolume>> touched_volumes;
     for (const auto &point : pointcloud->points_) {
         auto min_bound = LocateVolumeUnit(
                 point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
@@ -105,112 +110,122 @@ void ScalableTSDFVolume::Integrate(
             for (auto y = min_bound(1); y <= max_bound(1); y++) {
                 for (auto z = min_bound(2); z <= max_bound(2); z++) {
                     auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+                    if (touched_volume_units_.insert(loc).second) {
+                        touched_volumes.push_back(OpenVolumeUnit(loc));
                     }
                 }
             }
         }
     }
+
+    // Each unit is small, so the units rather than their voxels are
+    // distributed over the threads. The nested parallel loop of the unit
+    // then runs on the calling thread.
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < (int)touched_volumes.size(); i++) {
+        touched_volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
+    }
 }
 
-std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
-    auto pointcloud = std::make_shared<geometry::PointCloud>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    float w0, w1, f0, f1;
-    Eigen::Vector3f c0, c1;
+std::vector<const ScalableTSDFVolume::VolumeUnit *>
+ScalableTSDFVolume::GetVolumeUnits() const {
+    std::vector<const VolumeUnit *> units;
+    units.reserve(volume_units_.size());
     for (const auto &unit : volume_units_) {
         if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
-                        f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
-                        if (color_type_ != TSDFVolumeColorType::NoColor)
-                            c0 = volume0.voxels_[volume0.IndexOf(idx0)]
-                                         .color_.cast<float>();
-                        if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
-                            Eigen::Vector3d p0 =
-                                    Eigen::Vector3d(half_voxel_length +
-                                                            voxel_length_ * x,
-                                                    half_voxel_length +
-                                                            voxel_length_ * y,
-                                                    half_voxel_length +
-                                                            voxel_length_ * z) +
-                                    index0.cast<double>() * volume_unit_length_;
-                            for (int i = 0; i < 3; i++) {
-                                Eigen::Vector3d p1 = p0;
-                                Eigen::Vector3i idx1 = idx0;
-                                Eigen::Vector3i index1 = index0;
-                                p1(i) += voxel_length_;
-                                idx1(i) += 1;
-                                if (idx1(i) < volume0.resolution_) {
-                                    w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+            units.push_back(&unit.second);
+        }
+    }
+    return units;
+}
+
+std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
+    double half_voxel_length = voxel_length_ * 0.5;
+    // Extract the points of each unit in parallel, then concatenate them in
+    // the order of the units.
+    const std::vector<const VolumeUnit *> units = GetVolumeUnits();
+    std::vector<geometry::PointCloud> unit_pointclouds(units.size());
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int u = 0; u < (int)units.size(); u++) {
+        float w0, w1, f0, f1;
+        Eigen::Vector3f c0, c1;
+        geometry::PointCloud *pointcloud = &unit_pointclouds[u];
+        const auto &volume0 = *units[u]->volume_;
+        const auto &index0 = units[u]->index_;
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    w0 = volume0.voxels_[volume0.IndexOf(idx0)].weight_;
+                    f0 = volume0.voxels_[volume0.IndexOf(idx0)].tsdf_;
+                    if (color_type_ != TSDFVolumeColorType::NoColor)
+                        c0 = volume0.voxels_[volume0.IndexOf(idx0)]
+                                     .color_.cast<float>();
+                    if (w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f) {
+                        Eigen::Vector3d p0 =
+                                Eigen::Vector3d(
+                                        half_voxel_length + voxel_length_ * x,
+                                        half_voxel_length + voxel_length_ * y,
+                                        half_voxel_length + voxel_length_ * z) +
+                                index0.cast<double>() * volume_unit_length_;
+                        for (int i = 0; i < 3; i++) {
+                            Eigen::Vector3d p1 = p0;
+                            Eigen::Vector3i idx1 = idx0;
+                            Eigen::Vector3i index1 = index0;
+                            p1(i) += voxel_length_;
+                            idx1(i) += 1;
+                            if (idx1(i) < volume0.resolution_) {
+                                w1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .weight_;
+                                f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                             .tsdf_;
+                                if (color_type_ != TSDFVolumeColorType::NoColor)
+                                    c1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                                 .color_.cast<float>();
+                            } else {
+                                idx1(i) -= volume0.resolution_;
+                                index1(i) += 1;
+                                auto unit_itr = volume_units_.find(index1);
+                                if (unit_itr == volume_units_.end()) {
+                                    w1 = 0.0f;
+                                    f1 = 0.0f;
+                                } else {
+                                    const auto &volume1 =
+                                            *unit_itr->second.volume_;
+                                    w1 = volume1.voxels_[volume1.IndexOf(idx1)]
                                                  .weight_;
-                                    f1 = volume0.voxels_[volume0.IndexOf(idx1)]
+                                    f1 = volume1.voxels_[volume1.IndexOf(idx1)]
                                                  .tsdf_;
                                     if (color_type_ !=
                                         TSDFVolumeColorType::NoColor)
-                                        c1 = volume0.voxels_[volume0.IndexOf(
+                                        c1 = volume1.voxels_[volume1.IndexOf(
                                                                      idx1)]
                                                      .color_.cast<float>();
-                                } else {
-                                    idx1(i) -= volume0.resolution_;
-                                    index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
-                                        w1 = 0.0f;
-                                        f1 = 0.0f;
-                                    } else {
-                                        const auto &volume1 =
-                                                *unit_itr->second.volume_;
-                                        w1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .weight_;
-                                        f1 = volume1.voxels_[volume1.IndexOf(
-                                                                     idx1)]
-                                                     .tsdf_;
-                                        if (color_type_ !=
-                                            TSDFVolumeColorType::NoColor)
-                                            c1 = volume1.voxels_
-                                                         [volume1.IndexOf(idx1)]
-                                                                 .color_
-                                                                 .cast<float>();
-                                    }
                                 }
-                                if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
-                                    f0 * f1 < 0) {
-                                    float r0 = std::fabs(f0);
-                                    float r1 = std::fabs(f1);
-                                    Eigen::Vector3d p = p0;
-                                    p(i) = (p0(i) * r1 + p1(i) * r0) /
-                                           (r0 + r1);
-                                    pointcloud->points_.push_back(p);
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1) / 255.0f)
-                                                        .cast<double>());
-                                    } else if (color_type_ ==
-                                               TSDFVolumeColorType::Gray32) {
-                                        pointcloud->colors_.push_back(
-                                                ((c0 * r1 + c1 * r0) /
-                                                 (r0 + r1))
-                                                        .cast<double>());
-                                    }
-                                    // has_normal
-                                    pointcloud->normals_.push_back(
-                                            GetNormalAt(p));
+                            }
+                            if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
+                                f0 * f1 < 0) {
+                                float r0 = std::fabs(f0);
+                                float r1 = std::fabs(f1);
+                                Eigen::Vector3d p = p0;
+                                p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
+                                pointcloud->points_.push_back(p);
+                                if (color_type_ == TSDFVolumeColorType::RGB8) {
+                                    pointcloud->colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1) /
+                                             255.0f)
+                                                    .cast<double>());
+                                } else if (color_type_ ==
+                                           TSDFVolumeColorType::Gray32) {
+                                    pointcloud->colors_.push_back(
+                                            ((c0 * r1 + c1 * r0) / (r0 + r1))
+                                                    .cast<double>());
                                 }
+                                // has_normal
+                                pointcloud->normals_.push_back(GetNormalAt(p));
                             }
                         }
                     }
@@ -218,6 +233,19 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
             }
         }
     }
+
+    auto pointcloud = std::make_shared<geometry::PointCloud>();
+    for (const auto &unit_pointcloud : unit_pointclouds) {
+        pointcloud->points_.insert(pointcloud->points_.end(),
+                                   unit_pointcloud.points_.begin(),
+                                   unit_pointcloud.points_.end());
+        pointcloud->normals_.insert(pointcloud->normals_.end(),
+                                    unit_pointcloud.normals_.begin(),
+                                    unit_pointcloud.normals_.end());
+        pointcloud->colors_.insert(pointcloud->colors_.end(),
+                                   unit_pointcloud.colors_.begin(),
+                                   unit_pointcloud.colors_.end());
+    }
     return pointcloud;
 }
 
@@ -225,149 +253,175 @@ std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
+    typedef std::unordered_map<
             Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
             std::equal_to<Eigen::Vector4i>,
             Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+            EdgeIndexToVertexIndex;
+    double half_voxel_length = voxel_length_ * 0.5;
+
+    // The cubes of each unit are polygonized in parallel into a unit mesh.
+    // Vertices on the edges shared with the neighboring units are created in
+    // each of them and identified by their global edge index, so that they
+    // can be merged afterwards.
+    const std::vector<const VolumeUnit *> units = GetVolumeUnits();
+    std::vector<geometry::TriangleMesh> unit_meshes(units.size());
+    std::vector<std::vector<Eigen::Vector4i, utility::Vector4i_allocator>>
+            unit_edge_indices(units.size());
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int u = 0; u < (int)units.size(); u++) {
+        geometry::TriangleMesh *mesh = &unit_meshes[u];
+        auto &edge_indices = unit_edge_indices[u];
+        EdgeIndexToVertexIndex edgeindex_to_vertexindex;
+        int edge_to_index[12];
+        const auto &volume0 = *units[u]->volume_;
+        const auto &index0 = units[u]->index_;
+        for (int x = 0; x < volume0.resolution_; x++) {
+            for (int y = 0; y < volume0.resolution_; y++) {
+                for (int z = 0; z < volume0.resolution_; z++) {
+                    Eigen::Vector3i idx0(x, y, z);
+                    int cube_index = 0;
+                    float w[8];
+                    float f[8];
+                    Eigen::Vector3d c[8];
+                    for (int i = 0; i < 8; i++) {
+                        Eigen::Vector3i index1 = index0;
+                        Eigen::Vector3i idx1 = idx0 + shift[i];
+                        if (idx1(0) < volume_unit_resolution_ &&
+                            idx1(1) < volume_unit_resolution_ &&
+                            idx1(2) < volume_unit_resolution_) {
+                            w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                           .weight_;
+                            f[i] = volume0.voxels_[volume0.IndexOf(idx1)].tsdf_;
+                            if (color_type_ == TSDFVolumeColorType::RGB8)
+                                c[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                               .color_.cast<double>() /
+                                       255.0;
+                            else if (color_type_ ==
+                                     TSDFVolumeColorType::Gray32)
+                                c[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                               .color_.cast<double>();
+                        } else {
+                            for (int j = 0; j < 3; j++) {
+                                if (idx1(j) >= volume_unit_resolution_) {
+                                    idx1(j) -= volume_unit_resolution_;
+                                    index1(j) += 1;
+                                }
+                            }
+                            auto unit_itr1 = volume_units_.find(index1);
+                            if (unit_itr1 == volume_units_.end()) {
+                                w[i] = 0.0f;
+                                f[i] = 0.0f;
+                            } else {
+                                const auto &volume1 =
+                                        *unit_itr1->second.volume_;
+                                w[i] = volume1.voxels_[volume1.IndexOf(idx1)]
                                                .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
+                                f[i] = volume1.voxels_[volume1.IndexOf(idx1)]
                                                .tsdf_;
                                 if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
+                                    c[i] = volume1.voxels_[volume1.IndexOf(
                                                                    idx1)]
                                                    .color_.cast<double>() /
                                            255.0;
                                 else if (color_type_ ==
                                          TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
+                                    c[i] = volume1.voxels_[volume1.IndexOf(
                                                                    idx1)]
                                                    .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
                             }
                         }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
+                        if (w[i] == 0.0f) {
+                            cube_index = 0;
+                            break;
+                        } else {
+                            if (f[i] < 0.0f) {
+                                cube_index |= (1 << i);
+                            }
                         }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
+                    }
+                    if (cube_index == 0 || cube_index == 255) {
+                        continue;
+                    }
+                    for (int i = 0; i < 12; i++) {
+                        if (edge_table[cube_index] & (1 << i)) {
+                            Eigen::Vector4i edge_index =
+                                    Eigen::Vector4i(index0(0), index0(1),
+                                                    index0(2), 0) *
+                                            volume_unit_resolution_ +
+                                    Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                            if (edgeindex_to_vertexindex.find(edge_index) ==
+                                edgeindex_to_vertexindex.end()) {
+                                edge_to_index[i] = (int)mesh->vertices_.size();
+                                edgeindex_to_vertexindex[edge_index] =
+                                        (int)mesh->vertices_.size();
+                                edge_indices.push_back(edge_index);
+                                Eigen::Vector3d pt(
+                                        half_voxel_length +
+                                                voxel_length_ * edge_index(0),
+                                        half_voxel_length +
+                                                voxel_length_ * edge_index(1),
+                                        half_voxel_length +
+                                                voxel_length_ * edge_index(2));
+                                double f0 = std::abs(
+                                        (double)f[edge_to_vert[i][0]]);
+                                double f1 = std::abs(
+                                        (double)f[edge_to_vert[i][1]]);
+                                pt(edge_index(3)) +=
+                                        f0 * voxel_length_ / (f0 + f1);
+                                mesh->vertices_.push_back(pt);
+                                if (color_type_ !=
+                                    TSDFVolumeColorType::NoColor) {
+                                    const auto &c0 = c[edge_to_vert[i][0]];
+                                    const auto &c1 = c[edge_to_vert[i][1]];
+                                    mesh->vertex_colors_.push_back(
+                                            (f1 * c0 + f0 * c1) / (f0 + f1));
                                 }
+                            } else {
+                                edge_to_index[i] =
+                                        edgeindex_to_vertexindex[edge_index];
                             }
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
-                        }
+                    }
+                    for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                        mesh->triangles_.push_back(Eigen::Vector3i(
+                                edge_to_index[tri_table[cube_index][i]],
+                                edge_to_index[tri_table[cube_index][i + 2]],
+                                edge_to_index[tri_table[cube_index][i + 1]]));
                     }
                 }
             }
         }
     }
+
+    // Merge the unit meshes in the order of the units, keeping the first copy
+    // of every shared vertex. This gives the same mesh as polygonizing all
+    // units in one pass.
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    EdgeIndexToVertexIndex edgeindex_to_vertexindex;
+    for (size_t u = 0; u < unit_meshes.size(); u++) {
+        const geometry::TriangleMesh &unit_mesh = unit_meshes[u];
+        std::vector<int> vertex_map(unit_mesh.vertices_.size());
+        for (size_t k = 0; k < unit_mesh.vertices_.size(); k++) {
+            auto it = edgeindex_to_vertexindex.emplace(
+                    unit_edge_indices[u][k], (int)mesh->vertices_.size());
+            if (it.second) {
+                mesh->vertices_.push_back(unit_mesh.vertices_[k]);
+                if (color_type_ != TSDFVolumeColorType::NoColor) {
+                    mesh->vertex_colors_.push_back(
+                            unit_mesh.vertex_colors_[k]);
+                }
+            }
+            vertex_map[k] = it.first->second;
+        }
+        for (const auto &triangle : unit_mesh.triangles_) {
+            mesh->triangles_.push_back(
+                    Eigen::Vector3i(vertex_map[triangle(0)],
+                                    vertex_map[triangle(1)],
+                                    vertex_map[triangle(2)]));
+        }
+    }
     return mesh;
 }
 
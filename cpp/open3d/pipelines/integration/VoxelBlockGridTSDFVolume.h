@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/integration/TSDFVolume.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace pipelines {
+namespace integration {
+
+/// \class VoxelBlockGridTSDFVolume
+///
+/// \brief VoxelBlockGridTSDFVolume implements the legacy TSDFVolume interface
+/// on top of a t::geometry::VoxelBlockGrid, so that applications written
+/// against TSDFVolume integrate on the GPU without changes.
+///
+/// Each frame is uploaded to the device once and integrated with the tensor
+/// kernels. The extracted point clouds and meshes are converted back to the
+/// legacy geometry types.
+class VoxelBlockGridTSDFVolume : public TSDFVolume {
+public:
+    /// \param voxel_length Length of the voxel in meters.
+    /// \param sdf_trunc Truncation value for signed distance function (SDF).
+    /// \param color_type Color type of the TSDF volume.
+    /// \param block_resolution Number of voxels per side of a voxel block.
+    /// \param block_count Initial number of voxel blocks, the grid grows as
+    /// needed.
+    /// \param device Device of the voxel block grid. The default is CUDA:0 if
+    /// it is available and CPU:0 otherwise.
+    VoxelBlockGridTSDFVolume(double voxel_length,
+                             double sdf_trunc,
+                             TSDFVolumeColorType color_type,
+                             int block_resolution = 16,
+                             int block_count = 10000,
+                             const core::Device &device = GetDefaultDevice());
+    ~VoxelBlockGridTSDFVolume() override {}
+
+public:
+    void Reset() override;
+    void Integrate(const geometry::RGBDImage &image,
+                   const camera::PinholeCameraIntrinsic &intrinsic,
+                   const Eigen::Matrix4d &extrinsic) override;
+    std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
+    std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+
+    /// The underlying voxel block grid, e.g. to ray cast it.
+    t::geometry::VoxelBlockGrid &GetVoxelBlockGrid() { return voxel_grid_; }
+
+    /// CUDA:0 if it is available, CPU:0 otherwise.
+    static core::Device GetDefaultDevice();
+
+public:
+    int block_resolution_;
+    int block_count_;
+    core::Device device_;
+
+private:
+    t::geometry::VoxelBlockGrid voxel_grid_;
+    /// The last intrinsic matrix and its tensor, converted once per camera.
+    Eigen::Matrix3d intrinsic_matrix_;
+    core::Tensor intrinsic_tensor_;
+};
+
+}  // namespace integration
+}  // namespace pipelines
+}  // namespace open3d
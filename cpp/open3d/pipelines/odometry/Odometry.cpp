@@ -33,89 +33,13 @@
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace pipelines {
 namespace odometry {
 
-static std::tuple<geometry::Image, geometry::Image> InitializeCorrespondenceMap(
-        int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    correspondence_map.Prepare(width, height, 2, 4);
-    depth_buffer.Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map.height_; v++) {
-        for (int u = 0; u < correspondence_map.width_; u++) {
-            *correspondence_map.PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map.PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer.PointerAt<float>(u, v, 0) = -1.0f;
-        }
-    }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
-
-static inline void AddElementToCorrespondenceMap(
-        geometry::Image &correspondence_map,
-        geometry::Image &depth_buffer,
-        int u_s,
-        int v_s,
-        int u_t,
-        int v_t,
-        float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-    }
-}
-
-static void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                                    geometry::Image &depth_buffer,
-                                    geometry::Image &correspondence_map_part,
-                                    geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
-            }
-        }
-    }
-}
-
-static int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
-            }
-        }
-    }
-    return correspondence_count;
-}
-
 static CorrespondenceSetPixelWise ComputeCorrespondence(
         const Eigen::Matrix3d intrinsic_matrix,
         const Eigen::Matrix4d &extrinsic,
@@ -128,65 +52,43 @@ static CorrespondenceSetPixelWise ComputeCorrespondence(
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
     Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
 
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#pragma omp parallel
-    {
-        geometry::Image correspondence_map_private;
-        geometry::Image depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#pragma omp for nowait
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
-            for (int u_s = 0; u_s < depth_s.width_; u_s++) {
-                double d_s = *depth_s.PointerAt<float>(u_s, v_s);
-                if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.max_depth_diff_) {
-                            AddElementToCorrespondenceMap(
-                                    correspondence_map_private,
-                                    depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
+    // Each source pixel has at most one correspondence, so the rows are
+    // independent and their correspondences are concatenated in row order.
+    std::vector<CorrespondenceSetPixelWise> row_correspondences(
+            depth_s.height_);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        for (int u_s = 0; u_s < depth_s.width_; u_s++) {
+            double d_s = *depth_s.PointerAt<float>(u_s, v_s);
+            if (!std::isnan(d_s)) {
+                Eigen::Vector3d uv_in_s =
+                        d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
+                double transformed_d_s = uv_in_s(2);
+                int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+                int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+                if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
+                    v_t < depth_t.height_) {
+                    double d_t = *depth_t.PointerAt<float>(u_t, v_t);
+                    if (!std::isnan(d_t) &&
+                        std::abs(transformed_d_s - d_t) <=
+                                option.max_depth_diff_) {
+                        row_correspondences[v_s].emplace_back(u_s, v_s, u_t,
+                                                              v_t);
                     }
                 }
             }
         }
-#pragma omp critical(ComputeCorrespondence)
-        {
-            MergeCorrespondenceMaps(correspondence_map, depth_buffer,
-                                    correspondence_map_private,
-                                    depth_buffer_private);
-
-        }  //    omp critical
-    }      //    omp parallel
+    }
 
     CorrespondenceSetPixelWise correspondence;
-    int correspondence_count = CountCorrespondence(correspondence_map);
-    correspondence.resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                correspondence[cnt] = pixel_correspondence;
-                cnt++;
-            }
-        }
+    size_t correspondence_count = 0;
+    for (const auto &row : row_correspondences) {
+        correspondence_count += row.size();
+    }
+    correspondence.reserve(correspondence_count);
+    for (const auto &row : row_correspondences) {
+        correspondence.insert(correspondence.end(), row.begin(), row.end());
     }
     return correspondence;
 }
@@ -204,6 +106,8 @@ static std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
     const double oy = intrinsic_matrix(1, 2);
     image_xyz->Prepare(depth.width_, depth.height_, 3, 4);
 
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int y = 0; y < image_xyz->height_; y++) {
         for (int x = 0; x < image_xyz->width_; x++) {
             float *px = image_xyz->PointerAt<float>(x, y, 0);
@@ -237,16 +141,13 @@ static std::vector<Eigen::Matrix3d> CreateCameraMatrixPyramid(
 
 static Eigen::Matrix6d CreateInformationMatrix(
         const Eigen::Matrix4d &extrinsic,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const Eigen::Matrix3d &intrinsic_matrix,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
+        const geometry::Image &xyz_t,
         const OdometryOption &option) {
-    CorrespondenceSetPixelWise correspondence =
-            ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
-                                  extrinsic, depth_s, depth_t, option);
-
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
+    CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
+            intrinsic_matrix, extrinsic, depth_s, depth_t, option);
 
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
@@ -260,9 +161,9 @@ static Eigen::Matrix6d CreateInformationMatrix(
         for (int row = 0; row < int(correspondence.size()); row++) {
             int u_t = correspondence[row](2);
             int v_t = correspondence[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
@@ -285,9 +186,11 @@ static Eigen::Matrix6d CreateInformationMatrix(
     return GTG;
 }
 
-static void NormalizeIntensity(
-        geometry::Image &image_s,
-        geometry::Image &image_t,
+/// Scales that normalize the mean intensity of the corresponding pixels of
+/// the source and the target image to 0.5.
+static std::tuple<double, double> ComputeIntensityScales(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
         const CorrespondenceSetPixelWise &correspondence) {
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
@@ -296,7 +199,9 @@ static void NormalizeIntensity(
                 "same");
     }
     double mean_s = 0.0, mean_t = 0.0;
-    for (size_t row = 0; row < correspondence.size(); row++) {
+#pragma omp parallel for reduction(+ : mean_s, mean_t) schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int row = 0; row < int(correspondence.size()); row++) {
         int u_s = correspondence[row](0);
         int v_s = correspondence[row](1);
         int u_t = correspondence[row](2);
@@ -306,14 +211,14 @@ static void NormalizeIntensity(
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
+    return std::make_tuple(0.5 / mean_s, 0.5 / mean_t);
 }
 
-static inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
-        const geometry::Image &color, const geometry::Image &depth) {
-    return std::make_shared<geometry::RGBDImage>(
-            geometry::RGBDImage(color, depth));
+static inline std::shared_ptr<geometry::RGBDImage> ScaleIntensity(
+        const geometry::RGBDImage &image, double scale) {
+    auto scaled = std::make_shared<geometry::RGBDImage>(image);
+    scaled->color_.LinearTransform(scale, 0.0);
+    return scaled;
 }
 
 static std::shared_ptr<geometry::Image> PreprocessDepth(
@@ -321,6 +226,8 @@ static std::shared_ptr<geometry::Image> PreprocessDepth(
     std::shared_ptr<geometry::Image> depth_processed =
             std::make_shared<geometry::Image>();
     *depth_processed = depth_orig;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int y = 0; y < depth_processed->height_; y++) {
         for (int x = 0; x < depth_processed->width_; x++) {
             float *p = depth_processed->PointerAt<float>(x, y);
@@ -376,42 +283,48 @@ static inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
     return false;
 }
 
-static std::tuple<std::shared_ptr<geometry::RGBDImage>,
-                  std::shared_ptr<geometry::RGBDImage>>
-InitializeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
+static inline bool CheckRGBDImage(const geometry::RGBDImage &image) {
+    const bool is_color_valid =
+            IsColorImageRGB(image.color_)
+                    ? image.color_.bytes_per_channel_ == 1
+                    : (image.color_.num_of_channels_ == 1 &&
+                       image.color_.bytes_per_channel_ == 4);
+    return is_color_valid && CheckImagePair(image.color_, image.depth_) &&
+           image.depth_.num_of_channels_ == 1 &&
+           image.depth_.bytes_per_channel_ == 4;
+}
+
+RGBDOdometryFrame::RGBDOdometryFrame(
+        const geometry::RGBDImage &image,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
-        const Eigen::Matrix4d &odo_init,
-        const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
+        const OdometryOption &option /*= OdometryOption()*/) {
+    if (!CheckRGBDImage(image)) {
+        utility::LogError("[RGBDOdometryFrame] Unsupported image format.");
+    }
+    std::shared_ptr<geometry::Image> color;
+    if (IsColorImageRGB(image.color_)) {
+        color = image.color_.CreateFloatImage();
     } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
+        color = std::make_shared<geometry::Image>(image.color_);
+    }
+    auto gray = color->Filter(geometry::Image::FilterType::Gaussian3);
+    auto depth = PreprocessDepth(image.depth_, option)
+                         ->Filter(geometry::Image::FilterType::Gaussian3);
+
+    const int num_levels =
+            (int)option.iteration_number_per_pyramid_level_.size();
+    pyramid_ = geometry::RGBDImage(*gray, *depth).CreatePyramid(num_levels);
+    pyramid_dx_ = geometry::RGBDImage::FilterPyramid(
+            pyramid_, geometry::Image::FilterType::Sobel3Dx);
+    pyramid_dy_ = geometry::RGBDImage::FilterPyramid(
+            pyramid_, geometry::Image::FilterType::Sobel3Dy);
+    camera_matrix_pyramid_ =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic, num_levels);
+    xyz_pyramid_.resize(num_levels);
+    for (int level = 0; level < num_levels; level++) {
+        xyz_pyramid_[level] = ConvertDepthImageToXYZImage(
+                pyramid_[level]->depth_, camera_matrix_pyramid_[level]);
     }
-
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-
-    CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
-    return std::make_tuple(source_out, target_out);
 }
 
 static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
@@ -460,52 +373,41 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
 }
 
 static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const RGBDOdometryFrame &source,
+        const RGBDOdometryFrame &target,
+        double scale_s,
+        double scale_t,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
         const Eigen::Matrix3d level_camera_matrix =
-                pyramid_camera_matrix[level];
-
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
+                source.camera_matrix_pyramid_[level];
+
+        // The intensity normalization depends on the pair, so only the
+        // intensities of the cached pyramids are rescaled.
+        auto source_level = ScaleIntensity(*source.pyramid_[level], scale_s);
+        auto target_level = ScaleIntensity(*target.pyramid_[level], scale_t);
+        auto target_dx_level =
+                ScaleIntensity(*target.pyramid_dx_[level], scale_t);
+        auto target_dy_level =
+                ScaleIntensity(*target.pyramid_dy_[level], scale_t);
 
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
                     iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    *source.xyz_pyramid_[level], *target_dx_level,
+                    *target_dy_level, level_camera_matrix, result_odo,
+                    jacobian_method, option);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -518,36 +420,51 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
 }
 
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
-        /*= camera::PinholeCameraIntrinsic()*/,
+        const RGBDOdometryFrame &source,
+        const RGBDOdometryFrame &target,
         const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
         const RGBDOdometryJacobian &jacobian_method
         /*=RGBDOdometryJacobianFromHybridTerm*/,
         const OdometryOption &option /*= OdometryOption()*/) {
-    if (!CheckRGBDImagePair(source, target)) {
+    const size_t num_levels = option.iteration_number_per_pyramid_level_.size();
+    if (source.IsEmpty() || target.IsEmpty() ||
+        source.pyramid_.size() != num_levels ||
+        target.pyramid_.size() != num_levels) {
+        utility::LogWarning(
+                "[RGBDOdometry] Frames should have one pyramid level per "
+                "entry of iteration_number_per_pyramid_level.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+    if (!CheckImagePair(source.pyramid_[0]->depth_,
+                        target.pyramid_[0]->depth_)) {
         utility::LogWarning(
                 "[RGBDOdometry] Two RGBD pairs should be same in size.");
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
                                Eigen::Matrix6d::Zero());
     }
 
-    std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
-    std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
+    const Eigen::Matrix3d &intrinsic_matrix = source.camera_matrix_pyramid_[0];
+    const geometry::Image &source_depth = source.pyramid_[0]->depth_;
+    const geometry::Image &target_depth = target.pyramid_[0]->depth_;
+    CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
+            intrinsic_matrix, odo_init, source_depth, target_depth, option);
+    double scale_s, scale_t;
+    std::tie(scale_s, scale_t) =
+            ComputeIntensityScales(source.pyramid_[0]->color_,
+                                   target.pyramid_[0]->color_, correspondence);
 
     Eigen::Matrix4d extrinsic;
     bool is_success;
-    std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+    std::tie(is_success, extrinsic) =
+            ComputeMultiscale(source, target, scale_s, scale_t, odo_init,
+                              jacobian_method, option);
 
     if (is_success) {
         Eigen::Matrix4d trans_output = extrinsic;
         Eigen::MatrixXd info_output = CreateInformationMatrix(
-                extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
+                extrinsic, intrinsic_matrix, source_depth, target_depth,
+                *target.xyz_pyramid_[0], option);
         return std::make_tuple(true, trans_output, info_output);
     } else {
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
@@ -555,6 +472,28 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/,
+        const OdometryOption &option /*= OdometryOption()*/) {
+    if (!CheckRGBDImagePair(source, target)) {
+        utility::LogWarning(
+                "[RGBDOdometry] Two RGBD pairs should be same in size.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+
+    RGBDOdometryFrame source_frame(source, pinhole_camera_intrinsic, option);
+    RGBDOdometryFrame target_frame(target, pinhole_camera_intrinsic, option);
+    return ComputeRGBDOdometry(source_frame, target_frame, odo_init,
+                               jacobian_method, option);
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
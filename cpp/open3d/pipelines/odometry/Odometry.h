@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
 #include "open3d/pipelines/odometry/OdometryOption.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
@@ -39,13 +40,48 @@
 
 namespace open3d {
 
-namespace geometry {
-class RGBDImage;
-}
-
 namespace pipelines {
 namespace odometry {
 
+/// \class RGBDOdometryFrame
+///
+/// \brief RGBD image prepared for ComputeRGBDOdometry.
+///
+/// Holds the filtered intensity and depth pyramids of one frame, their
+/// gradients and the point maps of every level. In a sequence, each frame
+/// is prepared once and used as the target of one pair and as the source of
+/// the next one.
+class RGBDOdometryFrame {
+public:
+    /// \brief Default Constructor.
+    RGBDOdometryFrame() {}
+    /// \brief Prepare an RGBD image.
+    ///
+    /// \param image RGBD image, with a 3 channel uint8 or 1 channel float
+    /// color image and a float depth image.
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameters. Gives the depth range and
+    /// the number of pyramid levels.
+    RGBDOdometryFrame(
+            const geometry::RGBDImage &image,
+            const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+            const OdometryOption &option = OdometryOption());
+
+    bool IsEmpty() const { return pyramid_.empty(); }
+
+public:
+    /// Intensity and depth pyramid, finest level first.
+    geometry::RGBDImagePyramid pyramid_;
+    /// Horizontal gradients of the pyramid.
+    geometry::RGBDImagePyramid pyramid_dx_;
+    /// Vertical gradients of the pyramid.
+    geometry::RGBDImagePyramid pyramid_dy_;
+    /// 3 channel images of the back projected depth of each level.
+    geometry::ImagePyramid xyz_pyramid_;
+    /// Camera intrinsic matrix of each level.
+    std::vector<Eigen::Matrix3d> camera_matrix_pyramid_;
+};
+
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
 ///
 /// \param source Source RGBD image.
@@ -65,6 +101,25 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \brief Function to estimate 6D rigid motion from two prepared RGBD frames.
+///
+/// Both frames must have one pyramid level per entry of
+/// OdometryOption::iteration_number_per_pyramid_level_.
+///
+/// \param source Source frame.
+/// \param target Target frame.
+/// \param odo_init Initial 4x4 motion matrix estimation.
+/// \param jacobian_method The odometry Jacobian method to use.
+/// \param option Odometry hyper parameteres.
+/// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        const RGBDOdometryFrame &source,
+        const RGBDOdometryFrame &target,
+        const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+        const RGBDOdometryJacobian &jacobian_method =
+                RGBDOdometryJacobianFromHybridTerm(),
+        const OdometryOption &option = OdometryOption());
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
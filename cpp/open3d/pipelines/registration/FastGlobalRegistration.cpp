@@ -26,14 +26,16 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
-#include <map>
+#include <algorithm>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
+#include "open3d/utility/Eigen.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -43,34 +45,48 @@ static std::vector<std::pair<int, int>> InitialMatching(
         const Feature& src_features, const Feature& dst_features) {
     geometry::KDTreeFlann src_feature_tree(src_features);
     geometry::KDTreeFlann dst_feature_tree(dst_features);
-    std::map<int, int> corres_ij;
-    std::vector<int> corres_ji(dst_features.data_.cols(), -1);
+    int num_src = int(src_features.data_.cols());
+    int num_dst = int(dst_features.data_.cols());
+    std::vector<int> corres_ji(num_dst, -1);
 
-#pragma omp parallel for
-    for (int j = 0; j < dst_features.data_.cols(); j++) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int j = 0; j < num_dst; j++) {
         std::vector<int> corres_tmp(1);
         std::vector<double> dist_tmp(1);
         src_feature_tree.SearchKNN(Eigen::VectorXd(dst_features.data_.col(j)),
                                    1, corres_tmp, dist_tmp);
-        int i = corres_tmp[0];
-        corres_ji[j] = i;
-        if (corres_ij.find(i) == corres_ij.end()) {
-            // set a temp value to prevent other threads recomputing
-            // corres_ij[i] until the following dst_feature_tree.SearchKNN()
-            // call completes. There is still a race condition but the result
-            // would be fine since both threads will compute the same result
-            corres_ij[i] = -1;
-            dst_feature_tree.SearchKNN(
-                    Eigen::VectorXd(src_features.data_.col(i)), 1, corres_tmp,
-                    dist_tmp);
-            corres_ij[i] = corres_tmp[0];
+        corres_ji[j] = corres_tmp[0];
+    }
+
+    // Only the source features matched by a destination feature are searched
+    // back, each once.
+    std::vector<int> corres_ij(num_src, -1);
+    std::vector<int> src_matched;
+    std::vector<bool> is_matched(num_src, false);
+    for (int j = 0; j < num_dst; j++) {
+        if (!is_matched[corres_ji[j]]) {
+            is_matched[corres_ji[j]] = true;
+            src_matched.push_back(corres_ji[j]);
         }
     }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int k = 0; k < int(src_matched.size()); k++) {
+        int i = src_matched[k];
+        std::vector<int> corres_tmp(1);
+        std::vector<double> dist_tmp(1);
+        dst_feature_tree.SearchKNN(Eigen::VectorXd(src_features.data_.col(i)),
+                                   1, corres_tmp, dist_tmp);
+        corres_ij[i] = corres_tmp[0];
+    }
 
     utility::LogDebug("\t[cross check] ");
     std::vector<std::pair<int, int>> corres_cross;
-    for (const std::pair<const int, int>& ij : corres_ij) {
-        if (corres_ji[ij.second] == ij.first) corres_cross.push_back(ij);
+    for (int i = 0; i < num_src; i++) {
+        if (corres_ij[i] != -1 && corres_ji[corres_ij[i]] == i) {
+            corres_cross.push_back(std::make_pair(i, corres_ij[i]));
+        }
     }
     utility::LogDebug("Initial matchings : {}", corres_cross.size());
     return corres_cross;
@@ -82,8 +98,7 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
         const std::vector<std::pair<int, int>>& corres_cross,
         const FastGlobalRegistrationOption& option) {
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
+    int i = 0, cnt = 0;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
@@ -92,42 +107,61 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
                                                      : std::random_device{}();
     utility::UniformRandIntGenerator rand_generator(0, ncorr - 1, seed_val);
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = rand_generator();
-        rand1 = rand_generator();
-        rand2 = rand_generator();
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from source fragment
-        Eigen::Vector3d pti0 = src_point_cloud.points_[idi0];
-        Eigen::Vector3d pti1 = src_point_cloud.points_[idi1];
-        Eigen::Vector3d pti2 = src_point_cloud.points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from dest fragment
-        Eigen::Vector3d ptj0 = dst_point_cloud.points_[idj0];
-        Eigen::Vector3d ptj1 = dst_point_cloud.points_[idj1];
-        Eigen::Vector3d ptj2 = dst_point_cloud.points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
-            cnt++;
+
+    // Trials are drawn in batches and tested in parallel. They are accepted in
+    // drawing order, so the result is the same as testing them one by one.
+    const int batch_size = std::max(1024, 4 * option.maximum_tuple_count_);
+    std::vector<Eigen::Vector3i> trials;
+    std::vector<char> is_tuple;
+    while (i < number_of_trial && cnt < option.maximum_tuple_count_) {
+        const int num_trials = std::min(batch_size, number_of_trial - i);
+        trials.resize(num_trials);
+        is_tuple.resize(num_trials);
+        for (Eigen::Vector3i& trial : trials) {
+            trial(0) = rand_generator();
+            trial(1) = rand_generator();
+            trial(2) = rand_generator();
+        }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int k = 0; k < num_trials; k++) {
+            int idi0 = corres_cross[trials[k](0)].first;
+            int idj0 = corres_cross[trials[k](0)].second;
+            int idi1 = corres_cross[trials[k](1)].first;
+            int idj1 = corres_cross[trials[k](1)].second;
+            int idi2 = corres_cross[trials[k](2)].first;
+            int idj2 = corres_cross[trials[k](2)].second;
+
+            // collect 3 points from source fragment
+            Eigen::Vector3d pti0 = src_point_cloud.points_[idi0];
+            Eigen::Vector3d pti1 = src_point_cloud.points_[idi1];
+            Eigen::Vector3d pti2 = src_point_cloud.points_[idi2];
+            double li0 = (pti0 - pti1).norm();
+            double li1 = (pti1 - pti2).norm();
+            double li2 = (pti2 - pti0).norm();
+
+            // collect 3 points from dest fragment
+            Eigen::Vector3d ptj0 = dst_point_cloud.points_[idj0];
+            Eigen::Vector3d ptj1 = dst_point_cloud.points_[idj1];
+            Eigen::Vector3d ptj2 = dst_point_cloud.points_[idj2];
+            double lj0 = (ptj0 - ptj1).norm();
+            double lj1 = (ptj1 - ptj2).norm();
+            double lj2 = (ptj2 - ptj0).norm();
+
+            // check tuple constraint
+            is_tuple[k] = (li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                          (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                          (li2 * scale < lj2) && (lj2 < li2 / scale);
+        }
+        for (int k = 0; k < num_trials; k++, i++) {
+            if (is_tuple[k]) {
+                for (int c = 0; c < 3; c++) {
+                    corres_tuple.push_back(corres_cross[trials[k](c)]);
+                }
+                cnt++;
+            }
+            if (cnt >= option.maximum_tuple_count_) break;
         }
-        if (cnt >= option.maximum_tuple_count_) break;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
                       number_of_trial, i);
@@ -205,59 +239,41 @@ static Eigen::Matrix4d OptimizePairwiseRegistration(
 
     if (corres.size() < 10) return Eigen::Matrix4d::Identity();
 
-    std::vector<double> s(corres.size(), 1.0);
     Eigen::Matrix4d trans;
     trans.setIdentity();
 
     for (int itr = 0; itr < numIter; itr++) {
-        const int nvariable = 6;
-        Eigen::MatrixXd JTJ(nvariable, nvariable);
-        Eigen::MatrixXd JTr(nvariable, 1);
-        Eigen::MatrixXd J(nvariable, 1);
-        JTJ.setZero();
-        JTr.setZero();
-        double r = 0.0, r2 = 0.0;
-
-        for (size_t c = 0; c < corres.size(); c++) {
-            int ii = corres[c].first;
-            int jj = corres[c].second;
-            Eigen::Vector3d p, q;
-            p = point_cloud_vec[i].points_[ii];
-            q = point_cloud_copy_j.points_[jj];
-            Eigen::Vector3d rpq = p - q;
-
-            size_t c2 = c;
-            double temp = par / (rpq.dot(rpq) + par);
-            s[c2] = temp * temp;
-
-            J.setZero();
-            J(1) = -q(2);
-            J(2) = q(1);
-            J(3) = -1;
-            r = rpq(0);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(2) = -q(0);
-            J(0) = q(2);
-            J(4) = -1;
-            r = rpq(1);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(0) = -q(1);
-            J(1) = q(0);
-            J(5) = -1;
-            r = rpq(2);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-            r2 += (par * (1.0 - sqrt(s[c2])) * (1.0 - sqrt(s[c2])));
-        }
+        auto f_lambda =
+                [&](int c,
+                    std::vector<Eigen::Vector6d, utility::Vector6d_allocator>&
+                            J_r,
+                    std::vector<double>& r, std::vector<double>& w) {
+                    const Eigen::Vector3d& p =
+                            point_cloud_vec[i].points_[corres[c].first];
+                    const Eigen::Vector3d& q =
+                            point_cloud_copy_j.points_[corres[c].second];
+                    Eigen::Vector3d rpq = p - q;
+                    double temp = par / (rpq.dot(rpq) + par);
+                    double s = temp * temp;
+
+                    J_r.resize(3);
+                    r.resize(3);
+                    w.resize(3);
+                    J_r[0] << 0, -q(2), q(1), -1, 0, 0;
+                    J_r[1] << q(2), 0, -q(0), 0, -1, 0;
+                    J_r[2] << -q(1), q(0), 0, 0, 0, -1;
+                    for (int k = 0; k < 3; k++) {
+                        r[k] = rpq(k);
+                        w[k] = s;
+                    }
+                };
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        double r2;
+        std::tie(JTJ, JTr, r2) =
+                utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                        f_lambda, int(corres.size()), false);
+
         bool success;
         Eigen::VectorXd result;
         std::tie(success, result) = utility::SolveLinearSystemPSD(-JTJ, JTr);
@@ -75,11 +75,10 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeFlann &kdtree,
         const geometry::KDTreeSearchParam &search_param) {
+    const int64_t num_points = input.points_.size();
     auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    feature->Resize(33, (int)num_points);
+    auto compute_spfh = [&](int i) {
         const auto &point = input.points_[i];
         const auto &normal = input.normals_[i];
         std::vector<int> indices;
@@ -106,7 +105,12 @@ static std::shared_ptr<Feature> ComputeSPFHFeature(
                 feature->data_(h_index + 22, i) += hist_incr;
             }
         }
-    }
+    };
+    utility::ParallelForRange(num_points, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            compute_spfh(int(i));
+        }
+    });
     return feature;
 }
 
@@ -114,8 +118,9 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    const int64_t num_points = input.points_.size();
     auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
+    feature->Resize(33, (int)num_points);
     if (!input.HasNormals()) {
         utility::LogError(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
@@ -126,9 +131,7 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
     if (spfh == nullptr) {
         utility::LogError("Internal error: SPFH feature is nullptr.");
     }
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < (int)input.points_.size(); i++) {
+    auto compute_fpfh = [&](int i) {
         const auto &point = input.points_[i];
         std::vector<int> indices;
         std::vector<double> distance2;
@@ -156,7 +159,12 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 feature->data_(j, i) += spfh->data_(j, i);
             }
         }
-    }
+    };
+    utility::ParallelForRange(num_points, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            compute_fpfh(int(i));
+        }
+    });
     return feature;
 }
 
@@ -38,6 +38,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace pipelines {
@@ -83,11 +84,13 @@ std::shared_ptr<geometry::PointCloud> InitializePointCloudForGeneralizedICP(
 
     output->covariances_.resize(output->points_.size());
     const Eigen::Matrix3d C = Eigen::Vector3d(epsilon, 1, 1).asDiagonal();
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)output->normals_.size(); i++) {
-        const auto Rx = GetRotationFromE1ToX(output->normals_[i]);
-        output->covariances_[i] = Rx * C * Rx.transpose();
-    }
+    utility::ParallelForRange(
+            output->normals_.size(), [&](int64_t begin, int64_t end) {
+                for (int64_t i = begin; i < end; ++i) {
+                    const auto Rx = GetRotationFromE1ToX(output->normals_[i]);
+                    output->covariances_[i] = Rx * C * Rx.transpose();
+                }
+            });
     return output;
 }
 }  // namespace
@@ -36,12 +36,16 @@
 #include "open3d/pipelines/registration/PoseGraph.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+typedef Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Lower>
+        SparseLDLT;
+
 /// Definition of linear operators used for computing Jacobian matrix.
 /// If the relative transform of the two geometry is reasonably small,
 /// they can be approximated as below linearized form
@@ -148,6 +152,8 @@ static int UpdateConfidence(PoseGraph &pose_graph,
                             const GlobalOptimizationOption &option) {
     int n_edges = (int)pose_graph.edges_.size();
     int valid_edges_num = 0;
+#pragma omp parallel for reduction(+ : valid_edges_num) schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         if (t.uncertain_) {
@@ -170,6 +176,8 @@ static double ComputeResidual(const PoseGraph &pose_graph,
                               const GlobalOptimizationOption &option) {
     int n_edges = (int)pose_graph.edges_.size();
     double residual = 0.0;
+#pragma omp parallel for reduction(+ : residual) schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &te = pose_graph.edges_[iter_edge];
         double line_process_iter = te.confidence_;
@@ -184,6 +192,8 @@ static double ComputeResidual(const PoseGraph &pose_graph,
 static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
     int n_edges = (int)pose_graph.edges_.size();
     Eigen::VectorXd output(n_edges * 6);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
         std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
@@ -206,15 +216,24 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+///
+/// H is sparse and only its lower triangle is stored, which is the part read
+/// by SparseLDLT. Its sparsity pattern only depends on the edges, so that the
+/// symbolic factorization can be reused by all iterations of an optimization.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
 
+    // The terms of the edges are computed in parallel, then summed in edge
+    // order so that the result does not depend on the number of threads.
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_ss(n_edges);
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_st(n_edges);
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_tt(n_edges);
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> b_s(n_edges);
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> b_t(n_edges);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
@@ -229,24 +248,80 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
         Eigen::Vector6d eT_Info = e.transpose() * t.information_;
         double line_process_iter = t.confidence_;
 
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+        H_ss[iter_edge].noalias() = line_process_iter * JsT_Info * Js;
+        H_st[iter_edge].noalias() = line_process_iter * JsT_Info * Jt;
+        H_tt[iter_edge].noalias() = line_process_iter * JtT_Info * Jt;
+        b_s[iter_edge].noalias() =
+                -line_process_iter * (eT_Info.transpose() * Js).transpose();
+        b_t[iter_edge].noalias() =
+                -line_process_iter * (eT_Info.transpose() * Jt).transpose();
     }
+
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_diag(
+            n_nodes, Eigen::Matrix6d::Zero());
+    Eigen::VectorXd b(n_nodes * 6);
+    b.setZero();
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(size_t(n_edges) * 36 + size_t(n_nodes) * 21);
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        int i = t.source_node_id_;
+        int j = t.target_node_id_;
+        H_diag[i] += H_ss[iter_edge];
+        H_diag[j] += H_tt[iter_edge];
+        b.block<6, 1>(i * 6, 0) += b_s[iter_edge];
+        b.block<6, 1>(j * 6, 0) += b_t[iter_edge];
+        if (i == j) {
+            H_diag[i] += H_st[iter_edge] + H_st[iter_edge].transpose();
+            continue;
+        }
+        // Block (j, i) of H is the transpose of block (i, j).
+        const Eigen::Matrix6d H_lower =
+                i > j ? H_st[iter_edge] : H_st[iter_edge].transpose();
+        int row = std::max(i, j) * 6;
+        int col = std::min(i, j) * 6;
+        for (int c = 0; c < 6; c++) {
+            for (int r = 0; r < 6; r++) {
+                triplets.emplace_back(row + r, col + c, H_lower(r, c));
+            }
+        }
+    }
+    // The diagonal blocks of all nodes are stored, even if they are zero, so
+    // that H + lambda * I has the same sparsity pattern as H.
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        for (int c = 0; c < 6; c++) {
+            for (int r = c; r < 6; r++) {
+                triplets.emplace_back(iter_node * 6 + r, iter_node * 6 + c,
+                                      H_diag[iter_node](r, c));
+            }
+        }
+    }
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    H.setFromTriplets(triplets.begin(), triplets.end());
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Function to solve H @ delta == b. \p solver must have analyzed the
+/// sparsity pattern of H. Falls back to a dense solver if the sparse
+/// factorization fails.
+static std::tuple<bool, Eigen::VectorXd> SolveLinearSystem(
+        SparseLDLT &solver,
+        const Eigen::SparseMatrix<double> &H,
+        const Eigen::VectorXd &b) {
+    solver.factorize(H);
+    if (solver.info() == Eigen::Success) {
+        Eigen::VectorXd delta = solver.solve(b);
+        if (solver.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(delta));
+        }
+    }
+    utility::LogWarning(
+            "Sparse LDLT factorization failed, switched to dense solver");
+    Eigen::SparseMatrix<double> H_full = H.selfadjointView<Eigen::Lower>();
+    Eigen::VectorXd delta = Eigen::MatrixXd(H_full).ldlt().solve(b);
+    return std::make_tuple(true, std::move(delta));
+}
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -385,42 +460,45 @@ static void CompensateReferencePoseGraphNode(PoseGraph &pose_graph_new,
 
 static bool ValidatePoseGraphConnectivity(const PoseGraph &pose_graph,
                                           bool ignore_uncertain_edges = false) {
-    size_t n_nodes = pose_graph.nodes_.size();
-    size_t n_edges = pose_graph.edges_.size();
+    int n_nodes = (int)pose_graph.nodes_.size();
+
+    // Adjacency lists of the nodes. Edges referencing invalid nodes are
+    // reported by ValidatePoseGraph.
+    std::vector<std::vector<int>> adjacent_nodes(n_nodes);
+    for (const PoseGraphEdge &t : pose_graph.edges_) {
+        if (ignore_uncertain_edges && t.uncertain_) {
+            continue;
+        }
+        if (t.source_node_id_ < 0 || t.source_node_id_ >= n_nodes ||
+            t.target_node_id_ < 0 || t.target_node_id_ >= n_nodes) {
+            continue;
+        }
+        adjacent_nodes[t.source_node_id_].push_back(t.target_node_id_);
+        adjacent_nodes[t.target_node_id_].push_back(t.source_node_id_);
+    }
 
     // Test if the connected component containing the first node is the entire
     // graph
     std::vector<int> nodes_to_explore{};
-    std::vector<int> component{};
+    std::vector<bool> in_component(n_nodes, false);
+    int component_size = 0;
     if (n_nodes > 0) {
         nodes_to_explore.push_back(0);
-        component.push_back(0);
+        in_component[0] = true;
+        component_size++;
     }
     while (!nodes_to_explore.empty()) {
         int i = nodes_to_explore.back();
         nodes_to_explore.pop_back();
-        for (size_t j = 0; j < n_edges; j++) {
-            const PoseGraphEdge &t = pose_graph.edges_[j];
-            if (ignore_uncertain_edges && t.uncertain_) {
-                continue;
-            }
-            int adjacent_node{-1};
-            if (t.source_node_id_ == i) {
-                adjacent_node = t.target_node_id_;
-            } else if (t.target_node_id_ == i) {
-                adjacent_node = t.source_node_id_;
-            }
-            if (adjacent_node != -1) {
-                auto find_result = std::find(component.begin(), component.end(),
-                                             adjacent_node);
-                if (find_result == component.end()) {
-                    nodes_to_explore.push_back(adjacent_node);
-                    component.push_back(adjacent_node);
-                }
+        for (int adjacent_node : adjacent_nodes[i]) {
+            if (!in_component[adjacent_node]) {
+                nodes_to_explore.push_back(adjacent_node);
+                in_component[adjacent_node] = true;
+                component_size++;
             }
         }
     }
-    return component.size() == n_nodes;
+    return component_size == n_nodes;
 }
 
 static bool ValidatePoseGraph(const PoseGraph &pose_graph) {
@@ -511,11 +589,13 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
     std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    SparseLDLT solver;
+    solver.analyzePattern(H);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
@@ -532,10 +612,8 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         Eigen::VectorXd delta(H.cols());
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        std::tie(solver_success, delta) = SolveLinearSystem(solver, H, b);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -602,12 +680,15 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H_I(n_nodes * 6, n_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
     std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    SparseLDLT solver;
+    solver.analyzePattern(H);
 
     Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
@@ -629,14 +710,13 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
             Eigen::VectorXd delta(H_LM.cols());
             bool solver_success = false;
 
             // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            std::tie(solver_success, delta) =
+                    SolveLinearSystem(solver, H_LM, b);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
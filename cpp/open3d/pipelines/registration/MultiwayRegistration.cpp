@@ -0,0 +1,253 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/MultiwayRegistration.h"
+
+#include <Eigen/Dense>
+#include <algorithm>
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace pipelines {
+namespace registration {
+
+std::vector<Eigen::Vector2i> ComputeCandidateFragmentPairs(
+        const std::vector<geometry::AxisAlignedBoundingBox> &bounding_boxes,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &poses /* = {}*/,
+        double margin /* = 0.0*/) {
+    const int num_fragments = int(bounding_boxes.size());
+    if (!poses.empty() && int(poses.size()) != num_fragments) {
+        utility::LogError("Expected {} poses, but got {}.", num_fragments,
+                          poses.size());
+    }
+
+    // Bounding box of each fragment in the common frame, as center and half
+    // extent.
+    std::vector<Eigen::Vector3d> centers(num_fragments);
+    std::vector<Eigen::Vector3d> half_extents(num_fragments);
+    for (int i = 0; i < num_fragments && !poses.empty(); i++) {
+        const Eigen::Vector3d center = 0.5 * (bounding_boxes[i].min_bound_ +
+                                              bounding_boxes[i].max_bound_);
+        const Eigen::Vector3d half_extent =
+                0.5 * (bounding_boxes[i].max_bound_ -
+                       bounding_boxes[i].min_bound_) +
+                Eigen::Vector3d::Constant(margin);
+        const Eigen::Matrix3d R = poses[i].block<3, 3>(0, 0);
+        centers[i] = R * center + poses[i].block<3, 1>(0, 3);
+        half_extents[i] = R.cwiseAbs() * half_extent;
+    }
+
+    std::vector<Eigen::Vector2i> pairs;
+    for (int s = 0; s < num_fragments; s++) {
+        for (int t = s + 1; t < num_fragments; t++) {
+            if (poses.empty() || t == s + 1 ||
+                ((centers[s] - centers[t]).cwiseAbs().array() <=
+                 (half_extents[s] + half_extents[t]).array())
+                        .all()) {
+                pairs.emplace_back(s, t);
+            }
+        }
+    }
+    return pairs;
+}
+
+PoseGraph CreatePoseGraphFromPairwiseRegistrations(
+        int num_fragments,
+        const std::vector<Eigen::Vector2i> &pairs,
+        const PairwiseRegistrationFunction &register_pair,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &initial_poses /* = {}*/) {
+    if (!initial_poses.empty() && int(initial_poses.size()) != num_fragments) {
+        utility::LogError("Expected {} initial poses, but got {}.",
+                          num_fragments, initial_poses.size());
+    }
+    for (const Eigen::Vector2i &pair : pairs) {
+        if (pair(0) < 0 || pair(0) >= num_fragments || pair(1) < 0 ||
+            pair(1) >= num_fragments || pair(0) == pair(1)) {
+            utility::LogError("Invalid fragment pair ({}, {}).", pair(0),
+                              pair(1));
+        }
+    }
+
+    const int num_pairs = int(pairs.size());
+    std::vector<int> is_registered(num_pairs, 0);
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations(
+            num_pairs, Eigen::Matrix4d::Identity());
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> informations(
+            num_pairs, Eigen::Matrix6d::Identity());
+    // Pairs take very different times, e.g. when RANSAC exits early, so they
+    // are scheduled dynamically.
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_pairs; i++) {
+        is_registered[i] = register_pair(pairs[i](0), pairs[i](1),
+                                         transformations[i], informations[i]);
+    }
+    utility::LogDebug("Registered {:d} of {:d} fragment pairs.",
+                      std::count(is_registered.begin(), is_registered.end(), 1),
+                      num_pairs);
+
+    PoseGraph pose_graph;
+    if (!initial_poses.empty()) {
+        for (const Eigen::Matrix4d &pose : initial_poses) {
+            pose_graph.nodes_.push_back(PoseGraphNode(pose));
+        }
+    } else if (num_fragments > 0) {
+        // Chain the registrations of consecutive fragments.
+        std::vector<int> odometry_pair(num_fragments, -1);
+        for (int i = 0; i < num_pairs; i++) {
+            if (is_registered[i] && pairs[i](1) == pairs[i](0) + 1) {
+                odometry_pair[pairs[i](0)] = i;
+            }
+        }
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose_graph.nodes_.push_back(PoseGraphNode(pose));
+        for (int s = 0; s + 1 < num_fragments; s++) {
+            if (odometry_pair[s] >= 0) {
+                pose = pose * transformations[odometry_pair[s]].inverse();
+            }
+            pose_graph.nodes_.push_back(PoseGraphNode(pose));
+        }
+    }
+    for (int i = 0; i < num_pairs; i++) {
+        if (is_registered[i]) {
+            pose_graph.edges_.push_back(PoseGraphEdge(
+                    pairs[i](0), pairs[i](1), transformations[i],
+                    informations[i], pairs[i](1) != pairs[i](0) + 1));
+        }
+    }
+    return pose_graph;
+}
+
+PoseGraph CreatePoseGraphFromPointClouds(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &fragments,
+        const std::vector<std::shared_ptr<Feature>> &features /* = {}*/,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &initial_poses /* = {}*/,
+        const MultiwayRegistrationOption &option
+        /* = MultiwayRegistrationOption()*/) {
+    const int num_fragments = int(fragments.size());
+    if (!features.empty() && int(features.size()) != num_fragments) {
+        utility::LogError("Expected {} features, but got {}.", num_fragments,
+                          features.size());
+    }
+    if (option.max_correspondence_distance_ <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    std::vector<geometry::AxisAlignedBoundingBox> bounding_boxes;
+    for (int i = 0; i < num_fragments; i++) {
+        if (!fragments[i] || !fragments[i]->HasPoints()) {
+            utility::LogError("Fragment {} is empty.", i);
+        }
+        if (!features.empty() &&
+            (!features[i] ||
+             features[i]->Num() != fragments[i]->points_.size())) {
+            utility::LogError("Feature {} does not match its fragment.", i);
+        }
+        bounding_boxes.push_back(fragments[i]->GetAxisAlignedBoundingBox());
+    }
+    const std::vector<Eigen::Vector2i> pairs = ComputeCandidateFragmentPairs(
+            bounding_boxes, initial_poses, option.bounding_box_margin_);
+
+    // Every fragment is the target of several pairs, so its indices are
+    // built once up front.
+    std::vector<std::unique_ptr<geometry::KDTreeFlann>> kdtrees(num_fragments);
+    std::vector<std::unique_ptr<geometry::KDTreeFlann>> feature_kdtrees(
+            num_fragments);
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_fragments; i++) {
+        kdtrees[i].reset(new geometry::KDTreeFlann(*fragments[i]));
+        if (!features.empty()) {
+            feature_kdtrees[i].reset(new geometry::KDTreeFlann(*features[i]));
+        }
+    }
+
+    const CorrespondenceCheckerBasedOnEdgeLength edge_length_checker(0.9);
+    const CorrespondenceCheckerBasedOnDistance distance_checker(
+            option.max_correspondence_distance_);
+    const TransformationEstimationPointToPoint point_to_point(false);
+    const TransformationEstimationPointToPlane point_to_plane;
+    auto register_pair = [&](int s, int t, Eigen::Matrix4d &transformation,
+                             Eigen::Matrix6d &information) {
+        const geometry::PointCloud &source = *fragments[s];
+        const geometry::PointCloud &target = *fragments[t];
+        Eigen::Matrix4d init = Eigen::Matrix4d::Identity();
+        if (!initial_poses.empty()) {
+            init = initial_poses[t].inverse() * initial_poses[s];
+        }
+        if (!features.empty() && (initial_poses.empty() || t != s + 1)) {
+            const Feature &source_feature = *features[s];
+            CorrespondenceSet corres(source_feature.Num());
+            std::vector<int> indices(1);
+            std::vector<double> distance2(1);
+            for (int i = 0; i < int(corres.size()); i++) {
+                const Eigen::VectorXd query = source_feature.data_.col(i);
+                feature_kdtrees[t]->SearchKNN(query, 1, indices, distance2);
+                corres[i] = Eigen::Vector2i(i, indices[0]);
+            }
+            init = RegistrationRANSACBasedOnCorrespondence(
+                           source, target, corres,
+                           option.max_correspondence_distance_,
+                           point_to_point, 3,
+                           {edge_length_checker, distance_checker},
+                           option.ransac_criteria_, option.seed_)
+                           .transformation_;
+        }
+        const TransformationEstimation &estimation =
+                target.HasNormals()
+                        ? static_cast<const TransformationEstimation &>(
+                                  point_to_plane)
+                        : point_to_point;
+        const RegistrationResult result = RegistrationICP(
+                source, target, *kdtrees[t],
+                option.max_correspondence_distance_, init, estimation,
+                option.icp_criteria_);
+        if (result.fitness_ < option.min_fitness_) {
+            return false;
+        }
+        transformation = result.transformation_;
+        information = GetInformationMatrixFromPointClouds(
+                source, target, *kdtrees[t],
+                option.max_correspondence_distance_, transformation);
+        return true;
+    };
+    return CreatePoseGraphFromPairwiseRegistrations(num_fragments, pairs,
+                                                    register_pair,
+                                                    initial_poses);
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
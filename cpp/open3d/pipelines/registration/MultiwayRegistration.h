@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/pipelines/registration/Registration.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Optional.h"
+
+namespace open3d {
+
+namespace geometry {
+class AxisAlignedBoundingBox;
+class PointCloud;
+}  // namespace geometry
+
+namespace pipelines {
+namespace registration {
+class Feature;
+
+/// \class MultiwayRegistrationOption
+///
+/// \brief Options for building a pose graph from the pairwise registrations
+/// of a sequence of fragments.
+class MultiwayRegistrationOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_correspondence_distance Maximum correspondence points-pair
+    /// distance of the pairwise registrations.
+    /// \param min_fitness Pairs registered with a lower fitness are left out
+    /// of the pose graph.
+    /// \param bounding_box_margin Margin added to the bounding boxes of the
+    /// fragments before testing them for overlap.
+    MultiwayRegistrationOption(double max_correspondence_distance = 0.05,
+                               double min_fitness = 0.3,
+                               double bounding_box_margin = 0.0)
+        : max_correspondence_distance_(max_correspondence_distance),
+          min_fitness_(min_fitness),
+          bounding_box_margin_(bounding_box_margin) {}
+    ~MultiwayRegistrationOption() {}
+
+public:
+    /// Maximum correspondence points-pair distance of the pairwise
+    /// registrations.
+    double max_correspondence_distance_;
+    /// Pairs registered with a lower fitness are left out of the pose graph.
+    double min_fitness_;
+    /// Margin added to the bounding boxes of the fragments, placed with the
+    /// initial poses, before testing them for overlap.
+    double bounding_box_margin_;
+    /// Convergence criteria of the feature based RANSAC registration.
+    RANSACConvergenceCriteria ransac_criteria_ =
+            RANSACConvergenceCriteria(100000, 0.999);
+    /// Convergence criteria of the ICP refinement.
+    ICPConvergenceCriteria icp_criteria_;
+    /// Random seed of RANSAC.
+    utility::optional<unsigned int> seed_;
+};
+
+/// \brief Function to register fragment \p source_id to fragment
+/// \p target_id. Returns false if they could not be registered, otherwise
+/// sets the source to target \p transformation and its 6x6 \p information
+/// matrix. It is called from several threads at once.
+typedef std::function<bool(int source_id,
+                           int target_id,
+                           Eigen::Matrix4d &transformation,
+                           Eigen::Matrix6d &information)>
+        PairwiseRegistrationFunction;
+
+/// \brief Function to select the pairs of fragments worth registering.
+///
+/// Returns the pairs (s, t), s < t, of consecutive fragments and of
+/// fragments whose bounding boxes overlap once placed with \p poses and
+/// enlarged by \p margin, sorted by s then t.
+///
+/// \param bounding_boxes Bounding box of each fragment, in its own frame.
+/// \param poses Pose of each fragment in a common frame. Without poses all
+/// pairs are returned.
+/// \param margin Margin added to the bounding boxes.
+std::vector<Eigen::Vector2i> ComputeCandidateFragmentPairs(
+        const std::vector<geometry::AxisAlignedBoundingBox> &bounding_boxes,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &poses = {},
+        double margin = 0.0);
+
+/// \brief Function to build a pose graph from pairwise registrations.
+///
+/// The pairs are registered in parallel. Edges are added in the order of
+/// \p pairs, edges between non consecutive fragments are uncertain.
+///
+/// \param num_fragments Number of fragments, one node each.
+/// \param pairs Pairs (source, target) of fragments to register.
+/// \param register_pair Function registering one pair.
+/// \param initial_poses Node poses. If empty, the poses are chained from
+/// the registrations of consecutive fragments, starting at identity.
+PoseGraph CreatePoseGraphFromPairwiseRegistrations(
+        int num_fragments,
+        const std::vector<Eigen::Vector2i> &pairs,
+        const PairwiseRegistrationFunction &register_pair,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &initial_poses = {});
+
+/// \brief Function to build a pose graph by registering a sequence of point
+/// cloud fragments.
+///
+/// Candidate pairs are selected with ComputeCandidateFragmentPairs(). The
+/// KDTree of every fragment and of its features is built once. Consecutive
+/// fragments with initial poses, or any pair without features, start from
+/// the initial poses. Other pairs start from RANSAC on feature matches. All
+/// pairs are then refined with ICP, point to plane if the target has
+/// normals.
+///
+/// \param fragments Point cloud fragments, in their own frames.
+/// \param features Feature of each fragment, or empty.
+/// \param initial_poses Pose of each fragment, e.g. from odometry, or empty.
+/// \param option Registration options.
+PoseGraph CreatePoseGraphFromPointClouds(
+        const std::vector<std::shared_ptr<geometry::PointCloud>> &fragments,
+        const std::vector<std::shared_ptr<Feature>> &features = {},
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &initial_poses = {},
+        const MultiwayRegistrationOption &option =
+                MultiwayRegistrationOption());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace open3d
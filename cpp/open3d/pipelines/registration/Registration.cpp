@@ -26,6 +26,9 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <algorithm>
+#include <mutex>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
@@ -37,44 +40,57 @@ namespace open3d {
 namespace pipelines {
 namespace registration {
 
+/// \p previous_target gives, for each source point, the target point it
+/// corresponded to in the previous ICP iteration, or -1. The distance to that
+/// point bounds the distance to the nearest neighbor, so the search is
+/// restricted to this smaller radius and gives the same result.
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         const geometry::KDTreeFlann &target_kdtree,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &transformation) {
+        const Eigen::Matrix4d &transformation,
+        const std::vector<int> &previous_target = std::vector<int>()) {
     RegistrationResult result(transformation);
     if (max_correspondence_distance <= 0.0) {
         return result;
     }
 
+    // Margin over the hint distance, so that rounding cannot exclude the
+    // hinted point itself.
+    const double hint_margin = 1e-6 * max_correspondence_distance;
     double error2 = 0.0;
 
-#pragma omp parallel
-    {
-        double error2_private = 0.0;
-        CorrespondenceSet correspondence_set_private;
-#pragma omp for nowait
-        for (int i = 0; i < (int)source.points_.size(); i++) {
-            std::vector<int> indices(1);
-            std::vector<double> dists(1);
-            const auto &point = source.points_[i];
-            if (target_kdtree.SearchHybrid(point, max_correspondence_distance,
-                                           1, indices, dists) > 0) {
-                error2_private += dists[0];
-                correspondence_set_private.push_back(
-                        Eigen::Vector2i(i, indices[0]));
-            }
-        }
-#pragma omp critical(GetRegistrationResultAndCorrespondences)
-        {
-            for (int i = 0; i < (int)correspondence_set_private.size(); i++) {
-                result.correspondence_set_.push_back(
-                        correspondence_set_private[i]);
-            }
-            error2 += error2_private;
-        }
-    }
+    std::mutex result_mutex;
+    utility::ParallelForRange(
+            source.points_.size(), [&](int64_t begin, int64_t end) {
+                double error2_private = 0.0;
+                CorrespondenceSet correspondence_set_private;
+                std::vector<int> indices(1);
+                std::vector<double> dists(1);
+                for (int i = int(begin); i < int(end); i++) {
+                    const auto &point = source.points_[i];
+                    double radius = max_correspondence_distance;
+                    if (!previous_target.empty() && previous_target[i] >= 0) {
+                        const double hint_distance =
+                                (point - target.points_[previous_target[i]])
+                                        .norm();
+                        radius = std::min(radius, hint_distance + hint_margin);
+                    }
+                    if (target_kdtree.SearchHybrid(point, radius, 1, indices,
+                                                   dists) > 0) {
+                        error2_private += dists[0];
+                        correspondence_set_private.push_back(
+                                Eigen::Vector2i(i, indices[0]));
+                    }
+                }
+                std::lock_guard<std::mutex> lock(result_mutex);
+                result.correspondence_set_.insert(
+                        result.correspondence_set_.end(),
+                        correspondence_set_private.begin(),
+                        correspondence_set_private.end());
+                error2 += error2_private;
+            });
 
     if (result.correspondence_set_.empty()) {
         result.fitness_ = 0.0;
@@ -98,8 +114,14 @@ static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     int good = 0;
     double max_dis2 = max_correspondence_distance * max_correspondence_distance;
     for (const auto &c : corres) {
-        double dis2 =
-                (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        // Same arithmetic as PointCloud::Transform, without copying the
+        // whole source point cloud for every hypothesis.
+        const Eigen::Vector4d point =
+                transformation * Eigen::Vector4d(source.points_[c[0]](0),
+                                                 source.points_[c[0]](1),
+                                                 source.points_[c[0]](2), 1.0);
+        double dis2 = (point.head<3>() / point(3) - target.points_[c[1]])
+                              .squaredNorm();
         if (dis2 < max_dis2) {
             good++;
             error2 += dis2;
@@ -141,6 +163,22 @@ RegistrationResult RegistrationICP(
         /* = TransformationEstimationPointToPoint(false)*/,
         const ICPConvergenceCriteria
                 &criteria /* = ICPConvergenceCriteria()*/) {
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    return RegistrationICP(source, target, kdtree, max_correspondence_distance,
+                           init, estimation, criteria);
+}
+
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
@@ -164,15 +202,15 @@ RegistrationResult RegistrationICP(
     }
 
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (!init.isIdentity()) {
         pcd.Transform(init);
     }
     RegistrationResult result;
     result = GetRegistrationResultAndCorrespondences(
-            pcd, target, kdtree, max_correspondence_distance, transformation);
+            pcd, target, target_kdtree, max_correspondence_distance,
+            transformation);
+    std::vector<int> previous_target(pcd.points_.size());
     for (int i = 0; i < criteria.max_iteration_; i++) {
         utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
                           result.fitness_, result.inlier_rmse_);
@@ -181,9 +219,13 @@ RegistrationResult RegistrationICP(
         transformation = update * transformation;
         pcd.Transform(update);
         RegistrationResult backup = result;
+        std::fill(previous_target.begin(), previous_target.end(), -1);
+        for (const Eigen::Vector2i &c : backup.correspondence_set_) {
+            previous_target[c(0)] = c(1);
+        }
         result = GetRegistrationResultAndCorrespondences(
-                pcd, target, kdtree, max_correspondence_distance,
-                transformation);
+                pcd, target, target_kdtree, max_correspondence_distance,
+                transformation, previous_target);
 
         if (std::abs(backup.fitness_ - result.fitness_) <
                     criteria.relative_fitness_ &&
@@ -216,6 +258,19 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
     RegistrationResult best_result;
     int exit_itr = -1;
 
+    // Checkers that do not need the aligned point clouds run before the
+    // transformation is estimated, the others after it.
+    std::vector<size_t> pre_checkers, post_checkers;
+    for (size_t i = 0; i < checkers.size(); i++) {
+        if (checkers[i].get().require_pointcloud_alignment_) {
+            post_checkers.push_back(i);
+        } else {
+            pre_checkers.push_back(i);
+        }
+    }
+    std::vector<int64_t> num_checked(checkers.size(), 0);
+    std::vector<int64_t> num_rejected(checkers.size(), 0);
+
 #pragma omp parallel
     {
         CorrespondenceSet ransac_corres(ransac_n);
@@ -226,32 +281,60 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         utility::UniformRandIntGenerator rand_generator(
                 0, static_cast<int>(corres.size()) - 1, seed_val);
 
+        // Each thread runs the checkers of a group in decreasing order of
+        // their observed rejection rate, so that most hypotheses fail on the
+        // first checker. The order does not change which hypotheses pass.
+        std::vector<size_t> pre_order = pre_checkers;
+        std::vector<size_t> post_order = post_checkers;
+        std::vector<int64_t> num_checked_local(checkers.size(), 0);
+        std::vector<int64_t> num_rejected_local(checkers.size(), 0);
+        auto sort_by_rejection_rate = [&](std::vector<size_t> &order) {
+            std::stable_sort(order.begin(), order.end(),
+                             [&](size_t lhs, size_t rhs) {
+                                 return num_rejected_local[lhs] *
+                                                (num_checked_local[rhs] + 1) >
+                                        num_rejected_local[rhs] *
+                                                (num_checked_local[lhs] + 1);
+                             });
+        };
+        auto run_checkers = [&](const std::vector<size_t> &order,
+                                const Eigen::Matrix4d &transformation) {
+            for (size_t i : order) {
+                num_checked_local[i]++;
+                if (!checkers[i].get().Check(source, target, ransac_corres,
+                                             transformation)) {
+                    num_rejected_local[i]++;
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        int num_itr_local = 0;
 #pragma omp for nowait
         for (int itr = 0; itr < criteria.max_iteration_; itr++) {
             if (itr < exit_itr_local) {
+                if (++num_itr_local % 256 == 0) {
+                    sort_by_rejection_rate(pre_order);
+                    sort_by_rejection_rate(post_order);
+                }
                 for (int j = 0; j < ransac_n; j++) {
                     ransac_corres[j] = corres[rand_generator()];
                 }
 
+                // Check correspondences and transformation: inexpensive
+                if (!run_checkers(pre_order, Eigen::Matrix4d::Identity())) {
+                    continue;
+                }
                 Eigen::Matrix4d transformation =
                         estimation.ComputeTransformation(source, target,
                                                          ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
+                if (!run_checkers(post_order, transformation)) {
+                    continue;
                 }
-                if (!check) continue;
 
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
                 auto result = EvaluateRANSACBasedOnCorrespondence(
-                        pcd, target, corres, max_correspondence_distance,
+                        source, target, corres, max_correspondence_distance,
                         transformation);
 
                 if (result.IsBetterRANSACThan(best_result_local)) {
@@ -276,12 +359,20 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
             if (exit_itr_local > exit_itr) {
                 exit_itr = exit_itr_local;
             }
+            for (size_t i = 0; i < checkers.size(); i++) {
+                num_checked[i] += num_checked_local[i];
+                num_rejected[i] += num_rejected_local[i];
+            }
         }
     }
     utility::LogDebug(
             "RANSAC exits at {:d}-th iteration: inlier ratio {:e}, "
             "RMSE {:e}",
             exit_itr, best_result.fitness_, best_result.inlier_rmse_);
+    for (size_t i = 0; i < checkers.size(); i++) {
+        utility::LogDebug("RANSAC checker {:d} rejected {:d} of {:d} checks.",
+                          i, num_rejected[i], num_checked[i]);
+    }
     return best_result;
 }
 
@@ -299,7 +390,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/,
-        utility::optional<unsigned int> seed /* = utility::nullopt*/) {
+        utility::optional<unsigned int> seed /* = utility::nullopt*/,
+        double feature_search_eps /* = 0.0*/) {
     if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
         return RegistrationResult();
     }
@@ -310,32 +402,34 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     geometry::KDTreeFlann kdtree_target(target_feature);
     pipelines::registration::CorrespondenceSet corres_ij(num_src_pts);
 
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
-    for (int i = 0; i < num_src_pts; i++) {
+    utility::ParallelForRange(num_src_pts, [&](int64_t begin, int64_t end) {
         std::vector<int> corres_tmp(1);
         std::vector<double> dist_tmp(1);
-
-        kdtree_target.SearchKNN(Eigen::VectorXd(source_feature.data_.col(i)), 1,
-                                corres_tmp, dist_tmp);
-        int j = corres_tmp[0];
-        corres_ij[i] = Eigen::Vector2i(i, j);
-    }
+        for (int i = int(begin); i < int(end); i++) {
+            kdtree_target.SearchKNN(
+                    Eigen::VectorXd(source_feature.data_.col(i)), 1,
+                    corres_tmp, dist_tmp, feature_search_eps);
+            int j = corres_tmp[0];
+            corres_ij[i] = Eigen::Vector2i(i, j);
+        }
+    });
 
     // Do reverse check if mutual_filter is enabled
     if (mutual_filter) {
         geometry::KDTreeFlann kdtree_source(source_feature);
         pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
 
-#pragma omp parallel for num_threads(utility::EstimateMaxThreads())
-        for (int j = 0; j < num_tgt_pts; ++j) {
+        utility::ParallelForRange(num_tgt_pts, [&](int64_t begin, int64_t end) {
             std::vector<int> corres_tmp(1);
             std::vector<double> dist_tmp(1);
-            kdtree_source.SearchKNN(
-                    Eigen::VectorXd(target_feature.data_.col(j)), 1, corres_tmp,
-                    dist_tmp);
-            int i = corres_tmp[0];
-            corres_ji[j] = Eigen::Vector2i(i, j);
-        }
+            for (int j = int(begin); j < int(end); ++j) {
+                kdtree_source.SearchKNN(
+                        Eigen::VectorXd(target_feature.data_.col(j)), 1,
+                        corres_tmp, dist_tmp, feature_search_eps);
+                int i = corres_tmp[0];
+                corres_ji[j] = Eigen::Vector2i(i, j);
+            }
+        });
 
         pipelines::registration::CorrespondenceSet corres_mutual;
         for (int i = 0; i < num_src_pts; ++i) {
@@ -368,12 +462,23 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         const geometry::PointCloud &target,
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
+    geometry::KDTreeFlann target_kdtree(target);
+    return GetInformationMatrixFromPointClouds(source, target, target_kdtree,
+                                               max_correspondence_distance,
+                                               transformation);
+}
+
+Eigen::Matrix6d GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation) {
     geometry::PointCloud pcd = source;
     if (!transformation.isIdentity()) {
         pcd.Transform(transformation);
     }
     RegistrationResult result;
-    geometry::KDTreeFlann target_kdtree(target);
     result = GetRegistrationResultAndCorrespondences(
             pcd, target, target_kdtree, max_correspondence_distance,
             transformation);
@@ -38,6 +38,7 @@
 namespace open3d {
 
 namespace geometry {
+class KDTreeFlann;
 class PointCloud;
 }
 
@@ -177,6 +178,29 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Functions for ICP registration with a prebuilt target index.
+///
+/// Avoids rebuilding the KDTree of the target when it is registered against
+/// many sources, e.g. in frame-to-model tracking.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_kdtree KDTree built on \p target.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -217,6 +241,10 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param checkers Correspondence checker.
 /// \param criteria Convergence criteria.
 /// \param seed Random seed.
+/// \param feature_search_eps Approximation factor of the feature nearest
+/// neighbor search, see KDTreeFlann::SearchKNN. 0 matches features exactly;
+/// larger values speed up matching at the cost of some wrong
+/// correspondences, which RANSAC tolerates.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -230,7 +258,8 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
-        utility::optional<unsigned int> seed = utility::nullopt);
+        utility::optional<unsigned int> seed = utility::nullopt,
+        double feature_search_eps = 0.0);
 
 /// \param source The source point cloud.
 /// \param target The target point cloud.
@@ -243,6 +272,23 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation);
 
+/// \brief Function for computing the information matrix with a prebuilt
+/// target index.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_kdtree KDTree built on \p target.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param transformation The 4x4 transformation matrix to transform
+/// `source` to `target`.
+Eigen::Matrix6d GetInformationMatrixFromPointClouds(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &transformation);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
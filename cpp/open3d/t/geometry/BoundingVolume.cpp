@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/BoundingVolume.h"
+
+#include <Eigen/Core>
+#include <exception>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace bounding_volume {
+
+namespace {
+
+void CheckPoints(const core::RaggedTensor &points) {
+    core::AssertTensorShape(points.GetValues(), {utility::nullopt, 3});
+    core::AssertTensorDtypes(points.GetValues(),
+                             {core::Float32, core::Float64});
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor> ComputePCABoxes(
+        const core::RaggedTensor &points) {
+    const core::Tensor &values = points.GetValues();
+    const core::Tensor &row_splits = points.GetRowSplits();
+    const core::Device device = values.GetDevice();
+    const int64_t num_points = values.GetLength();
+    const int64_t num_clusters = points.GetNumRows();
+    const core::Tensor row_ids = points.GetValueRowIds();
+
+    const core::Tensor means = values.SegmentMean(row_splits);
+    const core::Tensor centered = values - means.IndexGet({row_ids});
+    const core::Tensor covariances =
+            (centered.Reshape({num_points, 3, 1}) *
+             centered.Reshape({num_points, 1, 3}))
+                    .SegmentMean(row_splits);
+
+    core::Tensor rotations = core::Tensor::Empty(
+            {num_clusters, 3, 3}, values.GetDtype(), device);
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::ComputePrincipalAxesCPU(covariances, rotations);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::ComputePrincipalAxesCUDA, covariances,
+                  rotations);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    // Bounds of the points in the frame of their cluster, R^T (p - mean).
+    const core::Tensor local = (centered.Reshape({num_points, 3, 1}) *
+                                rotations.IndexGet({row_ids}))
+                                       .Sum({1});
+    const core::Tensor local_min = local.SegmentMin(row_splits);
+    const core::Tensor local_max = local.SegmentMax(row_splits);
+    const core::Tensor local_centers =
+            ((local_min + local_max) * 0.5).Reshape({num_clusters, 1, 3});
+    const core::Tensor centers =
+            means + (rotations * local_centers).Sum({2});
+    return std::make_tuple(centers, rotations, local_max - local_min);
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+ComputeMinimalUprightAreaBoxes(const core::RaggedTensor &points) {
+    const core::Tensor &values = points.GetValues();
+    const core::Tensor &row_splits = points.GetRowSplits();
+    const core::Device device = values.GetDevice();
+    const int64_t num_clusters = points.GetNumRows();
+
+    // Sort the points of each cluster by x and then by y with stable sorts
+    // of all points, from the least to the most significant key.
+    const core::TensorKey all = core::TensorKey::Slice(
+            utility::nullopt, utility::nullopt, utility::nullopt);
+    core::Tensor order =
+            values.GetItem({all, core::TensorKey::Index(1)}).Argsort();
+    order = order.IndexGet(
+            {values.GetItem({all, core::TensorKey::Index(0)})
+                     .IndexGet({order})
+                     .Argsort()});
+    order = order.IndexGet(
+            {points.GetValueRowIds().IndexGet({order}).Argsort()});
+    const core::Tensor sorted = values.IndexGet({order});
+
+    core::Tensor min_bounds, max_bounds;
+    std::tie(min_bounds, max_bounds) = ComputeAxisAlignedBoundingBoxes(points);
+    core::Tensor centers = core::Tensor::Empty({num_clusters, 3},
+                                               values.GetDtype(), device);
+    core::Tensor rotations = core::Tensor::Empty({num_clusters, 3, 3},
+                                                 values.GetDtype(), device);
+    core::Tensor extents = core::Tensor::Empty({num_clusters, 3},
+                                               values.GetDtype(), device);
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::ComputeUprightMinimalAreaBoxesCPU(
+                sorted, row_splits, min_bounds, max_bounds, centers,
+                rotations, extents);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::ComputeUprightMinimalAreaBoxesCUDA,
+                  sorted, row_splits, min_bounds, max_bounds, centers,
+                  rotations, extents);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return std::make_tuple(centers, rotations, extents);
+}
+
+}  // namespace
+
+std::tuple<core::Tensor, core::Tensor> ComputeAxisAlignedBoundingBoxes(
+        const core::RaggedTensor &points) {
+    CheckPoints(points);
+    return std::make_tuple(points.RowMin(), points.RowMax());
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+ComputeOrientedBoundingBoxes(const core::RaggedTensor &points,
+                             OrientedBoundingBoxMethod method) {
+    CheckPoints(points);
+    if (method == OrientedBoundingBoxMethod::PCA) {
+        return ComputePCABoxes(points);
+    } else {
+        return ComputeMinimalUprightAreaBoxes(points);
+    }
+}
+
+core::RaggedTensor ComputeConvexHulls(const core::RaggedTensor &points) {
+    CheckPoints(points);
+    const core::Tensor values =
+            points.GetValues()
+                    .To(core::Device("CPU:0"), core::Float64)
+                    .Contiguous();
+    const double *values_ptr = values.GetDataPtr<double>();
+    const std::vector<int64_t> row_splits =
+            points.GetRowSplits().ToFlatVector<int64_t>();
+    const int64_t num_clusters = points.GetNumRows();
+
+    std::vector<std::vector<int64_t>> triangles(num_clusters);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < num_clusters; ++i) {
+        const int64_t begin = row_splits[i];
+        const int64_t end = row_splits[i + 1];
+        if (end - begin < 4) {
+            continue;
+        }
+        std::vector<Eigen::Vector3d> cluster(end - begin);
+        for (int64_t j = begin; j < end; ++j) {
+            cluster[j - begin] = Eigen::Map<const Eigen::Vector3d>(
+                    values_ptr + 3 * j);
+        }
+        // Qhull throws if the points do not span a volume. That must not
+        // stop the other clusters.
+        try {
+            std::shared_ptr<open3d::geometry::TriangleMesh> hull;
+            std::vector<size_t> hull_to_cluster;
+            std::tie(hull, hull_to_cluster) =
+                    open3d::geometry::Qhull::ComputeConvexHull(cluster);
+            triangles[i].reserve(3 * hull->triangles_.size());
+            for (const Eigen::Vector3i &triangle : hull->triangles_) {
+                for (int k = 0; k < 3; ++k) {
+                    triangles[i].push_back(
+                            begin + int64_t(hull_to_cluster[triangle(k)]));
+                }
+            }
+        } catch (const std::exception &) {
+            triangles[i].clear();
+        }
+    }
+
+    std::vector<int64_t> all_triangles;
+    std::vector<int64_t> triangle_row_splits(num_clusters + 1, 0);
+    for (int64_t i = 0; i < num_clusters; ++i) {
+        all_triangles.insert(all_triangles.end(), triangles[i].begin(),
+                             triangles[i].end());
+        triangle_row_splits[i + 1] = int64_t(all_triangles.size()) / 3;
+    }
+    const core::Device device = points.GetDevice();
+    const int64_t num_triangles = triangle_row_splits.back();
+    return core::RaggedTensor(
+            core::Tensor(all_triangles, {num_triangles, 3}, core::Int64)
+                    .To(device),
+            core::Tensor(triangle_row_splits, {num_clusters + 1}, core::Int64)
+                    .To(device));
+}
+
+}  // namespace bounding_volume
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <tuple>
+
+#include "open3d/core/RaggedTensor.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace bounding_volume {
+
+/// Methods to fit an oriented bounding box to each cluster.
+enum class OrientedBoundingBoxMethod {
+    /// Box aligned with the principal axes of the points, which are sorted
+    /// by decreasing variance.
+    PCA,
+    /// Box with vertical z axis and the smallest footprint in the xy plane,
+    /// found with rotating calipers on the 2D convex hull of the points.
+    /// The x axis of the box is along the longer side of the footprint.
+    /// Suited for objects standing on the ground, e.g. detected vehicles.
+    MinimalUprightArea,
+};
+
+/// \brief Computes the axis aligned bounding box of each cluster.
+///
+/// All clusters are processed with one segment reduction on the device of
+/// \p points.
+///
+/// \param points Ragged Float32 or Float64 positions with value shape {3},
+/// one row per cluster.
+/// \return Tuple (min_bounds, max_bounds) of shape {B, 3} for B clusters.
+/// The bounds of empty clusters are 0.
+std::tuple<core::Tensor, core::Tensor> ComputeAxisAlignedBoundingBoxes(
+        const core::RaggedTensor &points);
+
+/// \brief Computes an oriented bounding box for each cluster.
+///
+/// All clusters are processed in one call on the device of \p points. The
+/// boxes use the conventions of open3d::geometry::OrientedBoundingBox:
+/// point p of the box is center + R * diag(extent) * t with t in
+/// [-0.5, 0.5]^3. Unlike OrientedBoundingBox::CreateFromPoints(), the PCA
+/// axes are fitted to all points of a cluster instead of to its convex hull,
+/// which needs no hull computation.
+///
+/// \param points Ragged Float32 or Float64 positions with value shape {3},
+/// one row per cluster.
+/// \param method How to choose the orientation of the boxes.
+/// \return Tuple (centers, rotations, extents) with shapes {B, 3},
+/// {B, 3, 3} and {B, 3} for B clusters, in the dtype of \p points. The
+/// columns of each rotation are the axes of the box. Empty clusters get
+/// identity rotations and zero extents.
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+ComputeOrientedBoundingBoxes(
+        const core::RaggedTensor &points,
+        OrientedBoundingBoxMethod method = OrientedBoundingBoxMethod::PCA);
+
+/// \brief Computes the 3D convex hull of each cluster.
+///
+/// The hulls are computed with Qhull (quickhull) on the CPU, one cluster per
+/// thread. Points on the CUDA device are copied to the host and the result is
+/// copied back.
+///
+/// \param points Ragged Float32 or Float64 positions with value shape {3},
+/// one row per cluster.
+/// \return Ragged Int64 triangles with value shape {3}, one row per cluster.
+/// The vertices index the rows of points.GetValues(). Clusters whose points
+/// do not span a volume, e.g. with fewer than 4 or only coplanar points, have
+/// no triangles.
+core::RaggedTensor ComputeConvexHulls(const core::RaggedTensor &points);
+
+}  // namespace bounding_volume
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
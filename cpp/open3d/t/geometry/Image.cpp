@@ -35,6 +35,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/t/geometry/kernel/IPPImage.h"
 #include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/geometry/kernel/NPPImage.h"
@@ -117,50 +118,23 @@ Image Image::To(core::Dtype dtype,
     }
 
     Image dst_im;
+    if (!copy && dtype == GetDtype()) {
+        dst_im.data_ = data_;
+    } else {
+        dst_im.data_ = core::Tensor::Empty(
+                std::vector<int64_t>{GetRows(), GetCols(), GetChannels()},
+                dtype, GetDevice());
+    }
     if (HAVE_IPPICV &&
+        data_.GetDevice().GetType() == core::Device::DeviceType::CPU &&
         std::count(ipp_supported.begin(), ipp_supported.end(), GetDtype()) >
                 0 &&
         std::count(ipp_supported.begin(), ipp_supported.end(), dtype) > 0) {
-        // TODO(Sameer): Tensor based Op for saturate_cast / LinearTransform
-        // NPP does not expose a useful API, so as a workaround, move data to
-        // CPU and use IPP.
-        auto device = data_.GetDevice();
-        if (device.GetType() != core::Device::DeviceType::CPU) {
-            core::Tensor data_CPU = data_.To(core::Device("CPU:0"));
-            core::Tensor dst_data_CPU =
-                    (dtype == GetDtype()
-                             ? data_CPU
-                             : core::Tensor::Empty(
-                                       std::vector<int64_t>{GetRows(),
-                                                            GetCols(),
-                                                            GetChannels()},
-                                       dtype, core::Device("CPU:0")));
-            IPP_CALL(ipp::To, data_CPU, dst_data_CPU, scale, offset);
-            if (!copy && dtype == GetDtype()) {
-                const_cast<core::Tensor &>(data_).CopyFrom(dst_data_CPU);
-                dst_im.data_ = data_;
-            } else {
-                dst_im.data_ = dst_data_CPU.To(device);
-            }
-        } else {
-            if (!copy && dtype == GetDtype()) {
-                dst_im.data_ = data_;
-            } else {
-                dst_im.data_ = core::Tensor::Empty(
-                        std::vector<int64_t>{GetRows(), GetCols(),
-                                             GetChannels()},
-                        dtype, GetDevice());
-            }
-            IPP_CALL(ipp::To, data_, dst_im.data_, scale, offset);
-        }
+        IPP_CALL(ipp::To, data_, dst_im.data_, scale, offset);
     } else {
-        // Suppress unused-but-set-variable warning if IPPICV is not available
-        (void)scale;
-
-        utility::LogError(
-                "Conversion from {} to {} on device {} is not implemented!",
-                GetDtype().ToString(), dtype.ToString(),
-                GetDevice().ToString());
+        // NPP does not expose a useful API for saturate_cast with scale and
+        // offset, so CUDA images use our own kernel.
+        kernel::image::To(data_, dst_im.data_, scale, offset);
     }
     return dst_im;
 }
@@ -235,6 +209,11 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Resize, data_, dst_im.data_, interp_type);
+    } else if (interp_type == InterpType::Nearest ||
+               interp_type == InterpType::Linear) {
+        // Fallback for data types and channels not supported by NPP and IPP.
+        kernel::image::Resize(data_, dst_im.data_,
+                              interp_type == InterpType::Linear);
     } else {
         utility::LogError(
                 "Resize with data type {} on device {} is not "
@@ -244,7 +223,133 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
     return dst_im;
 }
 
-Image Image::Dilate(int kernel_size) const {
+/// Reuse \p dst's buffer if it already has the requested shape, dtype and
+/// device, otherwise reallocate it. Neighbourhood filters read pixels that
+/// have already been written, so \p dst must not share memory with \p src.
+static void PrepareOutput(const Image &src,
+                          Image &dst,
+                          int64_t rows,
+                          int64_t cols,
+                          int64_t channels,
+                          core::Dtype dtype,
+                          const std::string &fn_name) {
+    const core::Tensor &src_t = src.AsTensor();
+    const core::Tensor &dst_t = dst.AsTensor();
+    if (dst_t.NumElements() > 0 && dst_t.GetBlob() == src_t.GetBlob()) {
+        utility::LogError(
+                "{}: the output image must not share memory with the input "
+                "image.",
+                fn_name);
+    }
+    if (dst.GetRows() != rows || dst.GetCols() != cols ||
+        dst.GetChannels() != channels || dst.GetDtype() != dtype ||
+        dst.GetDevice() != src.GetDevice() || !dst_t.IsContiguous()) {
+        dst.Reset(rows, cols, channels, dtype, src.GetDevice());
+    }
+}
+
+static void PrepareFilterOutput(const Image &src,
+                                Image &dst,
+                                int64_t channels,
+                                core::Dtype dtype,
+                                const std::string &fn_name) {
+    PrepareOutput(src, dst, src.GetRows(), src.GetCols(), channels, dtype,
+                  fn_name);
+}
+
+core::Tensor Image::CreateUndistortMap(const core::Tensor &intrinsics,
+                                       const core::Tensor &distortion,
+                                       int64_t rows,
+                                       int64_t cols,
+                                       const core::Device &device) {
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (distortion.NumDims() != 1 ||
+        !(distortion.GetLength() == 4 || distortion.GetLength() == 5 ||
+          distortion.GetLength() == 8)) {
+        utility::LogError(
+                "Expected 4, 5 or 8 distortion coefficients, but got shape "
+                "{}.",
+                distortion.GetShape().ToString());
+    }
+    if (rows <= 0 || cols <= 0) {
+        utility::LogError("Invalid image size ({}, {}).", rows, cols);
+    }
+
+    // The map is computed once, so a plain CPU loop is enough.
+    const core::Tensor K =
+            intrinsics.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const core::Tensor D =
+            distortion.To(core::Device("CPU:0"), core::Float64).Contiguous();
+    const double *K_ptr = K.GetDataPtr<double>();
+    const double fx = K_ptr[0], cx = K_ptr[2];
+    const double fy = K_ptr[4], cy = K_ptr[5];
+    double d[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    for (int64_t i = 0; i < D.GetLength(); ++i) {
+        d[i] = D.GetDataPtr<double>()[i];
+    }
+    const double k1 = d[0], k2 = d[1], p1 = d[2], p2 = d[3], k3 = d[4];
+    const double k4 = d[5], k5 = d[6], k6 = d[7];
+
+    core::Tensor map({rows, cols, 2}, core::Float32, core::Device("CPU:0"));
+    float *map_ptr = map.GetDataPtr<float>();
+#pragma omp parallel for schedule(static)
+    for (int64_t v = 0; v < rows; ++v) {
+        for (int64_t u = 0; u < cols; ++u) {
+            // Distort the normalized coordinates of the ideal pixel with the
+            // Brown-Conrady (rational) model and project them back.
+            const double x = (u - cx) / fx;
+            const double y = (v - cy) / fy;
+            const double r2 = x * x + y * y;
+            const double r4 = r2 * r2;
+            const double r6 = r4 * r2;
+            const double radial = (1 + k1 * r2 + k2 * r4 + k3 * r6) /
+                                  (1 + k4 * r2 + k5 * r4 + k6 * r6);
+            const double xd =
+                    x * radial + 2 * p1 * x * y + p2 * (r2 + 2 * x * x);
+            const double yd =
+                    y * radial + p1 * (r2 + 2 * y * y) + 2 * p2 * x * y;
+            float *uv = map_ptr + 2 * (v * cols + u);
+            uv[0] = static_cast<float>(fx * xd + cx);
+            uv[1] = static_cast<float>(fy * yd + cy);
+        }
+    }
+    return map.To(device);
+}
+
+Image Image::Remap(const core::Tensor &map, InterpType interp_type) const {
+    Image dst_im;
+    Remap(dst_im, map, interp_type);
+    return dst_im;
+}
+
+Image &Image::Remap(Image &dst_im,
+                    const core::Tensor &map,
+                    InterpType interp_type) const {
+    core::AssertTensorShape(map, {utility::nullopt, utility::nullopt, 2});
+    core::AssertTensorDtype(map, core::Float32);
+    core::AssertTensorDevice(map, GetDevice());
+    if (interp_type != InterpType::Nearest &&
+        interp_type != InterpType::Linear) {
+        utility::LogError(
+                "Remap only supports Nearest and Linear interpolation.");
+    }
+
+    PrepareOutput(*this, dst_im, map.GetShape(0), map.GetShape(1),
+                  GetChannels(), GetDtype(), "Remap");
+    kernel::image::Remap(data_, map.Contiguous(), dst_im.data_,
+                         interp_type == InterpType::Linear);
+    return dst_im;
+}
+
+Image Image::Undistort(const core::Tensor &intrinsics,
+                       const core::Tensor &distortion,
+                       InterpType interp_type) const {
+    return Remap(CreateUndistortMap(intrinsics, distortion, GetRows(),
+                                    GetCols(), GetDevice()),
+                 interp_type);
+}
+
+Image &Image::Dilate(Image &dst_im, int kernel_size) const {
     // Check NPP datatype support for each function in documentation:
     // https://docs.nvidia.com/cuda/npp/group__nppi.html
     static const dtype_channels_pairs npp_supported{
@@ -262,8 +367,7 @@ Image Image::Dilate(int kernel_size) const {
             {core::Float32, 3}, {core::Bool, 4},  {core::UInt8, 4},
             {core::Float32, 4}};
 
-    Image dst_im;
-    dst_im.data_ = core::Tensor::EmptyLike(data_);
+    PrepareFilterOutput(*this, dst_im, GetChannels(), GetDtype(), "Dilate");
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
@@ -281,9 +385,16 @@ Image Image::Dilate(int kernel_size) const {
     return dst_im;
 }
 
-Image Image::FilterBilateral(int kernel_size,
-                             float value_sigma,
-                             float dist_sigma) const {
+Image Image::Dilate(int kernel_size) const {
+    Image dst_im;
+    Dilate(dst_im, kernel_size);
+    return dst_im;
+}
+
+Image &Image::FilterBilateral(Image &dst_im,
+                              int kernel_size,
+                              float value_sigma,
+                              float dist_sigma) const {
     if (kernel_size < 3) {
         utility::LogError("Kernel size must be >= 3, but got {}.", kernel_size);
     }
@@ -299,8 +410,8 @@ Image Image::FilterBilateral(int kernel_size,
             {core::Float32, 3},
     };
 
-    Image dst_im;
-    dst_im.data_ = core::Tensor::EmptyLike(data_);
+    PrepareFilterOutput(*this, dst_im, GetChannels(), GetDtype(),
+                        "FilterBilateral");
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
@@ -321,7 +432,15 @@ Image Image::FilterBilateral(int kernel_size,
     return dst_im;
 }
 
-Image Image::Filter(const core::Tensor &kernel) const {
+Image Image::FilterBilateral(int kernel_size,
+                             float value_sigma,
+                             float dist_sigma) const {
+    Image dst_im;
+    FilterBilateral(dst_im, kernel_size, value_sigma, dist_sigma);
+    return dst_im;
+}
+
+Image &Image::Filter(Image &dst_im, const core::Tensor &kernel) const {
     static const dtype_channels_pairs npp_supported{
             {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
             {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
@@ -333,8 +452,7 @@ Image Image::Filter(const core::Tensor &kernel) const {
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
 
-    Image dst_im;
-    dst_im.data_ = core::Tensor::EmptyLike(data_);
+    PrepareFilterOutput(*this, dst_im, GetChannels(), GetDtype(), "Filter");
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
@@ -353,7 +471,15 @@ Image Image::Filter(const core::Tensor &kernel) const {
     return dst_im;
 }
 
-Image Image::FilterGaussian(int kernel_size, float sigma) const {
+Image Image::Filter(const core::Tensor &kernel) const {
+    Image dst_im;
+    Filter(dst_im, kernel);
+    return dst_im;
+}
+
+Image &Image::FilterGaussian(Image &dst_im,
+                             int kernel_size,
+                             float sigma) const {
     if (kernel_size < 3 || kernel_size % 2 == 0) {
         utility::LogError("Kernel size must be an odd number >= 3, but got {}.",
                           kernel_size);
@@ -370,8 +496,8 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
 
-    Image dst_im;
-    dst_im.data_ = core::Tensor::EmptyLike(data_);
+    PrepareFilterOutput(*this, dst_im, GetChannels(), GetDtype(),
+                        "FilterGaussian");
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
         std::count(npp_supported.begin(), npp_supported.end(),
                    std::make_pair(GetDtype(), GetChannels())) > 0) {
@@ -390,7 +516,15 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
     return dst_im;
 }
 
-std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
+Image Image::FilterGaussian(int kernel_size, float sigma) const {
+    Image dst_im;
+    FilterGaussian(dst_im, kernel_size, sigma);
+    return dst_im;
+}
+
+void Image::FilterSobel(Image &dst_im_dx,
+                        Image &dst_im_dy,
+                        int kernel_size) const {
     if (!(kernel_size == 3 || kernel_size == 5)) {
         utility::LogError("Kernel size must be 3 or 5, but got {}.",
                           kernel_size);
@@ -409,16 +543,14 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
     };
 
     // Routines: 8u16s, 32f
-    Image dst_im_dx, dst_im_dy;
-    core::Dtype dtype = GetDtype();
-    if (dtype == core::Float32) {
-        dst_im_dx = core::Tensor::EmptyLike(data_);
-        dst_im_dy = core::Tensor::EmptyLike(data_);
-    } else if (dtype == core::UInt8) {
-        dst_im_dx = core::Tensor::Empty(data_.GetShape(), core::Int16,
-                                        data_.GetDevice());
-        dst_im_dy = core::Tensor::Empty(data_.GetShape(), core::Int16,
-                                        data_.GetDevice());
+    const core::Dtype dst_dtype =
+            GetDtype() == core::UInt8 ? core::Int16 : GetDtype();
+    PrepareFilterOutput(*this, dst_im_dx, GetChannels(), dst_dtype,
+                        "FilterSobel");
+    PrepareFilterOutput(*this, dst_im_dy, GetChannels(), dst_dtype,
+                        "FilterSobel");
+    if (dst_im_dx.AsTensor().IsSame(dst_im_dy.AsTensor())) {
+        utility::LogError("FilterSobel: dx and dy must be different images.");
     }
 
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
@@ -438,6 +570,11 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
                 "implemented!",
                 GetDtype().ToString(), GetDevice().ToString());
     }
+}
+
+std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
+    Image dst_im_dx, dst_im_dy;
+    FilterSobel(dst_im_dx, dst_im_dy, kernel_size);
     return std::make_pair(dst_im_dx, dst_im_dy);
 }
 
@@ -199,10 +199,61 @@ public:
     /// type.
     ///
     /// Downsample if sampling rate is < 1. Upsample if sampling rate > 1.
-    /// Aspect ratio is always preserved.
+    /// Aspect ratio is always preserved. Nearest and Linear interpolation are
+    /// supported for all data types and channels on all devices.
     Image Resize(float sampling_rate = 0.5f,
                  InterpType interp_type = InterpType::Nearest) const;
 
+    /// \brief Compute a lookup table that undistorts images with Remap.
+    ///
+    /// For every pixel of the undistorted image, the table stores the (x, y)
+    /// coordinates of the same point in the distorted input image. The
+    /// undistorted image uses the same camera matrix as the input. Compute
+    /// the table once per camera and reuse it for every frame.
+    ///
+    /// \param intrinsics 3x3 camera matrix.
+    /// \param distortion Distortion coefficients (k1, k2, p1, p2[, k3[, k4,
+    /// k5, k6]]) in the OpenCV order, i.e. the Brown-Conrady model with an
+    /// optional rational radial term.
+    /// \param rows Image height.
+    /// \param cols Image width.
+    /// \param device Device of the returned table.
+    ///
+    /// \return Float32 tensor of shape (rows, cols, 2).
+    static core::Tensor CreateUndistortMap(
+            const core::Tensor &intrinsics,
+            const core::Tensor &distortion,
+            int64_t rows,
+            int64_t cols,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// \brief Return a new image sampled at the coordinates in \p map.
+    ///
+    /// Output pixel (u, v) takes the value of this image at (map[v, u, 0],
+    /// map[v, u, 1]), with pixel centers at integer coordinates. Pixels that
+    /// map outside of the image are set to 0. All data types and channels are
+    /// supported on all devices.
+    ///
+    /// \param map Float32 tensor of shape (rows, cols, 2) on the same device,
+    /// e.g. from CreateUndistortMap. The output has the same rows and cols.
+    /// \param interp_type Nearest or Linear.
+    Image Remap(const core::Tensor &map,
+                InterpType interp_type = InterpType::Linear) const;
+
+    /// \brief Remap into a preallocated image \p dst. See Dilate(Image &,
+    /// int) for the reuse rules.
+    Image &Remap(Image &dst,
+                 const core::Tensor &map,
+                 InterpType interp_type = InterpType::Linear) const;
+
+    /// \brief Return a new undistorted image.
+    ///
+    /// This computes the lookup table on every call. For video, call
+    /// CreateUndistortMap once and Remap for every frame instead.
+    Image Undistort(const core::Tensor &intrinsics,
+                    const core::Tensor &distortion,
+                    InterpType interp_type = InterpType::Linear) const;
+
     /// \brief Return a new image after performing morphological dilation.
     ///
     /// Supported datatypes are UInt8, UInt16 and Float32 with {1, 3, 4}
@@ -212,9 +263,22 @@ public:
     /// \param kernel_size An odd number >= 3.
     Image Dilate(int kernel_size = 3) const;
 
+    /// \brief Perform morphological dilation into a preallocated image.
+    ///
+    /// \p dst is reallocated only if its shape, dtype or device do not match
+    /// the result, so it can be reused across calls. \p dst must not share
+    /// memory with this image.
+    ///
+    /// \return Reference to \p dst.
+    Image &Dilate(Image &dst, int kernel_size = 3) const;
+
     /// \brief Return a new image after filtering with the given kernel.
     Image Filter(const core::Tensor &kernel) const;
 
+    /// \brief Filter with the given kernel into a preallocated image \p dst.
+    /// See Dilate(Image &, int) for the reuse rules.
+    Image &Filter(Image &dst, const core::Tensor &kernel) const;
+
     /// \brief Return a new image after bilateral filtering.
     ///
     /// \param value_sigma Standard deviation for the image content.
@@ -229,18 +293,35 @@ public:
                           float value_sigma = 20.0f,
                           float distance_sigma = 10.0f) const;
 
+    /// \brief Bilateral filter into a preallocated image \p dst. See
+    /// Dilate(Image &, int) for the reuse rules.
+    Image &FilterBilateral(Image &dst,
+                           int kernel_size = 3,
+                           float value_sigma = 20.0f,
+                           float distance_sigma = 10.0f) const;
+
     /// \brief Return a new image after Gaussian filtering.
     ///
     /// \param kernel_size Odd numbers >= 3 are supported.
     /// \param sigma Standard deviation of the Gaussian distribution.
     Image FilterGaussian(int kernel_size = 3, float sigma = 1.0f) const;
 
+    /// \brief Gaussian filter into a preallocated image \p dst. See
+    /// Dilate(Image &, int) for the reuse rules.
+    Image &FilterGaussian(Image &dst,
+                          int kernel_size = 3,
+                          float sigma = 1.0f) const;
+
     /// \brief Return a pair of new gradient images (dx, dy) after Sobel
     /// filtering.
     ///
     /// \param kernel_size: Sobel filter kernel size, either 3 or 5.
     std::pair<Image, Image> FilterSobel(int kernel_size = 3) const;
 
+    /// \brief Sobel filter into preallocated gradient images \p dx and \p
+    /// dy. See Dilate(Image &, int) for the reuse rules.
+    void FilterSobel(Image &dx, Image &dy, int kernel_size = 3) const;
+
     /// \brief Return a new downsampled image with pyramid downsampling.
     ///
     /// The returned image is formed by a chained Gaussian filter (kernel_size =
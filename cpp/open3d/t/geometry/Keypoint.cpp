@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Keypoint.h"
+
+#include <algorithm>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/kernel/PointCloud.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace keypoint {
+
+namespace {
+
+// Query points per radius search, which bounds the size of the neighbor
+// lists of a block.
+constexpr int64_t kISSBlockSize = 1 << 18;
+
+void ComputeISSSaliency(const core::Tensor &points,
+                        const core::Tensor &neighbor_indices,
+                        const core::Tensor &neighbor_row_splits,
+                        core::Tensor &saliency,
+                        int64_t min_neighbors,
+                        double gamma_21,
+                        double gamma_32) {
+    const core::Device::DeviceType device_type =
+            points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::ComputeISSSaliencyCPU(
+                points, neighbor_indices, neighbor_row_splits, saliency,
+                min_neighbors, gamma_21, gamma_32);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::ComputeISSSaliencyCUDA, points,
+                  neighbor_indices, neighbor_row_splits, saliency,
+                  min_neighbors, gamma_21, gamma_32);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeISSLocalMaxima(const core::Tensor &saliency,
+                           const core::Tensor &query_indices,
+                           const core::Tensor &neighbor_indices,
+                           const core::Tensor &neighbor_row_splits,
+                           core::Tensor &is_local_maximum,
+                           int64_t min_neighbors) {
+    const core::Device::DeviceType device_type =
+            saliency.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::ComputeISSLocalMaximaCPU(
+                saliency, query_indices, neighbor_indices,
+                neighbor_row_splits, is_local_maximum, min_neighbors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::ComputeISSLocalMaximaCUDA, saliency,
+                  query_indices, neighbor_indices, neighbor_row_splits,
+                  is_local_maximum, min_neighbors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace
+
+PointCloud ComputeISSKeypoints(const PointCloud &input,
+                               double salient_radius /* = 0.0 */,
+                               double non_max_radius /* = 0.0 */,
+                               double gamma_21 /* = 0.975 */,
+                               double gamma_32 /* = 0.975 */,
+                               int min_neighbors /* = 5 */) {
+    if (input.IsEmpty()) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return PointCloud(input.GetDevice());
+    }
+    const core::Tensor points = input.GetPointPositions().Contiguous();
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+
+    core::nns::NearestNeighborSearch tree(points);
+    if (!tree.LBVHIndex()) {
+        utility::LogError("Building LBVHIndex failed.");
+    }
+
+    if (salient_radius == 0.0 || non_max_radius == 0.0) {
+        // Model resolution, the mean distance to the nearest other point.
+        core::Tensor distances;
+        std::tie(std::ignore, distances) = tree.KnnSearch(points, 2);
+        const double resolution =
+                distances.GetShape(1) < 2
+                        ? 0.0
+                        : distances.Slice(1, 1, 2)
+                                  .Sqrt()
+                                  .Mean({0, 1})
+                                  .To(core::Float64)
+                                  .Item<double>();
+        salient_radius = 6 * resolution;
+        non_max_radius = 4 * resolution;
+        utility::LogDebug(
+                "[ComputeISSKeypoints] Computed salient_radius = {}, "
+                "non_max_radius = {} from input model",
+                salient_radius, non_max_radius);
+    }
+    if (salient_radius <= 0.0 || non_max_radius <= 0.0) {
+        utility::LogWarning(
+                "[ComputeISSKeypoints] Radii must be positive, got "
+                "salient_radius = {} and non_max_radius = {}.",
+                salient_radius, non_max_radius);
+        return PointCloud(device);
+    }
+
+    core::Tensor indices, row_splits;
+    core::Tensor saliency =
+            core::Tensor::Zeros({num_points}, points.GetDtype(), device);
+    for (int64_t begin = 0; begin < num_points; begin += kISSBlockSize) {
+        const int64_t end = std::min(begin + kISSBlockSize, num_points);
+        std::tie(indices, std::ignore, row_splits) = tree.FixedRadiusSearch(
+                points.Slice(0, begin, end), salient_radius, false);
+        core::Tensor block_saliency = saliency.Slice(0, begin, end);
+        ComputeISSSaliency(points, indices.To(core::Int32).Contiguous(),
+                           row_splits.To(core::Int64).Contiguous(),
+                           block_saliency, min_neighbors, gamma_21,
+                           gamma_32);
+    }
+
+    // Only salient points can be keypoints, so only they are searched.
+    const core::Tensor candidates = saliency.Gt(0).NonZero()[0].Contiguous();
+    const int64_t num_candidates = candidates.GetLength();
+    core::Tensor is_keypoint =
+            core::Tensor::Empty({num_candidates}, core::Bool, device);
+    for (int64_t begin = 0; begin < num_candidates; begin += kISSBlockSize) {
+        const int64_t end = std::min(begin + kISSBlockSize, num_candidates);
+        const core::Tensor block_candidates = candidates.Slice(0, begin, end);
+        std::tie(indices, std::ignore, row_splits) = tree.FixedRadiusSearch(
+                points.IndexGet({block_candidates}), non_max_radius, false);
+        core::Tensor block_is_keypoint = is_keypoint.Slice(0, begin, end);
+        ComputeISSLocalMaxima(saliency, block_candidates,
+                              indices.To(core::Int32).Contiguous(),
+                              row_splits.To(core::Int64).Contiguous(),
+                              block_is_keypoint, min_neighbors);
+    }
+    const core::Tensor keypoints = candidates.IndexGet({is_keypoint});
+    utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
+                      keypoints.GetLength());
+
+    PointCloud output(device);
+    for (const auto &kv : input.GetPointAttr().IndexGet(keypoints)) {
+        output.SetPointAttr(kv.first, kv.second);
+    }
+    return output;
+}
+
+}  // namespace keypoint
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
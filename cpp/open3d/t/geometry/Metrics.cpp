@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Metrics.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+core::Tensor ComputeMetricsCommon(const core::Tensor &distance12,
+                                  const core::Tensor &distance21,
+                                  const std::vector<Metric> &metrics,
+                                  const MetricParameters &params) {
+    core::AssertTensorDevice(distance21, distance12.GetDevice());
+    if (distance12.NumElements() == 0 || distance21.NumElements() == 0) {
+        utility::LogError("Distances must not be empty.");
+    }
+    const core::Tensor d12 = distance12.Reshape({-1}).To(core::Float64);
+    const core::Tensor d21 = distance21.Reshape({-1}).To(core::Float64);
+
+    std::vector<float> metric_values;
+    for (const Metric metric : metrics) {
+        switch (metric) {
+            case Metric::ChamferDistance:
+                metric_values.push_back(
+                        static_cast<float>(d12.Mean({0}).Item<double>() +
+                                           d21.Mean({0}).Item<double>()));
+                break;
+            case Metric::HausdorffDistance:
+                metric_values.push_back(static_cast<float>(
+                        std::max(d12.Max({0}).Item<double>(),
+                                 d21.Max({0}).Item<double>())));
+                break;
+            case Metric::FScore:
+                for (const float radius : params.fscore_radius) {
+                    const double precision = d12.Lt(radius)
+                                                     .To(core::Float64)
+                                                     .Mean({0})
+                                                     .Item<double>();
+                    const double recall = d21.Lt(radius)
+                                                  .To(core::Float64)
+                                                  .Mean({0})
+                                                  .Item<double>();
+                    const double fscore =
+                            precision + recall > 0
+                                    ? 2 * precision * recall /
+                                              (precision + recall)
+                                    : 0;
+                    metric_values.push_back(static_cast<float>(fscore));
+                }
+                break;
+            default:
+                utility::LogError("Unsupported metric.");
+        }
+    }
+    return core::Tensor(metric_values, {int64_t(metric_values.size())},
+                        core::Float32);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
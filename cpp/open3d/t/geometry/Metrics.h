@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// Metrics for comparing two geometries.
+enum class Metric {
+    /// Mean distance from each geometry to the other one, summed over both
+    /// directions.
+    ChamferDistance,
+    /// Largest distance from a point of either geometry to the other one.
+    HausdorffDistance,
+    /// Harmonic mean of precision and recall at each of the
+    /// MetricParameters::fscore_radius thresholds, in [0, 1].
+    FScore
+};
+
+/// Holder for the parameters of the geometry comparison metrics.
+struct MetricParameters {
+    /// Distance thresholds at which the F-Score is evaluated. One value is
+    /// returned per threshold.
+    std::vector<float> fscore_radius = {0.01f};
+};
+
+/// \brief Computes the metrics from nearest neighbor distances in both
+/// directions.
+///
+/// \param distance12 Distances from each element of the first geometry to the
+/// second one, of shape {N,}.
+/// \param distance21 Distances from each element of the second geometry to the
+/// first one, of shape {M,}.
+/// \param metrics The metrics to compute.
+/// \param params Parameters of the metrics.
+/// \return A Float32 CPU tensor with one value per metric, in the order of
+/// \p metrics. FScore expands to one value per threshold in
+/// MetricParameters::fscore_radius.
+core::Tensor ComputeMetricsCommon(const core::Tensor &distance12,
+                                  const core::Tensor &distance21,
+                                  const std::vector<Metric> &metrics,
+                                  const MetricParameters &params);
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
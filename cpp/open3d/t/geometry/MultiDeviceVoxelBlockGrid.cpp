@@ -0,0 +1,380 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/MultiDeviceVoxelBlockGrid.h"
+
+#include <future>
+#include <unordered_map>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// Runs fn(i) for every device index i in its own thread, so that the devices
+/// work concurrently. Exceptions are rethrown in the calling thread.
+template <typename Func>
+static void ForEachDevice(int64_t count, const Func &fn) {
+    if (count == 1) {
+        fn(0);
+        return;
+    }
+    std::vector<std::future<void>> futures;
+    for (int64_t i = 0; i < count; ++i) {
+        futures.push_back(std::async(std::launch::async, fn, i));
+    }
+    for (auto &future : futures) {
+        future.get();
+    }
+}
+
+MultiDeviceVoxelBlockGrid::MultiDeviceVoxelBlockGrid(
+        const std::vector<std::string> &attr_names,
+        const std::vector<core::Dtype> &attr_dtypes,
+        const std::vector<core::SizeVector> &attr_channels,
+        float voxel_size,
+        int64_t block_resolution,
+        int64_t block_count,
+        const std::vector<core::Device> &devices,
+        int64_t partition_resolution,
+        const core::HashBackendType &backend)
+    : voxel_size_(voxel_size),
+      block_resolution_(block_resolution),
+      partition_resolution_(partition_resolution),
+      devices_(devices) {
+    if (devices.empty()) {
+        utility::LogError("At least one device is required.");
+    }
+    if (partition_resolution <= 0) {
+        utility::LogError("partition resolution must be positive, but got {}",
+                          partition_resolution);
+    }
+
+    // Voxel size and block resolution are checked by VoxelBlockGrid.
+    for (const core::Device &device : devices) {
+        grids_.emplace_back(attr_names, attr_dtypes, attr_channels, voxel_size,
+                            block_resolution, block_count, device, backend);
+    }
+}
+
+VoxelBlockGrid &MultiDeviceVoxelBlockGrid::GetGrid(int64_t index) {
+    AssertInitialized();
+    if (index < 0 || index >= GetDeviceCount()) {
+        utility::LogError("device index {} out of range [0, {}).", index,
+                          GetDeviceCount());
+    }
+    return grids_[index];
+}
+
+core::Tensor MultiDeviceVoxelBlockGrid::GetOwners(
+        const core::Tensor &block_coords) const {
+    AssertInitialized();
+    core::AssertTensorShape(block_coords, {utility::nullopt, 3});
+    core::AssertTensorDtype(block_coords, core::Int32);
+
+    core::Tensor regions = (block_coords.To(core::Float64) /
+                            static_cast<double>(partition_resolution_))
+                                   .Floor()
+                                   .To(core::Int64);
+
+    // Spatial hash of the region coordinates, reduced modulo the device count
+    // with a floored division to stay non-negative.
+    core::Tensor primes = core::Tensor::Init<int64_t>(
+            {73856093, 19349669, 83492791}, block_coords.GetDevice());
+    core::Tensor hashes = (regions * primes).Sum({1});
+    const int64_t count = GetDeviceCount();
+    return hashes - (hashes.To(core::Float64) / static_cast<double>(count))
+                                    .Floor()
+                                    .To(core::Int64) *
+                            count;
+}
+
+core::Tensor MultiDeviceVoxelBlockGrid::GetRoutingMask(
+        const core::Tensor &block_coords, int64_t index) const {
+    core::Tensor mask = core::Tensor::Zeros({block_coords.GetLength()},
+                                            core::Bool,
+                                            block_coords.GetDevice());
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                core::Tensor offset = core::Tensor::Init<int32_t>(
+                        {dx, dy, dz}, block_coords.GetDevice());
+                mask = mask.LogicalOr(
+                        GetOwners(block_coords + offset).Eq(index));
+            }
+        }
+    }
+    return mask;
+}
+
+core::Tensor MultiDeviceVoxelBlockGrid::GetOwnedMask(const core::Tensor &points,
+                                                     int64_t index) const {
+    float block_size = voxel_size_ * block_resolution_;
+    core::Tensor keys =
+            (points / block_size).Floor().To(core::Int32).Contiguous();
+    return GetOwners(keys).Eq(index);
+}
+
+void MultiDeviceVoxelBlockGrid::Integrate(const Image &depth,
+                                          const core::Tensor &intrinsic,
+                                          const core::Tensor &extrinsic,
+                                          float depth_scale,
+                                          float depth_max,
+                                          float trunc_voxel_multiplier) {
+    Integrate(depth, Image(), intrinsic, extrinsic, depth_scale, depth_max,
+              trunc_voxel_multiplier);
+}
+
+void MultiDeviceVoxelBlockGrid::Integrate(const Image &depth,
+                                          const Image &color,
+                                          const core::Tensor &intrinsic,
+                                          const core::Tensor &extrinsic,
+                                          float depth_scale,
+                                          float depth_max,
+                                          float trunc_voxel_multiplier) {
+    AssertInitialized();
+    core::Tensor block_coords = grids_[0].GetUniqueBlockCoordinates(
+            depth.To(devices_[0]), intrinsic, extrinsic, depth_scale,
+            depth_max, trunc_voxel_multiplier);
+    if (block_coords.GetLength() == 0) {
+        return;
+    }
+
+    ForEachDevice(GetDeviceCount(), [&](int64_t i) {
+        core::Tensor device_coords =
+                block_coords.IndexGet({GetRoutingMask(block_coords, i)});
+        if (device_coords.GetLength() == 0) {
+            return;
+        }
+        const core::Device &device = devices_[i];
+        grids_[i].Integrate(device_coords.To(device), depth.To(device),
+                            color.IsEmpty() ? color : color.To(device),
+                            intrinsic, extrinsic, depth_scale, depth_max,
+                            trunc_voxel_multiplier);
+    });
+}
+
+TensorMap MultiDeviceVoxelBlockGrid::RayCast(
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        int width,
+        int height,
+        const std::vector<std::string> attrs,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold) {
+    AssertInitialized();
+
+    static const std::unordered_map<std::string, int> kAttrChannelMap = {
+            {"vertex", 3}, {"normal", 3}, {"depth", 1}, {"color", 3}};
+
+    // Depth is always rendered to select the nearest surface of each pixel.
+    std::vector<std::string> device_attrs = {"depth"};
+    for (const auto &attr : attrs) {
+        if (kAttrChannelMap.count(attr) == 0) {
+            utility::LogError(
+                    "Unsupported attribute {} for multi-device ray casting.",
+                    attr);
+        }
+        if (attr != "depth") {
+            device_attrs.push_back(attr);
+        }
+    }
+
+    const int64_t count = GetDeviceCount();
+    std::vector<TensorMap> device_maps(count, TensorMap("depth"));
+    std::vector<char> has_map(count, false);
+    ForEachDevice(count, [&](int64_t i) {
+        core::HashMap hashmap = grids_[i].GetHashMap();
+        if (hashmap.Size() == 0) {
+            return;
+        }
+        core::Tensor block_coords = hashmap.GetKeyTensor().IndexGet(
+                {hashmap.GetActiveIndices().To(core::Int64)});
+        TensorMap device_map = grids_[i].RayCast(
+                block_coords, intrinsic, extrinsic, width, height,
+                device_attrs, depth_scale, depth_min, depth_max,
+                weight_threshold);
+        for (const auto &attr : device_attrs) {
+            device_maps[i][attr] = device_map[attr].To(devices_[0]);
+        }
+        has_map[i] = true;
+    });
+
+    TensorMap renderings_map("depth");
+    for (const auto &attr : device_attrs) {
+        renderings_map[attr] = core::Tensor::Zeros(
+                {height, width, kAttrChannelMap.at(attr)}, core::Float32,
+                devices_[0]);
+    }
+    for (int64_t i = 0; i < count; ++i) {
+        if (!has_map[i]) {
+            continue;
+        }
+
+        // Take the pixels where this device hits a nearer surface.
+        core::Tensor depth = device_maps[i]["depth"];
+        core::Tensor nearest_depth = renderings_map["depth"];
+        core::Tensor fill_mask =
+                depth.Gt(0)
+                        .LogicalAnd(nearest_depth.Le(0).LogicalOr(
+                                depth.Lt(nearest_depth)))
+                        .Reshape({height, width});
+        for (const auto &attr : device_attrs) {
+            renderings_map[attr].IndexSet(
+                    {fill_mask}, device_maps[i][attr].IndexGet({fill_mask}));
+        }
+    }
+
+    return renderings_map;
+}
+
+PointCloud MultiDeviceVoxelBlockGrid::ExtractPointCloud(
+        float weight_threshold) {
+    AssertInitialized();
+    const int64_t count = GetDeviceCount();
+    std::vector<core::Tensor> points(count), normals(count), colors(count);
+    std::vector<char> has_points(count, false), has_colors(count, false);
+    ForEachDevice(count, [&](int64_t i) {
+        if (grids_[i].GetHashMap().Size() == 0) {
+            return;
+        }
+        PointCloud pcd = grids_[i].ExtractPointCloud(-1, weight_threshold);
+        if (pcd.GetPointPositions().GetLength() == 0) {
+            return;
+        }
+        core::Tensor mask = GetOwnedMask(pcd.GetPointPositions(), i);
+        points[i] = pcd.GetPointPositions().IndexGet({mask}).To(devices_[0]);
+        normals[i] = pcd.GetPointNormals().IndexGet({mask}).To(devices_[0]);
+        if (pcd.HasPointColors()) {
+            colors[i] = pcd.GetPointColors().IndexGet({mask}).To(devices_[0]);
+            has_colors[i] = true;
+        }
+        has_points[i] = true;
+    });
+
+    std::vector<core::Tensor> all_points, all_normals, all_colors;
+    for (int64_t i = 0; i < count; ++i) {
+        if (!has_points[i]) {
+            continue;
+        }
+        all_points.push_back(points[i]);
+        all_normals.push_back(normals[i]);
+        if (has_colors[i]) {
+            all_colors.push_back(colors[i]);
+        }
+    }
+
+    if (all_points.empty()) {
+        return PointCloud(devices_[0]);
+    }
+    PointCloud pcd(core::Concatenate(all_points));
+    pcd.SetPointNormals(core::Concatenate(all_normals));
+    if (all_colors.size() == all_points.size()) {
+        pcd.SetPointColors(core::Concatenate(all_colors));
+    }
+    return pcd;
+}
+
+TriangleMesh MultiDeviceVoxelBlockGrid::ExtractTriangleMesh(
+        float weight_threshold) {
+    AssertInitialized();
+    const int64_t count = GetDeviceCount();
+    std::vector<core::Tensor> vertices(count), normals(count), colors(count),
+            triangles(count);
+    std::vector<char> has_mesh(count, false), has_colors(count, false);
+    ForEachDevice(count, [&](int64_t i) {
+        if (grids_[i].GetHashMap().Size() == 0) {
+            return;
+        }
+        TriangleMesh mesh = grids_[i].ExtractTriangleMesh(-1, weight_threshold);
+        core::Tensor device_vertices = mesh.GetVertexPositions();
+        core::Tensor device_triangles = mesh.GetTriangleIndices();
+        if (device_triangles.GetLength() == 0) {
+            return;
+        }
+
+        core::Tensor corners = device_triangles.To(core::Int64).T();
+        core::Tensor centroids = device_vertices.IndexGet({corners[0]});
+        for (int64_t k = 1; k < 3; ++k) {
+            centroids += device_vertices.IndexGet({corners[k]});
+        }
+        centroids /= 3.0f;
+
+        // Vertices only referenced by halo triangles are kept.
+        core::Tensor mask = GetOwnedMask(centroids, i);
+        vertices[i] = device_vertices.To(devices_[0]);
+        normals[i] = mesh.GetVertexNormals().To(devices_[0]);
+        if (mesh.HasVertexColors()) {
+            colors[i] = mesh.GetVertexColors().To(devices_[0]);
+            has_colors[i] = true;
+        }
+        triangles[i] = device_triangles.IndexGet({mask}).To(devices_[0]);
+        has_mesh[i] = true;
+    });
+
+    std::vector<core::Tensor> all_vertices, all_normals, all_colors,
+            all_triangles;
+    int64_t vertex_offset = 0;
+    for (int64_t i = 0; i < count; ++i) {
+        if (!has_mesh[i]) {
+            continue;
+        }
+        all_vertices.push_back(vertices[i]);
+        all_normals.push_back(normals[i]);
+        if (has_colors[i]) {
+            all_colors.push_back(colors[i]);
+        }
+        all_triangles.push_back(triangles[i] + vertex_offset);
+        vertex_offset += vertices[i].GetLength();
+    }
+
+    if (all_vertices.empty()) {
+        return TriangleMesh(devices_[0]);
+    }
+    TriangleMesh mesh(core::Concatenate(all_vertices),
+                      core::Concatenate(all_triangles));
+    mesh.SetVertexNormals(core::Concatenate(all_normals));
+    if (all_colors.size() == all_vertices.size()) {
+        mesh.SetVertexColors(core::Concatenate(all_colors));
+    }
+    return mesh;
+}
+
+void MultiDeviceVoxelBlockGrid::AssertInitialized() const {
+    if (grids_.empty()) {
+        utility::LogError("MultiDeviceVoxelBlockGrid not initialized.");
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// A multi-device voxel block grid spreads one scene over several devices,
+/// e.g. all the GPUs of a node, with one VoxelBlockGrid per device. Space is
+/// partitioned into cubic regions of partition_resolution^3 blocks, and each
+/// region is owned by a device picked by hashing its coordinates, so that a
+/// moving sensor keeps all the devices busy. A device also stores a halo of
+/// one block around its regions, integrated like its own blocks, so that
+/// interpolation, normals and Marching Cubes at region borders see their
+/// neighbors. Frames are only integrated on the devices owning or haloing
+/// the blocks they touch, and the devices work concurrently. Results are
+/// composed on the first device.
+class MultiDeviceVoxelBlockGrid {
+public:
+    MultiDeviceVoxelBlockGrid() = default;
+
+    /// \brief Default Constructor.
+    /// block_count is the initial number of blocks of each device.
+    /// Example:
+    /// MultiDeviceVoxelBlockGrid({"tsdf", "weight", "color"},
+    ///                           {core::Float32, core::UInt16,
+    ///                            core::UInt16},
+    ///                           {{1}, {1}, {3}},
+    ///                           0.005,
+    ///                           16,
+    ///                           10000,
+    ///                           {core::Device("CUDA:0"),
+    ///                            core::Device("CUDA:1")},
+    ///                           8,
+    ///                           core::HashBackendType::Default);
+    MultiDeviceVoxelBlockGrid(
+            const std::vector<std::string> &attr_names,
+            const std::vector<core::Dtype> &attr_dtypes,
+            const std::vector<core::SizeVector> &attr_channels,
+            float voxel_size = 0.0058,
+            int64_t block_resolution = 16,
+            int64_t block_count = 10000,
+            const std::vector<core::Device> &devices = {core::Device("CPU:0")},
+            int64_t partition_resolution = 8,
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// Get the number of devices.
+    int64_t GetDeviceCount() const {
+        return static_cast<int64_t>(grids_.size());
+    }
+
+    /// Get the voxel block grid of a device, in the order of construction.
+    /// It holds the blocks owned by the device and their halo.
+    VoxelBlockGrid &GetGrid(int64_t index);
+
+    /// Get a (N,) Int64 tensor with the index of the device owning each of
+    /// the (N, 3) Int32 block coordinates, on the device of block_coords.
+    core::Tensor GetOwners(const core::Tensor &block_coords) const;
+
+    /// Specific operation for TSDF volumes.
+    /// Integrate an RGB-D frame using pinhole camera model. The blocks touched
+    /// by the frame are computed once on the first device and routed to the
+    /// devices owning them or their halo, which integrate the frame
+    /// concurrently.
+    void Integrate(const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 4.0);
+
+    /// Specific operation for TSDF volumes.
+    /// Similar to RGB-D integration, but only applied to depth.
+    void Integrate(const Image &depth,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 4.0);
+
+    /// Specific operation for TSDF volumes.
+    /// Perform volumetric ray casting in all the active blocks of every
+    /// device concurrently. Each pixel takes its values from the nearest
+    /// surface hit on any device. Results are on the first device.
+    /// Since the rays of a device skip the blocks stored elsewhere, a few
+    /// pixels grazing region borders may differ from a single grid.
+    /// Supported attributes: vertex, depth, color, normal.
+    TensorMap RayCast(const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      int width,
+                      int height,
+                      const std::vector<std::string> attrs = {"depth", "color"},
+                      float depth_scale = 1000.0f,
+                      float depth_min = 0.1f,
+                      float depth_max = 3.0f,
+                      float weight_threshold = 3.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Extract point cloud at isosurface points of all the devices, on the
+    /// first device. Points in the halo of a device are dropped.
+    PointCloud ExtractPointCloud(float weight_threshold = 3.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Extract mesh near iso-surfaces of all the devices with Marching Cubes,
+    /// on the first device. Triangles whose centroid falls in the halo of a
+    /// device are dropped, so that the parts meet without overlap.
+    TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f);
+
+private:
+    void AssertInitialized() const;
+
+    /// Returns a (N,) Bool mask of the (N, 3) Int32 block coordinates owned
+    /// by the device at index, or within one block of its regions.
+    core::Tensor GetRoutingMask(const core::Tensor &block_coords,
+                                int64_t index) const;
+
+    /// Returns a (N,) Bool mask of the (N, 3) Float32 points that fall in a
+    /// block owned by the device at index.
+    core::Tensor GetOwnedMask(const core::Tensor &points, int64_t index) const;
+
+    float voxel_size_ = -1;
+    int64_t block_resolution_ = -1;
+    int64_t partition_resolution_ = -1;
+
+    std::vector<core::Device> devices_;
+    std::vector<VoxelBlockGrid> grids_;
+};
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,301 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+MultiResolutionVoxelBlockGrid::MultiResolutionVoxelBlockGrid(
+        const std::vector<std::string> &attr_names,
+        const std::vector<core::Dtype> &attr_dtypes,
+        const std::vector<core::SizeVector> &attr_channels,
+        float voxel_size,
+        const std::vector<float> &level_depths,
+        int64_t block_resolution,
+        int64_t block_count,
+        const core::Device &device,
+        const core::HashBackendType &backend)
+    : voxel_size_(voxel_size),
+      block_resolution_(block_resolution),
+      level_depths_(level_depths) {
+    for (size_t i = 0; i < level_depths.size(); ++i) {
+        if (level_depths[i] <= 0 ||
+            (i > 0 && level_depths[i] <= level_depths[i - 1])) {
+            utility::LogError(
+                    "level depths must be positive and increasing, but got {} "
+                    "at level {}",
+                    level_depths[i], i);
+        }
+    }
+
+    // Voxel size and block resolution are checked by VoxelBlockGrid.
+    for (size_t l = 0; l <= level_depths.size(); ++l) {
+        levels_.emplace_back(attr_names, attr_dtypes, attr_channels,
+                             voxel_size * static_cast<float>(int64_t(1) << l),
+                             block_resolution, block_count, device, backend);
+    }
+}
+
+VoxelBlockGrid &MultiResolutionVoxelBlockGrid::GetLevel(int64_t level) {
+    AssertInitialized();
+    if (level < 0 || level >= GetLevelCount()) {
+        utility::LogError("level {} out of range [0, {}).", level,
+                          GetLevelCount());
+    }
+    return levels_[level];
+}
+
+float MultiResolutionVoxelBlockGrid::GetVoxelSize(int64_t level) const {
+    AssertInitialized();
+    if (level < 0 || level >= GetLevelCount()) {
+        utility::LogError("level {} out of range [0, {}).", level,
+                          GetLevelCount());
+    }
+    return voxel_size_ * static_cast<float>(int64_t(1) << level);
+}
+
+void MultiResolutionVoxelBlockGrid::Integrate(const Image &depth,
+                                              const core::Tensor &intrinsic,
+                                              const core::Tensor &extrinsic,
+                                              float depth_scale,
+                                              float depth_max,
+                                              float trunc_voxel_multiplier) {
+    Integrate(depth, Image(), intrinsic, extrinsic, depth_scale, depth_max,
+              trunc_voxel_multiplier);
+}
+
+void MultiResolutionVoxelBlockGrid::Integrate(const Image &depth,
+                                              const Image &color,
+                                              const core::Tensor &intrinsic,
+                                              const core::Tensor &extrinsic,
+                                              float depth_scale,
+                                              float depth_max,
+                                              float trunc_voxel_multiplier) {
+    AssertInitialized();
+    core::Tensor depth_tensor = depth.AsTensor();
+    core::Tensor depth_metric = depth_tensor.To(core::Float32) / depth_scale;
+
+    for (int64_t l = 0; l < GetLevelCount(); ++l) {
+        // Extend the band by one block of the next coarser level, so that the
+        // finer level covers the boundary.
+        float band_min = l == 0 ? 0.0f : level_depths_[l - 1];
+        float band_max = l + 1 == GetLevelCount()
+                                 ? depth_max
+                                 : level_depths_[l] + GetVoxelSize(l + 1) *
+                                                              block_resolution_;
+        if (band_min >= depth_max) {
+            break;
+        }
+
+        core::Tensor band_mask =
+                depth_metric.Ge(band_min).LogicalAnd(depth_metric.Lt(band_max));
+        Image band_depth(depth_tensor *
+                         band_mask.To(depth_tensor.GetDtype()));
+
+        core::Tensor block_coords = levels_[l].GetUniqueBlockCoordinates(
+                band_depth, intrinsic, extrinsic, depth_scale, depth_max,
+                trunc_voxel_multiplier);
+        if (block_coords.GetLength() == 0) {
+            continue;
+        }
+        levels_[l].Integrate(block_coords, band_depth, color, intrinsic,
+                             extrinsic, depth_scale, depth_max);
+    }
+}
+
+TensorMap MultiResolutionVoxelBlockGrid::RayCast(
+        const core::Tensor &intrinsic,
+        const core::Tensor &extrinsic,
+        int width,
+        int height,
+        const std::vector<std::string> attrs,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold) {
+    AssertInitialized();
+
+    static const std::unordered_map<std::string, int> kAttrChannelMap = {
+            {"vertex", 3}, {"normal", 3}, {"depth", 1}, {"color", 3}};
+
+    // Depth is always rendered to select the level of each pixel.
+    std::vector<std::string> level_attrs = {"depth"};
+    for (const auto &attr : attrs) {
+        if (kAttrChannelMap.count(attr) == 0) {
+            utility::LogError(
+                    "Unsupported attribute {} for multi-resolution ray "
+                    "casting.",
+                    attr);
+        }
+        if (attr != "depth") {
+            level_attrs.push_back(attr);
+        }
+    }
+
+    core::Device device = levels_[0].GetHashMap().GetDevice();
+    TensorMap renderings_map("depth");
+    for (const auto &attr : level_attrs) {
+        renderings_map[attr] = core::Tensor::Zeros(
+                {height, width, kAttrChannelMap.at(attr)}, core::Float32,
+                device);
+    }
+
+    for (int64_t l = 0; l < GetLevelCount(); ++l) {
+        core::HashMap hashmap = levels_[l].GetHashMap();
+        if (hashmap.Size() == 0) {
+            continue;
+        }
+        core::Tensor block_coords = hashmap.GetKeyTensor().IndexGet(
+                {hashmap.GetActiveIndices().To(core::Int64)});
+        TensorMap level_map = levels_[l].RayCast(
+                block_coords, intrinsic, extrinsic, width, height, level_attrs,
+                depth_scale, depth_min, depth_max, weight_threshold);
+
+        // Fill the pixels missed by all the finer levels.
+        core::Tensor fill_mask = renderings_map["depth"]
+                                         .Le(0)
+                                         .LogicalAnd(level_map["depth"].Gt(0))
+                                         .Reshape({height, width});
+        for (const auto &attr : level_attrs) {
+            renderings_map[attr].IndexSet(
+                    {fill_mask}, level_map[attr].IndexGet({fill_mask}));
+        }
+    }
+
+    return renderings_map;
+}
+
+core::Tensor MultiResolutionVoxelBlockGrid::GetOwnedMask(
+        const core::Tensor &points, int64_t level) {
+    core::Tensor owned_mask = core::Tensor::Ones(
+            {points.GetLength()}, core::Bool, points.GetDevice());
+    for (int64_t l = 0; l < level; ++l) {
+        core::HashMap hashmap = levels_[l].GetHashMap();
+        if (hashmap.Size() == 0) {
+            continue;
+        }
+        float block_size = GetVoxelSize(l) * block_resolution_;
+        core::Tensor keys =
+                (points / block_size).Floor().To(core::Int32).Contiguous();
+        core::Tensor buf_indices, masks;
+        hashmap.Find(keys, buf_indices, masks);
+        owned_mask = owned_mask.LogicalAnd(masks.LogicalNot());
+    }
+    return owned_mask;
+}
+
+PointCloud MultiResolutionVoxelBlockGrid::ExtractPointCloud(
+        float weight_threshold) {
+    AssertInitialized();
+    std::vector<core::Tensor> points, normals, colors;
+    for (int64_t l = 0; l < GetLevelCount(); ++l) {
+        if (levels_[l].GetHashMap().Size() == 0) {
+            continue;
+        }
+        PointCloud pcd = levels_[l].ExtractPointCloud(-1, weight_threshold);
+        core::Tensor mask = GetOwnedMask(pcd.GetPointPositions(), l);
+        points.push_back(pcd.GetPointPositions().IndexGet({mask}));
+        normals.push_back(pcd.GetPointNormals().IndexGet({mask}));
+        if (pcd.HasPointColors()) {
+            colors.push_back(pcd.GetPointColors().IndexGet({mask}));
+        }
+    }
+
+    core::Device device = levels_[0].GetHashMap().GetDevice();
+    if (points.empty()) {
+        return PointCloud(device);
+    }
+    PointCloud pcd(core::Concatenate(points));
+    pcd.SetPointNormals(core::Concatenate(normals));
+    if (colors.size() == points.size()) {
+        pcd.SetPointColors(core::Concatenate(colors));
+    }
+    return pcd;
+}
+
+TriangleMesh MultiResolutionVoxelBlockGrid::ExtractTriangleMesh(
+        float weight_threshold) {
+    AssertInitialized();
+    std::vector<core::Tensor> vertices, normals, colors, triangles;
+    int64_t vertex_offset = 0;
+    for (int64_t l = 0; l < GetLevelCount(); ++l) {
+        if (levels_[l].GetHashMap().Size() == 0) {
+            continue;
+        }
+        TriangleMesh mesh =
+                levels_[l].ExtractTriangleMesh(-1, weight_threshold);
+        core::Tensor level_vertices = mesh.GetVertexPositions();
+        core::Tensor level_triangles = mesh.GetTriangleIndices();
+        if (level_triangles.GetLength() == 0) {
+            continue;
+        }
+
+        core::Tensor corners = level_triangles.To(core::Int64).T();
+        core::Tensor centroids = level_vertices.IndexGet({corners[0]});
+        for (int64_t k = 1; k < 3; ++k) {
+            centroids += level_vertices.IndexGet({corners[k]});
+        }
+        centroids /= 3.0f;
+
+        // Vertices only referenced by dropped triangles are kept.
+        core::Tensor mask = GetOwnedMask(centroids, l);
+        vertices.push_back(level_vertices);
+        normals.push_back(mesh.GetVertexNormals());
+        if (mesh.HasVertexColors()) {
+            colors.push_back(mesh.GetVertexColors());
+        }
+        triangles.push_back(level_triangles.IndexGet({mask}) + vertex_offset);
+        vertex_offset += level_vertices.GetLength();
+    }
+
+    core::Device device = levels_[0].GetHashMap().GetDevice();
+    if (vertices.empty()) {
+        return TriangleMesh(device);
+    }
+    TriangleMesh mesh(core::Concatenate(vertices),
+                      core::Concatenate(triangles));
+    mesh.SetVertexNormals(core::Concatenate(normals));
+    if (colors.size() == vertices.size()) {
+        mesh.SetVertexColors(core::Concatenate(colors));
+    }
+    return mesh;
+}
+
+void MultiResolutionVoxelBlockGrid::AssertInitialized() const {
+    if (levels_.empty()) {
+        utility::LogError("MultiResolutionVoxelBlockGrid not initialized.");
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,157 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// A multi-resolution voxel block grid is a stack of VoxelBlockGrid levels
+/// sharing the same attributes and block resolution, where level l has a voxel
+/// size of voxel_size * 2^l. Each observation is integrated into the level
+/// whose depth band contains it, so that far-away regions are stored with
+/// coarse blocks, each covering 8x the volume of a block one level finer.
+/// Neighboring levels overlap by one coarse block across their band boundary;
+/// ray casting and surface extraction stitch the levels by letting the finest
+/// level own the space covered by its blocks.
+class MultiResolutionVoxelBlockGrid {
+public:
+    MultiResolutionVoxelBlockGrid() = default;
+
+    /// \brief Default Constructor.
+    /// level_depths are the increasing depths (in meters) at which
+    /// observations switch to the next coarser level, so that there are
+    /// level_depths.size() + 1 levels.
+    /// Example:
+    /// MultiResolutionVoxelBlockGrid({"tsdf", "weight", "color"},
+    ///                               {core::Float32, core::UInt16,
+    ///                                core::UInt16},
+    ///                               {{1}, {1}, {3}},
+    ///                               0.005,
+    ///                               {2.0, 4.0},
+    ///                               16,
+    ///                               10000,
+    ///                               core::Device("CUDA:0"),
+    ///                               core::HashBackendType::Default);
+    MultiResolutionVoxelBlockGrid(
+            const std::vector<std::string> &attr_names,
+            const std::vector<core::Dtype> &attr_dtypes,
+            const std::vector<core::SizeVector> &attr_channels,
+            float voxel_size = 0.0058,
+            const std::vector<float> &level_depths = {2.0f},
+            int64_t block_resolution = 16,
+            int64_t block_count = 10000,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashBackendType &backend =
+                    core::HashBackendType::Default);
+
+    /// Get the number of levels.
+    int64_t GetLevelCount() const {
+        return static_cast<int64_t>(levels_.size());
+    }
+
+    /// Get the voxel block grid of a level, level 0 being the finest.
+    VoxelBlockGrid &GetLevel(int64_t level);
+
+    /// Get the voxel size of a level.
+    float GetVoxelSize(int64_t level) const;
+
+    /// Specific operation for TSDF volumes.
+    /// Integrate an RGB-D frame using pinhole camera model. The depth image is
+    /// split by level_depths, each band being extended by one block of the
+    /// next coarser level, and integrated into the blocks it touches in the
+    /// corresponding level.
+    void Integrate(const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 4.0);
+
+    /// Specific operation for TSDF volumes.
+    /// Similar to RGB-D integration, but only applied to depth.
+    void Integrate(const Image &depth,
+                   const core::Tensor &intrinsic,
+                   const core::Tensor &extrinsic,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 4.0);
+
+    /// Specific operation for TSDF volumes.
+    /// Perform volumetric ray casting in all the active blocks of every level.
+    /// Each pixel takes its values from the finest level the ray hits.
+    /// Supported attributes: vertex, depth, color, normal.
+    TensorMap RayCast(const core::Tensor &intrinsic,
+                      const core::Tensor &extrinsic,
+                      int width,
+                      int height,
+                      const std::vector<std::string> attrs = {"depth", "color"},
+                      float depth_scale = 1000.0f,
+                      float depth_min = 0.1f,
+                      float depth_max = 3.0f,
+                      float weight_threshold = 3.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Extract point cloud at isosurface points of all the levels. Points of a
+    /// level that fall in an active block of a finer level are dropped.
+    PointCloud ExtractPointCloud(float weight_threshold = 3.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Extract mesh near iso-surfaces of all the levels with Marching Cubes.
+    /// Triangles of a level whose centroid falls in an active block of a finer
+    /// level are dropped. Cracks between levels are not filled.
+    TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f);
+
+private:
+    void AssertInitialized() const;
+
+    /// Returns a (N,) Bool mask of the (N, 3) Float32 points that do not fall
+    /// in any active block of the levels finer than level.
+    core::Tensor GetOwnedMask(const core::Tensor &points, int64_t level);
+
+    float voxel_size_ = -1;
+    int64_t block_resolution_ = -1;
+
+    // Depths separating the observation bands of consecutive levels.
+    std::vector<float> level_depths_;
+
+    // Levels from the finest to the coarsest.
+    std::vector<VoxelBlockGrid> levels_;
+};
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
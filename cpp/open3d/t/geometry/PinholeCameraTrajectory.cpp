@@ -0,0 +1,289 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PinholeCameraTrajectory.h"
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/linalg/Matmul.h"
+#include "open3d/t/geometry/Utility.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+PinholeCameraTrajectory::PinholeCameraTrajectory(
+        const core::Tensor &intrinsic,
+        int width,
+        int height,
+        const core::Tensor &extrinsics)
+    : width_(width), height_(height) {
+    if (width <= 0 || height <= 0) {
+        utility::LogError("Invalid image size {}x{}.", width, height);
+    }
+    intrinsic_ = intrinsic.To(core::Device("CPU:0"), core::Float64)
+                         .Contiguous();
+    CheckIntrinsicTensor(intrinsic_);
+    core::AssertTensorShape(extrinsics, {utility::nullopt, 4, 4});
+    extrinsics_ = extrinsics.To(core::Float64).Contiguous();
+}
+
+core::Tensor PinholeCameraTrajectory::GetExtrinsic(int64_t index) const {
+    if (index < 0 || index >= GetLength()) {
+        utility::LogError("Frame index {} out of range [0, {}).", index,
+                          GetLength());
+    }
+    return extrinsics_[index].Contiguous();
+}
+
+core::Tensor PinholeCameraTrajectory::GetPoses() const {
+    // [R t; 0 1]^-1 = [R^T -R^T t; 0 1].
+    const int64_t n = GetLength();
+    const core::Tensor rotations_t =
+            extrinsics_.Slice(1, 0, 3).Slice(2, 0, 3).Transpose(1, 2);
+    core::Tensor centers;
+    core::BatchedMatmul(rotations_t, extrinsics_.Slice(1, 0, 3).Slice(2, 3, 4),
+                        centers);
+    core::Tensor poses =
+            core::Tensor::Zeros({n, 4, 4}, core::Float64, GetDevice());
+    poses.Slice(1, 0, 3).Slice(2, 0, 3).AsRvalue() = rotations_t;
+    poses.Slice(1, 0, 3).Slice(2, 3, 4).AsRvalue() = centers.Neg();
+    poses.Slice(1, 3, 4).Slice(2, 3, 4).Fill(1.0);
+    return poses;
+}
+
+PinholeCameraTrajectory PinholeCameraTrajectory::To(const core::Device &device,
+                                                    bool copy) const {
+    return PinholeCameraTrajectory(intrinsic_, width_, height_,
+                                   extrinsics_.To(device, copy));
+}
+
+PinholeCameraTrajectory PinholeCameraTrajectory::Compose(
+        const core::Tensor &transformations) const {
+    core::AssertTensorDevice(transformations, GetDevice());
+    if (transformations.NumDims() == 2) {
+        core::AssertTensorShape(transformations, {4, 4});
+    } else {
+        core::AssertTensorShape(transformations, {GetLength(), 4, 4});
+    }
+    core::Tensor extrinsics;
+    core::BatchedMatmul(transformations.To(core::Float64), extrinsics_,
+                        extrinsics);
+    return PinholeCameraTrajectory(intrinsic_, width_, height_, extrinsics);
+}
+
+PinholeCameraTrajectory PinholeCameraTrajectory::Interpolate(
+        const core::Tensor &times) const {
+    core::AssertTensorShape(times, {utility::nullopt});
+    const int64_t n = GetLength();
+    if (n == 0) {
+        utility::LogError("Cannot interpolate an empty trajectory.");
+    }
+    const core::Device host("CPU:0");
+    const core::Tensor extrinsics = extrinsics_.To(host).Contiguous();
+    const core::Tensor times_host =
+            times.To(host, core::Float64).Contiguous();
+    const int64_t m = times_host.GetLength();
+    core::Tensor result = core::Tensor::Empty({m, 4, 4}, core::Float64, host);
+
+    typedef Eigen::Matrix<double, 4, 4, Eigen::RowMajor> Matrix4dRowMajor;
+    const double *src = extrinsics.GetDataPtr<double>();
+    const double *times_ptr = times_host.GetDataPtr<double>();
+    double *dst = result.GetDataPtr<double>();
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < m; ++k) {
+        const double time =
+                std::min(std::max(times_ptr[k], 0.0), double(n - 1));
+        const int64_t i = std::min(int64_t(std::floor(time)),
+                                   std::max(n - 2, int64_t(0)));
+        const int64_t j = std::min(i + 1, n - 1);
+        const double w = time - double(i);
+
+        const Eigen::Map<const Matrix4dRowMajor> e0(src + 16 * i);
+        const Eigen::Map<const Matrix4dRowMajor> e1(src + 16 * j);
+        const Eigen::Quaterniond q0(Eigen::Matrix3d(e0.block<3, 3>(0, 0)));
+        const Eigen::Quaterniond q1(Eigen::Matrix3d(e1.block<3, 3>(0, 0)));
+        const Eigen::Matrix3d rotation = q0.slerp(w, q1).toRotationMatrix();
+        const Eigen::Vector3d c0 =
+                -e0.block<3, 3>(0, 0).transpose() * e0.block<3, 1>(0, 3);
+        const Eigen::Vector3d c1 =
+                -e1.block<3, 3>(0, 0).transpose() * e1.block<3, 1>(0, 3);
+
+        Eigen::Map<Matrix4dRowMajor> e(dst + 16 * k);
+        e.setIdentity();
+        e.block<3, 3>(0, 0) = rotation;
+        e.block<3, 1>(0, 3) = -rotation * ((1 - w) * c0 + w * c1);
+    }
+    return PinholeCameraTrajectory(intrinsic_, width_, height_,
+                                   result.To(GetDevice()));
+}
+
+core::Tensor PinholeCameraTrajectory::ComputeVisibleBlocks(
+        const core::Tensor &block_coords,
+        double block_size,
+        double depth_min,
+        double depth_max) const {
+    core::AssertTensorShape(block_coords, {utility::nullopt, 3});
+    core::AssertTensorDevice(block_coords, GetDevice());
+    if (block_size <= 0) {
+        utility::LogError("block_size must be positive, but got {}.",
+                          block_size);
+    }
+    const int64_t n = GetLength();
+    const int64_t m = block_coords.GetLength();
+    core::Tensor visible =
+            core::Tensor::Zeros({n, m}, core::Bool, GetDevice());
+    if (n == 0 || m == 0) {
+        return visible;
+    }
+
+    const double *k = intrinsic_.GetDataPtr<double>();
+    const double fx = k[0], fy = k[4], cx = k[2], cy = k[5];
+    const double radius = 0.5 * std::sqrt(3.0) * block_size;
+    const core::Tensor centers =
+            (block_coords.To(core::Float64) + 0.5) * block_size;
+
+    // The side planes of the frustum go through the camera center, with
+    // inward normals n. A sphere is outside if n.x < -radius |n|.
+    auto keep = [radius](const core::Tensor &mask, const core::Tensor &x,
+                         const core::Tensor &z, double a, double b) {
+        return mask.LogicalAnd(
+                (x * a + z * b).Ge(-radius * std::sqrt(a * a + b * b)));
+    };
+
+    // The frames are processed in chunks to bound the (M, chunk, 3) camera
+    // coordinates.
+    const int64_t chunk = std::max(int64_t(1), int64_t(1 << 22) / m);
+    for (int64_t begin = 0; begin < n; begin += chunk) {
+        const int64_t end = std::min(begin + chunk, n);
+        const int64_t count = end - begin;
+        const core::Tensor extrinsics = extrinsics_.Slice(0, begin, end);
+        // Stacking the rotations as a (3 * count, 3) matrix transforms the
+        // centers by all the frames with a single matmul.
+        const core::Tensor rotations =
+                extrinsics.Slice(1, 0, 3).Slice(2, 0, 3).Contiguous().Reshape(
+                        {3 * count, 3});
+        const core::Tensor translations =
+                extrinsics.Slice(1, 0, 3).Slice(2, 3, 4).Contiguous().Reshape(
+                        {1, count, 3});
+        const core::Tensor points =
+                centers.Matmul(rotations.T()).Reshape({m, count, 3}) +
+                translations;
+        const core::Tensor x = points.Slice(2, 0, 1);
+        const core::Tensor y = points.Slice(2, 1, 2);
+        const core::Tensor z = points.Slice(2, 2, 3);
+
+        core::Tensor mask = (z + radius)
+                                    .Ge(depth_min)
+                                    .LogicalAnd((z - radius).Le(depth_max));
+        mask = keep(mask, x, z, fx, cx);
+        mask = keep(mask, x, z, -fx, width_ - cx);
+        mask = keep(mask, y, z, fy, cy);
+        mask = keep(mask, y, z, -fy, height_ - cy);
+        visible.Slice(0, begin, end).AsRvalue() =
+                mask.Reshape({m, count}).T();
+    }
+    return visible;
+}
+
+core::Tensor PinholeCameraTrajectory::SelectFrames(
+        VoxelBlockGrid &voxel_grid,
+        double depth_min,
+        double depth_max,
+        int64_t min_visible_blocks) const {
+    core::HashMap hashmap = voxel_grid.GetHashMap();
+    const core::Tensor block_coords = hashmap.GetKeyTensor().IndexGet(
+            {hashmap.GetActiveIndices().To(core::Int64)});
+    const core::Tensor visible = ComputeVisibleBlocks(
+            block_coords.To(GetDevice()),
+            voxel_grid.GetVoxelSize() * voxel_grid.GetBlockResolution(),
+            depth_min, depth_max);
+    return visible.To(core::Int64)
+            .Sum({1})
+            .Ge(min_visible_blocks)
+            .NonZero()
+            .Reshape({-1});
+}
+
+camera::PinholeCameraTrajectory PinholeCameraTrajectory::ToLegacy() const {
+    camera::PinholeCameraTrajectory trajectory;
+    camera::PinholeCameraIntrinsic intrinsic;
+    intrinsic.width_ = width_;
+    intrinsic.height_ = height_;
+    intrinsic.intrinsic_matrix_ =
+            core::eigen_converter::TensorToEigenMatrixXd(intrinsic_);
+    const core::Tensor extrinsics =
+            extrinsics_.To(core::Device("CPU:0")).Contiguous();
+    trajectory.parameters_.resize(GetLength());
+    for (int64_t i = 0; i < GetLength(); ++i) {
+        trajectory.parameters_[i].intrinsic_ = intrinsic;
+        trajectory.parameters_[i].extrinsic_ =
+                core::eigen_converter::TensorToEigenMatrixXd(extrinsics[i]);
+    }
+    return trajectory;
+}
+
+PinholeCameraTrajectory PinholeCameraTrajectory::FromLegacy(
+        const camera::PinholeCameraTrajectory &trajectory,
+        const core::Device &device) {
+    const std::vector<camera::PinholeCameraParameters> &parameters =
+            trajectory.parameters_;
+    if (parameters.empty()) {
+        utility::LogError("Input trajectory is empty.");
+    }
+    const camera::PinholeCameraIntrinsic &intrinsic = parameters[0].intrinsic_;
+    const int64_t n = int64_t(parameters.size());
+    core::Tensor extrinsics = core::Tensor::Empty({n, 4, 4}, core::Float64);
+    for (int64_t i = 0; i < n; ++i) {
+        const camera::PinholeCameraIntrinsic &other = parameters[i].intrinsic_;
+        if (other.width_ != intrinsic.width_ ||
+            other.height_ != intrinsic.height_ ||
+            other.intrinsic_matrix_ != intrinsic.intrinsic_matrix_) {
+            utility::LogError(
+                    "Frame {} has different intrinsics than frame 0, but the "
+                    "frames must share them.",
+                    i);
+        }
+        extrinsics[i] =
+                core::eigen_converter::EigenMatrixToTensor(Eigen::Matrix4d(
+                        parameters[i].extrinsic_));
+    }
+    return PinholeCameraTrajectory(
+            core::eigen_converter::EigenMatrixToTensor(
+                    intrinsic.intrinsic_matrix_),
+            intrinsic.width_, intrinsic.height_, extrinsics.To(device));
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
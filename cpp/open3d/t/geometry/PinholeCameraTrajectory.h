@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// A camera trajectory stored as tensors, the tensor counterpart of
+/// open3d::camera::PinholeCameraTrajectory for cameras sharing their
+/// intrinsics, e.g. the frames of one RGB-D sequence. The world to camera
+/// extrinsics are a single (N, 4, 4) Float64 tensor on the device of the
+/// trajectory, so that composition and frustum culling run as batched tensor
+/// operations, and a frame's extrinsic can be passed to
+/// VoxelBlockGrid::Integrate as is.
+class PinholeCameraTrajectory {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param intrinsic Float64 tensor of shape (3, 3), shared by all the
+    /// frames. Kept on the CPU, like the intrinsics of VoxelBlockGrid.
+    /// \param width Width of the images in pixels.
+    /// \param height Height of the images in pixels.
+    /// \param extrinsics Tensor of shape (N, 4, 4) with the world to camera
+    /// transformation of every frame. Converted to Float64, the trajectory
+    /// lives on its device.
+    PinholeCameraTrajectory(const core::Tensor &intrinsic,
+                            int width,
+                            int height,
+                            const core::Tensor &extrinsics);
+
+    /// \brief Number of frames.
+    int64_t GetLength() const { return extrinsics_.GetLength(); }
+
+    bool IsEmpty() const { return GetLength() == 0; }
+
+    core::Device GetDevice() const { return extrinsics_.GetDevice(); }
+
+    const core::Tensor &GetIntrinsic() const { return intrinsic_; }
+
+    int GetWidth() const { return width_; }
+
+    int GetHeight() const { return height_; }
+
+    /// \brief Float64 world to camera transformations of shape (N, 4, 4).
+    const core::Tensor &GetExtrinsics() const { return extrinsics_; }
+
+    /// \brief Float64 world to camera transformation of shape (4, 4) of frame
+    /// \p index.
+    core::Tensor GetExtrinsic(int64_t index) const;
+
+    /// \brief Float64 camera to world transformations of shape (N, 4, 4),
+    /// computed as batched rigid inverses of the extrinsics.
+    core::Tensor GetPoses() const;
+
+    /// \brief Returns the trajectory on \p device.
+    PinholeCameraTrajectory To(const core::Device &device,
+                               bool copy = false) const;
+
+    /// \brief Returns a trajectory whose extrinsics are \p transformations
+    /// times the extrinsics, e.g. to apply a camera to sensor calibration.
+    ///
+    /// \param transformations Tensor of shape (4, 4), applied to every frame,
+    /// or (N, 4, 4), one per frame.
+    PinholeCameraTrajectory Compose(const core::Tensor &transformations) const;
+
+    /// \brief Returns the trajectory sampled at \p times, e.g. to resample
+    /// poses estimated at key frames to every frame.
+    ///
+    /// Rotations are interpolated with quaternion slerp and camera centers
+    /// linearly, between the two frames around every time. The poses are
+    /// interpolated on the CPU and moved to the device of the trajectory.
+    ///
+    /// \param times Tensor of shape (M,) of fractional frame indices, clamped
+    /// to [0, N - 1].
+    PinholeCameraTrajectory Interpolate(const core::Tensor &times) const;
+
+    /// \brief Returns a Bool tensor of shape (N, M) telling which of the
+    /// blocks at \p block_coords every frame may see.
+    ///
+    /// A block is visible if its bounding sphere intersects the view frustum
+    /// of the frame between \p depth_min and \p depth_max. The test is
+    /// conservative, so blocks around the frustum corners may be kept.
+    ///
+    /// \param block_coords Int32 or Int64 tensor of shape (M, 3) with block
+    /// coordinates, as keys of VoxelBlockGrid.
+    /// \param block_size Edge length of the blocks, i.e. the voxel size times
+    /// the block resolution.
+    core::Tensor ComputeVisibleBlocks(const core::Tensor &block_coords,
+                                      double block_size,
+                                      double depth_min = 0.1,
+                                      double depth_max = 3.0) const;
+
+    /// \brief Returns the Int64 indices of the frames that may see at least
+    /// \p min_visible_blocks active blocks of \p voxel_grid, e.g. to schedule
+    /// the frames to integrate or texture into a known region.
+    core::Tensor SelectFrames(VoxelBlockGrid &voxel_grid,
+                              double depth_min = 0.1,
+                              double depth_max = 3.0,
+                              int64_t min_visible_blocks = 1) const;
+
+    /// \brief Convert to a legacy camera trajectory.
+    camera::PinholeCameraTrajectory ToLegacy() const;
+
+    /// \brief Create a trajectory from a legacy camera trajectory, whose
+    /// frames must share the same intrinsics.
+    static PinholeCameraTrajectory FromLegacy(
+            const camera::PinholeCameraTrajectory &trajectory,
+            const core::Device &device = core::Device("CPU:0"));
+
+private:
+    core::Tensor intrinsic_;
+    int width_;
+    int height_;
+    core::Tensor extrinsics_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
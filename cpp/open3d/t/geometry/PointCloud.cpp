@@ -27,7 +27,11 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <numeric>
+#include <random>
 #include <string>
 #include <unordered_map>
 
@@ -38,6 +42,7 @@
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/hashmap/HashSet.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
@@ -152,7 +157,7 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
                     core::TensorKey::Slice(length, combined_length, 1),
                     other_attr);
 
-            pcd.SetPointAttr(kv.first, combined_attr.Clone());
+            pcd.SetPointAttr(kv.first, combined_attr);
         } else {
             utility::LogError(
                     "The pointcloud is missing attribute {}. The pointcloud "
@@ -164,6 +169,32 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
     return pcd;
 }
 
+// Returns R C R^T for every {3, 3} matrix C of \p covariances.
+static core::Tensor RotateCovariances(const core::Tensor &R,
+                                      const core::Tensor &covariances) {
+    const int64_t n = covariances.GetLength();
+    if (n == 0) {
+        return covariances;
+    }
+    const core::Tensor R_t =
+            R.To(covariances.GetDevice(), covariances.GetDtype())
+                    .T()
+                    .Contiguous();
+
+    // C R^T, then R (C R^T) = ((C R^T)^T R^T)^T.
+    core::Tensor C_Rt = covariances.Contiguous()
+                                .Reshape({n * 3, 3})
+                                .Matmul(R_t)
+                                .Reshape({n, 3, 3});
+    return C_Rt.Transpose(1, 2)
+            .Contiguous()
+            .Reshape({n * 3, 3})
+            .Matmul(R_t)
+            .Reshape({n, 3, 3})
+            .Transpose(1, 2)
+            .Contiguous();
+}
+
 PointCloud &PointCloud::Transform(const core::Tensor &transformation) {
     core::AssertTensorShape(transformation, {4, 4});
 
@@ -171,6 +202,11 @@ PointCloud &PointCloud::Transform(const core::Tensor &transformation) {
     if (HasPointNormals()) {
         kernel::transform::TransformNormals(transformation, GetPointNormals());
     }
+    if (HasPointAttr("covariances")) {
+        const core::Tensor R = transformation.Slice(0, 0, 3).Slice(1, 0, 3);
+        SetPointAttr("covariances",
+                     RotateCovariances(R, GetPointAttr("covariances")));
+    }
 
     return *this;
 }
@@ -209,6 +245,10 @@ PointCloud &PointCloud::Rotate(const core::Tensor &R,
     if (HasPointNormals()) {
         kernel::transform::RotateNormals(R, GetPointNormals());
     }
+    if (HasPointAttr("covariances")) {
+        SetPointAttr("covariances",
+                     RotateCovariances(R, GetPointAttr("covariances")));
+    }
     return *this;
 }
 
@@ -226,23 +266,251 @@ PointCloud PointCloud::VoxelDownSample(
     core::Tensor buf_indices, masks;
     points_voxeli_hashset.Insert(points_voxeli, buf_indices, masks);
 
+    // The voxel coordinates replace the positions, so that all attributes
+    // are gathered with a single kernel launch.
+    TensorMap point_attr(point_attr_);
+    point_attr["positions"] = points_voxeli;
     PointCloud pcd_down(GetPointPositions().GetDevice());
-    for (auto &kv : point_attr_) {
+    for (auto &kv : point_attr.IndexGet(masks)) {
         if (kv.first == "positions") {
-            pcd_down.SetPointAttr(kv.first,
-                                  points_voxeli.IndexGet({masks}).To(
-                                          GetPointPositions().GetDtype()) *
-                                          voxel_size);
+            pcd_down.SetPointAttr(
+                    kv.first,
+                    kv.second.To(GetPointPositions().GetDtype()) * voxel_size);
         } else {
-            pcd_down.SetPointAttr(kv.first, kv.second.IndexGet({masks}));
+            pcd_down.SetPointAttr(kv.first, kv.second);
         }
     }
 
     return pcd_down;
 }
 
-void PointCloud::EstimateNormals(
-        const int max_knn /* = 30*/,
+/// Gathers all point attributes of \p pcd with \p index, which is either a
+/// boolean mask of shape {N,} or an Int64 index tensor. All attributes are
+/// gathered with a single kernel launch.
+static PointCloud IndexPoints(const PointCloud &pcd,
+                              const core::Tensor &index) {
+    PointCloud pcd_selected(pcd.GetDevice());
+    for (auto &kv : pcd.GetPointAttr().IndexGet(index)) {
+        pcd_selected.SetPointAttr(kv.first, kv.second);
+    }
+    return pcd_selected;
+}
+
+PointCloud PointCloud::UniformDownSample(int64_t every_k_points) const {
+    if (every_k_points <= 0) {
+        utility::LogError("every_k_points must be positive.");
+    }
+    const int64_t num_points = GetPointPositions().GetLength();
+    core::Tensor indices = core::Tensor::Arange(0, num_points, every_k_points,
+                                                core::Int64, device_);
+    return IndexPoints(*this, indices);
+}
+
+PointCloud PointCloud::RandomDownSample(double sampling_ratio) const {
+    if (sampling_ratio < 0 || sampling_ratio > 1) {
+        utility::LogError("sampling_ratio must be in [0, 1], but got {}.",
+                          sampling_ratio);
+    }
+    const int64_t num_points = GetPointPositions().GetLength();
+    const int64_t num_samples =
+            static_cast<int64_t>(sampling_ratio * num_points);
+
+    // Only the index permutation is drawn on the host, the attributes are
+    // gathered on the point cloud's device.
+    std::vector<int64_t> indices(num_points);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::mt19937 rng{std::random_device{}()};
+    std::shuffle(indices.begin(), indices.end(), rng);
+    indices.resize(num_samples);
+    std::sort(indices.begin(), indices.end());
+
+    return IndexPoints(*this, core::Tensor(indices, {num_samples},
+                                           core::Int64, device_));
+}
+
+PointCloud PointCloud::FarthestPointDownSample(int64_t num_samples) const {
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_samples < 0 || num_samples > num_points) {
+        utility::LogError("num_samples must be in [0, {}], but got {}.",
+                          num_points, num_samples);
+    }
+    if (num_samples == 0) {
+        return IndexPoints(*this, core::Tensor::Empty({0}, core::Int64,
+                                                      device_));
+    }
+
+    const core::Tensor &positions = GetPointPositions();
+    if (device_.GetType() == core::Device::DeviceType::CPU) {
+        core::Tensor indices =
+                core::Tensor::Empty({num_samples}, core::Int64, device_);
+        kernel::pointcloud::FarthestPointSampleCPU(positions.Contiguous(),
+                                                   indices);
+        return IndexPoints(*this, indices);
+    }
+
+    core::Tensor min_distances = core::Tensor::Full(
+            {num_points}, std::numeric_limits<double>::infinity(),
+            positions.GetDtype(), device_);
+
+    std::vector<int64_t> indices(num_samples);
+    int64_t farthest = 0;
+    for (int64_t i = 0; i < num_samples; ++i) {
+        indices[i] = farthest;
+        core::Tensor diff = positions - positions[farthest];
+        core::Tensor distances = (diff * diff).Sum({1});
+        core::Tensor closer = distances.Lt(min_distances);
+        min_distances.IndexSet({closer}, distances.IndexGet({closer}));
+        farthest = min_distances.ArgMax({0}).Item<int64_t>();
+    }
+
+    return IndexPoints(*this, core::Tensor(indices, {num_samples},
+                                           core::Int64, device_));
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
+        int64_t nb_points, double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "Illegal input parameters, nb_points must be positive and "
+                "search_radius must be positive.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    if (GetPointPositions().GetLength() == 0) {
+        return std::make_tuple(
+                Clone(), core::Tensor::Empty({0}, core::Bool, device_));
+    }
+
+    const core::Tensor positions = GetPointPositions().Contiguous();
+    core::nns::NearestNeighborSearch tree(positions);
+    if (!tree.HybridIndex(search_radius)) {
+        utility::LogError("Building HybridIndex failed.");
+    }
+    core::Tensor indices, distances, counts;
+    std::tie(indices, distances, counts) = tree.HybridSearch(
+            positions, search_radius, static_cast<int>(nb_points));
+
+    core::Tensor mask = counts.Ge(nb_points);
+    return std::make_tuple(IndexPoints(*this, mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
+        int64_t nb_neighbors, double std_ratio) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "Illegal input parameters, nb_neighbors and std_ratio must be "
+                "positive.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_points == 0) {
+        return std::make_tuple(
+                Clone(), core::Tensor::Empty({0}, core::Bool, device_));
+    }
+
+    const core::Tensor positions = GetPointPositions().Contiguous();
+    core::nns::NearestNeighborSearch tree(positions);
+    if (!tree.KnnIndex()) {
+        utility::LogError("Building KnnIndex failed.");
+    }
+    const int knn = static_cast<int>(std::min(nb_neighbors, num_points));
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = tree.KnnSearch(positions, knn);
+
+    core::Tensor avg_distances =
+            distances.Sqrt().Mean({1}).To(core::Float64);
+    const double mean = avg_distances.Mean({0}).Item<double>();
+    core::Tensor deviations = avg_distances - mean;
+    const double sq_sum = (deviations * deviations).Sum({0}).Item<double>();
+    const double std_dev =
+            num_points > 1 ? std::sqrt(sq_sum / (num_points - 1)) : 0;
+    const double distance_threshold = mean + std_ratio * std_dev;
+
+    core::Tensor mask = avg_distances.Le(distance_threshold);
+    return std::make_tuple(IndexPoints(*this, mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::SortBySpatialLocality(
+        SpatialSortMethod method) const {
+    if (IsEmpty()) {
+        return std::make_tuple(
+                Clone(), core::Tensor::Empty({0}, core::Int64, device_));
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    const int64_t num_points = GetPointPositions().GetLength();
+
+    const core::Tensor positions = GetPointPositions().Contiguous();
+    const core::Device host("CPU:0");
+    const core::Tensor min_bound = positions.Min({0}).To(host, core::Float64);
+    const core::Tensor max_bound = positions.Max({0}).To(host, core::Float64);
+    const double extent = (max_bound - min_bound).Max({0}).Item<double>();
+    const double cell_size = extent > 0 ? extent / ((1 << 21) - 1) : 1.0;
+    const bool hilbert = method == SpatialSortMethod::Hilbert;
+
+    core::Tensor codes =
+            core::Tensor::Empty({num_points}, core::Int64, device_);
+    if (device_.GetType() == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::ComputeSpatialCodesCPU(positions, min_bound,
+                                                   cell_size, hilbert, codes);
+    } else if (device_.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::ComputeSpatialCodesCUDA, positions,
+                  min_bound, cell_size, hilbert, codes);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    const core::Tensor perm = codes.Argsort();
+    return std::make_tuple(IndexPoints(*this, perm), perm);
+}
+
+core::Tensor PointCloud::ComputeVisibility(const core::Tensor &viewpoints,
+                                           double point_radius,
+                                           int64_t width,
+                                           double depth_tolerance) const {
+    if (point_radius <= 0) {
+        utility::LogError("point_radius must be positive, but got {}.",
+                          point_radius);
+    }
+    if (width < 2 || width % 2 != 0) {
+        utility::LogError("width must be a positive even number, but got {}.",
+                          width);
+    }
+    if (depth_tolerance < 0) {
+        utility::LogError("depth_tolerance must be non-negative, but got {}.",
+                          depth_tolerance);
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    core::AssertTensorShape(viewpoints, {utility::nullopt, 3});
+    core::AssertTensorDevice(viewpoints, device_);
+
+    const core::Tensor positions = GetPointPositions().Contiguous();
+    core::Tensor visible =
+            core::Tensor::Empty({viewpoints.GetLength(), positions.GetLength()},
+                                core::Bool, device_);
+    if (visible.NumElements() == 0) {
+        return visible;
+    }
+    const core::Tensor viewpoints_contiguous =
+            viewpoints.To(positions.GetDtype()).Contiguous();
+    if (device_.GetType() == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::ComputeVisibilityCPU(
+                positions, viewpoints_contiguous, point_radius, width,
+                depth_tolerance, visible);
+    } else if (device_.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::ComputeVisibilityCUDA, positions,
+                  viewpoints_contiguous, point_radius, width, depth_tolerance,
+                  visible);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    return visible;
+}
+
+void PointCloud::EstimateCovariances(
+        const int max_knn /* = 20*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
     core::AssertTensorDtypes(this->GetPointPositions(),
                              {core::Float32, core::Float64});
@@ -250,16 +518,6 @@ void PointCloud::EstimateNormals(
     const core::Dtype dtype = this->GetPointPositions().GetDtype();
     const core::Device device = GetDevice();
     const core::Device::DeviceType device_type = device.GetType();
-    const bool has_normals = HasPointNormals();
-
-    if (!has_normals) {
-        this->SetPointNormals(core::Tensor::Empty(
-                {GetPointPositions().GetLength(), 3}, dtype, device));
-    } else {
-        core::AssertTensorDtype(this->GetPointNormals(), dtype);
-
-        this->SetPointNormals(GetPointNormals().Contiguous());
-    }
 
     this->SetPointAttr(
             "covariances",
@@ -298,6 +556,29 @@ void PointCloud::EstimateNormals(
             utility::LogError("Unimplemented device");
         }
     }
+}
+
+void PointCloud::EstimateNormals(
+        const int max_knn /* = 30*/,
+        const utility::optional<double> radius /*= utility::nullopt*/) {
+    core::AssertTensorDtypes(this->GetPointPositions(),
+                             {core::Float32, core::Float64});
+
+    const core::Dtype dtype = this->GetPointPositions().GetDtype();
+    const core::Device device = GetDevice();
+    const core::Device::DeviceType device_type = device.GetType();
+    const bool has_normals = HasPointNormals();
+
+    if (!has_normals) {
+        this->SetPointNormals(core::Tensor::Empty(
+                {GetPointPositions().GetLength(), 3}, dtype, device));
+    } else {
+        core::AssertTensorDtype(this->GetPointNormals(), dtype);
+
+        this->SetPointNormals(GetPointNormals().Contiguous());
+    }
+
+    EstimateCovariances(max_knn, radius);
 
     // Estimate `normal` of each point using its `covariance` matrix.
     if (device_type == core::Device::DeviceType::CPU) {
@@ -312,11 +593,62 @@ void PointCloud::EstimateNormals(
         utility::LogError("Unimplemented device");
     }
 
-    // TODO (@rishabh): Don't remove covariances attribute, when
-    // EstimateCovariance functionality is exposed.
+    // Use EstimateCovariances to keep the covariances.
     RemovePointAttr("covariances");
 }
 
+void PointCloud::OrientNormalsConsistentTangentPlane(size_t k,
+                                                     double tile_size) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "No normals in the PointCloud. Call EstimateNormals() first.");
+    }
+    if (tile_size < 0) {
+        utility::LogError("tile_size must be non-negative, but got {}.",
+                          tile_size);
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    core::AssertTensorDtype(GetPointNormals(),
+                            GetPointPositions().GetDtype());
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_points == 0) {
+        return;
+    }
+
+    // The neighbors include the point itself.
+    const int knn = static_cast<int>(
+            std::min(static_cast<int64_t>(k) + 1, num_points));
+    if (num_points * knn >= (int64_t(1) << 32)) {
+        utility::LogError("Too many edges in the KNN graph: {} points x {}.",
+                          num_points, knn);
+    }
+    const core::Tensor positions = GetPointPositions().Contiguous();
+    core::nns::NearestNeighborSearch tree(positions);
+    if (!tree.KnnIndex()) {
+        utility::LogError("Building KnnIndex failed.");
+    }
+    core::Tensor neighbors;
+    std::tie(neighbors, std::ignore) = tree.KnnSearch(positions, knn);
+    neighbors = neighbors.To(core::Int64).Contiguous();
+
+    const core::Tensor tiles =
+            tile_size > 0
+                    ? (positions / tile_size).Floor().To(core::Int64)
+                    : core::Tensor::Empty({0}, core::Int64, device_);
+    core::Tensor normals = GetPointNormals().Contiguous();
+    if (device_.GetType() == core::Device::DeviceType::CPU) {
+        kernel::pointcloud::OrientNormalsAlongSpanningTreeCPU(
+                positions, neighbors, tiles, normals);
+    } else if (device_.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::pointcloud::OrientNormalsAlongSpanningTreeCUDA,
+                  positions, neighbors, tiles, normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+    SetPointNormals(normals);
+}
+
 void PointCloud::EstimateColorGradients(
         const int max_knn /* = 30*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
@@ -532,6 +864,51 @@ PointCloud PointCloud::CreateFromRGBDImage(const RGBDImage &rgbd_image,
     }
 }
 
+PointCloud PointCloud::CreateFromDepthImages(const core::Tensor &depths,
+                                             const core::Tensor &intrinsics,
+                                             const core::Tensor &extrinsics,
+                                             float depth_scale,
+                                             float depth_max,
+                                             int stride) {
+    core::AssertTensorDtypes(depths, {core::UInt16, core::Float32});
+
+    core::Tensor points, camera_ids;
+    kernel::pointcloud::UnprojectBatch(depths, utility::nullopt, points,
+                                       utility::nullopt, camera_ids, intrinsics,
+                                       extrinsics, depth_scale, depth_max,
+                                       stride);
+    PointCloud pcd(points);
+    pcd.SetPointAttr("camera_ids", camera_ids);
+    return pcd;
+}
+
+PointCloud PointCloud::CreateFromRGBDImages(const core::Tensor &depths,
+                                            const core::Tensor &colors,
+                                            const core::Tensor &intrinsics,
+                                            const core::Tensor &extrinsics,
+                                            float depth_scale,
+                                            float depth_max,
+                                            int stride) {
+    core::AssertTensorDtypes(depths, {core::UInt16, core::Float32});
+
+    // Same scaling as Image::To(core::Float32).
+    core::Tensor image_colors = colors.To(core::Float32);
+    if (colors.GetDtype() == core::UInt8) {
+        image_colors.Mul_(1.f / 255);
+    } else if (colors.GetDtype() == core::UInt16) {
+        image_colors.Mul_(1.f / 65535);
+    }
+
+    core::Tensor points, point_colors, camera_ids;
+    kernel::pointcloud::UnprojectBatch(depths, image_colors, points,
+                                       point_colors, camera_ids, intrinsics,
+                                       extrinsics, depth_scale, depth_max,
+                                       stride);
+    PointCloud pcd({{"positions", points}, {"colors", point_colors}});
+    pcd.SetPointAttr("camera_ids", camera_ids);
+    return pcd;
+}
+
 geometry::Image PointCloud::ProjectToDepthImage(int width,
                                                 int height,
                                                 const core::Tensor &intrinsics,
@@ -598,6 +975,37 @@ PointCloud PointCloud::FromLegacy(
     return pcd;
 }
 
+PointCloud PointCloud::FromLegacy(open3d::geometry::PointCloud &&pcd_legacy,
+                                  core::Dtype dtype,
+                                  const core::Device &device) {
+    if (dtype != core::Float64 ||
+        device.GetType() != core::Device::DeviceType::CPU) {
+        return FromLegacy(static_cast<const open3d::geometry::PointCloud &>(
+                                  pcd_legacy),
+                          dtype, device);
+    }
+    geometry::PointCloud pcd(device);
+    if (pcd_legacy.HasPoints()) {
+        pcd.SetPointPositions(
+                core::eigen_converter::MoveEigenVector3dVectorToTensor(
+                        std::move(pcd_legacy.points_)));
+    } else {
+        utility::LogWarning("Creating from an empty legacy PointCloud.");
+    }
+    if (pcd_legacy.HasColors()) {
+        pcd.SetPointColors(
+                core::eigen_converter::MoveEigenVector3dVectorToTensor(
+                        std::move(pcd_legacy.colors_)));
+    }
+    if (pcd_legacy.HasNormals()) {
+        pcd.SetPointNormals(
+                core::eigen_converter::MoveEigenVector3dVectorToTensor(
+                        std::move(pcd_legacy.normals_)));
+    }
+    pcd_legacy.Clear();
+    return pcd;
+}
+
 open3d::geometry::PointCloud PointCloud::ToLegacy() const {
     open3d::geometry::PointCloud pcd_legacy;
     if (HasPointPositions()) {
@@ -651,6 +1059,33 @@ open3d::geometry::PointCloud PointCloud::ToLegacy() const {
     return pcd_legacy;
 }
 
+core::Tensor PointCloud::ComputePointCloudDistance(
+        const PointCloud &target) const {
+    if (IsEmpty() || target.IsEmpty()) {
+        utility::LogError("Both point clouds must have points.");
+    }
+    core::AssertTensorDevice(target.GetPointPositions(), GetDevice());
+    core::AssertTensorDtype(target.GetPointPositions(),
+                            GetPointPositions().GetDtype());
+
+    core::nns::NearestNeighborSearch nns(target.GetPointPositions());
+    if (!nns.KnnIndex()) {
+        utility::LogError("Failed to build the KNN index.");
+    }
+    core::Tensor distances2;
+    std::tie(std::ignore, distances2) =
+            nns.KnnSearch(GetPointPositions().Contiguous(), 1);
+    return distances2.Reshape({-1}).Sqrt();
+}
+
+core::Tensor PointCloud::ComputeMetrics(const PointCloud &pcd2,
+                                        const std::vector<Metric> &metrics,
+                                        const MetricParameters &params) const {
+    core::Tensor distance12 = ComputePointCloudDistance(pcd2);
+    core::Tensor distance21 = pcd2.ComputePointCloudDistance(*this);
+    return ComputeMetricsCommon(distance12, distance21, metrics, params);
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -37,6 +38,7 @@
 #include "open3d/t/geometry/DrawableGeometry.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/Metrics.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/utility/Logging.h"
@@ -267,8 +269,8 @@ public:
         return Append(other);
     }
 
-    /// \brief Transforms the PointPositions and PointNormals (if exist)
-    /// of the PointCloud.
+    /// \brief Transforms the PointPositions, and the PointNormals and
+    /// `covariances` (if exist) of the PointCloud.
     ///
     /// Transformation matrix is a 4x4 matrix.
     ///  T (4x4) =   [[ R(3x3)  t(3x1) ],
@@ -303,7 +305,8 @@ public:
     /// \return Scaled point cloud
     PointCloud &Scale(double scale, const core::Tensor &center);
 
-    /// \brief Rotates the PointPositions and PointNormals (if exists).
+    /// \brief Rotates the PointPositions, and the PointNormals and
+    /// `covariances` (if exist).
     /// \param R Rotation [Tensor of dim {3,3}].
     /// Should be on the same device as the PointCloud
     /// \param center Center [Tensor of dim {3}] about which the PointCloud is
@@ -317,6 +320,88 @@ public:
                                const core::HashBackendType &backend =
                                        core::HashBackendType::Default) const;
 
+    /// \brief Downsamples a point cloud by keeping every k-th point, starting
+    /// from the first one.
+    /// \param every_k_points Sample rate. A positive number.
+    PointCloud UniformDownSample(int64_t every_k_points) const;
+
+    /// \brief Downsamples a point cloud by randomly selecting a fraction of
+    /// the points. The kept points preserve their original order.
+    /// \param sampling_ratio Fraction of points to keep, in [0, 1].
+    PointCloud RandomDownSample(double sampling_ratio) const;
+
+    /// \brief Downsamples a point cloud with farthest point sampling, starting
+    /// from the first point. Each step greedily picks the point farthest from
+    /// the already selected set.
+    /// \param num_samples Number of points to keep. Must not exceed the
+    /// number of points.
+    PointCloud FarthestPointDownSample(int64_t num_samples) const;
+
+    /// \brief Removes points that have less than \p nb_points neighbors in a
+    /// sphere of a given radius. The point itself is counted.
+    /// \param nb_points Minimum number of neighbors within the sphere.
+    /// \param search_radius Radius of the sphere.
+    /// \return Tuple of the filtered point cloud and a boolean mask of shape
+    /// {N,} that is true for the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
+            int64_t nb_points, double search_radius) const;
+
+    /// \brief Removes points that are further away from their \p nb_neighbors
+    /// nearest neighbors than the average of the point cloud. A point is kept
+    /// if its mean neighbor distance is at most mean + \p std_ratio * std,
+    /// where mean and std are taken over all points.
+    /// \param nb_neighbors Number of neighbors used for the mean distance.
+    /// \param std_ratio Multiplier of the standard deviation in the threshold.
+    /// \return Tuple of the filtered point cloud and a boolean mask of shape
+    /// {N,} that is true for the kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveStatisticalOutliers(
+            int64_t nb_neighbors, double std_ratio) const;
+
+    /// Space filling curves for SortBySpatialLocality().
+    enum class SpatialSortMethod {
+        Morton,   ///< Z-order curve. Cheapest to compute.
+        Hilbert,  ///< Hilbert curve. Consecutive cells are always adjacent.
+    };
+
+    /// \brief Reorders the points along a space filling curve, so that points
+    /// that are close in space are also close in memory. This speeds up
+    /// neighbor searches, voxelization and rendering of clouds that arrive in
+    /// sensor order. The positions are quantized to 2^21 cells per axis of
+    /// the bounding box and all attributes are permuted in one pass.
+    /// \param method The space filling curve.
+    /// \return Tuple of the reordered point cloud and the Int64 permutation
+    /// perm of shape {N,}, such that point i of the result is point perm[i]
+    /// of this point cloud. The original order is restored by indexing the
+    /// result with perm.Argsort().
+    std::tuple<PointCloud, core::Tensor> SortBySpatialLocality(
+            SpatialSortMethod method = SpatialSortMethod::Morton) const;
+
+    /// \brief Computes which points are visible from each of a batch of
+    /// viewpoints, e.g. for view planning. This is a batched alternative to
+    /// geometry::PointCloud::HiddenPointRemoval() that runs on the device of
+    /// the point cloud.
+    ///
+    /// The points are splatted as spheres of radius \p point_radius into an
+    /// equirectangular depth buffer around each viewpoint, keeping the
+    /// nearest depth per pixel. A point is visible if its distance is at most
+    /// (1 + \p depth_tolerance) times the depth at its pixel. The viewpoints
+    /// are processed in blocks to bound the memory of the depth buffers.
+    ///
+    /// \param viewpoints Tensor of shape {V, 3} with the viewpoint
+    /// positions.
+    /// \param point_radius Radius of the splats, about the point spacing.
+    /// Larger radii close more gaps between the points.
+    /// \param width Width of the depth buffers in pixels, which cover 360
+    /// degrees. The height is \p width / 2.
+    /// \param depth_tolerance Relative depth difference within which points
+    /// on the same surface are not considered occluded.
+    /// \return Bool tensor of shape {V, N} that is true where point j is
+    /// visible from viewpoint i.
+    core::Tensor ComputeVisibility(const core::Tensor &viewpoints,
+                                   double point_radius,
+                                   int64_t width = 1024,
+                                   double depth_tolerance = 0.01) const;
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -332,6 +417,37 @@ public:
             const int max_nn = 30,
             const utility::optional<double> radius = utility::nullopt);
 
+    /// \brief Function to consistently orient the normals along the minimum
+    /// spanning tree of the KNN graph, with edge weights 1 - |n_i . n_j|
+    /// (Hoppe et al., "Surface Reconstruction from Unorganized Points", 1992).
+    ///
+    /// Unlike the legacy geometry::PointCloud, which runs Kruskal's algorithm
+    /// and a breadth first traversal on the CPU, the tree is built with
+    /// Boruvka's algorithm on the device of the point cloud. The orientation
+    /// of each component is propagated while the components are merged, so
+    /// no traversal is needed. The graph does not include the Euclidean
+    /// minimum spanning tree used by the legacy function, so point clouds
+    /// whose KNN graph is not connected are oriented per connected part. The
+    /// normal of the highest point of each part points upwards.
+    ///
+    /// \param k Number of nearest neighbors of each point in the graph.
+    /// \param tile_size If positive, the space is divided into cubic tiles
+    /// of this size and edges within a tile are preferred over edges between
+    /// tiles: the normals are first oriented locally within each tile and
+    /// then the orientation is propagated across the tile boundaries.
+    void OrientNormalsConsistentTangentPlane(size_t k, double tile_size = 0.0);
+
+    /// \brief Function to estimate the covariance matrix of the neighbourhood
+    /// of every point, stored in the `covariances` attribute of shape
+    /// {N, 3, 3}. It uses KNN search if only max_nn parameter is provided, and
+    /// HybridSearch if radius parameter is also provided.
+    /// \param max_nn NeighbourSearch max neighbours parameter [Default = 20].
+    /// \param radius [optional] NeighbourSearch radius parameter to use
+    /// HybridSearch. [Recommended ~1.4x voxel size].
+    void EstimateCovariances(
+            const int max_nn = 20,
+            const utility::optional<double> radius = utility::nullopt);
+
     /// \brief Function to compute point color gradients. If radius is provided,
     /// then HybridSearch is used, otherwise KNN-Search is used.
     /// Reference: Park, Q.-Y. Zhou, and V. Koltun,
@@ -413,15 +529,95 @@ public:
             int stride = 1,
             bool with_normals = false);
 
+    /// \brief Factory function to create one point cloud from a batch of
+    /// depth images taken by several cameras.
+    ///
+    /// All images are unprojected with a single kernel launch and compacted
+    /// once, as with CreateFromDepthImage() for each camera followed by
+    /// concatenation. The index of the source image of each point is stored
+    /// in the Int32 point attribute "camera_ids" of shape {N, 1}. The order of
+    /// the points is unspecified.
+    ///
+    /// \param depths Stacked uint16_t or float depth images of shape
+    /// {B, H, W} or {B, H, W, 1}.
+    /// \param intrinsics Intrinsic parameters shared by all cameras {3, 3} or
+    /// per camera {B, 3, 3}.
+    /// \param extrinsics Extrinsic parameters per camera {B, 4, 4}.
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param depth_max Truncated at \p depth_max distance.
+    /// \param stride Sampling factor to support coarse point cloud extraction.
+    static PointCloud CreateFromDepthImages(const core::Tensor &depths,
+                                            const core::Tensor &intrinsics,
+                                            const core::Tensor &extrinsics,
+                                            float depth_scale = 1000.0f,
+                                            float depth_max = 3.0f,
+                                            int stride = 1);
+
+    /// \brief Factory function to create one point cloud from a batch of
+    /// RGB-D images taken by several cameras. See CreateFromDepthImages().
+    ///
+    /// \param depths Stacked uint16_t or float depth images of shape
+    /// {B, H, W} or {B, H, W, 1}.
+    /// \param colors Stacked color images {B, H, W, 3} of any dtype. UInt8 and
+    /// UInt16 colors are scaled to [0, 1] as in Image::To().
+    /// \param intrinsics Intrinsic parameters shared by all cameras {3, 3} or
+    /// per camera {B, 3, 3}.
+    /// \param extrinsics Extrinsic parameters per camera {B, 4, 4}.
+    /// \param depth_scale The depth is scaled by 1 / \p depth_scale.
+    /// \param depth_max Truncated at \p depth_max distance.
+    /// \param stride Sampling factor to support coarse point cloud extraction.
+    static PointCloud CreateFromRGBDImages(const core::Tensor &depths,
+                                           const core::Tensor &colors,
+                                           const core::Tensor &intrinsics,
+                                           const core::Tensor &extrinsics,
+                                           float depth_scale = 1000.0f,
+                                           float depth_max = 3.0f,
+                                           int stride = 1);
+
     /// Create a PointCloud from a legacy Open3D PointCloud.
     static PointCloud FromLegacy(
             const open3d::geometry::PointCloud &pcd_legacy,
             core::Dtype dtype = core::Float32,
             const core::Device &device = core::Device("CPU:0"));
 
+    /// Create a PointCloud from a legacy Open3D PointCloud that is no longer
+    /// needed. With \p dtype Float64 on a CPU \p device, the points, colors
+    /// and normals buffers are moved into the tensors without copying and
+    /// \p pcd_legacy is left empty. Otherwise this is the same as the copying
+    /// overload.
+    static PointCloud FromLegacy(
+            open3d::geometry::PointCloud &&pcd_legacy,
+            core::Dtype dtype = core::Float32,
+            const core::Device &device = core::Device("CPU:0"));
+
     /// Convert to a legacy Open3D PointCloud.
     open3d::geometry::PointCloud ToLegacy() const;
 
+    /// \brief Computes the distance from each point to its nearest neighbor
+    /// in \p target, using a KNN index on the point cloud device.
+    ///
+    /// \param target The point cloud to measure the distance to. Must be on
+    /// the same device and have the same positions dtype.
+    /// \return A tensor of shape {N,} with the Euclidean distances.
+    core::Tensor ComputePointCloudDistance(const PointCloud &target) const;
+
+    /// \brief Compares this point cloud with \p pcd2 using the given metrics.
+    ///
+    /// Nearest neighbor distances are computed in both directions on the
+    /// point cloud device, see ComputeMetricsCommon() for the definitions.
+    ///
+    /// \param pcd2 The other point cloud.
+    /// \param metrics The metrics to compute.
+    /// \param params Parameters of the metrics, e.g. the F-Score thresholds.
+    /// \return A Float32 CPU tensor with the metric values, in the order of
+    /// \p metrics.
+    core::Tensor ComputeMetrics(
+            const PointCloud &pcd2,
+            const std::vector<Metric> &metrics = {Metric::ChamferDistance,
+                                                  Metric::HausdorffDistance,
+                                                  Metric::FScore},
+            const MetricParameters &params = MetricParameters()) const;
+
     /// Project a point cloud to a depth image.
     geometry::Image ProjectToDepthImage(
             int width,
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PointCloudBuilder.h"
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+PointCloudBuilder &PointCloudBuilder::Append(const PointCloud &pcd) {
+    core::AssertTensorDevice(pcd.GetPointPositions(), device_);
+
+    if (point_attr_.empty()) {
+        for (const auto &kv : pcd.GetPointAttr()) {
+            point_attr_.emplace(
+                    kv.first,
+                    core::TensorList::FromTensor(kv.second, /*inplace=*/false));
+        }
+        length_ = pcd.GetPointPositions().GetLength();
+        return *this;
+    }
+
+    // Check all attributes before extending any of them, so that a failed
+    // append leaves the builder unchanged.
+    for (const auto &kv : point_attr_) {
+        if (!pcd.HasPointAttr(kv.first)) {
+            utility::LogError(
+                    "The pointcloud is missing attribute {}. The pointcloud "
+                    "being appended, must have all the attributes present in "
+                    "the builder.",
+                    kv.first);
+        }
+        const core::Tensor &attr = pcd.GetPointAttr(kv.first);
+        core::AssertTensorDtype(attr, kv.second.GetDtype());
+        core::AssertTensorDevice(attr, device_);
+        const core::SizeVector shape = attr.GetShape();
+        if (shape.empty() ||
+            core::SizeVector(shape.begin() + 1, shape.end()) !=
+                    kv.second.GetElementShape()) {
+            utility::LogError(
+                    "Shape mismatch. Attribute {}, shape {}, is not "
+                    "compatible with element shape {}.",
+                    kv.first, attr.GetShape(), kv.second.GetElementShape());
+        }
+    }
+
+    for (auto &kv : point_attr_) {
+        // An inplace tensorlist is a view of the attribute, so it is copied
+        // once, into the builder's storage.
+        kv.second.Extend(core::TensorList::FromTensor(
+                pcd.GetPointAttr(kv.first).Contiguous(), /*inplace=*/true));
+    }
+    length_ += pcd.GetPointPositions().GetLength();
+    return *this;
+}
+
+PointCloud PointCloudBuilder::ToPointCloud() const {
+    PointCloud pcd(device_);
+    for (const auto &kv : point_attr_) {
+        pcd.SetPointAttr(kv.first, kv.second.AsTensor());
+    }
+    return pcd;
+}
+
+void PointCloudBuilder::Clear() {
+    point_attr_.clear();
+    length_ = 0;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
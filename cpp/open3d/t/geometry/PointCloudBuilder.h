@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/TensorList.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class PointCloudBuilder
+/// \brief Accumulates point clouds with amortized O(1) appends.
+///
+/// PointCloud::Append() copies both operands into new tensors, so building a
+/// map from many scans is quadratic in the number of copies. The builder keeps
+/// one resizable core::TensorList per point attribute, whose capacity doubles
+/// on demand, so every point is copied once plus O(1) times on average.
+///
+/// The first appended point cloud defines the set of attributes. Later point
+/// clouds must have all of these attributes with the same dtype and element
+/// shape; additional attributes are ignored, as in PointCloud::Append().
+class PointCloudBuilder {
+public:
+    /// Constructs an empty builder on \p device.
+    explicit PointCloudBuilder(
+            const core::Device &device = core::Device("CPU:0"))
+        : device_(device) {}
+
+    /// Appends the points of \p pcd. \p pcd must be on the builder's device.
+    PointCloudBuilder &Append(const PointCloud &pcd);
+
+    /// Returns the accumulated point cloud. The attributes are views of the
+    /// builder's storage and no data is copied. Later appends either write
+    /// past the end of the views or reallocate, so returned point clouds stay
+    /// valid and unchanged.
+    PointCloud ToPointCloud() const;
+
+    /// Returns the number of accumulated points.
+    int64_t GetLength() const { return length_; }
+
+    /// Returns the device of the builder.
+    core::Device GetDevice() const { return device_; }
+
+    /// Removes all points and attributes.
+    void Clear();
+
+private:
+    core::Device device_;
+    int64_t length_ = 0;
+    std::unordered_map<std::string, core::TensorList> point_attr_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
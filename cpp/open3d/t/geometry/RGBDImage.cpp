@@ -26,6 +26,9 @@
 
 #include "open3d/t/geometry/RGBDImage.h"
 
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/kernel/Image.h"
+
 namespace open3d {
 namespace t {
 namespace geometry {
@@ -38,6 +41,88 @@ RGBDImage &RGBDImage::Clear() {
 
 bool RGBDImage::IsEmpty() const { return color_.IsEmpty() && depth_.IsEmpty(); }
 
+// Allocates a new image unless the image already has the requested shape,
+// dtype and device.
+static void ReuseOrReset(Image &im,
+                         int64_t rows,
+                         int64_t cols,
+                         int64_t channels,
+                         const core::Device &device) {
+    if (im.GetRows() != rows || im.GetCols() != cols ||
+        im.GetChannels() != channels || im.GetDtype() != core::Float32 ||
+        im.GetDevice() != device) {
+        im.Reset(rows, cols, channels, core::Float32, device);
+    }
+}
+
+void RGBDImage::CreateDepthPyramid(const core::Tensor &intrinsics,
+                                   const DepthPyramidOption &option,
+                                   DepthPyramid &pyramid) const {
+    if (depth_.GetRows() <= 0 || depth_.GetCols() <= 0 ||
+        depth_.GetChannels() != 1) {
+        utility::LogError(
+                "Invalid shape, expected a 1 channel image, but got ({}, {}, "
+                "{})",
+                depth_.GetRows(), depth_.GetCols(), depth_.GetChannels());
+    }
+    core::AssertTensorDtypes(depth_.AsTensor(), {core::UInt16, core::Float32});
+    core::AssertTensorShape(intrinsics, {3, 3});
+    if (option.num_levels < 1) {
+        utility::LogError("num_levels must be positive, but got {}.",
+                          option.num_levels);
+    }
+    if (option.bilateral_kernel_size < 1) {
+        utility::LogError("bilateral_kernel_size must be positive, but got {}.",
+                          option.bilateral_kernel_size);
+    }
+
+    const core::Device device = depth_.GetDevice();
+    const int64_t num_levels = option.num_levels;
+    pyramid.depth_.resize(num_levels);
+    pyramid.vertex_map_.resize(num_levels);
+    pyramid.normal_map_.resize(num_levels);
+    pyramid.intrinsics_.resize(num_levels);
+
+    int64_t rows = depth_.GetRows();
+    int64_t cols = depth_.GetCols();
+    core::Tensor intrinsics_d =
+            intrinsics.To(core::Device("CPU:0"), core::Float64, true);
+    for (int64_t level = 0; level < num_levels; ++level) {
+        ReuseOrReset(pyramid.depth_[level], rows, cols, 1, device);
+        ReuseOrReset(pyramid.vertex_map_[level], rows, cols, 3, device);
+        ReuseOrReset(pyramid.normal_map_[level], rows, cols, 3, device);
+        pyramid.intrinsics_[level] = intrinsics_d.Clone();
+
+        core::Tensor depth = pyramid.depth_[level].AsTensor();
+        core::Tensor depth_smooth;
+        if (level == 0) {
+            ReuseOrReset(pyramid.depth_smooth_, rows, cols, 1, device);
+            depth_smooth = pyramid.depth_smooth_.AsTensor();
+            kernel::image::ClipTransformBilateral(
+                    depth_.AsTensor(), depth, depth_smooth, option.depth_scale,
+                    option.depth_min, option.depth_max, option.invalid_fill,
+                    option.bilateral_kernel_size, option.bilateral_value_sigma,
+                    option.bilateral_distance_sigma);
+        } else {
+            kernel::image::PyrDownDepth(pyramid.depth_[level - 1].AsTensor(),
+                                        depth, option.depth_diff_threshold,
+                                        option.invalid_fill);
+            depth_smooth = depth;
+        }
+
+        core::Tensor vertex_map = pyramid.vertex_map_[level].AsTensor();
+        core::Tensor normal_map = pyramid.normal_map_[level].AsTensor();
+        kernel::image::CreateVertexNormalMap(depth, depth_smooth, vertex_map,
+                                             normal_map, intrinsics_d,
+                                             option.invalid_fill);
+
+        rows /= 2;
+        cols /= 2;
+        intrinsics_d /= 2;
+        intrinsics_d[-1][-1] = 1;
+    }
+}
+
 std::string RGBDImage::ToString() const {
     return fmt::format(
             "RGBD Image pair [{}Aligned]\n"
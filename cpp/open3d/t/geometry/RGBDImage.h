@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <cmath>
+#include <vector>
+
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/t/geometry/Image.h"
 
@@ -33,6 +36,46 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+/// \brief Options for RGBDImage::CreateDepthPyramid().
+struct DepthPyramidOption {
+    /// Number of pyramid levels, level 0 has the input resolution.
+    int num_levels = 3;
+    /// Scale to convert the raw depth values to meters.
+    float depth_scale = 1000.0f;
+    /// Depth values <= depth_min or >= depth_max (in meters) are invalid.
+    float depth_min = 0.0f;
+    float depth_max = 3.0f;
+    /// Value for invalid depth, vertices and normals.
+    float invalid_fill = NAN;
+    /// Bilateral filter parameters for the depth used to compute the normals
+    /// at level 0. The coarser levels are smoothed by the pyramid
+    /// downsampling. Set bilateral_kernel_size to 1 to disable the filter.
+    int bilateral_kernel_size = 5;
+    float bilateral_value_sigma = 5.0f;
+    float bilateral_distance_sigma = 10.0f;
+    /// Depth difference threshold for the edge preserving downsampling.
+    float depth_diff_threshold = 0.14f;
+};
+
+/// \brief A depth, vertex and normal map pyramid created by
+/// RGBDImage::CreateDepthPyramid().
+///
+/// The images of a pyramid are reused if it is passed to
+/// RGBDImage::CreateDepthPyramid() again for a frame with the same resolution
+/// and device.
+struct DepthPyramid {
+    /// Float32 depth images in meters with shape {rows, cols, 1}.
+    std::vector<Image> depth_;
+    /// Float32 vertex maps in camera coordinates with shape {rows, cols, 3}.
+    std::vector<Image> vertex_map_;
+    /// Float32 normal maps in camera coordinates with shape {rows, cols, 3}.
+    std::vector<Image> normal_map_;
+    /// Float64 CPU intrinsic matrices with shape {3, 3}.
+    std::vector<core::Tensor> intrinsics_;
+    /// Scratch buffer for the bilateral filtered depth at level 0.
+    Image depth_smooth_;
+};
+
 /// \brief RGBDImage A pair of color and depth images.
 ///
 /// For most procesing, the image pair should be aligned (same viewpoint and
@@ -97,6 +140,32 @@ public:
     /// Returns copy of the RGBD image on the same device.
     RGBDImage Clone() const { return To(color_.GetDevice(), /*copy=*/true); }
 
+    /// \brief Creates the depth, vertex and normal map pyramid of the depth
+    /// image.
+    ///
+    /// This is equivalent to ClipTransform(), FilterBilateral(),
+    /// CreateVertexMap() and CreateNormalMap() at level 0 followed by
+    /// PyrDownDepth(), CreateVertexMap() and CreateNormalMap() for the
+    /// coarser levels, but fuses the operations into two kernel launches per
+    /// level and writes into the images of \p pyramid.
+    /// \param intrinsics Intrinsic matrix of the depth image with shape {3,3}.
+    /// \param option Options for the pyramid.
+    /// \param pyramid The output pyramid. Its images are reused if they have
+    /// the expected shape and device.
+    void CreateDepthPyramid(const core::Tensor &intrinsics,
+                            const DepthPyramidOption &option,
+                            DepthPyramid &pyramid) const;
+
+    /// \brief Creates the depth, vertex and normal map pyramid of the depth
+    /// image in a new DepthPyramid.
+    DepthPyramid CreateDepthPyramid(
+            const core::Tensor &intrinsics,
+            const DepthPyramidOption &option = DepthPyramidOption()) const {
+        DepthPyramid pyramid;
+        CreateDepthPyramid(intrinsics, option, pyramid);
+        return pyramid;
+    }
+
     /// Convert to the legacy RGBDImage format.
     open3d::geometry::RGBDImage ToLegacy() const {
         return open3d::geometry::RGBDImage(color_.ToLegacy(),
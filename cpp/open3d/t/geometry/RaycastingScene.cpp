@@ -36,6 +36,9 @@
 #include <tutorials/common/math/closest_point.h>
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <tuple>
 #include <vector>
 
@@ -50,15 +53,13 @@ void ErrorFunction(void* userPtr, enum RTCError error, const char* str) {
     open3d::utility::LogError("embree error: {} {}", error, str);
 }
 
-// Checks the last dim, ensures that the number of dims is >= min_ndim, checks
-// the device, and dtype.
+// Checks the last dim, ensures that the number of dims is >= min_ndim, and
+// checks the dtype. Any device is accepted, queries run on a CPU copy.
 template <class DTYPE>
-void AssertTensorDtypeLastDimDeviceMinNDim(const open3d::core::Tensor& tensor,
-                                           const std::string& tensor_name,
-                                           int64_t last_dim,
-                                           const open3d::core::Device& device,
-                                           int64_t min_ndim = 2) {
-    open3d::core::AssertTensorDevice(tensor, device);
+void AssertTensorDtypeLastDimMinNDim(const open3d::core::Tensor& tensor,
+                                     const std::string& tensor_name,
+                                     int64_t last_dim,
+                                     int64_t min_ndim = 2) {
     if (tensor.NumDims() < min_ndim) {
         open3d::utility::LogError(
                 "{} Tensor ndim is {} but expected ndim >= {}", tensor_name,
@@ -110,10 +111,14 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
         RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
 
         unsigned int ray_id = ray.id;
-        std::tuple<uint32_t, uint32_t, float> gpID(hit.geomID, hit.primID,
+        // Use the ID of the instance for hits with instanced geometry.
+        const unsigned int geomID = hit.instID[0] != RTC_INVALID_GEOMETRY_ID
+                                            ? hit.instID[0]
+                                            : hit.geomID;
+        std::tuple<uint32_t, uint32_t, float> gpID(geomID, hit.primID,
                                                    ray.tfar);
         auto& prev_gpIDtfar = previous_geom_prim_ID_tfar->operator[](ray_id);
-        if (std::get<0>(prev_gpIDtfar) != hit.geomID ||
+        if (std::get<0>(prev_gpIDtfar) != geomID ||
             (std::get<1>(prev_gpIDtfar) != hit.primID &&
              std::get<2>(prev_gpIDtfar) != ray.tfar)) {
             ++(intersections[ray_id]);
@@ -124,65 +129,102 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
     }
 }
 
+// Bookkeeping for a geometry attached to the top level scene.
+struct GeometryInfo {
+    GeometryInfo()
+        : type(RTC_GEOMETRY_TYPE_TRIANGLE),
+          vertex_buffer(nullptr),
+          index_buffer(nullptr),
+          num_vertices(0),
+          instanced_scene(nullptr),
+          transformation(Eigen::Matrix4f::Identity()),
+          normal_transformation(Eigen::Matrix3f::Identity()) {}
+
+    // False for unused IDs and removed geometries.
+    bool IsValid() const { return vertex_buffer != nullptr; }
+
+    // RTC_GEOMETRY_TYPE_TRIANGLE or RTC_GEOMETRY_TYPE_INSTANCE.
+    RTCGeometryType type;
+    // The buffers of the triangle mesh. For instances these are the buffers of
+    // the mesh in the instanced scene.
+    float* vertex_buffer;
+    const uint32_t* index_buffer;
+    size_t num_vertices;
+    // The scene with the mesh for instances. nullptr otherwise.
+    RTCScene instanced_scene;
+    // The instance to world transformation and the transformation for the
+    // normals. Identity for geometries which are not instances.
+    Eigen::Matrix<float, 4, 4, Eigen::DontAlign> transformation;
+    Eigen::Matrix3f normal_transformation;
+};
+
 struct ClosestPointResult {
     ClosestPointResult()
         : primID(RTC_INVALID_GEOMETRY_ID),
           geomID(RTC_INVALID_GEOMETRY_ID),
-          geometry_ptrs_ptr() {}
+          distance(std::numeric_limits<float>::infinity()),
+          geometries_ptr() {}
 
     embree::Vec3f p;
     unsigned int primID;
     unsigned int geomID;
-    std::vector<std::tuple<RTCGeometryType, const void*, const void*>>*
-            geometry_ptrs_ptr;
+    // The query point and the distance to the closest point in world space.
+    embree::Vec3fa q;
+    float distance;
+    std::vector<GeometryInfo>* geometries_ptr;
 };
 
 // Code adapted from the embree closest_point tutorial.
 bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     using namespace embree;
     assert(args->userPtr);
-    const unsigned int geomID = args->geomID;
     const unsigned int primID = args->primID;
 
-    // query position in world space
-    Vec3fa q(args->query->x, args->query->y, args->query->z);
+    // For instances args->geomID is the ID within the instanced scene.
+    const bool instanced = args->context->instStackSize > 0;
+    const unsigned int geomID =
+            instanced ? args->context->instID[0] : args->geomID;
 
     ClosestPointResult* result =
             static_cast<ClosestPointResult*>(args->userPtr);
-    const RTCGeometryType geom_type =
-            std::get<0>(result->geometry_ptrs_ptr->operator[](geomID));
-    const void* ptr1 =
-            std::get<1>(result->geometry_ptrs_ptr->operator[](geomID));
-    const void* ptr2 =
-            std::get<2>(result->geometry_ptrs_ptr->operator[](geomID));
-
-    if (RTC_GEOMETRY_TYPE_TRIANGLE == geom_type) {
-        const float* vertex_positions = (const float*)ptr1;
-        const uint32_t* triangle_indices = (const uint32_t*)ptr2;
-
-        Vec3fa v0(vertex_positions[3 * triangle_indices[3 * primID + 0] + 0],
-                  vertex_positions[3 * triangle_indices[3 * primID + 0] + 1],
-                  vertex_positions[3 * triangle_indices[3 * primID + 0] + 2]);
-        Vec3fa v1(vertex_positions[3 * triangle_indices[3 * primID + 1] + 0],
-                  vertex_positions[3 * triangle_indices[3 * primID + 1] + 1],
-                  vertex_positions[3 * triangle_indices[3 * primID + 1] + 2]);
-        Vec3fa v2(vertex_positions[3 * triangle_indices[3 * primID + 2] + 0],
-                  vertex_positions[3 * triangle_indices[3 * primID + 2] + 1],
-                  vertex_positions[3 * triangle_indices[3 * primID + 2] + 2]);
-
-        // Determine distance to closest point on triangle (implemented in
-        // common/math/closest_point.h).
-        const Vec3fa p = closestPointTriangle(q, v0, v1, v2);
-        float d = distance(q, p);
-
-        // Store result in userPtr and update the query radius if we found a
-        // point closer to the query position. This is optional but allows for
-        // faster traversal (due to better culling).
-        if (d < args->query->radius) {
-            args->query->radius = d;
-            result->p = p;
-            result->primID = primID;
-            result->geomID = geomID;
+    const GeometryInfo& info = result->geometries_ptr->operator[](geomID);
+
+    // query position in world space
+    const Vec3fa& q = result->q;
+
+    const float* vertex_positions = info.vertex_buffer;
+    const uint32_t* triangle_indices = info.index_buffer;
+    auto GetVertex = [&](int corner) {
+        Eigen::Vector3f v(Eigen::Map<const Eigen::Vector3f>(
+                &vertex_positions[3 * triangle_indices[3 * primID + corner]]));
+        if (instanced) {
+            v = info.transformation.topLeftCorner<3, 3>() * v +
+                info.transformation.topRightCorner<3, 1>();
+        }
+        return Vec3fa(v.x(), v.y(), v.z());
+    };
+    const Vec3fa v0 = GetVertex(0);
+    const Vec3fa v1 = GetVertex(1);
+    const Vec3fa v2 = GetVertex(2);
+
+    // Determine distance to closest point on triangle (implemented in
+    // common/math/closest_point.h).
+    const Vec3fa p = closestPointTriangle(q, v0, v1, v2);
+    float d = distance(q, p);
+
+    // Store result in userPtr and update the query radius if we found a
+    // point closer to the query position. This is optional but allows for
+    // faster traversal (due to better culling).
+    if (d < result->distance) {
+        result->distance = d;
+        result->p = p;
+        result->primID = primID;
+        result->geomID = geomID;
+        // The query radius is in instance space. It can only be updated if
+        // the instance transformation is a similarity transformation.
+        const float scale = instanced ? args->similarityScale : 1.f;
+        if (scale > 0) {
+            args->query->radius = d * scale;
             return true;  // Return true to indicate that the query radius
                           // changed.
         }
@@ -190,6 +232,36 @@ bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     return false;
 }
 
+// Computes the camera center C and the matrix R^T K^-1 which maps pixel
+// coordinates to ray directions for a pinhole camera.
+void GetPinholeRayParameters(const open3d::core::Tensor& intrinsic_matrix,
+                             const open3d::core::Tensor& extrinsic_matrix,
+                             Eigen::Matrix3f& RT_invK,
+                             Eigen::Vector3f& C) {
+    open3d::core::AssertTensorDevice(intrinsic_matrix,
+                                     open3d::core::Device());
+    open3d::core::AssertTensorShape(intrinsic_matrix, {3, 3});
+    open3d::core::AssertTensorDevice(extrinsic_matrix,
+                                     open3d::core::Device());
+    open3d::core::AssertTensorShape(extrinsic_matrix, {4, 4});
+
+    auto intrinsic_matrix_contig =
+            intrinsic_matrix.To(open3d::core::Float64).Contiguous();
+    auto extrinsic_matrix_contig =
+            extrinsic_matrix.To(open3d::core::Float64).Contiguous();
+    // Eigen is col major
+    Eigen::Map<Eigen::MatrixXd> KT(intrinsic_matrix_contig.GetDataPtr<double>(),
+                                   3, 3);
+    Eigen::Map<Eigen::MatrixXd> TT(extrinsic_matrix_contig.GetDataPtr<double>(),
+                                   4, 4);
+
+    Eigen::Matrix3d invK = KT.transpose().inverse();
+    Eigen::Matrix3d RT = TT.block(0, 0, 3, 3);
+    Eigen::Vector3d t = TT.transpose().block(0, 3, 3, 1);
+    C = (-RT * t).cast<float>();
+    RT_invK = (RT * invK).cast<float>();
+}
+
 }  // namespace
 
 namespace open3d {
@@ -201,12 +273,105 @@ struct RaycastingScene::Impl {
     const size_t BATCH_SIZE = 1024;
     RTCDevice device_;
     RTCScene scene_;
-    bool scene_committed_;  // true if the scene has been committed.
-    // Vector for storing some information about the added geometry.
-    std::vector<std::tuple<RTCGeometryType, const void*, const void*>>
-            geometry_ptrs_;
+    // true if the scene has been committed.
+    std::atomic<bool> scene_committed_;
+    std::mutex commit_mutex_;
+    // Information about the added geometry indexed by the geometry ID.
+    std::vector<GeometryInfo> geometries_;
     core::Device tensor_device_;  // cpu
 
+    // Commits the scene on the first query after a modification. Queries on
+    // the same scene may run concurrently.
+    void CommitScene() {
+        if (!scene_committed_.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(commit_mutex_);
+            if (!scene_committed_.load(std::memory_order_relaxed)) {
+                rtcCommitScene(scene_);
+                scene_committed_.store(true, std::memory_order_release);
+            }
+        }
+    }
+
+    // Creates a triangle geometry and copies the vertices and triangles to
+    // its buffers. The geometry is committed and must be released by the
+    // caller.
+    RTCGeometry NewTriangleGeometry(const core::Tensor& vertex_positions,
+                                    const core::Tensor& triangle_indices,
+                                    GeometryInfo& info) {
+        core::AssertTensorShape(vertex_positions, {utility::nullopt, 3});
+        core::AssertTensorDtype(vertex_positions, core::Float32);
+        core::AssertTensorShape(triangle_indices, {utility::nullopt, 3});
+        core::AssertTensorDtype(triangle_indices, core::UInt32);
+
+        const size_t num_vertices = vertex_positions.GetLength();
+        const size_t num_triangles = triangle_indices.GetLength();
+
+        RTCGeometry geom = rtcNewGeometry(device_, RTC_GEOMETRY_TYPE_TRIANGLE);
+
+        // rtcSetNewGeometryBuffer will take care of alignment and padding
+        float* vertex_buffer = (float*)rtcSetNewGeometryBuffer(
+                geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3,
+                3 * sizeof(float), num_vertices);
+
+        uint32_t* index_buffer = (uint32_t*)rtcSetNewGeometryBuffer(
+                geom, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT3,
+                3 * sizeof(uint32_t), num_triangles);
+
+        {
+            auto data = vertex_positions.To(tensor_device_).Contiguous();
+            memcpy(vertex_buffer, data.GetDataPtr(),
+                   sizeof(float) * 3 * num_vertices);
+        }
+        {
+            auto data = triangle_indices.To(tensor_device_).Contiguous();
+            memcpy(index_buffer, data.GetDataPtr(),
+                   sizeof(uint32_t) * 3 * num_triangles);
+        }
+        rtcCommitGeometry(geom);
+
+        info.vertex_buffer = vertex_buffer;
+        info.index_buffer = index_buffer;
+        info.num_vertices = num_vertices;
+        return geom;
+    }
+
+    void SetGeometryInfo(uint32_t geom_id, const GeometryInfo& info) {
+        // Embree reuses the IDs of removed geometries.
+        if (geom_id >= geometries_.size()) {
+            geometries_.resize(geom_id + 1);
+        }
+        geometries_[geom_id] = info;
+    }
+
+    const GeometryInfo& GetGeometryInfo(uint32_t geom_id) const {
+        if (geom_id >= geometries_.size() || !geometries_[geom_id].IsValid()) {
+            utility::LogError("Invalid geometry ID {}.", geom_id);
+        }
+        return geometries_[geom_id];
+    }
+
+    // Sets the instance to world transformation of an instance geometry.
+    void SetInstanceTransformation(RTCGeometry instance,
+                                   const core::Tensor& transformation,
+                                   GeometryInfo& info) {
+        core::AssertTensorShape(transformation, {4, 4});
+        core::Tensor T = transformation.To(tensor_device_, core::Float32)
+                                 .Contiguous();
+        info.transformation = Eigen::Map<
+                const Eigen::Matrix<float, 4, 4, Eigen::RowMajor>>(
+                T.GetDataPtr<float>());
+        info.normal_transformation = info.transformation.topLeftCorner<3, 3>()
+                                             .inverse()
+                                             .transpose();
+        // The first 3 rows of the row major 4x4 matrix.
+        rtcSetGeometryTransform(instance, 0, RTC_FORMAT_FLOAT3X4_ROW_MAJOR,
+                                T.GetDataPtr<float>());
+        rtcCommitGeometry(instance);
+    }
+
+    // The number of rays in a packet for the coherent ray casting mode.
+    static const int PACKET_SIZE = 16;
+
     template <bool LINE_INTERSECTION>
     void CastRays(const float* const rays,
                   const size_t num_rays,
@@ -215,39 +380,84 @@ struct RaycastingScene::Impl {
                   unsigned int* primitive_ids,
                   float* primitive_uvs,
                   float* primitive_normals,
-                  const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+                  const int nthreads,
+                  const bool coherent) {
+        CommitScene();
 
         struct RTCIntersectContext context;
         rtcInitIntersectContext(&context);
+        if (coherent) {
+            context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+        }
 
-        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+        auto InitRay = [&](const size_t i, float& org_x, float& org_y,
+                           float& org_z, float& dir_x, float& dir_y,
+                           float& dir_z, float& tnear, float& tfar) {
+            const float* r = &rays[i * 6];
+            org_x = r[0];
+            org_y = r[1];
+            org_z = r[2];
+            if (LINE_INTERSECTION) {
+                dir_x = r[3] - r[0];
+                dir_y = r[4] - r[1];
+                dir_z = r[5] - r[2];
+            } else {
+                dir_x = r[3];
+                dir_y = r[4];
+                dir_z = r[5];
+            }
+            tnear = 0;
+            if (LINE_INTERSECTION) {
+                tfar = 1.f;
+            } else {
+                tfar = std::numeric_limits<float>::infinity();
+            }
+        };
+
+        auto WriteHit = [&](const size_t idx, const float tfar,
+                            const unsigned int geom_id,
+                            const unsigned int inst_id,
+                            const unsigned int prim_id, const float u,
+                            const float v, const float ng_x, const float ng_y,
+                            const float ng_z) {
+            t_hit[idx] = tfar;
+            if (geom_id != RTC_INVALID_GEOMETRY_ID) {
+                // For instances the hit refers to the instanced scene and the
+                // normal is in instance space.
+                Eigen::Vector3f ng(ng_x, ng_y, ng_z);
+                if (inst_id != RTC_INVALID_GEOMETRY_ID) {
+                    ng = geometries_[inst_id].normal_transformation * ng;
+                    geometry_ids[idx] = inst_id;
+                } else {
+                    geometry_ids[idx] = geom_id;
+                }
+                primitive_ids[idx] = prim_id;
+                primitive_uvs[idx * 2 + 0] = u;
+                primitive_uvs[idx * 2 + 1] = v;
+                ng.normalize();
+                primitive_normals[idx * 3 + 0] = ng.x();
+                primitive_normals[idx * 3 + 1] = ng.y();
+                primitive_normals[idx * 3 + 2] = ng.z();
+            } else {
+                geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+                primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+                primitive_uvs[idx * 2 + 0] = 0;
+                primitive_uvs[idx * 2 + 1] = 0;
+                primitive_normals[idx * 3 + 0] = 0;
+                primitive_normals[idx * 3 + 1] = 0;
+                primitive_normals[idx * 3 + 2] = 0;
+            }
+        };
+
+        // Casts consecutive rays as a stream with rtcIntersect1M.
+        auto StreamLoopFn = [&](const tbb::blocked_range<size_t>& range) {
             std::vector<RTCRayHit> rayhits(range.size());
 
             for (size_t i = range.begin(); i < range.end(); ++i) {
                 RTCRayHit& rh = rayhits[i - range.begin()];
-                const float* r = &rays[i * 6];
-                rh.ray.org_x = r[0];
-                rh.ray.org_y = r[1];
-                rh.ray.org_z = r[2];
-                if (LINE_INTERSECTION) {
-                    rh.ray.dir_x = r[3] - r[0];
-                    rh.ray.dir_y = r[4] - r[1];
-                    rh.ray.dir_z = r[5] - r[2];
-                } else {
-                    rh.ray.dir_x = r[3];
-                    rh.ray.dir_y = r[4];
-                    rh.ray.dir_z = r[5];
-                }
-                rh.ray.tnear = 0;
-                if (LINE_INTERSECTION) {
-                    rh.ray.tfar = 1.f;
-                } else {
-                    rh.ray.tfar = std::numeric_limits<float>::infinity();
-                }
+                InitRay(i, rh.ray.org_x, rh.ray.org_y, rh.ray.org_z,
+                        rh.ray.dir_x, rh.ray.dir_y, rh.ray.dir_z, rh.ray.tnear,
+                        rh.ray.tfar);
                 rh.ray.mask = 0;
                 rh.ray.id = i - range.begin();
                 rh.ray.flags = 0;
@@ -259,29 +469,56 @@ struct RaycastingScene::Impl {
                            sizeof(RTCRayHit));
 
             for (size_t i = range.begin(); i < range.end(); ++i) {
-                RTCRayHit rh = rayhits[i - range.begin()];
-                size_t idx = rh.ray.id + range.begin();
-                t_hit[idx] = rh.ray.tfar;
-                if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-                    geometry_ids[idx] = rh.hit.geomID;
-                    primitive_ids[idx] = rh.hit.primID;
-                    primitive_uvs[idx * 2 + 0] = rh.hit.u;
-                    primitive_uvs[idx * 2 + 1] = rh.hit.v;
-                    float inv_norm = 1.f / std::sqrt(rh.hit.Ng_x * rh.hit.Ng_x +
-                                                     rh.hit.Ng_y * rh.hit.Ng_y +
-                                                     rh.hit.Ng_z * rh.hit.Ng_z);
-                    primitive_normals[idx * 3 + 0] = rh.hit.Ng_x * inv_norm;
-                    primitive_normals[idx * 3 + 1] = rh.hit.Ng_y * inv_norm;
-                    primitive_normals[idx * 3 + 2] = rh.hit.Ng_z * inv_norm;
-                } else {
-                    geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_uvs[idx * 2 + 0] = 0;
-                    primitive_uvs[idx * 2 + 1] = 0;
-                    primitive_normals[idx * 3 + 0] = 0;
-                    primitive_normals[idx * 3 + 1] = 0;
-                    primitive_normals[idx * 3 + 2] = 0;
+                const RTCRayHit& rh = rayhits[i - range.begin()];
+                WriteHit(rh.ray.id + range.begin(), rh.ray.tfar, rh.hit.geomID,
+                         rh.hit.instID[0], rh.hit.primID, rh.hit.u, rh.hit.v,
+                         rh.hit.Ng_x, rh.hit.Ng_y, rh.hit.Ng_z);
+            }
+        };
+
+        // Casts consecutive rays in packets of 16 with rtcIntersect16. This is
+        // faster for coherent rays, e.g., rays of a camera in image order.
+        auto PacketLoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t begin = range.begin(); begin < range.end();
+                 begin += PACKET_SIZE) {
+                const size_t end = std::min(begin + PACKET_SIZE, range.end());
+                int valid[PACKET_SIZE];
+                RTCRayHit16 rh;
+                for (int j = 0; j < PACKET_SIZE; ++j) {
+                    const size_t i = begin + j;
+                    if (i >= end) {
+                        valid[j] = 0;
+                        continue;
+                    }
+                    valid[j] = -1;
+                    InitRay(i, rh.ray.org_x[j], rh.ray.org_y[j],
+                            rh.ray.org_z[j], rh.ray.dir_x[j], rh.ray.dir_y[j],
+                            rh.ray.dir_z[j], rh.ray.tnear[j], rh.ray.tfar[j]);
+                    rh.ray.time[j] = 0;
+                    rh.ray.mask[j] = 0;
+                    rh.ray.id[j] = j;
+                    rh.ray.flags[j] = 0;
+                    rh.hit.geomID[j] = RTC_INVALID_GEOMETRY_ID;
+                    rh.hit.instID[0][j] = RTC_INVALID_GEOMETRY_ID;
                 }
+
+                rtcIntersect16(valid, scene_, &context, &rh);
+
+                for (size_t i = begin; i < end; ++i) {
+                    const int j = int(i - begin);
+                    WriteHit(i, rh.ray.tfar[j], rh.hit.geomID[j],
+                             rh.hit.instID[0][j], rh.hit.primID[j],
+                             rh.hit.u[j], rh.hit.v[j], rh.hit.Ng_x[j],
+                             rh.hit.Ng_y[j], rh.hit.Ng_z[j]);
+                }
+            }
+        };
+
+        auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
+            if (coherent) {
+                PacketLoopFn(range);
+            } else {
+                StreamLoopFn(range);
             }
         };
 
@@ -305,10 +542,7 @@ struct RaycastingScene::Impl {
                         const float tfar,
                         int8_t* occluded,
                         const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         struct RTCIntersectContext context;
         rtcInitIntersectContext(&context);
@@ -360,10 +594,7 @@ struct RaycastingScene::Impl {
                             const size_t num_rays,
                             int* intersections,
                             const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         memset(intersections, 0, sizeof(int) * num_rays);
 
@@ -424,10 +655,7 @@ struct RaycastingScene::Impl {
                               unsigned int* geometry_ids,
                               unsigned int* primitive_ids,
                               const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
             for (size_t i = range.begin(); i < range.end(); ++i) {
@@ -439,7 +667,8 @@ struct RaycastingScene::Impl {
                 query.time = 0.f;
 
                 ClosestPointResult result;
-                result.geometry_ptrs_ptr = &geometry_ptrs_;
+                result.q = embree::Vec3fa(query.x, query.y, query.z);
+                result.geometries_ptr = &geometries_;
 
                 RTCPointQueryContext instStack;
                 rtcInitPointQueryContext(&instStack);
@@ -467,6 +696,106 @@ struct RaycastingScene::Impl {
                     LoopFn);
         }
     }
+
+    // Casts the rays of a pinhole camera without creating a ray tensor. The
+    // rays are generated on the fly and cast in coherent packets along the
+    // image rows. Outputs which are nullptr are not written.
+    void RenderPinhole(const Eigen::Matrix3f& RT_invK,
+                       const Eigen::Vector3f& C,
+                       const int width_px,
+                       const int height_px,
+                       float* depth,
+                       float* normals,
+                       unsigned int* primitive_ids,
+                       const int nthreads) {
+        CommitScene();
+
+        struct RTCIntersectContext context;
+        rtcInitIntersectContext(&context);
+        context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+
+        auto LoopFn = [&](const tbb::blocked_range<int>& range) {
+            for (int y = range.begin(); y < range.end(); ++y) {
+                for (int x_begin = 0; x_begin < width_px;
+                     x_begin += PACKET_SIZE) {
+                    const int x_end = std::min(x_begin + PACKET_SIZE, width_px);
+                    int valid[PACKET_SIZE];
+                    RTCRayHit16 rh;
+                    for (int j = 0; j < PACKET_SIZE; ++j) {
+                        const int x = x_begin + j;
+                        if (x >= x_end) {
+                            valid[j] = 0;
+                            continue;
+                        }
+                        valid[j] = -1;
+                        const Eigen::Vector3f dir =
+                                RT_invK * Eigen::Vector3f(x + 0.5f, y + 0.5f,
+                                                          1);
+                        rh.ray.org_x[j] = C.x();
+                        rh.ray.org_y[j] = C.y();
+                        rh.ray.org_z[j] = C.z();
+                        rh.ray.dir_x[j] = dir.x();
+                        rh.ray.dir_y[j] = dir.y();
+                        rh.ray.dir_z[j] = dir.z();
+                        rh.ray.tnear[j] = 0;
+                        rh.ray.tfar[j] = std::numeric_limits<float>::infinity();
+                        rh.ray.time[j] = 0;
+                        rh.ray.mask[j] = 0;
+                        rh.ray.id[j] = j;
+                        rh.ray.flags[j] = 0;
+                        rh.hit.geomID[j] = RTC_INVALID_GEOMETRY_ID;
+                        rh.hit.instID[0][j] = RTC_INVALID_GEOMETRY_ID;
+                    }
+
+                    rtcIntersect16(valid, scene_, &context, &rh);
+
+                    for (int x = x_begin; x < x_end; ++x) {
+                        const int j = x - x_begin;
+                        const int64_t idx = int64_t(y) * width_px + x;
+                        const bool hit =
+                                rh.hit.geomID[j] != RTC_INVALID_GEOMETRY_ID;
+                        // The ray directions have unit length along the
+                        // optical axis, t_hit is the depth.
+                        if (depth) {
+                            depth[idx] = hit ? rh.ray.tfar[j] : 0.f;
+                        }
+                        if (primitive_ids) {
+                            primitive_ids[idx] = hit ? rh.hit.primID[j]
+                                                     : RTC_INVALID_GEOMETRY_ID;
+                        }
+                        if (normals) {
+                            Eigen::Vector3f ng = Eigen::Vector3f::Zero();
+                            if (hit) {
+                                ng = Eigen::Vector3f(rh.hit.Ng_x[j],
+                                                     rh.hit.Ng_y[j],
+                                                     rh.hit.Ng_z[j]);
+                                const unsigned int inst_id =
+                                        rh.hit.instID[0][j];
+                                if (inst_id != RTC_INVALID_GEOMETRY_ID) {
+                                    ng = geometries_[inst_id]
+                                                 .normal_transformation *
+                                         ng;
+                                }
+                                ng.normalize();
+                            }
+                            Eigen::Map<Eigen::Vector3f>(&normals[idx * 3]) =
+                                    ng;
+                        }
+                    }
+                }
+            }
+        };
+
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<int>(0, height_px),
+                                  LoopFn);
+            });
+        } else {
+            tbb::parallel_for(tbb::blocked_range<int>(0, height_px), LoopFn);
+        }
+    }
 };
 
 RaycastingScene::RaycastingScene() : impl_(new RaycastingScene::Impl()) {
@@ -483,54 +812,27 @@ RaycastingScene::RaycastingScene() : impl_(new RaycastingScene::Impl()) {
 }
 
 RaycastingScene::~RaycastingScene() {
+    for (const auto& info : impl_->geometries_) {
+        if (info.instanced_scene) {
+            rtcReleaseScene(info.instanced_scene);
+        }
+    }
     rtcReleaseScene(impl_->scene_);
     rtcReleaseDevice(impl_->device_);
 }
 
 uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
                                        const core::Tensor& triangle_indices) {
-    core::AssertTensorDevice(vertex_positions, impl_->tensor_device_);
-    core::AssertTensorShape(vertex_positions, {utility::nullopt, 3});
-    core::AssertTensorDtype(vertex_positions, core::Float32);
-    core::AssertTensorDevice(triangle_indices, impl_->tensor_device_);
-    core::AssertTensorShape(triangle_indices, {utility::nullopt, 3});
-    core::AssertTensorDtype(triangle_indices, core::UInt32);
-
-    const size_t num_vertices = vertex_positions.GetLength();
-    const size_t num_triangles = triangle_indices.GetLength();
+    GeometryInfo info;
+    RTCGeometry geom = impl_->NewTriangleGeometry(vertex_positions,
+                                                  triangle_indices, info);
 
     // scene needs to be recommitted
     impl_->scene_committed_ = false;
-    RTCGeometry geom =
-            rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
-
-    // rtcSetNewGeometryBuffer will take care of alignment and padding
-    float* vertex_buffer = (float*)rtcSetNewGeometryBuffer(
-            geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3,
-            3 * sizeof(float), num_vertices);
-
-    uint32_t* index_buffer = (uint32_t*)rtcSetNewGeometryBuffer(
-            geom, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT3,
-            3 * sizeof(uint32_t), num_triangles);
-
-    {
-        auto data = vertex_positions.Contiguous();
-        memcpy(vertex_buffer, data.GetDataPtr(),
-               sizeof(float) * 3 * num_vertices);
-    }
-    {
-        auto data = triangle_indices.Contiguous();
-        memcpy(index_buffer, data.GetDataPtr(),
-               sizeof(uint32_t) * 3 * num_triangles);
-    }
-    rtcCommitGeometry(geom);
-
     uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
     rtcReleaseGeometry(geom);
 
-    impl_->geometry_ptrs_.push_back(std::make_tuple(RTC_GEOMETRY_TYPE_TRIANGLE,
-                                                    (const void*)vertex_buffer,
-                                                    (const void*)index_buffer));
+    impl_->SetGeometryInfo(geom_id, info);
     return geom_id;
 }
 
@@ -545,10 +847,106 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
                         mesh.GetTriangleIndices().To(core::UInt32));
 }
 
+uint32_t RaycastingScene::AddInstance(const core::Tensor& vertex_positions,
+                                      const core::Tensor& triangle_indices,
+                                      const core::Tensor& transformation) {
+    GeometryInfo info;
+    info.type = RTC_GEOMETRY_TYPE_INSTANCE;
+    RTCGeometry geom = impl_->NewTriangleGeometry(vertex_positions,
+                                                  triangle_indices, info);
+
+    // The mesh gets its own scene with its own BVH, which is not rebuilt if
+    // the instance transformation changes.
+    info.instanced_scene = rtcNewScene(impl_->device_);
+    rtcSetSceneFlags(info.instanced_scene,
+                     RTC_SCENE_FLAG_ROBUST |
+                             RTC_SCENE_FLAG_CONTEXT_FILTER_FUNCTION |
+                             RTC_SCENE_FLAG_DYNAMIC);
+    rtcAttachGeometry(info.instanced_scene, geom);
+    rtcReleaseGeometry(geom);
+    rtcCommitScene(info.instanced_scene);
+
+    RTCGeometry instance =
+            rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_INSTANCE);
+    rtcSetGeometryInstancedScene(instance, info.instanced_scene);
+    impl_->SetInstanceTransformation(instance, transformation, info);
+
+    // scene needs to be recommitted
+    impl_->scene_committed_ = false;
+    uint32_t geom_id = rtcAttachGeometry(impl_->scene_, instance);
+    rtcReleaseGeometry(instance);
+
+    impl_->SetGeometryInfo(geom_id, info);
+    return geom_id;
+}
+
+uint32_t RaycastingScene::AddInstance(const TriangleMesh& mesh,
+                                      const core::Tensor& transformation) {
+    size_t num_verts = mesh.GetVertexPositions().GetLength();
+    if (num_verts > std::numeric_limits<uint32_t>::max()) {
+        utility::LogError(
+                "Cannot add mesh with more than {} vertices to the scene",
+                std::numeric_limits<uint32_t>::max());
+    }
+    return AddInstance(mesh.GetVertexPositions(),
+                       mesh.GetTriangleIndices().To(core::UInt32),
+                       transformation);
+}
+
+void RaycastingScene::SetInstanceTransformation(
+        uint32_t geometry_id, const core::Tensor& transformation) {
+    if (impl_->GetGeometryInfo(geometry_id).type !=
+        RTC_GEOMETRY_TYPE_INSTANCE) {
+        utility::LogError("Geometry {} is not an instance.", geometry_id);
+    }
+    GeometryInfo& info = impl_->geometries_[geometry_id];
+    impl_->SetInstanceTransformation(
+            rtcGetGeometry(impl_->scene_, geometry_id), transformation, info);
+    // Only the top level structure over the instances needs to be rebuilt.
+    impl_->scene_committed_ = false;
+}
+
+void RaycastingScene::UpdateVertexPositions(
+        uint32_t geometry_id, const core::Tensor& vertex_positions) {
+    const GeometryInfo& info = impl_->GetGeometryInfo(geometry_id);
+    core::AssertTensorShape(vertex_positions,
+                            {int64_t(info.num_vertices), 3});
+    core::AssertTensorDtype(vertex_positions, core::Float32);
+
+    RTCGeometry geom =
+            info.instanced_scene
+                    ? rtcGetGeometry(info.instanced_scene, 0)
+                    : rtcGetGeometry(impl_->scene_, geometry_id);
+    {
+        auto data = vertex_positions.To(impl_->tensor_device_).Contiguous();
+        memcpy(info.vertex_buffer, data.GetDataPtr(),
+               sizeof(float) * 3 * info.num_vertices);
+    }
+    // The topology is unchanged, refitting the BVH is sufficient.
+    rtcSetGeometryBuildQuality(geom, RTC_BUILD_QUALITY_REFIT);
+    rtcUpdateGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0);
+    rtcCommitGeometry(geom);
+    if (info.instanced_scene) {
+        rtcCommitScene(info.instanced_scene);
+        RTCGeometry instance = rtcGetGeometry(impl_->scene_, geometry_id);
+        rtcCommitGeometry(instance);
+    }
+    impl_->scene_committed_ = false;
+}
+
+void RaycastingScene::RemoveGeometry(uint32_t geometry_id) {
+    const GeometryInfo& info = impl_->GetGeometryInfo(geometry_id);
+    rtcDetachGeometry(impl_->scene_, geometry_id);
+    if (info.instanced_scene) {
+        rtcReleaseScene(info.instanced_scene);
+    }
+    impl_->geometries_[geometry_id] = GeometryInfo();
+    impl_->scene_committed_ = false;
+}
+
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
-        const core::Tensor& rays, const int nthreads) {
-    AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
-                                                 impl_->tensor_device_);
+        const core::Tensor& rays, const int nthreads, const bool coherent) {
+    AssertTensorDtypeLastDimMinNDim<float>(rays, "rays", 6);
     auto shape = rays.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
@@ -563,15 +961,18 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
     shape.back() = 3;
     result["primitive_normals"] = core::Tensor(shape, core::Float32);
 
-    auto data = rays.Contiguous();
+    auto data = rays.To(impl_->tensor_device_).Contiguous();
     impl_->CastRays<false>(data.GetDataPtr<float>(), num_rays,
                            result["t_hit"].GetDataPtr<float>(),
                            result["geometry_ids"].GetDataPtr<uint32_t>(),
                            result["primitive_ids"].GetDataPtr<uint32_t>(),
                            result["primitive_uvs"].GetDataPtr<float>(),
                            result["primitive_normals"].GetDataPtr<float>(),
-                           nthreads);
+                           nthreads, coherent);
 
+    for (auto& kv : result) {
+        kv.second = kv.second.To(rays.GetDevice());
+    }
     return result;
 }
 
@@ -579,8 +980,7 @@ core::Tensor RaycastingScene::TestOcclusions(const core::Tensor& rays,
                                              const float tnear,
                                              const float tfar,
                                              const int nthreads) {
-    AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
-                                                 impl_->tensor_device_);
+    AssertTensorDtypeLastDimMinNDim<float>(rays, "rays", 6);
     auto shape = rays.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
@@ -588,18 +988,17 @@ core::Tensor RaycastingScene::TestOcclusions(const core::Tensor& rays,
 
     core::Tensor result(shape, core::Bool);
 
-    auto data = rays.Contiguous();
+    auto data = rays.To(impl_->tensor_device_).Contiguous();
     impl_->TestOcclusions(data.GetDataPtr<float>(), num_rays, tnear, tfar,
                           reinterpret_cast<int8_t*>(result.GetDataPtr<bool>()),
                           nthreads);
 
-    return result;
+    return result.To(rays.GetDevice());
 }
 
 core::Tensor RaycastingScene::CountIntersections(const core::Tensor& rays,
                                                  const int nthreads) {
-    AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
-                                                 impl_->tensor_device_);
+    AssertTensorDtypeLastDimMinNDim<float>(rays, "rays", 6);
     auto shape = rays.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
@@ -607,18 +1006,17 @@ core::Tensor RaycastingScene::CountIntersections(const core::Tensor& rays,
 
     core::Tensor intersections(shape, core::Dtype::FromType<int>());
 
-    auto data = rays.Contiguous();
+    auto data = rays.To(impl_->tensor_device_).Contiguous();
 
     impl_->CountIntersections(data.GetDataPtr<float>(), num_rays,
                               intersections.GetDataPtr<int>(), nthreads);
-    return intersections;
+    return intersections.To(rays.GetDevice());
 }
 
 std::unordered_map<std::string, core::Tensor>
 RaycastingScene::ComputeClosestPoints(const core::Tensor& query_points,
                                       const int nthreads) {
-    AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
-                                                 3, impl_->tensor_device_);
+    AssertTensorDtypeLastDimMinNDim<float>(query_points, "query_points", 3);
     auto shape = query_points.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
@@ -630,25 +1028,27 @@ RaycastingScene::ComputeClosestPoints(const core::Tensor& query_points,
     shape.push_back(3);
     result["points"] = core::Tensor(shape, core::Float32);
 
-    auto data = query_points.Contiguous();
+    auto data = query_points.To(impl_->tensor_device_).Contiguous();
     impl_->ComputeClosestPoints(data.GetDataPtr<float>(), num_query_points,
                                 result["points"].GetDataPtr<float>(),
                                 result["geometry_ids"].GetDataPtr<uint32_t>(),
                                 result["primitive_ids"].GetDataPtr<uint32_t>(),
                                 nthreads);
 
+    for (auto& kv : result) {
+        kv.second = kv.second.To(query_points.GetDevice());
+    }
     return result;
 }
 
 core::Tensor RaycastingScene::ComputeDistance(const core::Tensor& query_points,
                                               const int nthreads) {
-    AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
-                                                 3, impl_->tensor_device_);
+    AssertTensorDtypeLastDimMinNDim<float>(query_points, "query_points", 3);
     auto shape = query_points.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
 
-    auto data = query_points.Contiguous();
+    auto data = query_points.To(impl_->tensor_device_).Contiguous();
     auto closest_points = ComputeClosestPoints(data, nthreads);
 
     size_t num_query_points = shape.NumElements();
@@ -661,19 +1061,18 @@ core::Tensor RaycastingScene::ComputeDistance(const core::Tensor& query_points,
                                              num_query_points);
 
     distance_map = (closest_points_map - query_points_map).colwise().norm();
-    return distance;
+    return distance.To(query_points.GetDevice());
 }
 
 core::Tensor RaycastingScene::ComputeSignedDistance(
         const core::Tensor& query_points, const int nthreads) {
-    AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
-                                                 3, impl_->tensor_device_);
+    AssertTensorDtypeLastDimMinNDim<float>(query_points, "query_points", 3);
     auto shape = query_points.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
     size_t num_query_points = shape.NumElements();
 
-    auto data = query_points.Contiguous();
+    auto data = query_points.To(impl_->tensor_device_).Contiguous();
     auto distance = ComputeDistance(data, nthreads);
     core::Tensor rays({int64_t(num_query_points), 6}, core::Float32);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
@@ -692,13 +1091,12 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
     intersections_map = intersections_map.unaryExpr(
             [](const int x) { return (x % 2) ? -1 : 1; });
     distance_map.array() *= intersections_map.array().cast<float>();
-    return distance;
+    return distance.To(query_points.GetDevice());
 }
 
 core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
                                                const int nthreads) {
-    AssertTensorDtypeLastDimDeviceMinNDim<float>(query_points, "query_points",
-                                                 3, impl_->tensor_device_);
+    AssertTensorDtypeLastDimMinNDim<float>(query_points, "query_points", 3);
     auto shape = query_points.GetShape();
     shape.pop_back();  // Remove last dim, we want to use this shape for the
                        // results.
@@ -707,7 +1105,8 @@ core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
     core::Tensor rays({int64_t(num_query_points), 6}, core::Float32);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
                   core::TensorKey::Slice(0, 3, 1)},
-                 query_points.Reshape({int64_t(num_query_points), 3}));
+                 query_points.To(impl_->tensor_device_)
+                         .Reshape({int64_t(num_query_points), 3}));
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
                   core::TensorKey::Slice(3, 6, 1)},
                  core::Tensor::Ones({1}, core::Float32, impl_->tensor_device_)
@@ -717,7 +1116,8 @@ core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
             intersections.GetDataPtr<int>(), num_query_points);
     intersections_map =
             intersections_map.unaryExpr([](const int x) { return x % 2; });
-    return intersections.To(core::Float32).Reshape(shape);
+    return intersections.To(query_points.GetDevice(), core::Float32)
+            .Reshape(shape);
 }
 
 core::Tensor RaycastingScene::CreateRaysPinhole(
@@ -725,33 +1125,16 @@ core::Tensor RaycastingScene::CreateRaysPinhole(
         const core::Tensor& extrinsic_matrix,
         int width_px,
         int height_px) {
-    core::AssertTensorDevice(intrinsic_matrix, core::Device());
-    core::AssertTensorShape(intrinsic_matrix, {3, 3});
-    core::AssertTensorDevice(extrinsic_matrix, core::Device());
-    core::AssertTensorShape(extrinsic_matrix, {4, 4});
-
-    auto intrinsic_matrix_contig =
-            intrinsic_matrix.To(core::Float64).Contiguous();
-    auto extrinsic_matrix_contig =
-            extrinsic_matrix.To(core::Float64).Contiguous();
-    // Eigen is col major
-    Eigen::Map<Eigen::MatrixXd> KT(intrinsic_matrix_contig.GetDataPtr<double>(),
-                                   3, 3);
-    Eigen::Map<Eigen::MatrixXd> TT(extrinsic_matrix_contig.GetDataPtr<double>(),
-                                   4, 4);
-
-    Eigen::Matrix3d invK = KT.transpose().inverse();
-    Eigen::Matrix3d RT = TT.block(0, 0, 3, 3);
-    Eigen::Vector3d t = TT.transpose().block(0, 3, 3, 1);
-    Eigen::Vector3d C = -RT * t;
-    Eigen::Matrix3f RT_invK = (RT * invK).cast<float>();
+    Eigen::Matrix3f RT_invK;
+    Eigen::Vector3f C;
+    GetPinholeRayParameters(intrinsic_matrix, extrinsic_matrix, RT_invK, C);
 
     core::Tensor rays({height_px, width_px, 6}, core::Float32);
     Eigen::Map<Eigen::MatrixXf> rays_map(rays.GetDataPtr<float>(), 6,
                                          height_px * width_px);
 
     Eigen::Matrix<float, 6, 1> r;
-    r.topRows<3>() = C.cast<float>();
+    r.topRows<3>() = C;
     int64_t linear_idx = 0;
     for (int y = 0; y < height_px; ++y) {
         for (int x = 0; x < width_px; ++x, ++linear_idx) {
@@ -818,6 +1201,52 @@ core::Tensor RaycastingScene::CreateRaysPinhole(double fov_deg,
                              height_px);
 }
 
+Image RaycastingScene::RenderDepth(const core::Tensor& intrinsic_matrix,
+                                   const core::Tensor& extrinsic_matrix,
+                                   int width_px,
+                                   int height_px,
+                                   const int nthreads) {
+    Eigen::Matrix3f RT_invK;
+    Eigen::Vector3f C;
+    GetPinholeRayParameters(intrinsic_matrix, extrinsic_matrix, RT_invK, C);
+
+    core::Tensor depth({height_px, width_px, 1}, core::Float32);
+    impl_->RenderPinhole(RT_invK, C, width_px, height_px,
+                         depth.GetDataPtr<float>(), nullptr, nullptr,
+                         nthreads);
+    return Image(depth);
+}
+
+Image RaycastingScene::RenderNormals(const core::Tensor& intrinsic_matrix,
+                                     const core::Tensor& extrinsic_matrix,
+                                     int width_px,
+                                     int height_px,
+                                     const int nthreads) {
+    Eigen::Matrix3f RT_invK;
+    Eigen::Vector3f C;
+    GetPinholeRayParameters(intrinsic_matrix, extrinsic_matrix, RT_invK, C);
+
+    core::Tensor normals({height_px, width_px, 3}, core::Float32);
+    impl_->RenderPinhole(RT_invK, C, width_px, height_px, nullptr,
+                         normals.GetDataPtr<float>(), nullptr, nthreads);
+    return Image(normals);
+}
+
+Image RaycastingScene::RenderPrimitiveIds(const core::Tensor& intrinsic_matrix,
+                                          const core::Tensor& extrinsic_matrix,
+                                          int width_px,
+                                          int height_px,
+                                          const int nthreads) {
+    Eigen::Matrix3f RT_invK;
+    Eigen::Vector3f C;
+    GetPinholeRayParameters(intrinsic_matrix, extrinsic_matrix, RT_invK, C);
+
+    core::Tensor primitive_ids({height_px, width_px, 1}, core::UInt32);
+    impl_->RenderPinhole(RT_invK, C, width_px, height_px, nullptr, nullptr,
+                         primitive_ids.GetDataPtr<uint32_t>(), nthreads);
+    return Image(primitive_ids);
+}
+
 uint32_t RaycastingScene::INVALID_ID() { return RTC_INVALID_GEOMETRY_ID; }
 
 }  // namespace geometry
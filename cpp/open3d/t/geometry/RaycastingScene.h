@@ -30,6 +30,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TriangleMesh.h"
 
@@ -45,7 +46,13 @@ namespace geometry {
 /// or more query points.
 /// It builds an internal acceleration structure to speed up those queries.
 ///
-/// This class supports only the CPU device.
+/// The acceleration structure lives on the CPU and all queries are evaluated
+/// there. Query tensors may be on any device for convenience; they are copied
+/// to the CPU and the results are copied back to the device of the input.
+/// There is no GPU traversal, so CUDA inputs pay for both transfers.
+///
+/// Queries may be issued concurrently from multiple threads. Adding or
+/// removing geometry must not overlap with other calls on the same scene.
 class RaycastingScene {
 public:
     /// \brief Default Constructor.
@@ -65,6 +72,54 @@ public:
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const TriangleMesh &mesh);
 
+    /// \brief Add a triangle mesh as an instance with a transformation.
+    ///
+    /// The mesh is stored in its own acceleration structure. Changing the
+    /// transformation with SetInstanceTransformation() only rebuilds the top
+    /// level structure over the instances, which makes instances suitable for
+    /// moving objects. Static geometry should be added with AddTriangles().
+    /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype float.
+    /// \param triangle_indices Triangles as Tensor of dim {M,3} and dtype
+    /// uint32_t.
+    /// \param transformation The instance to world transformation as Tensor
+    /// with shape {4,4}.
+    /// \return The geometry ID of the added instance.
+    uint32_t AddInstance(const core::Tensor &vertex_positions,
+                         const core::Tensor &triangle_indices,
+                         const core::Tensor &transformation);
+
+    /// \brief Add a triangle mesh as an instance with a transformation.
+    /// \param mesh A triangle mesh.
+    /// \param transformation The instance to world transformation as Tensor
+    /// with shape {4,4}.
+    /// \return The geometry ID of the added instance.
+    uint32_t AddInstance(const TriangleMesh &mesh,
+                         const core::Tensor &transformation);
+
+    /// \brief Sets the transformation of an instance.
+    /// \param geometry_id The ID returned by AddInstance().
+    /// \param transformation The instance to world transformation as Tensor
+    /// with shape {4,4}.
+    void SetInstanceTransformation(uint32_t geometry_id,
+                                   const core::Tensor &transformation);
+
+    /// \brief Updates the vertex positions of a mesh or instance.
+    ///
+    /// The triangles are not changed. The acceleration structure of the mesh
+    /// is refitted instead of rebuilt, which is fast but can reduce the query
+    /// performance for large deformations.
+    /// \param geometry_id The ID returned by AddTriangles() or AddInstance().
+    /// \param vertex_positions Vertices as Tensor of dim {N,3} and dtype float
+    /// with the same number of vertices as the added mesh.
+    void UpdateVertexPositions(uint32_t geometry_id,
+                               const core::Tensor &vertex_positions);
+
+    /// \brief Removes a mesh or instance from the scene.
+    ///
+    /// The ID may be reused by geometries added later.
+    /// \param geometry_id The ID returned by AddTriangles() or AddInstance().
+    void RemoveGeometry(uint32_t geometry_id);
+
     /// \brief Computes the first intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
@@ -75,6 +130,9 @@ public:
     /// necessary to normalize the direction but the returned hit distance uses
     /// the length of the direction vector as unit.
     /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \param coherent If true, the rays are cast in packets of 16 consecutive
+    /// rays. This is faster if consecutive rays are coherent, e.g., for rays
+    /// created with CreateRaysPinhole().
     /// \return The returned dictionary contains:
     ///         - \b t_hit A tensor with the distance to the first hit. The
     ///           shape is {..}. If there is no intersection the hit distance
@@ -89,7 +147,9 @@ public:
     ///         - \b primitive_normals A tensor with the normals of the hit
     ///           triangles. The shape is {.., 3}.
     std::unordered_map<std::string, core::Tensor> CastRays(
-            const core::Tensor &rays, const int nthreads = 0);
+            const core::Tensor &rays,
+            const int nthreads = 0,
+            const bool coherent = false);
 
     /// \brief Checks if the rays have any intersection with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
@@ -221,6 +281,53 @@ public:
                                           int width_px,
                                           int height_px);
 
+    /// \brief Renders a depth image for a pinhole camera.
+    ///
+    /// This is equivalent to casting the rays from CreateRaysPinhole() but
+    /// generates the rays on the fly without allocating a ray tensor and
+    /// casts them in coherent packets.
+    /// \param intrinsic_matrix Intrinsic matrix with shape {3,3}.
+    /// \param extrinsic_matrix Extrinsic matrix with shape {4,4}.
+    /// \param width_px The width of the image in pixels.
+    /// \param height_px The height of the image in pixels.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return A Float32 image with shape {height_px, width_px, 1} with the
+    /// depth along the optical axis. Pixels without a hit are 0.
+    Image RenderDepth(const core::Tensor &intrinsic_matrix,
+                      const core::Tensor &extrinsic_matrix,
+                      int width_px,
+                      int height_px,
+                      const int nthreads = 0);
+
+    /// \brief Renders a normal image for a pinhole camera.
+    /// \param intrinsic_matrix Intrinsic matrix with shape {3,3}.
+    /// \param extrinsic_matrix Extrinsic matrix with shape {4,4}.
+    /// \param width_px The width of the image in pixels.
+    /// \param height_px The height of the image in pixels.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return A Float32 image with shape {height_px, width_px, 3} with the
+    /// normals of the hit triangles in world space. Pixels without a hit are
+    /// 0.
+    Image RenderNormals(const core::Tensor &intrinsic_matrix,
+                        const core::Tensor &extrinsic_matrix,
+                        int width_px,
+                        int height_px,
+                        const int nthreads = 0);
+
+    /// \brief Renders an image with the primitive IDs for a pinhole camera.
+    /// \param intrinsic_matrix Intrinsic matrix with shape {3,3}.
+    /// \param extrinsic_matrix Extrinsic matrix with shape {4,4}.
+    /// \param width_px The width of the image in pixels.
+    /// \param height_px The height of the image in pixels.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return A UInt32 image with shape {height_px, width_px, 1} with the
+    /// IDs of the hit triangles. Pixels without a hit are \a INVALID_ID .
+    Image RenderPrimitiveIds(const core::Tensor &intrinsic_matrix,
+                             const core::Tensor &extrinsic_matrix,
+                             int width_px,
+                             int height_px,
+                             const int nthreads = 0);
+
     /// \brief The value for invalid IDs.
     static uint32_t INVALID_ID();
 
@@ -31,7 +31,9 @@
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/core/kernel/GatherRows.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -90,6 +92,37 @@ TensorMap TensorMap::Contiguous() const {
     return tensor_map_contiguous;
 }
 
+TensorMap TensorMap::IndexGet(const core::Tensor& index) const {
+    TensorMap tensor_map_selected(GetPrimaryKey());
+    if (empty()) {
+        return tensor_map_selected;
+    }
+    AssertPrimaryKeyInMapOrEmpty();
+    AssertSizeSynchronized();
+
+    core::Tensor index_device = index.To(GetPrimaryDevice());
+    if (index_device.GetDtype() == core::Bool) {
+        if (index_device.GetShape() != core::SizeVector{GetPrimarySize()}) {
+            utility::LogError("Mask of shape {} does not match size {}.",
+                              index_device.GetShape(), GetPrimarySize());
+        }
+        index_device = index_device.NonZero()[0];
+    }
+
+    std::vector<std::string> keys;
+    std::vector<core::Tensor> tensors;
+    for (const auto& kv : *this) {
+        keys.push_back(kv.first);
+        tensors.push_back(kv.second);
+    }
+    std::vector<core::Tensor> selected =
+            core::kernel::GatherRows(tensors, index_device);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        tensor_map_selected[keys[i]] = selected[i];
+    }
+    return tensor_map_selected;
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
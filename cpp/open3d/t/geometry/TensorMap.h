@@ -129,6 +129,15 @@ public:
     /// memory will be used.
     TensorMap Contiguous() const;
 
+    /// Returns a new TensorMap with the rows \p index of all tensors. The rows
+    /// of all tensors are gathered with a single kernel launch, instead of one
+    /// IndexGet per tensor.
+    ///
+    /// \param index Int64 1-D tensor of row indices, or a Bool tensor of shape
+    /// {N,} masking the rows, where N is the size of the primary tensor. All
+    /// tensors must have size N.
+    TensorMap IndexGet(const core::Tensor& index) const;
+
     /// Returns true if the key exists in the map.
     /// Same as C++20's std::unordered_map::contains().
     bool Contains(const std::string& key) const { return count(key) != 0; }
@@ -27,15 +27,27 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
 #include <string>
 #include <unordered_map>
 
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/core/linalg/ConjugateGradient.h"
+#include "open3d/core/linalg/SparseMatrix.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
 
 namespace open3d {
 namespace t {
@@ -164,6 +176,760 @@ TriangleMesh &TriangleMesh::Rotate(const core::Tensor &R,
     return *this;
 }
 
+/// Returns the Int64 vertex indices of corner \p corner of all triangles.
+static core::Tensor TriangleCorner(const core::Tensor &indices,
+                                   int64_t corner) {
+    return indices.Slice(1, corner, corner + 1)
+            .To(core::Int64)
+            .Contiguous()
+            .Reshape({indices.GetLength()});
+}
+
+/// Row-wise cross product of two {N, 3} tensors.
+static core::Tensor CrossRows(const core::Tensor &a, const core::Tensor &b) {
+    auto col = [](const core::Tensor &t, int64_t i) {
+        return t.Slice(1, i, i + 1);
+    };
+    return core::Concatenate({col(a, 1) * col(b, 2) - col(a, 2) * col(b, 1),
+                              col(a, 2) * col(b, 0) - col(a, 0) * col(b, 2),
+                              col(a, 0) * col(b, 1) - col(a, 1) * col(b, 0)},
+                             1);
+}
+
+/// Normalizes the rows of a {N, 3} tensor. Rows of zero length are kept.
+static core::Tensor NormalizeRows(const core::Tensor &t) {
+    core::Tensor norms = (t * t).Sum({1}, true).Sqrt();
+    norms.Add_(norms.Eq(0).To(norms.GetDtype()));
+    return t / norms;
+}
+
+/// Returns the unnormalized normals of the triangles of \p mesh, whose
+/// lengths are twice the triangle areas.
+static core::Tensor ComputeTriangleCross(const TriangleMesh &mesh) {
+    const core::Tensor &positions = mesh.GetVertexPositions();
+    const core::Tensor &indices = mesh.GetTriangleIndices();
+    const core::Tensor v0 = positions.IndexGet({TriangleCorner(indices, 0)});
+    const core::Tensor v1 = positions.IndexGet({TriangleCorner(indices, 1)});
+    const core::Tensor v2 = positions.IndexGet({TriangleCorner(indices, 2)});
+    return CrossRows(v1 - v0, v2 - v0);
+}
+
+/// Groups equal rows of \p keys with a hash set. Returns the boolean mask
+/// that selects one row of every group, the Int64 group index of every row,
+/// with groups numbered in the order of the mask, and the number of groups.
+static std::tuple<core::Tensor, core::Tensor, int64_t> GroupEqualRows(
+        const core::Tensor &keys) {
+    const core::Device device = keys.GetDevice();
+    core::HashSet set(keys.GetLength(), keys.GetDtype(), {keys.GetShape(1)},
+                      device);
+    core::Tensor buf_indices, masks;
+    set.Insert(keys, buf_indices, masks);
+
+    const core::Tensor unique_buf_indices =
+            buf_indices.IndexGet({masks}).To(core::Int64);
+    const int64_t num_groups = unique_buf_indices.GetLength();
+    core::Tensor buf_to_group =
+            core::Tensor::Zeros({set.GetCapacity()}, core::Int64, device);
+    buf_to_group.IndexSet({unique_buf_indices},
+                          core::Tensor::Arange(0, num_groups, 1, core::Int64,
+                                               device));
+
+    core::Tensor found;
+    set.Find(keys, buf_indices, found);
+    return std::make_tuple(
+            masks, buf_to_group.IndexGet({buf_indices.To(core::Int64)}),
+            num_groups);
+}
+
+/// Views the bits of a floating point tensor as integers of the same size,
+/// since hash maps only support integer keys. Other dtypes are returned as is.
+static core::Tensor BitsAsInteger(const core::Tensor &t) {
+    core::Dtype dtype = t.GetDtype();
+    if (dtype == core::Float32) {
+        dtype = core::Int32;
+    } else if (dtype == core::Float64) {
+        dtype = core::Int64;
+    } else {
+        return t;
+    }
+    const core::Tensor contiguous = t.Contiguous();
+    return core::Tensor(contiguous.GetShape(), contiguous.GetStrides(),
+                        const_cast<void *>(contiguous.GetDataPtr()), dtype,
+                        contiguous.GetBlob());
+}
+
+/// Maps the triangle indices through \p vertex_map, keeping their dtype.
+static core::Tensor RemapTriangles(const core::Tensor &indices,
+                                   const core::Tensor &vertex_map) {
+    const int64_t num_triangles = indices.GetLength();
+    return vertex_map
+            .IndexGet({indices.To(core::Int64).Contiguous().Reshape(
+                    {num_triangles * 3})})
+            .Reshape({num_triangles, 3})
+            .To(indices.GetDtype());
+}
+
+TriangleMesh &TriangleMesh::ComputeTriangleNormals(bool normalized) {
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        utility::LogWarning("TriangleMesh has no vertices or triangles.");
+        return *this;
+    }
+    core::Tensor normals = ComputeTriangleCross(*this);
+    if (normalized) {
+        normals = NormalizeRows(normals);
+    }
+    SetTriangleNormals(normals);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized) {
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        utility::LogWarning("TriangleMesh has no vertices or triangles.");
+        return *this;
+    }
+    if (!HasTriangleNormals()) {
+        ComputeTriangleNormals(false);
+    }
+    const core::Tensor &indices = GetTriangleIndices();
+    const core::Tensor &triangle_normals = GetTriangleNormals();
+    core::Tensor normals = core::Tensor::Zeros(
+            GetVertexPositions().GetShape(), triangle_normals.GetDtype(),
+            device_);
+    for (int64_t corner = 0; corner < 3; ++corner) {
+        normals.IndexAdd_(0, TriangleCorner(indices, corner),
+                          triangle_normals);
+    }
+    if (normalized) {
+        normals = NormalizeRows(normals);
+        SetTriangleNormals(NormalizeRows(triangle_normals));
+    }
+    SetVertexNormals(normals);
+    return *this;
+}
+
+double TriangleMesh::GetSurfaceArea() const {
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        return 0;
+    }
+    const core::Tensor cross = ComputeTriangleCross(*this);
+    const core::Tensor areas = (cross * cross).Sum({1}).Sqrt() * 0.5;
+    return areas.Sum({0}).To(core::Float64).Item<double>();
+}
+
+std::tuple<core::Tensor, core::Tensor> TriangleMesh::ComputeHalfEdges() const {
+    if (!HasTriangleIndices() || GetTriangleIndices().GetLength() == 0) {
+        return std::make_tuple(
+                core::Tensor::Empty({0, 2}, core::Int64, device_),
+                core::Tensor::Empty({0}, core::Int64, device_));
+    }
+    const core::Tensor indices =
+            GetTriangleIndices().To(core::Int64).Contiguous();
+    const int64_t num_half_edges = indices.GetLength() * 3;
+    const core::Tensor sources = indices.Reshape({num_half_edges});
+    const core::Tensor targets =
+            core::Concatenate({indices.Slice(1, 1, 3), indices.Slice(1, 0, 1)},
+                              1)
+                    .Reshape({num_half_edges});
+    const int64_t num_vertices = sources.Max({0}).Item<int64_t>() + 1;
+
+    // Twins are adjacent once the half-edges are sorted by undirected edge.
+    const core::Tensor swap = sources.Gt(targets).To(core::Int64);
+    const core::Tensor lows = sources - swap * (sources - targets);
+    const core::Tensor keys =
+            lows * num_vertices + (sources + targets - lows);
+    const core::Tensor order = keys.Argsort();
+    const core::Tensor sorted_keys = keys.IndexGet({order});
+    const core::Tensor is_pair =
+            sorted_keys.Slice(0, 0, num_half_edges - 1)
+                    .Eq(sorted_keys.Slice(0, 1, num_half_edges));
+    const core::Tensor first =
+            order.Slice(0, 0, num_half_edges - 1).IndexGet({is_pair});
+    const core::Tensor second =
+            order.Slice(0, 1, num_half_edges).IndexGet({is_pair});
+    // Two half-edges of an edge in the same direction, or more than two
+    // half-edges on an edge.
+    const bool same_direction =
+            first.GetLength() > 0 && sources.IndexGet({first})
+                                             .Eq(sources.IndexGet({second}))
+                                             .Any();
+    const bool has_duplicates =
+            same_direction ||
+            is_pair.Slice(0, 0, num_half_edges - 2)
+                    .LogicalAnd(is_pair.Slice(0, 1, num_half_edges - 1))
+                    .Any();
+    if (has_duplicates) {
+        utility::LogError("ComputeHalfEdges failed. Duplicated half-edges.");
+    }
+
+    core::Tensor twins =
+            core::Tensor::Full({num_half_edges}, -1, core::Int64, device_);
+    twins.IndexSet({first}, second);
+    twins.IndexSet({second}, first);
+    return std::make_tuple(core::Concatenate({sources.Reshape({-1, 1}),
+                                              targets.Reshape({-1, 1})},
+                                             1),
+                           twins);
+}
+
+TriangleMesh TriangleMesh::RemoveDuplicatedVertices() const {
+    if (!HasVertexPositions()) {
+        return Clone();
+    }
+    core::Tensor masks, vertex_map;
+    int64_t num_vertices;
+    std::tie(masks, vertex_map, num_vertices) =
+            GroupEqualRows(BitsAsInteger(GetVertexPositions()));
+
+    TriangleMesh mesh(device_);
+    for (const auto &kv : vertex_attr_.IndexGet(masks)) {
+        mesh.SetVertexAttr(kv.first, kv.second);
+    }
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first == "indices") {
+            mesh.SetTriangleIndices(RemapTriangles(kv.second, vertex_map));
+        } else {
+            mesh.SetTriangleAttr(kv.first, kv.second.Clone());
+        }
+    }
+    utility::LogDebug("[RemoveDuplicatedVertices] {:d} vertices have been "
+                      "removed.",
+                      GetVertexPositions().GetLength() - num_vertices);
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::MergeCloseVertices(double eps) const {
+    if (eps <= 0) {
+        utility::LogError("eps must be positive.");
+    }
+    if (!HasVertexPositions()) {
+        return Clone();
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    const int64_t num_vertices = positions.GetLength();
+    const core::Tensor vertex_indices =
+            core::Tensor::Arange(0, num_vertices, 1, core::Int64, device_);
+    const core::Tensor cells = (positions / eps).Floor().To(core::Int64);
+
+    core::HashSet cell_set(num_vertices, core::Int64, {3}, device_);
+    core::Tensor buf_indices, masks;
+    cell_set.Insert(cells, buf_indices, masks);
+    cell_set.Find(cells, buf_indices, masks);
+
+    // The lowest vertex index of every cell, num_vertices for empty slots.
+    core::Tensor cell_representatives = core::Tensor::Full(
+            {cell_set.GetCapacity()}, num_vertices, core::Int64, device_);
+    cell_representatives.IndexReduce_(0, buf_indices.To(core::Int64),
+                                      vertex_indices, "min");
+
+    // For every vertex, the lowest representative within eps.
+    core::Tensor labels = core::Tensor::Full({num_vertices}, num_vertices,
+                                             core::Int64, device_);
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dz = -1; dz <= 1; ++dz) {
+                const core::Tensor offset = core::Tensor::Init<int64_t>(
+                        {dx, dy, dz}, device_);
+                core::Tensor nb_buf_indices, nb_masks;
+                cell_set.Find(cells + offset, nb_buf_indices, nb_masks);
+                const core::Tensor found = nb_masks.To(core::Int64);
+                const core::Tensor nb_cells =
+                        nb_buf_indices.To(core::Int64) * found;
+                const core::Tensor candidates =
+                        cell_representatives.IndexGet({nb_cells}) * found +
+                        num_vertices * (1 - found);
+                const core::Tensor diff =
+                        positions.IndexGet(
+                                {candidates.Clip(0, num_vertices - 1)}) -
+                        positions;
+                const core::Tensor closer =
+                        (diff * diff)
+                                .Sum({1})
+                                .Le(eps * eps)
+                                .LogicalAnd(candidates.Lt(labels))
+                                .To(core::Int64);
+                labels += (candidates - labels) * closer;
+            }
+        }
+    }
+    // Vertices without a representative in reach keep their own label.
+    const core::Tensor unassigned = labels.Eq(num_vertices).To(core::Int64);
+    labels += (vertex_indices - labels) * unassigned;
+
+    core::Tensor unique_labels, vertex_map, counts;
+    std::tie(unique_labels, vertex_map, counts) =
+            labels.UniqueWithInverseAndCounts();
+    const int64_t num_merged = unique_labels.GetLength();
+
+    TriangleMesh mesh(device_);
+    for (const auto &kv : vertex_attr_) {
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = num_merged;
+        core::Tensor attr =
+                core::Tensor::Zeros(shape, kv.second.GetDtype(), device_);
+        attr.IndexReduce_(0, vertex_map, kv.second, "mean",
+                          /*include_self=*/false);
+        mesh.SetVertexAttr(kv.first, attr);
+    }
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first == "indices") {
+            mesh.SetTriangleIndices(RemapTriangles(kv.second, vertex_map));
+        } else {
+            mesh.SetTriangleAttr(kv.first, kv.second.Clone());
+        }
+    }
+    if (mesh.HasTriangleNormals()) {
+        mesh.ComputeTriangleNormals();
+    }
+    utility::LogDebug("[MergeCloseVertices] merged {:d} vertices.",
+                      num_vertices - num_merged);
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::SimplifyVertexClustering(double voxel_size) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    if (!HasVertexPositions()) {
+        return Clone();
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    const core::Tensor voxel_min_bound = positions.Min({0}) - voxel_size * 0.5;
+    const core::Tensor voxels = ((positions - voxel_min_bound) / voxel_size)
+                                        .Floor()
+                                        .To(core::Int64);
+    core::Tensor masks, vertex_map;
+    int64_t num_vertices;
+    std::tie(masks, vertex_map, num_vertices) = GroupEqualRows(voxels);
+
+    TriangleMesh mesh(device_);
+    for (const auto &kv : vertex_attr_) {
+        core::SizeVector shape = kv.second.GetShape();
+        shape[0] = num_vertices;
+        core::Tensor attr =
+                core::Tensor::Zeros(shape, kv.second.GetDtype(), device_);
+        attr.IndexReduce_(0, vertex_map, kv.second, "mean",
+                          /*include_self=*/false);
+        if (kv.first == "normals") {
+            attr = NormalizeRows(attr);
+        }
+        mesh.SetVertexAttr(kv.first, attr);
+    }
+
+    if (HasTriangleIndices()) {
+        const core::Tensor triangles =
+                RemapTriangles(GetTriangleIndices(), vertex_map);
+        const core::Tensor t0 = triangles.Slice(1, 0, 1);
+        const core::Tensor t1 = triangles.Slice(1, 1, 2);
+        const core::Tensor t2 = triangles.Slice(1, 2, 3);
+        const core::Tensor valid = t0.Ne(t1)
+                                           .LogicalAnd(t1.Ne(t2))
+                                           .LogicalAnd(t2.Ne(t0))
+                                           .Reshape({triangles.GetLength()});
+        for (const auto &kv : triangle_attr_) {
+            if (kv.first == "indices") {
+                mesh.SetTriangleIndices(triangles.IndexGet({valid}));
+            } else {
+                mesh.SetTriangleAttr(kv.first, kv.second.IndexGet({valid}));
+            }
+        }
+    }
+    return mesh;
+}
+
+PointCloud TriangleMesh::SamplePointsUniformly(int64_t number_of_points,
+                                               bool use_triangle_normal,
+                                               int seed) const {
+    if (number_of_points <= 0) {
+        utility::LogError("number_of_points must be positive.");
+    }
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        utility::LogError("TriangleMesh has no vertices or triangles.");
+    }
+    const core::Tensor cross = ComputeTriangleCross(*this);
+    const core::Tensor areas =
+            (cross * cross).Sum({1}).Sqrt().To(core::Float64).Contiguous();
+    const double surface_area = areas.Sum({0}).Item<double>();
+    if (surface_area <= 0) {
+        utility::LogError("Invalid surface area {}, it must be > 0.",
+                          surface_area * 0.5);
+    }
+    if (seed == -1) {
+        std::random_device rd;
+        seed = rd();
+    }
+
+    core::Tensor triangles, weights;
+    const core::Device::DeviceType device_type = device_.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        kernel::trianglemesh::SampleTrianglesCPU(
+                areas, number_of_points, uint64_t(seed), triangles, weights);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(kernel::trianglemesh::SampleTrianglesCUDA, areas,
+                  number_of_points, uint64_t(seed), triangles, weights);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    const core::Dtype float_dtype = GetVertexPositions().GetDtype();
+    weights = weights.To(float_dtype);
+    const core::Tensor corners = GetTriangleIndices().IndexGet({triangles});
+    auto interpolate = [&](const core::Tensor &attr) {
+        const core::Tensor attr_f = attr.To(float_dtype);
+        core::Tensor result;
+        for (int64_t corner = 0; corner < 3; ++corner) {
+            core::Tensor term =
+                    attr_f.IndexGet({TriangleCorner(corners, corner)}) *
+                    weights.Slice(1, corner, corner + 1);
+            result = corner == 0 ? term : result + term;
+        }
+        return result.To(attr.GetDtype());
+    };
+
+    PointCloud pcd(interpolate(GetVertexPositions()));
+    if (use_triangle_normal) {
+        const core::Tensor triangle_normals =
+                HasTriangleNormals() ? GetTriangleNormals()
+                                     : NormalizeRows(cross);
+        pcd.SetPointNormals(triangle_normals.IndexGet({triangles}));
+    } else if (HasVertexNormals()) {
+        pcd.SetPointNormals(interpolate(GetVertexNormals()));
+    }
+    if (HasVertexColors()) {
+        pcd.SetPointColors(interpolate(GetVertexColors()));
+    }
+    return pcd;
+}
+
+PointCloud TriangleMesh::SamplePointsPoissonDisk(int64_t number_of_points,
+                                                 double init_factor,
+                                                 bool use_triangle_normal,
+                                                 int seed) const {
+    if (number_of_points <= 0) {
+        utility::LogError("number_of_points must be positive.");
+    }
+    if (init_factor < 1) {
+        utility::LogError("init_factor must be >= 1, but got {}.",
+                          init_factor);
+    }
+    if (seed == -1) {
+        std::random_device rd;
+        seed = rd();
+    }
+    const PointCloud candidates = SamplePointsUniformly(
+            int64_t(init_factor * number_of_points), use_triangle_normal,
+            seed);
+    const core::Tensor &positions = candidates.GetPointPositions();
+
+    // Start with the radius of the densest packing of the disks, as the
+    // legacy sample elimination, and shrink it until enough darts stick.
+    // The last attempt accepts all candidates.
+    static constexpr int kMaxAttempts = 8;
+    double radius = 2 * std::sqrt((GetSurfaceArea() / number_of_points) /
+                                  (2 * std::sqrt(3.)));
+    core::Tensor selected;
+    for (int attempt = 0; attempt < kMaxAttempts; ++attempt) {
+        if (attempt + 1 == kMaxAttempts) {
+            radius = 0;
+        }
+        core::Tensor priorities, accepted;
+        const core::Device::DeviceType device_type = device_.GetType();
+        if (device_type == core::Device::DeviceType::CPU) {
+            kernel::trianglemesh::ThrowDartsCPU(positions, radius,
+                                                uint64_t(seed) + 1, priorities,
+                                                accepted);
+        } else if (device_type == core::Device::DeviceType::CUDA) {
+            CUDA_CALL(kernel::trianglemesh::ThrowDartsCUDA, positions, radius,
+                      uint64_t(seed) + 1, priorities, accepted);
+        } else {
+            utility::LogError("Unimplemented device");
+        }
+        const core::Tensor indices = accepted.NonZero().Reshape({-1});
+        const int64_t num_accepted = indices.GetLength();
+        if (num_accepted >= number_of_points) {
+            // The first darts that stick when thrown in the order of the
+            // priorities.
+            const core::Tensor order =
+                    core::kernel::Argsort(priorities.IndexGet({indices}).Neg());
+            selected = indices.IndexGet(
+                    {order.Slice(0, 0, number_of_points)});
+            break;
+        }
+        radius *= 0.95 * std::max(0.25, std::sqrt(double(num_accepted) /
+                                                  number_of_points));
+    }
+
+    PointCloud pcd(device_);
+    for (const auto &kv : candidates.GetPointAttr()) {
+        pcd.SetPointAttr(kv.first, kv.second.IndexGet({selected}));
+    }
+    return pcd;
+}
+
+/// Returns the directed edges (sources, targets) between adjacent vertices,
+/// each undirected edge once in both directions.
+static std::tuple<core::Tensor, core::Tensor> ComputeAdjacencyEdges(
+        const core::Tensor &indices, int64_t num_vertices) {
+    std::vector<core::Tensor> sources, targets;
+    for (int64_t corner = 0; corner < 3; ++corner) {
+        const core::Tensor a = TriangleCorner(indices, corner);
+        const core::Tensor b = TriangleCorner(indices, (corner + 1) % 3);
+        sources.push_back(a);
+        targets.push_back(b);
+        sources.push_back(b);
+        targets.push_back(a);
+    }
+    // Edges shared by two triangles are kept once.
+    const core::Tensor keys = (core::Concatenate(sources) * num_vertices +
+                               core::Concatenate(targets))
+                                      .Unique();
+    const core::Tensor edge_sources = keys / num_vertices;
+    return std::make_tuple(edge_sources, keys - edge_sources * num_vertices);
+}
+
+/// Returns the keys of the vertex attributes filtered with \p scope.
+static std::vector<std::string> GetFilterKeys(
+        const TriangleMesh &mesh,
+        open3d::geometry::MeshBase::FilterScope scope) {
+    using FilterScope = open3d::geometry::MeshBase::FilterScope;
+    std::vector<std::string> keys;
+    if (scope == FilterScope::All || scope == FilterScope::Vertex) {
+        keys.push_back("positions");
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Normal) &&
+        mesh.HasVertexNormals()) {
+        keys.push_back("normals");
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Color) &&
+        mesh.HasVertexColors()) {
+        keys.push_back("colors");
+    }
+    return keys;
+}
+
+/// One step of the Laplacian filter of the legacy TriangleMesh: every
+/// attribute moves towards the average of its neighbors, weighted by their
+/// inverse distance. Vertices without neighbors are kept.
+static void FilterSmoothLaplacianStep(TriangleMesh &mesh,
+                                      const core::Tensor &sources,
+                                      const core::Tensor &targets,
+                                      double lambda,
+                                      const std::vector<std::string> &keys) {
+    const core::Tensor &positions = mesh.GetVertexPositions();
+    const core::Tensor diff =
+            positions.IndexGet({sources}) - positions.IndexGet({targets});
+    const core::Tensor weights =
+            1.0 / ((diff * diff).Sum({1}, true).Sqrt() + 1e-12);
+    core::Tensor total_weights = core::Tensor::Zeros(
+            {positions.GetLength(), 1}, weights.GetDtype(), mesh.GetDevice());
+    total_weights.IndexAdd_(0, sources, weights);
+    const core::Tensor has_neighbors =
+            total_weights.Gt(0).To(weights.GetDtype());
+    total_weights.Add_(total_weights.Eq(0).To(weights.GetDtype()));
+
+    for (const std::string &key : keys) {
+        const core::Tensor attr = mesh.GetVertexAttr(key);
+        const core::Dtype dtype = attr.GetDtype();
+        core::Tensor weighted_sum =
+                core::Tensor::Zeros(attr.GetShape(), dtype, mesh.GetDevice());
+        weighted_sum.IndexAdd_(
+                0, sources, attr.IndexGet({targets}) * weights.To(dtype));
+        const core::Tensor average = weighted_sum / total_weights.To(dtype);
+        const core::Tensor step = (average - attr) * has_neighbors.To(dtype);
+        mesh.SetVertexAttr(key, attr + step * lambda);
+    }
+}
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(
+        int number_of_iterations,
+        double lambda,
+        open3d::geometry::MeshBase::FilterScope scope) const {
+    TriangleMesh mesh = Clone();
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        return mesh;
+    }
+    core::Tensor sources, targets;
+    std::tie(sources, targets) = ComputeAdjacencyEdges(
+            GetTriangleIndices(), GetVertexPositions().GetLength());
+    const std::vector<std::string> keys = GetFilterKeys(mesh, scope);
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        FilterSmoothLaplacianStep(mesh, sources, targets, lambda, keys);
+    }
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(
+        int number_of_iterations,
+        double lambda,
+        double mu,
+        open3d::geometry::MeshBase::FilterScope scope) const {
+    TriangleMesh mesh = Clone();
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        return mesh;
+    }
+    core::Tensor sources, targets;
+    std::tie(sources, targets) = ComputeAdjacencyEdges(
+            GetTriangleIndices(), GetVertexPositions().GetLength());
+    const std::vector<std::string> keys = GetFilterKeys(mesh, scope);
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        FilterSmoothLaplacianStep(mesh, sources, targets, lambda, keys);
+        FilterSmoothLaplacianStep(mesh, sources, targets, mu, keys);
+    }
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::DeformAsRigidAsPossible(
+        const core::Tensor &constraint_vertex_indices,
+        const core::Tensor &constraint_vertex_positions,
+        int64_t max_iter,
+        open3d::geometry::MeshBase::DeformAsRigidAsPossibleEnergy energy,
+        double smoothed_alpha) const {
+    if (!HasVertexPositions() || !HasTriangleIndices()) {
+        utility::LogError("TriangleMesh has no vertices or triangles.");
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    const core::Dtype dtype = positions.GetDtype();
+    const int64_t num_vertices = positions.GetLength();
+    const int64_t num_constraints = constraint_vertex_indices.GetLength();
+    core::AssertTensorDevice(constraint_vertex_indices, device_);
+    core::AssertTensorShape(constraint_vertex_indices, {num_constraints});
+    core::AssertTensorDevice(constraint_vertex_positions, device_);
+    core::AssertTensorShape(constraint_vertex_positions, {num_constraints, 3});
+    const core::Tensor constraint_indices =
+            constraint_vertex_indices.To(core::Int64);
+    const core::Tensor constraint_positions =
+            constraint_vertex_positions.To(dtype);
+    const core::Tensor vertices = positions.Contiguous();
+
+    // Cotangent weights of the directed edges, averaged over the triangles
+    // of every edge and clamped at 0 as in the legacy implementation.
+    const core::Tensor &indices = GetTriangleIndices();
+    std::vector<core::Tensor> rows, cols, cots;
+    for (int64_t corner = 0; corner < 3; ++corner) {
+        const core::Tensor a = TriangleCorner(indices, corner);
+        const core::Tensor b = TriangleCorner(indices, (corner + 1) % 3);
+        const core::Tensor opposite =
+                vertices.IndexGet({TriangleCorner(indices, (corner + 2) % 3)});
+        const core::Tensor ea = vertices.IndexGet({a}) - opposite;
+        const core::Tensor eb = vertices.IndexGet({b}) - opposite;
+        const core::Tensor cross = CrossRows(ea, eb);
+        const core::Tensor cot =
+                (ea * eb).Sum({1}) / (cross * cross).Sum({1}).Sqrt();
+        rows.insert(rows.end(), {a, b});
+        cols.insert(cols.end(), {b, a});
+        cots.insert(cots.end(), {cot, cot});
+    }
+    core::Tensor sorted_keys, sorted_cots;
+    std::tie(sorted_keys, sorted_cots) = core::Tensor::SortByKey(
+            core::Concatenate(rows) * num_vertices + core::Concatenate(cols),
+            core::Concatenate(cots));
+    core::Tensor group_ids, splits;
+    core::kernel::SortedGroups(sorted_keys, group_ids, splits);
+    const int64_t num_edges = splits.GetLength() - 1;
+    const core::Tensor edge_keys =
+            sorted_keys.IndexGet({splits.Slice(0, 0, num_edges)});
+    const core::Tensor edge_rows = edge_keys / num_vertices;
+    const core::Tensor edge_cols = edge_keys - edge_rows * num_vertices;
+    const core::Tensor counts =
+            splits.Slice(0, 1, num_edges + 1) - splits.Slice(0, 0, num_edges);
+    const core::Tensor weights =
+            (sorted_cots.SegmentSum(splits) / counts.To(dtype))
+                    .Clip(0, std::numeric_limits<double>::max());
+    const core::Tensor offsets =
+            core::SparseMatrix::FromCOO(edge_rows, edge_cols, weights,
+                                        num_vertices, num_vertices)
+                    .GetRowOffsets();
+
+    // The constrained vertices are eliminated, which leaves the symmetric
+    // positive definite Laplacian of the free vertices. The conjugate
+    // gradient solves are warm started from the previous iteration.
+    core::Tensor is_free =
+            core::Tensor::Ones({num_vertices}, core::Bool, device_);
+    is_free.IndexSet({constraint_indices},
+                     core::Tensor::Zeros({num_constraints}, core::Bool,
+                                         device_));
+    const core::Tensor free_vertices = is_free.NonZero().Reshape({-1});
+    const int64_t num_free = free_vertices.GetLength();
+    core::Tensor free_index =
+            core::Tensor::Full({num_vertices}, -1, core::Int64, device_);
+    free_index.IndexSet(
+            {free_vertices},
+            core::Tensor::Arange(0, num_free, 1, core::Int64, device_));
+    const core::Tensor row_free = is_free.IndexGet({edge_rows});
+    const core::Tensor col_free = is_free.IndexGet({edge_cols});
+    const core::Tensor both_free = row_free.LogicalAnd(col_free);
+    const core::Tensor diagonal =
+            free_index.IndexGet({edge_rows.IndexGet({row_free})});
+    const core::SparseMatrix A = core::SparseMatrix::FromCOO(
+            core::Concatenate(
+                    {diagonal,
+                     free_index.IndexGet({edge_rows.IndexGet({both_free})})}),
+            core::Concatenate(
+                    {diagonal,
+                     free_index.IndexGet({edge_cols.IndexGet({both_free})})}),
+            core::Concatenate({weights.IndexGet({row_free}),
+                               weights.IndexGet({both_free}).Neg()}),
+            num_free, num_free);
+    const core::Tensor to_constraint =
+            row_free.LogicalAnd(col_free.LogicalNot());
+    core::Tensor targets = vertices.Clone();
+    targets.IndexSet({constraint_indices}, constraint_positions);
+    core::Tensor b_constraints =
+            core::Tensor::Zeros({num_free, 3}, dtype, device_);
+    b_constraints.IndexAdd_(
+            0, free_index.IndexGet({edge_rows.IndexGet({to_constraint})}),
+            targets.IndexGet({edge_cols.IndexGet({to_constraint})}) *
+                    weights.IndexGet({to_constraint}).Reshape({-1, 1}));
+
+    const bool smoothed =
+            energy ==
+            open3d::geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    const double smoothed_weight =
+            smoothed ? 4 * smoothed_alpha * GetSurfaceArea() : 0;
+    const double tolerance = dtype == core::Float64 ? 1e-10 : 1e-6;
+    const core::Device::DeviceType device_type = device_.GetType();
+    core::Tensor deformed = vertices.Clone();
+    core::Tensor rotations, rhs;
+    for (int64_t iter = 0; iter < max_iter; ++iter) {
+        const core::Tensor rotations_old =
+                smoothed && iter > 0 ? rotations : core::Tensor();
+        if (device_type == core::Device::DeviceType::CPU) {
+            kernel::trianglemesh::ComputeARAPRotationsCPU(
+                    offsets, edge_cols, weights, vertices, deformed,
+                    rotations_old, smoothed_weight, rotations);
+            kernel::trianglemesh::ComputeARAPRhsCPU(
+                    offsets, edge_cols, weights, vertices, rotations, rhs);
+        } else if (device_type == core::Device::DeviceType::CUDA) {
+            CUDA_CALL(kernel::trianglemesh::ComputeARAPRotationsCUDA, offsets,
+                      edge_cols, weights, vertices, deformed, rotations_old,
+                      smoothed_weight, rotations);
+            CUDA_CALL(kernel::trianglemesh::ComputeARAPRhsCUDA, offsets,
+                      edge_cols, weights, vertices, rotations, rhs);
+        } else {
+            utility::LogError("Unimplemented device");
+        }
+
+        if (num_free > 0) {
+            const core::Tensor b =
+                    rhs.IndexGet({free_vertices}) + b_constraints;
+            const core::Tensor x0 = deformed.IndexGet({free_vertices});
+            std::vector<core::Tensor> x;
+            for (int64_t comp = 0; comp < 3; ++comp) {
+                auto column = [&](const core::Tensor &t) {
+                    return t.Slice(1, comp, comp + 1)
+                            .Contiguous()
+                            .Reshape({num_free});
+                };
+                x.push_back(core::SolveCG(A, column(b), column(x0), tolerance)
+                                    .Reshape({num_free, 1}));
+            }
+            deformed.IndexSet({free_vertices}, core::Concatenate(x, 1));
+        }
+        deformed.IndexSet({constraint_indices}, constraint_positions);
+    }
+
+    return TriangleMesh(deformed, GetTriangleIndices());
+}
+
 geometry::TriangleMesh TriangleMesh::FromLegacy(
         const open3d::geometry::TriangleMesh &mesh_legacy,
         core::Dtype float_dtype,
@@ -253,6 +1019,35 @@ TriangleMesh TriangleMesh::To(const core::Device &device, bool copy) const {
     return mesh;
 }
 
+std::tuple<TriangleMesh, core::Tensor>
+TriangleMesh::CreateFromPointCloudPoisson(
+        const PointCloud &pcd,
+        size_t depth,
+        size_t width,
+        float scale,
+        bool linear_fit,
+        int n_threads,
+        const open3d::geometry::PoissonReconstructionOption &option) {
+    if (!pcd.HasPointNormals()) {
+        utility::LogError("[CreateFromPointCloudPoisson] pcd has no normals");
+    }
+    std::shared_ptr<open3d::geometry::TriangleMesh> mesh_legacy;
+    std::vector<double> densities;
+    std::tie(mesh_legacy, densities) =
+            open3d::geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd.ToLegacy(), depth, width, scale, linear_fit, n_threads,
+                    option);
+
+    const core::Dtype float_dtype = pcd.GetPointPositions().GetDtype();
+    const core::Device device = pcd.GetDevice();
+    TriangleMesh mesh =
+            FromLegacy(*mesh_legacy, float_dtype, core::Int64, device);
+    core::Tensor densities_tensor =
+            core::Tensor(densities, {int64_t(densities.size())}, core::Float64)
+                    .To(device, float_dtype);
+    return std::make_tuple(mesh, densities_tensor);
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -37,6 +39,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class PointCloud;
+
 /// \class TriangleMesh
 /// \brief A triangle mesh contains vertices and triangles.
 ///
@@ -428,6 +432,148 @@ public:
     /// \return Rotated TriangleMesh
     TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center);
 
+    /// \brief Computes the triangle normals on the device of the mesh.
+    /// \param normalized If true, the normals are normalized to unit length.
+    /// Otherwise their length is twice the triangle area.
+    TriangleMesh &ComputeTriangleNormals(bool normalized = true);
+
+    /// \brief Computes the vertex normals as the sum of the normals of the
+    /// adjacent triangles, which are computed if missing.
+    /// \param normalized If true, the vertex and triangle normals are
+    /// normalized to unit length.
+    TriangleMesh &ComputeVertexNormals(bool normalized = true);
+
+    /// Returns the sum of the triangle areas.
+    double GetSurfaceArea() const;
+
+    /// \brief Computes the half-edges of the mesh with the layout of
+    /// open3d::geometry::HalfEdgeTriangleMesh: half-edge 3 * i + j goes from
+    /// corner j to corner (j + 1) % 3 of triangle i, and its next half-edge is
+    /// 3 * i + (j + 1) % 3. Twins are matched by sorting the edges on the
+    /// device of the mesh. Unlike the legacy conversion, the mesh is not
+    /// purged first. Throws if an edge has two half-edges in the same
+    /// direction, i.e. if the mesh is not an oriented manifold.
+    /// \return The {3 * num_triangles, 2} Int64 vertex indices of the
+    /// half-edges and the {3 * num_triangles} Int64 indices of their twins,
+    /// -1 for boundary half-edges.
+    std::tuple<core::Tensor, core::Tensor> ComputeHalfEdges() const;
+
+    /// \brief Returns a mesh in which vertices with bitwise identical positions
+    /// are merged. The other vertex attributes are taken from one of the merged
+    /// vertices and the triangle indices are remapped.
+    ///
+    /// Vertices are matched with a hash set on the device of the mesh, so the
+    /// order of the remaining vertices may differ from the legacy
+    /// implementation.
+    TriangleMesh RemoveDuplicatedVertices() const;
+
+    /// \brief Returns a mesh in which vertices closer than \p eps are welded.
+    ///
+    /// Vertices are binned into a spatial hash set with cells of size \p eps.
+    /// The lowest-indexed vertex of every cell represents the cell, and each
+    /// vertex is merged with the lowest-indexed representative within \p eps
+    /// in the 27 neighboring cells. The merged vertex attributes are
+    /// averaged, triangle indices are remapped and triangle normals are
+    /// recomputed if present. Unlike the legacy implementation, merging is
+    /// not transitive: a vertex joins a representative, not the group of a
+    /// neighbor.
+    /// \param eps Maximum distance of welded vertices, must be positive.
+    TriangleMesh MergeCloseVertices(double eps) const;
+
+    /// \brief Returns a mesh in which all vertices that fall into the same
+    /// voxel are replaced by their average. Vertex normals are renormalized,
+    /// and triangles that become degenerate are removed together with their
+    /// attributes.
+    /// \param voxel_size Edge length of the voxels, must be positive.
+    TriangleMesh SimplifyVertexClustering(double voxel_size) const;
+
+    /// \brief Samples points uniformly from the surface of the mesh.
+    ///
+    /// Triangles are drawn in parallel on the device of the mesh with a
+    /// prefix sum of their areas, and every triangle gets a number of samples
+    /// proportional to its area.
+    /// \param number_of_points Number of points to sample.
+    /// \param use_triangle_normal If true, the sampled points get the normal
+    /// of their triangle. Otherwise vertex normals are interpolated if
+    /// present.
+    /// \param seed Seed of the random generator. -1 draws a random seed.
+    PointCloud SamplePointsUniformly(int64_t number_of_points,
+                                     bool use_triangle_normal = false,
+                                     int seed = -1) const;
+
+    /// \brief Samples points from the surface of the mesh such that no two
+    /// points are closer than a radius, see Yuksel, "Sample Elimination for
+    /// Generating Poisson Disk Sample Sets", EUROGRAPHICS, 2015.
+    ///
+    /// Instead of the serial sample elimination of the legacy implementation,
+    /// uniform samples are thinned by parallel dart throwing in a grid, on the
+    /// device of the mesh. The radius starts at the one of the densest
+    /// packing and shrinks until enough darts stick.
+    /// \param number_of_points Number of points to sample.
+    /// \param init_factor Factor for the number of uniform samples that are
+    /// thinned, must be >= 1.
+    /// \param use_triangle_normal If true, the sampled points get the normal
+    /// of their triangle. Otherwise vertex normals are interpolated if
+    /// present.
+    /// \param seed Seed of the random generator. -1 draws a random seed.
+    PointCloud SamplePointsPoissonDisk(int64_t number_of_points,
+                                       double init_factor = 5,
+                                       bool use_triangle_normal = false,
+                                       int seed = -1) const;
+
+    /// \brief Returns a mesh smoothed with the Laplacian filter. Each vertex
+    /// moves towards the average of its neighbors, weighted by their inverse
+    /// distance.
+    /// \param number_of_iterations Number of smoothing iterations.
+    /// \param lambda Filter parameter.
+    /// \param scope Vertex attributes that are filtered.
+    TriangleMesh FilterSmoothLaplacian(
+            int number_of_iterations,
+            double lambda = 0.5,
+            open3d::geometry::MeshBase::FilterScope scope =
+                    open3d::geometry::MeshBase::FilterScope::All) const;
+
+    /// \brief Returns a mesh smoothed with the Taubin filter, which alternates
+    /// Laplacian steps with \p lambda and \p mu to avoid shrinkage. See
+    /// Taubin, "Curve and Surface Smoothing Without Shrinkage", 1995.
+    /// \param number_of_iterations Number of smoothing iterations.
+    /// \param lambda Filter parameter.
+    /// \param mu Filter parameter.
+    /// \param scope Vertex attributes that are filtered.
+    TriangleMesh FilterSmoothTaubin(
+            int number_of_iterations,
+            double lambda = 0.5,
+            double mu = -0.53,
+            open3d::geometry::MeshBase::FilterScope scope =
+                    open3d::geometry::MeshBase::FilterScope::All) const;
+
+    /// \brief Deforms the mesh with the method of Sorkine and Alexa,
+    /// "As-Rigid-As-Possible Surface Modeling", 2007.
+    ///
+    /// Unlike the legacy implementation, which factorizes the system on the
+    /// CPU, the rotations are fitted with one closed-form 3x3 SVD per vertex
+    /// and the positions are solved with the preconditioned conjugate
+    /// gradient method, warm started from the previous iteration, all on the
+    /// device of the mesh. The constrained vertices are eliminated from the
+    /// system, so that it stays symmetric positive definite.
+    /// \param constraint_vertex_indices Int tensor of shape {K} with the
+    /// indices of the constrained vertices.
+    /// \param constraint_vertex_positions Tensor of shape {K, 3} with their
+    /// positions.
+    /// \param max_iter Number of iterations.
+    /// \param energy Energy model that is minimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed energy.
+    /// \return The deformed mesh with the vertex positions and triangle
+    /// indices of this mesh.
+    TriangleMesh DeformAsRigidAsPossible(
+            const core::Tensor &constraint_vertex_indices,
+            const core::Tensor &constraint_vertex_positions,
+            int64_t max_iter,
+            open3d::geometry::MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                    open3d::geometry::MeshBase::DeformAsRigidAsPossibleEnergy::
+                            Spokes,
+            double smoothed_alpha = 0.01) const;
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
@@ -446,6 +592,37 @@ public:
     /// Convert to a legacy Open3D TriangleMesh.
     open3d::geometry::TriangleMesh ToLegacy() const;
 
+    /// \brief Computes a triangle mesh from an oriented point cloud with the
+    /// Screened Poisson Surface Reconstruction of Kazhdan and Hoppe, 2013.
+    ///
+    /// The reconstruction runs on the CPU with the multithreaded
+    /// implementation of open3d::geometry::TriangleMesh, and the result is
+    /// returned on the device of \p pcd with the dtype of its positions.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// \param depth Maximum depth of the tree that will be used for surface
+    /// reconstruction.
+    /// \param width Target width of the finest level octree cells. Ignored if
+    /// depth is specified.
+    /// \param scale Ratio between the diameter of the cube used for
+    /// reconstruction and the diameter of the samples' bounding cube.
+    /// \param linear_fit If true, the reconstructor uses linear interpolation
+    /// to estimate the positions of iso-vertices.
+    /// \param n_threads Number of threads used for reconstruction. Set to -1
+    /// to automatically determine it.
+    /// \param option Octree and solver settings.
+    /// \return The mesh and a tensor of shape {V,} with the per vertex
+    /// densities, which can be used to trim the mesh.
+    static std::tuple<TriangleMesh, core::Tensor> CreateFromPointCloudPoisson(
+            const PointCloud &pcd,
+            size_t depth = 8,
+            size_t width = 0,
+            float scale = 1.1f,
+            bool linear_fit = false,
+            int n_threads = -1,
+            const open3d::geometry::PoissonReconstructionOption &option =
+                    open3d::geometry::PoissonReconstructionOption());
+
 protected:
     core::Device device_ = core::Device("CPU:0");
     TensorMap vertex_attr_;
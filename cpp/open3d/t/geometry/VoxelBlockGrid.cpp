@@ -26,7 +26,12 @@
 
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
+#include <algorithm>
+#include <map>
+#include <set>
+
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/Utility.h"
@@ -34,6 +39,8 @@
 #include "open3d/t/geometry/kernel/VoxelBlockGrid.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -70,6 +77,105 @@ static std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
                           masks_nb.View({27, n, 1}));
 }
 
+/// Converts (27, N, 1) neighbor lookups to (N, 27) buffer indices, with -1
+/// for unallocated neighbors.
+static core::Tensor EncodeNeighborBlocks(const core::Tensor &nb_buf_indices,
+                                         const core::Tensor &nb_masks) {
+    int64_t n = nb_buf_indices.GetShape()[1];
+    core::Tensor masks = nb_masks.To(core::Int32);
+    core::Tensor encoded = nb_buf_indices.Mul(masks).Add(masks).Sub(1);
+    return encoded.View({27, n}).T().Contiguous();
+}
+
+/// Index of the neighbor that sees a block as its neighbor nb, i.e. the
+/// offset in the opposite direction.
+static core::Tensor OppositeNeighbors(const core::Device &device) {
+    return core::Tensor::Arange(0, 27, 1, core::Int64, device).Mul(-1).Add(26);
+}
+
+/// Splits a mesh into one mesh per block, given the (T,) index in
+/// [0, num_blocks) of the block owning each triangle. Vertices shared by
+/// several blocks are duplicated, so that each mesh stands on its own.
+static std::vector<TriangleMesh> SplitTriangleMeshByBlock(
+        const TriangleMesh &mesh,
+        const core::Tensor &triangle_block_indices,
+        int64_t num_blocks) {
+    core::Device device = mesh.GetDevice();
+    core::Device host("CPU:0");
+
+    core::Tensor triangles =
+            mesh.GetTriangleIndices().To(host, core::Int32).Contiguous();
+    core::Tensor owners =
+            triangle_block_indices.To(host, core::Int32).Contiguous();
+    const int *triangles_ptr = triangles.GetDataPtr<int>();
+    const int *owners_ptr = owners.GetDataPtr<int>();
+    int64_t num_triangles = triangles.GetLength();
+
+    std::unordered_map<std::string, core::Tensor> vertex_attrs;
+    for (const auto &kv : mesh.GetVertexAttr()) {
+        vertex_attrs.emplace(kv.first, kv.second.To(host));
+    }
+    int64_t num_vertices = mesh.GetVertexPositions().GetLength();
+
+    // Bucket the triangles by block.
+    std::vector<int64_t> offsets(num_blocks + 1, 0);
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        ++offsets[owners_ptr[i] + 1];
+    }
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        offsets[b + 1] += offsets[b];
+    }
+    std::vector<int64_t> order(num_triangles);
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    for (int64_t i = 0; i < num_triangles; ++i) {
+        order[cursors[owners_ptr[i]]++] = i;
+    }
+
+    std::vector<TriangleMesh> chunks;
+    chunks.reserve(num_blocks);
+    std::vector<int> local_indices(num_vertices, -1);
+    for (int64_t b = 0; b < num_blocks; ++b) {
+        std::vector<int64_t> vertex_ids;
+        std::vector<int> chunk_triangles;
+        for (int64_t i = offsets[b]; i < offsets[b + 1]; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                int v = triangles_ptr[3 * order[i] + k];
+                if (local_indices[v] < 0) {
+                    local_indices[v] = static_cast<int>(vertex_ids.size());
+                    vertex_ids.push_back(v);
+                }
+                chunk_triangles.push_back(local_indices[v]);
+            }
+        }
+        for (int64_t v : vertex_ids) {
+            local_indices[v] = -1;
+        }
+
+        int64_t chunk_num_vertices = static_cast<int64_t>(vertex_ids.size());
+        int64_t chunk_num_triangles =
+                static_cast<int64_t>(chunk_triangles.size()) / 3;
+        core::Tensor vertex_ids_t(vertex_ids, {chunk_num_vertices},
+                                  core::Int64, host);
+        TriangleMesh chunk(device);
+        for (const auto &kv : vertex_attrs) {
+            core::SizeVector shape = kv.second.GetShape();
+            shape[0] = chunk_num_vertices;
+            chunk.SetVertexAttr(
+                    kv.first,
+                    chunk_num_vertices > 0
+                            ? kv.second.IndexGet({vertex_ids_t}).To(device)
+                            : core::Tensor(shape, kv.second.GetDtype(),
+                                           device));
+        }
+        chunk.SetTriangleIndices(
+                core::Tensor(chunk_triangles, {chunk_num_triangles, 3},
+                             core::Int32, host)
+                        .To(device));
+        chunks.push_back(chunk);
+    }
+    return chunks;
+}
+
 static TensorMap ConstructTensorMap(
         const core::HashMap &block_hashmap,
         std::unordered_map<std::string, int> name_attr_map) {
@@ -291,9 +397,10 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                const core::Tensor &intrinsic,
                                const core::Tensor &extrinsic,
                                float depth_scale,
-                               float depth_max) {
+                               float depth_max,
+                               float trunc_voxel_multiplier) {
     Integrate(block_coords, depth, Image(), intrinsic, extrinsic, depth_scale,
-              depth_max);
+              depth_max, trunc_voxel_multiplier);
 }
 
 void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
@@ -302,7 +409,9 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                const core::Tensor &intrinsic,
                                const core::Tensor &extrinsic,
                                float depth_scale,
-                               float depth_max) {
+                               float depth_max,
+                               float trunc_voxel_multiplier) {
+    OPEN3D_PROFILE_ZONE("geometry", "VoxelBlockGrid::Integrate");
     AssertInitialized();
     bool integrate_color = color.AsTensor().NumElements() > 0;
 
@@ -315,21 +424,190 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
     CheckExtrinsicTensor(extrinsic);
 
     core::Tensor buf_indices, masks;
+    const bool nb_block_table_valid = IsNeighborBlockTableValid();
     block_hashmap_->Activate(block_coords, buf_indices, masks);
+    if (nb_block_table_valid) {
+        UpdateNeighborBlockTable(buf_indices.IndexGet({masks}));
+    }
     block_hashmap_->Find(block_coords, buf_indices, masks);
+    MarkBlocksDirty(buf_indices.IndexGet({masks}));
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
 
-    float trunc_multiplier = block_resolution_ * 0.5;
+    if (trunc_voxel_multiplier <= 0.0f) {
+        trunc_voxel_multiplier = block_resolution_ * 0.5;
+    }
     kernel::voxel_grid::Integrate(depth.AsTensor(), color.AsTensor(),
                                   buf_indices, block_keys, block_value_map,
                                   intrinsic, extrinsic, block_resolution_,
-                                  voxel_size_, voxel_size_ * trunc_multiplier,
+                                  voxel_size_,
+                                  voxel_size_ * trunc_voxel_multiplier,
                                   depth_scale, depth_max);
 }
 
+void VoxelBlockGrid::IntegrateBatch(const core::Tensor &depths,
+                                    const core::Tensor &colors,
+                                    const core::Tensor &intrinsic,
+                                    const core::Tensor &extrinsics,
+                                    float depth_scale,
+                                    float depth_max,
+                                    float trunc_voxel_multiplier) {
+    OPEN3D_PROFILE_ZONE("geometry", "VoxelBlockGrid::IntegrateBatch");
+    AssertInitialized();
+    bool integrate_color = colors.NumElements() > 0;
+
+    CheckDepthTensor(depths);
+    core::AssertTensorShape(depths, {utility::nullopt, utility::nullopt,
+                                     utility::nullopt, 1});
+    const int64_t batch_size = depths.GetLength();
+    const int64_t rows = depths.GetShape(1);
+    const int64_t cols = depths.GetShape(2);
+    if (integrate_color) {
+        CheckColorTensor(colors);
+        core::AssertTensorShape(colors, {batch_size, rows, cols, 3});
+    }
+    CheckIntrinsicTensor(intrinsic);
+    core::AssertTensorShape(extrinsics, {batch_size, 4, 4});
+    core::AssertTensorDtype(extrinsics, core::Float64);
+    core::AssertTensorDevice(extrinsics, core::Device("CPU:0"));
+
+    const core::Tensor depths_contiguous = depths.Contiguous();
+    const core::Tensor colors_contiguous =
+            integrate_color ? colors.Contiguous() : colors;
+
+    // Touch the blocks of all the frames in the frustum hash map at once.
+    const int64_t down_factor = 4;
+    const int64_t est_sample_multiplier = 4;
+    if (frustum_hashmap_ == nullptr) {
+        int64_t capacity = (cols / down_factor) * (rows / down_factor) *
+                           est_sample_multiplier;
+        frustum_hashmap_ = std::make_shared<core::HashMap>(
+                capacity, core::Int32, core::SizeVector{3}, core::Int32,
+                core::SizeVector{1}, block_hashmap_->GetDevice());
+    } else {
+        frustum_hashmap_->Clear();
+    }
+
+    core::Tensor block_coords;
+    kernel::voxel_grid::DepthTouchBatch(
+            frustum_hashmap_, depths_contiguous, intrinsic, extrinsics,
+            block_coords, block_resolution_, voxel_size_,
+            voxel_size_ * trunc_voxel_multiplier, depth_scale, depth_max,
+            down_factor);
+
+    core::Tensor buf_indices, masks;
+    const bool nb_block_table_valid = IsNeighborBlockTableValid();
+    block_hashmap_->Activate(block_coords, buf_indices, masks);
+    if (nb_block_table_valid) {
+        UpdateNeighborBlockTable(buf_indices.IndexGet({masks}));
+    }
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+    MarkBlocksDirty(buf_indices.IndexGet({masks}));
+
+    core::Tensor block_keys = block_hashmap_->GetKeyTensor();
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+
+    float trunc_multiplier = block_resolution_ * 0.5;
+    kernel::voxel_grid::IntegrateBatch(
+            depths_contiguous, colors_contiguous, buf_indices, block_keys,
+            block_value_map, intrinsic, extrinsics.Contiguous(),
+            block_resolution_, voxel_size_, voxel_size_ * trunc_multiplier,
+            depth_scale, depth_max);
+}
+
+void VoxelBlockGrid::EraseBlocks(const core::Tensor &block_coords) {
+    AssertInitialized();
+    CheckBlockCoorinates(block_coords);
+
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+    core::Tensor erased = buf_indices.IndexGet({masks}).To(core::Int64);
+
+    // Once incremental mesh extraction is in use, report the erased blocks
+    // and re-mesh their neighbors, whose meshes reach into them.
+    const bool track_changes = dirty_block_mask_.GetLength() > 0;
+    if (track_changes && erased.GetLength() > 0) {
+        core::Tensor erased_keys =
+                block_hashmap_->GetKeyTensor().IndexGet({erased});
+        erased_block_keys_ =
+                erased_block_keys_.NumElements() > 0
+                        ? core::Concatenate({erased_block_keys_, erased_keys})
+                        : erased_keys;
+
+        if (dirty_block_mask_.GetLength() == block_hashmap_->GetCapacity()) {
+            core::Device device = block_hashmap_->GetDevice();
+            core::Tensor nb_buf_indices, nb_masks;
+            std::tie(nb_buf_indices, nb_masks) =
+                    BufferRadiusNeighbors(block_hashmap_, erased);
+            MarkBlocksDirty(nb_buf_indices.IndexGet({nb_masks}));
+            dirty_block_mask_.IndexSet(
+                    {erased}, core::Tensor::Zeros({erased.GetLength()},
+                                                  core::Bool, device));
+        }
+    }
+
+    const bool nb_block_table_valid = IsNeighborBlockTableValid();
+    if (nb_block_table_valid && erased.GetLength() > 0) {
+        core::Device device = block_hashmap_->GetDevice();
+
+        // Unlink the erased blocks from their neighbors, then clear
+        // their own rows.
+        core::Tensor rows = nb_block_table_.IndexGet({erased});
+        core::Tensor links =
+                rows.To(core::Int64)
+                        .Mul(27)
+                        .Add(OppositeNeighbors(device).View({1, 27}))
+                        .IndexGet({rows.Ge(0)});
+        nb_block_table_.View({-1}).IndexSet(
+                {links}, core::Tensor::Full({links.GetLength()}, -1,
+                                            core::Int32, device));
+        nb_block_table_.IndexSet(
+                {erased}, core::Tensor::Full({erased.GetLength(), 27}, -1,
+                                             core::Int32, device));
+    }
+
+    block_hashmap_->Erase(block_coords, masks);
+    if (nb_block_table_valid) {
+        nb_block_table_size_ = block_hashmap_->Size();
+    }
+}
+
+int64_t VoxelBlockGrid::RecycleBlocks(float weight_threshold,
+                                      float weight_decay) {
+    AssertInitialized();
+    if (weight_decay < 0.0f || weight_decay > 1.0f) {
+        utility::LogError("Weight decay must be in [0, 1], but got {}.",
+                          weight_decay);
+    }
+
+    core::Tensor active_buf_indices = block_hashmap_->GetActiveIndices();
+    if (active_buf_indices.GetLength() == 0) {
+        return 0;
+    }
+
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    core::Tensor surface_block_masks;
+    kernel::voxel_grid::DecayWeightsAndFindSurfaceBlocks(
+            active_buf_indices, block_value_map, surface_block_masks,
+            block_resolution_, weight_threshold, weight_decay);
+    if (weight_decay < 1.0f) {
+        MarkBlocksDirty(active_buf_indices);
+    }
+
+    core::Tensor free_buf_indices =
+            active_buf_indices.IndexGet({surface_block_masks.LogicalNot()});
+    int64_t num_free = free_buf_indices.GetLength();
+    if (num_free > 0) {
+        EraseBlocks(block_hashmap_->GetKeyTensor().IndexGet(
+                {free_buf_indices.To(core::Int64)}));
+    }
+    return num_free;
+}
+
 TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                                   const core::Tensor &intrinsic,
                                   const core::Tensor &extrinsic,
@@ -340,6 +618,7 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                                   float depth_min,
                                   float depth_max,
                                   float weight_threshold) {
+    OPEN3D_PROFILE_ZONE("geometry", "VoxelBlockGrid::RayCast");
     AssertInitialized();
     CheckBlockCoorinates(block_coords);
     CheckIntrinsicTensor(intrinsic);
@@ -396,15 +675,37 @@ TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
     float trunc_multiplier = block_resolution_ * 0.5;
     TensorMap block_value_map =
             ConstructTensorMap(*block_hashmap_, name_attr_map_);
+
+    // Rays skip the selected blocks holding only free or unobserved space in
+    // one step instead of marching through their voxels.
+    core::Tensor buf_indices, masks, free_block_masks;
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+    kernel::voxel_grid::FindFreeBlocks(buf_indices.IndexGet({masks}),
+                                       block_value_map, free_block_masks,
+                                       block_resolution_, weight_threshold);
+
     kernel::voxel_grid::RayCast(
-            block_hashmap_, block_value_map, range_minmax_map, renderings_map,
-            intrinsic, extrinsic, height, width, block_resolution_, voxel_size_,
+            block_hashmap_, block_value_map, range_minmax_map,
+            free_block_masks, renderings_map, intrinsic, extrinsic, height,
+            width, block_resolution_, voxel_size_,
             voxel_size_ * trunc_multiplier, depth_scale, depth_min, depth_max,
             weight_threshold);
 
     return renderings_map;
 }
 
+/// Returns the Int64 permutation that sorts the rows of the 2-D tensor
+/// \p rows lexicographically. Stable sorts by the last to the first column.
+static core::Tensor ArgsortRows(const core::Tensor &rows) {
+    core::Tensor perm = core::Tensor::Arange(0, rows.GetLength(), 1,
+                                             core::Int64, rows.GetDevice());
+    for (int64_t col = rows.GetShape(1) - 1; col >= 0; --col) {
+        const core::Tensor keys = rows.T()[col].IndexGet({perm});
+        perm = perm.IndexGet({keys.Argsort()});
+    }
+    return perm;
+}
+
 PointCloud VoxelBlockGrid::ExtractPointCloud(int estimated_number,
                                              float weight_threshold) {
     AssertInitialized();
@@ -413,7 +714,7 @@ PointCloud VoxelBlockGrid::ExtractPointCloud(int estimated_number,
 
     core::Tensor active_nb_buf_indices, active_nb_masks;
     std::tie(active_nb_buf_indices, active_nb_masks) =
-            BufferRadiusNeighbors(block_hashmap_, active_buf_indices);
+            GetNeighborBlocks(active_buf_indices);
 
     // Extract points around zero-crossings.
     core::Tensor points, normals, colors;
@@ -433,6 +734,15 @@ PointCloud VoxelBlockGrid::ExtractPointCloud(int estimated_number,
         pcd.SetPointColors(colors.Slice(0, 0, estimated_number));
     }
 
+    if (utility::IsDeterministic()) {
+        // The points are appended in the order of the hash map buffer, which
+        // varies between runs. Sort them by position instead.
+        const core::Tensor perm = ArgsortRows(pcd.GetPointPositions());
+        for (const auto &kv : pcd.GetPointAttr().IndexGet(perm)) {
+            pcd.SetPointAttr(kv.first, kv.second);
+        }
+    }
+
     return pcd;
 }
 
@@ -442,7 +752,7 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(int estimated_number,
     core::Tensor active_buf_indices_i32 = block_hashmap_->GetActiveIndices();
     core::Tensor active_nb_buf_indices, active_nb_masks;
     std::tie(active_nb_buf_indices, active_nb_masks) =
-            BufferRadiusNeighbors(block_hashmap_, active_buf_indices_i32);
+            GetNeighborBlocks(active_buf_indices_i32);
 
     core::Device device = block_hashmap_->GetDevice();
     // Map active indices to [0, num_blocks] to be allocated for surface mesh.
@@ -454,7 +764,8 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(int estimated_number,
     inverse_index_map.IndexSet({active_buf_indices_i32.To(core::Int64)},
                                iota_map);
 
-    core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors,
+            triangle_block_indices;
     int vertex_count = estimated_number;
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
@@ -463,8 +774,28 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(int estimated_number,
     kernel::voxel_grid::ExtractTriangleMesh(
             active_buf_indices_i32, inverse_index_map, active_nb_buf_indices,
             active_nb_masks, block_keys, block_value_map, vertices, triangles,
-            vertex_normals, vertex_colors, block_resolution_, voxel_size_,
-            weight_threshold, vertex_count);
+            vertex_normals, vertex_colors, triangle_block_indices,
+            block_resolution_, voxel_size_, weight_threshold,
+            /*mesh_block_count=*/-1, vertex_count);
+
+    if (utility::IsDeterministic()) {
+        // Sort the vertices by position and the triangles by their new vertex
+        // indices, see ExtractPointCloud().
+        const core::Tensor perm = ArgsortRows(vertices);
+        core::Tensor inverse_perm =
+                core::Tensor::Empty({perm.GetLength()}, core::Int64, device);
+        inverse_perm.IndexSet(
+                {perm}, core::Tensor::Arange(0, perm.GetLength(), 1,
+                                             core::Int64, device));
+        vertices = vertices.IndexGet({perm});
+        vertex_normals = vertex_normals.IndexGet({perm});
+        if (vertex_colors.GetLength() == perm.GetLength()) {
+            vertex_colors = vertex_colors.IndexGet({perm});
+        }
+        triangles = inverse_perm.IndexGet({triangles.To(core::Int64)})
+                            .To(triangles.GetDtype());
+        triangles = triangles.IndexGet({ArgsortRows(triangles)});
+    }
 
     TriangleMesh mesh(vertices, triangles);
     mesh.SetVertexNormals(vertex_normals);
@@ -475,6 +806,112 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(int estimated_number,
     return mesh;
 }
 
+std::tuple<core::Tensor, std::vector<TriangleMesh>, core::Tensor>
+VoxelBlockGrid::ExtractTriangleMeshIncremental(float weight_threshold) {
+    AssertInitialized();
+    core::Device device = block_hashmap_->GetDevice();
+    int64_t capacity = block_hashmap_->GetCapacity();
+    core::Tensor active_buf_indices =
+            block_hashmap_->GetActiveIndices().To(core::Int64);
+
+    // Re-mesh the dirty blocks and their neighbors.
+    core::Tensor remesh_mask =
+            core::Tensor::Zeros({capacity}, core::Bool, device);
+    if (dirty_block_mask_.GetLength() != capacity) {
+        remesh_mask.IndexSet(
+                {active_buf_indices},
+                core::Tensor::Ones({active_buf_indices.GetLength()},
+                                   core::Bool, device));
+    } else {
+        core::Tensor dirty = dirty_block_mask_.NonZero()[0];
+        if (dirty.GetLength() > 0) {
+            core::Tensor nb_buf_indices, nb_masks;
+            std::tie(nb_buf_indices, nb_masks) = GetNeighborBlocks(dirty);
+            core::Tensor remesh = nb_buf_indices.IndexGet({nb_masks});
+            remesh_mask.IndexSet(
+                    {remesh.To(core::Int64)},
+                    core::Tensor::Ones({remesh.GetLength()}, core::Bool,
+                                       device));
+        }
+    }
+    core::Tensor remesh_buf_indices = remesh_mask.NonZero()[0];
+    int64_t num_remesh = remesh_buf_indices.GetLength();
+
+    dirty_block_mask_ = core::Tensor::Zeros({capacity}, core::Bool, device);
+
+    // Blocks erased and not re-activated since the previous call.
+    core::Tensor erased_keys({0, 3}, core::Int32, device);
+    if (erased_block_keys_.NumElements() > 0) {
+        core::Tensor buf_indices, masks;
+        block_hashmap_->Find(erased_block_keys_, buf_indices, masks);
+        erased_keys = erased_block_keys_.IndexGet({masks.LogicalNot()});
+    }
+    erased_block_keys_ = core::Tensor();
+
+    core::Tensor block_keys = block_hashmap_->GetKeyTensor();
+    core::Tensor remesh_keys = block_keys.IndexGet({remesh_buf_indices});
+    if (num_remesh == 0) {
+        return std::make_tuple(remesh_keys, std::vector<TriangleMesh>(),
+                               erased_keys);
+    }
+
+    // Cubes of the re-meshed blocks put vertices on the edges of their
+    // neighbors in the positive directions, which are passed after them
+    // without forming triangles of their own.
+    core::Tensor remesh_nb_buf_indices, remesh_nb_masks;
+    std::tie(remesh_nb_buf_indices, remesh_nb_masks) =
+            GetNeighborBlocks(remesh_buf_indices);
+    core::Tensor positive_nbs = core::Tensor::Init<int64_t>(
+            {13, 14, 16, 17, 22, 23, 25, 26}, device);
+    core::Tensor vertex_blocks =
+            remesh_nb_buf_indices.IndexGet({positive_nbs})
+                    .IndexGet({remesh_nb_masks.IndexGet({positive_nbs})});
+    core::Tensor vertex_mask =
+            core::Tensor::Zeros({capacity}, core::Bool, device);
+    vertex_mask.IndexSet({vertex_blocks.To(core::Int64)},
+                         core::Tensor::Ones({vertex_blocks.GetLength()},
+                                            core::Bool, device));
+    vertex_mask.IndexSet({remesh_buf_indices},
+                         core::Tensor::Zeros({num_remesh}, core::Bool, device));
+    core::Tensor vertex_buf_indices = vertex_mask.NonZero()[0];
+
+    core::Tensor buf_indices_i32 =
+            core::Concatenate({remesh_buf_indices, vertex_buf_indices})
+                    .To(core::Int32);
+    core::Tensor nb_buf_indices, nb_masks;
+    std::tie(nb_buf_indices, nb_masks) = GetNeighborBlocks(buf_indices_i32);
+
+    int64_t num_blocks = buf_indices_i32.GetLength();
+    core::Tensor inverse_index_map({capacity}, core::Int32, device);
+    core::Tensor iota_map =
+            core::Tensor::Arange(0, num_blocks, 1, core::Int32, device);
+    inverse_index_map.IndexSet({buf_indices_i32.To(core::Int64)}, iota_map);
+
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors,
+            triangle_block_indices;
+    int vertex_count = -1;
+
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    kernel::voxel_grid::ExtractTriangleMesh(
+            buf_indices_i32, inverse_index_map, nb_buf_indices, nb_masks,
+            block_keys, block_value_map, vertices, triangles, vertex_normals,
+            vertex_colors, triangle_block_indices, block_resolution_,
+            voxel_size_, weight_threshold, static_cast<int>(num_remesh),
+            vertex_count);
+
+    TriangleMesh mesh(vertices, triangles);
+    mesh.SetVertexNormals(vertex_normals);
+    if (vertex_colors.GetLength() == vertices.GetLength()) {
+        mesh.SetVertexColors(vertex_colors);
+    }
+
+    return std::make_tuple(
+            remesh_keys,
+            SplitTriangleMeshByBlock(mesh, triangle_block_indices, num_remesh),
+            erased_keys);
+}
+
 void VoxelBlockGrid::Save(const std::string &file_name) const {
     AssertInitialized();
     // TODO(wei): provide 'GetActiveKeyValues' functionality.
@@ -531,24 +968,33 @@ void VoxelBlockGrid::Save(const std::string &file_name) const {
 }
 
 VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
-    std::unordered_map<std::string, core::Tensor> tensor_map =
-            t::io::ReadNpz(file_name);
+    // The stored device is a placeholder key, so only the central directory
+    // is read to find it.
+    const std::string kCPU = "CPU";
+    const std::string kCUDA = "CUDA";
+    std::string device_str = "CPU:0";
+    t::io::NpzFile npz(file_name);
+    for (const std::string &key : npz.GetKeys()) {
+        if (!key.compare(0, kCPU.size(), kCPU) ||
+            !key.compare(0, kCUDA.size(), kCUDA)) {
+            device_str = key;
+        }
+    }
+    return Load(file_name, core::Device(device_str));
+}
+
+VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name,
+                                    const core::Device &device) {
+    // Arrays are mapped instead of read, so only the chunk being inserted is
+    // staged for the copy to the device.
+    t::io::NpzFile npz(file_name, /*use_mmap=*/true);
 
     std::string prefix = "attr_name_";
     std::unordered_map<int, std::string> inv_attr_map;
-
-    std::string kCPU = "CPU";
-    std::string kCUDA = "CUDA";
-
-    std::string device_str = "CPU:0";
-    for (auto &it : tensor_map) {
-        if (!it.first.compare(0, prefix.size(), prefix)) {
-            int value_id = it.second[0].Item<int>();
-            inv_attr_map.emplace(value_id, it.first.substr(prefix.size()));
-        }
-        if (!it.first.compare(0, kCPU.size(), kCPU) ||
-            !it.first.compare(0, kCUDA.size(), kCUDA)) {
-            device_str = it.first;
+    for (const std::string &key : npz.GetKeys()) {
+        if (!key.compare(0, prefix.size(), prefix)) {
+            int value_id = npz.Get(key)[0].Item<int>();
+            inv_attr_map.emplace(value_id, key.substr(prefix.size()));
         }
     }
     if (inv_attr_map.size() == 0) {
@@ -557,8 +1003,6 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
                 "grids.");
     }
 
-    core::Device device(device_str);
-
     std::vector<std::string> attr_names(inv_attr_map.size());
 
     std::vector<core::Tensor> soa_value_tensor(inv_attr_map.size());
@@ -571,10 +1015,9 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
         int value_id = v.first;
         attr_names[value_id] = v.second;
 
-        core::Tensor value_i =
-                tensor_map.at(fmt::format("value_{:03d}", value_id));
+        core::Tensor value_i = npz.Get(fmt::format("value_{:03d}", value_id));
 
-        soa_value_tensor[value_id] = value_i.To(device);
+        soa_value_tensor[value_id] = value_i;
         attr_dtypes[value_id] = value_i.GetDtype();
 
         core::SizeVector value_i_shape = value_i.GetShape();
@@ -583,17 +1026,413 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
         attr_channels[value_id] = value_i_shape;
     }
 
-    core::Tensor keys = tensor_map.at("key").To(device);
-    float voxel_size = tensor_map.at("voxel_size")[0].Item<float>();
-    int block_resolution = tensor_map.at("block_resolution")[0].Item<int64_t>();
+    core::Tensor keys = npz.Get("key");
+    float voxel_size = npz.Get("voxel_size")[0].Item<float>();
+    int block_resolution = npz.Get("block_resolution")[0].Item<int64_t>();
 
+    const int64_t num_blocks = keys.GetLength();
     VoxelBlockGrid vbg(attr_names, attr_dtypes, attr_channels, voxel_size,
-                       block_resolution, keys.GetLength(), device);
+                       block_resolution, num_blocks, device);
     auto block_hashmap = vbg.GetHashMap();
-    block_hashmap.Insert(keys, soa_value_tensor);
+    const int64_t kChunkSize = 4096;
+    for (int64_t begin = 0; begin < num_blocks; begin += kChunkSize) {
+        const int64_t end = std::min(begin + kChunkSize, num_blocks);
+        std::vector<core::Tensor> chunk_values;
+        for (const core::Tensor &value : soa_value_tensor) {
+            chunk_values.push_back(value.Slice(0, begin, end).To(device));
+        }
+        block_hashmap.Insert(keys.Slice(0, begin, end).To(device),
+                             chunk_values);
+    }
     return vbg;
 }
 
+using TileCoord = std::tuple<int, int, int>;
+
+static int FloorDivide(int a, int b) {
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+static std::string GetTileIndexPath(const std::string &directory) {
+    return utility::filesystem::GetRegularizedDirectoryName(directory) +
+           "tiles.npz";
+}
+
+static std::string GetTilePath(const std::string &directory,
+                               const TileCoord &tile) {
+    return utility::filesystem::GetRegularizedDirectoryName(directory) +
+           fmt::format("tile_{}_{}_{}.npz", std::get<0>(tile),
+                       std::get<1>(tile), std::get<2>(tile));
+}
+
+static bool IsTileWithinRadius(const TileCoord &tile,
+                               const float *position,
+                               float tile_size,
+                               float radius) {
+    float dx = (std::get<0>(tile) + 0.5f) * tile_size - position[0];
+    float dy = (std::get<1>(tile) + 0.5f) * tile_size - position[1];
+    float dz = (std::get<2>(tile) + 0.5f) * tile_size - position[2];
+    return dx * dx + dy * dy + dz * dz <= radius * radius;
+}
+
+static std::set<TileCoord> ReadTileIndex(const std::string &directory,
+                                         int64_t tile_resolution) {
+    std::set<TileCoord> tiles;
+    std::string path = GetTileIndexPath(directory);
+    if (!utility::filesystem::FileExists(path)) {
+        return tiles;
+    }
+
+    std::unordered_map<std::string, core::Tensor> index =
+            t::io::ReadNpz(path);
+    int64_t stored_resolution = index.at("tile_resolution")[0].Item<int64_t>();
+    if (stored_resolution != tile_resolution) {
+        utility::LogError(
+                "Tiles in {} are stored with resolution {}, but got {}.",
+                directory, stored_resolution, tile_resolution);
+    }
+
+    core::Tensor coords = index.at("tile").To(core::Int32).Contiguous();
+    const int *coords_ptr = coords.GetDataPtr<int>();
+    for (int64_t i = 0; i < coords.GetLength(); ++i) {
+        tiles.emplace(coords_ptr[3 * i + 0], coords_ptr[3 * i + 1],
+                      coords_ptr[3 * i + 2]);
+    }
+    return tiles;
+}
+
+static void WriteTileIndex(const std::string &directory,
+                           const std::set<TileCoord> &tiles,
+                           int64_t tile_resolution) {
+    std::vector<int> coords;
+    for (const TileCoord &tile : tiles) {
+        coords.push_back(std::get<0>(tile));
+        coords.push_back(std::get<1>(tile));
+        coords.push_back(std::get<2>(tile));
+    }
+
+    core::Device host("CPU:0");
+    std::unordered_map<std::string, core::Tensor> index;
+    index.emplace("tile",
+                  core::Tensor(coords, {static_cast<int64_t>(tiles.size()), 3},
+                               core::Int32, host));
+    index.emplace("tile_resolution",
+                  core::Tensor(std::vector<int64_t>{tile_resolution}, {1},
+                               core::Int64, host));
+    t::io::WriteNpz(GetTileIndexPath(directory), index);
+}
+
+/// Appends the blocks of the tile stored at path that are missing in tile.
+static void MergeStoredTile(
+        const std::string &path,
+        std::unordered_map<std::string, core::Tensor> &tile) {
+    if (!utility::filesystem::FileExists(path)) {
+        return;
+    }
+    std::unordered_map<std::string, core::Tensor> stored =
+            t::io::ReadNpz(path);
+
+    std::set<TileCoord> keys;
+    core::Tensor tile_keys = tile.at("key").Contiguous();
+    const int *tile_keys_ptr = tile_keys.GetDataPtr<int>();
+    for (int64_t i = 0; i < tile_keys.GetLength(); ++i) {
+        keys.emplace(tile_keys_ptr[3 * i + 0], tile_keys_ptr[3 * i + 1],
+                     tile_keys_ptr[3 * i + 2]);
+    }
+
+    std::vector<int64_t> rows;
+    core::Tensor stored_keys = stored.at("key").Contiguous();
+    const int *stored_keys_ptr = stored_keys.GetDataPtr<int>();
+    for (int64_t i = 0; i < stored_keys.GetLength(); ++i) {
+        if (keys.count(TileCoord(stored_keys_ptr[3 * i + 0],
+                                 stored_keys_ptr[3 * i + 1],
+                                 stored_keys_ptr[3 * i + 2])) == 0) {
+            rows.push_back(i);
+        }
+    }
+    if (rows.empty()) {
+        return;
+    }
+
+    core::Tensor rows_t(rows, {static_cast<int64_t>(rows.size())}, core::Int64,
+                        core::Device("CPU:0"));
+    for (auto &it : tile) {
+        it.second = core::Concatenate(
+                {it.second, stored.at(it.first).IndexGet({rows_t})});
+    }
+}
+
+int64_t VoxelBlockGrid::StreamOutTiles(const std::string &directory,
+                                       const core::Tensor &position,
+                                       float radius,
+                                       int64_t tile_resolution) {
+    AssertInitialized();
+    core::AssertTensorShape(position, {3});
+    if (tile_resolution <= 0) {
+        utility::LogError("tile resolution must be positive, but got {}",
+                          tile_resolution);
+    }
+
+    core::Device device = block_hashmap_->GetDevice();
+    core::Device host("CPU:0");
+    core::Tensor position_host = position.To(host, core::Float32).Contiguous();
+    const float *position_ptr = position_host.GetDataPtr<float>();
+    float tile_size = voxel_size_ * block_resolution_ * tile_resolution;
+
+    // Group the active blocks out of range by tile.
+    core::Tensor active_buf_indices =
+            block_hashmap_->GetActiveIndices().To(core::Int64);
+    core::Tensor keys = block_hashmap_->GetKeyTensor()
+                                .IndexGet({active_buf_indices})
+                                .To(host)
+                                .Contiguous();
+    const int *keys_ptr = keys.GetDataPtr<int>();
+    const int r = static_cast<int>(tile_resolution);
+    std::map<TileCoord, std::vector<int64_t>> tile_rows;
+    for (int64_t i = 0; i < keys.GetLength(); ++i) {
+        TileCoord tile(FloorDivide(keys_ptr[3 * i + 0], r),
+                       FloorDivide(keys_ptr[3 * i + 1], r),
+                       FloorDivide(keys_ptr[3 * i + 2], r));
+        if (!IsTileWithinRadius(tile, position_ptr, tile_size, radius)) {
+            tile_rows[tile].push_back(i);
+        }
+    }
+    if (tile_rows.empty()) {
+        return 0;
+    }
+
+    utility::filesystem::MakeDirectoryHierarchy(directory);
+    std::set<TileCoord> stored_tiles =
+            ReadTileIndex(directory, tile_resolution);
+
+    std::vector<core::Tensor> values = block_hashmap_->GetValueTensors();
+    std::vector<core::Tensor> out_buf_indices;
+    for (auto &it : tile_rows) {
+        core::Tensor rows(it.second, {static_cast<int64_t>(it.second.size())},
+                          core::Int64, host);
+        core::Tensor buf_indices =
+                active_buf_indices.IndexGet({rows.To(device)});
+
+        std::unordered_map<std::string, core::Tensor> tile;
+        tile.emplace("key", keys.IndexGet({rows}));
+        for (auto &attr : name_attr_map_) {
+            tile.emplace(fmt::format("value_{:03d}", attr.second),
+                         values[attr.second].IndexGet({buf_indices}).To(host));
+        }
+
+        std::string path = GetTilePath(directory, it.first);
+        if (stored_tiles.count(it.first) > 0) {
+            MergeStoredTile(path, tile);
+        }
+        t::io::WriteNpz(path, tile);
+        stored_tiles.insert(it.first);
+        prefetched_tiles_.erase(path);
+
+        out_buf_indices.push_back(buf_indices);
+    }
+    WriteTileIndex(directory, stored_tiles, tile_resolution);
+
+    core::Tensor out_keys = block_hashmap_->GetKeyTensor().IndexGet(
+            {core::Concatenate(out_buf_indices)});
+    EraseBlocks(out_keys);
+    return out_keys.GetLength();
+}
+
+int64_t VoxelBlockGrid::StreamInTiles(const std::string &directory,
+                                      const core::Tensor &position,
+                                      float radius,
+                                      int64_t tile_resolution) {
+    AssertInitialized();
+    core::AssertTensorShape(position, {3});
+    if (tile_resolution <= 0) {
+        utility::LogError("tile resolution must be positive, but got {}",
+                          tile_resolution);
+    }
+
+    core::Device device = block_hashmap_->GetDevice();
+    core::Tensor position_host =
+            position.To(core::Device("CPU:0"), core::Float32).Contiguous();
+    const float *position_ptr = position_host.GetDataPtr<float>();
+    float tile_size = voxel_size_ * block_resolution_ * tile_resolution;
+
+    std::set<TileCoord> stored_tiles =
+            ReadTileIndex(directory, tile_resolution);
+    bool index_changed = false;
+    int64_t num_blocks = 0;
+    for (auto it = stored_tiles.begin(); it != stored_tiles.end();) {
+        if (!IsTileWithinRadius(*it, position_ptr, tile_size, radius)) {
+            ++it;
+            continue;
+        }
+
+        std::string path = GetTilePath(directory, *it);
+        std::unordered_map<std::string, core::Tensor> tile;
+        auto prefetched = prefetched_tiles_.find(path);
+        if (prefetched != prefetched_tiles_.end()) {
+            tile = prefetched->second.get();
+            prefetched_tiles_.erase(prefetched);
+        } else {
+            tile = t::io::ReadNpz(path);
+        }
+
+        // Blocks activated since the tile was streamed out take precedence.
+        core::Tensor buf_indices, masks;
+        const bool nb_block_table_valid = IsNeighborBlockTableValid();
+        block_hashmap_->Activate(tile.at("key").To(device), buf_indices,
+                                 masks);
+        core::Tensor new_buf_indices = buf_indices.IndexGet({masks});
+        if (nb_block_table_valid) {
+            UpdateNeighborBlockTable(new_buf_indices);
+        }
+        MarkBlocksDirty(new_buf_indices);
+
+        std::vector<core::Tensor> values = block_hashmap_->GetValueTensors();
+        core::Tensor new_indices = new_buf_indices.To(core::Int64);
+        for (auto &attr : name_attr_map_) {
+            std::string name = fmt::format("value_{:03d}", attr.second);
+            if (tile.count(name) == 0) {
+                utility::LogError("Attribute {} not found in tile {}.",
+                                  attr.first, path);
+            }
+            values[attr.second].IndexSet(
+                    {new_indices}, tile.at(name).To(device).IndexGet({masks}));
+        }
+        num_blocks += new_indices.GetLength();
+
+        it = stored_tiles.erase(it);
+        index_changed = true;
+    }
+
+    if (index_changed) {
+        WriteTileIndex(directory, stored_tiles, tile_resolution);
+    }
+    return num_blocks;
+}
+
+void VoxelBlockGrid::PrefetchTiles(const std::string &directory,
+                                   const core::Tensor &positions,
+                                   float radius,
+                                   int64_t tile_resolution) {
+    AssertInitialized();
+    core::AssertTensorShape(positions, {utility::nullopt, 3});
+    if (tile_resolution <= 0) {
+        utility::LogError("tile resolution must be positive, but got {}",
+                          tile_resolution);
+    }
+
+    core::Tensor positions_host =
+            positions.To(core::Device("CPU:0"), core::Float32).Contiguous();
+    const float *positions_ptr = positions_host.GetDataPtr<float>();
+    float tile_size = voxel_size_ * block_resolution_ * tile_resolution;
+
+    std::set<TileCoord> stored_tiles =
+            ReadTileIndex(directory, tile_resolution);
+    for (const TileCoord &tile : stored_tiles) {
+        std::string path = GetTilePath(directory, tile);
+        if (prefetched_tiles_.count(path) > 0) {
+            continue;
+        }
+        for (int64_t i = 0; i < positions_host.GetLength(); ++i) {
+            if (IsTileWithinRadius(tile, positions_ptr + 3 * i, tile_size,
+                                   radius)) {
+                prefetched_tiles_.emplace(
+                        path, std::async(std::launch::async, [path]() {
+                                  return t::io::ReadNpz(path);
+                              }).share());
+                break;
+            }
+        }
+    }
+}
+
+std::pair<core::Tensor, core::Tensor> VoxelBlockGrid::GetNeighborBlocks(
+        const core::Tensor &active_buf_indices) {
+    if (!IsNeighborBlockTableValid()) {
+        RebuildNeighborBlockTable();
+    }
+
+    int64_t n = active_buf_indices.GetLength();
+    core::Tensor rows =
+            nb_block_table_.IndexGet({active_buf_indices.To(core::Int64)});
+    core::Tensor nb_masks = rows.Ge(0);
+    // Unallocated neighbors map to index 0 as in HashMap::Find.
+    core::Tensor nb_buf_indices = rows.Mul(nb_masks.To(core::Int32));
+    return std::make_pair(nb_buf_indices.T().Contiguous().View({27, n, 1}),
+                          nb_masks.T().Contiguous().View({27, n, 1}));
+}
+
+bool VoxelBlockGrid::IsNeighborBlockTableValid() const {
+    return nb_block_table_.NumDims() == 2 &&
+           nb_block_table_.GetLength() == block_hashmap_->GetCapacity() &&
+           nb_block_table_size_ == block_hashmap_->Size();
+}
+
+void VoxelBlockGrid::RebuildNeighborBlockTable() {
+    // Allocate a new table, as the old one may be shared with copies of this
+    // grid.
+    nb_block_table_ = core::Tensor::Full({block_hashmap_->GetCapacity(), 27},
+                                         -1, core::Int32,
+                                         block_hashmap_->GetDevice());
+    core::Tensor active_buf_indices = block_hashmap_->GetActiveIndices();
+    if (active_buf_indices.GetLength() > 0) {
+        core::Tensor nb_buf_indices, nb_masks;
+        std::tie(nb_buf_indices, nb_masks) =
+                BufferRadiusNeighbors(block_hashmap_, active_buf_indices);
+        core::Tensor rows = EncodeNeighborBlocks(nb_buf_indices, nb_masks);
+        nb_block_table_.IndexSet({active_buf_indices.To(core::Int64)}, rows);
+    }
+    nb_block_table_size_ = block_hashmap_->Size();
+}
+
+void VoxelBlockGrid::UpdateNeighborBlockTable(
+        const core::Tensor &new_buf_indices) {
+    // Buffer indices are reassigned when the hash map grows.
+    if (nb_block_table_.GetLength() != block_hashmap_->GetCapacity()) {
+        nb_block_table_ = core::Tensor();
+        nb_block_table_size_ = -1;
+        return;
+    }
+
+    int64_t n = new_buf_indices.GetLength();
+    if (n > 0) {
+        core::Device device = block_hashmap_->GetDevice();
+        core::Tensor nb_buf_indices, nb_masks;
+        std::tie(nb_buf_indices, nb_masks) =
+                BufferRadiusNeighbors(block_hashmap_, new_buf_indices);
+        core::Tensor rows = EncodeNeighborBlocks(nb_buf_indices, nb_masks);
+        nb_block_table_.IndexSet({new_buf_indices.To(core::Int64)}, rows);
+
+        // A new block is neighbor (26 - nb) of its neighbor nb.
+        core::Tensor found = nb_masks.View({27, n});
+        core::Tensor links = nb_buf_indices.View({27, n})
+                                     .To(core::Int64)
+                                     .Mul(27)
+                                     .Add(OppositeNeighbors(device).View(
+                                             {27, 1}))
+                                     .IndexGet({found});
+        core::Tensor values =
+                new_buf_indices.View({1, n}).Expand({27, n}).IndexGet({found});
+        nb_block_table_.View({-1}).IndexSet({links}, values);
+    }
+    nb_block_table_size_ = block_hashmap_->Size();
+}
+
+void VoxelBlockGrid::MarkBlocksDirty(const core::Tensor &buf_indices) {
+    // Buffer indices are reassigned when the hash map grows, after which all
+    // the blocks count as dirty.
+    int64_t capacity = block_hashmap_->GetCapacity();
+    if (dirty_block_mask_.GetLength() != capacity) {
+        return;
+    }
+
+    int64_t n = buf_indices.GetLength();
+    if (n > 0) {
+        core::Device device = block_hashmap_->GetDevice();
+        dirty_block_mask_.IndexSet({buf_indices.To(core::Int64)},
+                                   core::Tensor::Ones({n}, core::Bool, device));
+    }
+}
+
 void VoxelBlockGrid::AssertInitialized() const {
     if (block_hashmap_ == nullptr) {
         utility::LogError("VoxelBlockGrid not initialized.");
@@ -26,6 +26,11 @@
 
 #pragma once
 
+#include <future>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
 #include "open3d/t/geometry/Geometry.h"
@@ -70,6 +75,12 @@ public:
     /// (SoA).
     core::HashMap GetHashMap() { return *block_hashmap_; }
 
+    /// Get the edge length of the voxels.
+    float GetVoxelSize() const { return voxel_size_; }
+
+    /// Get the number of voxels along the edges of a block.
+    int64_t GetBlockResolution() const { return block_resolution_; }
+
     /// Get the attribute tensor corresponding to the attribute name.
     /// A sugar for hashmap.GetValueTensor(i)
     core::Tensor GetAttribute(const std::string &attr_name) const;
@@ -146,19 +157,26 @@ public:
     /// tsdf: float, weight: uint16_t, color: uint16_t
     /// and accurate mode for differentiable rendering:
     /// tsdf/weight/color: float
+    /// and a compact mode with 6 instead of 12 bytes per voxel:
+    /// tsdf: int16_t, weight: uint8_t, color: uint8_t
+    /// where tsdf is quantized over the truncation range and weight saturates
+    /// at 255.
     /// We assume input data are either raw:
     /// depth: uint16_t, color: uint8_t
     /// or depth/color: float.
     /// To support other types and properties, users should combine
     /// GetUniqueBlockCoordinates, GetVoxelIndices, and GetVoxelCoordinates,
     /// with self-defined operations.
+    /// The SDF is truncated at trunc_voxel_multiplier voxels, or at half the
+    /// block resolution if it is 0.
     void Integrate(const core::Tensor &block_coords,
                    const Image &depth,
                    const Image &color,
                    const core::Tensor &intrinsic,
                    const core::Tensor &extrinsic,
                    float depth_scale = 1000.0f,
-                   float depth_max = 3.0f);
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 0.0f);
 
     /// Specific operation for TSDF volumes.
     /// Similar to RGB-D integration, but only applied to depth.
@@ -167,7 +185,41 @@ public:
                    const core::Tensor &intrinsic,
                    const core::Tensor &extrinsic,
                    float depth_scale = 1000.0f,
-                   float depth_max = 3.0f);
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 0.0f);
+
+    /// Specific operation for TSDF volumes.
+    /// Integrate a batch of frames with known poses: (B, H, W, 1) depths,
+    /// (B, H, W, 3) colors (or an empty tensor for depth only) and (B, 4, 4)
+    /// Float64 extrinsics. The blocks touched by all the frames are
+    /// deduplicated and activated in one hash map pass, and all the frames are
+    /// integrated in a single kernel where each voxel fuses them in batch
+    /// order. This replaces calling GetUniqueBlockCoordinates and Integrate
+    /// on each frame in turn; since every frame is fused into all the blocks
+    /// touched by the batch, a few more observations near block borders may
+    /// be fused. Memory grows with B, so split long sequences into batches.
+    void IntegrateBatch(const core::Tensor &depths,
+                        const core::Tensor &colors,
+                        const core::Tensor &intrinsic,
+                        const core::Tensor &extrinsics,
+                        float depth_scale = 1000.0f,
+                        float depth_max = 3.0f,
+                        float trunc_voxel_multiplier = 4.0);
+
+    /// Erase the voxel blocks at the given (N, 3) Int32 block coordinates.
+    /// Coordinates that are not allocated are ignored.
+    void EraseBlocks(const core::Tensor &block_coords);
+
+    /// Specific operation for TSDF volumes.
+    /// Garbage collection for long sessions with a moving sensor, keeping
+    /// memory proportional to the observed surface. The weights of all the
+    /// voxels are first multiplied by weight_decay (integer weights are
+    /// truncated), so that stale observations fade out. Blocks without any
+    /// voxel that has a weight above weight_threshold and a TSDF inside the
+    /// truncation band, i.e. unobserved or carved free space, are then
+    /// erased. Returns the number of erased blocks.
+    int64_t RecycleBlocks(float weight_threshold = 0.0f,
+                          float weight_decay = 1.0f);
 
     /// Specific operation for TSDF volumes.
     /// Perform volumetric ray casting in the selected block coordinates.
@@ -179,6 +231,8 @@ public:
     /// The block coordinates in the frustum can be taken from
     /// GetUniqueBlockCoordinates.
     /// All the block coordinates can be taken from GetHashMap().GetKeyTensor().
+    /// Rays cross the selected blocks without any voxel of at least
+    /// weight_threshold in front of or behind the surface in a single step.
     TensorMap RayCast(const core::Tensor &block_coords,
                       const core::Tensor &intrinsic,
                       const core::Tensor &extrinsic,
@@ -208,15 +262,82 @@ public:
     TriangleMesh ExtractTriangleMesh(int estimate_number = -1,
                                      float weight_threshold = 3.0f);
 
+    /// Specific operation for TSDF volumes.
+    /// Incremental mesh extraction for live previews. Integrate,
+    /// IntegrateBatch and EraseBlocks mark the blocks they change as dirty;
+    /// this call re-runs Marching Cubes only on the dirty blocks and their 26
+    /// neighbors, whose cubes and normals reach into them, and clears the
+    /// flags. Returns the (K, 3) Int32 keys of the re-meshed blocks, one mesh
+    /// chunk per key holding the triangles of the cubes in that block (empty
+    /// if there are none), and the (E, 3) Int32 keys of the blocks erased
+    /// since the previous call, whose chunks should be dropped. Chunks do not
+    /// share vertices, so they can be swapped independently. The first call,
+    /// and any call after the hash map has grown, re-meshes all the blocks.
+    /// Changes made directly through GetHashMap() are not tracked.
+    std::tuple<core::Tensor, std::vector<TriangleMesh>, core::Tensor>
+    ExtractTriangleMeshIncremental(float weight_threshold = 3.0f);
+
+    /// Out-of-core streaming for large scenes with a bounded working set.
+    /// Space is partitioned into cubic tiles of tile_resolution^3 blocks. Each
+    /// stored tile is a tile_<x>_<y>_<z>.npz file in directory, listed in the
+    /// tiles.npz index.
+    /// Writes the active blocks in the tiles whose center is farther than
+    /// radius (in meters) from the (3,) position to disk, and erases them.
+    /// Blocks of a tile already on disk are merged, the active ones taking
+    /// precedence. Returns the number of blocks streamed out.
+    int64_t StreamOutTiles(const std::string &directory,
+                           const core::Tensor &position,
+                           float radius,
+                           int64_t tile_resolution = 8);
+
+    /// Reads the stored tiles whose center is within radius (in meters) of
+    /// the (3,) position, inserts their blocks except those already active,
+    /// and removes them from the index. Tiles prefetched with PrefetchTiles
+    /// are taken from memory. Returns the number of blocks streamed in.
+    int64_t StreamInTiles(const std::string &directory,
+                          const core::Tensor &position,
+                          float radius,
+                          int64_t tile_resolution = 8);
+
+    /// Starts reading the stored tiles within radius (in meters) of any of
+    /// the (N, 3) positions, e.g. predicted from the trajectory, in
+    /// background threads for later calls to StreamInTiles.
+    void PrefetchTiles(const std::string &directory,
+                       const core::Tensor &positions,
+                       float radius,
+                       int64_t tile_resolution = 8);
+
     /// Save a voxel block grid to a .npz file.
     void Save(const std::string &file_name) const;
 
-    /// Load a voxel block grid from a .npz file.
+    /// Load a voxel block grid from a .npz file, on the device it was saved
+    /// from.
     static VoxelBlockGrid Load(const std::string &file_name);
 
+    /// Load a voxel block grid from a .npz file to \p device. The file is
+    /// memory-mapped and copied to the device in chunks of blocks, so no full
+    /// host copy of the grid is made.
+    static VoxelBlockGrid Load(const std::string &file_name,
+                               const core::Device &device);
+
 private:
     void AssertInitialized() const;
 
+    /// Returns (27, N, 1) neighbor buffer indices and masks of the blocks at
+    /// active_buf_indices, read from the neighbor block table. The table is
+    /// rebuilt beforehand if the hash map was modified outside this class.
+    std::pair<core::Tensor, core::Tensor> GetNeighborBlocks(
+            const core::Tensor &active_buf_indices);
+
+    bool IsNeighborBlockTableValid() const;
+    void RebuildNeighborBlockTable();
+
+    /// Links newly activated blocks into a valid neighbor block table.
+    void UpdateNeighborBlockTable(const core::Tensor &new_buf_indices);
+
+    /// Flags the blocks at buf_indices for ExtractTriangleMeshIncremental.
+    void MarkBlocksDirty(const core::Tensor &buf_indices);
+
     float voxel_size_ = -1;
     int64_t block_resolution_ = -1;
 
@@ -228,6 +349,28 @@ private:
 
     // Map: attribute name -> index to access the attribute in SoA.
     std::unordered_map<std::string, int> name_attr_map_;
+
+    // (capacity, 27) Int32 buffer indices of the 27-neighborhood of each
+    // block, indexed by buffer index, with -1 for unallocated neighbors.
+    // Built lazily and kept in sync on Integrate and EraseBlocks.
+    core::Tensor nb_block_table_;
+    // Hash map size the table was last synchronized with.
+    int64_t nb_block_table_size_ = -1;
+
+    // (capacity,) Bool flags of the blocks changed since the last incremental
+    // mesh extraction. Treated as all set when its length does not match the
+    // hash map capacity.
+    core::Tensor dirty_block_mask_;
+    // (E, 3) Int32 keys of the blocks erased since the last incremental mesh
+    // extraction.
+    core::Tensor erased_block_keys_;
+
+    // Tile file path -> contents being read in the background by
+    // PrefetchTiles.
+    std::unordered_map<
+            std::string,
+            std::shared_future<std::unordered_map<std::string, core::Tensor>>>
+            prefetched_tiles_;
 };
 }  // namespace geometry
 }  // namespace t
@@ -0,0 +1,199 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+VoxelGrid::VoxelGrid(double voxel_size,
+                     const core::Tensor &origin,
+                     int64_t init_capacity,
+                     const core::Device &device,
+                     const core::HashBackendType &backend)
+    : voxel_size_(voxel_size) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive, but got {}.",
+                          voxel_size);
+    }
+    core::AssertTensorShape(origin, {3});
+    origin_ = origin.To(device, core::Float64).Contiguous();
+    hashmap_ = std::make_shared<core::HashMap>(
+            std::max(init_capacity, int64_t(1)), core::Int32,
+            core::SizeVector{3},
+            std::vector<core::Dtype>{core::Float32, core::Float32},
+            std::vector<core::SizeVector>{{1}, {3}}, device, backend);
+}
+
+VoxelGrid VoxelGrid::CreateFromPointCloud(const PointCloud &pcd,
+                                          double voxel_size) {
+    const core::Tensor &points = pcd.GetPointPositions();
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    if (points.GetLength() == 0) {
+        utility::LogError("Input point cloud is empty.");
+    }
+    const core::Tensor origin =
+            points.To(core::Float64).Min({0}) - 0.5 * voxel_size;
+
+    VoxelGrid voxel_grid(voxel_size, origin, points.GetLength(),
+                         points.GetDevice());
+    if (pcd.HasPointColors()) {
+        voxel_grid.Insert(points, pcd.GetPointColors());
+    } else {
+        voxel_grid.Insert(points);
+    }
+    utility::LogDebug("Pointcloud is voxelized from {} points to {} voxels.",
+                      points.GetLength(), voxel_grid.Size());
+    return voxel_grid;
+}
+
+core::Tensor VoxelGrid::GetVoxel(const core::Tensor &points) const {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDevice(points, GetDevice());
+    return ((points.To(core::Float64) - origin_.View({1, 3})) / voxel_size_)
+            .Floor()
+            .To(core::Int32);
+}
+
+void VoxelGrid::Insert(const core::Tensor &points) {
+    const core::Tensor keys = GetVoxel(points);
+
+    // Zero the values of the newly activated voxels, the other points map to
+    // voxels that already exist.
+    core::Tensor buf_indices, masks;
+    hashmap_->Activate(keys, buf_indices, masks);
+    core::Tensor new_indices = buf_indices.IndexGet({masks}).To(core::Int64);
+    core::Tensor counts = hashmap_->GetValueTensor(0);
+    core::Tensor color_sums = hashmap_->GetValueTensor(1);
+    counts.IndexSet({new_indices},
+                    core::Tensor::Zeros({new_indices.GetLength(), 1},
+                                        core::Float32, GetDevice()));
+    color_sums.IndexSet({new_indices},
+                        core::Tensor::Zeros({new_indices.GetLength(), 3},
+                                            core::Float32, GetDevice()));
+
+    hashmap_->Find(keys, buf_indices, masks);
+    counts.IndexAdd_(0, buf_indices.To(core::Int64),
+                     core::Tensor::Ones({keys.GetLength(), 1}, core::Float32,
+                                        GetDevice()));
+}
+
+void VoxelGrid::Insert(const core::Tensor &points, const core::Tensor &colors) {
+    core::AssertTensorShape(colors, {points.GetLength(), 3});
+    core::AssertTensorDevice(colors, GetDevice());
+    Insert(points);
+
+    core::Tensor buf_indices, masks;
+    hashmap_->Find(GetVoxel(points), buf_indices, masks);
+    hashmap_->GetValueTensor(1).IndexAdd_(0, buf_indices.To(core::Int64),
+                                          colors.To(core::Float32));
+    has_colors_ = true;
+}
+
+core::Tensor VoxelGrid::CheckIfIncluded(const core::Tensor &points) const {
+    core::Tensor buf_indices, masks;
+    hashmap_->Find(GetVoxel(points), buf_indices, masks);
+    return masks;
+}
+
+core::Tensor VoxelGrid::GetActiveIndices() const {
+    return hashmap_->GetActiveIndices().To(core::Int64);
+}
+
+core::Tensor VoxelGrid::GetVoxelCoordinates() const {
+    return hashmap_->GetKeyTensor().IndexGet({GetActiveIndices()});
+}
+
+core::Tensor VoxelGrid::GetVoxelCenters() const {
+    return (GetVoxelCoordinates().To(core::Float64) + 0.5) * voxel_size_ +
+           origin_.View({1, 3});
+}
+
+core::Tensor VoxelGrid::GetVoxelColors() const {
+    const core::Tensor active_indices = GetActiveIndices();
+    const core::Tensor counts =
+            hashmap_->GetValueTensor(0).IndexGet({active_indices});
+    const core::Tensor color_sums =
+            hashmap_->GetValueTensor(1).IndexGet({active_indices});
+    // Every active voxel holds at least one point.
+    return color_sums / counts;
+}
+
+open3d::geometry::VoxelGrid VoxelGrid::ToLegacy() const {
+    open3d::geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = voxel_size_;
+    voxel_grid.origin_ = core::eigen_converter::TensorToEigenVector3dVector(
+            origin_.View({1, 3}))[0];
+
+    const std::vector<Eigen::Vector3i> coordinates =
+            core::eigen_converter::TensorToEigenVector3iVector(
+                    GetVoxelCoordinates());
+    const std::vector<Eigen::Vector3d> colors =
+            core::eigen_converter::TensorToEigenVector3dVector(
+                    GetVoxelColors());
+    voxel_grid.voxels_.reserve(coordinates.size());
+    for (size_t i = 0; i < coordinates.size(); ++i) {
+        voxel_grid.AddVoxel(
+                open3d::geometry::Voxel(coordinates[i], colors[i]));
+    }
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::FromLegacy(const open3d::geometry::VoxelGrid &voxel_grid,
+                                const core::Device &device) {
+    const core::Tensor origin(
+            std::vector<double>{voxel_grid.origin_(0), voxel_grid.origin_(1),
+                                voxel_grid.origin_(2)},
+            {3}, core::Float64);
+    VoxelGrid output(voxel_grid.voxel_size_, origin,
+                     int64_t(voxel_grid.voxels_.size()), device);
+    if (!voxel_grid.HasVoxels()) {
+        return output;
+    }
+
+    std::vector<Eigen::Vector3d> centers;
+    std::vector<Eigen::Vector3d> colors;
+    centers.reserve(voxel_grid.voxels_.size());
+    colors.reserve(voxel_grid.voxels_.size());
+    for (const auto &it : voxel_grid.voxels_) {
+        centers.push_back(voxel_grid.GetVoxelCenterCoordinate(it.first));
+        colors.push_back(it.second.color_);
+    }
+    output.Insert(core::eigen_converter::EigenVector3dVectorToTensor(
+                          centers, core::Float64, device),
+                  core::eigen_converter::EigenVector3dVectorToTensor(
+                          colors, core::Float32, device));
+    return output;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// A sparse voxel grid stored in a core::HashMap, the tensor counterpart of
+/// open3d::geometry::VoxelGrid. Construction and queries run as batched hash
+/// map operations on the device of the grid.
+///
+/// Voxel coordinates are Int32 keys floor((p - origin) / voxel_size). Every
+/// voxel keeps the number of points that fell into it and, if the points had
+/// colors, their sum, so that colors are averaged across insertions.
+class VoxelGrid {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param voxel_size Edge length of the voxels.
+    /// \param origin Float64 tensor of shape (3,), the corner of voxel (0, 0,
+    /// 0).
+    /// \param init_capacity Initial number of voxels, grows on demand.
+    /// \param device Device of the grid.
+    VoxelGrid(double voxel_size,
+              const core::Tensor &origin = core::Tensor::Zeros({3},
+                                                               core::Float64),
+              int64_t init_capacity = 1000,
+              const core::Device &device = core::Device("CPU:0"),
+              const core::HashBackendType &backend =
+                      core::HashBackendType::Default);
+
+    /// \brief Create a voxel grid with all voxels occupied by points of \p
+    /// pcd, on the device of \p pcd. As in the legacy version, the origin is
+    /// the minimum bound of the points minus half a voxel.
+    static VoxelGrid CreateFromPointCloud(const PointCloud &pcd,
+                                          double voxel_size);
+
+    /// \brief Activate the voxels containing \p points (Float32 or Float64,
+    /// shape (N, 3)).
+    void Insert(const core::Tensor &points);
+
+    /// \brief Activate the voxels containing \p points and accumulate \p
+    /// colors of shape (N, 3) into them.
+    void Insert(const core::Tensor &points, const core::Tensor &colors);
+
+    /// \brief Return the Int32 voxel coordinates of shape (N, 3) of \p points.
+    core::Tensor GetVoxel(const core::Tensor &points) const;
+
+    /// \brief Return a Bool mask of shape (N,) telling whether each of \p
+    /// points lies in an occupied voxel.
+    core::Tensor CheckIfIncluded(const core::Tensor &points) const;
+
+    /// \brief Int32 coordinates of shape (M, 3) of all occupied voxels.
+    core::Tensor GetVoxelCoordinates() const;
+
+    /// \brief Float64 centers of shape (M, 3) of all occupied voxels, in the
+    /// order of GetVoxelCoordinates().
+    core::Tensor GetVoxelCenters() const;
+
+    /// \brief Float32 average colors of shape (M, 3) of all occupied voxels,
+    /// in the order of GetVoxelCoordinates(). Voxels without colored points
+    /// are black.
+    core::Tensor GetVoxelColors() const;
+
+    /// \brief Number of occupied voxels.
+    int64_t Size() const { return hashmap_->Size(); }
+
+    bool IsEmpty() const { return Size() == 0; }
+
+    bool HasColors() const { return has_colors_; }
+
+    double GetVoxelSize() const { return voxel_size_; }
+
+    core::Tensor GetOrigin() const { return origin_; }
+
+    core::Device GetDevice() const { return hashmap_->GetDevice(); }
+
+    /// Get the underlying hash map from voxel coordinates to the number of
+    /// points (Float32, (1,)) and the color sum (Float32, (3,)).
+    core::HashMap GetHashMap() { return *hashmap_; }
+
+    /// Convert to a legacy VoxelGrid.
+    open3d::geometry::VoxelGrid ToLegacy() const;
+
+    /// Create a VoxelGrid from a legacy VoxelGrid.
+    static VoxelGrid FromLegacy(
+            const open3d::geometry::VoxelGrid &voxel_grid,
+            const core::Device &device = core::Device("CPU:0"));
+
+private:
+    /// Return the Int64 buffer indices of the active voxels.
+    core::Tensor GetActiveIndices() const;
+
+    double voxel_size_;
+    /// Float64, (3,), on the device of the grid.
+    core::Tensor origin_;
+    bool has_colors_ = false;
+    std::shared_ptr<core::HashMap> hashmap_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace pointcloud {
+
+/// Farthest point sampling on the CPU, starting from the first point. Each
+/// step picks the point with the largest squared distance to the points
+/// picked so far, ties go to the smallest index.
+///
+/// Every step reduces the points in one chunk per thread. The chunks are
+/// merged in order, which makes the result independent of the number of
+/// threads. This is shared by t::geometry::PointCloud and the ML ops.
+///
+/// \param points    The point positions with shape [num_points,3].
+/// \param num_points    The number of points.
+/// \param num_samples    The number of samples, at most \p num_points.
+/// \param indices    Output array with the \p num_samples sampled indices.
+template <class T, class TIndex>
+void FarthestPointSample(const T* const points,
+                         int64_t num_points,
+                         int64_t num_samples,
+                         TIndex* indices) {
+    if (num_points <= 0 || num_samples <= 0) return;
+
+    // Small chunks do not amortize the cost of the parallel region.
+    constexpr int64_t min_chunk_size = 4096;
+    const int num_chunks = static_cast<int>(std::max<int64_t>(
+            1, std::min<int64_t>(utility::EstimateMaxThreads(),
+                                 num_points / min_chunk_size)));
+
+    std::vector<T> min_distances(num_points,
+                                 std::numeric_limits<T>::infinity());
+    std::vector<std::pair<T, int64_t>> chunk_max(num_chunks);
+    int64_t farthest = 0;
+    for (int64_t i = 0; i < num_samples; ++i) {
+        indices[i] = static_cast<TIndex>(farthest);
+        const T x = points[3 * farthest + 0];
+        const T y = points[3 * farthest + 1];
+        const T z = points[3 * farthest + 2];
+
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int c = 0; c < num_chunks; ++c) {
+            const int64_t begin = num_points * c / num_chunks;
+            const int64_t end = num_points * (c + 1) / num_chunks;
+            T max_distance = -1;
+            int64_t max_idx = begin;
+            for (int64_t k = begin; k < end; ++k) {
+                const T dx = points[3 * k + 0] - x;
+                const T dy = points[3 * k + 1] - y;
+                const T dz = points[3 * k + 2] - z;
+                const T distance = dx * dx + dy * dy + dz * dz;
+                if (distance < min_distances[k]) min_distances[k] = distance;
+                if (min_distances[k] > max_distance) {
+                    max_distance = min_distances[k];
+                    max_idx = k;
+                }
+            }
+            chunk_max[c] = std::make_pair(max_distance, max_idx);
+        }
+
+        std::pair<T, int64_t> max_pair = chunk_max[0];
+        for (int c = 1; c < num_chunks; ++c) {
+            if (chunk_max[c].first > max_pair.first) max_pair = chunk_max[c];
+        }
+        farthest = max_pair.second;
+    }
+}
+
+}  // namespace pointcloud
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
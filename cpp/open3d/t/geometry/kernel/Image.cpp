@@ -33,6 +33,45 @@ namespace geometry {
 namespace kernel {
 namespace image {
 
+void To(const core::Tensor &src,
+        core::Tensor &dst,
+        double scale,
+        double offset) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ToCPU(src, dst, scale, offset);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ToCUDA, src, dst, scale, offset);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Resize(const core::Tensor &src, core::Tensor &dst, bool linear) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ResizeCPU(src, dst, linear);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ResizeCUDA, src, dst, linear);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Remap(const core::Tensor &src,
+           const core::Tensor &map,
+           core::Tensor &dst,
+           bool linear) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        RemapCPU(src, map, dst, linear);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RemapCUDA, src, map, dst, linear);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void ClipTransform(const core::Tensor &src,
                    core::Tensor &dst,
                    float scale,
@@ -94,6 +133,51 @@ void CreateNormalMap(const core::Tensor &src,
     }
 }
 
+void ClipTransformBilateral(const core::Tensor &src,
+                            core::Tensor &dst,
+                            core::Tensor &dst_smooth,
+                            float scale,
+                            float min_value,
+                            float max_value,
+                            float clip_fill,
+                            int kernel_size,
+                            float value_sigma,
+                            float distance_sigma) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ClipTransformBilateralCPU(src, dst, dst_smooth, scale, min_value,
+                                  max_value, clip_fill, kernel_size,
+                                  value_sigma, distance_sigma);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ClipTransformBilateralCUDA, src, dst, dst_smooth, scale,
+                  min_value, max_value, clip_fill, kernel_size, value_sigma,
+                  distance_sigma);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void CreateVertexNormalMap(const core::Tensor &depth,
+                           const core::Tensor &depth_smooth,
+                           core::Tensor &vertex_map,
+                           core::Tensor &normal_map,
+                           const core::Tensor &intrinsics,
+                           float invalid_fill) {
+    core::Device device = depth.GetDevice();
+    static const core::Device host("CPU:0");
+
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        CreateVertexNormalMapCPU(depth, depth_smooth, vertex_map, normal_map,
+                                 intrinsics_d, invalid_fill);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CreateVertexNormalMapCUDA, depth, depth_smooth, vertex_map,
+                  normal_map, intrinsics_d, invalid_fill);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void ColorizeDepth(const core::Tensor &src,
                    core::Tensor &dst,
                    float scale,
@@ -34,6 +34,18 @@ namespace geometry {
 namespace kernel {
 namespace image {
 
+void To(const core::Tensor &src,
+        core::Tensor &dst,
+        double scale,
+        double offset);
+
+void Resize(const core::Tensor &src, core::Tensor &dst, bool linear);
+
+void Remap(const core::Tensor &src,
+           const core::Tensor &map,
+           core::Tensor &dst,
+           bool linear);
+
 void ClipTransform(const core::Tensor &src,
                    core::Tensor &dst,
                    float scale,
@@ -55,12 +67,42 @@ void CreateNormalMap(const core::Tensor &src,
                      core::Tensor &dst,
                      float invalid_fill);
 
+void ClipTransformBilateral(const core::Tensor &src,
+                            core::Tensor &dst,
+                            core::Tensor &dst_smooth,
+                            float scale,
+                            float min_value,
+                            float max_value,
+                            float clip_fill,
+                            int kernel_size,
+                            float value_sigma,
+                            float distance_sigma);
+
+void CreateVertexNormalMap(const core::Tensor &depth,
+                           const core::Tensor &depth_smooth,
+                           core::Tensor &vertex_map,
+                           core::Tensor &normal_map,
+                           const core::Tensor &intrinsics,
+                           float invalid_fill);
+
 void ColorizeDepth(const core::Tensor &src,
                    core::Tensor &dst,
                    float scale,
                    float min_value,
                    float max_value);
 
+void ToCPU(const core::Tensor &src,
+           core::Tensor &dst,
+           double scale,
+           double offset);
+
+void ResizeCPU(const core::Tensor &src, core::Tensor &dst, bool linear);
+
+void RemapCPU(const core::Tensor &src,
+              const core::Tensor &map,
+              core::Tensor &dst,
+              bool linear);
+
 void ClipTransformCPU(const core::Tensor &src,
                       core::Tensor &dst,
                       float scale,
@@ -82,6 +124,24 @@ void CreateNormalMapCPU(const core::Tensor &src,
                         core::Tensor &dst,
                         float invalid_fill);
 
+void ClipTransformBilateralCPU(const core::Tensor &src,
+                               core::Tensor &dst,
+                               core::Tensor &dst_smooth,
+                               float scale,
+                               float min_value,
+                               float max_value,
+                               float clip_fill,
+                               int kernel_size,
+                               float value_sigma,
+                               float distance_sigma);
+
+void CreateVertexNormalMapCPU(const core::Tensor &depth,
+                              const core::Tensor &depth_smooth,
+                              core::Tensor &vertex_map,
+                              core::Tensor &normal_map,
+                              const core::Tensor &intrinsics,
+                              float invalid_fill);
+
 void ColorizeDepthCPU(const core::Tensor &src,
                       core::Tensor &dst,
                       float scale,
@@ -89,6 +149,18 @@ void ColorizeDepthCPU(const core::Tensor &src,
                       float max_value);
 
 #ifdef BUILD_CUDA_MODULE
+void ToCUDA(const core::Tensor &src,
+            core::Tensor &dst,
+            double scale,
+            double offset);
+
+void ResizeCUDA(const core::Tensor &src, core::Tensor &dst, bool linear);
+
+void RemapCUDA(const core::Tensor &src,
+               const core::Tensor &map,
+               core::Tensor &dst,
+               bool linear);
+
 void ClipTransformCUDA(const core::Tensor &src,
                        core::Tensor &dst,
                        float scale,
@@ -110,6 +182,24 @@ void CreateNormalMapCUDA(const core::Tensor &src,
                          core::Tensor &dst,
                          float invalid_fill);
 
+void ClipTransformBilateralCUDA(const core::Tensor &src,
+                                core::Tensor &dst,
+                                core::Tensor &dst_smooth,
+                                float scale,
+                                float min_value,
+                                float max_value,
+                                float clip_fill,
+                                int kernel_size,
+                                float value_sigma,
+                                float distance_sigma);
+
+void CreateVertexNormalMapCUDA(const core::Tensor &depth,
+                               const core::Tensor &depth_smooth,
+                               core::Tensor &vertex_map,
+                               core::Tensor &normal_map,
+                               const core::Tensor &intrinsics,
+                               float invalid_fill);
+
 void ColorizeDepthCUDA(const core::Tensor &src,
                        core::Tensor &dst,
                        float scale,
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <limits>
+#include <type_traits>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
@@ -41,6 +44,236 @@ using std::isinf;
 using std::isnan;
 #endif
 
+// Converts v to scalar_t with rounding to nearest and saturation to [lo, hi]
+// for integer types.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE scalar_t SaturateCast(double v, double lo, double hi) {
+#ifndef __CUDACC__
+    using std::rint;
+#endif
+    if (std::is_same<scalar_t, bool>::value) {
+        return static_cast<scalar_t>(v != 0);
+    } else if (std::is_integral<scalar_t>::value) {
+        v = rint(v);
+        v = v < lo ? lo : v;
+        v = v > hi ? hi : v;
+    }
+    return static_cast<scalar_t>(v);
+}
+
+#ifdef __CUDACC__
+void ToCUDA
+#else
+void ToCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         double scale,
+         double offset) {
+    const int64_t n = src.NumElements();
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using src_t = scalar_t;
+        const src_t* src_ptr = src.GetDataPtr<src_t>();
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst.GetDtype(), [&]() {
+            using dst_t = scalar_t;
+            dst_t* dst_ptr = dst.GetDataPtr<dst_t>();
+            const double lo =
+                    static_cast<double>(std::numeric_limits<dst_t>::lowest());
+            const double hi =
+                    static_cast<double>(std::numeric_limits<dst_t>::max());
+            core::ParallelFor(src.GetDevice(), n,
+                              [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                                  double v = static_cast<double>(
+                                          src_ptr[workload_idx]);
+                                  dst_ptr[workload_idx] = SaturateCast<dst_t>(
+                                          v * scale + offset, lo, hi);
+                              });
+        });
+    });
+}
+
+#ifdef __CUDACC__
+void ResizeCUDA
+#else
+void ResizeCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst, bool linear) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t rows_dst = dst.GetShape(0);
+    const int64_t cols_dst = dst.GetShape(1);
+    const int64_t n = rows_dst * cols_dst;
+
+    // Pixel centers are aligned, i.e. pixel x in dst maps to
+    // (x + 0.5) * scale - 0.5 in src.
+    const double scale_x = double(cols) / cols_dst;
+    const double scale_y = double(rows) / rows_dst;
+
+#ifndef __CUDACC__
+    using std::ceil;
+    using std::floor;
+    using std::max;
+    using std::min;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const double lo =
+                static_cast<double>(std::numeric_limits<scalar_t>::lowest());
+        const double hi =
+                static_cast<double>(std::numeric_limits<scalar_t>::max());
+        core::ParallelFor(
+                src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols_dst;
+                    int64_t x = workload_idx % cols_dst;
+
+                    double xs = (x + 0.5) * scale_x - 0.5;
+                    double ys = (y + 0.5) * scale_y - 0.5;
+                    scalar_t* out = dst_indexer.GetDataPtr<scalar_t>(x, y);
+
+                    if (!linear) {
+                        // Round to nearest, ties go to the smaller index.
+                        int64_t x0 = static_cast<int64_t>(ceil(xs - 0.5));
+                        int64_t y0 = static_cast<int64_t>(ceil(ys - 0.5));
+                        x0 = min(max(x0, int64_t(0)), cols - 1);
+                        y0 = min(max(y0, int64_t(0)), rows - 1);
+                        const scalar_t* in =
+                                src_indexer.GetDataPtr<scalar_t>(x0, y0);
+                        for (int64_t c = 0; c < channels; ++c) {
+                            out[c] = in[c];
+                        }
+                        return;
+                    }
+
+                    xs = min(max(xs, 0.0), double(cols - 1));
+                    ys = min(max(ys, 0.0), double(rows - 1));
+                    int64_t x0 = static_cast<int64_t>(floor(xs));
+                    int64_t y0 = static_cast<int64_t>(floor(ys));
+                    int64_t x1 = min(x0 + 1, cols - 1);
+                    int64_t y1 = min(y0 + 1, rows - 1);
+                    double wx = xs - x0;
+                    double wy = ys - y0;
+
+                    const scalar_t* in00 =
+                            src_indexer.GetDataPtr<scalar_t>(x0, y0);
+                    const scalar_t* in01 =
+                            src_indexer.GetDataPtr<scalar_t>(x1, y0);
+                    const scalar_t* in10 =
+                            src_indexer.GetDataPtr<scalar_t>(x0, y1);
+                    const scalar_t* in11 =
+                            src_indexer.GetDataPtr<scalar_t>(x1, y1);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        double v = (1 - wy) * ((1 - wx) * in00[c] +
+                                               wx * in01[c]) +
+                                   wy * ((1 - wx) * in10[c] + wx * in11[c]);
+                        out[c] = SaturateCast<scalar_t>(v, lo, hi);
+                    }
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void RemapCUDA
+#else
+void RemapCPU
+#endif
+        (const core::Tensor& src,
+         const core::Tensor& map,
+         core::Tensor& dst,
+         bool linear) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer map_indexer(map, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t cols_dst = dst.GetShape(1);
+    const int64_t n = dst.GetShape(0) * cols_dst;
+
+#ifndef __CUDACC__
+    using std::floor;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        const double lo =
+                static_cast<double>(std::numeric_limits<scalar_t>::lowest());
+        const double hi =
+                static_cast<double>(std::numeric_limits<scalar_t>::max());
+        core::ParallelFor(
+                src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t y = workload_idx / cols_dst;
+                    int64_t x = workload_idx % cols_dst;
+
+                    // Source coordinates of the pixel center, NaN maps to
+                    // the border value as well.
+                    const float* xy = map_indexer.GetDataPtr<float>(x, y);
+                    const float xs = xy[0];
+                    const float ys = xy[1];
+                    scalar_t* out = dst_indexer.GetDataPtr<scalar_t>(x, y);
+                    if (!(xs > -1 && xs < cols && ys > -1 && ys < rows)) {
+                        for (int64_t c = 0; c < channels; ++c) {
+                            out[c] = scalar_t(0);
+                        }
+                        return;
+                    }
+
+                    if (!linear) {
+                        int64_t x0 = static_cast<int64_t>(floor(xs + 0.5f));
+                        int64_t y0 = static_cast<int64_t>(floor(ys + 0.5f));
+                        if (x0 < 0 || x0 >= cols || y0 < 0 ||
+                            y0 >= rows) {
+                            for (int64_t c = 0; c < channels; ++c) {
+                                out[c] = scalar_t(0);
+                            }
+                            return;
+                        }
+                        const scalar_t* in =
+                                src_indexer.GetDataPtr<scalar_t>(x0, y0);
+                        for (int64_t c = 0; c < channels; ++c) {
+                            out[c] = in[c];
+                        }
+                        return;
+                    }
+
+                    // Bilinear with a constant zero border, neighbours
+                    // outside of the image contribute nothing.
+                    const int64_t x0 = static_cast<int64_t>(floor(xs));
+                    const int64_t y0 = static_cast<int64_t>(floor(ys));
+                    const double wx = xs - x0;
+                    const double wy = ys - y0;
+                    const bool vx0 = x0 >= 0, vx1 = x0 + 1 < cols;
+                    const bool vy0 = y0 >= 0, vy1 = y0 + 1 < rows;
+                    for (int64_t c = 0; c < channels; ++c) {
+                        double v = 0;
+                        if (vy0 && vx0) {
+                            v += (1 - wy) * (1 - wx) *
+                                 src_indexer.GetDataPtr<scalar_t>(x0, y0)[c];
+                        }
+                        if (vy0 && vx1) {
+                            v += (1 - wy) * wx *
+                                 src_indexer.GetDataPtr<scalar_t>(x0 + 1,
+                                                                  y0)[c];
+                        }
+                        if (vy1 && vx0) {
+                            v += wy * (1 - wx) *
+                                 src_indexer.GetDataPtr<scalar_t>(x0,
+                                                                  y0 + 1)[c];
+                        }
+                        if (vy1 && vx1) {
+                            v += wy * wx *
+                                 src_indexer.GetDataPtr<scalar_t>(x0 + 1,
+                                                                  y0 + 1)[c];
+                        }
+                        out[c] = SaturateCast<scalar_t>(v, lo, hi);
+                    }
+                });
+    });
+}
+
 #ifdef __CUDACC__
 void ClipTransformCUDA
 #else
@@ -260,6 +493,185 @@ void CreateNormalMapCPU
             });
 }
 
+#ifdef __CUDACC__
+void ClipTransformBilateralCUDA
+#else
+void ClipTransformBilateralCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         core::Tensor& dst_smooth,
+         float scale,
+         float min_value,
+         float max_value,
+         float clip_fill,
+         int kernel_size,
+         float value_sigma,
+         float distance_sigma) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+    NDArrayIndexer dst_smooth_indexer(dst_smooth, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t n = rows * cols;
+
+    const int radius = kernel_size / 2;
+    const float value_factor = -0.5f / (value_sigma * value_sigma);
+    const float distance_factor = -0.5f / (distance_sigma * distance_sigma);
+
+#ifndef __CUDACC__
+    using std::exp;
+    using std::isinf;
+    using std::isnan;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        core::ParallelFor(
+                src.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    auto is_invalid = [clip_fill] OPEN3D_DEVICE(float v) {
+                        if (isinf(clip_fill)) return isinf(v);
+                        if (isnan(clip_fill)) return isnan(v);
+                        return v == clip_fill;
+                    };
+                    // Same as ClipTransform.
+                    auto clip_transform = [=] OPEN3D_DEVICE(int64_t x,
+                                                            int64_t y) {
+                        float in = static_cast<float>(
+                                *src_indexer.GetDataPtr<scalar_t>(x, y));
+                        float out = in / scale;
+                        out = out <= min_value ? clip_fill : out;
+                        out = out >= max_value ? clip_fill : out;
+                        return out;
+                    };
+
+                    int64_t y = workload_idx / cols;
+                    int64_t x = workload_idx % cols;
+
+                    float d_center = clip_transform(x, y);
+                    *dst_indexer.GetDataPtr<float>(x, y) = d_center;
+                    if (is_invalid(d_center)) {
+                        *dst_smooth_indexer.GetDataPtr<float>(x, y) = clip_fill;
+                        return;
+                    }
+
+                    // Bilateral filter over the valid depth values in a
+                    // square window.
+                    float v_sum = 0;
+                    float w_sum = 0;
+                    for (int64_t yk = y - radius; yk <= y + radius; ++yk) {
+                        if (yk < 0 || yk >= rows) continue;
+                        for (int64_t xk = x - radius; xk <= x + radius; ++xk) {
+                            if (xk < 0 || xk >= cols) continue;
+                            float d = clip_transform(xk, yk);
+                            if (is_invalid(d)) continue;
+                            float dv = d - d_center;
+                            float dist2 = float((xk - x) * (xk - x) +
+                                                (yk - y) * (yk - y));
+                            float w = exp(value_factor * dv * dv +
+                                          distance_factor * dist2);
+                            v_sum += w * d;
+                            w_sum += w;
+                        }
+                    }
+                    *dst_smooth_indexer.GetDataPtr<float>(x, y) =
+                            v_sum / w_sum;
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void CreateVertexNormalMapCUDA
+#else
+void CreateVertexNormalMapCPU
+#endif
+        (const core::Tensor& depth,
+         const core::Tensor& depth_smooth,
+         core::Tensor& vertex_map,
+         core::Tensor& normal_map,
+         const core::Tensor& intrinsics,
+         float invalid_fill) {
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer depth_smooth_indexer(depth_smooth, 2);
+    NDArrayIndexer vertex_indexer(vertex_map, 2);
+    NDArrayIndexer normal_indexer(normal_map, 2);
+    TransformIndexer ti(intrinsics, core::Tensor::Eye(4, core::Float64,
+                                                      core::Device("CPU:0")));
+
+    int64_t rows = depth.GetShape(0);
+    int64_t cols = depth.GetShape(1);
+    int64_t n = rows * cols;
+
+#ifndef __CUDACC__
+    using std::isinf;
+    using std::isnan;
+    using std::sqrt;
+#endif
+
+    core::ParallelFor(
+            depth.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                auto is_invalid = [invalid_fill] OPEN3D_DEVICE(float v) {
+                    if (isinf(invalid_fill)) return isinf(v);
+                    if (isnan(invalid_fill)) return isnan(v);
+                    return v == invalid_fill;
+                };
+
+                int64_t y = workload_idx / cols;
+                int64_t x = workload_idx % cols;
+
+                float* vertex = vertex_indexer.GetDataPtr<float>(x, y);
+                float d = *depth_indexer.GetDataPtr<float>(x, y);
+                if (!is_invalid(d)) {
+                    ti.Unproject(static_cast<float>(x), static_cast<float>(y),
+                                 d, vertex + 0, vertex + 1, vertex + 2);
+                } else {
+                    vertex[0] = invalid_fill;
+                    vertex[1] = invalid_fill;
+                    vertex[2] = invalid_fill;
+                }
+
+                // The normals are computed from the smoothed depth as in
+                // CreateNormalMap, with the vertices unprojected on the fly.
+                float* normal = normal_indexer.GetDataPtr<float>(x, y);
+                normal[0] = invalid_fill;
+                normal[1] = invalid_fill;
+                normal[2] = invalid_fill;
+                if (y >= rows - 1 || x >= cols - 1) return;
+
+                float d00 = *depth_smooth_indexer.GetDataPtr<float>(x, y);
+                float d10 = *depth_smooth_indexer.GetDataPtr<float>(x + 1, y);
+                float d01 = *depth_smooth_indexer.GetDataPtr<float>(x, y + 1);
+                if (is_invalid(d00) || is_invalid(d10) || is_invalid(d01)) {
+                    return;
+                }
+
+                float v00[3], v10[3], v01[3];
+                ti.Unproject(static_cast<float>(x), static_cast<float>(y), d00,
+                             v00 + 0, v00 + 1, v00 + 2);
+                ti.Unproject(static_cast<float>(x + 1), static_cast<float>(y),
+                             d10, v10 + 0, v10 + 1, v10 + 2);
+                ti.Unproject(static_cast<float>(x), static_cast<float>(y + 1),
+                             d01, v01 + 0, v01 + 1, v01 + 2);
+
+                float dx0 = v01[0] - v00[0];
+                float dy0 = v01[1] - v00[1];
+                float dz0 = v01[2] - v00[2];
+
+                float dx1 = v10[0] - v00[0];
+                float dy1 = v10[1] - v00[1];
+                float dz1 = v10[2] - v00[2];
+
+                float nx = dy0 * dz1 - dz0 * dy1;
+                float ny = dz0 * dx1 - dx0 * dz1;
+                float nz = dx0 * dy1 - dy0 * dx1;
+
+                float normal_norm = sqrt(nx * nx + ny * ny + nz * nz);
+                normal[0] = nx / normal_norm;
+                normal[1] = ny / normal_norm;
+                normal[2] = nz / normal_norm;
+            });
+}
+
 #ifdef __CUDACC__
 void ColorizeDepthCUDA
 #else
@@ -31,6 +31,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Utility.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -80,6 +81,102 @@ void Unproject(const core::Tensor& depth,
     }
 }
 
+void UnprojectBatch(
+        const core::Tensor& depths,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        core::Tensor& camera_ids,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max,
+        int64_t stride) {
+    if (image_colors.has_value() != colors.has_value()) {
+        utility::LogError(
+                "[UnprojectBatch] Both or none of image_colors and colors "
+                "must have values.");
+    }
+    if (stride < 1) {
+        utility::LogError("[UnprojectBatch] stride must be positive, got {}.",
+                          stride);
+    }
+
+    const core::SizeVector shape = depths.GetShape();
+    if (!(shape.size() == 3 || (shape.size() == 4 && shape[3] == 1))) {
+        utility::LogError(
+                "[UnprojectBatch] Expected depths of shape {B, H, W} or "
+                "{B, H, W, 1}, got {}.",
+                shape);
+    }
+    const int64_t num_cameras = shape[0];
+    const core::Tensor depths_3d =
+            depths.Contiguous().Reshape({num_cameras, shape[1], shape[2]});
+
+    core::AssertTensorShape(extrinsics, {num_cameras, 4, 4});
+    const bool shared_intrinsics = intrinsics.NumDims() == 2;
+    if (shared_intrinsics) {
+        core::AssertTensorShape(intrinsics, {3, 3});
+    } else {
+        core::AssertTensorShape(intrinsics, {num_cameras, 3, 3});
+    }
+
+    const core::Device device = depths.GetDevice();
+    core::Tensor image_colors_c;
+    if (image_colors.has_value()) {
+        const core::Tensor& imcol = image_colors.value().get();
+        core::AssertTensorDevice(imcol, device);
+        core::AssertTensorDtype(imcol, core::Float32);
+        core::AssertTensorShape(imcol, {num_cameras, shape[1], shape[2], 3});
+        image_colors_c = imcol.Contiguous();
+    }
+
+    // Per camera parameters {fx, fy, cx, cy, camera to world 3x4}, rounded
+    // to float the same way as TransformIndexer.
+    static const core::Device host("CPU:0");
+    const core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Float64).Contiguous();
+    const core::Tensor extrinsics_d =
+            extrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor cameras({num_cameras, 16}, core::Float32, host);
+    float* cameras_ptr = cameras.GetDataPtr<float>();
+    for (int64_t b = 0; b < num_cameras; ++b) {
+        const double* K = intrinsics_d.GetDataPtr<double>() +
+                          (shared_intrinsics ? 0 : 9 * b);
+        const core::Tensor pose =
+                t::geometry::InverseTransformation(extrinsics_d[b])
+                        .Contiguous();
+        const double* T = pose.GetDataPtr<double>();
+        float* camera = cameras_ptr + 16 * b;
+        camera[0] = static_cast<float>(K[0]);
+        camera[1] = static_cast<float>(K[4]);
+        camera[2] = static_cast<float>(K[2]);
+        camera[3] = static_cast<float>(K[5]);
+        for (int i = 0; i < 12; ++i) {
+            camera[4 + i] = static_cast<float>(T[i]);
+        }
+    }
+    cameras = cameras.To(device);
+
+    utility::optional<std::reference_wrapper<const core::Tensor>>
+            image_colors_ref = utility::nullopt;
+    if (image_colors.has_value()) {
+        image_colors_ref = std::cref(image_colors_c);
+    }
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        UnprojectBatchCPU(depths_3d, image_colors_ref, points, colors,
+                          camera_ids, cameras, depth_scale, depth_max, stride);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(UnprojectBatchCUDA, depths_3d, image_colors_ref, points,
+                  colors, camera_ids, cameras, depth_scale, depth_max, stride);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void Project(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
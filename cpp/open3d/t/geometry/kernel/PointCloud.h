@@ -47,6 +47,24 @@ void Unproject(const core::Tensor& depth,
                float depth_max,
                int64_t stride);
 
+/// Unprojects a stack of B depth images {B, H, W} (or {B, H, W, 1}) into one
+/// point cloud with a single launch and a single compaction. \p intrinsics is
+/// shared {3, 3} or per camera {B, 3, 3}, \p extrinsics is {B, 4, 4}.
+/// \p camera_ids {N, 1} Int32 holds the index of the source image of each
+/// point. Optional \p image_colors {B, H, W, 3} must be Float32.
+void UnprojectBatch(
+        const core::Tensor& depths,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        core::Tensor& camera_ids,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max,
+        int64_t stride);
+
 void Project(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -69,6 +87,18 @@ void UnprojectCPU(
         float depth_max,
         int64_t stride);
 
+void UnprojectBatchCPU(
+        const core::Tensor& depths,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        core::Tensor& camera_ids,
+        const core::Tensor& cameras,
+        float depth_scale,
+        float depth_max,
+        int64_t stride);
+
 void ProjectCPU(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -92,6 +122,18 @@ void UnprojectCUDA(
         float depth_max,
         int64_t stride);
 
+void UnprojectBatchCUDA(
+        const core::Tensor& depths,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        core::Tensor& camera_ids,
+        const core::Tensor& cameras,
+        float depth_scale,
+        float depth_max,
+        int64_t stride);
+
 void ProjectCUDA(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -129,6 +171,79 @@ void EstimateColorGradientsUsingKNNSearchCPU(const core::Tensor& points,
                                              core::Tensor& color_gradient,
                                              const int64_t& max_nn);
 
+void ComputeISSSaliencyCPU(const core::Tensor& points,
+                           const core::Tensor& neighbor_indices,
+                           const core::Tensor& neighbor_row_splits,
+                           core::Tensor& saliency,
+                           int64_t min_neighbors,
+                           double gamma_21,
+                           double gamma_32);
+
+void ComputeISSLocalMaximaCPU(const core::Tensor& saliency,
+                              const core::Tensor& query_indices,
+                              const core::Tensor& neighbor_indices,
+                              const core::Tensor& neighbor_row_splits,
+                              core::Tensor& is_local_maximum,
+                              int64_t min_neighbors);
+
+/// Farthest point sampling starting from the first point. \p indices is an
+/// Int64 tensor whose length is the number of samples.
+void FarthestPointSampleCPU(const core::Tensor& points, core::Tensor& indices);
+
+/// Computes a 63-bit space filling curve code per point. The positions are
+/// quantized to a grid of 2^21 cells per axis with origin \p min_bound, a
+/// Float64 tensor of shape {3} on the host, and cell size \p cell_size.
+/// \p codes is an Int64 tensor of shape {N}. If \p hilbert is true, Hilbert
+/// codes are computed, otherwise Morton (Z-order) codes.
+void ComputeSpatialCodesCPU(const core::Tensor& points,
+                            const core::Tensor& min_bound,
+                            double cell_size,
+                            bool hilbert,
+                            core::Tensor& codes);
+
+/// Computes the principal axes of each of the B covariance matrices of shape
+/// {B, 3, 3}. \p rotations has the same shape and dtype; its columns are the
+/// axes sorted by decreasing variance and form a right-handed frame.
+void ComputePrincipalAxesCPU(const core::Tensor& covariances,
+                             core::Tensor& rotations);
+
+/// Computes for each cluster the box with vertical z axis and the smallest
+/// footprint in the xy plane. The points of a cluster, rows
+/// [row_splits[i], row_splits[i + 1]) of \p points, must be sorted by x and
+/// then by y. \p min_bounds and \p max_bounds of shape {B, 3} are the axis
+/// aligned bounds of the clusters. The x axis of a box is along the longer
+/// side of its footprint. The outputs \p centers {B, 3},
+/// \p rotations {B, 3, 3} and \p extents {B, 3} have the dtype of \p points.
+void ComputeUprightMinimalAreaBoxesCPU(const core::Tensor& points,
+                                       const core::Tensor& row_splits,
+                                       const core::Tensor& min_bounds,
+                                       const core::Tensor& max_bounds,
+                                       core::Tensor& centers,
+                                       core::Tensor& rotations,
+                                       core::Tensor& extents);
+
+/// Orients \p normals {N, 3} consistently along the minimum spanning tree of
+/// the KNN graph \p neighbors {N, K} (Int64, -1 for no neighbor) with edge
+/// weights 1 - |n_i . n_j|. The tree is built with Boruvka's algorithm. If
+/// \p tiles is an Int64 tensor {N, 3} of integer tile coordinates, edges
+/// within a tile are preferred over edges between tiles, otherwise it has
+/// shape {0}. In each tree, the normal of the point with the largest z points
+/// upwards. N * K must be less than 2^32.
+void OrientNormalsAlongSpanningTreeCPU(const core::Tensor& points,
+                                       const core::Tensor& neighbors,
+                                       const core::Tensor& tiles,
+                                       core::Tensor& normals);
+
+/// Computes the Bool visibility {V, N} of \p points from \p viewpoints
+/// {V, 3}, both in the same dtype, with equirectangular depth buffers of
+/// \p width x \p width / 2 pixels. See PointCloud::ComputeVisibility().
+void ComputeVisibilityCPU(const core::Tensor& points,
+                          const core::Tensor& viewpoints,
+                          double point_radius,
+                          int64_t width,
+                          double depth_tolerance,
+                          core::Tensor& visible);
+
 #ifdef BUILD_CUDA_MODULE
 void EstimateCovariancesUsingHybridSearchCUDA(const core::Tensor& points,
                                               core::Tensor& covariances,
@@ -155,6 +270,49 @@ void EstimateColorGradientsUsingKNNSearchCUDA(const core::Tensor& points,
                                               const core::Tensor& colors,
                                               core::Tensor& color_gradient,
                                               const int64_t& max_nn);
+void ComputeISSSaliencyCUDA(const core::Tensor& points,
+                            const core::Tensor& neighbor_indices,
+                            const core::Tensor& neighbor_row_splits,
+                            core::Tensor& saliency,
+                            int64_t min_neighbors,
+                            double gamma_21,
+                            double gamma_32);
+
+void ComputeISSLocalMaximaCUDA(const core::Tensor& saliency,
+                               const core::Tensor& query_indices,
+                               const core::Tensor& neighbor_indices,
+                               const core::Tensor& neighbor_row_splits,
+                               core::Tensor& is_local_maximum,
+                               int64_t min_neighbors);
+
+void ComputeSpatialCodesCUDA(const core::Tensor& points,
+                             const core::Tensor& min_bound,
+                             double cell_size,
+                             bool hilbert,
+                             core::Tensor& codes);
+
+void ComputePrincipalAxesCUDA(const core::Tensor& covariances,
+                              core::Tensor& rotations);
+
+void ComputeUprightMinimalAreaBoxesCUDA(const core::Tensor& points,
+                                        const core::Tensor& row_splits,
+                                        const core::Tensor& min_bounds,
+                                        const core::Tensor& max_bounds,
+                                        core::Tensor& centers,
+                                        core::Tensor& rotations,
+                                        core::Tensor& extents);
+
+void OrientNormalsAlongSpanningTreeCUDA(const core::Tensor& points,
+                                        const core::Tensor& neighbors,
+                                        const core::Tensor& tiles,
+                                        core::Tensor& normals);
+
+void ComputeVisibilityCUDA(const core::Tensor& points,
+                           const core::Tensor& viewpoints,
+                           double point_radius,
+                           int64_t width,
+                           double depth_tolerance,
+                           core::Tensor& visible);
 #endif
 
 }  // namespace pointcloud
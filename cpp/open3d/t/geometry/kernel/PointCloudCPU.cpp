@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/t/geometry/kernel/FarthestPointSampling.h"
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
 
 namespace open3d {
@@ -97,6 +98,15 @@ void ProjectCPU(
     });
 }
 
+void FarthestPointSampleCPU(const core::Tensor& points,
+                            core::Tensor& indices) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        FarthestPointSample(points.GetDataPtr<scalar_t>(), points.GetLength(),
+                            indices.GetLength(),
+                            indices.GetDataPtr<int64_t>());
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -25,8 +25,13 @@
 // ----------------------------------------------------------------------------
 
 #include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
 #include <vector>
 
+#include "open3d/core/Atomic.h"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -50,6 +55,10 @@ namespace pointcloud {
 
 #ifndef __CUDACC__
 using std::abs;
+using std::asin;
+using std::atan2;
+using std::cos;
+using std::floor;
 using std::max;
 using std::min;
 using std::sqrt;
@@ -144,7 +153,7 @@ void UnprojectCPU
 #endif
 
 #ifdef __CUDACC__
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
 #endif
     points = points.Slice(0, 0, total_pts_count);
     if (have_colors) {
@@ -153,6 +162,107 @@ void UnprojectCPU
     }
 }
 
+#if defined(__CUDACC__)
+void UnprojectBatchCUDA
+#else
+void UnprojectBatchCPU
+#endif
+        (const core::Tensor& depths,
+         utility::optional<std::reference_wrapper<const core::Tensor>>
+                 image_colors,
+         core::Tensor& points,
+         utility::optional<std::reference_wrapper<core::Tensor>> colors,
+         core::Tensor& camera_ids,
+         const core::Tensor& cameras,
+         float depth_scale,
+         float depth_max,
+         int64_t stride) {
+    const bool have_colors = image_colors.has_value();
+    const core::Device device = depths.GetDevice();
+
+    const int64_t rows = depths.GetShape(1);
+    const int64_t cols = depths.GetShape(2);
+    const int64_t rows_strided = rows / stride;
+    const int64_t cols_strided = cols / stride;
+    const int64_t pixels_per_camera = rows_strided * cols_strided;
+    const int64_t n = depths.GetShape(0) * pixels_per_camera;
+
+    // Output
+    points = core::Tensor({n, 3}, core::Float32, device);
+    camera_ids = core::Tensor({n, 1}, core::Int32, device);
+    float* points_ptr = points.GetDataPtr<float>();
+    int32_t* camera_ids_ptr = camera_ids.GetDataPtr<int32_t>();
+    const float* image_colors_ptr = nullptr;
+    float* colors_ptr = nullptr;
+    if (have_colors) {
+        image_colors_ptr = image_colors.value().get().GetDataPtr<float>();
+        colors.value().get() = core::Tensor({n, 3}, core::Float32, device);
+        colors_ptr = colors.value().get().GetDataPtr<float>();
+    }
+    const float* cameras_ptr = cameras.GetDataPtr<float>();
+
+    // Counter
+#if defined(__CUDACC__)
+    core::Tensor count(std::vector<int>{0}, {}, core::Int32, device);
+    int* count_ptr = count.GetDataPtr<int>();
+#else
+    std::atomic<int> count_atomic(0);
+    std::atomic<int>* count_ptr = &count_atomic;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(depths.GetDtype(), [&]() {
+        const scalar_t* depths_ptr = depths.GetDataPtr<scalar_t>();
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t camera = workload_idx / pixels_per_camera;
+            const int64_t pixel = workload_idx % pixels_per_camera;
+            const int64_t y = (pixel / cols_strided) * stride;
+            const int64_t x = (pixel % cols_strided) * stride;
+            const int64_t offset = (camera * rows + y) * cols + x;
+
+            const float d = depths_ptr[offset] / depth_scale;
+            if (d > 0 && d < depth_max) {
+                const int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+
+                // Same arithmetic as TransformIndexer::Unproject and
+                // TransformIndexer::RigidTransform.
+                const float* K = cameras_ptr + 16 * camera;
+                const float* T = K + 4;
+                const float x_c = (static_cast<float>(x) - K[2]) * d / K[0];
+                const float y_c = (static_cast<float>(y) - K[3]) * d / K[1];
+                const float z_c = d;
+
+                float* vertex = points_ptr + 3 * idx;
+                vertex[0] = x_c * T[0] + y_c * T[1] + z_c * T[2] + T[3];
+                vertex[1] = x_c * T[4] + y_c * T[5] + z_c * T[6] + T[7];
+                vertex[2] = x_c * T[8] + y_c * T[9] + z_c * T[10] + T[11];
+                camera_ids_ptr[idx] = static_cast<int32_t>(camera);
+                if (have_colors) {
+                    float* pcd_pixel = colors_ptr + 3 * idx;
+                    const float* image_pixel = image_colors_ptr + 3 * offset;
+                    pcd_pixel[0] = image_pixel[0];
+                    pcd_pixel[1] = image_pixel[1];
+                    pcd_pixel[2] = image_pixel[2];
+                }
+            }
+        });
+    });
+#if defined(__CUDACC__)
+    int total_pts_count = count.Item<int>();
+#else
+    int total_pts_count = (*count_ptr).load();
+#endif
+
+#ifdef __CUDACC__
+    core::cuda::StreamSynchronize();
+#endif
+    points = points.Slice(0, 0, total_pts_count);
+    camera_ids = camera_ids.Slice(0, 0, total_pts_count);
+    if (have_colors) {
+        colors.value().get() =
+                colors.value().get().Slice(0, 0, total_pts_count);
+    }
+}
+
 // This is a `two-pass` estimate method for covariance which is numerically more
 // robust than the `textbook` method generally used for covariance computation.
 template <typename scalar_t>
@@ -277,7 +387,7 @@ void EstimateCovariancesUsingHybridSearchCPU
                 });
     });
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::StreamSynchronize();
 }
 
 #if defined(__CUDACC__)
@@ -329,7 +439,7 @@ void EstimateCovariancesUsingKNNSearchCPU
                 });
     });
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::StreamSynchronize();
 }
 
 template <typename scalar_t>
@@ -648,7 +758,7 @@ void EstimateNormalsFromCovariancesCPU
                 });
     });
 
-    core::cuda::Synchronize(covariances.GetDevice());
+    core::cuda::StreamSynchronize();
 }
 
 template <typename scalar_t>
@@ -801,7 +911,7 @@ void EstimateColorGradientsUsingHybridSearchCPU
                 });
     });
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::StreamSynchronize();
 }
 
 #if defined(__CUDACC__)
@@ -855,7 +965,759 @@ void EstimateColorGradientsUsingKNNSearchCPU
                 });
     });
 
-    core::cuda::Synchronize(points.GetDevice());
+    core::cuda::StreamSynchronize();
+}
+
+/// Eigenvalues of the symmetric 3x3 matrix with entries {xx, yy, zz, xy, xz,
+/// yz}, in increasing order. Uses the closed form of the same reference as
+/// EstimatePointWiseNormalsWithFastEigen3x3.
+OPEN3D_HOST_DEVICE inline void ComputeSymmetricEigenvalues3x3(const double* A,
+                                                              double* eval) {
+    const double norm = A[3] * A[3] + A[4] * A[4] + A[5] * A[5];
+    if (norm == 0) {
+        eval[0] = min(A[0], min(A[1], A[2]));
+        eval[2] = max(A[0], max(A[1], A[2]));
+        eval[1] = A[0] + A[1] + A[2] - eval[0] - eval[2];
+        return;
+    }
+    const double q = (A[0] + A[1] + A[2]) / 3.0;
+    const double b00 = A[0] - q;
+    const double b11 = A[1] - q;
+    const double b22 = A[2] - q;
+    const double p =
+            sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2.0) / 6.0);
+    const double c00 = b11 * b22 - A[5] * A[5];
+    const double c01 = A[3] * b22 - A[5] * A[4];
+    const double c02 = A[3] * A[5] - b11 * A[4];
+    const double det = (b00 * c00 - A[3] * c01 + A[4] * c02) / (p * p * p);
+    const double half_det = min(max(det * 0.5, -1.0), 1.0);
+    const double angle = acos(half_det) / 3.0;
+    const double two_thirds_pi = 2.09439510239319549;
+    const double beta2 = cos(angle) * 2.0;
+    const double beta0 = cos(angle + two_thirds_pi) * 2.0;
+    const double beta1 = -(beta0 + beta2);
+    eval[0] = q + p * beta0;
+    eval[1] = q + p * beta1;
+    eval[2] = q + p * beta2;
+}
+
+#if defined(__CUDACC__)
+void ComputeISSSaliencyCUDA
+#else
+void ComputeISSSaliencyCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_row_splits,
+         core::Tensor& saliency,
+         int64_t min_neighbors,
+         double gamma_21,
+         double gamma_32) {
+    const int64_t n = saliency.GetLength();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const int32_t* indices_ptr = neighbor_indices.GetDataPtr<int32_t>();
+        const int64_t* splits_ptr = neighbor_row_splits.GetDataPtr<int64_t>();
+        scalar_t* saliency_ptr = saliency.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(
+                points.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t begin = splits_ptr[workload_idx];
+                    const int64_t count = splits_ptr[workload_idx + 1] - begin;
+                    saliency_ptr[workload_idx] = 0;
+                    if (count < min_neighbors || count == 0) {
+                        return;
+                    }
+
+                    // Scatter matrix of the neighborhood, as the legacy
+                    // utility::ComputeCovariance().
+                    double cumulants[9] = {0};
+                    for (int64_t k = begin; k < begin + count; ++k) {
+                        const scalar_t* p = points_ptr + 3 * indices_ptr[k];
+                        const double x = p[0], y = p[1], z = p[2];
+                        cumulants[0] += x;
+                        cumulants[1] += y;
+                        cumulants[2] += z;
+                        cumulants[3] += x * x;
+                        cumulants[4] += y * y;
+                        cumulants[5] += z * z;
+                        cumulants[6] += x * y;
+                        cumulants[7] += x * z;
+                        cumulants[8] += y * z;
+                    }
+                    for (int i = 0; i < 9; ++i) {
+                        cumulants[i] /= count;
+                    }
+                    const double A[6] = {
+                            cumulants[3] - cumulants[0] * cumulants[0],
+                            cumulants[4] - cumulants[1] * cumulants[1],
+                            cumulants[5] - cumulants[2] * cumulants[2],
+                            cumulants[6] - cumulants[0] * cumulants[1],
+                            cumulants[7] - cumulants[0] * cumulants[2],
+                            cumulants[8] - cumulants[1] * cumulants[2]};
+                    if (A[0] == 0 && A[1] == 0 && A[2] == 0 && A[3] == 0 &&
+                        A[4] == 0 && A[5] == 0) {
+                        return;
+                    }
+
+                    double eval[3];
+                    ComputeSymmetricEigenvalues3x3(A, eval);
+                    if (eval[1] / eval[2] < gamma_21 &&
+                        eval[0] / eval[1] < gamma_32) {
+                        saliency_ptr[workload_idx] =
+                                static_cast<scalar_t>(eval[0]);
+                    }
+                });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+#if defined(__CUDACC__)
+void ComputeISSLocalMaximaCUDA
+#else
+void ComputeISSLocalMaximaCPU
+#endif
+        (const core::Tensor& saliency,
+         const core::Tensor& query_indices,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_row_splits,
+         core::Tensor& is_local_maximum,
+         int64_t min_neighbors) {
+    const int64_t n = query_indices.GetLength();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(saliency.GetDtype(), [&]() {
+        const scalar_t* saliency_ptr = saliency.GetDataPtr<scalar_t>();
+        const int64_t* query_ptr = query_indices.GetDataPtr<int64_t>();
+        const int32_t* indices_ptr = neighbor_indices.GetDataPtr<int32_t>();
+        const int64_t* splits_ptr = neighbor_row_splits.GetDataPtr<int64_t>();
+        bool* is_local_maximum_ptr = is_local_maximum.GetDataPtr<bool>();
+
+        core::ParallelFor(
+                saliency.GetDevice(), n,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t begin = splits_ptr[workload_idx];
+                    const int64_t end = splits_ptr[workload_idx + 1];
+                    const scalar_t value =
+                            saliency_ptr[query_ptr[workload_idx]];
+                    bool is_maximum = end - begin >= min_neighbors;
+                    for (int64_t k = begin; k < end && is_maximum; ++k) {
+                        is_maximum = saliency_ptr[indices_ptr[k]] <= value;
+                    }
+                    is_local_maximum_ptr[workload_idx] = is_maximum;
+                });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+/// Spreads the 21 low bits of \p x so that there are two zero bits between
+/// consecutive bits.
+static inline OPEN3D_HOST_DEVICE uint64_t SpreadBits3(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+/// Returns the 63-bit Hilbert code of the 21-bit cell coordinates \p X,
+/// following Skilling, "Programming the Hilbert curve", AIP 2004. \p X is
+/// overwritten.
+static inline OPEN3D_HOST_DEVICE uint64_t HilbertCode3(uint32_t* X) {
+    const uint32_t M = 1u << 20;
+    // Inverse undo of the excess work.
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+        const uint32_t P = Q - 1;
+        for (int i = 0; i < 3; ++i) {
+            if (X[i] & Q) {
+                X[0] ^= P;
+            } else {
+                const uint32_t t = (X[0] ^ X[i]) & P;
+                X[0] ^= t;
+                X[i] ^= t;
+            }
+        }
+    }
+    // Gray encode.
+    X[1] ^= X[0];
+    X[2] ^= X[1];
+    uint32_t t = 0;
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+        if (X[2] & Q) {
+            t ^= Q - 1;
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        X[i] ^= t;
+    }
+    // The code interleaves the transposed bits, X[0] being the most
+    // significant of each triple.
+    return SpreadBits3(X[2]) | SpreadBits3(X[1]) << 1 | SpreadBits3(X[0]) << 2;
+}
+
+#if defined(__CUDACC__)
+void ComputeSpatialCodesCUDA
+#else
+void ComputeSpatialCodesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& min_bound,
+         double cell_size,
+         bool hilbert,
+         core::Tensor& codes) {
+    const int64_t n = points.GetLength();
+    const double* min_bound_ptr = min_bound.GetDataPtr<double>();
+    const double min_x = min_bound_ptr[0];
+    const double min_y = min_bound_ptr[1];
+    const double min_z = min_bound_ptr[2];
+    const double inv_cell_size = 1.0 / cell_size;
+    const double max_cell = double((1 << 21) - 1);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        int64_t* codes_ptr = codes.GetDataPtr<int64_t>();
+
+        core::ParallelFor(
+                points.GetDevice(), n,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t* p = points_ptr + 3 * workload_idx;
+                    const double mins[3] = {min_x, min_y, min_z};
+                    uint32_t X[3];
+                    for (int i = 0; i < 3; ++i) {
+                        const double cell = floor((double(p[i]) - mins[i]) *
+                                                  inv_cell_size);
+                        X[i] = uint32_t(max(0.0, min(cell, max_cell)));
+                    }
+                    codes_ptr[workload_idx] = static_cast<int64_t>(
+                            hilbert ? HilbertCode3(X)
+                                    : SpreadBits3(X[0]) |
+                                              SpreadBits3(X[1]) << 1 |
+                                              SpreadBits3(X[2]) << 2);
+                });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+#if defined(__CUDACC__)
+void ComputePrincipalAxesCUDA
+#else
+void ComputePrincipalAxesCPU
+#endif
+        (const core::Tensor& covariances, core::Tensor& rotations) {
+    const int64_t n = covariances.GetLength();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(covariances.GetDtype(), [&]() {
+        const scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+        scalar_t* rotations_ptr = rotations.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(
+                covariances.GetDevice(), n,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    // The covariance is symmetric positive semi-definite, so U
+                    // holds its eigenvectors sorted by decreasing eigenvalue.
+                    scalar_t U[9], S[3], V[9];
+                    core::linalg::kernel::svd3x3(
+                            covariances_ptr + 9 * workload_idx, U, S, V, 6);
+                    scalar_t* R = rotations_ptr + 9 * workload_idx;
+                    for (int i = 0; i < 9; ++i) {
+                        R[i] = U[i];
+                    }
+                });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+/// Cross product of (b - a) and (c - a) in the xy plane.
+template <typename scalar_t>
+static inline OPEN3D_HOST_DEVICE double Cross2D(const scalar_t* a,
+                                                const scalar_t* b,
+                                                const scalar_t* c) {
+    return (double(b[0]) - a[0]) * (double(c[1]) - a[1]) -
+           (double(b[1]) - a[1]) * (double(c[0]) - a[0]);
+}
+
+#if defined(__CUDACC__)
+void ComputeUprightMinimalAreaBoxesCUDA
+#else
+void ComputeUprightMinimalAreaBoxesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& row_splits,
+         const core::Tensor& min_bounds,
+         const core::Tensor& max_bounds,
+         core::Tensor& centers,
+         core::Tensor& rotations,
+         core::Tensor& extents) {
+    const int64_t num_clusters = row_splits.GetLength() - 1;
+    // Each cluster builds its hull in its own range of 2 * (cluster size)
+    // entries, the bound of the monotone chain algorithm.
+    core::Tensor hulls = core::Tensor::Empty({2 * points.GetLength()},
+                                             core::Int64, points.GetDevice());
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const int64_t* row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+        const scalar_t* min_bounds_ptr = min_bounds.GetDataPtr<scalar_t>();
+        const scalar_t* max_bounds_ptr = max_bounds.GetDataPtr<scalar_t>();
+        int64_t* hulls_ptr = hulls.GetDataPtr<int64_t>();
+        scalar_t* centers_ptr = centers.GetDataPtr<scalar_t>();
+        scalar_t* rotations_ptr = rotations.GetDataPtr<scalar_t>();
+        scalar_t* extents_ptr = extents.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(
+                points.GetDevice(), num_clusters,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t begin = row_splits_ptr[workload_idx];
+                    const int64_t end = row_splits_ptr[workload_idx + 1];
+                    int64_t* hull = hulls_ptr + 2 * begin;
+
+                    // Andrew's monotone chain on the points sorted by x and y.
+                    int64_t k = 0;
+                    for (int64_t i = begin; i < end; ++i) {
+                        while (k >= 2 &&
+                               Cross2D(points_ptr + 3 * hull[k - 2],
+                                       points_ptr + 3 * hull[k - 1],
+                                       points_ptr + 3 * i) <= 0) {
+                            --k;
+                        }
+                        hull[k++] = i;
+                    }
+                    for (int64_t i = end - 2, lower = k + 1; i >= begin; --i) {
+                        while (k >= lower &&
+                               Cross2D(points_ptr + 3 * hull[k - 2],
+                                       points_ptr + 3 * hull[k - 1],
+                                       points_ptr + 3 * i) <= 0) {
+                            --k;
+                        }
+                        hull[k++] = i;
+                    }
+                    // The last point closes the chain. A single point is its
+                    // own hull.
+                    const int64_t hull_size = end - begin > 1 ? k - 1 : k;
+
+                    // The minimal rectangle has a side collinear with a hull
+                    // edge, so try the direction of every edge.
+                    double best_area = -1;
+                    double best_u[2] = {1, 0};
+                    double best_min[2] = {0, 0};
+                    double best_max[2] = {0, 0};
+                    for (int64_t e = 0; e < hull_size || best_area < 0; ++e) {
+                        double u[2] = {1, 0};
+                        if (e < hull_size) {
+                            const scalar_t* a = points_ptr + 3 * hull[e];
+                            const scalar_t* b =
+                                    points_ptr +
+                                    3 * hull[(e + 1) % hull_size];
+                            u[0] = double(b[0]) - a[0];
+                            u[1] = double(b[1]) - a[1];
+                            const double length =
+                                    sqrt(u[0] * u[0] + u[1] * u[1]);
+                            if (length == 0) {
+                                continue;
+                            }
+                            u[0] /= length;
+                            u[1] /= length;
+                        }
+                        double lo[2] = {0, 0}, hi[2] = {0, 0};
+                        for (int64_t j = 0; j < hull_size; ++j) {
+                            const scalar_t* p = points_ptr + 3 * hull[j];
+                            const double pu = u[0] * p[0] + u[1] * p[1];
+                            const double pv = -u[1] * p[0] + u[0] * p[1];
+                            lo[0] = j == 0 ? pu : min(lo[0], pu);
+                            hi[0] = j == 0 ? pu : max(hi[0], pu);
+                            lo[1] = j == 0 ? pv : min(lo[1], pv);
+                            hi[1] = j == 0 ? pv : max(hi[1], pv);
+                        }
+                        const double area = (hi[0] - lo[0]) * (hi[1] - lo[1]);
+                        if (best_area < 0 || area < best_area) {
+                            best_area = area;
+                            best_u[0] = u[0];
+                            best_u[1] = u[1];
+                            best_min[0] = lo[0];
+                            best_min[1] = lo[1];
+                            best_max[0] = hi[0];
+                            best_max[1] = hi[1];
+                        }
+                    }
+
+                    const double cu = 0.5 * (best_min[0] + best_max[0]);
+                    const double cv = 0.5 * (best_min[1] + best_max[1]);
+                    const scalar_t* min_bound =
+                            min_bounds_ptr + 3 * workload_idx;
+                    const scalar_t* max_bound =
+                            max_bounds_ptr + 3 * workload_idx;
+                    scalar_t* center = centers_ptr + 3 * workload_idx;
+                    center[0] = scalar_t(best_u[0] * cu - best_u[1] * cv);
+                    center[1] = scalar_t(best_u[1] * cu + best_u[0] * cv);
+                    center[2] = scalar_t(0.5 * (double(min_bound[2]) +
+                                                max_bound[2]));
+                    double eu = best_max[0] - best_min[0];
+                    double ev = best_max[1] - best_min[1];
+                    // Put the longer side on the x axis, turning by 90
+                    // degrees.
+                    if (ev > eu) {
+                        const double t = eu;
+                        eu = ev;
+                        ev = t;
+                        const double ux = best_u[0];
+                        best_u[0] = -best_u[1];
+                        best_u[1] = ux;
+                    }
+                    scalar_t* extent = extents_ptr + 3 * workload_idx;
+                    extent[0] = scalar_t(eu);
+                    extent[1] = scalar_t(ev);
+                    extent[2] = max_bound[2] - min_bound[2];
+                    scalar_t* R = rotations_ptr + 9 * workload_idx;
+                    R[0] = scalar_t(best_u[0]);
+                    R[1] = scalar_t(-best_u[1]);
+                    R[2] = 0;
+                    R[3] = scalar_t(best_u[1]);
+                    R[4] = scalar_t(best_u[0]);
+                    R[5] = 0;
+                    R[6] = 0;
+                    R[7] = 0;
+                    R[8] = 1;
+                });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+static inline OPEN3D_HOST_DEVICE uint32_t FloatBits(float f) {
+    union {
+        float f;
+        uint32_t u;
+    } x;
+    x.f = f;
+    return x.u;
+}
+
+#if defined(__CUDACC__)
+void OrientNormalsAlongSpanningTreeCUDA
+#else
+void OrientNormalsAlongSpanningTreeCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbors,
+         const core::Tensor& tiles,
+         core::Tensor& normals) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t knn = neighbors.GetShape(1);
+    const int64_t num_edges = n * knn;
+    const bool use_tiles = tiles.NumDims() == 2;
+    const int64_t no_edge = std::numeric_limits<int64_t>::max();
+
+    // Union-find forest of the points, where flips[i] tells if the normal of
+    // i is flipped relative to the normal of parents[i]. Between rounds all
+    // points point to the root of their component.
+    core::Tensor parents = core::Tensor::Arange(0, n, 1, core::Int64, device);
+    core::Tensor flips = core::Tensor::Zeros({n}, core::Int32, device);
+    core::Tensor next_parents = parents.Clone();
+    core::Tensor next_flips = flips.Clone();
+    core::Tensor best_edges = core::Tensor::Empty({n}, core::Int64, device);
+    core::Tensor changed = core::Tensor::Empty({1}, core::Int32, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+        const int64_t* tiles_ptr =
+                use_tiles ? tiles.GetDataPtr<int64_t>() : nullptr;
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        int64_t* best_edges_ptr = best_edges.GetDataPtr<int64_t>();
+        int32_t* changed_ptr = changed.GetDataPtr<int32_t>();
+
+        // Boruvka's algorithm: in each round every component is joined to the
+        // component at the other end of its cheapest edge, which at least
+        // halves the number of components. The keys order the edges by tile
+        // crossing, weight and index, so there are no ties.
+        while (true) {
+            best_edges.Fill(no_edge);
+            changed.Fill(0);
+            const int64_t* parents_ptr = parents.GetDataPtr<int64_t>();
+            const int32_t* flips_ptr = flips.GetDataPtr<int32_t>();
+            int64_t* next_parents_ptr = next_parents.GetDataPtr<int64_t>();
+            int32_t* next_flips_ptr = next_flips.GetDataPtr<int32_t>();
+
+            core::ParallelFor(
+                    device, num_edges, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t u = workload_idx / knn;
+                        const int64_t v = neighbors_ptr[workload_idx];
+                        if (v < 0 || v == u) {
+                            return;
+                        }
+                        const int64_t cu = parents_ptr[u];
+                        const int64_t cv = parents_ptr[v];
+                        if (cu == cv) {
+                            return;
+                        }
+                        const scalar_t* nu = normals_ptr + 3 * u;
+                        const scalar_t* nv = normals_ptr + 3 * v;
+                        const double dot = double(nu[0]) * nv[0] +
+                                           double(nu[1]) * nv[1] +
+                                           double(nu[2]) * nv[2];
+                        // Bits of a non-negative float up to 1 are ordered
+                        // and less than 2^30.
+                        const float weight = float(max(0.0, 1.0 - abs(dot)));
+                        bool crossing = false;
+                        if (tiles_ptr) {
+                            for (int i = 0; i < 3; ++i) {
+                                crossing |= tiles_ptr[3 * u + i] !=
+                                            tiles_ptr[3 * v + i];
+                            }
+                        }
+                        const int64_t key = int64_t(crossing) << 62 |
+                                            int64_t(FloatBits(weight)) << 32 |
+                                            workload_idx;
+                        core::AtomicMinRelaxed(best_edges_ptr + cu, key);
+                        core::AtomicMinRelaxed(best_edges_ptr + cv, key);
+                    });
+
+            // Hook every root with an edge to the other component, choosing
+            // the flip that makes the normals at the edge agree.
+            core::ParallelFor(
+                    device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        next_parents_ptr[workload_idx] =
+                                parents_ptr[workload_idx];
+                        next_flips_ptr[workload_idx] = flips_ptr[workload_idx];
+                        if (parents_ptr[workload_idx] != workload_idx ||
+                            best_edges_ptr[workload_idx] == no_edge) {
+                            return;
+                        }
+                        const int64_t e =
+                                best_edges_ptr[workload_idx] & 0xFFFFFFFF;
+                        const int64_t u = e / knn;
+                        const int64_t v = neighbors_ptr[e];
+                        const scalar_t* nu = normals_ptr + 3 * u;
+                        const scalar_t* nv = normals_ptr + 3 * v;
+                        const double dot = double(nu[0]) * nv[0] +
+                                           double(nu[1]) * nv[1] +
+                                           double(nu[2]) * nv[2];
+                        next_parents_ptr[workload_idx] =
+                                parents_ptr[u] == workload_idx
+                                        ? parents_ptr[v]
+                                        : parents_ptr[u];
+                        next_flips_ptr[workload_idx] =
+                                int32_t(dot < 0) ^ flips_ptr[u] ^ flips_ptr[v];
+                        *changed_ptr = 1;
+                    });
+            if (!changed.Item<int32_t>()) {
+                break;
+            }
+
+            // Two components that chose the same edge point to each other.
+            // The one with the smaller index stays a root.
+            core::ParallelFor(
+                    device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t other = next_parents_ptr[workload_idx];
+                        if (workload_idx < other &&
+                            next_parents_ptr[other] == workload_idx) {
+                            next_parents_ptr[workload_idx] = workload_idx;
+                            next_flips_ptr[workload_idx] = 0;
+                        }
+                    });
+            std::swap(parents, next_parents);
+            std::swap(flips, next_flips);
+
+            // Pointer jumping, until all points point to their root.
+            do {
+                changed.Fill(0);
+                const int64_t* src_parents_ptr = parents.GetDataPtr<int64_t>();
+                const int32_t* src_flips_ptr = flips.GetDataPtr<int32_t>();
+                int64_t* dst_parents_ptr = next_parents.GetDataPtr<int64_t>();
+                int32_t* dst_flips_ptr = next_flips.GetDataPtr<int32_t>();
+                core::ParallelFor(
+                        device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            const int64_t p = src_parents_ptr[workload_idx];
+                            const int64_t pp = src_parents_ptr[p];
+                            dst_parents_ptr[workload_idx] = pp;
+                            dst_flips_ptr[workload_idx] =
+                                    src_flips_ptr[workload_idx] ^
+                                    (pp == p ? 0 : src_flips_ptr[p]);
+                            if (pp != p) {
+                                *changed_ptr = 1;
+                            }
+                        });
+                std::swap(parents, next_parents);
+                std::swap(flips, next_flips);
+            } while (changed.Item<int32_t>());
+        }
+
+        // Orient each tree such that the normal of its highest point has a
+        // non-negative z, then apply the flips relative to the roots.
+        const int64_t* parents_ptr = parents.GetDataPtr<int64_t>();
+        const int32_t* flips_ptr = flips.GetDataPtr<int32_t>();
+        best_edges.Fill(std::numeric_limits<int64_t>::min());
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const uint32_t bits =
+                            FloatBits(float(points_ptr[3 * workload_idx + 2]));
+                    const uint32_t ordered =
+                            bits & 0x80000000u ? ~bits : bits | 0x80000000u;
+                    const uint64_t key =
+                            (uint64_t(ordered) << 32 | uint64_t(workload_idx)) ^
+                            (uint64_t(1) << 63);
+                    core::AtomicMaxRelaxed(
+                            best_edges_ptr + parents_ptr[workload_idx],
+                            static_cast<int64_t>(key));
+                });
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    if (parents_ptr[workload_idx] != workload_idx) {
+                        return;
+                    }
+                    const int64_t top =
+                            best_edges_ptr[workload_idx] & 0xFFFFFFFF;
+                    const bool down = normals_ptr[3 * top + 2] < 0;
+                    best_edges_ptr[workload_idx] =
+                            int64_t(down != bool(flips_ptr[top]));
+                });
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    if (flips_ptr[workload_idx] ^
+                        best_edges_ptr[parents_ptr[workload_idx]]) {
+                        scalar_t* normal = normals_ptr + 3 * workload_idx;
+                        normal[0] = -normal[0];
+                        normal[1] = -normal[1];
+                        normal[2] = -normal[2];
+                    }
+                });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+/// Distance r, elevation and pixel of the offset (dx, dy, dz) in an
+/// equirectangular image with square pixels of \p pixel_angle radians.
+static inline OPEN3D_HOST_DEVICE void EquirectangularPixel(double dx,
+                                                           double dy,
+                                                           double dz,
+                                                           int64_t width,
+                                                           double pixel_angle,
+                                                           double& r,
+                                                           double& elevation,
+                                                           int64_t& row,
+                                                           int64_t& col) {
+    r = sqrt(dx * dx + dy * dy + dz * dz);
+    elevation = r > 0 ? asin(max(-1.0, min(1.0, dz / r))) : 0;
+    const double azimuth = atan2(dy, dx);
+    row = min(width / 2 - 1, int64_t((elevation + M_PI / 2) / pixel_angle));
+    col = int64_t((azimuth + M_PI) / pixel_angle) % width;
+}
+
+#if defined(__CUDACC__)
+void ComputeVisibilityCUDA
+#else
+void ComputeVisibilityCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& viewpoints,
+         double point_radius,
+         int64_t width,
+         double depth_tolerance,
+         core::Tensor& visible) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t num_viewpoints = viewpoints.GetLength();
+    const int64_t height = width / 2;
+    const int64_t num_pixels = width * height;
+    // Viewpoints per block, such that the depth buffers of a block have at
+    // most 2^26 pixels.
+    const int64_t block_size =
+            std::max(int64_t(1), (int64_t(1) << 26) / num_pixels);
+    const double pixel_angle = 2 * M_PI / width;
+    // Bounds the splats of points close to a viewpoint.
+    const int64_t max_half_size = 32;
+    const double depth_scale = 1.0 / (1.0 + depth_tolerance);
+    bool* visible_ptr = visible.GetDataPtr<bool>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t* viewpoints_ptr = viewpoints.GetDataPtr<scalar_t>();
+
+        for (int64_t begin = 0; begin < num_viewpoints; begin += block_size) {
+            const int64_t end = std::min(begin + block_size, num_viewpoints);
+            // Depths are stored as the bits of positive floats, which have
+            // the same order as the depths.
+            core::Tensor depths = core::Tensor::Full(
+                    {end - begin, height, width},
+                    std::numeric_limits<int32_t>::max(), core::Int32, device);
+            int32_t* depths_ptr = depths.GetDataPtr<int32_t>();
+
+            core::ParallelFor(
+                    device, (end - begin) * n,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const scalar_t* c =
+                                viewpoints_ptr + 3 * (begin + workload_idx / n);
+                        const scalar_t* p =
+                                points_ptr + 3 * (workload_idx % n);
+                        double r, elevation;
+                        int64_t row, col;
+                        EquirectangularPixel(
+                                double(p[0]) - c[0], double(p[1]) - c[1],
+                                double(p[2]) - c[2], width, pixel_angle, r,
+                                elevation, row, col);
+                        if (r == 0) {
+                            return;
+                        }
+                        // The splat covers the angular radius of the sphere,
+                        // which is wider in azimuth away from the equator.
+                        const double alpha = asin(min(1.0, point_radius / r));
+                        const int64_t half_rows = min(
+                                max_half_size,
+                                int64_t(alpha / pixel_angle + 0.5));
+                        const int64_t half_cols = min(
+                                max_half_size,
+                                int64_t(alpha /
+                                                (pixel_angle *
+                                                 max(cos(elevation), 1e-6)) +
+                                        0.5));
+                        const int32_t depth = int32_t(FloatBits(float(r)));
+                        int32_t* buffer =
+                                depths_ptr + (workload_idx / n) * num_pixels;
+                        for (int64_t i = row - half_rows; i <= row + half_rows;
+                             ++i) {
+                            if (i < 0 || i >= height) {
+                                continue;
+                            }
+                            for (int64_t j = col - half_cols;
+                                 j <= col + half_cols; ++j) {
+                                core::AtomicMinRelaxed(
+                                        buffer + i * width +
+                                                (j + width) % width,
+                                        depth);
+                            }
+                        }
+                    });
+
+            core::ParallelFor(
+                    device, (end - begin) * n,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const scalar_t* c =
+                                viewpoints_ptr + 3 * (begin + workload_idx / n);
+                        const scalar_t* p =
+                                points_ptr + 3 * (workload_idx % n);
+                        double r, elevation;
+                        int64_t row, col;
+                        EquirectangularPixel(
+                                double(p[0]) - c[0], double(p[1]) - c[1],
+                                double(p[2]) - c[2], width, pixel_angle, r,
+                                elevation, row, col);
+                        const int32_t* buffer =
+                                depths_ptr + (workload_idx / n) * num_pixels;
+                        visible_ptr[begin * n + workload_idx] =
+                                r == 0 ||
+                                int32_t(FloatBits(float(r * depth_scale))) <=
+                                        buffer[row * width + col];
+                    });
+        }
+    });
+
+    core::cuda::StreamSynchronize();
 }
 
 }  // namespace pointcloud
@@ -169,7 +169,7 @@ void IntegrateCPU
                         });
             });
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
 #endif
 }
 
@@ -495,7 +495,7 @@ void ExtractSurfacePointsCPU
     valid_size = total_count;
 
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
 #endif
 }
 
@@ -1118,7 +1118,7 @@ void EstimateRangeCPU
 #endif
             });
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
 #endif
 }
 
@@ -1531,7 +1531,7 @@ void RayCastCPU
     });
 
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
 #endif
 }
 
@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// \brief Draws samples on triangles with probability proportional to their
+/// areas.
+///
+/// The prefix sum of the areas is computed on the device. As in the legacy
+/// implementation, triangle i receives the samples between the rounded
+/// fractions of the total area before and after it, which every sample finds
+/// by a binary search over the prefix sum.
+///
+/// \param areas Float64 tensor of shape {T} with the triangle areas. Their sum
+/// must be positive.
+/// \param number_of_points Number of samples.
+/// \param seed Seed of the counter-based random numbers.
+/// \param triangles Output Int64 tensor of shape {number_of_points}, the
+/// triangle of every sample.
+/// \param weights Output Float64 tensor of shape {number_of_points, 3}, the
+/// barycentric coordinates of every sample.
+void SampleTrianglesCPU(const core::Tensor& areas,
+                        int64_t number_of_points,
+                        uint64_t seed,
+                        core::Tensor& triangles,
+                        core::Tensor& weights);
+
+/// \brief Selects a Poisson-disk subset of \p points by parallel dart
+/// throwing.
+///
+/// Every point gets a random priority. In every round, the undecided points
+/// that have the highest priority among their undecided neighbors closer
+/// than \p radius are accepted, and their undecided neighbors are rejected.
+/// Neighbors are found in a grid of cells of size \p radius. The accepted
+/// points are the ones that serial dart throwing in the order of decreasing
+/// priority accepts. If \p radius is not positive, all points are accepted.
+///
+/// \param points Float32 or Float64 tensor of shape {N, 3}.
+/// \param radius Minimal distance between accepted points.
+/// \param seed Seed of the counter-based random priorities.
+/// \param priorities Output Int64 tensor of shape {N} with the non-negative
+/// priorities of the points.
+/// \param accepted Output Bool tensor of shape {N}.
+void ThrowDartsCPU(const core::Tensor& points,
+                   double radius,
+                   uint64_t seed,
+                   core::Tensor& priorities,
+                   core::Tensor& accepted);
+
+/// \brief Fits the rotations of the as-rigid-as-possible energy of Sorkine
+/// and Alexa, one vertex per thread with a closed-form 3x3 SVD.
+///
+/// The neighbors of vertex i and the weights of its edges are
+/// neighbors[offsets[i]:offsets[i + 1]] and weights[offsets[i]:offsets[i + 1]].
+///
+/// \param offsets Int64 tensor of shape {N + 1}.
+/// \param neighbors Int64 tensor of shape {E}.
+/// \param weights Tensor of shape {E} with the dtype of \p vertices.
+/// \param vertices Float32 or Float64 tensor of shape {N, 3}, the positions
+/// at rest.
+/// \param deformed Tensor of shape {N, 3}, the deformed positions.
+/// \param rotations_old Rotations {N, 3, 3} of the previous iteration for
+/// the smoothed energy, or an empty tensor.
+/// \param smoothed_weight Weight of the rotation smoothness term.
+/// \param rotations Output tensor of shape {N, 3, 3}.
+void ComputeARAPRotationsCPU(const core::Tensor& offsets,
+                             const core::Tensor& neighbors,
+                             const core::Tensor& weights,
+                             const core::Tensor& vertices,
+                             const core::Tensor& deformed,
+                             const core::Tensor& rotations_old,
+                             double smoothed_weight,
+                             core::Tensor& rotations);
+
+/// \brief Computes the right hand side sum_j w_ij / 2 (R_i + R_j)(v_i - v_j)
+/// of the as-rigid-as-possible position update for all vertices i. The
+/// arguments are those of ComputeARAPRotationsCPU().
+///
+/// \param rhs Output tensor of shape {N, 3}.
+void ComputeARAPRhsCPU(const core::Tensor& offsets,
+                       const core::Tensor& neighbors,
+                       const core::Tensor& weights,
+                       const core::Tensor& vertices,
+                       const core::Tensor& rotations,
+                       core::Tensor& rhs);
+
+#ifdef BUILD_CUDA_MODULE
+void SampleTrianglesCUDA(const core::Tensor& areas,
+                         int64_t number_of_points,
+                         uint64_t seed,
+                         core::Tensor& triangles,
+                         core::Tensor& weights);
+
+void ThrowDartsCUDA(const core::Tensor& points,
+                    double radius,
+                    uint64_t seed,
+                    core::Tensor& priorities,
+                    core::Tensor& accepted);
+
+void ComputeARAPRotationsCUDA(const core::Tensor& offsets,
+                              const core::Tensor& neighbors,
+                              const core::Tensor& weights,
+                              const core::Tensor& vertices,
+                              const core::Tensor& deformed,
+                              const core::Tensor& rotations_old,
+                              double smoothed_weight,
+                              core::Tensor& rotations);
+
+void ComputeARAPRhsCUDA(const core::Tensor& offsets,
+                        const core::Tensor& neighbors,
+                        const core::Tensor& weights,
+                        const core::Tensor& vertices,
+                        const core::Tensor& rotations,
+                        core::Tensor& rhs);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
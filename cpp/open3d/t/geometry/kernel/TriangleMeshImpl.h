@@ -0,0 +1,436 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <cmath>
+#include <cstdint>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+
+#if defined(__CUDACC__)
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+#else
+#include "open3d/utility/ParallelScan.h"
+#endif
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+#ifndef __CUDACC__
+using std::round;
+using std::sqrt;
+#endif
+
+/// Finalizer of the splitmix64 generator.
+OPEN3D_HOST_DEVICE inline uint64_t MixBits(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/// Returns the random bits number \p counter of the stream \p seed. Draws do
+/// not depend on each other, so that every thread can make its own.
+OPEN3D_HOST_DEVICE inline uint64_t RandomBits(uint64_t seed,
+                                              uint64_t counter) {
+    return MixBits(MixBits(seed) + (counter + 1) * 0x9e3779b97f4a7c15ULL);
+}
+
+/// Returns a random number in [0, 1), see RandomBits.
+OPEN3D_HOST_DEVICE inline double RandomUniform(uint64_t seed,
+                                               uint64_t counter) {
+    return double(RandomBits(seed, counter) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/// Calls \p func(j) for the points j of the 27 grid cells around \p cell
+/// until it returns true. Returns whether any call returned true.
+template <typename func_t>
+OPEN3D_HOST_DEVICE bool AnyInNeighborCells(const int64_t* cell,
+                                           int64_t dim_y,
+                                           int64_t dim_z,
+                                           const int64_t* cell_keys,
+                                           int64_t num_cells,
+                                           const int64_t* cell_splits,
+                                           const int64_t* order,
+                                           func_t func) {
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dz = -1; dz <= 1; ++dz) {
+                const int64_t key =
+                        ((cell[0] + dx) * dim_y + cell[1] + dy) * dim_z +
+                        cell[2] + dz;
+                int64_t lo = 0, hi = num_cells;
+                while (lo < hi) {
+                    const int64_t mid = (lo + hi) / 2;
+                    if (cell_keys[mid] < key) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                if (lo == num_cells || cell_keys[lo] != key) {
+                    continue;
+                }
+                for (int64_t k = cell_splits[lo]; k < cell_splits[lo + 1];
+                     ++k) {
+                    if (func(order[k])) {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+#if defined(__CUDACC__)
+void SampleTrianglesCUDA
+#else
+void SampleTrianglesCPU
+#endif
+        (const core::Tensor& areas,
+         int64_t number_of_points,
+         uint64_t seed,
+         core::Tensor& triangles,
+         core::Tensor& weights) {
+    const core::Device device = areas.GetDevice();
+    const int64_t num_triangles = areas.GetLength();
+    const core::Tensor areas_c = areas.Contiguous();
+    core::Tensor cdf =
+            core::Tensor::Empty({num_triangles}, core::Float64, device);
+    const double* areas_ptr = areas_c.GetDataPtr<double>();
+    double* cdf_ptr = cdf.GetDataPtr<double>();
+#if defined(__CUDACC__)
+    thrust::inclusive_scan(thrust::cuda::par.on(core::cuda::GetStream()),
+                           areas_ptr, areas_ptr + num_triangles, cdf_ptr);
+#else
+    utility::InclusivePrefixSum(areas_ptr, areas_ptr + num_triangles,
+                                cdf_ptr);
+#endif
+    const double scale =
+            double(number_of_points) / cdf[num_triangles - 1].Item<double>();
+
+    triangles = core::Tensor::Empty({number_of_points}, core::Int64, device);
+    weights = core::Tensor::Empty({number_of_points, 3}, core::Float64, device);
+    int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    double* weights_ptr = weights.GetDataPtr<double>();
+    core::ParallelFor(device, number_of_points, [=] OPEN3D_DEVICE(
+                                                        int64_t workload_idx) {
+        // The first triangle whose rounded cumulative number of samples
+        // exceeds the sample. The last triangle takes rounding leftovers.
+        int64_t lo = 0, hi = num_triangles - 1;
+        while (lo < hi) {
+            const int64_t mid = (lo + hi) / 2;
+            if (round(cdf_ptr[mid] * scale) > double(workload_idx)) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        const double r1 = sqrt(RandomUniform(seed, 2 * workload_idx));
+        const double r2 = RandomUniform(seed, 2 * workload_idx + 1);
+        triangles_ptr[workload_idx] = lo;
+        weights_ptr[3 * workload_idx + 0] = 1 - r1;
+        weights_ptr[3 * workload_idx + 1] = r1 * (1 - r2);
+        weights_ptr[3 * workload_idx + 2] = r1 * r2;
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+#if defined(__CUDACC__)
+void ThrowDartsCUDA
+#else
+void ThrowDartsCPU
+#endif
+        (const core::Tensor& points,
+         double radius,
+         uint64_t seed,
+         core::Tensor& priorities,
+         core::Tensor& accepted) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+
+    priorities = core::Tensor::Empty({n}, core::Int64, device);
+    int64_t* priorities_ptr = priorities.GetDataPtr<int64_t>();
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        priorities_ptr[workload_idx] =
+                int64_t(RandomBits(seed, workload_idx) >> 1);
+    });
+    if (radius <= 0 || n == 0) {
+        accepted = core::Tensor::Full({n}, true, core::Bool, device);
+        return;
+    }
+
+    // Grid cells are shifted by one, so that the neighbors of all occupied
+    // cells have non-negative coordinates and keys.
+    core::Tensor cells = (points / radius).Floor().To(core::Int64);
+    cells = (cells - cells.Min({0}) + 1).Contiguous();
+    const core::Tensor dims =
+            (cells.Max({0}) + 2).To(core::Device("CPU:0")).Contiguous();
+    const int64_t* dims_ptr = dims.GetDataPtr<int64_t>();
+    if (double(dims_ptr[0]) * double(dims_ptr[1]) * double(dims_ptr[2]) >
+        double(int64_t(1) << 62)) {
+        utility::LogError(
+                "Radius {} is too small for the extent of the points.",
+                radius);
+    }
+    const int64_t dim_y = dims_ptr[1];
+    const int64_t dim_z = dims_ptr[2];
+    const core::Tensor keys =
+            ((cells.Slice(1, 0, 1) * dim_y + cells.Slice(1, 1, 2)) * dim_z +
+             cells.Slice(1, 2, 3))
+                    .Reshape({n});
+    const core::Tensor order = core::kernel::Argsort(keys);
+    const core::Tensor sorted_keys = keys.IndexGet({order});
+    core::Tensor group_ids, cell_splits;
+    core::kernel::SortedGroups(sorted_keys, group_ids, cell_splits);
+    const int64_t num_cells = cell_splits.GetLength() - 1;
+    const core::Tensor cell_keys =
+            sorted_keys.IndexGet({cell_splits.Slice(0, 0, num_cells)});
+
+    const int64_t* cells_ptr = cells.GetDataPtr<int64_t>();
+    const int64_t* order_ptr = order.GetDataPtr<int64_t>();
+    const int64_t* cell_keys_ptr = cell_keys.GetDataPtr<int64_t>();
+    const int64_t* cell_splits_ptr = cell_splits.GetDataPtr<int64_t>();
+
+    // Undecided points are 0, accepted ones 1 and rejected ones 2. Every
+    // round reads one state buffer and writes the other.
+    core::Tensor state = core::Tensor::Zeros({n}, core::UInt8, device);
+    core::Tensor next = core::Tensor::Empty({n}, core::UInt8, device);
+    uint8_t* state_ptr = state.GetDataPtr<uint8_t>();
+    uint8_t* next_ptr = next.GetDataPtr<uint8_t>();
+    const core::Tensor points_c = points.Contiguous();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points_c.GetDataPtr<scalar_t>();
+        const scalar_t radius2 = scalar_t(radius * radius);
+        do {
+            // Accept the points that no undecided or accepted neighbor
+            // precedes.
+            core::ParallelFor(
+                    device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t i = workload_idx;
+                        if (state_ptr[i] != 0) {
+                            next_ptr[i] = state_ptr[i];
+                            return;
+                        }
+                        const scalar_t* p = points_ptr + 3 * i;
+                        const int64_t priority = priorities_ptr[i];
+                        const bool preceded = AnyInNeighborCells(
+                                cells_ptr + 3 * i, dim_y, dim_z, cell_keys_ptr,
+                                num_cells, cell_splits_ptr, order_ptr,
+                                [&](int64_t j) {
+                                    if (j == i || state_ptr[j] == 2 ||
+                                        priorities_ptr[j] < priority ||
+                                        (priorities_ptr[j] == priority &&
+                                         j > i)) {
+                                        return false;
+                                    }
+                                    const scalar_t* q = points_ptr + 3 * j;
+                                    const scalar_t dx = q[0] - p[0];
+                                    const scalar_t dy = q[1] - p[1];
+                                    const scalar_t dz = q[2] - p[2];
+                                    return dx * dx + dy * dy + dz * dz <
+                                           radius2;
+                                });
+                        next_ptr[i] = preceded ? 0 : 1;
+                    });
+            // Reject the undecided neighbors of accepted points.
+            core::ParallelFor(
+                    device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t i = workload_idx;
+                        if (next_ptr[i] != 0) {
+                            state_ptr[i] = next_ptr[i];
+                            return;
+                        }
+                        const scalar_t* p = points_ptr + 3 * i;
+                        const bool covered = AnyInNeighborCells(
+                                cells_ptr + 3 * i, dim_y, dim_z, cell_keys_ptr,
+                                num_cells, cell_splits_ptr, order_ptr,
+                                [&](int64_t j) {
+                                    if (next_ptr[j] != 1) {
+                                        return false;
+                                    }
+                                    const scalar_t* q = points_ptr + 3 * j;
+                                    const scalar_t dx = q[0] - p[0];
+                                    const scalar_t dy = q[1] - p[1];
+                                    const scalar_t dz = q[2] - p[2];
+                                    return dx * dx + dy * dy + dz * dz <
+                                           radius2;
+                                });
+                        state_ptr[i] = covered ? 2 : 0;
+                    });
+        } while (state.Eq(0).Any());
+    });
+
+    accepted = state.Eq(1);
+}
+
+#if defined(__CUDACC__)
+void ComputeARAPRotationsCUDA
+#else
+void ComputeARAPRotationsCPU
+#endif
+        (const core::Tensor& offsets,
+         const core::Tensor& neighbors,
+         const core::Tensor& weights,
+         const core::Tensor& vertices,
+         const core::Tensor& deformed,
+         const core::Tensor& rotations_old,
+         double smoothed_weight,
+         core::Tensor& rotations) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t n = vertices.GetLength();
+    rotations = core::Tensor::Empty({n, 3, 3}, vertices.GetDtype(), device);
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* weights_ptr = weights.GetDataPtr<scalar_t>();
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        const scalar_t* deformed_ptr = deformed.GetDataPtr<scalar_t>();
+        const scalar_t* rotations_old_ptr =
+                rotations_old.NumElements() > 0
+                        ? rotations_old.GetDataPtr<scalar_t>()
+                        : nullptr;
+        scalar_t* rotations_ptr = rotations.GetDataPtr<scalar_t>();
+        const scalar_t smoothed_w = scalar_t(smoothed_weight);
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const scalar_t* vi = vertices_ptr + 3 * workload_idx;
+            const scalar_t* di = deformed_ptr + 3 * workload_idx;
+            scalar_t S[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+            scalar_t R_sum[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+            const int64_t begin = offsets_ptr[workload_idx];
+            const int64_t end = offsets_ptr[workload_idx + 1];
+            for (int64_t k = begin; k < end; ++k) {
+                const int64_t j = neighbors_ptr[k];
+                scalar_t e0[3], e1[3];
+                for (int c = 0; c < 3; ++c) {
+                    e0[c] = vi[c] - vertices_ptr[3 * j + c];
+                    e1[c] = di[c] - deformed_ptr[3 * j + c];
+                }
+                for (int r = 0; r < 3; ++r) {
+                    for (int c = 0; c < 3; ++c) {
+                        S[3 * r + c] += weights_ptr[k] * e0[r] * e1[c];
+                    }
+                }
+                if (rotations_old_ptr) {
+                    for (int m = 0; m < 9; ++m) {
+                        R_sum[m] += rotations_old_ptr[9 * j + m];
+                    }
+                }
+            }
+            if (rotations_old_ptr && end > begin) {
+                for (int r = 0; r < 3; ++r) {
+                    for (int c = 0; c < 3; ++c) {
+                        S[3 * r + c] = 2 * S[3 * r + c] +
+                                       smoothed_w / scalar_t(end - begin) *
+                                               R_sum[3 * c + r];
+                    }
+                }
+            }
+
+            // S = U diag(sigma) V^T with rotations U and V, so V U^T is the
+            // closest rotation and needs no reflection fix.
+            scalar_t U[9], sigma[3], V[9];
+            core::linalg::kernel::svd3x3(S, U, sigma, V, 6);
+            scalar_t* R = rotations_ptr + 9 * workload_idx;
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    R[3 * r + c] = V[3 * r + 0] * U[3 * c + 0] +
+                                   V[3 * r + 1] * U[3 * c + 1] +
+                                   V[3 * r + 2] * U[3 * c + 2];
+                }
+            }
+        });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+#if defined(__CUDACC__)
+void ComputeARAPRhsCUDA
+#else
+void ComputeARAPRhsCPU
+#endif
+        (const core::Tensor& offsets,
+         const core::Tensor& neighbors,
+         const core::Tensor& weights,
+         const core::Tensor& vertices,
+         const core::Tensor& rotations,
+         core::Tensor& rhs) {
+    const core::Device device = vertices.GetDevice();
+    const int64_t n = vertices.GetLength();
+    rhs = core::Tensor::Empty({n, 3}, vertices.GetDtype(), device);
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* weights_ptr = weights.GetDataPtr<scalar_t>();
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        const scalar_t* rotations_ptr = rotations.GetDataPtr<scalar_t>();
+        scalar_t* rhs_ptr = rhs.GetDataPtr<scalar_t>();
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const scalar_t* vi = vertices_ptr + 3 * workload_idx;
+            const scalar_t* Ri = rotations_ptr + 9 * workload_idx;
+            scalar_t b[3] = {0, 0, 0};
+            for (int64_t k = offsets_ptr[workload_idx];
+                 k < offsets_ptr[workload_idx + 1]; ++k) {
+                const int64_t j = neighbors_ptr[k];
+                const scalar_t* Rj = rotations_ptr + 9 * j;
+                scalar_t e[3];
+                for (int c = 0; c < 3; ++c) {
+                    e[c] = vi[c] - vertices_ptr[3 * j + c];
+                }
+                const scalar_t half_w = weights_ptr[k] / 2;
+                for (int r = 0; r < 3; ++r) {
+                    for (int c = 0; c < 3; ++c) {
+                        b[r] += half_w * (Ri[3 * r + c] + Rj[3 * r + c]) * e[c];
+                    }
+                }
+            }
+            for (int r = 0; r < 3; ++r) {
+                rhs_ptr[3 * workload_idx + r] = b[r];
+            }
+        });
+    });
+
+    core::cuda::StreamSynchronize();
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
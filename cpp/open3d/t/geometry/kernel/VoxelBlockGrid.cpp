@@ -85,6 +85,33 @@ void DepthTouch(std::shared_ptr<core::HashMap>& hashmap,
     }
 }
 
+void DepthTouchBatch(std::shared_ptr<core::HashMap>& hashmap,
+                     const core::Tensor& depths,
+                     const core::Tensor& intrinsic,
+                     const core::Tensor& extrinsics,
+                     core::Tensor& voxel_block_coords,
+                     index_t voxel_grid_resolution,
+                     float voxel_size,
+                     float sdf_trunc,
+                     float depth_scale,
+                     float depth_max,
+                     index_t stride) {
+    core::Device::DeviceType device_type = hashmap->GetDevice().GetType();
+
+    if (device_type == core::Device::DeviceType::CPU) {
+        DepthTouchBatchCPU(hashmap, depths, intrinsic, extrinsics,
+                           voxel_block_coords, voxel_grid_resolution,
+                           voxel_size, sdf_trunc, depth_scale, depth_max,
+                           stride);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(DepthTouchBatchCUDA, hashmap, depths, intrinsic, extrinsics,
+                  voxel_block_coords, voxel_grid_resolution, voxel_size,
+                  sdf_trunc, depth_scale, depth_max, stride);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
                                             const core::Tensor& block_keys,
                                             core::Tensor& voxel_coords,
@@ -106,18 +133,30 @@ void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
     }
 }
 
-#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(WEIGHT_DTYPE, COLOR_DTYPE, ...)   \
+#define DISPATCH_VALUE_DTYPE_TO_TEMPLATE(TSDF_DTYPE, WEIGHT_DTYPE,         \
+                                         COLOR_DTYPE, ...)                 \
     [&] {                                                                  \
-        if (WEIGHT_DTYPE == open3d::core::Float32 &&                       \
+        if (TSDF_DTYPE == open3d::core::Float32 &&                         \
+            WEIGHT_DTYPE == open3d::core::Float32 &&                       \
             COLOR_DTYPE == open3d::core::Float32) {                        \
+            using tsdf_t = float;                                          \
             using weight_t = float;                                        \
             using color_t = float;                                         \
             return __VA_ARGS__();                                          \
-        } else if (WEIGHT_DTYPE == open3d::core::UInt16 &&                 \
+        } else if (TSDF_DTYPE == open3d::core::Float32 &&                  \
+                   WEIGHT_DTYPE == open3d::core::UInt16 &&                 \
                    COLOR_DTYPE == open3d::core::UInt16) {                  \
+            using tsdf_t = float;                                          \
             using weight_t = uint16_t;                                     \
             using color_t = uint16_t;                                      \
             return __VA_ARGS__();                                          \
+        } else if (TSDF_DTYPE == open3d::core::Int16 &&                    \
+                   WEIGHT_DTYPE == open3d::core::UInt8 &&                  \
+                   COLOR_DTYPE == open3d::core::UInt8) {                   \
+            using tsdf_t = int16_t;                                        \
+            using weight_t = uint8_t;                                      \
+            using color_t = uint8_t;                                       \
+            return __VA_ARGS__();                                          \
         } else {                                                           \
             utility::LogError("Unsupported value data type combination."); \
         }                                                                  \
@@ -152,9 +191,12 @@ void Integrate(const core::Tensor& depth,
                float sdf_trunc,
                float depth_scale,
                float depth_max) {
-    using tsdf_t = float;
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -175,7 +217,8 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCPU<input_depth_t, input_color_t,
                                              tsdf_t, weight_t, color_t>(
                                         depth, color, block_indices, block_keys,
@@ -189,7 +232,8 @@ void Integrate(const core::Tensor& depth,
         DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
                 input_depth_dtype, input_color_dtype, [&] {
                     DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                            block_weight_dtype, block_color_dtype, [&] {
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
                                 IntegrateCUDA<input_depth_t, input_color_t,
                                               tsdf_t, weight_t, color_t>(
                                         depth, color, block_indices, block_keys,
@@ -206,9 +250,172 @@ void Integrate(const core::Tensor& depth,
     }
 }
 
+void IntegrateBatch(const core::Tensor& depths,
+                    const core::Tensor& colors,
+                    const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    TensorMap& block_value_map,
+                    const core::Tensor& intrinsic,
+                    const core::Tensor& extrinsics,
+                    index_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max) {
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
+    core::Dtype block_weight_dtype = core::Dtype::Float32;
+    core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
+    if (block_value_map.Contains("weight")) {
+        block_weight_dtype = block_value_map.at("weight").GetDtype();
+    }
+    if (block_value_map.Contains("color")) {
+        block_color_dtype = block_value_map.at("color").GetDtype();
+    }
+
+    core::Dtype input_depth_dtype = depths.GetDtype();
+    core::Dtype input_color_dtype = (input_depth_dtype == core::Dtype::Float32)
+                                            ? core::Dtype::Float32
+                                            : core::Dtype::UInt8;
+    if (colors.NumElements() > 0) {
+        input_color_dtype = colors.GetDtype();
+    }
+
+    core::Device::DeviceType device_type = depths.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
+                input_depth_dtype, input_color_dtype, [&] {
+                    DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
+                                IntegrateBatchCPU<input_depth_t, input_color_t,
+                                                  tsdf_t, weight_t, color_t>(
+                                        depths, colors, block_indices,
+                                        block_keys, block_value_map, intrinsic,
+                                        extrinsics, resolution, voxel_size,
+                                        sdf_trunc, depth_scale, depth_max);
+                            });
+                });
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
+                input_depth_dtype, input_color_dtype, [&] {
+                    DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                            block_tsdf_dtype, block_weight_dtype,
+                            block_color_dtype, [&] {
+                                IntegrateBatchCUDA<input_depth_t, input_color_t,
+                                                   tsdf_t, weight_t, color_t>(
+                                        depths, colors, block_indices,
+                                        block_keys, block_value_map, intrinsic,
+                                        extrinsics, resolution, voxel_size,
+                                        sdf_trunc, depth_scale, depth_max);
+                            });
+                });
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void DecayWeightsAndFindSurfaceBlocks(const core::Tensor& block_indices,
+                                      TensorMap& block_value_map,
+                                      core::Tensor& surface_block_masks,
+                                      index_t resolution,
+                                      float weight_threshold,
+                                      float weight_decay) {
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
+    core::Dtype block_weight_dtype = core::Dtype::Float32;
+    core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
+    if (block_value_map.Contains("weight")) {
+        block_weight_dtype = block_value_map.at("weight").GetDtype();
+    }
+    if (block_value_map.Contains("color")) {
+        block_color_dtype = block_value_map.at("color").GetDtype();
+    }
+
+    core::Device::DeviceType device_type =
+            block_indices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
+                    DecayWeightsAndFindSurfaceBlocksCPU<tsdf_t, weight_t,
+                                                        color_t>(
+                            block_indices, block_value_map,
+                            surface_block_masks, resolution, weight_threshold,
+                            weight_decay);
+                });
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
+                    DecayWeightsAndFindSurfaceBlocksCUDA<tsdf_t, weight_t,
+                                                         color_t>(
+                            block_indices, block_value_map,
+                            surface_block_masks, resolution, weight_threshold,
+                            weight_decay);
+                });
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FindFreeBlocks(const core::Tensor& block_indices,
+                    const TensorMap& block_value_map,
+                    core::Tensor& free_block_masks,
+                    index_t resolution,
+                    float weight_threshold) {
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
+    core::Dtype block_weight_dtype = core::Dtype::Float32;
+    core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
+    if (block_value_map.Contains("weight")) {
+        block_weight_dtype = block_value_map.at("weight").GetDtype();
+    }
+    if (block_value_map.Contains("color")) {
+        block_color_dtype = block_value_map.at("color").GetDtype();
+    }
+
+    core::Device::DeviceType device_type =
+            block_indices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
+                    FindFreeBlocksCPU<tsdf_t, weight_t, color_t>(
+                            block_indices, block_value_map, free_block_masks,
+                            resolution, weight_threshold);
+                });
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
+                    FindFreeBlocksCUDA<tsdf_t, weight_t, color_t>(
+                            block_indices, block_value_map, free_block_masks,
+                            resolution, weight_threshold);
+                });
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              const TensorMap& block_value_map,
              const core::Tensor& range_map,
+             const core::Tensor& free_block_masks,
              TensorMap& renderings_map,
              const core::Tensor& intrinsic,
              const core::Tensor& extrinsic,
@@ -221,9 +428,12 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              float depth_min,
              float depth_max,
              float weight_threshold) {
-    using tsdf_t = float;
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -234,23 +444,25 @@ void RayCast(std::shared_ptr<core::HashMap>& hashmap,
     core::Device::DeviceType device_type = hashmap->GetDevice().GetType();
     if (device_type == core::Device::DeviceType::CPU) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     RayCastCPU<tsdf_t, weight_t, color_t>(
-                            hashmap, block_value_map, range_map, renderings_map,
-                            intrinsic, extrinsic, h, w, block_resolution,
-                            voxel_size, sdf_trunc, depth_scale, depth_min,
-                            depth_max, weight_threshold);
+                            hashmap, block_value_map, range_map,
+                            free_block_masks, renderings_map, intrinsic,
+                            extrinsic, h, w, block_resolution, voxel_size,
+                            sdf_trunc, depth_scale, depth_min, depth_max,
+                            weight_threshold);
                 });
 
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     RayCastCUDA<tsdf_t, weight_t, color_t>(
-                            hashmap, block_value_map, range_map, renderings_map,
-                            intrinsic, extrinsic, h, w, block_resolution,
-                            voxel_size, sdf_trunc, depth_scale, depth_min,
-                            depth_max, weight_threshold);
+                            hashmap, block_value_map, range_map,
+                            free_block_masks, renderings_map, intrinsic,
+                            extrinsic, h, w, block_resolution, voxel_size,
+                            sdf_trunc, depth_scale, depth_min, depth_max,
+                            weight_threshold);
                 });
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
@@ -272,9 +484,12 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float voxel_size,
                        float weight_threshold,
                        int& valid_size) {
-    using tsdf_t = float;
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -285,7 +500,7 @@ void ExtractPointCloud(const core::Tensor& block_indices,
     core::Device::DeviceType device_type = block_indices.GetDevice().GetType();
     if (device_type == core::Device::DeviceType::CPU) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractPointCloudCPU<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -296,7 +511,7 @@ void ExtractPointCloud(const core::Tensor& block_indices,
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractPointCloudCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, nb_block_indices, nb_block_masks,
                             block_keys, block_value_map, points, normals,
@@ -321,13 +536,18 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          core::Tensor& triangles,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
+                         core::Tensor& triangle_block_indices,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
+                         index_t mesh_block_count,
                          int& vertex_count) {
-    using tsdf_t = float;
+    core::Dtype block_tsdf_dtype = core::Dtype::Float32;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("tsdf")) {
+        block_tsdf_dtype = block_value_map.at("tsdf").GetDtype();
+    }
     if (block_value_map.Contains("weight")) {
         block_weight_dtype = block_value_map.at("weight").GetDtype();
     }
@@ -338,23 +558,25 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
     core::Device::DeviceType device_type = block_indices.GetDevice().GetType();
     if (device_type == core::Device::DeviceType::CPU) {
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractTriangleMeshCPU<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
                             nb_block_masks, block_keys, block_value_map,
                             vertices, triangles, vertex_normals, vertex_colors,
-                            block_resolution, voxel_size, weight_threshold,
+                            triangle_block_indices, block_resolution,
+                            voxel_size, weight_threshold, mesh_block_count,
                             vertex_count);
                 });
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
-                block_weight_dtype, block_color_dtype, [&] {
+                block_tsdf_dtype, block_weight_dtype, block_color_dtype, [&] {
                     ExtractTriangleMeshCUDA<tsdf_t, weight_t, color_t>(
                             block_indices, inv_block_indices, nb_block_indices,
                             nb_block_masks, block_keys, block_value_map,
                             vertices, triangles, vertex_normals, vertex_colors,
-                            block_resolution, voxel_size, weight_threshold,
+                            triangle_block_indices, block_resolution,
+                            voxel_size, weight_threshold, mesh_block_count,
                             vertex_count);
                 });
 #else
@@ -59,6 +59,21 @@ void DepthTouch(std::shared_ptr<core::HashMap>& hashmap,
                 float depth_max,
                 index_t stride);
 
+/// Batched DepthTouch over (B, H, W, 1) depths and (B, 4, 4) extrinsics. The
+/// blocks touched by all the frames are deduplicated in a single hash map
+/// pass.
+void DepthTouchBatch(std::shared_ptr<core::HashMap>& hashmap,
+                     const core::Tensor& depths,
+                     const core::Tensor& intrinsics,
+                     const core::Tensor& extrinsics,
+                     core::Tensor& voxel_block_coords,
+                     index_t voxel_grid_resolution,
+                     float voxel_size,
+                     float sdf_trunc,
+                     float depth_scale,
+                     float depth_max,
+                     index_t stride);
+
 void GetVoxelCoordinatesAndFlattenedIndices(const core::Tensor& buf_indices,
                                             const core::Tensor& block_keys,
                                             core::Tensor& voxel_coords,
@@ -79,9 +94,47 @@ void Integrate(const core::Tensor& depth,
                float depth_scale,
                float depth_max);
 
+/// Batched Integrate over (B, H, W, 1) depths, (B, H, W, 3) or empty colors
+/// and (B, 4, 4) extrinsics. Each voxel fuses the frames in batch order with
+/// the same update as per-frame integration.
+void IntegrateBatch(const core::Tensor& depths,
+                    const core::Tensor& colors,
+                    const core::Tensor& block_indices,
+                    const core::Tensor& block_keys,
+                    TensorMap& block_value_map,
+                    const core::Tensor& intrinsics,
+                    const core::Tensor& extrinsics,
+                    index_t resolution,
+                    float voxel_size,
+                    float sdf_trunc,
+                    float depth_scale,
+                    float depth_max);
+
+/// Multiplies the weights of the voxels in the blocks at block_indices by
+/// weight_decay, then sets the (N,) Bool surface_block_masks of the blocks
+/// that still hold a voxel with a weight above weight_threshold and a TSDF
+/// inside the truncation band.
+void DecayWeightsAndFindSurfaceBlocks(const core::Tensor& block_indices,
+                                      TensorMap& block_value_map,
+                                      core::Tensor& surface_block_masks,
+                                      index_t resolution,
+                                      float weight_threshold,
+                                      float weight_decay);
+
+/// Sets the (capacity,) Bool free_block_masks, indexed by buffer index, of
+/// the blocks at block_indices without any voxel that has a weight of at
+/// least weight_threshold and a TSDF below the truncation band, i.e. blocks
+/// of free or unobserved space that rays may skip at once.
+void FindFreeBlocks(const core::Tensor& block_indices,
+                    const TensorMap& block_value_map,
+                    core::Tensor& free_block_masks,
+                    index_t resolution,
+                    float weight_threshold);
+
 void RayCast(std::shared_ptr<core::HashMap>& hashmap,
              const TensorMap& block_value_map,
              const core::Tensor& range_map,
+             const core::Tensor& free_block_masks,
              TensorMap& renderings_map,
              const core::Tensor& intrinsics,
              const core::Tensor& extrinsics,
@@ -108,6 +161,12 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float weight_threshold,
                        index_t& valid_size);
 
+/// Marching cubes over the blocks at block_indices. Only the first
+/// mesh_block_count blocks (all of them if negative) form triangles; the
+/// remaining blocks must include their neighbors in the positive directions
+/// and only hold the vertices shared with them. triangle_block_indices
+/// receives, for each triangle, the position in block_indices of the block
+/// that owns it.
 void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const core::Tensor& inv_block_indices,
                          const core::Tensor& nb_block_indices,
@@ -118,9 +177,11 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          core::Tensor& triangles,
                          core::Tensor& vertex_normals,
                          core::Tensor& vertex_colors,
+                         core::Tensor& triangle_block_indices,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
+                         index_t mesh_block_count,
                          index_t& vertex_count);
 
 /// CPU
@@ -143,6 +204,18 @@ void DepthTouchCPU(std::shared_ptr<core::HashMap>& hashmap,
                    float depth_max,
                    index_t stride);
 
+void DepthTouchBatchCPU(std::shared_ptr<core::HashMap>& hashmap,
+                        const core::Tensor& depths,
+                        const core::Tensor& intrinsics,
+                        const core::Tensor& extrinsics,
+                        core::Tensor& voxel_block_coords,
+                        index_t voxel_grid_resolution,
+                        float voxel_size,
+                        float sdf_trunc,
+                        float depth_scale,
+                        float depth_max,
+                        index_t stride);
+
 void GetVoxelCoordinatesAndFlattenedIndicesCPU(const core::Tensor& buf_indices,
                                                const core::Tensor& block_keys,
                                                core::Tensor& voxel_coords,
@@ -168,10 +241,44 @@ void IntegrateCPU(const core::Tensor& depth,
                   float depth_scale,
                   float depth_max);
 
+template <typename input_depth_t,
+          typename input_color_t,
+          typename tsdf_t,
+          typename weight_t,
+          typename color_t>
+void IntegrateBatchCPU(const core::Tensor& depths,
+                       const core::Tensor& colors,
+                       const core::Tensor& block_indices,
+                       const core::Tensor& block_keys,
+                       TensorMap& block_value_map,
+                       const core::Tensor& intrinsics,
+                       const core::Tensor& extrinsics,
+                       index_t resolution,
+                       float voxel_size,
+                       float sdf_trunc,
+                       float depth_scale,
+                       float depth_max);
+
+template <typename tsdf_t, typename weight_t, typename color_t>
+void DecayWeightsAndFindSurfaceBlocksCPU(const core::Tensor& block_indices,
+                                         TensorMap& block_value_map,
+                                         core::Tensor& surface_block_masks,
+                                         index_t resolution,
+                                         float weight_threshold,
+                                         float weight_decay);
+
+template <typename tsdf_t, typename weight_t, typename color_t>
+void FindFreeBlocksCPU(const core::Tensor& block_indices,
+                       const TensorMap& block_value_map,
+                       core::Tensor& free_block_masks,
+                       index_t resolution,
+                       float weight_threshold);
+
 template <typename tsdf_t, typename weight_t, typename color_t>
 void RayCastCPU(std::shared_ptr<core::HashMap>& hashmap,
                 const TensorMap& block_value_map,
                 const core::Tensor& range_map,
+                const core::Tensor& free_block_masks,
                 TensorMap& renderings_map,
                 const core::Tensor& intrinsics,
                 const core::Tensor& extrinsics,
@@ -210,9 +317,11 @@ void ExtractTriangleMeshCPU(const core::Tensor& block_indices,
                             core::Tensor& triangles,
                             core::Tensor& vertex_normals,
                             core::Tensor& vertex_colors,
+                            core::Tensor& triangle_block_indices,
                             index_t block_resolution,
                             float voxel_size,
                             float weight_threshold,
+                            index_t mesh_block_count,
                             index_t& vertex_count);
 
 #ifdef BUILD_CUDA_MODULE
@@ -235,6 +344,18 @@ void DepthTouchCUDA(std::shared_ptr<core::HashMap>& hashmap,
                     float depth_max,
                     index_t stride);
 
+void DepthTouchBatchCUDA(std::shared_ptr<core::HashMap>& hashmap,
+                         const core::Tensor& depths,
+                         const core::Tensor& intrinsics,
+                         const core::Tensor& extrinsics,
+                         core::Tensor& voxel_block_coords,
+                         index_t voxel_grid_resolution,
+                         float voxel_size,
+                         float sdf_trunc,
+                         float depth_scale,
+                         float depth_max,
+                         index_t stride);
+
 void GetVoxelCoordinatesAndFlattenedIndicesCUDA(const core::Tensor& buf_indices,
                                                 const core::Tensor& block_keys,
                                                 core::Tensor& voxel_coords,
@@ -260,10 +381,44 @@ void IntegrateCUDA(const core::Tensor& depth,
                    float depth_scale,
                    float depth_max);
 
+template <typename input_depth_t,
+          typename input_color_t,
+          typename tsdf_t,
+          typename weight_t,
+          typename color_t>
+void IntegrateBatchCUDA(const core::Tensor& depths,
+                        const core::Tensor& colors,
+                        const core::Tensor& block_indices,
+                        const core::Tensor& block_keys,
+                        TensorMap& block_value_map,
+                        const core::Tensor& intrinsics,
+                        const core::Tensor& extrinsics,
+                        index_t resolution,
+                        float voxel_size,
+                        float sdf_trunc,
+                        float depth_scale,
+                        float depth_max);
+
+template <typename tsdf_t, typename weight_t, typename color_t>
+void DecayWeightsAndFindSurfaceBlocksCUDA(const core::Tensor& block_indices,
+                                          TensorMap& block_value_map,
+                                          core::Tensor& surface_block_masks,
+                                          index_t resolution,
+                                          float weight_threshold,
+                                          float weight_decay);
+
+template <typename tsdf_t, typename weight_t, typename color_t>
+void FindFreeBlocksCUDA(const core::Tensor& block_indices,
+                        const TensorMap& block_value_map,
+                        core::Tensor& free_block_masks,
+                        index_t resolution,
+                        float weight_threshold);
+
 template <typename tsdf_t, typename weight_t, typename color_t>
 void RayCastCUDA(std::shared_ptr<core::HashMap>& hashmap,
                  const TensorMap& block_value_map,
                  const core::Tensor& range_map,
+                 const core::Tensor& free_block_masks,
                  TensorMap& renderings_map,
                  const core::Tensor& intrinsics,
                  const core::Tensor& extrinsics,
@@ -302,9 +457,11 @@ void ExtractTriangleMeshCUDA(const core::Tensor& block_indices,
                              core::Tensor& triangles,
                              core::Tensor& vertex_normals,
                              core::Tensor& vertex_colors,
+                             core::Tensor& triangle_block_indices,
                              index_t block_resolution,
                              float voxel_size,
                              float weight_threshold,
+                             index_t mesh_block_count,
                              index_t& vertex_count);
 
 #endif
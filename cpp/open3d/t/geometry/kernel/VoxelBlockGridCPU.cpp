@@ -219,6 +219,102 @@ void DepthTouchCPU(std::shared_ptr<core::HashMap> &hashmap,
     }
 }
 
+void DepthTouchBatchCPU(std::shared_ptr<core::HashMap> &hashmap,
+                        const core::Tensor &depths,
+                        const core::Tensor &intrinsics,
+                        const core::Tensor &extrinsics,
+                        core::Tensor &voxel_block_coords,
+                        index_t voxel_grid_resolution,
+                        float voxel_size,
+                        float sdf_trunc,
+                        float depth_scale,
+                        float depth_max,
+                        index_t stride) {
+    core::Device device = depths.GetDevice();
+    NDArrayIndexer depth_indexer(depths[0], 2);
+    int64_t depth_frame_size = depths.GetStride(0);
+    core::Tensor poses = CreateFrameTransformIndexers(
+            intrinsics, extrinsics, device, 1.0f, /*inverse=*/true);
+    const TransformIndexer *poses_ptr =
+            static_cast<const TransformIndexer *>(poses.GetDataPtr());
+
+    // Output
+    index_t rows_strided = depth_indexer.GetShape(0) / stride;
+    index_t cols_strided = depth_indexer.GetShape(1) / stride;
+    index_t frame_n = rows_strided * cols_strided;
+    index_t n = static_cast<index_t>(depths.GetLength()) * frame_n;
+
+    index_t resolution = voxel_grid_resolution;
+    float block_size = voxel_size * resolution;
+
+    // One set over all the frames deduplicates blocks across the batch.
+    tbb::concurrent_unordered_set<Coord3i, Coord3iHash> set;
+    DISPATCH_DTYPE_TO_TEMPLATE(depths.GetDtype(), [&]() {
+        core::ParallelFor(device, n, [&](index_t workload_idx) {
+            index_t b = workload_idx / frame_n;
+            index_t pixel_idx = workload_idx % frame_n;
+            index_t y = (pixel_idx / cols_strided) * stride;
+            index_t x = (pixel_idx % cols_strided) * stride;
+            const TransformIndexer &ti = poses_ptr[b];
+
+            float d = depth_indexer.GetDataPtr<scalar_t>(
+                              x, y)[b * depth_frame_size] /
+                      depth_scale;
+            if (d > 0 && d < depth_max) {
+                float x_c = 0, y_c = 0, z_c = 0;
+                ti.Unproject(static_cast<float>(x), static_cast<float>(y), 1.0,
+                             &x_c, &y_c, &z_c);
+                float x_g = 0, y_g = 0, z_g = 0;
+                ti.RigidTransform(x_c, y_c, z_c, &x_g, &y_g, &z_g);
+
+                // Origin
+                float x_o = 0, y_o = 0, z_o = 0;
+                ti.GetCameraPosition(&x_o, &y_o, &z_o);
+
+                // Direction
+                float x_d = x_g - x_o;
+                float y_d = y_g - y_o;
+                float z_d = z_g - z_o;
+
+                const index_t step_size = 3;
+                const float t_min = std::max(d - sdf_trunc, 0.0f);
+                const float t_max = std::min(d + sdf_trunc, depth_max);
+                const float t_step = (t_max - t_min) / step_size;
+
+                float t = t_min;
+                for (index_t step = 0; step <= step_size; ++step) {
+                    index_t xb = static_cast<index_t>(
+                            std::floor((x_o + t * x_d) / block_size));
+                    index_t yb = static_cast<index_t>(
+                            std::floor((y_o + t * y_d) / block_size));
+                    index_t zb = static_cast<index_t>(
+                            std::floor((z_o + t * z_d) / block_size));
+                    set.emplace(xb, yb, zb);
+                    t += t_step;
+                }
+            }
+        });
+    });
+
+    index_t block_count = set.size();
+    if (block_count == 0) {
+        utility::LogError(
+                "No block is touched in TSDF volume, abort integration. Please "
+                "check specified parameters, "
+                "especially depth_scale and voxel_size");
+    }
+
+    voxel_block_coords = core::Tensor({block_count, 3}, core::Int32, device);
+    index_t *block_coords_ptr = voxel_block_coords.GetDataPtr<index_t>();
+    index_t count = 0;
+    for (auto it = set.begin(); it != set.end(); ++it, ++count) {
+        index_t offset = count * 3;
+        block_coords_ptr[offset + 0] = static_cast<index_t>(it->x_);
+        block_coords_ptr[offset + 1] = static_cast<index_t>(it->y_);
+        block_coords_ptr[offset + 2] = static_cast<index_t>(it->z_);
+    }
+}
+
 #define FN_ARGUMENTS                                                     \
     const core::Tensor &depth, const core::Tensor &color,                \
             const core::Tensor &indices, const core::Tensor &block_keys, \
@@ -234,12 +330,55 @@ template void IntegrateCPU<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCPU<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCPU<uint16_t, uint8_t, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCPU<float, float, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+
+template void IntegrateBatchCPU<uint16_t, uint8_t, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCPU<uint16_t, uint8_t, float, float, float>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCPU<float, float, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCPU<float, float, float, float, float>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCPU<uint16_t, uint8_t, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCPU<float, float, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+
+#undef FN_ARGUMENTS
+
+#define FN_ARGUMENTS                                                   \
+    const core::Tensor &block_indices, TensorMap &block_value_map,     \
+            core::Tensor &surface_block_masks, index_t resolution,     \
+            float weight_threshold, float weight_decay
+
+template void DecayWeightsAndFindSurfaceBlocksCPU<float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void DecayWeightsAndFindSurfaceBlocksCPU<float, float, float>(
+        FN_ARGUMENTS);
+template void DecayWeightsAndFindSurfaceBlocksCPU<int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+
+#undef FN_ARGUMENTS
+
+#define FN_ARGUMENTS                                                       \
+    const core::Tensor &block_indices, const TensorMap &block_value_map,   \
+            core::Tensor &free_block_masks, index_t resolution,            \
+            float weight_threshold
+
+template void FindFreeBlocksCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
+template void FindFreeBlocksCPU<float, float, float>(FN_ARGUMENTS);
+template void FindFreeBlocksCPU<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
 #define FN_ARGUMENTS                                                           \
     std::shared_ptr<core::HashMap> &hashmap, const TensorMap &block_value_map, \
-            const core::Tensor &range_map, TensorMap &renderings_map,          \
+            const core::Tensor &range_map,                                     \
+            const core::Tensor &free_block_masks, TensorMap &renderings_map,   \
             const core::Tensor &intrinsics, const core::Tensor &extrinsics,    \
             index_t h, index_t w, index_t block_resolution, float voxel_size,  \
             float sdf_trunc, float depth_scale, float depth_min,               \
@@ -247,6 +386,7 @@ template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
 
 template void RayCastCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
+template void RayCastCPU<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -260,6 +400,7 @@ template void RayCastCPU<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCPU<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -270,11 +411,13 @@ template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
             const core::Tensor &block_keys, const TensorMap &block_value_map, \
             core::Tensor &vertices, core::Tensor &triangles,                  \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
-            index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            core::Tensor &triangle_block_indices, index_t block_resolution,   \
+            float voxel_size, float weight_threshold,                         \
+            index_t mesh_block_count, index_t &vertex_count
 
 template void ExtractTriangleMeshCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCPU<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCPU<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
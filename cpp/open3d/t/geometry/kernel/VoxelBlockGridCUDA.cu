@@ -245,6 +245,136 @@ void DepthTouchCUDA(std::shared_ptr<core::HashMap> &hashmap,
     OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
 }
 
+void DepthTouchBatchCUDA(std::shared_ptr<core::HashMap> &hashmap,
+                         const core::Tensor &depths,
+                         const core::Tensor &intrinsics,
+                         const core::Tensor &extrinsics,
+                         core::Tensor &voxel_block_coords,
+                         index_t voxel_grid_resolution,
+                         float voxel_size,
+                         float sdf_trunc,
+                         float depth_scale,
+                         float depth_max,
+                         index_t stride) {
+    core::Device device = depths.GetDevice();
+    NDArrayIndexer depth_indexer(depths[0], 2);
+    int64_t depth_frame_size = depths.GetStride(0);
+    core::Tensor poses = CreateFrameTransformIndexers(
+            intrinsics, extrinsics, device, 1.0f, /*inverse=*/true);
+    const TransformIndexer *poses_ptr =
+            static_cast<const TransformIndexer *>(poses.GetDataPtr());
+
+    // Output
+    index_t rows_strided = depth_indexer.GetShape(0) / stride;
+    index_t cols_strided = depth_indexer.GetShape(1) / stride;
+    index_t frame_n = rows_strided * cols_strided;
+    index_t n = static_cast<index_t>(depths.GetLength()) * frame_n;
+
+    const index_t step_size = 3;
+    const index_t est_multipler_factor = (step_size + 1);
+
+    core::Tensor block_coordi({est_multipler_factor * n, 3}, core::Dtype::Int32,
+                              device);
+
+    // Counter
+    core::Tensor count(std::vector<index_t>{0}, {1}, core::Dtype::Int32,
+                       device);
+    index_t *count_ptr = count.GetDataPtr<index_t>();
+    index_t *block_coordi_ptr = block_coordi.GetDataPtr<index_t>();
+
+    index_t resolution = voxel_grid_resolution;
+    float block_size = voxel_size * resolution;
+    DISPATCH_DTYPE_TO_TEMPLATE(depths.GetDtype(), [&]() {
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+            index_t b = workload_idx / frame_n;
+            index_t pixel_idx = workload_idx % frame_n;
+            index_t y = (pixel_idx / cols_strided) * stride;
+            index_t x = (pixel_idx % cols_strided) * stride;
+            const TransformIndexer &ti = poses_ptr[b];
+
+            float d = depth_indexer.GetDataPtr<scalar_t>(
+                              x, y)[b * depth_frame_size] /
+                      depth_scale;
+            if (d > 0 && d < depth_max) {
+                float x_c = 0, y_c = 0, z_c = 0;
+                ti.Unproject(static_cast<float>(x), static_cast<float>(y), 1.0,
+                             &x_c, &y_c, &z_c);
+                float x_g = 0, y_g = 0, z_g = 0;
+                ti.RigidTransform(x_c, y_c, z_c, &x_g, &y_g, &z_g);
+
+                // Origin
+                float x_o = 0, y_o = 0, z_o = 0;
+                ti.GetCameraPosition(&x_o, &y_o, &z_o);
+
+                // Direction
+                float x_d = x_g - x_o;
+                float y_d = y_g - y_o;
+                float z_d = z_g - z_o;
+
+                const float t_min = max(d - sdf_trunc, 0.0);
+                const float t_max = min(d + sdf_trunc, depth_max);
+                const float t_step = (t_max - t_min) / step_size;
+
+                float t = t_min;
+                index_t idx = OPEN3D_ATOMIC_ADD(count_ptr, (step_size + 1));
+                for (index_t step = 0; step <= step_size; ++step) {
+                    index_t offset = (step + idx) * 3;
+
+                    index_t xb = static_cast<index_t>(
+                            floorf((x_o + t * x_d) / block_size));
+                    index_t yb = static_cast<index_t>(
+                            floorf((y_o + t * y_d) / block_size));
+                    index_t zb = static_cast<index_t>(
+                            floorf((z_o + t * z_d) / block_size));
+
+                    block_coordi_ptr[offset + 0] = xb;
+                    block_coordi_ptr[offset + 1] = yb;
+                    block_coordi_ptr[offset + 2] = zb;
+
+                    t += t_step;
+                }
+            }
+        });
+    });
+
+    index_t total_block_count = static_cast<index_t>(count[0].Item<index_t>());
+    if (total_block_count == 0) {
+        utility::LogError(
+                "No block is touched in TSDF volume, "
+                "abort integration. Please check specified parameters, "
+                "especially depth_scale and voxel_size");
+    }
+
+    // A single activation deduplicates the blocks of the whole batch. Unlike
+    // the per-frame touch, the hash map grows instead of truncating the
+    // candidates to its capacity.
+    block_coordi = block_coordi.Slice(0, 0, total_block_count);
+    core::Tensor block_addrs, block_masks;
+    hashmap->Activate(block_coordi, block_addrs, block_masks);
+
+    // Customized IndexGet (generic version too slow)
+    voxel_block_coords =
+            core::Tensor({hashmap->Size(), 3}, core::Int32, device);
+    index_t *voxel_block_coord_ptr = voxel_block_coords.GetDataPtr<index_t>();
+    bool *block_masks_ptr = block_masks.GetDataPtr<bool>();
+    count[0] = 0;
+    core::ParallelFor(device, total_block_count,
+                      [=] OPEN3D_DEVICE(index_t workload_idx) {
+                          if (block_masks_ptr[workload_idx]) {
+                              index_t idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+                              index_t offset_lhs = 3 * idx;
+                              index_t offset_rhs = 3 * workload_idx;
+                              voxel_block_coord_ptr[offset_lhs + 0] =
+                                      block_coordi_ptr[offset_rhs + 0];
+                              voxel_block_coord_ptr[offset_lhs + 1] =
+                                      block_coordi_ptr[offset_rhs + 1];
+                              voxel_block_coord_ptr[offset_lhs + 2] =
+                                      block_coordi_ptr[offset_rhs + 2];
+                          }
+                      });
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
 #define FN_ARGUMENTS                                                     \
     const core::Tensor &depth, const core::Tensor &color,                \
             const core::Tensor &indices, const core::Tensor &block_keys, \
@@ -260,12 +390,55 @@ template void IntegrateCUDA<uint16_t, uint8_t, float, float, float>(
 template void IntegrateCUDA<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
+template void IntegrateCUDA<uint16_t, uint8_t, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateCUDA<float, float, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+
+template void IntegrateBatchCUDA<uint16_t, uint8_t, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCUDA<uint16_t, uint8_t, float, float, float>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCUDA<float, float, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCUDA<float, float, float, float, float>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCUDA<uint16_t, uint8_t, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+template void IntegrateBatchCUDA<float, float, int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+
+#undef FN_ARGUMENTS
+
+#define FN_ARGUMENTS                                                   \
+    const core::Tensor &block_indices, TensorMap &block_value_map,     \
+            core::Tensor &surface_block_masks, index_t resolution,     \
+            float weight_threshold, float weight_decay
+
+template void DecayWeightsAndFindSurfaceBlocksCUDA<float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void DecayWeightsAndFindSurfaceBlocksCUDA<float, float, float>(
+        FN_ARGUMENTS);
+template void DecayWeightsAndFindSurfaceBlocksCUDA<int16_t, uint8_t, uint8_t>(
+        FN_ARGUMENTS);
+
+#undef FN_ARGUMENTS
+
+#define FN_ARGUMENTS                                                       \
+    const core::Tensor &block_indices, const TensorMap &block_value_map,   \
+            core::Tensor &free_block_masks, index_t resolution,            \
+            float weight_threshold
+
+template void FindFreeBlocksCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
+template void FindFreeBlocksCUDA<float, float, float>(FN_ARGUMENTS);
+template void FindFreeBlocksCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
 #define FN_ARGUMENTS                                                           \
     std::shared_ptr<core::HashMap> &hashmap, const TensorMap &block_value_map, \
-            const core::Tensor &range_map, TensorMap &renderings_map,          \
+            const core::Tensor &range_map,                                     \
+            const core::Tensor &free_block_masks, TensorMap &renderings_map,   \
             const core::Tensor &intrinsics, const core::Tensor &extrinsics,    \
             index_t h, index_t w, index_t block_resolution, float voxel_size,  \
             float sdf_trunc, float depth_scale, float depth_min,               \
@@ -273,6 +446,7 @@ template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
 
 template void RayCastCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
+template void RayCastCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -286,6 +460,7 @@ template void RayCastCUDA<float, float, float>(FN_ARGUMENTS);
 
 template void ExtractPointCloudCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractPointCloudCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractPointCloudCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -311,11 +486,13 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
             const core::Tensor &block_keys, const TensorMap &block_value_map, \
             core::Tensor &vertices, core::Tensor &triangles,                  \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
-            index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            core::Tensor &triangle_block_indices, index_t block_resolution,   \
+            float voxel_size, float weight_threshold,                         \
+            index_t mesh_block_count, index_t &vertex_count
 
 template void ExtractTriangleMeshCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCUDA<float, float, float>(FN_ARGUMENTS);
+template void ExtractTriangleMeshCUDA<int16_t, uint8_t, uint8_t>(FN_ARGUMENTS);
 
 #undef FN_ARGUMENTS
 
@@ -25,7 +25,9 @@
 // ----------------------------------------------------------------------------
 
 #include <atomic>
+#include <cfloat>
 #include <cmath>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -49,6 +51,33 @@ namespace voxel_grid {
 using index_t = int;
 using ArrayIndexer = TArrayIndexer<index_t>;
 
+/// Returns a (B, sizeof(TransformIndexer)) UInt8 tensor on device holding one
+/// TransformIndexer per frame of a (B, 4, 4) extrinsic stack, so that batched
+/// kernels can pick the camera of each frame by index. With inverse, the
+/// indexers transform from camera to world coordinates.
+inline core::Tensor CreateFrameTransformIndexers(const core::Tensor& intrinsics,
+                                                 const core::Tensor& extrinsics,
+                                                 const core::Device& device,
+                                                 float scale,
+                                                 bool inverse) {
+    const int64_t batch_size = extrinsics.GetLength();
+    std::vector<TransformIndexer> indexers;
+    indexers.reserve(batch_size);
+    for (int64_t b = 0; b < batch_size; ++b) {
+        core::Tensor extrinsic = extrinsics[b].Contiguous();
+        indexers.emplace_back(
+                intrinsics,
+                inverse ? InverseTransformation(extrinsic) : extrinsic, scale);
+    }
+
+    const int64_t indexer_size = sizeof(TransformIndexer);
+    core::Tensor transforms({batch_size, indexer_size}, core::UInt8, device);
+    core::MemoryManager::MemcpyFromHost(transforms.GetDataPtr(), device,
+                                        indexers.data(),
+                                        batch_size * indexer_size);
+    return transforms;
+}
+
 #if defined(__CUDACC__)
 void GetVoxelCoordinatesAndFlattenedIndicesCUDA
 #else
@@ -127,6 +156,41 @@ DeviceGetLinearIdx(index_t xo,
            xn;
 }
 
+/// Storage codec of the TSDF values, normalized to [-1, 1] by the truncation
+/// distance. Compact Int16 storage maps them to [-32767, 32767].
+inline OPEN3D_HOST_DEVICE float DecodeTSDF(float tsdf) { return tsdf; }
+inline OPEN3D_HOST_DEVICE float DecodeTSDF(int16_t tsdf) {
+    return tsdf * (1.0f / 32767.0f);
+}
+
+template <typename tsdf_t>
+inline OPEN3D_HOST_DEVICE tsdf_t EncodeTSDF(float tsdf);
+template <>
+inline OPEN3D_HOST_DEVICE float EncodeTSDF<float>(float tsdf) {
+    return tsdf;
+}
+template <>
+inline OPEN3D_HOST_DEVICE int16_t EncodeTSDF<int16_t>(float tsdf) {
+    return static_cast<int16_t>(roundf(tsdf * 32767.0f));
+}
+
+/// Integer weights saturate at the maximum of their type instead of wrapping
+/// around.
+template <typename weight_t>
+inline OPEN3D_HOST_DEVICE weight_t SaturateWeight(float weight);
+template <>
+inline OPEN3D_HOST_DEVICE float SaturateWeight<float>(float weight) {
+    return weight;
+}
+template <>
+inline OPEN3D_HOST_DEVICE uint16_t SaturateWeight<uint16_t>(float weight) {
+    return weight < 65535.0f ? static_cast<uint16_t>(weight) : 65535;
+}
+template <>
+inline OPEN3D_HOST_DEVICE uint8_t SaturateWeight<uint8_t>(float weight) {
+    return weight < 255.0f ? static_cast<uint8_t>(weight) : 255;
+}
+
 template <typename tsdf_t>
 inline OPEN3D_DEVICE void DeviceGetNormal(
         const tsdf_t* tsdf_base_ptr,
@@ -150,9 +214,18 @@ inline OPEN3D_DEVICE void DeviceGetNormal(
     index_t vyn = GetLinearIdx(xo, yo - 1, zo);
     index_t vzp = GetLinearIdx(xo, yo, zo + 1);
     index_t vzn = GetLinearIdx(xo, yo, zo - 1);
-    if (vxp >= 0 && vxn >= 0) n[0] = tsdf_base_ptr[vxp] - tsdf_base_ptr[vxn];
-    if (vyp >= 0 && vyn >= 0) n[1] = tsdf_base_ptr[vyp] - tsdf_base_ptr[vyn];
-    if (vzp >= 0 && vzn >= 0) n[2] = tsdf_base_ptr[vzp] - tsdf_base_ptr[vzn];
+    if (vxp >= 0 && vxn >= 0) {
+        n[0] = DecodeTSDF(tsdf_base_ptr[vxp]) -
+               DecodeTSDF(tsdf_base_ptr[vxn]);
+    }
+    if (vyp >= 0 && vyn >= 0) {
+        n[1] = DecodeTSDF(tsdf_base_ptr[vyp]) -
+               DecodeTSDF(tsdf_base_ptr[vyn]);
+    }
+    if (vzp >= 0 && vzn >= 0) {
+        n[2] = DecodeTSDF(tsdf_base_ptr[vzp]) -
+               DecodeTSDF(tsdf_base_ptr[vzn]);
+    }
 };
 
 template <typename input_depth_t,
@@ -274,7 +347,8 @@ void IntegrateCPU
 
         float inv_wsum = 1.0f / (*weight_ptr + 1);
         float weight = *weight_ptr;
-        *tsdf_ptr = (weight * (*tsdf_ptr) + sdf) * inv_wsum;
+        *tsdf_ptr = EncodeTSDF<tsdf_t>(
+                (weight * DecodeTSDF(*tsdf_ptr) + sdf) * inv_wsum);
 
         if (integrate_color) {
             color_t* color_ptr = color_base_ptr + 3 * linear_idx;
@@ -287,11 +361,309 @@ void IntegrateCPU
                                inv_wsum;
             }
         }
-        *weight_ptr = weight + 1;
+        *weight_ptr = SaturateWeight<weight_t>(weight + 1);
+    });
+
+#if defined(__CUDACC__)
+    core::cuda::StreamSynchronize();
+#endif
+}
+
+template <typename input_depth_t,
+          typename input_color_t,
+          typename tsdf_t,
+          typename weight_t,
+          typename color_t>
+#if defined(__CUDACC__)
+void IntegrateBatchCUDA
+#else
+void IntegrateBatchCPU
+#endif
+        (const core::Tensor& depths,
+         const core::Tensor& colors,
+         const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         TensorMap& block_value_map,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         index_t resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_max) {
+    // Parameters
+    index_t resolution2 = resolution * resolution;
+    index_t resolution3 = resolution2 * resolution;
+
+    core::Device device = block_keys.GetDevice();
+    index_t batch_size = static_cast<index_t>(depths.GetLength());
+
+    core::Tensor transforms = CreateFrameTransformIndexers(
+            intrinsics, extrinsics, device, voxel_size, /*inverse=*/false);
+    const TransformIndexer* transforms_ptr =
+            static_cast<const TransformIndexer*>(transforms.GetDataPtr());
+
+    ArrayIndexer voxel_indexer({resolution, resolution, resolution});
+
+    ArrayIndexer block_keys_indexer(block_keys, 1);
+
+    // Frames share the pixel indexing of the first frame and are reached by
+    // their offset in the stack.
+    ArrayIndexer depth_indexer(depths[0], 2);
+    int64_t depth_frame_size = depths.GetStride(0);
+
+    const index_t* indices_ptr = indices.GetDataPtr<index_t>();
+
+    if (!block_value_map.Contains("tsdf") ||
+        !block_value_map.Contains("weight")) {
+        utility::LogError(
+                "TSDF and/or weight not allocated in blocks, please implement "
+                "customized integration.");
+    }
+    tsdf_t* tsdf_base_ptr = block_value_map.at("tsdf").GetDataPtr<tsdf_t>();
+    weight_t* weight_base_ptr =
+            block_value_map.at("weight").GetDataPtr<weight_t>();
+
+    bool integrate_color =
+            block_value_map.Contains("color") && colors.NumElements() > 0;
+    color_t* color_base_ptr = nullptr;
+    ArrayIndexer color_indexer;
+    int64_t color_frame_size = 0;
+
+    float color_multiplier = 1.0;
+    if (integrate_color) {
+        color_base_ptr = block_value_map.at("color").GetDataPtr<color_t>();
+        color_indexer = ArrayIndexer(colors[0], 2);
+        color_frame_size = colors.GetStride(0);
+
+        // Float32: [0, 1] -> [0, 255]
+        if (colors.GetDtype() == core::Float32) {
+            color_multiplier = 255.0;
+        }
+    }
+
+    index_t n = indices.GetLength() * resolution3;
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+        // Natural index (0, N) -> (block_idx, voxel_idx)
+        index_t block_idx = indices_ptr[workload_idx / resolution3];
+        index_t voxel_idx = workload_idx % resolution3;
+
+        /// Coordinate transform
+        // block_idx -> (x_block, y_block, z_block)
+        index_t* block_key_ptr =
+                block_keys_indexer.GetDataPtr<index_t>(block_idx);
+        index_t xb = block_key_ptr[0];
+        index_t yb = block_key_ptr[1];
+        index_t zb = block_key_ptr[2];
+
+        // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+        index_t xv, yv, zv;
+        voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+        // coordinate in world (in voxel)
+        index_t x = xb * resolution + xv;
+        index_t y = yb * resolution + yv;
+        index_t z = zb * resolution + zv;
+
+        index_t linear_idx = block_idx * resolution3 + voxel_idx;
+
+        tsdf_t* tsdf_ptr = tsdf_base_ptr + linear_idx;
+        weight_t* weight_ptr = weight_base_ptr + linear_idx;
+        color_t* color_ptr =
+                integrate_color ? color_base_ptr + 3 * linear_idx : nullptr;
+
+        // Fuse the frames in order in registers with the same storage
+        // conversions as per-frame integration, then write the voxel once.
+        tsdf_t tsdf = *tsdf_ptr;
+        weight_t weight = *weight_ptr;
+        color_t color[3] = {0, 0, 0};
+        if (integrate_color) {
+            for (index_t i = 0; i < 3; ++i) {
+                color[i] = color_ptr[i];
+            }
+        }
+
+        bool updated = false;
+        for (index_t b = 0; b < batch_size; ++b) {
+            const TransformIndexer& transform_indexer = transforms_ptr[b];
+
+            // coordinate in camera (in voxel -> in meter)
+            float xc, yc, zc, u, v;
+            transform_indexer.RigidTransform(
+                    static_cast<float>(x), static_cast<float>(y),
+                    static_cast<float>(z), &xc, &yc, &zc);
+
+            // coordinate in image (in pixel)
+            transform_indexer.Project(xc, yc, zc, &u, &v);
+            if (!depth_indexer.InBoundary(u, v)) {
+                continue;
+            }
+
+            index_t ui = static_cast<index_t>(u);
+            index_t vi = static_cast<index_t>(v);
+
+            // Associate image workload and compute SDF and
+            // TSDF.
+            float depth = depth_indexer.GetDataPtr<input_depth_t>(
+                                  ui, vi)[b * depth_frame_size] /
+                          depth_scale;
+
+            float sdf = depth - zc;
+            if (depth <= 0 || depth > depth_max || zc <= 0 ||
+                sdf < -sdf_trunc) {
+                continue;
+            }
+            sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
+            sdf /= sdf_trunc;
+
+            float inv_wsum = 1.0f / (weight + 1);
+            float w = weight;
+            tsdf = EncodeTSDF<tsdf_t>((w * DecodeTSDF(tsdf) + sdf) * inv_wsum);
+
+            if (integrate_color) {
+                const input_color_t* input_color_ptr =
+                        color_indexer.GetDataPtr<input_color_t>(ui, vi) +
+                        b * color_frame_size;
+
+                for (index_t i = 0; i < 3; ++i) {
+                    color[i] = (w * color[i] +
+                                input_color_ptr[i] * color_multiplier) *
+                               inv_wsum;
+                }
+            }
+            weight = SaturateWeight<weight_t>(w + 1);
+            updated = true;
+        }
+
+        if (updated) {
+            *tsdf_ptr = tsdf;
+            *weight_ptr = weight;
+            if (integrate_color) {
+                for (index_t i = 0; i < 3; ++i) {
+                    color_ptr[i] = color[i];
+                }
+            }
+        }
     });
 
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
+#endif
+}
+
+template <typename tsdf_t, typename weight_t, typename color_t>
+#if defined(__CUDACC__)
+void DecayWeightsAndFindSurfaceBlocksCUDA
+#else
+void DecayWeightsAndFindSurfaceBlocksCPU
+#endif
+        (const core::Tensor& indices,
+         TensorMap& block_value_map,
+         core::Tensor& surface_block_masks,
+         index_t resolution,
+         float weight_threshold,
+         float weight_decay) {
+    index_t resolution3 = resolution * resolution * resolution;
+    core::Device device = indices.GetDevice();
+    index_t n_blocks = static_cast<index_t>(indices.GetLength());
+
+    if (!block_value_map.Contains("tsdf") ||
+        !block_value_map.Contains("weight")) {
+        utility::LogError(
+                "TSDF and/or weight not allocated in blocks, please implement "
+                "customized garbage collection.");
+    }
+    const tsdf_t* tsdf_base_ptr =
+            block_value_map.at("tsdf").GetDataPtr<tsdf_t>();
+    weight_t* weight_base_ptr =
+            block_value_map.at("weight").GetDataPtr<weight_t>();
+
+    const index_t* indices_ptr = indices.GetDataPtr<index_t>();
+
+    surface_block_masks = core::Tensor::Zeros({n_blocks}, core::Bool, device);
+    bool* surface_block_masks_ptr = surface_block_masks.GetDataPtr<bool>();
+
+    const bool decay = weight_decay < 1.0f;
+    index_t n = n_blocks * resolution3;
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+        index_t workload_block_idx = workload_idx / resolution3;
+        index_t block_idx = indices_ptr[workload_block_idx];
+        index_t voxel_idx = workload_idx % resolution3;
+        index_t linear_idx = block_idx * resolution3 + voxel_idx;
+
+        weight_t* weight_ptr = weight_base_ptr + linear_idx;
+        if (decay) {
+            // Integer weights are truncated, so they reach zero.
+            *weight_ptr = static_cast<weight_t>(*weight_ptr * weight_decay);
+        }
+
+        float weight = *weight_ptr;
+        float tsdf = DecodeTSDF(tsdf_base_ptr[linear_idx]);
+        if (weight > weight_threshold && tsdf < 1.0f && tsdf > -1.0f) {
+            // Non-atomic write, but we are safe
+            surface_block_masks_ptr[workload_block_idx] = true;
+        }
+    });
+
+#if defined(__CUDACC__)
+    core::cuda::StreamSynchronize();
+#endif
+}
+
+template <typename tsdf_t, typename weight_t, typename color_t>
+#if defined(__CUDACC__)
+void FindFreeBlocksCUDA
+#else
+void FindFreeBlocksCPU
+#endif
+        (const core::Tensor& indices,
+         const TensorMap& block_value_map,
+         core::Tensor& free_block_masks,
+         index_t resolution,
+         float weight_threshold) {
+    index_t resolution3 = resolution * resolution * resolution;
+    core::Device device = indices.GetDevice();
+    index_t n_blocks = static_cast<index_t>(indices.GetLength());
+
+    if (!block_value_map.Contains("tsdf") ||
+        !block_value_map.Contains("weight")) {
+        utility::LogError(
+                "TSDF and/or weight not allocated in blocks, please implement "
+                "customized ray casting.");
+    }
+    const core::Tensor& tsdf = block_value_map.at("tsdf");
+    const tsdf_t* tsdf_base_ptr = tsdf.GetDataPtr<tsdf_t>();
+    const weight_t* weight_base_ptr =
+            block_value_map.at("weight").GetDataPtr<weight_t>();
+
+    const index_t* indices_ptr = indices.GetDataPtr<index_t>();
+
+    free_block_masks =
+            core::Tensor::Zeros({tsdf.GetLength()}, core::Bool, device);
+    bool* free_block_masks_ptr = free_block_masks.GetDataPtr<bool>();
+
+    core::ParallelFor(device, n_blocks,
+                      [=] OPEN3D_DEVICE(index_t workload_idx) {
+                          free_block_masks_ptr[indices_ptr[workload_idx]] =
+                                  true;
+                      });
+
+    index_t n = n_blocks * resolution3;
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+        index_t block_idx = indices_ptr[workload_idx / resolution3];
+        index_t voxel_idx = workload_idx % resolution3;
+        index_t linear_idx = block_idx * resolution3 + voxel_idx;
+
+        float weight = weight_base_ptr[linear_idx];
+        float tsdf = DecodeTSDF(tsdf_base_ptr[linear_idx]);
+        if (weight >= weight_threshold && tsdf < 1.0f) {
+            // Non-atomic write, but we are safe
+            free_block_masks_ptr[block_idx] = false;
+        }
+    });
+
+#if defined(__CUDACC__)
+    core::cuda::StreamSynchronize();
 #endif
 }
 
@@ -325,6 +697,7 @@ void RayCastCPU
         (std::shared_ptr<core::HashMap>& hashmap,
          const TensorMap& block_value_map,
          const core::Tensor& range,
+         const core::Tensor& free_block_masks,
          TensorMap& renderings_map,
          const core::Tensor& intrinsics,
          const core::Tensor& extrinsics,
@@ -392,6 +765,7 @@ void RayCastCPU
             block_value_map.at("tsdf").GetDataPtr<tsdf_t>();
     const weight_t* weight_base_ptr =
             block_value_map.at("weight").GetDataPtr<weight_t>();
+    const bool* free_block_masks_ptr = free_block_masks.GetDataPtr<bool>();
 
     // Geometry
     if (renderings_map.Contains("depth")) {
@@ -460,10 +834,21 @@ void RayCastCPU
 
 #ifndef __CUDACC__
     using std::max;
+    using std::min;
     using std::sqrt;
 #endif
 
     core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+        // Ray parameter distance from coordinate p to the boundary of its
+        // block along direction d, in one dimension.
+        auto GetBlockExitDistance = [&] OPEN3D_DEVICE(float p,
+                                                      float d) -> float {
+            float p_b = floorf(p / block_size) * block_size;
+            if (d > 0) return (p_b + block_size - p) / d;
+            if (d < 0) return (p_b - p) / d;
+            return FLT_MAX;
+        };
+
         auto GetLinearIdxAtP = [&] OPEN3D_DEVICE(
                                        index_t x_b, index_t y_b, index_t z_b,
                                        index_t x_v, index_t y_v, index_t z_v,
@@ -663,9 +1048,22 @@ void RayCastCPU
             if (linear_idx < 0) {
                 t_prev = t;
                 t += block_size;
+            } else if (free_block_masks_ptr[linear_idx / resolution3]) {
+                // Jump to where the ray leaves the free block, which is
+                // treated as observed free space.
+                x_g = x_o + t * x_d;
+                y_g = y_o + t * y_d;
+                z_g = z_o + t * z_d;
+                float dt = GetBlockExitDistance(x_g, x_d);
+                dt = min(dt, GetBlockExitDistance(y_g, y_d));
+                dt = min(dt, GetBlockExitDistance(z_g, z_d));
+
+                tsdf = 1.0f;
+                t_prev = t;
+                t += dt + 1e-3f * voxel_size;
             } else {
                 tsdf_prev = tsdf;
-                tsdf = tsdf_base_ptr[linear_idx];
+                tsdf = DecodeTSDF(tsdf_base_ptr[linear_idx]);
                 w = weight_base_ptr[linear_idx];
                 if (tsdf_prev > 0 && w >= weight_threshold && tsdf <= 0) {
                     surface_found = true;
@@ -749,7 +1147,7 @@ void RayCastCPU
                         index_ptr[k] = linear_idx_k;
                     }
 
-                    float tsdf_k = tsdf_base_ptr[linear_idx_k];
+                    float tsdf_k = DecodeTSDF(tsdf_base_ptr[linear_idx_k]);
                     float interp_ratio_dx = ry * rz * (2 * dx_v - 1);
                     float interp_ratio_dy = rx * rz * (2 * dy_v - 1);
                     float interp_ratio_dz = rx * ry * (2 * dz_v - 1);
@@ -806,7 +1204,7 @@ void RayCastCPU
     });
 
 #if defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
 #endif
 }
 
@@ -899,7 +1297,7 @@ void ExtractPointCloudCPU
             voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
             index_t linear_idx = block_idx * resolution3 + voxel_idx;
-            float tsdf_o = tsdf_base_ptr[linear_idx];
+            float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
             float weight_o = weight_base_ptr[linear_idx];
             if (weight_o <= weight_threshold) return;
 
@@ -910,7 +1308,7 @@ void ExtractPointCloudCPU
                                      zv + (i == 2), workload_block_idx);
                 if (linear_idx_i < 0) continue;
 
-                float tsdf_i = tsdf_base_ptr[linear_idx_i];
+                float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
                 float weight_i = weight_base_ptr[linear_idx_i];
                 if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                     OPEN3D_ATOMIC_ADD(count_ptr, 1);
@@ -980,7 +1378,7 @@ void ExtractPointCloudCPU
         voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
 
         index_t linear_idx = block_idx * resolution3 + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
         float weight_o = weight_base_ptr[linear_idx];
         if (weight_o <= weight_threshold) return;
 
@@ -1000,7 +1398,7 @@ void ExtractPointCloudCPU
                                  workload_block_idx);
             if (linear_idx_i < 0) continue;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i > weight_threshold && tsdf_i * tsdf_o < 0) {
                 float ratio = (0 - tsdf_o) / (tsdf_i - tsdf_o);
@@ -1063,7 +1461,7 @@ void ExtractPointCloudCPU
     valid_size = total_count;
 
 #if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
-    core::cuda::Synchronize();
+    core::cuda::StreamSynchronize();
 #endif
 }
 
@@ -1083,9 +1481,11 @@ void ExtractTriangleMeshCPU
          core::Tensor& triangles,
          core::Tensor& vertex_normals,
          core::Tensor& vertex_colors,
+         core::Tensor& triangle_block_indices,
          index_t block_resolution,
          float voxel_size,
          float weight_threshold,
+         index_t mesh_block_count,
          index_t& vertex_count) {
     core::Device device = block_indices.GetDevice();
 
@@ -1095,6 +1495,10 @@ void ExtractTriangleMeshCPU
     // Shape / transform indexers, no data involved
     ArrayIndexer voxel_indexer({resolution, resolution, resolution});
     index_t n_blocks = static_cast<index_t>(block_indices.GetLength());
+    index_t n_mesh_blocks =
+            (mesh_block_count < 0 || mesh_block_count > n_blocks)
+                    ? n_blocks
+                    : mesh_block_count;
 
     // TODO(wei): profile performance by replacing the table to a hashmap.
     // Voxel-wise mesh info. 4 channels correspond to:
@@ -1140,10 +1544,12 @@ void ExtractTriangleMeshCPU
     }
 
     index_t n = n_blocks * resolution3;
+    // Only the leading blocks form cubes; the others receive vertices.
+    index_t n_mesh = n_mesh_blocks * resolution3;
     // Pass 0: analyze mesh structure, set up one-on-one correspondences
     // from edges to vertices.
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelFor(device, n_mesh, [=] OPEN3D_DEVICE(index_t widx) {
         auto GetLinearIdx = [&] OPEN3D_DEVICE(
                                     index_t xo, index_t yo, index_t zo,
                                     index_t curr_block_idx) -> index_t {
@@ -1170,7 +1576,7 @@ void ExtractTriangleMeshCPU
                                  zv + vtx_shifts[i][2], workload_block_idx);
             if (linear_idx_i < 0) return;
 
-            float tsdf_i = tsdf_base_ptr[linear_idx_i];
+            float tsdf_i = DecodeTSDF(tsdf_base_ptr[linear_idx_i]);
             float weight_i = weight_base_ptr[linear_idx_i];
             if (weight_i <= weight_threshold) return;
 
@@ -1334,7 +1740,7 @@ void ExtractTriangleMeshCPU
 
         // Obtain voxel ptr
         index_t linear_idx = resolution3 * block_idx + voxel_idx;
-        float tsdf_o = tsdf_base_ptr[linear_idx];
+        float tsdf_o = DecodeTSDF(tsdf_base_ptr[linear_idx]);
 
         float no[3] = {0}, ne[3] = {0};
 
@@ -1351,7 +1757,7 @@ void ExtractTriangleMeshCPU
                                  workload_block_idx);
             OPEN3D_ASSERT(linear_idx_e > 0 &&
                           "Internal error: GetVoxelAt returns nullptr.");
-            float tsdf_e = tsdf_base_ptr[linear_idx_e];
+            float tsdf_e = DecodeTSDF(tsdf_base_ptr[linear_idx_e]);
             float ratio = (0 - tsdf_o) / (tsdf_e - tsdf_o);
 
             index_t idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
@@ -1400,6 +1806,9 @@ void ExtractTriangleMeshCPU
     index_t triangle_count = vertex_count * 3;
     triangles = core::Tensor({triangle_count, 3}, core::Int32, device);
     ArrayIndexer triangle_indexer(triangles, 1);
+    triangle_block_indices =
+            core::Tensor({triangle_count}, core::Int32, device);
+    index_t* triangle_block_ptr = triangle_block_indices.GetDataPtr<index_t>();
 
 #if defined(__CUDACC__)
     count = core::Tensor(std::vector<index_t>{0}, {}, core::Int32, device);
@@ -1407,7 +1816,7 @@ void ExtractTriangleMeshCPU
 #else
     (*count_ptr) = 0;
 #endif
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelFor(device, n_mesh, [=] OPEN3D_DEVICE(index_t widx) {
         // Natural index (0, N) -> (block_idx, voxel_idx)
         index_t workload_block_idx = widx / resolution3;
         index_t voxel_idx = widx % resolution3;
@@ -1427,6 +1836,7 @@ void ExtractTriangleMeshCPU
             if (tri_table[table_idx][tri] == -1) return;
 
             index_t tri_idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+            triangle_block_ptr[tri_idx] = workload_block_idx;
 
             for (index_t vertex = 0; vertex < 3; ++vertex) {
                 index_t edge = tri_table[table_idx][tri + vertex];
@@ -1466,6 +1876,7 @@ void ExtractTriangleMeshCPU
 #endif
     utility::LogDebug("Total triangle count = {}", triangle_count);
     triangles = triangles.Slice(0, 0, triangle_count);
+    triangle_block_indices = triangle_block_indices.Slice(0, 0, triangle_count);
 }
 
 }  // namespace voxel_grid
@@ -0,0 +1,465 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ColumnarIO.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/t/io/MappedFile.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+// Open3D columnar container layout. All values are little endian, as is the
+// host. Strings are a uint32 length followed by the characters.
+//
+// header  "O3DCOLS\0", uint32 version, uint32 num_columns, uint64 data
+//         offset, uint64 data size.
+// index   Per column its name, dtype name, uint32 ndim, int64 shape[ndim]
+//         and the uint64 offset of its data from the data offset.
+// data    The columns as contiguous arrays in row major order, each starting
+//         at a multiple of kColumnAlignment, so that they can be used in
+//         place from a memory-mapped file.
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr char kColumnsMagic[8] = {'O', '3', 'D', 'C', 'O', 'L', 'S', '\0'};
+constexpr uint32_t kColumnsVersion = 1;
+constexpr int64_t kColumnsHeaderSize = 32;
+constexpr int64_t kColumnAlignment = 64;
+
+int64_t AlignColumn(int64_t offset) {
+    return (offset + kColumnAlignment - 1) / kColumnAlignment *
+           kColumnAlignment;
+}
+
+template <typename T>
+void Put(std::vector<char> &buffer, T value) {
+    const size_t size = buffer.size();
+    buffer.resize(size + sizeof(T));
+    std::memcpy(buffer.data() + size, &value, sizeof(T));
+}
+
+void PutString(std::vector<char> &buffer, const std::string &value) {
+    Put<uint32_t>(buffer, uint32_t(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+/// Reads values from the serialized index. Every read fails past its end.
+class IndexReader {
+public:
+    IndexReader(const char *begin, const char *end) : ptr_(begin), end_(end) {}
+
+    template <typename T>
+    T Get() {
+        if (end_ - ptr_ < int64_t(sizeof(T))) {
+            utility::LogError("Read columns failed: corrupted index.");
+        }
+        T value;
+        std::memcpy(&value, ptr_, sizeof(T));
+        ptr_ += sizeof(T);
+        return value;
+    }
+
+    std::string GetString() {
+        const uint32_t size = Get<uint32_t>();
+        if (end_ - ptr_ < int64_t(size)) {
+            utility::LogError("Read columns failed: corrupted index.");
+        }
+        std::string value(ptr_, size);
+        ptr_ += size;
+        return value;
+    }
+
+private:
+    const char *ptr_;
+    const char *end_;
+};
+
+core::Dtype GetColumnDtype(const std::string &name) {
+    static const std::vector<core::Dtype> dtypes{
+            core::Bool,   core::UInt8,   core::UInt16, core::UInt32,
+            core::UInt64, core::Int8,    core::Int16,  core::Int32,
+            core::Int64,  core::Float32, core::Float64};
+    for (const core::Dtype &dtype : dtypes) {
+        if (dtype.ToString() == name) {
+            return dtype;
+        }
+    }
+    utility::LogError("Read columns failed: unsupported dtype {}.", name);
+}
+
+/// Stacks tensors with the same dtype and element shape along the first
+/// dimension on the host. \p shape is the shape of one of them.
+core::Tensor ConcatenateRows(const std::vector<core::Tensor> &tensors,
+                             const core::SizeVector &shape,
+                             const core::Dtype &dtype) {
+    core::SizeVector out_shape = shape;
+    out_shape[0] = 0;
+    for (const core::Tensor &tensor : tensors) {
+        out_shape[0] += tensor.GetLength();
+    }
+    core::Tensor out(out_shape, dtype, core::Device("CPU:0"));
+    int64_t begin = 0;
+    for (const core::Tensor &tensor : tensors) {
+        const int64_t end = begin + tensor.GetLength();
+        if (end > begin) {
+            out.Slice(0, begin, end) = tensor.To(core::Device("CPU:0"));
+        }
+        begin = end;
+    }
+    return out;
+}
+
+core::Tensor GetColumn(const std::map<std::string, core::Tensor> &columns,
+                       const std::string &name,
+                       const std::string &filename) {
+    auto it = columns.find(name);
+    if (it == columns.end()) {
+        utility::LogError("Read columns failed: {} has no column {}.",
+                          filename, name);
+    }
+    return it->second;
+}
+
+}  // namespace
+
+void WriteColumns(const std::string &filename,
+                  const std::map<std::string, core::Tensor> &columns) {
+    std::vector<core::Tensor> host_columns;
+    std::vector<char> index;
+    int64_t data_size = 0;
+    for (const auto &it : columns) {
+        host_columns.push_back(
+                it.second.To(core::Device("CPU:0")).Contiguous());
+        const core::Tensor &column = host_columns.back();
+        const core::SizeVector &shape = column.GetShape();
+        PutString(index, it.first);
+        PutString(index, column.GetDtype().ToString());
+        Put<uint32_t>(index, uint32_t(shape.size()));
+        for (int64_t dim : shape) {
+            Put<int64_t>(index, dim);
+        }
+        const int64_t offset = AlignColumn(data_size);
+        Put<uint64_t>(index, uint64_t(offset));
+        data_size =
+                offset + column.NumElements() * column.GetDtype().ByteSize();
+    }
+
+    std::vector<char> header(kColumnsMagic,
+                             kColumnsMagic + sizeof(kColumnsMagic));
+    Put<uint32_t>(header, kColumnsVersion);
+    Put<uint32_t>(header, uint32_t(columns.size()));
+    const int64_t data_offset =
+            AlignColumn(kColumnsHeaderSize + int64_t(index.size()));
+    Put<uint64_t>(header, uint64_t(data_offset));
+    Put<uint64_t>(header, uint64_t(data_size));
+    header.insert(header.end(), index.begin(), index.end());
+    header.resize(data_offset, 0);
+
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "wb")) {
+        utility::LogError("Write columns failed: unable to open file {}.",
+                          filename);
+    }
+    FILE *fp = file.GetFILE();
+    bool success = fwrite(header.data(), 1, header.size(), fp) == header.size();
+    int64_t offset = 0;
+    const std::vector<char> padding(kColumnAlignment, 0);
+    for (const core::Tensor &column : host_columns) {
+        const size_t padding_size = size_t(AlignColumn(offset) - offset);
+        const size_t num_bytes =
+                column.NumElements() * column.GetDtype().ByteSize();
+        success = success &&
+                  fwrite(padding.data(), 1, padding_size, fp) ==
+                          padding_size &&
+                  fwrite(column.GetDataPtr(), 1, num_bytes, fp) == num_bytes;
+        offset += int64_t(padding_size + num_bytes);
+    }
+    if (!success) {
+        utility::LogError("Write columns failed: unable to write file {}.",
+                          filename);
+    }
+}
+
+std::map<std::string, core::Tensor> ReadColumns(const std::string &filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Read columns failed: unable to open file {}.",
+                          filename);
+    }
+    const int64_t file_size = file.GetFileSize();
+    std::vector<char> header(kColumnsHeaderSize);
+    if (file.ReadData(header.data(), 1, header.size()) != header.size() ||
+        std::memcmp(header.data(), kColumnsMagic, sizeof(kColumnsMagic)) !=
+                0) {
+        utility::LogError("Read columns failed: {} is not a column file.",
+                          filename);
+    }
+    IndexReader header_reader(header.data() + sizeof(kColumnsMagic),
+                              header.data() + header.size());
+    const uint32_t version = header_reader.Get<uint32_t>();
+    if (version != kColumnsVersion) {
+        utility::LogError("Read columns failed: unsupported version {}.",
+                          version);
+    }
+    const uint32_t num_columns = header_reader.Get<uint32_t>();
+    const int64_t data_offset = int64_t(header_reader.Get<uint64_t>());
+    const int64_t data_size = int64_t(header_reader.Get<uint64_t>());
+    if (data_offset < kColumnsHeaderSize || data_size < 0 ||
+        data_offset + data_size > file_size) {
+        utility::LogError("Read columns failed: {} is truncated.", filename);
+    }
+    std::vector<char> index(data_offset - kColumnsHeaderSize);
+    if (file.ReadData(index.data(), 1, index.size()) != index.size()) {
+        utility::LogError("Read columns failed: {} is truncated.", filename);
+    }
+    file.Close();
+
+    std::shared_ptr<core::Blob> blob;
+    if (data_size > 0) {
+        blob = MapFileRegion(filename, data_offset, data_size);
+    }
+    std::map<std::string, core::Tensor> columns;
+    IndexReader reader(index.data(), index.data() + index.size());
+    for (uint32_t i = 0; i < num_columns; ++i) {
+        const std::string name = reader.GetString();
+        const core::Dtype dtype = GetColumnDtype(reader.GetString());
+        core::SizeVector shape(reader.Get<uint32_t>());
+        for (int64_t &dim : shape) {
+            dim = reader.Get<int64_t>();
+            if (dim < 0) {
+                utility::LogError("Read columns failed: invalid shape.");
+            }
+        }
+        const int64_t offset = int64_t(reader.Get<uint64_t>());
+        const int64_t num_bytes = shape.NumElements() * dtype.ByteSize();
+        if (offset < 0 || offset + num_bytes > data_size) {
+            utility::LogError("Read columns failed: {} is truncated.",
+                              filename);
+        }
+        if (num_bytes == 0) {
+            columns.emplace(name, core::Tensor(shape, dtype));
+        } else {
+            columns.emplace(
+                    name,
+                    core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                                 static_cast<char *>(blob->GetDataPtr()) +
+                                         offset,
+                                 dtype, blob));
+        }
+    }
+    return columns;
+}
+
+void WriteFeatures(const std::string &filename,
+                   const std::vector<core::Tensor> &features) {
+    std::vector<int64_t> offsets{0};
+    for (const core::Tensor &feature : features) {
+        core::AssertTensorShape(feature, {utility::nullopt,
+                                          features[0].GetShape().back()});
+        core::AssertTensorDtype(feature, features[0].GetDtype());
+        offsets.push_back(offsets.back() + feature.GetLength());
+    }
+    std::map<std::string, core::Tensor> columns;
+    columns.emplace("feature_offsets",
+                    core::Tensor(offsets, {int64_t(offsets.size())},
+                                 core::Int64));
+    if (!features.empty()) {
+        columns.emplace("features",
+                        ConcatenateRows(features, features[0].GetShape(),
+                                        features[0].GetDtype()));
+    }
+    WriteColumns(filename, columns);
+}
+
+std::vector<core::Tensor> ReadFeatures(const std::string &filename) {
+    const std::map<std::string, core::Tensor> columns = ReadColumns(filename);
+    const core::Tensor offsets =
+            GetColumn(columns, "feature_offsets", filename);
+    const int64_t *offsets_ptr = offsets.GetDataPtr<int64_t>();
+    std::vector<core::Tensor> features;
+    if (offsets.GetLength() > 1) {
+        const core::Tensor all = GetColumn(columns, "features", filename);
+        for (int64_t i = 0; i + 1 < offsets.GetLength(); ++i) {
+            features.push_back(
+                    all.Slice(0, offsets_ptr[i], offsets_ptr[i + 1]));
+        }
+    }
+    return features;
+}
+
+void WriteCorrespondences(
+        const std::string &filename,
+        const std::map<std::pair<int, int>, core::Tensor> &correspondences) {
+    std::vector<int32_t> pairs;
+    std::vector<int64_t> offsets{0};
+    std::vector<core::Tensor> sets;
+    for (const auto &it : correspondences) {
+        core::AssertTensorShape(it.second, {utility::nullopt, 2});
+        pairs.push_back(it.first.first);
+        pairs.push_back(it.first.second);
+        offsets.push_back(offsets.back() + it.second.GetLength());
+        sets.push_back(it.second.To(core::Int64));
+    }
+    const int64_t num_sets = int64_t(sets.size());
+    std::map<std::string, core::Tensor> columns;
+    columns.emplace("pairs", core::Tensor(pairs, {num_sets, 2}, core::Int32));
+    columns.emplace("offsets",
+                    core::Tensor(offsets, {num_sets + 1}, core::Int64));
+    columns.emplace("correspondences",
+                    ConcatenateRows(sets, {0, 2}, core::Int64));
+    WriteColumns(filename, columns);
+}
+
+std::map<std::pair<int, int>, core::Tensor> ReadCorrespondences(
+        const std::string &filename) {
+    const std::map<std::string, core::Tensor> columns = ReadColumns(filename);
+    const core::Tensor pairs = GetColumn(columns, "pairs", filename);
+    const core::Tensor offsets = GetColumn(columns, "offsets", filename);
+    const core::Tensor all = GetColumn(columns, "correspondences", filename);
+    if (offsets.GetLength() != pairs.GetLength() + 1) {
+        utility::LogError("Read columns failed: corrupted file {}.",
+                          filename);
+    }
+    const int32_t *pairs_ptr = pairs.GetDataPtr<int32_t>();
+    const int64_t *offsets_ptr = offsets.GetDataPtr<int64_t>();
+    std::map<std::pair<int, int>, core::Tensor> correspondences;
+    for (int64_t i = 0; i < pairs.GetLength(); ++i) {
+        correspondences.emplace(
+                std::make_pair(pairs_ptr[2 * i], pairs_ptr[2 * i + 1]),
+                all.Slice(0, offsets_ptr[i], offsets_ptr[i + 1]));
+    }
+    return correspondences;
+}
+
+void WritePoseGraphColumns(
+        const std::string &filename,
+        const open3d::pipelines::registration::PoseGraph &pose_graph) {
+    const int64_t num_nodes = int64_t(pose_graph.nodes_.size());
+    const int64_t num_edges = int64_t(pose_graph.edges_.size());
+    core::Tensor node_poses({num_nodes, 4, 4}, core::Float64);
+    core::Tensor source_ids({num_edges}, core::Int32);
+    core::Tensor target_ids({num_edges}, core::Int32);
+    core::Tensor transformations({num_edges, 4, 4}, core::Float64);
+    core::Tensor information({num_edges, 6, 6}, core::Float64);
+    core::Tensor uncertain({num_edges}, core::Bool);
+    core::Tensor confidences({num_edges}, core::Float64);
+
+    double *node_poses_ptr = node_poses.GetDataPtr<double>();
+    for (int64_t i = 0; i < num_nodes; ++i) {
+        Eigen::Map<Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                node_poses_ptr + 16 * i) = pose_graph.nodes_[i].pose_;
+    }
+    for (int64_t i = 0; i < num_edges; ++i) {
+        const open3d::pipelines::registration::PoseGraphEdge &edge =
+                pose_graph.edges_[i];
+        source_ids.GetDataPtr<int32_t>()[i] = edge.source_node_id_;
+        target_ids.GetDataPtr<int32_t>()[i] = edge.target_node_id_;
+        Eigen::Map<Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                transformations.GetDataPtr<double>() + 16 * i) =
+                edge.transformation_;
+        Eigen::Map<Eigen::Matrix<double, 6, 6, Eigen::RowMajor>>(
+                information.GetDataPtr<double>() + 36 * i) = edge.information_;
+        uncertain.GetDataPtr<bool>()[i] = edge.uncertain_;
+        confidences.GetDataPtr<double>()[i] = edge.confidence_;
+    }
+
+    WriteColumns(filename, {{"node_poses", node_poses},
+                            {"edge_source_ids", source_ids},
+                            {"edge_target_ids", target_ids},
+                            {"edge_transformations", transformations},
+                            {"edge_information", information},
+                            {"edge_uncertain", uncertain},
+                            {"edge_confidences", confidences}});
+}
+
+void ReadPoseGraphColumns(
+        const std::string &filename,
+        open3d::pipelines::registration::PoseGraph &pose_graph) {
+    const std::map<std::string, core::Tensor> columns = ReadColumns(filename);
+    const core::Tensor node_poses = GetColumn(columns, "node_poses", filename);
+    const core::Tensor source_ids =
+            GetColumn(columns, "edge_source_ids", filename);
+    const core::Tensor target_ids =
+            GetColumn(columns, "edge_target_ids", filename);
+    const core::Tensor transformations =
+            GetColumn(columns, "edge_transformations", filename);
+    const core::Tensor information =
+            GetColumn(columns, "edge_information", filename);
+    const core::Tensor uncertain =
+            GetColumn(columns, "edge_uncertain", filename);
+    const core::Tensor confidences =
+            GetColumn(columns, "edge_confidences", filename);
+    const int64_t num_nodes = node_poses.GetLength();
+    const int64_t num_edges = source_ids.GetLength();
+    core::AssertTensorShape(node_poses, {num_nodes, 4, 4});
+    core::AssertTensorDtype(node_poses, core::Float64);
+    for (const core::Tensor &column :
+         {source_ids, target_ids, uncertain, confidences}) {
+        core::AssertTensorShape(column, {num_edges});
+    }
+    core::AssertTensorShape(transformations, {num_edges, 4, 4});
+    core::AssertTensorShape(information, {num_edges, 6, 6});
+    core::AssertTensorDtype(source_ids, core::Int32);
+    core::AssertTensorDtype(target_ids, core::Int32);
+    core::AssertTensorDtype(transformations, core::Float64);
+    core::AssertTensorDtype(information, core::Float64);
+    core::AssertTensorDtype(uncertain, core::Bool);
+    core::AssertTensorDtype(confidences, core::Float64);
+
+    pose_graph.nodes_.resize(num_nodes);
+    for (int64_t i = 0; i < num_nodes; ++i) {
+        pose_graph.nodes_[i].pose_ =
+                Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                        node_poses.GetDataPtr<double>() + 16 * i);
+    }
+    pose_graph.edges_.resize(num_edges);
+    for (int64_t i = 0; i < num_edges; ++i) {
+        open3d::pipelines::registration::PoseGraphEdge &edge =
+                pose_graph.edges_[i];
+        edge.source_node_id_ = source_ids.GetDataPtr<int32_t>()[i];
+        edge.target_node_id_ = target_ids.GetDataPtr<int32_t>()[i];
+        edge.transformation_ =
+                Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>>(
+                        transformations.GetDataPtr<double>() + 16 * i);
+        edge.information_ =
+                Eigen::Map<const Eigen::Matrix<double, 6, 6, Eigen::RowMajor>>(
+                        information.GetDataPtr<double>() + 36 * i);
+        edge.uncertain_ = uncertain.GetDataPtr<bool>()[i];
+        edge.confidence_ = confidences.GetDataPtr<double>()[i];
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
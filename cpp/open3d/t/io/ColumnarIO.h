@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \brief Write named tensors ("columns") to a single columnar container
+/// file.
+///
+/// Each column is stored as one contiguous, aligned array behind a small
+/// index, so that a multi-fragment pipeline keeps all its features,
+/// correspondences or edges in one file instead of one file per fragment
+/// or pair. Columns on other devices are copied to the host first.
+///
+/// \param filename The container file name to write to.
+/// \param columns Named tensors to write.
+void WriteColumns(const std::string &filename,
+                  const std::map<std::string, core::Tensor> &columns);
+
+/// \brief Read all columns of a file written by WriteColumns().
+///
+/// The file is memory-mapped with copy-on-write semantics and the returned
+/// CPU tensors view the mapping, so pages are read on first access only.
+///
+/// \param filename The container file name to read from.
+std::map<std::string, core::Tensor> ReadColumns(const std::string &filename);
+
+/// \brief Write the feature matrices of several fragments to one container.
+///
+/// \param filename The container file name to write to.
+/// \param features One (N_i, D) feature tensor per fragment, e.g. from
+/// t::pipelines::registration::ComputeFPFHFeature(), all with the same D and
+/// dtype.
+void WriteFeatures(const std::string &filename,
+                   const std::vector<core::Tensor> &features);
+
+/// \brief Read the feature matrices written by WriteFeatures(). The tensors
+/// are views of the memory-mapped file.
+std::vector<core::Tensor> ReadFeatures(const std::string &filename);
+
+/// \brief Write correspondence sets to one container.
+///
+/// \param filename The container file name to write to.
+/// \param correspondences (N_k, 2) Int64 correspondence sets keyed by
+/// (source, target) fragment ids, as computed by the SLAC pipeline.
+void WriteCorrespondences(
+        const std::string &filename,
+        const std::map<std::pair<int, int>, core::Tensor> &correspondences);
+
+/// \brief Read the correspondence sets written by WriteCorrespondences().
+/// The tensors are views of the memory-mapped file.
+std::map<std::pair<int, int>, core::Tensor> ReadCorrespondences(
+        const std::string &filename);
+
+/// \brief Write the nodes and edges of a pose graph as columns.
+///
+/// The container holds "node_poses" (N, 4, 4), "edge_source_ids" and
+/// "edge_target_ids" (M,), "edge_transformations" (M, 4, 4),
+/// "edge_information" (M, 6, 6), "edge_uncertain" (M,) and
+/// "edge_confidences" (M,). Matrices are row major Float64.
+///
+/// \param filename The container file name to write to.
+/// \param pose_graph The pose graph to write.
+void WritePoseGraphColumns(
+        const std::string &filename,
+        const open3d::pipelines::registration::PoseGraph &pose_graph);
+
+/// \brief Read a pose graph written by WritePoseGraphColumns().
+///
+/// \param filename The container file name to read from.
+/// \param pose_graph The pose graph to read to.
+void ReadPoseGraphColumns(
+        const std::string &filename,
+        open3d::pipelines::registration::PoseGraph &pose_graph);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -26,13 +26,238 @@
 
 #include "open3d/t/io/HashMapIO.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/t/io/MappedFile.h"
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+// Open3D hash map (.o3dhash) layout. All values are little endian, as is the
+// host.
+//
+// header  "O3DHASH\0", uint32 version, uint32 num_values, uint64 size,
+//         uint64 capacity, uint64 data offset.
+// arrays  For the keys and then each value array, the dtype name as a uint32
+//         length and its characters, then uint32 ndim and int64 shape[ndim]
+//         of one element.
+// data    From the data offset, the active keys as one contiguous array of
+//         size elements, followed by each value array in the same order.
+//         Arrays start at multiples of kO3DHashAlignment, so that they can
+//         be used in place from a memory-mapped file.
+
 namespace open3d {
 namespace t {
 namespace io {
 
-void WriteHashMap(const std::string& file_name, const core::HashMap& hashmap) {
+namespace {
+
+constexpr char kO3DHashMagic[8] = {'O', '3', 'D', 'H', 'A', 'S', 'H', '\0'};
+constexpr uint32_t kO3DHashVersion = 1;
+constexpr int64_t kO3DHashHeaderSize = 40;
+constexpr int64_t kO3DHashAlignment = 64;
+
+int64_t AlignO3DHash(int64_t offset) {
+    return (offset + kO3DHashAlignment - 1) / kO3DHashAlignment *
+           kO3DHashAlignment;
+}
+
+template <typename T>
+void Put(std::vector<char>& buffer, T value) {
+    const size_t size = buffer.size();
+    buffer.resize(size + sizeof(T));
+    std::memcpy(buffer.data() + size, &value, sizeof(T));
+}
+
+void PutArrayType(std::vector<char>& buffer,
+                  const core::Dtype& dtype,
+                  const core::SizeVector& element_shape) {
+    const std::string name = dtype.ToString();
+    Put<uint32_t>(buffer, uint32_t(name.size()));
+    buffer.insert(buffer.end(), name.begin(), name.end());
+    Put<uint32_t>(buffer, uint32_t(element_shape.size()));
+    for (int64_t dim : element_shape) {
+        Put<int64_t>(buffer, dim);
+    }
+}
+
+template <typename T>
+T Get(utility::filesystem::CFile& file) {
+    T value;
+    if (file.ReadData(&value, sizeof(T), 1) != 1) {
+        utility::LogError("Read hash map failed: unexpected end of file.");
+    }
+    return value;
+}
+
+void GetArrayType(utility::filesystem::CFile& file,
+                  core::Dtype& dtype,
+                  core::SizeVector& element_shape) {
+    static const std::vector<core::Dtype> dtypes{
+            core::Bool,   core::UInt8,   core::UInt16, core::UInt32,
+            core::UInt64, core::Int8,    core::Int16,  core::Int32,
+            core::Int64,  core::Float32, core::Float64};
+    std::string name(Get<uint32_t>(file), '\0');
+    if (file.ReadData(&name[0], 1, name.size()) != name.size()) {
+        utility::LogError("Read hash map failed: unexpected end of file.");
+    }
+    dtype = core::Undefined;
+    for (const core::Dtype& candidate : dtypes) {
+        if (candidate.ToString() == name) {
+            dtype = candidate;
+        }
+    }
+    if (dtype == core::Undefined) {
+        utility::LogError("Read hash map failed: unsupported dtype {}.", name);
+    }
+    element_shape.resize(Get<uint32_t>(file));
+    for (int64_t& dim : element_shape) {
+        dim = Get<int64_t>(file);
+        if (dim < 0) {
+            utility::LogError("Read hash map failed: invalid element shape.");
+        }
+    }
+}
+
+void WriteHashMapToO3DHash(const std::string& file_name,
+                           const core::HashMap& hashmap) {
+    const core::Device host("CPU:0");
+    const core::Tensor active_indices =
+            hashmap.GetActiveIndices().To(core::Int64);
+    std::vector<core::Tensor> arrays{
+            hashmap.GetKeyTensor().IndexGet({active_indices}).To(host)};
+    for (const core::Tensor& value : hashmap.GetValueTensors()) {
+        arrays.push_back(value.IndexGet({active_indices}).To(host));
+    }
+
+    std::vector<char> header(kO3DHashMagic,
+                             kO3DHashMagic + sizeof(kO3DHashMagic));
+    Put<uint32_t>(header, kO3DHashVersion);
+    Put<uint32_t>(header, uint32_t(arrays.size() - 1));
+    Put<uint64_t>(header, uint64_t(active_indices.GetLength()));
+    Put<uint64_t>(header, uint64_t(hashmap.GetCapacity()));
+    const size_t data_offset_pos = header.size();
+    Put<uint64_t>(header, 0);
+    for (const core::Tensor& array : arrays) {
+        const core::SizeVector& shape = array.GetShape();
+        PutArrayType(header, array.GetDtype(),
+                     core::SizeVector(shape.begin() + 1, shape.end()));
+    }
+    const uint64_t data_offset = AlignO3DHash(int64_t(header.size()));
+    std::memcpy(header.data() + data_offset_pos, &data_offset,
+                sizeof(uint64_t));
+    header.resize(data_offset, 0);
+
+    utility::filesystem::CFile file;
+    if (!file.Open(file_name, "wb")) {
+        utility::LogError("Write hash map failed: unable to open file {}.",
+                          file_name);
+    }
+    FILE* fp = file.GetFILE();
+    bool success = fwrite(header.data(), 1, header.size(), fp) == header.size();
+    int64_t offset = int64_t(header.size());
+    const std::vector<char> padding(kO3DHashAlignment, 0);
+    for (const core::Tensor& array : arrays) {
+        const int64_t padding_size = AlignO3DHash(offset) - offset;
+        const size_t num_bytes =
+                array.NumElements() * array.GetDtype().ByteSize();
+        success = success &&
+                  fwrite(padding.data(), 1, padding_size, fp) ==
+                          size_t(padding_size) &&
+                  fwrite(array.GetDataPtr(), 1, num_bytes, fp) == num_bytes;
+        offset += padding_size + int64_t(num_bytes);
+    }
+    if (!success) {
+        utility::LogError("Write hash map failed: unable to write file {}.",
+                          file_name);
+    }
+}
+
+core::HashMap ReadHashMapFromO3DHash(const std::string& file_name,
+                                     const core::Device& device,
+                                     const core::HashBackendType& backend) {
+    utility::filesystem::CFile file;
+    if (!file.Open(file_name, "rb")) {
+        utility::LogError("Read hash map failed: unable to open file {}.",
+                          file_name);
+    }
+    char magic[sizeof(kO3DHashMagic)];
+    if (file.ReadData(magic, 1, sizeof(magic)) != sizeof(magic) ||
+        std::memcmp(magic, kO3DHashMagic, sizeof(magic)) != 0) {
+        utility::LogError("Read hash map failed: {} is not a .o3dhash file.",
+                          file_name);
+    }
+    const uint32_t version = Get<uint32_t>(file);
+    if (version != kO3DHashVersion) {
+        utility::LogError("Read hash map failed: unsupported version {}.",
+                          version);
+    }
+    const uint32_t num_values = Get<uint32_t>(file);
+    const int64_t size = int64_t(Get<uint64_t>(file));
+    const int64_t capacity = int64_t(Get<uint64_t>(file));
+    const int64_t data_offset = int64_t(Get<uint64_t>(file));
+
+    std::vector<core::Dtype> dtypes(num_values + 1);
+    std::vector<core::SizeVector> element_shapes(num_values + 1);
+    std::vector<int64_t> offsets(num_values + 1);
+    int64_t data_size = 0;
+    for (uint32_t i = 0; i <= num_values; ++i) {
+        GetArrayType(file, dtypes[i], element_shapes[i]);
+        offsets[i] = AlignO3DHash(data_size);
+        data_size = offsets[i] + size * element_shapes[i].NumElements() *
+                                         dtypes[i].ByteSize();
+    }
+    if (file.CurPos() > data_offset ||
+        data_offset + data_size > file.GetFileSize()) {
+        utility::LogError("Read hash map failed: {} is truncated.", file_name);
+    }
+    file.Close();
+
+    // The keys and values are views of the mapped file, copied once to the
+    // hash map's buffers, or first to the device.
+    std::shared_ptr<core::Blob> blob;
+    if (data_size > 0) {
+        blob = MapFileRegion(file_name, data_offset, data_size);
+    }
+    std::vector<core::Tensor> arrays;
+    for (uint32_t i = 0; i <= num_values; ++i) {
+        core::SizeVector shape{size};
+        shape.insert(shape.end(), element_shapes[i].begin(),
+                     element_shapes[i].end());
+        if (blob) {
+            arrays.emplace_back(
+                    shape, core::shape_util::DefaultStrides(shape),
+                    static_cast<char*>(blob->GetDataPtr()) + offsets[i],
+                    dtypes[i], blob);
+            arrays.back() = arrays.back().To(device);
+        } else {
+            arrays.emplace_back(shape, dtypes[i], device);
+        }
+    }
+
+    const core::Tensor keys = arrays[0];
+    const std::vector<core::Tensor> values(arrays.begin() + 1, arrays.end());
+    core::HashMap hashmap(std::max(capacity, std::max(size, int64_t(1))),
+                          dtypes[0], element_shapes[0],
+                          std::vector<core::Dtype>(dtypes.begin() + 1,
+                                                   dtypes.end()),
+                          std::vector<core::SizeVector>(
+                                  element_shapes.begin() + 1,
+                                  element_shapes.end()),
+                          device, backend);
+    if (size > 0) {
+        core::Tensor masks, buf_indices;
+        hashmap.Insert(keys, values, buf_indices, masks);
+    }
+    return hashmap;
+}
+
+void WriteHashMapToNpz(const std::string& file_name,
+                       const core::HashMap& hashmap) {
     core::Tensor keys = hashmap.GetKeyTensor();
     std::vector<core::Tensor> values = hashmap.GetValueTensors();
 
@@ -63,12 +288,14 @@ void WriteHashMap(const std::string& file_name, const core::HashMap& hashmap) {
     WriteNpz(file_name + postfix, output);
 }
 
-core::HashMap ReadHashMap(const std::string& file_name) {
+core::HashMap ReadHashMapFromNpz(const std::string& file_name,
+                                 const core::Device& device,
+                                 const core::HashBackendType& backend) {
     std::unordered_map<std::string, core::Tensor> tensor_map =
             t::io::ReadNpz(file_name);
 
     // Key
-    core::Tensor keys = tensor_map.at("key");
+    core::Tensor keys = tensor_map.at("key").To(device);
 
     core::Dtype key_dtype = keys.GetDtype();
 
@@ -93,20 +320,41 @@ core::HashMap ReadHashMap(const std::string& file_name) {
         core::SizeVector value_element_shape_i(shape_value_i.begin() + 1,
                                                shape_value_i.end());
 
-        arr_input_values.push_back(value_i);
+        arr_input_values.push_back(value_i.To(device));
         dtypes_value.push_back(value_dtype_i);
         element_shapes_value.push_back(value_element_shape_i);
     }
 
-    auto hashmap =
-            core::HashMap(init_capacity, key_dtype, key_element_shape,
-                          dtypes_value, element_shapes_value, core::Device());
+    auto hashmap = core::HashMap(init_capacity, key_dtype, key_element_shape,
+                                 dtypes_value, element_shapes_value, device,
+                                 backend);
 
     core::Tensor masks, buf_indices;
     hashmap.Insert(keys, arr_input_values, masks, buf_indices);
 
     return hashmap;
 }
+}  // namespace
+
+void WriteHashMap(const std::string& file_name, const core::HashMap& hashmap) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(file_name) ==
+        "o3dhash") {
+        WriteHashMapToO3DHash(file_name, hashmap);
+    } else {
+        WriteHashMapToNpz(file_name, hashmap);
+    }
+}
+
+core::HashMap ReadHashMap(const std::string& file_name,
+                          const core::Device& device,
+                          const core::HashBackendType& backend) {
+    if (utility::filesystem::GetFileExtensionInLowerCase(file_name) ==
+        "o3dhash") {
+        return ReadHashMapFromO3DHash(file_name, device, backend);
+    }
+    return ReadHashMapFromNpz(file_name, device, backend);
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
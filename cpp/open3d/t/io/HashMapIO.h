@@ -35,15 +35,30 @@ namespace open3d {
 namespace t {
 namespace io {
 
-/// Read a hash map's keys and values from a npz file at 'key' and 'value'.
-/// Return a hash map on CPU.
+/// Read a hash map's keys and values from a file written by WriteHashMap().
 ///
-/// \param filename The npz file name to read from.
-core::HashMap ReadHashMap(const std::string& filename);
+/// A .o3dhash file is memory-mapped and its keys and values are inserted on
+/// \p device in one batch, without intermediate copies on the host. Any
+/// other file is read as npz with the keys at 'key' and the values at
+/// 'value_{:03d}'. The loaded hash map keeps the saved capacity when it is
+/// known.
+///
+/// \param filename The .o3dhash or npz file name to read from.
+/// \param device Device of the returned hash map.
+/// \param backend Backend of the returned hash map.
+core::HashMap ReadHashMap(
+        const std::string& filename,
+        const core::Device& device = core::Device("CPU:0"),
+        const core::HashBackendType& backend = core::HashBackendType::Default);
 
-/// Save a hash map's keys and values to a npz file at 'key' and 'value'.
+/// Save a hash map's keys and values.
+///
+/// A file name ending with .o3dhash is written in a raw binary layout that
+/// ReadHashMap() maps into memory. Otherwise the keys and values are saved
+/// to a npz file at 'key' and 'value_{:03d}', and '.npz' is appended to the
+/// file name if needed.
 ///
-/// \param filename The npz file name to write to.
+/// \param filename The file name to write to.
 /// \param hashmap HashMap to save.
 void WriteHashMap(const std::string& filename, const core::HashMap& hashmap);
 
@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageReader.h"
+
+#include <algorithm>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+ImageReader::~ImageReader() { Close(); }
+
+bool ImageReader::Open(const std::vector<std::string> &filenames,
+                       const core::Device &device,
+                       int num_threads,
+                       int prefetch) {
+    Close();
+    if (filenames.empty()) {
+        utility::LogWarning("Open image sequence failed: no file names.");
+        return false;
+    }
+    if (num_threads <= 0) {
+        num_threads = utility::EstimateMaxThreads();
+    }
+    num_threads = std::max(
+            1, std::min(num_threads, static_cast<int>(filenames.size())));
+    if (prefetch <= 0) {
+        prefetch = 2 * num_threads;
+    }
+    // Fewer slots than threads would leave threads idle.
+    prefetch = std::max(prefetch, num_threads);
+
+    filenames_ = filenames;
+    device_ = device;
+    slots_ = std::vector<Slot>(prefetch);
+    next_read_ = 0;
+    next_decode_ = 0;
+    stop_ = false;
+    for (int i = 0; i < num_threads; ++i) {
+        workers_.emplace_back(&ImageReader::DecodeLoop, this);
+    }
+    return true;
+}
+
+void ImageReader::Close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    slot_free_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+    slots_.clear();
+    filenames_.clear();
+    next_read_ = 0;
+    next_decode_ = 0;
+}
+
+bool ImageReader::IsEOF() const {
+    return !IsOpened() || next_read_ >= GetNumImages();
+}
+
+bool ImageReader::ReadNext(geometry::Image &image) {
+    if (IsEOF()) {
+        image = geometry::Image();
+        return false;
+    }
+    bool success;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        Slot &slot = slots_[next_read_ % slots_.size()];
+        slot_ready_.wait(lock, [&slot] { return slot.ready; });
+        success = slot.success;
+        image = std::move(slot.image);
+        slot = Slot();
+        ++next_read_;
+    }
+    slot_free_.notify_all();
+    if (!success) {
+        image = geometry::Image();
+    }
+    return success;
+}
+
+void ImageReader::DecodeLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        // Image i goes into the slot of image i - slots_.size(), which must
+        // have been returned already.
+        slot_free_.wait(lock, [this] {
+            return stop_ || next_decode_ >= GetNumImages() ||
+                   next_decode_ < next_read_ + int64_t(slots_.size());
+        });
+        if (stop_ || next_decode_ >= GetNumImages()) {
+            return;
+        }
+        const int64_t index = next_decode_++;
+        lock.unlock();
+
+        geometry::Image image;
+        bool success = false;
+        try {
+            success = ReadImage(filenames_[index], image);
+            if (success && image.GetDevice() != device_) {
+                image = image.To(device_);
+            }
+        } catch (const std::exception &e) {
+            utility::LogWarning("Read image {} failed with exception: {}",
+                                filenames_[index], e.what());
+            success = false;
+        }
+
+        lock.lock();
+        Slot &slot = slots_[index % slots_.size()];
+        slot.image = std::move(image);
+        slot.success = success;
+        slot.ready = true;
+        slot_ready_.notify_all();
+    }
+}
+
+std::string ImageReader::ToString() const {
+    if (IsOpened()) {
+        return fmt::format("ImageReader reading {} images on {}, at image {}",
+                           GetNumImages(), device_.ToString(), next_read_);
+    } else {
+        return "ImageReader: No open sequence.";
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
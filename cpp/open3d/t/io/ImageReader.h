@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/Image.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class ImageReader
+///
+/// \brief Reads a sequence of image files, e.g. the color or depth frames of
+/// an RGB-D dataset, ahead of the caller.
+///
+/// A pool of threads decodes the next images with ReadImage() and moves them
+/// to the target device, so that decoding and the host to device copy of a
+/// frame overlap with the processing of the previous ones. Images are
+/// returned in the order of the file names.
+class ImageReader {
+public:
+    ImageReader() {}
+    ~ImageReader();
+
+    /// Start reading a sequence of images.
+    ///
+    /// \param filenames Paths of the images, in reading order.
+    /// \param device Device of the returned images.
+    /// \param num_threads Number of decoding threads, 0 for one per core.
+    /// \param prefetch Maximum number of images decoded ahead of ReadNext(),
+    /// 0 for twice the number of threads.
+    bool Open(const std::vector<std::string> &filenames,
+              const core::Device &device = core::Device("CPU:0"),
+              int num_threads = 0,
+              int prefetch = 0);
+
+    /// Stop reading. Images being decoded are discarded.
+    void Close();
+
+    /// Check if a sequence is opened.
+    bool IsOpened() const { return !workers_.empty(); }
+
+    /// Check if all images of the sequence have been returned.
+    bool IsEOF() const;
+
+    /// Number of images in the sequence.
+    int64_t GetNumImages() const { return int64_t(filenames_.size()); }
+
+    /// Number of images returned by ReadNext() so far.
+    int64_t GetNumImagesRead() const { return next_read_; }
+
+    /// \brief Read the next image of the sequence, waiting for it to be
+    /// decoded if needed.
+    ///
+    /// \return false and an empty \p image after the last image or if the
+    /// image could not be read. Reading continues with the following image.
+    bool ReadNext(geometry::Image &image);
+
+    /// Text description.
+    std::string ToString() const;
+
+private:
+    struct Slot {
+        bool ready = false;
+        bool success = false;
+        geometry::Image image;
+    };
+
+    void DecodeLoop();
+
+    std::vector<std::string> filenames_;
+    core::Device device_;
+    std::vector<std::thread> workers_;
+    /// Ring of prefetch slots, image i is decoded into slot i % size.
+    std::vector<Slot> slots_;
+    int64_t next_read_ = 0;
+    int64_t next_decode_ = 0;
+    bool stop_ = false;
+    std::mutex mutex_;
+    /// Signals free slots to the workers.
+    std::condition_variable slot_free_;
+    /// Signals decoded images to ReadNext().
+    std::condition_variable slot_ready_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/MappedFile.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include "open3d/utility/Logging.h"
+
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace open3d {
+namespace t {
+namespace io {
+
+std::shared_ptr<core::Blob> MapFileRegion(const std::string& file_name,
+                                          int64_t offset,
+                                          int64_t num_bytes) {
+#ifdef WINDOWS
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    const int64_t granularity = system_info.dwAllocationGranularity;
+#else
+    const int64_t granularity = sysconf(_SC_PAGESIZE);
+#endif
+    // The mapping offset must be a multiple of the granularity.
+    const int64_t map_offset = offset / granularity * granularity;
+    const size_t map_len = static_cast<size_t>(offset - map_offset + num_bytes);
+
+#ifdef WINDOWS
+    HANDLE file = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        utility::LogError("Failed to open file {}, error: {}.", file_name,
+                          GetLastError());
+    }
+    HANDLE mapping =
+            CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        utility::LogError("Failed to map file {}, error: {}.", file_name,
+                          GetLastError());
+    }
+    void* base = MapViewOfFile(mapping, FILE_MAP_COPY,
+                               static_cast<DWORD>(map_offset >> 32),
+                               static_cast<DWORD>(map_offset & 0xFFFFFFFF),
+                               map_len);
+    // The view keeps the mapping object alive.
+    CloseHandle(mapping);
+    if (base == nullptr) {
+        utility::LogError("Failed to map file {}, error: {}.", file_name,
+                          GetLastError());
+    }
+    auto deleter = [base](void*) { UnmapViewOfFile(base); };
+#else
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        utility::LogError("Failed to open file {}, error: {}.", file_name,
+                          std::strerror(errno));
+    }
+    void* base = mmap(nullptr, map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                      static_cast<off_t>(map_offset));
+    const int mmap_errno = errno;
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+    if (base == MAP_FAILED) {
+        utility::LogError("Failed to map file {}, error: {}.", file_name,
+                          std::strerror(mmap_errno));
+    }
+    auto deleter = [base, map_len](void*) { munmap(base, map_len); };
+#endif
+    return std::make_shared<core::Blob>(
+            core::Device("CPU:0"),
+            static_cast<char*>(base) + (offset - map_offset), deleter);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -52,6 +52,7 @@
 
 #include <zlib.h>
 
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <regex>
@@ -63,6 +64,7 @@
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
+#include "open3d/t/io/MappedFile.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
@@ -158,6 +160,7 @@ static char DtypeToChar(const core::Dtype& dtype) {
     // 'c': std::complex<float>, std::complex<double>),
     //      std::complex<long double>)
     // '?': object
+    if (dtype == core::Float16) return 'f';
     if (dtype == core::Float32) return 'f';
     if (dtype == core::Float64) return 'f';
     if (dtype == core::Int8) return 'i';
@@ -376,6 +379,37 @@ static std::tuple<size_t, size_t, size_t> ParseZipFooter(FILE* fp) {
                            global_header_offset);
 }
 
+// Returns {nrecs, global_header_size, global_header_offset} from the Zip64 end
+// of central directory record, which is used when the standard footer fields
+// overflow, e.g. for archives larger than 4GiB.
+static std::tuple<size_t, size_t, size_t> ParseZip64Footer(FILE* fp) {
+    // The 20 byte Zip64 locator directly precedes the 22 byte footer.
+    const size_t locator_len = 20;
+    CharVector locator(locator_len);
+    fseek(fp, -static_cast<int64_t>(locator_len + 22), SEEK_END);
+    if (fread(locator.Data(), sizeof(char), locator_len, fp) != locator_len ||
+        *reinterpret_cast<uint32_t*>(&locator[0]) != 0x07064b50) {
+        utility::LogError("Failed to read Zip64 footer locator.");
+    }
+    const uint64_t record_offset = *reinterpret_cast<uint64_t*>(&locator[8]);
+
+    const size_t record_len = 56;
+    CharVector record(record_len);
+    fseek(fp, static_cast<int64_t>(record_offset), SEEK_SET);
+    if (fread(record.Data(), sizeof(char), record_len, fp) != record_len ||
+        *reinterpret_cast<uint32_t*>(&record[0]) != 0x06064b50) {
+        utility::LogError("Failed to read Zip64 footer.");
+    }
+    // clang-format off
+    uint64_t nrecs                = *reinterpret_cast<uint64_t*>(&record[32]);
+    uint64_t global_header_size   = *reinterpret_cast<uint64_t*>(&record[40]);
+    uint64_t global_header_offset = *reinterpret_cast<uint64_t*>(&record[48]);
+    // clang-format on
+    return std::make_tuple(static_cast<size_t>(nrecs),
+                           static_cast<size_t>(global_header_size),
+                           static_cast<size_t>(global_header_offset));
+}
+
 static void WriteNpzOneTensor(const std::string& file_name,
                               const std::string& tensor_name,
                               const core::Tensor& tensor,
@@ -532,6 +566,18 @@ public:
         blob_ = std::make_shared<core::Blob>(NumBytes(), core::Device("CPU:0"));
     }
 
+    /// Wraps existing CPU memory, e.g. a memory-mapped file region.
+    NumpyArray(const core::SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<core::Blob>& blob)
+        : blob_(blob),
+          shape_(shape),
+          type_(type),
+          word_size_(word_size),
+          fortran_order_(fortran_order) {}
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -543,6 +589,7 @@ public:
     }
 
     core::Dtype GetDtype() const {
+        if (type_ == 'f' && word_size_ == 2) return core::Float16;
         if (type_ == 'f' && word_size_ == 4) return core::Float32;
         if (type_ == 'f' && word_size_ == 8) return core::Float64;
         if (type_ == 'i' && word_size_ == 1) return core::Int8;
@@ -628,6 +675,30 @@ static NumpyArray CreateNumpyArrayFromFile(FILE* fp) {
     return arr;
 }
 
+// Parses the header at the current position of the opened file and maps the
+// array data that follows it.
+static NumpyArray CreateNumpyArrayFromMappedFile(
+        utility::filesystem::CFile& cfile, const std::string& file_name) {
+    core::SizeVector shape;
+    char type;
+    int64_t word_size;
+    bool fortran_order;
+    std::tie(shape, type, word_size, fortran_order) =
+            ParseNpyHeaderFromFile(cfile.GetFILE());
+
+    const int64_t num_bytes = shape.NumElements() * word_size;
+    if (num_bytes == 0) {
+        // Empty mappings are not allowed.
+        return NumpyArray(shape, type, word_size, fortran_order);
+    }
+    const int64_t offset = cfile.CurPos();
+    if (offset + num_bytes > cfile.GetFileSize()) {
+        utility::LogError("Failed to read array data.");
+    }
+    return NumpyArray(shape, type, word_size, fortran_order,
+                      MapFileRegion(file_name, offset, num_bytes));
+}
+
 static NumpyArray CreateNumpyArrayFromCompressedFile(
         FILE* fp,
         uint32_t num_compressed_bytes,
@@ -678,12 +749,15 @@ static NumpyArray CreateNumpyArrayFromCompressedFile(
     return array;
 }
 
-core::Tensor ReadNpy(const std::string& file_name) {
+core::Tensor ReadNpy(const std::string& file_name, bool use_mmap) {
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
                           cfile.GetError());
     }
+    if (use_mmap) {
+        return CreateNumpyArrayFromMappedFile(cfile, file_name).ToTensor();
+    }
     return CreateNumpyArrayFromFile(cfile.GetFILE()).ToTensor();
 }
 
@@ -691,8 +765,8 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor) {
     NumpyArray(tensor).Save(file_name);
 }
 
-std::unordered_map<std::string, core::Tensor> ReadNpz(
-        const std::string& file_name) {
+NpzFile::NpzFile(const std::string& file_name, bool use_mmap)
+    : file_name_(file_name), use_mmap_(use_mmap) {
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
@@ -700,78 +774,139 @@ std::unordered_map<std::string, core::Tensor> ReadNpz(
     }
     FILE* fp = cfile.GetFILE();
 
-    std::unordered_map<std::string, core::Tensor> tensor_map;
-
-    // It's possible to check tensor_name and only one selected numpy array,
-    // here we load all of them.
-    while (true) {
-        CharVector local_header(30);
-        size_t local_header_bytes =
-                fread(local_header.Data(), sizeof(char), 30, fp);
-
-        // An empty zip file has exactly 22 bytes.
-        if (local_header_bytes == 22) {
-            const char empty_zip_bytes[22] = {
-                    0x50, 0x4b, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
-                    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-                    0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-            if (std::memcmp(empty_zip_bytes, local_header.Data(), 22) == 0) {
-                break;
-            } else {
-                utility::LogError("Inalid empty .npz file.");
-            }
-        }
+    size_t nrecs;
+    size_t global_header_size;
+    size_t global_header_offset;
+    std::tie(nrecs, global_header_size, global_header_offset) =
+            ParseZipFooter(fp);
+    if (nrecs == 0xFFFF || global_header_size == 0xFFFFFFFF ||
+        global_header_offset == 0xFFFFFFFF) {
+        std::tie(nrecs, global_header_size, global_header_offset) =
+                ParseZip64Footer(fp);
+    }
 
-        if (local_header_bytes != 30) {
-            utility::LogError("Failed to read local header in npz.");
-        }
+    CharVector global_header(global_header_size);
+    fseek(fp, static_cast<int64_t>(global_header_offset), SEEK_SET);
+    if (fread(global_header.Data(), sizeof(char), global_header_size, fp) !=
+        global_header_size) {
+        utility::LogError("Failed to read global header in npz.");
+    }
 
-        // If we've reached the global header, stop reading.
-        if (local_header[2] != 0x03 || local_header[3] != 0x04) {
-            break;
+    // Each central directory record is 46 bytes followed by the name, the
+    // extra field and the comment.
+    size_t pos = 0;
+    for (size_t i = 0; i < nrecs; ++i) {
+        if (pos + 46 > global_header_size ||
+            *reinterpret_cast<uint32_t*>(&global_header[pos]) != 0x02014b50) {
+            utility::LogError("Invalid central directory record in npz.");
         }
-
-        // Read tensor name.
-        uint16_t tensor_name_len =
-                *reinterpret_cast<uint16_t*>(&local_header[26]);
-        CharVector tensor_name_buf(tensor_name_len, ' ');
-        if (fread(tensor_name_buf.Data(), sizeof(char), tensor_name_len, fp) !=
-            tensor_name_len) {
-            utility::LogError("Failed to read tensor name in npz.");
+        const char* record = global_header.Data() + pos;
+        Member member;
+        member.compression_method =
+                *reinterpret_cast<const uint16_t*>(record + 10);
+        member.num_compressed_bytes =
+                *reinterpret_cast<const uint32_t*>(record + 20);
+        member.num_uncompressed_bytes =
+                *reinterpret_cast<const uint32_t*>(record + 24);
+        uint16_t name_len = *reinterpret_cast<const uint16_t*>(record + 28);
+        uint16_t extra_len = *reinterpret_cast<const uint16_t*>(record + 30);
+        uint16_t comment_len = *reinterpret_cast<const uint16_t*>(record + 32);
+        member.local_header_offset =
+                *reinterpret_cast<const uint32_t*>(record + 42);
+
+        std::string name(record + 46, name_len);
+        if (name.size() > 4 && name.substr(name.size() - 4) == ".npy") {
+            name.erase(name.size() - 4);
         }
 
-        // Erase the trailing ".npy".
-        std::string tensor_name(tensor_name_buf.Begin(), tensor_name_buf.End());
-        tensor_name.erase(tensor_name.end() - 4, tensor_name.end());
-
-        // Read extra field.
-        uint16_t extra_field_len =
-                *reinterpret_cast<uint16_t*>(&local_header[28]);
-        if (extra_field_len > 0) {
-            CharVector buff(extra_field_len);
-            if (fread(buff.Data(), sizeof(char), extra_field_len, fp) !=
-                extra_field_len) {
-                utility::LogError("Failed to read extra field in npz.");
+        // Overflowing fields are stored in the Zip64 extra field, in this
+        // order and only if overflowing.
+        size_t extra_pos = pos + 46 + name_len;
+        const size_t extra_end = extra_pos + extra_len;
+        while (extra_pos + 4 <= extra_end) {
+            const uint16_t id =
+                    *reinterpret_cast<uint16_t*>(&global_header[extra_pos]);
+            const uint16_t size =
+                    *reinterpret_cast<uint16_t*>(&global_header[extra_pos + 2]);
+            if (id == 0x0001) {
+                size_t field = extra_pos + 4;
+                for (int64_t* value : {&member.num_uncompressed_bytes,
+                                       &member.num_compressed_bytes,
+                                       &member.local_header_offset}) {
+                    if (*value == 0xFFFFFFFF && field + 8 <= extra_end) {
+                        *value = static_cast<int64_t>(
+                                *reinterpret_cast<uint64_t*>(
+                                        &global_header[field]));
+                        field += 8;
+                    }
+                }
             }
+            extra_pos += 4 + size;
         }
 
-        uint16_t compressed_method =
-                *reinterpret_cast<uint16_t*>(&local_header[8]);
-        uint32_t num_compressed_bytes =
-                *reinterpret_cast<uint32_t*>(&local_header[18]);
-        uint32_t num_uncompressed_bytes =
-                *reinterpret_cast<uint32_t*>(&local_header[22]);
+        keys_.push_back(name);
+        members_[name] = member;
+        pos += 46 + name_len + extra_len + comment_len;
+    }
+}
 
-        if (compressed_method == 0) {
-            tensor_map[tensor_name] = CreateNumpyArrayFromFile(fp).ToTensor();
-        } else {
-            tensor_map[tensor_name] =
-                    CreateNumpyArrayFromCompressedFile(fp, num_compressed_bytes,
-                                                       num_uncompressed_bytes)
-                            .ToTensor();
+bool NpzFile::Contains(const std::string& key) const {
+    return members_.count(key) != 0;
+}
+
+core::Tensor NpzFile::Get(const std::string& key) const {
+    auto it = members_.find(key);
+    if (it == members_.end()) {
+        utility::LogError("Array {} not found in {}.", key, file_name_);
+    }
+    const Member& member = it->second;
+
+    utility::filesystem::CFile cfile;
+    if (!cfile.Open(file_name_, "rb")) {
+        utility::LogError("Failed to open file {}, error: {}.", file_name_,
+                          cfile.GetError());
+    }
+    FILE* fp = cfile.GetFILE();
+
+    // The local header may have a different extra field than the central
+    // directory record, so its lengths are read again.
+    CharVector local_header(30);
+    fseek(fp, member.local_header_offset, SEEK_SET);
+    if (fread(local_header.Data(), sizeof(char), 30, fp) != 30 ||
+        local_header[2] != 0x03 || local_header[3] != 0x04) {
+        utility::LogError("Failed to read local header in npz.");
+    }
+    uint16_t name_len = *reinterpret_cast<uint16_t*>(&local_header[26]);
+    uint16_t extra_len = *reinterpret_cast<uint16_t*>(&local_header[28]);
+    fseek(fp, name_len + extra_len, SEEK_CUR);
+
+    if (member.compression_method == 0) {
+        if (use_mmap_) {
+            return CreateNumpyArrayFromMappedFile(cfile, file_name_)
+                    .ToTensor();
         }
+        return CreateNumpyArrayFromFile(fp).ToTensor();
     }
+    if (member.num_compressed_bytes > 0xFFFFFFFF ||
+        member.num_uncompressed_bytes > 0xFFFFFFFF) {
+        utility::LogError(
+                "Compressed arrays larger than 4GiB are not supported.");
+    }
+    return CreateNumpyArrayFromCompressedFile(
+                   fp, static_cast<uint32_t>(member.num_compressed_bytes),
+                   static_cast<uint32_t>(member.num_uncompressed_bytes))
+            .ToTensor();
+}
 
+std::unordered_map<std::string, core::Tensor> ReadNpz(
+        const std::string& file_name) {
+    // Sizes are taken from the central directory, since Zip64 local headers,
+    // as written by np.savez, store placeholders instead.
+    NpzFile npz(file_name);
+    std::unordered_map<std::string, core::Tensor> tensor_map;
+    for (const std::string& key : npz.GetKeys()) {
+        tensor_map[key] = npz.Get(key);
+    }
     return tensor_map;
 }
 
@@ -28,6 +28,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 
@@ -38,7 +39,10 @@ namespace io {
 /// Read Numpy .npy file to a tensor.
 ///
 /// \param file_name The file name to read from.
-core::Tensor ReadNpy(const std::string& file_name);
+/// \param use_mmap If true, the file is memory-mapped copy-on-write instead of
+/// read into memory. Data pages are loaded on first access and writes to the
+/// tensor are not written back to the file.
+core::Tensor ReadNpy(const std::string& file_name, bool use_mmap = false);
 
 /// Save a tensor to a Numpy .npy file.
 ///
@@ -52,6 +56,38 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor);
 std::unordered_map<std::string, core::Tensor> ReadNpz(
         const std::string& file_name);
 
+/// Reads the arrays of a Numpy .npz file on demand. Only the zip central
+/// directory is read when the file is opened.
+class NpzFile {
+public:
+    /// \param file_name The file name to read from.
+    /// \param use_mmap If true, uncompressed arrays are memory-mapped
+    /// copy-on-write, see ReadNpy(). Compressed arrays are always inflated
+    /// into memory.
+    explicit NpzFile(const std::string& file_name, bool use_mmap = false);
+
+    /// Returns the array names in the order they are stored.
+    const std::vector<std::string>& GetKeys() const { return keys_; }
+
+    bool Contains(const std::string& key) const;
+
+    /// Reads the array \p key from the file.
+    core::Tensor Get(const std::string& key) const;
+
+private:
+    struct Member {
+        int64_t local_header_offset;
+        uint16_t compression_method;
+        int64_t num_compressed_bytes;
+        int64_t num_uncompressed_bytes;
+    };
+
+    std::string file_name_;
+    bool use_mmap_;
+    std::vector<std::string> keys_;
+    std::unordered_map<std::string, Member> members_;
+};
+
 /// Save a string to tensor map as Numpy .npz file.
 ///
 /// \param file_name The file name to write to.
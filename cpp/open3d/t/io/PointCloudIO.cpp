@@ -34,6 +34,7 @@
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -51,6 +52,9 @@ static const std::unordered_map<
                 {"pcd", ReadPointCloudFromPCD},
                 {"ply", ReadPointCloudFromPLY},
                 {"pts", ReadPointCloudFromPTS},
+                {"las", ReadPointCloudFromLAS},
+                {"laz", ReadPointCloudFromLAS},
+                {"o3dpc", ReadPointCloudFromO3DPC},
         };
 
 static const std::unordered_map<
@@ -61,7 +65,8 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"npz", WritePointCloudToNPZ}, {"xyzi", WritePointCloudToXYZI},
                 {"pcd", WritePointCloudToPCD}, {"ply", WritePointCloudToPLY},
-                {"pts", WritePointCloudToPTS},
+                {"pts", WritePointCloudToPTS}, {"las", WritePointCloudToLAS},
+                {"o3dpc", WritePointCloudToO3DPC},
         };
 
 std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
@@ -76,6 +81,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const open3d::io::ReadPointCloudOption &params) {
+    OPEN3D_PROFILE_ZONE("io", "ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
@@ -140,6 +146,7 @@ bool ReadPointCloud(const std::string &filename,
 bool WritePointCloud(const std::string &filename,
                      const geometry::PointCloud &pointcloud,
                      const open3d::io::WritePointCloudOption &params) {
+    OPEN3D_PROFILE_ZONE("io", "WritePointCloud");
     std::string format =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     auto map_itr = file_extension_to_pointcloud_write_function.find(format);
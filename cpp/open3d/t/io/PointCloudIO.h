@@ -26,7 +26,10 @@
 
 #pragma once
 
+#include <Eigen/Core>
+#include <limits>
 #include <string>
+#include <vector>
 
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -101,6 +104,101 @@ bool WritePointCloudToPTS(const std::string &filename,
                           const geometry::PointCloud &pointcloud,
                           const WritePointCloudOption &params);
 
+/// \struct LASReadFilter
+/// \brief Filters applied to the point records of a LAS file while they are
+/// decoded. Rejected points are never stored.
+struct LASReadFilter {
+    /// Keep only points inside the box [min_bound, max_bound].
+    Eigen::Vector3d min_bound =
+            Eigen::Vector3d::Constant(-std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
+    /// Keep only points of these classes. Empty keeps all classes.
+    std::vector<uint8_t> classifications;
+    /// Keep only points with these return numbers, e.g. {1} for first
+    /// returns. Empty keeps all returns.
+    std::vector<uint8_t> return_numbers;
+    /// Number of point records read and decoded at a time.
+    int64_t chunk_size = 1 << 16;
+};
+
+/// Read the uncompressed point records of a LAS 1.0 - 1.4 file (point data
+/// formats 0 - 10). Positions are Float64 in world coordinates. The
+/// attributes "intensities" (UInt16), "classification", "return_number",
+/// "number_of_returns" (UInt8) and, if the point format has them,
+/// "gps_time" (Float64) and "colors" (UInt16) are all of shape (N, 1), except
+/// for colors (N, 3). Records are streamed in chunks of
+/// \p filter.chunk_size and \p filter is applied before they are stored.
+bool ReadPointCloudFromLASWithFilter(const std::string &filename,
+                                     geometry::PointCloud &pointcloud,
+                                     const LASReadFilter &filter,
+                                     const ReadPointCloudOption &params = {});
+
+/// ReadPointCloudFromLASWithFilter() without filters, the reader registered
+/// for the "las" and "laz" extensions. LAZ compressed point records are not
+/// supported.
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params);
+
+/// Write a LAS 1.2 file with point data format 0 - 3, depending on whether
+/// \p pointcloud has "gps_time" and colors. The attributes read by
+/// ReadPointCloudFromLAS are written if present. The scale of each axis is
+/// the smallest power of ten for which the extent of the points fits the 32
+/// bit integer coordinates.
+bool WritePointCloudToLAS(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params);
+
+/// \struct O3DPCReadFilter
+/// \brief Attribute and bounding box pushdown for reading an Open3D columnar
+/// point cloud (.o3dpc) file. Attributes and chunks that are not needed are
+/// never read from the file.
+struct O3DPCReadFilter {
+    /// Names of the point attributes to read. "positions" is always read.
+    /// Empty reads all attributes.
+    std::vector<std::string> attributes;
+    /// Keep only points inside the box [min_bound, max_bound]. Chunks whose
+    /// bounds are outside the box are skipped, chunks whose bounds are inside
+    /// it are taken as a whole.
+    Eigen::Vector3d min_bound =
+            Eigen::Vector3d::Constant(-std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound =
+            Eigen::Vector3d::Constant(std::numeric_limits<double>::infinity());
+};
+
+/// Read an Open3D columnar point cloud file. The file stores each attribute
+/// of each chunk of points as a separate, optionally LZF compressed block,
+/// together with the per channel minimum and maximum of the block, so that
+/// \p filter is applied without touching the skipped parts of the file.
+bool ReadPointCloudFromO3DPCWithFilter(const std::string &filename,
+                                       geometry::PointCloud &pointcloud,
+                                       const O3DPCReadFilter &filter,
+                                       const ReadPointCloudOption &params = {});
+
+/// ReadPointCloudFromO3DPCWithFilter() without filters, the reader registered
+/// for the "o3dpc" extension.
+bool ReadPointCloudFromO3DPC(const std::string &filename,
+                             geometry::PointCloud &pointcloud,
+                             const ReadPointCloudOption &params);
+
+/// Write all point attributes of \p pointcloud to an Open3D columnar point
+/// cloud file in chunks of \p chunk_size points. The blocks are LZF
+/// compressed if \p params.compressed is set. Chunk bounds only help
+/// ReadPointCloudFromO3DPCWithFilter() if the point order is spatially
+/// coherent, e.g. scan order.
+bool WritePointCloudToO3DPCWithChunkSize(
+        const std::string &filename,
+        const geometry::PointCloud &pointcloud,
+        int64_t chunk_size,
+        const WritePointCloudOption &params = {});
+
+/// WritePointCloudToO3DPCWithChunkSize() with chunks of 65536 points, the
+/// writer registered for the "o3dpc" extension.
+bool WritePointCloudToO3DPC(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            const WritePointCloudOption &params);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
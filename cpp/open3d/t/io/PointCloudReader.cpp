@@ -0,0 +1,310 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/t/io/NumpyIO.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// Return the points [begin, end) of \p pointcloud, sharing its memory.
+geometry::PointCloud SlicePointCloud(const geometry::PointCloud &pointcloud,
+                                     int64_t begin,
+                                     int64_t end) {
+    geometry::PointCloud sliced(pointcloud.GetDevice());
+    for (const auto &kv : pointcloud.GetPointAttr()) {
+        sliced.SetPointAttr(kv.first, kv.second.Slice(0, begin, end));
+    }
+    return sliced;
+}
+
+/// Returns chunks of a point cloud held by the source. Used for NPZ files,
+/// whose arrays are memory-mapped so that only the pages of the chunks are
+/// loaded, and for the formats that can only be read whole.
+class SlicingPointCloudSource : public PointCloudReader::Source {
+public:
+    explicit SlicingPointCloudSource(const geometry::PointCloud &pointcloud)
+        : pointcloud_(pointcloud) {}
+
+    int64_t GetNumPoints() const override {
+        return pointcloud_.IsEmpty()
+                       ? 0
+                       : pointcloud_.GetPointPositions().GetLength();
+    }
+
+    bool ReadNext(int64_t max_points,
+                  geometry::PointCloud &pointcloud) override {
+        const int64_t end = std::min(position_ + max_points, GetNumPoints());
+        pointcloud.Clear();
+        if (position_ < end) {
+            for (const auto &kv : pointcloud_.GetPointAttr()) {
+                pointcloud.SetPointAttr(
+                        kv.first, kv.second.Slice(0, position_, end).Clone());
+            }
+            position_ = end;
+        }
+        return true;
+    }
+
+private:
+    geometry::PointCloud pointcloud_;
+    int64_t position_ = 0;
+};
+
+/// Streams the lines of the XYZ, XYZN, XYZRGB and XYZI text formats. Lines
+/// that do not start with the expected number of values are skipped, as in
+/// the readers of these formats.
+class XYZPointCloudSource : public PointCloudReader::Source {
+public:
+    /// \param attrs The attribute names and widths of the columns.
+    explicit XYZPointCloudSource(
+            const std::vector<std::pair<std::string, int>> &attrs)
+        : attrs_(attrs), num_columns_(0) {
+        for (const auto &attr : attrs_) {
+            num_columns_ += attr.second;
+        }
+    }
+
+    bool Open(const std::string &filename) {
+        return file_.Open(filename, "r");
+    }
+
+    int64_t GetNumPoints() const override { return -1; }
+
+    bool ReadNext(int64_t max_points,
+                  geometry::PointCloud &pointcloud) override {
+        std::vector<double> values;
+        values.reserve(size_t(std::min<int64_t>(max_points, 1 << 20)) *
+                       num_columns_);
+        std::vector<double> row(num_columns_);
+        int64_t num_points = 0;
+        const char *line;
+        while (num_points < max_points && (line = file_.ReadLine())) {
+            if (open3d::io::ParseDoubles(line, line + std::strlen(line),
+                                         row.data(),
+                                         num_columns_) == num_columns_) {
+                values.insert(values.end(), row.begin(), row.end());
+                ++num_points;
+            }
+        }
+
+        pointcloud.Clear();
+        if (num_points > 0) {
+            const core::Tensor rows(values, {num_points, num_columns_},
+                                    core::Float64);
+            int64_t column = 0;
+            for (const auto &attr : attrs_) {
+                pointcloud.SetPointAttr(
+                        attr.first,
+                        rows.Slice(1, column, column + attr.second)
+                                .Contiguous());
+                column += attr.second;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<std::pair<std::string, int>> attrs_;
+    int num_columns_;
+    utility::filesystem::CFile file_;
+};
+
+}  // namespace
+
+PointCloudReader::~PointCloudReader() { Close(); }
+
+bool PointCloudReader::Open(const std::string &filename,
+                            const std::string &format,
+                            bool prefetch) {
+    Close();
+    const std::string file_format =
+            format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(
+                              filename)
+                    : format;
+    if (!utility::filesystem::FileExists(filename)) {
+        utility::LogWarning("Open point cloud failed: file {} not found.",
+                            filename);
+        return false;
+    }
+
+    static const std::unordered_map<std::string,
+                                    std::vector<std::pair<std::string, int>>>
+            xyz_format_to_attrs{
+                    {"xyz", {{"positions", 3}}},
+                    {"xyzn", {{"positions", 3}, {"normals", 3}}},
+                    {"xyzrgb", {{"positions", 3}, {"colors", 3}}},
+                    {"xyzi", {{"positions", 3}, {"intensities", 1}}},
+            };
+    try {
+        if (file_format == "ply") {
+            source_ = CreatePointCloudSourceFromPLY(filename);
+        } else if (file_format == "pcd") {
+            source_ = CreatePointCloudSourceFromPCD(filename);
+        } else if (xyz_format_to_attrs.count(file_format)) {
+            auto source = std::make_unique<XYZPointCloudSource>(
+                    xyz_format_to_attrs.at(file_format));
+            if (!source->Open(filename)) {
+                utility::LogWarning(
+                        "Open point cloud failed: unable to open file: {}",
+                        filename);
+                return false;
+            }
+            source_ = std::move(source);
+        } else if (file_format == "npz") {
+            const NpzFile npz(filename, /*use_mmap=*/true);
+            std::unordered_map<std::string, core::Tensor> tensor_map;
+            for (const std::string &key : npz.GetKeys()) {
+                tensor_map[key] = npz.Get(key);
+            }
+            source_ = std::make_unique<SlicingPointCloudSource>(
+                    geometry::PointCloud(tensor_map));
+        }
+
+        if (!source_) {
+            utility::LogDebug(
+                    "{} can not be decoded in chunks, reading the whole file.",
+                    filename);
+            geometry::PointCloud pointcloud;
+            if (!ReadPointCloud(filename, pointcloud, {file_format})) {
+                return false;
+            }
+            source_ = std::make_unique<SlicingPointCloudSource>(pointcloud);
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Open point cloud failed with exception: {}",
+                            e.what());
+        source_.reset();
+        return false;
+    }
+
+    filename_ = filename;
+    prefetch_ = prefetch;
+    return true;
+}
+
+void PointCloudReader::Close() {
+    if (prefetched_.valid()) {
+        prefetched_.wait();
+        prefetched_ = {};
+    }
+    source_.reset();
+    filename_.clear();
+    pending_.Clear();
+    eof_ = false;
+    num_points_read_ = 0;
+}
+
+bool PointCloudReader::IsEOF() const {
+    if (!IsOpened()) {
+        return true;
+    }
+    const int64_t num_points = GetNumPoints();
+    return eof_ || (num_points >= 0 && num_points_read_ >= num_points);
+}
+
+int64_t PointCloudReader::GetNumPoints() const {
+    return IsOpened() ? source_->GetNumPoints() : 0;
+}
+
+bool PointCloudReader::ReadNext(int64_t max_points,
+                                geometry::PointCloud &pointcloud) {
+    if (!IsOpened()) {
+        utility::LogError("No open file. Please call Open().");
+    }
+    if (max_points <= 0) {
+        utility::LogError("max_points must be positive, but got {}.",
+                          max_points);
+    }
+
+    pointcloud.Clear();
+    if (pending_.IsEmpty() && !eof_) {
+        bool success;
+        if (prefetched_.valid()) {
+            std::tie(success, pending_) = prefetched_.get();
+        } else {
+            success = source_->ReadNext(max_points, pending_);
+        }
+        if (!success) {
+            utility::LogWarning("Read point cloud failed: unable to decode {}.",
+                                filename_);
+            pending_.Clear();
+            eof_ = true;
+        }
+    }
+    if (pending_.IsEmpty()) {
+        eof_ = true;
+        return false;
+    }
+
+    // A prefetched chunk may be larger than requested.
+    const int64_t num_pending = pending_.GetPointPositions().GetLength();
+    if (num_pending > max_points) {
+        pointcloud = SlicePointCloud(pending_, 0, max_points);
+        pending_ = SlicePointCloud(pending_, max_points, num_pending);
+    } else {
+        pointcloud = pending_;
+        pending_.Clear();
+    }
+    num_points_read_ += pointcloud.GetPointPositions().GetLength();
+
+    if (prefetch_ && pending_.IsEmpty() && !IsEOF()) {
+        Source *source = source_.get();
+        prefetched_ = std::async(std::launch::async, [source, max_points]() {
+            geometry::PointCloud next;
+            const bool success = source->ReadNext(max_points, next);
+            return std::make_pair(success, next);
+        });
+    }
+    return true;
+}
+
+std::string PointCloudReader::ToString() const {
+    if (IsOpened()) {
+        return fmt::format("PointCloudReader reading file {} at point {} / {}",
+                           filename_, num_points_read_, GetNumPoints());
+    } else {
+        return "PointCloudReader: No open file.";
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,130 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class PointCloudReader
+///
+/// \brief Reads a point cloud file chunk by chunk, so that files larger than
+/// memory can be processed piecewise, e.g. downsampled or tiled.
+///
+/// Binary little endian PLY with a fixed vertex layout, ASCII and binary PCD,
+/// XYZ, XYZN, XYZRGB, XYZI and uncompressed NPZ files are decoded one chunk
+/// at a time. Other files, e.g. ASCII PLY or compressed PCD, are read whole by
+/// Open() and then returned in chunks.
+///
+/// With prefetching, the next chunk is decoded on another thread while the
+/// caller processes the current one.
+class PointCloudReader {
+public:
+    /// Decodes the chunks of one file format.
+    class Source {
+    public:
+        virtual ~Source() {}
+
+        /// Total number of points in the file, -1 if not known in advance.
+        virtual int64_t GetNumPoints() const = 0;
+
+        /// Decode the next at most \p max_points points into \p pointcloud,
+        /// which is empty after the last point. Returns false on error.
+        virtual bool ReadNext(int64_t max_points,
+                              geometry::PointCloud &pointcloud) = 0;
+    };
+
+    PointCloudReader() {}
+    ~PointCloudReader();
+
+    /// Open a point cloud file.
+    ///
+    /// \param filename Path to the point cloud file.
+    /// \param format File format, "auto" to use the file extension.
+    /// \param prefetch Decode the next chunk in the background.
+    bool Open(const std::string &filename,
+              const std::string &format = "auto",
+              bool prefetch = false);
+
+    /// Close the opened file.
+    void Close();
+
+    /// Check if a file is opened.
+    bool IsOpened() const { return source_ != nullptr; }
+
+    /// Check if all points of the file have been read.
+    bool IsEOF() const;
+
+    /// Total number of points in the file, -1 if not known in advance.
+    int64_t GetNumPoints() const;
+
+    /// Number of points returned by ReadNext() so far.
+    int64_t GetNumPointsRead() const { return num_points_read_; }
+
+    /// Return the filename being read.
+    std::string GetFilename() const { return filename_; }
+
+    /// \brief Read the next at most \p max_points points.
+    ///
+    /// \return false and an empty \p pointcloud if all points have been read
+    /// or the file could not be decoded.
+    bool ReadNext(int64_t max_points, geometry::PointCloud &pointcloud);
+
+    /// Text description.
+    std::string ToString() const;
+
+private:
+    std::unique_ptr<Source> source_;
+    std::string filename_;
+    bool prefetch_ = false;
+    bool eof_ = false;
+    int64_t num_points_read_ = 0;
+    /// Decoded points not returned yet.
+    geometry::PointCloud pending_;
+    std::future<std::pair<bool, geometry::PointCloud>> prefetched_;
+};
+
+/// Create a Source for a binary little endian PLY file with a fixed vertex
+/// layout, nullptr for other PLY files.
+std::unique_ptr<PointCloudReader::Source> CreatePointCloudSourceFromPLY(
+        const std::string &filename);
+
+/// Create a Source for an ASCII or binary PCD file, nullptr for compressed or
+/// invalid PCD files.
+std::unique_ptr<PointCloudReader::Source> CreatePointCloudSourceFromPCD(
+        const std::string &filename);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
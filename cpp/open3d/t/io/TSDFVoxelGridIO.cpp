@@ -132,10 +132,11 @@ bool ReadTSDFVoxelGrid(const std::string &file_name,
             metadata.attr_dtype_map_, metadata.voxel_size_, metadata.sdf_trunc_,
             metadata.block_resolution_, metadata.block_count_, device);
 
-    std::unordered_map<std::string, core::Tensor> tensor_map =
-            t::io::ReadNpz(hashmap_file_name);
-    core::Tensor keys = tensor_map.at("key").To(device);
-    core::Tensor values = tensor_map.at("value_000").To(device);
+    // Map the arrays instead of reading them, so that they are copied to
+    // the device without an intermediate host copy.
+    t::io::NpzFile npz(hashmap_file_name, /*use_mmap=*/true);
+    core::Tensor keys = npz.Get("key").To(device);
+    core::Tensor values = npz.Get("value_000").To(device);
 
     core::Tensor buf_indices, masks;
     tsdf_voxelgrid.GetBlockHashMap()->Insert(keys, values, buf_indices, masks);
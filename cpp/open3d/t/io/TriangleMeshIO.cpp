@@ -29,7 +29,9 @@
 #include <unordered_map>
 
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -40,7 +42,12 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            geometry::TriangleMesh &,
                            const open3d::io::ReadTriangleMeshOptions &)>>
-        file_extension_to_trianglemesh_read_function{};
+        file_extension_to_trianglemesh_read_function{
+                {"stl", ReadTriangleMeshFromSTL},
+                {"gltf", ReadTriangleMeshFromGLTF},
+                {"glb", ReadTriangleMeshFromGLTF},
+                {"off", ReadTriangleMeshFromOFF},
+        };
 
 static const std::unordered_map<
         std::string,
@@ -79,6 +86,7 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       open3d::io::ReadTriangleMeshOptions params) {
+    OPEN3D_PROFILE_ZONE("io", "ReadTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -99,6 +107,16 @@ bool ReadTriangleMesh(const std::string &filename,
         }
         mesh = geometry::TriangleMesh::FromLegacy(legacy_mesh);
     } else {
+        if (params.print_progress) {
+            auto progress_text = std::string("Reading ") +
+                                 utility::ToUpper(filename_ext) +
+                                 " file: " + filename;
+            auto pbar = utility::ConsoleProgressBar(100, progress_text, true);
+            params.update_progress = [pbar](double percent) mutable -> bool {
+                pbar.SetCurrentCount(size_t(percent));
+                return true;
+            };
+        }
         success = map_itr->second(filename, mesh, params);
         utility::LogDebug(
                 "Read geometry::TriangleMesh: {:d} triangles and {:d} "
@@ -123,6 +141,7 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_vertex_colors /* = true*/,
                        bool write_triangle_uvs /* = true*/,
                        bool print_progress /* = false*/) {
+    OPEN3D_PROFILE_ZONE("io", "WriteTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/t/geometry/TriangleMesh.h"
@@ -63,6 +64,36 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+/// Read a binary or ASCII STL file. Corners with equal positions are merged
+/// into one vertex, the facet normals are stored as triangle normals.
+/// Positions and normals are Float32, indices Int64.
+bool ReadTriangleMeshFromSTL(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             const open3d::io::ReadTriangleMeshOptions &params);
+
+/// Read the triangle primitives of a glTF or GLB file as one mesh per
+/// primitive and node instance of the default scene, with the node
+/// transformations applied. The file is parsed once for all meshes.
+/// Tightly packed accessors of untransformed meshes view the loaded buffers,
+/// or the mapped file for GLB, without copies.
+bool ReadTriangleMeshesFromGLTF(
+        const std::string &filename,
+        std::vector<geometry::TriangleMesh> &meshes,
+        const open3d::io::ReadTriangleMeshOptions &params = {});
+
+/// ReadTriangleMeshesFromGLTF() with all meshes merged into one.
+bool ReadTriangleMeshFromGLTF(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+/// Read an OFF file with optional vertex normals and colors, as Float32
+/// tensors. Files with polygons other than triangles are triangulated by
+/// the legacy reader.
+bool ReadTriangleMeshFromOFF(const std::string &filename,
+                             geometry::TriangleMesh &mesh,
+                             const open3d::io::ReadTriangleMeshOptions &params);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
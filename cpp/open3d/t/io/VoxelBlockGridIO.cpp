@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/VoxelBlockGridIO.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// Calls \p func(i) for i in [0, n) on \p num_threads threads. Rethrows the
+/// first exception once all calls have finished.
+void ParallelForFiles(size_t n,
+                      int num_threads,
+                      const std::function<void(size_t)> &func) {
+    if (num_threads <= 0) {
+        num_threads = utility::EstimateMaxThreads();
+    }
+    num_threads = int(std::max<size_t>(
+            1, std::min<size_t>(size_t(num_threads), n)));
+
+    // Files are claimed one by one, as their sizes may differ a lot.
+    std::atomic<size_t> next(0);
+    std::vector<std::exception_ptr> errors(n);
+    auto worker = [&]() {
+        for (size_t i = next++; i < n; i = next++) {
+            try {
+                func(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int i = 1; i < num_threads; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (const std::exception_ptr &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // namespace
+
+void WriteVoxelBlockGrids(
+        const std::vector<std::string> &file_names,
+        const std::vector<geometry::VoxelBlockGrid> &grids,
+        int num_threads) {
+    if (file_names.size() != grids.size()) {
+        utility::LogError("Got {} file names for {} voxel block grids.",
+                          file_names.size(), grids.size());
+    }
+    ParallelForFiles(grids.size(), num_threads,
+                     [&](size_t i) { grids[i].Save(file_names[i]); });
+}
+
+std::vector<geometry::VoxelBlockGrid> ReadVoxelBlockGrids(
+        const std::vector<std::string> &file_names,
+        const core::Device &device,
+        int num_threads) {
+    std::vector<geometry::VoxelBlockGrid> grids(file_names.size());
+    ParallelForFiles(file_names.size(), num_threads, [&](size_t i) {
+        grids[i] = geometry::VoxelBlockGrid::Load(file_names[i], device);
+    });
+    return grids;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
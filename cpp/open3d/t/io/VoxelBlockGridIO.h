@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/VoxelBlockGrid.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \brief Save voxel block grids, e.g. the fragments of a reconstruction, to
+/// .npz files in parallel.
+///
+/// Each grid is written by VoxelBlockGrid::Save(). Errors are raised after
+/// all other grids are written.
+///
+/// \param file_names One .npz file name per grid.
+/// \param grids The grids to save.
+/// \param num_threads Number of writing threads, 0 for one per core.
+void WriteVoxelBlockGrids(
+        const std::vector<std::string> &file_names,
+        const std::vector<geometry::VoxelBlockGrid> &grids,
+        int num_threads = 0);
+
+/// \brief Load voxel block grids from .npz files in parallel.
+///
+/// Each grid is read by VoxelBlockGrid::Load(), which maps the file and copies
+/// it to \p device in chunks.
+///
+/// \param file_names The .npz files to read.
+/// \param device Device of the returned grids.
+/// \param num_threads Number of reading threads, 0 for one per core.
+std::vector<geometry::VoxelBlockGrid> ReadVoxelBlockGrids(
+        const std::vector<std::string> &file_names,
+        const core::Device &device,
+        int num_threads = 0);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,481 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// The tinygltf and stb implementations are compiled in io/FileGLTF.cpp, this
+// file only needs the declarations.
+#undef TINYGLTF_IMPLEMENTATION
+#undef STB_IMAGE_IMPLEMENTATION
+#undef STB_IMAGE_WRITE_IMPLEMENTATION
+#include <tiny_gltf.h>
+
+#include <Eigen/Geometry>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/io/MappedFile.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// The loaded glTF model. Accessor tensors keep it alive, so they can view
+/// its buffers without copies.
+struct GLTFData {
+    tinygltf::Model model;
+    /// Binary chunk of a GLB file, mapped from the file. It replaces the
+    /// copy of buffer 0 in model.
+    std::shared_ptr<core::Blob> glb_bin;
+};
+
+core::Dtype ComponentTypeToDtype(int component_type) {
+    switch (component_type) {
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+            return core::Int8;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+            return core::UInt8;
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+            return core::Int16;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+            return core::UInt16;
+        case TINYGLTF_COMPONENT_TYPE_INT:
+            return core::Int32;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+            return core::UInt32;
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:
+            return core::Float32;
+        case TINYGLTF_COMPONENT_TYPE_DOUBLE:
+            return core::Float64;
+        default:
+            return core::Undefined;
+    }
+}
+
+/// Returns the accessor as a {count, components} tensor. Tightly packed
+/// accessors view the buffer, interleaved ones are copied.
+bool AccessorToTensor(const std::shared_ptr<const GLTFData> &data,
+                      int accessor_index,
+                      core::Tensor &tensor) {
+    const tinygltf::Model &model = data->model;
+    if (accessor_index < 0 ||
+        accessor_index >= static_cast<int>(model.accessors.size())) {
+        return false;
+    }
+    const tinygltf::Accessor &accessor = model.accessors[accessor_index];
+    const core::Dtype dtype = ComponentTypeToDtype(accessor.componentType);
+    const int64_t num_components =
+            tinygltf::GetNumComponentsInType(accessor.type);
+    if (dtype == core::Undefined || num_components <= 0 ||
+        accessor.sparse.isSparse || accessor.bufferView < 0 ||
+        accessor.bufferView >= static_cast<int>(model.bufferViews.size())) {
+        utility::LogWarning(
+                "Read GLTF failed: accessor {} is sparse or has an "
+                "unsupported layout.",
+                accessor_index);
+        return false;
+    }
+    const tinygltf::BufferView &view = model.bufferViews[accessor.bufferView];
+    const int64_t element_size = num_components * dtype.ByteSize();
+    const int64_t byte_stride = accessor.ByteStride(view);
+    const int64_t count = static_cast<int64_t>(accessor.count);
+    if (byte_stride <= 0 || byte_stride % dtype.ByteSize() != 0) {
+        utility::LogWarning("Read GLTF failed: invalid stride of accessor {}.",
+                            accessor_index);
+        return false;
+    }
+
+    const char *buffer_ptr;
+    int64_t buffer_size;
+    std::shared_ptr<const void> owner;
+    if (data->glb_bin && view.buffer == 0) {
+        buffer_ptr = static_cast<const char *>(data->glb_bin->GetDataPtr());
+        buffer_size = static_cast<int64_t>(model.buffers[0].byteLength);
+        owner = data->glb_bin;
+    } else {
+        const tinygltf::Buffer &buffer = model.buffers[view.buffer];
+        buffer_ptr = reinterpret_cast<const char *>(buffer.data.data());
+        buffer_size = static_cast<int64_t>(buffer.data.size());
+        owner = data;
+    }
+    const int64_t offset = static_cast<int64_t>(view.byteOffset) +
+                           static_cast<int64_t>(accessor.byteOffset);
+    if (count > 0 &&
+        offset + (count - 1) * byte_stride + element_size > buffer_size) {
+        utility::LogWarning(
+                "Read GLTF failed: accessor {} is out of the buffer bounds.",
+                accessor_index);
+        return false;
+    }
+
+    void *ptr = const_cast<char *>(buffer_ptr + offset);
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"), ptr,
+                                             [owner](void *) {});
+    tensor = core::Tensor({count, num_components},
+                          {byte_stride / dtype.ByteSize(), 1}, ptr, dtype,
+                          blob);
+    if (byte_stride != element_size) {
+        tensor = tensor.Contiguous();
+    }
+    return true;
+}
+
+/// Local transformation of a node, either its matrix or T * R * S.
+Eigen::Matrix4d GetNodeTransform(const tinygltf::Node &node) {
+    Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
+    if (node.matrix.size() == 16) {
+        transform = Eigen::Map<const Eigen::Matrix4d>(node.matrix.data());
+        return transform;
+    }
+    if (node.scale.size() == 3) {
+        transform.topLeftCorner<3, 3>() =
+                Eigen::Vector3d(node.scale[0], node.scale[1], node.scale[2])
+                        .asDiagonal();
+    }
+    if (node.rotation.size() == 4) {
+        // glTF quaternions are qx, qy, qz, qw.
+        transform.topLeftCorner<3, 3>() =
+                Eigen::Quaterniond(node.rotation[3], node.rotation[0],
+                                   node.rotation[1], node.rotation[2])
+                        .toRotationMatrix() *
+                transform.topLeftCorner<3, 3>();
+    }
+    if (node.translation.size() == 3) {
+        transform.topRightCorner<3, 1>() = Eigen::Vector3d(
+                node.translation[0], node.translation[1], node.translation[2]);
+    }
+    return transform;
+}
+
+bool PrimitiveToMesh(const std::shared_ptr<const GLTFData> &data,
+                     const tinygltf::Primitive &primitive,
+                     geometry::TriangleMesh &mesh) {
+    core::Tensor positions;
+    auto position_it = primitive.attributes.find("POSITION");
+    if (position_it == primitive.attributes.end() ||
+        !AccessorToTensor(data, position_it->second, positions) ||
+        positions.GetDtype() != core::Float32 || positions.GetShape(1) != 3) {
+        utility::LogWarning(
+                "Read GLTF failed: primitive has no Float32 VEC3 positions.");
+        return false;
+    }
+    mesh.SetVertexPositions(positions);
+
+    auto normal_it = primitive.attributes.find("NORMAL");
+    core::Tensor normals;
+    if (normal_it != primitive.attributes.end() &&
+        AccessorToTensor(data, normal_it->second, normals) &&
+        normals.GetDtype() == core::Float32 && normals.GetShape(1) == 3) {
+        mesh.SetVertexNormals(normals);
+    }
+
+    // Colors may be VEC3 or VEC4, with normalized integer components.
+    auto color_it = primitive.attributes.find("COLOR_0");
+    core::Tensor colors;
+    if (color_it != primitive.attributes.end() &&
+        AccessorToTensor(data, color_it->second, colors) &&
+        colors.GetShape(1) >= 3) {
+        if (colors.GetShape(1) > 3) {
+            colors = colors.Slice(1, 0, 3).Contiguous();
+        }
+        if (colors.GetDtype() == core::UInt8) {
+            colors = colors.To(core::Float32) /
+                     float(std::numeric_limits<uint8_t>::max());
+        } else if (colors.GetDtype() == core::UInt16) {
+            colors = colors.To(core::Float32) /
+                     float(std::numeric_limits<uint16_t>::max());
+        }
+        if (colors.GetDtype() == core::Float32) {
+            mesh.SetVertexColors(colors);
+        } else {
+            utility::LogWarning(
+                    "Unrecognized component type for vertex colors");
+        }
+    }
+
+    core::Tensor indices;
+    if (primitive.indices < 0) {
+        indices = core::Tensor::Arange(0, positions.GetLength(), 1,
+                                       core::Int64);
+    } else if (AccessorToTensor(data, primitive.indices, indices)) {
+        indices = indices.Reshape({-1}).To(core::Int64);
+    } else {
+        return false;
+    }
+    const int64_t num_indices = indices.GetLength();
+    switch (primitive.mode) {
+        case TINYGLTF_MODE_TRIANGLES:
+            mesh.SetTriangleIndices(
+                    indices.Slice(0, 0, num_indices / 3 * 3).Reshape({-1, 3}));
+            break;
+        case TINYGLTF_MODE_TRIANGLE_STRIP:
+        case TINYGLTF_MODE_TRIANGLE_FAN: {
+            const int64_t num_triangles = std::max<int64_t>(num_indices - 2, 0);
+            core::Tensor triangles({num_triangles, 3}, core::Int64);
+            const int64_t *src = indices.GetDataPtr<int64_t>();
+            int64_t *dst = triangles.GetDataPtr<int64_t>();
+            const bool fan = primitive.mode == TINYGLTF_MODE_TRIANGLE_FAN;
+            for (int64_t i = 0; i < num_triangles; ++i) {
+                dst[3 * i + 0] = fan ? src[0] : src[i];
+                dst[3 * i + 1] = src[i + 1];
+                dst[3 * i + 2] = src[i + 2];
+            }
+            mesh.SetTriangleIndices(triangles);
+            break;
+        }
+        default:
+            utility::LogWarning(
+                    "Read GLTF: skipping primitive with mode {}, only "
+                    "triangles are supported.",
+                    primitive.mode);
+            return false;
+    }
+    return true;
+}
+
+/// Append the primitives of \p node_index and its children to \p meshes.
+void AddNodeMeshes(const std::shared_ptr<const GLTFData> &data,
+                   int node_index,
+                   const Eigen::Matrix4d &parent_transform,
+                   int depth,
+                   std::vector<geometry::TriangleMesh> &meshes) {
+    const tinygltf::Model &model = data->model;
+    // The depth limit guards against cycles in invalid files.
+    if (node_index < 0 || node_index >= static_cast<int>(model.nodes.size()) ||
+        depth > static_cast<int>(model.nodes.size())) {
+        return;
+    }
+    const tinygltf::Node &node = model.nodes[node_index];
+    const Eigen::Matrix4d transform = parent_transform * GetNodeTransform(node);
+    if (node.mesh >= 0 && node.mesh < static_cast<int>(model.meshes.size())) {
+        for (const tinygltf::Primitive &primitive :
+             model.meshes[node.mesh].primitives) {
+            geometry::TriangleMesh mesh;
+            if (!PrimitiveToMesh(data, primitive, mesh)) {
+                continue;
+            }
+            if (!transform.isIdentity()) {
+                // The buffers are shared with other instances of the mesh.
+                mesh = mesh.Clone();
+                mesh.Transform(core::eigen_converter::EigenMatrixToTensor(
+                        transform));
+            }
+            meshes.push_back(mesh);
+        }
+    }
+    for (int child : node.children) {
+        AddNodeMeshes(data, child, transform, depth + 1, meshes);
+    }
+}
+
+/// Map the binary chunk of a GLB file, or return nullptr if the file does
+/// not have one.
+std::shared_ptr<core::Blob> MapGLBBinaryChunk(
+        const std::shared_ptr<core::Blob> &file_blob, int64_t file_size) {
+    const char *bytes = static_cast<const char *>(file_blob->GetDataPtr());
+    auto read_u32 = [bytes](int64_t offset) {
+        uint32_t value;
+        std::memcpy(&value, bytes + offset, sizeof(value));
+        return int64_t(value);
+    };
+    // 12 byte header, then chunks of length, type and data.
+    if (file_size < 20) {
+        return nullptr;
+    }
+    const int64_t bin_header = 20 + read_u32(12);
+    if (bin_header + 8 > file_size || read_u32(bin_header + 4) != 0x004E4942) {
+        return nullptr;
+    }
+    const int64_t bin_size = read_u32(bin_header);
+    if (bin_header + 8 + bin_size > file_size) {
+        return nullptr;
+    }
+    return std::make_shared<core::Blob>(
+            core::Device("CPU:0"),
+            static_cast<char *>(file_blob->GetDataPtr()) + bin_header + 8,
+            [file_blob](void *) {});
+}
+
+}  // namespace
+
+bool ReadTriangleMeshesFromGLTF(
+        const std::string &filename,
+        std::vector<geometry::TriangleMesh> &meshes,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    meshes.clear();
+    try {
+        auto data = std::make_shared<GLTFData>();
+        tinygltf::TinyGLTF loader;
+        std::string warn;
+        std::string err;
+        bool ret;
+        if (utility::filesystem::GetFileExtensionInLowerCase(filename) ==
+            "glb") {
+            utility::filesystem::CFile file;
+            if (!file.Open(filename, "rb")) {
+                utility::LogWarning(
+                        "Read GLTF failed: unable to open file {}", filename);
+                return false;
+            }
+            const int64_t file_size = file.GetFileSize();
+            file.Close();
+            if (file_size <= 0) {
+                utility::LogWarning("Read GLTF failed: empty file {}",
+                                    filename);
+                return false;
+            }
+            std::shared_ptr<core::Blob> file_blob =
+                    MapFileRegion(filename, 0, file_size);
+            ret = loader.LoadBinaryFromMemory(
+                    &data->model, &err, &warn,
+                    static_cast<const unsigned char *>(
+                            file_blob->GetDataPtr()),
+                    static_cast<unsigned int>(file_size),
+                    utility::filesystem::GetFileParentDirectory(filename));
+            // Accessors of the embedded buffer view the mapped file, so the
+            // copy made by tinygltf is released.
+            if (ret && !data->model.buffers.empty() &&
+                data->model.buffers[0].uri.empty()) {
+                data->glb_bin = MapGLBBinaryChunk(file_blob, file_size);
+                if (data->glb_bin) {
+                    std::vector<unsigned char>().swap(
+                            data->model.buffers[0].data);
+                }
+            }
+        } else {
+            ret = loader.LoadASCIIFromFile(&data->model, &err, &warn,
+                                           filename);
+        }
+        if (!warn.empty()) {
+            utility::LogWarning("Read GLTF: {}", warn);
+        }
+        if (!ret) {
+            utility::LogWarning("Read GLTF failed: unable to open file {}: {}",
+                                filename, err);
+            return false;
+        }
+
+        std::shared_ptr<const GLTFData> const_data = data;
+        const tinygltf::Model &model = const_data->model;
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(model.nodes.size());
+        // Nodes of the default scene, or all nodes if there is no scene.
+        std::vector<int> root_nodes;
+        int depth = 0;
+        if (!model.scenes.empty()) {
+            const int scene = model.defaultScene >= 0 &&
+                                              model.defaultScene <
+                                                      int(model.scenes.size())
+                                      ? model.defaultScene
+                                      : 0;
+            root_nodes = model.scenes[scene].nodes;
+        } else {
+            for (int i = 0; i < int(model.nodes.size()); ++i) {
+                root_nodes.push_back(i);
+            }
+            // Children are visited as roots, do not visit them twice.
+            depth = int(model.nodes.size());
+        }
+        for (int node : root_nodes) {
+            AddNodeMeshes(const_data, node, Eigen::Matrix4d::Identity(), depth,
+                          meshes);
+            ++reporter;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read GLTF failed with exception: {}", e.what());
+        meshes.clear();
+        return false;
+    }
+}
+
+bool ReadTriangleMeshFromGLTF(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    mesh.Clear();
+    std::vector<geometry::TriangleMesh> meshes;
+    if (!ReadTriangleMeshesFromGLTF(filename, meshes, params)) {
+        return false;
+    }
+    if (meshes.size() == 1) {
+        mesh = meshes[0];
+        return true;
+    }
+    if (meshes.size() > 1) {
+        utility::LogInfo(
+                "The file contains more than one mesh. All meshes will be "
+                "loaded as a single mesh.");
+    }
+
+    // Vertex attributes are kept if all meshes have them.
+    bool has_normals = true;
+    bool has_colors = true;
+    std::vector<core::Tensor> positions, normals, colors, triangles;
+    int64_t num_vertices = 0;
+    for (const geometry::TriangleMesh &part : meshes) {
+        has_normals = has_normals && part.HasVertexNormals();
+        has_colors = has_colors && part.HasVertexColors();
+        positions.push_back(part.GetVertexPositions());
+        triangles.push_back(part.GetTriangleIndices() + num_vertices);
+        num_vertices += part.GetVertexPositions().GetLength();
+    }
+    if (positions.empty()) {
+        return true;
+    }
+    for (const geometry::TriangleMesh &part : meshes) {
+        if (has_normals) {
+            normals.push_back(part.GetVertexNormals());
+        }
+        if (has_colors) {
+            colors.push_back(part.GetVertexColors());
+        }
+    }
+    mesh.SetVertexPositions(core::Concatenate(positions));
+    mesh.SetTriangleIndices(core::Concatenate(triangles));
+    if (has_normals) {
+        mesh.SetVertexNormals(core::Concatenate(normals));
+    }
+    if (has_colors) {
+        mesh.SetVertexColors(core::Concatenate(colors));
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,556 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <limits>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// LAS specification:
+// https://www.asprs.org/wp-content/uploads/2019/07/LAS_1_4_r15.pdf
+// All values are little endian, as is the host.
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// Size of the LAS 1.0 - 1.2 public header block, the one written.
+constexpr int kLASHeaderSize12 = 227;
+/// Size of the LAS 1.4 public header block, the largest one read.
+constexpr int kLASHeaderSize14 = 375;
+
+struct LASHeader {
+    uint8_t version_major;
+    uint8_t version_minor;
+    uint16_t header_size;
+    uint32_t offset_to_point_data;
+    uint8_t point_format;
+    uint16_t point_record_length;
+    uint64_t num_points;
+    double scale[3];
+    double offset[3];
+};
+
+/// Byte offsets of the optional fields of a point data record format, -1 if
+/// the format lacks the field. Formats 6 - 10 pack the return numbers and the
+/// classification differently from formats 0 - 5.
+struct LASPointLayout {
+    int gps_time_offset;
+    int colors_offset;
+    bool extended;
+    int record_length;
+};
+
+template <typename T>
+T ReadLE(const uint8_t *ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void WriteLE(uint8_t *ptr, T value) {
+    std::memcpy(ptr, &value, sizeof(T));
+}
+
+bool GetLASPointLayout(uint8_t point_format, LASPointLayout &layout) {
+    static const std::array<LASPointLayout, 11> layouts{{{-1, -1, false, 20},
+                                                         {20, -1, false, 28},
+                                                         {-1, 20, false, 26},
+                                                         {20, 28, false, 34},
+                                                         {20, -1, false, 57},
+                                                         {20, 28, false, 63},
+                                                         {22, -1, true, 30},
+                                                         {22, 30, true, 36},
+                                                         {22, 30, true, 38},
+                                                         {22, -1, true, 59},
+                                                         {22, 30, true, 67}}};
+    if (point_format >= layouts.size()) {
+        return false;
+    }
+    layout = layouts[point_format];
+    return true;
+}
+
+bool ReadLASHeader(FILE *file, LASHeader &header, std::string &error) {
+    uint8_t buffer[kLASHeaderSize14] = {0};
+    const size_t num_read = fread(buffer, 1, kLASHeaderSize12, file);
+    if (num_read != kLASHeaderSize12 || std::memcmp(buffer, "LASF", 4) != 0) {
+        error = "not a LAS file";
+        return false;
+    }
+    header.version_major = buffer[24];
+    header.version_minor = buffer[25];
+    header.header_size = ReadLE<uint16_t>(buffer + 94);
+    header.offset_to_point_data = ReadLE<uint32_t>(buffer + 96);
+    header.point_format = buffer[104];
+    header.point_record_length = ReadLE<uint16_t>(buffer + 105);
+    header.num_points = ReadLE<uint32_t>(buffer + 107);
+    for (int i = 0; i < 3; ++i) {
+        header.scale[i] = ReadLE<double>(buffer + 131 + 8 * i);
+        header.offset[i] = ReadLE<double>(buffer + 155 + 8 * i);
+    }
+    if (header.header_size < kLASHeaderSize12 ||
+        header.offset_to_point_data < header.header_size) {
+        error = "corrupted header";
+        return false;
+    }
+
+    // LAS 1.4 keeps the 64 bit point count after the 1.2 and 1.3 fields, the
+    // legacy count is 0 for formats 6 - 10.
+    if (header.version_major == 1 && header.version_minor >= 4 &&
+        header.header_size >= kLASHeaderSize14) {
+        if (fread(buffer + kLASHeaderSize12, 1,
+                  kLASHeaderSize14 - kLASHeaderSize12,
+                  file) != kLASHeaderSize14 - kLASHeaderSize12) {
+            error = "corrupted header";
+            return false;
+        }
+        header.num_points = ReadLE<uint64_t>(buffer + 247);
+    }
+    return true;
+}
+
+/// Look-up table of the accepted values of an 8 bit attribute.
+std::array<bool, 256> MakeAcceptTable(const std::vector<uint8_t> &values) {
+    std::array<bool, 256> table;
+    table.fill(values.empty());
+    for (uint8_t value : values) {
+        table[value] = true;
+    }
+    return table;
+}
+
+/// Return attribute \p key of \p pointcloud as a contiguous Float64 tensor of
+/// shape (num_points, num_columns), or an empty tensor if it is absent.
+core::Tensor GetLASAttribute(const geometry::PointCloud &pointcloud,
+                             const std::string &key,
+                             int64_t num_points,
+                             int64_t num_columns) {
+    if (num_points == 0 || !pointcloud.HasPointAttr(key)) {
+        return core::Tensor();
+    }
+    const core::Tensor &attr = pointcloud.GetPointAttr(key);
+    if (attr.NumElements() != num_points * num_columns) {
+        utility::LogError("Attribute {} has shape {}, but expected ({}, {}).",
+                          key, attr.GetShape(), num_points, num_columns);
+    }
+    return attr.To(core::Float64).Reshape({num_points, num_columns});
+}
+
+template <typename T>
+T ClampRound(double value) {
+    return static_cast<T>(std::round(
+            std::min(std::max(value, double(std::numeric_limits<T>::min())),
+                     double(std::numeric_limits<T>::max()))));
+}
+
+}  // namespace
+
+bool ReadPointCloudFromLASWithFilter(const std::string &filename,
+                                     geometry::PointCloud &pointcloud,
+                                     const LASReadFilter &filter,
+                                     const ReadPointCloudOption &params) {
+    try {
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "rb")) {
+            utility::LogWarning("Read LAS failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        LASHeader header;
+        std::string error;
+        if (!ReadLASHeader(file.GetFILE(), header, error)) {
+            utility::LogWarning("Read LAS failed: {}: {}.", error, filename);
+            return false;
+        }
+        // LAZ files are LAS files with the compressed point records flagged
+        // in the upper bits of the point data format.
+        if (header.point_format & 0xC0) {
+            utility::LogWarning(
+                    "Read LAS failed: {} has LAZ compressed point records, "
+                    "which are not supported. Decompress it to LAS first.",
+                    filename);
+            return false;
+        }
+        LASPointLayout layout;
+        if (!GetLASPointLayout(header.point_format, layout)) {
+            utility::LogWarning(
+                    "Read LAS failed: unsupported point data format {}.",
+                    header.point_format);
+            return false;
+        }
+        if (header.point_record_length < layout.record_length) {
+            utility::LogWarning(
+                    "Read LAS failed: point record length {} is too short "
+                    "for point data format {}.",
+                    header.point_record_length, header.point_format);
+            return false;
+        }
+        if (filter.chunk_size <= 0) {
+            utility::LogError("chunk_size must be positive, but got {}.",
+                              filter.chunk_size);
+        }
+        if (fseek(file.GetFILE(), long(header.offset_to_point_data),
+                  SEEK_SET) != 0) {
+            utility::LogWarning("Read LAS failed: unable to seek file: {}",
+                                filename);
+            return false;
+        }
+
+        const std::array<bool, 256> accept_classification =
+                MakeAcceptTable(filter.classifications);
+        const std::array<bool, 256> accept_return_number =
+                MakeAcceptTable(filter.return_numbers);
+        const bool has_gps_time = layout.gps_time_offset >= 0;
+        const bool has_colors = layout.colors_offset >= 0;
+
+        std::vector<double> positions;
+        std::vector<uint16_t> intensities;
+        std::vector<uint8_t> classification;
+        std::vector<uint8_t> return_number;
+        std::vector<uint8_t> number_of_returns;
+        std::vector<double> gps_time;
+        std::vector<uint16_t> colors;
+
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(int64_t(header.num_points));
+        const size_t record_length = header.point_record_length;
+        std::vector<uint8_t> buffer(size_t(filter.chunk_size) * record_length);
+        for (uint64_t begin = 0; begin < header.num_points;
+             begin += filter.chunk_size) {
+            const size_t num_records = size_t(std::min<uint64_t>(
+                    filter.chunk_size, header.num_points - begin));
+            if (file.ReadData(buffer.data(), record_length, num_records) !=
+                num_records) {
+                utility::LogWarning(
+                        "Read LAS failed: unexpected end of file after {} of "
+                        "{} points: {}",
+                        begin, header.num_points, filename);
+                return false;
+            }
+            for (size_t i = 0; i < num_records; ++i) {
+                const uint8_t *record = buffer.data() + i * record_length;
+                double xyz[3];
+                bool inside = true;
+                for (int d = 0; d < 3; ++d) {
+                    xyz[d] = ReadLE<int32_t>(record + 4 * d) * header.scale[d] +
+                             header.offset[d];
+                    inside = inside && xyz[d] >= filter.min_bound(d) &&
+                             xyz[d] <= filter.max_bound(d);
+                }
+                const uint8_t returns = record[14];
+                const uint8_t point_return_number =
+                        layout.extended ? (returns & 0x0F) : (returns & 0x07);
+                const uint8_t point_number_of_returns =
+                        layout.extended ? (returns >> 4)
+                                        : ((returns >> 3) & 0x07);
+                const uint8_t point_classification =
+                        layout.extended ? record[16] : (record[15] & 0x1F);
+                if (!inside || !accept_classification[point_classification] ||
+                    !accept_return_number[point_return_number]) {
+                    continue;
+                }
+
+                positions.insert(positions.end(), xyz, xyz + 3);
+                intensities.push_back(ReadLE<uint16_t>(record + 12));
+                classification.push_back(point_classification);
+                return_number.push_back(point_return_number);
+                number_of_returns.push_back(point_number_of_returns);
+                if (has_gps_time) {
+                    gps_time.push_back(
+                            ReadLE<double>(record + layout.gps_time_offset));
+                }
+                if (has_colors) {
+                    for (int c = 0; c < 3; ++c) {
+                        colors.push_back(ReadLE<uint16_t>(
+                                record + layout.colors_offset + 2 * c));
+                    }
+                }
+            }
+            reporter.Update(int64_t(begin + num_records));
+        }
+
+        const int64_t num_points = int64_t(intensities.size());
+        pointcloud.Clear();
+        pointcloud.SetPointPositions(
+                core::Tensor(positions, {num_points, 3}, core::Float64));
+        pointcloud.SetPointAttr(
+                "intensities",
+                core::Tensor(intensities, {num_points, 1}, core::UInt16));
+        pointcloud.SetPointAttr(
+                "classification",
+                core::Tensor(classification, {num_points, 1}, core::UInt8));
+        pointcloud.SetPointAttr(
+                "return_number",
+                core::Tensor(return_number, {num_points, 1}, core::UInt8));
+        pointcloud.SetPointAttr(
+                "number_of_returns",
+                core::Tensor(number_of_returns, {num_points, 1}, core::UInt8));
+        if (has_gps_time) {
+            pointcloud.SetPointAttr(
+                    "gps_time",
+                    core::Tensor(gps_time, {num_points, 1}, core::Float64));
+        }
+        if (has_colors) {
+            pointcloud.SetPointColors(
+                    core::Tensor(colors, {num_points, 3}, core::UInt16));
+        }
+        reporter.Finish();
+        utility::LogDebug("Read LAS: kept {} of {} points.", num_points,
+                          header.num_points);
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read LAS failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool ReadPointCloudFromLAS(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const ReadPointCloudOption &params) {
+    return ReadPointCloudFromLASWithFilter(filename, pointcloud,
+                                           LASReadFilter(), params);
+}
+
+bool WritePointCloudToLAS(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const WritePointCloudOption &params) {
+    if (bool(params.write_ascii)) {
+        utility::LogError("PointCloud can't be saved in ASCII format as .las.");
+    }
+    if (bool(params.compressed)) {
+        utility::LogError(
+                "PointCloud can't be saved in compressed format as .las.");
+    }
+
+    try {
+        const int64_t num_points =
+                pointcloud.HasPointPositions()
+                        ? pointcloud.GetPointPositions().GetLength()
+                        : 0;
+        if (uint64_t(num_points) > std::numeric_limits<uint32_t>::max()) {
+            utility::LogWarning(
+                    "Write LAS failed: {} points exceed the LAS 1.2 limit.",
+                    num_points);
+            return false;
+        }
+        const core::Tensor positions =
+                GetLASAttribute(pointcloud, "positions", num_points, 3);
+        const core::Tensor intensities =
+                GetLASAttribute(pointcloud, "intensities", num_points, 1);
+        const core::Tensor classification =
+                GetLASAttribute(pointcloud, "classification", num_points, 1);
+        const core::Tensor return_number =
+                GetLASAttribute(pointcloud, "return_number", num_points, 1);
+        const core::Tensor number_of_returns = GetLASAttribute(
+                pointcloud, "number_of_returns", num_points, 1);
+        const core::Tensor gps_time =
+                GetLASAttribute(pointcloud, "gps_time", num_points, 1);
+        core::Tensor colors =
+                GetLASAttribute(pointcloud, "colors", num_points, 3);
+        if (colors.NumElements() > 0) {
+            // Scale colors to the 16 bit range of LAS.
+            const core::Dtype dtype = pointcloud.GetPointColors().GetDtype();
+            if (dtype == core::UInt8) {
+                colors = colors * 257.0;
+            } else if (dtype == core::Float32 || dtype == core::Float64) {
+                colors = colors * 65535.0;
+            }
+        }
+        const bool has_gps_time = gps_time.NumElements() > 0;
+        const bool has_colors = colors.NumElements() > 0;
+        const uint8_t point_format =
+                uint8_t((has_gps_time ? 1 : 0) | (has_colors ? 2 : 0));
+        LASPointLayout layout;
+        GetLASPointLayout(point_format, layout);
+
+        // Quantize relative to the floor of the minimum bound, with the
+        // smallest power of ten that fits the extent in int32.
+        double offset[3] = {0, 0, 0};
+        double scale[3] = {1e-3, 1e-3, 1e-3};
+        double min_bound[3] = {0, 0, 0};
+        double max_bound[3] = {0, 0, 0};
+        if (num_points > 0) {
+            const core::Tensor min_tensor = positions.Min({0});
+            const core::Tensor max_tensor = positions.Max({0});
+            for (int d = 0; d < 3; ++d) {
+                min_bound[d] = min_tensor[d].Item<double>();
+                max_bound[d] = max_tensor[d].Item<double>();
+                offset[d] = std::floor(min_bound[d]);
+                const double range = max_bound[d] - offset[d];
+                const double int32_max = std::numeric_limits<int32_t>::max();
+                if (range > 0) {
+                    scale[d] = std::pow(
+                            10.0, std::ceil(std::log10(range / int32_max)));
+                    if (range / scale[d] > int32_max) {
+                        scale[d] *= 10;
+                    }
+                }
+            }
+        }
+
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "wb")) {
+            utility::LogWarning("Write LAS failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+
+        auto attr_ptr = [](const core::Tensor &attr) {
+            return attr.NumElements() > 0 ? attr.GetDataPtr<double>()
+                                          : nullptr;
+        };
+        const double *positions_ptr = attr_ptr(positions);
+        const double *intensities_ptr = attr_ptr(intensities);
+        const double *classification_ptr = attr_ptr(classification);
+        const double *return_number_ptr = attr_ptr(return_number);
+        const double *number_of_returns_ptr = attr_ptr(number_of_returns);
+        const double *gps_time_ptr = attr_ptr(gps_time);
+        const double *colors_ptr = attr_ptr(colors);
+
+        uint32_t num_points_by_return[5] = {0, 0, 0, 0, 0};
+        for (int64_t i = 0; i < num_points; ++i) {
+            const int r = return_number_ptr
+                                  ? ClampRound<uint8_t>(return_number_ptr[i])
+                                  : 1;
+            if (r >= 1 && r <= 5) {
+                ++num_points_by_return[r - 1];
+            }
+        }
+
+        uint8_t header[kLASHeaderSize12] = {0};
+        std::memcpy(header, "LASF", 4);
+        header[24] = 1;
+        header[25] = 2;
+        std::strncpy(reinterpret_cast<char *>(header + 26), "Open3D", 32);
+        std::strncpy(reinterpret_cast<char *>(header + 58), "Open3D", 32);
+        const std::time_t now = std::time(nullptr);
+        const std::tm *date = std::gmtime(&now);
+        WriteLE<uint16_t>(header + 90, uint16_t(date->tm_yday + 1));
+        WriteLE<uint16_t>(header + 92, uint16_t(date->tm_year + 1900));
+        WriteLE<uint16_t>(header + 94, kLASHeaderSize12);
+        WriteLE<uint32_t>(header + 96, kLASHeaderSize12);
+        header[104] = point_format;
+        WriteLE<uint16_t>(header + 105, uint16_t(layout.record_length));
+        WriteLE<uint32_t>(header + 107, uint32_t(num_points));
+        for (int r = 0; r < 5; ++r) {
+            WriteLE<uint32_t>(header + 111 + 4 * r, num_points_by_return[r]);
+        }
+        for (int d = 0; d < 3; ++d) {
+            WriteLE<double>(header + 131 + 8 * d, scale[d]);
+            WriteLE<double>(header + 155 + 8 * d, offset[d]);
+            WriteLE<double>(header + 179 + 16 * d, max_bound[d]);
+            WriteLE<double>(header + 187 + 16 * d, min_bound[d]);
+        }
+        if (fwrite(header, 1, kLASHeaderSize12, file.GetFILE()) !=
+            kLASHeaderSize12) {
+            utility::LogWarning("Write LAS failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_points);
+        const int64_t chunk_size = LASReadFilter().chunk_size;
+        std::vector<uint8_t> buffer(size_t(chunk_size) * layout.record_length);
+        for (int64_t begin = 0; begin < num_points; begin += chunk_size) {
+            const int64_t end = std::min(begin + chunk_size, num_points);
+            std::fill(buffer.begin(), buffer.end(), 0);
+            for (int64_t i = begin; i < end; ++i) {
+                uint8_t *record =
+                        buffer.data() + (i - begin) * layout.record_length;
+                for (int d = 0; d < 3; ++d) {
+                    WriteLE<int32_t>(record + 4 * d,
+                                     ClampRound<int32_t>(
+                                             (positions_ptr[3 * i + d] -
+                                              offset[d]) /
+                                             scale[d]));
+                }
+                if (intensities_ptr) {
+                    WriteLE<uint16_t>(record + 12,
+                                      ClampRound<uint16_t>(intensities_ptr[i]));
+                }
+                const uint8_t r =
+                        return_number_ptr
+                                ? ClampRound<uint8_t>(return_number_ptr[i])
+                                : 1;
+                const uint8_t n =
+                        number_of_returns_ptr
+                                ? ClampRound<uint8_t>(number_of_returns_ptr[i])
+                                : 1;
+                record[14] = uint8_t((r & 0x07) | ((n & 0x07) << 3));
+                // Formats 0 - 3 only hold classes 0 - 31.
+                if (classification_ptr) {
+                    record[15] =
+                            ClampRound<uint8_t>(classification_ptr[i]) & 0x1F;
+                }
+                if (gps_time_ptr) {
+                    WriteLE<double>(record + layout.gps_time_offset,
+                                    gps_time_ptr[i]);
+                }
+                if (colors_ptr) {
+                    for (int c = 0; c < 3; ++c) {
+                        WriteLE<uint16_t>(
+                                record + layout.colors_offset + 2 * c,
+                                ClampRound<uint16_t>(colors_ptr[3 * i + c]));
+                    }
+                }
+            }
+            const size_t num_records = size_t(end - begin);
+            if (fwrite(buffer.data(), layout.record_length, num_records,
+                       file.GetFILE()) != num_records) {
+                utility::LogWarning(
+                        "Write LAS failed: unable to write file: {}",
+                        filename);
+                return false;
+            }
+            reporter.Update(end);
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write LAS failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
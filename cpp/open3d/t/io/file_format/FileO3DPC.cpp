@@ -0,0 +1,720 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/MappedFile.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// Open3D columnar point cloud (.o3dpc) layout. All values are little endian,
+// as is the host. Strings are a uint32 length followed by the characters.
+//
+// header  "O3DPC\0\0\0", uint32 version, uint32 reserved, uint64 index offset,
+//         uint64 index size.
+// data    For each chunk of chunk_size points and each attribute, a block with
+//         the rows of the chunk, raw or LZF compressed. Blocks start at
+//         multiples of kO3DPCAlignment.
+// index   uint64 num_points, uint64 chunk_size, uint64 num_chunks,
+//         uint32 num_attributes, then per attribute its name, dtype name,
+//         uint32 ndim and int64 shape[ndim] of one point, then per chunk and
+//         attribute uint64 block offset, uint64 block size, uint8 codec,
+//         float64 min[channels] and float64 max[channels]. The minimum of a
+//         channel with NaN values is -inf, so that the bounds never exclude
+//         a point that a per point test would keep.
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr char kO3DPCMagic[8] = {'O', '3', 'D', 'P', 'C', '\0', '\0', '\0'};
+constexpr uint32_t kO3DPCVersion = 1;
+constexpr int64_t kO3DPCHeaderSize = 32;
+constexpr int64_t kO3DPCAlignment = 64;
+constexpr int64_t kO3DPCDefaultChunkSize = 1 << 16;
+
+enum class O3DPCCodec : uint8_t { Raw = 0, LZF = 1 };
+
+struct O3DPCAttribute {
+    std::string name;
+    core::Dtype dtype;
+    core::SizeVector element_shape;
+    /// Number of values per point.
+    int64_t channels;
+    int64_t row_bytes;
+};
+
+struct O3DPCBlock {
+    uint64_t offset;
+    uint64_t size;
+    O3DPCCodec codec;
+    std::vector<double> min;
+    std::vector<double> max;
+};
+
+struct O3DPCIndex {
+    uint64_t num_points;
+    uint64_t chunk_size;
+    uint64_t num_chunks;
+    std::vector<O3DPCAttribute> attributes;
+    /// num_chunks x attributes.size() blocks, chunk major.
+    std::vector<O3DPCBlock> blocks;
+};
+
+template <typename T>
+T ReadLE(const char *ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void WriteLE(char *ptr, T value) {
+    std::memcpy(ptr, &value, sizeof(T));
+}
+
+/// Appends values to the serialized index.
+class IndexWriter {
+public:
+    template <typename T>
+    void Put(T value) {
+        const size_t size = buffer_.size();
+        buffer_.resize(size + sizeof(T));
+        WriteLE<T>(buffer_.data() + size, value);
+    }
+
+    void PutString(const std::string &value) {
+        Put<uint32_t>(uint32_t(value.size()));
+        buffer_.insert(buffer_.end(), value.begin(), value.end());
+    }
+
+    const std::vector<char> &GetBuffer() const { return buffer_; }
+
+private:
+    std::vector<char> buffer_;
+};
+
+/// Reads values from the serialized index. Every read fails past its end.
+class IndexReader {
+public:
+    IndexReader(const char *begin, const char *end) : ptr_(begin), end_(end) {}
+
+    template <typename T>
+    bool Get(T &value) {
+        if (end_ - ptr_ < int64_t(sizeof(T))) {
+            return false;
+        }
+        value = ReadLE<T>(ptr_);
+        ptr_ += sizeof(T);
+        return true;
+    }
+
+    bool GetString(std::string &value) {
+        uint32_t size;
+        if (!Get(size) || end_ - ptr_ < int64_t(size)) {
+            return false;
+        }
+        value.assign(ptr_, size);
+        ptr_ += size;
+        return true;
+    }
+
+private:
+    const char *ptr_;
+    const char *end_;
+};
+
+bool GetO3DPCDtype(const std::string &name, core::Dtype &dtype) {
+    static const std::vector<core::Dtype> dtypes{
+            core::Bool,   core::UInt8,  core::UInt16, core::UInt32,
+            core::UInt64, core::Int8,   core::Int16,  core::Int32,
+            core::Int64,  core::Float32, core::Float64};
+    for (const core::Dtype &candidate : dtypes) {
+        if (candidate.ToString() == name) {
+            dtype = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReadO3DPCIndex(const std::vector<char> &buffer, O3DPCIndex &index) {
+    IndexReader reader(buffer.data(), buffer.data() + buffer.size());
+    uint32_t num_attributes;
+    if (!reader.Get(index.num_points) || !reader.Get(index.chunk_size) ||
+        !reader.Get(index.num_chunks) || !reader.Get(num_attributes) ||
+        index.chunk_size == 0 ||
+        index.num_chunks !=
+                (index.num_points + index.chunk_size - 1) / index.chunk_size) {
+        return false;
+    }
+    index.attributes.resize(num_attributes);
+    for (O3DPCAttribute &attr : index.attributes) {
+        std::string dtype_name;
+        uint32_t ndim;
+        if (!reader.GetString(attr.name) || !reader.GetString(dtype_name) ||
+            !GetO3DPCDtype(dtype_name, attr.dtype) || !reader.Get(ndim)) {
+            return false;
+        }
+        attr.element_shape.resize(ndim);
+        for (int64_t &dim : attr.element_shape) {
+            if (!reader.Get(dim) || dim < 0) {
+                return false;
+            }
+        }
+        attr.channels = attr.element_shape.NumElements();
+        attr.row_bytes = attr.channels * attr.dtype.ByteSize();
+    }
+    index.blocks.resize(index.num_chunks * num_attributes);
+    for (size_t b = 0; b < index.blocks.size(); ++b) {
+        O3DPCBlock &block = index.blocks[b];
+        const int64_t channels = index.attributes[b % num_attributes].channels;
+        uint8_t codec;
+        if (!reader.Get(block.offset) || !reader.Get(block.size) ||
+            !reader.Get(codec) || codec > uint8_t(O3DPCCodec::LZF)) {
+            return false;
+        }
+        block.codec = O3DPCCodec(codec);
+        block.min.resize(channels);
+        block.max.resize(channels);
+        for (double &value : block.min) {
+            if (!reader.Get(value)) return false;
+        }
+        for (double &value : block.max) {
+            if (!reader.Get(value)) return false;
+        }
+    }
+    return true;
+}
+
+/// Decodes \p block, which holds \p raw_size bytes of rows, into \p out.
+void DecodeO3DPCBlock(const char *data,
+                      uint64_t data_size,
+                      const O3DPCBlock &block,
+                      int64_t raw_size,
+                      char *out) {
+    if (block.offset > data_size || block.size > data_size - block.offset) {
+        utility::LogError("block at {} exceeds the data section.",
+                          block.offset);
+    }
+    const char *src = data + block.offset;
+    if (block.codec == O3DPCCodec::Raw) {
+        if (int64_t(block.size) != raw_size) {
+            utility::LogError("block at {} has {} bytes, expected {}.",
+                              block.offset, block.size, raw_size);
+        }
+        std::memcpy(out, src, raw_size);
+    } else if (raw_size > std::numeric_limits<unsigned int>::max() ||
+               lzf_decompress(src, (unsigned int)block.size, out,
+                              (unsigned int)raw_size) != raw_size) {
+        utility::LogError("failed to decompress block at {}.", block.offset);
+    }
+}
+
+/// Per channel minimum and maximum of \p num_rows rows of \p attr.
+void ComputeO3DPCBounds(const O3DPCAttribute &attr,
+                        const char *rows,
+                        int64_t num_rows,
+                        std::vector<double> &min,
+                        std::vector<double> &max) {
+    const int64_t channels = attr.channels;
+    min.assign(channels, std::numeric_limits<double>::infinity());
+    max.assign(channels, -std::numeric_limits<double>::infinity());
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(attr.dtype, [&]() {
+        const scalar_t *values = reinterpret_cast<const scalar_t *>(rows);
+        for (int64_t i = 0; i < num_rows; ++i) {
+            for (int64_t c = 0; c < channels; ++c) {
+                const double value = double(values[i * channels + c]);
+                if (std::isnan(value)) {
+                    min[c] = -std::numeric_limits<double>::infinity();
+                }
+                min[c] = std::min(min[c], value);
+                max[c] = std::max(max[c], value);
+            }
+        }
+    });
+}
+
+}  // namespace
+
+bool ReadPointCloudFromO3DPCWithFilter(const std::string &filename,
+                                       geometry::PointCloud &pointcloud,
+                                       const O3DPCReadFilter &filter,
+                                       const ReadPointCloudOption &params) {
+    try {
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "rb")) {
+            utility::LogWarning("Read O3DPC failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        char header[kO3DPCHeaderSize];
+        if (file.ReadData(header, 1, kO3DPCHeaderSize) != kO3DPCHeaderSize ||
+            std::memcmp(header, kO3DPCMagic, sizeof(kO3DPCMagic)) != 0) {
+            utility::LogWarning("Read O3DPC failed: not an O3DPC file: {}",
+                                filename);
+            return false;
+        }
+        const uint32_t version = ReadLE<uint32_t>(header + 8);
+        if (version != kO3DPCVersion) {
+            utility::LogWarning(
+                    "Read O3DPC failed: unsupported version {} of file: {}",
+                    version, filename);
+            return false;
+        }
+        const uint64_t index_offset = ReadLE<uint64_t>(header + 16);
+        const uint64_t index_size = ReadLE<uint64_t>(header + 24);
+        const uint64_t file_size = uint64_t(file.GetFileSize());
+        std::vector<char> index_buffer;
+        O3DPCIndex index;
+        bool index_valid = index_offset >= uint64_t(kO3DPCHeaderSize) &&
+                           index_offset <= file_size &&
+                           index_size <= file_size - index_offset;
+        if (index_valid) {
+            index_buffer.resize(index_size);
+            index_valid =
+                    fseek(file.GetFILE(), long(index_offset), SEEK_SET) == 0 &&
+                    file.ReadData(index_buffer.data(), 1, index_size) ==
+                            index_size &&
+                    ReadO3DPCIndex(index_buffer, index);
+        }
+        if (!index_valid) {
+            utility::LogWarning("Read O3DPC failed: corrupted index: {}",
+                                filename);
+            return false;
+        }
+        file.Close();
+
+        const int64_t num_attributes = int64_t(index.attributes.size());
+        auto find_attribute = [&](const std::string &name) {
+            for (int64_t a = 0; a < num_attributes; ++a) {
+                if (index.attributes[a].name == name) return a;
+            }
+            return int64_t(-1);
+        };
+        const int64_t positions_idx = find_attribute("positions");
+        if (positions_idx < 0 ||
+            index.attributes[positions_idx].element_shape !=
+                    core::SizeVector{3}) {
+            utility::LogWarning("Read O3DPC failed: no positions in file: {}",
+                                filename);
+            return false;
+        }
+        std::vector<int64_t> selected{positions_idx};
+        if (filter.attributes.empty()) {
+            for (int64_t a = 0; a < num_attributes; ++a) {
+                if (a != positions_idx) selected.push_back(a);
+            }
+        } else {
+            for (const std::string &name : filter.attributes) {
+                const int64_t a = find_attribute(name);
+                if (a < 0) {
+                    utility::LogWarning(
+                            "Read O3DPC failed: no attribute {} in file: {}",
+                            name, filename);
+                    return false;
+                }
+                if (std::find(selected.begin(), selected.end(), a) ==
+                    selected.end()) {
+                    selected.push_back(a);
+                }
+            }
+        }
+
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(2);
+        const int64_t num_chunks = int64_t(index.num_chunks);
+        const int64_t chunk_size = int64_t(index.chunk_size);
+        const int64_t num_points = int64_t(index.num_points);
+        // Only the data section is mapped. Pages of skipped blocks are never
+        // read from the file.
+        std::shared_ptr<core::Blob> blob;
+        const char *data = nullptr;
+        if (num_chunks > 0) {
+            blob = MapFileRegion(filename, 0, int64_t(index_offset));
+            data = static_cast<const char *>(blob->GetDataPtr());
+        }
+
+        // First pass: classify the chunks against the box by their bounds
+        // and test the points of the chunks that straddle it.
+        const bool has_box =
+                (filter.min_bound.array() >
+                 -std::numeric_limits<double>::infinity())
+                        .any() ||
+                (filter.max_bound.array() <
+                 std::numeric_limits<double>::infinity())
+                        .any();
+        const O3DPCAttribute &positions_attr = index.attributes[positions_idx];
+        std::vector<int64_t> num_kept(num_chunks, 0);
+        std::vector<bool> partial(num_chunks, false);
+        std::vector<std::vector<int64_t>> kept_rows(num_chunks);
+        std::vector<std::vector<char>> chunk_positions(num_chunks);
+        utility::ParallelForRange(
+                num_chunks,
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t c = begin; c < end; ++c) {
+                        const int64_t num_rows = std::min(
+                                chunk_size, num_points - c * chunk_size);
+                        if (!has_box) {
+                            num_kept[c] = num_rows;
+                            continue;
+                        }
+                        const O3DPCBlock &block =
+                                index.blocks[c * num_attributes +
+                                             positions_idx];
+                        bool outside = false;
+                        bool inside = true;
+                        for (int d = 0; d < 3; ++d) {
+                            outside = outside ||
+                                      block.max[d] < filter.min_bound(d) ||
+                                      block.min[d] > filter.max_bound(d);
+                            inside = inside &&
+                                     block.min[d] >= filter.min_bound(d) &&
+                                     block.max[d] <= filter.max_bound(d);
+                        }
+                        if (outside) {
+                            continue;
+                        }
+                        if (inside) {
+                            num_kept[c] = num_rows;
+                            continue;
+                        }
+                        partial[c] = true;
+                        std::vector<char> &rows = chunk_positions[c];
+                        rows.resize(num_rows * positions_attr.row_bytes);
+                        DecodeO3DPCBlock(data, index_offset, block,
+                                         int64_t(rows.size()), rows.data());
+                        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(
+                                positions_attr.dtype, [&]() {
+                                    const scalar_t *xyz =
+                                            reinterpret_cast<const scalar_t *>(
+                                                    rows.data());
+                                    for (int64_t i = 0; i < num_rows; ++i) {
+                                        bool keep = true;
+                                        for (int d = 0; d < 3; ++d) {
+                                            const double v =
+                                                    double(xyz[3 * i + d]);
+                                            keep = keep &&
+                                                   v >= filter.min_bound(d) &&
+                                                   v <= filter.max_bound(d);
+                                        }
+                                        if (keep) kept_rows[c].push_back(i);
+                                    }
+                                });
+                        num_kept[c] = int64_t(kept_rows[c].size());
+                    }
+                },
+                1);
+        reporter.Update(1);
+
+        std::vector<int64_t> out_begin(num_chunks + 1, 0);
+        for (int64_t c = 0; c < num_chunks; ++c) {
+            out_begin[c + 1] = out_begin[c] + num_kept[c];
+        }
+        const int64_t num_out = out_begin[num_chunks];
+        std::vector<core::Tensor> out_attrs;
+        for (int64_t a : selected) {
+            const O3DPCAttribute &attr = index.attributes[a];
+            core::SizeVector shape{num_out};
+            shape.insert(shape.end(), attr.element_shape.begin(),
+                         attr.element_shape.end());
+            out_attrs.push_back(core::Tensor::Empty(shape, attr.dtype));
+        }
+
+        // Second pass: decode the selected blocks of the kept chunks. Whole
+        // chunks are decoded in place, the rows of straddling chunks are
+        // gathered.
+        utility::ParallelForRange(
+                num_chunks,
+                [&](int64_t begin, int64_t end) {
+                    std::vector<char> scratch;
+                    for (int64_t c = begin; c < end; ++c) {
+                        if (num_kept[c] == 0) continue;
+                        const int64_t num_rows = std::min(
+                                chunk_size, num_points - c * chunk_size);
+                        for (size_t s = 0; s < selected.size(); ++s) {
+                            const O3DPCAttribute &attr =
+                                    index.attributes[selected[s]];
+                            const O3DPCBlock &block =
+                                    index.blocks[c * num_attributes +
+                                                 selected[s]];
+                            char *dst = static_cast<char *>(
+                                                out_attrs[s].GetDataPtr()) +
+                                        out_begin[c] * attr.row_bytes;
+                            const int64_t raw_size = num_rows * attr.row_bytes;
+                            if (!partial[c]) {
+                                DecodeO3DPCBlock(data, index_offset, block,
+                                                 raw_size, dst);
+                                continue;
+                            }
+                            const char *rows = chunk_positions[c].data();
+                            if (selected[s] != positions_idx) {
+                                scratch.resize(raw_size);
+                                DecodeO3DPCBlock(data, index_offset, block,
+                                                 raw_size, scratch.data());
+                                rows = scratch.data();
+                            }
+                            for (size_t k = 0; k < kept_rows[c].size(); ++k) {
+                                std::memcpy(dst + k * attr.row_bytes,
+                                            rows + kept_rows[c][k] *
+                                                           attr.row_bytes,
+                                            attr.row_bytes);
+                            }
+                        }
+                    }
+                },
+                1);
+
+        pointcloud.Clear();
+        for (size_t s = 0; s < selected.size(); ++s) {
+            pointcloud.SetPointAttr(index.attributes[selected[s]].name,
+                                    out_attrs[s]);
+        }
+        reporter.Finish();
+        utility::LogDebug("Read O3DPC: kept {} of {} points, {} of {} chunks.",
+                          num_out, num_points,
+                          std::count_if(num_kept.begin(), num_kept.end(),
+                                        [](int64_t n) { return n > 0; }),
+                          num_chunks);
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read O3DPC failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool ReadPointCloudFromO3DPC(const std::string &filename,
+                             geometry::PointCloud &pointcloud,
+                             const ReadPointCloudOption &params) {
+    return ReadPointCloudFromO3DPCWithFilter(filename, pointcloud,
+                                             O3DPCReadFilter(), params);
+}
+
+bool WritePointCloudToO3DPCWithChunkSize(
+        const std::string &filename,
+        const geometry::PointCloud &pointcloud,
+        int64_t chunk_size,
+        const WritePointCloudOption &params) {
+    if (bool(params.write_ascii)) {
+        utility::LogError(
+                "PointCloud can't be saved in ASCII format as .o3dpc.");
+    }
+    if (chunk_size <= 0) {
+        utility::LogError("chunk_size must be positive, but got {}.",
+                          chunk_size);
+    }
+    if (!pointcloud.HasPointPositions()) {
+        utility::LogWarning(
+                "Write O3DPC failed: point cloud has no positions.");
+        return false;
+    }
+
+    try {
+        const int64_t num_points = pointcloud.GetPointPositions().GetLength();
+        // Positions come first, the other attributes in name order.
+        std::vector<std::string> names;
+        for (const auto &kv : pointcloud.GetPointAttr()) {
+            if (kv.first != "positions") names.push_back(kv.first);
+        }
+        std::sort(names.begin(), names.end());
+        names.insert(names.begin(), "positions");
+
+        std::vector<O3DPCAttribute> attributes;
+        std::vector<core::Tensor> tensors;
+        for (const std::string &name : names) {
+            const core::Tensor &tensor = pointcloud.GetPointAttr(name);
+            O3DPCAttribute attr;
+            if (!GetO3DPCDtype(tensor.GetDtype().ToString(), attr.dtype)) {
+                utility::LogWarning(
+                        "Write O3DPC: skipping attribute {} of unsupported "
+                        "dtype {}.",
+                        name, tensor.GetDtype().ToString());
+                continue;
+            }
+            const core::SizeVector shape = tensor.GetShape();
+            attr.name = name;
+            attr.element_shape =
+                    core::SizeVector(shape.begin() + 1, shape.end());
+            attr.channels = attr.element_shape.NumElements();
+            attr.row_bytes = attr.channels * attr.dtype.ByteSize();
+            attributes.push_back(attr);
+            tensors.push_back(
+                    tensor.To(core::Device("CPU:0")).Contiguous());
+        }
+
+        const int64_t num_attributes = int64_t(attributes.size());
+        const int64_t num_chunks = (num_points + chunk_size - 1) / chunk_size;
+        const bool compress = bool(params.compressed);
+        std::vector<O3DPCBlock> blocks(num_chunks * num_attributes);
+        std::vector<std::vector<char>> compressed(blocks.size());
+        utility::ParallelForRange(
+                int64_t(blocks.size()),
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t b = begin; b < end; ++b) {
+                        const int64_t c = b / num_attributes;
+                        const O3DPCAttribute &attr =
+                                attributes[b % num_attributes];
+                        const int64_t num_rows = std::min(
+                                chunk_size, num_points - c * chunk_size);
+                        const int64_t raw_size = num_rows * attr.row_bytes;
+                        const char *rows =
+                                static_cast<const char *>(
+                                        tensors[b % num_attributes]
+                                                .GetDataPtr()) +
+                                c * chunk_size * attr.row_bytes;
+                        O3DPCBlock &block = blocks[b];
+                        ComputeO3DPCBounds(attr, rows, num_rows, block.min,
+                                           block.max);
+                        block.codec = O3DPCCodec::Raw;
+                        block.size = uint64_t(raw_size);
+                        if (!compress || raw_size < 2 ||
+                            raw_size > std::numeric_limits<
+                                               unsigned int>::max()) {
+                            continue;
+                        }
+                        // Blocks that LZF does not shrink are stored raw.
+                        std::vector<char> &out = compressed[b];
+                        out.resize(raw_size - 1);
+                        const unsigned int size = lzf_compress(
+                                rows, (unsigned int)raw_size, out.data(),
+                                (unsigned int)out.size());
+                        if (size == 0) {
+                            out.clear();
+                            continue;
+                        }
+                        out.resize(size);
+                        block.codec = O3DPCCodec::LZF;
+                        block.size = size;
+                    }
+                },
+                1);
+
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "wb")) {
+            utility::LogWarning("Write O3DPC failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        uint64_t offset = 0;
+        auto write = [&](const void *ptr, uint64_t size) {
+            offset += size;
+            return fwrite(ptr, 1, size, file.GetFILE()) == size;
+        };
+        const std::vector<char> padding(kO3DPCAlignment, 0);
+        char header[kO3DPCHeaderSize] = {0};
+        bool ok = write(header, kO3DPCHeaderSize);
+
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_chunks);
+        for (int64_t c = 0; c < num_chunks && ok; ++c) {
+            for (int64_t a = 0; a < num_attributes && ok; ++a) {
+                const int64_t b = c * num_attributes + a;
+                const uint64_t padding_size =
+                        (kO3DPCAlignment - offset % kO3DPCAlignment) %
+                        kO3DPCAlignment;
+                ok = write(padding.data(), padding_size);
+                blocks[b].offset = offset;
+                const char *payload =
+                        blocks[b].codec == O3DPCCodec::LZF
+                                ? compressed[b].data()
+                                : static_cast<const char *>(
+                                          tensors[a].GetDataPtr()) +
+                                          c * chunk_size *
+                                                  attributes[a].row_bytes;
+                ok = ok && write(payload, blocks[b].size);
+            }
+            reporter.Update(c + 1);
+        }
+
+        IndexWriter index;
+        index.Put<uint64_t>(num_points);
+        index.Put<uint64_t>(chunk_size);
+        index.Put<uint64_t>(num_chunks);
+        index.Put<uint32_t>(uint32_t(num_attributes));
+        for (const O3DPCAttribute &attr : attributes) {
+            index.PutString(attr.name);
+            index.PutString(attr.dtype.ToString());
+            index.Put<uint32_t>(uint32_t(attr.element_shape.size()));
+            for (int64_t dim : attr.element_shape) {
+                index.Put<int64_t>(dim);
+            }
+        }
+        for (const O3DPCBlock &block : blocks) {
+            index.Put<uint64_t>(block.offset);
+            index.Put<uint64_t>(block.size);
+            index.Put<uint8_t>(uint8_t(block.codec));
+            for (double value : block.min) index.Put<double>(value);
+            for (double value : block.max) index.Put<double>(value);
+        }
+        const uint64_t index_offset = offset;
+        const std::vector<char> &index_buffer = index.GetBuffer();
+        ok = ok && write(index_buffer.data(), index_buffer.size());
+
+        std::memcpy(header, kO3DPCMagic, sizeof(kO3DPCMagic));
+        WriteLE<uint32_t>(header + 8, kO3DPCVersion);
+        WriteLE<uint64_t>(header + 16, index_offset);
+        WriteLE<uint64_t>(header + 24, uint64_t(index_buffer.size()));
+        ok = ok && fseek(file.GetFILE(), 0, SEEK_SET) == 0 &&
+             write(header, kO3DPCHeaderSize);
+        if (!ok) {
+            utility::LogWarning("Write O3DPC failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write O3DPC failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WritePointCloudToO3DPC(const std::string &filename,
+                            const geometry::PointCloud &pointcloud,
+                            const WritePointCloudOption &params) {
+    return WritePointCloudToO3DPCWithChunkSize(
+            filename, pointcloud, kO3DPCDefaultChunkSize, params);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
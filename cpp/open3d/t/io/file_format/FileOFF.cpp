@@ -0,0 +1,238 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadTriangleMeshFromOFF(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    try {
+        mesh.Clear();
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "rb")) {
+            utility::LogWarning("Read OFF failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        auto get_next_line = [&file]() -> std::string {
+            while (const char *line_buffer = file.ReadLine()) {
+                std::string line(line_buffer);
+                utility::StripString(line);
+                if (!line.empty() && line[0] != '#') {
+                    return line;
+                }
+            }
+            return "";
+        };
+
+        const std::string header = get_next_line();
+        if (header != "OFF" && header != "COFF" && header != "NOFF" &&
+            header != "CNOFF") {
+            utility::LogWarning(
+                    "Read OFF failed: header keyword '{}' not supported.",
+                    header);
+            return false;
+        }
+        int64_t num_vertices, num_faces, num_edges;
+        std::istringstream iss(get_next_line());
+        if (!(iss >> num_vertices >> num_faces >> num_edges)) {
+            utility::LogWarning("Read OFF failed: could not read file info.");
+            return false;
+        }
+        if (num_vertices <= 0 || num_faces <= 0) {
+            utility::LogWarning(
+                    "Read OFF failed: mesh has no vertices or faces.");
+            return false;
+        }
+        const int64_t start_pos = ftell(file.GetFILE());
+        file.Close();
+
+        const bool has_normals = header == "NOFF" || header == "CNOFF";
+        const bool has_colors = header == "COFF" || header == "CNOFF";
+        const int num_vertex_values = 3 + 3 * has_normals + 4 * has_colors;
+
+        // All numbers of the remaining lines and the number of numbers per
+        // line, collected per chunk of lines.
+        utility::CountingProgressReporter reporter(params.update_progress);
+        open3d::io::ParallelLineReader reader(filename, start_pos);
+        std::vector<std::vector<double>> chunk_values(reader.NumChunks());
+        std::vector<std::vector<int64_t>> chunk_row_sizes(reader.NumChunks());
+        reader.ForEachLine(
+                [&](int64_t chunk, const char *begin, const char *end) {
+                    std::vector<double> &values = chunk_values[chunk];
+                    const size_t size = values.size();
+                    double value;
+                    while (open3d::io::ParseDouble(begin, end, value)) {
+                        values.push_back(value);
+                    }
+                    // Blank and comment lines have no leading number.
+                    if (values.size() > size) {
+                        chunk_row_sizes[chunk].push_back(values.size() - size);
+                    }
+                },
+                &reporter);
+        const std::vector<double> values =
+                open3d::io::ConcatenateChunks(chunk_values);
+        const std::vector<int64_t> row_sizes =
+                open3d::io::ConcatenateChunks(chunk_row_sizes);
+        if (int64_t(row_sizes.size()) < num_vertices + num_faces) {
+            utility::LogWarning(
+                    "Read OFF failed: expected {} vertices and {} faces, but "
+                    "found {} lines.",
+                    num_vertices, num_faces, row_sizes.size());
+            return false;
+        }
+        std::vector<int64_t> row_begins(num_vertices + num_faces + 1, 0);
+        for (int64_t row = 0; row < num_vertices + num_faces; ++row) {
+            row_begins[row + 1] = row_begins[row] + row_sizes[row];
+        }
+
+        core::Tensor positions({num_vertices, 3}, core::Float32);
+        core::Tensor normals, colors;
+        float *positions_ptr = positions.GetDataPtr<float>();
+        float *normals_ptr = nullptr;
+        float *colors_ptr = nullptr;
+        if (has_normals) {
+            normals = core::Tensor({num_vertices, 3}, core::Float32);
+            normals_ptr = normals.GetDataPtr<float>();
+        }
+        if (has_colors) {
+            colors = core::Tensor({num_vertices, 3}, core::Float32);
+            colors_ptr = colors.GetDataPtr<float>();
+        }
+        std::atomic<bool> vertices_valid(true);
+        utility::ParallelForRange(num_vertices, [&](int64_t begin,
+                                                    int64_t end) {
+            for (int64_t v = begin; v < end; ++v) {
+                if (row_sizes[v] < num_vertex_values) {
+                    vertices_valid = false;
+                    return;
+                }
+                const double *row = values.data() + row_begins[v];
+                for (int c = 0; c < 3; ++c) {
+                    positions_ptr[3 * v + c] = float(row[c]);
+                }
+                row += 3;
+                if (normals_ptr) {
+                    for (int c = 0; c < 3; ++c) {
+                        normals_ptr[3 * v + c] = float(row[c]);
+                    }
+                    row += 3;
+                }
+                if (colors_ptr) {
+                    for (int c = 0; c < 3; ++c) {
+                        colors_ptr[3 * v + c] = float(row[c] / 255);
+                    }
+                }
+            }
+        });
+        if (!vertices_valid) {
+            utility::LogWarning(
+                    "Read OFF failed: could not read all vertex values.");
+            return false;
+        }
+
+        // Triangles are copied directly. Other polygons need the ear
+        // clipping of the legacy reader.
+        core::Tensor triangles({num_faces, 3}, core::Int64);
+        int64_t *triangles_ptr = triangles.GetDataPtr<int64_t>();
+        std::atomic<bool> faces_valid(true);
+        std::atomic<bool> all_triangles(true);
+        utility::ParallelForRange(num_faces, [&](int64_t begin, int64_t end) {
+            for (int64_t f = begin; f < end; ++f) {
+                const int64_t row = num_vertices + f;
+                const double *face = values.data() + row_begins[row];
+                if (face[0] != 3) {
+                    all_triangles = false;
+                    return;
+                }
+                if (row_sizes[row] < 4) {
+                    faces_valid = false;
+                    return;
+                }
+                for (int c = 0; c < 3; ++c) {
+                    const int64_t index = int64_t(face[c + 1]);
+                    if (index < 0 || index >= num_vertices) {
+                        faces_valid = false;
+                        return;
+                    }
+                    triangles_ptr[3 * f + c] = index;
+                }
+            }
+        });
+        if (!all_triangles) {
+            open3d::geometry::TriangleMesh legacy_mesh;
+            if (!open3d::io::ReadTriangleMeshFromOFF(filename, legacy_mesh,
+                                                     params)) {
+                return false;
+            }
+            mesh = geometry::TriangleMesh::FromLegacy(legacy_mesh);
+            return true;
+        }
+        if (!faces_valid) {
+            utility::LogWarning(
+                    "Read OFF failed: could not read all vertex indices.");
+            return false;
+        }
+
+        mesh.SetVertexPositions(positions);
+        if (has_normals) {
+            mesh.SetVertexNormals(normals);
+        }
+        if (has_colors) {
+            mesh.SetVertexColors(colors);
+        }
+        mesh.SetTriangleIndices(triangles);
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read OFF failed with exception: {}", e.what());
+        mesh.Clear();
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
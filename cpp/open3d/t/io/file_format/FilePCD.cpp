@@ -24,21 +24,29 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <fmt/format.h>
 #include <liblzf/lzf.h>
 
-#include <cinttypes>
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <iterator>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/ParallelFor.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/io/ParallelLineWriter.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudReader.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 // References for PCD file IO
@@ -468,23 +476,54 @@ static void ReadBinaryPCDElementsFromField(ReadAttributePtr &attr,
             });
 }
 
-static bool ReadPCDData(FILE *file,
-                        PCDHeader &header,
-                        t::geometry::PointCloud &pointcloud,
-                        const ReadPointCloudOption &params) {
-    // The header should have been checked
-    pointcloud.Clear();
-
-    std::unordered_map<std::string, ReadAttributePtr> map_field_to_attr_ptr;
+// Unpacks the column of a field of a binary_compressed PCD file, which stores
+// the values of all points contiguously, into its attribute.
+static void UnpackCompressedPCDField(ReadAttributePtr &attr,
+                                     const PCLPointField &field,
+                                     const char *base_ptr,
+                                     int num_points) {
+    const int64_t stride = field.size * field.count;
+    if (field.name == "rgb" || field.name == "rgba") {
+        utility::ParallelForRange(num_points, [&](int64_t begin, int64_t end) {
+            for (int64_t i = begin; i < end; ++i) {
+                ReadBinaryPCDColorsFromField(attr, field, base_ptr + i * stride,
+                                             static_cast<int>(i));
+            }
+        });
+        return;
+    }
+    DISPATCH_DTYPE_TO_TEMPLATE(
+            GetDtypeFromPCDHeaderField(field.type, field.size), [&] {
+                scalar_t *attr_data_ptr =
+                        static_cast<scalar_t *>(attr.data_ptr_) + attr.row_idx_;
+                const int64_t row_length = attr.row_length_;
+                utility::ParallelForRange(
+                        num_points, [&](int64_t begin, int64_t end) {
+                            for (int64_t i = begin; i < end; ++i) {
+                                std::memcpy(attr_data_ptr + i * row_length,
+                                            base_ptr + i * stride,
+                                            sizeof(scalar_t));
+                            }
+                        });
+            });
+}
 
+// Allocates the attributes of num_points points in pointcloud and maps the
+// fields of the header to them.
+static bool InitializePCDAttributes(
+        PCDHeader &header,
+        int num_points,
+        t::geometry::PointCloud &pointcloud,
+        std::unordered_map<std::string, ReadAttributePtr>
+                &map_field_to_attr_ptr) {
     if (header.has_attr["positions"]) {
         pointcloud.SetPointPositions(core::Tensor::Empty(
-                {header.points, 3}, header.attr_dtype["positions"]));
+                {num_points, 3}, header.attr_dtype["positions"]));
 
         void *data_ptr = pointcloud.GetPointPositions().GetDataPtr();
-        ReadAttributePtr position_x(data_ptr, 0, 3, header.points);
-        ReadAttributePtr position_y(data_ptr, 1, 3, header.points);
-        ReadAttributePtr position_z(data_ptr, 2, 3, header.points);
+        ReadAttributePtr position_x(data_ptr, 0, 3, num_points);
+        ReadAttributePtr position_y(data_ptr, 1, 3, num_points);
+        ReadAttributePtr position_z(data_ptr, 2, 3, num_points);
 
         map_field_to_attr_ptr.emplace(std::string("x"), position_x);
         map_field_to_attr_ptr.emplace(std::string("y"), position_y);
@@ -496,12 +535,12 @@ static bool ReadPCDData(FILE *file,
     }
     if (header.has_attr["normals"]) {
         pointcloud.SetPointNormals(core::Tensor::Empty(
-                {header.points, 3}, header.attr_dtype["normals"]));
+                {num_points, 3}, header.attr_dtype["normals"]));
 
         void *data_ptr = pointcloud.GetPointNormals().GetDataPtr();
-        ReadAttributePtr normal_x(data_ptr, 0, 3, header.points);
-        ReadAttributePtr normal_y(data_ptr, 1, 3, header.points);
-        ReadAttributePtr normal_z(data_ptr, 2, 3, header.points);
+        ReadAttributePtr normal_x(data_ptr, 0, 3, num_points);
+        ReadAttributePtr normal_y(data_ptr, 1, 3, num_points);
+        ReadAttributePtr normal_z(data_ptr, 2, 3, num_points);
 
         map_field_to_attr_ptr.emplace(std::string("normal_x"), normal_x);
         map_field_to_attr_ptr.emplace(std::string("normal_y"), normal_y);
@@ -511,10 +550,10 @@ static bool ReadPCDData(FILE *file,
         // Colors stored in a PCD file is ALWAYS in UInt8 format.
         // However it is stored as a single packed floating value.
         pointcloud.SetPointColors(
-                core::Tensor::Empty({header.points, 3}, core::UInt8));
+                core::Tensor::Empty({num_points, 3}, core::UInt8));
 
         void *data_ptr = pointcloud.GetPointColors().GetDataPtr();
-        ReadAttributePtr colors(data_ptr, 0, 3, header.points);
+        ReadAttributePtr colors(data_ptr, 0, 3, num_points);
 
         map_field_to_attr_ptr.emplace(std::string("colors"), colors);
     }
@@ -528,70 +567,141 @@ static bool ReadPCDData(FILE *file,
             field.name != "rgba") {
             pointcloud.SetPointAttr(
                     field.name,
-                    core::Tensor::Empty({header.points, 1},
+                    core::Tensor::Empty({num_points, 1},
                                         header.attr_dtype[field.name]));
 
             void *data_ptr = pointcloud.GetPointAttr(field.name).GetDataPtr();
-            ReadAttributePtr attr(data_ptr, 0, 1, header.points);
+            ReadAttributePtr attr(data_ptr, 0, 1, num_points);
 
             map_field_to_attr_ptr.emplace(field.name, attr);
         }
     }
+    return true;
+}
+
+// Looks up the attribute of every field of the header once, since the map
+// must not be modified concurrently.
+static std::vector<ReadAttributePtr *> GetPCDFieldAttributes(
+        const PCDHeader &header,
+        std::unordered_map<std::string, ReadAttributePtr>
+                &map_field_to_attr_ptr) {
+    std::vector<ReadAttributePtr *> field_attrs;
+    for (const auto &field : header.fields) {
+        const bool is_color = field.name == "rgb" || field.name == "rgba";
+        field_attrs.push_back(
+                &map_field_to_attr_ptr[is_color ? "colors" : field.name]);
+    }
+    return field_attrs;
+}
+
+// Reads the tokens of an ASCII PCD line into point idx.
+static void ReadASCIIPCDFields(const PCDHeader &header,
+                               const std::vector<ReadAttributePtr *> &attrs,
+                               const std::vector<std::string> &strs,
+                               int idx) {
+    for (size_t i = 0; i < header.fields.size(); ++i) {
+        const auto &field = header.fields[i];
+        if (field.name == "rgb" || field.name == "rgba") {
+            ReadASCIIPCDColorsFromField(*attrs[i], field,
+                                        strs[field.count_offset].c_str(), idx);
+        } else {
+            ReadASCIIPCDElementsFromField(
+                    *attrs[i], field, strs[field.count_offset].c_str(), idx);
+        }
+    }
+}
+
+// Reads num_points binary records from the current position of file.
+static bool ReadBinaryPCDRecords(
+        FILE *file,
+        const PCDHeader &header,
+        int num_points,
+        std::unordered_map<std::string, ReadAttributePtr>
+                &map_field_to_attr_ptr,
+        utility::CountingProgressReporter *reporter) {
+    std::unique_ptr<char[]> buffer(new char[header.pointsize]);
+    for (int i = 0; i < num_points; ++i) {
+        if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
+            utility::LogWarning("[ReadPCDData] Failed to read data record.");
+            return false;
+        }
+        for (const auto &field : header.fields) {
+            if (field.name == "rgb" || field.name == "rgba") {
+                ReadBinaryPCDColorsFromField(map_field_to_attr_ptr["colors"],
+                                             field, buffer.get() + field.offset,
+                                             i);
+            } else {
+                ReadBinaryPCDElementsFromField(
+                        map_field_to_attr_ptr[field.name], field,
+                        buffer.get() + field.offset, i);
+            }
+        }
+        if (reporter && i % 1000 == 0) {
+            reporter->Update(i);
+        }
+    }
+    return true;
+}
+
+static bool ReadPCDData(FILE *file,
+                        const std::string &filename,
+                        PCDHeader &header,
+                        t::geometry::PointCloud &pointcloud,
+                        const ReadPointCloudOption &params) {
+    // The header should have been checked
+    pointcloud.Clear();
+
+    std::unordered_map<std::string, ReadAttributePtr> map_field_to_attr_ptr;
+    if (!InitializePCDAttributes(header, header.points, pointcloud,
+                                 map_field_to_attr_ptr)) {
+        return false;
+    }
 
     utility::CountingProgressReporter reporter(params.update_progress);
     reporter.SetTotal(header.points);
 
     if (header.datatype == PCDDataType::ASCII) {
-        char line_buffer[DEFAULT_IO_BUFFER_SIZE];
-        int idx = 0;
-        while (fgets(line_buffer, DEFAULT_IO_BUFFER_SIZE, file) &&
-               idx < header.points) {
-            std::string line(line_buffer);
-            std::vector<std::string> strs =
-                    utility::SplitString(line, "\t\r\n ");
-            if ((int)strs.size() < header.elementnum) {
-                continue;
-            }
-            for (size_t i = 0; i < header.fields.size(); ++i) {
-                const auto &field = header.fields[i];
-                if (field.name == "rgb" || field.name == "rgba") {
-                    ReadASCIIPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            strs[field.count_offset].c_str(), idx);
-                } else {
-                    ReadASCIIPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            strs[field.count_offset].c_str(), idx);
-                }
-            }
-            ++idx;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        // Lines with fewer than elementnum tokens are skipped, the first
+        // header.points of the others hold the points. Both the search and
+        // the parsing of the lines run in parallel.
+        open3d::io::ParallelLineReader reader(filename, ftell(file));
+        std::vector<std::vector<std::pair<const char *, const char *>>>
+                chunk_lines(reader.NumChunks());
+        reader.ForEachLine(
+                [&](int64_t chunk, const char *begin, const char *end) {
+                    int num_tokens = 0;
+                    bool in_token = false;
+                    for (const char *p = begin; p < end; ++p) {
+                        const bool is_delimiter = *p == ' ' || *p == '\t' ||
+                                                  *p == '\r' || *p == '\n';
+                        num_tokens += !is_delimiter && !in_token;
+                        in_token = !is_delimiter;
+                    }
+                    if (num_tokens >= header.elementnum) {
+                        chunk_lines[chunk].emplace_back(begin, end);
+                    }
+                },
+                &reporter);
+        const std::vector<std::pair<const char *, const char *>> lines =
+                open3d::io::ConcatenateChunks(chunk_lines);
+
+        const std::vector<ReadAttributePtr *> field_attrs =
+                GetPCDFieldAttributes(header, map_field_to_attr_ptr);
+        const int num_lines = static_cast<int>(
+                std::min<int64_t>(lines.size(), header.points));
+        utility::ParallelForRange(num_lines, [&](int64_t begin, int64_t end) {
+            for (int64_t idx = begin; idx < end; ++idx) {
+                const std::vector<std::string> strs = utility::SplitString(
+                        std::string(lines[idx].first, lines[idx].second),
+                        "\t\r\n ");
+                ReadASCIIPCDFields(header, field_attrs, strs, int(idx));
             }
-        }
+        });
     } else if (header.datatype == PCDDataType::BINARY) {
-        std::unique_ptr<char[]> buffer(new char[header.pointsize]);
-        for (int i = 0; i < header.points; ++i) {
-            if (fread(buffer.get(), header.pointsize, 1, file) != 1) {
-                utility::LogWarning(
-                        "[ReadPCDData] Failed to read data record.");
-                pointcloud.Clear();
-                return false;
-            }
-            for (const auto &field : header.fields) {
-                if (field.name == "rgb" || field.name == "rgba") {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            buffer.get() + field.offset, i);
-                } else {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            buffer.get() + field.offset, i);
-                }
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
-            }
+        if (!ReadBinaryPCDRecords(file, header, header.points,
+                                  map_field_to_attr_ptr, &reporter)) {
+            pointcloud.Clear();
+            return false;
         }
     } else if (header.datatype == PCDDataType::BINARY_COMPRESSED) {
         double reporter_total = 100.0;
@@ -632,25 +742,27 @@ static bool ReadPCDData(FILE *file,
             pointcloud.Clear();
             return false;
         }
+        reporter.Update(int(reporter_total * .6));
+        // The fields are stored one after another, so each field is unpacked
+        // into its tensor independently. Resolve the attributes up front, the
+        // map must not be modified from the parallel loop.
+        std::vector<ReadAttributePtr *> field_attrs;
         for (const auto &field : header.fields) {
-            const char *base_ptr = buffer.get() + field.offset * header.points;
-            double progress =
-                    double(base_ptr - buffer.get()) / uncompressed_size;
-            reporter.Update(int(reporter_total * (progress + .2)));
-            if (field.name == "rgb" || field.name == "rgba") {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDColorsFromField(
-                            map_field_to_attr_ptr["colors"], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
-            } else {
-                for (int i = 0; i < header.points; ++i) {
-                    ReadBinaryPCDElementsFromField(
-                            map_field_to_attr_ptr[field.name], field,
-                            base_ptr + i * field.size * field.count, i);
-                }
-            }
+            const bool is_color = field.name == "rgb" || field.name == "rgba";
+            field_attrs.push_back(
+                    &map_field_to_attr_ptr[is_color ? "colors" : field.name]);
         }
+        utility::ParallelForRange(
+                static_cast<int64_t>(header.fields.size()),
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t f = begin; f < end; ++f) {
+                        const PCLPointField &field = header.fields[f];
+                        UnpackCompressedPCDField(
+                                *field_attrs[f], field,
+                                buffer.get() + field.offset * header.points,
+                                header.points);
+                    }
+                });
     }
     reporter.Finish();
     return true;
@@ -938,65 +1050,18 @@ static core::Tensor PackColorsToFloat(const core::Tensor &colors_contiguous) {
 }
 
 template <typename scalar_t>
-static int WriteElementDataToFileASCII(const scalar_t &data,
-                                       FILE *file) = delete;
-
-template <>
-int WriteElementDataToFileASCII<float>(const float &data, FILE *file) {
-    return fprintf(file, "%.10g ", data);
+static void AppendElementDataASCII(const scalar_t &data, std::string &text) {
+    fmt::format_to(std::back_inserter(text), "{} ", data);
 }
 
 template <>
-int WriteElementDataToFileASCII<double>(const double &data, FILE *file) {
-    return fprintf(file, "%.10g ", data);
+void AppendElementDataASCII<float>(const float &data, std::string &text) {
+    fmt::format_to(std::back_inserter(text), "{:.10g} ", data);
 }
 
 template <>
-int WriteElementDataToFileASCII<std::int8_t>(const std::int8_t &data,
-                                             FILE *file) {
-    return fprintf(file, "%" PRId8 " ", data);
-}
-
-template <>
-int WriteElementDataToFileASCII<std::int16_t>(const std::int16_t &data,
-                                              FILE *file) {
-    return fprintf(file, "%" PRId16 " ", data);
-}
-
-template <>
-int WriteElementDataToFileASCII<std::int32_t>(const std::int32_t &data,
-                                              FILE *file) {
-    return fprintf(file, "%" PRId32 " ", data);
-}
-
-template <>
-int WriteElementDataToFileASCII<std::int64_t>(const std::int64_t &data,
-                                              FILE *file) {
-    return fprintf(file, "%" PRId64 " ", data);
-}
-
-template <>
-int WriteElementDataToFileASCII<std::uint8_t>(const std::uint8_t &data,
-                                              FILE *file) {
-    return fprintf(file, "%" PRIu8 " ", data);
-}
-
-template <>
-int WriteElementDataToFileASCII<std::uint16_t>(const std::uint16_t &data,
-                                               FILE *file) {
-    return fprintf(file, "%" PRIu16 " ", data);
-}
-
-template <>
-int WriteElementDataToFileASCII<std::uint32_t>(const std::uint32_t &data,
-                                               FILE *file) {
-    return fprintf(file, "%" PRIu32 " ", data);
-}
-
-template <>
-int WriteElementDataToFileASCII<std::uint64_t>(const std::uint64_t &data,
-                                               FILE *file) {
-    return fprintf(file, "%" PRIu64 " ", data);
+void AppendElementDataASCII<double>(const double &data, std::string &text) {
+    fmt::format_to(std::back_inserter(text), "{:.10g} ", data);
 }
 
 static bool WritePCDData(FILE *file,
@@ -1044,24 +1109,29 @@ static bool WritePCDData(FILE *file,
     utility::CountingProgressReporter reporter(params.update_progress);
     reporter.SetTotal(num_points);
     if (header.datatype == PCDDataType::ASCII) {
-        for (std::int64_t i = 0; i < num_points; ++i) {
-            for (auto &it : attribute_ptrs) {
-                DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
-                    const scalar_t *data_ptr =
-                            static_cast<const scalar_t *>(it.data_ptr_);
-
-                    for (int idx_offset = it.group_size_ * i;
-                         idx_offset < it.group_size_ * (i + 1); ++idx_offset) {
-                        WriteElementDataToFileASCII<scalar_t>(
-                                data_ptr[idx_offset], file);
-                    }
-                });
-            }
-
-            fprintf(file, "\n");
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        auto format_lines = [&](int64_t begin, int64_t end,
+                                std::string &text) {
+            for (std::int64_t i = begin; i < end; ++i) {
+                for (auto &it : attribute_ptrs) {
+                    DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
+                        const scalar_t *data_ptr =
+                                static_cast<const scalar_t *>(it.data_ptr_);
+
+                        for (int idx_offset = it.group_size_ * i;
+                             idx_offset < it.group_size_ * (i + 1);
+                             ++idx_offset) {
+                            AppendElementDataASCII<scalar_t>(
+                                    data_ptr[idx_offset], text);
+                        }
+                    });
+                }
+                text += '\n';
             }
+        };
+        if (!open3d::io::WriteLinesInParallel(file, num_points, format_lines,
+                                              &reporter)) {
+            utility::LogWarning("Write PCD failed: unable to write data.");
+            return false;
         }
     } else if (header.datatype == PCDDataType::BINARY) {
         std::vector<char> buffer((header.pointsize * header.points));
@@ -1106,35 +1176,69 @@ static bool WritePCDData(FILE *file,
         std::vector<char> buffer(buffer_size_in_bytes);
         std::vector<char> buffer_compressed(2 * buffer_size_in_bytes);
 
-        std::uint32_t buffer_index = 0;
-        std::int64_t count = 0;
+        // Each column starts at a fixed offset, so the columns are packed
+        // independently.
+        std::int64_t buffer_index = 0;
         for (auto &it : attribute_ptrs) {
             DISPATCH_DTYPE_TO_TEMPLATE(it.dtype_, [&]() {
                 const scalar_t *data_ptr =
                         static_cast<const scalar_t *>(it.data_ptr_);
-
-                for (int idx_offset = 0; idx_offset < it.group_size_;
+                const int group_size = it.group_size_;
+                for (int idx_offset = 0; idx_offset < group_size;
                      ++idx_offset) {
-                    for (std::int64_t i = 0; i < num_points; ++i) {
-                        std::memcpy(buffer.data() + buffer_index,
-                                    reinterpret_cast<const char *>(
-                                            &data_ptr[i * it.group_size_ +
-                                                      idx_offset]),
-                                    sizeof(scalar_t));
-                        buffer_index += sizeof(scalar_t);
-                    }
+                    char *column_ptr = buffer.data() + buffer_index;
+                    utility::ParallelForRange(
+                            num_points, [&](int64_t begin, int64_t end) {
+                                for (int64_t i = begin; i < end; ++i) {
+                                    const scalar_t &value =
+                                            data_ptr[i * group_size +
+                                                     idx_offset];
+                                    std::memcpy(column_ptr +
+                                                        i * sizeof(scalar_t),
+                                                &value, sizeof(scalar_t));
+                                }
+                            });
+                    buffer_index += num_points * sizeof(scalar_t);
                 }
             });
-
-            reporter.Update(count++);
         }
-
-        std::uint32_t size_compressed = lzf_compress(
-                buffer.data(), buffer_size_in_bytes, buffer_compressed.data(),
-                buffer_size_in_bytes * 2);
-        if (size_compressed == 0) {
-            utility::LogWarning("[WritePCDData] Failed to compress data.");
-            return false;
+        reporter.Update(static_cast<std::int64_t>(report_total * 0.5));
+
+        // LZF back-references are relative to the current output position
+        // and never cross the start of the input, so independently compressed
+        // blocks concatenate into one valid LZF stream. Each block gets twice
+        // its size in buffer_compressed, which LZF can not exceed.
+        const std::int64_t block_size = 1 << 20;
+        const std::int64_t num_blocks =
+                (buffer_size_in_bytes + block_size - 1) / block_size;
+        std::vector<unsigned int> block_sizes_compressed(num_blocks, 0);
+        utility::ParallelForRange(
+                num_blocks,
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t b = begin; b < end; ++b) {
+                        const std::int64_t offset = b * block_size;
+                        const unsigned int len =
+                                static_cast<unsigned int>(std::min(
+                                        block_size,
+                                        buffer_size_in_bytes - offset));
+                        block_sizes_compressed[b] = lzf_compress(
+                                buffer.data() + offset, len,
+                                buffer_compressed.data() + 2 * offset, 2 * len);
+                    }
+                },
+                1);
+        std::uint32_t size_compressed = 0;
+        for (std::int64_t b = 0; b < num_blocks; ++b) {
+            if (block_sizes_compressed[b] == 0) {
+                utility::LogWarning("[WritePCDData] Failed to compress data.");
+                return false;
+            }
+            // Compact the blocks in order. The destination never overtakes
+            // the source, as every block starts at twice its input offset.
+            std::memmove(buffer_compressed.data() + size_compressed,
+                         buffer_compressed.data() + 2 * b * block_size,
+                         block_sizes_compressed[b]);
+            size_compressed += block_sizes_compressed[b];
         }
 
         utility::LogDebug(
@@ -1151,6 +1255,90 @@ static bool WritePCDData(FILE *file,
     return true;
 }
 
+namespace {
+
+// Reads the points of an ASCII or binary PCD file chunk by chunk. Compressed
+// files store the fields one after another, so they can not be streamed.
+class PCDPointCloudSource : public PointCloudReader::Source {
+public:
+    bool Open(const std::string &filename) {
+        if (!file_.Open(filename, "rb") ||
+            !ReadPCDHeader(file_.GetFILE(), header_)) {
+            return false;
+        }
+        return header_.datatype != PCDDataType::BINARY_COMPRESSED &&
+               header_.has_attr["positions"];
+    }
+
+    int64_t GetNumPoints() const override { return header_.points; }
+
+    bool ReadNext(int64_t max_points,
+                  geometry::PointCloud &pointcloud) override {
+        const int num_points = static_cast<int>(
+                std::min<int64_t>(max_points, header_.points - position_));
+        pointcloud.Clear();
+        if (num_points <= 0) {
+            return true;
+        }
+        std::unordered_map<std::string, ReadAttributePtr>
+                map_field_to_attr_ptr;
+        InitializePCDAttributes(header_, num_points, pointcloud,
+                                map_field_to_attr_ptr);
+
+        if (header_.datatype == PCDDataType::BINARY) {
+            if (!ReadBinaryPCDRecords(file_.GetFILE(), header_, num_points,
+                                      map_field_to_attr_ptr, nullptr)) {
+                pointcloud.Clear();
+                return false;
+            }
+            position_ += num_points;
+            return true;
+        }
+
+        // As in ReadPCDData(), lines with fewer than elementnum tokens are
+        // skipped.
+        const std::vector<ReadAttributePtr *> field_attrs =
+                GetPCDFieldAttributes(header_, map_field_to_attr_ptr);
+        int num_read = 0;
+        const char *line;
+        while (num_read < num_points && (line = file_.ReadLine())) {
+            const std::vector<std::string> strs =
+                    utility::SplitString(line, "\t\r\n ");
+            if (static_cast<int>(strs.size()) >= header_.elementnum) {
+                ReadASCIIPCDFields(header_, field_attrs, strs, num_read++);
+            }
+        }
+        position_ += num_points;
+        if (num_read < num_points) {
+            // The file holds fewer points than its header declares.
+            position_ = header_.points;
+            geometry::PointCloud read_points;
+            for (const auto &kv : pointcloud.GetPointAttr()) {
+                read_points.SetPointAttr(kv.first,
+                                         kv.second.Slice(0, 0, num_read));
+            }
+            pointcloud = num_read > 0 ? read_points : geometry::PointCloud();
+        }
+        return true;
+    }
+
+private:
+    utility::filesystem::CFile file_;
+    PCDHeader header_;
+    int64_t position_ = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<PointCloudReader::Source> CreatePointCloudSourceFromPCD(
+        const std::string &filename) {
+    auto source = std::make_unique<PCDPointCloudSource>();
+    if (!source->Open(filename)) {
+        return nullptr;
+    }
+    return source;
+}
+
 bool ReadPointCloudFromPCD(const std::string &filename,
                            t::geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
@@ -1180,7 +1368,7 @@ bool ReadPointCloudFromPCD(const std::string &filename,
                       header.has_attr["positions"] ? "yes" : "no",
                       header.has_attr["normals"] ? "yes" : "no",
                       header.has_attr["colors"] ? "yes" : "no");
-    if (!ReadPCDData(file, header, pointcloud, params)) {
+    if (!ReadPCDData(file, filename, header, pointcloud, params)) {
         utility::LogWarning("Read PCD failed: unable to read data.");
         fclose(file);
         return false;
@@ -26,15 +26,24 @@
 
 #include <rply.h>
 
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <unordered_set>
 #include <vector>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/io/MappedFile.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudReader.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -171,9 +180,251 @@ static std::tuple<std::string, int, int> GetNameStrideOffsetForAttribute(
     return std::make_tuple(name, 1, 0);
 }
 
+// Byte layout of the "vertex" element of a binary little endian PLY file.
+struct PLYBinaryVertexLayout {
+    struct Property {
+        std::string name_;
+        core::Dtype dtype_;
+        std::string type_name_;
+        int64_t offset_;
+    };
+    std::vector<Property> properties_;
+    int64_t data_offset_ = 0;
+    int64_t num_vertices_ = 0;
+    int64_t vertex_size_ = 0;
+};
+
+// Same dtypes as GetDtype() for the type names rply maps to them.
+static std::pair<int64_t, core::Dtype> GetPlyTypeSizeAndDtype(
+        const std::string &type_name) {
+    if (type_name == "uint8" || type_name == "uchar") return {1, core::UInt8};
+    if (type_name == "int8" || type_name == "char") return {1, core::Undefined};
+    if (type_name == "uint16") return {2, core::UInt16};
+    if (type_name == "int16" || type_name == "short" || type_name == "ushort") {
+        return {2, core::Undefined};
+    }
+    if (type_name == "int32" || type_name == "int") return {4, core::Int32};
+    if (type_name == "uint32" || type_name == "uint") {
+        return {4, core::Undefined};
+    }
+    if (type_name == "float32" || type_name == "float") {
+        return {4, core::Float32};
+    }
+    if (type_name == "float64" || type_name == "double") {
+        return {8, core::Float64};
+    }
+    return {0, core::Undefined};
+}
+
+// Parses the header of a PLY file. Returns false if the file is not binary
+// little endian, or if the vertex element or any element before it has list
+// properties, i.e. if the vertices are not stored with a fixed stride at a
+// known offset.
+static bool ParsePLYBinaryVertexLayout(const std::string &filename,
+                                       PLYBinaryVertexLayout &layout) {
+    const uint16_t endian_probe = 1;
+    if (*reinterpret_cast<const uint8_t *>(&endian_probe) != 1) {
+        return false;
+    }
+    std::ifstream file(filename, std::ios::binary);
+    std::string line;
+    if (!file || !std::getline(file, line) || line.compare(0, 3, "ply")) {
+        return false;
+    }
+
+    bool is_binary_little_endian = false;
+    bool in_vertex = false;
+    bool vertex_found = false;
+    int64_t element_size = 0;
+    int64_t element_count = 0;
+    int64_t offset = 0;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+        if (keyword == "format") {
+            std::string format;
+            tokens >> format;
+            is_binary_little_endian = format == "binary_little_endian";
+        } else if (keyword == "element") {
+            if (vertex_found) {
+                in_vertex = false;
+                continue;
+            }
+            offset += element_size * element_count;
+            std::string name;
+            element_size = 0;
+            element_count = -1;
+            tokens >> name >> element_count;
+            if (element_count < 0) return false;
+            in_vertex = name == "vertex";
+            vertex_found = in_vertex;
+        } else if (keyword == "property") {
+            if (vertex_found && !in_vertex) continue;
+            std::string type_name, name;
+            tokens >> type_name >> name;
+            const auto size_dtype = GetPlyTypeSizeAndDtype(type_name);
+            if (type_name == "list" || size_dtype.first == 0) return false;
+            if (in_vertex) {
+                layout.properties_.push_back(
+                        {name, size_dtype.second, type_name, element_size});
+            }
+            element_size += size_dtype.first;
+        } else if (keyword == "end_header") {
+            if (!is_binary_little_endian || !vertex_found) return false;
+            layout.data_offset_ = static_cast<int64_t>(file.tellg()) + offset;
+            layout.num_vertices_ = element_count;
+            layout.vertex_size_ = element_size;
+            file.seekg(0, std::ios::end);
+            const int64_t file_size = static_cast<int64_t>(file.tellg());
+            return layout.data_offset_ +
+                           layout.num_vertices_ * layout.vertex_size_ <=
+                   file_size;
+        }
+    }
+    return false;
+}
+
+// Reads the vertices [begin, begin + num_vertices) of a PLY file described by
+// layout, by mapping the file and gathering the properties of all vertices in
+// parallel instead of going through rply callbacks scalar by scalar. Packed
+// records such as float xyz followed by uchar rgb are not aligned for strided
+// tensor views, so every property is copied into its contiguous attribute
+// tensor byte-wise.
+static void ReadPointCloudFromMappedPLY(const std::string &filename,
+                                        const PLYBinaryVertexLayout &layout,
+                                        int64_t begin,
+                                        int64_t num_vertices,
+                                        geometry::PointCloud &pointcloud) {
+    struct Copy {
+        int64_t src_offset_;
+        int64_t dst_offset_;
+        int64_t dst_stride_;
+        int64_t size_;
+        uint8_t *dst_ptr_;
+    };
+    std::unordered_set<std::string> initialized_attrs;
+    std::vector<Copy> copies;
+    for (const auto &property : layout.properties_) {
+        if (property.dtype_ == core::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_, property.type_name_);
+            continue;
+        }
+        std::string attr_name;
+        int stride, channel;
+        std::tie(attr_name, stride, channel) =
+                GetNameStrideOffsetForAttribute(property.name_);
+        if (initialized_attrs.insert(attr_name).second) {
+            pointcloud.SetPointAttr(
+                    attr_name, core::Tensor::Empty({num_vertices, stride},
+                                                   property.dtype_));
+        }
+        core::Tensor attr = pointcloud.GetPointAttr(attr_name);
+        if (attr.GetDtype() != property.dtype_) {
+            utility::LogError(
+                    "Property {} ({}) does not have the same dtype as the "
+                    "other channels of {} ({}).",
+                    property.name_, property.dtype_.ToString(), attr_name,
+                    attr.GetDtype().ToString());
+        }
+        const int64_t size = property.dtype_.ByteSize();
+        copies.push_back({property.offset_, channel * size, stride * size,
+                          size, static_cast<uint8_t *>(attr.GetDataPtr())});
+    }
+
+    if (num_vertices > 0) {
+        const std::shared_ptr<core::Blob> blob = MapFileRegion(
+                filename, layout.data_offset_ + begin * layout.vertex_size_,
+                num_vertices * layout.vertex_size_);
+        const uint8_t *src_ptr =
+                static_cast<const uint8_t *>(blob->GetDataPtr());
+        const int64_t vertex_size = layout.vertex_size_;
+        utility::ParallelForRange(
+                num_vertices, [&](int64_t begin, int64_t end) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        const uint8_t *src = src_ptr + i * vertex_size;
+                        for (const Copy &copy : copies) {
+                            std::memcpy(copy.dst_ptr_ + i * copy.dst_stride_ +
+                                                copy.dst_offset_,
+                                        src + copy.src_offset_, copy.size_);
+                        }
+                    }
+                });
+    }
+}
+
+namespace {
+
+// Reads the vertices of a PLY file with a fixed vertex layout chunk by chunk,
+// mapping only the records of the current chunk.
+class PLYPointCloudSource : public PointCloudReader::Source {
+public:
+    PLYPointCloudSource(const std::string &filename,
+                        const PLYBinaryVertexLayout &layout)
+        : filename_(filename), layout_(layout) {}
+
+    int64_t GetNumPoints() const override { return layout_.num_vertices_; }
+
+    bool ReadNext(int64_t max_points,
+                  geometry::PointCloud &pointcloud) override {
+        const int64_t num_vertices =
+                std::min(max_points, layout_.num_vertices_ - position_);
+        pointcloud.Clear();
+        if (num_vertices > 0) {
+            ReadPointCloudFromMappedPLY(filename_, layout_, position_,
+                                        num_vertices, pointcloud);
+            position_ += num_vertices;
+        }
+        return true;
+    }
+
+private:
+    std::string filename_;
+    PLYBinaryVertexLayout layout_;
+    int64_t position_ = 0;
+};
+
+}  // namespace
+
+std::unique_ptr<PointCloudReader::Source> CreatePointCloudSourceFromPLY(
+        const std::string &filename) {
+    PLYBinaryVertexLayout layout;
+    if (!ParsePLYBinaryVertexLayout(filename, layout)) {
+        return nullptr;
+    }
+    // Warn about the skipped properties once, not for every chunk.
+    std::vector<PLYBinaryVertexLayout::Property> properties;
+    for (const auto &property : layout.properties_) {
+        if (property.dtype_ == core::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_, property.type_name_);
+        } else {
+            properties.push_back(property);
+        }
+    }
+    layout.properties_ = properties;
+    return std::make_unique<PLYPointCloudSource>(filename, layout);
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    PLYBinaryVertexLayout layout;
+    if (ParsePLYBinaryVertexLayout(filename, layout)) {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(layout.num_vertices_);
+        ReadPointCloudFromMappedPLY(filename, layout, 0, layout.num_vertices_,
+                                    pointcloud);
+        reporter.Finish();
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
@@ -25,13 +25,18 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <fmt/format.h>
+#include <iterator>
 
 #include "open3d/core/TensorCheck.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/io/ParallelLineWriter.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressReporters.h"
 
 namespace open3d {
@@ -73,7 +78,6 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             return true;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(num_points);
 
         // Store data start position.
         int64_t start_pos = ftell(file.GetFILE());
@@ -136,60 +140,40 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             }
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
+        file.Close();
 
-        int64_t idx = 0;
-        while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
-            }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
+        std::vector<double> values;
+        if (num_fields > 0) {
+            open3d::io::ParallelLineReader reader(filename, start_pos);
+            std::string invalid_line;
+            if (!open3d::io::ParseRows(reader, int(num_fields), num_points,
+                                       values, invalid_line, &reporter)) {
+                utility::LogWarning("Read PTS failed at line: {}",
+                                    invalid_line);
                 return false;
             }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
-            }
         }
-
+        const int64_t num_rows =
+                num_fields > 0 ? int64_t(values.size() / num_fields) : 0;
+        utility::ParallelForRange(num_rows, [&](int64_t begin, int64_t end) {
+            for (int64_t idx = begin; idx < end; ++idx) {
+                const double *row = values.data() + idx * num_fields;
+                points_ptr[3 * idx + 0] = row[0];
+                points_ptr[3 * idx + 1] = row[1];
+                points_ptr[3 * idx + 2] = row[2];
+                // X Y Z I R G B or X Y Z I.
+                if (intensities_ptr) {
+                    intensities_ptr[idx] = row[3];
+                }
+                // R G B are the last three fields.
+                if (colors_ptr) {
+                    const double *color = row + num_fields - 3;
+                    colors_ptr[3 * idx + 0] = int(color[0]);
+                    colors_ptr[3 * idx + 1] = int(color[1]);
+                    colors_ptr[3 * idx + 2] = int(color[2]);
+                }
+            }
+        });
         reporter.Finish();
         return true;
     } catch (const std::exception &e) {
@@ -251,99 +235,65 @@ bool WritePointCloudToPTS(const std::string &filename,
             return false;
         }
 
+        // Keep the converted tensors alive while the lines are formatted.
+        core::Tensor points, intensities, colors;
         const double *points_ptr = nullptr;
         const double *intensities_ptr = nullptr;
         const uint8_t *colors_ptr = nullptr;
-        core::Tensor colors;
-
         if (num_points > 0) {
-            points_ptr = pointcloud.GetPointPositions()
-                                 .To(core::Float64)
-                                 .GetDataPtr<double>();
+            points = pointcloud.GetPointPositions()
+                             .To(core::Float64)
+                             .Contiguous();
+            points_ptr = points.GetDataPtr<double>();
         }
-
-        // X Y Z I R G B.
-        if (pointcloud.HasPointColors() &&
-            pointcloud.HasPointAttr("intensities")) {
-            colors = ConvertColorTensorToUint8(pointcloud.GetPointColors());
-            colors_ptr = colors.GetDataPtr<uint8_t>();
-            intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                      .To(core::Float64)
-                                      .GetDataPtr<double>();
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(),
-                            "%.10f %.10f %.10f %.10f %d %d %d\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2], intensities_ptr[i],
-                            colors_ptr[3 * i + 0], colors_ptr[3 * i + 1],
-                            colors_ptr[3 * i + 2]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
-                }
-            }
+        if (num_points > 0 && pointcloud.HasPointAttr("intensities")) {
+            intensities = pointcloud.GetPointAttr("intensities")
+                                  .To(core::Float64)
+                                  .Contiguous();
+            intensities_ptr = intensities.GetDataPtr<double>();
         }
-        // X Y Z R G B.
-        else if (pointcloud.HasPointColors()) {
-            colors = ConvertColorTensorToUint8(pointcloud.GetPointColors());
+        if (num_points > 0 && pointcloud.HasPointColors()) {
+            colors = ConvertColorTensorToUint8(pointcloud.GetPointColors())
+                             .Contiguous();
             colors_ptr = colors.GetDataPtr<uint8_t>();
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %d %d %d\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2], colors_ptr[3 * i + 0],
-                            colors_ptr[3 * i + 1], colors_ptr[3 * i + 2]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
-                }
-            }
         }
-        // X Y Z I.
-        else if (pointcloud.HasPointAttr("intensities")) {
-            intensities_ptr = pointcloud.GetPointAttr("intensities")
-                                      .To(core::Float64)
-                                      .GetDataPtr<double>();
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2], intensities_ptr[i]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
 
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
-                }
-            }
-        }
-        // X Y Z.
-        else {
-            for (int i = 0; i < num_points; i++) {
-                if (fprintf(file.GetFILE(), "%.10f %.10f %.10f\r\n",
-                            points_ptr[3 * i + 0], points_ptr[3 * i + 1],
-                            points_ptr[3 * i + 2]) < 0) {
-                    utility::LogWarning(
-                            "Write PTS failed: unable to write file: {}",
-                            filename);
-                    return false;
-                }
-
-                if (i % 1000 == 0) {
-                    reporter.Update(i);
+        auto format_lines = [&](int64_t begin, int64_t end,
+                                std::string &text) {
+            auto out = std::back_inserter(text);
+            for (int64_t i = begin; i < end; i++) {
+                const double *point = points_ptr + 3 * i;
+                const uint8_t *color = colors_ptr + 3 * i;
+                if (colors_ptr && intensities_ptr) {
+                    // X Y Z I R G B.
+                    fmt::format_to(out,
+                                   "{:.10f} {:.10f} {:.10f} {:.10f} {} {} "
+                                   "{}\r\n",
+                                   point[0], point[1], point[2],
+                                   intensities_ptr[i], color[0], color[1],
+                                   color[2]);
+                } else if (colors_ptr) {
+                    // X Y Z R G B.
+                    fmt::format_to(out, "{:.10f} {:.10f} {:.10f} {} {} {}\r\n",
+                                   point[0], point[1], point[2], color[0],
+                                   color[1], color[2]);
+                } else if (intensities_ptr) {
+                    // X Y Z I.
+                    fmt::format_to(out, "{:.10f} {:.10f} {:.10f} {:.10f}\r\n",
+                                   point[0], point[1], point[2],
+                                   intensities_ptr[i]);
+                } else {
+                    // X Y Z.
+                    fmt::format_to(out, "{:.10f} {:.10f} {:.10f}\r\n",
+                                   point[0], point[1], point[2]);
                 }
             }
+        };
+        if (!open3d::io::WriteLinesInParallel(file.GetFILE(), num_points,
+                                              format_lines, &reporter)) {
+            utility::LogWarning("Write PTS failed: unable to write file: {}",
+                                filename);
+            return false;
         }
 
         reporter.Finish();
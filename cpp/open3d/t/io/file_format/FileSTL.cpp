@@ -0,0 +1,251 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/t/io/MappedFile.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ProgressReporters.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+constexpr int64_t kSTLHeaderSize = 84;
+constexpr int64_t kSTLTriangleSize = 50;
+
+/// Merge the corners of all triangles with bitwise equal positions in one
+/// hash map pass. \p corners holds 3 positions per triangle.
+void SetMeshFromTriangleCorners(const std::vector<float> &corners,
+                                geometry::TriangleMesh &mesh) {
+    typedef Eigen::Matrix<uint32_t, 3, 1> Key;
+    const int64_t num_corners = int64_t(corners.size() / 3);
+    std::vector<Key> keys(num_corners);
+    utility::ParallelForRange(num_corners, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            for (int c = 0; c < 3; ++c) {
+                // Adding +0 turns -0 into +0, so both get the same key.
+                const float value = corners[3 * i + c] + 0.0f;
+                std::memcpy(&keys[i](c), &value, sizeof(float));
+            }
+        }
+    });
+
+    std::unordered_map<Key, int64_t, utility::hash_eigen<Key>> key_to_index;
+    key_to_index.reserve(num_corners / 2);
+    core::Tensor indices({num_corners / 3, 3}, core::Int64);
+    int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+    std::vector<int64_t> first_corner;
+    first_corner.reserve(num_corners / 2);
+    for (int64_t i = 0; i < num_corners; ++i) {
+        auto it = key_to_index.emplace(keys[i], int64_t(first_corner.size()));
+        if (it.second) {
+            first_corner.push_back(i);
+        }
+        indices_ptr[i] = it.first->second;
+    }
+    std::vector<Key>().swap(keys);
+
+    const int64_t num_vertices = int64_t(first_corner.size());
+    core::Tensor positions({num_vertices, 3}, core::Float32);
+    float *positions_ptr = positions.GetDataPtr<float>();
+    utility::ParallelForRange(num_vertices, [&](int64_t begin, int64_t end) {
+        for (int64_t v = begin; v < end; ++v) {
+            std::memcpy(positions_ptr + 3 * v,
+                        corners.data() + 3 * first_corner[v],
+                        3 * sizeof(float));
+        }
+    });
+    mesh.SetVertexPositions(positions);
+    mesh.SetTriangleIndices(indices);
+}
+
+bool ReadBinarySTL(const std::string &filename,
+                   int64_t num_triangles,
+                   geometry::TriangleMesh &mesh,
+                   utility::CountingProgressReporter &reporter) {
+    if (num_triangles == 0) {
+        utility::LogWarning("Read STL failed: mesh has no triangles.");
+        return false;
+    }
+    reporter.SetTotal(num_triangles);
+    std::shared_ptr<core::Blob> blob = MapFileRegion(
+            filename, kSTLHeaderSize, num_triangles * kSTLTriangleSize);
+    const char *data = static_cast<const char *>(blob->GetDataPtr());
+
+    // Each record is a normal, three corners and a 2 byte attribute count.
+    std::vector<float> corners(9 * num_triangles);
+    core::Tensor normals({num_triangles, 3}, core::Float32);
+    float *normals_ptr = normals.GetDataPtr<float>();
+    utility::ParallelForRange(num_triangles, [&](int64_t begin, int64_t end) {
+        for (int64_t t = begin; t < end; ++t) {
+            const char *record = data + t * kSTLTriangleSize;
+            std::memcpy(normals_ptr + 3 * t, record, 3 * sizeof(float));
+            std::memcpy(corners.data() + 9 * t, record + 3 * sizeof(float),
+                        9 * sizeof(float));
+        }
+    });
+    reporter.Update(num_triangles);
+
+    SetMeshFromTriangleCorners(corners, mesh);
+    mesh.SetTriangleNormals(normals);
+    return true;
+}
+
+bool ReadASCIISTL(const std::string &filename,
+                  geometry::TriangleMesh &mesh,
+                  utility::CountingProgressReporter &reporter) {
+    auto starts_with = [](const char *&begin, const char *end,
+                          const char *keyword) {
+        const size_t size = std::strlen(keyword);
+        if (size_t(end - begin) < size ||
+            std::strncmp(begin, keyword, size) != 0) {
+            return false;
+        }
+        begin += size;
+        return true;
+    };
+
+    open3d::io::ParallelLineReader reader(filename);
+    std::vector<std::vector<float>> chunk_corners(reader.NumChunks());
+    std::vector<std::vector<float>> chunk_normals(reader.NumChunks());
+    std::vector<char> chunk_valid(reader.NumChunks(), 1);
+    reader.ForEachLine(
+            [&](int64_t chunk, const char *begin, const char *end) {
+                while (begin < end && (*begin == ' ' || *begin == '\t')) {
+                    ++begin;
+                }
+                std::vector<float> *values;
+                if (starts_with(begin, end, "vertex")) {
+                    values = &chunk_corners[chunk];
+                } else if (starts_with(begin, end, "facet normal")) {
+                    values = &chunk_normals[chunk];
+                } else {
+                    return;
+                }
+                double xyz[3];
+                if (open3d::io::ParseDoubles(begin, end, xyz, 3) != 3) {
+                    chunk_valid[chunk] = 0;
+                    return;
+                }
+                values->insert(values->end(), xyz, xyz + 3);
+            },
+            &reporter);
+    for (char valid : chunk_valid) {
+        if (!valid) {
+            utility::LogWarning(
+                    "Read STL failed: could not read all vertex values.");
+            return false;
+        }
+    }
+
+    const std::vector<float> corners =
+            open3d::io::ConcatenateChunks(chunk_corners);
+    const std::vector<float> normals =
+            open3d::io::ConcatenateChunks(chunk_normals);
+    const int64_t num_triangles = int64_t(corners.size() / 9);
+    if (corners.size() % 9 != 0 ||
+        int64_t(normals.size()) != 3 * num_triangles) {
+        utility::LogWarning(
+                "Read STL failed: facets must have one normal and three "
+                "vertices.");
+        return false;
+    }
+    SetMeshFromTriangleCorners(corners, mesh);
+    mesh.SetTriangleNormals(
+            core::Tensor(normals, {num_triangles, 3}, core::Float32));
+    return true;
+}
+
+}  // namespace
+
+bool ReadTriangleMeshFromSTL(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params) {
+    try {
+        mesh.Clear();
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "rb")) {
+            utility::LogWarning("Read STL failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        const int64_t file_size = file.GetFileSize();
+        char header[kSTLHeaderSize] = {0};
+        const size_t header_size =
+                fread(header, 1, kSTLHeaderSize, file.GetFILE());
+        const bool has_header = header_size == size_t(kSTLHeaderSize);
+        file.Close();
+
+        utility::CountingProgressReporter reporter(params.update_progress);
+        // ASCII files may also start with "solid", so the triangle count
+        // must match the file size for a binary file.
+        uint32_t num_triangles = 0;
+        if (has_header) {
+            std::memcpy(&num_triangles, header + 80, sizeof(uint32_t));
+        }
+        bool success;
+        if (has_header &&
+            file_size == kSTLHeaderSize + kSTLTriangleSize * num_triangles) {
+            success = ReadBinarySTL(filename, num_triangles, mesh, reporter);
+        } else if (header_size >= 5 && std::strncmp(header, "solid", 5) == 0) {
+            success = ReadASCIISTL(filename, mesh, reporter);
+        } else {
+            utility::LogWarning(
+                    "Read STL failed: {} is neither a binary nor an ASCII STL "
+                    "file.",
+                    filename);
+            return false;
+        }
+        if (!success) {
+            mesh.Clear();
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read STL failed with exception: {}", e.what());
+        mesh.Clear();
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
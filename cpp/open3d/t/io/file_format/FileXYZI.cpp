@@ -25,10 +25,14 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <fmt/format.h>
+#include <iterator>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/ParallelLineReader.h"
+#include "open3d/io/ParallelLineWriter.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -53,31 +57,30 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        file.Close();
 
         pointcloud.Clear();
-        core::Tensor points({num_points, 3}, core::Float64);
-        core::Tensor intensities({num_points, 1}, core::Float64);
-        double *points_ptr = points.GetDataPtr<double>();
-        double *intensities_ptr = intensities.GetDataPtr<double>();
+        open3d::io::ParallelLineReader reader(filename);
+        std::vector<std::vector<double>> chunk_values(reader.NumChunks());
+        reader.ForEachLine(
+                [&](int64_t chunk, const char *begin, const char *end) {
+                    std::vector<double> &values = chunk_values[chunk];
+                    const size_t size = values.size();
+                    values.resize(size + 4);
+                    if (open3d::io::ParseDoubles(
+                                begin, end, values.data() + size, 4) != 4) {
+                        values.resize(size);
+                    }
+                },
+                &reporter);
+        const std::vector<double> values =
+                open3d::io::ConcatenateChunks(chunk_values);
 
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
-        pointcloud.SetPointPositions(points);
-        pointcloud.SetPointAttr("intensities", intensities);
+        const core::Tensor xyzi(values, {int64_t(values.size() / 4), 4},
+                                core::Float64);
+        pointcloud.SetPointPositions(xyzi.Slice(1, 0, 3).Contiguous());
+        pointcloud.SetPointAttr("intensities",
+                                xyzi.Slice(1, 3, 4).Contiguous());
         reporter.Finish();
 
         return true;
@@ -121,20 +124,26 @@ bool WritePointCloudToXYZI(const std::string &filename,
         }
         reporter.SetTotal(points.GetShape(0));
 
-        for (int i = 0; i < points.GetShape(0); i++) {
-            if (fprintf(file.GetFILE(), "%.10f %.10f %.10f %.10f\n",
-                        points[i][0].Item<double>(),
-                        points[i][1].Item<double>(),
-                        points[i][2].Item<double>(),
-                        intensities[i][0].Item<double>()) < 0) {
-                utility::LogWarning(
-                        "Write XYZI failed: unable to write file: {}",
-                        filename);
-                return false;  // error happened during writing.
-            }
-            if (i % 1000 == 0) {
-                reporter.Update(i);
+        const core::Tensor points_f64 = points.To(core::Float64).Contiguous();
+        const core::Tensor intensities_f64 =
+                intensities.To(core::Float64).Contiguous();
+        const double *points_ptr = points_f64.GetDataPtr<double>();
+        const double *intensities_ptr = intensities_f64.GetDataPtr<double>();
+        auto format_lines = [&](int64_t begin, int64_t end,
+                                std::string &text) {
+            for (int64_t i = begin; i < end; i++) {
+                fmt::format_to(std::back_inserter(text),
+                               "{:.10f} {:.10f} {:.10f} {:.10f}\n",
+                               points_ptr[3 * i + 0], points_ptr[3 * i + 1],
+                               points_ptr[3 * i + 2], intensities_ptr[i]);
             }
+        };
+        if (!open3d::io::WriteLinesInParallel(file.GetFILE(),
+                                              points.GetShape(0), format_lines,
+                                              &reporter)) {
+            utility::LogWarning("Write XYZI failed: unable to write file: {}",
+                                filename);
+            return false;  // error happened during writing.
         }
         reporter.Finish();
         return true;
@@ -0,0 +1,221 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/MultiSensorCapture.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+MultiSensorCapture::MultiSensorCapture(
+        const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+        size_t buffer_size,
+        uint64_t sync_tolerance_us,
+        const core::Device &device,
+        bool align_depth_to_color,
+        bool use_host_timestamps)
+    : buffer_size_(std::max<size_t>(buffer_size, 1)),
+      sync_tolerance_us_(sync_tolerance_us),
+      device_(device),
+      align_depth_to_color_(align_depth_to_color),
+      use_host_timestamps_(use_host_timestamps) {
+    for (const std::shared_ptr<RGBDSensor> &sensor : sensors) {
+        if (!sensor) {
+            utility::LogError("Sensors must not be null.");
+        }
+        streams_.emplace_back(new Stream());
+        streams_.back()->sensor = sensor;
+    }
+}
+
+MultiSensorCapture::~MultiSensorCapture() { StopCapture(); }
+
+bool MultiSensorCapture::StartCapture(bool start_record) {
+    if (IsCapturing()) {
+        return true;
+    }
+    if (streams_.empty()) {
+        utility::LogWarning("Start capture failed: no sensors.");
+        return false;
+    }
+    for (size_t i = 0; i < streams_.size(); ++i) {
+        if (!streams_[i]->sensor->StartCapture(start_record)) {
+            utility::LogWarning("Start capture failed for sensor {}.", i);
+            for (size_t j = 0; j < i; ++j) {
+                streams_[j]->sensor->StopCapture();
+            }
+            return false;
+        }
+    }
+    stop_ = false;
+    for (std::unique_ptr<Stream> &stream : streams_) {
+        stream->buffer.reset(new utility::SPSCRingBuffer<Frame>(buffer_size_));
+        stream->has_head = false;
+        stream->num_dropped = 0;
+        stream->failed = false;
+        stream->thread = std::thread(&MultiSensorCapture::CaptureLoop, this,
+                                     std::ref(*stream));
+    }
+    is_capturing_ = true;
+    return true;
+}
+
+void MultiSensorCapture::StopCapture() {
+    if (!is_capturing_) {
+        return;
+    }
+    stop_ = true;
+    for (std::unique_ptr<Stream> &stream : streams_) {
+        stream->thread.join();
+        stream->sensor->StopCapture();
+        stream->buffer.reset();
+        stream->head = Frame();
+        stream->has_head = false;
+    }
+    is_capturing_ = false;
+}
+
+void MultiSensorCapture::CaptureLoop(Stream &stream) {
+    while (!stop_) {
+        Frame frame;
+        try {
+            frame.image = stream.sensor->CaptureFrame(true,
+                                                      align_depth_to_color_);
+            if (frame.image.IsEmpty()) {
+                continue;
+            }
+            if (use_host_timestamps_) {
+                frame.timestamp = uint64_t(
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                                std::chrono::steady_clock::now()
+                                        .time_since_epoch())
+                                .count());
+            } else {
+                frame.timestamp = stream.sensor->GetTimestamp();
+            }
+            // The copy to the device overlaps with the processing of the
+            // previous frameset by the caller.
+            if (frame.image.color_.GetDevice() != device_) {
+                frame.image = frame.image.To(device_);
+            }
+        } catch (const std::exception &e) {
+            utility::LogWarning("Capture failed with exception: {}", e.what());
+            stream.failed = true;
+            frame_ready_.notify_all();
+            return;
+        }
+        if (!stream.buffer->Push(std::move(frame))) {
+            ++stream.num_dropped;
+        }
+        frame_ready_.notify_all();
+    }
+}
+
+bool MultiSensorCapture::CaptureFrames(std::vector<geometry::RGBDImage> &frames,
+                                       std::vector<uint64_t> &timestamps,
+                                       bool wait) {
+    if (!IsCapturing()) {
+        utility::LogError("Please StartCapture() first.");
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        bool has_all_heads = true;
+        bool has_failed = false;
+        for (std::unique_ptr<Stream> &stream : streams_) {
+            if (!stream->has_head) {
+                stream->has_head = stream->buffer->Pop(stream->head);
+            }
+            has_all_heads = has_all_heads && stream->has_head;
+            has_failed = has_failed || stream->failed;
+        }
+
+        if (has_all_heads) {
+            uint64_t min_timestamp = std::numeric_limits<uint64_t>::max();
+            uint64_t max_timestamp = 0;
+            for (const std::unique_ptr<Stream> &stream : streams_) {
+                min_timestamp = std::min(min_timestamp, stream->head.timestamp);
+                max_timestamp = std::max(max_timestamp, stream->head.timestamp);
+            }
+            if (max_timestamp - min_timestamp <= sync_tolerance_us_) {
+                frames.resize(streams_.size());
+                timestamps.resize(streams_.size());
+                for (size_t i = 0; i < streams_.size(); ++i) {
+                    frames[i] = std::move(streams_[i]->head.image);
+                    timestamps[i] = streams_[i]->head.timestamp;
+                    streams_[i]->head = Frame();
+                    streams_[i]->has_head = false;
+                }
+                return true;
+            }
+            // No later frame of the newest sensor can match these heads.
+            for (std::unique_ptr<Stream> &stream : streams_) {
+                if (stream->head.timestamp + sync_tolerance_us_ <
+                    max_timestamp) {
+                    stream->head = Frame();
+                    stream->has_head = false;
+                    ++stream->num_dropped;
+                }
+            }
+            continue;
+        }
+        if (has_failed || !wait) {
+            return false;
+        }
+        // The capture threads notify without the lock, so a notification
+        // may be missed. The timeout bounds the extra latency.
+        frame_ready_.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
+int64_t MultiSensorCapture::GetNumDroppedFrames(size_t index) const {
+    if (index >= streams_.size()) {
+        utility::LogError("Sensor index {} out of range [0, {}).", index,
+                          streams_.size());
+    }
+    return streams_[index]->num_dropped;
+}
+
+std::string MultiSensorCapture::ToString() const {
+    std::string str = fmt::format(
+            "MultiSensorCapture with {} sensors, sync tolerance {} us on {}{}",
+            streams_.size(), sync_tolerance_us_, device_.ToString(),
+            IsCapturing() ? ", capturing" : "");
+    for (const std::unique_ptr<Stream> &stream : streams_) {
+        str += "\n" + stream->sensor->ToString();
+    }
+    return str;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
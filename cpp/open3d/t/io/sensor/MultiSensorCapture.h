@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDSensor.h"
+#include "open3d/utility/SPSCRingBuffer.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class MultiSensorCapture
+///
+/// \brief Captures from several RGBD sensors at once and returns framesets
+/// with matching timestamps.
+///
+/// Each sensor is read by its own thread, which timestamps the frames, moves
+/// them to the target device and pushes them into a lock-free ring buffer.
+/// CaptureFrames() takes the oldest frame of every sensor and drops frames
+/// that are older than the newest one by more than the sync tolerance, until
+/// all timestamps lie within the tolerance.
+///
+/// Sensor timestamps are only comparable if the sensors share a clock, e.g.
+/// RealSense cameras with global time enabled (the default). Otherwise use
+/// the time the frames arrive on the host.
+class MultiSensorCapture {
+public:
+    /// \param sensors Initialized sensors, not capturing yet.
+    /// \param buffer_size Number of frames buffered per sensor. New frames of
+    /// a sensor are dropped while its buffer is full.
+    /// \param sync_tolerance_us Maximum difference of the timestamps in a
+    /// frameset, in us.
+    /// \param device Device of the returned images.
+    /// \param align_depth_to_color Align the depth images to the color images.
+    /// \param use_host_timestamps Timestamp frames with the host clock when
+    /// they arrive instead of the sensor timestamp.
+    MultiSensorCapture(const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+                       size_t buffer_size = 4,
+                       uint64_t sync_tolerance_us = 5000,
+                       const core::Device &device = core::Device("CPU:0"),
+                       bool align_depth_to_color = true,
+                       bool use_host_timestamps = false);
+    ~MultiSensorCapture();
+
+    MultiSensorCapture(const MultiSensorCapture &) = delete;
+    MultiSensorCapture &operator=(const MultiSensorCapture &) = delete;
+
+    /// Start capturing on all sensors.
+    /// \param start_record Start recording to the sensor files as well.
+    bool StartCapture(bool start_record = false);
+
+    /// Stop capturing on all sensors. Buffered frames are discarded. Returns
+    /// once every capture thread has received its current frame.
+    void StopCapture();
+
+    /// Check if the sensors are capturing.
+    bool IsCapturing() const { return !streams_.empty() && is_capturing_; }
+
+    /// \brief Get the next synchronized frameset.
+    ///
+    /// \param frames One image per sensor, in the order of the sensors.
+    /// \param timestamps Timestamp of each image, in us.
+    /// \param wait If true wait for the next frameset, else return false
+    /// immediately if it is not yet available.
+    /// \return false if no frameset is available or a sensor failed.
+    bool CaptureFrames(std::vector<geometry::RGBDImage> &frames,
+                       std::vector<uint64_t> &timestamps,
+                       bool wait = true);
+
+    /// Number of sensors.
+    size_t GetNumSensors() const { return streams_.size(); }
+
+    /// \brief Number of frames of sensor \p index that were dropped since
+    /// StartCapture(), because the buffer was full or no frames of the other
+    /// sensors matched them.
+    int64_t GetNumDroppedFrames(size_t index) const;
+
+    /// Text description.
+    std::string ToString() const;
+
+private:
+    struct Frame {
+        geometry::RGBDImage image;
+        uint64_t timestamp = 0;
+    };
+
+    struct Stream {
+        std::shared_ptr<RGBDSensor> sensor;
+        std::unique_ptr<utility::SPSCRingBuffer<Frame>> buffer;
+        std::thread thread;
+        /// Oldest frame taken from the buffer but not returned yet. Only
+        /// used by CaptureFrames().
+        Frame head;
+        bool has_head = false;
+        std::atomic<int64_t> num_dropped{0};
+        std::atomic<bool> failed{false};
+    };
+
+    /// Body of the capture thread of \p stream.
+    void CaptureLoop(Stream &stream);
+
+    std::vector<std::unique_ptr<Stream>> streams_;
+    size_t buffer_size_;
+    uint64_t sync_tolerance_us_;
+    core::Device device_;
+    bool align_depth_to_color_;
+    bool use_host_timestamps_;
+    bool is_capturing_ = false;
+    std::atomic<bool> stop_{false};
+    /// Only used to wait for new frames, the buffers are lock-free.
+    std::mutex mutex_;
+    std::condition_variable frame_ready_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -48,8 +48,9 @@ namespace io {
 // See: https://github.com/isl-org/Open3D/issues/3141
 const size_t RSBagReader::DEFAULT_BUFFER_SIZE;
 
-RSBagReader::RSBagReader(size_t buffer_size)
-    : frame_buffer_(buffer_size),
+RSBagReader::RSBagReader(size_t buffer_size, const core::Device &device)
+    : device_(device),
+      frame_buffer_(buffer_size),
       frame_position_us_(buffer_size),
       pipe_(nullptr) {}
 
@@ -91,15 +92,16 @@ bool RSBagReader::Open(const std::string &filename) {
 }
 
 void RSBagReader::Close() {
-    is_opened_ = false;
+    {
+        std::lock_guard<std::mutex> lock(frame_buffer_mutex_);
+        is_opened_ = false;
+    }
     need_frames_.notify_one();
     frame_reader_thread_.join();
     pipe_->stop();
 }
 
 void RSBagReader::fill_frame_buffer() try {
-    std::mutex frame_buffer_mutex;
-    std::unique_lock<std::mutex> lock(frame_buffer_mutex);
     const unsigned int RS2_PLAYBACK_TIMEOUT_MS =
             static_cast<unsigned int>(10 * 1000.0 / metadata_.fps_);
     rs2::frameset frames;
@@ -122,6 +124,7 @@ void RSBagReader::fill_frame_buffer() try {
                 utility::LogDebug("frame_reader_thread_ seek to {}us",
                                   seek_to_);
                 rs_device.seek(std::chrono::microseconds(seek_to_));
+                std::lock_guard<std::mutex> lock(frame_buffer_mutex_);
                 tail_fid_.store(
                         head_fid_.load());  // atomic: Invalidate buffer.
                 next_dev_color_fid = dev_color_fid = 0;
@@ -136,8 +139,7 @@ void RSBagReader::fill_frame_buffer() try {
             }
             if (next_dev_color_fid != dev_color_fid) {
                 dev_color_fid = next_dev_color_fid;
-                auto &current_frame =
-                        frame_buffer_[head_fid_ % frame_buffer_.size()];
+                t::geometry::RGBDImage current_frame;
 
                 frames = align_to_color.process(frames);
                 const auto &color_frame = frames.get_color_frame();
@@ -152,13 +154,32 @@ void RSBagReader::fill_frame_buffer() try {
                         static_cast<const uint16_t *>(depth_frame.get_data()),
                         {depth_frame.get_height(), depth_frame.get_width()},
                         metadata_.depth_dt_);
-                frame_position_us_[head_fid_ % frame_buffer_.size()] =
+                if (device_ != core::Device("CPU:0")) {
+                    current_frame = current_frame.To(device_);
+                }
+                const uint64_t position_us =
                         rs_device.get_position() /
                         1000;  // Convert nanoseconds -> microseconds
-                ++head_fid_;   // atomic
+                {
+                    std::lock_guard<std::mutex> lock(frame_buffer_mutex_);
+                    // Drop the frame if SeekTimestamp() was called while it
+                    // was decoded.
+                    if (seek_to_ == UINT64_MAX) {
+                        frame_buffer_[head_fid_ % frame_buffer_.size()] =
+                                current_frame;
+                        frame_position_us_[head_fid_ % frame_buffer_.size()] =
+                                position_us;
+                        ++head_fid_;  // atomic
+                    }
+                }
+                frames_available_.notify_one();
             } else {
                 utility::LogDebug("frame_reader_thread EOF. Join.");
-                is_eof_ = true;
+                {
+                    std::lock_guard<std::mutex> lock(frame_buffer_mutex_);
+                    is_eof_ = true;
+                }
+                frames_available_.notify_one();
                 return;
             }
             if (!is_opened_) break;  // exit if Close()
@@ -167,8 +188,9 @@ void RSBagReader::fill_frame_buffer() try {
         utility::LogDebug(
                 "frame_reader_thread pause reading tail_fid_={}, head_fid_={}",
                 tail_fid_, head_fid_);
+        std::unique_lock<std::mutex> lock(frame_buffer_mutex_);
         need_frames_.wait(lock, [this] {
-            return !is_opened_ ||
+            return !is_opened_ || seek_to_ < UINT64_MAX ||
                    head_fid_ < tail_fid_ + frame_buffer_.size() /
                                                    BUFFER_REFILL_FACTOR;
         });
@@ -186,23 +208,24 @@ t::geometry::RGBDImage RSBagReader::NextFrame() {
     if (!IsOpened()) {
         utility::LogError("Null file handler. Please call Open().");
     }
+    t::geometry::RGBDImage frame;
+    {
+        std::unique_lock<std::mutex> lock(frame_buffer_mutex_);
+        // (rare) wait for frame_reader_thread_
+        frames_available_.wait(
+                lock, [this] { return is_eof_ || tail_fid_ < head_fid_; });
+        if (tail_fid_ == head_fid_) {  // no more frames
+            utility::LogInfo("EOF reached");
+            return t::geometry::RGBDImage();
+        }
+        frame = frame_buffer_[(tail_fid_++) %  // atomic
+                              frame_buffer_.size()];
+    }
     if (!is_eof_ &&
-        head_fid_ < tail_fid_ + frame_buffer_.size() / BUFFER_REFILL_FACTOR)
+        head_fid_ < tail_fid_ + frame_buffer_.size() / BUFFER_REFILL_FACTOR) {
         need_frames_.notify_one();
-
-    while (!is_eof_ &&
-           tail_fid_ ==
-                   head_fid_) {  // (rare) spin wait for frame_reader_thread_
-        std::this_thread::sleep_for(
-                std::chrono::duration<double>(1 / metadata_.fps_));
-    }
-    if (is_eof_ && tail_fid_ == head_fid_) {  // no more frames
-        utility::LogInfo("EOF reached");
-        return t::geometry::RGBDImage();
-    } else {
-        return frame_buffer_[(tail_fid_++) %  // atomic
-                             frame_buffer_.size()];
     }
+    return frame;
 }
 
 bool RSBagReader::SeekTimestamp(uint64_t timestamp) {
@@ -215,7 +238,12 @@ bool RSBagReader::SeekTimestamp(uint64_t timestamp) {
                             metadata_.stream_length_usec_);
         return false;
     }
-    seek_to_ = timestamp;  // atomic
+    {
+        // Frames buffered before the seek are not returned any more.
+        std::lock_guard<std::mutex> lock(frame_buffer_mutex_);
+        seek_to_ = timestamp;  // atomic
+        tail_fid_.store(head_fid_.load());
+    }
     if (is_eof_) {
         Open(filename_);  // EOF requires restarting pipeline.
     } else {
@@ -28,11 +28,13 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "open3d/core/Device.h"
 #include "open3d/io/sensor/RGBDSensorConfig.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #include "open3d/utility/IJsonConvertible.h"
@@ -61,6 +63,9 @@ namespace io {
 /// https://intelrealsense.github.io/librealsense/doxygen/rs__sensor_8h.html#ae04b7887ce35d16dbd9d2d295d23aac7
 /// for format documentation
 ///
+/// Frames are decoded, aligned and copied to the target device on a background
+/// thread, which keeps a buffer of frames ahead of the caller.
+///
 /// Note: A few frames may be dropped if user code takes a long time (>10 frame
 /// intervals) to process a frame.
 ///
@@ -72,7 +77,10 @@ public:
     ///
     /// \param buffer_size (optional) Max number of frames to store in the frame
     /// buffer
-    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    /// \param device (optional) Device of the returned frames. Frames are
+    /// copied to it by the frame reader thread.
+    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                         const core::Device &device = core::Device("CPU:0"));
 
     RSBagReader(const RSBagReader &) = delete;
     RSBagReader &operator=(const RSBagReader &) = delete;
@@ -114,12 +122,16 @@ public:
     /// Return filename being read
     virtual std::string GetFilename() const override { return filename_; };
 
+    /// Return the device of the returned frames.
+    core::Device GetDevice() const { return device_; }
+
     using RGBDVideoReader::SaveFrames;
     using RGBDVideoReader::ToString;
 
 private:
     std::string filename_;
     RGBDVideoMetadata metadata_;
+    core::Device device_;
 
     std::atomic<bool> is_eof_{false};     // Write by frame_reader_thread.
     std::atomic<bool> is_opened_{false};  // Read by frame_reader_thread.
@@ -141,12 +153,17 @@ private:
             0};  ///< Next write position by frame_reader_thread.
     std::atomic<uint64_t> tail_fid_{0};  ///< Next unread frame position.
     std::atomic<uint64_t> seek_to_{UINT64_MAX};
+    /// Guards the changes of head_fid_, tail_fid_, is_eof_ and is_opened_
+    /// that the condition variables wait for.
+    std::mutex frame_buffer_mutex_;
     std::condition_variable need_frames_;
+    std::condition_variable frames_available_;
     /// This workaround implements a single producer single consumer frame queue
     /// with a circular buffer. The producer thread (frame_reader_thread) keeps
     /// the buffer full. The main thread reads from the current position in the
     /// buffer and signals the producer thread with a condition variable for
-    /// more frames if less than a quarter of the frames remain.
+    /// more frames if less than a quarter of the frames remain. The main thread
+    /// waits on frames_available_ if the buffer is empty.
     void fill_frame_buffer();
     std::thread frame_reader_thread_;
 
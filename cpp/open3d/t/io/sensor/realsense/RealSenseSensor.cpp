@@ -271,6 +271,22 @@ void RealSenseSensor::ResumeRecord() {
     }
 }
 
+namespace {
+
+/// Tensor sharing the buffer of \p frame, which stays in the librealsense
+/// frame pool until the tensor is destroyed.
+core::Tensor FrameToTensor(const rs2::frame& frame,
+                           const core::SizeVector& shape,
+                           core::Dtype dtype) {
+    void* data_ptr = const_cast<void*>(frame.get_data());
+    auto blob = std::make_shared<core::Blob>(
+            core::Device("CPU:0"), data_ptr, [frame](void*) { (void)frame; });
+    return core::Tensor(shape, core::shape_util::DefaultStrides(shape),
+                        data_ptr, dtype, blob);
+}
+
+}  // namespace
+
 geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
                                                   bool align_depth_to_color) {
     if (!is_capturing_) {
@@ -284,16 +300,16 @@ geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
             return geometry::RGBDImage();
         if (align_depth_to_color) frames = align_to_color_->process(frames);
         timestamp_ = uint64_t(frames.get_timestamp() * MILLISEC_TO_MICROSEC);
-        // Copy frame data to Tensors
+        // The tensors share the frame buffers, see the class documentation.
         const auto& color_frame = frames.get_color_frame();
-        current_frame_.color_ = core::Tensor(
-                static_cast<const uint8_t*>(color_frame.get_data()),
+        current_frame_.color_ = FrameToTensor(
+                color_frame,
                 {color_frame.get_height(), color_frame.get_width(),
                  metadata_.color_channels_},
                 metadata_.color_dt_);
         const auto& depth_frame = frames.get_depth_frame();
-        current_frame_.depth_ = core::Tensor(
-                static_cast<const uint16_t*>(depth_frame.get_data()),
+        current_frame_.depth_ = FrameToTensor(
+                depth_frame,
                 {depth_frame.get_height(), depth_frame.get_width()},
                 metadata_.depth_dt_);
         return current_frame_;
@@ -108,6 +108,10 @@ public:
     /// with an empty RGBDImage if it is not yet available.
     /// \param align_depth_to_color Enable aligning WFOV depth image to
     /// the color image in visualizer.
+    ///
+    /// The returned images share the buffers of the camera frames without a
+    /// copy. Frames stay in the librealsense frame pool while an image refers
+    /// to them, so hold only a few images at a time or Clone() them.
     virtual geometry::RGBDImage CaptureFrame(
             bool wait = true, bool align_depth_to_color = true) override;
 
@@ -0,0 +1,210 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/kernel/Matrix.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Computes the (phi, alpha, theta, distance) pair feature of two oriented
+/// points, following the legacy pipelines::registration implementation.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void ComputePairFeature(
+        const scalar_t *p1,
+        const scalar_t *n1,
+        const scalar_t *p2,
+        const scalar_t *n2,
+        scalar_t *feature) {
+    scalar_t dp2p1[3] = {p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+    feature[3] = sqrt(core::linalg::kernel::dot_3x1(dp2p1, dp2p1));
+    if (feature[3] == 0) {
+        feature[0] = feature[1] = feature[2] = feature[3] = 0;
+        return;
+    }
+
+    scalar_t angle1 = core::linalg::kernel::dot_3x1(n1, dp2p1) / feature[3];
+    scalar_t angle2 = core::linalg::kernel::dot_3x1(n2, dp2p1) / feature[3];
+    // Same as acos(|angle1|) > acos(|angle2|), as acos decreases on [0, 1].
+    const bool swap = angle1 * angle1 < angle2 * angle2;
+    const scalar_t *n1_copy = swap ? n2 : n1;
+    const scalar_t *n2_copy = swap ? n1 : n2;
+    if (swap) {
+        dp2p1[0] = -dp2p1[0];
+        dp2p1[1] = -dp2p1[1];
+        dp2p1[2] = -dp2p1[2];
+        feature[2] = -angle2;
+    } else {
+        feature[2] = angle1;
+    }
+
+    scalar_t v[3];
+    core::linalg::kernel::cross_3x1(dp2p1, n1_copy, v);
+    const scalar_t v_norm = sqrt(core::linalg::kernel::dot_3x1(v, v));
+    if (v_norm == 0) {
+        feature[0] = feature[1] = feature[2] = feature[3] = 0;
+        return;
+    }
+    v[0] /= v_norm;
+    v[1] /= v_norm;
+    v[2] /= v_norm;
+
+    scalar_t w[3];
+    core::linalg::kernel::cross_3x1(n1_copy, v, w);
+    feature[1] = core::linalg::kernel::dot_3x1(v, n2_copy);
+    feature[0] = atan2(core::linalg::kernel::dot_3x1(w, n2_copy),
+                       core::linalg::kernel::dot_3x1(n1_copy, n2_copy));
+}
+
+/// Adds one pair feature to the 3 x 11 bin SPFH histogram \p spfh.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void UpdateSPFHFeature(
+        const scalar_t *feature, scalar_t hist_incr, scalar_t *spfh) {
+    const scalar_t kPi = static_cast<scalar_t>(3.14159265358979323846);
+    int h_index[3];
+    h_index[0] = static_cast<int>(floor(11 * (feature[0] + kPi) / (2 * kPi)));
+    h_index[1] = static_cast<int>(floor(11 * (feature[1] + 1) * 0.5));
+    h_index[2] = static_cast<int>(floor(11 * (feature[2] + 1) * 0.5));
+    for (int k = 0; k < 3; ++k) {
+        const int h = h_index[k] < 0 ? 0 : (h_index[k] >= 11 ? 10 : h_index[k]);
+        spfh[k * 11 + h] += hist_incr;
+    }
+}
+
+#if defined(__CUDACC__)
+void ComputeFPFHFeatureCUDA
+#else
+void ComputeFPFHFeatureCPU
+#endif
+        (const core::Tensor &points,
+         const core::Tensor &normals,
+         const core::Tensor &indices,
+         const core::Tensor &distance2,
+         const core::Tensor &counts,
+         core::Tensor &fpfhs) {
+    const core::Device device = points.GetDevice();
+    const int64_t n = points.GetLength();
+    const int64_t max_nn = indices.GetShape(1);
+
+    const core::Tensor points_contiguous = points.Contiguous();
+    const core::Tensor normals_contiguous = normals.Contiguous();
+    const core::Tensor indices_contiguous = indices.Contiguous();
+    const core::Tensor distance2_contiguous = distance2.Contiguous();
+    const core::Tensor counts_contiguous = counts.Contiguous();
+    core::Tensor spfhs =
+            core::Tensor::Zeros({n, 33}, points.GetDtype(), device);
+
+    const int32_t *indices_ptr = indices_contiguous.GetDataPtr<int32_t>();
+    const int32_t *counts_ptr = counts_contiguous.GetDataPtr<int32_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t *points_ptr = points_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *normals_ptr =
+                normals_contiguous.GetDataPtr<scalar_t>();
+        const scalar_t *distance2_ptr =
+                distance2_contiguous.GetDataPtr<scalar_t>();
+        scalar_t *spfhs_ptr = spfhs.GetDataPtr<scalar_t>();
+        scalar_t *fpfhs_ptr = fpfhs.GetDataPtr<scalar_t>();
+
+        // Pass 1: simplified point feature histogram of every point against
+        // its neighbors, skipping the point itself.
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int32_t *nb_indices = indices_ptr + workload_idx * max_nn;
+            const int count = counts_ptr[workload_idx];
+
+            int num_neighbors = 0;
+            for (int k = 0; k < count; ++k) {
+                num_neighbors += (nb_indices[k] != workload_idx);
+            }
+            if (num_neighbors == 0) return;
+
+            const scalar_t hist_incr =
+                    100 / static_cast<scalar_t>(num_neighbors);
+            const scalar_t *p1 = points_ptr + 3 * workload_idx;
+            const scalar_t *n1 = normals_ptr + 3 * workload_idx;
+            scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            for (int k = 0; k < count; ++k) {
+                const int64_t j = nb_indices[k];
+                if (j == workload_idx) continue;
+                scalar_t feature[4];
+                ComputePairFeature(p1, n1, points_ptr + 3 * j,
+                                   normals_ptr + 3 * j, feature);
+                UpdateSPFHFeature(feature, hist_incr, spfh);
+            }
+        });
+
+        // Pass 2: inverse squared distance weighted sum of the neighbors'
+        // SPFH, normalized per sub-histogram and added to the point's own.
+        core::ParallelFor(device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int32_t *nb_indices = indices_ptr + workload_idx * max_nn;
+            const scalar_t *nb_distance2 =
+                    distance2_ptr + workload_idx * max_nn;
+            const int count = counts_ptr[workload_idx];
+            scalar_t *fpfh = fpfhs_ptr + 33 * workload_idx;
+
+            scalar_t sum[3] = {0, 0, 0};
+            bool has_neighbor = false;
+            for (int k = 0; k < count; ++k) {
+                const int64_t j = nb_indices[k];
+                if (j == workload_idx) continue;
+                has_neighbor = true;
+                const scalar_t dist = nb_distance2[k];
+                if (dist == 0) continue;
+                const scalar_t *spfh = spfhs_ptr + 33 * j;
+                for (int h = 0; h < 33; ++h) {
+                    const scalar_t val = spfh[h] / dist;
+                    sum[h / 11] += val;
+                    fpfh[h] += val;
+                }
+            }
+            if (!has_neighbor) return;
+
+            for (int s = 0; s < 3; ++s) {
+                if (sum[s] != 0) sum[s] = 100 / sum[s];
+            }
+            const scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            for (int h = 0; h < 33; ++h) {
+                fpfh[h] = fpfh[h] * sum[h / 11] + spfh[h];
+            }
+        });
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
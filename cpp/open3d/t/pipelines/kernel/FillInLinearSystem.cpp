@@ -27,12 +27,88 @@
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
 
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
 
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace kernel {
 
+// Number of correspondences whose blocks are activated at once in
+// FillInSLACAlignmentTermSparse, bounding the 400 keys per correspondence.
+static constexpr int64_t kSLACBlockBatchSize = 4096;
+
+// Activates the 3x3 blocks at the (N, 2) keys, zeroing the new ones, and
+// returns their Int32 buffer indices.
+static core::Tensor ActivateBlocks(core::HashMap &AtA_blocks,
+                                   const core::Tensor &keys) {
+    core::Tensor buf_indices, masks;
+    std::tie(buf_indices, masks) = AtA_blocks.Activate(keys);
+    core::Tensor new_indices = buf_indices.IndexGet({masks}).To(core::Int64);
+    if (new_indices.GetLength() > 0) {
+        AtA_blocks.GetValueTensor().IndexSet(
+                {new_indices},
+                core::Tensor::Zeros({}, core::Float32, keys.GetDevice()));
+    }
+    std::tie(buf_indices, masks) = AtA_blocks.Find(keys);
+    return buf_indices;
+}
+
+// Returns the (n x 20 x 20, 2) keys of the blocks touched by n SLAC
+// correspondences, following the variable layout of GetSLACAlignmentJacobian.
+static core::Tensor GetSLACAlignmentBlockKeys(const core::Tensor &cgrid_idx_ps,
+                                              const core::Tensor &cgrid_idx_qs,
+                                              int i,
+                                              int j,
+                                              int n_frags) {
+    core::Device device = cgrid_idx_ps.GetDevice();
+    int64_t n = cgrid_idx_ps.GetLength();
+
+    core::Tensor pose_blocks =
+            core::Tensor::Init<int>({2 * i, 2 * i + 1, 2 * j, 2 * j + 1},
+                                    device)
+                    .Reshape({1, 4}) +
+            core::Tensor::Zeros({n, 4}, core::Int32, device);
+    core::Tensor blocks = core::Concatenate(
+            {pose_blocks, cgrid_idx_ps.Reshape({n, 8}) + 2 * n_frags,
+             cgrid_idx_qs.Reshape({n, 8}) + 2 * n_frags},
+            1);
+
+    core::Tensor zeros = core::Tensor::Zeros({n, 20, 20}, core::Int32, device);
+    core::Tensor rows = blocks.Reshape({n, 20, 1}) + zeros;
+    core::Tensor cols = blocks.Reshape({n, 1, 20}) + zeros;
+    return core::Concatenate(
+            {rows.Reshape({n * 400, 1}), cols.Reshape({n * 400, 1})}, 1);
+}
+
+// Returns the (n x 6 x 4, 2) keys of the blocks (i, i), (k, k), (i, k) and
+// (k, i) for the 6 neighbors k of n control grid points i. Invalid neighbors
+// map to (i, i).
+static core::Tensor GetSLACRegularizerBlockKeys(
+        const core::Tensor &grid_idx,
+        const core::Tensor &grid_nbs_idx,
+        const core::Tensor &grid_nbs_mask,
+        int n_frags) {
+    core::Device device = grid_idx.GetDevice();
+    int64_t n = grid_idx.GetLength();
+
+    core::Tensor valid = grid_nbs_mask.To(core::Int32);
+    core::Tensor invalid = grid_nbs_mask.LogicalNot().To(core::Int32);
+    core::Tensor blocks_i = grid_idx.Reshape({n, 1}) + 2 * n_frags +
+                            core::Tensor::Zeros({n, 6}, core::Int32, device);
+    core::Tensor blocks_k =
+            (grid_nbs_idx + 2 * n_frags) * valid + blocks_i * invalid;
+    blocks_i = blocks_i.Reshape({n, 6, 1});
+    blocks_k = blocks_k.Reshape({n, 6, 1});
+
+    core::Tensor rows =
+            core::Concatenate({blocks_i, blocks_k, blocks_i, blocks_k}, 2);
+    core::Tensor cols =
+            core::Concatenate({blocks_i, blocks_k, blocks_k, blocks_i}, 2);
+    return core::Concatenate(
+            {rows.Reshape({n * 24, 1}), cols.Reshape({n * 24, 1})}, 1);
+}
+
 void FillInRigidAlignmentTerm(core::Tensor &AtA,
                               core::Tensor &Atb,
                               core::Tensor &residual,
@@ -148,6 +224,108 @@ void FillInSLACAlignmentTerm(core::Tensor &AtA,
     }
 }
 
+void FillInSLACAlignmentTermSparse(core::HashMap &AtA_blocks,
+                                   core::Tensor &Atb,
+                                   core::Tensor &residual,
+                                   const core::Tensor &Ti_ps,
+                                   const core::Tensor &Tj_qs,
+                                   const core::Tensor &normal_ps,
+                                   const core::Tensor &Ri_normal_ps,
+                                   const core::Tensor &RjT_Ri_normal_ps,
+                                   const core::Tensor &cgrid_idx_ps,
+                                   const core::Tensor &cgrid_idx_qs,
+                                   const core::Tensor &cgrid_ratio_qs,
+                                   const core::Tensor &cgrid_ratio_ps,
+                                   int i,
+                                   int j,
+                                   int n,
+                                   float threshold) {
+    core::AssertTensorDtype(Atb, core::Float32);
+    core::AssertTensorDtype(residual, core::Float32);
+    core::AssertTensorDtype(Ti_ps, core::Float32);
+    core::AssertTensorDtype(Tj_qs, core::Float32);
+    core::AssertTensorDtype(normal_ps, core::Float32);
+    core::AssertTensorDtype(Ri_normal_ps, core::Float32);
+    core::AssertTensorDtype(RjT_Ri_normal_ps, core::Float32);
+    core::AssertTensorDtype(cgrid_idx_ps, core::Int32);
+    core::AssertTensorDtype(cgrid_idx_qs, core::Int32);
+
+    core::Device device = Atb.GetDevice();
+    if (AtA_blocks.GetDevice() != device) {
+        utility::LogError("AtA should have the same device as Atb.");
+    }
+    if (Ti_ps.GetDevice() != device) {
+        utility::LogError(
+                "Points i should have the same device as the linear system.");
+    }
+    if (Tj_qs.GetDevice() != device) {
+        utility::LogError(
+                "Points j should have the same device as the linear system.");
+    }
+    if (Ri_normal_ps.GetDevice() != device) {
+        utility::LogError(
+                "Normals i should have the same device as the linear system.");
+    }
+
+    int64_t length = Ti_ps.GetLength();
+    if (Tj_qs.GetLength() != length || normal_ps.GetLength() != length ||
+        Ri_normal_ps.GetLength() != length ||
+        RjT_Ri_normal_ps.GetLength() != length ||
+        cgrid_idx_ps.GetLength() != length ||
+        cgrid_idx_qs.GetLength() != length ||
+        cgrid_ratio_ps.GetLength() != length ||
+        cgrid_ratio_qs.GetLength() != length) {
+        utility::LogError(
+                "Unable to setup linear system: input length mismatch.");
+    }
+
+    for (int64_t start = 0; start < length; start += kSLACBlockBatchSize) {
+        int64_t end = std::min(start + kSLACBlockBatchSize, length);
+        core::Tensor cgrid_idx_ps_batch = cgrid_idx_ps.Slice(0, start, end);
+        core::Tensor cgrid_idx_qs_batch = cgrid_idx_qs.Slice(0, start, end);
+        core::Tensor block_buf_indices = ActivateBlocks(
+                AtA_blocks,
+                GetSLACAlignmentBlockKeys(cgrid_idx_ps_batch,
+                                          cgrid_idx_qs_batch, i, j, n));
+        // Activation may rehash, so the value buffer is fetched afterwards.
+        core::Tensor AtA_values = AtA_blocks.GetValueTensor();
+
+        core::Tensor Ti_ps_batch = Ti_ps.Slice(0, start, end);
+        core::Tensor Tj_qs_batch = Tj_qs.Slice(0, start, end);
+        core::Tensor normal_ps_batch = normal_ps.Slice(0, start, end);
+        core::Tensor Ri_normal_ps_batch = Ri_normal_ps.Slice(0, start, end);
+        core::Tensor RjT_Ri_normal_ps_batch =
+                RjT_Ri_normal_ps.Slice(0, start, end);
+        core::Tensor cgrid_ratio_ps_batch = cgrid_ratio_ps.Slice(0, start, end);
+        core::Tensor cgrid_ratio_qs_batch = cgrid_ratio_qs.Slice(0, start, end);
+
+        core::Device::DeviceType device_type = device.GetType();
+        if (device_type == core::Device::DeviceType::CPU) {
+            FillInSLACAlignmentTermSparseCPU(
+                    AtA_values, block_buf_indices, Atb, residual, Ti_ps_batch,
+                    Tj_qs_batch, normal_ps_batch, Ri_normal_ps_batch,
+                    RjT_Ri_normal_ps_batch, cgrid_idx_ps_batch,
+                    cgrid_idx_qs_batch, cgrid_ratio_ps_batch,
+                    cgrid_ratio_qs_batch, i, j, n, threshold);
+
+        } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+            FillInSLACAlignmentTermSparseCUDA(
+                    AtA_values, block_buf_indices, Atb, residual, Ti_ps_batch,
+                    Tj_qs_batch, normal_ps_batch, Ri_normal_ps_batch,
+                    RjT_Ri_normal_ps_batch, cgrid_idx_ps_batch,
+                    cgrid_idx_qs_batch, cgrid_ratio_ps_batch,
+                    cgrid_ratio_qs_batch, i, j, n, threshold);
+#else
+            utility::LogError(
+                    "Not compiled with CUDA, but CUDA device is used.");
+#endif
+        } else {
+            utility::LogError("Unimplemented device");
+        }
+    }
+}
+
 void FillInSLACRegularizerTerm(core::Tensor &AtA,
                                core::Tensor &Atb,
                                core::Tensor &residual,
@@ -187,6 +365,54 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
     }
 }
 
+void FillInSLACRegularizerTermSparse(core::HashMap &AtA_blocks,
+                                     core::Tensor &Atb,
+                                     core::Tensor &residual,
+                                     const core::Tensor &grid_idx,
+                                     const core::Tensor &grid_nbs_idx,
+                                     const core::Tensor &grid_nbs_mask,
+                                     const core::Tensor &positions_init,
+                                     const core::Tensor &positions_curr,
+                                     float weight,
+                                     int n,
+                                     int anchor_idx) {
+    core::AssertTensorDtype(Atb, core::Float32);
+    core::AssertTensorDtype(residual, core::Float32);
+    core::AssertTensorDtype(grid_idx, core::Int32);
+    core::AssertTensorDtype(grid_nbs_idx, core::Int32);
+
+    core::Device device = Atb.GetDevice();
+    if (AtA_blocks.GetDevice() != device) {
+        utility::LogError("AtA should have the same device as Atb.");
+    }
+
+    core::Tensor block_buf_indices = ActivateBlocks(
+            AtA_blocks,
+            GetSLACRegularizerBlockKeys(grid_idx, grid_nbs_idx, grid_nbs_mask,
+                                        n));
+    core::Tensor AtA_values = AtA_blocks.GetValueTensor();
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FillInSLACRegularizerTermSparseCPU(
+                AtA_values, block_buf_indices, Atb, residual, grid_idx,
+                grid_nbs_idx, grid_nbs_mask, positions_init, positions_curr,
+                weight, n, anchor_idx);
+
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FillInSLACRegularizerTermSparseCUDA(
+                AtA_values, block_buf_indices, Atb, residual, grid_idx,
+                grid_nbs_idx, grid_nbs_mask, positions_init, positions_curr,
+                weight, n, anchor_idx);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
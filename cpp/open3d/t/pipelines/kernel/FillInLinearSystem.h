@@ -26,6 +26,7 @@
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/HashMap.h"
 namespace open3d {
 namespace t {
 namespace pipelines {
@@ -70,6 +71,41 @@ void FillInSLACRegularizerTerm(core::Tensor &AtA,
                                int n,
                                int anchor_idx);
 
+/// Block sparse counterpart of FillInSLACAlignmentTerm. \p AtA_blocks maps the
+/// Int32 (row, col) coordinates of 3x3 blocks to their row-major Float32
+/// values. The pose of fragment f covers the blocks 2f and 2f + 1, and control
+/// grid point c the block 2n + c. Missing blocks are activated and zeroed.
+void FillInSLACAlignmentTermSparse(core::HashMap &AtA_blocks,
+                                   core::Tensor &Atb,
+                                   core::Tensor &residual,
+                                   const core::Tensor &Ti_qs,
+                                   const core::Tensor &Tj_qs,
+                                   const core::Tensor &normal_ps,
+                                   const core::Tensor &Ri_normal_ps,
+                                   const core::Tensor &RjT_Ri_normal_ps,
+                                   const core::Tensor &cgrid_idx_ps,
+                                   const core::Tensor &cgrid_idx_qs,
+                                   const core::Tensor &cgrid_ratio_qs,
+                                   const core::Tensor &cgrid_ratio_ps,
+                                   int i,
+                                   int j,
+                                   int n,
+                                   float threshold);
+
+/// Block sparse counterpart of FillInSLACRegularizerTerm, see
+/// FillInSLACAlignmentTermSparse.
+void FillInSLACRegularizerTermSparse(core::HashMap &AtA_blocks,
+                                     core::Tensor &Atb,
+                                     core::Tensor &residual,
+                                     const core::Tensor &grid_idx,
+                                     const core::Tensor &grid_nbs_idx,
+                                     const core::Tensor &grid_nbs_mask,
+                                     const core::Tensor &positions_init,
+                                     const core::Tensor &positions_curr,
+                                     float weight,
+                                     int n,
+                                     int anchor_idx);
+
 void FillInRigidAlignmentTermCPU(core::Tensor &AtA,
                                  core::Tensor &Atb,
                                  core::Tensor &residual,
@@ -109,6 +145,37 @@ void FillInSLACRegularizerTermCPU(core::Tensor &AtA,
                                   int n,
                                   int anchor_idx);
 
+void FillInSLACAlignmentTermSparseCPU(core::Tensor &AtA_blocks,
+                                      const core::Tensor &block_buf_indices,
+                                      core::Tensor &Atb,
+                                      core::Tensor &residual,
+                                      const core::Tensor &Ti_qs,
+                                      const core::Tensor &Tj_qs,
+                                      const core::Tensor &normal_ps,
+                                      const core::Tensor &Ri_normal_ps,
+                                      const core::Tensor &RjT_Ri_normal_ps,
+                                      const core::Tensor &cgrid_idx_ps,
+                                      const core::Tensor &cgrid_idx_qs,
+                                      const core::Tensor &cgrid_ratio_qs,
+                                      const core::Tensor &cgrid_ratio_ps,
+                                      int i,
+                                      int j,
+                                      int n,
+                                      float threshold);
+
+void FillInSLACRegularizerTermSparseCPU(core::Tensor &AtA_blocks,
+                                        const core::Tensor &block_buf_indices,
+                                        core::Tensor &Atb,
+                                        core::Tensor &residual,
+                                        const core::Tensor &grid_idx,
+                                        const core::Tensor &grid_nbs_idx,
+                                        const core::Tensor &grid_nbs_mask,
+                                        const core::Tensor &positions_init,
+                                        const core::Tensor &positions_curr,
+                                        float weight,
+                                        int n,
+                                        int anchor_idx);
+
 #ifdef BUILD_CUDA_MODULE
 void FillInRigidAlignmentTermCUDA(core::Tensor &AtA,
                                   core::Tensor &Atb,
@@ -149,6 +216,37 @@ void FillInSLACRegularizerTermCUDA(core::Tensor &AtA,
                                    int n,
                                    int anchor_idx);
 
+void FillInSLACAlignmentTermSparseCUDA(core::Tensor &AtA_blocks,
+                                       const core::Tensor &block_buf_indices,
+                                       core::Tensor &Atb,
+                                       core::Tensor &residual,
+                                       const core::Tensor &Ti_qs,
+                                       const core::Tensor &Tj_qs,
+                                       const core::Tensor &normal_ps,
+                                       const core::Tensor &Ri_normal_ps,
+                                       const core::Tensor &RjT_Ri_normal_ps,
+                                       const core::Tensor &cgrid_idx_ps,
+                                       const core::Tensor &cgrid_idx_qs,
+                                       const core::Tensor &cgrid_ratio_qs,
+                                       const core::Tensor &cgrid_ratio_ps,
+                                       int i,
+                                       int j,
+                                       int n,
+                                       float threshold);
+
+void FillInSLACRegularizerTermSparseCUDA(core::Tensor &AtA_blocks,
+                                         const core::Tensor &block_buf_indices,
+                                         core::Tensor &Atb,
+                                         core::Tensor &residual,
+                                         const core::Tensor &grid_idx,
+                                         const core::Tensor &grid_nbs_idx,
+                                         const core::Tensor &grid_nbs_mask,
+                                         const core::Tensor &positions_init,
+                                         const core::Tensor &positions_curr,
+                                         float weight,
+                                         int n,
+                                         int anchor_idx);
+
 #endif
 
 }  // namespace kernel
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/Atomic.h"
 #include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
@@ -32,6 +33,191 @@ namespace open3d {
 namespace t {
 namespace pipelines {
 namespace kernel {
+
+/// Computes the point-to-plane residual \p r of the SLAC correspondence
+/// \p workload_idx, and its Jacobian \p J w.r.t. the 60 variables \p idx it
+/// depends on: 2 x 6 for the poses of fragments i and j, and 2 x 8 x 3 for the
+/// control grid points around p and q. The variables come in groups of 3
+/// consecutive indices. Returns false if the residual is above the threshold.
+OPEN3D_DEVICE inline bool GetSLACAlignmentJacobian(
+        int64_t workload_idx,
+        const float *Ti_Cps_ptr,
+        const float *Tj_Cqs_ptr,
+        const float *Cnormal_ps_ptr,
+        const float *Ri_Cnormal_ps_ptr,
+        const float *RjT_Ri_Cnormal_ps_ptr,
+        const int *cgrid_idx_ps_ptr,
+        const int *cgrid_idx_qs_ptr,
+        const float *cgrid_ratio_ps_ptr,
+        const float *cgrid_ratio_qs_ptr,
+        int i,
+        int j,
+        int n_frags,
+        float threshold,
+        float &r,
+        float *J,
+        int *idx) {
+    const float *Ti_Cp = Ti_Cps_ptr + 3 * workload_idx;
+    const float *Tj_Cq = Tj_Cqs_ptr + 3 * workload_idx;
+    const float *Cnormal_p = Cnormal_ps_ptr + 3 * workload_idx;
+    const float *Ri_Cnormal_p = Ri_Cnormal_ps_ptr + 3 * workload_idx;
+    const float *RjTRi_Cnormal_p = RjT_Ri_Cnormal_ps_ptr + 3 * workload_idx;
+
+    const int *cgrid_idx_p = cgrid_idx_ps_ptr + 8 * workload_idx;
+    const int *cgrid_idx_q = cgrid_idx_qs_ptr + 8 * workload_idx;
+    const float *cgrid_ratio_p = cgrid_ratio_ps_ptr + 8 * workload_idx;
+    const float *cgrid_ratio_q = cgrid_ratio_qs_ptr + 8 * workload_idx;
+
+    r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
+        (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
+        (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
+    if (abs(r) > threshold) return false;
+
+    // Jacobian w.r.t. Ti: 0-6
+    J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
+    J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
+    J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
+    J[3] = Ri_Cnormal_p[0];
+    J[4] = Ri_Cnormal_p[1];
+    J[5] = Ri_Cnormal_p[2];
+
+    // Jacobian w.r.t. Tj: 6-12
+    for (int k = 0; k < 6; ++k) {
+        J[k + 6] = -J[k];
+
+        idx[k + 0] = 6 * i + k;
+        idx[k + 6] = 6 * j + k;
+    }
+
+    // Jacobian w.r.t. C over p: 12-36
+    for (int k = 0; k < 8; ++k) {
+        J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
+        J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
+        J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
+
+        idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
+        idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
+        idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
+    }
+
+    // Jacobian w.r.t. C over q: 36-60
+    for (int k = 0; k < 8; ++k) {
+        J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
+        J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
+        J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
+
+        idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
+        idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
+        idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+    }
+    return true;
+}
+
+/// Estimates the local rotation \p R of control grid point \p idx_i from the
+/// initial and current offsets to its 6 neighbors. Returns false if fewer than
+/// 3 neighbors are valid.
+OPEN3D_DEVICE inline bool GetSLACRegularizerRotation(
+        int idx_i,
+        const int *idx_nbs,
+        const bool *mask_nbs,
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        int anchor_idx,
+        float R[3][3]) {
+    // Build a 3x3 linear system to compute the local R
+    float cov[3][3] = {{0}};
+    float U[3][3], V[3][3], S[3];
+
+    int cnt = 0;
+    for (int k = 0; k < 6; ++k) {
+        bool mask_k = mask_nbs[k];
+        if (!mask_k) continue;
+
+        int idx_k = idx_nbs[k];
+
+        // Now build linear systems
+        float diff_ik_init[3] = {positions_init_ptr[idx_i * 3 + 0] -
+                                         positions_init_ptr[idx_k * 3 + 0],
+                                 positions_init_ptr[idx_i * 3 + 1] -
+                                         positions_init_ptr[idx_k * 3 + 1],
+                                 positions_init_ptr[idx_i * 3 + 2] -
+                                         positions_init_ptr[idx_k * 3 + 2]};
+        float diff_ik_curr[3] = {positions_curr_ptr[idx_i * 3 + 0] -
+                                         positions_curr_ptr[idx_k * 3 + 0],
+                                 positions_curr_ptr[idx_i * 3 + 1] -
+                                         positions_curr_ptr[idx_k * 3 + 1],
+                                 positions_curr_ptr[idx_i * 3 + 2] -
+                                         positions_curr_ptr[idx_k * 3 + 2]};
+
+        // Build linear system by computing XY^T when formulating Y
+        // = RX Y: curr X: init
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
+            }
+        }
+        ++cnt;
+    }
+
+    if (cnt < 3) {
+        return false;
+    }
+
+    core::linalg::kernel::svd3x3(*cov, *U, S, *V);
+
+    core::linalg::kernel::transpose3x3_(*U);
+    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+
+    float d = core::linalg::kernel::det3x3(*R);
+
+    if (d < 0) {
+        U[2][0] = -U[2][0];
+        U[2][1] = -U[2][1];
+        U[2][2] = -U[2][2];
+        core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+    }
+
+    // Now we have R, we build Hessian and residuals
+    // But first, we need to anchor a point
+    if (idx_i == anchor_idx) {
+        R[0][0] = R[1][1] = R[2][2] = 1;
+        R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] = 0;
+    }
+    return true;
+}
+
+/// Computes the residual of the edge between control grid points \p idx_i and
+/// \p idx_k given the local rotation \p R of \p idx_i.
+OPEN3D_DEVICE inline void GetSLACRegularizerResidual(
+        int idx_i,
+        int idx_k,
+        float R[3][3],
+        const float *positions_init_ptr,
+        const float *positions_curr_ptr,
+        float *local_r) {
+    float diff_ik_init[3] = {
+            positions_init_ptr[idx_i * 3 + 0] -
+                    positions_init_ptr[idx_k * 3 + 0],
+            positions_init_ptr[idx_i * 3 + 1] -
+                    positions_init_ptr[idx_k * 3 + 1],
+            positions_init_ptr[idx_i * 3 + 2] -
+                    positions_init_ptr[idx_k * 3 + 2]};
+    float diff_ik_curr[3] = {
+            positions_curr_ptr[idx_i * 3 + 0] -
+                    positions_curr_ptr[idx_k * 3 + 0],
+            positions_curr_ptr[idx_i * 3 + 1] -
+                    positions_curr_ptr[idx_k * 3 + 1],
+            positions_curr_ptr[idx_i * 3 + 2] -
+                    positions_curr_ptr[idx_k * 3 + 2]};
+    float R_diff_ik_curr[3];
+
+    core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init, R_diff_ik_curr);
+
+    local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
+    local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
+    local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+}
+
 #if defined(__CUDACC__)
 void FillInRigidAlignmentTermCUDA
 #else
@@ -146,6 +332,7 @@ void FillInRigidAlignmentTermCPU
     Atb.IndexSet({indices}, Atb_sub + Atb_local.View({12, 1}));
 }
 
+
 #if defined(__CUDACC__)
 void FillInSLACAlignmentTermCUDA
 #else
@@ -203,66 +390,18 @@ void FillInSLACAlignmentTermCPU
 
     core::ParallelFor(
             AtA.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
-                const float *Ti_Cp = Ti_Cps_ptr + 3 * workload_idx;
-                const float *Tj_Cq = Tj_Cqs_ptr + 3 * workload_idx;
-                const float *Cnormal_p = Cnormal_ps_ptr + 3 * workload_idx;
-                const float *Ri_Cnormal_p =
-                        Ri_Cnormal_ps_ptr + 3 * workload_idx;
-                const float *RjTRi_Cnormal_p =
-                        RjT_Ri_Cnormal_ps_ptr + 3 * workload_idx;
-
-                const int *cgrid_idx_p = cgrid_idx_ps_ptr + 8 * workload_idx;
-                const int *cgrid_idx_q = cgrid_idx_qs_ptr + 8 * workload_idx;
-                const float *cgrid_ratio_p =
-                        cgrid_ratio_ps_ptr + 8 * workload_idx;
-                const float *cgrid_ratio_q =
-                        cgrid_ratio_qs_ptr + 8 * workload_idx;
-
-                float r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
-                          (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
-                          (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
-                if (abs(r) > threshold) return;
-
                 // Now we fill in a 60 x 60 sub-matrix: 2 x (6 + 8 x 3)
+                float r;
                 float J[60];
                 int idx[60];
-
-                // Jacobian w.r.t. Ti: 0-6
-                J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
-                J[1] = Tj_Cq[2] * Ri_Cnormal_p[0] - Tj_Cq[0] * Ri_Cnormal_p[2];
-                J[2] = -Tj_Cq[1] * Ri_Cnormal_p[0] + Tj_Cq[0] * Ri_Cnormal_p[1];
-                J[3] = Ri_Cnormal_p[0];
-                J[4] = Ri_Cnormal_p[1];
-                J[5] = Ri_Cnormal_p[2];
-
-                // Jacobian w.r.t. Tj: 6-12
-                for (int k = 0; k < 6; ++k) {
-                    J[k + 6] = -J[k];
-
-                    idx[k + 0] = 6 * i + k;
-                    idx[k + 6] = 6 * j + k;
-                }
-
-                // Jacobian w.r.t. C over p: 12-36
-                for (int k = 0; k < 8; ++k) {
-                    J[12 + k * 3 + 0] = cgrid_ratio_p[k] * Cnormal_p[0];
-                    J[12 + k * 3 + 1] = cgrid_ratio_p[k] * Cnormal_p[1];
-                    J[12 + k * 3 + 2] = cgrid_ratio_p[k] * Cnormal_p[2];
-
-                    idx[12 + k * 3 + 0] = 6 * n_frags + cgrid_idx_p[k] * 3 + 0;
-                    idx[12 + k * 3 + 1] = 6 * n_frags + cgrid_idx_p[k] * 3 + 1;
-                    idx[12 + k * 3 + 2] = 6 * n_frags + cgrid_idx_p[k] * 3 + 2;
-                }
-
-                // Jacobian w.r.t. C over q: 36-60
-                for (int k = 0; k < 8; ++k) {
-                    J[36 + k * 3 + 0] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[0];
-                    J[36 + k * 3 + 1] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[1];
-                    J[36 + k * 3 + 2] = -cgrid_ratio_q[k] * RjTRi_Cnormal_p[2];
-
-                    idx[36 + k * 3 + 0] = 6 * n_frags + cgrid_idx_q[k] * 3 + 0;
-                    idx[36 + k * 3 + 1] = 6 * n_frags + cgrid_idx_q[k] * 3 + 1;
-                    idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
+                if (!GetSLACAlignmentJacobian(
+                            workload_idx, Ti_Cps_ptr, Tj_Cqs_ptr,
+                            Cnormal_ps_ptr, Ri_Cnormal_ps_ptr,
+                            RjT_Ri_Cnormal_ps_ptr, cgrid_idx_ps_ptr,
+                            cgrid_idx_qs_ptr, cgrid_ratio_ps_ptr,
+                            cgrid_ratio_qs_ptr, i, j, n_frags, threshold, r, J,
+                            idx)) {
+                    return;
                 }
 
         // Not optimized; Switch to reduction if necessary.
@@ -293,6 +432,101 @@ void FillInSLACAlignmentTermCPU
             });
 }
 
+#if defined(__CUDACC__)
+void FillInSLACAlignmentTermSparseCUDA
+#else
+void FillInSLACAlignmentTermSparseCPU
+#endif
+        (core::Tensor &AtA_blocks,
+         const core::Tensor &block_buf_indices,
+         core::Tensor &Atb,
+         core::Tensor &residual,
+         const core::Tensor &Ti_Cps,
+         const core::Tensor &Tj_Cqs,
+         const core::Tensor &Cnormal_ps,
+         const core::Tensor &Ri_Cnormal_ps,
+         const core::Tensor &RjT_Ri_Cnormal_ps,
+         const core::Tensor &cgrid_idx_ps,
+         const core::Tensor &cgrid_idx_qs,
+         const core::Tensor &cgrid_ratio_qs,
+         const core::Tensor &cgrid_ratio_ps,
+         int i,
+         int j,
+         int n_frags,
+         float threshold) {
+    int64_t n = Ti_Cps.GetLength();
+    if (block_buf_indices.GetLength() != n * 400) {
+        utility::LogError(
+                "Unable to setup linear system: expected {} block indices, "
+                "but got {}.",
+                n * 400, block_buf_indices.GetLength());
+    }
+
+    float *AtA_blocks_ptr = static_cast<float *>(AtA_blocks.GetDataPtr());
+    const int *block_buf_indices_ptr =
+            static_cast<const int *>(block_buf_indices.GetDataPtr());
+    float *Atb_ptr = static_cast<float *>(Atb.GetDataPtr());
+    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+
+    // Geometric properties
+    const float *Ti_Cps_ptr = static_cast<const float *>(Ti_Cps.GetDataPtr());
+    const float *Tj_Cqs_ptr = static_cast<const float *>(Tj_Cqs.GetDataPtr());
+    const float *Cnormal_ps_ptr =
+            static_cast<const float *>(Cnormal_ps.GetDataPtr());
+    const float *Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(Ri_Cnormal_ps.GetDataPtr());
+    const float *RjT_Ri_Cnormal_ps_ptr =
+            static_cast<const float *>(RjT_Ri_Cnormal_ps.GetDataPtr());
+
+    // Association properties
+    const int *cgrid_idx_ps_ptr =
+            static_cast<const int *>(cgrid_idx_ps.GetDataPtr());
+    const int *cgrid_idx_qs_ptr =
+            static_cast<const int *>(cgrid_idx_qs.GetDataPtr());
+    const float *cgrid_ratio_ps_ptr =
+            static_cast<const float *>(cgrid_ratio_ps.GetDataPtr());
+    const float *cgrid_ratio_qs_ptr =
+            static_cast<const float *>(cgrid_ratio_qs.GetDataPtr());
+
+    core::ParallelFor(
+            Atb.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                float r;
+                float J[60];
+                int idx[60];
+                if (!GetSLACAlignmentJacobian(
+                            workload_idx, Ti_Cps_ptr, Tj_Cqs_ptr,
+                            Cnormal_ps_ptr, Ri_Cnormal_ps_ptr,
+                            RjT_Ri_Cnormal_ps_ptr, cgrid_idx_ps_ptr,
+                            cgrid_idx_qs_ptr, cgrid_ratio_ps_ptr,
+                            cgrid_ratio_qs_ptr, i, j, n_frags, threshold, r, J,
+                            idx)) {
+                    return;
+                }
+
+                // The 60 variables form 20 groups of 3, and each pair of
+                // groups owns a 3x3 block in the block sparse system.
+                const int *buf_indices =
+                        block_buf_indices_ptr + 400 * workload_idx;
+                for (int bi = 0; bi < 20; ++bi) {
+                    for (int bj = 0; bj < 20; ++bj) {
+                        float *block =
+                                AtA_blocks_ptr + 9 * buf_indices[bi * 20 + bj];
+                        for (int u = 0; u < 3; ++u) {
+                            for (int v = 0; v < 3; ++v) {
+                                core::AtomicAddRelaxed(
+                                        block + u * 3 + v,
+                                        J[bi * 3 + u] * J[bj * 3 + v]);
+                            }
+                        }
+                    }
+                }
+                for (int k = 0; k < 60; ++k) {
+                    core::AtomicAddRelaxed(Atb_ptr + idx[k], J[k] * r);
+                }
+                core::AtomicAddRelaxed(residual_ptr, r * r);
+            });
+}
+
 #if defined(__CUDACC__)
 void FillInSLACRegularizerTermCUDA
 #else
@@ -336,98 +570,24 @@ void FillInSLACRegularizerTermCPU
                 const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
                 const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
 
-                // Build a 3x3 linear system to compute the local R
-                float cov[3][3] = {{0}};
-                float U[3][3], V[3][3], S[3];
-
-                int cnt = 0;
-                for (int k = 0; k < 6; ++k) {
-                    bool mask_k = mask_nbs[k];
-                    if (!mask_k) continue;
-
-                    int idx_k = idx_nbs[k];
-
-                    // Now build linear systems
-                    float diff_ik_init[3] = {
-                            positions_init_ptr[idx_i * 3 + 0] -
-                                    positions_init_ptr[idx_k * 3 + 0],
-                            positions_init_ptr[idx_i * 3 + 1] -
-                                    positions_init_ptr[idx_k * 3 + 1],
-                            positions_init_ptr[idx_i * 3 + 2] -
-                                    positions_init_ptr[idx_k * 3 + 2]};
-                    float diff_ik_curr[3] = {
-                            positions_curr_ptr[idx_i * 3 + 0] -
-                                    positions_curr_ptr[idx_k * 3 + 0],
-                            positions_curr_ptr[idx_i * 3 + 1] -
-                                    positions_curr_ptr[idx_k * 3 + 1],
-                            positions_curr_ptr[idx_i * 3 + 2] -
-                                    positions_curr_ptr[idx_k * 3 + 2]};
-
-                    // Build linear system by computing XY^T when formulating Y
-                    // = RX Y: curr X: init
-                    for (int i = 0; i < 3; ++i) {
-                        for (int j = 0; j < 3; ++j) {
-                            cov[i][j] += diff_ik_init[i] * diff_ik_curr[j];
-                        }
-                    }
-                    ++cnt;
-                }
-
-                if (cnt < 3) {
-                    return;
-                }
-
-                core::linalg::kernel::svd3x3(*cov, *U, S, *V);
-
                 float R[3][3];
-                core::linalg::kernel::transpose3x3_(*U);
-                core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
-
-                float d = core::linalg::kernel::det3x3(*R);
-
-                if (d < 0) {
-                    U[2][0] = -U[2][0];
-                    U[2][1] = -U[2][1];
-                    U[2][2] = -U[2][2];
-                    core::linalg::kernel::matmul3x3_3x3(*V, *U, *R);
+                if (!GetSLACRegularizerRotation(idx_i, idx_nbs, mask_nbs,
+                                                positions_init_ptr,
+                                                positions_curr_ptr, anchor_idx,
+                                                R)) {
+                    return;
                 }
 
-                // Now we have R, we build Hessian and residuals
-                // But first, we need to anchor a point
-                if (idx_i == anchor_idx) {
-                    R[0][0] = R[1][1] = R[2][2] = 1;
-                    R[0][1] = R[0][2] = R[1][0] = R[1][2] = R[2][0] = R[2][1] =
-                            0;
-                }
                 for (int k = 0; k < 6; ++k) {
                     bool mask_k = mask_nbs[k];
 
                     if (mask_k) {
                         int idx_k = idx_nbs[k];
 
-                        float diff_ik_init[3] = {
-                                positions_init_ptr[idx_i * 3 + 0] -
-                                        positions_init_ptr[idx_k * 3 + 0],
-                                positions_init_ptr[idx_i * 3 + 1] -
-                                        positions_init_ptr[idx_k * 3 + 1],
-                                positions_init_ptr[idx_i * 3 + 2] -
-                                        positions_init_ptr[idx_k * 3 + 2]};
-                        float diff_ik_curr[3] = {
-                                positions_curr_ptr[idx_i * 3 + 0] -
-                                        positions_curr_ptr[idx_k * 3 + 0],
-                                positions_curr_ptr[idx_i * 3 + 1] -
-                                        positions_curr_ptr[idx_k * 3 + 1],
-                                positions_curr_ptr[idx_i * 3 + 2] -
-                                        positions_curr_ptr[idx_k * 3 + 2]};
-                        float R_diff_ik_curr[3];
-
-                        core::linalg::kernel::matmul3x3_3x1(*R, diff_ik_init,
-                                                            R_diff_ik_curr);
-
                         float local_r[3];
-                        local_r[0] = diff_ik_curr[0] - R_diff_ik_curr[0];
-                        local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
-                        local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
+                        GetSLACRegularizerResidual(idx_i, idx_k, R,
+                                                   positions_init_ptr,
+                                                   positions_curr_ptr, local_r);
 
                         int offset_idx_i = 3 * idx_i + 6 * n_frags;
                         int offset_idx_k = 3 * idx_k + 6 * n_frags;
@@ -490,6 +650,104 @@ void FillInSLACRegularizerTermCPU
                 }
             });
 }
+
+#if defined(__CUDACC__)
+void FillInSLACRegularizerTermSparseCUDA
+#else
+void FillInSLACRegularizerTermSparseCPU
+#endif
+        (core::Tensor &AtA_blocks,
+         const core::Tensor &block_buf_indices,
+         core::Tensor &Atb,
+         core::Tensor &residual,
+         const core::Tensor &grid_idx,
+         const core::Tensor &grid_nbs_idx,
+         const core::Tensor &grid_nbs_mask,
+         const core::Tensor &positions_init,
+         const core::Tensor &positions_curr,
+         float weight,
+         int n_frags,
+         int anchor_idx) {
+
+    int64_t n = grid_idx.GetLength();
+    if (block_buf_indices.GetLength() != n * 24) {
+        utility::LogError(
+                "Unable to setup linear system: expected {} block indices, "
+                "but got {}.",
+                n * 24, block_buf_indices.GetLength());
+    }
+
+    float *AtA_blocks_ptr = static_cast<float *>(AtA_blocks.GetDataPtr());
+    const int *block_buf_indices_ptr =
+            static_cast<const int *>(block_buf_indices.GetDataPtr());
+    float *Atb_ptr = static_cast<float *>(Atb.GetDataPtr());
+    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+
+    const int *grid_idx_ptr = static_cast<const int *>(grid_idx.GetDataPtr());
+    const int *grid_nbs_idx_ptr =
+            static_cast<const int *>(grid_nbs_idx.GetDataPtr());
+    const bool *grid_nbs_mask_ptr =
+            static_cast<const bool *>(grid_nbs_mask.GetDataPtr());
+
+    const float *positions_init_ptr =
+            static_cast<const float *>(positions_init.GetDataPtr());
+    const float *positions_curr_ptr =
+            static_cast<const float *>(positions_curr.GetDataPtr());
+
+    core::ParallelFor(
+            Atb.GetDevice(), n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                // Enumerate 6 neighbors
+                int idx_i = grid_idx_ptr[workload_idx];
+
+                const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
+                const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
+
+                float R[3][3];
+                if (!GetSLACRegularizerRotation(idx_i, idx_nbs, mask_nbs,
+                                                positions_init_ptr,
+                                                positions_curr_ptr, anchor_idx,
+                                                R)) {
+                    return;
+                }
+
+                for (int k = 0; k < 6; ++k) {
+                    if (!mask_nbs[k]) continue;
+                    int idx_k = idx_nbs[k];
+
+                    float local_r[3];
+                    GetSLACRegularizerResidual(idx_i, idx_k, R,
+                                               positions_init_ptr,
+                                               positions_curr_ptr, local_r);
+
+                    core::AtomicAddRelaxed(
+                            residual_ptr,
+                            weight * (local_r[0] * local_r[0] +
+                                      local_r[1] * local_r[1] +
+                                      local_r[2] * local_r[2]));
+
+                    // Blocks (i, i), (k, k), (i, k) and (k, i), all diagonal.
+                    const int *buf_indices =
+                            block_buf_indices_ptr + 24 * workload_idx + 4 * k;
+                    const float signs[4] = {weight, weight, -weight, -weight};
+                    for (int b = 0; b < 4; ++b) {
+                        float *block = AtA_blocks_ptr + 9 * buf_indices[b];
+                        for (int axis = 0; axis < 3; ++axis) {
+                            core::AtomicAddRelaxed(block + axis * 4, signs[b]);
+                        }
+                    }
+
+                    int offset_idx_i = 3 * idx_i + 6 * n_frags;
+                    int offset_idx_k = 3 * idx_k + 6 * n_frags;
+                    for (int axis = 0; axis < 3; ++axis) {
+                        core::AtomicAddRelaxed(&Atb_ptr[offset_idx_i + axis],
+                                               weight * local_r[axis]);
+                        core::AtomicAddRelaxed(&Atb_ptr[offset_idx_k + axis],
+                                               -weight * local_r[axis]);
+                    }
+                }
+            });
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/RANSAC.h"
+
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void EstimateRANSACHypotheses(const core::Tensor &source_points,
+                              const core::Tensor &target_points,
+                              const core::Tensor &sample_indices,
+                              core::Tensor &transformations) {
+    const core::Dtype dtype = source_points.GetDtype();
+    const core::Device device = source_points.GetDevice();
+
+    core::AssertTensorDtypes(source_points, {core::Float32, core::Float64});
+    core::AssertTensorShape(source_points, {utility::nullopt, 3});
+    core::AssertTensorShape(target_points, source_points.GetShape());
+    core::AssertTensorDtype(target_points, dtype);
+    core::AssertTensorDevice(target_points, device);
+    core::AssertTensorShape(sample_indices,
+                            {utility::nullopt, utility::nullopt});
+    core::AssertTensorDtype(sample_indices, core::Int64);
+    core::AssertTensorDevice(sample_indices, device);
+    if (sample_indices.GetShape(1) < 3) {
+        utility::LogError("Each sample needs at least 3 correspondences.");
+    }
+
+    transformations = core::Tensor::Empty({sample_indices.GetLength(), 4, 4},
+                                          dtype, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateRANSACHypothesesCPU(source_points.Contiguous(),
+                                    target_points.Contiguous(),
+                                    sample_indices.Contiguous(),
+                                    transformations);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EstimateRANSACHypothesesCUDA, source_points.Contiguous(),
+                  target_points.Contiguous(), sample_indices.Contiguous(),
+                  transformations);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EvaluateRANSACHypotheses(const core::Tensor &source_points,
+                              const core::Tensor &target_points,
+                              const core::Tensor &transformations,
+                              double max_correspondence_distance,
+                              core::Tensor &inlier_counts,
+                              core::Tensor &inlier_errors) {
+    const core::Dtype dtype = source_points.GetDtype();
+    const core::Device device = source_points.GetDevice();
+
+    core::AssertTensorDtypes(source_points, {core::Float32, core::Float64});
+    core::AssertTensorShape(source_points, {utility::nullopt, 3});
+    core::AssertTensorShape(target_points, source_points.GetShape());
+    core::AssertTensorDtype(target_points, dtype);
+    core::AssertTensorDevice(target_points, device);
+    core::AssertTensorShape(transformations, {utility::nullopt, 4, 4});
+    core::AssertTensorDtype(transformations, dtype);
+    core::AssertTensorDevice(transformations, device);
+
+    const int64_t num_hypotheses = transformations.GetLength();
+    inlier_counts =
+            core::Tensor::Zeros({num_hypotheses}, core::Int32, device);
+    inlier_errors = core::Tensor::Zeros({num_hypotheses}, dtype, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EvaluateRANSACHypothesesCPU(
+                source_points.Contiguous(), target_points.Contiguous(),
+                transformations.Contiguous(), max_correspondence_distance,
+                inlier_counts, inlier_errors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EvaluateRANSACHypothesesCUDA, source_points.Contiguous(),
+                  target_points.Contiguous(), transformations.Contiguous(),
+                  max_correspondence_distance, inlier_counts, inlier_errors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
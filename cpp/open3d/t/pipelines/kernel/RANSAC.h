@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \brief Estimates one rigid transformation per RANSAC sample with the
+/// Kabsch algorithm, all samples in parallel.
+///
+/// \param source_points Source positions of the correspondences, {C, 3} of
+/// Float32 or Float64 dtype.
+/// \param target_points Target positions of the correspondences, {C, 3} of
+/// the same dtype, where source_points[i] corresponds to target_points[i].
+/// \param sample_indices Int64 {B, n} indices into the correspondences, one
+/// row of n >= 3 distinct correspondences per hypothesis.
+/// \param transformations Output {B, 4, 4} source to target transformations
+/// of the points' dtype.
+void EstimateRANSACHypotheses(const core::Tensor &source_points,
+                              const core::Tensor &target_points,
+                              const core::Tensor &sample_indices,
+                              core::Tensor &transformations);
+
+/// \brief Scores every hypothesis against all correspondences in parallel.
+///
+/// \param source_points Source positions of the correspondences, {C, 3}.
+/// \param target_points Target positions of the correspondences, {C, 3}.
+/// \param transformations {B, 4, 4} hypotheses of the points' dtype.
+/// \param max_correspondence_distance Inlier distance threshold.
+/// \param inlier_counts Output Int32 {B,} number of correspondences within
+/// the threshold after transformation.
+/// \param inlier_errors Output {B,} sum of the squared inlier distances, of
+/// the points' dtype.
+void EvaluateRANSACHypotheses(const core::Tensor &source_points,
+                              const core::Tensor &target_points,
+                              const core::Tensor &transformations,
+                              double max_correspondence_distance,
+                              core::Tensor &inlier_counts,
+                              core::Tensor &inlier_errors);
+
+void EstimateRANSACHypothesesCPU(const core::Tensor &source_points,
+                                 const core::Tensor &target_points,
+                                 const core::Tensor &sample_indices,
+                                 core::Tensor &transformations);
+
+void EvaluateRANSACHypothesesCPU(const core::Tensor &source_points,
+                                 const core::Tensor &target_points,
+                                 const core::Tensor &transformations,
+                                 double max_correspondence_distance,
+                                 core::Tensor &inlier_counts,
+                                 core::Tensor &inlier_errors);
+
+#ifdef BUILD_CUDA_MODULE
+void EstimateRANSACHypothesesCUDA(const core::Tensor &source_points,
+                                  const core::Tensor &target_points,
+                                  const core::Tensor &sample_indices,
+                                  core::Tensor &transformations);
+
+void EvaluateRANSACHypothesesCUDA(const core::Tensor &source_points,
+                                  const core::Tensor &target_points,
+                                  const core::Tensor &transformations,
+                                  double max_correspondence_distance,
+                                  core::Tensor &inlier_counts,
+                                  core::Tensor &inlier_errors);
+#endif
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,193 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#pragma once
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
+#include "open3d/t/pipelines/kernel/RANSAC.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+#if defined(__CUDACC__)
+void EstimateRANSACHypothesesCUDA
+#else
+void EstimateRANSACHypothesesCPU
+#endif
+        (const core::Tensor &source_points,
+         const core::Tensor &target_points,
+         const core::Tensor &sample_indices,
+         core::Tensor &transformations) {
+    const int64_t num_hypotheses = sample_indices.GetLength();
+    const int64_t sample_size = sample_indices.GetShape(1);
+    const int64_t *sample_indices_ptr = sample_indices.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(source_points.GetDtype(), [&]() {
+        const scalar_t *source_ptr = source_points.GetDataPtr<scalar_t>();
+        const scalar_t *target_ptr = target_points.GetDataPtr<scalar_t>();
+        scalar_t *transformations_ptr = transformations.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(
+                source_points.GetDevice(), num_hypotheses,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t *sample =
+                            sample_indices_ptr + workload_idx * sample_size;
+
+                    scalar_t mean_s[3] = {0, 0, 0};
+                    scalar_t mean_t[3] = {0, 0, 0};
+                    for (int64_t k = 0; k < sample_size; ++k) {
+                        for (int d = 0; d < 3; ++d) {
+                            mean_s[d] += source_ptr[3 * sample[k] + d];
+                            mean_t[d] += target_ptr[3 * sample[k] + d];
+                        }
+                    }
+                    for (int d = 0; d < 3; ++d) {
+                        mean_s[d] /= sample_size;
+                        mean_t[d] /= sample_size;
+                    }
+
+                    // Cross covariance Sxy = sum (t - mean_t)(s - mean_s)^T.
+                    scalar_t Sxy[9] = {0};
+                    for (int64_t k = 0; k < sample_size; ++k) {
+                        const scalar_t *s = source_ptr + 3 * sample[k];
+                        const scalar_t *t = target_ptr + 3 * sample[k];
+                        for (int i = 0; i < 3; ++i) {
+                            for (int j = 0; j < 3; ++j) {
+                                Sxy[i * 3 + j] += (t[i] - mean_t[i]) *
+                                                  (s[j] - mean_s[j]);
+                            }
+                        }
+                    }
+
+                    // U and V are rotations, and the reflection case is
+                    // absorbed by a negative last singular value, so U V^T
+                    // is the Kabsch rotation.
+                    scalar_t U[9], S[3], V[9];
+                    core::linalg::kernel::svd3x3(Sxy, U, S, V, 6);
+
+                    scalar_t *T = transformations_ptr + 16 * workload_idx;
+                    for (int i = 0; i < 3; ++i) {
+                        for (int j = 0; j < 3; ++j) {
+                            T[i * 4 + j] = U[i * 3 + 0] * V[j * 3 + 0] +
+                                           U[i * 3 + 1] * V[j * 3 + 1] +
+                                           U[i * 3 + 2] * V[j * 3 + 2];
+                        }
+                        T[i * 4 + 3] = mean_t[i] - T[i * 4 + 0] * mean_s[0] -
+                                       T[i * 4 + 1] * mean_s[1] -
+                                       T[i * 4 + 2] * mean_s[2];
+                    }
+                    T[12] = T[13] = T[14] = 0;
+                    T[15] = 1;
+                });
+    });
+}
+
+/// Squared distance between \p T applied to \p s and \p t.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE scalar_t
+GetSquaredResidual(const scalar_t *T, const scalar_t *s, const scalar_t *t) {
+    scalar_t d2 = 0;
+    for (int r = 0; r < 3; ++r) {
+        const scalar_t diff = T[r * 4 + 0] * s[0] + T[r * 4 + 1] * s[1] +
+                              T[r * 4 + 2] * s[2] + T[r * 4 + 3] - t[r];
+        d2 += diff * diff;
+    }
+    return d2;
+}
+
+#if defined(__CUDACC__)
+void EvaluateRANSACHypothesesCUDA
+#else
+void EvaluateRANSACHypothesesCPU
+#endif
+        (const core::Tensor &source_points,
+         const core::Tensor &target_points,
+         const core::Tensor &transformations,
+         double max_correspondence_distance,
+         core::Tensor &inlier_counts,
+         core::Tensor &inlier_errors) {
+    const int64_t num_correspondences = source_points.GetLength();
+    const int64_t num_hypotheses = transformations.GetLength();
+    int32_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int32_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(source_points.GetDtype(), [&]() {
+        const scalar_t *source_ptr = source_points.GetDataPtr<scalar_t>();
+        const scalar_t *target_ptr = target_points.GetDataPtr<scalar_t>();
+        const scalar_t *transformations_ptr =
+                transformations.GetDataPtr<scalar_t>();
+        scalar_t *inlier_errors_ptr = inlier_errors.GetDataPtr<scalar_t>();
+        const scalar_t threshold2 = static_cast<scalar_t>(
+                max_correspondence_distance * max_correspondence_distance);
+
+#if defined(__CUDACC__)
+        // One thread per (hypothesis, correspondence) pair.
+        core::ParallelFor(
+                source_points.GetDevice(),
+                num_hypotheses * num_correspondences,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t h = workload_idx / num_correspondences;
+                    const int64_t i = workload_idx % num_correspondences;
+                    const scalar_t d2 = GetSquaredResidual(
+                            transformations_ptr + 16 * h, source_ptr + 3 * i,
+                            target_ptr + 3 * i);
+                    if (d2 < threshold2) {
+                        atomicAdd(&inlier_counts_ptr[h], 1);
+                        atomicAdd(&inlier_errors_ptr[h], d2);
+                    }
+                });
+#else
+        // One thread per hypothesis, avoiding atomics on the host.
+        core::ParallelFor(
+                source_points.GetDevice(), num_hypotheses, [=](int64_t h) {
+                    int32_t count = 0;
+                    scalar_t error = 0;
+                    for (int64_t i = 0; i < num_correspondences; ++i) {
+                        const scalar_t d2 = GetSquaredResidual(
+                                transformations_ptr + 16 * h,
+                                source_ptr + 3 * i, target_ptr + 3 * i);
+                        if (d2 < threshold2) {
+                            ++count;
+                            error += d2;
+                        }
+                    }
+                    inlier_counts_ptr[h] = count;
+                    inlier_errors_ptr[h] = error;
+                });
+#endif
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -208,6 +208,57 @@ void ComputeOdometryResultHybrid(const core::Tensor &source_depth,
     }
 }
 
+void ComputeOdometryResultHybridFused(
+        const core::Tensor &source_depth,
+        const core::Tensor &target_depth,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_intensity,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        core::Tensor &delta,
+        float &inlier_residual,
+        int &inlier_count,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta) {
+    // Only Float32 is supported as of now. TODO. Support Float64.
+    core::AssertTensorDtypes(source_depth, {core::Float32});
+
+    const core::Dtype supported_dtype = source_depth.GetDtype();
+    const core::Device device = source_depth.GetDevice();
+
+    core::AssertTensorDtype(target_depth, supported_dtype);
+    core::AssertTensorDtype(source_intensity, supported_dtype);
+    core::AssertTensorDtype(target_intensity, supported_dtype);
+
+    core::AssertTensorDevice(target_depth, device);
+    core::AssertTensorDevice(source_intensity, device);
+    core::AssertTensorDevice(target_intensity, device);
+
+    core::AssertTensorShape(intrinsics, {3, 3});
+    core::AssertTensorShape(init_source_to_target, {4, 4});
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d = intrinsics.To(host, core::Float64).Contiguous();
+    core::Tensor trans_d =
+            init_source_to_target.To(host, core::Float64).Contiguous();
+
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ComputeOdometryResultHybridFusedCPU(
+                source_depth, target_depth, source_intensity, target_intensity,
+                intrinsics_d, trans_d, delta, inlier_residual, inlier_count,
+                depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeOdometryResultHybridFusedCUDA, source_depth,
+                  target_depth, source_intensity, target_intensity,
+                  intrinsics_d, trans_d, delta, inlier_residual, inlier_count,
+                  depth_outlier_trunc, depth_huber_delta,
+                  intensity_huber_delta);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
 }  // namespace odometry
 }  // namespace kernel
 }  // namespace pipelines
@@ -79,6 +79,22 @@ void ComputeOdometryResultHybrid(const core::Tensor &source_depth,
                                  const float depth_huber_delta,
                                  const float intensity_huber_delta);
 
+/// Hybrid odometry on raw Float32 depth and intensity images. The source
+/// vertices and the target gradients are computed inside the kernel.
+void ComputeOdometryResultHybridFused(
+        const core::Tensor &source_depth,
+        const core::Tensor &target_depth,
+        const core::Tensor &source_intensity,
+        const core::Tensor &target_intensity,
+        const core::Tensor &intrinsics,
+        const core::Tensor &init_source_to_target,
+        core::Tensor &delta,
+        float &inlier_residual,
+        int &inlier_count,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta);
+
 }  // namespace odometry
 }  // namespace kernel
 }  // namespace pipelines
@@ -326,6 +326,98 @@ void ComputeOdometryResultHybridCPU(const core::Tensor& source_depth,
     DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
 }
 
+void ComputeOdometryResultHybridFusedCPU(
+        const core::Tensor& source_depth,
+        const core::Tensor& target_depth,
+        const core::Tensor& source_intensity,
+        const core::Tensor& target_intensity,
+        const core::Tensor& intrinsics,
+        const core::Tensor& init_source_to_target,
+        core::Tensor& delta,
+        float& inlier_residual,
+        int& inlier_count,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta) {
+    NDArrayIndexer source_depth_indexer(source_depth, 2);
+    NDArrayIndexer target_depth_indexer(target_depth, 2);
+
+    NDArrayIndexer source_intensity_indexer(source_intensity, 2);
+    NDArrayIndexer target_intensity_indexer(target_intensity, 2);
+
+    core::Tensor trans = init_source_to_target;
+    t::geometry::kernel::TransformIndexer ti(intrinsics, trans);
+
+    // Output
+    int64_t rows = source_depth_indexer.GetShape(0);
+    int64_t cols = source_depth_indexer.GetShape(1);
+
+    core::Device device = source_depth.GetDevice();
+
+    int64_t n = rows * cols;
+
+    std::vector<float> A_1x29(29, 0.0);
+
+#ifdef _MSC_VER
+    std::vector<float> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     workload_idx++) {
+#else
+    float* A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    int y = workload_idx / cols;
+                    int x = workload_idx % cols;
+
+                    float J_I[6], J_D[6];
+                    float r_I, r_D;
+
+                    bool valid = GetJacobianHybridFused(
+                            x, y, depth_outlier_trunc, source_depth_indexer,
+                            target_depth_indexer, source_intensity_indexer,
+                            target_intensity_indexer, ti, J_I, J_D, r_I, r_D);
+
+                    if (valid) {
+                        float d_huber_I =
+                                HuberDeriv(r_I, intensity_huber_delta);
+                        float d_huber_D = HuberDeriv(r_D, depth_huber_delta);
+
+                        float r_huber_I = HuberLoss(r_I, intensity_huber_delta);
+                        float r_huber_D = HuberLoss(r_D, depth_huber_delta);
+
+                        for (int i = 0, j = 0; j < 6; j++) {
+                            for (int k = 0; k <= j; k++) {
+                                A_reduction[i] +=
+                                        J_I[j] * J_I[k] + J_D[j] * J_D[k];
+                                i++;
+                            }
+                            A_reduction[21 + j] +=
+                                    J_I[j] * d_huber_I + J_D[j] * d_huber_D;
+                        }
+                        A_reduction[27] += r_huber_I + r_huber_D;
+                        A_reduction[28] += 1;
+                    }
+                }
+#ifdef _MSC_VER
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<float> a, std::vector<float> b) {
+                std::vector<float> result(29);
+                for (int j = 0; j < 29; j++) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+    core::Tensor A_reduction_tensor(A_1x29, {29}, core::Float32, device);
+    DecodeAndSolve6x6(A_reduction_tensor, delta, inlier_residual, inlier_count);
+}
+
 }  // namespace odometry
 }  // namespace kernel
 }  // namespace pipelines
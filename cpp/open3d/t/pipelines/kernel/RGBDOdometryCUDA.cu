@@ -29,6 +29,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/ParallelFor.h"
+#include "open3d/core/ScratchScope.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
@@ -49,6 +50,7 @@ __global__ void ComputeOdometryResultPointToPlaneCUDAKernel(
         NDArrayIndexer target_normal_indexer,
         TransformIndexer ti,
         float* global_sum,
+        const int64_t block_sum_stride,
         int rows,
         int cols,
         const float depth_outlier_trunc,
@@ -61,6 +63,7 @@ __global__ void ComputeOdometryResultPointToPlaneCUDAKernel(
     const int x = threadIdx.x + blockIdx.x * blockDim.x;
     const int y = threadIdx.y + blockIdx.y * blockDim.y;
     const int tid = threadIdx.x + threadIdx.y * blockDim.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
 
     local_sum0[tid] = 0;
     local_sum1[tid] = 0;
@@ -146,20 +149,23 @@ void ComputeOdometryResultPointToPlaneCUDA(
     const int64_t rows = source_vertex_indexer.GetShape(0);
     const int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, core::Float32, device);
-    float* global_sum_ptr = global_sum.GetDataPtr<float>();
-
     const int kThreadSize = 16;
     const dim3 blocks((cols + kThreadSize - 1) / kThreadSize,
                       (rows + kThreadSize - 1) / kThreadSize);
     const dim3 threads(kThreadSize, kThreadSize);
+
+    const int64_t block_sum_stride = GetBlockSumStride(29);
+    core::Tensor global_sum = CreateBlockSums(int64_t(blocks.x) * blocks.y, 29,
+                                              core::Float32, device);
+    float* global_sum_ptr = global_sum.GetDataPtr<float>();
     ComputeOdometryResultPointToPlaneCUDAKernel<<<blocks, threads, 0,
                                                   core::cuda::GetStream()>>>(
             source_vertex_indexer, target_vertex_indexer, target_normal_indexer,
-            ti, global_sum_ptr, rows, cols, depth_outlier_trunc,
-            depth_huber_delta);
+            ti, global_sum_ptr, block_sum_stride, rows, cols,
+            depth_outlier_trunc, depth_huber_delta);
     core::cuda::Synchronize();
-    DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
+    DecodeAndSolve6x6(ReduceBlockSums(global_sum), delta, inlier_residual,
+                      inlier_count);
 }
 
 __global__ void ComputeOdometryResultIntensityCUDAKernel(
@@ -172,6 +178,7 @@ __global__ void ComputeOdometryResultIntensityCUDAKernel(
         NDArrayIndexer source_vertex_indexer,
         TransformIndexer ti,
         float* global_sum,
+        const int64_t block_sum_stride,
         int rows,
         int cols,
         const float depth_outlier_trunc,
@@ -184,6 +191,7 @@ __global__ void ComputeOdometryResultIntensityCUDAKernel(
     const int x = threadIdx.x + blockIdx.x * blockDim.x;
     const int y = threadIdx.y + blockIdx.y * blockDim.y;
     const int tid = threadIdx.x + threadIdx.y * blockDim.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
 
     local_sum0[tid] = 0;
     local_sum1[tid] = 0;
@@ -253,22 +261,25 @@ void ComputeOdometryResultIntensityCUDA(
     const int64_t rows = source_vertex_indexer.GetShape(0);
     const int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, core::Float32, device);
-    float* global_sum_ptr = global_sum.GetDataPtr<float>();
-
     const int kThreadSize = 16;
     const dim3 blocks((cols + kThreadSize - 1) / kThreadSize,
                       (rows + kThreadSize - 1) / kThreadSize);
     const dim3 threads(kThreadSize, kThreadSize);
+
+    const int64_t block_sum_stride = GetBlockSumStride(29);
+    core::Tensor global_sum = CreateBlockSums(int64_t(blocks.x) * blocks.y, 29,
+                                              core::Float32, device);
+    float* global_sum_ptr = global_sum.GetDataPtr<float>();
     ComputeOdometryResultIntensityCUDAKernel<<<blocks, threads, 0,
                                                core::cuda::GetStream()>>>(
             source_depth_indexer, target_depth_indexer,
             source_intensity_indexer, target_intensity_indexer,
             target_intensity_dx_indexer, target_intensity_dy_indexer,
-            source_vertex_indexer, ti, global_sum_ptr, rows, cols,
-            depth_outlier_trunc, intensity_huber_delta);
+            source_vertex_indexer, ti, global_sum_ptr, block_sum_stride, rows,
+            cols, depth_outlier_trunc, intensity_huber_delta);
     core::cuda::Synchronize();
-    DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
+    DecodeAndSolve6x6(ReduceBlockSums(global_sum), delta, inlier_residual,
+                      inlier_count);
 }
 
 __global__ void ComputeOdometryResultHybridCUDAKernel(
@@ -283,6 +294,7 @@ __global__ void ComputeOdometryResultHybridCUDAKernel(
         NDArrayIndexer source_vertex_indexer,
         TransformIndexer ti,
         float* global_sum,
+        const int64_t block_sum_stride,
         int rows,
         int cols,
         const float depth_outlier_trunc,
@@ -296,6 +308,7 @@ __global__ void ComputeOdometryResultHybridCUDAKernel(
     const int x = threadIdx.x + blockIdx.x * blockDim.x;
     const int y = threadIdx.y + blockIdx.y * blockDim.y;
     const int tid = threadIdx.x + threadIdx.y * blockDim.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
 
     local_sum0[tid] = 0;
     local_sum1[tid] = 0;
@@ -374,23 +387,133 @@ void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
     const int64_t rows = source_vertex_indexer.GetShape(0);
     const int64_t cols = source_vertex_indexer.GetShape(1);
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, core::Float32, device);
-    float* global_sum_ptr = global_sum.GetDataPtr<float>();
-
     const int kThreadSize = 16;
     const dim3 blocks((cols + kThreadSize - 1) / kThreadSize,
                       (rows + kThreadSize - 1) / kThreadSize);
     const dim3 threads(kThreadSize, kThreadSize);
+
+    const int64_t block_sum_stride = GetBlockSumStride(29);
+    core::Tensor global_sum = CreateBlockSums(int64_t(blocks.x) * blocks.y, 29,
+                                              core::Float32, device);
+    float* global_sum_ptr = global_sum.GetDataPtr<float>();
     ComputeOdometryResultHybridCUDAKernel<<<blocks, threads, 0,
                                             core::cuda::GetStream()>>>(
             source_depth_indexer, target_depth_indexer,
             source_intensity_indexer, target_intensity_indexer,
             target_depth_dx_indexer, target_depth_dy_indexer,
             target_intensity_dx_indexer, target_intensity_dy_indexer,
-            source_vertex_indexer, ti, global_sum_ptr, rows, cols,
-            depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
+            source_vertex_indexer, ti, global_sum_ptr, block_sum_stride, rows,
+            cols, depth_outlier_trunc, depth_huber_delta,
+            intensity_huber_delta);
+    core::cuda::Synchronize();
+    DecodeAndSolve6x6(ReduceBlockSums(global_sum), delta, inlier_residual,
+                      inlier_count);
+}
+
+__global__ void ComputeOdometryResultHybridFusedCUDAKernel(
+        NDArrayIndexer source_depth_indexer,
+        NDArrayIndexer target_depth_indexer,
+        NDArrayIndexer source_intensity_indexer,
+        NDArrayIndexer target_intensity_indexer,
+        TransformIndexer ti,
+        float* global_sum,
+        const int64_t block_sum_stride,
+        int rows,
+        int cols,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta) {
+    const int kBlockSize = 256;
+    __shared__ float local_sum0[kBlockSize];
+    __shared__ float local_sum1[kBlockSize];
+    __shared__ float local_sum2[kBlockSize];
+
+    const int x = threadIdx.x + blockIdx.x * blockDim.x;
+    const int y = threadIdx.y + blockIdx.y * blockDim.y;
+    const int tid = threadIdx.x + threadIdx.y * blockDim.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    if (y >= rows || x >= cols) return;
+
+    float J_I[6] = {0}, J_D[6] = {0}, reduction[21 + 6 + 2];
+    float r_I = 0, r_D = 0;
+    bool valid = GetJacobianHybridFused(
+            x, y, depth_outlier_trunc, source_depth_indexer,
+            target_depth_indexer, source_intensity_indexer,
+            target_intensity_indexer, ti, J_I, J_D, r_I, r_D);
+
+    float d_huber_D = HuberDeriv(r_D, depth_huber_delta);
+    float d_huber_I = HuberDeriv(r_I, intensity_huber_delta);
+
+    float r_huber_D = HuberLoss(r_D, depth_huber_delta);
+    float r_huber_I = HuberLoss(r_I, intensity_huber_delta);
+
+    // Dump J, r into JtJ and Jtr
+    int offset = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j <= i; ++j) {
+            reduction[offset++] = J_I[i] * J_I[j] + J_D[i] * J_D[j];
+        }
+    }
+    for (int i = 0; i < 6; ++i) {
+        reduction[offset++] = J_I[i] * d_huber_I + J_D[i] * d_huber_D;
+    }
+    reduction[offset++] = r_huber_D + r_huber_I;
+    reduction[offset++] = valid;
+
+    ReduceSum6x6LinearSystem<float, kBlockSize>(tid, valid, reduction,
+                                                local_sum0, local_sum1,
+                                                local_sum2, global_sum);
+}
+
+void ComputeOdometryResultHybridFusedCUDA(
+        const core::Tensor& source_depth,
+        const core::Tensor& target_depth,
+        const core::Tensor& source_intensity,
+        const core::Tensor& target_intensity,
+        const core::Tensor& intrinsics,
+        const core::Tensor& init_source_to_target,
+        core::Tensor& delta,
+        float& inlier_residual,
+        int& inlier_count,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta) {
+    NDArrayIndexer source_depth_indexer(source_depth, 2);
+    NDArrayIndexer target_depth_indexer(target_depth, 2);
+
+    NDArrayIndexer source_intensity_indexer(source_intensity, 2);
+    NDArrayIndexer target_intensity_indexer(target_intensity, 2);
+
+    core::Device device = source_depth.GetDevice();
+    core::Tensor trans = init_source_to_target;
+    t::geometry::kernel::TransformIndexer ti(intrinsics, trans);
+
+    const int64_t rows = source_depth_indexer.GetShape(0);
+    const int64_t cols = source_depth_indexer.GetShape(1);
+
+    const int kThreadSize = 16;
+    const dim3 blocks((cols + kThreadSize - 1) / kThreadSize,
+                      (rows + kThreadSize - 1) / kThreadSize);
+    const dim3 threads(kThreadSize, kThreadSize);
+
+    const int64_t block_sum_stride = GetBlockSumStride(29);
+    core::Tensor global_sum = CreateBlockSums(int64_t(blocks.x) * blocks.y, 29,
+                                              core::Float32, device);
+    float* global_sum_ptr = global_sum.GetDataPtr<float>();
+    ComputeOdometryResultHybridFusedCUDAKernel<<<blocks, threads, 0,
+                                                 core::cuda::GetStream()>>>(
+            source_depth_indexer, target_depth_indexer,
+            source_intensity_indexer, target_intensity_indexer, ti,
+            global_sum_ptr, block_sum_stride, rows, cols, depth_outlier_trunc,
+            depth_huber_delta, intensity_huber_delta);
     core::cuda::Synchronize();
-    DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
+    DecodeAndSolve6x6(ReduceBlockSums(global_sum), delta, inlier_residual,
+                      inlier_count);
 }
 
 }  // namespace odometry
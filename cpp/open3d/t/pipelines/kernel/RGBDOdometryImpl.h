@@ -80,6 +80,21 @@ void ComputeOdometryResultHybridCPU(const core::Tensor& source_depth,
                                     float depth_outlier_trunc,
                                     const float depth_huber_delta,
                                     const float intensity_huber_delta);
+
+void ComputeOdometryResultHybridFusedCPU(
+        const core::Tensor& source_depth,
+        const core::Tensor& target_depth,
+        const core::Tensor& source_intensity,
+        const core::Tensor& target_intensity,
+        const core::Tensor& intrinsics,
+        const core::Tensor& init_source_to_target,
+        core::Tensor& delta,
+        float& inlier_residual,
+        int& inlier_count,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta);
+
 #ifdef BUILD_CUDA_MODULE
 
 void ComputeOdometryResultPointToPlaneCUDA(
@@ -127,6 +142,20 @@ void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
                                      const float depth_outlier_trunc,
                                      const float depth_huber_delta,
                                      const float intensity_huber_delta);
+
+void ComputeOdometryResultHybridFusedCUDA(
+        const core::Tensor& source_depth,
+        const core::Tensor& target_depth,
+        const core::Tensor& source_intensity,
+        const core::Tensor& target_intensity,
+        const core::Tensor& intrinsics,
+        const core::Tensor& init_source_to_target,
+        core::Tensor& delta,
+        float& inlier_residual,
+        int& inlier_count,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta);
 #endif
 
 }  // namespace odometry
@@ -182,6 +182,64 @@ OPEN3D_HOST_DEVICE inline bool GetJacobianIntensity(
     return true;
 }
 
+/// Fills the hybrid intensity and depth Jacobians and residuals of a source
+/// point transformed to \p T_source_to_target_v in the target camera, given
+/// the (scaled) target gradients at its projection.
+OPEN3D_HOST_DEVICE inline void FillJacobianHybrid(
+        const float* T_source_to_target_v,
+        float fx,
+        float fy,
+        float diff_I,
+        float dIdx,
+        float dIdy,
+        float diff_D,
+        float dDdx,
+        float dDdy,
+        float* J_I,
+        float* J_D,
+        float& r_I,
+        float& r_D) {
+    // sqrt 0.5, according to
+    // http://redwood-data.org/indoor_lidar_rgbd/supp.pdf
+    const float sqrt_lambda_intensity = 0.707;
+    const float sqrt_lambda_depth = 0.707;
+
+    float invz = 1 / T_source_to_target_v[2];
+    float c0 = dIdx * fx * invz;
+    float c1 = dIdy * fy * invz;
+    float c2 = -(c0 * T_source_to_target_v[0] + c1 * T_source_to_target_v[1]) *
+               invz;
+    float d0 = dDdx * fx * invz;
+    float d1 = dDdy * fy * invz;
+    float d2 = -(d0 * T_source_to_target_v[0] + d1 * T_source_to_target_v[1]) *
+               invz;
+
+    J_I[0] = sqrt_lambda_intensity *
+             (-T_source_to_target_v[2] * c1 + T_source_to_target_v[1] * c2);
+    J_I[1] = sqrt_lambda_intensity *
+             (T_source_to_target_v[2] * c0 - T_source_to_target_v[0] * c2);
+    J_I[2] = sqrt_lambda_intensity *
+             (-T_source_to_target_v[1] * c0 + T_source_to_target_v[0] * c1);
+    J_I[3] = sqrt_lambda_intensity * (c0);
+    J_I[4] = sqrt_lambda_intensity * (c1);
+    J_I[5] = sqrt_lambda_intensity * (c2);
+    r_I = sqrt_lambda_intensity * diff_I;
+
+    J_D[0] = sqrt_lambda_depth *
+             ((-T_source_to_target_v[2] * d1 + T_source_to_target_v[1] * d2) -
+              T_source_to_target_v[1]);
+    J_D[1] = sqrt_lambda_depth *
+             ((T_source_to_target_v[2] * d0 - T_source_to_target_v[0] * d2) +
+              T_source_to_target_v[0]);
+    J_D[2] = sqrt_lambda_depth *
+             ((-T_source_to_target_v[1] * d0 + T_source_to_target_v[0] * d1));
+    J_D[3] = sqrt_lambda_depth * (d0);
+    J_D[4] = sqrt_lambda_depth * (d1);
+    J_D[5] = sqrt_lambda_depth * (d2 - 1.0f);
+
+    r_D = sqrt_lambda_depth * diff_D;
+}
+
 OPEN3D_HOST_DEVICE inline bool GetJacobianHybrid(
         int x,
         int y,
@@ -200,10 +258,6 @@ OPEN3D_HOST_DEVICE inline bool GetJacobianHybrid(
         float* J_D,
         float& r_I,
         float& r_D) {
-    // sqrt 0.5, according to
-    // http://redwood-data.org/indoor_lidar_rgbd/supp.pdf
-    const float sqrt_lambda_intensity = 0.707;
-    const float sqrt_lambda_depth = 0.707;
     const float sobel_scale = 0.125;
 
     float* source_v = source_vertex_indexer.GetDataPtr<float>(x, y);
@@ -250,40 +304,105 @@ OPEN3D_HOST_DEVICE inline bool GetJacobianHybrid(
     float dIdy = sobel_scale *
                  (*target_intensity_dy_indexer.GetDataPtr<float>(u_t, v_t));
 
-    float invz = 1 / T_source_to_target_v[2];
-    float c0 = dIdx * fx * invz;
-    float c1 = dIdy * fy * invz;
-    float c2 = -(c0 * T_source_to_target_v[0] + c1 * T_source_to_target_v[1]) *
-               invz;
-    float d0 = dDdx * fx * invz;
-    float d1 = dDdy * fy * invz;
-    float d2 = -(d0 * T_source_to_target_v[0] + d1 * T_source_to_target_v[1]) *
-               invz;
+    FillJacobianHybrid(T_source_to_target_v, fx, fy, diff_I, dIdx, dIdy,
+                       diff_D, dDdx, dDdy, J_I, J_D, r_I, r_D);
 
-    J_I[0] = sqrt_lambda_intensity *
-             (-T_source_to_target_v[2] * c1 + T_source_to_target_v[1] * c2);
-    J_I[1] = sqrt_lambda_intensity *
-             (T_source_to_target_v[2] * c0 - T_source_to_target_v[0] * c2);
-    J_I[2] = sqrt_lambda_intensity *
-             (-T_source_to_target_v[1] * c0 + T_source_to_target_v[0] * c1);
-    J_I[3] = sqrt_lambda_intensity * (c0);
-    J_I[4] = sqrt_lambda_intensity * (c1);
-    J_I[5] = sqrt_lambda_intensity * (c2);
-    r_I = sqrt_lambda_intensity * diff_I;
+    return true;
+}
 
-    J_D[0] = sqrt_lambda_depth *
-             ((-T_source_to_target_v[2] * d1 + T_source_to_target_v[1] * d2) -
-              T_source_to_target_v[1]);
-    J_D[1] = sqrt_lambda_depth *
-             ((T_source_to_target_v[2] * d0 - T_source_to_target_v[0] * d2) +
-              T_source_to_target_v[0]);
-    J_D[2] = sqrt_lambda_depth *
-             ((-T_source_to_target_v[1] * d0 + T_source_to_target_v[0] * d1));
-    J_D[3] = sqrt_lambda_depth * (d0);
-    J_D[4] = sqrt_lambda_depth * (d1);
-    J_D[5] = sqrt_lambda_depth * (d2 - 1.0f);
+/// 3x3 Sobel gradients of a (rows, cols, 1) Float32 image at (u, v), with
+/// replicated borders as in Image::FilterSobel. NaN neighbors propagate.
+OPEN3D_HOST_DEVICE inline void GetSobelGradient(const NDArrayIndexer& indexer,
+                                                int u,
+                                                int v,
+                                                float& dx,
+                                                float& dy) {
+    const int rows = static_cast<int>(indexer.GetShape(0));
+    const int cols = static_cast<int>(indexer.GetShape(1));
+    const int u0 = u > 0 ? u - 1 : 0;
+    const int u1 = u < cols - 1 ? u + 1 : cols - 1;
+    const int v0 = v > 0 ? v - 1 : 0;
+    const int v1 = v < rows - 1 ? v + 1 : rows - 1;
+
+    const float p00 = *indexer.GetDataPtr<float>(u0, v0);
+    const float p01 = *indexer.GetDataPtr<float>(u, v0);
+    const float p02 = *indexer.GetDataPtr<float>(u1, v0);
+    const float p10 = *indexer.GetDataPtr<float>(u0, v);
+    const float p12 = *indexer.GetDataPtr<float>(u1, v);
+    const float p20 = *indexer.GetDataPtr<float>(u0, v1);
+    const float p21 = *indexer.GetDataPtr<float>(u, v1);
+    const float p22 = *indexer.GetDataPtr<float>(u1, v1);
+
+    dx = (p02 - p00) + 2 * (p12 - p10) + (p22 - p20);
+    dy = (p20 - p00) + 2 * (p21 - p01) + (p22 - p02);
+}
 
-    r_D = sqrt_lambda_depth * diff_D;
+/// Same as GetJacobianHybrid, but back-projects the source vertex from the
+/// source depth and evaluates the target Sobel gradients at the projection,
+/// so that no vertex map or gradient images need to be built beforehand.
+OPEN3D_HOST_DEVICE inline bool GetJacobianHybridFused(
+        int x,
+        int y,
+        const float depth_outlier_trunc,
+        const NDArrayIndexer& source_depth_indexer,
+        const NDArrayIndexer& target_depth_indexer,
+        const NDArrayIndexer& source_intensity_indexer,
+        const NDArrayIndexer& target_intensity_indexer,
+        const TransformIndexer& ti,
+        float* J_I,
+        float* J_D,
+        float& r_I,
+        float& r_D) {
+    const float sobel_scale = 0.125;
+
+    float depth_s = *source_depth_indexer.GetDataPtr<float>(x, y);
+    if (isnan(depth_s)) {
+        return false;
+    }
+
+    float source_v[3];
+    ti.Unproject(static_cast<float>(x), static_cast<float>(y), depth_s,
+                 &source_v[0], &source_v[1], &source_v[2]);
+
+    // Transform source points to the target camera coordinate space.
+    float T_source_to_target_v[3], u_tf, v_tf;
+    ti.RigidTransform(source_v[0], source_v[1], source_v[2],
+                      &T_source_to_target_v[0], &T_source_to_target_v[1],
+                      &T_source_to_target_v[2]);
+    ti.Project(T_source_to_target_v[0], T_source_to_target_v[1],
+               T_source_to_target_v[2], &u_tf, &v_tf);
+    int u_t = int(roundf(u_tf));
+    int v_t = int(roundf(v_tf));
+
+    if (T_source_to_target_v[2] < 0 ||
+        !target_depth_indexer.InBoundary(u_t, v_t)) {
+        return false;
+    }
+
+    float fx, fy;
+    ti.GetFocalLength(&fx, &fy);
+
+    float depth_t = *target_depth_indexer.GetDataPtr<float>(u_t, v_t);
+    float diff_D = depth_t - T_source_to_target_v[2];
+    if (isnan(depth_t) || abs(diff_D) > depth_outlier_trunc) {
+        return false;
+    }
+
+    float dDdx, dDdy;
+    GetSobelGradient(target_depth_indexer, u_t, v_t, dDdx, dDdy);
+    if (isnan(dDdx) || isnan(dDdy)) {
+        return false;
+    }
+
+    float diff_I = *target_intensity_indexer.GetDataPtr<float>(u_t, v_t) -
+                   *source_intensity_indexer.GetDataPtr<float>(x, y);
+    float dIdx, dIdy;
+    GetSobelGradient(target_intensity_indexer, u_t, v_t, dIdx, dIdy);
+
+    FillJacobianHybrid(T_source_to_target_v, fx, fy, diff_I,
+                       sobel_scale * dIdx, sobel_scale * dIdy, diff_D,
+                       sobel_scale * dDdx, sobel_scale * dDdy, J_I, J_D, r_I,
+                       r_D);
 
     return true;
 }
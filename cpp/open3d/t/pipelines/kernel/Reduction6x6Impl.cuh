@@ -28,16 +28,63 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ScratchScope.h"
+#include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace kernel {
 
+/// Returns the stride between the sums of consecutive blocks in the global sum
+/// buffer of a block reduction. In deterministic mode (see
+/// utility::IsDeterministic()) every block writes its sums to its own row of
+/// \p num_values values, and ReduceBlockSums() adds the rows in block order.
+/// Otherwise the stride is 0 and all blocks accumulate into the same row with
+/// atomics, whose order varies between runs.
+inline int64_t GetBlockSumStride(int64_t num_values) {
+    return utility::IsDeterministic() ? num_values : 0;
+}
+
+/// Allocates the zero-initialized global sum buffer of a block reduction of
+/// \p num_values values over \p num_blocks blocks. See GetBlockSumStride().
+inline core::Tensor CreateBlockSums(int64_t num_blocks,
+                                    int64_t num_values,
+                                    const core::Dtype& dtype,
+                                    const core::Device& device) {
+    const int64_t num_rows = GetBlockSumStride(num_values) == 0
+                                     ? 1
+                                     : std::max<int64_t>(num_blocks, 1);
+    return core::ScratchScope::Zeros({num_rows, num_values}, dtype, device);
+}
+
+/// Returns the sums of shape {num_values} of a buffer from CreateBlockSums().
+/// The rows are added in block order, so the result is reproducible.
+inline core::Tensor ReduceBlockSums(const core::Tensor& block_sums) {
+    if (block_sums.GetLength() == 1) {
+        return block_sums[0];
+    }
+    return block_sums.SegmentSum(core::Tensor::Init<int64_t>(
+                                         {0, block_sums.GetLength()},
+                                         block_sums.GetDevice()))[0];
+}
+
+/// Returns the global sum row of the calling block for a buffer with stride
+/// \p block_sum_stride, see GetBlockSumStride().
+template <typename scalar_t>
+__device__ inline scalar_t* GetBlockSum(scalar_t* global_sum,
+                                        int64_t block_sum_stride) {
+    const int64_t block_idx =
+            blockIdx.x + static_cast<int64_t>(blockIdx.y) * gridDim.x;
+    return global_sum + block_idx * block_sum_stride;
+}
+
 template <typename scalar_t>
 __device__ inline void WarpReduceSum(volatile scalar_t* local_sum,
                                      const int tid) {
@@ -26,8 +26,12 @@
 
 #include "open3d/t/pipelines/kernel/Registration.h"
 
+#include <algorithm>
+
+#include "open3d/core/ScratchScope.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/t/pipelines/kernel/RegistrationImpl.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
 
 namespace open3d {
 namespace t {
@@ -69,6 +73,198 @@ core::Tensor ComputePosePointToPlane(const core::Tensor &source_points,
     return pose;
 }
 
+std::tuple<core::Tensor, core::Tensor> BuildCorrespondenceHashTable(
+        const core::Tensor &target_points, const double voxel_size) {
+    return BuildCorrespondenceHashTable(
+            target_points,
+            core::Tensor::Empty({0}, core::Int64, target_points.GetDevice()),
+            voxel_size);
+}
+
+std::tuple<core::Tensor, core::Tensor> BuildCorrespondenceHashTable(
+        const core::Tensor &target_points,
+        const core::Tensor &target_row_splits,
+        const double voxel_size) {
+    core::AssertTensorDtypes(target_points, {core::Float32, core::Float64});
+    core::AssertTensorShape(target_points, {utility::nullopt, 3});
+    core::AssertTensorDtype(target_row_splits, core::Int64);
+    core::AssertTensorShape(target_row_splits, {utility::nullopt});
+    core::AssertTensorDevice(target_row_splits, target_points.GetDevice());
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive, but got {}.",
+                          voxel_size);
+    }
+
+    core::Tensor cell_splits, sorted_indices;
+
+    const core::Device::DeviceType device_type =
+            target_points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        BuildCorrespondenceHashTableCPU(
+                target_points.Contiguous(), target_row_splits.Contiguous(),
+                voxel_size, cell_splits, sorted_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(BuildCorrespondenceHashTableCUDA, target_points.Contiguous(),
+                  target_row_splits.Contiguous(), voxel_size, cell_splits,
+                  sorted_indices);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    return std::make_tuple(cell_splits, sorted_indices);
+}
+
+core::Tensor ComputePosePointToPlaneFused(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        const registration::RobustKernel &kernel,
+        int64_t &inlier_count,
+        double &squared_error) {
+    const core::Device device = source_points.GetDevice();
+    core::AssertTensorDevice(target_points, device);
+    core::AssertTensorDevice(cell_splits, device);
+    core::AssertTensorDtype(cell_splits, core::Int64);
+    core::AssertTensorDtype(sorted_indices, core::Int64);
+    core::AssertTensorShape(sorted_indices, {target_points.GetLength()});
+
+    // Pose {6,} tensor [ouput].
+    core::Tensor pose = core::Tensor::Empty({6}, core::Float64, device);
+
+    float residual = 0;
+    inlier_count = 0;
+    squared_error = 0;
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePosePointToPlaneFusedCPU(
+                source_points.Contiguous(), target_points.Contiguous(),
+                target_normals.Contiguous(), cell_splits.Contiguous(),
+                sorted_indices.Contiguous(), max_correspondence_distance, pose,
+                residual, inlier_count, squared_error,
+                source_points.GetDtype(), device, kernel);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePosePointToPlaneFusedCUDA, source_points.Contiguous(),
+                  target_points.Contiguous(), target_normals.Contiguous(),
+                  cell_splits.Contiguous(), sorted_indices.Contiguous(),
+                  max_correspondence_distance, pose, residual, inlier_count,
+                  squared_error, source_points.GetDtype(), device, kernel);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    utility::LogDebug(
+            "Fused PointToPlane Transform: residual {}, inlier_count {}",
+            residual, inlier_count);
+
+    return pose;
+}
+
+std::tuple<core::Tensor, core::Tensor, core::Tensor, core::Tensor>
+ComputePosePointToPlaneBatched(const core::Tensor &source_points,
+                               const core::Tensor &source_row_splits,
+                               const core::Tensor &transformations,
+                               const core::Tensor &active,
+                               const core::Tensor &target_points,
+                               const core::Tensor &target_normals,
+                               const core::Tensor &target_row_splits,
+                               const core::Tensor &cell_splits,
+                               const core::Tensor &sorted_indices,
+                               const double max_correspondence_distance,
+                               const registration::RobustKernel &kernel,
+                               const bool compute_correspondences) {
+    const core::Device device = source_points.GetDevice();
+    const core::Dtype dtype = source_points.GetDtype();
+    const int64_t num_batches = source_row_splits.GetLength() - 1;
+
+    core::AssertTensorDtypes(source_points, {core::Float32, core::Float64});
+    core::AssertTensorShape(source_points, {utility::nullopt, 3});
+    core::AssertTensorDtype(target_points, dtype);
+    core::AssertTensorDtype(target_normals, dtype);
+    core::AssertTensorDevice(target_points, device);
+    core::AssertTensorDevice(target_normals, device);
+    core::AssertTensorDtype(source_row_splits, core::Int64);
+    core::AssertTensorDtype(target_row_splits, core::Int64);
+    core::AssertTensorDevice(source_row_splits, device);
+    core::AssertTensorDevice(target_row_splits, device);
+    core::AssertTensorShape(target_row_splits, {num_batches + 1});
+    core::AssertTensorShape(transformations, {num_batches, 4, 4});
+    core::AssertTensorShape(active, {num_batches});
+    core::AssertTensorDtype(active, core::Bool);
+    core::AssertTensorDevice(cell_splits, device);
+    core::AssertTensorDtype(cell_splits, core::Int64);
+    core::AssertTensorDtype(sorted_indices, core::Int64);
+    core::AssertTensorShape(sorted_indices, {target_points.GetLength()});
+
+    // [0:29] as in ComputePosePointToPlane, [29] squared distance, per pair.
+    core::Tensor global_sum =
+            core::ScratchScope::Zeros({num_batches, 30}, dtype, device);
+    core::Tensor correspondences =
+            compute_correspondences
+                    ? core::Tensor::Full({source_points.GetLength()}, -1,
+                                         core::Int64, device)
+                    : core::Tensor::Empty({0}, core::Int64, device);
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePosePointToPlaneBatchedCPU(
+                source_points.Contiguous(), source_row_splits.Contiguous(),
+                transformations.To(device, dtype).Contiguous(),
+                active.To(device).Contiguous(), target_points.Contiguous(),
+                target_normals.Contiguous(), target_row_splits.Contiguous(),
+                cell_splits.Contiguous(), sorted_indices.Contiguous(),
+                max_correspondence_distance, global_sum, correspondences,
+                dtype, device, kernel);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePosePointToPlaneBatchedCUDA,
+                  source_points.Contiguous(), source_row_splits.Contiguous(),
+                  transformations.To(device, dtype).Contiguous(),
+                  active.To(device).Contiguous(), target_points.Contiguous(),
+                  target_normals.Contiguous(), target_row_splits.Contiguous(),
+                  cell_splits.Contiguous(), sorted_indices.Contiguous(),
+                  max_correspondence_distance, global_sum, correspondences,
+                  dtype, device, kernel);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    const core::Device host("CPU:0");
+    core::Tensor global_sum_host = global_sum.To(host, core::Float64);
+    core::Tensor poses =
+            core::Tensor::Zeros({num_batches, 6}, core::Float64, host);
+    core::Tensor inlier_counts =
+            core::Tensor::Zeros({num_batches}, core::Int64, host);
+    core::Tensor squared_errors =
+            core::Tensor::Zeros({num_batches}, core::Float64, host);
+
+    const double *global_sum_ptr = global_sum_host.GetDataPtr<double>();
+    double *poses_ptr = poses.GetDataPtr<double>();
+    int64_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+    double *squared_errors_ptr = squared_errors.GetDataPtr<double>();
+    for (int64_t b = 0; b < num_batches; ++b) {
+        inlier_counts_ptr[b] =
+                static_cast<int64_t>(global_sum_ptr[30 * b + 28]);
+        squared_errors_ptr[b] = global_sum_ptr[30 * b + 29];
+        if (inlier_counts_ptr[b] == 0) {
+            continue;
+        }
+
+        core::Tensor pose;
+        float residual = 0;
+        int inlier_count = 0;
+        DecodeAndSolve6x6(global_sum_host[b].Slice(0, 0, 29), pose, residual,
+                          inlier_count);
+        const double *pose_ptr = pose.GetDataPtr<double>();
+        std::copy(pose_ptr, pose_ptr + 6, poses_ptr + 6 * b);
+    }
+
+    return std::make_tuple(poses, inlier_counts, squared_errors,
+                           correspondences);
+}
+
 core::Tensor ComputePoseColoredICP(const core::Tensor &source_points,
                                    const core::Tensor &source_colors,
                                    const core::Tensor &target_points,
@@ -113,6 +309,45 @@ core::Tensor ComputePoseColoredICP(const core::Tensor &source_points,
     return pose;
 }
 
+core::Tensor ComputePoseGeneralizedICP(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_covariances,
+        const core::Tensor &target_covariances,
+        const core::Tensor &correspondence_indices,
+        const registration::RobustKernel &kernel) {
+    const core::Device device = source_points.GetDevice();
+
+    // Pose {6,} tensor [ouput].
+    core::Tensor pose = core::Tensor::Empty({6}, core::Float64, device);
+
+    float residual = 0;
+    int inlier_count = 0;
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePoseGeneralizedICPCPU(
+                source_points.Contiguous(), target_points.Contiguous(),
+                source_covariances.Contiguous(),
+                target_covariances.Contiguous(),
+                correspondence_indices.Contiguous(), pose, residual,
+                inlier_count, source_points.GetDtype(), device, kernel);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePoseGeneralizedICPCUDA, source_points.Contiguous(),
+                  target_points.Contiguous(), source_covariances.Contiguous(),
+                  target_covariances.Contiguous(),
+                  correspondence_indices.Contiguous(), pose, residual,
+                  inlier_count, source_points.GetDtype(), device, kernel);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    utility::LogDebug("GeneralizedICP Transform: residual {}, inlier_count {}",
+                      residual, inlier_count);
+
+    return pose;
+}
+
 std::tuple<core::Tensor, core::Tensor> ComputeRtPointToPoint(
         const core::Tensor &source_points,
         const core::Tensor &target_points,
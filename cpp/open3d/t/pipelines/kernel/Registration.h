@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/t/pipelines/registration/Registration.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
@@ -55,6 +57,124 @@ core::Tensor ComputePosePointToPlane(const core::Tensor &source_positions,
                                      const core::Tensor &correspondence_indices,
                                      const registration::RobustKernel &kernel);
 
+/// \brief Bins the target positions into a spatial hash table for
+/// ComputePosePointToPlaneFused.
+///
+/// Points are binned into cubic cells with edge length \p voxel_size and the
+/// cells are hashed into a table of buckets. The target points of bucket `b`
+/// are `sorted_indices[cell_splits[b]:cell_splits[b + 1]]`.
+///
+/// \param target_positions target point positions of Float32 or Float64
+/// dtype.
+/// \param voxel_size Edge length of a cell. Must not be smaller than the
+/// correspondence search radius.
+/// \return tuple of (cell_splits, sorted_indices), Int64 tensors of shape
+/// {num_buckets + 1} and {N} on the device of \p target_positions.
+std::tuple<core::Tensor, core::Tensor> BuildCorrespondenceHashTable(
+        const core::Tensor &target_positions, const double voxel_size);
+
+/// \brief Bins the target positions of several point clouds, packed into a
+/// ragged tensor, into one spatial hash table for
+/// ComputePosePointToPlaneBatched. Cells of different batches hash apart.
+///
+/// \param target_positions Packed target point positions {N, 3} of Float32
+/// or Float64 dtype.
+/// \param target_row_splits Int64 tensor of shape {B + 1}. Batch `b` holds
+/// rows [target_row_splits[b], target_row_splits[b + 1]) of
+/// \p target_positions.
+/// \param voxel_size Edge length of a cell. Must not be smaller than the
+/// correspondence search radius.
+/// \return tuple of (cell_splits, sorted_indices), as in the overload above.
+std::tuple<core::Tensor, core::Tensor> BuildCorrespondenceHashTable(
+        const core::Tensor &target_positions,
+        const core::Tensor &target_row_splits,
+        const double voxel_size);
+
+/// \brief Computes pose for point to plane registration method, searching
+/// the nearest target point of every source point on the fly.
+///
+/// Equivalent to a hybrid search with max_knn = 1 followed by
+/// ComputePosePointToPlane, but each source point looks up its
+/// correspondence in the hash table from BuildCorrespondenceHashTable and
+/// accumulates its Jacobian into the linear system in the same pass, so no
+/// correspondence tensor is materialized.
+///
+/// \param source_positions source point positions of Float32 or Float64 dtype.
+/// \param target_positions target point positions of same dtype as source point
+/// positions.
+/// \param target_normals target point normals of same dtype as source point
+/// positions.
+/// \param cell_splits Bucket splits from BuildCorrespondenceHashTable.
+/// \param sorted_indices Bucketed target indices from
+/// BuildCorrespondenceHashTable.
+/// \param max_correspondence_distance Correspondence search radius. It is also
+/// the voxel size the hash table was built with.
+/// \param kernel statistical robust kernel for outlier rejection.
+/// \param inlier_count [output] Number of source points with a
+/// correspondence.
+/// \param squared_error [output] Sum of the squared distances of the
+/// correspondences.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64, where alpha, beta, gamma are the Euler angles in the ZYX order.
+core::Tensor ComputePosePointToPlaneFused(
+        const core::Tensor &source_positions,
+        const core::Tensor &target_positions,
+        const core::Tensor &target_normals,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        const registration::RobustKernel &kernel,
+        int64_t &inlier_count,
+        double &squared_error);
+
+/// \brief Batched version of ComputePosePointToPlaneFused for B independent
+/// source/target pairs packed into ragged tensors, computed in one pass over
+/// all source points.
+///
+/// \param source_positions Packed source point positions {N, 3} of Float32 or
+/// Float64 dtype, before applying \p transformations.
+/// \param source_row_splits Int64 tensor of shape {B + 1}. Pair `b` owns rows
+/// [source_row_splits[b], source_row_splits[b + 1]) of \p source_positions.
+/// \param transformations Current source to target transformation of every
+/// pair, a {B, 4, 4} Float64 tensor.
+/// \param active Bool tensor of shape {B}. Pairs which are not active are
+/// skipped and get a zero pose.
+/// \param target_positions Packed target point positions of same dtype as
+/// source point positions.
+/// \param target_normals Packed target point normals of same dtype as source
+/// point positions.
+/// \param target_row_splits Int64 tensor of shape {B + 1}, the row splits of
+/// \p target_positions.
+/// \param cell_splits Bucket splits from BuildCorrespondenceHashTable.
+/// \param sorted_indices Bucketed target indices from
+/// BuildCorrespondenceHashTable.
+/// \param max_correspondence_distance Correspondence search radius. It is also
+/// the voxel size the hash table was built with.
+/// \param kernel statistical robust kernel for outlier rejection.
+/// \param compute_correspondences If true, also return the correspondences.
+/// \return tuple of (poses, inlier_counts, squared_errors, correspondences).
+/// poses is a {B, 6} Float64 tensor of [alpha beta gamma, tx, ty, tz] rows,
+/// zero for pairs without correspondences. inlier_counts {B} of Int64 and
+/// squared_errors {B} of Float64 hold the number of correspondences and their
+/// summed squared distance. These three are on CPU. correspondences is an
+/// Int64 tensor of shape {N} on the device of \p source_positions holding,
+/// for every source point, the index of its correspondence within the
+/// target of its pair, or -1. It is empty unless \p compute_correspondences
+/// is set.
+std::tuple<core::Tensor, core::Tensor, core::Tensor, core::Tensor>
+ComputePosePointToPlaneBatched(const core::Tensor &source_positions,
+                               const core::Tensor &source_row_splits,
+                               const core::Tensor &transformations,
+                               const core::Tensor &active,
+                               const core::Tensor &target_positions,
+                               const core::Tensor &target_normals,
+                               const core::Tensor &target_row_splits,
+                               const core::Tensor &cell_splits,
+                               const core::Tensor &sorted_indices,
+                               const double max_correspondence_distance,
+                               const registration::RobustKernel &kernel,
+                               const bool compute_correspondences = false);
+
 /// \brief Computes pose for colored-icp registration method.
 ///
 /// \param source_positions source point positions of Float32 or Float64 dtype.
@@ -87,6 +207,34 @@ core::Tensor ComputePoseColoredICP(const core::Tensor &source_positions,
                                    const registration::RobustKernel &kernel,
                                    const double &lambda_geometric);
 
+/// \brief Computes pose for generalized ICP registration method.
+///
+/// Every correspondence contributes the three rows of its residual whitened by
+/// `(C_s + C_t)^(-1/2)`, where C_s and C_t are the covariances of the source
+/// and target points.
+///
+/// \param source_positions source point positions of Float32 or Float64 dtype.
+/// \param target_positions target point positions of same dtype as source point
+/// positions.
+/// \param source_covariances source point covariances {N, 3, 3} of same dtype
+/// as source point positions.
+/// \param target_covariances target point covariances {M, 3, 3} of same dtype
+/// as source point positions.
+/// \param correspondence_indices Tensor of type Int64 containing indices of
+/// corresponding target positions, where the value is the target index and the
+/// index of the value itself is the source index. It contains -1 as value at
+/// index with no correspondence.
+/// \param kernel statistical robust kernel for outlier rejection.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64, where alpha, beta, gamma are the Euler angles in the ZYX order.
+core::Tensor ComputePoseGeneralizedICP(
+        const core::Tensor &source_positions,
+        const core::Tensor &target_positions,
+        const core::Tensor &source_covariances,
+        const core::Tensor &target_covariances,
+        const core::Tensor &correspondence_indices,
+        const registration::RobustKernel &kernel);
+
 /// \brief Computes (R) Rotation {3,3} and (t) translation {3,}
 /// for point to point registration method.
 ///
@@ -27,12 +27,15 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <tuple>
 #include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/ParallelFor.h"
+#include "open3d/core/ScratchScope.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/pipelines/kernel/RegistrationImpl.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
@@ -126,7 +129,7 @@ void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
                                 const registration::RobustKernel &kernel) {
     int n = source_points.GetLength();
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
+    core::Tensor global_sum = core::ScratchScope::Zeros({29}, dtype, device);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
@@ -146,6 +149,420 @@ void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
     DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
 }
 
+void BuildCorrespondenceHashTableCPU(const core::Tensor &target_points,
+                                     const core::Tensor &target_row_splits,
+                                     const double voxel_size,
+                                     core::Tensor &cell_splits,
+                                     core::Tensor &sorted_indices) {
+    const core::Device device = target_points.GetDevice();
+    const int64_t n = target_points.GetLength();
+    const int64_t num_buckets = std::max<int64_t>(2 * n, 1);
+
+    // Without row splits all points belong to batch 0.
+    const int64_t num_batches = target_row_splits.GetLength() - 1;
+    const int64_t *row_splits_ptr =
+            num_batches > 0 ? target_row_splits.GetDataPtr<int64_t>()
+                            : nullptr;
+
+    core::Tensor buckets = core::Tensor::Empty({n}, core::Int64, device);
+    int64_t *buckets_ptr = buckets.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(target_points.GetDtype(), [&]() {
+        const scalar_t *target_points_ptr =
+                target_points.GetDataPtr<scalar_t>();
+        const scalar_t voxel = static_cast<scalar_t>(voxel_size);
+        core::ParallelFor(device, n, [=](int64_t workload_idx) {
+            const scalar_t *p = target_points_ptr + 3 * workload_idx;
+            const int64_t batch_idx =
+                    row_splits_ptr == nullptr
+                            ? 0
+                            : GetBatchIndexFromRowSplits(
+                                      row_splits_ptr, num_batches,
+                                      workload_idx);
+            buckets_ptr[workload_idx] = GetCorrespondenceHashBucket(
+                    static_cast<int64_t>(std::floor(p[0] / voxel)),
+                    static_cast<int64_t>(std::floor(p[1] / voxel)),
+                    static_cast<int64_t>(std::floor(p[2] / voxel)),
+                    batch_idx, num_buckets);
+        });
+    });
+
+    core::Tensor sorted_buckets;
+    std::tie(sorted_buckets, sorted_indices) = core::Tensor::SortByKey(
+            buckets, core::Tensor::Arange(0, n, 1, core::Int64, device));
+
+    // Bucket b holds sorted positions [cell_splits[b], cell_splits[b + 1]).
+    cell_splits = core::Tensor::Empty({num_buckets + 1}, core::Int64, device);
+    const int64_t *sorted_buckets_ptr = sorted_buckets.GetDataPtr<int64_t>();
+    int64_t *cell_splits_ptr = cell_splits.GetDataPtr<int64_t>();
+    core::ParallelFor(device, n + 1, [=](int64_t workload_idx) {
+        const int64_t i = workload_idx;
+        const int64_t prev = i == 0 ? -1 : sorted_buckets_ptr[i - 1];
+        const int64_t curr = i == n ? num_buckets : sorted_buckets_ptr[i];
+        for (int64_t b = prev + 1; b <= curr; ++b) {
+            cell_splits_ptr[b] = i;
+        }
+    });
+}
+
+template <typename scalar_t, typename func_t>
+static void ComputePosePointToPlaneFusedKernelCPU(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_normals_ptr,
+        const int64_t *cell_splits_ptr,
+        const int64_t *sorted_indices_ptr,
+        const int64_t num_buckets,
+        const int64_t num_targets,
+        const scalar_t max_correspondence_distance,
+        const int n,
+        scalar_t *global_sum,
+        func_t GetWeightFromRobustKernel) {
+    // Same layout as ComputePosePointToPlaneKernelCPU, with the squared
+    // correspondence distance appended as the 29th element.
+    std::vector<scalar_t> A_1x30(30, 0.0);
+    const scalar_t max_distance2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+#ifdef _WIN32
+    std::vector<scalar_t> zeros_30(30, 0.0);
+    A_1x30 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_30,
+            [&](tbb::blocked_range<int> r, std::vector<scalar_t> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     ++workload_idx) {
+#else
+    scalar_t *A_reduction = A_1x30.data();
+#pragma omp parallel for reduction(+ : A_reduction[:30]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    const scalar_t *source_point =
+                            source_points_ptr + 3 * workload_idx;
+                    scalar_t distance2 = 0;
+                    const int64_t target_idx =
+                            FindCorrespondenceInHashTable<scalar_t>(
+                                    source_point, target_points_ptr,
+                                    cell_splits_ptr, sorted_indices_ptr,
+                                    num_buckets, max_correspondence_distance,
+                                    max_distance2, 0, 0, num_targets,
+                                    distance2);
+
+                    scalar_t J_ij[6];
+                    scalar_t r = 0;
+
+                    bool valid = kernel::GetJacobianPointToPlane<scalar_t>(
+                            0, source_point, target_points_ptr,
+                            target_normals_ptr, &target_idx, J_ij, r);
+
+                    if (valid) {
+                        scalar_t w = GetWeightFromRobustKernel(r);
+
+                        // Dump J, r into JtJ and Jtr
+                        int i = 0;
+                        for (int j = 0; j < 6; ++j) {
+                            for (int k = 0; k <= j; ++k) {
+                                A_reduction[i] += J_ij[j] * w * J_ij[k];
+                                ++i;
+                            }
+                            A_reduction[21 + j] += J_ij[j] * w * r;
+                        }
+                        A_reduction[27] += r;
+                        A_reduction[28] += 1;
+                        A_reduction[29] += distance2;
+                    }
+                }
+#ifdef _WIN32
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<scalar_t> a, std::vector<scalar_t> b) {
+                std::vector<scalar_t> result(30);
+                for (int j = 0; j < 30; ++j) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+
+    for (int i = 0; i < 30; ++i) {
+        global_sum[i] = A_1x30[i];
+    }
+}
+
+void ComputePosePointToPlaneFusedCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        core::Tensor &pose,
+        float &residual,
+        int64_t &inlier_count,
+        double &squared_error,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    int n = source_points.GetLength();
+
+    core::Tensor global_sum = core::ScratchScope::Zeros({30}, dtype, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    kernel::ComputePosePointToPlaneFusedKernelCPU(
+                            source_points.GetDataPtr<scalar_t>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            target_normals.GetDataPtr<scalar_t>(),
+                            cell_splits.GetDataPtr<int64_t>(),
+                            sorted_indices.GetDataPtr<int64_t>(),
+                            cell_splits.GetLength() - 1,
+                            sorted_indices.GetLength(),
+                            static_cast<scalar_t>(max_correspondence_distance),
+                            n, global_sum_ptr, GetWeightFromRobustKernel);
+                });
+    });
+
+    int count = 0;
+    DecodeAndSolve6x6(global_sum.Slice(0, 0, 29), pose, residual, count);
+    inlier_count = count;
+    squared_error = global_sum[29].To(core::Float64).Item<double>();
+}
+
+template <typename scalar_t, typename func_t>
+static void ComputePosePointToPlaneBatchedKernelCPU(
+        const scalar_t *source_points_ptr,
+        const int64_t *source_row_splits_ptr,
+        const scalar_t *transformations_ptr,
+        const bool *active_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_normals_ptr,
+        const int64_t *target_row_splits_ptr,
+        const int64_t *cell_splits_ptr,
+        const int64_t *sorted_indices_ptr,
+        const int64_t num_buckets,
+        const scalar_t max_correspondence_distance,
+        const int64_t num_batches,
+        scalar_t *global_sum,
+        int64_t *correspondences_ptr,
+        func_t GetWeightFromRobustKernel) {
+    const scalar_t max_distance2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+    // Every pair reduces into its own 30 elements, laid out as in
+    // ComputePosePointToPlaneFusedKernelCPU, so pairs run in parallel.
+#pragma omp parallel for schedule(dynamic) num_threads(utility::EstimateMaxThreads())
+    for (int64_t batch_idx = 0; batch_idx < num_batches; ++batch_idx) {
+        if (!active_ptr[batch_idx]) {
+            continue;
+        }
+
+        const scalar_t *T = transformations_ptr + 16 * batch_idx;
+        const int64_t target_begin = target_row_splits_ptr[batch_idx];
+        const int64_t target_end = target_row_splits_ptr[batch_idx + 1];
+
+        scalar_t A_reduction[30] = {0};
+        for (int64_t workload_idx = source_row_splits_ptr[batch_idx];
+             workload_idx < source_row_splits_ptr[batch_idx + 1];
+             ++workload_idx) {
+            scalar_t source_point[3];
+            TransformPoint<scalar_t>(T, source_points_ptr + 3 * workload_idx,
+                                     source_point);
+
+            scalar_t distance2 = 0;
+            const int64_t target_idx = FindCorrespondenceInHashTable<scalar_t>(
+                    source_point, target_points_ptr, cell_splits_ptr,
+                    sorted_indices_ptr, num_buckets,
+                    max_correspondence_distance, max_distance2, batch_idx,
+                    target_begin, target_end, distance2);
+            if (correspondences_ptr != nullptr) {
+                correspondences_ptr[workload_idx] =
+                        target_idx == -1 ? -1 : target_idx - target_begin;
+            }
+
+            scalar_t J_ij[6];
+            scalar_t r = 0;
+
+            bool valid = kernel::GetJacobianPointToPlane<scalar_t>(
+                    0, source_point, target_points_ptr, target_normals_ptr,
+                    &target_idx, J_ij, r);
+
+            if (valid) {
+                scalar_t w = GetWeightFromRobustKernel(r);
+
+                // Dump J, r into JtJ and Jtr
+                int i = 0;
+                for (int j = 0; j < 6; ++j) {
+                    for (int k = 0; k <= j; ++k) {
+                        A_reduction[i] += J_ij[j] * w * J_ij[k];
+                        ++i;
+                    }
+                    A_reduction[21 + j] += J_ij[j] * w * r;
+                }
+                A_reduction[27] += r;
+                A_reduction[28] += 1;
+                A_reduction[29] += distance2;
+            }
+        }
+
+        for (int i = 0; i < 30; ++i) {
+            global_sum[30 * batch_idx + i] = A_reduction[i];
+        }
+    }
+}
+
+void ComputePosePointToPlaneBatchedCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &source_row_splits,
+        const core::Tensor &transformations,
+        const core::Tensor &active,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_row_splits,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        core::Tensor &global_sum,
+        core::Tensor &correspondences,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    int64_t *correspondences_ptr =
+            correspondences.GetLength() > 0
+                    ? correspondences.GetDataPtr<int64_t>()
+                    : nullptr;
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    kernel::ComputePosePointToPlaneBatchedKernelCPU(
+                            source_points.GetDataPtr<scalar_t>(),
+                            source_row_splits.GetDataPtr<int64_t>(),
+                            transformations.GetDataPtr<scalar_t>(),
+                            active.GetDataPtr<bool>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            target_normals.GetDataPtr<scalar_t>(),
+                            target_row_splits.GetDataPtr<int64_t>(),
+                            cell_splits.GetDataPtr<int64_t>(),
+                            sorted_indices.GetDataPtr<int64_t>(),
+                            cell_splits.GetLength() - 1,
+                            static_cast<scalar_t>(max_correspondence_distance),
+                            source_row_splits.GetLength() - 1, global_sum_ptr,
+                            correspondences_ptr, GetWeightFromRobustKernel);
+                });
+    });
+}
+
+template <typename scalar_t, typename funct_t>
+static void ComputePoseGeneralizedICPKernelCPU(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *source_covariances_ptr,
+        const scalar_t *target_covariances_ptr,
+        const int64_t *correspondence_indices,
+        const int n,
+        scalar_t *global_sum,
+        funct_t GetWeightFromRobustKernel) {
+    // As, AtA is a symmetric matrix, we only need 21 elements instead of 36.
+    // Atb is of shape {6,1}. Combining both, A_1x29 is a temp. storage
+    // with [0:21] elements as AtA, [21:27] elements as Atb, 27th as residual
+    // and 28th as inlier_count.
+    std::vector<scalar_t> A_1x29(29, 0.0);
+
+#ifdef _WIN32
+    std::vector<scalar_t> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<scalar_t> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     ++workload_idx) {
+#else
+    scalar_t *A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int workload_idx = 0; workload_idx < n; ++workload_idx) {
+#endif
+                    scalar_t J_ij[18] = {0};
+                    scalar_t r[3] = {0};
+
+                    bool valid = GetJacobianGeneralizedICP<scalar_t>(
+                            workload_idx, source_points_ptr, target_points_ptr,
+                            source_covariances_ptr, target_covariances_ptr,
+                            correspondence_indices, J_ij, r);
+
+                    if (valid) {
+                        // Dump the three whitened rows into JtJ and Jtr.
+                        for (int row = 0; row < 3; ++row) {
+                            const scalar_t *J = J_ij + 6 * row;
+                            scalar_t w = GetWeightFromRobustKernel(r[row]);
+                            int i = 0;
+                            for (int j = 0; j < 6; ++j) {
+                                for (int k = 0; k <= j; ++k) {
+                                    A_reduction[i] += J[j] * w * J[k];
+                                    ++i;
+                                }
+                                A_reduction[21 + j] += J[j] * w * r[row];
+                            }
+                            A_reduction[27] += r[row] * r[row];
+                        }
+                        A_reduction[28] += 1;
+                    }
+                }
+#ifdef _WIN32
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<scalar_t> a, std::vector<scalar_t> b) {
+                std::vector<scalar_t> result(29);
+                for (int j = 0; j < 29; ++j) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+
+    for (int i = 0; i < 29; ++i) {
+        global_sum[i] = A_1x29[i];
+    }
+}
+
+void ComputePoseGeneralizedICPCPU(const core::Tensor &source_points,
+                                  const core::Tensor &target_points,
+                                  const core::Tensor &source_covariances,
+                                  const core::Tensor &target_covariances,
+                                  const core::Tensor &correspondence_indices,
+                                  core::Tensor &pose,
+                                  float &residual,
+                                  int &inlier_count,
+                                  const core::Dtype &dtype,
+                                  const core::Device &device,
+                                  const registration::RobustKernel &kernel) {
+    int n = source_points.GetLength();
+
+    core::Tensor global_sum = core::ScratchScope::Zeros({29}, dtype, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    kernel::ComputePoseGeneralizedICPKernelCPU(
+                            source_points.GetDataPtr<scalar_t>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            source_covariances.GetDataPtr<scalar_t>(),
+                            target_covariances.GetDataPtr<scalar_t>(),
+                            correspondence_indices.GetDataPtr<int64_t>(), n,
+                            global_sum.GetDataPtr<scalar_t>(),
+                            GetWeightFromRobustKernel);
+                });
+    });
+
+    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+}
+
 template <typename scalar_t, typename funct_t>
 static void ComputePoseColoredICPKernelCPU(
         const scalar_t *source_points_ptr,
@@ -241,7 +658,7 @@ void ComputePoseColoredICPCPU(const core::Tensor &source_points,
                               const double &lambda_geometric) {
     int n = source_points.GetLength();
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
+    core::Tensor global_sum = core::ScratchScope::Zeros({29}, dtype, device);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t sqrt_lambda_geometric =
@@ -491,7 +908,7 @@ void ComputeInformationMatrixCPU(const core::Tensor &target_points,
                                  const core::Device &device) {
     int n = correspondence_indices.GetLength();
 
-    core::Tensor global_sum = core::Tensor::Zeros({21}, dtype, device);
+    core::Tensor global_sum = core::ScratchScope::Zeros({21}, dtype, device);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
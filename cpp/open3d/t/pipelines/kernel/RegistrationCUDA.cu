@@ -26,14 +26,21 @@
 
 #include <cuda.h>
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/ParallelFor.h"
+#include "open3d/core/ScratchScope.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/pipelines/kernel/Reduction6x6Impl.cuh"
 #include "open3d/t/pipelines/kernel/RegistrationImpl.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
 #include "open3d/t/pipelines/registration/RobustKernelImpl.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -50,12 +57,14 @@ __global__ void ComputePosePointToPlaneKernelCUDA(
         const int64_t *correspondence_indices,
         const int n,
         scalar_t *global_sum,
+        const int64_t block_sum_stride,
         func_t GetWeightFromRobustKernel) {
     __shared__ scalar_t local_sum0[kThread1DUnit];
     __shared__ scalar_t local_sum1[kThread1DUnit];
     __shared__ scalar_t local_sum2[kThread1DUnit];
 
     const int tid = threadIdx.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
 
     local_sum0[tid] = 0;
     local_sum1[tid] = 0;
@@ -105,9 +114,10 @@ void ComputePosePointToPlaneCUDA(const core::Tensor &source_points,
                                  const registration::RobustKernel &kernel) {
     int n = source_points.GetLength();
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
     const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
     const dim3 threads(kThread1DUnit);
+    const int64_t block_sum_stride = GetBlockSumStride(29);
+    core::Tensor global_sum = CreateBlockSums(blocks.x, 29, dtype, device);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
@@ -121,13 +131,501 @@ void ComputePosePointToPlaneCUDA(const core::Tensor &source_points,
                             target_points.GetDataPtr<scalar_t>(),
                             target_normals.GetDataPtr<scalar_t>(),
                             correspondence_indices.GetDataPtr<int64_t>(), n,
-                            global_sum_ptr, GetWeightFromRobustKernel);
+                            global_sum_ptr, block_sum_stride,
+                            GetWeightFromRobustKernel);
                 });
     });
 
     core::cuda::Synchronize();
 
-    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+    DecodeAndSolve6x6(ReduceBlockSums(global_sum), pose, residual,
+                      inlier_count);
+}
+
+void BuildCorrespondenceHashTableCUDA(const core::Tensor &target_points,
+                                      const core::Tensor &target_row_splits,
+                                      const double voxel_size,
+                                      core::Tensor &cell_splits,
+                                      core::Tensor &sorted_indices) {
+    const core::Device device = target_points.GetDevice();
+    const int64_t n = target_points.GetLength();
+    const int64_t num_buckets = std::max<int64_t>(2 * n, 1);
+
+    // Without row splits all points belong to batch 0.
+    const int64_t num_batches = target_row_splits.GetLength() - 1;
+    const int64_t *row_splits_ptr =
+            num_batches > 0 ? target_row_splits.GetDataPtr<int64_t>()
+                            : nullptr;
+
+    core::Tensor buckets = core::Tensor::Empty({n}, core::Int64, device);
+    int64_t *buckets_ptr = buckets.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(target_points.GetDtype(), [&]() {
+        const scalar_t *target_points_ptr =
+                target_points.GetDataPtr<scalar_t>();
+        const scalar_t voxel = static_cast<scalar_t>(voxel_size);
+        core::ParallelFor(
+                device, n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t *p = target_points_ptr + 3 * workload_idx;
+                    const int64_t batch_idx =
+                            row_splits_ptr == nullptr
+                                    ? 0
+                                    : GetBatchIndexFromRowSplits(
+                                              row_splits_ptr, num_batches,
+                                              workload_idx);
+                    buckets_ptr[workload_idx] = GetCorrespondenceHashBucket(
+                            static_cast<int64_t>(floor(p[0] / voxel)),
+                            static_cast<int64_t>(floor(p[1] / voxel)),
+                            static_cast<int64_t>(floor(p[2] / voxel)),
+                            batch_idx, num_buckets);
+                });
+    });
+
+    core::Tensor sorted_buckets;
+    std::tie(sorted_buckets, sorted_indices) = core::Tensor::SortByKey(
+            buckets, core::Tensor::Arange(0, n, 1, core::Int64, device));
+
+    // Bucket b holds sorted positions [cell_splits[b], cell_splits[b + 1]).
+    cell_splits = core::Tensor::Empty({num_buckets + 1}, core::Int64, device);
+    const int64_t *sorted_buckets_ptr = sorted_buckets.GetDataPtr<int64_t>();
+    int64_t *cell_splits_ptr = cell_splits.GetDataPtr<int64_t>();
+    core::ParallelFor(
+            device, n + 1, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t i = workload_idx;
+                const int64_t prev = i == 0 ? -1 : sorted_buckets_ptr[i - 1];
+                const int64_t curr =
+                        i == n ? num_buckets : sorted_buckets_ptr[i];
+                for (int64_t b = prev + 1; b <= curr; ++b) {
+                    cell_splits_ptr[b] = i;
+                }
+            });
+}
+
+template <typename scalar_t, typename func_t>
+__global__ void ComputePosePointToPlaneFusedKernelCUDA(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_normals_ptr,
+        const int64_t *cell_splits_ptr,
+        const int64_t *sorted_indices_ptr,
+        const int64_t num_buckets,
+        const int64_t num_targets,
+        const scalar_t max_correspondence_distance,
+        const int n,
+        scalar_t *global_sum,
+        const int64_t block_sum_stride,
+        func_t GetWeightFromRobustKernel) {
+    __shared__ scalar_t local_sum0[kThread1DUnit];
+    __shared__ scalar_t local_sum1[kThread1DUnit];
+    __shared__ scalar_t local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    // Threads past the end still take part in the block reduction.
+    scalar_t J_ij[6] = {0}, reduction[29] = {0};
+    scalar_t r = 0, distance2 = 0;
+    bool valid = false;
+
+    if (workload_idx < n) {
+        const scalar_t *source_point = source_points_ptr + 3 * workload_idx;
+        const int64_t target_idx = FindCorrespondenceInHashTable<scalar_t>(
+                source_point, target_points_ptr, cell_splits_ptr,
+                sorted_indices_ptr, num_buckets, max_correspondence_distance,
+                max_correspondence_distance * max_correspondence_distance, 0,
+                0, num_targets, distance2);
+        valid = GetJacobianPointToPlane<scalar_t>(
+                0, source_point, target_points_ptr, target_normals_ptr,
+                &target_idx, J_ij, r);
+    }
+
+    if (valid) {
+        scalar_t w = GetWeightFromRobustKernel(r);
+
+        // Dump J, r into JtJ and Jtr
+        int i = 0;
+        for (int j = 0; j < 6; ++j) {
+            for (int k = 0; k <= j; ++k) {
+                reduction[i] += J_ij[j] * w * J_ij[k];
+                ++i;
+            }
+            reduction[21 + j] += J_ij[j] * w * r;
+        }
+        reduction[27] += r;
+        reduction[28] += 1;
+    }
+
+    ReduceSum6x6LinearSystem<scalar_t, kThread1DUnit>(tid, valid, reduction,
+                                                      local_sum0, local_sum1,
+                                                      local_sum2, global_sum);
+
+    // Sum reduction: squared correspondence distance(1)
+    local_sum0[tid] = valid ? distance2 : 0;
+    __syncthreads();
+
+    BlockReduceSum<scalar_t, kThread1DUnit>(tid, local_sum0);
+    if (tid == 0) {
+        atomicAdd(&global_sum[29], local_sum0[0]);
+    }
+}
+
+void ComputePosePointToPlaneFusedCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        core::Tensor &pose,
+        float &residual,
+        int64_t &inlier_count,
+        double &squared_error,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    int n = source_points.GetLength();
+
+    const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+    const int64_t block_sum_stride = GetBlockSumStride(30);
+    core::Tensor global_sum = CreateBlockSums(blocks.x, 30, dtype, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    ComputePosePointToPlaneFusedKernelCUDA<<<
+                            blocks, threads, 0, core::cuda::GetStream()>>>(
+                            source_points.GetDataPtr<scalar_t>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            target_normals.GetDataPtr<scalar_t>(),
+                            cell_splits.GetDataPtr<int64_t>(),
+                            sorted_indices.GetDataPtr<int64_t>(),
+                            cell_splits.GetLength() - 1,
+                            sorted_indices.GetLength(),
+                            static_cast<scalar_t>(max_correspondence_distance),
+                            n, global_sum_ptr, block_sum_stride,
+                            GetWeightFromRobustKernel);
+                });
+    });
+
+    core::cuda::Synchronize();
+
+    global_sum = ReduceBlockSums(global_sum);
+    int count = 0;
+    DecodeAndSolve6x6(global_sum.Slice(0, 0, 29), pose, residual, count);
+    inlier_count = count;
+    squared_error = global_sum[29].To(core::Float64).Item<double>();
+}
+
+template <typename scalar_t, typename func_t>
+__global__ void ComputePosePointToPlaneBatchedKernelCUDA(
+        const scalar_t *source_points_ptr,
+        const int64_t *source_row_splits_ptr,
+        const scalar_t *transformations_ptr,
+        const bool *active_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *target_normals_ptr,
+        const int64_t *target_row_splits_ptr,
+        const int64_t *cell_splits_ptr,
+        const int64_t *sorted_indices_ptr,
+        const int64_t num_buckets,
+        const scalar_t max_correspondence_distance,
+        const int64_t num_batches,
+        const int64_t n,
+        const int64_t *block_splits_ptr,
+        scalar_t *global_sum,
+        int64_t *correspondences_ptr,
+        func_t GetWeightFromRobustKernel) {
+    __shared__ scalar_t local_sum0[kThread1DUnit];
+    __shared__ scalar_t local_sum1[kThread1DUnit];
+    __shared__ scalar_t local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    int64_t block_begin = static_cast<int64_t>(blockIdx.x) * blockDim.x;
+    int64_t block_end = n;
+    int64_t block_batch_idx;
+    scalar_t *block_sum;
+    if (block_splits_ptr != nullptr) {
+        // Deterministic mode: blocks are aligned to pairs and every block
+        // writes its sums to its own row.
+        block_batch_idx = GetBatchIndexFromRowSplits(block_splits_ptr,
+                                                     num_batches, blockIdx.x);
+        block_begin = source_row_splits_ptr[block_batch_idx] +
+                      (blockIdx.x - block_splits_ptr[block_batch_idx]) *
+                              blockDim.x;
+        block_end = source_row_splits_ptr[block_batch_idx + 1];
+        block_sum = global_sum + 30 * static_cast<int64_t>(blockIdx.x);
+    } else {
+        block_batch_idx = GetBatchIndexFromRowSplits(source_row_splits_ptr,
+                                                     num_batches, block_begin);
+        block_sum = global_sum + 30 * block_batch_idx;
+    }
+    const int64_t workload_idx = block_begin + threadIdx.x;
+
+    // Threads past the end still take part in the block reduction.
+    scalar_t J_ij[6] = {0}, reduction[30] = {0};
+    scalar_t r = 0, distance2 = 0;
+    int64_t batch_idx = block_batch_idx;
+    bool valid = false;
+
+    if (workload_idx < block_end) {
+        batch_idx = GetBatchIndexFromRowSplits(source_row_splits_ptr,
+                                               num_batches, workload_idx);
+        int64_t target_idx = -1;
+        if (active_ptr[batch_idx]) {
+            const int64_t target_begin = target_row_splits_ptr[batch_idx];
+            scalar_t source_point[3];
+            TransformPoint<scalar_t>(transformations_ptr + 16 * batch_idx,
+                                     source_points_ptr + 3 * workload_idx,
+                                     source_point);
+            target_idx = FindCorrespondenceInHashTable<scalar_t>(
+                    source_point, target_points_ptr, cell_splits_ptr,
+                    sorted_indices_ptr, num_buckets,
+                    max_correspondence_distance,
+                    max_correspondence_distance * max_correspondence_distance,
+                    batch_idx, target_begin,
+                    target_row_splits_ptr[batch_idx + 1], distance2);
+            valid = GetJacobianPointToPlane<scalar_t>(
+                    0, source_point, target_points_ptr, target_normals_ptr,
+                    &target_idx, J_ij, r);
+            if (correspondences_ptr != nullptr && target_idx != -1) {
+                target_idx -= target_begin;
+            }
+        }
+        if (correspondences_ptr != nullptr) {
+            correspondences_ptr[workload_idx] = target_idx;
+        }
+    }
+
+    if (valid) {
+        scalar_t w = GetWeightFromRobustKernel(r);
+
+        // Dump J, r into JtJ and Jtr
+        int i = 0;
+        for (int j = 0; j < 6; ++j) {
+            for (int k = 0; k <= j; ++k) {
+                reduction[i] += J_ij[j] * w * J_ij[k];
+                ++i;
+            }
+            reduction[21 + j] += J_ij[j] * w * r;
+        }
+        reduction[27] += r;
+        reduction[28] += 1;
+        reduction[29] += distance2;
+    }
+
+    // Pairs hold many points, so almost every block lies within one pair and
+    // reduces in shared memory. Blocks across pair boundaries add per thread.
+    if (__syncthreads_and(batch_idx == block_batch_idx)) {
+        ReduceSum6x6LinearSystem<scalar_t, kThread1DUnit>(
+                tid, valid, reduction, local_sum0, local_sum1, local_sum2,
+                block_sum);
+
+        // Sum reduction: squared correspondence distance(1)
+        local_sum0[tid] = valid ? reduction[29] : 0;
+        __syncthreads();
+
+        BlockReduceSum<scalar_t, kThread1DUnit>(tid, local_sum0);
+        if (tid == 0) {
+            atomicAdd(&block_sum[29], local_sum0[0]);
+        }
+    } else if (valid) {
+        for (int i = 0; i < 30; ++i) {
+            atomicAdd(&global_sum[30 * batch_idx + i], reduction[i]);
+        }
+    }
+}
+
+void ComputePosePointToPlaneBatchedCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &source_row_splits,
+        const core::Tensor &transformations,
+        const core::Tensor &active,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_row_splits,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        core::Tensor &global_sum,
+        core::Tensor &correspondences,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel) {
+    const int64_t n = source_points.GetLength();
+    if (n == 0) {
+        return;
+    }
+    int64_t *correspondences_ptr =
+            correspondences.GetLength() > 0
+                    ? correspondences.GetDataPtr<int64_t>()
+                    : nullptr;
+
+    const int64_t num_batches = source_row_splits.GetLength() - 1;
+    dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+
+    // In deterministic mode every pair gets its own blocks, each writing one
+    // row of block_sums. The rows of a pair are added in block order below.
+    core::Tensor block_splits;
+    core::Tensor block_sums = global_sum;
+    const int64_t *block_splits_ptr = nullptr;
+    if (utility::IsDeterministic()) {
+        const core::Tensor row_splits =
+                source_row_splits.To(core::Device("CPU:0"));
+        const int64_t *row_splits_ptr = row_splits.GetDataPtr<int64_t>();
+        std::vector<int64_t> splits(num_batches + 1, 0);
+        for (int64_t b = 0; b < num_batches; ++b) {
+            const int64_t length = row_splits_ptr[b + 1] - row_splits_ptr[b];
+            splits[b + 1] =
+                    splits[b] + (length + kThread1DUnit - 1) / kThread1DUnit;
+        }
+        blocks = dim3(splits.back());
+        block_splits = core::Tensor(splits, {num_batches + 1}, core::Int64,
+                                    device);
+        block_splits_ptr = block_splits.GetDataPtr<int64_t>();
+        block_sums = core::ScratchScope::Zeros({splits.back(), 30}, dtype,
+                                               device);
+    }
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t *global_sum_ptr = block_sums.GetDataPtr<scalar_t>();
+
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    ComputePosePointToPlaneBatchedKernelCUDA<<<
+                            blocks, threads, 0, core::cuda::GetStream()>>>(
+                            source_points.GetDataPtr<scalar_t>(),
+                            source_row_splits.GetDataPtr<int64_t>(),
+                            transformations.GetDataPtr<scalar_t>(),
+                            active.GetDataPtr<bool>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            target_normals.GetDataPtr<scalar_t>(),
+                            target_row_splits.GetDataPtr<int64_t>(),
+                            cell_splits.GetDataPtr<int64_t>(),
+                            sorted_indices.GetDataPtr<int64_t>(),
+                            cell_splits.GetLength() - 1,
+                            static_cast<scalar_t>(max_correspondence_distance),
+                            num_batches, n, block_splits_ptr,
+                            global_sum_ptr, correspondences_ptr,
+                            GetWeightFromRobustKernel);
+                });
+    });
+
+    if (block_splits_ptr != nullptr) {
+        global_sum.AsRvalue() = block_sums.SegmentSum(block_splits);
+    }
+    core::cuda::Synchronize();
+}
+
+template <typename scalar_t, typename funct_t>
+__global__ void ComputePoseGeneralizedICPKernelCUDA(
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *source_covariances_ptr,
+        const scalar_t *target_covariances_ptr,
+        const int64_t *correspondence_indices,
+        const int n,
+        scalar_t *global_sum,
+        const int64_t block_sum_stride,
+        funct_t GetWeightFromRobustKernel) {
+    __shared__ scalar_t local_sum0[kThread1DUnit];
+    __shared__ scalar_t local_sum1[kThread1DUnit];
+    __shared__ scalar_t local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    if (workload_idx >= n) return;
+
+    scalar_t J_ij[18] = {0}, r[3] = {0}, reduction[29] = {0};
+
+    bool valid = GetJacobianGeneralizedICP<scalar_t>(
+            workload_idx, source_points_ptr, target_points_ptr,
+            source_covariances_ptr, target_covariances_ptr,
+            correspondence_indices, J_ij, r);
+
+    if (valid) {
+        // Dump the three whitened rows into JtJ and Jtr.
+        for (int row = 0; row < 3; ++row) {
+            const scalar_t *J = J_ij + 6 * row;
+            scalar_t w = GetWeightFromRobustKernel(r[row]);
+            int i = 0;
+            for (int j = 0; j < 6; ++j) {
+                for (int k = 0; k <= j; ++k) {
+                    reduction[i] += J[j] * w * J[k];
+                    ++i;
+                }
+                reduction[21 + j] += J[j] * w * r[row];
+            }
+            reduction[27] += r[row] * r[row];
+        }
+        reduction[28] += 1;
+    }
+
+    ReduceSum6x6LinearSystem<scalar_t, kThread1DUnit>(tid, valid, reduction,
+                                                      local_sum0, local_sum1,
+                                                      local_sum2, global_sum);
+}
+
+void ComputePoseGeneralizedICPCUDA(const core::Tensor &source_points,
+                                   const core::Tensor &target_points,
+                                   const core::Tensor &source_covariances,
+                                   const core::Tensor &target_covariances,
+                                   const core::Tensor &correspondence_indices,
+                                   core::Tensor &pose,
+                                   float &residual,
+                                   int &inlier_count,
+                                   const core::Dtype &dtype,
+                                   const core::Device &device,
+                                   const registration::RobustKernel &kernel) {
+    int n = source_points.GetLength();
+
+    const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+    const int64_t block_sum_stride = GetBlockSumStride(29);
+    core::Tensor global_sum = CreateBlockSums(blocks.x, 29, dtype, device);
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_ROBUST_KERNEL_FUNCTION(
+                kernel.type_, scalar_t, kernel.scaling_parameter_,
+                kernel.shape_parameter_, [&]() {
+                    ComputePoseGeneralizedICPKernelCUDA<<<
+                            blocks, threads, 0, core::cuda::GetStream()>>>(
+                            source_points.GetDataPtr<scalar_t>(),
+                            target_points.GetDataPtr<scalar_t>(),
+                            source_covariances.GetDataPtr<scalar_t>(),
+                            target_covariances.GetDataPtr<scalar_t>(),
+                            correspondence_indices.GetDataPtr<int64_t>(), n,
+                            global_sum.GetDataPtr<scalar_t>(),
+                            block_sum_stride, GetWeightFromRobustKernel);
+                });
+    });
+
+    core::cuda::Synchronize();
+
+    DecodeAndSolve6x6(ReduceBlockSums(global_sum), pose, residual,
+                      inlier_count);
 }
 
 template <typename scalar_t, typename funct_t>
@@ -143,12 +641,14 @@ __global__ void ComputePoseColoredICPKernelCUDA(
         const scalar_t sqrt_lambda_photometric,
         const int n,
         scalar_t *global_sum,
+        const int64_t block_sum_stride,
         funct_t GetWeightFromRobustKernel) {
     __shared__ scalar_t local_sum0[kThread1DUnit];
     __shared__ scalar_t local_sum1[kThread1DUnit];
     __shared__ scalar_t local_sum2[kThread1DUnit];
 
     const int tid = threadIdx.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
 
     local_sum0[tid] = 0;
     local_sum1[tid] = 0;
@@ -205,9 +705,10 @@ void ComputePoseColoredICPCUDA(const core::Tensor &source_points,
                                const double &lambda_geometric) {
     int n = source_points.GetLength();
 
-    core::Tensor global_sum = core::Tensor::Zeros({29}, dtype, device);
     const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
     const dim3 threads(kThread1DUnit);
+    const int64_t block_sum_stride = GetBlockSumStride(29);
+    core::Tensor global_sum = CreateBlockSums(blocks.x, 29, dtype, device);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t sqrt_lambda_geometric =
@@ -229,13 +730,14 @@ void ComputePoseColoredICPCUDA(const core::Tensor &source_points,
                             correspondence_indices.GetDataPtr<int64_t>(),
                             sqrt_lambda_geometric, sqrt_lambda_photometric, n,
                             global_sum.GetDataPtr<scalar_t>(),
-                            GetWeightFromRobustKernel);
+                            block_sum_stride, GetWeightFromRobustKernel);
                 });
     });
 
     core::cuda::Synchronize();
 
-    DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
+    DecodeAndSolve6x6(ReduceBlockSums(global_sum), pose, residual,
+                      inlier_count);
 }
 
 template <typename scalar_t>
@@ -243,12 +745,14 @@ __global__ void ComputeInformationMatrixKernelCUDA(
         const scalar_t *target_points_ptr,
         const int64_t *correspondence_indices,
         const int n,
-        scalar_t *global_sum) {
+        scalar_t *global_sum,
+        const int64_t block_sum_stride) {
     __shared__ scalar_t local_sum0[kThread1DUnit];
     __shared__ scalar_t local_sum1[kThread1DUnit];
     __shared__ scalar_t local_sum2[kThread1DUnit];
 
     const int tid = threadIdx.x;
+    global_sum = GetBlockSum(global_sum, block_sum_stride);
 
     local_sum0[tid] = 0;
     local_sum1[tid] = 0;
@@ -287,9 +791,10 @@ void ComputeInformationMatrixCUDA(const core::Tensor &target_points,
                                   const core::Device &device) {
     int n = correspondence_indices.GetLength();
 
-    core::Tensor global_sum = core::Tensor::Zeros({21}, dtype, device);
     const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
     const dim3 threads(kThread1DUnit);
+    const int64_t block_sum_stride = GetBlockSumStride(21);
+    core::Tensor global_sum = CreateBlockSums(blocks.x, 21, dtype, device);
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         scalar_t *global_sum_ptr = global_sum.GetDataPtr<scalar_t>();
@@ -298,12 +803,12 @@ void ComputeInformationMatrixCUDA(const core::Tensor &target_points,
                                              core::cuda::GetStream()>>>(
                 target_points.GetDataPtr<scalar_t>(),
                 correspondence_indices.GetDataPtr<int64_t>(), n,
-                global_sum_ptr);
+                global_sum_ptr, block_sum_stride);
 
         core::cuda::Synchronize();
 
-        core::Tensor global_sum_cpu =
-                global_sum.To(core::Device("CPU:0"), core::Float64);
+        core::Tensor global_sum_cpu = ReduceBlockSums(global_sum).To(
+                core::Device("CPU:0"), core::Float64);
         double *sum_ptr = global_sum_cpu.GetDataPtr<double>();
 
         // Information matrix is on CPU of type Float64.
@@ -28,8 +28,11 @@
 
 #pragma once
 
+#include <cmath>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
 
 namespace open3d {
@@ -48,6 +51,55 @@ void ComputePosePointToPlaneCPU(const core::Tensor &source_points,
                                 const core::Device &device,
                                 const registration::RobustKernel &kernel);
 
+void BuildCorrespondenceHashTableCPU(const core::Tensor &target_points,
+                                     const core::Tensor &target_row_splits,
+                                     const double voxel_size,
+                                     core::Tensor &cell_splits,
+                                     core::Tensor &sorted_indices);
+
+void ComputePosePointToPlaneFusedCPU(const core::Tensor &source_points,
+                                     const core::Tensor &target_points,
+                                     const core::Tensor &target_normals,
+                                     const core::Tensor &cell_splits,
+                                     const core::Tensor &sorted_indices,
+                                     const double max_correspondence_distance,
+                                     core::Tensor &pose,
+                                     float &residual,
+                                     int64_t &inlier_count,
+                                     double &squared_error,
+                                     const core::Dtype &dtype,
+                                     const core::Device &device,
+                                     const registration::RobustKernel &kernel);
+
+void ComputePosePointToPlaneBatchedCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &source_row_splits,
+        const core::Tensor &transformations,
+        const core::Tensor &active,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_row_splits,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        core::Tensor &global_sum,
+        core::Tensor &correspondences,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel);
+
+void ComputePoseGeneralizedICPCPU(const core::Tensor &source_points,
+                                  const core::Tensor &target_points,
+                                  const core::Tensor &source_covariances,
+                                  const core::Tensor &target_covariances,
+                                  const core::Tensor &correspondence_indices,
+                                  core::Tensor &pose,
+                                  float &residual,
+                                  int &inlier_count,
+                                  const core::Dtype &dtype,
+                                  const core::Device &device,
+                                  const registration::RobustKernel &kernel);
+
 void ComputePoseColoredICPCPU(const core::Tensor &source_points,
                               const core::Tensor &source_colors,
                               const core::Tensor &target_points,
@@ -75,6 +127,55 @@ void ComputePosePointToPlaneCUDA(const core::Tensor &source_points,
                                  const core::Device &device,
                                  const registration::RobustKernel &kernel);
 
+void BuildCorrespondenceHashTableCUDA(const core::Tensor &target_points,
+                                      const core::Tensor &target_row_splits,
+                                      const double voxel_size,
+                                      core::Tensor &cell_splits,
+                                      core::Tensor &sorted_indices);
+
+void ComputePosePointToPlaneFusedCUDA(const core::Tensor &source_points,
+                                      const core::Tensor &target_points,
+                                      const core::Tensor &target_normals,
+                                      const core::Tensor &cell_splits,
+                                      const core::Tensor &sorted_indices,
+                                      const double max_correspondence_distance,
+                                      core::Tensor &pose,
+                                      float &residual,
+                                      int64_t &inlier_count,
+                                      double &squared_error,
+                                      const core::Dtype &dtype,
+                                      const core::Device &device,
+                                      const registration::RobustKernel &kernel);
+
+void ComputePosePointToPlaneBatchedCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &source_row_splits,
+        const core::Tensor &transformations,
+        const core::Tensor &active,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_row_splits,
+        const core::Tensor &cell_splits,
+        const core::Tensor &sorted_indices,
+        const double max_correspondence_distance,
+        core::Tensor &global_sum,
+        core::Tensor &correspondences,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const registration::RobustKernel &kernel);
+
+void ComputePoseGeneralizedICPCUDA(const core::Tensor &source_points,
+                                   const core::Tensor &target_points,
+                                   const core::Tensor &source_covariances,
+                                   const core::Tensor &target_covariances,
+                                   const core::Tensor &correspondence_indices,
+                                   core::Tensor &pose,
+                                   float &residual,
+                                   int &inlier_count,
+                                   const core::Dtype &dtype,
+                                   const core::Device &device,
+                                   const registration::RobustKernel &kernel);
+
 void ComputePoseColoredICPCUDA(const core::Tensor &source_points,
                                const core::Tensor &source_colors,
                                const core::Tensor &target_points,
@@ -168,6 +269,163 @@ template bool GetJacobianPointToPlane(int64_t workload_idx,
                                       double *J_ij,
                                       double &r);
 
+/// Bucket of the cell (x, y, z) of batch \p batch_idx in a correspondence hash
+/// table with \p num_buckets buckets.
+OPEN3D_HOST_DEVICE inline int64_t GetCorrespondenceHashBucket(
+        int64_t x,
+        int64_t y,
+        int64_t z,
+        int64_t batch_idx,
+        int64_t num_buckets) {
+    const uint64_t hash = (static_cast<uint64_t>(x) * 73856093ULL) ^
+                          (static_cast<uint64_t>(y) * 19349669ULL) ^
+                          (static_cast<uint64_t>(z) * 83492791ULL) ^
+                          (static_cast<uint64_t>(batch_idx) * 2654435761ULL);
+    return static_cast<int64_t>(hash % static_cast<uint64_t>(num_buckets));
+}
+
+/// Index of the batch holding element \p idx of a ragged tensor with the
+/// \p num_batches + 1 row splits \p row_splits.
+OPEN3D_HOST_DEVICE inline int64_t GetBatchIndexFromRowSplits(
+        const int64_t *row_splits, int64_t num_batches, int64_t idx) {
+    int64_t lo = 0;
+    int64_t hi = num_batches;
+    while (hi - lo > 1) {
+        const int64_t mid = (lo + hi) / 2;
+        if (row_splits[mid] <= idx) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/// Returns the index of the nearest target point of batch \p batch_idx,
+/// i.e. in [\p target_begin, \p target_end), within sqrt(\p max_distance2) of
+/// \p query, or -1 if there is none. Ties are broken towards the smaller
+/// target index.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline int64_t FindCorrespondenceInHashTable(
+        const scalar_t *query,
+        const scalar_t *target_points_ptr,
+        const int64_t *cell_splits_ptr,
+        const int64_t *sorted_indices_ptr,
+        const int64_t num_buckets,
+        const scalar_t voxel_size,
+        const scalar_t max_distance2,
+        const int64_t batch_idx,
+        const int64_t target_begin,
+        const int64_t target_end,
+        scalar_t &distance2) {
+    const int64_t cx = static_cast<int64_t>(floor(query[0] / voxel_size));
+    const int64_t cy = static_cast<int64_t>(floor(query[1] / voxel_size));
+    const int64_t cz = static_cast<int64_t>(floor(query[2] / voxel_size));
+
+    int64_t nearest = -1;
+    distance2 = 0;
+    for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+            for (int64_t dz = -1; dz <= 1; ++dz) {
+                const int64_t bucket = GetCorrespondenceHashBucket(
+                        cx + dx, cy + dy, cz + dz, batch_idx, num_buckets);
+                for (int64_t k = cell_splits_ptr[bucket];
+                     k < cell_splits_ptr[bucket + 1]; ++k) {
+                    const int64_t target_idx = sorted_indices_ptr[k];
+                    if (target_idx < target_begin || target_idx >= target_end) {
+                        continue;
+                    }
+                    const scalar_t *target = target_points_ptr + 3 * target_idx;
+                    const scalar_t ex = query[0] - target[0];
+                    const scalar_t ey = query[1] - target[1];
+                    const scalar_t ez = query[2] - target[2];
+                    const scalar_t d2 = ex * ex + ey * ey + ez * ez;
+                    if (d2 > max_distance2) {
+                        continue;
+                    }
+                    if (nearest == -1 || d2 < distance2 ||
+                        (d2 == distance2 && target_idx < nearest)) {
+                        nearest = target_idx;
+                        distance2 = d2;
+                    }
+                }
+            }
+        }
+    }
+    return nearest;
+}
+
+/// Applies the rigid transformation \p T (row-major 4x4) to \p point.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void TransformPoint(const scalar_t *T,
+                                              const scalar_t *point,
+                                              scalar_t *transformed) {
+    for (int i = 0; i < 3; ++i) {
+        transformed[i] = T[4 * i + 0] * point[0] + T[4 * i + 1] * point[1] +
+                         T[4 * i + 2] * point[2] + T[4 * i + 3];
+    }
+}
+
+/// Jacobian {3, 6} (row-major) and residual {3} of the correspondence of
+/// source point \p workload_idx for generalized ICP. The residual is the point
+/// difference whitened by `(C_s + C_t)^(-1/2)`.
+template <typename scalar_t>
+OPEN3D_DEVICE inline bool GetJacobianGeneralizedICP(
+        const int64_t workload_idx,
+        const scalar_t *source_points_ptr,
+        const scalar_t *target_points_ptr,
+        const scalar_t *source_covariances_ptr,
+        const scalar_t *target_covariances_ptr,
+        const int64_t *correspondence_indices,
+        scalar_t *J_ij,
+        scalar_t *r) {
+    if (correspondence_indices[workload_idx] == -1) {
+        return false;
+    }
+
+    const int64_t target_idx = correspondence_indices[workload_idx];
+    const scalar_t *vs = source_points_ptr + 3 * workload_idx;
+    const scalar_t *vt = target_points_ptr + 3 * target_idx;
+    const scalar_t *Cs = source_covariances_ptr + 9 * workload_idx;
+    const scalar_t *Ct = target_covariances_ptr + 9 * target_idx;
+
+    // M = C_s + C_t is symmetric positive definite, so its SVD U S U^T is
+    // also its eigen decomposition and W = M^(-1/2) = U S^(-1/2) U^T.
+    scalar_t M[9];
+    for (int i = 0; i < 9; ++i) {
+        M[i] = Cs[i] + Ct[i];
+    }
+    scalar_t U[9], S[3], V[9];
+    core::linalg::kernel::svd3x3(M, U, S, V, 6);
+    scalar_t S_inv_sqrt[3];
+    for (int k = 0; k < 3; ++k) {
+        S_inv_sqrt[k] = S[k] > 0 ? 1 / sqrt(S[k]) : 0;
+    }
+
+    const scalar_t d[3] = {vs[0] - vt[0], vs[1] - vt[1], vs[2] - vt[2]};
+    for (int i = 0; i < 3; ++i) {
+        scalar_t w[3];
+        for (int j = 0; j < 3; ++j) {
+            w[j] = U[3 * i + 0] * S_inv_sqrt[0] * U[3 * j + 0] +
+                   U[3 * i + 1] * S_inv_sqrt[1] * U[3 * j + 1] +
+                   U[3 * i + 2] * S_inv_sqrt[2] * U[3 * j + 2];
+        }
+
+        r[i] = w[0] * d[0] + w[1] * d[1] + w[2] * d[2];
+
+        // Row i of W [-[vs]x | I], i.e. [vs x w, w].
+        scalar_t *J_i = J_ij + 6 * i;
+        J_i[0] = vs[1] * w[2] - vs[2] * w[1];
+        J_i[1] = vs[2] * w[0] - vs[0] * w[2];
+        J_i[2] = vs[0] * w[1] - vs[1] * w[0];
+        J_i[3] = w[0];
+        J_i[4] = w[1];
+        J_i[5] = w[2];
+    }
+
+    return true;
+}
+
 template <typename scalar_t>
 OPEN3D_HOST_DEVICE inline bool GetJacobianColoredICP(
         const int64_t workload_idx,
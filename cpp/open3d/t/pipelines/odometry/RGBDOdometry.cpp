@@ -26,11 +26,13 @@
 
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 
+#include "open3d/core/ScratchScope.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/pipelines/kernel/RGBDOdometry.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Profiler.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 
 namespace open3d {
@@ -42,348 +44,191 @@ using core::Tensor;
 using t::geometry::Image;
 using t::geometry::RGBDImage;
 
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsic,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScale(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& init_source_to_target,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const Method method,
-        const OdometryLossParams& params) {
-    // TODO (wei): more device check
-    const core::Device device = source.depth_.GetDevice();
-    core::AssertTensorDevice(target.depth_.AsTensor(), device);
-
+OdometryFrame::OdometryFrame(const RGBDImage& rgbd,
+                             const Tensor& intrinsics,
+                             const float depth_scale,
+                             const float depth_max,
+                             const int64_t num_levels,
+                             const Method method,
+                             const OdometryLossParams& params,
+                             const bool as_target)
+    : method_(method), as_target_(as_target) {
     core::AssertTensorShape(intrinsics, {3, 3});
-    core::AssertTensorShape(init_source_to_target, {4, 4});
-
-    // 4x4 transformations are always float64 and stay on CPU.
-    const core::Device host("CPU:0");
-    const Tensor intrinsics_d = intrinsics.To(host, core::Float64);
-    const Tensor trans_d = init_source_to_target.To(host, core::Float64);
-
-    Image source_depth = source.depth_;
-    Image target_depth = target.depth_;
-
-    Image source_depth_processed =
-            source_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-    Image target_depth_processed =
-            target_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-
-    RGBDImage source_processed(source.color_, source_depth_processed);
-    RGBDImage target_processed(target.color_, target_depth_processed);
-
-    if (method == Method::PointToPlane) {
-        return RGBDOdometryMultiScalePointToPlane(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Intensity) {
-        return RGBDOdometryMultiScaleIntensity(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Hybrid) {
-        return RGBDOdometryMultiScaleHybrid(source_processed, target_processed,
-                                            intrinsics_d, trans_d, depth_scale,
-                                            depth_max, criteria, params);
-    } else {
-        utility::LogError("Odometry method not implemented.");
+    if (num_levels < 1) {
+        utility::LogError("num_levels must be positive, but got {}.",
+                          num_levels);
     }
 
-    return OdometryResult(trans_d);
-}
-
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_vertex_maps(n_levels);
-    std::vector<Tensor> target_vertex_maps(n_levels);
-    std::vector<Tensor> target_normal_maps(n_levels);
-    std::vector<Tensor> intrinsic_matrices(n_levels);
+    intrinsics_pyramid_.resize(num_levels);
+    // Hybrid odometry back-projects depth and computes target gradients in
+    // its fused kernel, so it needs neither vertex maps nor gradient images.
+    if (method != Method::Hybrid) {
+        vertex_map_pyramid_.resize(num_levels);
+    }
+    if (method == Method::PointToPlane && as_target) {
+        normal_map_pyramid_.resize(num_levels);
+    }
+    if (method != Method::PointToPlane) {
+        depth_pyramid_.resize(num_levels);
+        intensity_pyramid_.resize(num_levels);
+    }
+    if (method == Method::Intensity && as_target) {
+        intensity_dx_pyramid_.resize(num_levels);
+        intensity_dy_pyramid_.resize(num_levels);
+    }
 
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
+    // 3x3 intrinsics are always float64 and stay on CPU.
+    Tensor intrinsics_pyr = intrinsics.To(core::Device("CPU:0"), core::Float64);
 
-    Tensor intrinsics_pyr = intrinsics;
+    Image depth_curr =
+            rgbd.depth_.ClipTransform(depth_scale, 0, depth_max, NAN);
+    Image intensity_curr;
+    if (method != Method::PointToPlane) {
+        intensity_curr = rgbd.color_.RGBToGray().To(core::Float32);
+    }
 
     // Create image pyramid.
-    for (int64_t i = 0; i < n_levels; ++i) {
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_vertex_map =
-                target_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-
-        Image target_depth_curr_smooth =
-                target_depth_curr.FilterBilateral(5, 5, 10);
-        Image target_vertex_map_smooth =
-                target_depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_normal_map = target_vertex_map_smooth.CreateNormalMap(NAN);
-
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-        target_vertex_maps[n_levels - 1 - i] = target_vertex_map.AsTensor();
-        target_normal_maps[n_levels - 1 - i] = target_normal_map.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
+    for (int64_t i = 0; i < num_levels; ++i) {
+        const int64_t level = num_levels - 1 - i;
 
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
+        intrinsics_pyramid_[level] = intrinsics_pyr.Clone();
+        if (method != Method::Hybrid) {
+            vertex_map_pyramid_[level] =
+                    depth_curr.CreateVertexMap(intrinsics_pyr, NAN).AsTensor();
         }
-    }
 
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultPointToPlane(
-                    source_vertex_maps[i], target_vertex_maps[i],
-                    target_normal_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
-
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
+        if (method == Method::PointToPlane && as_target) {
+            Image depth_curr_smooth = depth_curr.FilterBilateral(5, 5, 10);
+            Image vertex_map_smooth =
+                    depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
+            normal_map_pyramid_[level] =
+                    vertex_map_smooth.CreateNormalMap(NAN).AsTensor();
         }
-    }
-
-    return result;
-}
-
-OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
 
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
+        if (method != Method::PointToPlane) {
+            depth_pyramid_[level] = depth_curr.AsTensor().Clone();
+            intensity_pyramid_[level] = intensity_curr.AsTensor().Clone();
+        }
 
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
+        if (method == Method::Intensity && as_target) {
+            auto intensity_grad = intensity_curr.FilterSobel();
+            intensity_dx_pyramid_[level] = intensity_grad.first.AsTensor();
+            intensity_dy_pyramid_[level] = intensity_grad.second.AsTensor();
+        }
 
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
+        if (i != num_levels - 1) {
+            depth_curr = depth_curr.PyrDownDepth(
                     params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
+            if (method != Method::PointToPlane) {
+                intensity_curr = intensity_curr.PyrDown();
+            }
 
             intrinsics_pyr /= 2;
             intrinsics_pyr[-1][-1] = 1;
         }
     }
-
-    // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultIntensity(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_intensity_dx[i],
-                    target_intensity_dy[i], source_vertex_maps[i],
-                    intrinsic_matrices[i], result.transformation_,
-                    params.depth_outlier_trunc_, params.intensity_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
-
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
-        }
-    }
-
-    return result;
 }
 
-OdometryResult RGBDOdometryMultiScaleHybrid(
+OdometryResult RGBDOdometryMultiScale(
         const RGBDImage& source,
         const RGBDImage& target,
         const Tensor& intrinsics,
-        const Tensor& trans,
+        const Tensor& init_source_to_target,
         const float depth_scale,
         const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
         const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> target_depth_dx(n_levels);
-    std::vector<Tensor> target_depth_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr(source.depth_);
-    Image target_depth_curr(target.depth_);
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        auto target_depth_grad = target_depth_curr.FilterSobel();
-        target_depth_dx[n_levels - 1 - i] = target_depth_grad.first.AsTensor();
-        target_depth_dy[n_levels - 1 - i] = target_depth_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
+    core::AssertTensorDevice(target.depth_.AsTensor(),
+                             source.depth_.GetDevice());
+
+    const int64_t n_levels = int64_t(criteria.size());
+    OdometryFrame source_frame(source, intrinsics, depth_scale, depth_max,
+                               n_levels, method, params,
+                               /*as_target=*/false);
+    OdometryFrame target_frame(target, intrinsics, depth_scale, depth_max,
+                               n_levels, method, params,
+                               /*as_target=*/true);
+
+    return RGBDOdometryMultiScale(source_frame, target_frame,
+                                  init_source_to_target, criteria, params);
+}
 
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
+OdometryResult RGBDOdometryMultiScale(
+        const OdometryFrame& source,
+        const OdometryFrame& target,
+        const Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const OdometryLossParams& params) {
+    OPEN3D_PROFILE_ZONE("pipelines", "RGBDOdometryMultiScale");
+    const int64_t n_levels = int64_t(criteria.size());
+    const Method method = source.GetMethod();
+    if (target.GetMethod() != method) {
+        utility::LogError(
+                "Source and target frames are built for different methods.");
+    }
+    if (!target.IsTarget()) {
+        utility::LogError("Target frame is not built with as_target.");
     }
+    if (source.GetNumLevels() != n_levels ||
+        target.GetNumLevels() != n_levels) {
+        utility::LogError(
+                "Expected frames with {} levels as in the criteria list, but "
+                "got {} (source) and {} (target).",
+                n_levels, source.GetNumLevels(), target.GetNumLevels());
+    }
+    if (!source.intrinsics_pyramid_.back().AllClose(
+                target.intrinsics_pyramid_.back())) {
+        utility::LogError(
+                "Source and target frames have different intrinsics.");
+    }
+    const std::vector<Tensor>& source_images =
+            method == Method::PointToPlane ? source.vertex_map_pyramid_
+                                           : source.depth_pyramid_;
+    const std::vector<Tensor>& target_images =
+            method == Method::PointToPlane ? target.vertex_map_pyramid_
+                                           : target.depth_pyramid_;
+    core::AssertTensorDevice(target_images.back(),
+                             source_images.back().GetDevice());
+    core::AssertTensorShape(init_source_to_target, {4, 4});
 
-    // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
+    // 4x4 transformations are always float64 and stay on CPU.
+    const Tensor trans_d =
+            init_source_to_target.To(core::Device("CPU:0"), core::Float64);
+
+    OdometryResult result(trans_d, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultHybrid(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_depth_dx[i], target_depth_dy[i],
-                    target_intensity_dx[i], target_intensity_dy[i],
-                    source_vertex_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_, params.intensity_huber_delta_);
+            OdometryResult delta_result;
+            if (method == Method::PointToPlane) {
+                delta_result = ComputeOdometryResultPointToPlane(
+                        source.vertex_map_pyramid_[i],
+                        target.vertex_map_pyramid_[i],
+                        target.normal_map_pyramid_[i],
+                        source.intrinsics_pyramid_[i], result.transformation_,
+                        params.depth_outlier_trunc_, params.depth_huber_delta_);
+            } else if (method == Method::Intensity) {
+                delta_result = ComputeOdometryResultIntensity(
+                        source.depth_pyramid_[i], target.depth_pyramid_[i],
+                        source.intensity_pyramid_[i],
+                        target.intensity_pyramid_[i],
+                        target.intensity_dx_pyramid_[i],
+                        target.intensity_dy_pyramid_[i],
+                        source.vertex_map_pyramid_[i],
+                        source.intrinsics_pyramid_[i], result.transformation_,
+                        params.depth_outlier_trunc_,
+                        params.intensity_huber_delta_);
+            } else if (method == Method::Hybrid) {
+                delta_result = ComputeOdometryResultHybridFused(
+                        source.depth_pyramid_[i], target.depth_pyramid_[i],
+                        source.intensity_pyramid_[i],
+                        target.intensity_pyramid_[i],
+                        source.intrinsics_pyramid_[i], result.transformation_,
+                        params.depth_outlier_trunc_, params.depth_huber_delta_,
+                        params.intensity_huber_delta_);
+            } else {
+                utility::LogError("Odometry method not implemented.");
+            }
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
@@ -415,6 +260,9 @@ OdometryResult ComputeOdometryResultPointToPlane(
         const Tensor& init_source_to_target,
         const float depth_outlier_trunc,
         const float depth_huber_delta) {
+    // Scratch buffers of the kernels are recycled across iterations.
+    core::ScratchScope scratch_scope(source_vertex_map.GetDevice());
+
     // Delta target_to_source on host.
     Tensor se3_delta;
     float inlier_residual;
@@ -447,6 +295,8 @@ OdometryResult ComputeOdometryResultIntensity(
         const Tensor& init_source_to_target,
         const float depth_outlier_trunc,
         const float intensity_huber_delta) {
+    core::ScratchScope scratch_scope(source_depth.GetDevice());
+
     // Delta target_to_source on host.
     Tensor se3_delta;
     float inlier_residual;
@@ -482,6 +332,8 @@ OdometryResult ComputeOdometryResultHybrid(const Tensor& source_depth,
                                            const float depth_outlier_trunc,
                                            const float depth_huber_delta,
                                            const float intensity_huber_delta) {
+    core::ScratchScope scratch_scope(source_depth.GetDevice());
+
     // Delta target_to_source on host.
     Tensor se3_delta;
     float inlier_residual;
@@ -504,6 +356,39 @@ OdometryResult ComputeOdometryResultHybrid(const Tensor& source_depth,
                                           source_vertex_map.GetShape(1)));
 }
 
+OdometryResult ComputeOdometryResultHybridFused(
+        const Tensor& source_depth,
+        const Tensor& target_depth,
+        const Tensor& source_intensity,
+        const Tensor& target_intensity,
+        const Tensor& intrinsics,
+        const Tensor& init_source_to_target,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta) {
+    core::ScratchScope scratch_scope(source_depth.GetDevice());
+
+    // Delta target_to_source on host.
+    Tensor se3_delta;
+    float inlier_residual;
+    int inlier_count;
+    kernel::odometry::ComputeOdometryResultHybridFused(
+            source_depth, target_depth, source_intensity, target_intensity,
+            intrinsics, init_source_to_target, se3_delta, inlier_residual,
+            inlier_count, depth_outlier_trunc, depth_huber_delta,
+            intensity_huber_delta);
+    // Check inlier_count, source_depth's shape is non-zero guaranteed.
+    if (inlier_count <= 0) {
+        utility::LogError("Invalid inlier_count value {}, must be > 0.",
+                          inlier_count);
+    }
+    return OdometryResult(
+            pipelines::kernel::PoseToTransformation(se3_delta),
+            inlier_residual / inlier_count,
+            double(inlier_count) / double(source_depth.GetShape(0) *
+                                          source_depth.GetShape(1)));
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace t
@@ -137,6 +137,78 @@ public:
     float intensity_huber_delta_;
 };
 
+/// \class OdometryFrame
+///
+/// \brief Image pyramids of an RGBD frame for multi-scale RGBD odometry.
+///
+/// RGBDOdometryMultiScale on RGBD images rebuilds the pyramids of both frames
+/// on every call. When many frames are tracked against the same keyframe,
+/// build the OdometryFrame of the keyframe once and reuse it as the target.
+class OdometryFrame {
+public:
+    /// \brief Builds the pyramids of \p rgbd used by \p method.
+    ///
+    /// \param rgbd RGBD image holding a depth image (UInt16 or Float32) with a
+    /// scale factor and, for Intensity and Hybrid, a color image (UInt8 x 3).
+    /// \param intrinsics (3, 3) intrinsic matrix for projection of
+    /// core::Float64 on CPU.
+    /// \param depth_scale Converts depth pixel values to meters by dividing the
+    /// scale factor.
+    /// \param depth_max Max depth to truncate depth image with noisy
+    /// measurements.
+    /// \param num_levels Number of pyramid levels. It must match the length of
+    /// the criteria list of the odometry.
+    /// \param method Method the pyramids are built for.
+    /// \param params Parameters used in loss function. The depth outlier
+    /// threshold is also used to down sample the depth.
+    /// \param as_target If true, also builds the pyramids needed to use the
+    /// frame as target: normal maps for PointToPlane, and image gradients for
+    /// Intensity. Hybrid computes the gradients in its fused kernel.
+    OdometryFrame(const t::geometry::RGBDImage& rgbd,
+                  const core::Tensor& intrinsics,
+                  const float depth_scale = 1000.0f,
+                  const float depth_max = 3.0f,
+                  const int64_t num_levels = 3,
+                  const Method method = Method::Hybrid,
+                  const OdometryLossParams& params = OdometryLossParams(),
+                  const bool as_target = true);
+
+    /// Method the pyramids are built for.
+    Method GetMethod() const { return method_; }
+    /// Number of pyramid levels.
+    int64_t GetNumLevels() const {
+        return int64_t(intrinsics_pyramid_.size());
+    }
+    /// Whether the frame can be used as target.
+    bool IsTarget() const { return as_target_; }
+
+public:
+    /// All pyramids are ordered from coarse to fine. Pyramids a method does
+    /// not use are left empty.
+    ///
+    /// (3, 3) Float64 intrinsic matrices on CPU.
+    std::vector<core::Tensor> intrinsics_pyramid_;
+    /// (rows, cols, 3) Float32 vertex maps, for PointToPlane and Intensity.
+    std::vector<core::Tensor> vertex_map_pyramid_;
+    /// (rows, cols, 3) Float32 normal maps, for PointToPlane targets.
+    std::vector<core::Tensor> normal_map_pyramid_;
+    /// (rows, cols, 1) Float32 depth images, for Intensity and Hybrid.
+    std::vector<core::Tensor> depth_pyramid_;
+    /// (rows, cols, 1) Float32 intensity images, for Intensity and Hybrid.
+    std::vector<core::Tensor> intensity_pyramid_;
+    /// (rows, cols, 1) Float32 depth gradients. Left empty, as Hybrid
+    /// computes them in its fused kernel.
+    std::vector<core::Tensor> depth_dx_pyramid_;
+    std::vector<core::Tensor> depth_dy_pyramid_;
+    /// (rows, cols, 1) Float32 intensity gradients, for Intensity targets.
+    std::vector<core::Tensor> intensity_dx_pyramid_;
+    std::vector<core::Tensor> intensity_dy_pyramid_;
+
+private:
+    Method method_;
+    bool as_target_;
+};
+
 /// \brief Create an RGBD image pyramid given the original source and target
 /// RGBD images, and perform hierarchical odometry using specified \p
 /// method.
@@ -174,6 +246,29 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Performs hierarchical odometry on prebuilt frame pyramids, with the
+/// method the frames are built for. Reusing the target frame avoids
+/// rebuilding its pyramids in frame-to-keyframe tracking.
+/// \param source Source frame.
+/// \param target Target frame, built with as_target. It must have the same
+/// method, number of levels and intrinsics as \p source.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param criteria_list Criteria used to define and terminate iterations, from
+/// coarse to fine. Its length must be the number of levels of the frames.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        const OdometryFrame& source,
+        const OdometryFrame& target,
+        const core::Tensor& init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const OdometryLossParams& params = OdometryLossParams());
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
@@ -315,6 +410,42 @@ OdometryResult ComputeOdometryResultHybrid(
         const float depth_huber_delta,
         const float intensity_huber_delta);
 
+/// \brief Estimates the 4x4 rigid transformation T from source to target, with
+/// inlier rmse and fitness, using the same loss as ComputeOdometryResultHybrid.
+/// A single kernel back-projects the source depth, evaluates the 3x3 Sobel
+/// gradients of the target depth and intensity at the projective
+/// correspondence and reduces the linear system, so no vertex map or gradient
+/// images have to be built beforehand. Used by RGBDOdometryMultiScale for
+/// Method::Hybrid.
+///
+/// \param source_depth (rows, cols, channels=1) Float32 source depth image
+/// obtained by PreprocessDepth before calling this function.
+/// \param target_depth (rows, cols, channels=1) Float32 target depth image
+/// obtained by PreprocessDepth before calling this function.
+/// \param source_intensity (rows, cols, channels=1) Float32 source intensity
+/// image obtained by RGBToGray before calling this function.
+/// \param target_intensity (rows, cols, channels=1) Float32 target intensity
+/// image obtained by RGBToGray before calling this function.
+/// \param intrinsics (3, 3) intrinsic matrix for projection.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target.
+/// \param depth_outlier_trunc Depth difference threshold used to filter
+/// projective associations.
+/// \param depth_huber_delta Huber norm parameter used in depth loss.
+/// \param intensity_huber_delta Huber norm parameter used in intensity loss.
+/// \return odometry result, with(4, 4) optimized transformation matrix
+/// from source to target, inlier ratio, and fitness.
+OdometryResult ComputeOdometryResultHybridFused(
+        const core::Tensor& source_depth,
+        const core::Tensor& target_depth,
+        const core::Tensor& source_intensity,
+        const core::Tensor& target_intensity,
+        const core::Tensor& intrinsics,
+        const core::Tensor& init_source_to_target,
+        const float depth_outlier_trunc,
+        const float depth_huber_delta,
+        const float intensity_huber_delta);
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace t
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <algorithm>
+
+#include "open3d/core/TensorCheck.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
+                                const int max_nn,
+                                const utility::optional<double> radius) {
+    if (!input.HasPointNormals()) {
+        utility::LogError(
+                "ComputeFPFHFeature failed because the input point cloud has "
+                "no normals.");
+    }
+    if (max_nn <= 0) {
+        utility::LogError("max_nn must be positive, but got {}.", max_nn);
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError("radius must be positive, but got {}.",
+                          radius.value());
+    }
+
+    const core::Tensor positions = input.GetPointPositions().Contiguous();
+    const core::Tensor normals = input.GetPointNormals().Contiguous();
+    const core::Dtype dtype = positions.GetDtype();
+    const core::Device device = positions.GetDevice();
+    const int64_t num_points = positions.GetLength();
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    core::AssertTensorDtype(normals, dtype);
+
+    core::Tensor fpfhs = core::Tensor::Zeros({num_points, 33}, dtype, device);
+    if (num_points == 0) {
+        return fpfhs;
+    }
+
+    core::nns::NearestNeighborSearch tree(positions);
+    core::Tensor indices, distance2, counts;
+    if (radius.has_value()) {
+        utility::LogDebug("Using Hybrid Search for computing FPFH features.");
+        if (!tree.HybridIndex(radius.value())) {
+            utility::LogError("Building HybridIndex failed.");
+        }
+        std::tie(indices, distance2, counts) =
+                tree.HybridSearch(positions, radius.value(), max_nn);
+    } else {
+        utility::LogDebug("Using KNN Search for computing FPFH features.");
+        if (!tree.KnnIndex()) {
+            utility::LogError("Building KnnIndex failed.");
+        }
+        const int knn =
+                static_cast<int>(std::min<int64_t>(max_nn, num_points));
+        std::tie(indices, distance2) = tree.KnnSearch(positions, knn);
+        counts = core::Tensor::Full({num_points}, knn, core::Int32, device);
+    }
+
+    kernel::ComputeFPFHFeature(positions, normals, indices.To(core::Int32),
+                               distance2, counts.To(core::Int32), fpfhs);
+    return fpfhs;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
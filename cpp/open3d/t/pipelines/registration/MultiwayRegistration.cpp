@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/MultiwayRegistration.h"
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorCheck.h"
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+namespace legacy = open3d::pipelines::registration;
+
+legacy::PoseGraph CreatePoseGraphFromPointClouds(
+        const std::vector<geometry::PointCloud> &fragments,
+        const std::vector<core::Tensor> &features /* = {}*/,
+        const std::vector<core::Tensor> &initial_poses /* = {}*/,
+        const legacy::MultiwayRegistrationOption &option
+        /* = legacy::MultiwayRegistrationOption()*/) {
+    const int num_fragments = int(fragments.size());
+    if (!features.empty() && int(features.size()) != num_fragments) {
+        utility::LogError("Expected {} features, but got {}.", num_fragments,
+                          features.size());
+    }
+    if (!initial_poses.empty() && int(initial_poses.size()) != num_fragments) {
+        utility::LogError("Expected {} initial poses, but got {}.",
+                          num_fragments, initial_poses.size());
+    }
+    if (option.max_correspondence_distance_ <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+
+    std::vector<open3d::geometry::AxisAlignedBoundingBox> bounding_boxes;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    bool has_normals = true;
+    for (int i = 0; i < num_fragments; i++) {
+        if (fragments[i].IsEmpty()) {
+            utility::LogError("Fragment {} is empty.", i);
+        }
+        has_normals = has_normals && fragments[i].HasPointNormals();
+        bounding_boxes.emplace_back(
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        fragments[i].GetMinBound().Reshape({3, 1})),
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        fragments[i].GetMaxBound().Reshape({3, 1})));
+        if (!initial_poses.empty()) {
+            core::AssertTensorShape(initial_poses[i], {4, 4});
+            poses.push_back(core::eigen_converter::TensorToEigenMatrixXd(
+                    initial_poses[i]));
+        }
+    }
+    const std::vector<Eigen::Vector2i> pairs =
+            legacy::ComputeCandidateFragmentPairs(bounding_boxes, poses,
+                                                  option.bounding_box_margin_);
+    const int num_pairs = int(pairs.size());
+
+    // Each RANSAC already keeps the device busy, so the pairs are run one
+    // after another. The ICP refinements are small and run in one batch.
+    const RANSACConvergenceCriteria ransac_criteria(
+            option.ransac_criteria_.max_iteration_,
+            option.ransac_criteria_.confidence_);
+    std::vector<geometry::PointCloud> sources, targets;
+    std::vector<core::Tensor> inits;
+    for (const Eigen::Vector2i &pair : pairs) {
+        const int s = pair(0), t = pair(1);
+        sources.push_back(fragments[s]);
+        targets.push_back(fragments[t]);
+        Eigen::Matrix4d init = Eigen::Matrix4d::Identity();
+        if (!poses.empty()) {
+            init = poses[t].inverse() * poses[s];
+        }
+        if (!features.empty() && (poses.empty() || t != s + 1)) {
+            inits.push_back(RANSACFromFeatures(
+                                    fragments[s], fragments[t], features[s],
+                                    features[t],
+                                    option.max_correspondence_distance_,
+                                    false, 3, ransac_criteria)
+                                    .transformation_);
+        } else {
+            inits.push_back(core::eigen_converter::EigenMatrixToTensor(init));
+        }
+    }
+    const ICPConvergenceCriteria icp_criteria(
+            option.icp_criteria_.relative_fitness_,
+            option.icp_criteria_.relative_rmse_,
+            option.icp_criteria_.max_iteration_);
+    const std::vector<RegistrationResult> results =
+            has_normals ? BatchedICP(sources, targets,
+                                     option.max_correspondence_distance_,
+                                     inits,
+                                     TransformationEstimationPointToPlane(),
+                                     icp_criteria)
+                        : BatchedICP(sources, targets,
+                                     option.max_correspondence_distance_,
+                                     inits,
+                                     TransformationEstimationPointToPoint(),
+                                     icp_criteria);
+
+    std::vector<int> is_registered(num_pairs, 0);
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations(
+            num_pairs, Eigen::Matrix4d::Identity());
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> informations(
+            num_pairs, Eigen::Matrix6d::Identity());
+    std::vector<int> pair_index(num_fragments * num_fragments, -1);
+    for (int i = 0; i < num_pairs; i++) {
+        pair_index[pairs[i](0) * num_fragments + pairs[i](1)] = i;
+        if (results[i].fitness_ < option.min_fitness_) {
+            continue;
+        }
+        is_registered[i] = 1;
+        transformations[i] = core::eigen_converter::TensorToEigenMatrixXd(
+                results[i].transformation_);
+        informations[i] = core::eigen_converter::TensorToEigenMatrixXd(
+                GetInformationMatrix(sources[i], targets[i],
+                                     option.max_correspondence_distance_,
+                                     results[i].transformation_));
+    }
+
+    // The registrations are all done, the legacy scheduler only looks them
+    // up to assemble the pose graph.
+    auto lookup_pair = [&](int s, int t, Eigen::Matrix4d &transformation,
+                           Eigen::Matrix6d &information) {
+        const int i = pair_index[s * num_fragments + t];
+        if (!is_registered[i]) {
+            return false;
+        }
+        transformation = transformations[i];
+        information = informations[i];
+        return true;
+    };
+    return legacy::CreatePoseGraphFromPairwiseRegistrations(
+            num_fragments, pairs, lookup_pair, poses);
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,72 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/MultiwayRegistration.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+
+namespace open3d {
+namespace t {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace pipelines {
+namespace registration {
+
+/// \brief Function to build a pose graph by registering a sequence of point
+/// cloud fragments, on the device of the fragments.
+///
+/// Candidate pairs are selected with the legacy
+/// open3d::pipelines::registration::ComputeCandidateFragmentPairs().
+/// Consecutive fragments with initial poses, or any pair without features,
+/// start from the initial poses. Other pairs start from RANSACFromFeatures().
+/// All pairs are then refined together with BatchedICP(), point to plane if
+/// every fragment has normals.
+///
+/// \param fragments Point cloud fragments, in their own frames, all of the
+/// same type and on the same device.
+/// \param features Features of shape {N_i, D} of each fragment, or empty.
+/// \param initial_poses Pose of each fragment as a 4x4 tensor, e.g. from
+/// odometry, or empty.
+/// \param option Registration options. The RANSAC seed is not used.
+open3d::pipelines::registration::PoseGraph CreatePoseGraphFromPointClouds(
+        const std::vector<geometry::PointCloud> &fragments,
+        const std::vector<core::Tensor> &features = {},
+        const std::vector<core::Tensor> &initial_poses = {},
+        const open3d::pipelines::registration::MultiwayRegistrationOption
+                &option = open3d::pipelines::registration::
+                        MultiwayRegistrationOption());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,13 +26,26 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <typeinfo>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/ScratchScope.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/RANSAC.h"
 #include "open3d/t/pipelines/kernel/Registration.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Eigen.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Profiler.h"
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace t {
@@ -112,6 +125,7 @@ RegistrationResult ICP(const geometry::PointCloud &source,
                        const core::Tensor &init_source_to_target,
                        const TransformationEstimation &estimation,
                        const ICPConvergenceCriteria &criteria) {
+    OPEN3D_PROFILE_ZONE("pipelines", "ICP");
     return MultiScaleICP(source, target, {-1}, {criteria},
                          {max_correspondence_distance}, init_source_to_target,
                          estimation);
@@ -172,6 +186,15 @@ static void AssertInputMultiScaleICP(
         }
     }
 
+    for (const ICPConvergenceCriteria &criteria : criterias) {
+        if (criteria.convergence_check_interval_ < 1) {
+            utility::LogError(
+                    " [ICP] convergence_check_interval must be positive, but "
+                    "got {}.",
+                    criteria.convergence_check_interval_);
+        }
+    }
+
     if (max_correspondence_distances[0] <= 0.0) {
         utility::LogError(
                 " Max correspondence distance must be greater than 0, but"
@@ -193,6 +216,34 @@ static void AssertInputMultiScaleICP(
     }
 }
 
+// Sets the covariances used by GeneralizedICP, unless they are given. Each
+// point gets the covariance of a plane with its normal, i.e. epsilon along the
+// normal and 1 in the plane: C = I - (1 - epsilon) n n^T.
+static void InitializeCovariancesForGeneralizedICP(geometry::PointCloud &pcd,
+                                                   double epsilon,
+                                                   double radius) {
+    if (pcd.HasPointAttr("covariances")) {
+        return;
+    }
+
+    core::Tensor normals;
+    if (pcd.HasPointNormals()) {
+        normals = pcd.GetPointNormals();
+    } else {
+        geometry::PointCloud pcd_with_normals = pcd;
+        pcd_with_normals.EstimateNormals(30, radius);
+        normals = pcd_with_normals.GetPointNormals();
+    }
+
+    const int64_t n = normals.GetLength();
+    core::Tensor covariances =
+            normals.Reshape({n, 3, 1}) * normals.Reshape({n, 1, 3});
+    covariances.Mul_(-(1.0 - epsilon));
+    covariances.Add_(core::Tensor::Eye(3, normals.GetDtype(),
+                                       normals.GetDevice()));
+    pcd.SetPointAttr("covariances", covariances);
+}
+
 static std::tuple<std::vector<t::geometry::PointCloud>,
                   std::vector<t::geometry::PointCloud>>
 InitializePointCloudPyramidForMultiScaleICP(
@@ -231,6 +282,23 @@ InitializePointCloudPyramidForMultiScaleICP(
         }
     }
 
+    // Computing covariances. The coarser scales are voxel down sampled from
+    // the finest one, which carries the covariances over.
+    if (estimation.GetTransformationEstimationType() ==
+        TransformationEstimationType::GeneralizedICP) {
+        const auto *gicp =
+                dynamic_cast<const TransformationEstimationForGeneralizedICP *>(
+                        &estimation);
+        const double epsilon = gicp ? gicp->epsilon_ : 1e-3;
+        const double radius = voxel_sizes[num_iterations - 1] == -1
+                                      ? max_correspondence_distance * 2.0
+                                      : voxel_sizes[num_iterations - 1] * 2.0;
+        InitializeCovariancesForGeneralizedICP(
+                source_down_pyramid[num_iterations - 1], epsilon, radius);
+        InitializeCovariancesForGeneralizedICP(
+                target_down_pyramid[num_iterations - 1], epsilon, radius);
+    }
+
     for (int k = num_iterations - 2; k >= 0; k--) {
         source_down_pyramid[k] =
                 source_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
@@ -241,39 +309,140 @@ InitializePointCloudPyramidForMultiScaleICP(
     return std::make_tuple(source_down_pyramid, target_down_pyramid);
 }
 
+// ICP with the stock point to plane estimation fuses the correspondence
+// search into the linear system reduction, see
+// kernel::ComputePosePointToPlaneFused. Subclasses may override
+// ComputeTransformation, so they take the generic path.
+static bool UseFusedPointToPlane(const TransformationEstimation &estimation) {
+    return typeid(estimation) == typeid(TransformationEstimationPointToPlane);
+}
+
 static RegistrationResult DoSingleScaleIterationsICP(
         geometry::PointCloud &source,
         const geometry::PointCloud &target,
         open3d::core::nns::NearestNeighborSearch &target_nns,
         const ICPConvergenceCriteria &criteria,
+        const int &max_iteration,
         const double &max_correspondence_distance,
         core::Tensor &transformation,
         const TransformationEstimation &estimation,
         const int &iteration_idx,
-        double &prev_fitness,
-        double &prev_inlier_rmse,
+        ICPScaleReport &report,
         const core::Device &device,
         const core::Dtype &dtype) {
-    RegistrationResult result;
-    for (int j = 0; j < criteria.max_iteration_; j++) {
-        result = GetRegistrationResultAndCorrespondences(
-                source.GetPointPositions(), target_nns,
-                max_correspondence_distance, transformation);
-
-        // Computing Transform between source and target, given
-        // correspondences. ComputeTransformation returns {4,4} shaped
-        // Float64 transformation tensor on CPU device.
-        core::Tensor update =
-                estimation
-                        .ComputeTransformation(source, target,
-                                               result.correspondences_)
-                        .To(core::Float64);
+    const bool fused = UseFusedPointToPlane(estimation);
+    core::Tensor cell_splits, sorted_indices;
+    if (fused) {
+        std::tie(cell_splits, sorted_indices) =
+                kernel::BuildCorrespondenceHashTable(
+                        target.GetPointPositions(),
+                        max_correspondence_distance);
+    }
+
+    const double num_points =
+            static_cast<double>(source.GetPointPositions().GetLength());
+    const int check_interval = criteria.convergence_check_interval_;
+
+    // {number of correspondences, sum of squared distances} of the current
+    // and the previous iteration, on the host. The fused iterations get them
+    // along with the pose. Otherwise they stay on the device in stats and
+    // prev_stats until the next convergence check.
+    double curr[2] = {0, 0}, prev[2] = {0, 0};
+    core::Tensor stats, prev_stats;
+
+    report.max_iteration_ = max_iteration;
+    report.iterations_ = 0;
+    report.converged_ = false;
+
+    RegistrationResult result(transformation);
+    for (int j = 0; j < max_iteration; j++) {
+        // Reuse the reduction buffers of the previous iteration.
+        core::ScratchScope scratch_scope(device);
+
+        const bool check =
+                (j + 1) % check_interval == 0 || j == max_iteration - 1;
+
+        core::Tensor update;
+        if (fused) {
+            int64_t num_correspondences = 0;
+            double squared_error = 0;
+            core::Tensor pose = kernel::ComputePosePointToPlaneFused(
+                    source.GetPointPositions(), target.GetPointPositions(),
+                    target.GetPointNormals(), cell_splits, sorted_indices,
+                    max_correspondence_distance,
+                    static_cast<const TransformationEstimationPointToPlane &>(
+                            estimation)
+                            .kernel_,
+                    num_correspondences, squared_error);
+            prev[0] = curr[0];
+            prev[1] = curr[1];
+            curr[0] = static_cast<double>(num_correspondences);
+            curr[1] = squared_error;
+            if (num_correspondences == 0) {
+                utility::LogError(
+                        "0 correspondence present between the pointclouds. "
+                        "Try increasing the max_correspondence_distance "
+                        "parameter.");
+            }
+
+            result = RegistrationResult(transformation);
+            update = kernel::PoseToTransformation(pose);
+        } else {
+            result = RegistrationResult(transformation);
+            core::Tensor distances, counts;
+            std::tie(result.correspondences_, distances, counts) =
+                    target_nns.HybridSearch(source.GetPointPositions(),
+                                            max_correspondence_distance, 1);
+            result.correspondences_ = result.correspondences_.To(core::Int64);
+            stats = core::Concatenate(
+                    {counts.Sum({0}).To(core::Float64).Reshape({1}),
+                     distances.Sum({0}).To(core::Float64).Reshape({1})});
+
+            // Fetch both iterations in a single transfer.
+            if (check) {
+                core::Tensor stats_host =
+                        (j == 0 ? stats
+                                : core::Concatenate({prev_stats, stats}))
+                                .To(core::Device("CPU:0"));
+                const double *stats_ptr = stats_host.GetDataPtr<double>();
+                if (j != 0) {
+                    prev[0] = stats_ptr[0];
+                    prev[1] = stats_ptr[1];
+                    stats_ptr += 2;
+                }
+                curr[0] = stats_ptr[0];
+                curr[1] = stats_ptr[1];
+                if (curr[0] == 0) {
+                    utility::LogError(
+                            "0 correspondence present between the "
+                            "pointclouds. Try increasing the "
+                            "max_correspondence_distance parameter.");
+                }
+            }
+            prev_stats = stats;
+
+            // Computing Transform between source and target, given
+            // correspondences. ComputeTransformation returns {4,4} shaped
+            // Float64 transformation tensor on CPU device.
+            update = estimation
+                             .ComputeTransformation(source, target,
+                                                    result.correspondences_)
+                             .To(core::Float64);
+        }
 
         // Multiply the transform to the cumulative transformation (update).
         transformation = update.Matmul(transformation);
 
         // Apply the transform on source pointcloud.
         source.Transform(update);
+        report.iterations_ = j + 1;
+
+        if (!check) {
+            continue;
+        }
+
+        result.fitness_ = curr[0] / num_points;
+        result.inlier_rmse_ = std::sqrt(curr[1] / curr[0]);
 
         utility::LogDebug(
                 " ICP Scale #{:d} Iteration #{:d}: Fitness {:.4f}, RMSE "
@@ -281,16 +450,14 @@ static RegistrationResult DoSingleScaleIterationsICP(
                 iteration_idx + 1, j, result.fitness_, result.inlier_rmse_);
 
         // ICPConvergenceCriteria, to terminate iteration.
-        if (j != 0 &&
-            std::abs(prev_fitness - result.fitness_) <
+        if (j != 0 && prev[0] != 0 &&
+            std::abs(prev[0] / num_points - result.fitness_) <
                     criteria.relative_fitness_ &&
-            std::abs(prev_inlier_rmse - result.inlier_rmse_) <
+            std::abs(std::sqrt(prev[1] / prev[0]) - result.inlier_rmse_) <
                     criteria.relative_rmse_) {
+            report.converged_ = true;
             break;
         }
-
-        prev_fitness = result.fitness_;
-        prev_inlier_rmse = result.inlier_rmse_;
     }
 
     return result;
@@ -303,7 +470,10 @@ RegistrationResult MultiScaleICP(
         const std::vector<ICPConvergenceCriteria> &criterias,
         const std::vector<double> &max_correspondence_distances,
         const core::Tensor &init_source_to_target,
-        const TransformationEstimation &estimation) {
+        const TransformationEstimation &estimation,
+        bool adaptive_iteration_budget,
+        std::vector<ICPScaleReport> *scale_reports) {
+    OPEN3D_PROFILE_ZONE("pipelines", "MultiScaleICP");
     core::AssertTensorDtypes(source.GetPointPositions(),
                              {core::Float64, core::Float32});
 
@@ -329,27 +499,43 @@ RegistrationResult MultiScaleICP(
             init_source_to_target.To(core::Device("CPU:0"), core::Float64);
     RegistrationResult result(transformation);
 
-    double prev_fitness = 0;
-    double prev_inlier_rmse = 0;
+    std::vector<ICPScaleReport> reports(num_iterations);
 
     // ---- Iterating over different resolution scale START -------------------
     for (int64_t i = 0; i < num_iterations; ++i) {
+        utility::Timer timer;
+        timer.Start();
+
         source_down_pyramid[i].Transform(transformation);
 
-        // Initialize Neighbor Search.
+        // Initialize Neighbor Search. The fused point to plane iterations do
+        // their own lookup, so the index is only needed for the final result.
         core::nns::NearestNeighborSearch target_nns(
                 target_down_pyramid[i].GetPointPositions());
-        bool check = target_nns.HybridIndex(max_correspondence_distances[i]);
-        if (!check) {
-            utility::LogError(
-                    "NearestNeighborSearch::HybridSearch: Index is not set.");
+        if (!UseFusedPointToPlane(estimation) || i == num_iterations - 1) {
+            bool check =
+                    target_nns.HybridIndex(max_correspondence_distances[i]);
+            if (!check) {
+                utility::LogError(
+                        "NearestNeighborSearch::HybridSearch: Index is not "
+                        "set.");
+            }
+        }
+
+        // A converged coarser scale bounds the budget of this one.
+        int max_iteration = criterias[i].max_iteration_;
+        if (adaptive_iteration_budget && i > 0 && reports[i - 1].converged_) {
+            max_iteration = std::min(
+                    max_iteration,
+                    std::max(2 * reports[i - 1].iterations_,
+                             criterias[i].convergence_check_interval_));
         }
 
         // ICP iterations result for single scale.
         result = DoSingleScaleIterationsICP(
                 source_down_pyramid[i], target_down_pyramid[i], target_nns,
-                criterias[i], max_correspondence_distances[i], transformation,
-                estimation, i, prev_fitness, prev_inlier_rmse, device, dtype);
+                criterias[i], max_iteration, max_correspondence_distances[i],
+                transformation, estimation, i, reports[i], device, dtype);
 
         // To calculate final `fitness` and `inlier_rmse` for the current
         // `transformation` stored in `result`.
@@ -358,12 +544,671 @@ RegistrationResult MultiScaleICP(
                     source_down_pyramid[i], target_nns,
                     max_correspondence_distances[i], transformation);
         }
+
+        timer.Stop();
+        reports[i].time_ms_ = timer.GetDuration();
+        utility::LogDebug(" ICP Scale #{:d}: {:d}/{:d} iterations in {:.2f} ms",
+                          i + 1, reports[i].iterations_,
+                          reports[i].max_iteration_, reports[i].time_ms_);
     }
     // ---- Iterating over different resolution scale END ---------------------
 
+    if (scale_reports != nullptr) {
+        *scale_reports = std::move(reports);
+    }
     return result;
 }
 
+std::vector<RegistrationResult> BatchedICP(
+        const std::vector<geometry::PointCloud> &sources,
+        const std::vector<geometry::PointCloud> &targets,
+        double max_correspondence_distance,
+        const std::vector<core::Tensor> &init_source_to_targets,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
+    OPEN3D_PROFILE_ZONE("pipelines", "BatchedICP");
+    const int64_t num_pairs = static_cast<int64_t>(sources.size());
+    if (targets.size() != sources.size()) {
+        utility::LogError(
+                "Number of sources ({}) and targets ({}) must be the same.",
+                sources.size(), targets.size());
+    }
+    if (!init_source_to_targets.empty() &&
+        init_source_to_targets.size() != sources.size()) {
+        utility::LogError("Expected {} initial transformations, but got {}.",
+                          sources.size(), init_source_to_targets.size());
+    }
+    if (max_correspondence_distance <= 0) {
+        utility::LogError(
+                "max_correspondence_distance must be positive, but got {}.",
+                max_correspondence_distance);
+    }
+
+    const core::Device host("CPU:0");
+    auto GetInit = [&](int64_t b) {
+        return init_source_to_targets.empty()
+                       ? core::Tensor::Eye(4, core::Float64, host)
+                       : init_source_to_targets[b];
+    };
+
+    std::vector<RegistrationResult> results;
+    if (!UseFusedPointToPlane(estimation)) {
+        for (int64_t b = 0; b < num_pairs; ++b) {
+            results.push_back(ICP(sources[b], targets[b],
+                                  max_correspondence_distance, GetInit(b),
+                                  estimation, criteria));
+        }
+        return results;
+    }
+    if (num_pairs == 0) {
+        return results;
+    }
+
+    const core::Device device = sources[0].GetDevice();
+    const core::Dtype dtype = sources[0].GetPointPositions().GetDtype();
+    core::AssertTensorDtypes(sources[0].GetPointPositions(),
+                             {core::Float64, core::Float32});
+
+    // Pack all pairs into ragged tensors.
+    std::vector<core::Tensor> source_positions, target_positions,
+            target_normals;
+    std::vector<int64_t> source_row_splits(1, 0), target_row_splits(1, 0);
+    core::Tensor transformations =
+            core::Tensor::Empty({num_pairs, 4, 4}, core::Float64, host);
+    for (int64_t b = 0; b < num_pairs; ++b) {
+        if (!sources[b].HasPointPositions() ||
+            !targets[b].HasPointPositions()) {
+            utility::LogError("Source and/or Target pointcloud {} is empty.",
+                              b);
+        }
+        if (!targets[b].HasPointNormals()) {
+            utility::LogError("Target pointcloud {} missing normals attribute.",
+                              b);
+        }
+        core::AssertTensorDtype(sources[b].GetPointPositions(), dtype);
+        core::AssertTensorDtype(targets[b].GetPointPositions(), dtype);
+        core::AssertTensorDtype(targets[b].GetPointNormals(), dtype);
+        core::AssertTensorDevice(sources[b].GetPointPositions(), device);
+        core::AssertTensorDevice(targets[b].GetPointPositions(), device);
+        core::AssertTensorShape(GetInit(b), {4, 4});
+
+        source_positions.push_back(sources[b].GetPointPositions());
+        target_positions.push_back(targets[b].GetPointPositions());
+        target_normals.push_back(targets[b].GetPointNormals());
+        source_row_splits.push_back(source_row_splits.back() +
+                                    sources[b].GetPointPositions().GetLength());
+        target_row_splits.push_back(target_row_splits.back() +
+                                    targets[b].GetPointPositions().GetLength());
+        transformations.SetItem(core::TensorKey::Index(b),
+                                GetInit(b).To(host, core::Float64));
+    }
+
+    const core::Tensor packed_source_positions =
+            core::Concatenate(source_positions, 0);
+    const core::Tensor packed_target_positions =
+            core::Concatenate(target_positions, 0);
+    const core::Tensor packed_target_normals =
+            core::Concatenate(target_normals, 0);
+    const core::Tensor source_row_splits_t =
+            core::Tensor(source_row_splits, {num_pairs + 1}, core::Int64)
+                    .To(device);
+    const core::Tensor target_row_splits_t =
+            core::Tensor(target_row_splits, {num_pairs + 1}, core::Int64)
+                    .To(device);
+
+    core::Tensor cell_splits, sorted_indices;
+    std::tie(cell_splits, sorted_indices) =
+            kernel::BuildCorrespondenceHashTable(packed_target_positions,
+                                                 target_row_splits_t,
+                                                 max_correspondence_distance);
+
+    const RobustKernel &robust_kernel =
+            static_cast<const TransformationEstimationPointToPlane &>(
+                    estimation)
+                    .kernel_;
+
+    core::Tensor active =
+            core::Tensor::Full({num_pairs}, true, core::Bool, host);
+    bool *active_ptr = active.GetDataPtr<bool>();
+    std::vector<double> prev_fitness(num_pairs, 0);
+    std::vector<double> prev_inlier_rmse(num_pairs, 0);
+
+    for (int j = 0; j < criteria.max_iteration_; j++) {
+        // Reuse the reduction buffers of the previous iteration.
+        core::ScratchScope scratch_scope(device);
+
+        core::Tensor poses, inlier_counts, squared_errors, correspondences;
+        std::tie(poses, inlier_counts, squared_errors, correspondences) =
+                kernel::ComputePosePointToPlaneBatched(
+                        packed_source_positions, source_row_splits_t,
+                        transformations, active, packed_target_positions,
+                        packed_target_normals, target_row_splits_t,
+                        cell_splits, sorted_indices,
+                        max_correspondence_distance, robust_kernel);
+        const int64_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+        const double *squared_errors_ptr = squared_errors.GetDataPtr<double>();
+
+        int64_t num_active = 0;
+        for (int64_t b = 0; b < num_pairs; ++b) {
+            if (!active_ptr[b]) {
+                continue;
+            }
+            const int64_t num_correspondences = inlier_counts_ptr[b];
+            if (num_correspondences == 0) {
+                active_ptr[b] = false;
+                continue;
+            }
+
+            const double fitness =
+                    static_cast<double>(num_correspondences) /
+                    static_cast<double>(source_row_splits[b + 1] -
+                                        source_row_splits[b]);
+            const double inlier_rmse =
+                    std::sqrt(squared_errors_ptr[b] /
+                              static_cast<double>(num_correspondences));
+
+            // Multiply the transform to the cumulative transformation.
+            core::Tensor update = kernel::PoseToTransformation(poses[b]);
+            transformations.SetItem(core::TensorKey::Index(b),
+                                    update.Matmul(transformations[b]));
+
+            utility::LogDebug(
+                    " Batched ICP Pair #{:d} Iteration #{:d}: Fitness {:.4f}, "
+                    "RMSE {:.4f}",
+                    b, j, fitness, inlier_rmse);
+
+            // ICPConvergenceCriteria, to terminate iteration of this pair.
+            if (j != 0 &&
+                std::abs(prev_fitness[b] - fitness) <
+                        criteria.relative_fitness_ &&
+                std::abs(prev_inlier_rmse[b] - inlier_rmse) <
+                        criteria.relative_rmse_) {
+                active_ptr[b] = false;
+                continue;
+            }
+
+            prev_fitness[b] = fitness;
+            prev_inlier_rmse[b] = inlier_rmse;
+            ++num_active;
+        }
+
+        if (num_active == 0) {
+            break;
+        }
+    }
+
+    // Final `fitness`, `inlier_rmse` and correspondences of every pair for
+    // its final transformation.
+    active.Fill(true);
+    core::Tensor poses, inlier_counts, squared_errors, correspondences;
+    std::tie(poses, inlier_counts, squared_errors, correspondences) =
+            kernel::ComputePosePointToPlaneBatched(
+                    packed_source_positions, source_row_splits_t,
+                    transformations, active, packed_target_positions,
+                    packed_target_normals, target_row_splits_t, cell_splits,
+                    sorted_indices, max_correspondence_distance, robust_kernel,
+                    /*compute_correspondences=*/true);
+    const int64_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+    const double *squared_errors_ptr = squared_errors.GetDataPtr<double>();
+
+    for (int64_t b = 0; b < num_pairs; ++b) {
+        RegistrationResult result(transformations[b].Clone());
+        result.correspondences_ = correspondences.Slice(
+                0, source_row_splits[b], source_row_splits[b + 1]);
+        const int64_t num_correspondences = inlier_counts_ptr[b];
+        if (num_correspondences > 0) {
+            result.fitness_ =
+                    static_cast<double>(num_correspondences) /
+                    static_cast<double>(source_row_splits[b + 1] -
+                                        source_row_splits[b]);
+            result.inlier_rmse_ =
+                    std::sqrt(squared_errors_ptr[b] /
+                              static_cast<double>(num_correspondences));
+        }
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+RegistrationResult RANSACFromCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences,
+        double max_correspondence_distance,
+        int ransac_n,
+        const RANSACConvergenceCriteria &criteria,
+        int batch_size) {
+    if (!target.HasPointPositions() || !source.HasPointPositions()) {
+        utility::LogError("Source and/or Target pointcloud is empty.");
+    }
+    core::AssertTensorDtypes(source.GetPointPositions(),
+                             {core::Float64, core::Float32});
+    core::AssertTensorDtype(target.GetPointPositions(),
+                            source.GetPointPositions().GetDtype());
+    core::AssertTensorDevice(target.GetPointPositions(), source.GetDevice());
+    core::AssertTensorShape(correspondences, {utility::nullopt, 2});
+    core::AssertTensorDtype(correspondences, core::Int64);
+    if (ransac_n < 3 || max_correspondence_distance <= 0 ||
+        batch_size <= 0) {
+        utility::LogError(
+                "Illegal input parameters, ransac_n must be at least 3, "
+                "max_correspondence_distance and batch_size must be "
+                "positive.");
+    }
+    if (criteria.confidence_ <= 0 || criteria.confidence_ >= 1) {
+        utility::LogError("confidence must be in (0, 1), but got {}.",
+                          criteria.confidence_);
+    }
+
+    const int64_t num_correspondences = correspondences.GetLength();
+    if (num_correspondences < ransac_n) {
+        utility::LogWarning(
+                "RANSAC needs at least {} correspondences, but got {}.",
+                ransac_n, num_correspondences);
+        return RegistrationResult();
+    }
+
+    const core::Device device = source.GetDevice();
+    const core::Tensor correspondences_device = correspondences.To(device);
+    const core::Tensor source_points =
+            source.GetPointPositions()
+                    .IndexGet({correspondences_device.Slice(1, 0, 1)
+                                       .Reshape({-1})})
+                    .Contiguous();
+    const core::Tensor target_points =
+            target.GetPointPositions()
+                    .IndexGet({correspondences_device.Slice(1, 1, 2)
+                                       .Reshape({-1})})
+                    .Contiguous();
+
+    // Samples are drawn on the host, hypotheses are estimated and scored on
+    // the device one batch at a time.
+    std::mt19937 rng{std::random_device{}()};
+    std::uniform_int_distribution<int64_t> distribution(
+            0, num_correspondences - 1);
+
+    int64_t max_iteration = criteria.max_iteration_;
+    int64_t best_count = 0;
+    double best_error = 0;
+    core::Tensor best_transformation;
+    int64_t iteration = 0;
+    while (iteration < max_iteration) {
+        const int64_t num_hypotheses =
+                std::min<int64_t>(batch_size, max_iteration - iteration);
+
+        std::vector<int64_t> samples(num_hypotheses * ransac_n);
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            int64_t *sample = samples.data() + h * ransac_n;
+            for (int k = 0; k < ransac_n; ++k) {
+                do {
+                    sample[k] = distribution(rng);
+                } while (std::find(sample, sample + k, sample[k]) !=
+                         sample + k);
+            }
+        }
+
+        core::Tensor transformations, inlier_counts, inlier_errors;
+        kernel::EstimateRANSACHypotheses(
+                source_points, target_points,
+                core::Tensor(samples, {num_hypotheses, ransac_n}, core::Int64,
+                             device),
+                transformations);
+        kernel::EvaluateRANSACHypotheses(
+                source_points, target_points, transformations,
+                max_correspondence_distance, inlier_counts, inlier_errors);
+
+        inlier_counts = inlier_counts.To(core::Device("CPU:0"));
+        inlier_errors = inlier_errors.To(core::Device("CPU:0"), core::Float64);
+        const int32_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int32_t>();
+        const double *inlier_errors_ptr = inlier_errors.GetDataPtr<double>();
+        int64_t batch_best = -1;
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            if (inlier_counts_ptr[h] > best_count ||
+                (inlier_counts_ptr[h] == best_count && best_count > 0 &&
+                 inlier_errors_ptr[h] < best_error)) {
+                best_count = inlier_counts_ptr[h];
+                best_error = inlier_errors_ptr[h];
+                batch_best = h;
+            }
+        }
+        if (batch_best >= 0) {
+            best_transformation = transformations[batch_best].To(
+                    core::Device("CPU:0"), core::Float64);
+        }
+        iteration += num_hypotheses;
+
+        // Number of hypotheses to find an all-inlier sample with the given
+        // confidence at the best inlier ratio so far.
+        if (best_count > 0) {
+            const double inlier_ratio =
+                    static_cast<double>(best_count) / num_correspondences;
+            if (inlier_ratio >= 1) break;
+            const double est_iteration =
+                    std::log(1 - criteria.confidence_) /
+                    std::log(1 - std::pow(inlier_ratio, ransac_n));
+            if (est_iteration < max_iteration) {
+                max_iteration = static_cast<int64_t>(std::ceil(est_iteration));
+            }
+        }
+    }
+    utility::LogDebug("RANSAC: {} hypotheses, best inlier count {} / {}.",
+                      iteration, best_count, num_correspondences);
+
+    if (best_count == 0) {
+        return RegistrationResult();
+    }
+    return EvaluateRegistration(source, target, max_correspondence_distance,
+                                best_transformation);
+}
+
+/// Matches each source feature to its nearest target feature. Returns the
+/// Int64 {C, 2} (source index, target index) pairs on \p device. With
+/// \p mutual_filter, only pairs that are also nearest from the target side are
+/// kept.
+static core::Tensor MatchFeatures(const core::Tensor &source_features,
+                                  const core::Tensor &target_features,
+                                  bool mutual_filter,
+                                  const core::Device &device) {
+    const int64_t num_source = source_features.GetLength();
+    const core::Tensor source_features_contiguous =
+            source_features.Contiguous();
+    const core::Tensor target_features_contiguous =
+            target_features.Contiguous();
+
+    core::nns::NearestNeighborSearch target_feature_nns(
+            target_features_contiguous);
+    if (!target_feature_nns.KnnIndex()) {
+        utility::LogError("Building KnnIndex failed.");
+    }
+    core::Tensor target_indices, distances;
+    std::tie(target_indices, distances) =
+            target_feature_nns.KnnSearch(source_features_contiguous, 1);
+    target_indices = target_indices.Reshape({-1}).To(device, core::Int64);
+    core::Tensor source_indices =
+            core::Tensor::Arange(0, num_source, 1, core::Int64, device);
+
+    if (mutual_filter) {
+        core::nns::NearestNeighborSearch source_feature_nns(
+                source_features_contiguous);
+        if (!source_feature_nns.KnnIndex()) {
+            utility::LogError("Building KnnIndex failed.");
+        }
+        core::Tensor back_indices;
+        std::tie(back_indices, distances) =
+                source_feature_nns.KnnSearch(target_features_contiguous, 1);
+        back_indices = back_indices.Reshape({-1}).To(device, core::Int64);
+
+        core::Tensor mutual =
+                back_indices.IndexGet({target_indices}).Eq(source_indices);
+        source_indices = source_indices.IndexGet({mutual});
+        target_indices = target_indices.IndexGet({mutual});
+    }
+
+    return source_indices.Reshape({-1, 1})
+            .Append(target_indices.Reshape({-1, 1}), 1);
+}
+
+static void AssertInputFeatures(const geometry::PointCloud &source,
+                                const geometry::PointCloud &target,
+                                const core::Tensor &source_features,
+                                const core::Tensor &target_features) {
+    if (!target.HasPointPositions() || !source.HasPointPositions()) {
+        utility::LogError("Source and/or Target pointcloud is empty.");
+    }
+    const int64_t num_source = source.GetPointPositions().GetLength();
+    const int64_t num_target = target.GetPointPositions().GetLength();
+    core::AssertTensorShape(source_features, {num_source, utility::nullopt});
+    core::AssertTensorShape(target_features,
+                            {num_target, source_features.GetShape(1)});
+    core::AssertTensorDtype(target_features, source_features.GetDtype());
+    core::AssertTensorDevice(target_features, source_features.GetDevice());
+}
+
+RegistrationResult RANSACFromFeatures(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        double max_correspondence_distance,
+        bool mutual_filter,
+        int ransac_n,
+        const RANSACConvergenceCriteria &criteria,
+        int batch_size) {
+    AssertInputFeatures(source, target, source_features, target_features);
+    const core::Tensor correspondences =
+            MatchFeatures(source_features, target_features, mutual_filter,
+                          source.GetDevice());
+    return RANSACFromCorrespondences(source, target, correspondences,
+                                     max_correspondence_distance, ransac_n,
+                                     criteria, batch_size);
+}
+
+/// Selects the correspondences of the tuple test of Fast Global Registration.
+/// Random triples of correspondences are tested in batches on the device and
+/// accepted in drawing order, until \p maximum_tuple_count tuples are found
+/// or 100 trials per correspondence are made.
+static core::Tensor SelectTupleCorrespondences(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondences,
+        const open3d::pipelines::registration::FastGlobalRegistrationOption
+                &option) {
+    const core::Device device = source_points.GetDevice();
+    const int64_t num_correspondences = correspondences.GetLength();
+    const int64_t num_trials = num_correspondences * 100;
+    const int64_t batch_size =
+            std::max<int64_t>(1024, 4 * option.maximum_tuple_count_);
+    const double scale = option.tuple_scale_;
+
+    std::mt19937 rng{option.seed_.has_value() ? option.seed_.value()
+                                              : std::random_device{}()};
+    std::uniform_int_distribution<int64_t> distribution(
+            0, num_correspondences - 1);
+
+    // Lengths of the three sides of the triangles of a batch of triples.
+    auto side_lengths = [](const core::Tensor &points,
+                           const core::Tensor &indices) {
+        const core::Tensor triangles = points.IndexGet({indices});
+        const core::Tensor p0 = triangles.Slice(1, 0, 1);
+        const core::Tensor p1 = triangles.Slice(1, 1, 2);
+        const core::Tensor p2 = triangles.Slice(1, 2, 3);
+        return core::Concatenate({p0 - p1, p1 - p2, p2 - p0}, 1)
+                .Mul(core::Concatenate({p0 - p1, p1 - p2, p2 - p0}, 1))
+                .Sum({2})
+                .Sqrt();
+    };
+
+    std::vector<int64_t> selected;
+    int64_t num_tuples = 0;
+    int64_t trial = 0;
+    while (trial < num_trials && num_tuples < option.maximum_tuple_count_) {
+        const int64_t num_batch = std::min(batch_size, num_trials - trial);
+        std::vector<int64_t> samples(num_batch * 3);
+        for (int64_t &sample : samples) {
+            sample = distribution(rng);
+        }
+        const core::Tensor samples_device(samples, {num_batch, 3}, core::Int64,
+                                          device);
+        const core::Tensor source_lengths = side_lengths(
+                source_points, correspondences.Slice(1, 0, 1)
+                                       .Reshape({-1})
+                                       .IndexGet({samples_device}));
+        const core::Tensor target_lengths = side_lengths(
+                target_points, correspondences.Slice(1, 1, 2)
+                                       .Reshape({-1})
+                                       .IndexGet({samples_device}));
+        const core::Tensor is_similar =
+                source_lengths.Mul(scale)
+                        .Lt(target_lengths)
+                        .LogicalAnd(target_lengths.Lt(
+                                source_lengths.Div(scale)));
+        const core::Tensor is_tuple =
+                is_similar.Slice(1, 0, 1)
+                        .LogicalAnd(is_similar.Slice(1, 1, 2))
+                        .LogicalAnd(is_similar.Slice(1, 2, 3))
+                        .Reshape({-1})
+                        .To(core::Device("CPU:0"));
+        const bool *is_tuple_ptr = is_tuple.GetDataPtr<bool>();
+        for (int64_t k = 0; k < num_batch &&
+                            num_tuples < option.maximum_tuple_count_;
+             ++k, ++trial) {
+            if (is_tuple_ptr[k]) {
+                selected.insert(selected.end(), samples.begin() + 3 * k,
+                                samples.begin() + 3 * k + 3);
+                ++num_tuples;
+            }
+        }
+    }
+    utility::LogDebug("FGR: {} tuples ({} trials).", num_tuples, trial);
+
+    const int64_t num_selected = int64_t(selected.size());
+    return correspondences.IndexGet(
+            {core::Tensor(selected, {num_selected}, core::Int64, device)});
+}
+
+RegistrationResult FastGlobalRegistrationFromFeatures(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        const open3d::pipelines::registration::FastGlobalRegistrationOption
+                &option) {
+    AssertInputFeatures(source, target, source_features, target_features);
+    core::AssertTensorDtypes(source.GetPointPositions(),
+                             {core::Float64, core::Float32});
+    core::AssertTensorDtype(target.GetPointPositions(),
+                            source.GetPointPositions().GetDtype());
+    core::AssertTensorDevice(target.GetPointPositions(), source.GetDevice());
+
+    const core::Device device = source.GetDevice();
+    const core::Device host("CPU:0");
+    const core::Tensor correspondences = MatchFeatures(
+            source_features, target_features, /*mutual_filter=*/true, device);
+    utility::LogDebug("FGR: {} initial matches.",
+                      correspondences.GetLength());
+    if (correspondences.GetLength() == 0) {
+        return RegistrationResult();
+    }
+
+    // Normalize both point clouds by their mean and the largest distance of a
+    // point to its mean, computed in Float64.
+    core::Tensor source_points =
+            source.GetPointPositions().To(core::Float64);
+    core::Tensor target_points =
+            target.GetPointPositions().To(core::Float64);
+    const core::Tensor source_mean = source_points.Mean({0}, true);
+    const core::Tensor target_mean = target_points.Mean({0}, true);
+    source_points = source_points - source_mean;
+    target_points = target_points - target_mean;
+    const double scale =
+            std::max(source_points.Mul(source_points)
+                             .Sum({1})
+                             .Max({0})
+                             .Sqrt()
+                             .Item<double>(),
+                     target_points.Mul(target_points)
+                             .Sum({1})
+                             .Max({0})
+                             .Sqrt()
+                             .Item<double>());
+    const double scale_global = option.use_absolute_scale_ ? 1.0 : scale;
+    if (scale_global <= 0) {
+        utility::LogError("Invalid scale_global: {}, it must be > 0.",
+                          scale_global);
+    }
+    source_points = source_points / scale_global;
+    target_points = target_points / scale_global;
+
+    const core::Tensor corres = SelectTupleCorrespondences(
+            source_points, target_points, correspondences, option);
+    const int64_t num_corres = corres.GetLength();
+    core::Tensor transformation =
+            core::Tensor::Eye(4, core::Float64, host);
+    if (num_corres >= 10) {
+        const core::Tensor p = source_points.IndexGet(
+                {corres.Slice(1, 0, 1).Reshape({-1})});
+        core::Tensor q = target_points.IndexGet(
+                {corres.Slice(1, 1, 2).Reshape({-1})});
+        const core::Tensor zeros =
+                core::Tensor::Zeros({num_corres, 1}, core::Float64, device);
+        const core::Tensor ones =
+                core::Tensor::Ones({num_corres, 1}, core::Float64, device);
+
+        // Aligns the target to the source as the legacy implementation does,
+        // the result is inverted below.
+        Eigen::Matrix4d trans = Eigen::Matrix4d::Identity();
+        double par = scale_global;
+        for (int itr = 0; itr < option.iteration_number_; itr++) {
+            const core::Tensor rpq = p - q;
+            const core::Tensor temp =
+                    core::Tensor::Full({num_corres, 1}, par, core::Float64,
+                                       device) /
+                    (rpq.Mul(rpq).Sum({1}, true) + par);
+            const core::Tensor s = temp * temp;
+
+            // Rows of the Jacobian of the x, y and z residuals of each
+            // correspondence, [skew(q) | -I].
+            const core::Tensor qx = q.Slice(1, 0, 1);
+            const core::Tensor qy = q.Slice(1, 1, 2);
+            const core::Tensor qz = q.Slice(1, 2, 3);
+            const core::Tensor J =
+                    core::Concatenate({zeros, qz.Neg(), qy, ones.Neg(), zeros,
+                                       zeros, qz, zeros, qx.Neg(), zeros,
+                                       ones.Neg(), zeros, qy.Neg(), qx, zeros,
+                                       zeros, zeros, ones.Neg()},
+                                      1)
+                            .Reshape({num_corres * 3, 6});
+            const core::Tensor Jw =
+                    J * core::Concatenate({s, s, s}, 1).Reshape({-1, 1});
+            const core::Tensor JTJ = Jw.T().Matmul(J).To(host);
+            const core::Tensor JTr =
+                    Jw.T().Matmul(rpq.Reshape({-1, 1})).To(host);
+
+            bool success;
+            Eigen::VectorXd result;
+            std::tie(success, result) = utility::SolveLinearSystemPSD(
+                    -core::eigen_converter::TensorToEigenMatrixXd(JTJ),
+                    core::eigen_converter::TensorToEigenMatrixXd(JTr));
+            const Eigen::Matrix4d delta =
+                    utility::TransformVector6dToMatrix4d(result);
+            trans = delta * trans;
+            const core::Tensor delta_device =
+                    core::eigen_converter::EigenMatrixToTensor(delta).To(
+                            device);
+            q = q.Matmul(delta_device.Slice(0, 0, 3).Slice(1, 0, 3).T()) +
+                delta_device.Slice(0, 0, 3).Slice(1, 3, 4).T();
+
+            // graduated non-convexity.
+            if (option.decrease_mu_) {
+                if (itr % 4 == 0 &&
+                    par > option.maximum_correspondence_distance_) {
+                    par /= option.division_factor_;
+                }
+            }
+        }
+
+        // Undo the normalization, trans * target is aligned with source.
+        const Eigen::Vector3d mu_source =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        source_mean.To(host).Reshape({3, 1}));
+        const Eigen::Vector3d mu_target =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        target_mean.To(host).Reshape({3, 1}));
+        const Eigen::Matrix3d R = trans.block<3, 3>(0, 0);
+        Eigen::Matrix4d trans_original = Eigen::Matrix4d::Identity();
+        trans_original.block<3, 3>(0, 0) = R;
+        trans_original.block<3, 1>(0, 3) =
+                -R * mu_target + trans.block<3, 1>(0, 3) * scale_global +
+                mu_source;
+        transformation = core::eigen_converter::EigenMatrixToTensor(
+                Eigen::Matrix4d(trans_original.inverse()));
+    }
+    return EvaluateRegistration(source, target,
+                                option.maximum_correspondence_distance_,
+                                transformation);
+}
+
 core::Tensor GetInformationMatrix(const geometry::PointCloud &source,
                                   const geometry::PointCloud &target,
                                   const double max_correspondence_distance,
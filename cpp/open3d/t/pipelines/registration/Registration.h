@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/FastGlobalRegistration.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
@@ -58,12 +59,16 @@ public:
     /// \param relative_rmse If relative change (difference) of inliner RMSE
     /// score is lower than relative_rmse, the iteration stops.
     /// \param max_iteration Maximum iteration before iteration stops.
+    /// \param convergence_check_interval The convergence is tested every
+    /// convergence_check_interval iterations.
     ICPConvergenceCriteria(double relative_fitness = 1e-6,
                            double relative_rmse = 1e-6,
-                           int max_iteration = 30)
+                           int max_iteration = 30,
+                           int convergence_check_interval = 1)
         : relative_fitness_(relative_fitness),
           relative_rmse_(relative_rmse),
-          max_iteration_(max_iteration) {}
+          max_iteration_(max_iteration),
+          convergence_check_interval_(convergence_check_interval) {}
     ~ICPConvergenceCriteria() {}
 
 public:
@@ -75,6 +80,51 @@ public:
     double relative_rmse_;
     /// Maximum iteration before iteration stops.
     int max_iteration_;
+    /// The convergence is tested every `convergence_check_interval`
+    /// iterations. Fitness and RMSE then stay on the device in between, so
+    /// the iterations do not wait for their transfer to the host. ICP may run
+    /// up to `convergence_check_interval - 1` iterations past convergence.
+    int convergence_check_interval_;
+};
+
+/// \class ICPScaleReport
+///
+/// \brief Iterations and time spent on one scale of MultiScaleICP.
+class ICPScaleReport {
+public:
+    /// Iteration budget of the scale.
+    int max_iteration_ = 0;
+    /// Number of iterations run.
+    int iterations_ = 0;
+    /// Whether the scale stopped on the convergence criteria, rather than on
+    /// its iteration budget.
+    bool converged_ = false;
+    /// Wall time of the scale in milliseconds, including its setup such as
+    /// building the neighbor search index.
+    double time_ms_ = 0.0;
+};
+
+/// \class RANSACConvergenceCriteria
+///
+/// \brief Class that defines the convergence criteria of RANSAC.
+class RANSACConvergenceCriteria {
+public:
+    /// \brief Parameterized Constructor.
+    /// RANSAC stops after \p max_iteration_ hypotheses, or earlier once the
+    /// best hypothesis so far is found with probability \p confidence_.
+    ///
+    /// \param max_iteration Maximum number of hypotheses.
+    /// \param confidence Desired probability of success, in (0, 1).
+    RANSACConvergenceCriteria(int max_iteration = 100000,
+                              double confidence = 0.999)
+        : max_iteration_(max_iteration), confidence_(confidence) {}
+    ~RANSACConvergenceCriteria() {}
+
+public:
+    /// Maximum number of hypotheses.
+    int max_iteration_;
+    /// Desired probability of success, used for early termination.
+    double confidence_;
 };
 
 /// \class RegistrationResult
@@ -167,6 +217,12 @@ RegistrationResult ICP(
 /// \param init_source_to_target Initial transformation estimation of type
 /// Float64 on CPU.
 /// \param estimation Estimation method.
+/// \param adaptive_iteration_budget If true, a scale following a converged
+/// scale gets twice the iterations that scale needed, bounded by its own
+/// max_iteration, as a good coarse alignment leaves little to refine.
+/// \param scale_reports [optional] Filled with one ICPScaleReport per scale.
+/// The scales are timed on the host between the synchronizations that end
+/// every scale, so the report adds no synchronization of its own.
 RegistrationResult MultiScaleICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -176,7 +232,123 @@ RegistrationResult MultiScaleICP(
         const core::Tensor &init_source_to_target =
                 core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
         const TransformationEstimation &estimation =
-                TransformationEstimationPointToPoint());
+                TransformationEstimationPointToPoint(),
+        bool adaptive_iteration_budget = false,
+        std::vector<ICPScaleReport> *scale_reports = nullptr);
+
+/// \brief Runs ICP on many source/target pairs at once.
+///
+/// All pairs are packed into ragged tensors and every iteration finds the
+/// correspondences and builds the linear systems of all pairs in a single
+/// kernel launch, which keeps the device busy when each pair alone is small.
+/// Each pair stops iterating on its own once it meets the convergence
+/// criteria. A pair without any correspondence stops as well and is returned
+/// with zero fitness and RMSE, rather than failing the whole batch.
+///
+/// The batched path is used with TransformationEstimationPointToPlane. Other
+/// estimation methods run ICP on the pairs one after another.
+///
+/// \param sources The source point clouds. (Float32 or Float64 type, all of
+/// the same type and on the same device).
+/// \param targets The target point clouds, with normals for point to plane.
+/// Same length, type and device as \p sources.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init_source_to_targets Initial transformation estimation of every
+/// pair, each of type Float64 on CPU. Empty for identity.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria, shared by all pairs.
+/// \return One RegistrationResult per pair.
+std::vector<RegistrationResult> BatchedICP(
+        const std::vector<geometry::PointCloud> &sources,
+        const std::vector<geometry::PointCloud> &targets,
+        double max_correspondence_distance,
+        const std::vector<core::Tensor> &init_source_to_targets = {},
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPlane(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+/// \brief Function for global RANSAC registration based on a set of
+/// correspondences. Hypotheses are sampled in batches and all hypotheses of a
+/// batch are estimated (Kabsch) and scored against every correspondence in
+/// parallel on the point clouds' device. The iteration count is lowered after
+/// each batch from the best inlier ratio and the confidence of \p criteria.
+///
+/// \param source The source point cloud. (Float32 or Float64 type).
+/// \param target The target point cloud. (Float32 or Float64 type).
+/// \param correspondences Int64 tensor of shape {C, 2}, each row a pair of
+/// (source index, target index).
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance, used both for the inlier test and the final evaluation.
+/// \param ransac_n Number of correspondences per hypothesis, at least 3.
+/// \param criteria Convergence criteria.
+/// \param batch_size Number of hypotheses estimated and scored at once.
+/// \return Registration result of the best hypothesis, evaluated against the
+/// full point clouds. Its transformation is identity and fitness is 0 if no
+/// hypothesis has an inlier.
+RegistrationResult RANSACFromCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences,
+        double max_correspondence_distance,
+        int ransac_n = 3,
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria(),
+        int batch_size = 1024);
+
+/// \brief Function for global RANSAC registration based on feature matching.
+/// Each source point is matched to the target point with the nearest feature,
+/// then RANSACFromCorrespondences() is run on the matches.
+///
+/// \param source The source point cloud. (Float32 or Float64 type).
+/// \param target The target point cloud. (Float32 or Float64 type).
+/// \param source_features Source features of shape {N_source, D}, e.g. from
+/// ComputeFPFHFeature().
+/// \param target_features Target features of shape {N_target, D}, of the same
+/// dtype and device as \p source_features.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param mutual_filter If true, only keeps matches that are also the
+/// nearest source feature of their target feature.
+/// \param ransac_n Number of correspondences per hypothesis, at least 3.
+/// \param criteria Convergence criteria.
+/// \param batch_size Number of hypotheses estimated and scored at once.
+RegistrationResult RANSACFromFeatures(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        double max_correspondence_distance,
+        bool mutual_filter = false,
+        int ransac_n = 3,
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria(),
+        int batch_size = 1024);
+
+/// \brief Function for Fast Global Registration [Zhou et al 2016] based on
+/// feature matching, on the device of the point clouds.
+///
+/// Mutual nearest features give the initial matches, which are filtered by
+/// the tuple test in batches of random trials. The graduated non-convexity
+/// iterations then evaluate all correspondences at once with tensor
+/// operations. The parameters have the same meaning as in the legacy
+/// open3d::pipelines::registration::FastGlobalRegistration().
+///
+/// \param source The source point cloud. (Float32 or Float64 type).
+/// \param target The target point cloud. (Float32 or Float64 type).
+/// \param source_features Source features of shape {N_source, D}, e.g. from
+/// ComputeFPFHFeature().
+/// \param target_features Target features of shape {N_target, D}, of the same
+/// dtype and device as \p source_features.
+/// \param option Registration option.
+RegistrationResult FastGlobalRegistrationFromFeatures(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &source_features,
+        const core::Tensor &target_features,
+        const open3d::pipelines::registration::FastGlobalRegistrationOption
+                &option = open3d::pipelines::registration::
+                        FastGlobalRegistrationOption());
 
 /// \brief Computes `Information Matrix`, from the transfromation between source
 /// and target pointcloud. It returns the `Information Matrix` of shape {6, 6},
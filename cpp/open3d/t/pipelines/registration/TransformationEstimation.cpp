@@ -27,6 +27,7 @@
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/t/pipelines/kernel/Registration.h"
 #include "open3d/t/pipelines/kernel/TransformationConverter.h"
 
@@ -317,6 +318,99 @@ core::Tensor TransformationEstimationForColoredICP::ComputeTransformation(
     return transform;
 }
 
+double TransformationEstimationForGeneralizedICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences) const {
+    if (!target.HasPointPositions() || !source.HasPointPositions()) {
+        utility::LogError("Source and/or Target pointcloud is empty.");
+    }
+    if (!target.HasPointAttr("covariances") ||
+        !source.HasPointAttr("covariances")) {
+        utility::LogError(
+                "Source and/or Target pointcloud missing covariances "
+                "attribute.");
+    }
+
+    const core::Dtype dtype = source.GetPointPositions().GetDtype();
+    core::AssertTensorDtype(target.GetPointPositions(), dtype);
+    core::AssertTensorDtype(source.GetPointAttr("covariances"), dtype);
+    core::AssertTensorDtype(target.GetPointAttr("covariances"), dtype);
+    core::AssertTensorDevice(target.GetPointPositions(), source.GetDevice());
+
+    AssertValidCorrespondences(correspondences, source.GetPointPositions());
+
+    core::Tensor valid = correspondences.Ne(-1).Reshape({-1});
+    core::Tensor neighbour_indices =
+            correspondences.IndexGet({valid}).Reshape({-1});
+    const int64_t n = neighbour_indices.GetLength();
+    if (n == 0) {
+        return 0.0;
+    }
+
+    // error = d^T (C_s + C_t)^(-1/2) d, with d = vs - vt. C_s + C_t = U S U^T
+    // is symmetric positive definite, so error = sum_k (U^T d)_k^2 / sqrt(S_k).
+    core::Tensor d = source.GetPointPositions().IndexGet({valid}) -
+                     target.GetPointPositions().IndexGet({neighbour_indices});
+    core::Tensor M =
+            source.GetPointAttr("covariances").IndexGet({valid}) +
+            target.GetPointAttr("covariances").IndexGet({neighbour_indices});
+    core::Tensor U, S, VT;
+    core::BatchedSVD3x3(M, U, S, VT);
+
+    core::Tensor Ut_d = U.Mul(d.Reshape({n, 3, 1})).Sum({1});
+    double error = Ut_d.Mul_(Ut_d)
+                           .Div_(S.Sqrt())
+                           .Sum({0, 1})
+                           .To(core::Float64)
+                           .Item<double>();
+    return std::sqrt(error / static_cast<double>(n));
+}
+
+core::Tensor TransformationEstimationForGeneralizedICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &correspondences) const {
+    if (!target.HasPointPositions() || !source.HasPointPositions()) {
+        utility::LogError("Source and/or Target pointcloud is empty.");
+    }
+    if (!target.HasPointAttr("covariances") ||
+        !source.HasPointAttr("covariances")) {
+        utility::LogError(
+                "Source and/or Target pointcloud missing covariances "
+                "attribute.");
+    }
+
+    core::AssertTensorDtypes(source.GetPointPositions(),
+                             {core::Float64, core::Float32});
+    const core::Dtype dtype = source.GetPointPositions().GetDtype();
+
+    core::AssertTensorDtype(target.GetPointPositions(), dtype);
+    core::AssertTensorDtype(source.GetPointAttr("covariances"), dtype);
+    core::AssertTensorDtype(target.GetPointAttr("covariances"), dtype);
+    core::AssertTensorShape(
+            source.GetPointAttr("covariances"),
+            {source.GetPointPositions().GetLength(), 3, 3});
+    core::AssertTensorShape(
+            target.GetPointAttr("covariances"),
+            {target.GetPointPositions().GetLength(), 3, 3});
+
+    core::AssertTensorDevice(target.GetPointPositions(), source.GetDevice());
+
+    AssertValidCorrespondences(correspondences, source.GetPointPositions());
+
+    // Get pose {6} of type Float64 from correspondences indexed source and
+    // target point cloud.
+    core::Tensor pose = pipelines::kernel::ComputePoseGeneralizedICP(
+            source.GetPointPositions(), target.GetPointPositions(),
+            source.GetPointAttr("covariances"),
+            target.GetPointAttr("covariances"), correspondences,
+            this->kernel_);
+
+    // Get transformation {4,4} of type Float64 from pose {6}.
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
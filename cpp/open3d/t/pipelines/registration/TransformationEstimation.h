@@ -51,6 +51,7 @@ enum class TransformationEstimationType {
     PointToPoint = 1,
     PointToPlane = 2,
     ColoredICP = 3,
+    GeneralizedICP = 4,
 };
 
 /// \class TransformationEstimation
@@ -286,6 +287,86 @@ private:
             TransformationEstimationType::ColoredICP;
 };
 
+/// \class TransformationEstimationForGeneralizedICP
+///
+/// This is implementation of following paper
+/// A. Segal, D. Haehnel, S. Thrun
+/// Generalized-ICP, RSS 2009.
+///
+/// Class to estimate a transformation matrix tensor of shape {4, 4}, dtype
+/// Float64, on CPU device for generalized ICP method.
+class TransformationEstimationForGeneralizedICP
+    : public TransformationEstimation {
+public:
+    ~TransformationEstimationForGeneralizedICP() override{};
+
+    /// \brief Constructor.
+    ///
+    /// \param epsilon Small constant representing covariance along the
+    /// normal, used when the covariances are computed from normals.
+    /// \param kernel (optional) Any of the implemented statistical robust
+    /// kernel for outlier rejection.
+    explicit TransformationEstimationForGeneralizedICP(
+            double epsilon = 1e-3,
+            const RobustKernel &kernel =
+                    RobustKernel(RobustKernelMethod::L2Loss, 1.0, 1.0))
+        : epsilon_(epsilon), kernel_(kernel) {}
+
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+
+public:
+    /// \brief Computes RMSE (double) for GeneralizedICP method, between two
+    /// pointclouds, given correspondences. The error of each correspondence
+    /// is `d^T (C_s + C_t)^(-1/2) d`, where d is the point difference.
+    ///
+    /// \param source Source pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {N, 3, 3} and the same dtype as the
+    /// positions.
+    /// \param target Target pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {M, 3, 3} and the same dtype as the
+    /// positions.
+    /// \param correspondences Tensor of type Int64 containing indices of
+    /// corresponding target points, where the value is the target index and the
+    /// index of the value itself is the source index. It contains -1 as value
+    /// at index with no correspondence.
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const core::Tensor &correspondences) const override;
+
+    /// \brief Estimates the transformation matrix for GeneralizedICP method,
+    /// a tensor of shape {4, 4}, and dtype Float64 on CPU device.
+    ///
+    /// \param source Source pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {N, 3, 3} and the same dtype as the
+    /// positions.
+    /// \param target Target pointcloud. (Float32 or Float64 type). It must
+    /// contain covariances of shape {M, 3, 3} and the same dtype as the
+    /// positions.
+    /// \param correspondences Tensor of type Int64 containing indices of
+    /// corresponding target points, where the value is the target index and the
+    /// index of the value itself is the source index. It contains -1 as value
+    /// at index with no correspondence.
+    /// \return transformation between source to target, a tensor of shape {4,
+    /// 4}, type Float64 on CPU device.
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const core::Tensor &correspondences) const override;
+
+public:
+    /// Covariance along the normal of covariances computed from normals.
+    double epsilon_ = 1e-3;
+    /// RobustKernel for outlier rejection.
+    RobustKernel kernel_ = RobustKernel(RobustKernelMethod::L2Loss, 1.0, 1.0);
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::GeneralizedICP;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
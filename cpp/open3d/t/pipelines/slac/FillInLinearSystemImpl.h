@@ -74,7 +74,8 @@ static void FillInRigidAlignmentTerm(Tensor& AtA,
 void FillInRigidAlignmentTerm(Tensor& AtA,
                               Tensor& Atb,
                               Tensor& residual,
-                              const std::vector<std::string>& fnames,
+                              const std::vector<PointCloud>& tpcds,
+                              const CorrespondenceMap& correspondences,
                               const PoseGraph& pose_graph,
                               const SLACOptimizerParams& params,
                               const SLACDebugOption& debug_option) {
@@ -85,15 +86,14 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
 
-        std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
-                                               params.GetSubfolderName(), i, j);
-        if (!utility::filesystem::FileExists(corres_fname)) {
+        auto corres_it = correspondences.find(std::make_pair(i, j));
+        if (corres_it == correspondences.end()) {
             utility::LogWarning("Correspondence {} {} skipped!", i, j);
             continue;
         }
-        Tensor corres_ij = Tensor::Load(corres_fname).To(device);
-        PointCloud tpcd_i = CreateTPCDFromFile(fnames[i], device);
-        PointCloud tpcd_j = CreateTPCDFromFile(fnames[j], device);
+        Tensor corres_ij = corres_it->second.To(device);
+        const PointCloud& tpcd_i = tpcds[i];
+        const PointCloud& tpcd_j = tpcds[j];
 
         PointCloud tpcd_i_indexed(
                 tpcd_i.GetPointPositions().IndexGet({corres_ij.T()[0]}));
@@ -118,7 +118,10 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
     }
 }
 
-static void FillInSLACAlignmentTerm(Tensor& AtA,
+// Fills in either the dense AtA or the block sparse AtA_blocks, whichever is
+// not null.
+static void FillInSLACAlignmentTerm(Tensor* AtA,
+                                    core::HashMap* AtA_blocks,
                                     Tensor& Atb,
                                     Tensor& residual,
                                     ControlGrid& ctr_grid,
@@ -162,20 +165,30 @@ static void FillInSLACAlignmentTerm(Tensor& AtA,
     Tensor RjT_Ri_Cnormal_ps =
             (Rj.T().Matmul(Ri_Cnormal_ps.T())).T().Contiguous();
 
-    kernel::FillInSLACAlignmentTerm(
-            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
-            RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
-            cgrid_ratio_qs, i, j, n_fragments, threshold);
+    if (AtA_blocks) {
+        kernel::FillInSLACAlignmentTermSparse(
+                *AtA_blocks, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps,
+                Ri_Cnormal_ps, RjT_Ri_Cnormal_ps, cgrid_index_ps,
+                cgrid_index_qs, cgrid_ratio_ps, cgrid_ratio_qs, i, j,
+                n_fragments, threshold);
+    } else {
+        kernel::FillInSLACAlignmentTerm(
+                *AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
+                RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs,
+                cgrid_ratio_ps, cgrid_ratio_qs, i, j, n_fragments, threshold);
+    }
 }
 
-void FillInSLACAlignmentTerm(Tensor& AtA,
-                             Tensor& Atb,
-                             Tensor& residual,
-                             ControlGrid& ctr_grid,
-                             const std::vector<std::string>& fnames,
-                             const PoseGraph& pose_graph,
-                             const SLACOptimizerParams& params,
-                             const SLACDebugOption& debug_option) {
+static void FillInSLACAlignmentTerm(Tensor* AtA,
+                                    core::HashMap* AtA_blocks,
+                                    Tensor& Atb,
+                                    Tensor& residual,
+                                    ControlGrid& ctr_grid,
+                                    const std::vector<PointCloud>& tpcds,
+                                    const CorrespondenceMap& correspondences,
+                                    const PoseGraph& pose_graph,
+                                    const SLACOptimizerParams& params,
+                                    const SLACDebugOption& debug_option) {
     core::Device device(params.device_);
     int n_frags = pose_graph.nodes_.size();
 
@@ -184,16 +197,14 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
 
-        std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
-                                               params.GetSubfolderName(), i, j);
-        if (!utility::filesystem::FileExists(corres_fname)) {
+        auto corres_it = correspondences.find(std::make_pair(i, j));
+        if (corres_it == correspondences.end()) {
             utility::LogWarning("Correspondence {} {} skipped!", i, j);
             continue;
         }
-        Tensor corres_ij = Tensor::Load(corres_fname).To(device);
-
-        PointCloud tpcd_i = CreateTPCDFromFile(fnames[i], device);
-        PointCloud tpcd_j = CreateTPCDFromFile(fnames[j], device);
+        Tensor corres_ij = corres_it->second.To(device);
+        const PointCloud& tpcd_i = tpcds[i];
+        const PointCloud& tpcd_j = tpcds[j];
 
         PointCloud tpcd_i_indexed(
                 tpcd_i.GetPointPositions().IndexGet({corres_ij.T()[0]}));
@@ -218,9 +229,9 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
                            .To(device, core::Float32);
 
         // Fill In.
-        FillInSLACAlignmentTerm(AtA, Atb, residual, ctr_grid, tpcd_param_i,
-                                tpcd_param_j, Ti, Tj, i, j, n_frags,
-                                params.distance_threshold_);
+        FillInSLACAlignmentTerm(AtA, AtA_blocks, Atb, residual, ctr_grid,
+                                tpcd_param_i, tpcd_param_j, Ti, Tj, i, j,
+                                n_frags, params.distance_threshold_);
 
         if (debug_option.debug_ && i >= debug_option.debug_start_node_idx_) {
             VisualizePointCloudCorrespondences(tpcd_i, tpcd_j, corres_ij,
@@ -231,29 +242,87 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
     }
 }
 
-void FillInSLACRegularizerTerm(Tensor& AtA,
-                               Tensor& Atb,
-                               Tensor& residual,
-                               ControlGrid& ctr_grid,
-                               int n_frags,
-                               const SLACOptimizerParams& params,
-                               const SLACDebugOption& debug_option) {
+void FillInSLACAlignmentTerm(Tensor& AtA,
+                             Tensor& Atb,
+                             Tensor& residual,
+                             ControlGrid& ctr_grid,
+                             const std::vector<PointCloud>& tpcds,
+                             const CorrespondenceMap& correspondences,
+                             const PoseGraph& pose_graph,
+                             const SLACOptimizerParams& params,
+                             const SLACDebugOption& debug_option) {
+    FillInSLACAlignmentTerm(&AtA, nullptr, Atb, residual, ctr_grid, tpcds,
+                            correspondences, pose_graph, params, debug_option);
+}
+
+void FillInSLACAlignmentTerm(core::HashMap& AtA_blocks,
+                             Tensor& Atb,
+                             Tensor& residual,
+                             ControlGrid& ctr_grid,
+                             const std::vector<PointCloud>& tpcds,
+                             const CorrespondenceMap& correspondences,
+                             const PoseGraph& pose_graph,
+                             const SLACOptimizerParams& params,
+                             const SLACDebugOption& debug_option) {
+    FillInSLACAlignmentTerm(nullptr, &AtA_blocks, Atb, residual, ctr_grid,
+                            tpcds, correspondences, pose_graph, params,
+                            debug_option);
+}
+
+static void FillInSLACRegularizerTerm(Tensor* AtA,
+                                      core::HashMap* AtA_blocks,
+                                      Tensor& Atb,
+                                      Tensor& residual,
+                                      ControlGrid& ctr_grid,
+                                      int n_frags,
+                                      const SLACOptimizerParams& params,
+                                      const SLACDebugOption& debug_option) {
     Tensor active_buf_indices, nb_buf_indices, nb_masks;
     std::tie(active_buf_indices, nb_buf_indices, nb_masks) =
             ctr_grid.GetNeighborGridMap();
 
     Tensor positions_init = ctr_grid.GetInitPositions();
     Tensor positions_curr = ctr_grid.GetCurrPositions();
-    kernel::FillInSLACRegularizerTerm(AtA, Atb, residual, active_buf_indices,
-                                      nb_buf_indices, nb_masks, positions_init,
-                                      positions_curr,
-                                      n_frags * params.regularizer_weight_,
-                                      n_frags, ctr_grid.GetAnchorIdx());
+    if (AtA_blocks) {
+        kernel::FillInSLACRegularizerTermSparse(
+                *AtA_blocks, Atb, residual, active_buf_indices, nb_buf_indices,
+                nb_masks, positions_init, positions_curr,
+                n_frags * params.regularizer_weight_, n_frags,
+                ctr_grid.GetAnchorIdx());
+    } else {
+        kernel::FillInSLACRegularizerTerm(
+                *AtA, Atb, residual, active_buf_indices, nb_buf_indices,
+                nb_masks, positions_init, positions_curr,
+                n_frags * params.regularizer_weight_, n_frags,
+                ctr_grid.GetAnchorIdx());
+    }
     if (debug_option.debug_) {
         VisualizeGridDeformation(ctr_grid);
     }
 }
 
+void FillInSLACRegularizerTerm(Tensor& AtA,
+                               Tensor& Atb,
+                               Tensor& residual,
+                               ControlGrid& ctr_grid,
+                               int n_frags,
+                               const SLACOptimizerParams& params,
+                               const SLACDebugOption& debug_option) {
+    FillInSLACRegularizerTerm(&AtA, nullptr, Atb, residual, ctr_grid, n_frags,
+                              params, debug_option);
+}
+
+void FillInSLACRegularizerTerm(core::HashMap& AtA_blocks,
+                               Tensor& Atb,
+                               Tensor& residual,
+                               ControlGrid& ctr_grid,
+                               int n_frags,
+                               const SLACOptimizerParams& params,
+                               const SLACDebugOption& debug_option) {
+    FillInSLACRegularizerTerm(nullptr, &AtA_blocks, Atb, residual, ctr_grid,
+                              n_frags, params, debug_option);
+}
+
 }  // namespace slac
 }  // namespace pipelines
 }  // namespace t
@@ -26,12 +26,18 @@
 
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 
+#include <mutex>
+#include <numeric>
+
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/core/linalg/ConjugateGradient.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/t/io/ColumnarIO.h"
 #include "open3d/t/pipelines/slac/FillInLinearSystemImpl.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace t {
@@ -58,7 +64,7 @@ static std::vector<std::string> PreprocessPointClouds(
         fnames_processed.emplace_back(fname_processed);
         if (utility::filesystem::FileExists(fname_processed)) continue;
 
-        auto pcd = io::CreatePointCloudFromFile(fname);
+        auto pcd = open3d::io::CreatePointCloudFromFile(fname);
         if (pcd == nullptr) {
             utility::LogError("Internal error: pcd is nullptr.");
         }
@@ -75,7 +81,7 @@ static std::vector<std::string> PreprocessPointClouds(
             }
         }
 
-        io::WritePointCloud(fname_processed, *pcd);
+        open3d::io::WritePointCloud(fname_processed, *pcd);
         utility::LogInfo("Saving processed point cloud {}", fname_processed);
     }
 
@@ -223,28 +229,42 @@ static core::Tensor GetCorrespondenceSetForPointCloudPair(
     return correspondence_set;
 }
 
-// Read pose graph containing loop closures and odometry to compute
-// correspondences.
-void SaveCorrespondencesForPointClouds(
-        const std::vector<std::string>& fnames_processed,
+// Loads the processed fragments on the device once, so that they are not read
+// again for every edge and iteration.
+static std::vector<PointCloud> LoadPointClouds(
+        const std::vector<std::string>& fnames, const core::Device& device) {
+    std::vector<PointCloud> tpcds(fnames.size());
+    utility::ParallelForRange(
+            int64_t(fnames.size()),
+            [&](int64_t begin, int64_t end) {
+                for (int64_t k = begin; k < end; ++k) {
+                    tpcds[k] = CreateTPCDFromFile(fnames[k], device);
+                }
+            },
+            /*grain_size=*/1);
+    return tpcds;
+}
+
+// Computes the correspondences of the given pose graph edges. Edges are
+// independent, so they are distributed over the threads of the task arena.
+static CorrespondenceMap ComputeCorrespondencesForEdges(
+        const std::vector<PointCloud>& tpcds,
         const PoseGraph& pose_graph,
+        const std::vector<size_t>& edge_indices,
         const SLACOptimizerParams& params,
         const SLACDebugOption& debug_option) {
-    // Enumerate pose graph edges.
-    for (auto& edge : pose_graph.edges_) {
+    CorrespondenceMap correspondences;
+    std::mutex correspondences_mutex;
+
+    auto process_edge = [&](size_t edge_idx) {
+        const auto& edge = pose_graph.edges_[edge_idx];
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
 
         utility::LogInfo("Processing {:02d} -> {:02d}", i, j);
 
-        std::string correspondences_fname = fmt::format(
-                "{}/{:03d}_{:03d}.npy", params.GetSubfolderName(), i, j);
-        if (utility::filesystem::FileExists(correspondences_fname)) continue;
-
-        PointCloud tpcd_i =
-                CreateTPCDFromFile(fnames_processed[i], params.device_);
-        PointCloud tpcd_j =
-                CreateTPCDFromFile(fnames_processed[j], params.device_);
+        PointCloud tpcd_i = tpcds[i];
+        PointCloud tpcd_j = tpcds[j];
 
         // pose of i in model frame.
         core::Tensor T_i = core::eigen_converter::EigenMatrixToTensor(
@@ -263,20 +283,92 @@ void SaveCorrespondencesForPointClouds(
                 debug_option.debug_);
 
         if (correspondence_set.GetLength() > 0) {
-            correspondence_set.Save(correspondences_fname);
-            utility::LogInfo("Saving {} corres for {:02d} -> {:02d}",
-                             correspondence_set.GetLength(), i, j);
+            std::lock_guard<std::mutex> lock(correspondences_mutex);
+            correspondences[std::make_pair(i, j)] = correspondence_set;
+        }
+    };
+
+    // Visualization must stay on the calling thread.
+    if (debug_option.debug_) {
+        for (size_t edge_idx : edge_indices) {
+            process_edge(edge_idx);
         }
+    } else {
+        utility::ParallelForRange(
+                int64_t(edge_indices.size()),
+                [&](int64_t begin, int64_t end) {
+                    for (int64_t k = begin; k < end; ++k) {
+                        process_edge(edge_indices[k]);
+                    }
+                },
+                /*grain_size=*/1);
     }
+    return correspondences;
 }
 
-static void InitializeControlGrid(ControlGrid& ctr_grid,
-                                  const std::vector<std::string>& fnames) {
-    core::Device device(ctr_grid.GetDevice());
-    for (auto& fname : fnames) {
-        utility::LogInfo("Initializing grid for {}", fname);
+static std::vector<size_t> GetAllEdgeIndices(const PoseGraph& pose_graph) {
+    std::vector<size_t> edge_indices(pose_graph.edges_.size());
+    std::iota(edge_indices.begin(), edge_indices.end(), 0);
+    return edge_indices;
+}
+
+CorrespondenceMap ComputeCorrespondencesForPointClouds(
+        const std::vector<std::string>& fnames_processed,
+        const PoseGraph& pose_graph,
+        const SLACOptimizerParams& params,
+        const SLACDebugOption& debug_option) {
+    return ComputeCorrespondencesForEdges(
+            LoadPointClouds(fnames_processed, params.device_), pose_graph,
+            GetAllEdgeIndices(pose_graph), params, debug_option);
+}
+
+// Read pose graph containing loop closures and odometry to compute
+// correspondences.
+void SaveCorrespondencesForPointClouds(
+        const std::vector<std::string>& fnames_processed,
+        const PoseGraph& pose_graph,
+        const SLACOptimizerParams& params,
+        const SLACDebugOption& debug_option) {
+    // All correspondence sets go into one container, so that large pose
+    // graphs do not create one file per edge. Only compute the edges that
+    // are not saved yet.
+    const std::string correspondences_fname = fmt::format(
+            "{}/correspondences.o3dcols", params.GetSubfolderName());
+    CorrespondenceMap saved;
+    if (utility::filesystem::FileExists(correspondences_fname)) {
+        saved = t::io::ReadCorrespondences(correspondences_fname);
+    }
+    std::vector<size_t> edge_indices;
+    for (size_t k = 0; k < pose_graph.edges_.size(); ++k) {
+        const auto& edge = pose_graph.edges_[k];
+        if (saved.count(std::make_pair(edge.source_node_id_,
+                                       edge.target_node_id_)) == 0) {
+            edge_indices.push_back(k);
+        }
+    }
+    if (edge_indices.empty()) {
+        return;
+    }
 
-        auto tpcd = CreateTPCDFromFile(fname, device);
+    CorrespondenceMap correspondences = ComputeCorrespondencesForEdges(
+            LoadPointClouds(fnames_processed, params.device_), pose_graph,
+            edge_indices, params, debug_option);
+    for (const auto& it : correspondences) {
+        utility::LogInfo("Saving {} corres for {:02d} -> {:02d}",
+                         it.second.GetLength(), it.first.first,
+                         it.first.second);
+    }
+    // The saved sets view the mapped file, which is about to be replaced.
+    for (auto& it : saved) {
+        correspondences.emplace(it.first, it.second.Clone());
+    }
+    saved.clear();
+    t::io::WriteCorrespondences(correspondences_fname, correspondences);
+}
+
+static void InitializeControlGrid(ControlGrid& ctr_grid,
+                                  const std::vector<PointCloud>& tpcds) {
+    for (const auto& tpcd : tpcds) {
         ctr_grid.Touch(tpcd);
     }
     utility::LogInfo("Initialization finished.");
@@ -314,6 +406,130 @@ static void UpdateControlGrid(ControlGrid& ctr_grid, core::Tensor& delta) {
     ctr_grid.GetCurrPositions().Slice(0, 0, ctr_grid.Size()) += delta_cgrids;
 }
 
+// Computes A x for the block sparse matrix A given by the block coordinates
+// rows and cols and the (M, 3, 3) blocks, with x in (num_blocks, 3).
+static core::Tensor BlockSparseMatVec(const core::Tensor& rows,
+                                      const core::Tensor& cols,
+                                      const core::Tensor& blocks,
+                                      const core::Tensor& x) {
+    core::Tensor y = core::Tensor::Zeros(x.GetShape(), x.GetDtype(),
+                                         x.GetDevice());
+    core::Tensor products =
+            blocks.Mul(x.IndexGet({cols}).Reshape({-1, 1, 3})).Sum({2});
+    y.IndexAdd_(0, rows, products);
+    return y;
+}
+
+// Solves the block sparse system AtA_blocks x = b with Jacobi preconditioned
+// conjugate gradient. x is (num_params, 1) and holds the initial guess.
+static void SolveBlockSparsePCG(core::HashMap& AtA_blocks,
+                                const core::Tensor& b,
+                                core::Tensor& x,
+                                int max_iterations,
+                                float tolerance) {
+    core::Tensor active_indices = AtA_blocks.GetActiveIndices().To(core::Int64);
+    core::Tensor keys = AtA_blocks.GetKeyTensor()
+                                .IndexGet({active_indices})
+                                .To(core::Int64);
+    core::Tensor rows = keys.Slice(1, 0, 1).Reshape({-1}).Contiguous();
+    core::Tensor cols = keys.Slice(1, 1, 2).Reshape({-1}).Contiguous();
+    core::Tensor blocks = AtA_blocks.GetValueTensor()
+                                  .IndexGet({active_indices})
+                                  .Reshape({-1, 3, 3});
+
+    // Inverse of the diagonal, leaving unconstrained variables unscaled.
+    core::Tensor is_diag = rows.Eq(cols);
+    core::Tensor diag = core::Tensor::Zeros({b.GetLength() / 3, 3},
+                                            core::Float32, b.GetDevice());
+    core::Tensor diag_blocks = blocks.IndexGet({is_diag}).Reshape({-1, 9});
+    diag.IndexAdd_(0, rows.IndexGet({is_diag}),
+                   diag_blocks.Slice(1, 0, 9, 4).Contiguous());
+    core::Tensor inv_diag =
+            core::Tensor::Ones(diag.GetShape(), core::Float32, b.GetDevice())
+                    .Div(diag.Add(diag.Le(0).To(core::Float32)))
+                    .Reshape({-1});
+
+    auto apply_A = [&](const core::Tensor& v) {
+        return BlockSparseMatVec(rows, cols, blocks, v.Reshape({-1, 3}))
+                .Reshape({-1});
+    };
+    auto apply_preconditioner = [&inv_diag](const core::Tensor& r) {
+        return r * inv_diag;
+    };
+    x = core::SolveCG(apply_A, b.Reshape({-1}), x.Reshape({-1}), tolerance,
+                      max_iterations, apply_preconditioner)
+                .Reshape({-1, 1});
+}
+
+// SLAC iterations with the Hessian in 3x3 blocks, see
+// RunSLACOptimizerForFragments. Each solve starts from the previous update.
+static std::pair<PoseGraph, ControlGrid> RunSLACOptimizerSparse(
+        const std::vector<PointCloud>& tpcds,
+        const CorrespondenceMap& correspondences,
+        const PoseGraph& pose_graph,
+        ControlGrid& ctr_grid,
+        int64_t num_params,
+        const SLACOptimizerParams& params,
+        const SLACDebugOption& debug_option) {
+    core::Device device(params.device_);
+    utility::LogInfo("Initializing the block sparse {}^2 Hessian matrix",
+                     num_params);
+
+    // Pose 0 is fixed by its 2 diagonal blocks.
+    core::Tensor anchor_keys =
+            core::Tensor::Init<int>({{0, 0}, {1, 1}}, device);
+    core::Tensor anchor_blocks =
+            core::Tensor::Eye(3, core::Float32, device).Reshape({1, 9});
+
+    core::HashMap AtA_blocks(num_params * 4, core::Int32, {2}, core::Float32,
+                             {9}, device);
+    core::Tensor delta =
+            core::Tensor::Zeros({num_params, 1}, core::Float32, device);
+
+    PoseGraph pose_graph_update(pose_graph);
+    for (int itr = 0; itr < params.max_iterations_; ++itr) {
+        utility::LogInfo("Iteration {}", itr);
+        AtA_blocks.GetValueTensor().Fill(0);
+        core::Tensor Atb =
+                core::Tensor::Zeros({num_params, 1}, core::Float32, device);
+
+        core::Tensor residual_data =
+                core::Tensor::Zeros({1}, core::Float32, device);
+        FillInSLACAlignmentTerm(AtA_blocks, Atb, residual_data, ctr_grid,
+                                tpcds, correspondences, pose_graph_update,
+                                params, debug_option);
+
+        utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
+
+        core::Tensor residual_reg =
+                core::Tensor::Zeros({1}, core::Float32, device);
+        FillInSLACRegularizerTerm(AtA_blocks, Atb, residual_reg, ctr_grid,
+                                  pose_graph_update.nodes_.size(), params,
+                                  debug_option);
+        utility::LogInfo("Regularizer loss = {}",
+                         residual_reg[0].Item<float>());
+
+        core::Tensor anchor_indices, anchor_masks;
+        AtA_blocks.Activate(anchor_keys);
+        std::tie(anchor_indices, anchor_masks) = AtA_blocks.Find(anchor_keys);
+        AtA_blocks.GetValueTensor().IndexAdd_(
+                0, anchor_indices.To(core::Int64),
+                anchor_blocks.Expand({2, 9}).Contiguous());
+
+        SolveBlockSparsePCG(AtA_blocks, Atb.Neg(), delta,
+                            params.pcg_max_iterations_, params.pcg_tolerance_);
+
+        core::Tensor delta_poses =
+                delta.Slice(0, 0, 6 * pose_graph_update.nodes_.size());
+        core::Tensor delta_cgrids = delta.Slice(
+                0, 6 * pose_graph_update.nodes_.size(), delta.GetLength());
+
+        UpdatePoses(pose_graph_update, delta_poses);
+        UpdateControlGrid(ctr_grid, delta_cgrids);
+    }
+    return std::make_pair(pose_graph_update, ctr_grid);
+}
+
 std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
         const std::vector<std::string>& fnames,
         const PoseGraph& pose_graph,
@@ -327,9 +543,11 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
     // First preprocess the point cloud with downsampling and normal
     // estimation.
     auto fnames_down = PreprocessPointClouds(fnames, params);
+    std::vector<PointCloud> tpcds = LoadPointClouds(fnames_down, device);
     // Then obtain the correspondences given the pose graph
-    SaveCorrespondencesForPointClouds(fnames_down, pose_graph, params,
-                                      debug_option);
+    CorrespondenceMap correspondences = ComputeCorrespondencesForEdges(
+            tpcds, pose_graph, GetAllEdgeIndices(pose_graph), params,
+            debug_option);
 
     // First initialize the ctr_grid.
     // grid size = 3.0 / 8: recommended by the original implementation
@@ -337,12 +555,17 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
     // grid count = 8000: empirical value, will be increased dynamically if
     // exceeded.
     ControlGrid ctr_grid(3.0 / 8, 8000, device);
-    InitializeControlGrid(ctr_grid, fnames_down);
+    InitializeControlGrid(ctr_grid, tpcds);
     ctr_grid.Compactify();
 
     // Fill-in
     // fragments x 6 (se3) + control_grids x 3 (R^3)
     int64_t num_params = fnames_down.size() * 6 + ctr_grid.Size() * 3;
+    if (params.use_sparse_solver_) {
+        return RunSLACOptimizerSparse(tpcds, correspondences, pose_graph,
+                                      ctr_grid, num_params, params,
+                                      debug_option);
+    }
     utility::LogInfo("Initializing the {}^2 Hessian matrix", num_params);
 
     PoseGraph pose_graph_update(pose_graph);
@@ -360,8 +583,9 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
 
         core::Tensor residual_data =
                 core::Tensor::Zeros({1}, core::Float32, device);
-        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, fnames_down,
-                                pose_graph_update, params, debug_option);
+        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, tpcds,
+                                correspondences, pose_graph_update, params,
+                                debug_option);
 
         utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
 
@@ -399,9 +623,11 @@ PoseGraph RunRigidOptimizerForFragments(const std::vector<std::string>& fnames,
     // estimation.
     std::vector<std::string> fnames_down =
             PreprocessPointClouds(fnames, params);
+    std::vector<PointCloud> tpcds = LoadPointClouds(fnames_down, device);
     // Then obtain the correspondences given the pose graph
-    SaveCorrespondencesForPointClouds(fnames_down, pose_graph, params,
-                                      debug_option);
+    CorrespondenceMap correspondences = ComputeCorrespondencesForEdges(
+            tpcds, pose_graph, GetAllEdgeIndices(pose_graph), params,
+            debug_option);
 
     // Fill-in
     // fragments x 6 (se3)
@@ -422,7 +648,7 @@ PoseGraph RunRigidOptimizerForFragments(const std::vector<std::string>& fnames,
         AtA.IndexSet({indices_eye0, indices_eye0},
                      1e5 * core::Tensor::Ones({}, core::Float32, device));
 
-        FillInRigidAlignmentTerm(AtA, Atb, residual, fnames_down,
+        FillInRigidAlignmentTerm(AtA, Atb, residual, tpcds, correspondences,
                                  pose_graph_update, params, debug_option);
         utility::LogInfo("Loss = {}", residual[0].Item<float>());
 
@@ -26,7 +26,9 @@
 
 #pragma once
 
+#include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "open3d/pipelines/registration/PoseGraph.h"
@@ -40,6 +42,10 @@ namespace slac {
 
 using PoseGraph = open3d::pipelines::registration::PoseGraph;
 
+/// Map from the (source, target) node indices of a pose graph edge to its
+/// (C, 2) Int64 correspondence set. Rejected edges have no entry.
+using CorrespondenceMap = std::map<std::pair<int, int>, core::Tensor>;
+
 struct SLACOptimizerParams {
     /// Number of iterations.
     int max_iterations_;
@@ -62,6 +68,19 @@ struct SLACOptimizerParams {
 
     /// Relative directory to store SLAC results in the dataset folder.
     std::string slac_folder_ = "";
+
+    /// Assemble the SLAC system as 3x3 blocks in a hash map and solve it with
+    /// preconditioned conjugate gradient, instead of a dense Hessian. Needed
+    /// when the control grid has more than a few thousand points.
+    bool use_sparse_solver_ = false;
+
+    /// Maximum conjugate gradient iterations per SLAC iteration.
+    int pcg_max_iterations_ = 1000;
+
+    /// Conjugate gradient stops when the residual norm drops below this
+    /// fraction of the right hand side norm.
+    float pcg_tolerance_ = 1e-5;
+
     std::string GetSubfolderName() const {
         if (voxel_size_ < 0) {
             return fmt::format("{}/original", slac_folder_);
@@ -82,19 +101,31 @@ struct SLACOptimizerParams {
     /// \param device Device to use. [Default: CPU:0].
     /// \param slac_folder Relative directory to store SLAC results in the
     /// dataset folder. [Default: ""].
+    /// \param use_sparse_solver Use the block sparse PCG solver in
+    /// RunSLACOptimizerForFragments. [Default: false].
+    /// \param pcg_max_iterations Maximum conjugate gradient iterations.
+    /// [Default: 1000].
+    /// \param pcg_tolerance Relative residual to stop conjugate gradient.
+    /// [Default: 1e-5].
     SLACOptimizerParams(const int max_iterations = 5,
                         const float voxel_size = 0.05,
                         const float distance_threshold = 0.07,
                         const float fitness_threshold = 0.3,
                         const float regularizer_weight = 1,
                         const core::Device device = core::Device("CPU:0"),
-                        const std::string slac_folder = "") {
+                        const std::string slac_folder = "",
+                        const bool use_sparse_solver = false,
+                        const int pcg_max_iterations = 1000,
+                        const float pcg_tolerance = 1e-5) {
         if (fitness_threshold < 0) {
             utility::LogError("fitness threshold must be positive.");
         }
         if (distance_threshold < 0) {
             utility::LogError("distance threshold must be positive.");
         }
+        if (pcg_tolerance < 0) {
+            utility::LogError("pcg tolerance must be positive.");
+        }
 
         max_iterations_ = max_iterations;
         voxel_size_ = voxel_size;
@@ -103,6 +134,9 @@ struct SLACOptimizerParams {
         regularizer_weight_ = regularizer_weight;
         device_ = device;
         slac_folder_ = slac_folder;
+        use_sparse_solver_ = use_sparse_solver;
+        pcg_max_iterations_ = pcg_max_iterations;
+        pcg_tolerance_ = pcg_tolerance;
     }
 };
 
@@ -146,6 +180,9 @@ struct SLACDebugOption {
 /// \brief Read pose graph containing loop closures and odometry to compute
 /// putative correspondences between pairs of pointclouds.
 ///
+/// All sets are saved to correspondences.o3dcols in the subfolder of \p params
+/// with t::io::WriteCorrespondences(). Edges already saved there are skipped.
+///
 /// \param fnames_processed Vector of filenames for processed pointcloud
 /// fragments.
 ///  \param fragment_pose_graph Legacy PoseGraph for pointcloud
@@ -158,6 +195,23 @@ void SaveCorrespondencesForPointClouds(
         const SLACOptimizerParams& params = SLACOptimizerParams(),
         const SLACDebugOption& debug_option = SLACDebugOption());
 
+/// \brief Compute the correspondences of all the pose graph edges, like
+/// SaveCorrespondencesForPointClouds, but in parallel over the edges and
+/// without writing them to disk.
+///
+/// \param fnames_processed Vector of filenames for processed pointcloud
+/// fragments.
+/// \param fragment_pose_graph Legacy PoseGraph for pointcloud fragments.
+/// \param params Parameters to tune in finding correspondences.
+/// \param debug_option SLACDebugOption containing the debug options. Edges
+/// are processed one at a time when debugging is enabled.
+/// \return Correspondence sets on params.device_, keyed by edge.
+CorrespondenceMap ComputeCorrespondencesForPointClouds(
+        const std::vector<std::string>& fnames_processed,
+        const PoseGraph& fragment_pose_graph,
+        const SLACOptimizerParams& params = SLACOptimizerParams(),
+        const SLACDebugOption& debug_option = SLACDebugOption());
+
 /// \brief Simultaneous Localization and Calibration: Self-Calibration of
 /// Consumer Depth Cameras, CVPR 2014 Qian-Yi Zhou and Vladlen Koltun
 /// Estimate a shared control grid for all fragments for scene reconstruction,
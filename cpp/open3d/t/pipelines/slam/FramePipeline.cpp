@@ -0,0 +1,338 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/FramePipeline.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "open3d/core/Stream.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+namespace {
+
+/// Frame passed between the stages.
+struct PipelineItem {
+    int frame_id = -1;
+    /// Host images, set by the decode stage.
+    t::geometry::RGBDImage rgbd;
+    /// Device frame, set by the upload stage.
+    std::shared_ptr<Frame> frame;
+    /// Tracked pose, set by the tracking stage.
+    core::Tensor T_frame_to_world;
+};
+
+/// Blocking single producer, single consumer queue with a fixed capacity.
+template <typename T>
+class BoundedQueue {
+public:
+    explicit BoundedQueue(size_t capacity) : capacity_(capacity) {}
+
+    /// Blocks while the queue is full. Returns false if it is closed.
+    bool Push(T item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] {
+            return closed_ || queue_.size() < capacity_;
+        });
+        if (closed_) {
+            return false;
+        }
+        queue_.push_back(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /// Blocks while the queue is empty. Returns false once it is closed and
+    /// drained.
+    bool Pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return closed_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            return false;
+        }
+        item = std::move(queue_.front());
+        queue_.pop_front();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void Close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+private:
+    size_t capacity_;
+    std::deque<T> queue_;
+    bool closed_ = false;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+};
+
+/// Latest ray casted model frame, published by the mapping stage.
+struct ModelFrameSlot {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int frame_id = -1;
+    std::shared_ptr<Frame> frame;
+    core::Tensor T_frame_to_world;
+    bool closed = false;
+};
+
+}  // namespace
+
+FramePipeline::FramePipeline(Model& model,
+                             const core::Tensor& intrinsics,
+                             int height,
+                             int width,
+                             const FramePipelineOption& option)
+    : model_(model),
+      intrinsics_(intrinsics),
+      height_(height),
+      width_(width),
+      option_(option) {
+    if (option.queue_size_ < 1) {
+        utility::LogError("queue_size must be positive, but got {}.",
+                          option.queue_size_);
+    }
+    if (option.max_raycast_lag_ < 0) {
+        utility::LogError("max_raycast_lag must be non-negative, but got {}.",
+                          option.max_raycast_lag_);
+    }
+}
+
+std::vector<core::Tensor> FramePipeline::Run(const FrameSource& source,
+                                             const FrameCallback& callback) {
+    const core::Device device = model_.voxel_grid_.GetHashMap().GetDevice();
+    const int first_frame_id = model_.frame_id_ + 1;
+    const core::Tensor T_init = model_.GetCurrentFramePose().Clone();
+
+    BoundedQueue<PipelineItem> decoded(option_.queue_size_);
+    BoundedQueue<PipelineItem> uploaded(option_.queue_size_);
+    BoundedQueue<PipelineItem> tracked(option_.queue_size_);
+    ModelFrameSlot slot;
+
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto stop_all = [&]() {
+        decoded.Close();
+        uploaded.Close();
+        tracked.Close();
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            slot.closed = true;
+        }
+        slot.cv.notify_all();
+    };
+    auto fail = [&](std::exception_ptr e) {
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = e;
+            }
+        }
+        failed = true;
+        stop_all();
+    };
+
+    // Accumulated time per stage in ms, each written by its stage only.
+    double decode_ms = 0, upload_ms = 0, tracking_ms = 0, mapping_ms = 0;
+
+    // Each stage synchronizes its stream before handing a frame over, so that
+    // consumers on other streams never read unfinished device data.
+    std::vector<std::thread> threads;
+    threads.emplace_back([&]() {
+        try {
+            int frame_id = first_frame_id;
+            while (!failed) {
+                utility::Timer timer;
+                timer.Start();
+                PipelineItem item;
+                if (!source(item.rgbd)) {
+                    break;
+                }
+                item.frame_id = frame_id++;
+                timer.Stop();
+                decode_ms += timer.GetDuration();
+                if (!decoded.Push(std::move(item))) {
+                    break;
+                }
+            }
+            decoded.Close();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    });
+
+    threads.emplace_back([&]() {
+        try {
+            core::Stream upload_stream(device);
+            core::ScopedStream scoped_stream(upload_stream);
+            PipelineItem item;
+            while (!failed && decoded.Pop(item)) {
+                utility::Timer timer;
+                timer.Start();
+                item.frame = std::make_shared<Frame>(height_, width_,
+                                                     intrinsics_, device);
+                item.frame->SetDataFromImage("depth", item.rgbd.depth_);
+                item.frame->SetDataFromImage("color", item.rgbd.color_);
+                item.rgbd = t::geometry::RGBDImage();
+                upload_stream.Synchronize();
+                timer.Stop();
+                upload_ms += timer.GetDuration();
+                if (!uploaded.Push(std::move(item))) {
+                    break;
+                }
+            }
+            uploaded.Close();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    });
+
+    threads.emplace_back([&]() {
+        try {
+            core::Stream tracking_stream(device);
+            core::ScopedStream scoped_stream(tracking_stream);
+            PipelineItem item;
+            while (!failed && uploaded.Pop(item)) {
+                if (item.frame_id == first_frame_id) {
+                    item.T_frame_to_world = T_init;
+                } else {
+                    // Wait for a model frame recent enough.
+                    const int min_frame_id =
+                            item.frame_id - 1 - option_.max_raycast_lag_;
+                    std::shared_ptr<Frame> model_frame;
+                    core::Tensor T_model_to_world;
+                    {
+                        std::unique_lock<std::mutex> lock(slot.mutex);
+                        slot.cv.wait(lock, [&] {
+                            return slot.closed || slot.frame_id >= min_frame_id;
+                        });
+                        if (slot.frame_id < min_frame_id) {
+                            break;
+                        }
+                        model_frame = slot.frame;
+                        T_model_to_world = slot.T_frame_to_world;
+                    }
+
+                    utility::Timer timer;
+                    timer.Start();
+                    odometry::OdometryResult result = model_.TrackFrameToModel(
+                            *item.frame, *model_frame, option_.depth_scale_,
+                            option_.depth_max_, option_.depth_diff_);
+                    item.T_frame_to_world =
+                            T_model_to_world.Matmul(result.transformation_);
+                    tracking_stream.Synchronize();
+                    timer.Stop();
+                    tracking_ms += timer.GetDuration();
+                }
+                if (!tracked.Push(std::move(item))) {
+                    break;
+                }
+            }
+            tracked.Close();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    });
+
+    std::vector<core::Tensor> poses;
+    try {
+        core::Stream mapping_stream(device);
+        core::ScopedStream scoped_stream(mapping_stream);
+        PipelineItem item;
+        while (!failed && tracked.Pop(item)) {
+            utility::Timer timer;
+            timer.Start();
+            model_.UpdateFramePose(item.frame_id, item.T_frame_to_world);
+            model_.Integrate(*item.frame, option_.depth_scale_,
+                             option_.depth_max_);
+            model_.UpdateLoopClosure();
+
+            auto model_frame = std::make_shared<Frame>(height_, width_,
+                                                       intrinsics_, device);
+            model_.SynthesizeModelFrame(*model_frame, option_.depth_scale_,
+                                        option_.depth_min_, option_.depth_max_,
+                                        /*enable_color=*/false);
+            mapping_stream.Synchronize();
+            {
+                std::lock_guard<std::mutex> lock(slot.mutex);
+                slot.frame_id = item.frame_id;
+                slot.frame = model_frame;
+                slot.T_frame_to_world = model_.GetCurrentFramePose();
+            }
+            slot.cv.notify_all();
+            timer.Stop();
+            mapping_ms += timer.GetDuration();
+
+            poses.push_back(item.T_frame_to_world);
+            if (callback) {
+                callback(item.frame_id, item.T_frame_to_world);
+            }
+        }
+    } catch (...) {
+        fail(std::current_exception());
+    }
+
+    stop_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    if (!poses.empty()) {
+        const double n = double(poses.size());
+        utility::LogDebug(
+                "FramePipeline: {} frames, per frame decode {:.2f} ms, upload "
+                "{:.2f} ms, tracking {:.2f} ms, mapping {:.2f} ms.",
+                poses.size(), decode_ms / n, upload_ms / n, tracking_ms / n,
+                mapping_ms / n);
+    }
+    return poses;
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
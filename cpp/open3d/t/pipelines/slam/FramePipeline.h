@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/pipelines/slam/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+/// Parameters of FramePipeline.
+class FramePipelineOption {
+public:
+    /// \param queue_size Capacity of the queue between two stages. Producers
+    /// block when it is full, which bounds memory and latency.
+    /// \param max_raycast_lag Number of frames the model frame used to track a
+    /// frame may lag behind. 0 tracks frame i against the model after
+    /// integrating frame i - 1, like the serial loop. Larger values let
+    /// tracking run concurrently with integration and ray casting.
+    /// \param depth_scale Scale factor to convert raw depth into meters.
+    /// \param depth_min Depth where ray casting starts from.
+    /// \param depth_max Depth truncation of integration and ray casting.
+    /// \param depth_diff Depth difference threshold of tracking.
+    FramePipelineOption(int queue_size = 2,
+                        int max_raycast_lag = 0,
+                        float depth_scale = 1000.0f,
+                        float depth_min = 0.1f,
+                        float depth_max = 3.0f,
+                        float depth_diff = 0.07f)
+        : queue_size_(queue_size),
+          max_raycast_lag_(max_raycast_lag),
+          depth_scale_(depth_scale),
+          depth_min_(depth_min),
+          depth_max_(depth_max),
+          depth_diff_(depth_diff) {}
+
+public:
+    int queue_size_;
+    int max_raycast_lag_;
+    float depth_scale_;
+    float depth_min_;
+    float depth_max_;
+    float depth_diff_;
+};
+
+/// \class FramePipeline
+///
+/// \brief Drives a Model over a sequence of RGBD frames with overlapping
+/// stages, so that throughput is bounded by the slowest stage rather than by
+/// the sum of all stages:
+///
+/// 1. decode: calls the frame source, e.g. reading and decoding images;
+/// 2. upload: copies the frame to the model device;
+/// 3. tracking: tracks the frame against the latest model frame;
+/// 4. mapping: integrates the frame, optionally applies loop closure, and ray
+///    casts the model frame used to track the next frames.
+///
+/// Each stage runs on its own thread and, on CUDA, on its own stream. Stages
+/// exchange frames through bounded queues, and a stage synchronizes its stream
+/// before handing a frame over. The mapping stage runs on the calling thread
+/// and is the only one accessing the voxel grid of the model.
+class FramePipeline {
+public:
+    /// Reads the next frame into \p rgbd on the host. Returns false at the end
+    /// of the sequence.
+    using FrameSource = std::function<bool(t::geometry::RGBDImage& rgbd)>;
+    /// Called by the mapping stage after integrating each frame.
+    using FrameCallback = std::function<void(
+            int frame_id, const core::Tensor& T_frame_to_world)>;
+
+    /// \param model Model to track against and integrate into. The first frame
+    /// is placed at its current pose.
+    /// \param intrinsics (3, 3) intrinsic matrix of the frames.
+    /// \param height Height of the frames.
+    /// \param width Width of the frames.
+    /// \param option Pipeline parameters.
+    FramePipeline(Model& model,
+                  const core::Tensor& intrinsics,
+                  int height,
+                  int width,
+                  const FramePipelineOption& option = FramePipelineOption());
+
+    /// \brief Processes all the frames of \p source.
+    ///
+    /// An exception thrown in any stage stops all the stages and is rethrown.
+    /// \param source Frame source called from the decode thread.
+    /// \param callback Optional callback called from the calling thread.
+    /// \return (4, 4) Float64 frame to world poses on CPU, one per frame, as
+    /// tracked.
+    std::vector<core::Tensor> Run(const FrameSource& source,
+                                  const FrameCallback& callback = nullptr);
+
+private:
+    Model& model_;
+    core::Tensor intrinsics_;
+    int height_;
+    int width_;
+    FramePipelineOption option_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,347 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slam/LoopClosure.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/pipelines/registration/Feature.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+namespace legacy_registration = open3d::pipelines::registration;
+
+/// Mean pools a (rows, cols) Float32 image in cells, then normalizes the
+/// pooled values to zero mean and unit length.
+static core::Tensor PoolAndNormalize(const core::Tensor& image,
+                                     int cell_size) {
+    const int64_t rows = image.GetShape(0) / cell_size;
+    const int64_t cols = image.GetShape(1) / cell_size;
+    if (rows == 0 || cols == 0) {
+        utility::LogError("Image of size {} is smaller than cell size {}.",
+                          image.GetShape(), cell_size);
+    }
+
+    core::Tensor pooled = image.Slice(0, 0, rows * cell_size)
+                                  .Slice(1, 0, cols * cell_size)
+                                  .Contiguous()
+                                  .Reshape({rows, cell_size, cols, cell_size})
+                                  .Mean({1, 3})
+                                  .Reshape({rows * cols})
+                                  .To(core::Device("CPU:0"));
+    pooled = pooled - pooled.Mean({0});
+    const float norm = pooled.Mul(pooled).Sum({0}).Sqrt().Item<float>();
+    return norm > 0 ? pooled / norm : pooled;
+}
+
+core::Tensor ComputeKeyframeDescriptor(const core::Tensor& depth,
+                                       const core::Tensor& color,
+                                       int cell_size) {
+    if (cell_size < 1) {
+        utility::LogError("cell_size must be positive, but got {}.",
+                          cell_size);
+    }
+
+    core::Tensor depth_f = depth.To(core::Float32).Reshape(
+            {depth.GetShape(0), depth.GetShape(1)});
+    // Invalid depth is pooled as 0, like missing measurements in raw depth.
+    depth_f.SetItem(core::TensorKey::IndexTensor(depth_f.IsNan()),
+                    core::Tensor::Zeros({}, core::Float32, depth.GetDevice()));
+    core::Tensor intensity = color.To(core::Float32).Mean({2});
+
+    // Both halves have unit length, so the dot product is in [-1, 1].
+    return core::Concatenate({PoolAndNormalize(depth_f, cell_size),
+                              PoolAndNormalize(intensity, cell_size)}) /
+           std::sqrt(2.0f);
+}
+
+int KeyframeDatabase::Add(const Keyframe& keyframe) {
+    if (keyframe.descriptor_.NumDims() != 1) {
+        utility::LogError("Keyframe descriptor must be a 1D tensor.");
+    }
+    core::Tensor descriptor = keyframe.descriptor_.Reshape(
+            {1, keyframe.descriptor_.GetLength()});
+    descriptors_ = descriptors_.NumElements() > 0
+                           ? core::Concatenate({descriptors_, descriptor})
+                           : descriptor.Clone();
+    keyframes_.push_back(keyframe);
+    return int(keyframes_.size()) - 1;
+}
+
+std::vector<int> KeyframeDatabase::Query(const core::Tensor& descriptor,
+                                         int max_id,
+                                         int k,
+                                         double min_similarity) const {
+    std::vector<int> result;
+    const int64_t n = std::min<int64_t>(max_id + 1, Size());
+    if (n <= 0 || k <= 0) {
+        return result;
+    }
+
+    core::Tensor similarities =
+            descriptors_.Slice(0, 0, n)
+                    .Matmul(descriptor.Reshape({descriptor.GetLength(), 1}))
+                    .Reshape({n});
+    std::vector<float> values = similarities.ToFlatVector<float>();
+
+    for (int64_t i = 0; i < n; ++i) {
+        if (values[i] >= min_similarity) {
+            result.push_back(int(i));
+        }
+    }
+    std::sort(result.begin(), result.end(),
+              [&](int a, int b) { return values[a] > values[b]; });
+    if (int(result.size()) > k) {
+        result.resize(k);
+    }
+    return result;
+}
+
+LoopClosure::LoopClosure(const LoopClosureOption& option) : option_(option) {
+    if (option.keyframe_interval_ < 1) {
+        utility::LogError("keyframe_interval must be positive, but got {}.",
+                          option.keyframe_interval_);
+    }
+    worker_ = std::thread{&LoopClosure::Run, this};
+}
+
+LoopClosure::~LoopClosure() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+}
+
+void LoopClosure::AddKeyframe(const Keyframe& keyframe) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(keyframe);
+    }
+    cv_.notify_all();
+}
+
+bool LoopClosure::PollCorrection(std::vector<core::Tensor>& keyframe_poses) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!has_correction_) {
+        return false;
+    }
+    keyframe_poses = std::move(corrected_poses_);
+    corrected_poses_.clear();
+    has_correction_ = false;
+    return true;
+}
+
+void LoopClosure::WaitUntilIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return queue_.empty() && !busy_; });
+}
+
+int LoopClosure::GetNumLoopClosures() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_loop_closures_;
+}
+
+void LoopClosure::Run() {
+    while (true) {
+        Keyframe keyframe;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (stop_) {
+                return;
+            }
+            keyframe = std::move(queue_.front());
+            queue_.pop_front();
+            busy_ = true;
+        }
+
+        try {
+            ProcessKeyframe(keyframe);
+        } catch (const std::exception& e) {
+            utility::LogWarning("Loop closure failed on frame {}: {}",
+                                keyframe.frame_id_, e.what());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            busy_ = false;
+        }
+        cv_.notify_all();
+    }
+}
+
+void LoopClosure::ProcessKeyframe(Keyframe& keyframe) {
+    keyframe.descriptor_ = ComputeKeyframeDescriptor(
+            keyframe.depth_, keyframe.color_, option_.descriptor_cell_size_);
+    const int id = database_.Add(keyframe);
+
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::CreateFromRGBDImage(
+            t::geometry::RGBDImage(keyframe.color_, keyframe.depth_),
+            keyframe.intrinsics_,
+            core::Tensor::Eye(4, core::Float32, core::Device("CPU:0")),
+            keyframe.depth_scale_, keyframe.depth_max_);
+    pcd = pcd.VoxelDownSample(option_.voxel_size_);
+    pcd.EstimateNormals(30, 2 * option_.voxel_size_);
+    pcds_.push_back(pcd);
+    features_.push_back(core::Tensor());
+
+    // Chain the new node to the previous one with the tracked odometry, so
+    // that it follows the corrections of the previous optimizations.
+    const Eigen::Matrix4d T_prev_to_frame =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    keyframe.T_prev_to_frame_);
+    if (id == 0) {
+        pose_graph_.nodes_.push_back(legacy_registration::PoseGraphNode(
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        keyframe.T_frame_to_world_)));
+    } else {
+        const Eigen::Matrix4d pose =
+                pose_graph_.nodes_.back().pose_ * T_prev_to_frame.inverse();
+        pose_graph_.nodes_.push_back(legacy_registration::PoseGraphNode(pose));
+
+        Eigen::Matrix6d information = Eigen::Matrix6d::Identity();
+        if (pcds_[id - 1].GetPointPositions().GetLength() > 0 &&
+            pcd.GetPointPositions().GetLength() > 0) {
+            information = core::eigen_converter::TensorToEigenMatrixXd(
+                    registration::GetInformationMatrix(
+                            pcds_[id - 1], pcd,
+                            option_.max_correspondence_distance_,
+                            keyframe.T_prev_to_frame_));
+        }
+        pose_graph_.edges_.push_back(legacy_registration::PoseGraphEdge(
+                id - 1, id, T_prev_to_frame, information, false));
+    }
+
+    const std::vector<int> candidates = database_.Query(
+            keyframe.descriptor_, id - option_.min_keyframe_gap_,
+            option_.num_candidates_, option_.min_similarity_);
+    bool closed = false;
+    for (int candidate : candidates) {
+        Eigen::Matrix4d transformation;
+        Eigen::Matrix6d information;
+        if (VerifyLoopClosure(id, candidate, transformation, information)) {
+            pose_graph_.edges_.push_back(legacy_registration::PoseGraphEdge(
+                    id, candidate, transformation, information, true));
+            utility::LogDebug("Loop closure between frames {} and {}.",
+                              keyframe.frame_id_,
+                              database_.Get(candidate).frame_id_);
+            closed = true;
+        }
+    }
+    if (!closed) {
+        return;
+    }
+
+    legacy_registration::GlobalOptimizationOption option(
+            option_.max_correspondence_distance_, 0.25, 1.0, 0);
+    legacy_registration::GlobalOptimization(
+            pose_graph_,
+            legacy_registration::GlobalOptimizationLevenbergMarquardt(),
+            legacy_registration::GlobalOptimizationConvergenceCriteria(),
+            option);
+
+    std::vector<core::Tensor> poses;
+    poses.reserve(pose_graph_.nodes_.size());
+    for (const auto& node : pose_graph_.nodes_) {
+        poses.push_back(core::eigen_converter::EigenMatrixToTensor(
+                Eigen::Matrix4d(node.pose_)));
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        corrected_poses_ = std::move(poses);
+        has_correction_ = true;
+        ++num_loop_closures_;
+    }
+}
+
+bool LoopClosure::VerifyLoopClosure(int source_id,
+                                    int target_id,
+                                    Eigen::Matrix4d& transformation,
+                                    Eigen::Matrix6d& information) {
+    const t::geometry::PointCloud& source = pcds_[source_id];
+    const t::geometry::PointCloud& target = pcds_[target_id];
+    if (source.GetPointPositions().GetLength() < 3 ||
+        target.GetPointPositions().GetLength() < 3) {
+        return false;
+    }
+
+    const double max_distance = option_.max_correspondence_distance_;
+    const Eigen::Matrix4d init = pose_graph_.nodes_[target_id].pose_.inverse() *
+                                 pose_graph_.nodes_[source_id].pose_;
+
+    // Refine the current estimate first; drift is usually small enough.
+    registration::RegistrationResult result = registration::ICP(
+            source, target, max_distance,
+            core::eigen_converter::EigenMatrixToTensor(init),
+            registration::TransformationEstimationPointToPlane());
+    if (result.fitness_ < option_.min_fitness_) {
+        // Global registration from features, computed once per keyframe.
+        for (int id : {source_id, target_id}) {
+            if (features_[id].NumElements() == 0) {
+                features_[id] = registration::ComputeFPFHFeature(
+                        pcds_[id], 100, 5 * option_.voxel_size_);
+            }
+        }
+        registration::RegistrationResult global_result =
+                registration::RANSACFromFeatures(
+                        source, target, features_[source_id],
+                        features_[target_id], 1.5 * option_.voxel_size_,
+                        /*mutual_filter=*/true);
+        if (global_result.fitness_ <= 0) {
+            return false;
+        }
+        result = registration::ICP(
+                source, target, max_distance, global_result.transformation_,
+                registration::TransformationEstimationPointToPlane());
+    }
+    if (result.fitness_ < option_.min_fitness_) {
+        return false;
+    }
+
+    transformation = core::eigen_converter::TensorToEigenMatrixXd(
+            result.transformation_);
+    information = core::eigen_converter::TensorToEigenMatrixXd(
+            registration::GetInformationMatrix(source, target, max_distance,
+                                               result.transformation_));
+    return true;
+}
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
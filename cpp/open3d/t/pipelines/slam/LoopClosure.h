@@ -0,0 +1,215 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slam {
+
+/// Parameters of the loop closure of a Model.
+class LoopClosureOption {
+public:
+    /// \param keyframe_interval A keyframe is taken every keyframe_interval
+    /// integrated frames.
+    /// \param min_keyframe_gap Loop candidates of a keyframe are searched among
+    /// the keyframes at least min_keyframe_gap keyframes older.
+    /// \param num_candidates Number of most similar candidates verified per
+    /// keyframe.
+    /// \param min_similarity Minimum cosine similarity of the global
+    /// descriptors of a candidate.
+    /// \param voxel_size Voxel size of the point clouds used in verification.
+    /// \param max_correspondence_distance Maximum correspondence distance in
+    /// RANSAC, ICP and pose graph optimization.
+    /// \param min_fitness Minimum ICP fitness of an accepted loop closure.
+    /// \param descriptor_cell_size Cell size in pixels of the global
+    /// descriptor.
+    LoopClosureOption(int keyframe_interval = 10,
+                      int min_keyframe_gap = 10,
+                      int num_candidates = 3,
+                      double min_similarity = 0.8,
+                      double voxel_size = 0.05,
+                      double max_correspondence_distance = 0.07,
+                      double min_fitness = 0.3,
+                      int descriptor_cell_size = 32)
+        : keyframe_interval_(keyframe_interval),
+          min_keyframe_gap_(min_keyframe_gap),
+          num_candidates_(num_candidates),
+          min_similarity_(min_similarity),
+          voxel_size_(voxel_size),
+          max_correspondence_distance_(max_correspondence_distance),
+          min_fitness_(min_fitness),
+          descriptor_cell_size_(descriptor_cell_size) {}
+
+public:
+    int keyframe_interval_;
+    int min_keyframe_gap_;
+    int num_candidates_;
+    double min_similarity_;
+    double voxel_size_;
+    double max_correspondence_distance_;
+    double min_fitness_;
+    int descriptor_cell_size_;
+};
+
+/// Keyframe kept for loop closure and re-integration.
+class Keyframe {
+public:
+    int frame_id_ = -1;
+    /// Raw depth and color images as integrated, and (3, 3) intrinsics.
+    core::Tensor depth_;
+    core::Tensor color_;
+    core::Tensor intrinsics_;
+    float depth_scale_ = 1000.0f;
+    float depth_max_ = 3.0f;
+    /// (4, 4) Float64 pose on CPU.
+    core::Tensor T_frame_to_world_;
+    /// (4, 4) Float64 transformation on CPU from the previous keyframe to
+    /// this one, as tracked. Identity for the first keyframe.
+    core::Tensor T_prev_to_frame_;
+    /// (N, 3) Int32 coordinates of the voxel blocks the keyframe was
+    /// integrated into, maintained by Model.
+    core::Tensor block_coords_;
+    /// (D,) Float32 global descriptor on CPU, computed by LoopClosure.
+    core::Tensor descriptor_;
+};
+
+/// \brief Computes a global descriptor for place recognition: the depth and
+/// the intensity images are mean pooled in cells of cell_size x cell_size
+/// pixels, and each half is normalized to zero mean and unit length, so that
+/// the dot product of two descriptors is their cosine similarity.
+///
+/// \param depth (rows, cols, 1) depth image, UInt16 or Float32.
+/// \param color (rows, cols, 3) color image, UInt8 or Float32.
+/// \param cell_size Pooling cell size in pixels.
+/// \return (D,) Float32 descriptor on CPU.
+core::Tensor ComputeKeyframeDescriptor(const core::Tensor& depth,
+                                       const core::Tensor& color,
+                                       int cell_size = 32);
+
+/// Keyframes and their stacked global descriptors for place recognition.
+class KeyframeDatabase {
+public:
+    /// Adds a keyframe with a descriptor and returns its id.
+    int Add(const Keyframe& keyframe);
+
+    /// Returns the ids of at most \p k keyframes with id <= \p max_id and a
+    /// cosine similarity to \p descriptor of at least \p min_similarity, most
+    /// similar first.
+    std::vector<int> Query(const core::Tensor& descriptor,
+                           int max_id,
+                           int k,
+                           double min_similarity) const;
+
+    int Size() const { return int(keyframes_.size()); }
+    const Keyframe& Get(int id) const { return keyframes_.at(id); }
+
+private:
+    std::vector<Keyframe> keyframes_;
+    /// (N, D) Float32 descriptors on CPU.
+    core::Tensor descriptors_;
+};
+
+/// \class LoopClosure
+///
+/// \brief Loop closure running on a background thread. Keyframes are queued
+/// by the tracking thread and processed in order: the keyframe is added to
+/// the pose graph with its tracked odometry edge, similar older keyframes are
+/// retrieved from the keyframe database, and each candidate is verified by
+/// ICP from the current pose estimate, falling back to FPFH + RANSAC. Every
+/// accepted loop adds an uncertain edge and triggers a pose graph
+/// optimization, whose keyframe poses are published for the tracking thread
+/// to apply.
+class LoopClosure {
+public:
+    explicit LoopClosure(const LoopClosureOption& option = LoopClosureOption());
+    ~LoopClosure();
+
+    /// Queues a keyframe and returns immediately.
+    void AddKeyframe(const Keyframe& keyframe);
+
+    /// \brief Takes the latest optimized keyframe poses, if a loop was closed
+    /// since the last call.
+    ///
+    /// \param keyframe_poses Filled with one (4, 4) Float64 pose per keyframe
+    /// processed before the optimization, in keyframe order.
+    /// \return True if new poses were taken.
+    bool PollCorrection(std::vector<core::Tensor>& keyframe_poses);
+
+    /// Blocks until all the queued keyframes are processed.
+    void WaitUntilIdle();
+
+    /// Number of accepted loop closures.
+    int GetNumLoopClosures() const;
+
+    const LoopClosureOption& GetOption() const { return option_; }
+
+private:
+    void Run();
+    void ProcessKeyframe(Keyframe& keyframe);
+    bool VerifyLoopClosure(int source_id,
+                           int target_id,
+                           Eigen::Matrix4d& transformation,
+                           Eigen::Matrix6d& information);
+
+private:
+    LoopClosureOption option_;
+
+    // Accessed by the worker thread only.
+    KeyframeDatabase database_;
+    std::vector<t::geometry::PointCloud> pcds_;
+    std::vector<core::Tensor> features_;
+    open3d::pipelines::registration::PoseGraph pose_graph_;
+
+    // Shared with the tracking thread, guarded by mutex_.
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Keyframe> queue_;
+    bool busy_ = false;
+    bool stop_ = false;
+    bool has_correction_ = false;
+    std::vector<core::Tensor> corrected_poses_;
+    int num_loop_closures_ = 0;
+
+    std::thread worker_;
+};
+
+}  // namespace slam
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,13 +26,18 @@
 
 #include "open3d/t/pipelines/slam/Model.h"
 
+#include <cstring>
+
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 #include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/utility/Profiler.h"
 
 namespace open3d {
 namespace t {
@@ -59,6 +64,7 @@ void Model::SynthesizeModelFrame(Frame& raycast_frame,
                                  float depth_min,
                                  float depth_max,
                                  bool enable_color) {
+    OPEN3D_PROFILE_ZONE("pipelines", "Model::SynthesizeModelFrame");
     auto result = voxel_grid_.RayCast(
             frustum_block_coords_, raycast_frame.GetIntrinsics(),
             t::geometry::InverseTransformation(GetCurrentFramePose()),
@@ -77,29 +83,115 @@ void Model::SynthesizeModelFrame(Frame& raycast_frame,
     }
 }
 
+/// Bit pattern of \p value, to store parameters in a graph signature.
+static int64_t ToSignatureEntry(double value) {
+    int64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
 odometry::OdometryResult Model::TrackFrameToModel(const Frame& input_frame,
                                                   const Frame& raycast_frame,
                                                   float depth_scale,
                                                   float depth_max,
                                                   float depth_diff) {
+    OPEN3D_PROFILE_ZONE("pipelines", "Model::TrackFrameToModel");
     const static core::Tensor identity =
             core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    const std::vector<odometry::OdometryConvergenceCriteria> criteria{6, 3, 1};
+    const odometry::OdometryLossParams params(depth_diff);
 
-    // TODO: more customized / optimized
+    const core::Tensor input_depth = input_frame.GetData("depth");
+    const core::Tensor raycast_depth = raycast_frame.GetData("depth");
+    const core::Device device = input_depth.GetDevice();
+    if (!graph_capture_ || device.GetType() != core::Device::DeviceType::CUDA) {
+        // TODO: more customized / optimized
+        return odometry::RGBDOdometryMultiScale(
+                t::geometry::RGBDImage(input_frame.GetDataAsImage("color"),
+                                       input_frame.GetDataAsImage("depth")),
+                t::geometry::RGBDImage(raycast_frame.GetDataAsImage("color"),
+                                       raycast_frame.GetDataAsImage("depth")),
+                raycast_frame.GetIntrinsics(), identity, depth_scale, depth_max,
+                criteria, odometry::Method::PointToPlane, params);
+    }
+
+    // Building the pyramids launches dozens of small kernels with the same
+    // shapes on every frame. Everything they depend on goes into the
+    // signature of the graph.
+    const core::Tensor intrinsics = raycast_frame.GetIntrinsics().To(
+            core::Device("CPU:0"), core::Float64, /*copy=*/true);
+    core::SizeVector signature{
+            device.GetID(),
+            static_cast<int64_t>(input_depth.GetDtype().GetDtypeCode()),
+            input_depth.GetDtype().ByteSize(),
+            static_cast<int64_t>(raycast_depth.GetDtype().GetDtypeCode()),
+            raycast_depth.GetDtype().ByteSize(),
+            ToSignatureEntry(depth_scale),
+            ToSignatureEntry(depth_max),
+            ToSignatureEntry(depth_diff)};
+    for (int64_t size : input_depth.GetShape()) {
+        signature.push_back(size);
+    }
+    for (int64_t size : raycast_depth.GetShape()) {
+        signature.push_back(size);
+    }
+    const double* intrinsics_ptr = intrinsics.GetDataPtr<double>();
+    for (int64_t i = 0; i < 9; ++i) {
+        signature.push_back(ToSignatureEntry(intrinsics_ptr[i]));
+    }
+
+    if (!track_graph_ || track_graph_->NeedsCapture(signature)) {
+        track_graph_ = std::make_shared<core::Graph>(device);
+        track_input_depth_ = core::Tensor::EmptyLike(input_depth);
+        track_raycast_depth_ = core::Tensor::EmptyLike(raycast_depth);
+        // PointToPlane odometry does not read the color images.
+        const t::geometry::Image no_color;
+        try {
+            track_graph_->Capture(signature, [&]() {
+                track_input_frame_ = std::make_shared<odometry::OdometryFrame>(
+                        t::geometry::RGBDImage(
+                                no_color,
+                                t::geometry::Image(track_input_depth_)),
+                        intrinsics, depth_scale, depth_max,
+                        int64_t(criteria.size()),
+                        odometry::Method::PointToPlane, params,
+                        /*as_target=*/false);
+                track_raycast_frame_ =
+                        std::make_shared<odometry::OdometryFrame>(
+                                t::geometry::RGBDImage(
+                                        no_color,
+                                        t::geometry::Image(
+                                                track_raycast_depth_)),
+                                intrinsics, depth_scale, depth_max,
+                                int64_t(criteria.size()),
+                                odometry::Method::PointToPlane, params,
+                                /*as_target=*/true);
+            });
+        } catch (const std::runtime_error& e) {
+            utility::LogWarning(
+                    "Falling back to uncaptured tracking, as the odometry "
+                    "pyramids cannot be captured: {}",
+                    e.what());
+            SetGraphCapture(false);
+            track_input_frame_.reset();
+            track_raycast_frame_.reset();
+            return TrackFrameToModel(input_frame, raycast_frame, depth_scale,
+                                     depth_max, depth_diff);
+        }
+    }
+
+    track_input_depth_.CopyFrom(input_depth);
+    track_raycast_depth_.CopyFrom(raycast_depth);
+    track_graph_->Replay();
     return odometry::RGBDOdometryMultiScale(
-            t::geometry::RGBDImage(input_frame.GetDataAsImage("color"),
-                                   input_frame.GetDataAsImage("depth")),
-            t::geometry::RGBDImage(raycast_frame.GetDataAsImage("color"),
-                                   raycast_frame.GetDataAsImage("depth")),
-            raycast_frame.GetIntrinsics(), identity, depth_scale, depth_max,
-            std::vector<odometry::OdometryConvergenceCriteria>{6, 3, 1},
-            odometry::Method::PointToPlane,
-            odometry::OdometryLossParams(depth_diff));
+            *track_input_frame_, *track_raycast_frame_, identity, criteria,
+            params);
 }
 
 void Model::Integrate(const Frame& input_frame,
                       float depth_scale,
                       float depth_max) {
+    OPEN3D_PROFILE_ZONE("pipelines", "Model::Integrate");
     t::geometry::Image depth = input_frame.GetDataAsImage("depth");
     t::geometry::Image color = input_frame.GetDataAsImage("color");
     core::Tensor intrinsic = input_frame.GetIntrinsics();
@@ -109,6 +201,28 @@ void Model::Integrate(const Frame& input_frame,
             depth, intrinsic, extrinsic, depth_scale, depth_max);
     voxel_grid_.Integrate(frustum_block_coords_, depth, color, intrinsic,
                           extrinsic);
+
+    if (loop_closure_ &&
+        frame_id_ % loop_closure_->GetOption().keyframe_interval_ == 0) {
+        // Copies, as the caller may reuse the frame buffers.
+        Keyframe keyframe;
+        keyframe.frame_id_ = frame_id_;
+        keyframe.depth_ = depth.AsTensor().Clone();
+        keyframe.color_ = color.AsTensor().Clone();
+        keyframe.intrinsics_ = intrinsic.Clone();
+        keyframe.depth_scale_ = depth_scale;
+        keyframe.depth_max_ = depth_max;
+        keyframe.T_frame_to_world_ = GetCurrentFramePose().Clone();
+        keyframe.T_prev_to_frame_ =
+                keyframes_.empty()
+                        ? core::Tensor::Eye(4, core::Float64,
+                                            core::Device("CPU:0"))
+                        : extrinsic.Matmul(
+                                  keyframes_.back().T_frame_to_world_);
+        keyframe.block_coords_ = frustum_block_coords_;
+        keyframes_.push_back(keyframe);
+        loop_closure_->AddKeyframe(keyframe);
+    }
 }
 
 t::geometry::PointCloud Model::ExtractPointCloud(int estimated_number,
@@ -123,6 +237,77 @@ t::geometry::TriangleMesh Model::ExtractTriangleMesh(int estimated_number,
 
 core::HashMap Model::GetHashMap() { return voxel_grid_.GetHashMap(); }
 
+void Model::EnableLoopClosure(const LoopClosureOption& option) {
+    loop_closure_ = std::make_shared<LoopClosure>(option);
+    keyframes_.clear();
+}
+
+bool Model::UpdateLoopClosure() {
+    std::vector<core::Tensor> poses;
+    if (!loop_closure_ || !loop_closure_->PollCorrection(poses) ||
+        poses.empty()) {
+        return false;
+    }
+
+    // Keyframes queued after the optimization, and the current frame, follow
+    // the last optimized keyframe.
+    const size_t n = std::min(poses.size(), keyframes_.size());
+    const core::Tensor T_correction = poses[n - 1].Matmul(
+            t::geometry::InverseTransformation(
+                    keyframes_[n - 1].T_frame_to_world_));
+    T_frame_to_world_ = T_correction.Matmul(T_frame_to_world_).Contiguous();
+
+    std::vector<bool> moved(keyframes_.size(), false);
+    std::vector<core::Tensor> stale_block_coords;
+    for (size_t i = 0; i < keyframes_.size(); ++i) {
+        Keyframe& keyframe = keyframes_[i];
+        core::Tensor pose = i < n ? poses[i]
+                                  : T_correction.Matmul(
+                                            keyframe.T_frame_to_world_);
+        if (!pose.AllClose(keyframe.T_frame_to_world_, 0, 1e-4)) {
+            moved[i] = true;
+            keyframe.T_frame_to_world_ = pose.Contiguous();
+            stale_block_coords.push_back(keyframe.block_coords_);
+        }
+    }
+    if (stale_block_coords.empty()) {
+        return true;
+    }
+
+    core::Tensor block_coords = core::Concatenate(stale_block_coords);
+    core::HashSet stale_blocks(block_coords.GetLength(), core::Int32, {3},
+                               block_coords.GetDevice());
+    core::Tensor buf_indices, masks;
+    std::tie(buf_indices, masks) = stale_blocks.Insert(block_coords);
+    voxel_grid_.EraseBlocks(block_coords.IndexGet({masks}));
+
+    // Re-integrate the moved keyframes, and the other keyframes that observed
+    // the erased blocks.
+    int count = 0;
+    for (size_t i = 0; i < keyframes_.size(); ++i) {
+        Keyframe& keyframe = keyframes_[i];
+        const bool observed_stale =
+                stale_blocks.Find(keyframe.block_coords_).second.Any();
+        if (!moved[i] && !observed_stale) {
+            continue;
+        }
+        t::geometry::Image depth(keyframe.depth_);
+        t::geometry::Image color(keyframe.color_);
+        core::Tensor extrinsic =
+                t::geometry::InverseTransformation(keyframe.T_frame_to_world_);
+        keyframe.block_coords_ = voxel_grid_.GetUniqueBlockCoordinates(
+                depth, keyframe.intrinsics_, extrinsic, keyframe.depth_scale_,
+                keyframe.depth_max_);
+        voxel_grid_.Integrate(keyframe.block_coords_, depth, color,
+                              keyframe.intrinsics_, extrinsic,
+                              keyframe.depth_scale_, keyframe.depth_max_);
+        ++count;
+    }
+    utility::LogDebug("Loop closure: re-integrated {} of {} keyframes.", count,
+                      keyframes_.size());
+    return true;
+}
+
 }  // namespace slam
 }  // namespace pipelines
 }  // namespace t
@@ -26,12 +26,14 @@
 
 #pragma once
 
+#include "open3d/core/Graph.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 #include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/LoopClosure.h"
 
 namespace open3d {
 namespace t {
@@ -117,6 +119,38 @@ public:
     /// Get block hashmap int the TSDFVoxelGrid.
     core::HashMap GetHashMap();
 
+    /// Starts loop closure on a background thread. From then on, Integrate
+    /// takes a keyframe every option.keyframe_interval_ frames and queues it
+    /// for place recognition and verification, without waiting for it.
+    void EnableLoopClosure(
+            const LoopClosureOption& option = LoopClosureOption());
+
+    /// Applies the keyframe poses of the latest closed loop, if any. The voxel
+    /// blocks observed by the keyframes whose pose changed are erased, and the
+    /// keyframes observing them are re-integrated with their corrected poses.
+    /// The current frame pose follows the correction of the last optimized
+    /// keyframe. Call it between frames of the tracking loop.
+    /// \return True if a correction was applied.
+    bool UpdateLoopClosure();
+
+    /// Enables or disables the graph capture in TrackFrameToModel, which is
+    /// enabled by default. On CUDA devices, the odometry pyramids of both
+    /// frames are recorded once into a core::Graph and replayed on every
+    /// frame, which removes the launch overhead of their kernels.
+    void SetGraphCapture(bool enable) {
+        graph_capture_ = enable;
+        if (!enable) {
+            track_graph_.reset();
+        }
+    }
+
+    /// Returns the number of times the odometry pyramids have been captured.
+    /// A re-capture happens when the frame size, the depth dtype, the
+    /// intrinsics or the tracking parameters change.
+    int64_t GetNumGraphCaptures() const {
+        return track_graph_ ? track_graph_->GetNumCaptures() : 0;
+    }
+
 public:
     /// Maintained volumetric map.
     t::geometry::VoxelBlockGrid voxel_grid_;
@@ -127,6 +161,20 @@ public:
     core::Tensor T_frame_to_world_;
 
     int frame_id_ = -1;
+
+    /// Keyframes taken for loop closure, with their corrected poses.
+    std::vector<Keyframe> keyframes_;
+    std::shared_ptr<LoopClosure> loop_closure_;
+
+private:
+    bool graph_capture_ = true;
+    /// Records the odometry pyramids of TrackFrameToModel, which read the
+    /// depth images from the fixed buffers below.
+    std::shared_ptr<core::Graph> track_graph_;
+    core::Tensor track_input_depth_;
+    core::Tensor track_raycast_depth_;
+    std::shared_ptr<odometry::OdometryFrame> track_input_frame_;
+    std::shared_ptr<odometry::OdometryFrame> track_raycast_frame_;
 };
 }  // namespace slam
 }  // namespace pipelines
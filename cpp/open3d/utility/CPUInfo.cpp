@@ -51,6 +51,8 @@ namespace utility {
 struct CPUInfo::Impl {
     int num_cores_;
     int num_threads_;
+    /// Logical CPU ids of each NUMA node, indexed by node id.
+    std::vector<std::vector<int>> numa_node_cpus_;
 };
 
 /// Returns the number of physical CPU cores.
@@ -132,9 +134,60 @@ static int PhysicalConcurrency() {
     }
 }  // namespace utility
 
+/// Parses a Linux cpulist string, e.g. "0-3,8,10-11".
+static std::vector<int> ParseCPUList(std::string cpu_list) {
+    std::vector<int> cpus;
+    for (const std::string& token :
+         utility::SplitString(utility::StripString(cpu_list), ",")) {
+        std::vector<std::string> bounds = utility::SplitString(token, "-");
+        if (bounds.size() == 1) {
+            cpus.push_back(std::stoi(bounds[0]));
+        } else if (bounds.size() == 2) {
+            for (int cpu = std::stoi(bounds[0]); cpu <= std::stoi(bounds[1]);
+                 ++cpu) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+/// Returns the logical CPU ids of each NUMA node.
+static std::vector<std::vector<int>> NumaTopology(int num_threads) {
+    std::vector<std::vector<int>> node_cpus;
+#ifdef __linux__
+    try {
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string line;
+        if (std::getline(online, line)) {
+            for (int node : ParseCPUList(line)) {
+                std::ifstream cpulist("/sys/devices/system/node/node" +
+                                      std::to_string(node) + "/cpulist");
+                std::string cpus;
+                std::getline(cpulist, cpus);
+                if (node >= static_cast<int>(node_cpus.size())) {
+                    node_cpus.resize(node + 1);
+                }
+                node_cpus[node] = ParseCPUList(cpus);
+            }
+        }
+    } catch (...) {
+        node_cpus.clear();
+    }
+#endif
+    if (node_cpus.empty()) {
+        node_cpus.emplace_back();
+        for (int cpu = 0; cpu < num_threads; ++cpu) {
+            node_cpus[0].push_back(cpu);
+        }
+    }
+    return node_cpus;
+}
+
 CPUInfo::CPUInfo() : impl_(new CPUInfo::Impl()) {
     impl_->num_cores_ = PhysicalConcurrency();
     impl_->num_threads_ = std::thread::hardware_concurrency();
+    impl_->numa_node_cpus_ = NumaTopology(impl_->num_threads_);
 }
 
 CPUInfo& CPUInfo::GetInstance() {
@@ -146,9 +199,32 @@ int CPUInfo::NumCores() const { return impl_->num_cores_; }
 
 int CPUInfo::NumThreads() const { return impl_->num_threads_; }
 
+int CPUInfo::NumNumaNodes() const {
+    return static_cast<int>(impl_->numa_node_cpus_.size());
+}
+
+const std::vector<int>& CPUInfo::NumaNodeCPUs(int node) const {
+    if (node < 0 || node >= NumNumaNodes()) {
+        utility::LogError("Invalid NUMA node {}, the system has {} node(s).",
+                          node, NumNumaNodes());
+    }
+    return impl_->numa_node_cpus_[node];
+}
+
+int CPUInfo::NumaNodeOfCPU(int cpu) const {
+    for (int node = 0; node < NumNumaNodes(); ++node) {
+        for (int node_cpu : impl_->numa_node_cpus_[node]) {
+            if (node_cpu == cpu) {
+                return node;
+            }
+        }
+    }
+    return 0;
+}
+
 void CPUInfo::Print() const {
-    utility::LogInfo("CPUInfo: {} cores, {} threads.", NumCores(),
-                     NumThreads());
+    utility::LogInfo("CPUInfo: {} cores, {} threads, {} NUMA node(s).",
+                     NumCores(), NumThreads(), NumNumaNodes());
 }
 
 }  // namespace utility
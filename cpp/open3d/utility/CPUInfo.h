@@ -26,6 +26,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 namespace open3d {
 namespace utility {
@@ -48,6 +49,17 @@ public:
     /// boost::thread::hardware_concurrency().
     int NumThreads() const;
 
+    /// Returns the number of NUMA nodes. Systems that do not expose a NUMA
+    /// topology are reported as a single node containing all logical cores.
+    int NumNumaNodes() const;
+
+    /// Returns the logical CPU ids that belong to NUMA node \p node. The list
+    /// is empty for memory-only nodes.
+    const std::vector<int>& NumaNodeCPUs(int node) const;
+
+    /// Returns the NUMA node of logical CPU \p cpu, or 0 if unknown.
+    int NumaNodeOfCPU(int cpu) const;
+
     /// Prints CPUInfo in the console.
     void Print() const;
 
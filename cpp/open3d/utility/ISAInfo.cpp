@@ -30,6 +30,7 @@
 #include "ISAInfo_ispc.h"
 #endif
 
+#include "open3d/Macro.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -37,6 +38,7 @@ namespace utility {
 
 struct ISAInfo::Impl {
     ISATarget target_;
+    ISATarget cpu_dispatch_target_;
 };
 
 static ISATarget GetSelectedISATarget() {
@@ -49,7 +51,23 @@ static ISATarget GetSelectedISATarget() {
 #endif
 }
 
-static std::string ToString(ISATarget target) {
+// Mirrors the selection of the target_clones resolver of OPEN3D_CPU_DISPATCH.
+static ISATarget GetCPUDispatchTarget() {
+#ifdef OPEN3D_CPU_DISPATCH_ENABLED
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return ISATarget::AVX512SKX;
+    } else if (__builtin_cpu_supports("avx2")) {
+        return ISATarget::AVX2;
+    } else {
+        return ISATarget::SSE2;
+    }
+#else
+    return ISATarget::DISABLED;
+#endif
+}
+
+std::string ToString(ISATarget target) {
     switch (target) {
         /* x86 */
         case ISATarget::SSE2:
@@ -85,6 +103,7 @@ static std::string ToString(ISATarget target) {
 
 ISAInfo::ISAInfo() : impl_(new ISAInfo::Impl()) {
     impl_->target_ = GetSelectedISATarget();
+    impl_->cpu_dispatch_target_ = GetCPUDispatchTarget();
 }
 
 ISAInfo& ISAInfo::GetInstance() {
@@ -94,9 +113,15 @@ ISAInfo& ISAInfo::GetInstance() {
 
 ISATarget ISAInfo::SelectedTarget() const { return impl_->target_; }
 
+ISATarget ISAInfo::CPUDispatchTarget() const {
+    return impl_->cpu_dispatch_target_;
+}
+
 void ISAInfo::Print() const {
     utility::LogInfo("ISAInfo: {} instruction set used in ISPC code.",
                      ToString(SelectedTarget()));
+    utility::LogInfo("ISAInfo: {} instruction set used in C++ CPU kernels.",
+                     ToString(CPUDispatchTarget()));
 }
 
 }  // namespace utility
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 namespace open3d {
 namespace utility {
@@ -49,6 +50,9 @@ enum class ISATarget {
     DISABLED = -100
 };
 
+/// Returns the name of \p target, e.g. "AVX2".
+std::string ToString(ISATarget target);
+
 /// \brief ISA information.
 ///
 /// This provides information about kernel code written in ISPC.
@@ -63,6 +67,11 @@ public:
     /// Returns the dispatched ISA target that will be used in kernel code.
     ISATarget SelectedTarget() const;
 
+    /// Returns the ISA target used by the C++ CPU kernels compiled with
+    /// OPEN3D_CPU_DISPATCH, or ISATarget::DISABLED if they are compiled for
+    /// the baseline ISA only. AVX512SKX denotes the AVX-512F version.
+    ISATarget CPUDispatchTarget() const;
+
     /// Prints ISAInfo in the console.
     void Print() const;
 
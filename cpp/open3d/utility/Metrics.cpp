@@ -0,0 +1,267 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Metrics.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+const char *TypeName(MetricType type) {
+    switch (type) {
+        case MetricType::Counter:
+            return "counter";
+        case MetricType::Gauge:
+            return "gauge";
+        case MetricType::Histogram:
+            return "histogram";
+    }
+    return "untyped";
+}
+
+std::string EscapeLabelValue(const std::string &value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (char c : value) {
+        if (c == '\\' || c == '"') {
+            escaped += '\\';
+            escaped += c;
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string FormatValue(double value) {
+    if (value == double(int64_t(value))) {
+        return std::to_string(int64_t(value));
+    }
+    return fmt::format("{}", value);
+}
+
+}  // namespace
+
+void Gauge::Add(double value) {
+    double current = value_.load(std::memory_order_relaxed);
+    while (!value_.compare_exchange_weak(current, current + value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+Histogram::Histogram(const std::vector<double> &bounds)
+    : bounds_(bounds), counts_(new std::atomic<int64_t>[bounds.size() + 1]) {
+    if (!std::is_sorted(bounds_.begin(), bounds_.end())) {
+        LogError("Histogram bucket bounds must be sorted.");
+    }
+    for (size_t i = 0; i <= bounds_.size(); ++i) {
+        counts_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void Histogram::Observe(double value) {
+    const size_t bucket =
+            std::lower_bound(bounds_.begin(), bounds_.end(), value) -
+            bounds_.begin();
+    counts_[bucket].fetch_add(1, std::memory_order_relaxed);
+    sum_.Add(value);
+}
+
+std::vector<int64_t> Histogram::GetBucketCounts() const {
+    std::vector<int64_t> counts(bounds_.size() + 1);
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] = counts_[i].load(std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+int64_t Histogram::GetCount() const {
+    const std::vector<int64_t> counts = GetBucketCounts();
+    return std::accumulate(counts.begin(), counts.end(), int64_t(0));
+}
+
+double Histogram::GetSum() const { return sum_.Get(); }
+
+MetricsRegistry &MetricsRegistry::GetInstance() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+MetricsRegistry::Family &MetricsRegistry::GetFamily(const std::string &name,
+                                                    const std::string &help,
+                                                    MetricType type) {
+    auto it = families_.find(name);
+    if (it == families_.end()) {
+        it = families_.emplace(name, Family()).first;
+        it->second.help = help;
+        it->second.type = type;
+    } else if (it->second.type != type) {
+        LogError("Metric {} is already registered as a {}.", name,
+                 TypeName(it->second.type));
+    }
+    return it->second;
+}
+
+Counter &MetricsRegistry::GetCounter(const std::string &name,
+                                     const std::string &help,
+                                     const MetricLabels &labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &counter =
+            GetFamily(name, help, MetricType::Counter).counters[labels];
+    if (!counter) {
+        counter.reset(new Counter());
+    }
+    return *counter;
+}
+
+Gauge &MetricsRegistry::GetGauge(const std::string &name,
+                                 const std::string &help,
+                                 const MetricLabels &labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &gauge = GetFamily(name, help, MetricType::Gauge).gauges[labels];
+    if (!gauge) {
+        gauge.reset(new Gauge());
+    }
+    return *gauge;
+}
+
+Histogram &MetricsRegistry::GetHistogram(const std::string &name,
+                                         const std::string &help,
+                                         const std::vector<double> &bounds,
+                                         const MetricLabels &labels) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &histogram =
+            GetFamily(name, help, MetricType::Histogram).histograms[labels];
+    if (!histogram) {
+        histogram.reset(new Histogram(bounds));
+    }
+    return *histogram;
+}
+
+int MetricsRegistry::AddCollector(Collector collector) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    collectors_.emplace(next_collector_id_, std::move(collector));
+    return next_collector_id_++;
+}
+
+void MetricsRegistry::RemoveCollector(int id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    collectors_.erase(id);
+}
+
+std::vector<MetricFamily> MetricsRegistry::Collect() const {
+    std::vector<MetricFamily> families;
+    std::vector<Collector> collectors;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto &kv : families_) {
+            const Family &family = kv.second;
+            MetricFamily out;
+            out.name = kv.first;
+            out.help = family.help;
+            out.type = family.type;
+            for (const auto &counter : family.counters) {
+                out.samples.push_back({kv.first, counter.first,
+                                       double(counter.second->Get())});
+            }
+            for (const auto &gauge : family.gauges) {
+                out.samples.push_back(
+                        {kv.first, gauge.first, gauge.second->Get()});
+            }
+            for (const auto &histogram : family.histograms) {
+                const Histogram &h = *histogram.second;
+                const std::vector<int64_t> counts = h.GetBucketCounts();
+                int64_t cumulative = 0;
+                for (size_t i = 0; i < counts.size(); ++i) {
+                    cumulative += counts[i];
+                    MetricLabels labels = histogram.first;
+                    labels["le"] = i < h.GetBounds().size()
+                                           ? FormatValue(h.GetBounds()[i])
+                                           : "+Inf";
+                    out.samples.push_back(
+                            {kv.first + "_bucket", labels, double(cumulative)});
+                }
+                out.samples.push_back(
+                        {kv.first + "_sum", histogram.first, h.GetSum()});
+                out.samples.push_back({kv.first + "_count", histogram.first,
+                                       double(cumulative)});
+            }
+            families.push_back(std::move(out));
+        }
+        for (const auto &kv : collectors_) {
+            collectors.push_back(kv.second);
+        }
+    }
+    // Collectors may be slow or use the registry themselves, so they run
+    // without holding the lock.
+    for (const auto &collector : collectors) {
+        collector(families);
+    }
+    std::stable_sort(families.begin(), families.end(),
+                     [](const MetricFamily &a, const MetricFamily &b) {
+                         return a.name < b.name;
+                     });
+    return families;
+}
+
+std::string MetricsRegistry::ToPrometheusText() const {
+    std::ostringstream out;
+    for (const MetricFamily &family : Collect()) {
+        if (!family.help.empty()) {
+            out << "# HELP " << family.name << " " << family.help << "\n";
+        }
+        out << "# TYPE " << family.name << " " << TypeName(family.type)
+            << "\n";
+        for (const MetricSample &sample : family.samples) {
+            out << sample.name;
+            if (!sample.labels.empty()) {
+                out << "{";
+                bool first = true;
+                for (const auto &label : sample.labels) {
+                    out << (first ? "" : ",") << label.first << "=\""
+                        << EscapeLabelValue(label.second) << "\"";
+                    first = false;
+                }
+                out << "}";
+            }
+            out << " " << FormatValue(sample.value) << "\n";
+        }
+    }
+    return out.str();
+}
+
+}  // namespace utility
+}  // namespace open3d
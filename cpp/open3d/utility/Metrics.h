@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// Label names and values of a metric, e.g. {{"device", "CUDA:0"}}.
+using MetricLabels = std::map<std::string, std::string>;
+
+/// \class Counter
+///
+/// \brief Monotonically increasing value, e.g. a number of events.
+class Counter {
+public:
+    void Increment(int64_t value = 1) {
+        value_.fetch_add(value, std::memory_order_relaxed);
+    }
+    int64_t Get() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+/// \class Gauge
+///
+/// \brief Value that can go up and down, e.g. a number of bytes in use.
+class Gauge {
+public:
+    void Set(double value) { value_.store(value, std::memory_order_relaxed); }
+    void Add(double value);
+    double Get() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<double> value_{0.0};
+};
+
+/// \class Histogram
+///
+/// \brief Distribution of observed values over fixed buckets.
+class Histogram {
+public:
+    /// \param bounds Sorted upper bounds of the buckets. A last bucket
+    /// without upper bound is added implicitly.
+    explicit Histogram(const std::vector<double> &bounds);
+
+    void Observe(double value);
+
+    const std::vector<double> &GetBounds() const { return bounds_; }
+    /// Number of observations per bucket, including the implicit last one.
+    std::vector<int64_t> GetBucketCounts() const;
+    int64_t GetCount() const;
+    double GetSum() const;
+
+private:
+    std::vector<double> bounds_;
+    std::unique_ptr<std::atomic<int64_t>[]> counts_;
+    Gauge sum_;
+};
+
+enum class MetricType { Counter, Gauge, Histogram };
+
+/// A single value of a metric family, in the Prometheus data model.
+/// Histograms are expanded into <name>_bucket samples with an "le" label and
+/// <name>_sum and <name>_count samples.
+struct MetricSample {
+    std::string name;
+    MetricLabels labels;
+    double value = 0.0;
+};
+
+/// All samples of a metric name.
+struct MetricFamily {
+    std::string name;
+    std::string help;
+    MetricType type = MetricType::Gauge;
+    std::vector<MetricSample> samples;
+};
+
+/// \class MetricsRegistry
+///
+/// \brief Process wide registry of counters, gauges and histograms.
+///
+/// Metrics are either updated by the instrumented code (GetCounter(),
+/// GetGauge(), GetHistogram()) or computed on demand by collectors, which
+/// are called by Collect() and suit values that are cheaper to read when
+/// asked for, such as memory statistics. Collect() is the pull API;
+/// ToPrometheusText() formats its result in the Prometheus text exposition
+/// format.
+class MetricsRegistry {
+public:
+    using Collector = std::function<void(std::vector<MetricFamily> &)>;
+
+    static MetricsRegistry &GetInstance();
+
+    MetricsRegistry(const MetricsRegistry &) = delete;
+    MetricsRegistry &operator=(const MetricsRegistry &) = delete;
+
+    /// Returns the counter \p name with \p labels, creating it if needed.
+    /// The reference stays valid for the lifetime of the program.
+    Counter &GetCounter(const std::string &name,
+                        const std::string &help,
+                        const MetricLabels &labels = {});
+    Gauge &GetGauge(const std::string &name,
+                    const std::string &help,
+                    const MetricLabels &labels = {});
+    /// \p bounds is only used when the histogram is created.
+    Histogram &GetHistogram(const std::string &name,
+                            const std::string &help,
+                            const std::vector<double> &bounds,
+                            const MetricLabels &labels = {});
+
+    /// Adds a collector that appends metric families on Collect(). Returns
+    /// an id for RemoveCollector().
+    int AddCollector(Collector collector);
+    void RemoveCollector(int id);
+
+    /// Returns the current value of all metrics, sorted by name.
+    std::vector<MetricFamily> Collect() const;
+
+    /// Returns Collect() in the Prometheus text exposition format.
+    std::string ToPrometheusText() const;
+
+private:
+    MetricsRegistry() = default;
+
+    struct Family {
+        std::string help;
+        MetricType type;
+        std::map<MetricLabels, std::unique_ptr<Counter>> counters;
+        std::map<MetricLabels, std::unique_ptr<Gauge>> gauges;
+        std::map<MetricLabels, std::unique_ptr<Histogram>> histograms;
+    };
+    Family &GetFamily(const std::string &name,
+                      const std::string &help,
+                      MetricType type);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family> families_;
+    std::map<int, Collector> collectors_;
+    int next_collector_id_ = 0;
+};
+
+}  // namespace utility
+}  // namespace open3d
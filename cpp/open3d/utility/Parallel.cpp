@@ -29,9 +29,22 @@
 #ifdef _OPENMP
 #include <omp.h>
 #endif
+#ifdef __linux__
+#include <sched.h>
+#endif
+#include <tbb/blocked_range.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "open3d/utility/CPUInfo.h"
 #include "open3d/utility/Logging.h"
@@ -47,7 +60,11 @@ static std::string GetEnvVar(const std::string& name) {
     }
 }
 
-int EstimateMaxThreads() {
+/// Thread limit set by SetMaxThreads(), or 0 if not set.
+static std::atomic<int> max_threads_limit(0);
+
+/// EstimateMaxThreads() without the SetMaxThreads() limit.
+static int DefaultMaxThreads() {
 #ifdef _OPENMP
     if (!GetEnvVar("OMP_NUM_THREADS").empty() ||
         !GetEnvVar("OMP_DYNAMIC").empty()) {
@@ -64,8 +81,37 @@ int EstimateMaxThreads() {
 #endif
 }
 
+int EstimateMaxThreads() {
+    const int limit = max_threads_limit.load();
+    return limit > 0 ? limit : DefaultMaxThreads();
+}
+
+void SetMaxThreads(int num_threads) {
+    static std::mutex mutex;
+    static std::unique_ptr<tbb::global_control> arena_limit;
+    std::lock_guard<std::mutex> lock(mutex);
+    max_threads_limit = std::max(num_threads, 0);
+    arena_limit.reset();
+    if (num_threads > 0) {
+        arena_limit.reset(new tbb::global_control(
+                tbb::global_control::max_allowed_parallelism,
+                size_t(num_threads)));
+    }
+}
+
+static std::atomic<bool> deterministic(false);
+
+void SetDeterministic(bool enabled) { deterministic = enabled; }
+
+bool IsDeterministic() { return deterministic.load(); }
+
+/// Number of ParallelForRange() range bodies active on the calling thread.
+static thread_local int parallel_for_range_depth = 0;
+
 bool InParallel() {
-    // TODO: when we add TBB/Parallel STL support to ParallelFor, update this.
+    if (parallel_for_range_depth > 0) {
+        return true;
+    }
 #ifdef _OPENMP
     return omp_in_parallel();
 #else
@@ -73,5 +119,162 @@ bool InParallel() {
 #endif
 }
 
+static std::atomic<ThreadAffinity> thread_affinity(ThreadAffinity::None);
+/// Incremented on every SetThreadAffinity() call so that threads notice the
+/// change the next time they run a range body.
+static std::atomic<int> thread_affinity_generation(0);
+static thread_local int applied_thread_affinity_generation = 0;
+
+#ifdef __linux__
+static thread_local bool has_saved_affinity_mask = false;
+static thread_local cpu_set_t saved_affinity_mask;
+
+/// Returns the CPUs the process may run on, ordered for \p affinity.
+static std::vector<int> GetAffinityCPUs(ThreadAffinity affinity) {
+    static const cpu_set_t process_mask = []() {
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        if (sched_getaffinity(0, sizeof(mask), &mask) != 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                CPU_SET(cpu, &mask);
+            }
+        }
+        return mask;
+    }();
+
+    const CPUInfo& cpu_info = CPUInfo::GetInstance();
+    std::vector<std::vector<int>> node_cpus;
+    for (int node = 0; node < cpu_info.NumNumaNodes(); ++node) {
+        std::vector<int> cpus;
+        for (int cpu : cpu_info.NumaNodeCPUs(node)) {
+            if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &process_mask)) {
+                cpus.push_back(cpu);
+            }
+        }
+        if (!cpus.empty()) {
+            node_cpus.push_back(cpus);
+        }
+    }
+
+    std::vector<int> ordered_cpus;
+    if (affinity == ThreadAffinity::Compact) {
+        for (const std::vector<int>& cpus : node_cpus) {
+            ordered_cpus.insert(ordered_cpus.end(), cpus.begin(), cpus.end());
+        }
+    } else if (affinity == ThreadAffinity::Scatter) {
+        for (size_t i = 0; !node_cpus.empty(); ++i) {
+            bool any = false;
+            for (const std::vector<int>& cpus : node_cpus) {
+                if (i < cpus.size()) {
+                    ordered_cpus.push_back(cpus[i]);
+                    any = true;
+                }
+            }
+            if (!any) break;
+        }
+    }
+    return ordered_cpus;
+}
+#endif
+
+/// Pins the calling arena thread according to the current affinity policy if
+/// the policy changed since the thread last ran a range body.
+static void UpdateThreadAffinity() {
+    // Slot 0 is reserved for the thread calling ParallelForRange(). It is left
+    // unpinned, since the threads it creates later would inherit its mask.
+    const int slot = tbb::this_task_arena::current_thread_index();
+    if (slot <= 0) {
+        return;
+    }
+    const int generation = thread_affinity_generation.load();
+    if (applied_thread_affinity_generation == generation) {
+        return;
+    }
+    applied_thread_affinity_generation = generation;
+#ifdef __linux__
+    const ThreadAffinity affinity = thread_affinity.load();
+    if (affinity == ThreadAffinity::None) {
+        if (has_saved_affinity_mask) {
+            sched_setaffinity(0, sizeof(saved_affinity_mask),
+                              &saved_affinity_mask);
+            has_saved_affinity_mask = false;
+        }
+        return;
+    }
+    const std::vector<int> cpus = GetAffinityCPUs(affinity);
+    if (cpus.empty()) {
+        return;
+    }
+    if (!has_saved_affinity_mask) {
+        has_saved_affinity_mask =
+                sched_getaffinity(0, sizeof(saved_affinity_mask),
+                                  &saved_affinity_mask) == 0;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(cpus[slot % cpus.size()], &mask);
+    if (sched_setaffinity(0, sizeof(mask), &mask) != 0) {
+        utility::LogDebug("Failed to pin thread slot {} to CPU {}.", slot,
+                          cpus[slot % cpus.size()]);
+    }
+#endif
+}
+
+void SetThreadAffinity(ThreadAffinity affinity) {
+    thread_affinity = affinity;
+    ++thread_affinity_generation;
+}
+
+ThreadAffinity GetThreadAffinity() { return thread_affinity.load(); }
+
+static tbb::task_arena& GetTaskArena() {
+    static tbb::task_arena arena(std::max(DefaultMaxThreads(), 1));
+    return arena;
+}
+
+void ParallelForRange(int64_t n,
+                      const std::function<void(int64_t, int64_t)>& func,
+                      int64_t grain_size) {
+    if (n <= 0) {
+        return;
+    }
+    if (grain_size < 0) {
+        utility::LogError("grain_size must be non-negative, but got {}.",
+                          grain_size);
+    }
+
+    auto run_range = [&func](const tbb::blocked_range<int64_t>& range) {
+        ++parallel_for_range_depth;
+        try {
+            func(range.begin(), range.end());
+        } catch (...) {
+            --parallel_for_range_depth;
+            throw;
+        }
+        --parallel_for_range_depth;
+    };
+
+    // Run serially if there is nothing to split, avoiding the arena overhead.
+    if (n <= grain_size) {
+        run_range(tbb::blocked_range<int64_t>(0, n));
+        return;
+    }
+
+    auto run_pinned_range =
+            [&run_range](const tbb::blocked_range<int64_t>& range) {
+                UpdateThreadAffinity();
+                run_range(range);
+            };
+    GetTaskArena().execute([&]() {
+        if (grain_size == 0) {
+            tbb::parallel_for(tbb::blocked_range<int64_t>(0, n),
+                              run_pinned_range, tbb::auto_partitioner());
+        } else {
+            tbb::parallel_for(tbb::blocked_range<int64_t>(0, n, grain_size),
+                              run_pinned_range, tbb::simple_partitioner());
+        }
+    });
+}
+
 }  // namespace utility
 }  // namespace open3d
@@ -26,14 +26,97 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+
 namespace open3d {
 namespace utility {
 
 /// Estimate the maximum number of threads to be used in a parallel region.
 int EstimateMaxThreads();
 
-/// Returns true if in an parallel section.
+/// Limits the number of threads of all parallel regions to \p num_threads,
+/// e.g. to measure the scaling of a kernel. EstimateMaxThreads() returns
+/// \p num_threads and the ParallelForRange() task arena runs at most
+/// \p num_threads threads at a time. A value <= 0 removes the limit.
+void SetMaxThreads(int num_threads);
+
+/// Returns true if in an parallel section. This covers both OpenMP parallel
+/// regions and range bodies executed by ParallelForRange().
 bool InParallel();
 
+/// Run \p func over sub-ranges of [0, \p n) on the shared work-stealing task
+/// arena.
+///
+/// The arena is created once with EstimateMaxThreads() slots. Idle threads
+/// steal sub-ranges from busy ones, so non-uniform work items are balanced
+/// automatically. Calls can be nested: an inner ParallelForRange() issued from
+/// within a range body schedules its tasks in the same arena instead of
+/// spawning a new thread team, so nested parallelism neither oversubscribes
+/// the machine nor serializes the inner loop.
+///
+/// \param n The number of workloads.
+/// \param func The function to be executed on each sub-range. The function
+/// should take the half-open range `[begin, end)`, i.e.,
+/// `void func(int64_t begin, int64_t end)`.
+/// \param grain_size The minimum number of workloads per sub-range. If 0, the
+/// sub-range sizes are chosen adaptively by the scheduler.
+///
+/// \note Exceptions thrown by \p func are propagated to the caller.
+void ParallelForRange(int64_t n,
+                      const std::function<void(int64_t, int64_t)>& func,
+                      int64_t grain_size = 0);
+
+/// Enables or disables the deterministic mode of parallel kernels.
+///
+/// Some CUDA kernels accumulate floating point values with atomics, so their
+/// results differ in the last bits from run to run. In deterministic mode these
+/// kernels produce bit-for-bit reproducible results instead:
+/// - The 6x6 linear system reductions of t::pipelines (ICP and RGB-D
+///   odometry) write one partial sum per CUDA block and add the partial sums
+///   in block order. The extra pass costs a few percent of the reduction.
+/// - t::geometry::VoxelBlockGrid::ExtractPointCloud() and
+///   ExtractTriangleMesh() return their points, vertices and triangles in a
+///   canonical sorted order that does not depend on the hash map layout. This
+///   adds a few stable sorts of the output, on CPU and CUDA.
+/// - The gradients of the PyTorch ops three_interpolate and
+///   trilinear_devoxelize sort the scattered entries by target and sum them
+///   in a fixed order. This is several times slower than the atomic
+///   scatter for large inputs. The torch ops also honor
+///   torch.use_deterministic_algorithms().
+///
+/// The cost of each path can be measured with the benchmarks of the
+/// respective module. The mode is off by default.
+void SetDeterministic(bool deterministic);
+
+/// Returns true if the deterministic mode of parallel kernels is enabled, see
+/// SetDeterministic().
+bool IsDeterministic();
+
+/// Thread affinity policy of the ParallelForRange() task arena.
+enum class ThreadAffinity {
+    /// Threads are not pinned and may be migrated by the OS (default).
+    None,
+    /// Thread slot i is pinned to the i-th allowed logical CPU, filling NUMA
+    /// node 0 before node 1 and so on. Keeps small thread teams on one socket.
+    Compact,
+    /// Consecutive thread slots are pinned round-robin across NUMA nodes, so
+    /// that the memory bandwidth of every node is used. Pairs with
+    /// core::NumaPolicy::Interleave for large bandwidth-bound kernels.
+    Scatter,
+};
+
+/// Sets the thread affinity policy of the ParallelForRange() task arena.
+///
+/// Each worker thread applies the new policy the next time it executes a range
+/// body. The thread calling ParallelForRange() is never pinned, so that the
+/// threads it creates afterwards keep the process affinity. Switching back to
+/// ThreadAffinity::None restores the affinity mask a thread had before it was
+/// first pinned. Only supported on Linux; elsewhere this is a no-op.
+void SetThreadAffinity(ThreadAffinity affinity);
+
+/// Returns the current thread affinity policy.
+ThreadAffinity GetThreadAffinity();
+
 }  // namespace utility
 }  // namespace open3d
@@ -0,0 +1,282 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Profiler.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+struct Zone {
+    const char *name = nullptr;
+    const char *category = nullptr;
+    int64_t begin_ns = 0;
+    int64_t end_ns = 0;
+};
+
+/// Fixed size ring buffer of the zones of one thread or track. The mutex is
+/// only contended while the trace is exported.
+struct ZoneBuffer {
+    ZoneBuffer(int id, const std::string &name, size_t capacity)
+        : id(id), name(name), zones(std::max<size_t>(capacity, 1)) {}
+
+    void Push(const Zone &zone) {
+        std::lock_guard<std::mutex> lock(mutex);
+        zones[next] = zone;
+        next = (next + 1) % zones.size();
+        count++;
+    }
+
+    const int id;
+    const std::string name;
+    std::mutex mutex;
+    std::vector<Zone> zones;
+    size_t next = 0;
+    size_t count = 0;
+};
+
+void AppendJsonString(std::ostringstream &out, const char *s) {
+    out << '"';
+    for (; s && *s; ++s) {
+        switch (*s) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            default:
+                if (static_cast<unsigned char>(*s) < 0x20) {
+                    out << ' ';
+                } else {
+                    out << *s;
+                }
+        }
+    }
+    out << '"';
+}
+
+}  // namespace
+
+struct Profiler::Impl {
+    std::mutex mutex;
+    size_t capacity = 1 << 16;
+    std::vector<std::shared_ptr<ZoneBuffer>> threads;
+    std::map<std::string, std::shared_ptr<ZoneBuffer>> tracks;
+    std::vector<std::function<void()>> deferred;
+    // Written at exit if OPEN3D_PROFILE is set.
+    std::string exit_trace_filename;
+
+    std::shared_ptr<ZoneBuffer> NewBuffer(const std::string &name) {
+        std::lock_guard<std::mutex> lock(mutex);
+        const int id = int(threads.size() + tracks.size());
+        auto buffer = std::make_shared<ZoneBuffer>(
+                id, name.empty() ? fmt::format("Thread {}", id) : name,
+                capacity);
+        if (name.empty()) {
+            threads.push_back(buffer);
+        } else {
+            tracks[name] = buffer;
+        }
+        return buffer;
+    }
+
+    void RunDeferred() {
+        std::vector<std::function<void()>> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.swap(deferred);
+        }
+        for (auto &resolve : pending) {
+            resolve();
+        }
+    }
+};
+
+Profiler::Profiler() : impl_(new Impl()) {
+    if (const char *filename = std::getenv("OPEN3D_PROFILE")) {
+        impl_->exit_trace_filename = filename;
+        SetEnabled(!impl_->exit_trace_filename.empty());
+    }
+}
+
+Profiler::~Profiler() {
+    if (!impl_->exit_trace_filename.empty()) {
+        WriteChromeTrace(impl_->exit_trace_filename);
+    }
+}
+
+Profiler &Profiler::GetInstance() {
+    static Profiler instance;
+    return instance;
+}
+
+int64_t Profiler::Now() {
+    static const std::chrono::steady_clock::time_point epoch =
+            std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now() - epoch)
+            .count();
+}
+
+void Profiler::SetBufferCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    impl_->capacity = capacity;
+}
+
+void Profiler::Clear() {
+    impl_->RunDeferred();
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto clear = [this](ZoneBuffer &buffer) {
+        std::lock_guard<std::mutex> buffer_lock(buffer.mutex);
+        buffer.zones.assign(std::max<size_t>(impl_->capacity, 1), Zone());
+        buffer.next = 0;
+        buffer.count = 0;
+    };
+    for (auto &buffer : impl_->threads) {
+        clear(*buffer);
+    }
+    for (auto &kv : impl_->tracks) {
+        clear(*kv.second);
+    }
+}
+
+void Profiler::Record(const char *name,
+                      const char *category,
+                      int64_t begin_ns,
+                      int64_t end_ns) {
+    // The registry keeps the buffer alive after the thread exits.
+    thread_local std::shared_ptr<ZoneBuffer> buffer = impl_->NewBuffer("");
+    buffer->Push({name, category, begin_ns, end_ns});
+}
+
+void Profiler::RecordOnTrack(const std::string &track,
+                             const char *name,
+                             const char *category,
+                             int64_t begin_ns,
+                             int64_t end_ns) {
+    std::shared_ptr<ZoneBuffer> buffer;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        auto it = impl_->tracks.find(track);
+        if (it != impl_->tracks.end()) {
+            buffer = it->second;
+        }
+    }
+    if (!buffer) {
+        buffer = impl_->NewBuffer(track);
+    }
+    buffer->Push({name, category, begin_ns, end_ns});
+}
+
+void Profiler::AddDeferred(std::function<void()> resolve) {
+    bool flush = false;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        impl_->deferred.push_back(std::move(resolve));
+        flush = impl_->deferred.size() >= impl_->capacity;
+    }
+    // Bound the number of pending functions (and e.g. GPU events they hold)
+    // in long runs that export only at the end.
+    if (flush) {
+        impl_->RunDeferred();
+    }
+}
+
+std::string Profiler::ToChromeTrace() {
+    impl_->RunDeferred();
+
+    std::vector<std::shared_ptr<ZoneBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        buffers = impl_->threads;
+        for (auto &kv : impl_->tracks) {
+            buffers.push_back(kv.second);
+        }
+    }
+
+    std::ostringstream out;
+    out.precision(3);
+    out << std::fixed << "{\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&out, &first]() {
+        if (!first) out << ",\n";
+        first = false;
+    };
+    for (auto &buffer : buffers) {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        separator();
+        out << "{\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->id
+            << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+        AppendJsonString(out, buffer->name.c_str());
+        out << "}}";
+
+        // Oldest zone first.
+        const size_t capacity = buffer->zones.size();
+        const size_t size = std::min(buffer->count, capacity);
+        const size_t start = buffer->count > capacity ? buffer->next : 0;
+        for (size_t i = 0; i < size; ++i) {
+            const Zone &zone = buffer->zones[(start + i) % capacity];
+            separator();
+            out << "{\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id
+                << ",\"name\":";
+            AppendJsonString(out, zone.name);
+            out << ",\"cat\":";
+            AppendJsonString(out, zone.category);
+            out << ",\"ts\":" << double(zone.begin_ns) * 1e-3
+                << ",\"dur\":" << double(zone.end_ns - zone.begin_ns) * 1e-3
+                << "}";
+        }
+    }
+    out << "],\"displayTimeUnit\":\"ms\"}\n";
+    return out.str();
+}
+
+bool Profiler::WriteChromeTrace(const std::string &filename) {
+    std::ofstream file(filename);
+    if (!file) {
+        LogWarning("Failed to open {} for writing the profiler trace.",
+                   filename);
+        return false;
+    }
+    file << ToChromeTrace();
+    return bool(file);
+}
+
+}  // namespace utility
+}  // namespace open3d
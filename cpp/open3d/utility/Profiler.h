@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "open3d/utility/Preprocessor.h"
+
+namespace open3d {
+namespace utility {
+
+/// \class Profiler
+///
+/// \brief Collects named time zones and exports them as a Chrome trace.
+///
+/// Every thread records into its own ring buffer, so recording does not
+/// contend with other threads. When a buffer is full the oldest zones are
+/// overwritten. The trace can be opened in chrome://tracing or
+/// https://ui.perfetto.dev.
+///
+/// Zones are added with the OPEN3D_PROFILE_ZONE() macro, which compiles to
+/// nothing unless Open3D is built with WITH_PROFILING=ON. Recording must also
+/// be enabled at runtime with SetEnabled() or by setting the environment
+/// variable OPEN3D_PROFILE to a file name, in which case the trace is written
+/// to that file at exit.
+class Profiler {
+public:
+    ~Profiler();
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    static Profiler &GetInstance();
+
+    /// Nanoseconds since the first call.
+    static int64_t Now();
+
+    void SetEnabled(bool enabled) {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Sets the number of zones kept per thread. Buffers that already exist
+    /// keep their size until Clear().
+    void SetBufferCapacity(size_t capacity);
+
+    /// Discards all recorded zones.
+    void Clear();
+
+    /// Records a zone of the calling thread. \p name and \p category must
+    /// outlive the profiler, e.g. be string literals.
+    void Record(const char *name,
+                const char *category,
+                int64_t begin_ns,
+                int64_t end_ns);
+
+    /// Records a zone on the named track, e.g. "CUDA:0" for GPU work.
+    void RecordOnTrack(const std::string &track,
+                       const char *name,
+                       const char *category,
+                       int64_t begin_ns,
+                       int64_t end_ns);
+
+    /// Adds a function that is run before the next export, e.g. to read back
+    /// GPU timings once the work has finished. The function typically calls
+    /// RecordOnTrack(). Pending functions are also run once there are as
+    /// many as the buffer capacity.
+    void AddDeferred(std::function<void()> resolve);
+
+    /// Returns the recorded zones in the Chrome trace event JSON format.
+    std::string ToChromeTrace();
+
+    /// Writes ToChromeTrace() to \p filename. Returns false on failure.
+    bool WriteChromeTrace(const std::string &filename);
+
+private:
+    Profiler();
+
+    std::atomic<bool> enabled_{false};
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \class ProfileZone
+///
+/// \brief Records the lifetime of the object as a zone of the calling thread.
+class ProfileZone {
+public:
+    explicit ProfileZone(const char *name, const char *category = "open3d")
+        : name_(name),
+          category_(category),
+          begin_ns_(Profiler::GetInstance().IsEnabled() ? Profiler::Now()
+                                                        : -1) {}
+    ~ProfileZone() {
+        if (begin_ns_ >= 0) {
+            Profiler::GetInstance().Record(name_, category_, begin_ns_,
+                                           Profiler::Now());
+        }
+    }
+    ProfileZone(const ProfileZone &) = delete;
+    ProfileZone &operator=(const ProfileZone &) = delete;
+
+private:
+    const char *name_;
+    const char *category_;
+    int64_t begin_ns_;
+};
+
+}  // namespace utility
+}  // namespace open3d
+
+#ifdef WITH_PROFILING
+/// Records the rest of the enclosing scope as zone \p name in \p category.
+/// Both must be string literals.
+#define OPEN3D_PROFILE_ZONE(category, name)                            \
+    ::open3d::utility::ProfileZone OPEN3D_CONCAT(open3d_profile_zone_, \
+                                                 __LINE__)(name, category)
+#else
+#define OPEN3D_PROFILE_ZONE(category, name)
+#endif
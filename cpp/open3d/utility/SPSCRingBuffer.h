@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace open3d {
+namespace utility {
+
+/// \class SPSCRingBuffer
+///
+/// \brief Lock-free ring buffer for one producer and one consumer thread.
+///
+/// Push() may only be called by the producer and Pop() only by the consumer.
+/// Neither blocks: Push() fails if the buffer is full and Pop() fails if it
+/// is empty.
+template <typename T>
+class SPSCRingBuffer {
+public:
+    /// \param capacity Maximum number of elements in the buffer.
+    explicit SPSCRingBuffer(size_t capacity) : slots_(capacity + 1) {}
+
+    SPSCRingBuffer(const SPSCRingBuffer &) = delete;
+    SPSCRingBuffer &operator=(const SPSCRingBuffer &) = delete;
+
+    /// Appends \p value. Returns false if the buffer is full.
+    bool Push(T &&value) {
+        const size_t tail = tail_.value.load(std::memory_order_relaxed);
+        const size_t next = Next(tail);
+        if (next == head_.value.load(std::memory_order_acquire)) {
+            return false;
+        }
+        slots_[tail] = std::move(value);
+        tail_.value.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /// Removes the oldest element and moves it to \p value. Returns false if
+    /// the buffer is empty.
+    bool Pop(T &value) {
+        const size_t head = head_.value.load(std::memory_order_relaxed);
+        if (head == tail_.value.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = std::move(slots_[head]);
+        // Release resources held by the element, e.g. device frames, now.
+        slots_[head] = T();
+        head_.value.store(Next(head), std::memory_order_release);
+        return true;
+    }
+
+    /// Number of elements in the buffer. Exact only if called by the producer
+    /// or the consumer while the other thread is idle.
+    size_t Size() const {
+        const size_t head = head_.value.load(std::memory_order_acquire);
+        const size_t tail = tail_.value.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : tail + slots_.size() - head;
+    }
+
+    bool Empty() const { return Size() == 0; }
+
+    size_t Capacity() const { return slots_.size() - 1; }
+
+private:
+    size_t Next(size_t index) const {
+        return index + 1 == slots_.size() ? 0 : index + 1;
+    }
+
+    /// Index padded to keep head_ and tail_ on different cache lines.
+    struct Index {
+        std::atomic<size_t> value{0};
+        char padding[64 - sizeof(std::atomic<size_t>)];
+    };
+
+    /// One slot stays free to tell a full from an empty buffer.
+    std::vector<T> slots_;
+    /// Next element to pop, written by the consumer.
+    Index head_;
+    /// Next free slot, written by the producer.
+    Index tail_;
+};
+
+}  // namespace utility
+}  // namespace open3d
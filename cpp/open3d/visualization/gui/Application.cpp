@@ -701,6 +701,33 @@ std::shared_ptr<geometry::Image> Application::RenderToImage(
     return img;
 }
 
+std::vector<std::shared_ptr<geometry::Image>> Application::RenderToImages(
+        rendering::Renderer &renderer,
+        rendering::View *view,
+        rendering::Scene *scene,
+        int width,
+        int height,
+        size_t n_images,
+        const std::function<void(size_t)> &setup_camera) {
+    std::vector<std::shared_ptr<geometry::Image>> images(n_images);
+    view->SetViewport(0, 0, width, height);
+
+    // Each request copies the view settings, including the camera, so the
+    // camera can be changed before the next one is queued.
+    for (size_t i = 0; i < n_images; ++i) {
+        setup_camera(i);
+        renderer.RenderToImage(
+                view, scene,
+                [&images, i](std::shared_ptr<geometry::Image> img) {
+                    images[i] = img;
+                });
+    }
+    renderer.BeginFrame();
+    renderer.EndFrame();
+
+    return images;
+}
+
 std::shared_ptr<geometry::Image> Application::RenderToDepthImage(
         rendering::Renderer &renderer,
         rendering::View *view,
@@ -191,6 +191,20 @@ public:
             int width,
             int height);
 
+    /// Renders \p n_images images of the scene, e.g. several views of a
+    /// model. \p setup_camera is called with the index of each image before
+    /// it is requested, and all images are rendered and read back in a single
+    /// frame, which is much faster than calling RenderToImage() repeatedly.
+    /// The same restrictions as for RenderToImage() apply.
+    std::vector<std::shared_ptr<geometry::Image>> RenderToImages(
+            rendering::Renderer &renderer,
+            rendering::View *view,
+            rendering::Scene *scene,
+            int width,
+            int height,
+            size_t n_images,
+            const std::function<void(size_t)> &setup_camera);
+
     // Same as RenderToImage(), but returns the depth values in a float image.
     std::shared_ptr<geometry::Image> RenderToDepthImage(
             rendering::Renderer &renderer,
@@ -26,11 +26,13 @@
 
 #include "open3d/visualization/gui/BitmapWindowSystem.h"
 
+#include <atomic>
 #include <chrono>
 #include <mutex>
 #include <queue>
 #include <thread>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/visualization/gui/Events.h"
@@ -49,6 +51,13 @@ struct BitmapWindow {
     Rect frame;
     Point mouse_pos;
     int mouse_buttons = 0;
+    // Draw events are coalesced: there is at most one queued per window.
+    std::atomic<bool> redraw_pending{false};
+    std::atomic<bool> needs_full_frame{true};
+    // Last frame sent to the draw callback, which partial readbacks of the
+    // damaged region are composited into.
+    std::shared_ptr<core::Tensor> frame_image;
+    bool readback_pending = false;
 
     BitmapWindow(Window *o3dw, int width, int height)
         : o3d_window(o3dw), frame(0, 0, width, height) {}
@@ -66,7 +75,10 @@ struct BitmapEvent {
 struct BitmapDrawEvent : public BitmapEvent {
     BitmapDrawEvent(BitmapWindow *target) : BitmapEvent(target) {}
 
-    void Execute() override { event_target->o3d_window->OnDraw(); }
+    void Execute() override {
+        event_target->redraw_pending = false;
+        event_target->o3d_window->OnDraw();
+    }
 };
 
 struct BitmapResizeEvent : public BitmapEvent {
@@ -129,11 +141,13 @@ struct BitmapEventQueue : public std::queue<std::shared_ptr<BitmapEvent>> {
         super::pop();
         return evt;
     }
-    void push(const value_t &event) {
+    bool push(const value_t &event) {
         if (evt_q_mutex_.try_lock()) {
             super::push(event);
             evt_q_mutex_.unlock();
+            return true;
         }
+        return false;
     }
 
 private:
@@ -221,7 +235,22 @@ void BitmapWindowSystem::DestroyWindow(OSWindow w) {
 
 void BitmapWindowSystem::PostRedrawEvent(OSWindow w) {
     auto hw = (BitmapWindow *)w;
-    impl_->event_queue_.push(std::make_shared<BitmapDrawEvent>(hw));
+    // Every mouse move requests a redraw, but a single draw of the latest
+    // state is enough.
+    if (!hw->redraw_pending.exchange(true)) {
+        if (!impl_->event_queue_.push(std::make_shared<BitmapDrawEvent>(hw))) {
+            hw->redraw_pending = false;
+        }
+    }
+}
+
+void BitmapWindowSystem::PostFullRedrawEvent(OSWindow w) {
+    ((BitmapWindow *)w)->needs_full_frame = true;
+    PostRedrawEvent(w);
+}
+
+bool BitmapWindowSystem::CanSkipUndamagedFrame(OSWindow w) {
+    return !((BitmapWindow *)w)->needs_full_frame.exchange(false);
 }
 
 void BitmapWindowSystem::PostMouseEvent(OSWindow w, const MouseEvent &e) {
@@ -308,15 +337,51 @@ rendering::FilamentRenderer *BitmapWindowSystem::CreateRenderer(OSWindow w) {
             return;
         }
 
+        auto *hw = (BitmapWindow *)w;
         auto size = this->GetWindowSizePixels(w);
-        Window *window = ((BitmapWindow *)w)->o3d_window;
+        Window *window = hw->o3d_window;
+        const Rect damage = window->GetDamage();
+        if (damage.width <= 0 || damage.height <= 0) {
+            return;
+        }
+
+        // Partial readbacks need the previous frame to be complete.
+        const bool is_full_frame =
+                !hw->frame_image || hw->readback_pending ||
+                hw->frame_image->GetShape(0) != size.height ||
+                hw->frame_image->GetShape(1) != size.width ||
+                damage == Rect(0, 0, size.width, size.height);
+        hw->readback_pending = true;
+        if (is_full_frame) {
+            auto on_pixels = [this, hw](std::shared_ptr<core::Tensor> image) {
+                hw->frame_image = image;
+                hw->readback_pending = false;
+                if (this->impl_->on_draw_) {
+                    this->impl_->on_draw_(hw->o3d_window, image);
+                }
+            };
+            renderer->RequestReadPixels(size.width, size.height, on_pixels);
+            return;
+        }
 
-        auto on_pixels = [this, window](std::shared_ptr<core::Tensor> image) {
+        // Only read back the damaged region and composite it into a copy of
+        // the last frame, which the draw callback may still be holding on to.
+        auto on_pixels = [this, hw, damage](std::shared_ptr<core::Tensor> rgn) {
+            auto image = std::make_shared<core::Tensor>(
+                    hw->frame_image->Clone());
+            image->Slice(0, damage.y, damage.GetBottom())
+                    .Slice(1, damage.x, damage.GetRight())
+                    .AsRvalue() = *rgn;
+            hw->frame_image = image;
+            hw->readback_pending = false;
             if (this->impl_->on_draw_) {
-                this->impl_->on_draw_(window, image);
+                this->impl_->on_draw_(hw->o3d_window, image);
             }
         };
-        renderer->RequestReadPixels(size.width, size.height, on_pixels);
+        // The readback origin is at the bottom left.
+        renderer->RequestReadPixels(damage.x,
+                                    size.height - damage.GetBottom(),
+                                    damage.width, damage.height, on_pixels);
     };
     renderer->SetOnAfterDraw(on_after_draw);
     return renderer;
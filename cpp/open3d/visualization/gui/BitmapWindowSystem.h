@@ -73,6 +73,10 @@ public:
     Size GetScreenSize(OSWindow w) override;
 
     void PostRedrawEvent(OSWindow w) override;
+    /// Posts a redraw that renders and reads back the whole window even if
+    /// nothing changed, e.g. for a newly connected client.
+    void PostFullRedrawEvent(OSWindow w);
+    bool CanSkipUndamagedFrame(OSWindow w) override;
     void PostMouseEvent(OSWindow w, const MouseEvent& e);
     void PostKeyEvent(OSWindow w, const KeyEvent& e);
     void PostTextInputEvent(OSWindow w, const TextInputEvent& e);
@@ -35,6 +35,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/gui/Events.h"
 #include "open3d/visualization/rendering/MaterialRecord.h"
 #include "open3d/visualization/rendering/Open3DScene.h"
@@ -192,12 +193,20 @@ void PickPointsInteractor::SetPickableGeometry(
         } else if (tcloud || tmesh) {
             const auto &tpoints = (tcloud ? tcloud->GetPointPositions()
                                           : tmesh->GetVertexPositions());
-            const size_t n = tpoints.NumElements();
-            float *pts = (float *)tpoints.GetDataPtr();
-            points_.reserve(points_.size() + n);
-            for (size_t i = 0; i < n; i += 3) {
-                points_.emplace_back(double(pts[i]), double(pts[i + 1]),
-                                     double(pts[i + 2]));
+            // The positions may live on the GPU and be Float32 or Float64.
+            const core::Tensor host_points = tpoints.To(core::Device("CPU:0"))
+                                                     .To(core::Float64)
+                                                     .Contiguous();
+            const double *pts = host_points.GetDataPtr<double>();
+            const int64_t n = host_points.GetLength();
+            const size_t offset = points_.size();
+            points_.resize(offset + n);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t i = 0; i < n; ++i) {
+                points_[offset + i] = Eigen::Vector3d(pts[3 * i],
+                                                      pts[3 * i + 1],
+                                                      pts[3 * i + 2]);
             }
         }
 
@@ -235,9 +244,11 @@ void PickPointsInteractor::SetPickableGeometry(
 
     if (!points_.empty()) {  // Filament panics if an object has zero vertices
         auto cloud = std::make_shared<geometry::PointCloud>(points_);
-        cloud->colors_.reserve(points_.size());
-        for (size_t i = 0; i < cloud->points_.size(); ++i) {
-            cloud->colors_.emplace_back(SetColorForIndex(uint32_t(i)));
+        cloud->colors_.resize(points_.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < int64_t(cloud->points_.size()); ++i) {
+            cloud->colors_[i] = SetColorForIndex(uint32_t(i));
         }
 
         auto mat = MakeMaterial();
@@ -1240,6 +1240,11 @@ Widget::DrawResult SceneWidget::Tick(const TickEvent& e) {
             result = Widget::DrawResult::REDRAW;
         }
     }
+    // Stream in the point cloud octree nodes for the current camera.
+    if (impl_->scene_ && impl_->scene_->UpdatePointCloudLOD()) {
+        ForceRedraw();
+        result = Widget::DrawResult::REDRAW;
+    }
     return result;
 }
 
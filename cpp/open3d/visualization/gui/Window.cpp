@@ -31,6 +31,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <queue>
 #include <unordered_map>
@@ -203,6 +205,63 @@ struct ImguiWindowContext : public FontContext {
     }
 };
 
+// Fingerprint and bounds of an ImGui draw list (one per top-level child),
+// used to find the parts of the window that changed between frames.
+struct DrawListState {
+    std::uint64_t hash = 0;
+    Rect bounds;
+};
+
+std::uint64_t HashBytes(const void* data, size_t n_bytes, std::uint64_t h) {
+    // FNV-1a, eight bytes at a time.
+    static constexpr std::uint64_t kPrime = 1099511628211ull;
+    const char* bytes = static_cast<const char*>(data);
+    size_t i = 0;
+    for (; i + sizeof(std::uint64_t) <= n_bytes; i += sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        h = (h ^ word) * kPrime;
+    }
+    for (; i < n_bytes; ++i) {
+        h = (h ^ std::uint64_t(bytes[i])) * kPrime;
+    }
+    return h;
+}
+
+DrawListState GetDrawListState(const ImDrawList& list) {
+    DrawListState state;
+    std::uint64_t h = 14695981039346656037ull;
+    h = HashBytes(list.VtxBuffer.Data,
+                  list.VtxBuffer.Size * sizeof(ImDrawVert), h);
+    h = HashBytes(list.IdxBuffer.Data, list.IdxBuffer.Size * sizeof(ImDrawIdx),
+                  h);
+    for (const ImDrawCmd& cmd : list.CmdBuffer) {
+        h = HashBytes(&cmd.ClipRect, sizeof(cmd.ClipRect), h);
+        h = HashBytes(&cmd.TextureId, sizeof(cmd.TextureId), h);
+        h = HashBytes(&cmd.ElemCount, sizeof(cmd.ElemCount), h);
+    }
+    state.hash = h;
+
+    if (list.VtxBuffer.Size > 0) {
+        ImVec2 min_pt(FLT_MAX, FLT_MAX), max_pt(-FLT_MAX, -FLT_MAX);
+        for (const ImDrawVert& v : list.VtxBuffer) {
+            min_pt.x = std::min(min_pt.x, v.pos.x);
+            min_pt.y = std::min(min_pt.y, v.pos.y);
+            max_pt.x = std::max(max_pt.x, v.pos.x);
+            max_pt.y = std::max(max_pt.y, v.pos.y);
+        }
+        // Pad by a pixel for antialiased edges
+        int x0 = int(std::floor(min_pt.x)) - 1;
+        int y0 = int(std::floor(min_pt.y)) - 1;
+        int x1 = int(std::ceil(max_pt.x)) + 1;
+        int y1 = int(std::ceil(max_pt.y)) + 1;
+        state.bounds = Rect(x0, y0, x1 - x0, y1 - y0);
+    }
+    return state;
+}
+
+bool IsEmpty(const Rect& r) { return r.width <= 0 || r.height <= 0; }
+
 }  // namespace
 
 const int Window::FLAG_HIDDEN = (1 << 0);
@@ -250,6 +309,13 @@ struct Window::Impl {
     bool needs_redraw_ = true;  // set by PostRedraw to defer if already drawing
     bool is_resizing_ = false;
     bool is_drawing_ = false;
+
+    // Damage tracking: the state of the last rendered frame and the region
+    // of the window that changed in it.
+    std::vector<DrawListState> draw_lists_;
+    Size last_draw_size_;
+    std::uint64_t last_texture_generation_ = 0;
+    Rect damage_;
 };
 
 Window::Window(const std::string& title, int flags /*= 0*/)
@@ -433,6 +499,8 @@ void Window::DestroyWindow() {
 
 int Window::GetMouseMods() const { return impl_->mouse_mods_; }
 
+Rect Window::GetDamage() const { return impl_->damage_; }
+
 std::string Window::GetWebRTCUID() const {
 #ifdef BUILD_WEBRTC
     if (auto* webrtc_ws = dynamic_cast<webrtc_server::WebRTCWindowSystem*>(
@@ -921,10 +989,16 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     // Draw. Since ImGUI is an immediate mode gui, it does layout during
     // draw, and if we are drawing for layout purposes, don't actually
     // draw, because we are just going to draw again after this returns.
+    // Also skip the frame if nothing changed and the window system does not
+    // need it, which keeps idle remote windows from rendering and encoding.
     if (!is_layout_pass) {
-        impl_->renderer_->BeginFrame();
-        impl_->renderer_->Draw();
-        impl_->renderer_->EndFrame();
+        impl_->damage_ = CalcDamage();
+        if (!IsEmpty(impl_->damage_) ||
+            impl_->renderer_->HasPendingBufferRenders()) {
+            impl_->renderer_->BeginFrame();
+            impl_->renderer_->Draw();
+            impl_->renderer_->EndFrame();
+        }
     }
 
     if (needs_layout) {
@@ -936,6 +1010,62 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     }
 }
 
+Rect Window::CalcDamage() {
+    auto size = GetSize();
+    const Rect full(0, 0, size.width, size.height);
+
+    const ImDrawData* draw_data = ImGui::GetDrawData();
+    std::vector<DrawListState> draw_lists(draw_data->CmdListsCount);
+    for (int i = 0; i < draw_data->CmdListsCount; ++i) {
+        draw_lists[i] = GetDrawListState(*draw_data->CmdLists[i]);
+    }
+    auto texture_generation = impl_->renderer_->GetTextureGeneration();
+
+    auto& ws = Application::GetInstance().GetWindowSystem();
+    bool is_full = !ws.CanSkipUndamagedFrame(impl_->window_) ||
+                   size.width != impl_->last_draw_size_.width ||
+                   size.height != impl_->last_draw_size_.height ||
+                   draw_lists.size() != impl_->draw_lists_.size() ||
+                   texture_generation != impl_->last_texture_generation_;
+
+    Rect damage;
+    auto add_damage = [&damage](const Rect& r) {
+        if (!IsEmpty(r)) {
+            damage = (IsEmpty(damage) ? r : damage.UnionedWith(r));
+        }
+    };
+    if (!is_full) {
+        // A changed draw list damages both where it was and where it is now.
+        for (size_t i = 0; i < draw_lists.size(); ++i) {
+            if (draw_lists[i].hash != impl_->draw_lists_[i].hash) {
+                add_damage(draw_lists[i].bounds);
+                add_damage(impl_->draw_lists_[i].bounds);
+            }
+        }
+        // 3D views that render this frame (viewport origin is bottom left)
+        for (auto& vp : impl_->renderer_->GetPendingViewports()) {
+            add_damage(Rect(vp[0], size.height - vp[1] - vp[3], vp[2], vp[3]));
+        }
+    }
+
+    impl_->draw_lists_ = std::move(draw_lists);
+    impl_->last_draw_size_ = size;
+    impl_->last_texture_generation_ = texture_generation;
+
+    if (is_full || IsEmpty(damage)) {
+        return (is_full ? full : Rect());
+    }
+    // Clip to the window
+    int x0 = std::max(damage.x, 0);
+    int y0 = std::max(damage.y, 0);
+    int x1 = std::min(damage.GetRight(), full.GetRight());
+    int y1 = std::min(damage.GetBottom(), full.GetBottom());
+    if (x1 <= x0 || y1 <= y0) {
+        return Rect();
+    }
+    return Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
 void Window::OnDraw() {
     impl_->is_drawing_ = true;
     bool needed_layout = impl_->needs_layout_;
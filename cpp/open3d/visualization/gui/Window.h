@@ -176,6 +176,12 @@ public:
     /// WebRTCWindowSystem.
     std::string GetWebRTCUID() const;
 
+    /// Returns the region of the window, in pixels, that changed in the last
+    /// drawn frame. This is empty if the frame was skipped because nothing
+    /// changed, which only happens with window systems that allow it
+    /// (e.g. WebRTCWindowSystem).
+    Rect GetDamage() const;
+
 protected:
     /// Returns the preferred size of the window. The window is not
     /// obligated to honor this size. If all children of the window
@@ -207,6 +213,7 @@ public:
 private:
     void CreateRenderer();
     Widget::DrawResult DrawOnce(bool is_layout_pass);
+    Rect CalcDamage();
     void* MakeDrawContextCurrent() const;
     void RestoreDrawContext(void* old_context) const;
 
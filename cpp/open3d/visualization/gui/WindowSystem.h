@@ -69,6 +69,11 @@ public:
 
     virtual void PostRedrawEvent(OSWindow w) = 0;
 
+    // Returns true if a frame that is identical to the previous one does not
+    // need to be rendered. Window systems that present to the screen need
+    // every requested frame.
+    virtual bool CanSkipUndamagedFrame(OSWindow w) { return false; }
+
     virtual bool GetWindowIsVisible(OSWindow w) const = 0;
     virtual void ShowWindow(OSWindow w, bool show) = 0;
 
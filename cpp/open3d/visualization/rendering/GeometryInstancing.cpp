@@ -0,0 +1,205 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/rendering/GeometryInstancing.h"
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+#include <cstring>
+
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+const core::Device kCPU("CPU:0");
+
+// Checks the per-instance arguments and returns the transforms as a
+// contiguous Float32 CPU tensor.
+core::Tensor PrepareTransforms(const core::Tensor& transforms,
+                               const core::Tensor& colors) {
+    core::AssertTensorShape(transforms, {utility::nullopt, 4, 4});
+    if (colors.NumElements() > 0) {
+        core::AssertTensorShape(colors, {transforms.GetLength(), 3});
+    }
+    return transforms.To(kCPU, core::Float32).Contiguous();
+}
+
+// Applies each transform to all rows of the (M, 3) tensor \p vectors and
+// returns the (N * M, 3) Float32 result. Normals are transformed with the
+// inverse transpose and renormalized.
+core::Tensor TransformVectors(const core::Tensor& vectors,
+                              const core::Tensor& transforms,
+                              bool is_normal) {
+    using RowMatrix3f =
+            Eigen::Matrix<float, Eigen::Dynamic, 3, Eigen::RowMajor>;
+    const core::Tensor src = vectors.To(kCPU, core::Float32).Contiguous();
+    const int64_t n_instances = transforms.GetLength();
+    const int64_t n_vectors = src.GetLength();
+    core::Tensor dst({n_instances * n_vectors, 3}, core::Float32);
+
+    Eigen::Map<const RowMatrix3f> in(src.GetDataPtr<float>(), n_vectors, 3);
+    const float* transform_ptr = transforms.GetDataPtr<float>();
+    float* dst_ptr = dst.GetDataPtr<float>();
+    for (int64_t i = 0; i < n_instances; ++i) {
+        Eigen::Map<const Eigen::Matrix<float, 4, 4, Eigen::RowMajor>> transform(
+                transform_ptr + 16 * i);
+        Eigen::Matrix3f rotation = transform.topLeftCorner<3, 3>();
+        Eigen::Map<RowMatrix3f> out(dst_ptr + 3 * n_vectors * i, n_vectors,
+                                    3);
+        if (is_normal) {
+            rotation = rotation.inverse().transpose().eval();
+            out.noalias() = in * rotation.transpose();
+            for (int64_t j = 0; j < n_vectors; ++j) {
+                out.row(j).normalize();
+            }
+        } else {
+            Eigen::RowVector3f translation =
+                    transform.topRightCorner<3, 1>().transpose();
+            out.noalias() = in * rotation.transpose();
+            out.rowwise() += translation;
+        }
+    }
+    return dst;
+}
+
+// Returns the (N * M, k) Int64 indices of N copies of the (M, k) \p indices,
+// where copy i refers to the i-th copy of the \p n_vertices vertices.
+core::Tensor OffsetIndices(const core::Tensor& indices,
+                           int64_t n_instances,
+                           int64_t n_vertices) {
+    const core::Tensor src = indices.To(kCPU, core::Int64).Contiguous();
+    const int64_t n = src.NumElements();
+    core::Tensor dst({n_instances * src.GetLength(), src.GetShape(1)},
+                     core::Int64);
+    const int64_t* src_ptr = src.GetDataPtr<int64_t>();
+    int64_t* dst_ptr = dst.GetDataPtr<int64_t>();
+    for (int64_t i = 0; i < n_instances; ++i) {
+        const int64_t offset = i * n_vertices;
+        for (int64_t j = 0; j < n; ++j) {
+            dst_ptr[i * n + j] = src_ptr[j] + offset;
+        }
+    }
+    return dst;
+}
+
+// Returns \p times copies of all rows: [a, b] -> [a, b, a, b, ...]
+core::Tensor TileRows(const core::Tensor& rows, int64_t times) {
+    const core::Tensor src = rows.To(kCPU).Contiguous();
+    core::SizeVector shape = src.GetShape();
+    shape[0] *= times;
+    core::Tensor dst(shape, src.GetDtype());
+    const int64_t n_bytes = src.NumElements() * src.GetDtype().ByteSize();
+    for (int64_t i = 0; i < times; ++i) {
+        std::memcpy(static_cast<char*>(dst.GetDataPtr()) + i * n_bytes,
+                    src.GetDataPtr(), n_bytes);
+    }
+    return dst;
+}
+
+// Repeats each row \p times times: [a, b] -> [a, a, ..., b, b, ...]
+core::Tensor RepeatRows(const core::Tensor& rows, int64_t times) {
+    const core::Tensor src = rows.To(kCPU).Contiguous();
+    core::SizeVector shape = src.GetShape();
+    shape[0] *= times;
+    core::Tensor dst(shape, src.GetDtype());
+    const int64_t row_bytes = src.GetLength() > 0
+                                      ? src.NumElements() / src.GetLength() *
+                                                src.GetDtype().ByteSize()
+                                      : 0;
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    for (int64_t i = 0; i < src.GetLength(); ++i) {
+        for (int64_t j = 0; j < times; ++j) {
+            std::memcpy(dst_ptr + (i * times + j) * row_bytes,
+                        src_ptr + i * row_bytes, row_bytes);
+        }
+    }
+    return dst;
+}
+
+}  // namespace
+
+t::geometry::TriangleMesh InstanceTriangleMesh(
+        const t::geometry::TriangleMesh& mesh,
+        const core::Tensor& transforms,
+        const core::Tensor& colors /*= core::Tensor()*/) {
+    const core::Tensor transforms_cpu = PrepareTransforms(transforms, colors);
+    const int64_t n_instances = transforms_cpu.GetLength();
+    const int64_t n_vertices = mesh.GetVertexPositions().GetLength();
+
+    t::geometry::TriangleMesh instances(kCPU);
+    instances.SetVertexPositions(TransformVectors(mesh.GetVertexPositions(),
+                                                  transforms_cpu, false));
+    if (mesh.HasTriangleIndices()) {
+        instances.SetTriangleIndices(OffsetIndices(mesh.GetTriangleIndices(),
+                                                   n_instances, n_vertices));
+    }
+    if (mesh.HasVertexNormals()) {
+        instances.SetVertexNormals(TransformVectors(mesh.GetVertexNormals(),
+                                                    transforms_cpu, true));
+    }
+    if (colors.NumElements() > 0) {
+        instances.SetVertexColors(RepeatRows(colors, n_vertices));
+    } else if (mesh.HasVertexColors()) {
+        instances.SetVertexColors(
+                TileRows(mesh.GetVertexColors(), n_instances));
+    }
+    return instances;
+}
+
+t::geometry::LineSet InstanceLineSet(
+        const t::geometry::LineSet& lines,
+        const core::Tensor& transforms,
+        const core::Tensor& colors /*= core::Tensor()*/) {
+    const core::Tensor transforms_cpu = PrepareTransforms(transforms, colors);
+    const int64_t n_instances = transforms_cpu.GetLength();
+    const int64_t n_points = lines.GetPointPositions().GetLength();
+
+    t::geometry::LineSet instances(kCPU);
+    instances.SetPointPositions(TransformVectors(lines.GetPointPositions(),
+                                                 transforms_cpu, false));
+    if (lines.HasLineIndices()) {
+        instances.SetLineIndices(OffsetIndices(lines.GetLineIndices(),
+                                               n_instances, n_points));
+        if (colors.NumElements() > 0) {
+            instances.SetLineColors(
+                    RepeatRows(colors, lines.GetLineIndices().GetLength()));
+        } else if (lines.HasLineColors()) {
+            instances.SetLineColors(
+                    TileRows(lines.GetLineColors(), n_instances));
+        }
+    }
+    return instances;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
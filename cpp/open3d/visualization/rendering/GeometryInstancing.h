@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/LineSet.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// Merges one transformed copy of \p mesh per instance into a single mesh,
+/// so that many repeated meshes (boxes, voxel cubes, glyphs) are rendered by
+/// one renderable with one draw call instead of one object each. Vertex
+/// positions, normals, colors and triangle indices are kept; the result is
+/// on the CPU with Float32 positions and normals.
+///
+/// \param mesh    The mesh to repeat.
+/// \param transforms    (N, 4, 4) model matrix of each instance.
+/// \param colors    Optional (N, 3) color of each instance, which replaces
+/// the vertex colors of \p mesh.
+t::geometry::TriangleMesh InstanceTriangleMesh(
+        const t::geometry::TriangleMesh& mesh,
+        const core::Tensor& transforms,
+        const core::Tensor& colors = core::Tensor());
+
+/// Same as InstanceTriangleMesh() for line sets, e.g. camera frustums. The
+/// optional per-instance \p colors replace the line colors.
+t::geometry::LineSet InstanceLineSet(
+        const t::geometry::LineSet& lines,
+        const core::Tensor& transforms,
+        const core::Tensor& colors = core::Tensor());
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -27,12 +27,19 @@
 #include "open3d/visualization/rendering/Open3DScene.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <set>
 
 #include "open3d/geometry/Geometry.h"
 #include "open3d/geometry/LineSet.h"
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/visualization/gui/Application.h"
+#include "open3d/visualization/rendering/Camera.h"
 #include "open3d/visualization/rendering/MaterialRecord.h"
+#include "open3d/visualization/rendering/PointCloudLOD.h"
 #include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/View.h"
 
@@ -43,6 +50,10 @@ namespace rendering {
 const std::string kAxisObjectName("__axis__");
 const std::string kFastModelObjectSuffix("__fast__");
 const std::string kLowQualityModelObjectSuffix("__low__");
+const std::string kLODNodeObjectSuffix("__lod__");
+// Limits the number of octree nodes uploaded per update such that the nodes
+// are streamed in over several frames instead of stalling a single one.
+const size_t kMaxLODNodesPerUpdate = 8;
 
 namespace {
 std::shared_ptr<geometry::TriangleMesh> CreateAxisGeometry(double axis_length) {
@@ -114,8 +125,21 @@ void RecreateAxis(Scene* scene,
     scene->ShowGeometry(kAxisObjectName, enabled);
 }
 
+std::string GetLODNodeName(const std::string& name, size_t node_idx) {
+    return name + "." + kLODNodeObjectSuffix + std::to_string(node_idx);
+}
+
 }  // namespace
 
+struct Open3DScene::LODData {
+    std::string name;
+    MaterialRecord material;
+    size_t point_budget;
+    std::future<std::shared_ptr<PointCloudLOD>> future;
+    std::shared_ptr<PointCloudLOD> hierarchy;
+    std::set<size_t> shown;
+};
+
 Open3DScene::Open3DScene(Renderer& renderer) : renderer_(renderer) {
     scene_ = renderer_.CreateScene();
     auto scene = renderer_.GetScene(scene_);
@@ -244,6 +268,9 @@ void Open3DScene::ClearGeometry() {
         if (!g.second.low_name.empty()) {
             scene->RemoveGeometry(g.second.low_name);
         }
+        if (g.second.lod) {
+            RemoveLODNodes(*g.second.lod);
+        }
     }
     geometries_.clear();
     bounds_ = geometry::AxisAlignedBoundingBox();
@@ -255,6 +282,38 @@ void Open3DScene::AddGeometry(
         const geometry::Geometry3D* geom,
         const MaterialRecord& mat,
         bool add_downsampled_copy_for_fast_rendering /*= true*/) {
+    auto scene = renderer_.GetScene(scene_);
+    if (point_cloud_lod_budget_ > 0 &&
+        geom->GetGeometryType() ==
+                geometry::Geometry::GeometryType::PointCloud &&
+        static_cast<const geometry::PointCloud*>(geom)->points_.size() >
+                downsample_threshold_) {
+        // The caller's cloud may not outlive this call, so the octree is
+        // built from a copy. Until it is ready a uniformly downsampled
+        // preview within the point budget is shown.
+        auto cloud = std::make_shared<geometry::PointCloud>(
+                *static_cast<const geometry::PointCloud*>(geom));
+        auto lod = std::make_shared<LODData>();
+        lod->name = name;
+        lod->material = mat;
+        lod->point_budget = point_cloud_lod_budget_;
+        lod->future = std::async(std::launch::async, [cloud]() {
+            return std::make_shared<PointCloudLOD>(*cloud);
+        });
+        const size_t every_k_points = size_t(std::ceil(
+                double(cloud->points_.size()) / double(lod->point_budget)));
+        auto preview = cloud->UniformDownSample(every_k_points);
+        if (scene->AddGeometry(name, *preview, mat)) {
+            bounds_ += cloud->GetAxisAlignedBoundingBox();
+            GeometryData info(name, "");
+            info.lod = lod;
+            geometries_[name] = info;
+            SetGeometryToLOD(info, lod_);
+        }
+        axis_dirty_ = true;
+        return;
+    }
+
     size_t downsample_threshold = SIZE_MAX;
     std::string fast_name;
     if (add_downsampled_copy_for_fast_rendering) {
@@ -262,7 +321,6 @@ void Open3DScene::AddGeometry(
         downsample_threshold = downsample_threshold_;
     }
 
-    auto scene = renderer_.GetScene(scene_);
     if (scene->AddGeometry(name, *geom, mat, fast_name, downsample_threshold)) {
         bounds_ += scene->GetGeometryBoundingBox(name);
         GeometryData info(name, "");
@@ -322,6 +380,24 @@ void Open3DScene::AddGeometry(
     axis_dirty_ = true;
 }
 
+void Open3DScene::AddInstancedGeometry(const std::string& name,
+                                       const t::geometry::Geometry* geom,
+                                       const core::Tensor& transforms,
+                                       const MaterialRecord& mat,
+                                       const core::Tensor& colors
+                                       /*= core::Tensor()*/) {
+    auto scene = renderer_.GetScene(scene_);
+    if (scene->AddInstancedGeometry(name, *geom, transforms, mat, colors)) {
+        bounds_ += scene->GetGeometryBoundingBox(name);
+        GeometryData info(name, "");
+        geometries_[name] = info;
+        SetGeometryToLOD(info, lod_);
+    }
+
+    // Axes may need to be recreated
+    axis_dirty_ = true;
+}
+
 bool Open3DScene::HasGeometry(const std::string& name) const {
     auto scene = renderer_.GetScene(scene_);
     return scene->HasGeometry(name);
@@ -338,6 +414,9 @@ void Open3DScene::RemoveGeometry(const std::string& name) {
         if (!g->second.low_name.empty()) {
             scene->RemoveGeometry(g->second.low_name);
         }
+        if (g->second.lod) {
+            RemoveLODNodes(*g->second.lod);
+        }
         geometries_.erase(name);
     }
 }
@@ -352,6 +431,12 @@ void Open3DScene::ModifyGeometryMaterial(const std::string& name,
             scene->OverrideMaterial(it->second.fast_name, mat);
         }
         // Don't want to override low_name, as that is a bounding box.
+        if (it->second.lod) {
+            it->second.lod->material = mat;
+            for (size_t node_idx : it->second.lod->shown) {
+                scene->OverrideMaterial(GetLODNodeName(name, node_idx), mat);
+            }
+        }
     }
 }
 
@@ -397,6 +482,13 @@ void Open3DScene::UpdateMaterial(const MaterialRecord& mat) {
         // if (!g.second.low_name.empty()) {
         //     scene->OverrideMaterial(g.second.low_name, mat);
         // }
+        if (g.second.lod) {
+            g.second.lod->material = mat;
+            for (size_t node_idx : g.second.lod->shown) {
+                scene->OverrideMaterial(
+                        GetLODNodeName(g.second.name, node_idx), mat);
+            }
+        }
     }
 }
 
@@ -436,6 +528,17 @@ void Open3DScene::SetGeometryToLOD(const GeometryData& data, LOD lod) {
         scene->ShowGeometry(data.low_name, false);
     }
 
+    if (data.lod) {
+        // Once the octree is ready its nodes replace the preview; they are
+        // managed by UpdatePointCloudLOD().
+        if (!data.visible) {
+            RemoveLODNodes(*data.lod);
+        } else if (!data.lod->hierarchy) {
+            scene->ShowGeometry(data.name, true);
+        }
+        return;
+    }
+
     if (data.visible) {
         if (lod == LOD::HIGH_DETAIL) {
             scene->ShowGeometry(data.name, true);
@@ -455,6 +558,81 @@ void Open3DScene::SetGeometryToLOD(const GeometryData& data, LOD lod) {
     }
 }
 
+void Open3DScene::RemoveLODNodes(LODData& lod) {
+    auto scene = renderer_.GetScene(scene_);
+    for (size_t node_idx : lod.shown) {
+        scene->RemoveGeometry(GetLODNodeName(lod.name, node_idx));
+    }
+    lod.shown.clear();
+}
+
+bool Open3DScene::UpdatePointCloudLOD() {
+    auto scene = renderer_.GetScene(scene_);
+    bool changed = false;
+    size_t num_added = 0;
+    for (auto& g : geometries_) {
+        if (!g.second.lod) {
+            continue;
+        }
+        LODData& lod = *g.second.lod;
+        if (!lod.hierarchy) {
+            if (lod.future.wait_for(std::chrono::seconds(0)) !=
+                std::future_status::ready) {
+                continue;
+            }
+            lod.hierarchy = lod.future.get();
+            scene->ShowGeometry(g.second.name, false);
+            changed = true;
+        }
+        if (!g.second.visible) {
+            continue;
+        }
+        // Keep the current nodes while the camera is moving, uploading new
+        // nodes would only slow down the interaction.
+        if (lod_ == LOD::FAST && !lod.shown.empty()) {
+            continue;
+        }
+
+        auto view = GetView();
+        auto camera = view->GetCamera();
+        const std::vector<size_t> selected = lod.hierarchy->SelectNodes(
+                camera->GetViewMatrix().matrix(),
+                camera->GetProjectionMatrix().matrix(),
+                float(view->GetViewport()[3]), lod.point_budget);
+        const std::set<size_t> selected_set(selected.begin(), selected.end());
+
+        // Nodes are selected coarse to fine, so adding them in order
+        // refines the cloud progressively.
+        for (size_t node_idx : selected) {
+            if (num_added >= kMaxLODNodesPerUpdate) {
+                break;
+            }
+            if (lod.shown.count(node_idx)) {
+                continue;
+            }
+            const PointCloudLOD::Node& node =
+                    lod.hierarchy->GetNodes()[node_idx];
+            const std::string node_name =
+                    GetLODNodeName(g.second.name, node_idx);
+            if (scene->AddGeometry(node_name, *node.cloud, lod.material)) {
+                lod.shown.insert(node_idx);
+                ++num_added;
+                changed = true;
+            }
+        }
+        for (auto it = lod.shown.begin(); it != lod.shown.end();) {
+            if (selected_set.count(*it)) {
+                ++it;
+            } else {
+                scene->RemoveGeometry(GetLODNodeName(g.second.name, *it));
+                it = lod.shown.erase(it);
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
 Open3DScene::LOD Open3DScene::GetLOD() const { return lod_; }
 
 Scene* Open3DScene::GetScene() const { return renderer_.GetScene(scene_); }
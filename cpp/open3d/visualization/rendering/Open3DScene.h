@@ -27,8 +27,10 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <vector>
 
+#include "open3d/core/Tensor.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/visualization/rendering/Renderer.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
@@ -91,6 +93,21 @@ public:
     }
     size_t GetDownsampleThreshold() const { return downsample_threshold_; }
 
+    /// Sets the maximum number of points drawn for each point cloud that is
+    /// rendered with a level-of-detail hierarchy. If non-zero, legacy point
+    /// clouds with more points than the downsample threshold that are added
+    /// afterwards are split into an octree in a background thread, and
+    /// UpdatePointCloudLOD() streams in the nodes that are visible from the
+    /// current camera. 0 (the default) disables the hierarchy.
+    void SetPointCloudLODBudget(size_t n_points) {
+        point_cloud_lod_budget_ = n_points;
+    }
+    size_t GetPointCloudLODBudget() const { return point_cloud_lod_budget_; }
+
+    /// Updates the octree nodes that are shown for the current camera.
+    /// Returns true if geometries were added to or removed from the scene.
+    bool UpdatePointCloudLOD();
+
     void ClearGeometry();
     /// Adds a geometry with the specified name. Default visible is true.
     void AddGeometry(const std::string& name,
@@ -104,6 +121,14 @@ public:
                      const t::geometry::Geometry* geom,
                      const MaterialRecord& mat,
                      bool add_downsampled_copy_for_fast_rendering = true);
+    /// Adds \p geom (a t::geometry::TriangleMesh or LineSet) once per
+    /// (4, 4) model matrix in \p transforms as a single object, drawn with
+    /// one draw call. \p colors optionally gives a (N, 3) color per instance.
+    void AddInstancedGeometry(const std::string& name,
+                              const t::geometry::Geometry* geom,
+                              const core::Tensor& transforms,
+                              const MaterialRecord& mat,
+                              const core::Tensor& colors = core::Tensor());
     bool HasGeometry(const std::string& name) const;
     void RemoveGeometry(const std::string& name);
     /// Shows or hides the geometry with the specified name.
@@ -133,11 +158,14 @@ public:
     Renderer& GetRenderer() const;
 
 private:
+    struct LODData;
+
     struct GeometryData {
         std::string name;
         std::string fast_name;
         std::string low_name;
         bool visible;
+        std::shared_ptr<LODData> lod;
 
         GeometryData() : visible(false) {}  // for STL containers
         GeometryData(const std::string& n, const std::string& fast)
@@ -145,6 +173,7 @@ private:
     };
 
     void SetGeometryToLOD(const GeometryData&, LOD lod);
+    void RemoveLODNodes(LODData& lod);
 
 private:
     Renderer& renderer_;
@@ -158,6 +187,7 @@ private:
     std::map<std::string, GeometryData> geometries_;  // name -> data
     geometry::AxisAlignedBoundingBox bounds_;
     size_t downsample_threshold_ = 6000000;
+    size_t point_cloud_lod_budget_ = 0;
 };
 
 }  // namespace rendering
@@ -0,0 +1,246 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/rendering/PointCloudLOD.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <unordered_set>
+
+#include "open3d/geometry/PointCloud.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+namespace {
+
+std::shared_ptr<geometry::PointCloud> CopyPoints(
+        const geometry::PointCloud& cloud, const std::vector<size_t>& indices) {
+    auto result = std::make_shared<geometry::PointCloud>();
+    result->points_.reserve(indices.size());
+    for (size_t idx : indices) {
+        result->points_.push_back(cloud.points_[idx]);
+    }
+    if (cloud.HasColors()) {
+        result->colors_.reserve(indices.size());
+        for (size_t idx : indices) {
+            result->colors_.push_back(cloud.colors_[idx]);
+        }
+    }
+    if (cloud.HasNormals()) {
+        result->normals_.reserve(indices.size());
+        for (size_t idx : indices) {
+            result->normals_.push_back(cloud.normals_[idx]);
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
+PointCloudLOD::PointCloudLOD(const geometry::PointCloud& cloud,
+                             int grid_size /*= 128*/,
+                             size_t max_leaf_points /*= 20000*/,
+                             int max_depth /*= 20*/)
+    : grid_size_(grid_size),
+      max_leaf_points_(max_leaf_points),
+      max_depth_(max_depth) {
+    if (cloud.IsEmpty()) {
+        return;
+    }
+    num_points_ = cloud.points_.size();
+
+    Node root;
+    root.min_bound = cloud.GetMinBound();
+    root.size = (cloud.GetMaxBound() - root.min_bound).maxCoeff();
+    root.depth = 0;
+    nodes_.push_back(root);
+
+    std::vector<size_t> indices(num_points_);
+    std::iota(indices.begin(), indices.end(), 0);
+    Build(cloud, 0, indices);
+}
+
+void PointCloudLOD::Build(const geometry::PointCloud& cloud,
+                          size_t node_idx,
+                          std::vector<size_t>& indices) {
+    // Copy the node data, nodes_ may be reallocated by the recursion.
+    const Eigen::Vector3d min_bound = nodes_[node_idx].min_bound;
+    const double size = nodes_[node_idx].size;
+    const int depth = nodes_[node_idx].depth;
+    nodes_[node_idx].children.fill(-1);
+
+    std::vector<size_t> kept;
+    std::array<std::vector<size_t>, 8> child_indices;
+    if (indices.size() <= max_leaf_points_ || depth >= max_depth_ ||
+        size <= 0) {
+        kept.swap(indices);
+    } else {
+        const double inv_cell_size = grid_size_ / size;
+        const Eigen::Vector3d center =
+                min_bound + Eigen::Vector3d::Constant(size / 2);
+        std::unordered_set<int64_t> occupied;
+        for (size_t idx : indices) {
+            const Eigen::Vector3d& p = cloud.points_[idx];
+            const Eigen::Vector3i cell = ((p - min_bound) * inv_cell_size)
+                                                 .array()
+                                                 .floor()
+                                                 .cast<int>()
+                                                 .max(0)
+                                                 .min(grid_size_ - 1);
+            const int64_t key =
+                    (int64_t(cell(0)) * grid_size_ + cell(1)) * grid_size_ +
+                    cell(2);
+            if (occupied.insert(key).second) {
+                kept.push_back(idx);
+            } else {
+                const int octant = (p(0) >= center(0) ? 1 : 0) |
+                                   (p(1) >= center(1) ? 2 : 0) |
+                                   (p(2) >= center(2) ? 4 : 0);
+                child_indices[octant].push_back(idx);
+            }
+        }
+        std::vector<size_t>().swap(indices);
+    }
+    nodes_[node_idx].cloud = CopyPoints(cloud, kept);
+    std::vector<size_t>().swap(kept);
+
+    for (int octant = 0; octant < 8; ++octant) {
+        if (child_indices[octant].empty()) {
+            continue;
+        }
+        Node child;
+        child.size = size / 2;
+        child.min_bound = min_bound + child.size * Eigen::Vector3d(
+                                                           octant & 1,
+                                                           (octant >> 1) & 1,
+                                                           (octant >> 2) & 1);
+        child.depth = depth + 1;
+        const size_t child_idx = nodes_.size();
+        nodes_.push_back(child);
+        nodes_[node_idx].children[octant] = int(child_idx);
+        Build(cloud, child_idx, child_indices[octant]);
+    }
+}
+
+std::vector<size_t> PointCloudLOD::SelectNodes(
+        const Eigen::Matrix4f& view,
+        const Eigen::Matrix4f& projection,
+        float viewport_height,
+        size_t point_budget,
+        float min_node_size /*= 100.f*/) const {
+    std::vector<size_t> selected;
+    if (nodes_.empty()) {
+        return selected;
+    }
+
+    const Eigen::Matrix4f view_projection = projection * view;
+    const bool perspective = projection(3, 3) == 0.f;
+    const float scale = std::abs(projection(1, 1)) * viewport_height / 2;
+
+    // Returns the projected radius of the bounding sphere of the node in
+    // pixels or -1 if the node is outside of the view frustum.
+    auto projected_size = [&](const Node& node) {
+        const float size = float(node.size);
+        const Eigen::Vector3f min_bound = node.min_bound.cast<float>();
+        // Count the corners outside of the side planes and behind the camera.
+        // The node is culled if all corners are outside of the same plane.
+        std::array<int, 5> outside = {0, 0, 0, 0, 0};
+        for (int i = 0; i < 8; ++i) {
+            const Eigen::Vector3f corner =
+                    min_bound + size * Eigen::Vector3f(float(i & 1),
+                                                       float((i >> 1) & 1),
+                                                       float((i >> 2) & 1));
+            const Eigen::Vector4f c = view_projection * corner.homogeneous();
+            outside[0] += c.x() < -c.w();
+            outside[1] += c.x() > c.w();
+            outside[2] += c.y() < -c.w();
+            outside[3] += c.y() > c.w();
+            outside[4] += c.w() <= 0;
+        }
+        for (int count : outside) {
+            if (count == 8) {
+                return -1.f;
+            }
+        }
+
+        const float radius = size * std::sqrt(3.f) / 2;
+        if (!perspective) {
+            return radius * scale;
+        }
+        const Eigen::Vector3f center =
+                min_bound + Eigen::Vector3f::Constant(size / 2);
+        const float distance =
+                (view * center.homogeneous()).head<3>().norm();
+        if (distance <= radius) {
+            return std::numeric_limits<float>::max();
+        }
+        return radius / distance * scale;
+    };
+
+    // Visit the nodes with the largest projected size first. Children are
+    // only queued after their parent has been selected.
+    std::priority_queue<std::pair<float, size_t>> queue;
+    const float root_size = projected_size(nodes_[0]);
+    if (root_size >= 0) {
+        queue.push({root_size, 0});
+    }
+    size_t num_points = 0;
+    while (!queue.empty()) {
+        const std::pair<float, size_t> top = queue.top();
+        queue.pop();
+        const Node& node = nodes_[top.second];
+        const size_t node_points = node.cloud->points_.size();
+        if (num_points + node_points > point_budget) {
+            break;
+        }
+        num_points += node_points;
+        selected.push_back(top.second);
+
+        if (top.first < min_node_size) {
+            continue;
+        }
+        for (int child : node.children) {
+            if (child < 0) {
+                continue;
+            }
+            const float child_size = projected_size(nodes_[child]);
+            if (child_size >= 0) {
+                queue.push({child_size, size_t(child)});
+            }
+        }
+    }
+    return selected;
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
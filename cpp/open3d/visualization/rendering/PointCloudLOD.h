@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}  // namespace geometry
+
+namespace visualization {
+namespace rendering {
+
+/// Level of detail hierarchy for rendering large point clouds, similar to
+/// Potree. The bounding cube of the cloud is recursively split into an
+/// octree. Each node stores a subsample of the points in its cube with at
+/// most one point per cell of a grid_size^3 grid; the remaining points are
+/// passed on to the children. Rendering a node together with any subset of
+/// its ancestors therefore never duplicates points, and the density of the
+/// rendered cloud increases with every level that is added.
+class PointCloudLOD {
+public:
+    struct Node {
+        /// Minimum corner of the cube of this node.
+        Eigen::Vector3d min_bound;
+        /// Edge length of the cube of this node.
+        double size;
+        int depth;
+        /// The points stored in this node.
+        std::shared_ptr<geometry::PointCloud> cloud;
+        /// Indices of the children or -1 if a child does not exist.
+        std::array<int, 8> children;
+    };
+
+    /// Builds the hierarchy. This copies the points, colors and normals of
+    /// \p cloud and may take a while for large clouds, so it is usually run
+    /// in a background thread.
+    ///
+    /// \param cloud    The input point cloud.
+    /// \param grid_size    Resolution of the sampling grid of each node.
+    /// \param max_leaf_points    Nodes with at most this number of points are
+    /// not split.
+    /// \param max_depth    The maximum depth of the octree.
+    PointCloudLOD(const geometry::PointCloud& cloud,
+                  int grid_size = 128,
+                  size_t max_leaf_points = 20000,
+                  int max_depth = 20);
+
+    const std::vector<Node>& GetNodes() const { return nodes_; }
+    size_t GetNumPoints() const { return num_points_; }
+
+    /// Selects the nodes to render for a camera. Nodes outside the view
+    /// frustum are skipped. The remaining nodes are visited in the order of
+    /// their projected size, starting at the root, until the total number of
+    /// points would exceed \p point_budget. The children of a node are only
+    /// visited if its projected size is at least \p min_node_size pixels.
+    ///
+    /// \param view    The world to camera transform.
+    /// \param projection    The projection matrix of the camera.
+    /// \param viewport_height    The height of the viewport in pixels.
+    /// \param point_budget    The maximum number of points of the selected
+    /// nodes.
+    /// \param min_node_size    Minimum projected size of a node in pixels for
+    /// refining it.
+    /// \return The indices of the selected nodes, parents before children.
+    std::vector<size_t> SelectNodes(const Eigen::Matrix4f& view,
+                                    const Eigen::Matrix4f& projection,
+                                    float viewport_height,
+                                    size_t point_budget,
+                                    float min_node_size = 100.f) const;
+
+private:
+    void Build(const geometry::PointCloud& cloud,
+               size_t node_idx,
+               std::vector<size_t>& indices);
+
+    int grid_size_;
+    size_t max_leaf_points_;
+    int max_depth_;
+    size_t num_points_ = 0;
+    std::vector<Node> nodes_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
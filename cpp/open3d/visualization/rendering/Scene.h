@@ -34,6 +34,10 @@
 #include "open3d/visualization/rendering/RendererHandle.h"
 
 namespace open3d {
+namespace core {
+class Tensor;
+}  // namespace core
+
 namespace geometry {
 class Geometry3D;
 class AxisAlignedBoundingBox;
@@ -102,10 +106,29 @@ public:
                              size_t downsample_threshold = SIZE_MAX) = 0;
     virtual bool AddGeometry(const std::string& object_name,
                              const TriangleMeshModel& model) = 0;
+    /// Adds one object made of copies of \p geometry (a
+    /// t::geometry::TriangleMesh or LineSet), one per (4, 4) model matrix in
+    /// the (N, 4, 4) tensor \p transforms, so that all instances are drawn
+    /// with a single draw call. \p colors optionally gives the (N, 3) color
+    /// of each instance; pass an empty tensor to keep the geometry's colors.
+    virtual bool AddInstancedGeometry(const std::string& object_name,
+                                      const t::geometry::Geometry& geometry,
+                                      const core::Tensor& transforms,
+                                      const MaterialRecord& material,
+                                      const core::Tensor& colors) = 0;
     virtual bool HasGeometry(const std::string& object_name) const = 0;
+    /// Updates the flagged attributes of a point cloud that was added with
+    /// AddGeometry(). The points of \p point_cloud replace the points starting
+    /// at \p first_point, so a live view can upload only the range that
+    /// changed or append new points. The vertex buffer keeps the capacity it
+    /// was created with: add the cloud with spare (e.g. zero) points to
+    /// reserve room for appending. If \p first_point is 0 the number of drawn
+    /// points is set to the size of \p point_cloud, otherwise it grows to
+    /// include the updated range.
     virtual void UpdateGeometry(const std::string& object_name,
                                 const t::geometry::PointCloud& point_cloud,
-                                uint32_t update_flags) = 0;
+                                uint32_t update_flags,
+                                uint32_t first_point = 0) = 0;
     virtual void RemoveGeometry(const std::string& object_name) = 0;
     virtual void ShowGeometry(const std::string& object_name, bool show) = 0;
     virtual bool GeometryIsVisible(const std::string& object_name) = 0;
@@ -26,6 +26,7 @@
 
 #include "open3d/visualization/rendering/filament/FilamentGeometryBuffersBuilder.h"
 
+#include "open3d/core/MemoryManager.h"
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/Octree.h"
@@ -285,6 +286,16 @@ std::unique_ptr<GeometryBuffersBuilder> GeometryBuffersBuilder::GetBuilder(
     return nullptr;
 }
 
+float* GeometryBuffersBuilder::CopyTensorToFloatBuffer(
+        const core::Tensor& tensor) {
+    const core::Tensor src = tensor.To(core::Float32).Contiguous();
+    const size_t num_bytes = src.NumElements() * sizeof(float);
+    float* buffer = static_cast<float*>(malloc(num_bytes));
+    core::MemoryManager::MemcpyToHost(buffer, src.GetDataPtr(), src.GetDevice(),
+                                      num_bytes);
+    return buffer;
+}
+
 void GeometryBuffersBuilder::DeallocateBuffer(void* buffer,
                                               size_t size,
                                               void* user_ptr) {
@@ -112,13 +112,20 @@ public:
     virtual Buffers ConstructBuffers() = 0;
     virtual filament::Box ComputeAABB() = 0;
 
+    // Copies the tensor into a newly allocated host array of Float32 values
+    // that must be released with DeallocateBuffer(), e.g. by passing it to a
+    // Filament BufferDescriptor. The Float32 conversion and compaction run on
+    // the tensor's device, so a CUDA tensor is transferred only once, directly
+    // into the array.
+    static float* CopyTensorToFloatBuffer(const core::Tensor& tensor);
+
+    static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr);
+
 protected:
     size_t downsample_threshold_ = SIZE_MAX;
     bool wide_lines_ = false;
     bool adjust_colors_for_srgb_tonemapping_ = true;
 
-    static void DeallocateBuffer(void* buffer, size_t size, void* user_ptr);
-
     static IndexBufferHandle CreateIndexBuffer(size_t max_index,
                                                size_t n_subsamples = SIZE_MAX);
 };
@@ -77,6 +77,7 @@ FilamentRenderToBuffer::~FilamentRenderToBuffer() {
         buffer_ = nullptr;
 
         buffer_size_ = 0;
+        buffer_capacity_ = 0;
     }
 }
 
@@ -128,12 +129,15 @@ void FilamentRenderToBuffer::Configure(const View* view,
 
 void FilamentRenderToBuffer::SetDimensions(const std::uint32_t width,
                                            const std::uint32_t height) {
-    if (swapchain_) {
-        engine_.destroy(swapchain_);
+    // The swap chain and the pixel buffer are kept when this object is reused
+    // for another request of the same size.
+    if (!swapchain_ || width != width_ || height != height_) {
+        if (swapchain_) {
+            engine_.destroy(swapchain_);
+        }
+        swapchain_ = engine_.createSwapChain(
+                width, height, filament::SwapChain::CONFIG_READABLE);
     }
-
-    swapchain_ = engine_.createSwapChain(width, height,
-                                         filament::SwapChain::CONFIG_READABLE);
     view_->SetViewport(0, 0, width, height);
 
     width_ = width;
@@ -144,14 +148,21 @@ void FilamentRenderToBuffer::SetDimensions(const std::uint32_t width,
     } else {
         buffer_size_ = width * height * n_channels_ * sizeof(std::uint8_t);
     }
-    if (buffer_) {
-        buffer_ = static_cast<std::uint8_t*>(realloc(buffer_, buffer_size_));
-    } else {
-        buffer_ = static_cast<std::uint8_t*>(malloc(buffer_size_));
+    if (buffer_size_ > buffer_capacity_) {
+        if (buffer_) {
+            buffer_ = static_cast<std::uint8_t*>(
+                    realloc(buffer_, buffer_size_));
+        } else {
+            buffer_ = static_cast<std::uint8_t*>(malloc(buffer_size_));
+        }
+        buffer_capacity_ = buffer_size_;
     }
 }
 
 void FilamentRenderToBuffer::CopySettings(const View* view) {
+    if (view_) {
+        delete view_;
+    }
     view_ = new FilamentView(engine_, EngineInstance::GetResourceManager());
     auto* downcast = dynamic_cast<const FilamentView*>(view);
     if (downcast) {
@@ -82,6 +82,7 @@ private:
     std::size_t n_channels_ = 0;
     std::uint8_t* buffer_ = nullptr;
     std::size_t buffer_size_ = 0;
+    std::size_t buffer_capacity_ = 0;
     bool depth_image_ = false;
 
     BufferReadyCallback callback_;
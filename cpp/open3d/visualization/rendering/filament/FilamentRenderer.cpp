@@ -55,6 +55,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
 #include "open3d/visualization/rendering/filament/FilamentCamera.h"
 #include "open3d/visualization/rendering/filament/FilamentEntitiesMods.h"
 #include "open3d/visualization/rendering/filament/FilamentRenderToBuffer.h"
@@ -66,6 +67,12 @@ namespace open3d {
 namespace visualization {
 namespace rendering {
 
+namespace {
+// Maximum number of idle buffer renderers kept for reuse. A few are enough to
+// render several views per frame without recreating them.
+const size_t kMaxIdleBufferRenderers = 8;
+}  // namespace
+
 FilamentRenderer::FilamentRenderer(filament::Engine& engine,
                                    void* native_drawable,
                                    FilamentResourceManager& resource_mgr)
@@ -90,6 +97,7 @@ FilamentRenderer::FilamentRenderer(filament::Engine& engine,
 }
 
 FilamentRenderer::~FilamentRenderer() {
+    idle_buffer_renderers_.clear();
     scenes_.clear();
 
     engine_.destroy(renderer_);
@@ -114,6 +122,8 @@ Scene* FilamentRenderer::GetScene(const SceneHandle& id) const {
 }
 
 void FilamentRenderer::DestroyScene(const SceneHandle& id) {
+    // Idle buffer renderers may still have a view of the scene attached.
+    idle_buffer_renderers_.clear();
     scenes_.erase(id);
 }
 
@@ -171,11 +181,16 @@ void FilamentRenderer::UpdateBitmapSwapChain(int width, int height) {
 }
 
 void FilamentRenderer::BeginFrame() {
-    // We will complete render to buffer requests first
+    // We will complete render to buffer requests first. All pending requests,
+    // e.g. several views of the same scene, are submitted together and read
+    // back with a single flush.
     if (!buffer_renderers_.empty()) {
+        utility::Timer timer;
+        timer.Start();
         for (auto& br : buffer_renderers_) {
             if (br->pending_) {
                 br->Render();
+                buffer_stats_.n_buffers++;
             }
         }
 
@@ -184,7 +199,18 @@ void FilamentRenderer::BeginFrame() {
         // pixels callback does not get called until sometime later,
         // possibly several draws later.
         engine_.flushAndWait();
+        timer.Stop();
+        buffer_stats_.n_frames++;
+        buffer_stats_.total_time_ms += timer.GetDuration();
 
+        // Keep the renderers that are done and no longer referenced
+        // elsewhere for the next requests.
+        for (auto& br : buffer_renderers_) {
+            if (br.use_count() == 1 && br->frame_done_ && !br->pending_ &&
+                idle_buffer_renderers_.size() < kMaxIdleBufferRenderers) {
+                idle_buffer_renderers_.push_back(br);
+            }
+        }
         buffer_renderers_.clear();  // Cleanup
     }
 
@@ -221,6 +247,25 @@ void FilamentRenderer::EndFrame() {
     }
 }
 
+std::vector<std::array<int, 4>> FilamentRenderer::GetPendingViewports() const {
+    std::vector<std::array<int, 4>> viewports;
+    for (const auto& pair : scenes_) {
+        auto scene_viewports = pair.second->GetPendingViewports();
+        viewports.insert(viewports.end(), scene_viewports.begin(),
+                         scene_viewports.end());
+    }
+    return viewports;
+}
+
+bool FilamentRenderer::HasPendingBufferRenders() const {
+    for (const auto& br : buffer_renderers_) {
+        if (br->pending_) {
+            return true;
+        }
+    }
+    return false;
+}
+
 namespace {
 
 struct UserData {
@@ -244,6 +289,15 @@ void FilamentRenderer::RequestReadPixels(
         int width,
         int height,
         std::function<void(std::shared_ptr<core::Tensor>)> callback) {
+    RequestReadPixels(0, 0, width, height, callback);
+}
+
+void FilamentRenderer::RequestReadPixels(
+        int x,
+        int y,
+        int width,
+        int height,
+        std::function<void(std::shared_ptr<core::Tensor>)> callback) {
     core::SizeVector shape{height, width, 3};
     core::Dtype dtype = core::UInt8;
     int64_t nbytes = shape.NumElements() * dtype.ByteSize();
@@ -257,7 +311,7 @@ void FilamentRenderer::RequestReadPixels(
     PixelBufferDescriptor pd(image->GetDataPtr(), nbytes, PixelDataFormat::RGB,
                              PixelDataType::UBYTE, ReadPixelsCallback,
                              user_data);
-    renderer_->readPixels(0, 0, width, height, std::move(pd));
+    renderer_->readPixels(x, y, width, height, std::move(pd));
     needs_wait_after_draw_ = true;
 }
 
@@ -326,12 +380,14 @@ bool FilamentRenderer::UpdateTexture(
         TextureHandle texture,
         const std::shared_ptr<geometry::Image> image,
         bool srgb) {
+    texture_generation_++;
     return resource_mgr_.UpdateTexture(texture, image, srgb);
 }
 
 bool FilamentRenderer::UpdateTexture(TextureHandle texture,
                                      const t::geometry::Image& image,
                                      bool srgb) {
+    texture_generation_++;
     return resource_mgr_.UpdateTexture(texture, image, srgb);
 }
 
@@ -369,7 +425,15 @@ void FilamentRenderer::RemoveSkybox(const SkyboxHandle& id) {
 }
 
 std::shared_ptr<RenderToBuffer> FilamentRenderer::CreateBufferRenderer() {
-    auto renderer = std::make_shared<FilamentRenderToBuffer>(engine_);
+    std::shared_ptr<FilamentRenderToBuffer> renderer;
+    if (!idle_buffer_renderers_.empty()) {
+        renderer = idle_buffer_renderers_.back();
+        idle_buffer_renderers_.pop_back();
+        buffer_stats_.n_renderers_reused++;
+    } else {
+        renderer = std::make_shared<FilamentRenderToBuffer>(engine_);
+        buffer_stats_.n_renderers_created++;
+    }
     buffer_renderers_.insert(renderer);
     return renderer;
 }
@@ -26,9 +26,12 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "open3d/visualization/rendering/Renderer.h"
 
@@ -78,6 +81,15 @@ public:
                            int height,
                            std::function<void(std::shared_ptr<core::Tensor>)>
                                    callback) override;
+    // Reads back only the given region, with the origin at the bottom left.
+    // The image has the region's size and its rows are ordered like those of
+    // a full readback.
+    void RequestReadPixels(int x,
+                           int y,
+                           int width,
+                           int height,
+                           std::function<void(std::shared_ptr<core::Tensor>)>
+                                   callback);
     void EndFrame() override;
 
     void SetOnAfterDraw(std::function<void()> callback) override;
@@ -120,6 +132,35 @@ public:
 
     filament::Renderer* GetNative() { return renderer_; }
 
+    // Counters for render to buffer requests (e.g. RenderToImage()), which
+    // can be used to monitor the throughput of offscreen rendering.
+    struct RenderToBufferStats {
+        // Number of BeginFrame() calls that processed requests
+        size_t n_frames = 0;
+        // Number of rendered and read back buffers
+        size_t n_buffers = 0;
+        // Number of buffer renderers that had to be created, and that were
+        // reused from the pool instead
+        size_t n_renderers_created = 0;
+        size_t n_renderers_reused = 0;
+        // Time spent rendering and reading back buffers
+        double total_time_ms = 0.0;
+    };
+    const RenderToBufferStats& GetRenderToBufferStats() const {
+        return buffer_stats_;
+    }
+    void ResetRenderToBufferStats() { buffer_stats_ = RenderToBufferStats(); }
+
+    // Damage tracking, for window systems that only render the frames that
+    // changed. Returns the viewports (origin at the bottom left) of the 3D
+    // views that the next Draw() will render.
+    std::vector<std::array<int, 4>> GetPendingViewports() const;
+    // Incremented by every in-place texture update, since those change what
+    // is drawn without changing the GUI draw commands.
+    std::uint64_t GetTextureGeneration() const { return texture_generation_; }
+    // True if render to buffer requests are waiting for BeginFrame()
+    bool HasPendingBufferRenders() const;
+
 private:
     friend class FilamentRenderToBuffer;
 
@@ -137,6 +178,13 @@ private:
 
     std::unordered_set<std::shared_ptr<FilamentRenderToBuffer>>
             buffer_renderers_;
+    // Buffer renderers that finished their request. Reusing them avoids
+    // creating a Filament renderer, swap chain and pixel buffer per request.
+    std::vector<std::shared_ptr<FilamentRenderToBuffer>>
+            idle_buffer_renderers_;
+    RenderToBufferStats buffer_stats_;
+
+    std::uint64_t texture_generation_ = 0;
 
     bool frame_started_ = false;
     std::function<void()> on_after_draw_;
@@ -32,6 +32,7 @@
 //       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
 //       determine the if statement does not run.)
 // 4305: LightManager.h needs to specify some constants as floats
+#include <algorithm>
 #include <unordered_set>
 
 #ifdef _MSC_VER
@@ -73,8 +74,11 @@
 #include "open3d/geometry/LineSet.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/LineSet.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/visualization/rendering/GeometryInstancing.h"
 #include "open3d/visualization/rendering/Light.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Model.h"
@@ -424,6 +428,39 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     return success;
 }
 
+bool FilamentScene::AddInstancedGeometry(const std::string& object_name,
+                                         const t::geometry::Geometry& geometry,
+                                         const core::Tensor& transforms,
+                                         const MaterialRecord& material,
+                                         const core::Tensor& colors) {
+    // Filament does not instance renderables, so the instances are merged
+    // into one vertex buffer, which still renders with a single draw call.
+    using GT = t::geometry::Geometry::GeometryType;
+    switch (geometry.GetGeometryType()) {
+        case GT::TriangleMesh:
+            return AddGeometry(
+                    object_name,
+                    InstanceTriangleMesh(
+                            static_cast<const t::geometry::TriangleMesh&>(
+                                    geometry),
+                            transforms, colors),
+                    material);
+        case GT::LineSet:
+            return AddGeometry(
+                    object_name,
+                    InstanceLineSet(
+                            static_cast<const t::geometry::LineSet&>(geometry),
+                            transforms, colors),
+                    material);
+        default:
+            utility::LogWarning(
+                    "Geometry for instanced object {} must be a TriangleMesh "
+                    "or LineSet.",
+                    object_name);
+            return false;
+    }
+}
+
 #ifndef NDEBUG
 void OutputMaterialProperties(
         const visualization::rendering::MaterialRecord& mat) {
@@ -536,7 +573,8 @@ bool FilamentScene::HasGeometry(const std::string& object_name) const {
 
 void FilamentScene::UpdateGeometry(const std::string& object_name,
                                    const t::geometry::PointCloud& point_cloud,
-                                   uint32_t update_flags) {
+                                   uint32_t update_flags,
+                                   uint32_t first_point /*= 0*/) {
     auto geoms = GetGeometry(object_name, false);
     if (!geoms.empty()) {
         // Note: There should only be a single entry in geoms
@@ -547,73 +585,104 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
         const auto& points = point_cloud.GetPointPositions();
         const size_t n_vertices = points.GetLength();
 
-        // NOTE: number of points in the updated point cloud must be the
-        // same as the number of points when the vertex buffer was first
-        // created. If the number of points has changed then it cannot be
-        // updated. In that case, you must remove the geometry then add it
-        // again.
-        if (n_vertices > vbuf->getVertexCount()) {
+        // NOTE: the updated range must fit into the vertex buffer, which
+        // keeps the number of points it was first created with. If it does
+        // not fit, you must remove the geometry then add it again, ideally
+        // with room to spare for future updates.
+        if (first_point + n_vertices > vbuf->getVertexCount()) {
             utility::LogWarning(
                     "Geometry for point cloud {} cannot be updated because the "
                     "number of points exceeds the existing point count (Old: "
                     "{}, New: {})",
-                    object_name, vbuf->getVertexCount(), n_vertices);
+                    object_name, vbuf->getVertexCount(),
+                    first_point + n_vertices);
             return;
         }
 
-        bool geometry_update_needed = n_vertices != vbuf->getVertexCount();
-        bool pcloud_is_gpu =
-                points.GetDevice().GetType() == core::Device::DeviceType::CUDA;
-        t::geometry::PointCloud cpu_pcloud;
-        if (pcloud_is_gpu) {
-            cpu_pcloud = point_cloud.To(core::Device("CPU:0"));
-        }
+        const size_t num_drawn_points =
+                std::min(g->num_drawn_points, size_t(vbuf->getVertexCount()));
+        const size_t new_num_drawn_points =
+                first_point == 0 ? n_vertices
+                                 : std::max(num_drawn_points,
+                                            first_point + n_vertices);
+        bool geometry_update_needed = new_num_drawn_points != num_drawn_points;
+        // CPU data that is already Float32 is handed to Filament without a
+        // copy. Anything else, e.g. CUDA tensors, is converted on its device
+        // and copied once, straight into a buffer owned by Filament.
+        auto is_host_float = [](const core::Tensor& t) {
+            return t.GetDevice().GetType() == core::Device::DeviceType::CPU &&
+                   t.GetDtype() == core::Float32 && t.IsContiguous();
+        };
 
         // Update the each of the attribute requested
         if (update_flags & kUpdatePointsFlag) {
             const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto vertex_data =
-                        static_cast<float*>(malloc(vertex_array_size));
-                memcpy(vertex_data, cpu_pcloud.GetPointPositions().GetDataPtr(),
-                       vertex_array_size);
+            if (is_host_float(points)) {
                 filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        vertex_data, vertex_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
+                        points.GetDataPtr(), vertex_array_size);
+                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor),
+                                  first_point * 3 * sizeof(float));
             } else {
                 filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        points.GetDataPtr(), vertex_array_size);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
+                        GeometryBuffersBuilder::CopyTensorToFloatBuffer(points),
+                        vertex_array_size, DeallocateBuffer);
+                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor),
+                                  first_point * 3 * sizeof(float));
+            }
+
+            // Grow the bounds used for culling by the updated range, so
+            // appended points outside of the old bounds are not culled.
+            if (first_point > 0 && n_vertices > 0) {
+                auto& renderable_mgr = engine_.getRenderableManager();
+                auto inst = renderable_mgr.getInstance(g->filament_entity);
+                const core::Tensor min_bound =
+                        point_cloud.GetMinBound().To(core::Device("CPU:0"),
+                                                     core::Float32);
+                const core::Tensor max_bound =
+                        point_cloud.GetMaxBound().To(core::Device("CPU:0"),
+                                                     core::Float32);
+                const float* min_ptr = min_bound.GetDataPtr<float>();
+                const float* max_ptr = max_bound.GetDataPtr<float>();
+                filament::Box aabb;
+                aabb.set(filament::math::float3(min_ptr[0], min_ptr[1],
+                                                min_ptr[2]),
+                         filament::math::float3(max_ptr[0], max_ptr[1],
+                                                max_ptr[2]));
+                aabb.unionSelf(renderable_mgr.getAxisAlignedBoundingBox(inst));
+                renderable_mgr.setAxisAlignedBoundingBox(inst, aabb);
             }
         }
 
         if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
             const size_t color_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto color_data = static_cast<float*>(malloc(color_array_size));
-                memcpy(color_data, cpu_pcloud.GetPointPositions().GetDataPtr(),
-                       color_array_size);
+            const core::Tensor& colors = point_cloud.GetPointColors();
+            if (is_host_float(colors)) {
                 filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        color_data, color_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
+                        colors.GetDataPtr(), color_array_size);
+                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor),
+                                  first_point * 3 * sizeof(float));
             } else {
+                float* color_data =
+                        colors.GetDtype() == core::UInt8
+                                ? GeometryBuffersBuilder::
+                                          CopyTensorToFloatBuffer(
+                                                  colors.To(core::Float32) /
+                                                  255.0f)
+                                : GeometryBuffersBuilder::
+                                          CopyTensorToFloatBuffer(colors);
                 filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        point_cloud.GetPointColors().GetDataPtr(),
-                        color_array_size);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
+                        color_data, color_array_size, DeallocateBuffer);
+                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor),
+                                  first_point * 3 * sizeof(float));
             }
         }
 
         if (update_flags & kUpdateNormalsFlag &&
             point_cloud.HasPointNormals()) {
             const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-            const void* normal_data = nullptr;
-            if (pcloud_is_gpu) {
-                const auto& normals = point_cloud.GetPointNormals();
-                normal_data = normals.GetDataPtr();
-            } else {
-                normal_data = cpu_pcloud.GetPointNormals().GetDataPtr();
-            }
+            float* normal_data =
+                    GeometryBuffersBuilder::CopyTensorToFloatBuffer(
+                            point_cloud.GetPointNormals());
 
             // Converting normals to Filament type - quaternions
             auto float4v_tangents = static_cast<filament::math::quatf*>(
@@ -627,32 +696,45 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
             orientation->getQuats(float4v_tangents, n_vertices);
             filament::VertexBuffer::BufferDescriptor normals_descriptor(
                     float4v_tangents, normal_array_size, DeallocateBuffer);
-            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor));
+            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor),
+                              first_point * 4 * sizeof(float));
             delete orientation;
+            free(normal_data);
         }
 
         if (update_flags & kUpdateUv0Flag) {
             const size_t uv_array_size = n_vertices * 2 * sizeof(float);
             if (point_cloud.HasPointAttr("uv")) {
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        point_cloud.GetPointAttr("uv").GetDataPtr(),
-                        uv_array_size);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
+                const core::Tensor& uv = point_cloud.GetPointAttr("uv");
+                if (is_host_float(uv)) {
+                    filament::VertexBuffer::BufferDescriptor uv_descriptor(
+                            uv.GetDataPtr(), uv_array_size);
+                    vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor),
+                                      first_point * 2 * sizeof(float));
+                } else {
+                    filament::VertexBuffer::BufferDescriptor uv_descriptor(
+                            GeometryBuffersBuilder::CopyTensorToFloatBuffer(uv),
+                            uv_array_size, DeallocateBuffer);
+                    vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor),
+                                      first_point * 2 * sizeof(float));
+                }
             } else if (point_cloud.HasPointAttr("__visualization_scalar")) {
                 // Update in PointCloudBuffers.cpp, too:
                 //     TPointCloudBuffersBuilder::ConstructBuffers
                 float* uv_array = static_cast<float*>(malloc(uv_array_size));
                 memset(uv_array, 0, uv_array_size);
-                const float* src = static_cast<const float*>(
-                        point_cloud.GetPointAttr("__visualization_scalar")
-                                .GetDataPtr());
-                const size_t n = 2 * n_vertices;
-                for (size_t i = 0; i < n; i += 2) {
-                    uv_array[i] = *src++;
+                float* scalars =
+                        GeometryBuffersBuilder::CopyTensorToFloatBuffer(
+                                point_cloud.GetPointAttr(
+                                        "__visualization_scalar"));
+                for (size_t i = 0; i < n_vertices; ++i) {
+                    uv_array[2 * i] = scalars[i];
                 }
+                free(scalars);
                 filament::VertexBuffer::BufferDescriptor uv_descriptor(
                         uv_array, uv_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
+                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor),
+                                  first_point * 2 * sizeof(float));
             }
         }
 
@@ -662,7 +744,8 @@ void FilamentScene::UpdateGeometry(const std::string& object_name,
             auto inst = renderable_mgr.getInstance(g->filament_entity);
             renderable_mgr.setGeometryAt(
                     inst, 0, filament::RenderableManager::PrimitiveType::POINTS,
-                    0, n_vertices);
+                    0, new_num_drawn_points);
+            g->num_drawn_points = new_num_drawn_points;
         }
     }
 }
@@ -1897,6 +1980,17 @@ void FilamentScene::Draw(filament::Renderer& renderer) {
     }
 }
 
+std::vector<std::array<int, 4>> FilamentScene::GetPendingViewports() const {
+    std::vector<std::array<int, 4>> viewports;
+    for (const auto& pair : views_) {
+        const auto& container = pair.second;
+        if (container.is_active && container.render_count != 0) {
+            viewports.push_back(container.view->GetViewport());
+        }
+    }
+    return viewports;
+}
+
 }  // namespace rendering
 }  // namespace visualization
 }  // namespace open3d
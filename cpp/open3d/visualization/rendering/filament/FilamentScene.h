@@ -48,6 +48,7 @@
 #endif  // _MSC_VER
 
 #include <Eigen/Geometry>
+#include <array>
 #include <unordered_map>
 #include <vector>
 
@@ -123,10 +124,16 @@ public:
                      size_t downsample_threshold = SIZE_MAX) override;
     bool AddGeometry(const std::string& object_name,
                      const TriangleMeshModel& model) override;
+    bool AddInstancedGeometry(const std::string& object_name,
+                              const t::geometry::Geometry& geometry,
+                              const core::Tensor& transforms,
+                              const MaterialRecord& material,
+                              const core::Tensor& colors) override;
     bool HasGeometry(const std::string& object_name) const override;
     void UpdateGeometry(const std::string& object_name,
                         const t::geometry::PointCloud& point_cloud,
-                        uint32_t update_flags) override;
+                        uint32_t update_flags,
+                        uint32_t first_point = 0) override;
     void RemoveGeometry(const std::string& object_name) override;
     void ShowGeometry(const std::string& object_name, bool show) override;
     bool GeometryIsVisible(const std::string& object_name) override;
@@ -228,6 +235,9 @@ public:
             override;
 
     void Draw(filament::Renderer& renderer);
+    // Returns the viewports (x, y, width, height with the origin at the
+    // bottom left) of the views that the next Draw() will render.
+    std::vector<std::array<int, 4>> GetPendingViewports() const;
 
     // NOTE: Can GetNativeScene be removed?
     filament::Scene* GetNativeScene() const { return scene_; }
@@ -282,6 +292,9 @@ private:
         bool receive_shadows = true;
         bool culling_enabled = true;
         int priority = -1;  // default priority
+        // Number of drawn points after UpdateGeometry(), SIZE_MAX if all
+        // points of the vertex buffer are drawn.
+        size_t num_drawn_points = SIZE_MAX;
 
         GeometryMaterialInstance mat;
 
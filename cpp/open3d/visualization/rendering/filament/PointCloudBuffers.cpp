@@ -307,16 +307,12 @@ filament::Box PointCloudBuffersBuilder::ComputeAABB() {
 TPointCloudBuffersBuilder::TPointCloudBuffersBuilder(
         const t::geometry::PointCloud& geometry)
     : geometry_(geometry) {
-    // Make sure geometry is on CPU
+    // GPU resident point clouds stay on the GPU. The conversions below run on
+    // the device and ConstructBuffers() copies only the attributes that are
+    // rendered straight into the Filament buffers.
     auto pts = geometry.GetPointPositions();
-    if (pts.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
-        utility::LogWarning(
-                "GPU resident point clouds are not currently supported for "
-                "visualization. Copying data to CPU.");
-        geometry_ = geometry.To(core::Device("CPU:0"));
-    }
 
-    // Now make sure data types are Float32
+    // Make sure data types are Float32
     if (pts.GetDtype() != core::Float32) {
         utility::LogWarning(
                 "Tensor point cloud points must have DType of Float32 not {}. "
@@ -388,8 +384,7 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
     }
 
     const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
-    float* vertex_array = static_cast<float*>(malloc(vertex_array_size));
-    memcpy(vertex_array, points.GetDataPtr(), vertex_array_size);
+    float* vertex_array = CopyTensorToFloatBuffer(points);
     VertexBuffer::BufferDescriptor pts_descriptor(
             vertex_array, vertex_array_size,
             GeometryBuffersBuilder::DeallocateBuffer);
@@ -397,9 +392,8 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
 
     const size_t color_array_size = n_vertices * 3 * sizeof(float);
     if (geometry_.HasPointColors()) {
-        float* color_array = static_cast<float*>(malloc(color_array_size));
-        memcpy(color_array, geometry_.GetPointColors().GetDataPtr(),
-               color_array_size);
+        float* color_array =
+                CopyTensorToFloatBuffer(geometry_.GetPointColors());
         VertexBuffer::BufferDescriptor color_descriptor(
                 color_array, color_array_size,
                 GeometryBuffersBuilder::DeallocateBuffer);
@@ -417,7 +411,7 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
 
     const size_t normal_array_size = n_vertices * 4 * sizeof(float);
     if (geometry_.HasPointNormals()) {
-        const auto& normals = geometry_.GetPointNormals();
+        float* normals = CopyTensorToFloatBuffer(geometry_.GetPointNormals());
 
         // Converting normals to Filament type - quaternions
         auto float4v_tangents =
@@ -426,9 +420,10 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
                 filament::geometry::SurfaceOrientation::Builder()
                         .vertexCount(n_vertices)
                         .normals(reinterpret_cast<const math::float3*>(
-                                normals.GetDataPtr()))
+                                normals))
                         .build();
         orientation->getQuats(float4v_tangents, n_vertices);
+        free(normals);
         VertexBuffer::BufferDescriptor normals_descriptor(
                 float4v_tangents, normal_array_size,
                 GeometryBuffersBuilder::DeallocateBuffer);
@@ -449,21 +444,21 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
     }
 
     const size_t uv_array_size = n_vertices * 2 * sizeof(float);
-    float* uv_array = static_cast<float*>(malloc(uv_array_size));
+    float* uv_array = nullptr;
     if (geometry_.HasPointAttr("uv")) {
-        const float* uv_src = static_cast<const float*>(
-                geometry_.GetPointAttr("uv").GetDataPtr());
-        memcpy(uv_array, uv_src, uv_array_size);
+        uv_array = CopyTensorToFloatBuffer(geometry_.GetPointAttr("uv"));
     } else if (geometry_.HasPointAttr("__visualization_scalar")) {
         // Update in FilamentScene::UpdateGeometry(), too.
+        uv_array = static_cast<float*>(malloc(uv_array_size));
         memset(uv_array, 0, uv_array_size);
-        const float* src = static_cast<const float*>(
-                geometry_.GetPointAttr("__visualization_scalar").GetDataPtr());
-        const size_t n = 2 * n_vertices;
-        for (size_t i = 0; i < n; i += 2) {
-            uv_array[i] = *src++;
+        float* scalars = CopyTensorToFloatBuffer(
+                geometry_.GetPointAttr("__visualization_scalar"));
+        for (size_t i = 0; i < n_vertices; ++i) {
+            uv_array[2 * i] = scalars[i];
         }
+        free(scalars);
     } else {
+        uv_array = static_cast<float*>(malloc(uv_array_size));
         memset(uv_array, 0, uv_array_size);
     }
     VertexBuffer::BufferDescriptor uv_descriptor(
@@ -482,8 +477,8 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
 }
 
 filament::Box TPointCloudBuffersBuilder::ComputeAABB() {
-    auto min_bounds = geometry_.GetMinBound();
-    auto max_bounds = geometry_.GetMaxBound();
+    auto min_bounds = geometry_.GetMinBound().To(core::Device("CPU:0"));
+    auto max_bounds = geometry_.GetMaxBound().To(core::Device("CPU:0"));
     auto* min_bounds_float = min_bounds.GetDataPtr<float>();
     auto* max_bounds_float = max_bounds.GetDataPtr<float>();
 
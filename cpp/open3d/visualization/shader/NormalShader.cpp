@@ -50,20 +50,14 @@ bool NormalShader::Compile() {
 
 void NormalShader::Release() {
     UnbindGeometry();
+    ReleaseBuffer(vertex_position_buffer_);
+    ReleaseBuffer(vertex_normal_buffer_);
     ReleaseProgram();
 }
 
 bool NormalShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
-
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
     std::vector<Eigen::Vector3f> normals;
@@ -73,14 +67,10 @@ bool NormalShader::BindGeometry(const geometry::Geometry &geometry,
     }
 
     // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_normal_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
-                 normals.data(), GL_STATIC_DRAW);
+    UploadBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_,
+                 points.size() * sizeof(Eigen::Vector3f), points.data());
+    UploadBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_,
+                 normals.size() * sizeof(Eigen::Vector3f), normals.data());
     bound_ = true;
     return true;
 }
@@ -108,14 +98,6 @@ bool NormalShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void NormalShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_normal_buffer_);
-        bound_ = false;
-    }
-}
-
 bool NormalShaderForPointCloud::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
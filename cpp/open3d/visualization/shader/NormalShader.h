@@ -52,7 +52,6 @@ protected:
     bool RenderGeometry(const geometry::Geometry &geometry,
                         const RenderOption &option,
                         const ViewControl &view) final;
-    void UnbindGeometry() final;
 
 protected:
     virtual bool PrepareRendering(const geometry::Geometry &geometry,
@@ -66,9 +65,9 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    GLuint vertex_position_buffer_ = 0;
     GLuint vertex_normal_;
-    GLuint vertex_normal_buffer_;
+    GLuint vertex_normal_buffer_ = 0;
     GLuint MVP_;
     GLuint V_;
     GLuint M_;
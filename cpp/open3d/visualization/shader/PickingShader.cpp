@@ -49,20 +49,14 @@ bool PickingShader::Compile() {
 
 void PickingShader::Release() {
     UnbindGeometry();
+    ReleaseBuffer(vertex_position_buffer_);
+    ReleaseBuffer(vertex_index_buffer_);
     ReleaseProgram();
 }
 
 bool PickingShader::BindGeometry(const geometry::Geometry &geometry,
                                  const RenderOption &option,
                                  const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
-
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
     std::vector<float> indices;
@@ -72,14 +66,10 @@ bool PickingShader::BindGeometry(const geometry::Geometry &geometry,
     }
 
     // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_index_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_index_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, indices.size() * sizeof(float),
-                 indices.data(), GL_STATIC_DRAW);
+    UploadBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_,
+                 points.size() * sizeof(Eigen::Vector3f), points.data());
+    UploadBuffer(GL_ARRAY_BUFFER, vertex_index_buffer_,
+                 indices.size() * sizeof(float), indices.data());
 
     bound_ = true;
     return true;
@@ -106,14 +96,6 @@ bool PickingShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void PickingShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_index_buffer_);
-        bound_ = false;
-    }
-}
-
 bool PickingShaderForPointCloud::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
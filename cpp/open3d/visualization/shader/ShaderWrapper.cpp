@@ -56,6 +56,33 @@ void ShaderWrapper::InvalidateGeometry() {
     }
 }
 
+void ShaderWrapper::UploadBuffer(GLenum target,
+                                 GLuint &buffer,
+                                 GLsizeiptr size,
+                                 const void *data) {
+    if (buffer == 0) {
+        glGenBuffers(1, &buffer);
+    }
+    glBindBuffer(target, buffer);
+    GLint buffer_size = 0;
+    glGetBufferParameteriv(target, GL_BUFFER_SIZE, &buffer_size);
+    if (GLsizeiptr(buffer_size) == size && size > 0) {
+        // OpenGL 3.3 has no persistently mapped buffers; orphaning lets the
+        // driver hand out fresh storage while earlier frames still render.
+        glBufferData(target, size, NULL, GL_DYNAMIC_DRAW);
+        glBufferSubData(target, 0, size, data);
+    } else {
+        glBufferData(target, size, data, GL_DYNAMIC_DRAW);
+    }
+}
+
+void ShaderWrapper::ReleaseBuffer(GLuint &buffer) {
+    if (buffer != 0) {
+        glDeleteBuffers(1, &buffer);
+        buffer = 0;
+    }
+}
+
 void ShaderWrapper::PrintShaderWarning(const std::string &message) const {
     utility::LogWarning("[{}] {}", GetShaderName(), message);
 }
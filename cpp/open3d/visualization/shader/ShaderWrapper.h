@@ -80,7 +80,10 @@ protected:
     virtual bool RenderGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) = 0;
-    virtual void UnbindGeometry() = 0;
+    /// Geometry shaders upload with UploadBuffer() and keep their buffers for
+    /// the next BindGeometry(), Release() deletes them. Shaders that recreate
+    /// their resources on every binding release them here.
+    virtual void UnbindGeometry() { bound_ = false; }
 
 protected:
     bool ValidateShader(GLuint shader_index);
@@ -90,6 +93,20 @@ protected:
                         const char *const fragment_shader_code);
     void ReleaseProgram();
 
+    /// Uploads \p size bytes at \p data to \p buffer, which is created if it
+    /// is 0. A buffer that already has this size is reused: its old storage
+    /// is orphaned, so the driver does not wait for draws that still read it,
+    /// and the data is copied with glBufferSubData(). This way geometry that
+    /// changes every frame (e.g. Visualizer::UpdateGeometry()) neither
+    /// creates buffer objects nor stalls the pipeline.
+    void UploadBuffer(GLenum target,
+                      GLuint &buffer,
+                      GLsizeiptr size,
+                      const void *data);
+
+    /// Deletes \p buffer if it was created and resets it to 0.
+    void ReleaseBuffer(GLuint &buffer);
+
 protected:
     GLuint vertex_shader_ = 0;
     GLuint geometry_shader_ = 0;
@@ -47,20 +47,14 @@ bool Simple2DShader::Compile() {
 
 void Simple2DShader::Release() {
     UnbindGeometry();
+    ReleaseBuffer(vertex_position_buffer_);
+    ReleaseBuffer(vertex_color_buffer_);
     ReleaseProgram();
 }
 
 bool Simple2DShader::BindGeometry(const geometry::Geometry &geometry,
                                   const RenderOption &option,
                                   const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
-
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
     std::vector<Eigen::Vector3f> colors;
@@ -70,14 +64,10 @@ bool Simple2DShader::BindGeometry(const geometry::Geometry &geometry,
     }
 
     // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    UploadBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_,
+                 points.size() * sizeof(Eigen::Vector3f), points.data());
+    UploadBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_,
+                 colors.size() * sizeof(Eigen::Vector3f), colors.data());
 
     bound_ = true;
     return true;
@@ -103,14 +93,6 @@ bool Simple2DShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void Simple2DShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
-}
-
 bool Simple2DShaderForSelectionPolygon::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
@@ -49,20 +49,13 @@ bool SimpleBlackShader::Compile() {
 
 void SimpleBlackShader::Release() {
     UnbindGeometry();
+    ReleaseBuffer(vertex_position_buffer_);
     ReleaseProgram();
 }
 
 bool SimpleBlackShader::BindGeometry(const geometry::Geometry &geometry,
                                      const RenderOption &option,
                                      const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
-    UnbindGeometry();
-
     // Prepare data to be passed to GPU
     std::vector<Eigen::Vector3f> points;
     if (!PrepareBinding(geometry, option, view, points)) {
@@ -71,10 +64,8 @@ bool SimpleBlackShader::BindGeometry(const geometry::Geometry &geometry,
     }
 
     // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
+    UploadBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_,
+                 points.size() * sizeof(Eigen::Vector3f), points.data());
 
     bound_ = true;
     return true;
@@ -97,13 +88,6 @@ bool SimpleBlackShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void SimpleBlackShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        bound_ = false;
-    }
-}
-
 bool SimpleBlackShaderForPointCloudNormal::PrepareRendering(
         const geometry::Geometry &geometry,
         const RenderOption &option,
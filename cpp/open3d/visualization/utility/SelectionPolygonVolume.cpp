@@ -28,9 +28,13 @@
 
 #include <json/json.h>
 
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace visualization {
@@ -101,6 +105,56 @@ SelectionPolygonVolume::CropPointCloudInPolygon(
     return input.SelectByIndex(CropInPolygon(input.points_));
 }
 
+t::geometry::PointCloud SelectionPolygonVolume::CropPointCloud(
+        const t::geometry::PointCloud &input) const {
+    if (orthogonal_axis_ == "" || bounding_polygon_.empty() ||
+        input.IsEmpty()) {
+        return t::geometry::PointCloud(input.GetDevice());
+    }
+    const core::Tensor mask = GetPointMask(input.GetPointPositions());
+    t::geometry::PointCloud output(input.GetDevice());
+    for (const auto &kv : input.GetPointAttr()) {
+        output.SetPointAttr(kv.first, kv.second.IndexGet({mask}));
+    }
+    return output;
+}
+
+core::Tensor SelectionPolygonVolume::GetPointMask(
+        const core::Tensor &points) const {
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    const int64_t num_points = points.GetLength();
+    if (orthogonal_axis_ == "" || bounding_polygon_.empty()) {
+        return core::Tensor::Zeros({num_points}, core::Bool,
+                                   points.GetDevice());
+    }
+    int u, v, w;
+    GetAxes(u, v, w);
+    // Columns of the transposed view are strided views into points.
+    const core::Tensor points_t = points.T();
+    const core::Tensor pu = points_t[u];
+    const core::Tensor pv = points_t[v];
+    const core::Tensor pw = points_t[w];
+
+    // Even-odd rule: toggle for every polygon edge crossed by the ray from
+    // the point towards -u. Same test as CropInPolygon(), evaluated for all
+    // points per edge.
+    core::Tensor inside =
+            core::Tensor::Zeros({num_points}, core::Bool, points.GetDevice());
+    for (size_t i = 0; i < bounding_polygon_.size(); i++) {
+        const size_t j = (i + 1) % bounding_polygon_.size();
+        const double ui = bounding_polygon_[i](u), vi = bounding_polygon_[i](v);
+        const double uj = bounding_polygon_[j](u), vj = bounding_polygon_[j](v);
+        if (vi == vj) continue;  // Never satisfies the straddle test.
+        core::Tensor crosses = pv.Gt(vi).LogicalXor_(pv.Gt(vj));
+        core::Tensor x = pv.Sub(vi).Mul_((uj - ui) / (vj - vi)).Add_(ui);
+        crosses.LogicalAnd_(x.Lt(pu));
+        inside.LogicalXor_(crosses);
+    }
+    return inside.LogicalAnd_(pw.Ge(axis_min_))
+            .LogicalAnd_(pw.Le(axis_max_));
+}
+
 std::shared_ptr<geometry::TriangleMesh>
 SelectionPolygonVolume::CropTriangleMesh(
         const geometry::TriangleMesh &input) const {
@@ -122,10 +176,7 @@ SelectionPolygonVolume::CropTriangleMeshInPolygon(
     return input.SelectByIndex(CropInPolygon(input.vertices_));
 }
 
-std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
-        const std::vector<Eigen::Vector3d> &input) const {
-    std::vector<size_t> output_index;
-    int u, v, w;
+void SelectionPolygonVolume::GetAxes(int &u, int &v, int &w) const {
     if (orthogonal_axis_ == "x" || orthogonal_axis_ == "X") {
         u = 1;
         v = 2;
@@ -139,33 +190,38 @@ std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
         v = 1;
         w = 2;
     }
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
+}
+
+std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
+        const std::vector<Eigen::Vector3d> &input) const {
+    int u, v, w;
+    GetAxes(u, v, w);
+    // A point is inside if an odd number of polygon edges cross the ray from
+    // the point towards -u, so counting crossings is enough; no need to
+    // collect and sort them.
+    std::vector<uint8_t> mask(input.size(), 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t k = 0; k < int64_t(input.size()); k++) {
         const auto &point = input[k];
         if (point(w) < axis_min_ || point(w) > axis_max_) continue;
-        nodes.clear();
+        bool inside = false;
         for (size_t i = 0; i < bounding_polygon_.size(); i++) {
-            size_t j = (i + 1) % bounding_polygon_.size();
-            if ((bounding_polygon_[i](v) < point(v) &&
-                 bounding_polygon_[j](v) >= point(v)) ||
-                (bounding_polygon_[j](v) < point(v) &&
-                 bounding_polygon_[i](v) >= point(v))) {
-                nodes.push_back(bounding_polygon_[i](u) +
-                                (point(v) - bounding_polygon_[i](v)) /
-                                        (bounding_polygon_[j](v) -
-                                         bounding_polygon_[i](v)) *
-                                        (bounding_polygon_[j](u) -
-                                         bounding_polygon_[i](u)));
+            const size_t j = (i + 1) % bounding_polygon_.size();
+            const Eigen::Vector3d &pi = bounding_polygon_[i];
+            const Eigen::Vector3d &pj = bounding_polygon_[j];
+            if ((pi(v) < point(v)) != (pj(v) < point(v))) {
+                const double x = pi(u) + (point(v) - pi(v)) /
+                                                 (pj(v) - pi(v)) *
+                                                 (pj(u) - pi(u));
+                if (x < point(u)) inside = !inside;
             }
         }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), point(u));
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
+        mask[k] = inside;
+    }
+    std::vector<size_t> output_index;
+    for (size_t k = 0; k < input.size(); k++) {
+        if (mask[k]) output_index.push_back(k);
     }
     return output_index;
 }
@@ -35,12 +35,22 @@
 
 namespace open3d {
 
+namespace core {
+class Tensor;
+}
+
 namespace geometry {
 class Geometry;
 class PointCloud;
 class TriangleMesh;
 }  // namespace geometry
 
+namespace t {
+namespace geometry {
+class PointCloud;
+}
+}  // namespace t
+
 namespace visualization {
 
 /// \class SelectionPolygonVolume
@@ -58,6 +68,18 @@ public:
     /// \param input The input point cloud.
     std::shared_ptr<geometry::PointCloud> CropPointCloud(
             const geometry::PointCloud &input) const;
+    /// Function to crop a tensor point cloud. The selection runs as tensor
+    /// operations on the device of \p input, so large (GPU) point clouds do
+    /// not need to be copied to the host.
+    ///
+    /// \param input The input point cloud.
+    t::geometry::PointCloud CropPointCloud(
+            const t::geometry::PointCloud &input) const;
+    /// Computes which points lie inside the selection volume.
+    ///
+    /// \param points Float32 or Float64 tensor of shape {N, 3}.
+    /// \return Boolean mask of shape {N,} on the device of \p points.
+    core::Tensor GetPointMask(const core::Tensor &points) const;
     /// Function to crop crop triangle mesh.
     ///
     /// \param input The input triangle mesh.
@@ -71,6 +93,8 @@ private:
             const geometry::TriangleMesh &input) const;
     std::vector<size_t> CropInPolygon(
             const std::vector<Eigen::Vector3d> &input) const;
+    /// Returns the in-plane axes (u, v) and the orthogonal axis w.
+    void GetAxes(int &u, int &v, int &w) const;
 
 public:
     /// One of `{x, y, z}`.
@@ -26,6 +26,7 @@
 
 #include "open3d/visualization/visualizer/GuiVisualizer.h"
 
+#include <atomic>
 #include <random>
 
 #include "open3d/Open3DConfig.h"
@@ -352,8 +353,13 @@ struct GuiVisualizer::Impl {
         std::shared_ptr<GuiSettingsView> view_;
     } settings_;
 
+    // Only modified on the main thread; LoadGeometry() reads into its own
+    // copies and hands them off when done.
     rendering::TriangleMeshModel loaded_model_;
     std::shared_ptr<geometry::PointCloud> loaded_pcd_;
+    // Incremented by every load and by cancelling one; a loader whose
+    // generation is no longer current stops and discards its results.
+    std::atomic<int> load_generation_{0};
     int app_menu_custom_items_index_ = -1;
     std::shared_ptr<gui::Menu> app_menu_;
 
@@ -866,6 +872,13 @@ void GuiVisualizer::AddItemsToAppMenu(
 
 void GuiVisualizer::SetGeometry(
         std::shared_ptr<const geometry::Geometry> geometry, bool loaded_model) {
+    SetGeometry(geometry, loaded_model, true);
+}
+
+void GuiVisualizer::SetGeometry(
+        std::shared_ptr<const geometry::Geometry> geometry,
+        bool loaded_model,
+        bool setup_camera) {
     auto scene3d = impl_->scene_wgt_->GetScene();
     scene3d->ClearGeometry();
 
@@ -930,9 +943,11 @@ void GuiVisualizer::SetGeometry(
     }
     impl_->settings_.view_->Update();  // make sure prefab material is correct
 
-    auto &bounds = scene3d->GetBoundingBox();
-    impl_->scene_wgt_->SetupCamera(60.0, bounds,
-                                   bounds.GetCenter().cast<float>());
+    if (setup_camera) {
+        auto &bounds = scene3d->GetBoundingBox();
+        impl_->scene_wgt_->SetupCamera(60.0, bounds,
+                                       bounds.GetCenter().cast<float>());
+    }
 
     // Make sure scene is redrawn
     impl_->scene_wgt_->ForceRedraw();
@@ -969,7 +984,10 @@ void GuiVisualizer::Layout(const gui::LayoutContext &context) {
 }
 
 void GuiVisualizer::StartRPCInterface(const std::string &address, int timeout) {
-    impl_->receiver_ = std::make_shared<io::rpc::ZMQReceiver>(address, timeout);
+    // The message processor only posts to the main thread and is thread safe.
+    // A second worker keeps camera updates responsive during large meshes.
+    impl_->receiver_ = std::make_shared<io::rpc::ZMQReceiver>(address, timeout,
+                                                              2);
     impl_->receiver_->SetMessageProcessor(impl_->message_processor_);
     try {
         utility::LogInfo("Starting to listen on {}", address);
@@ -988,9 +1006,22 @@ bool GuiVisualizer::SetIBL(const char *path) {
 }
 
 void GuiVisualizer::LoadGeometry(const std::string &path) {
+    // Point clouds larger than this are shown downsampled while the normals
+    // of the full cloud are still being estimated.
+    const size_t kPreviewMinPoints = 1000000;
+
+    const int generation = ++impl_->load_generation_;
+    auto is_current = [this, generation]() {
+        return impl_->load_generation_ == generation;
+    };
+
     auto progressbar = std::make_shared<gui::ProgressBar>();
     gui::Application::GetInstance().PostToMainThread(this, [this, path,
-                                                            progressbar]() {
+                                                            progressbar,
+                                                            is_current]() {
+        if (!is_current()) {
+            return;
+        }
         auto &theme = GetTheme();
         auto loading_dlg = std::make_shared<gui::Dialog>("Loading");
         auto vert =
@@ -999,24 +1030,29 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
         vert->AddChild(std::make_shared<gui::Label>(loading_text.c_str()));
         vert->AddFixed(theme.font_size);
         vert->AddChild(progressbar);
+        auto cancel = std::make_shared<gui::Button>("Cancel");
+        cancel->SetOnClicked([this]() {
+            ++impl_->load_generation_;
+            CloseDialog();
+        });
+        vert->AddFixed(theme.font_size);
+        vert->AddChild(gui::Horiz::MakeCentered(cancel));
         loading_dlg->AddChild(vert);
         ShowDialog(loading_dlg);
     });
 
-    gui::Application::GetInstance().RunInThread([this, path, progressbar]() {
-        auto UpdateProgress = [this, progressbar](float value) {
+    gui::Application::GetInstance().RunInThread([this, path, progressbar,
+                                                 is_current]() {
+        auto UpdateProgress = [this, progressbar, is_current](float value) {
             gui::Application::GetInstance().PostToMainThread(
                     this,
                     [progressbar, value]() { progressbar->SetValue(value); });
+            return is_current();
         };
 
-        // clear current model
-        impl_->loaded_model_.meshes_.clear();
-        impl_->loaded_model_.materials_.clear();
-        impl_->loaded_pcd_.reset();
-
         auto geometry_type = io::ReadFileGeometryType(path);
 
+        auto model = std::make_shared<rendering::TriangleMeshModel>();
         bool model_success = false;
         if (geometry_type & io::CONTAINS_TRIANGLES) {
             const float ioProgressAmount = 1.0f;
@@ -1024,65 +1060,115 @@ void GuiVisualizer::LoadGeometry(const std::string &path) {
                 io::ReadTriangleModelOptions opt;
                 opt.update_progress = [ioProgressAmount,
                                        UpdateProgress](double percent) -> bool {
-                    UpdateProgress(ioProgressAmount * float(percent / 100.0));
-                    return true;
+                    return UpdateProgress(ioProgressAmount *
+                                          float(percent / 100.0));
                 };
-                model_success =
-                        io::ReadTriangleModel(path, impl_->loaded_model_, opt);
+                model_success = io::ReadTriangleModel(path, *model, opt);
             } catch (...) {
                 model_success = false;
             }
         }
+        if (!is_current()) {
+            return;
+        }
         if (!model_success) {
             utility::LogInfo("{} appears to be a point cloud", path.c_str());
         }
 
-        auto geometry = std::shared_ptr<geometry::Geometry3D>();
+        auto cloud = std::shared_ptr<geometry::PointCloud>();
         if (!model_success) {
-            auto cloud = std::make_shared<geometry::PointCloud>();
+            cloud = std::make_shared<geometry::PointCloud>();
             bool success = false;
             const float ioProgressAmount = 0.5f;
             try {
                 io::ReadPointCloudOption opt;
                 opt.update_progress = [ioProgressAmount,
                                        UpdateProgress](double percent) -> bool {
-                    UpdateProgress(ioProgressAmount * float(percent / 100.0));
-                    return true;
+                    return UpdateProgress(ioProgressAmount *
+                                          float(percent / 100.0));
                 };
                 success = io::ReadPointCloud(path, *cloud, opt);
             } catch (...) {
                 success = false;
             }
+            if (!is_current()) {
+                return;
+            }
             if (success) {
                 utility::LogInfo("Successfully read {}", path.c_str());
                 UpdateProgress(ioProgressAmount);
                 if (!cloud->HasNormals() && !cloud->HasColors()) {
+                    // Normal estimation dominates the load time of large
+                    // clouds, so show a subsampled copy in the meantime.
+                    bool previewed = false;
+                    if (cloud->points_.size() > kPreviewMinPoints) {
+                        std::shared_ptr<const geometry::Geometry> preview =
+                                cloud->UniformDownSample(
+                                        int(cloud->points_.size() /
+                                            kPreviewMinPoints) +
+                                        1);
+                        gui::Application::GetInstance().PostToMainThread(
+                                this, [this, preview, is_current]() {
+                                    if (is_current()) {
+                                        SetGeometry(preview, false, true);
+                                    }
+                                });
+                        previewed = true;
+                    }
                     cloud->EstimateNormals();
+                    if (!is_current()) {
+                        return;
+                    }
+                    UpdateProgress(0.666f);
+                    cloud->NormalizeNormals();
+                    UpdateProgress(0.75f);
+                    if (previewed) {
+                        // Keep the camera the user may have moved already.
+                        gui::Application::GetInstance().PostToMainThread(
+                                this, [this, cloud, is_current]() {
+                                    if (!is_current()) {
+                                        return;
+                                    }
+                                    impl_->loaded_pcd_ = cloud;
+                                    SetGeometry(cloud, false, false);
+                                    CloseDialog();
+                                });
+                        return;
+                    }
+                } else {
+                    cloud->NormalizeNormals();
+                    UpdateProgress(0.75f);
                 }
-                UpdateProgress(0.666f);
-                cloud->NormalizeNormals();
-                UpdateProgress(0.75f);
-                geometry = cloud;
-                impl_->loaded_pcd_ = cloud;
             } else {
                 utility::LogWarning("Failed to read points {}", path.c_str());
                 cloud.reset();
             }
         }
 
-        if (model_success || geometry) {
+        if (model_success || cloud) {
+            // Hand off on the main thread so the loaded data is never
+            // modified while the UI is using it.
             gui::Application::GetInstance().PostToMainThread(
-                    this, [this, model_success, geometry]() {
-                        SetGeometry(geometry, model_success);
+                    this, [this, model_success, model, cloud, is_current]() {
+                        if (!is_current()) {
+                            return;
+                        }
+                        impl_->loaded_model_ = std::move(*model);
+                        impl_->loaded_pcd_ = cloud;
+                        SetGeometry(cloud, model_success);
                         CloseDialog();
                     });
         } else {
-            gui::Application::GetInstance().PostToMainThread(this, [this,
-                                                                    path]() {
-                CloseDialog();
-                auto msg = std::string("Could not load '") + path + "'.";
-                ShowMessageBox("Error", msg.c_str());
-            });
+            gui::Application::GetInstance().PostToMainThread(
+                    this, [this, path, is_current]() {
+                        if (!is_current()) {
+                            return;
+                        }
+                        CloseDialog();
+                        auto msg =
+                                std::string("Could not load '") + path + "'.";
+                        ShowMessageBox("Error", msg.c_str());
+                    });
         }
     });
 }
@@ -89,6 +89,9 @@ private:
     std::unique_ptr<Impl> impl_;
 
     void Init();
+    void SetGeometry(std::shared_ptr<const geometry::Geometry> geometry,
+                     bool loaded_model,
+                     bool setup_camera);
 };
 
 }  // namespace visualization
@@ -1906,7 +1906,10 @@ Open3DScene *O3DVisualizer::GetScene() const {
 }
 
 void O3DVisualizer::StartRPCInterface(const std::string &address, int timeout) {
-    impl_->receiver_ = std::make_shared<io::rpc::ZMQReceiver>(address, timeout);
+    // The message processor only posts to the main thread and is thread safe.
+    // A second worker keeps camera updates responsive during large meshes.
+    impl_->receiver_ = std::make_shared<io::rpc::ZMQReceiver>(address, timeout,
+                                                              2);
     impl_->receiver_->SetMessageProcessor(impl_->message_processor_);
 
     try {
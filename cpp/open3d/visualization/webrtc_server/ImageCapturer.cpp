@@ -32,6 +32,9 @@
 #include <media/base/video_broadcaster.h>
 #include <media/base/video_common.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <memory>
 
 #include "open3d/core/Tensor.h"
@@ -41,6 +44,10 @@ namespace open3d {
 namespace visualization {
 namespace webrtc_server {
 
+// A static scene is still sent at this interval, so that the encoder can
+// answer key frame requests, e.g. after packet loss.
+static const int64_t kStaticFrameIntervalUs = 1000000;
+
 ImageCapturer::ImageCapturer(const std::string& url_,
                              const std::map<std::string, std::string>& opts)
     : ImageCapturer(opts) {}
@@ -64,8 +71,33 @@ ImageCapturer::ImageCapturer(const std::map<std::string, std::string>& opts)
     }
 }
 
+bool ImageCapturer::SkipFrame(const std::shared_ptr<core::Tensor>& frame,
+                              int64_t time_us) {
+    const bool force = force_next_frame_.exchange(false);
+    bool skip = false;
+    // Redraws of a static scene produce identical frames. Comparing them is
+    // much cheaper than converting and encoding them again.
+    if (!force && last_frame_ &&
+        time_us - last_frame_time_us_ < kStaticFrameIntervalUs &&
+        frame->GetShape() == last_frame_->GetShape() &&
+        std::memcmp(frame->GetDataPtr(), last_frame_->GetDataPtr(),
+                    frame->NumElements() * frame->GetDtype().ByteSize()) == 0) {
+        skip = true;
+    }
+    if (!skip) {
+        last_frame_ = frame;
+        last_frame_time_us_ = time_us;
+    }
+    return skip;
+}
+
 void ImageCapturer::OnCaptureResult(
         const std::shared_ptr<core::Tensor>& frame) {
+    const int64_t time_us = rtc::TimeMicros();
+    if (SkipFrame(frame, time_us)) {
+        return;
+    }
+
     int height = (int)frame->GetShape(0);
     int width = (int)frame->GetShape(1);
 
@@ -83,17 +115,31 @@ void ImageCapturer::OnCaptureResult(
     if (conversion_result >= 0) {
         webrtc::VideoFrame video_frame(i420_buffer,
                                        webrtc::VideoRotation::kVideoRotation_0,
-                                       rtc::TimeMicros());
-        if ((height_ == 0) && (width_ == 0)) {
+                                       time_us);
+        int height = height_;
+        int width = width_;
+        if (height == 0 && width == 0) {
+            height = video_frame.height();
+            width = video_frame.width();
+        } else if (height == 0) {
+            height = (video_frame.height() * width) / video_frame.width();
+        } else if (width == 0) {
+            width = (video_frame.width() * height) / video_frame.height();
+        }
+        // Downscale if the sinks request fewer pixels. WebRTC lowers the
+        // limit when the available bandwidth or the encoder cannot keep up,
+        // and raises it again when it recovers.
+        const int max_pixel_count = broadcaster_.wants().max_pixel_count;
+        if (max_pixel_count > 0 && width * height > max_pixel_count) {
+            const double scale =
+                    std::sqrt(double(max_pixel_count) / (width * height));
+            width = std::max(2, int(width * scale) & ~1);
+            height = std::max(2, int(height * scale) & ~1);
+        }
+
+        if (width == video_frame.width() && height == video_frame.height()) {
             broadcaster_.OnFrame(video_frame);
         } else {
-            int height = height_;
-            int width = width_;
-            if (height == 0) {
-                height = (video_frame.height() * width) / video_frame.width();
-            } else if (width == 0) {
-                width = (video_frame.width() * height) / video_frame.height();
-            }
             int stride_y = width;
             int stride_uv = (width + 1) / 2;
             rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer =
@@ -102,7 +148,7 @@ void ImageCapturer::OnCaptureResult(
             scaled_buffer->ScaleFrom(
                     *video_frame.video_frame_buffer()->ToI420());
             webrtc::VideoFrame frame = webrtc::VideoFrame(
-                    scaled_buffer, webrtc::kVideoRotation_0, rtc::TimeMicros());
+                    scaled_buffer, webrtc::kVideoRotation_0, time_us);
 
             broadcaster_.OnFrame(frame);
         }
@@ -117,6 +163,8 @@ void ImageCapturer::AddOrUpdateSink(
         rtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
         const rtc::VideoSinkWants& wants) {
     broadcaster_.AddOrUpdateSink(sink, wants);
+    // New sinks need a frame even if the scene does not change.
+    force_next_frame_ = true;
 }
 
 void ImageCapturer::RemoveSink(
@@ -35,6 +35,7 @@
 #include <media/base/video_broadcaster.h>
 #include <media/base/video_common.h>
 
+#include <atomic>
 #include <memory>
 
 #include "open3d/core/Tensor.h"
@@ -67,9 +68,20 @@ public:
     void OnCaptureResult(const std::shared_ptr<core::Tensor>& frame);
 
 protected:
+    /// Returns true if \p frame does not need to be encoded, because it is
+    /// identical to the last frame that was sent.
+    bool SkipFrame(const std::shared_ptr<core::Tensor>& frame,
+                   int64_t time_us);
+
     int width_;
     int height_;
     rtc::VideoBroadcaster broadcaster_;
+
+    // State for skipping frames. last_frame_ is only accessed from the thread
+    // that calls OnCaptureResult().
+    std::shared_ptr<core::Tensor> last_frame_;
+    int64_t last_frame_time_us_ = 0;
+    std::atomic<bool> force_next_frame_{true};
 };
 
 class ImageTrackSource : public BitmapTrackSource {
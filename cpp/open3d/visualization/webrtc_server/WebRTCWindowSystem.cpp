@@ -409,7 +409,7 @@ void WebRTCWindowSystem::SendInitFrames(const std::string &window_uid) {
     const auto os_window = GetOSWindowByUID(window_uid);
     if (!os_window) return;
     for (int i = 0; os_window != nullptr && i < s_max_initial_frames; ++i) {
-        PostRedrawEvent(os_window);
+        PostFullRedrawEvent(os_window);
         std::this_thread::sleep_for(
                 std::chrono::milliseconds(s_sleep_between_frames_ms));
         utility::LogDebug("Sent init frames #{} to {}.", i, window_uid);
@@ -41,6 +41,8 @@ void pybind_core_dtype(py::module &m) {
                                                     "Open3D data types.");
     dtype.def(py::init<Dtype::DtypeCode, int64_t, const std::string &>());
     dtype.def_readonly_static("Undefined", &core::Undefined);
+    dtype.def_readonly_static("Float16", &core::Float16);
+    dtype.def_readonly_static("BFloat16", &core::BFloat16);
     dtype.def_readonly_static("Float32", &core::Float32);
     dtype.def_readonly_static("Float64", &core::Float64);
     dtype.def_readonly_static("Int8", &core::Int8);
@@ -68,6 +70,8 @@ void pybind_core_dtype(py::module &m) {
     // Dtype shortcuts.
     // E.g. open3d.core.Float32
     m.attr("undefined") = &core::Undefined;
+    m.attr("float16") = core::Float16;
+    m.attr("bfloat16") = core::BFloat16;
     m.attr("float32") = core::Float32;
     m.attr("float64") = core::Float64;
     m.attr("int8") = core::Int8;
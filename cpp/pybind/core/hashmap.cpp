@@ -68,7 +68,7 @@ const std::unordered_map<std::string, std::string> argument_docs = {
         {"list_values",
          "List of input values stored in tensors of corresponding shapes."},
         {"capacity", "New capacity for rehashing."},
-        {"file_name", "File name of the corresponding .npz file."},
+        {"file_name", "File name of the corresponding .npz or .o3dhash file."},
         {"values_buffer_id", "Index of the value buffer tensor."},
         {"device_id", "Target CUDA device ID."}};
 
@@ -154,12 +154,14 @@ void pybind_core_hashmap(py::module& m) {
             "Get the buffer indices corresponding to active entries in the "
             "hash map.");
 
-    hashmap.def("save", &HashMap::Save, "Save the hash map into a .npz file.",
+    hashmap.def("save", &HashMap::Save,
+                "Save the hash map into a .npz or .o3dhash file.",
                 "file_name"_a);
     docstring::ClassMethodDocInject(m, "HashMap", "save", argument_docs);
 
     hashmap.def_static("load", &HashMap::Load,
-                       "Load a hash map from a .npz file.", "file_name"_a);
+                       "Load a hash map from a .npz or .o3dhash file.",
+                       "file_name"_a, "device"_a = Device("CPU:0"));
     docstring::ClassMethodDocInject(m, "HashMap", "load", argument_docs);
 
     hashmap.def("reserve", &HashMap::Reserve,
@@ -262,12 +264,14 @@ void pybind_core_hashset(py::module& m) {
             "Get the buffer indices corresponding to active entries in the "
             "hash set.");
 
-    hashset.def("save", &HashSet::Save, "Save the hash set into a .npz file.",
+    hashset.def("save", &HashSet::Save,
+                "Save the hash set into a .npz or .o3dhash file.",
                 "file_name"_a);
     docstring::ClassMethodDocInject(m, "HashSet", "save", argument_docs);
 
     hashset.def_static("load", &HashSet::Load,
-                       "Load a hash set from a .npz file.", "file_name"_a);
+                       "Load a hash set from a .npz or .o3dhash file.",
+                       "file_name"_a, "device"_a = Device("CPU:0"));
     docstring::ClassMethodDocInject(m, "HashSet", "load", argument_docs);
 
     hashset.def("reserve", &HashSet::Reserve,
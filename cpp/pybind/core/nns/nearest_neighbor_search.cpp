@@ -74,6 +74,9 @@ void pybind_core_nns(py::module &m) {
             py::arg("radius") = py::none());
     nns.def("multi_radius_index", &NearestNeighborSearch::MultiRadiusIndex,
             "Set index for multi-radius search.");
+    nns.def("lbvh_index", &NearestNeighborSearch::LBVHIndex,
+            "Set a linear BVH index for knn, fixed-radius and hybrid "
+            "search.");
     nns.def(
             "hybrid_index",
             [](NearestNeighborSearch &self, utility::optional<double> radius) {
@@ -267,23 +267,58 @@ static void BindTensorFullCreation(py::module& m, py::class_<Tensor>& tensor) {
             "device"_a = py::none());
 }
 
+// Wraps a DLManagedTensor in a "dltensor" capsule. The capsule calls the
+// deleter only if the tensor has not been consumed. See PyTorch's
+// torch/csrc/Module.cpp.
+static py::capsule DLManagedTensorToCapsule(
+        DLManagedTensor* dl_managed_tensor) {
+    auto capsule_destructor = [](PyObject* data) {
+        DLManagedTensor* dl_managed_tensor =
+                (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
+        if (dl_managed_tensor) {
+            // the dl_managed_tensor has not been consumed,
+            // call deleter ourselves
+            dl_managed_tensor->deleter(
+                    const_cast<DLManagedTensor*>(dl_managed_tensor));
+        } else {
+            // The dl_managed_tensor has been consumed
+            // PyCapsule_GetPointer has set an error indicator
+            PyErr_Clear();
+        }
+    };
+    return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
+}
+
+// Consumes a "dltensor" capsule and marks it as used.
+static Tensor CapsuleToTensor(py::capsule data) {
+    DLManagedTensor* dl_managed_tensor = static_cast<DLManagedTensor*>(data);
+    if (!dl_managed_tensor) {
+        utility::LogError(
+                "from_dlpack must receive "
+                "DLManagedTensor PyCapsule.");
+    }
+    // Make sure that the PyCapsule is not used again.
+    // See:
+    // torch/csrc/Module.cpp, and
+    // https://github.com/cupy/cupy/pull/1445/files#diff-ddf01ff512087ef616db57ecab88c6ae
+    Tensor t = Tensor::FromDLPack(dl_managed_tensor);
+    PyCapsule_SetName(data.ptr(), "used_dltensor");
+    return t;
+}
+
 void pybind_core_tensor(py::module& m) {
     py::class_<Tensor> tensor(
             m, "Tensor",
             "A Tensor is a view of a data Blob with shape, stride, data_ptr.");
 
     // o3c.Tensor(np.array([[0, 1, 2], [3, 4, 5]]), dtype=None, device=None).
+    // The array is borrowed and copied once, fused with the dtype and device
+    // conversion.
     tensor.def(py::init([](const py::array& np_array,
                            utility::optional<Dtype> dtype,
                            utility::optional<Device> device) {
-                   Tensor t = PyArrayToTensor(np_array, /*inplace=*/false);
-                   if (dtype.has_value()) {
-                       t = t.To(dtype.value());
-                   }
-                   if (device.has_value()) {
-                       t = t.To(device.value());
-                   }
-                   return t;
+                   return PyHandleToTensor(np_array, dtype, device,
+                                           /*force_copy=*/true);
                }),
                "Initialize Tensor from a Numpy array.", "np_array"_a,
                "dtype"_a = py::none(), "device"_a = py::none());
@@ -483,49 +518,80 @@ Example:
     tensor.def_static("from_numpy", [](py::array np_array) {
         return core::PyArrayToTensor(np_array, true);
     });
+    tensor.def_static(
+            "from_buffer",
+            [](py::buffer buffer) {
+                return core::PyBufferToTensor(buffer, true);
+            },
+            "Create a Tensor sharing the memory of an object supporting the "
+            "buffer protocol, e.g. a legacy open3d.utility.Vector3dVector. The "
+            "object is kept alive by the Tensor and must not be resized while "
+            "the Tensor is in use.",
+            "buffer"_a);
 
     tensor.def("to_dlpack", [](const Tensor& tensor) {
-        DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
-        // See PyTorch's torch/csrc/Module.cpp
-        auto capsule_destructor = [](PyObject* data) {
-            DLManagedTensor* dl_managed_tensor =
-                    (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
-            if (dl_managed_tensor) {
-                // the dl_managed_tensor has not been consumed,
-                // call deleter ourselves
-                dl_managed_tensor->deleter(
-                        const_cast<DLManagedTensor*>(dl_managed_tensor));
-            } else {
-                // The dl_managed_tensor has been consumed
-                // PyCapsule_GetPointer has set an error indicator
-                PyErr_Clear();
-            }
-        };
-        return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
+        return DLManagedTensorToCapsule(tensor.ToDLPack());
     });
 
-    tensor.def_static("from_dlpack", [](py::capsule data) {
-        DLManagedTensor* dl_managed_tensor =
-                static_cast<DLManagedTensor*>(data);
-        if (!dl_managed_tensor) {
-            utility::LogError(
-                    "from_dlpack must receive "
-                    "DLManagedTensor PyCapsule.");
-        }
-        // Make sure that the PyCapsule is not used again.
-        // See:
-        // torch/csrc/Module.cpp, and
-        // https://github.com/cupy/cupy/pull/1445/files#diff-ddf01ff512087ef616db57ecab88c6ae
-        Tensor t = Tensor::FromDLPack(dl_managed_tensor);
-        PyCapsule_SetName(data.ptr(), "used_dltensor");
-        return t;
+    // DLPack exchange protocol. The consumer passes the stream it will use
+    // the tensor on; None means the legacy default stream for CUDA tensors.
+    tensor.def(
+            "__dlpack__",
+            [](const Tensor& tensor, py::object stream) {
+                int64_t consumer_stream = -1;
+                if (!stream.is_none()) {
+                    consumer_stream = stream.cast<int64_t>();
+                } else if (tensor.GetDevice().GetType() ==
+                           Device::DeviceType::CUDA) {
+                    consumer_stream = 1;
+                }
+                return DLManagedTensorToCapsule(
+                        tensor.ToDLPack(consumer_stream));
+            },
+            "stream"_a = py::none());
+    tensor.def("__dlpack_device__", [](const Tensor& tensor) {
+        const Device device = tensor.GetDevice();
+        const DLDeviceType type = device.GetType() == Device::DeviceType::CUDA
+                                          ? DLDeviceType::kDLGPU
+                                          : DLDeviceType::kDLCPU;
+        return py::make_tuple(static_cast<int>(type), device.GetID());
     });
 
+    tensor.def_static(
+            "from_dlpack",
+            [](py::object data) {
+                if (py::isinstance<py::capsule>(data)) {
+                    return CapsuleToTensor(data.cast<py::capsule>());
+                }
+                if (!py::hasattr(data, "__dlpack__")) {
+                    utility::LogError(
+                            "from_dlpack must receive a DLManagedTensor "
+                            "PyCapsule or an object with __dlpack__.");
+                }
+                // Let the producer order its work before our current stream
+                // instead of synchronizing the device.
+                py::object stream = py::none();
+                if (py::hasattr(data, "__dlpack_device__")) {
+                    py::tuple device =
+                            data.attr("__dlpack_device__")().cast<py::tuple>();
+                    if (device[0].cast<int>() ==
+                        static_cast<int>(DLDeviceType::kDLGPU)) {
+                        stream = py::int_(cuda::GetDLPackStream());
+                    }
+                }
+                return CapsuleToTensor(data.attr("__dlpack__")(
+                        "stream"_a = stream));
+            },
+            "Creates a tensor sharing memory with a DLPack capsule or an "
+            "object implementing __dlpack__, such as a PyTorch tensor.");
+
     // Numpy IO.
     tensor.def("save", &Tensor::Save, "Save tensor to Numpy's npy format.",
                "file_name"_a);
     tensor.def_static("load", &Tensor::Load,
-                      "Load tensor from Numpy's npy format.", "file_name"_a);
+                      "Load tensor from Numpy's npy format. If use_mmap, the "
+                      "file is memory-mapped copy-on-write instead of read.",
+                      "file_name"_a, "use_mmap"_a = false);
 
     /// Linalg operations.
     tensor.def("det", &Tensor::Det,
@@ -858,6 +924,63 @@ Ref:
     BIND_REDUCTION_OP_NO_KEEPDIM(argmin, ArgMin);
     BIND_REDUCTION_OP_NO_KEEPDIM(argmax, ArgMax);
 
+    // Segmented reduction ops.
+    tensor.def("segment_sum", &Tensor::SegmentSum, "splits"_a,
+               "Sums consecutive segments along the first dimension. splits "
+               "is an int64 tensor of shape {num_segments + 1} starting with 0 "
+               "and ending with the length of the tensor.");
+    tensor.def("segment_mean", &Tensor::SegmentMean, "splits"_a,
+               "Averages consecutive segments along the first dimension.");
+    tensor.def("segment_max", &Tensor::SegmentMax, "splits"_a,
+               "Maximum of consecutive segments along the first dimension.");
+    tensor.def("segment_min", &Tensor::SegmentMin, "splits"_a,
+               "Minimum of consecutive segments along the first dimension.");
+
+    // Index reduction ops.
+    tensor.def("index_add_", &Tensor::IndexAdd_, "dim"_a, "index"_a, "src"_a,
+               "deterministic"_a = false,
+               "Accumulates slices of src into the tensor along dim at the "
+               "positions given by the int64 tensor index. If deterministic, "
+               "repeated indices are summed in a fixed order.");
+    tensor.def("index_reduce_", &Tensor::IndexReduce_, "dim"_a, "index"_a,
+               "src"_a, "reduce"_a, "include_self"_a = true,
+               "deterministic"_a = false,
+               "Reduces slices of src into the tensor along dim at the "
+               "positions given by index. reduce is one of \"sum\", "
+               "\"mean\", \"max\" or \"min\".");
+
+    // Sorting.
+    tensor.def("sort", &Tensor::Sort,
+               "Returns the elements of a 1-D tensor sorted in ascending "
+               "order. NaNs are ordered last.");
+    tensor.def("argsort", &Tensor::Argsort,
+               "Returns the int64 indices that stably sort a 1-D tensor in "
+               "ascending order.");
+    tensor.def(
+            "unique",
+            [](const Tensor& tensor, bool return_inverse,
+               bool return_counts) -> py::object {
+                if (!return_inverse && !return_counts) {
+                    return py::cast(tensor.Unique());
+                }
+                Tensor unique, inverse, counts;
+                std::tie(unique, inverse, counts) =
+                        tensor.UniqueWithInverseAndCounts();
+                if (return_inverse && return_counts) {
+                    return py::make_tuple(unique, inverse, counts);
+                } else if (return_inverse) {
+                    return py::make_tuple(unique, inverse);
+                } else {
+                    return py::make_tuple(unique, counts);
+                }
+            },
+            "return_inverse"_a = false, "return_counts"_a = false,
+            "Returns the sorted unique elements of a 1-D tensor, optionally "
+            "with the int64 inverse indices and counts.");
+    tensor.def_static("sort_by_key", &Tensor::SortByKey, "keys"_a, "values"_a,
+                      "Stably sorts the 1-D tensor keys and reorders values "
+                      "along its first dimension in the same way.");
+
     // Comparison.
     tensor.def(
             "allclose", &Tensor::AllClose, "other"_a, "rtol"_a = 1e-5,
@@ -918,6 +1041,10 @@ Returns:
             "item",
             [](const Tensor& tensor) -> py::object {
                 Dtype dtype = tensor.GetDtype();
+                if (dtype == core::Float16)
+                    return py::float_(tensor.Item<float16_t>());
+                if (dtype == core::BFloat16)
+                    return py::float_(tensor.Item<bfloat16_t>());
                 if (dtype == core::Float32)
                     return py::float_(tensor.Item<float>());
                 if (dtype == core::Float64)
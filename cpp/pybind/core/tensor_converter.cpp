@@ -38,17 +38,14 @@
 namespace open3d {
 namespace core {
 
+/// Converts \p t to the optional \p dtype and \p device in a single step. If
+/// \p copy is false, \p t is returned as is when no conversion is needed.
 static Tensor CastOptionalDtypeDevice(const Tensor& t,
                                       utility::optional<Dtype> dtype,
-                                      utility::optional<Device> device) {
-    Tensor t_cast = t;
-    if (dtype.has_value()) {
-        t_cast = t_cast.To(dtype.value());
-    }
-    if (device.has_value()) {
-        t_cast = t_cast.To(device.value());
-    }
-    return t_cast;
+                                      utility::optional<Device> device,
+                                      bool copy = false) {
+    return t.To(device.has_value() ? device.value() : t.GetDevice(),
+                dtype.has_value() ? dtype.value() : t.GetDtype(), copy);
 }
 
 /// Convert Tensor class to py::array (Numpy array).
@@ -140,6 +137,17 @@ Tensor PyArrayToTensor(py::array array, bool inplace) {
     }
 }
 
+Tensor PyBufferToTensor(const py::buffer& buffer, bool inplace) {
+    // numpy wraps the exporter's buffer without a copy and keeps the exporter
+    // alive as the base of the array.
+    py::array array = py::array::ensure(buffer);
+    if (!array) {
+        utility::LogError("Cannot convert buffer of type {} to Tensor.",
+                          std::string(py::str(buffer.get_type())));
+    }
+    return PyArrayToTensor(array, inplace);
+}
+
 Tensor PyListToTensor(const py::list& list,
                       utility::optional<Dtype> dtype,
                       utility::optional<Device> device) {
@@ -214,8 +222,9 @@ Tensor PyHandleToTensor(const py::handle& handle,
     // 3) float (double)
     // 4) list
     // 5) tuple
-    // 6) numpy.ndarray (value will be copied)
-    // 7) Tensor (value will be copied)
+    // 6) numpy.ndarray (value will be shared unless force_copy)
+    // 7) Tensor (value will be shared unless force_copy)
+    // 8) objects supporting the buffer protocol (same as numpy.ndarray)
     std::string class_name(py::str(handle.get_type()));
     if (class_name == "<class 'bool'>") {
         return BoolToTensor(static_cast<bool>(handle.cast<py::bool_>()), dtype,
@@ -231,21 +240,24 @@ Tensor PyHandleToTensor(const py::handle& handle,
     } else if (class_name == "<class 'tuple'>") {
         return PyTupleToTensor(handle.cast<py::tuple>(), dtype, device);
     } else if (class_name == "<class 'numpy.ndarray'>") {
-        return CastOptionalDtypeDevice(PyArrayToTensor(handle.cast<py::array>(),
-                                                       /*inplace=*/!force_copy),
-                                       dtype, device);
+        // Borrow the buffer, such that at most one copy is made for the
+        // dtype and device conversion.
+        return CastOptionalDtypeDevice(
+                PyArrayToTensor(handle.cast<py::array>(), /*inplace=*/true),
+                dtype, device, force_copy);
     } else if (class_name.find("open3d") != std::string::npos &&
                class_name.find("Tensor") != std::string::npos) {
         try {
             Tensor* tensor = handle.cast<Tensor*>();
-            if (force_copy) {
-                return CastOptionalDtypeDevice(tensor->Clone(), dtype, device);
-            } else {
-                return CastOptionalDtypeDevice(*tensor, dtype, device);
-            }
+            return CastOptionalDtypeDevice(*tensor, dtype, device, force_copy);
         } catch (...) {
             utility::LogError("Cannot cast index to Tensor.");
         }
+    } else if (py::isinstance<py::buffer>(handle)) {
+        return CastOptionalDtypeDevice(
+                PyBufferToTensor(py::reinterpret_borrow<py::buffer>(handle),
+                                 /*inplace=*/true),
+                dtype, device, force_copy);
     } else {
         utility::LogError("PyHandleToTensor has invalid input type {}.",
                           class_name);
@@ -65,6 +65,15 @@ py::array TensorToPyArray(const Tensor& tensor);
 /// python buffer will be copied.
 Tensor PyArrayToTensor(py::array array, bool inplace);
 
+/// Convert an object supporting the Python buffer protocol to Tensor, e.g. a
+/// memoryview or a legacy open3d.utility.Vector3dVector.
+///
+/// \param inplace If True, Tensor will directly use the underlying buffer and
+/// keep the exporting object alive. The exporter must not reallocate its
+/// memory (e.g. by resizing a vector) while the Tensor is in use. If False,
+/// the buffer will be copied.
+Tensor PyBufferToTensor(const py::buffer& buffer, bool inplace);
+
 /// Convert py::list to Tensor.
 ///
 /// Nested lists are supported, e.g. [[0, 1, 2], [3, 4, 5]] becomes a 2x3
@@ -115,8 +124,11 @@ Tensor BoolToTensor(bool scalar_value,
 /// 2) float (double)
 /// 3) list
 /// 4) tuple
-/// 5) numpy.ndarray (value will be copied)
-/// 6) Tensor (value will be copied)
+/// 5) numpy.ndarray (value will be shared unless \p force_copy is true)
+/// 6) Tensor (value will be shared unless \p force_copy is true)
+/// 7) objects supporting the buffer protocol, same as numpy.ndarray
+///
+/// If a dtype or device conversion is needed, the value is copied once.
 ///
 /// An exception will be thrown if the type is not supported.
 Tensor PyHandleToTensor(const py::handle& handle,
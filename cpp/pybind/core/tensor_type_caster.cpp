@@ -42,7 +42,8 @@ bool type_caster<open3d::core::Tensor>::load(handle src, bool convert) {
         if (class_name == "<class 'bool'>" || class_name == "<class 'int'>" ||
             class_name == "<class 'float'>" || class_name == "<class 'list'>" ||
             class_name == "<class 'tuple'>" ||
-            class_name == "<class 'numpy.ndarray'>") {
+            class_name == "<class 'numpy.ndarray'>" ||
+            py::isinstance<py::buffer>(src)) {
             holder_ = std::make_unique<open3d::core::Tensor>(
                     open3d::core::PyHandleToTensor(src));
             value = holder_.get();
@@ -171,7 +171,8 @@ def main():
         args_fwd = []
         for arg in schema.arguments:
             tmp = arg.name
-            if not arg.default_value is None:
+            # optional arguments like 'Tensor? x=None' have None as default
+            if arg.has_default_value():
                 if isinstance(arg.default_value, str):
                     tmp += '="{}"'.format(str(arg.default_value))
                 else:
@@ -176,6 +176,7 @@ void pybind_image(py::module &m) {
                             return *output;
                         }
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function to filter Image", "filter_type"_a)
             .def("flip_vertical", &Image::FlipVertical,
                  "Function to flip image vertically (upside down)")
@@ -197,6 +198,7 @@ void pybind_image(py::module &m) {
                             return output;
                         }
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function to create ImagePyramid", "num_of_levels"_a,
                     "with_gaussian_filter"_a)
             .def_static(
@@ -206,6 +208,7 @@ void pybind_image(py::module &m) {
                         auto output = Image::FilterPyramid(input, filter_type);
                         return output;
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function to filter ImagePyramid", "image_pyramid"_a,
                     "filter_type"_a);
 
@@ -115,7 +115,12 @@ void pybind_kdtreeflann(py::module &m) {
                      "At maximum, ``max_nn`` neighbors will be searched."},
                     {"knn", "``knn`` neighbors will be searched."},
                     {"feature", "Feature data."},
-                    {"data", "Matrix data."}};
+                    {"data", "Matrix data."},
+                    {"file_name", "Path to the .npz file."},
+                    {"use_mmap",
+                     "If true, the data and the tree permutation are "
+                     "memory-mapped, so that processes loading the same file "
+                     "share them through the page cache."}};
     py::class_<KDTreeFlann, std::shared_ptr<KDTreeFlann>> kdtreeflann(
             m, "KDTreeFlann", "KDTree with FLANN for nearest neighbor search.");
     kdtreeflann.def(py::init<>())
@@ -130,6 +135,12 @@ void pybind_kdtreeflann(py::module &m) {
             .def("set_feature", &KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
                  "feature"_a)
+            .def("save", &KDTreeFlann::Save,
+                 "Saves the data and the built KDTree to a .npz file.",
+                 "file_name"_a)
+            .def("load", &KDTreeFlann::Load,
+                 "Loads a KDTree saved with save() without rebuilding it.",
+                 "file_name"_a, "use_mmap"_a = false)
             // Although these C++ style functions are fast by orders of
             // magnitudes when similar queries are performed for a large number
             // of times and memory management is involved, we prefer not to
@@ -271,6 +282,10 @@ void pybind_kdtreeflann(py::module &m) {
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_vector_xd",
                                     map_kd_tree_flann_method_docs);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "load",
+                                    map_kd_tree_flann_method_docs);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "save",
+                                    map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "set_feature",
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "set_geometry",
@@ -29,6 +29,7 @@
 #include <sstream>
 #include <unordered_map>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "pybind/docstring.h"
@@ -361,6 +362,59 @@ void pybind_octree(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "Octree", "create_from_voxel_grid",
             {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+
+    // open3d.geometry.LinearOctree
+    py::class_<LinearOctree> linear_octree(
+            m, "LinearOctree",
+            "Pointerless octree over the points of a point cloud, built in "
+            "parallel from Morton-sorted points.");
+    py::detail::bind_default_constructor<LinearOctree>(linear_octree);
+    py::detail::bind_copy_functions<LinearOctree>(linear_octree);
+    linear_octree
+            .def("__repr__",
+                 [](const LinearOctree &octree) {
+                     return fmt::format(
+                             "geometry::LinearOctree with max_depth {}, {} "
+                             "nodes and {} points.",
+                             octree.max_depth_, octree.nodes_.size(),
+                             octree.point_indices_.size());
+                 })
+            .def("create_from_point_cloud",
+                 &LinearOctree::CreateFromPointCloud, "point_cloud"_a,
+                 "max_depth"_a, "size_expand"_a = 0.01,
+                 "Builds the octree from a point cloud in parallel.")
+            .def("clear", &LinearOctree::Clear, "Removes all nodes and points.")
+            .def("is_empty", &LinearOctree::IsEmpty,
+                 "Returns True if the octree has no nodes.")
+            .def("locate_leaf_node", &LinearOctree::LocateLeafNode, "point"_a,
+                 "Returns the index of the leaf node where the point resides, "
+                 "or -1 if there is none.")
+            .def("get_node_origin", &LinearOctree::GetNodeOrigin,
+                 "node_index"_a, "Returns the min bound of a node.")
+            .def("get_node_size", &LinearOctree::GetNodeSize, "node_index"_a,
+                 "Returns the edge size of a node.")
+            .def("get_node_point_indices", &LinearOctree::GetNodePointIndices,
+                 "node_index"_a, "Returns the indices of the points in a node.")
+            .def_property_readonly(
+                    "num_nodes",
+                    [](const LinearOctree &octree) {
+                        return octree.nodes_.size();
+                    },
+                    "int: Number of nodes in the octree.")
+            .def_readonly("origin", &LinearOctree::origin_,
+                          "(3, 1) float numpy array: Global min bound.")
+            .def_readonly("size", &LinearOctree::size_,
+                          "float: Outer bounding box edge size.")
+            .def_readonly("max_depth", &LinearOctree::max_depth_,
+                          "int: Depth of the leaf nodes.")
+            .def_readonly("point_indices", &LinearOctree::point_indices_,
+                          "List of point indices sorted by the Morton code of "
+                          "their leaf cell.");
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "create_from_point_cloud",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "locate_leaf_node",
+                                    map_octree_argument_docstrings);
 }
 
 void pybind_octree_methods(py::module &m) {}
@@ -81,11 +81,13 @@ void pybind_tetramesh(py::module &m) {
             .def("has_tetras", &TetraMesh::HasTetras,
                  "Returns ``True`` if the mesh contains tetras.")
             .def("extract_triangle_mesh", &TetraMesh::ExtractTriangleMesh,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that generates a triangle mesh of the specified "
                  "iso-surface.",
                  "values"_a, "level"_a)
             .def_static(
                     "create_from_point_cloud", &TetraMesh::CreateFromPointCloud,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function to create a tetrahedral mesh from a point cloud.",
                     "point_cloud"_a)
             .def_readwrite("vertices", &TetraMesh::vertices_,
@@ -36,6 +36,48 @@ namespace open3d {
 namespace geometry {
 
 void pybind_trianglemesh(py::module &m) {
+    py::class_<PoissonReconstructionOption> poisson_option(
+            m, "PoissonReconstructionOption",
+            "Octree and solver settings of "
+            "TriangleMesh.create_from_point_cloud_poisson.");
+    py::detail::bind_default_constructor<PoissonReconstructionOption>(
+            poisson_option);
+    py::detail::bind_copy_functions<PoissonReconstructionOption>(
+            poisson_option);
+    poisson_option
+            .def_readwrite("samples_per_node",
+                           &PoissonReconstructionOption::samples_per_node_,
+                           "Minimum number of points that should fall within "
+                           "an octree node. Use 1 to 5 for noise-free samples "
+                           "and 15 to 20 for noisy ones.")
+            .def_readwrite("point_weight",
+                           &PoissonReconstructionOption::point_weight_,
+                           "Importance of interpolating the point samples. "
+                           "Set to 0 for the unscreened reconstruction.")
+            .def_readwrite("confidence",
+                           &PoissonReconstructionOption::confidence_,
+                           "Exponent of the normal length used as the sample "
+                           "confidence. 0 ignores the normal lengths.")
+            .def_readwrite("full_depth",
+                           &PoissonReconstructionOption::full_depth_,
+                           "Octree depth up to which the tree is complete.")
+            .def_readwrite("base_depth",
+                           &PoissonReconstructionOption::base_depth_,
+                           "Coarsest depth of the multigrid solver.")
+            .def_readwrite("base_v_cycles",
+                           &PoissonReconstructionOption::base_v_cycles_,
+                           "Number of V-cycles at the base depth.")
+            .def_readwrite("iters", &PoissonReconstructionOption::iters_,
+                           "Number of Gauss-Seidel relaxations per level.")
+            .def_readwrite("cg_solver_accuracy",
+                           &PoissonReconstructionOption::cg_solver_accuracy_,
+                           "Relative accuracy of the conjugate gradient "
+                           "solver at the coarsest level.")
+            .def_readwrite("exact_interpolation",
+                           &PoissonReconstructionOption::exact_interpolation_,
+                           "If true, the point interpolation constraints are "
+                           "exact.");
+
     py::class_<TriangleMesh, PyGeometry3D<TriangleMesh>,
                std::shared_ptr<TriangleMesh>, MeshBase>
             trianglemesh(m, "TriangleMesh",
@@ -84,10 +126,12 @@ void pybind_trianglemesh(py::module &m) {
                  "list is needed")
             .def("remove_duplicated_vertices",
                  &TriangleMesh::RemoveDuplicatedVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that removes duplicated verties, i.e., vertices "
                  "that have identical coordinates.")
             .def("remove_duplicated_triangles",
                  &TriangleMesh::RemoveDuplicatedTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that removes duplicated triangles, i.e., removes "
                  "triangles that reference the same three vertices, "
                  "independent of their order.")
@@ -108,6 +152,7 @@ void pybind_trianglemesh(py::module &m) {
                  "area adjacent to the non-manifold edge until the number of "
                  "adjacent triangles to the edge is `<= 2`.")
             .def("merge_close_vertices", &TriangleMesh::MergeCloseVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that will merge close by vertices to a single one. "
                  "The vertex position, "
                  "normal and color will be the average of the vertices. The "
@@ -117,6 +162,7 @@ void pybind_trianglemesh(py::module &m) {
                  "close triangle soups.",
                  "eps"_a)
             .def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sharpen triangle mesh. The output value "
                  "(:math:`v_o`) is the input value (:math:`v_i`) plus strength "
                  "times the input value minus he sum of he adjacent values. "
@@ -125,6 +171,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "strength"_a = 1,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh with simple neighbour "
                  "average. :math:`v_o = \\frac{v_i + \\sum_{n \\in N} "
                  "v_n)}{|N| + 1}`, with :math:`v_i` being the input value, "
@@ -134,6 +181,7 @@ void pybind_trianglemesh(py::module &m) {
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_laplacian",
                  &TriangleMesh::FilterSmoothLaplacian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
                  "= v_i \\cdot \\lambda (sum_{n \\in N} w_n v_n - v_i)`, with "
                  ":math:`v_i` being the input value, :math:`v_o` the output "
@@ -144,6 +192,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using method of Taubin, "
                  "\"Curve and Surface Smoothing Without Shrinkage\", 1995. "
                  "Applies in each iteration two times filter_smooth_laplacian, "
@@ -182,6 +231,7 @@ void pybind_trianglemesh(py::module &m) {
                  "i.e., V + F - E, where V is the number of vertices, F is the "
                  "number of triangles, and E is the number of edges.")
             .def("get_non_manifold_edges", &TriangleMesh::GetNonManifoldEdges,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Get list of non-manifold edges.",
                  "allow_boundary_edges"_a = true)
             .def("is_edge_manifold", &TriangleMesh::IsEdgeManifold,
@@ -189,23 +239,30 @@ void pybind_trianglemesh(py::module &m) {
                  "allow_boundary_edges"_a = true)
             .def("get_non_manifold_vertices",
                  &TriangleMesh::GetNonManifoldVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Returns a list of indices to non-manifold vertices.")
             .def("is_vertex_manifold", &TriangleMesh::IsVertexManifold,
                  "Tests if all vertices of the triangle mesh are manifold.")
             .def("is_self_intersecting", &TriangleMesh::IsSelfIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is self-intersecting.")
             .def("get_self_intersecting_triangles",
                  &TriangleMesh::GetSelfIntersectingTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Returns a list of indices to triangles that intersect the "
                  "mesh.")
             .def("is_intersecting", &TriangleMesh::IsIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is intersecting the other "
                  "triangle mesh.")
             .def("is_orientable", &TriangleMesh::IsOrientable,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is orientable.")
             .def("is_watertight", &TriangleMesh::IsWatertight,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is watertight.")
             .def("orient_triangles", &TriangleMesh::OrientTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "If the mesh is orientable this function orients all "
                  "triangles such that all normals point towards the same "
                  "direction.")
@@ -238,11 +295,13 @@ void pybind_trianglemesh(py::module &m) {
                  "condition that it is watertight and orientable.")
             .def("sample_points_uniformly",
                  &TriangleMesh::SamplePointsUniformly,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to uniformly sample points from the mesh.",
                  "number_of_points"_a = 100, "use_triangle_normal"_a = false,
                  "seed"_a = -1)
             .def("sample_points_poisson_disk",
                  &TriangleMesh::SamplePointsPoissonDisk,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sample points from the mesh, where each point "
                  "has "
                  "approximately the same distance to the neighbouring points "
@@ -252,30 +311,45 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
                  "use_triangle_normal"_a = false, "seed"_a = -1)
             .def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using midpoint algorithm.",
                  "number_of_iterations"_a = 1)
             .def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using Loop's algorithm. Loop, "
                  "\"Smooth "
                  "subdivision surfaces based on triangles\", 1987.",
                  "number_of_iterations"_a = 1)
             .def("simplify_vertex_clustering",
                  &TriangleMesh::SimplifyVertexClustering,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using vertex clustering.",
                  "voxel_size"_a,
                  "contraction"_a = MeshBase::SimplificationContraction::Average)
             .def("simplify_quadric_decimation",
                  &TriangleMesh::SimplifyQuadricDecimation,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
                  "target_number_of_triangles"_a,
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
+            .def("simplify_quadric_decimation_parallel",
+                 &TriangleMesh::SimplifyQuadricDecimationParallel,
+                 "Parallel variant of simplify_quadric_decimation that "
+                 "collapses sets of non-overlapping edges per round. The "
+                 "result is comparable but not identical to the sequential "
+                 "version.",
+                 "target_number_of_triangles"_a,
+                 "maximum_error"_a = std::numeric_limits<double>::infinity(),
+                 "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
                  &TriangleMesh::ClusterConnectedTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that clusters connected triangles, i.e., triangles "
                  "that are connected via edges are assigned the same cluster "
                  "index.  This function returns an array that contains the "
@@ -307,6 +381,7 @@ void pybind_trianglemesh(py::module &m) {
                  "vertex_mask"_a)
             .def("deform_as_rigid_as_possible",
                  &TriangleMesh::DeformAsRigidAsPossible,
+                 py::call_guard<py::gil_scoped_release>(),
                  "This function deforms the mesh using the method by Sorkine "
                  "and Alexa, "
                  "'As-Rigid-As-Possible Surface Modeling', 2007",
@@ -320,6 +395,7 @@ void pybind_trianglemesh(py::module &m) {
                         return TriangleMesh::CreateFromPointCloudAlphaShape(
                                 pcd, alpha);
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Alpha shapes are a generalization of the convex hull. "
                     "With decreasing alpha value the shape schrinks and "
                     "creates cavities. See Edelsbrunner and Muecke, "
@@ -327,14 +403,29 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
                         &TriangleMesh::CreateFromPointCloudAlphaShape,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape shrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
                         "\"Three-Dimensional Alpha Shapes\", 1994.",
                         "pcd"_a, "alpha"_a, "tetra_mesh"_a, "pt_map"_a)
+            .def_static(
+                    "create_from_point_cloud_alpha_shapes",
+                    [](const PointCloud &pcd,
+                       const std::vector<double> &alphas) {
+                        return TriangleMesh::CreateFromPointCloudAlphaShapes(
+                                pcd, alphas);
+                    },
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Computes the alpha shapes of a point cloud for several "
+                    "alpha values. The Delaunay tetrahedralization and the "
+                    "circumradii of its tetras are computed once and reused "
+                    "for all the alpha values.",
+                    "pcd"_a, "alphas"_a)
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function that computes a triangle mesh from a oriented "
                     "PointCloud. This implements the Ball Pivoting algorithm "
                     "proposed in F. Bernardini et al., \"The ball-pivoting "
@@ -346,8 +437,19 @@ void pybind_trianglemesh(py::module &m) {
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
                     "pcd"_a, "radii"_a)
+            .def_static("create_from_point_cloud_ball_pivoting_parallel",
+                        &TriangleMesh::CreateFromPointCloudBallPivotingParallel,
+                        py::call_guard<py::gil_scoped_release>(),
+                        "Parallel variant of "
+                        "create_from_point_cloud_ball_pivoting. The point "
+                        "cloud is split into overlapping cells that are "
+                        "reconstructed independently and then stitched. The "
+                        "result is close to but not identical to the serial "
+                        "reconstruction.",
+                        "pcd"_a, "radii"_a, "cell_size"_a = 0.0)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Function that computes a triangle mesh from a "
                         "oriented PointCloud pcd. This implements the Screened "
                         "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
@@ -355,7 +457,8 @@ void pybind_trianglemesh(py::module &m) {
                         "This function uses the original implementation by "
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
-                        "linear_fit"_a = false, "n_threads"_a = -1)
+                        "linear_fit"_a = false, "n_threads"_a = -1,
+                        "option"_a = PoissonReconstructionOption())
             .def_static("create_box", &TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -617,6 +720,16 @@ void pybind_trianglemesh(py::module &m) {
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
               "boundaries"}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "simplify_quadric_decimation_parallel",
+            {{"target_number_of_triangles",
+              "The number of triangles that the simplified mesh should have. "
+              "It is not guaranteed that this number will be reached."},
+             {"maximum_error",
+              "The maximum error where a vertex is allowed to be merged"},
+             {"boundary_weight",
+              "A weight applied to edge vertices used to preserve "
+              "boundaries"}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -668,6 +781,14 @@ void pybind_trianglemesh(py::module &m) {
               "Otherwise, TetraMesh is computed from pcd."},
              {"pt_map",
               "Optional map from tetra_mesh vertex indices to pcd points."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_alpha_shapes",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surfaces are "
+              "reconstructed."},
+             {"alphas",
+              "Parameters to control the shapes, one mesh is returned per "
+              "value."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_ball_pivoting",
             {{"pcd",
@@ -676,6 +797,17 @@ void pybind_trianglemesh(py::module &m) {
              {"radii",
               "The radii of the ball that are used for the surface "
               "reconstruction."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_ball_pivoting_parallel",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"radii",
+              "The radii of the ball that are used for the surface "
+              "reconstruction."},
+             {"cell_size",
+              "Edge length of the cells. If not positive, it is chosen from "
+              "the extent of the point cloud and the number of threads."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
@@ -699,7 +831,8 @@ void pybind_trianglemesh(py::module &m) {
               "estimate the positions of iso-vertices."},
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
-              "automatically determine it."}});
+              "automatically determine it."},
+             {"option", "Octree and solver settings."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_box",
             {{"width", "x-directional length."},
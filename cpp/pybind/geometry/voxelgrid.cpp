@@ -100,7 +100,9 @@ void pybind_voxelgrid(py::module &m) {
                  "Element-wise check if a query in the list is included in "
                  "the VoxelGrid. Queries are double precision and "
                  "are mapped to the closest voxel.")
-            .def("carve_depth_map", &VoxelGrid::CarveDepthMap, "depth_map"_a,
+            .def("carve_depth_map", &VoxelGrid::CarveDepthMap,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "depth_map"_a,
                  "camera_params"_a, "keep_voxels_outside_image"_a = false,
                  "Remove all voxels from the VoxelGrid where none of the "
                  "boundary points of the voxel projects to depth value that is "
@@ -109,6 +111,7 @@ void pybind_voxelgrid(py::module &m) {
                  "only carved if all boundary points project to a valid image "
                  "location.")
             .def("carve_silhouette", &VoxelGrid::CarveSilhouette,
+                 py::call_guard<py::gil_scoped_release>(),
                  "silhouette_mask"_a, "camera_params"_a,
                  "keep_voxels_outside_image"_a = false,
                  "Remove all voxels from the VoxelGrid where none of the "
@@ -128,6 +131,7 @@ void pybind_voxelgrid(py::module &m) {
                         "height"_a, "depth"_a)
             .def_static("create_from_point_cloud",
                         &VoxelGrid::CreateFromPointCloud,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Creates a VoxelGrid from a given PointCloud. The "
                         "color value of a given  voxel is the average color "
                         "value of the points that fall into it (if the "
@@ -136,6 +140,7 @@ void pybind_voxelgrid(py::module &m) {
                         "input"_a, "voxel_size"_a)
             .def_static("create_from_point_cloud_within_bounds",
                         &VoxelGrid::CreateFromPointCloudWithinBounds,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Creates a VoxelGrid from a given PointCloud. The "
                         "color value of a given voxel is the average color "
                         "value of the points that fall into it (if the "
@@ -144,6 +149,7 @@ void pybind_voxelgrid(py::module &m) {
                         "input"_a, "voxel_size"_a, "min_bound"_a, "max_bound"_a)
             .def_static("create_from_triangle_mesh",
                         &VoxelGrid::CreateFromTriangleMesh,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Creates a VoxelGrid from a given TriangleMesh. No "
                         "color information is converted. The bounds of the "
                         "created VoxelGrid are computed from the  "
@@ -152,6 +158,7 @@ void pybind_voxelgrid(py::module &m) {
             .def_static(
                     "create_from_triangle_mesh_within_bounds",
                     &VoxelGrid::CreateFromTriangleMeshWithinBounds,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Creates a VoxelGrid from a given TriangleMesh. No color "
                     "information is converted. The bounds "
                     "of the created VoxelGrid are defined by the given "
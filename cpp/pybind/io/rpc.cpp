@@ -45,22 +45,63 @@ void pybind_rpc(py::module& m_io) {
     atexit.attr("register")(
             py::cpp_function([]() { rpc::DestroyZMQContext(); }));
 
+    py::enum_<rpc::ArrayTransport>(m, "ArrayTransport",
+                                   "How geometry arrays are transferred.")
+            .value("Inline", rpc::ArrayTransport::Inline,
+                   "Arrays are serialized into the message.")
+            .value("Frames", rpc::ArrayTransport::Frames,
+                   "Arrays are sent as separate frames without copying "
+                   "tensors.")
+            .value("SharedMemory", rpc::ArrayTransport::SharedMemory,
+                   "Arrays are passed in shared memory. Needs a local "
+                   "address.");
+
+    py::class_<rpc::MeshDataEncodingOptions>(m, "MeshDataEncodingOptions",
+                                             R"doc(
+Options for encoding the arrays of mesh data messages, e.g. for streaming
+geometry over low bandwidth links.
+)doc")
+            .def(py::init<>())
+            .def_readwrite("quantize_positions",
+                           &rpc::MeshDataEncodingOptions::quantize_positions,
+                           "Quantize vertex positions to 16 bit integers in "
+                           "their bounding box.")
+            .def_readwrite("colors_as_uint8",
+                           &rpc::MeshDataEncodingOptions::colors_as_uint8,
+                           "Send vertex colors in [0,1] as uint8.")
+            .def_readwrite("compress", &rpc::MeshDataEncodingOptions::compress,
+                           "Compress the arrays with LZF.")
+            .def_readwrite("delta", &rpc::MeshDataEncodingOptions::delta,
+                           "Send only the blocks of an array which changed "
+                           "since the last message with the same path.")
+            .def_readwrite("delta_block_size",
+                           &rpc::MeshDataEncodingOptions::delta_block_size,
+                           "Block size in bytes for delta updates.");
+
     py::class_<rpc::ConnectionBase, std::shared_ptr<rpc::ConnectionBase>>(
-            m, "_ConnectionBase");
+            m, "_ConnectionBase")
+            .def("set_mesh_data_encoding",
+                 &rpc::ConnectionBase::SetMeshDataEncoding,
+                 "Sets how the arrays of mesh data messages are encoded. Delta "
+                 "updates are relative to the previous message sent with this "
+                 "connection.",
+                 "options"_a);
 
     py::class_<rpc::Connection, std::shared_ptr<rpc::Connection>,
                rpc::ConnectionBase>(m, "Connection", R"doc(
 The default connection class which uses a ZeroMQ socket.
 )doc")
             .def(py::init([](std::string address, int connect_timeout,
-                             int timeout) {
+                             int timeout,
+                             rpc::ArrayTransport array_transport) {
                      return std::shared_ptr<rpc::Connection>(
                              new rpc::Connection(address, connect_timeout,
-                                                 timeout));
+                                                 timeout, array_transport));
                  }),
                  "Creates a connection object",
                  "address"_a = "tcp://127.0.0.1:51454",
-                 "connect_timeout"_a = 5000, "timeout"_a = 10000);
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000,
+                 "array_transport"_a = rpc::ArrayTransport::Inline);
 
     py::class_<rpc::BufferConnection, std::shared_ptr<rpc::BufferConnection>,
                rpc::ConnectionBase>(m, "BufferConnection", R"doc(
@@ -41,6 +41,8 @@ void pybind_sensor(py::module &m) {
                     {"sensor_index", "The selected device index."},
                     {"config", "AzureKinectSensor's config file."},
                     {"timestamp", "Timestamp in the video (usec)."},
+                    {"index", "Index of the frame in the video."},
+                    {"cache_size", "Maximum number of cached frames."},
                     {"filename", "Path to the mkv file."},
                     {"enable_record", "Enable recording to mkv file."},
                     {"enable_align_depth_to_color",
@@ -96,16 +98,38 @@ void pybind_sensor(py::module &m) {
     docstring::ClassMethodDocInject(m, "AzureKinectSensor", "list_devices",
                                     map_shared_argument_docstrings);
 
+    // Class writer statistics
+    py::class_<AsyncFrameWriterStatistics> writer_statistics(
+            m, "AsyncFrameWriterStatistics",
+            "Statistics of the thread writing recorded frames.");
+    writer_statistics
+            .def_readonly("num_written",
+                          &AsyncFrameWriterStatistics::num_written,
+                          "Frames written successfully.")
+            .def_readonly("num_dropped",
+                          &AsyncFrameWriterStatistics::num_dropped,
+                          "Frames dropped because the queue was full.")
+            .def_readonly("num_failed", &AsyncFrameWriterStatistics::num_failed,
+                          "Frames that could not be written.")
+            .def_readonly("queue_depth",
+                          &AsyncFrameWriterStatistics::queue_depth,
+                          "Frames waiting in the queue.")
+            .def_readonly("max_queue_depth",
+                          &AsyncFrameWriterStatistics::max_queue_depth,
+                          "Largest queue depth seen so far.")
+            .def("__repr__", &AsyncFrameWriterStatistics::ToString);
+
     // Class recorder
     py::class_<AzureKinectRecorder> azure_kinect_recorder(
             m, "AzureKinectRecorder", "AzureKinect recorder.");
 
     azure_kinect_recorder.def(
             py::init([](const AzureKinectSensorConfig &sensor_config,
-                        size_t sensor_index) {
-                return new AzureKinectRecorder(sensor_config, sensor_index);
+                        size_t sensor_index, size_t write_queue_size) {
+                return new AzureKinectRecorder(sensor_config, sensor_index,
+                                               write_queue_size);
             }),
-            "sensor_config"_a, "sensor_index"_a);
+            "sensor_config"_a, "sensor_index"_a, "write_queue_size"_a = 30);
     azure_kinect_recorder
             .def("init_sensor", &AzureKinectRecorder::InitSensor,
                  "Initialize sensor.")
@@ -118,7 +142,10 @@ void pybind_sensor(py::module &m) {
             .def("record_frame", &AzureKinectRecorder::RecordFrame,
                  "enable_record"_a, "enable_align_depth_to_color"_a,
                  "Record a frame to mkv if flag is on and return an RGBD "
-                 "object.");
+                 "object.")
+            .def("get_writer_statistics",
+                 &AzureKinectRecorder::GetWriterStatistics,
+                 "Statistics of the thread writing the mkv file.");
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder", "init_sensor",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder",
@@ -130,6 +157,9 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder", "record_frame",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectRecorder",
+                                    "get_writer_statistics",
+                                    map_shared_argument_docstrings);
 
     // Class mkv reader
     py::class_<MKVReader> azure_kinect_mkv_reader(
@@ -149,7 +179,18 @@ void pybind_sensor(py::module &m) {
                  "Seek to the timestamp (in us).")
             .def("next_frame", &MKVReader::NextFrame,
                  "Get next frame from the mkv playback and returns the RGBD "
-                 "object.");
+                 "object.")
+            .def("get_num_frames", &MKVReader::GetNumFrames,
+                 "Number of frames in the mkv playback.")
+            .def("get_frame_timestamp", &MKVReader::GetFrameTimestamp,
+                 "index"_a, "Timestamp (in us) of a frame.")
+            .def("seek_frame", &MKVReader::SeekFrame, "index"_a,
+                 "Seek to a frame.")
+            .def("get_frame", &MKVReader::GetFrame, "index"_a,
+                 "Get a frame from the cache or from the mkv playback and "
+                 "returns the RGBD object.")
+            .def("set_cache_size", &MKVReader::SetCacheSize, "cache_size"_a,
+                 "Set the maximum number of frames cached by get_frame.");
     docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "open",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "close",
@@ -162,6 +203,19 @@ void pybind_sensor(py::module &m) {
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "next_frame",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader",
+                                    "get_num_frames",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader",
+                                    "get_frame_timestamp",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "seek_frame",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader", "get_frame",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "AzureKinectMKVReader",
+                                    "set_cache_size",
+                                    map_shared_argument_docstrings);
 }
 
 }  // namespace io
@@ -27,6 +27,7 @@
 #include "pybind/pipelines/color_map/color_map.h"
 
 #include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/Device.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/pipelines/color_map/NonRigidOptimizer.h"
@@ -104,7 +105,11 @@ void pybind_color_map_options(py::module &m) {
             {"debug_output_dir",
              "If specified, the intermediate results will be stored in in the "
              "debug output dir. Existing files will be overwritten if the "
-             "names are the same."}};
+             "names are the same."},
+            {"device",
+             "open3d.core.Device: (Default ``CPU:0``) Device of the "
+             "visibility check. On a CUDA device the vertices are tested "
+             "against each depth image with tensor operations."}};
 
     py::class_<pipelines::color_map::RigidOptimizerOption>
             rigid_optimizer_option(m, "RigidOptimizerOption",
@@ -116,7 +121,8 @@ void pybind_color_map_options(py::module &m) {
                         int half_dilation_kernel_size_for_discontinuity_map,
                         int image_boundary_margin,
                         int invisible_vertex_color_knn,
-                        const std::string &debug_output_dir) {
+                        const std::string &debug_output_dir,
+                        const core::Device &device) {
                 auto option = new pipelines::color_map::RigidOptimizerOption;
                 option->maximum_iteration_ = maximum_iteration;
                 option->maximum_allowable_depth_ = maximum_allowable_depth;
@@ -130,6 +136,7 @@ void pybind_color_map_options(py::module &m) {
                 option->invisible_vertex_color_knn_ =
                         invisible_vertex_color_knn;
                 option->debug_output_dir_ = debug_output_dir;
+                option->device_ = device;
                 return option;
             }),
             "maximum_iteration"_a = 0, "maximum_allowable_depth"_a = 2.5,
@@ -137,7 +144,7 @@ void pybind_color_map_options(py::module &m) {
             "depth_threshold_for_discontinuity_check"_a = 0.1,
             "half_dilation_kernel_size_for_discontinuity_map"_a = 3,
             "image_boundary_margin"_a = 10, "invisible_vertex_color_knn"_a = 3,
-            "debug_output_dir"_a = "");
+            "debug_output_dir"_a = "", "device"_a = core::Device("CPU:0"));
 
     docstring::ClassMethodDocInject(m, "RigidOptimizerOption", "__init__",
                                     colormap_docstrings);
@@ -154,7 +161,8 @@ void pybind_color_map_options(py::module &m) {
                         int half_dilation_kernel_size_for_discontinuity_map,
                         int image_boundary_margin,
                         int invisible_vertex_color_knn,
-                        const std::string &debug_output_dir) {
+                        const std::string &debug_output_dir,
+                        const core::Device &device) {
                 auto option = new pipelines::color_map::NonRigidOptimizerOption;
                 option->number_of_vertical_anchors_ =
                         number_of_vertical_anchors;
@@ -172,6 +180,7 @@ void pybind_color_map_options(py::module &m) {
                 option->invisible_vertex_color_knn_ =
                         invisible_vertex_color_knn;
                 option->debug_output_dir_ = debug_output_dir;
+                option->device_ = device;
                 return option;
             }),
             "number_of_vertical_anchors"_a = 16,
@@ -181,7 +190,7 @@ void pybind_color_map_options(py::module &m) {
             "depth_threshold_for_discontinuity_check"_a = 0.1,
             "half_dilation_kernel_size_for_discontinuity_map"_a = 3,
             "image_boundary_margin"_a = 10, "invisible_vertex_color_knn"_a = 3,
-            "debug_output_dir"_a = "");
+            "debug_output_dir"_a = "", "device"_a = core::Device("CPU:0"));
 
     docstring::ClassMethodDocInject(m, "NonRigidOptimizerOption", "__init__",
                                     colormap_docstrings);
@@ -189,9 +198,11 @@ void pybind_color_map_options(py::module &m) {
 
 void pybind_color_map_classes(py::module &m) {
     m.def("run_rigid_optimizer", &pipelines::color_map::RunRigidOptimizer,
+          py::call_guard<py::gil_scoped_release>(),
           "Run rigid optimization.");
     m.def("run_non_rigid_optimizer",
           &pipelines::color_map::RunNonRigidOptimizer,
+          py::call_guard<py::gil_scoped_release>(),
           "Run non-rigid optimization.");
 }
 
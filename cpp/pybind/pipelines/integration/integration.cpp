@@ -30,6 +30,7 @@
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 #include "open3d/pipelines/integration/TSDFVolume.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
+#include "open3d/pipelines/integration/VoxelBlockGridTSDFVolume.h"
 #include "pybind/docstring.h"
 
 namespace open3d {
@@ -88,11 +89,14 @@ In SIGGRAPH, 1996)");
             .def("reset", &TSDFVolume::Reset,
                  "Function to reset the TSDFVolume")
             .def("integrate", &TSDFVolume::Integrate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to integrate an RGB-D image into the volume",
                  "image"_a, "intrinsic"_a, "extrinsic"_a)
             .def("extract_point_cloud", &TSDFVolume::ExtractPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a point cloud with normals")
             .def("extract_triangle_mesh", &TSDFVolume::ExtractTriangleMesh,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a triangle mesh")
             .def_readwrite("voxel_length", &TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
@@ -144,8 +148,10 @@ In SIGGRAPH, 1996)");
                  })  // todo: extend
             .def("extract_voxel_point_cloud",
                  &UniformTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point cloud.")
             .def("extract_voxel_grid", &UniformTSDFVolume::ExtractVoxelGrid,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data VoxelGrid.")
             .def("extract_volume_tsdf", &UniformTSDFVolume::ExtractVolumeTSDF,
                  "Debug function to extract the volume TSDF data.")
@@ -210,10 +216,46 @@ In SIGGRAPH, 2013)");
                  })
             .def("extract_voxel_point_cloud",
                  &ScalableTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point "
                  "cloud.");
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
                                     "extract_voxel_point_cloud");
+
+    // open3d.integration.VoxelBlockGridTSDFVolume:
+    // open3d.integration.TSDFVolume
+    py::class_<VoxelBlockGridTSDFVolume,
+               PyTSDFVolume<VoxelBlockGridTSDFVolume>, TSDFVolume>
+            vbg_tsdfvolume(m, "VoxelBlockGridTSDFVolume", R"(The
+VoxelBlockGridTSDFVolume implements the TSDFVolume interface on top of
+open3d.t.geometry.VoxelBlockGrid, so that code written against TSDFVolume
+integrates on the GPU. Each frame is uploaded to the device once, and the
+extracted point clouds and meshes are converted to the legacy types.)");
+    vbg_tsdfvolume
+            .def(py::init([](double voxel_length, double sdf_trunc,
+                             TSDFVolumeColorType color_type,
+                             int block_resolution, int block_count,
+                             const core::Device &device) {
+                     return new VoxelBlockGridTSDFVolume(
+                             voxel_length, sdf_trunc, color_type,
+                             block_resolution, block_count, device);
+                 }),
+                 "voxel_length"_a, "sdf_trunc"_a, "color_type"_a,
+                 "block_resolution"_a = 16, "block_count"_a = 10000,
+                 "device"_a = VoxelBlockGridTSDFVolume::GetDefaultDevice())
+            .def("__repr__",
+                 [](const VoxelBlockGridTSDFVolume &vol) {
+                     return std::string("VoxelBlockGridTSDFVolume on ") +
+                            vol.device_.ToString() +
+                            (vol.color_type_ == TSDFVolumeColorType::NoColor
+                                     ? std::string(" without color.")
+                                     : std::string(" with color."));
+                 })
+            .def_readonly("block_resolution",
+                          &VoxelBlockGridTSDFVolume::block_resolution_,
+                          "Number of voxels per side of a voxel block.")
+            .def_readonly("device", &VoxelBlockGridTSDFVolume::device_,
+                          "Device of the voxel block grid.");
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -120,6 +120,25 @@ void pybind_odometry_classes(py::module &m) {
                        std::to_string(c.max_depth_);
             });
 
+    // open3d.odometry.RGBDOdometryFrame
+    py::class_<RGBDOdometryFrame> frame(
+            m, "RGBDOdometryFrame",
+            "RGBD image prepared for odometry. Holds the intensity and depth "
+            "pyramids and their gradients, so that a frame of a sequence is "
+            "prepared once for the two pairs it belongs to.");
+    frame.def(py::init<const geometry::RGBDImage &,
+                       const camera::PinholeCameraIntrinsic &,
+                       const OdometryOption &>(),
+              "image"_a, "pinhole_camera_intrinsic"_a,
+              "option"_a = OdometryOption())
+            .def("is_empty", &RGBDOdometryFrame::IsEmpty,
+                 "Returns ``True`` if the frame is not prepared.")
+            .def("__repr__", [](const RGBDOdometryFrame &f) {
+                return std::string("RGBDOdometryFrame with ") +
+                       std::to_string(f.pyramid_.size()) +
+                       std::string(" pyramid levels.");
+            });
+
     // open3d.odometry.RGBDOdometryJacobian
     py::class_<RGBDOdometryJacobian,
                PyRGBDOdometryJacobian<RGBDOdometryJacobian>>
@@ -177,7 +196,13 @@ Anonymous submission.)");
 }
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("compute_rgbd_odometry", &ComputeRGBDOdometry,
+    m.def("compute_rgbd_odometry",
+          py::overload_cast<const geometry::RGBDImage &,
+                            const geometry::RGBDImage &,
+                            const camera::PinholeCameraIntrinsic &,
+                            const Eigen::Matrix4d &,
+                            const RGBDOdometryJacobian &,
+                            const OdometryOption &>(&ComputeRGBDOdometry),
           py::call_guard<py::gil_scoped_release>(),
           "Function to estimate 6D rigid motion from two RGBD image pairs. "
           "Output: (is_success, 4x4 motion matrix, 6x6 information matrix).",
@@ -201,6 +226,18 @@ void pybind_odometry_methods(py::module &m) {
                      ").``"},
                     {"option", "Odometry hyper parameteres."},
             });
+    m.def("compute_rgbd_odometry",
+          py::overload_cast<const RGBDOdometryFrame &,
+                            const RGBDOdometryFrame &, const Eigen::Matrix4d &,
+                            const RGBDOdometryJacobian &,
+                            const OdometryOption &>(&ComputeRGBDOdometry),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to estimate 6D rigid motion from two prepared RGBD "
+          "frames. Output: (is_success, 4x4 motion matrix, 6x6 information "
+          "matrix).",
+          "source"_a, "target"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+          "jacobian"_a = RGBDOdometryJacobianFromHybridTerm(),
+          "option"_a = OdometryOption());
 }
 
 void pybind_odometry(py::module &m) {
@@ -29,12 +29,14 @@
 #include <memory>
 #include <utility>
 
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/ColoredICP.h"
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/GeneralizedICP.h"
+#include "open3d/pipelines/registration/MultiwayRegistration.h"
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Logging.h"
@@ -533,6 +535,52 @@ must hold true for all edges.)");
                                             : "None");
             });
 
+    // open3d.registration.MultiwayRegistrationOption:
+    py::class_<MultiwayRegistrationOption> multiway_option(
+            m, "MultiwayRegistrationOption",
+            "Options for create_pose_graph_from_point_clouds.");
+    py::detail::bind_copy_functions<MultiwayRegistrationOption>(
+            multiway_option);
+    multiway_option
+            .def(py::init<double, double, double>(),
+                 "max_correspondence_distance"_a = 0.05,
+                 "min_fitness"_a = 0.3, "bounding_box_margin"_a = 0.0)
+            .def_readwrite("max_correspondence_distance",
+                           &MultiwayRegistrationOption::
+                                   max_correspondence_distance_,
+                           "float: Maximum correspondence points-pair "
+                           "distance of the pairwise registrations.")
+            .def_readwrite("min_fitness",
+                           &MultiwayRegistrationOption::min_fitness_,
+                           "float: Pairs registered with a lower fitness are "
+                           "left out of the pose graph.")
+            .def_readwrite("bounding_box_margin",
+                           &MultiwayRegistrationOption::bounding_box_margin_,
+                           "float: Margin added to the bounding boxes of the "
+                           "fragments before testing them for overlap.")
+            .def_readwrite("ransac_criteria",
+                           &MultiwayRegistrationOption::ransac_criteria_,
+                           "RANSACConvergenceCriteria: Convergence criteria "
+                           "of the feature based RANSAC registration.")
+            .def_readwrite("icp_criteria",
+                           &MultiwayRegistrationOption::icp_criteria_,
+                           "ICPConvergenceCriteria: Convergence criteria of "
+                           "the ICP refinement.")
+            .def_readwrite("seed", &MultiwayRegistrationOption::seed_,
+                           "unsigned int: Random seed of RANSAC.")
+            .def("__repr__", [](const MultiwayRegistrationOption &c) {
+                return fmt::format(
+                        "MultiwayRegistrationOption class "
+                        "with \nmax_correspondence_distance={}"
+                        "\nmin_fitness={}"
+                        "\nbounding_box_margin={}"
+                        "\nseed={}",
+                        c.max_correspondence_distance_, c.min_fitness_,
+                        c.bounding_box_margin_,
+                        c.seed_.has_value() ? std::to_string(c.seed_.value())
+                                            : "None");
+            });
+
     // open3d.registration.RegistrationResult
     py::class_<RegistrationResult> registration_result(
             m, "RegistrationResult",
@@ -598,6 +646,10 @@ static const std::unordered_map<std::string, std::string>
                 {"kernel", "Robust Kernel used in the Optimization"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
+                {"feature_search_eps",
+                 "Approximation factor of the feature nearest neighbor "
+                 "search. 0 matches features exactly, larger values trade "
+                 "matching accuracy for speed."},
                 {"mutual_filter",
                  "Enables mutual filter such that the correspondence of the "
                  "source point's correspondence is itself."},
@@ -607,6 +659,7 @@ static const std::unordered_map<std::string, std::string>
                 {"source_feature", "Source point cloud feature."},
                 {"source", "The source point cloud."},
                 {"target_feature", "Target point cloud feature."},
+                {"target_kdtree", "KDTreeFlann built on ``target``."},
                 {"target", "The target point cloud."},
                 {"transformation",
                  "The 4x4 transformation matrix to transform ``source`` to "
@@ -621,13 +674,33 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &RegistrationICP,
+    m.def("registration_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &,
+                            const TransformationEstimation &,
+                            const ICPConvergenceCriteria &>(&RegistrationICP),
           py::call_guard<py::gil_scoped_release>(),
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "estimation_method"_a = TransformationEstimationPointToPoint(false),
           "criteria"_a = ICPConvergenceCriteria());
+    m.def("registration_icp",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &,
+                            const geometry::KDTreeFlann &, double,
+                            const Eigen::Matrix4d &,
+                            const TransformationEstimation &,
+                            const ICPConvergenceCriteria &>(&RegistrationICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration with a KDTreeFlann prebuilt on the "
+          "target point cloud.",
+          "source"_a, "target"_a, "target_kdtree"_a,
+          "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "criteria"_a = ICPConvergenceCriteria());
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
@@ -642,6 +715,7 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("registration_generalized_icp", &RegistrationGeneralizedICP,
+          py::call_guard<py::gil_scoped_release>(),
           "Function for Generalized ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -677,7 +751,7 @@ void pybind_registration_methods(py::module &m) {
           "checkers"_a = std::vector<
                   std::reference_wrapper<const CorrespondenceChecker>>(),
           "criteria"_a = RANSACConvergenceCriteria(100000, 0.999),
-          "seed"_a = py::none());
+          "seed"_a = py::none(), "feature_search_eps"_a = 0.0);
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
@@ -692,7 +766,10 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("get_information_matrix_from_point_clouds",
-          &GetInformationMatrixFromPointClouds,
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::PointCloud &, double,
+                            const Eigen::Matrix4d &>(
+                  &GetInformationMatrixFromPointClouds),
           py::call_guard<py::gil_scoped_release>(),
           "Function for computing information matrix from transformation "
           "matrix",
@@ -700,6 +777,26 @@ void pybind_registration_methods(py::module &m) {
           "transformation"_a);
     docstring::FunctionDocInject(m, "get_information_matrix_from_point_clouds",
                                  map_shared_argument_docstrings);
+
+    m.def("create_pose_graph_from_point_clouds",
+          &CreatePoseGraphFromPointClouds,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for building a pose graph by registering a sequence of "
+          "point cloud fragments in parallel. Consecutive fragments and "
+          "fragments whose bounding boxes overlap under the initial poses are "
+          "registered.",
+          "fragments"_a,
+          "features"_a = std::vector<std::shared_ptr<Feature>>(),
+          "initial_poses"_a = std::vector<Eigen::Matrix4d,
+                                          utility::Matrix4d_allocator>(),
+          "option"_a = MultiwayRegistrationOption());
+    docstring::FunctionDocInject(
+            m, "create_pose_graph_from_point_clouds",
+            {{"fragments", "Point cloud fragments, in their own frames."},
+             {"features", "Feature of each fragment, or empty."},
+             {"initial_poses",
+              "Pose of each fragment, e.g. from odometry, or empty."},
+             {"option", "Registration option"}});
 }
 
 void pybind_registration(py::module &m) {
@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/BoundingVolume.h"
+
+#include "pybind/docstring.h"
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// All functions take the clusters as points and row splits.
+static const std::unordered_map<std::string, std::string>
+        map_shared_argument_docstrings = {
+                {"points",
+                 "Float32 or Float64 positions of shape {N, 3}, the points "
+                 "of all clusters one after the other."},
+                {"row_splits",
+                 "Int64 tensor of shape {B + 1}. Cluster i has the points "
+                 "[row_splits[i], row_splits[i + 1])."},
+                {"method", "How to choose the orientation of the boxes."}};
+
+void pybind_bounding_volume_methods(py::module& m) {
+    py::enum_<bounding_volume::OrientedBoundingBoxMethod>(
+            m, "OrientedBoundingBoxMethod",
+            "Methods to fit an oriented bounding box to each cluster.")
+            .value("PCA", bounding_volume::OrientedBoundingBoxMethod::PCA,
+                   "Box aligned with the principal axes of the points.")
+            .value("MinimalUprightArea",
+                   bounding_volume::OrientedBoundingBoxMethod::
+                           MinimalUprightArea,
+                   "Box with vertical z axis and the smallest footprint in "
+                   "the xy plane.")
+            .export_values();
+
+    m.def(
+            "compute_axis_aligned_bounding_boxes",
+            [](const core::Tensor& points, const core::Tensor& row_splits) {
+                return bounding_volume::ComputeAxisAlignedBoundingBoxes(
+                        core::RaggedTensor(points, row_splits));
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Computes the axis aligned bounding box of each cluster. Returns "
+            "the tuple (min_bounds, max_bounds) of shape {B, 3}.",
+            "points"_a, "row_splits"_a);
+    m.def(
+            "compute_oriented_bounding_boxes",
+            [](const core::Tensor& points, const core::Tensor& row_splits,
+               bounding_volume::OrientedBoundingBoxMethod method) {
+                return bounding_volume::ComputeOrientedBoundingBoxes(
+                        core::RaggedTensor(points, row_splits), method);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Computes an oriented bounding box for each cluster. Returns the "
+            "tuple (centers, rotations, extents) of shapes {B, 3}, {B, 3, 3} "
+            "and {B, 3}.",
+            "points"_a, "row_splits"_a,
+            "method"_a = bounding_volume::OrientedBoundingBoxMethod::PCA);
+    m.def(
+            "compute_convex_hulls",
+            [](const core::Tensor& points, const core::Tensor& row_splits) {
+                const core::RaggedTensor hulls =
+                        bounding_volume::ComputeConvexHulls(
+                                core::RaggedTensor(points, row_splits));
+                return std::make_tuple(hulls.GetValues(),
+                                       hulls.GetRowSplits());
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Computes the 3D convex hull of each cluster with Qhull, one "
+            "cluster per thread. Returns the tuple (triangles, "
+            "triangle_row_splits). The triangles index the rows of points.",
+            "points"_a, "row_splits"_a);
+
+    docstring::FunctionDocInject(m, "compute_axis_aligned_bounding_boxes",
+                                 map_shared_argument_docstrings);
+    docstring::FunctionDocInject(m, "compute_oriented_bounding_boxes",
+                                 map_shared_argument_docstrings);
+    docstring::FunctionDocInject(m, "compute_convex_hulls",
+                                 map_shared_argument_docstrings);
+}
+
+void pybind_bounding_volume(py::module& m) {
+    py::module m_submodule = m.def_submodule(
+            "bounding_volume", "Batched bounding volumes of point clusters.");
+    pybind_bounding_volume_methods(m_submodule);
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -26,6 +26,8 @@
 
 #include "open3d/t/geometry/Geometry.h"
 
+#include "open3d/t/geometry/Metrics.h"
+
 #include "pybind/docstring.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -46,6 +48,27 @@ void pybind_geometry_class(py::module& m) {
     docstring::ClassMethodDocInject(m, "Geometry", "is_empty");
 }
 
+void pybind_metrics(py::module& m) {
+    py::enum_<Metric>(m, "Metric", "Metrics for comparing two geometries.")
+            .value("ChamferDistance", Metric::ChamferDistance,
+                   "Mean distance to the other geometry, summed over both "
+                   "directions.")
+            .value("HausdorffDistance", Metric::HausdorffDistance,
+                   "Largest distance from either geometry to the other one.")
+            .value("FScore", Metric::FScore,
+                   "Harmonic mean of precision and recall at each F-Score "
+                   "threshold, in [0, 1].")
+            .export_values();
+
+    py::class_<MetricParameters> metric_params(
+            m, "MetricParameters",
+            "Holder for the parameters of the geometry comparison metrics.");
+    metric_params.def(py::init<>())
+            .def_readwrite("fscore_radius", &MetricParameters::fscore_radius,
+                           "Distance thresholds at which the F-Score is "
+                           "evaluated.");
+}
+
 void pybind_geometry(py::module& m) {
     py::module m_submodule = m.def_submodule(
             "geometry", "Tensor-based geometry defining module.");
@@ -53,12 +76,17 @@ void pybind_geometry(py::module& m) {
     pybind_geometry_class(m_submodule);
     pybind_drawable_geometry_class(m_submodule);
     pybind_tensormap(m_submodule);
+    pybind_metrics(m_submodule);
     pybind_pointcloud(m_submodule);
+    pybind_keypoint(m_submodule);
+    pybind_bounding_volume(m_submodule);
     pybind_lineset(m_submodule);
     pybind_trianglemesh(m_submodule);
     pybind_image(m_submodule);
     pybind_tsdf_voxelgrid(m_submodule);
     pybind_voxel_block_grid(m_submodule);
+    pybind_pinhole_camera_trajectory(m_submodule);
+    pybind_voxel_grid(m_submodule);
     pybind_raycasting_scene(m_submodule);
 }
 
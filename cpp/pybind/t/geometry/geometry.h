@@ -52,13 +52,18 @@ void pybind_geometry(py::module& m);
 void pybind_geometry_class(py::module& m);
 void pybind_drawable_geometry_class(py::module& m);
 void pybind_tensormap(py::module& m);
+void pybind_metrics(py::module& m);
 void pybind_image(py::module& m);
 void pybind_pointcloud(py::module& m);
+void pybind_keypoint(py::module& m);
+void pybind_bounding_volume(py::module& m);
 void pybind_lineset(py::module& m);
 void pybind_trianglemesh(py::module& m);
+void pybind_pinhole_camera_trajectory(py::module& m);
 void pybind_image(py::module& m);
 void pybind_tsdf_voxelgrid(py::module& m);
 void pybind_voxel_block_grid(py::module& m);
+void pybind_voxel_grid(py::module& m);
 void pybind_raycasting_scene(py::module& m);
 
 }  // namespace geometry
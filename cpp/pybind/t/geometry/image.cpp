@@ -130,20 +130,29 @@ void pybind_image(py::module &m) {
                  "Function to linearly transform pixel intensities in place: "
                  "image = scale * image + offset.",
                  "scale"_a = 1.0, "offset"_a = 0.0)
-            .def("dilate", &Image::Dilate,
+            .def("dilate", py::overload_cast<int>(&Image::Dilate, py::const_),
                  "Return a new image after performing morphological dilation. "
                  "Supported datatypes are UInt8, UInt16 and Float32 with "
                  "{1, 3, 4} channels. An 8-connected neighborhood is used to "
                  "create the dilation mask.",
                  "kernel_size"_a = 3)
-            .def("filter", &Image::Filter,
+            .def("filter",
+                 py::overload_cast<const core::Tensor &>(&Image::Filter,
+                                                         py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after filtering with the given kernel.",
                  "kernel"_a)
-            .def("filter_gaussian", &Image::FilterGaussian,
+            .def("filter_gaussian",
+                 py::overload_cast<int, float>(&Image::FilterGaussian,
+                                               py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after Gaussian filtering. "
                  "Possible kernel_size: odd numbers >= 3 are supported.",
                  "kernel_size"_a = 3, "sigma"_a = 1.0)
-            .def("filter_bilateral", &Image::FilterBilateral,
+            .def("filter_bilateral",
+                 py::overload_cast<int, float, float>(&Image::FilterBilateral,
+                                                      py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after bilateral filtering."
                  "Note: CPU (IPP) and CUDA (NPP) versions are inconsistent: "
                  "CPU uses a round kernel (radius = floor(kernel_size / 2)), "
@@ -151,17 +160,36 @@ void pybind_image(py::module &m) {
                  "Make sure to tune parameters accordingly.",
                  "kernel_size"_a = 3, "value_sigma"_a = 20.0,
                  "dist_sigma"_a = 10.0)
-            .def("filter_sobel", &Image::FilterSobel,
+            .def("filter_sobel",
+                 py::overload_cast<int>(&Image::FilterSobel, py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a pair of new gradient images (dx, dy) after Sobel "
                  "filtering. Possible kernel_size: 3 and 5.",
                  "kernel_size"_a = 3)
             .def("resize", &Image::Resize,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Return a new image after resizing with specified "
                  "interpolation type. Downsample if sampling rate is < 1. "
                  "Upsample if sampling rate > 1. Aspect ratio is always "
                  "kept.",
                  "sampling_rate"_a = 0.5,
                  "interp_type"_a = Image::InterpType::Nearest)
+            .def("remap",
+                 py::overload_cast<const core::Tensor &, Image::InterpType>(
+                         &Image::Remap, py::const_),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Return a new image sampled at the (x, y) source coordinates "
+                 "in map, a Float32 tensor of shape (rows, cols, 2). Pixels "
+                 "mapped outside of the image are set to 0. Only Nearest and "
+                 "Linear interpolation are supported.",
+                 "map"_a, "interp_type"_a = Image::InterpType::Linear)
+            .def("undistort", &Image::Undistort,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Return a new undistorted image. The lookup table is "
+                 "computed on every call, use create_undistort_map and remap "
+                 "for video.",
+                 "intrinsics"_a, "distortion"_a,
+                 "interp_type"_a = Image::InterpType::Linear)
             .def("pyrdown", &Image::PyrDown,
                  "Return a new downsampled image with pyramid downsampling "
                  "formed by a chained Gaussian filter (kernel_size = 5, sigma"
@@ -184,12 +212,14 @@ void pybind_image(py::module &m) {
               "Use INF, NAN or 0.0 (default) for clip_fill",
               "scale"_a, "min_value"_a, "max_value"_a, "clip_fill"_a = 0.0f);
     image.def("create_vertex_map", &Image::CreateVertexMap,
+              py::call_guard<py::gil_scoped_release>(),
               "Create a vertex map of shape (rows, cols, channels=3) in Float32"
               " from an image of shape (rows, cols, channels=1) in Float32 "
               "using unprojection. The input depth is expected to be the output"
               " of clip_transform.",
               "intrinsics"_a, "invalid_fill"_a = 0.0f);
     image.def("create_normal_map", &Image::CreateNormalMap,
+              py::call_guard<py::gil_scoped_release>(),
               "Create a normal map of shape (rows, cols, channels=3) in Float32"
               " from a vertex map of shape (rows, cols, channels=1) in Float32 "
               "using cross product of V(r, c+1)-V(r, c) and V(r+1, c)-V(r, c)"
@@ -199,6 +229,7 @@ void pybind_image(py::module &m) {
               "invalid_fill"_a = 0.0f);
     image.def(
             "colorize_depth", &Image::ColorizeDepth,
+            py::call_guard<py::gil_scoped_release>(),
             "Colorize an input depth image (with Dtype UInt16 or Float32). The"
             " image values are divided by scale, then clamped within "
             "(min_value, max_value) and finally converted to a 3 channel UInt8"
@@ -250,6 +281,14 @@ void pybind_image(py::module &m) {
     image.def_static("from_legacy", &Image::FromLegacy, "image_legacy"_a,
                      "device"_a = core::Device("CPU:0"),
                      "Create a Image from a legacy Open3D Image.");
+    image.def_static(
+            "create_undistort_map", &Image::CreateUndistortMap,
+            "intrinsics"_a, "distortion"_a, "rows"_a, "cols"_a,
+            "device"_a = core::Device("CPU:0"),
+            "Compute a remap lookup table of shape (rows, cols, 2) that "
+            "undistorts images taken with the given 3x3 camera matrix and "
+            "OpenCV-ordered distortion coefficients (k1, k2, p1, p2[, k3[, "
+            "k4, k5, k6]]).");
     image.def("as_tensor", &Image::AsTensor);
 
     docstring::ClassMethodDocInject(m, "Image", "get_min_bound");
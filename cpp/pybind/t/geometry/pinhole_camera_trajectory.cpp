@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PinholeCameraTrajectory.h"
+
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_pinhole_camera_trajectory(py::module& m) {
+    py::class_<PinholeCameraTrajectory> trajectory(
+            m, "PinholeCameraTrajectory",
+            "A camera trajectory with shared intrinsics and (N, 4, 4) world "
+            "to camera extrinsics stored as a tensor, the tensor counterpart "
+            "of open3d.camera.PinholeCameraTrajectory.");
+
+    trajectory.def(py::init<const core::Tensor&, int, int,
+                            const core::Tensor&>(),
+                   "intrinsic"_a, "width"_a, "height"_a, "extrinsics"_a);
+
+    trajectory.def("__len__", &PinholeCameraTrajectory::GetLength);
+    trajectory.def("is_empty", &PinholeCameraTrajectory::IsEmpty);
+    trajectory.def_property_readonly("device",
+                                     &PinholeCameraTrajectory::GetDevice);
+    trajectory.def_property_readonly("intrinsic",
+                                     &PinholeCameraTrajectory::GetIntrinsic);
+    trajectory.def_property_readonly("width",
+                                     &PinholeCameraTrajectory::GetWidth);
+    trajectory.def_property_readonly("height",
+                                     &PinholeCameraTrajectory::GetHeight);
+    trajectory.def_property_readonly("extrinsics",
+                                     &PinholeCameraTrajectory::GetExtrinsics);
+
+    trajectory.def("get_extrinsic", &PinholeCameraTrajectory::GetExtrinsic,
+                   "Return the (4, 4) extrinsic of a frame.", "index"_a);
+    trajectory.def("get_poses", &PinholeCameraTrajectory::GetPoses,
+                   "Return the (N, 4, 4) camera to world transformations.");
+    trajectory.def("to", &PinholeCameraTrajectory::To,
+                   "Return the trajectory on the device.", "device"_a,
+                   "copy"_a = false);
+    trajectory.def("compose", &PinholeCameraTrajectory::Compose,
+                   "Return a trajectory whose extrinsics are the (4, 4) or "
+                   "(N, 4, 4) transformations times the extrinsics.",
+                   "transformations"_a);
+    trajectory.def("interpolate", &PinholeCameraTrajectory::Interpolate,
+                   "Return the trajectory sampled at (M,) fractional frame "
+                   "indices, with slerp for rotations and linear "
+                   "interpolation for camera centers.",
+                   "times"_a);
+    trajectory.def("compute_visible_blocks",
+                   &PinholeCameraTrajectory::ComputeVisibleBlocks,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Return a (N, M) Bool tensor telling which of the (M, 3) "
+                   "blocks every frame may see.",
+                   "block_coords"_a, "block_size"_a, "depth_min"_a = 0.1,
+                   "depth_max"_a = 3.0);
+    trajectory.def("select_frames", &PinholeCameraTrajectory::SelectFrames,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Return the indices of the frames that may see at least "
+                   "min_visible_blocks active blocks of the voxel block grid.",
+                   "voxel_grid"_a, "depth_min"_a = 0.1, "depth_max"_a = 3.0,
+                   "min_visible_blocks"_a = 1);
+    trajectory.def("to_legacy", &PinholeCameraTrajectory::ToLegacy,
+                   "Convert to a legacy camera trajectory.");
+    trajectory.def_static(
+            "from_legacy", &PinholeCameraTrajectory::FromLegacy,
+            "Create a trajectory from a legacy camera trajectory whose frames "
+            "share the same intrinsics.",
+            "trajectory"_a, "device"_a = core::Device("CPU:0"));
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
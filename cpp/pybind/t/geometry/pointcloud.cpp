@@ -187,8 +187,60 @@ The attributes of the point cloud have different levels::
                 return pointcloud.VoxelDownSample(
                         voxel_size, core::HashBackendType::Default);
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def("uniform_down_sample", &PointCloud::UniformDownSample,
+                   "Downsamples a point cloud by keeping every k-th point, "
+                   "starting from the first one.",
+                   "every_k_points"_a);
+    pointcloud.def("random_down_sample", &PointCloud::RandomDownSample,
+                   "Downsamples a point cloud by randomly selecting a "
+                   "fraction of the points.",
+                   "sampling_ratio"_a);
+    pointcloud.def("farthest_point_down_sample",
+                   &PointCloud::FarthestPointDownSample,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Downsamples a point cloud with farthest point sampling.",
+                   "num_samples"_a);
+    pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Removes points that have less than nb_points neighbors "
+                   "in a sphere of a given radius. Returns the filtered "
+                   "point cloud and a boolean mask of the kept points.",
+                   "nb_points"_a, "search_radius"_a);
+    pointcloud.def("remove_statistical_outliers",
+                   &PointCloud::RemoveStatisticalOutliers,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Removes points that are further away from their "
+                   "neighbors than the average of the point cloud. Returns "
+                   "the filtered point cloud and a boolean mask of the kept "
+                   "points.",
+                   "nb_neighbors"_a, "std_ratio"_a);
+    py::enum_<PointCloud::SpatialSortMethod>(
+            m, "SpatialSortMethod",
+            "Space filling curves for PointCloud.sort_by_spatial_locality.")
+            .value("Morton", PointCloud::SpatialSortMethod::Morton)
+            .value("Hilbert", PointCloud::SpatialSortMethod::Hilbert)
+            .export_values();
+    pointcloud.def("sort_by_spatial_locality",
+                   &PointCloud::SortBySpatialLocality,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Reorders the points along a space filling curve, so that "
+                   "points that are close in space are also close in memory. "
+                   "Returns the reordered point cloud and the permutation "
+                   "perm, such that point i of the result is point perm[i]. "
+                   "Indexing the result with perm.argsort() restores the "
+                   "original order.",
+                   "method"_a = PointCloud::SpatialSortMethod::Morton);
+    pointcloud.def("compute_visibility", &PointCloud::ComputeVisibility,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Computes which points are visible from each viewpoint by "
+                   "splatting the points into an equirectangular depth buffer "
+                   "around each viewpoint. Returns a bool tensor of shape "
+                   "{V, N}.",
+                   "viewpoints"_a, "point_radius"_a, "width"_a = 1024,
+                   "depth_tolerance"_a = 0.01);
 
     pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
                    py::call_guard<py::gil_scoped_release>(),
@@ -198,6 +250,24 @@ The attributes of the point cloud have different levels::
                    "with respect to the same. It uses KNN search if only "
                    "max_nn parameter is provided, and HybridSearch if radius "
                    "parameter is also provided.");
+    pointcloud.def(
+            "orient_normals_consistent_tangent_plane",
+            &PointCloud::OrientNormalsConsistentTangentPlane,
+            py::call_guard<py::gil_scoped_release>(), py::arg("k"),
+            py::arg("tile_size") = 0.0,
+            "Function to consistently orient the normals along the minimum "
+            "spanning tree of the KNN graph, built in parallel with "
+            "Boruvka's algorithm. If tile_size is positive, the normals are "
+            "first oriented within cubic tiles of this size and then across "
+            "the tiles.");
+    pointcloud.def("estimate_covariances", &PointCloud::EstimateCovariances,
+                   py::call_guard<py::gil_scoped_release>(),
+                   py::arg("max_nn") = 20, py::arg("radius") = py::none(),
+                   "Function to estimate the covariance of each point from "
+                   "its neighbourhood, stored as 'covariances' of shape "
+                   "{N, 3, 3}. It uses KNN search if only max_nn parameter is "
+                   "provided, and HybridSearch if radius parameter is also "
+                   "provided.");
     pointcloud.def("estimate_color_gradients",
                    &PointCloud::EstimateColorGradients,
                    py::call_guard<py::gil_scoped_release>(),
@@ -232,11 +302,50 @@ The attributes of the point cloud have different levels::
             "fx\n\n y "
             "= (v - cy) * z / fy");
     pointcloud.def_static(
-            "from_legacy", &PointCloud::FromLegacy, "pcd_legacy"_a,
+            "create_from_depth_images", &PointCloud::CreateFromDepthImages,
+            py::call_guard<py::gil_scoped_release>(), "depths"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a = 1000.0f,
+            "depth_max"_a = 3.0f, "stride"_a = 1,
+            "Factory function to create one pointcloud from a batch of depth "
+            "images {B, H, W} taken by B cameras with shared {3, 3} or per "
+            "camera {B, 3, 3} intrinsics and {B, 4, 4} extrinsics. All images "
+            "are unprojected in a single launch. The index of the source "
+            "image of each point is stored in the 'camera_ids' attribute.");
+    pointcloud.def_static(
+            "create_from_rgbd_images", &PointCloud::CreateFromRGBDImages,
+            py::call_guard<py::gil_scoped_release>(), "depths"_a, "colors"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a = 1000.0f,
+            "depth_max"_a = 3.0f, "stride"_a = 1,
+            "Factory function to create one pointcloud (with properties "
+            "{'points', 'colors', 'camera_ids'}) from a batch of depth images "
+            "{B, H, W} and color images {B, H, W, 3} taken by B cameras. See "
+            "create_from_depth_images.");
+    pointcloud.def_static(
+            "from_legacy",
+            static_cast<PointCloud (*)(const open3d::geometry::PointCloud &,
+                                       core::Dtype, const core::Device &)>(
+                    &PointCloud::FromLegacy),
+            "pcd_legacy"_a,
             "dtype"_a = core::Float32, "device"_a = core::Device("CPU:0"),
             "Create a PointCloud from a legacy Open3D PointCloud.");
     pointcloud.def("to_legacy", &PointCloud::ToLegacy,
                    "Convert to a legacy Open3D PointCloud.");
+    pointcloud.def("compute_point_cloud_distance",
+                   &PointCloud::ComputePointCloudDistance,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "target"_a,
+                   "Computes the distance from each point to its nearest "
+                   "neighbor in the target point cloud.");
+    pointcloud.def("compute_metrics", &PointCloud::ComputeMetrics,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "pcd2"_a, "metrics"_a =
+                           std::vector<Metric>{Metric::ChamferDistance,
+                                               Metric::HausdorffDistance,
+                                               Metric::FScore},
+                   "params"_a = MetricParameters(),
+                   "Compares this point cloud with pcd2. Returns a Float32 "
+                   "tensor with one value per metric, and one value per "
+                   "threshold for FScore.");
 
     docstring::ClassMethodDocInject(m, "PointCloud", "estimate_normals",
                                     map_shared_argument_docstrings);
@@ -244,6 +353,11 @@ The attributes of the point cloud have different levels::
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "PointCloud", "create_from_rgbd_image",
                                     map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "PointCloud",
+                                    "create_from_depth_images",
+                                    map_shared_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "PointCloud", "create_from_rgbd_images",
+                                    map_shared_argument_docstrings);
 }
 
 }  // namespace geometry
@@ -41,7 +41,10 @@ or compute the closest point on the surface of a mesh with respect to one
 or more query points.
 It builds an internal acceleration structure to speed up those queries.
 
-This class supports only the CPU device.
+The acceleration structure lives on the CPU and all queries are evaluated
+there. Query tensors may be on any device for convenience; they are copied
+to the CPU and the results are copied back to the device of the input.
+There is no GPU traversal, so CUDA inputs pay for both transfers.
 
 The following shows how to create a scene and compute ray intersections::
 
@@ -105,8 +108,86 @@ Returns:
     The geometry ID of the added mesh.
 )doc");
 
-    raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
-                         "nthreads"_a = 0,
+    raycasting_scene.def(
+            "add_instance",
+            py::overload_cast<const core::Tensor&, const core::Tensor&,
+                              const core::Tensor&>(
+                    &RaycastingScene::AddInstance),
+            "vertex_positions"_a, "triangle_indices"_a, "transformation"_a,
+            R"doc(
+Add a triangle mesh as an instance with a transformation.
+
+The mesh is stored in its own acceleration structure. Changing the
+transformation with set_instance_transformation() only rebuilds the top level
+structure over the instances, which makes instances suitable for moving
+objects. Static geometry should be added with add_triangles().
+
+Args:
+    vertex_positions (open3d.core.Tensor): Vertices as Tensor of dim {N,3} and
+        dtype Float32.
+    triangle_indices (open3d.core.Tensor): Triangles as Tensor of dim {M,3}
+        and dtype UInt32.
+    transformation (open3d.core.Tensor): The instance to world transformation
+        as Tensor with shape {4,4}.
+
+Returns:
+    The geometry ID of the added instance.
+)doc");
+
+    raycasting_scene.def("add_instance",
+                         py::overload_cast<const TriangleMesh&,
+                                           const core::Tensor&>(
+                                 &RaycastingScene::AddInstance),
+                         "mesh"_a, "transformation"_a, R"doc(
+Add a triangle mesh as an instance with a transformation.
+
+Args:
+    mesh (open3d.t.geometry.TriangleMesh): A triangle mesh.
+    transformation (open3d.core.Tensor): The instance to world transformation
+        as Tensor with shape {4,4}.
+
+Returns:
+    The geometry ID of the added instance.
+)doc");
+
+    raycasting_scene.def("set_instance_transformation",
+                         &RaycastingScene::SetInstanceTransformation,
+                         "geometry_id"_a, "transformation"_a, R"doc(
+Sets the transformation of an instance.
+
+Args:
+    geometry_id (int): The ID returned by add_instance().
+    transformation (open3d.core.Tensor): The instance to world transformation
+        as Tensor with shape {4,4}.
+)doc");
+
+    raycasting_scene.def("update_vertex_positions",
+                         &RaycastingScene::UpdateVertexPositions,
+                         "geometry_id"_a, "vertex_positions"_a, R"doc(
+Updates the vertex positions of a mesh or instance.
+
+The triangles are not changed. The acceleration structure of the mesh is
+refitted instead of rebuilt, which is fast but can reduce the query performance
+for large deformations.
+
+Args:
+    geometry_id (int): The ID returned by add_triangles() or add_instance().
+    vertex_positions (open3d.core.Tensor): Vertices as Tensor of dim {N,3} and
+        dtype Float32 with the same number of vertices as the added mesh.
+)doc");
+
+    raycasting_scene.def("remove_geometry", &RaycastingScene::RemoveGeometry,
+                         "geometry_id"_a, R"doc(
+Removes a mesh or instance from the scene. The ID may be reused by geometries
+added later.
+
+Args:
+    geometry_id (int): The ID returned by add_triangles() or add_instance().
+)doc");
+
+    raycasting_scene.def("cast_rays", &RaycastingScene::CastRays,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "rays"_a, "nthreads"_a = 0, "coherent"_a = false,
                          R"doc(
 Computes the first intersection of the rays with the scene.
 
@@ -122,6 +203,10 @@ Args:
 
     nthreads (int): The number of threads to use. Set to 0 for automatic.
 
+    coherent (bool): If True, the rays are cast in packets of 16 consecutive
+        rays. This is faster if consecutive rays are coherent, e.g., for rays
+        created with create_rays_pinhole().
+
 Returns:
     A dictionary which contains the following keys
 
@@ -147,6 +232,7 @@ Returns:
 )doc");
 
     raycasting_scene.def("test_occlusions", &RaycastingScene::TestOcclusions,
+                         py::call_guard<py::gil_scoped_release>(),
                          "rays"_a, "tnear"_a = 0.f,
                          "tfar"_a = std::numeric_limits<float>::infinity(),
                          "nthreads"_a = 0,
@@ -174,8 +260,9 @@ Returns:
 )doc");
 
     raycasting_scene.def("count_intersections",
-                         &RaycastingScene::CountIntersections, "rays"_a,
-                         "nthreads"_a = 0, R"doc(
+                         &RaycastingScene::CountIntersections,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "rays"_a, "nthreads"_a = 0, R"doc(
 Computes the number of intersection of the rays with the scene.
 
 Args:
@@ -195,6 +282,7 @@ Returns:
 
     raycasting_scene.def("compute_closest_points",
                          &RaycastingScene::ComputeClosestPoints,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, "nthreads"_a = 0, R"doc(
 Computes the closest points on the surfaces of the scene.
 
@@ -223,6 +311,7 @@ Returns:
 )doc");
 
     raycasting_scene.def("compute_distance", &RaycastingScene::ComputeDistance,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, "nthreads"_a = 0, R"doc(
 Computes the distance to the surface of the scene.
 
@@ -242,6 +331,7 @@ Returns:
 
     raycasting_scene.def("compute_signed_distance",
                          &RaycastingScene::ComputeSignedDistance,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, "nthreads"_a = 0, R"doc(
 Computes the signed distance to the surface of the scene.
 
@@ -267,8 +357,9 @@ Returns:
 )doc");
 
     raycasting_scene.def("compute_occupancy",
-                         &RaycastingScene::ComputeOccupancy, "query_points"_a,
-                         "nthreads"_a = 0,
+                         &RaycastingScene::ComputeOccupancy,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "query_points"_a, "nthreads"_a = 0,
                          R"doc(
 Computes the occupancy at the query point positions.
 
@@ -335,6 +426,70 @@ Returns:
     A tensor of shape {height_px, width_px, 6} with the rays.
 )doc");
 
+    raycasting_scene.def("render_depth", &RaycastingScene::RenderDepth,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "intrinsic_matrix"_a, "extrinsic_matrix"_a,
+                         "width_px"_a, "height_px"_a, "nthreads"_a = 0, R"doc(
+Renders a depth image for a pinhole camera.
+
+This is equivalent to casting the rays from create_rays_pinhole() but generates
+the rays on the fly without allocating a ray tensor and casts them in coherent
+packets.
+
+Args:
+    intrinsic_matrix (open3d.core.Tensor): The upper triangular intrinsic matrix
+        with shape {3,3}.
+    extrinsic_matrix (open3d.core.Tensor): The 4x4 world to camera SE(3)
+        transformation matrix.
+    width_px (int): The width of the image in pixels.
+    height_px (int): The height of the image in pixels.
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A Float32 image with shape {height_px, width_px, 1} with the depth along
+    the optical axis. Pixels without a hit are 0.
+)doc");
+
+    raycasting_scene.def("render_normals", &RaycastingScene::RenderNormals,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "intrinsic_matrix"_a, "extrinsic_matrix"_a,
+                         "width_px"_a, "height_px"_a, "nthreads"_a = 0, R"doc(
+Renders a normal image for a pinhole camera.
+
+Args:
+    intrinsic_matrix (open3d.core.Tensor): The upper triangular intrinsic matrix
+        with shape {3,3}.
+    extrinsic_matrix (open3d.core.Tensor): The 4x4 world to camera SE(3)
+        transformation matrix.
+    width_px (int): The width of the image in pixels.
+    height_px (int): The height of the image in pixels.
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A Float32 image with shape {height_px, width_px, 3} with the normals of the
+    hit triangles in world space. Pixels without a hit are 0.
+)doc");
+
+    raycasting_scene.def("render_primitive_ids",
+                         &RaycastingScene::RenderPrimitiveIds,
+                         "intrinsic_matrix"_a, "extrinsic_matrix"_a,
+                         "width_px"_a, "height_px"_a, "nthreads"_a = 0, R"doc(
+Renders an image with the primitive IDs for a pinhole camera.
+
+Args:
+    intrinsic_matrix (open3d.core.Tensor): The upper triangular intrinsic matrix
+        with shape {3,3}.
+    extrinsic_matrix (open3d.core.Tensor): The 4x4 world to camera SE(3)
+        transformation matrix.
+    width_px (int): The width of the image in pixels.
+    height_px (int): The height of the image in pixels.
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A UInt32 image with shape {height_px, width_px, 1} with the IDs of the hit
+    triangles. Pixels without a hit are *INVALID_ID*.
+)doc");
+
     raycasting_scene.def_property_readonly_static(
             "INVALID_ID",
             [](py::object /* self */) -> uint32_t {
@@ -30,6 +30,7 @@
 #include <unordered_map>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "pybind/t/geometry/geometry.h"
 
 namespace open3d {
@@ -155,6 +156,83 @@ The attributes of the triangle mesh have different levels::
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def("compute_triangle_normals",
+                      &TriangleMesh::ComputeTriangleNormals,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "normalized"_a = true,
+                      "Computes the triangle normals on the device of the "
+                      "mesh.");
+    triangle_mesh.def("compute_vertex_normals",
+                      &TriangleMesh::ComputeVertexNormals,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "normalized"_a = true,
+                      "Computes the vertex normals as the sum of the normals "
+                      "of the adjacent triangles.");
+    triangle_mesh.def("get_surface_area", &TriangleMesh::GetSurfaceArea,
+                      "Returns the sum of the triangle areas.");
+    triangle_mesh.def("compute_half_edges", &TriangleMesh::ComputeHalfEdges,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns the (3 * num_triangles, 2) vertex indices of "
+                      "the half-edges, 3 per triangle, and the indices of "
+                      "their twins, -1 for boundary half-edges.");
+    triangle_mesh.def("remove_duplicated_vertices",
+                      &TriangleMesh::RemoveDuplicatedVertices,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "Returns a mesh in which vertices with identical "
+                      "positions are merged.");
+    triangle_mesh.def("merge_close_vertices", &TriangleMesh::MergeCloseVertices,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "eps"_a,
+                      "Returns a mesh in which vertices closer than eps are "
+                      "welded with a spatial hash set. The merged vertex "
+                      "attributes are averaged.");
+    triangle_mesh.def("simplify_vertex_clustering",
+                      &TriangleMesh::SimplifyVertexClustering,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "voxel_size"_a,
+                      "Returns a mesh in which all vertices that fall into "
+                      "the same voxel are replaced by their average.");
+    triangle_mesh.def("sample_points_uniformly",
+                      &TriangleMesh::SamplePointsUniformly,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_points"_a, "use_triangle_normal"_a = false,
+                      "seed"_a = -1,
+                      "Samples points uniformly from the surface of the "
+                      "mesh. Returns a PointCloud on the device of the mesh.");
+    triangle_mesh.def("sample_points_poisson_disk",
+                      &TriangleMesh::SamplePointsPoissonDisk,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_points"_a, "init_factor"_a = 5,
+                      "use_triangle_normal"_a = false, "seed"_a = -1,
+                      "Samples points from the surface of the mesh such that "
+                      "no two points are closer than a radius, by parallel "
+                      "dart throwing. Returns a PointCloud on the device of "
+                      "the mesh.");
+    triangle_mesh.def("filter_smooth_laplacian",
+                      &TriangleMesh::FilterSmoothLaplacian,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_iterations"_a, "lambda"_a = 0.5,
+                      "filter_scope"_a =
+                              open3d::geometry::MeshBase::FilterScope::All,
+                      "Returns a mesh smoothed with the Laplacian filter.");
+    triangle_mesh.def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                      py::call_guard<py::gil_scoped_release>(),
+                      "number_of_iterations"_a, "lambda"_a = 0.5,
+                      "mu"_a = -0.53,
+                      "filter_scope"_a =
+                              open3d::geometry::MeshBase::FilterScope::All,
+                      "Returns a mesh smoothed with the Taubin filter.");
+    triangle_mesh.def(
+            "deform_as_rigid_as_possible",
+            &TriangleMesh::DeformAsRigidAsPossible,
+            py::call_guard<py::gil_scoped_release>(),
+            "constraint_vertex_indices"_a, "constraint_vertex_positions"_a,
+            "max_iter"_a,
+            "energy"_a = open3d::geometry::MeshBase::
+                    DeformAsRigidAsPossibleEnergy::Spokes,
+            "smoothed_alpha"_a = 0.01,
+            "Deforms the mesh with the as-rigid-as-possible method of "
+            "Sorkine and Alexa, 2007, on the device of the mesh.");
 
     triangle_mesh.def_static(
             "from_legacy", &TriangleMesh::FromLegacy, "mesh_legacy"_a,
@@ -163,6 +241,18 @@ The attributes of the triangle mesh have different levels::
             "Create a TriangleMesh from a legacy Open3D TriangleMesh.");
     triangle_mesh.def("to_legacy", &TriangleMesh::ToLegacy,
                       "Convert to a legacy Open3D TriangleMesh.");
+
+    triangle_mesh.def_static(
+            "create_from_point_cloud_poisson",
+            &TriangleMesh::CreateFromPointCloudPoisson,
+            py::call_guard<py::gil_scoped_release>(),
+            "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1f,
+            "linear_fit"_a = false, "n_threads"_a = -1,
+            "option"_a = open3d::geometry::PoissonReconstructionOption(),
+            "Computes a triangle mesh from an oriented PointCloud with the "
+            "Screened Poisson Surface Reconstruction of Kazhdan and Hoppe, "
+            "2013. Returns the mesh and the per vertex densities on the "
+            "device of pcd.");
 }
 
 }  // namespace geometry
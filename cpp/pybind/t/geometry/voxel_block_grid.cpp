@@ -28,6 +28,8 @@
 #include <unordered_map>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/t/geometry/MultiDeviceVoxelBlockGrid.h"
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 #include "pybind/core/tensor_converter.h"
 #include "pybind/t/geometry/geometry.h"
@@ -129,6 +131,7 @@ void pybind_voxel_block_grid(py::module& m) {
             py::overload_cast<const Image&, const core::Tensor&,
                               const core::Tensor&, float, float, float>(
                     &VoxelBlockGrid::GetUniqueBlockCoordinates),
+            py::call_guard<py::gil_scoped_release>(),
             "Get a (3, M) active block coordinates from a depth image, with "
             "potential duplicates removed."
             "Note: these coordinates are not activated in the internal sparse "
@@ -139,29 +142,61 @@ void pybind_voxel_block_grid(py::module& m) {
     vbg.def("compute_unique_block_coordinates",
             py::overload_cast<const PointCloud&, float>(
                     &VoxelBlockGrid::GetUniqueBlockCoordinates),
+            py::call_guard<py::gil_scoped_release>(),
             "Obtain active block coordinates from a point cloud.", "pcd"_a,
             "trunc_voxel_multiplier"_a = 4.0);
 
     vbg.def("integrate",
             py::overload_cast<const core::Tensor&, const Image&, const Image&,
                               const core::Tensor&, const core::Tensor&, float,
-                              float>(&VoxelBlockGrid::Integrate),
+                              float, float>(&VoxelBlockGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Integrate an RGB-D frame in the selected block coordinates using "
-            "pinhole camera model.",
+            "pinhole camera model. The SDF is truncated at "
+            "trunc_voxel_multiplier voxels, or at half the block resolution "
+            "if it is 0.",
             "block_coords"_a, "depth"_a, "color"_a, "intrinsic"_a,
-            "extrinsic"_a, "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f);
+            "extrinsic"_a, "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+            "trunc_voxel_multiplier"_a = 0.0f);
 
     vbg.def("integrate",
             py::overload_cast<const core::Tensor&, const Image&,
                               const core::Tensor&, const core::Tensor&, float,
-                              float>(&VoxelBlockGrid::Integrate),
+                              float, float>(&VoxelBlockGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Similar to RGB-D integration, but only applied to depth images.",
             "block_coords"_a, "depth"_a, "intrinsic"_a, "extrinsic"_a,
-            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f);
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+            "trunc_voxel_multiplier"_a = 0.0f);
+
+    vbg.def("integrate_batch", &VoxelBlockGrid::IntegrateBatch,
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for TSDF volumes."
+            "Integrate a batch of (B, H, W, 1) depth and (B, H, W, 3) color "
+            "frames (or an empty color tensor) with (B, 4, 4) extrinsics. "
+            "Blocks are activated in one hash map pass and all the frames "
+            "are integrated in a single kernel.",
+            "depths"_a, "colors"_a, "intrinsic"_a, "extrinsics"_a,
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+            "trunc_voxel_multiplier"_a = 4.0);
+
+    vbg.def("erase_blocks", &VoxelBlockGrid::EraseBlocks,
+            "Erase the voxel blocks at the given (N, 3) Int32 block "
+            "coordinates.",
+            "block_coords"_a);
+
+    vbg.def("recycle_blocks", &VoxelBlockGrid::RecycleBlocks,
+            "Specific operation for TSDF volumes."
+            "Multiply voxel weights by weight_decay, then erase the blocks "
+            "without any voxel that has a weight above weight_threshold and "
+            "a TSDF inside the truncation band. Returns the number of erased "
+            "blocks.",
+            "weight_threshold"_a = 0.0f, "weight_decay"_a = 1.0f);
 
     vbg.def("ray_cast", &VoxelBlockGrid::RayCast,
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Perform volumetric ray casting in the selected block coordinates."
             "The block coordinates in the frustum can be taken from"
@@ -175,20 +210,215 @@ void pybind_voxel_block_grid(py::module& m) {
             "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f);
 
     vbg.def("extract_point_cloud", &VoxelBlockGrid::ExtractPointCloud,
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Extract point cloud at isosurface points.",
             "point_cloud_size_estimate"_a = -1, "weight_threshold"_a = 3.0f);
 
     vbg.def("extract_triangle_mesh", &VoxelBlockGrid::ExtractTriangleMesh,
+            py::call_guard<py::gil_scoped_release>(),
             "Specific operation for TSDF volumes."
             "Extract triangle mesh at isosurface points.",
             "vertex_size_estimate"_a = -1, "weight_threshold"_a = 3.0f);
 
+    vbg.def("extract_triangle_mesh_incremental",
+            &VoxelBlockGrid::ExtractTriangleMeshIncremental,
+            py::call_guard<py::gil_scoped_release>(),
+            "Specific operation for TSDF volumes."
+            "Re-mesh only the blocks changed since the previous call and their "
+            "neighbors. Returns the (K, 3) keys of the re-meshed blocks, a "
+            "list of K per-block mesh chunks, and the (E, 3) keys of the "
+            "erased blocks whose chunks should be dropped.",
+            "weight_threshold"_a = 3.0f);
+
+    vbg.def("stream_out_tiles", &VoxelBlockGrid::StreamOutTiles,
+            py::call_guard<py::gil_scoped_release>(),
+            "Write the active blocks in the tiles of tile_resolution^3 blocks "
+            "whose center is farther than radius from position to "
+            "directory, and erase them. Returns the number of blocks streamed "
+            "out.",
+            "directory"_a, "position"_a, "radius"_a, "tile_resolution"_a = 8);
+    vbg.def("stream_in_tiles", &VoxelBlockGrid::StreamInTiles,
+            py::call_guard<py::gil_scoped_release>(),
+            "Read the tiles stored in directory whose center is within radius "
+            "of position and insert their blocks. Returns the number of "
+            "blocks streamed in.",
+            "directory"_a, "position"_a, "radius"_a, "tile_resolution"_a = 8);
+    vbg.def("prefetch_tiles", &VoxelBlockGrid::PrefetchTiles,
+            py::call_guard<py::gil_scoped_release>(),
+            "Start reading the tiles stored in directory within radius of any "
+            "of the (N, 3) positions in the background for stream_in_tiles.",
+            "directory"_a, "positions"_a, "radius"_a, "tile_resolution"_a = 8);
+
     vbg.def("save", &VoxelBlockGrid::Save,
+            py::call_guard<py::gil_scoped_release>(),
             "Save the voxel block grid to a npz file."
             "file_name"_a);
-    vbg.def_static("load", &VoxelBlockGrid::Load,
+    vbg.def_static("load",
+                   py::overload_cast<const std::string&>(&VoxelBlockGrid::Load),
+                   py::call_guard<py::gil_scoped_release>(),
                    "Load a voxel block grid from a npz file.", "file_name"_a);
+    vbg.def_static("load",
+                   py::overload_cast<const std::string&, const core::Device&>(
+                           &VoxelBlockGrid::Load),
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Load a voxel block grid from a npz file to a device, "
+                   "copying it in chunks without a full host copy.",
+                   "file_name"_a, "device"_a);
+    py::class_<MultiResolutionVoxelBlockGrid> mrvbg(
+            m, "MultiResolutionVoxelBlockGrid",
+            "A stack of voxel block grids where level l has a voxel size of "
+            "voxel_size * 2^l. Observations are integrated into the level "
+            "whose depth band, split by level_depths, contains them, so that "
+            "far-away regions are stored with coarse blocks.");
+
+    mrvbg.def(py::init<const std::vector<std::string>&,
+                       const std::vector<core::Dtype>&,
+                       const std::vector<core::SizeVector>&, float,
+                       const std::vector<float>&, int64_t, int64_t,
+                       const core::Device&>(),
+              "attr_names"_a, "attr_dtypes"_a, "attr_channels"_a,
+              "voxel_size"_a = 0.0058,
+              "level_depths"_a = std::vector<float>{2.0f},
+              "block_resolution"_a = 16, "block_count"_a = 10000,
+              "device"_a = core::Device("CPU:0"));
+
+    mrvbg.def("level_count", &MultiResolutionVoxelBlockGrid::GetLevelCount,
+              "Get the number of levels.");
+    mrvbg.def("level", &MultiResolutionVoxelBlockGrid::GetLevel,
+              "Get the voxel block grid of a level, level 0 being the finest.",
+              "level"_a, py::return_value_policy::reference_internal);
+    mrvbg.def("voxel_size", &MultiResolutionVoxelBlockGrid::GetVoxelSize,
+              "Get the voxel size of a level.", "level"_a);
+
+    mrvbg.def("integrate",
+              py::overload_cast<const Image&, const Image&,
+                                const core::Tensor&, const core::Tensor&, float,
+                                float, float>(
+                      &MultiResolutionVoxelBlockGrid::Integrate),
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Integrate an RGB-D frame into the level of each depth band "
+              "using pinhole camera model.",
+              "depth"_a, "color"_a, "intrinsic"_a, "extrinsic"_a,
+              "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+              "trunc_voxel_multiplier"_a = 4.0);
+
+    mrvbg.def("integrate",
+              py::overload_cast<const Image&, const core::Tensor&,
+                                const core::Tensor&, float, float, float>(
+                      &MultiResolutionVoxelBlockGrid::Integrate),
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Similar to RGB-D integration, but only applied to depth images.",
+              "depth"_a, "intrinsic"_a, "extrinsic"_a,
+              "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+              "trunc_voxel_multiplier"_a = 4.0);
+
+    mrvbg.def("ray_cast", &MultiResolutionVoxelBlockGrid::RayCast,
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Perform volumetric ray casting in all the levels, each pixel "
+              "taking its values from the finest level the ray hits. "
+              "Supported attributes: vertex, depth, color, normal.",
+              "intrinsic"_a, "extrinsic"_a, "width"_a, "height"_a,
+              "render_attributes"_a =
+                      std::vector<std::string>{"depth", "color"},
+              "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+              "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f);
+
+    mrvbg.def("extract_point_cloud",
+              &MultiResolutionVoxelBlockGrid::ExtractPointCloud,
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Extract point cloud at isosurface points of all the levels.",
+              "weight_threshold"_a = 3.0f);
+
+    mrvbg.def("extract_triangle_mesh",
+              &MultiResolutionVoxelBlockGrid::ExtractTriangleMesh,
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Extract triangle mesh at isosurface points of all the levels.",
+              "weight_threshold"_a = 3.0f);
+
+    py::class_<MultiDeviceVoxelBlockGrid> mdvbg(
+            m, "MultiDeviceVoxelBlockGrid",
+            "A voxel block grid spread over several devices. Space is split "
+            "into cubic regions of partition_resolution^3 blocks, each owned "
+            "by a device picked by hashing its coordinates. Frames are "
+            "integrated concurrently on the devices owning the blocks they "
+            "touch, and results are composed on the first device.");
+
+    mdvbg.def(py::init<const std::vector<std::string>&,
+                       const std::vector<core::Dtype>&,
+                       const std::vector<core::SizeVector>&, float, int64_t,
+                       int64_t, const std::vector<core::Device>&, int64_t>(),
+              "attr_names"_a, "attr_dtypes"_a, "attr_channels"_a,
+              "voxel_size"_a = 0.0058, "block_resolution"_a = 16,
+              "block_count"_a = 10000,
+              "devices"_a = std::vector<core::Device>{core::Device("CPU:0")},
+              "partition_resolution"_a = 8);
+
+    mdvbg.def("device_count", &MultiDeviceVoxelBlockGrid::GetDeviceCount,
+              "Get the number of devices.");
+    mdvbg.def("grid", &MultiDeviceVoxelBlockGrid::GetGrid,
+              "Get the voxel block grid of a device, holding the blocks owned "
+              "by the device and a halo of one block around them.",
+              "index"_a, py::return_value_policy::reference_internal);
+    mdvbg.def("owners", &MultiDeviceVoxelBlockGrid::GetOwners,
+              "Get the index of the device owning each of the (N, 3) Int32 "
+              "block coordinates.",
+              "block_coords"_a);
+
+    mdvbg.def("integrate",
+              py::overload_cast<const Image&, const Image&,
+                                const core::Tensor&, const core::Tensor&, float,
+                                float, float>(
+                      &MultiDeviceVoxelBlockGrid::Integrate),
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Integrate an RGB-D frame on the devices owning the blocks it "
+              "touches using pinhole camera model.",
+              "depth"_a, "color"_a, "intrinsic"_a, "extrinsic"_a,
+              "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+              "trunc_voxel_multiplier"_a = 4.0);
+
+    mdvbg.def("integrate",
+              py::overload_cast<const Image&, const core::Tensor&,
+                                const core::Tensor&, float, float, float>(
+                      &MultiDeviceVoxelBlockGrid::Integrate),
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Similar to RGB-D integration, but only applied to depth images.",
+              "depth"_a, "intrinsic"_a, "extrinsic"_a,
+              "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+              "trunc_voxel_multiplier"_a = 4.0);
+
+    mdvbg.def("ray_cast", &MultiDeviceVoxelBlockGrid::RayCast,
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Perform volumetric ray casting on all the devices, each pixel "
+              "taking its values from the nearest surface hit. "
+              "Supported attributes: vertex, depth, color, normal.",
+              "intrinsic"_a, "extrinsic"_a, "width"_a, "height"_a,
+              "render_attributes"_a =
+                      std::vector<std::string>{"depth", "color"},
+              "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+              "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f);
+
+    mdvbg.def("extract_point_cloud",
+              &MultiDeviceVoxelBlockGrid::ExtractPointCloud,
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Extract point cloud at isosurface points of all the devices.",
+              "weight_threshold"_a = 3.0f);
+
+    mdvbg.def("extract_triangle_mesh",
+              &MultiDeviceVoxelBlockGrid::ExtractTriangleMesh,
+              py::call_guard<py::gil_scoped_release>(),
+              "Specific operation for TSDF volumes."
+              "Extract triangle mesh at isosurface points of all the devices.",
+              "weight_threshold"_a = 3.0f);
 }
 }  // namespace geometry
 }  // namespace t
@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "pybind/t/geometry/geometry.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+void pybind_voxel_grid(py::module& m) {
+    py::class_<VoxelGrid> voxel_grid(
+            m, "VoxelGrid",
+            "A sparse voxel grid stored in a hash map, the tensor counterpart "
+            "of open3d.geometry.VoxelGrid. Construction and queries run on "
+            "the device of the grid.");
+
+    voxel_grid.def(
+            py::init<double, const core::Tensor&, int64_t,
+                     const core::Device&, const core::HashBackendType&>(),
+            "voxel_size"_a,
+            "origin"_a = core::Tensor::Zeros({3}, core::Float64),
+            "init_capacity"_a = 1000, "device"_a = core::Device("CPU:0"),
+            "backend"_a = core::HashBackendType::Default);
+
+    voxel_grid.def_static("create_from_point_cloud",
+                          &VoxelGrid::CreateFromPointCloud,
+                          "Create a voxel grid with all voxels occupied by "
+                          "the points of the point cloud.",
+                          "pcd"_a, "voxel_size"_a);
+
+    voxel_grid.def("insert",
+                   py::overload_cast<const core::Tensor&>(&VoxelGrid::Insert),
+                   "Activate the voxels containing the (N, 3) points.",
+                   "points"_a);
+    voxel_grid.def("insert",
+                   py::overload_cast<const core::Tensor&, const core::Tensor&>(
+                           &VoxelGrid::Insert),
+                   "Activate the voxels containing the (N, 3) points and "
+                   "accumulate the (N, 3) colors into them.",
+                   "points"_a, "colors"_a);
+
+    voxel_grid.def("get_voxel", &VoxelGrid::GetVoxel,
+                   "Return the (N, 3) Int32 voxel coordinates of the points.",
+                   "points"_a);
+    voxel_grid.def("check_if_included", &VoxelGrid::CheckIfIncluded,
+                   "Return a (N,) Bool mask telling whether each point lies "
+                   "in an occupied voxel.",
+                   "points"_a);
+
+    voxel_grid.def("get_voxel_coordinates", &VoxelGrid::GetVoxelCoordinates,
+                   "(M, 3) Int32 coordinates of the occupied voxels.");
+    voxel_grid.def("get_voxel_centers", &VoxelGrid::GetVoxelCenters,
+                   "(M, 3) Float64 centers of the occupied voxels.");
+    voxel_grid.def("get_voxel_colors", &VoxelGrid::GetVoxelColors,
+                   "(M, 3) Float32 average colors of the occupied voxels.");
+
+    voxel_grid.def("hashmap", &VoxelGrid::GetHashMap,
+                   "Get the underlying hash map from voxel coordinates to the "
+                   "point count and the color sum.");
+    voxel_grid.def("size", &VoxelGrid::Size);
+    voxel_grid.def("is_empty", &VoxelGrid::IsEmpty);
+    voxel_grid.def("has_colors", &VoxelGrid::HasColors);
+    voxel_grid.def_property_readonly("voxel_size", &VoxelGrid::GetVoxelSize);
+    voxel_grid.def_property_readonly("origin", &VoxelGrid::GetOrigin);
+    voxel_grid.def_property_readonly("device", &VoxelGrid::GetDevice);
+
+    voxel_grid.def("to_legacy", &VoxelGrid::ToLegacy,
+                   "Convert to a legacy Open3D VoxelGrid.");
+    voxel_grid.def_static("from_legacy", &VoxelGrid::FromLegacy,
+                          "Create a VoxelGrid from a legacy Open3D VoxelGrid.",
+                          "voxel_grid"_a, "device"_a = core::Device("CPU:0"));
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -31,6 +31,7 @@
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/t/io/TSDFVoxelGridIO.h"
+#include "open3d/t/io/VoxelBlockGridIO.h"
 #include "pybind/docstring.h"
 #include "pybind/t/io/io.h"
 
@@ -42,6 +43,8 @@ namespace io {
 static const std::unordered_map<std::string, std::string>
         map_shared_argument_docstrings = {
                 {"filename", "Path to file."},
+                {"filenames", "Paths to the files."},
+                {"num_threads", "Number of threads, 0 for one per core."},
                 // Write options
                 {"compressed",
                  "Set to ``True`` to write in compressed format."},
@@ -168,6 +171,31 @@ void pybind_class_io(py::module &m_io) {
             "voxelgrid"_a);
     docstring::FunctionDocInject(m_io, "write_tsdf_voxelgrid",
                                  map_shared_argument_docstrings);
+
+    m_io.def(
+            "read_voxel_block_grids",
+            [](const std::vector<std::string> &filenames,
+               const core::Device &device, int num_threads) {
+                py::gil_scoped_release release;
+                return ReadVoxelBlockGrids(filenames, device, num_threads);
+            },
+            "Function to read voxel block grids from npz files in parallel.",
+            "filenames"_a, "device"_a, "num_threads"_a = 0);
+    docstring::FunctionDocInject(m_io, "read_voxel_block_grids",
+                                 map_shared_argument_docstrings);
+
+    m_io.def(
+            "write_voxel_block_grids",
+            [](const std::vector<std::string> &filenames,
+               const std::vector<geometry::VoxelBlockGrid> &grids,
+               int num_threads) {
+                py::gil_scoped_release release;
+                WriteVoxelBlockGrids(filenames, grids, num_threads);
+            },
+            "Function to write voxel block grids to npz files in parallel.",
+            "filenames"_a, "grids"_a, "num_threads"_a = 0);
+    docstring::FunctionDocInject(m_io, "write_voxel_block_grids",
+                                 map_shared_argument_docstrings);
 }
 
 }  // namespace io
@@ -56,7 +56,10 @@ void pybind_sensor(py::module &m) {
                      "(default video length) Save frames till this time (us)"},
                     {"buffer_size",
                      "Size of internal frame buffer, increase this if you "
-                     "experience frame drops."}};
+                     "experience frame drops."},
+                    {"device",
+                     "Device of the returned frames. Frames are copied to it "
+                     "in the background."}};
 
     py::enum_<SensorType>(m, "SensorType", "Sensor type")
             .value("AZURE_KINECT", SensorType::AZURE_KINECT)
@@ -191,8 +194,9 @@ void pybind_sensor(py::module &m) {
                     "takes a long time (>10 frame intervals) to process a "
                     "frame.");
     rs_bag_reader.def(py::init<>())
-            .def(py::init<size_t>(),
-                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE)
+            .def(py::init<size_t, const core::Device &>(),
+                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE,
+                 "device"_a = core::Device("CPU:0"))
             .def("is_opened", &RSBagReader::IsOpened,
                  "Check if the RS bag file  is opened.")
             .def("open", &RSBagReader::Open,
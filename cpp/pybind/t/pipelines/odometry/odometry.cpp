@@ -126,6 +126,34 @@ void pybind_odometry_classes(py::module &m) {
                         olp.depth_outlier_trunc_, olp.depth_huber_delta_,
                         olp.intensity_huber_delta_);
             });
+
+    // open3d.t.pipelines.odometry.OdometryFrame
+    py::class_<OdometryFrame> odometry_frame(
+            m, "OdometryFrame",
+            "Image pyramids of an RGBD frame for multi-scale RGBD odometry. "
+            "Build the frame of a keyframe once and reuse it as the target "
+            "to avoid rebuilding its pyramids for every tracked frame.");
+    py::detail::bind_copy_functions<OdometryFrame>(odometry_frame);
+    odometry_frame
+            .def(py::init<const t::geometry::RGBDImage &, const core::Tensor &,
+                          float, float, int64_t, Method,
+                          const OdometryLossParams &, bool>(),
+                 py::call_guard<py::gil_scoped_release>(), "rgbd"_a,
+                 "intrinsics"_a, "depth_scale"_a = 1000.0f,
+                 "depth_max"_a = 3.0f, "num_levels"_a = 3,
+                 "method"_a = Method::Hybrid,
+                 "params"_a = OdometryLossParams(), "as_target"_a = true)
+            .def_property_readonly("method", &OdometryFrame::GetMethod,
+                                   "Method the pyramids are built for.")
+            .def_property_readonly("num_levels", &OdometryFrame::GetNumLevels,
+                                   "Number of pyramid levels.")
+            .def_property_readonly("is_target", &OdometryFrame::IsTarget,
+                                   "Whether the frame can be used as target.")
+            .def("__repr__", [](const OdometryFrame &frame) {
+                return fmt::format("OdometryFrame[num_levels={}, "
+                                   "is_target={}].",
+                                   frame.GetNumLevels(), frame.IsTarget());
+            });
 }
 
 // Odometry functions have similar arguments, sharing arg docstrings.
@@ -191,7 +219,14 @@ static const std::unordered_map<std::string, std::string>
                  "by CreateVertexMap before calling this function."}};
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("rgbd_odometry_multi_scale", &RGBDOdometryMultiScale,
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const t::geometry::RGBDImage &,
+                            const t::geometry::RGBDImage &,
+                            const core::Tensor &, const core::Tensor &,
+                            const float, const float,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi Scale RGBD odometry.", "source"_a, "target"_a,
           "intrinsics"_a,
@@ -201,6 +236,21 @@ void pybind_odometry_methods(py::module &m) {
           "criteria_list"_a =
                   std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
           "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const OdometryFrame &, const OdometryFrame &,
+                            const core::Tensor &,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi Scale RGBD odometry on prebuilt frame "
+          "pyramids, with the method the frames are built for.",
+          "source"_a, "target"_a,
+          "init_source_to_target"_a =
+                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+          "criteria_list"_a =
+                  std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
+          "params"_a = OdometryLossParams());
     docstring::FunctionDocInject(m, "rgbd_odometry_multi_scale",
                                  map_shared_argument_docstrings);
 
@@ -269,6 +319,20 @@ Colored Point Cloud Registration Revisited, ICCV, 2017.)",
           "intensity_huber_delta"_a);
     docstring::FunctionDocInject(m, "compute_odometry_result_hybrid",
                                  map_shared_argument_docstrings);
+
+    m.def("compute_odometry_result_hybrid_fused",
+          &ComputeOdometryResultHybridFused,
+          py::call_guard<py::gil_scoped_release>(),
+          R"(Estimates the OdometryResult with the same loss as
+compute_odometry_result_hybrid, in a single kernel that back-projects the
+source depth and evaluates the target depth and intensity gradients at the
+correspondences, so no vertex map or gradient images are needed.)",
+          "source_depth"_a, "target_depth"_a, "source_intensity"_a,
+          "target_intensity"_a, "intrinsics"_a, "init_source_to_target"_a,
+          "depth_outlier_trunc"_a, "depth_huber_delta"_a,
+          "intensity_huber_delta"_a);
+    docstring::FunctionDocInject(m, "compute_odometry_result_hybrid_fused",
+                                 map_shared_argument_docstrings);
 }
 
 void pybind_odometry(py::module &m) {
@@ -30,6 +30,8 @@
 #include <utility>
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Feature.h"
+#include "open3d/t/pipelines/registration/MultiwayRegistration.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Logging.h"
 #include "pybind/docstring.h"
@@ -74,8 +76,9 @@ void pybind_registration_classes(py::module &m) {
     py::detail::bind_copy_functions<ICPConvergenceCriteria>(
             convergence_criteria);
     convergence_criteria
-            .def(py::init<double, double, int>(), "relative_fitness"_a = 1e-6,
-                 "relative_rmse"_a = 1e-6, "max_iteration"_a = 30)
+            .def(py::init<double, double, int, int>(),
+                 "relative_fitness"_a = 1e-6, "relative_rmse"_a = 1e-6,
+                 "max_iteration"_a = 30, "convergence_check_interval"_a = 1)
             .def_readwrite(
                     "relative_fitness",
                     &ICPConvergenceCriteria::relative_fitness_,
@@ -88,12 +91,45 @@ void pybind_registration_classes(py::module &m) {
             .def_readwrite("max_iteration",
                            &ICPConvergenceCriteria::max_iteration_,
                            "Maximum iteration before iteration stops.")
+            .def_readwrite(
+                    "convergence_check_interval",
+                    &ICPConvergenceCriteria::convergence_check_interval_,
+                    "The convergence is tested every "
+                    "``convergence_check_interval`` iterations, so that "
+                    "fitness and RMSE are not transferred to the host in "
+                    "between.")
             .def("__repr__", [](const ICPConvergenceCriteria &c) {
                 return fmt::format(
                         "ICPConvergenceCriteria[relative_fitness_={:e}, "
-                        "relative_rmse={:e}, max_iteration_={:d}].",
+                        "relative_rmse={:e}, max_iteration_={:d}, "
+                        "convergence_check_interval_={:d}].",
                         c.relative_fitness_, c.relative_rmse_,
-                        c.max_iteration_);
+                        c.max_iteration_, c.convergence_check_interval_);
+            });
+
+    // open3d.t.pipelines.registration.RANSACConvergenceCriteria
+    py::class_<RANSACConvergenceCriteria> ransac_criteria(
+            m, "RANSACConvergenceCriteria",
+            "Convergence criteria of RANSAC. RANSAC stops after "
+            "``max_iteration`` hypotheses, or earlier once the best "
+            "hypothesis is found with probability ``confidence``.");
+    py::detail::bind_copy_functions<RANSACConvergenceCriteria>(
+            ransac_criteria);
+    ransac_criteria
+            .def(py::init<int, double>(), "max_iteration"_a = 100000,
+                 "confidence"_a = 0.999)
+            .def_readwrite("max_iteration",
+                           &RANSACConvergenceCriteria::max_iteration_,
+                           "Maximum number of hypotheses.")
+            .def_readwrite("confidence",
+                           &RANSACConvergenceCriteria::confidence_,
+                           "Desired probability of success, used for early "
+                           "termination.")
+            .def("__repr__", [](const RANSACConvergenceCriteria &c) {
+                return fmt::format(
+                        "RANSACConvergenceCriteria[max_iteration_={:d}, "
+                        "confidence_={:e}].",
+                        c.max_iteration_, c.confidence_);
             });
 
     // open3d.t.pipelines.registration.RegistrationResult
@@ -251,6 +287,50 @@ void pybind_registration_classes(py::module &m) {
             .def_readwrite("kernel",
                            &TransformationEstimationForColoredICP::kernel_,
                            "Robust Kernel used in the Optimization");
+
+    // open3d.t.pipelines.registration.TransformationEstimationForGeneralizedICP
+    // TransformationEstimation
+    py::class_<TransformationEstimationForGeneralizedICP,
+               PyTransformationEstimation<
+                       TransformationEstimationForGeneralizedICP>,
+               TransformationEstimation>
+            te_gicp(m, "TransformationEstimationForGeneralizedICP",
+                    "Class to estimate a transformation between two point "
+                    "clouds using the covariances of their points, as in "
+                    "Generalized-ICP");
+    py::detail::bind_default_constructor<
+            TransformationEstimationForGeneralizedICP>(te_gicp);
+    py::detail::bind_copy_functions<TransformationEstimationForGeneralizedICP>(
+            te_gicp);
+    te_gicp.def(py::init([](double epsilon, RobustKernel &kernel) {
+                    return new TransformationEstimationForGeneralizedICP(
+                            epsilon, kernel);
+                }),
+                "epsilon"_a, "kernel"_a)
+            .def(py::init([](const double epsilon) {
+                     return new TransformationEstimationForGeneralizedICP(
+                             epsilon);
+                 }),
+                 "epsilon"_a)
+            .def(py::init([](const RobustKernel kernel) {
+                     auto te = TransformationEstimationForGeneralizedICP();
+                     te.kernel_ = kernel;
+                     return te;
+                 }),
+                 "kernel"_a)
+            .def("__repr__",
+                 [](const TransformationEstimationForGeneralizedICP &te) {
+                     return std::string(
+                                    "TransformationEstimationForGeneralizedICP"
+                                    " with epsilon: ") +
+                            std::to_string(te.epsilon_);
+                 })
+            .def_readwrite("epsilon",
+                           &TransformationEstimationForGeneralizedICP::epsilon_,
+                           "epsilon")
+            .def_readwrite("kernel",
+                           &TransformationEstimationForGeneralizedICP::kernel_,
+                           "Robust Kernel used in the Optimization");
 }
 
 // Registration functions have similar arguments, sharing arg
@@ -262,6 +342,10 @@ static const std::unordered_map<std::string, std::string>
                  "target points, where the value is the target index and the "
                  "index of the value itself is the source index. It contains "
                  "-1 as value at index with no correspondence."},
+                {"adaptive_iteration_budget",
+                 "If true, a scale following a converged scale gets twice the "
+                 "iterations that scale needed, bounded by its own "
+                 "``max_iteration``."},
                 {"criteria", "Convergence criteria"},
                 {"criteria_list",
                  "List of Convergence criteria for each scale of multi-scale "
@@ -269,8 +353,13 @@ static const std::unordered_map<std::string, std::string>
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``TransformationEstimationPointToPoint``, "
-                 "``TransformationEstimationPointToPlane``)"},
+                 "``TransformationEstimationPointToPlane``, "
+                 "``TransformationEstimationForColoredICP``, "
+                 "``TransformationEstimationForGeneralizedICP``)"},
                 {"init_source_to_target", "Initial transformation estimation"},
+                {"init_source_to_targets",
+                 "List of initial transformation estimations, one per pair. "
+                 "Empty for identity."},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
                 {"max_correspondence_distances",
@@ -278,7 +367,9 @@ static const std::unordered_map<std::string, std::string>
                  "points-pair distances for multi-scale icp."},
                 {"option", "Registration option"},
                 {"source", "The source point cloud."},
+                {"sources", "List of source point clouds."},
                 {"target", "The target point cloud."},
+                {"targets", "List of target point clouds, one per source."},
                 {"transformation",
                  "The 4x4 transformation matrix of type Float64 "
                  "to transform ``source`` to ``target``"},
@@ -305,16 +396,45 @@ void pybind_registration_methods(py::module &m) {
           "criteria"_a = ICPConvergenceCriteria());
     docstring::FunctionDocInject(m, "icp", map_shared_argument_docstrings);
 
-    m.def("multi_scale_icp", &MultiScaleICP,
-          py::call_guard<py::gil_scoped_release>(),
-          "Function for Multi-Scale ICP registration", "source"_a, "target"_a,
-          "voxel_sizes"_a, "criteria_list"_a, "max_correspondence_distances"_a,
-          "init_source_to_target"_a =
-                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
-          "estimation_method"_a = TransformationEstimationPointToPoint());
+    m.def(
+            "multi_scale_icp",
+            [](const geometry::PointCloud &source,
+               const geometry::PointCloud &target,
+               const std::vector<double> &voxel_sizes,
+               const std::vector<ICPConvergenceCriteria> &criteria_list,
+               const std::vector<double> &max_correspondence_distances,
+               const core::Tensor &init_source_to_target,
+               const TransformationEstimation &estimation,
+               bool adaptive_iteration_budget) {
+                return MultiScaleICP(source, target, voxel_sizes,
+                                     criteria_list,
+                                     max_correspondence_distances,
+                                     init_source_to_target, estimation,
+                                     adaptive_iteration_budget);
+            },
+            py::call_guard<py::gil_scoped_release>(),
+            "Function for Multi-Scale ICP registration", "source"_a,
+            "target"_a, "voxel_sizes"_a, "criteria_list"_a,
+            "max_correspondence_distances"_a,
+            "init_source_to_target"_a =
+                    core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+            "estimation_method"_a = TransformationEstimationPointToPoint(),
+            "adaptive_iteration_budget"_a = false);
     docstring::FunctionDocInject(m, "multi_scale_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("batched_icp", &BatchedICP, py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration of many source/target pairs at "
+          "once. With point to plane estimation all pairs iterate together "
+          "in a single kernel launch per iteration and converge "
+          "independently. Returns a list of RegistrationResult.",
+          "sources"_a, "targets"_a, "max_correspondence_distance"_a,
+          "init_source_to_targets"_a = std::vector<core::Tensor>(),
+          "estimation_method"_a = TransformationEstimationPointToPlane(),
+          "criteria"_a = ICPConvergenceCriteria());
+    docstring::FunctionDocInject(m, "batched_icp",
+                                 map_shared_argument_docstrings);
+
     m.def("get_information_matrix", &GetInformationMatrix,
           py::call_guard<py::gil_scoped_release>(),
           "Function for computing information matrix from transformation "
@@ -324,6 +444,54 @@ void pybind_registration_methods(py::module &m) {
           "transformation"_a);
     docstring::FunctionDocInject(m, "get_information_matrix",
                                  map_shared_argument_docstrings);
+
+    m.def("ransac_from_correspondences", &RANSACFromCorrespondences,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for global RANSAC registration based on a set of "
+          "correspondences of shape {C, 2}, each row a pair of (source index, "
+          "target index). Batches of hypotheses are estimated and scored in "
+          "parallel on the point clouds' device.",
+          "source"_a, "target"_a, "correspondences"_a,
+          "max_correspondence_distance"_a, "ransac_n"_a = 3,
+          "criteria"_a = RANSACConvergenceCriteria(), "batch_size"_a = 1024);
+
+    m.def("ransac_from_features", &RANSACFromFeatures,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for global RANSAC registration based on feature matching. "
+          "Each source point is matched to the target point with the nearest "
+          "feature.",
+          "source"_a, "target"_a, "source_features"_a, "target_features"_a,
+          "max_correspondence_distance"_a, "mutual_filter"_a = false,
+          "ransac_n"_a = 3, "criteria"_a = RANSACConvergenceCriteria(),
+          "batch_size"_a = 1024);
+
+    m.def("fast_global_registration_from_features",
+          &FastGlobalRegistrationFromFeatures,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Fast Global Registration based on mutual feature "
+          "matching. The optimization runs on the point clouds' device.",
+          "source"_a, "target"_a, "source_features"_a, "target_features"_a,
+          "option"_a = open3d::pipelines::registration::
+                  FastGlobalRegistrationOption());
+
+    m.def("create_pose_graph_from_point_clouds",
+          &CreatePoseGraphFromPointClouds,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for building a pose graph by registering a sequence of "
+          "point cloud fragments. Feature matched pairs run RANSAC, then all "
+          "pairs are refined with batched ICP on the fragments' device.",
+          "fragments"_a, "features"_a = std::vector<core::Tensor>(),
+          "initial_poses"_a = std::vector<core::Tensor>(),
+          "option"_a = open3d::pipelines::registration::
+                  MultiwayRegistrationOption());
+
+    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to compute FPFH feature for a point cloud. It uses KNN "
+          "search if only max_nn parameter is provided, and HybridSearch if "
+          "radius parameter is also provided. Returns a tensor of shape "
+          "{N, 33}.",
+          "input"_a, "max_nn"_a = 100, "radius"_a = py::none());
 }
 
 void pybind_registration(py::module &m) {
@@ -44,11 +44,13 @@ void pybind_slac_classes(py::module &m) {
     py::detail::bind_copy_functions<SLACOptimizerParams>(slac_optimizer_params);
     slac_optimizer_params
             .def(py::init<const int, const float, const float, const float,
-                          const float, const core::Device, const std::string>(),
+                          const float, const core::Device, const std::string,
+                          const bool, const int, const float>(),
                  "max_iterations"_a = 5, "voxel_size"_a = 0.05,
                  "distance_threshold"_a = 0.07, "fitness_threshold"_a = 0.3,
                  "regularizer_weight"_a = 1, "device"_a = core::Device("CPU:0"),
-                 "slac_folder"_a = "")
+                 "slac_folder"_a = "", "use_sparse_solver"_a = false,
+                 "pcg_max_iterations"_a = 1000, "pcg_tolerance"_a = 1e-5)
             .def_readwrite("max_iterations",
                            &SLACOptimizerParams::max_iterations_,
                            "Number of iterations.")
@@ -69,6 +71,16 @@ void pybind_slac_classes(py::module &m) {
             .def_readwrite("slac_folder", &SLACOptimizerParams::slac_folder_,
                            "Relative directory to store SLAC results in the "
                            "dataset folder.")
+            .def_readwrite("use_sparse_solver",
+                           &SLACOptimizerParams::use_sparse_solver_,
+                           "Assemble a block sparse Hessian and solve it with "
+                           "preconditioned conjugate gradient.")
+            .def_readwrite("pcg_max_iterations",
+                           &SLACOptimizerParams::pcg_max_iterations_,
+                           "Maximum conjugate gradient iterations.")
+            .def_readwrite("pcg_tolerance",
+                           &SLACOptimizerParams::pcg_tolerance_,
+                           "Relative residual to stop conjugate gradient.")
             .def(
                     "get_subfolder_name",
                     [](const SLACOptimizerParams &slac_optimizer_params) {
@@ -81,11 +93,11 @@ void pybind_slac_classes(py::module &m) {
                         "SLACOptimizerParams[max_iterations={:d}, "
                         "voxel_size={:e}, distance_threshold={:e}, "
                         "fitness_threshold={:e}, regularizer_weight={:e}, "
-                        "device={}, slac_folder={}].",
+                        "device={}, slac_folder={}, use_sparse_solver={}].",
                         params.max_iterations_, params.voxel_size_,
                         params.distance_threshold_, params.fitness_threshold_,
                         params.regularizer_weight_, params.device_.ToString(),
-                        params.slac_folder_);
+                        params.slac_folder_, params.use_sparse_solver_);
             });
 
     py::class_<SLACDebugOption> slac_debug_option(m, "slac_debug_option",
@@ -245,13 +257,27 @@ void pybind_slac_methods(py::module &m) {
           py::call_guard<py::gil_scoped_release>(),
           "Read pose graph containing loop closures and odometry to compute "
           "correspondences. Uses aggressive pruning -- reject any suspicious "
-          "pair.",
+          "pair. All sets are saved to correspondences.o3dcols in the "
+          "subfolder of params, edges already saved there are skipped.",
           "fnames_processed"_a, "fragment_pose_graph"_a,
           "params"_a = SLACOptimizerParams(),
           "debug_option"_a = SLACDebugOption());
     docstring::FunctionDocInject(m, "save_correspondences_for_pointclouds",
                                  map_shared_argument_docstrings);
 
+    m.def("compute_correspondences_for_pointclouds",
+          &ComputeCorrespondencesForPointClouds,
+          py::call_guard<py::gil_scoped_release>(),
+          "Compute the correspondences of all the pose graph edges in "
+          "parallel, like save_correspondences_for_pointclouds, and return "
+          "them as a dict from (source, target) to a (C, 2) tensor instead of "
+          "writing them to disk.",
+          "fnames_processed"_a, "fragment_pose_graph"_a,
+          "params"_a = SLACOptimizerParams(),
+          "debug_option"_a = SLACDebugOption());
+    docstring::FunctionDocInject(m, "compute_correspondences_for_pointclouds",
+                                 map_shared_argument_docstrings);
+
     m.def("run_slac_optimizer_for_fragments", &RunSLACOptimizerForFragments,
           "Simultaneous Localization and Calibration: Self-Calibration of "
           "Consumer Depth Cameras, CVPR 2014 Qian-Yi Zhou and Vladlen Koltun "
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/t/pipelines/slam/Frame.h"
+#include "open3d/t/pipelines/slam/FramePipeline.h"
 #include "open3d/t/pipelines/slam/Model.h"
 #include "pybind/docstring.h"
 
@@ -70,6 +71,46 @@ static const std::unordered_map<std::string, std::string>
                 {"intrinsics", "Intrinsic matrix stored in a 3x3 Tensor."}};
 
 void pybind_slam_model(py::module &m) {
+    py::class_<LoopClosureOption> loop_closure_option(
+            m, "LoopClosureOption",
+            "Parameters of the background loop closure of a Model.");
+    py::detail::bind_copy_functions<LoopClosureOption>(loop_closure_option);
+    loop_closure_option
+            .def(py::init<int, int, int, double, double, double, double,
+                          int>(),
+                 "keyframe_interval"_a = 10, "min_keyframe_gap"_a = 10,
+                 "num_candidates"_a = 3, "min_similarity"_a = 0.8,
+                 "voxel_size"_a = 0.05, "max_correspondence_distance"_a = 0.07,
+                 "min_fitness"_a = 0.3, "descriptor_cell_size"_a = 32)
+            .def_readwrite("keyframe_interval",
+                           &LoopClosureOption::keyframe_interval_,
+                           "A keyframe is taken every keyframe_interval "
+                           "integrated frames.")
+            .def_readwrite("min_keyframe_gap",
+                           &LoopClosureOption::min_keyframe_gap_,
+                           "Loop candidates are searched among the keyframes "
+                           "at least min_keyframe_gap keyframes older.")
+            .def_readwrite("num_candidates",
+                           &LoopClosureOption::num_candidates_,
+                           "Number of most similar candidates verified per "
+                           "keyframe.")
+            .def_readwrite("min_similarity",
+                           &LoopClosureOption::min_similarity_,
+                           "Minimum cosine similarity of the global "
+                           "descriptors of a candidate.")
+            .def_readwrite("voxel_size", &LoopClosureOption::voxel_size_,
+                           "Voxel size of the point clouds used in "
+                           "verification.")
+            .def_readwrite("max_correspondence_distance",
+                           &LoopClosureOption::max_correspondence_distance_,
+                           "Maximum correspondence distance in RANSAC, ICP "
+                           "and pose graph optimization.")
+            .def_readwrite("min_fitness", &LoopClosureOption::min_fitness_,
+                           "Minimum ICP fitness of an accepted loop closure.")
+            .def_readwrite("descriptor_cell_size",
+                           &LoopClosureOption::descriptor_cell_size_,
+                           "Cell size in pixels of the global descriptor.");
+
     py::class_<Model> model(m, "Model", "Volumetric model for Dense SLAM.");
     py::detail::bind_copy_functions<Model>(model);
 
@@ -126,6 +167,22 @@ void pybind_slam_model(py::module &m) {
     model.def(
             "get_hashmap", &Model::GetHashMap,
             "Get the underlying hash map from 3D coordinates to voxel blocks.");
+    model.def("enable_loop_closure", &Model::EnableLoopClosure,
+              "Start loop closure on a background thread. Integrate then "
+              "queues a keyframe every option.keyframe_interval frames.",
+              "option"_a = LoopClosureOption());
+    model.def("update_loop_closure", &Model::UpdateLoopClosure,
+              py::call_guard<py::gil_scoped_release>(),
+              "Apply the corrected keyframe poses of the latest closed loop, "
+              "if any, re-integrating the affected voxel blocks. Returns True "
+              "if a correction was applied.");
+    model.def("set_graph_capture", &Model::SetGraphCapture,
+              "Enable or disable recording the odometry pyramids of "
+              "track_frame_to_model into a graph that is replayed on every "
+              "frame on CUDA devices.",
+              "enable"_a);
+    model.def("get_num_graph_captures", &Model::GetNumGraphCaptures,
+              "Number of times the odometry pyramids have been captured.");
     model.def_readwrite("voxel_grid", &Model::voxel_grid_,
                         "Get the maintained TSDFVoxelGrid.");
     model.def_readwrite("transformation_frame_to_world",
@@ -160,11 +217,46 @@ void pybind_slam_frame(py::module &m) {
               "Get a 2D image from from the given key in the map.");
 }
 
+void pybind_slam_frame_pipeline(py::module &m) {
+    py::class_<FramePipelineOption> option(m, "FramePipelineOption",
+                                           "Parameters of FramePipeline.");
+    py::detail::bind_copy_functions<FramePipelineOption>(option);
+    option.def(py::init<int, int, float, float, float, float>(),
+               "queue_size"_a = 2, "max_raycast_lag"_a = 0,
+               "depth_scale"_a = 1000.0f, "depth_min"_a = 0.1f,
+               "depth_max"_a = 3.0f, "depth_diff"_a = 0.07f)
+            .def_readwrite("queue_size", &FramePipelineOption::queue_size_,
+                           "Capacity of the queue between two stages.")
+            .def_readwrite("max_raycast_lag",
+                           &FramePipelineOption::max_raycast_lag_,
+                           "Number of frames the model frame used in "
+                           "tracking may lag behind.")
+            .def_readwrite("depth_scale", &FramePipelineOption::depth_scale_)
+            .def_readwrite("depth_min", &FramePipelineOption::depth_min_)
+            .def_readwrite("depth_max", &FramePipelineOption::depth_max_)
+            .def_readwrite("depth_diff", &FramePipelineOption::depth_diff_);
+
+    py::class_<FramePipeline> pipeline(
+            m, "FramePipeline",
+            "Drives a Model over a sequence of RGBD frames with the decode, "
+            "upload, tracking and mapping stages running concurrently.");
+    pipeline.def(py::init<Model &, const core::Tensor &, int, int,
+                          const FramePipelineOption &>(),
+                 "model"_a, "intrinsics"_a, "height"_a, "width"_a,
+                 "option"_a = FramePipelineOption(), py::keep_alive<1, 2>());
+    pipeline.def("run", &FramePipeline::Run,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Process all the frames returned by source until it returns "
+                 "False. Returns the tracked poses.",
+                 "source"_a, "callback"_a = nullptr);
+}
+
 void pybind_slam(py::module &m) {
     py::module m_submodule =
             m.def_submodule("slam", "Tensor DenseSLAM pipeline.");
     pybind_slam_model(m_submodule);
     pybind_slam_frame(m_submodule);
+    pybind_slam_frame_pipeline(m_submodule);
 }
 
 }  // namespace slam
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+#include <type_traits>
+
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
 
@@ -46,6 +49,24 @@ py::class_<Vector, holder_type> bind_vector_without_repr(
     return cl;
 }
 
+// Copies the rows of a C-contiguous (N, Size) array into a vector of N Eigen
+// vectors of the same scalar type with a single memcpy. Fixed-size Eigen
+// vectors are tightly packed, hence both buffers have the same layout.
+template <typename Scalar, int ExtraFlags, typename Vector>
+void copy_rows_to_vectors(array_t<Scalar, ExtraFlags> &array,
+                          Vector &eigen_vectors) {
+    using EigenVector = typename Vector::value_type;
+    static_assert(std::is_same<typename EigenVector::Scalar, Scalar>::value &&
+                          sizeof(EigenVector) ==
+                                  sizeof(Scalar) *
+                                          EigenVector::SizeAtCompileTime,
+                  "EigenVector must be a tightly packed vector of Scalar.");
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    sizeof(EigenVector) * eigen_vectors.size());
+    }
+}
+
 // - This function is used by Pybind for std::vector<SomeEigenType> constructor.
 //   This optional constructor is added to avoid too many Python <-> C++ API
 //   calls when the vector size is large using the default biding method.
@@ -61,13 +82,7 @@ std::vector<EigenVector> py_array_to_vectors_double(
         throw py::cast_error();
     }
     std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        // The EigenVector here must be a double-typed eigen vector, since only
-        // open3d::Vector3dVector binds to py_array_to_vectors_double.
-        // Therefore, we can use the memory map directly.
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
+    copy_rows_to_vectors(array, eigen_vectors);
     return eigen_vectors;
 }
 
@@ -79,10 +94,7 @@ std::vector<EigenVector> py_array_to_vectors_int(
         throw py::cast_error();
     }
     std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
+    copy_rows_to_vectors(array, eigen_vectors);
     return eigen_vectors;
 }
 
@@ -96,10 +108,7 @@ py_array_to_vectors_int_eigen_allocator(
         throw py::cast_error();
     }
     std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
+    copy_rows_to_vectors(array, eigen_vectors);
     return eigen_vectors;
 }
 
@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Metrics.h"
+
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace utility {
+
+static const char* MetricTypeToString(MetricType type) {
+    switch (type) {
+        case MetricType::Counter:
+            return "counter";
+        case MetricType::Histogram:
+            return "histogram";
+        default:
+            return "gauge";
+    }
+}
+
+void pybind_metrics(py::module& m) {
+    m.def(
+            "collect_metrics",
+            []() {
+                py::list families;
+                for (const MetricFamily& family :
+                     MetricsRegistry::GetInstance().Collect()) {
+                    py::list samples;
+                    for (const MetricSample& sample : family.samples) {
+                        samples.append(py::dict("name"_a = sample.name,
+                                                "labels"_a = sample.labels,
+                                                "value"_a = sample.value));
+                    }
+                    families.append(py::dict(
+                            "name"_a = family.name, "help"_a = family.help,
+                            "type"_a = MetricTypeToString(family.type),
+                            "samples"_a = samples));
+                }
+                return families;
+            },
+            "Returns the current value of all runtime metrics, such as memory "
+            "usage per device, cache hit rates, hash map load factors and "
+            "kernel launch counts. Each metric family is a dict with the keys "
+            "'name', 'help', 'type' and 'samples', where each sample is a "
+            "dict with the keys 'name', 'labels' and 'value'.");
+    m.def(
+            "metrics_to_prometheus_text",
+            []() { return MetricsRegistry::GetInstance().ToPrometheusText(); },
+            "Returns all runtime metrics in the Prometheus text exposition "
+            "format.");
+}
+
+}  // namespace utility
+}  // namespace open3d
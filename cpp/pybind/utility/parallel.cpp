@@ -0,0 +1,52 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Parallel.h"
+
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace utility {
+
+void pybind_parallel(py::module& m) {
+    m.def("set_deterministic", &SetDeterministic,
+          "Enables or disables the deterministic mode. When enabled, CUDA "
+          "registration and odometry reductions, voxel block grid extraction "
+          "and the PyTorch three_interpolate and trilinear_devoxelize "
+          "gradients produce bitwise reproducible results, at the cost of "
+          "some speed.",
+          "deterministic"_a);
+    m.def("is_deterministic", &IsDeterministic,
+          "Returns True if the deterministic mode is enabled.");
+    docstring::FunctionDocInject(
+            m, "set_deterministic",
+            {{"deterministic", "Whether to use deterministic kernels."}});
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Profiler.h"
+
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+
+namespace open3d {
+namespace utility {
+
+void pybind_profiler(py::module& m) {
+    m.def(
+            "set_profiling_enabled",
+            [](bool enabled) { Profiler::GetInstance().SetEnabled(enabled); },
+            "Enables or disables recording of profiling zones. Zones are only "
+            "compiled in if Open3D is built with WITH_PROFILING=ON.",
+            "enabled"_a);
+    m.def(
+            "is_profiling_enabled",
+            []() { return Profiler::GetInstance().IsEnabled(); },
+            "Returns True if profiling zones are being recorded.");
+    m.def(
+            "clear_profile", []() { Profiler::GetInstance().Clear(); },
+            "Discards all recorded profiling zones.");
+    m.def(
+            "write_profile_trace",
+            [](const std::string& filename) {
+                return Profiler::GetInstance().WriteChromeTrace(filename);
+            },
+            "Writes the recorded profiling zones as a Chrome trace JSON file, "
+            "which can be opened in chrome://tracing or "
+            "https://ui.perfetto.dev.",
+            "filename"_a);
+    docstring::FunctionDocInject(m, "set_profiling_enabled",
+                                 {{"enabled", "Whether to record zones."}});
+    docstring::FunctionDocInject(m, "write_profile_trace",
+                                 {{"filename", "Path of the JSON file."}});
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -36,6 +36,9 @@ void pybind_utility(py::module &m) {
     py::module m_submodule = m.def_submodule("utility");
     pybind_logging(m_submodule);
     pybind_eigen(m_submodule);
+    pybind_metrics(m_submodule);
+    pybind_profiler(m_submodule);
+    pybind_parallel(m_submodule);
 }
 
 }  // namespace utility
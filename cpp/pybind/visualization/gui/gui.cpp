@@ -180,6 +180,17 @@ std::shared_ptr<geometry::Image> RenderToDepthImageWithoutWindow(
             height);
 }
 
+std::vector<std::shared_ptr<geometry::Image>> RenderToImagesWithoutWindow(
+        rendering::Open3DScene *scene,
+        int width,
+        int height,
+        size_t n_images,
+        const std::function<void(size_t)> &setup_camera) {
+    return Application::GetInstance().RenderToImages(
+            scene->GetRenderer(), scene->GetView(), scene->GetScene(), width,
+            height, n_images, setup_camera);
+}
+
 enum class EventCallbackResult { IGNORED = 0, HANDLED, CONSUMED };
 
 void pybind_gui_classes(py::module &m) {
@@ -45,6 +45,12 @@ std::shared_ptr<geometry::Image> RenderToImageWithoutWindow(
         rendering::Open3DScene *scene, int width, int height);
 std::shared_ptr<geometry::Image> RenderToDepthImageWithoutWindow(
         rendering::Open3DScene *scene, int width, int height);
+std::vector<std::shared_ptr<geometry::Image>> RenderToImagesWithoutWindow(
+        rendering::Open3DScene *scene,
+        int width,
+        int height,
+        size_t n_images,
+        const std::function<void(size_t)> &setup_camera);
 
 void pybind_gui(py::module &m);
 
@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/visualization/rendering/ColorGrading.h"
@@ -79,6 +81,38 @@ public:
         return gui::RenderToDepthImageWithoutWindow(scene_, width_, height_);
     }
 
+    std::vector<std::shared_ptr<geometry::Image>> RenderToImages(
+            const Eigen::Matrix3d &intrinsic, const core::Tensor &extrinsics) {
+        core::AssertTensorShape(extrinsics, {utility::nullopt, 4, 4});
+        const core::Tensor extrinsics_cpu =
+                extrinsics.To(core::Device("CPU:0"), core::Float64);
+        return gui::RenderToImagesWithoutWindow(
+                scene_, width_, height_, extrinsics_cpu.GetLength(),
+                [&](size_t i) {
+                    const Eigen::Matrix4d extrinsic =
+                            core::eigen_converter::TensorToEigenMatrixXd(
+                                    extrinsics_cpu[i]);
+                    SetupCamera(intrinsic, extrinsic, width_, height_);
+                });
+    }
+
+    py::dict GetRenderStats() const {
+        const auto &stats = renderer_->GetRenderToBufferStats();
+        py::dict result;
+        result["n_frames"] = stats.n_frames;
+        result["n_images"] = stats.n_buffers;
+        result["n_renderers_created"] = stats.n_renderers_created;
+        result["n_renderers_reused"] = stats.n_renderers_reused;
+        result["total_time_ms"] = stats.total_time_ms;
+        result["images_per_second"] =
+                stats.total_time_ms > 0
+                        ? 1000.0 * stats.n_buffers / stats.total_time_ms
+                        : 0.0;
+        return result;
+    }
+
+    void ResetRenderStats() { renderer_->ResetRenderToBufferStats(); }
+
     void SetupCamera(const camera::PinholeCameraIntrinsic &intrinsic,
                      const Eigen::Matrix4d &extrinsic) {
         SetupCamera(intrinsic.intrinsic_matrix_, extrinsic, intrinsic.width_,
@@ -208,7 +242,22 @@ void pybind_rendering_classes(py::module &m) {
                  &PyOffscreenRenderer::RenderToDepthImage,
                  "Renders scene depth buffer to a float image, blocking until "
                  "the image is returned. Pixels range from 0 (near plane) to "
-                 "1 (far plane)");
+                 "1 (far plane)")
+            .def("render_to_images", &PyOffscreenRenderer::RenderToImages,
+                 "intrinsic_matrix"_a, "extrinsic_matrices"_a,
+                 "Renders one image per extrinsic matrix, given as an array "
+                 "of shape (N, 4, 4), with the pinhole camera "
+                 "intrinsic_matrix, blocking until the images are returned. "
+                 "All views are rendered and read back in a single frame, "
+                 "which is much faster than calling render_to_image() for "
+                 "each view")
+            .def_property_readonly(
+                    "render_stats", &PyOffscreenRenderer::GetRenderStats,
+                    "Dictionary with throughput counters of the rendered "
+                    "images: n_frames, n_images, n_renderers_created, "
+                    "n_renderers_reused, total_time_ms and images_per_second")
+            .def("reset_render_stats", &PyOffscreenRenderer::ResetRenderStats,
+                 "Resets the counters in render_stats");
 
     // ---- Camera ----
     py::class_<Camera, std::shared_ptr<Camera>> cam(m, "Camera",
@@ -488,14 +537,25 @@ void pybind_rendering_classes(py::module &m) {
                  "name"_a, "geometry"_a, "material"_a,
                  "downsampled_name"_a = "", "downsample_threshold"_a = SIZE_MAX,
                  "Adds a Geometry with a material to the scene")
+            .def("add_instanced_geometry", &Scene::AddInstancedGeometry,
+                 "name"_a, "geometry"_a, "transforms"_a, "material"_a,
+                 "colors"_a = core::Tensor(),
+                 "Adds one copy of a tgeometry.TriangleMesh or LineSet per "
+                 "(4, 4) matrix of the (N, 4, 4) transforms tensor as a "
+                 "single object that is drawn with one draw call. colors is "
+                 "an optional (N, 3) tensor with a color per instance.")
             .def("has_geometry", &Scene::HasGeometry,
                  "Returns True if a geometry with the provided name exists in "
                  "the scene.")
-            .def("update_geometry", &Scene::UpdateGeometry,
+            .def("update_geometry", &Scene::UpdateGeometry, "name"_a,
+                 "point_cloud"_a, "update_flags"_a, "first_point"_a = 0,
                  "Updates the flagged arrays from the tgeometry.PointCloud. "
                  "The flags should be ORed from Scene.UPDATE_POINTS_FLAG, "
                  "Scene.UPDATE_NORMALS_FLAG, Scene.UPDATE_COLORS_FLAG, and "
-                 "Scene.UPDATE_UV0_FLAG")
+                 "Scene.UPDATE_UV0_FLAG. The points replace the points "
+                 "starting at first_point, which allows updating only a "
+                 "range or appending points within the capacity the "
+                 "geometry was added with")
             .def("enable_indirect_light", &Scene::EnableIndirectLight,
                  "Enables or disables indirect lighting")
             .def("set_indirect_light", &Scene::SetIndirectLight,
@@ -605,6 +665,14 @@ void pybind_rendering_classes(py::module &m) {
                          &Open3DScene::AddGeometry),
                  "name"_a, "geometry"_a, "material"_a,
                  "add_downsampled_copy_for_fast_rendering"_a = true)
+            .def("add_instanced_geometry",
+                 &Open3DScene::AddInstancedGeometry, "name"_a, "geometry"_a,
+                 "transforms"_a, "material"_a, "colors"_a = core::Tensor(),
+                 "Adds one copy of a tgeometry.TriangleMesh or LineSet per "
+                 "(4, 4) matrix of the (N, 4, 4) transforms tensor as a "
+                 "single object that is drawn with one draw call, e.g. for "
+                 "thousands of boxes or camera frustums. colors is an "
+                 "optional (N, 3) tensor with a color per instance.")
             .def("add_model", &Open3DScene::AddModel,
                  "Adds TriangleMeshModel to the scene.")
             .def("has_geometry", &Open3DScene::HasGeometry,
@@ -646,7 +714,19 @@ void pybind_rendering_classes(py::module &m) {
                           &Open3DScene::SetDownsampleThreshold,
                           "Minimum number of points before downsampled point "
                           "clouds are created and used when rendering speed "
-                          "is important");
+                          "is important")
+            .def_property("point_cloud_lod_budget",
+                          &Open3DScene::GetPointCloudLODBudget,
+                          &Open3DScene::SetPointCloudLODBudget,
+                          "Maximum number of points drawn for each point "
+                          "cloud larger than the downsample threshold. If "
+                          "non-zero, such point clouds are rendered from an "
+                          "octree whose visible nodes are streamed in. 0 "
+                          "disables the octree")
+            .def("update_point_cloud_lod", &Open3DScene::UpdatePointCloudLOD,
+                 "Updates the octree nodes shown for the current camera. "
+                 "Returns True if the scene changed. This is called "
+                 "automatically by SceneWidget");
 }
 
 void pybind_rendering(py::module &m) {
@@ -27,6 +27,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "open3d/visualization/utility/SelectionPolygonVolume.h"
@@ -52,6 +53,17 @@ void pybind_visualization_utility(py::module &m) {
                         return s.CropPointCloud(input);
                     },
                     "input"_a, "Function to crop point cloud.")
+            .def(
+                    "crop_point_cloud",
+                    [](const SelectionPolygonVolume &s,
+                       const t::geometry::PointCloud &input) {
+                        return s.CropPointCloud(input);
+                    },
+                    "input"_a,
+                    "Function to crop a tensor point cloud on its device.")
+            .def("get_point_mask", &SelectionPolygonVolume::GetPointMask,
+                 "points"_a,
+                 "Boolean mask of the points inside the selection volume.")
             .def(
                     "crop_triangle_mesh",
                     [](const SelectionPolygonVolume &s,
@@ -81,6 +93,9 @@ void pybind_visualization_utility(py::module &m) {
     docstring::ClassMethodDocInject(m, "SelectionPolygonVolume",
                                     "crop_point_cloud",
                                     {{"input", "The input point cloud."}});
+    docstring::ClassMethodDocInject(
+            m, "SelectionPolygonVolume", "get_point_mask",
+            {{"points", "Float32 or Float64 tensor of shape (N, 3)."}});
     docstring::ClassMethodDocInject(m, "SelectionPolygonVolume",
                                     "crop_triangle_mesh",
                                     {{"input", "The input triangle mesh."}});
@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Dispatch.h"
+
+#include "open3d/core/Dtype.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Dispatch, DtypeToTemplate) {
+    for (const core::Dtype &dtype :
+         {core::Bool, core::Float16, core::BFloat16, core::Float32,
+          core::Float64, core::Int8, core::Int16, core::Int32, core::Int64,
+          core::UInt8, core::UInt16, core::UInt32, core::UInt64}) {
+        if (core::IsDtypeDispatched(dtype)) {
+            const int64_t byte_size =
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype, [&]() {
+                        return int64_t(sizeof(scalar_t));
+                    });
+            EXPECT_EQ(byte_size, dtype.ByteSize());
+        } else {
+            EXPECT_ANY_THROW(
+                    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype, [&]() {
+                        return int64_t(sizeof(scalar_t));
+                    }));
+        }
+    }
+
+    // Float32, Int64 and Bool are always dispatched.
+    EXPECT_TRUE(core::IsDtypeDispatched(core::Float32));
+    EXPECT_TRUE(core::IsDtypeDispatched(core::Int64));
+    EXPECT_TRUE(core::IsDtypeDispatched(core::Bool));
+    EXPECT_ANY_THROW(DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(
+            core::Int64, [&]() { return sizeof(scalar_t); }));
+    EXPECT_ANY_THROW(DISPATCH_DTYPE_TO_TEMPLATE(
+            core::Bool, [&]() { return sizeof(scalar_t); }));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -89,5 +89,60 @@ TEST_P(EigenConverterPermuteDevices, TensorToEigenMatrix) {
             core::Tensor::Ones({5, 4}, core::Int32, cpu_device)));
 }
 
+TEST_P(EigenConverterPermuteDevices, EigenVectorNxVectorToTensor) {
+    core::Device device = GetParam();
+
+    std::vector<Eigen::Vector3d> values(1000);
+    Rand(values, Eigen::Vector3d::Constant(-10), Eigen::Vector3d::Constant(10),
+         0);
+    std::vector<Eigen::Vector3i> int_values(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        int_values[i] = values[i].cast<int>();
+    }
+
+    for (core::Dtype dtype :
+         {core::Float32, core::Float64, core::Int32, core::Int64}) {
+        const core::Tensor tensor =
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        values, dtype, device);
+        EXPECT_EQ(tensor.GetShape(), core::SizeVector({1000, 3}));
+        EXPECT_EQ(tensor.GetDtype(), dtype);
+        EXPECT_EQ(tensor.GetDevice(), device);
+
+        // Round trip through the narrower dtype.
+        const std::vector<Eigen::Vector3d> values_converted =
+                core::eigen_converter::TensorToEigenVector3dVector(tensor);
+        ASSERT_EQ(values_converted.size(), values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            const Eigen::Vector3d expected =
+                    dtype == core::Float32
+                            ? values[i].cast<float>().cast<double>()
+                            : dtype == core::Float64
+                                      ? values[i]
+                                      : int_values[i].cast<double>();
+            ExpectEQ(values_converted[i], expected);
+        }
+
+        // Non-contiguous tensors are handled as well.
+        const core::Tensor tensor_i = core::eigen_converter::
+                EigenVector3iVectorToTensor(int_values, dtype, device);
+        const std::vector<Eigen::Vector2i> values_2i =
+                core::eigen_converter::TensorToEigenVector2iVector(
+                        tensor_i.Slice(1, 1, 3));
+        ASSERT_EQ(values_2i.size(), values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            ExpectEQ(values_2i[i], Eigen::Vector2i(int_values[i].tail<2>()));
+        }
+    }
+
+    EXPECT_TRUE(core::eigen_converter::TensorToEigenVector3dVector(
+                        core::Tensor::Empty({0, 3}, core::Float32, device))
+                        .empty());
+    EXPECT_EQ(core::eigen_converter::EigenVector3dVectorToTensor(
+                      {}, core::Float32, device)
+                      .GetShape(),
+              core::SizeVector({0, 3}));
+}
+
 }  // namespace tests
 }  // namespace open3d
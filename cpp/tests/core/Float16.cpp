@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/core/Float16.h"
+
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class Float16PermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Float16,
+                         Float16PermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST(Float16, Float16Conversion) {
+    using core::float16_t;
+    EXPECT_EQ(float16_t(1.f).GetBits(), 0x3c00);
+    EXPECT_EQ(float16_t(-2.f).GetBits(), 0xc000);
+    EXPECT_EQ(float16_t(-0.f).GetBits(), 0x8000);
+    EXPECT_EQ(float16_t(65504.f).GetBits(), 0x7bff);
+    EXPECT_EQ(float(float16_t::FromBits(0x3555)), 0.333251953125f);
+
+    // Round to nearest even.
+    EXPECT_EQ(float(float16_t(2049.f)), 2048.f);
+    EXPECT_EQ(float(float16_t(2051.f)), 2052.f);
+    EXPECT_EQ(float(float16_t(1.f / 3.f)), 0.333251953125f);
+
+    // Subnormals, overflow and NaN.
+    EXPECT_EQ(float16_t(std::ldexp(1.f, -24)).GetBits(), 0x0001);
+    EXPECT_EQ(float(float16_t::FromBits(0x0001)), std::ldexp(1.f, -24));
+    EXPECT_EQ(float16_t(1e5f).GetBits(), 0x7c00);
+    EXPECT_TRUE(std::isinf(float(float16_t(
+            std::numeric_limits<float>::infinity()))));
+    EXPECT_TRUE(std::isnan(float(float16_t(
+            std::numeric_limits<float>::quiet_NaN()))));
+
+    EXPECT_EQ(float(std::numeric_limits<float16_t>::max()), 65504.f);
+    EXPECT_EQ(float(std::numeric_limits<float16_t>::lowest()), -65504.f);
+}
+
+TEST(Float16, BFloat16Conversion) {
+    using core::bfloat16_t;
+    EXPECT_EQ(bfloat16_t(1.f).GetBits(), 0x3f80);
+    EXPECT_EQ(bfloat16_t(-2.f).GetBits(), 0xc000);
+    EXPECT_EQ(float(bfloat16_t(3.f)), 3.f);
+
+    // Round to nearest even: 1 + 2^-8 is a tie between 1 and 1 + 2^-7.
+    EXPECT_EQ(float(bfloat16_t(1.f + std::ldexp(1.f, -8))), 1.f);
+    EXPECT_EQ(float(bfloat16_t(1.f + 3 * std::ldexp(1.f, -8))),
+              1.f + std::ldexp(1.f, -6));
+
+    EXPECT_EQ(bfloat16_t(std::numeric_limits<float>::infinity()).GetBits(),
+              0x7f80);
+    EXPECT_TRUE(std::isnan(float(bfloat16_t(
+            std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_EQ(float(std::numeric_limits<bfloat16_t>::max()),
+              std::ldexp(255.f, 120));
+}
+
+TEST_P(Float16PermuteDevices, ElementWise) {
+    core::Device device = GetParam();
+
+    for (const core::Dtype& dtype : {core::Float16, core::BFloat16}) {
+        core::Tensor a = core::Tensor::Init<float>({1, 4, 9, 16}, device);
+        core::Tensor b = core::Tensor::Init<float>({2, 2, 3, 0.5}, device);
+        core::Tensor a_half = a.To(dtype);
+        core::Tensor b_half = b.To(dtype);
+        EXPECT_EQ(a_half.GetDtype(), dtype);
+        EXPECT_EQ(a_half.GetDtype().ByteSize(), 2);
+        EXPECT_TRUE(a_half.To(core::Float32).AllClose(a));
+
+        EXPECT_TRUE((a_half + b_half).To(core::Float32).AllClose(a + b));
+        EXPECT_TRUE((a_half - b_half).To(core::Float32).AllClose(a - b));
+        EXPECT_TRUE((a_half * b_half).To(core::Float32).AllClose(a * b));
+        EXPECT_TRUE((a_half / b_half).To(core::Float32).AllClose(a / b));
+        EXPECT_TRUE((a_half + 1).To(core::Float32).AllClose(a + 1));
+        EXPECT_TRUE(a_half.Sqrt().To(core::Float32).AllClose(a.Sqrt()));
+        EXPECT_TRUE(a_half.Neg().To(core::Float32).AllClose(a.Neg()));
+        EXPECT_TRUE(a_half.Gt(b_half).AllEqual(a.Gt(b)));
+        EXPECT_FALSE(a_half.IsNan().Any());
+
+        // Casting between the two half types goes through float.
+        core::Dtype other = dtype == core::Float16 ? core::BFloat16
+                                                   : core::Float16;
+        EXPECT_TRUE(a_half.To(other).To(core::Float32).AllClose(a));
+        EXPECT_EQ(float(a_half[1].To(core::Float16).Item<core::float16_t>()),
+                  4.f);
+    }
+}
+
+TEST_P(Float16PermuteDevices, Reduction) {
+    core::Device device = GetParam();
+
+    for (const core::Dtype& dtype : {core::Float16, core::BFloat16}) {
+        // Accumulating in the half type would stall at 2048 (Float16) or 256
+        // (BFloat16); Float32 accumulation keeps the sum exact.
+        core::Tensor ones = core::Tensor::Ones({4096}, dtype, device);
+        core::Tensor sum = ones.Sum({0});
+        EXPECT_EQ(sum.GetDtype(), dtype);
+        EXPECT_EQ(sum.To(core::Float32).Item<float>(), 4096.f);
+
+        core::Tensor a =
+                core::Tensor::Init<float>({{3, -1, 2}, {0.5, 8, -4}}, device);
+        core::Tensor a_half = a.To(dtype);
+        EXPECT_TRUE(a_half.Sum({1}).To(core::Float32).AllClose(a.Sum({1})));
+        EXPECT_TRUE(a_half.Max({0}).To(core::Float32).AllClose(a.Max({0})));
+        EXPECT_TRUE(a_half.Min({0}).To(core::Float32).AllClose(a.Min({0})));
+        EXPECT_TRUE(a_half.ArgMax({1}).AllEqual(a.ArgMax({1})));
+        EXPECT_TRUE(a_half.ArgMin({1}).AllEqual(a.ArgMin({1})));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/Graph.h"
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class GraphPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Graph,
+                         GraphPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(GraphPermuteDevices, CaptureReplay) {
+    core::Device device = GetParam();
+
+    core::Graph graph(device);
+    EXPECT_EQ(graph.GetDevice(), device);
+    EXPECT_FALSE(graph.IsCaptured());
+    EXPECT_ANY_THROW(graph.Replay());
+
+    core::Tensor input = core::Tensor::Zeros({2, 3}, core::Float32, device);
+    core::Tensor output;
+    for (int frame = 0; frame < 3; ++frame) {
+        input.CopyFrom(core::Tensor::Full({2, 3}, frame, core::Float32,
+                                          device));
+        if (graph.NeedsCapture(input.GetShape())) {
+            graph.Capture(input.GetShape(), [&]() {
+                // Temporaries released during the capture stay valid.
+                core::Tensor scaled = input * 2;
+                output = (scaled + 1).Reshape({3, 2});
+            });
+        }
+        graph.Replay();
+        EXPECT_TRUE(output.AllClose(core::Tensor::Full(
+                {3, 2}, 2 * frame + 1, core::Float32, device)));
+    }
+    EXPECT_TRUE(graph.IsCaptured());
+    EXPECT_EQ(graph.GetNumCaptures(), 1);
+
+    // A different shape requires a new capture.
+    EXPECT_TRUE(graph.NeedsCapture({4, 3}));
+    input = core::Tensor::Ones({4, 3}, core::Float32, device);
+    graph.Capture(input.GetShape(), [&]() { output = input * 3; });
+    graph.Replay();
+    EXPECT_EQ(graph.GetNumCaptures(), 2);
+    EXPECT_TRUE(output.AllClose(
+            core::Tensor::Full({4, 3}, 3, core::Float32, device)));
+
+    graph.Reset();
+    EXPECT_FALSE(graph.IsCaptured());
+    EXPECT_TRUE(graph.NeedsCapture({4, 3}));
+    EXPECT_TRUE(output.AllClose(
+            core::Tensor::Full({4, 3}, 3, core::Float32, device)));
+}
+
+TEST_P(GraphPermuteDevices, CaptureError) {
+    core::Device device = GetParam();
+
+    core::Graph graph(device);
+    EXPECT_FALSE(core::Graph::IsCapturing(device));
+    // The function fails while capturing on CUDA and while replaying on CPU.
+    EXPECT_ANY_THROW({
+        graph.Capture({}, [&]() {
+            utility::LogError("Failure in the captured function.");
+        });
+        graph.Replay();
+    });
+    EXPECT_FALSE(core::Graph::IsCapturing(device));
+
+    // Nested captures are rejected.
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        core::Graph inner(device);
+        EXPECT_ANY_THROW(graph.Capture({}, [&]() {
+            EXPECT_TRUE(core::Graph::IsCapturing(device));
+            inner.Capture({}, []() {});
+        }));
+        EXPECT_FALSE(graph.IsCaptured());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
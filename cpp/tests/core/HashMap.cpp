@@ -34,6 +34,8 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/hashmap/HashSet.h"
+#include "open3d/core/hashmap/PagedHashMap.h"
+#include "open3d/core/hashmap/ShardedHashMap.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Optional.h"
 #include "tests/Tests.h"
@@ -82,6 +84,7 @@ TEST_P(HashMapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     for (auto backend : backends) {
@@ -112,6 +115,7 @@ TEST_P(HashMapPermuteDevices, Find) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -156,6 +160,7 @@ TEST_P(HashMapPermuteDevices, Insert) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -209,6 +214,7 @@ TEST_P(HashMapPermuteDevices, Erase) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -272,6 +278,7 @@ TEST_P(HashMapPermuteDevices, Reserve) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -326,6 +333,7 @@ TEST_P(HashMapPermuteDevices, Clear) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -384,6 +392,106 @@ TEST_P(HashMapPermuteDevices, Clear) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, Delta) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
+    }
+
+    for (auto backend : backends) {
+        core::HashMap hashmap(8, core::Int32, {1}, core::Int32, {1}, device,
+                              backend);
+        core::HashMap replica(8, core::Int32, {1}, core::Int32, {1}, device,
+                              backend);
+        EXPECT_ANY_THROW(hashmap.ExportDelta());
+        hashmap.EnableDeltaTracking();
+        EXPECT_TRUE(hashmap.IsDeltaTrackingEnabled());
+
+        // Values of keys [0, 32) in a hash map, -1 if not present.
+        auto lookup = [&](core::HashMap& map) {
+            core::Tensor keys = core::Tensor::Arange(0, 32, 1, core::Int32,
+                                                     device)
+                                        .Reshape({32, 1});
+            core::Tensor buf_indices, masks;
+            map.Find(keys, buf_indices, masks);
+            std::vector<int> values(32, -1);
+            std::vector<bool> found = masks.ToFlatVector<bool>();
+            std::vector<int> found_values =
+                    map.GetValueTensor()
+                            .IndexGet({buf_indices.To(core::Int64)})
+                            .ToFlatVector<int>();
+            for (int i = 0; i < 32; ++i) {
+                if (found[i]) values[i] = found_values[i];
+            }
+            return values;
+        };
+
+        core::Tensor keys =
+                core::Tensor::Arange(0, 5, 1, core::Int32, device).Reshape(
+                        {5, 1});
+        hashmap.Insert(keys, keys.Mul(10));
+        core::HashMapDelta delta = hashmap.ExportDelta();
+        EXPECT_EQ(delta.epoch, 0);
+        EXPECT_EQ(delta.keys.GetLength(), 5);
+        EXPECT_EQ(delta.erased_keys.GetShape(), core::SizeVector({0, 1}));
+        replica.ApplyDelta(delta);
+        EXPECT_EQ(replica.Size(), 5);
+        EXPECT_EQ(lookup(replica), lookup(hashmap));
+
+        // No changes, nothing to export.
+        delta = hashmap.ExportDelta();
+        EXPECT_EQ(delta.epoch, 1);
+        EXPECT_EQ(delta.keys.GetLength(), 0);
+        EXPECT_EQ(delta.erased_keys.GetLength(), 0);
+
+        // Modify a value in place, erase a key and insert enough keys to
+        // trigger a rehash.
+        core::Tensor buf_indices, masks;
+        hashmap.Find(core::Tensor::Init<int>({{2}}, device), buf_indices,
+                     masks);
+        hashmap.GetValueTensor().IndexSet(
+                {buf_indices.To(core::Int64)},
+                core::Tensor::Init<int>({{99}}, device));
+        hashmap.MarkDirty(buf_indices);
+        hashmap.Erase(core::Tensor::Init<int>({{3}, {31}}, device));
+        keys = core::Tensor::Arange(5, 21, 1, core::Int32, device)
+                       .Reshape({16, 1});
+        hashmap.Insert(keys, keys.Mul(10));
+        EXPECT_GT(hashmap.GetCapacity(), 8);
+
+        delta = hashmap.ExportDelta();
+        EXPECT_EQ(delta.epoch, 2);
+        EXPECT_EQ(delta.keys.GetLength(), 17);
+        EXPECT_EQ(delta.erased_keys.ToFlatVector<int>(),
+                  std::vector<int>({3}));
+        replica.ApplyDelta(delta);
+        EXPECT_EQ(replica.Size(), 20);
+        std::vector<int> values = lookup(replica);
+        EXPECT_EQ(values, lookup(hashmap));
+        EXPECT_EQ(values[2], 99);
+        EXPECT_EQ(values[3], -1);
+
+        // Erased and re-inserted keys are applied in order.
+        hashmap.Erase(core::Tensor::Init<int>({{4}}, device));
+        hashmap.Insert(core::Tensor::Init<int>({{4}}, device),
+                       core::Tensor::Init<int>({{44}}, device));
+        replica.ApplyDelta(hashmap.ExportDelta());
+        EXPECT_EQ(lookup(replica), lookup(hashmap));
+
+        hashmap.Clear();
+        delta = hashmap.ExportDelta();
+        EXPECT_EQ(delta.keys.GetLength(), 0);
+        EXPECT_EQ(delta.erased_keys.GetLength(), 20);
+        replica.ApplyDelta(delta);
+        EXPECT_EQ(replica.Size(), 0);
+    }
+}
+
 class int3 {
 public:
     int3() : x_(0), y_(0), z_(0){};
@@ -404,6 +512,7 @@ TEST_P(HashMapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -463,6 +572,7 @@ TEST_P(HashMapPermuteDevices, MultivalueInsertion) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -528,6 +638,76 @@ TEST_P(HashMapPermuteDevices, MultivalueInsertion) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, FindAndGather) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashBackendType::Slab);
+        backends.push_back(core::HashBackendType::StdGPU);
+    } else {
+        backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
+    }
+
+    const int n = 100;
+    core::Tensor keys =
+            core::Tensor::Arange(0, n, 1, core::Int32, device).Reshape({n, 1});
+    core::Tensor values_i64 = keys.To(core::Int64).Mul(7);
+    core::Tensor values_f32 =
+            core::Tensor::Ones({n, 3}, core::Float32, device).Mul(
+                    keys.To(core::Float32));
+    // 3-byte elements exercise the byte-wise copy.
+    core::Tensor values_u8 = values_f32.To(core::UInt8);
+
+    for (auto backend : backends) {
+        core::HashMap hashmap(n, core::Int32, {1},
+                              {core::Int64, core::Float32, core::UInt8},
+                              {{1}, {3}, {3}}, device, backend);
+        hashmap.Insert(keys, {values_i64, values_f32, values_u8});
+
+        // Half of the queries are missing.
+        core::Tensor queries = core::Tensor::Arange(n / 2, n + n / 2, 1,
+                                                    core::Int32, device)
+                                       .Reshape({n, 1});
+        std::vector<core::Tensor> values;
+        core::Tensor buf_indices, masks;
+        hashmap.FindAndGather(queries, {}, values, buf_indices, masks);
+        ASSERT_EQ(values.size(), 3u);
+        EXPECT_EQ(values[1].GetShape(), core::SizeVector({n, 3}));
+
+        core::Tensor expected_buf_indices, expected_masks;
+        hashmap.Find(queries, expected_buf_indices, expected_masks);
+        EXPECT_TRUE(masks.AllEqual(expected_masks));
+
+        core::Tensor found = masks.NonZero()[0];
+        core::Tensor missing = masks.LogicalNot().NonZero()[0];
+        EXPECT_EQ(found.GetLength(), n / 2);
+        core::Tensor found_buf_indices =
+                buf_indices.IndexGet({found}).To(core::Int64);
+        for (size_t i = 0; i < values.size(); ++i) {
+            core::Tensor value_buffer = hashmap.GetValueTensor(i);
+            EXPECT_TRUE(values[i].IndexGet({found}).AllEqual(
+                    value_buffer.IndexGet({found_buf_indices})));
+            EXPECT_TRUE(values[i].IndexGet({missing}).AllEqual(
+                    core::Tensor::Zeros({n / 2, i == 0 ? 1 : 3},
+                                        value_buffer.GetDtype(), device)));
+        }
+        EXPECT_TRUE(values[0].IndexGet({found}).AllEqual(
+                values_i64.Slice(0, n / 2, n)));
+
+        // Select a subset, in any order.
+        core::Tensor selected_masks;
+        std::tie(values, selected_masks) =
+                hashmap.FindAndGather(queries, {2, 1});
+        ASSERT_EQ(values.size(), 2u);
+        EXPECT_EQ(values[0].GetDtype(), core::UInt8);
+        EXPECT_TRUE(values[1].IndexGet({found}).AllEqual(
+                values_f32.Slice(0, n / 2, n)));
+
+        EXPECT_ANY_THROW(hashmap.FindAndGather(queries, {3}));
+    }
+}
+
 TEST_P(HashMapPermuteDevices, HashSet) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends;
@@ -536,6 +716,7 @@ TEST_P(HashMapPermuteDevices, HashSet) {
         backends.push_back(core::HashBackendType::StdGPU);
     } else {
         backends.push_back(core::HashBackendType::TBB);
+        backends.push_back(core::HashBackendType::LinearProbing);
     }
 
     const int n = 1000000;
@@ -562,6 +743,166 @@ TEST_P(HashMapPermuteDevices, HashSet) {
     }
 }
 
+TEST_P(HashMapPermuteDevices, ShardedHashMap) {
+    core::Device device = GetParam();
+
+    // Voxel coordinates in [-5, 5)^3, the value is the linear index.
+    std::vector<int> coords;
+    std::vector<float> indices;
+    for (int x = -5; x < 5; ++x) {
+        for (int y = -5; y < 5; ++y) {
+            for (int z = -5; z < 5; ++z) {
+                coords.insert(coords.end(), {x, y, z});
+                indices.push_back(static_cast<float>(indices.size()));
+            }
+        }
+    }
+    const int64_t n = static_cast<int64_t>(indices.size());
+    core::Tensor keys(coords, {n, 3}, core::Int32, device);
+    core::Tensor values(indices, {n, 1}, core::Float32, device);
+
+    core::ShardedHashMap hashmap(64, core::Int32, {3}, {core::Float32}, {{1}},
+                                 {device, device, device});
+    EXPECT_EQ(hashmap.GetShardCount(), 3);
+
+    core::Tensor shard_indices = hashmap.ComputeShardIndices(keys);
+    EXPECT_EQ(shard_indices.GetDevice(), device);
+    EXPECT_GE(shard_indices.Min({0}).Item<int64_t>(), 0);
+    EXPECT_LT(shard_indices.Max({0}).Item<int64_t>(), 3);
+
+    core::Tensor buf_indices, masks;
+    std::tie(buf_indices, masks) = hashmap.Insert(keys, {values});
+    EXPECT_EQ(masks.GetDevice(), device);
+    EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), n);
+    EXPECT_EQ(hashmap.Size(), n);
+    for (int64_t s = 0; s < 3; ++s) {
+        // Keys are spread over all shards.
+        EXPECT_GT(hashmap.GetShard(s).Size(), n / 6);
+    }
+
+    // Buffer indices refer to the shard of each key.
+    std::vector<int64_t> shard_vec = shard_indices.ToFlatVector<int64_t>();
+    std::vector<int> buf_vec = buf_indices.ToFlatVector<int>();
+    for (int64_t i = 0; i < n; i += 97) {
+        core::Tensor stored_key =
+                hashmap.GetShard(shard_vec[i]).GetKeyTensor()[buf_vec[i]];
+        EXPECT_TRUE(stored_key.AllEqual(keys[i]));
+    }
+
+    // Duplicates are rejected.
+    std::tie(buf_indices, masks) = hashmap.Insert(keys, {values});
+    EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), 0);
+
+    core::Tensor found_values;
+    std::tie(found_values, masks) = hashmap.FindValues(keys);
+    EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), n);
+    EXPECT_TRUE(found_values.AllEqual(values));
+
+    // Erase the half with x < 0.
+    core::Tensor negative = keys.Slice(0, 0, n / 2);
+    masks = hashmap.Erase(negative);
+    EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), n / 2);
+    EXPECT_EQ(hashmap.Size(), n / 2);
+    std::tie(found_values, masks) = hashmap.FindValues(keys);
+    std::vector<bool> found = masks.ToFlatVector<bool>();
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(found[i], i >= n / 2);
+    }
+    EXPECT_TRUE(found_values.Slice(0, 0, n / 2).AllEqual(
+            core::Tensor::Zeros({n / 2, 1}, core::Float32, device)));
+
+    std::tie(buf_indices, masks) = hashmap.Activate(negative);
+    EXPECT_EQ(masks.To(core::Int64).Sum({0}).Item<int64_t>(), n / 2);
+    EXPECT_EQ(hashmap.Size(), n);
+
+    hashmap.Clear();
+    EXPECT_EQ(hashmap.Size(), 0);
+    EXPECT_ANY_THROW(hashmap.Find(keys.To(core::Int64)));
+}
+
+TEST_P(HashMapPermuteDevices, PagedHashMap) {
+    core::Device device = GetParam();
+
+    auto make_keys = [&](int begin, int end) {
+        return core::Tensor::Arange(begin, end, 1, core::Int32, device)
+                .Reshape({end - begin, 1});
+    };
+    // Values of keys [begin, end) read from the device map, -1 if missing.
+    auto find_values = [&](core::PagedHashMap& hashmap, int begin, int end) {
+        core::Tensor buf_indices, masks;
+        std::tie(buf_indices, masks) = hashmap.Find(make_keys(begin, end));
+        core::Tensor value_buffer = hashmap.GetDeviceHashMap().GetValueTensor();
+        std::vector<int> values =
+                value_buffer.IndexGet({buf_indices.To(core::Int64)})
+                        .ToFlatVector<int>();
+        std::vector<bool> found = masks.ToFlatVector<bool>();
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (!found[i]) values[i] = -1;
+        }
+        return values;
+    };
+    auto expected_values = [](int begin, int end) {
+        std::vector<int> values;
+        for (int i = begin; i < end; ++i) values.push_back(10 * i);
+        return values;
+    };
+
+    core::PagedHashMap hashmap(16, core::Int32, {1}, {core::Int32}, {{1}},
+                               device);
+    const int64_t capacity = hashmap.GetDeviceHashMap().GetCapacity();
+    EXPECT_GE(capacity, 16);
+
+    // Insert more entries than fit on the device.
+    core::Tensor buf_indices, masks;
+    for (int begin = 0; begin < 4 * capacity; begin += 8) {
+        core::Tensor keys = make_keys(begin, begin + 8);
+        std::tie(buf_indices, masks) = hashmap.Insert(keys, {keys.Mul(10)});
+        EXPECT_TRUE(masks.All());
+    }
+    EXPECT_EQ(hashmap.Size(), 4 * capacity);
+    EXPECT_LE(hashmap.DeviceSize(), capacity);
+    EXPECT_EQ(hashmap.GetDeviceHashMap().GetCapacity(), capacity);
+
+    // Every entry is paged back in on demand.
+    for (int begin = 0; begin < 4 * capacity; begin += 8) {
+        EXPECT_EQ(find_values(hashmap, begin, begin + 8),
+                  expected_values(begin, begin + 8));
+    }
+    EXPECT_EQ(hashmap.Size(), 4 * capacity);
+
+    // Inserting existing keys, resident or not, leaves them unchanged.
+    core::Tensor keys = make_keys(0, 8);
+    std::tie(buf_indices, masks) = hashmap.Insert(keys, {keys.Mul(-1)});
+    EXPECT_FALSE(masks.Any());
+    EXPECT_EQ(find_values(hashmap, 0, 8), expected_values(0, 8));
+
+    // The least recently used entries are evicted first.
+    const int64_t resident = hashmap.DeviceSize();
+    EXPECT_EQ(hashmap.Evict(capacity), resident);
+    EXPECT_EQ(hashmap.DeviceSize(), 0);
+    find_values(hashmap, 0, 8);
+    find_values(hashmap, 8, 16);
+    find_values(hashmap, 0, 8);
+    hashmap.Evict(8);
+    core::Tensor host_buf_indices, host_masks;
+    core::HashMap host_hashmap = hashmap.GetHostHashMap();
+    host_hashmap.Find(make_keys(8, 16).To(core::Device("CPU:0")),
+                      host_buf_indices, host_masks);
+    EXPECT_TRUE(host_masks.All());
+    host_hashmap.Find(make_keys(0, 8).To(core::Device("CPU:0")),
+                      host_buf_indices, host_masks);
+    EXPECT_FALSE(host_masks.Any());
+
+    // Erase from both tiers.
+    masks = hashmap.Erase(make_keys(0, 16));
+    EXPECT_TRUE(masks.All());
+    EXPECT_EQ(hashmap.Size(), 4 * capacity - 16);
+    EXPECT_EQ(find_values(hashmap, 0, 8), std::vector<int>(8, -1));
+
+    // A single operation cannot exceed the device capacity.
+    EXPECT_ANY_THROW(hashmap.Activate(make_keys(1000, 1000 + capacity + 1)));
+}
+
 TEST_P(HashMapPermuteDevices, HashMapIO) {
     const core::Device &device = GetParam();
     const std::string file_name_noext = "hashmap";
@@ -602,5 +943,48 @@ TEST_P(HashMapPermuteDevices, HashMapIO) {
     utility::filesystem::RemoveFile(file_name_ext);
 }
 
+TEST_P(HashMapPermuteDevices, HashMapBinaryIO) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "hashmap.o3dhash";
+
+    const int n = 10000;
+    const int slots = 1023;
+    HashData<int3, int> data(n, slots);
+
+    std::vector<int> keys_int3;
+    keys_int3.assign(reinterpret_cast<int *>(data.keys_.data()),
+                     reinterpret_cast<int *>(data.keys_.data()) + 3 * n);
+    core::Tensor keys(keys_int3, {n, 3}, core::Int32, device);
+    core::Tensor values(data.vals_, {n}, core::Int32, device);
+    core::Tensor colors = core::Tensor::Ones({n, 3}, core::Float64, device);
+
+    core::HashMap hashmap(n * 2, core::Int32, {3}, {core::Int32, core::Float64},
+                          {{1}, {3}}, device);
+    core::Tensor buf_indices, masks;
+    hashmap.Insert(keys, {values, colors}, buf_indices, masks);
+    hashmap.Save(file_name);
+    EXPECT_TRUE(utility::filesystem::FileExists(file_name));
+
+    core::HashMap hashmap_loaded = core::HashMap::Load(file_name, device);
+    EXPECT_EQ(hashmap_loaded.GetDevice(), device);
+    EXPECT_EQ(hashmap_loaded.Size(), slots);
+    EXPECT_EQ(hashmap_loaded.GetCapacity(), hashmap.GetCapacity());
+
+    hashmap_loaded.Find(keys, buf_indices, masks);
+    EXPECT_TRUE(masks.All());
+    core::Tensor indices = buf_indices.To(core::Int64);
+    EXPECT_TRUE(hashmap_loaded.GetValueTensor(0).IndexGet({indices}).Reshape(
+            {n}).AllEqual(values));
+    EXPECT_TRUE(hashmap_loaded.GetValueTensor(1).IndexGet({indices}).AllEqual(
+            colors));
+
+    // Empty hash maps round trip as well.
+    core::HashMap empty(16, core::Int32, {3}, core::Int32, {1}, device);
+    empty.Save(file_name);
+    EXPECT_EQ(core::HashMap::Load(file_name, device).Size(), 0);
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
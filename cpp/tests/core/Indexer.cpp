@@ -274,5 +274,54 @@ TEST_P(IndexerPermuteDevices, IsContiguous) {
     EXPECT_TRUE(output.IsContiguous());
 }
 
+TEST_P(IndexerPermuteDevices, GetInputBroadcastLayout) {
+    core::Device device = GetParam();
+
+    core::Tensor output({4, 3}, core::Float32, device);
+    core::Tensor full({4, 3}, core::Float32, device);
+    core::Tensor row({3}, core::Float32, device);
+    core::Tensor column({4, 1}, core::Float32, device);
+    core::Tensor scalar({}, core::Float32, device);
+    core::Tensor strided = core::Tensor({4, 6}, core::Float32, device)
+                                   .Slice(1, 0, 6, 2);  // Shape {4, 3}.
+    core::Tensor strided_column = core::Tensor({4, 2}, core::Float32, device)
+                                          .Slice(1, 0, 1);  // Shape {4, 1}.
+    core::Indexer indexer(
+            {full, row, column, scalar, strided, strided_column}, output);
+
+    EXPECT_EQ(indexer.NumBroadcastCols(), 3);
+    EXPECT_EQ(indexer.GetInputBroadcastLayout(0),
+              core::BroadcastLayout::Contiguous);
+    EXPECT_EQ(indexer.GetInputBroadcastLayout(1), core::BroadcastLayout::Row);
+    EXPECT_EQ(indexer.GetInputBroadcastLayout(2),
+              core::BroadcastLayout::Column);
+    EXPECT_EQ(indexer.GetInputBroadcastLayout(3),
+              core::BroadcastLayout::Scalar);
+    EXPECT_EQ(indexer.GetInputBroadcastLayout(4),
+              core::BroadcastLayout::General);
+    EXPECT_EQ(indexer.GetInputBroadcastLayout(5),
+              core::BroadcastLayout::General);
+
+    // A row of a batch of matrices is not a single row of the {rows, cols}
+    // view.
+    core::Tensor batch_output({2, 4, 3}, core::Float32, device);
+    core::Tensor batch_row({2, 1, 3}, core::Float32, device);
+    core::Tensor batch_column({2, 4, 1}, core::Float32, device);
+    core::Indexer batch_indexer({batch_row, batch_column}, batch_output);
+    EXPECT_EQ(batch_indexer.GetInputBroadcastLayout(0),
+              core::BroadcastLayout::General);
+    EXPECT_EQ(batch_indexer.GetInputBroadcastLayout(1),
+              core::BroadcastLayout::Column);
+
+    // Non-contiguous outputs always use the generic kernels.
+    core::Tensor strided_output = core::Tensor({4, 6}, core::Float32, device)
+                                          .Slice(1, 0, 6, 2);
+    core::Indexer strided_indexer({full, row}, strided_output);
+    EXPECT_EQ(strided_indexer.GetInputBroadcastLayout(0),
+              core::BroadcastLayout::General);
+    EXPECT_EQ(strided_indexer.GetInputBroadcastLayout(1),
+              core::BroadcastLayout::General);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/LBVHIndex.h"
+
+#include <algorithm>
+#include <random>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class LBVHIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LBVHIndex,
+                         LBVHIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Random points on a coarse grid, so that the dataset contains duplicated
+/// points and shared Morton codes.
+static core::Tensor RandomGridPoints(int64_t n, std::mt19937 &rng) {
+    std::uniform_int_distribution<int> dist(-20, 20);
+    std::vector<double> values(n * 3);
+    for (double &v : values) {
+        v = dist(rng) * 0.05;
+    }
+    return core::Tensor(values, {n, 3}, core::Float64);
+}
+
+/// Sorted (squared distance, index) pairs of all points.
+static std::vector<std::pair<double, int>> BruteForceNeighbors(
+        const core::Tensor &points, const double *query) {
+    const double *points_ptr = points.GetDataPtr<double>();
+    std::vector<std::pair<double, int>> neighbors;
+    for (int64_t i = 0; i < points.GetLength(); ++i) {
+        double d = 0;
+        for (int c = 0; c < 3; ++c) {
+            double diff = points_ptr[3 * i + c] - query[c];
+            d += diff * diff;
+        }
+        neighbors.emplace_back(d, static_cast<int>(i));
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+TEST_P(LBVHIndexPermuteDevices, SearchKnn) {
+    core::Device device = GetParam();
+    std::mt19937 rng(0);
+    core::Tensor points = RandomGridPoints(3000, rng);
+    core::Tensor query_points = RandomGridPoints(100, rng).Mul(1.2);
+
+    core::nns::LBVHIndex index(points.To(device));
+    EXPECT_THROW(index.SearchKnn(query_points.To(device), 0),
+                 std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query_points.To(device, core::Float32), 3),
+                 std::runtime_error);
+
+    const int knn = 10;
+    core::Tensor indices, distances;
+    std::tie(indices, distances) =
+            index.SearchKnn(query_points.To(device), knn);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({100, knn}));
+    indices = indices.To(core::Device("CPU:0"));
+    distances = distances.To(core::Device("CPU:0"));
+
+    const double *query_ptr = query_points.GetDataPtr<double>();
+    for (int64_t i = 0; i < 100; ++i) {
+        std::vector<std::pair<double, int>> gt =
+                BruteForceNeighbors(points, query_ptr + 3 * i);
+        for (int k = 0; k < knn; ++k) {
+            // Ties make the indices ambiguous, the distances are not.
+            EXPECT_NEAR(distances[i][k].Item<double>(), gt[k].first, 1e-12);
+            int idx = indices[i][k].Item<int32_t>();
+            EXPECT_NEAR(BruteForceNeighbors(points.Slice(0, idx, idx + 1),
+                                            query_ptr + 3 * i)[0]
+                                .first,
+                        gt[k].first, 1e-12);
+        }
+    }
+
+    // Fewer points than knn.
+    core::nns::LBVHIndex small_index(points.Slice(0, 0, 1).To(device));
+    std::tie(indices, distances) =
+            small_index.SearchKnn(query_points.To(device), knn);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({100, 1}));
+    EXPECT_TRUE(indices.To(core::Device("CPU:0"))
+                        .AllEqual(core::Tensor::Zeros({100, 1}, core::Int32)));
+}
+
+TEST_P(LBVHIndexPermuteDevices, SearchRadiusHybrid) {
+    core::Device device = GetParam();
+    std::mt19937 rng(1);
+    core::Tensor points = RandomGridPoints(3000, rng);
+    core::Tensor query_points = RandomGridPoints(100, rng);
+    const double radius = 0.12;
+    const int max_knn = 6;
+
+    core::nns::LBVHIndex index(points.To(device));
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            index.SearchRadius(query_points.To(device), radius);
+    indices = indices.To(core::Device("CPU:0"));
+    distances = distances.To(core::Device("CPU:0"));
+    row_splits = row_splits.To(core::Device("CPU:0"));
+
+    core::Tensor hybrid_indices, hybrid_distances, counts;
+    std::tie(hybrid_indices, hybrid_distances, counts) =
+            index.SearchHybrid(query_points.To(device), radius, max_knn);
+    hybrid_indices = hybrid_indices.To(core::Device("CPU:0"));
+    hybrid_distances = hybrid_distances.To(core::Device("CPU:0"));
+    counts = counts.To(core::Device("CPU:0"));
+
+    const double *query_ptr = query_points.GetDataPtr<double>();
+    for (int64_t i = 0; i < 100; ++i) {
+        std::vector<std::pair<double, int>> gt =
+                BruteForceNeighbors(points, query_ptr + 3 * i);
+        int64_t num_in_radius = std::count_if(
+                gt.begin(), gt.end(), [&](const std::pair<double, int> &n) {
+                    return n.first < radius * radius;
+                });
+
+        int64_t begin = row_splits[i].Item<int64_t>();
+        ASSERT_EQ(row_splits[i + 1].Item<int64_t>() - begin, num_in_radius);
+        std::vector<int> found;
+        for (int64_t k = 0; k < num_in_radius; ++k) {
+            EXPECT_NEAR(distances[begin + k].Item<double>(), gt[k].first,
+                        1e-12);
+            found.push_back(indices[begin + k].Item<int32_t>());
+        }
+        std::vector<int> expected;
+        for (int64_t k = 0; k < num_in_radius; ++k) {
+            expected.push_back(gt[k].second);
+        }
+        std::sort(found.begin(), found.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(found, expected);
+
+        int64_t count = std::min<int64_t>(num_in_radius, max_knn);
+        EXPECT_EQ(counts[i].Item<int32_t>(), count);
+        for (int k = 0; k < max_knn; ++k) {
+            if (k < count) {
+                EXPECT_NEAR(hybrid_distances[i][k].Item<double>(),
+                            gt[k].first, 1e-12);
+            } else {
+                EXPECT_EQ(hybrid_indices[i][k].Item<int32_t>(), -1);
+            }
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,8 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
@@ -33,6 +35,10 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/ConjugateGradient.h"
+#include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/linalg/SparseMatrix.h"
 #include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/utility/Helper.h"
 #include "tests/Tests.h"
@@ -46,6 +52,20 @@ INSTANTIATE_TEST_SUITE_P(Linalg,
                          LinalgPermuteDevices,
                          testing::ValuesIn(PermuteDevices::TestCases()));
 
+/// Random values in [-1, 1] of the given shape.
+static core::Tensor RandomTensor(const core::SizeVector& shape,
+                                 core::Dtype dtype,
+                                 const core::Device& device,
+                                 unsigned int seed = 0) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-1, 1);
+    std::vector<double> values(shape.NumElements());
+    for (double& value : values) {
+        value = dist(rng);
+    }
+    return core::Tensor(values, shape, core::Float64, device).To(dtype);
+}
+
 TEST_P(LinalgPermuteDevices, Matmul) {
     const float EPSILON = 1e-8;
 
@@ -89,6 +109,94 @@ TEST_P(LinalgPermuteDevices, Matmul) {
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({2, 4}, dtype)));
 }
 
+TEST_P(LinalgPermuteDevices, MatmulHalf) {
+    core::Device device = GetParam();
+
+    core::Tensor A = RandomTensor({17, 33}, core::Float32, device, 1);
+    core::Tensor B = RandomTensor({33, 9}, core::Float32, device, 2);
+    for (core::Dtype dtype : {core::Float16, core::BFloat16}) {
+        // Round the inputs first, so that only the accumulation differs from
+        // the Float32 result.
+        core::Tensor A_half = A.To(dtype);
+        core::Tensor B_half = B.To(dtype);
+        core::Tensor C_gt =
+                A_half.To(core::Float32).Matmul(B_half.To(core::Float32));
+
+        core::Tensor C = A_half.Matmul(B_half);
+        EXPECT_EQ(C.GetDtype(), dtype);
+        EXPECT_EQ(C.GetShape(), core::SizeVector({17, 9}));
+        const double tol = dtype == core::Float16 ? 1e-2 : 5e-2;
+        EXPECT_TRUE(C.To(core::Float32).AllClose(C_gt, tol, tol));
+    }
+}
+
+TEST_P(LinalgPermuteDevices, BatchedMatmul) {
+    core::Device device = GetParam();
+
+    // Many point sets by many poses.
+    core::Tensor poses = RandomTensor({2, 3, 4, 4}, core::Float32, device, 1);
+    core::Tensor points = RandomTensor({2, 3, 4, 10}, core::Float32, device, 2);
+    core::Tensor output;
+    core::BatchedMatmul(poses, points, output);
+    EXPECT_EQ(output.GetShape(), core::SizeVector({2, 3, 4, 10}));
+    for (int64_t i = 0; i < 2; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            EXPECT_TRUE(output[i][j].AllClose(
+                    poses[i][j].Matmul(points[i][j]), 1e-5, 1e-5));
+        }
+    }
+
+    // One pose shared by all point sets, and the other way around.
+    core::Tensor pose = poses[0][0];
+    core::BatchedMatmul(pose, points, output);
+    EXPECT_EQ(output.GetShape(), core::SizeVector({2, 3, 4, 10}));
+    EXPECT_TRUE(output[1][2].AllClose(pose.Matmul(points[1][2]), 1e-5, 1e-5));
+    core::BatchedMatmul(poses, points[1][2], output);
+    EXPECT_EQ(output.GetShape(), core::SizeVector({2, 3, 4, 10}));
+    EXPECT_TRUE(output[1][0].AllClose(poses[1][0].Matmul(points[1][2]), 1e-5,
+                                      1e-5));
+
+    // Broadcast batch dimensions on both sides and non-float dtypes.
+    core::Tensor A = core::Tensor::Init<int32_t>({{{1, 2}, {3, 4}}}, device);
+    core::Tensor B =
+            core::Tensor::Init<int32_t>({{{1, 0}, {0, 1}}, {{0, 1}, {1, 0}}},
+                                        device)
+                    .Reshape({2, 1, 2, 2});
+    core::BatchedMatmul(A.Expand({1, 3, 2, 2}), B, output);
+    EXPECT_EQ(output.GetDtype(), core::Int32);
+    EXPECT_EQ(output.GetShape(), core::SizeVector({2, 3, 2, 2}));
+    EXPECT_EQ(output[0][2].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({1, 2, 3, 4}));
+    EXPECT_EQ(output[1][1].ToFlatVector<int32_t>(),
+              std::vector<int32_t>({2, 1, 4, 3}));
+
+    // Half precision.
+    core::Tensor output_half;
+    core::BatchedMatmul(poses.To(core::Float16), points.To(core::Float16),
+                        output_half);
+    EXPECT_EQ(output_half.GetDtype(), core::Float16);
+    core::BatchedMatmul(poses, points, output);
+    EXPECT_TRUE(output_half.To(core::Float32).AllClose(output, 1e-2, 1e-2));
+
+    // Empty inputs.
+    core::BatchedMatmul(core::Tensor::Ones({0, 4, 4}, core::Float32, device),
+                        points[0][0], output);
+    EXPECT_EQ(output.GetShape(), core::SizeVector({0, 4, 10}));
+    core::BatchedMatmul(core::Tensor::Ones({2, 4, 0}, core::Float32, device),
+                        core::Tensor::Ones({0, 5}, core::Float32, device),
+                        output);
+    EXPECT_TRUE(output.AllClose(
+            core::Tensor::Zeros({2, 4, 5}, core::Float32, device)));
+
+    // Shape test.
+    EXPECT_ANY_THROW(core::BatchedMatmul(poses, poses[0][0][0], output));
+    EXPECT_ANY_THROW(
+            core::BatchedMatmul(poses, points.Slice(2, 0, 3), output));
+    EXPECT_ANY_THROW(core::BatchedMatmul(
+            poses, core::Tensor::Ones({4, 4, 4, 4}, core::Float32, device),
+            output));
+}
+
 TEST_P(LinalgPermuteDevices, LU) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Float32;
@@ -516,5 +624,282 @@ TEST_P(LinalgPermuteDevices, KernelOps) {
     EXPECT_TRUE(output3x1.AllClose(Solve_Expected));
 }
 
+TEST_P(LinalgPermuteDevices, BatchedSolve) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float32, core::Float64}) {
+        const double tol = dtype == core::Float32 ? 1e-3 : 1e-9;
+        for (int64_t n : {3, 4, 6}) {
+            core::Tensor A = RandomTensor({2, 5, n, n}, dtype, device, n);
+            core::Tensor B = RandomTensor({2, 5, n, 2}, dtype, device, n + 1);
+            core::Tensor b = B.Slice(3, 0, 1).Reshape({2, 5, n});
+
+            core::Tensor X, x;
+            core::BatchedSolve(A, B, X);
+            core::BatchedSolve(A, b, x);
+            EXPECT_EQ(X.GetShape(), B.GetShape());
+            EXPECT_EQ(x.GetShape(), b.GetShape());
+
+            core::Tensor A_flat = A.Reshape({10, n, n});
+            core::Tensor B_flat = B.Reshape({10, n, 2});
+            core::Tensor X_flat = X.Reshape({10, n, 2});
+            for (int64_t i = 0; i < 10; ++i) {
+                EXPECT_TRUE(A_flat[i].Matmul(X_flat[i]).AllClose(B_flat[i],
+                                                                  tol, tol));
+            }
+            EXPECT_TRUE(x.AllClose(X.Slice(3, 0, 1).Reshape({2, 5, n}), tol,
+                                   tol));
+        }
+    }
+
+    // A zero leading entry requires pivoting.
+    core::Tensor A = core::Tensor::Init<double>(
+            {{{0, 1, 0}, {1, 0, 0}, {0, 0, 2}}}, device);
+    core::Tensor B = core::Tensor::Init<double>({{1, 2, 3}}, device);
+    core::Tensor X;
+    core::BatchedSolve(A, B, X);
+    EXPECT_TRUE(X.AllClose(core::Tensor::Init<double>({{2, 1, 1.5}}, device)));
+
+    // Empty batch.
+    core::BatchedSolve(core::Tensor::Zeros({0, 3, 3}, core::Float32, device),
+                       core::Tensor::Zeros({0, 3}, core::Float32, device), X);
+    EXPECT_EQ(X.GetShape(), core::SizeVector({0, 3}));
+
+    // Shape test.
+    core::Tensor A_5x5 = core::Tensor::Ones({2, 5, 5}, core::Float64, device);
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            A_5x5, core::Tensor::Ones({2, 5}, core::Float64, device), X));
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            A, core::Tensor::Ones({2, 3}, core::Float64, device), X));
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            A, core::Tensor::Ones({1, 3}, core::Float32, device), X));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedInverse) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float32, core::Float64}) {
+        const double tol = dtype == core::Float32 ? 1e-3 : 1e-9;
+        for (int64_t n : {3, 4, 6}) {
+            core::Tensor A = RandomTensor({7, n, n}, dtype, device, n);
+            core::Tensor A_inv;
+            core::BatchedInverse(A, A_inv);
+            EXPECT_EQ(A_inv.GetShape(), A.GetShape());
+
+            core::Tensor I = core::Tensor::Eye(n, dtype, device);
+            for (int64_t i = 0; i < 7; ++i) {
+                EXPECT_TRUE(A[i].Matmul(A_inv[i]).AllClose(I, tol, tol));
+            }
+        }
+    }
+
+    // Single matrix and non-contiguous input.
+    core::Tensor A = core::Tensor::Init<float>(
+            {{2, 3, 1}, {3, 3, 1}, {2, 4, 1}}, device);
+    core::Tensor A_inv;
+    core::BatchedInverse(A.T().T(), A_inv);
+    EXPECT_TRUE(A_inv.AllClose(core::Tensor::Init<float>(
+                                       {{-1, 1, 0}, {-1, 0, 1}, {6, -2, -3}},
+                                       device),
+                               1e-5, 1e-5));
+
+    // Shape test.
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({3}, core::Float32, device), A_inv));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 3, 4}, core::Float32, device), A_inv));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 2, 2}, core::Float32, device), A_inv));
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Ones({2, 3, 3}, core::Int32, device), A_inv));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSVD3x3) {
+    core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float32, core::Float64}) {
+        const double tol = dtype == core::Float32 ? 1e-4 : 1e-8;
+        core::Tensor A = RandomTensor({4, 5, 3, 3}, dtype, device);
+        core::Tensor U, S, VT;
+        core::BatchedSVD3x3(A, U, S, VT);
+        EXPECT_EQ(U.GetShape(), core::SizeVector({4, 5, 3, 3}));
+        EXPECT_EQ(S.GetShape(), core::SizeVector({4, 5, 3}));
+        EXPECT_EQ(VT.GetShape(), core::SizeVector({4, 5, 3, 3}));
+
+        core::Tensor A_flat = A.Reshape({20, 3, 3});
+        core::Tensor U_flat = U.Reshape({20, 3, 3});
+        core::Tensor S_flat = S.Reshape({20, 3});
+        core::Tensor VT_flat = VT.Reshape({20, 3, 3});
+        core::Tensor I = core::Tensor::Eye(3, dtype, device);
+        bool has_negative_det = false;
+        for (int64_t i = 0; i < 20; ++i) {
+            core::Tensor USVT = U_flat[i].Matmul(
+                    core::Tensor::Diag(S_flat[i]).Matmul(VT_flat[i]));
+            EXPECT_TRUE(USVT.AllClose(A_flat[i], tol, tol));
+            EXPECT_TRUE(U_flat[i].Matmul(U_flat[i].T()).AllClose(I, tol, tol));
+            EXPECT_TRUE(
+                    VT_flat[i].Matmul(VT_flat[i].T()).AllClose(I, tol, tol));
+
+            std::vector<double> s =
+                    S_flat[i].To(core::Float64).ToFlatVector<double>();
+            EXPECT_GE(s[0], s[1]);
+            EXPECT_GE(s[1], s[2]);
+            EXPECT_GE(s[2], 0);
+            std::vector<double> a =
+                    A_flat[i].To(core::Float64).ToFlatVector<double>();
+            has_negative_det = has_negative_det ||
+                               core::linalg::kernel::det3x3(a.data()) < 0;
+        }
+        EXPECT_TRUE(has_negative_det);
+    }
+
+    core::Tensor U, S, VT;
+    EXPECT_ANY_THROW(core::BatchedSVD3x3(
+            core::Tensor::Ones({2, 4, 4}, core::Float32, device), U, S, VT));
+}
+
+/// Tridiagonal SPD matrix 2.1 on the diagonal and -1 off the diagonal, in
+/// shuffled COO form with every diagonal entry split into two duplicates.
+static core::SparseMatrix TridiagonalSparseMatrix(int64_t n,
+                                                  core::Dtype dtype,
+                                                  const core::Device& device) {
+    std::vector<int64_t> rows, cols;
+    std::vector<double> values;
+    for (int64_t i = 0; i < n; ++i) {
+        for (int k = 0; k < 2; ++k) {
+            rows.push_back(i);
+            cols.push_back(i);
+            values.push_back(1.05);
+        }
+        if (i + 1 < n) {
+            rows.insert(rows.end(), {i, i + 1});
+            cols.insert(cols.end(), {i + 1, i});
+            values.insert(values.end(), {-1.0, -1.0});
+        }
+    }
+    std::vector<int64_t> order(values.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = static_cast<int64_t>(i);
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(0));
+    const int64_t nnz = static_cast<int64_t>(order.size());
+    core::Tensor order_t(order, {nnz}, core::Int64);
+    core::Tensor rows_t =
+            core::Tensor(rows, {nnz}, core::Int64).IndexGet({order_t});
+    core::Tensor cols_t =
+            core::Tensor(cols, {nnz}, core::Int64).IndexGet({order_t});
+    core::Tensor values_t = core::Tensor(values, {nnz}, core::Float64)
+                                    .IndexGet({order_t})
+                                    .To(dtype);
+    return core::SparseMatrix::FromCOO(rows_t.To(device), cols_t.To(device),
+                                       values_t.To(device), n, n);
+}
+
+TEST_P(LinalgPermuteDevices, SparseMatrix) {
+    const core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float32, core::Float64}) {
+        const int64_t n = 20;
+        core::SparseMatrix A = TridiagonalSparseMatrix(n, dtype, device);
+        EXPECT_EQ(A.GetNumRows(), n);
+        EXPECT_EQ(A.GetNumCols(), n);
+        EXPECT_EQ(A.GetNNZ(), 3 * n - 2);
+        EXPECT_EQ(A.GetDtype(), dtype);
+        EXPECT_EQ(A.GetDevice(), device);
+
+        std::vector<int64_t> row_offsets =
+                A.GetRowOffsets().ToFlatVector<int64_t>();
+        EXPECT_EQ(row_offsets.front(), 0);
+        EXPECT_EQ(row_offsets[1], 2);
+        EXPECT_EQ(row_offsets.back(), 3 * n - 2);
+        std::vector<int64_t> col_indices =
+                A.GetColIndices().ToFlatVector<int64_t>();
+        EXPECT_EQ(std::vector<int64_t>(col_indices.begin(),
+                                       col_indices.begin() + 5),
+                  std::vector<int64_t>({0, 1, 0, 1, 2}));
+
+        core::Tensor dense = A.ToDense();
+        EXPECT_TRUE(A.Diagonal().AllClose(
+                core::Tensor::Full({n}, 2.1, dtype, device)));
+        EXPECT_TRUE(dense.AllClose(
+                core::SparseMatrix::FromDense(dense).ToDense()));
+        EXPECT_EQ(core::SparseMatrix::FromDense(dense).GetNNZ(), 3 * n - 2);
+
+        core::Tensor x = RandomTensor({n}, dtype, device);
+        EXPECT_TRUE(A.SpMV(x).AllClose(
+                dense.Matmul(x.Reshape({n, 1})).Reshape({n}), 1e-5, 1e-5));
+        core::Tensor X = RandomTensor({n, 3}, dtype, device, 1);
+        EXPECT_TRUE(A.SpMV(X).AllClose(dense.Matmul(X), 1e-5, 1e-5));
+        EXPECT_TRUE(A.To(core::Device("CPU:0")).ToDense().AllClose(
+                dense.To(core::Device("CPU:0"))));
+    }
+
+    // Empty rows and an empty matrix.
+    core::Tensor empty_indices = core::Tensor::Empty({0}, core::Int64, device);
+    core::SparseMatrix empty = core::SparseMatrix::FromCOO(
+            empty_indices, empty_indices,
+            core::Tensor::Empty({0}, core::Float32, device), 3, 2);
+    EXPECT_EQ(empty.GetRowOffsets().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 0, 0, 0}));
+    EXPECT_TRUE(empty.ToDense().AllClose(
+            core::Tensor::Zeros({3, 2}, core::Float32, device)));
+    EXPECT_TRUE(empty.SpMV(core::Tensor::Ones({2}, core::Float32, device))
+                        .AllClose(core::Tensor::Zeros({3}, core::Float32,
+                                                      device)));
+
+    // Out of range indices and mismatched vectors are rejected.
+    core::Tensor indices = core::Tensor::Init<int64_t>({0, 3}, device);
+    core::Tensor values = core::Tensor::Ones({2}, core::Float32, device);
+    EXPECT_ANY_THROW(
+            core::SparseMatrix::FromCOO(indices, indices, values, 3, 3));
+    core::SparseMatrix A =
+            core::SparseMatrix::FromCOO(indices, indices, values, 4, 4);
+    EXPECT_ANY_THROW(A.SpMV(core::Tensor::Ones({3}, core::Float32, device)));
+    EXPECT_ANY_THROW(A.SpMV(core::Tensor::Ones({4}, core::Float64, device)));
+}
+
+TEST_P(LinalgPermuteDevices, SolveCG) {
+    const core::Device device = GetParam();
+
+    for (core::Dtype dtype : {core::Float32, core::Float64}) {
+        const int64_t n = 100;
+        const double tol = dtype == core::Float32 ? 1e-4 : 1e-8;
+        core::SparseMatrix A = TridiagonalSparseMatrix(n, dtype, device);
+        core::Tensor b = RandomTensor({n}, dtype, device);
+
+        for (bool use_jacobi_preconditioner : {true, false}) {
+            core::Tensor x = core::SolveCG(A, b, core::Tensor(), tol * 1e-2,
+                                           1000, use_jacobi_preconditioner);
+            EXPECT_EQ(x.GetShape(), core::SizeVector({n}));
+            EXPECT_TRUE(A.SpMV(x).AllClose(b, tol, tol));
+        }
+
+        // Starting from the solution returns immediately.
+        core::Tensor x = core::SolveCG(A, b);
+        EXPECT_TRUE(core::SolveCG(A, b, x, 1e-4, 0).AllClose(x));
+
+        EXPECT_TRUE(core::SolveCG(A, core::Tensor::Zeros({n}, dtype, device))
+                            .AllClose(core::Tensor::Zeros({n}, dtype,
+                                                          device)));
+        EXPECT_ANY_THROW(core::SolveCG(A, core::Tensor::Ones({n + 1}, dtype,
+                                                             device)));
+
+        // The same system given as an operator, with and without a
+        // preconditioner.
+        auto apply_A = [&A](const core::Tensor& v) { return A.SpMV(v); };
+        const core::Tensor inv_diagonal =
+                core::Tensor::Ones({n}, dtype, device).Div(A.Diagonal());
+        auto apply_jacobi = [&inv_diagonal](const core::Tensor& r) {
+            return r.Mul(inv_diagonal);
+        };
+        x = core::SolveCG(apply_A, b, core::Tensor(), tol * 1e-2, 1000,
+                          apply_jacobi);
+        EXPECT_TRUE(A.SpMV(x).AllClose(b, tol, tol));
+        x = core::SolveCG(apply_A, b, core::Tensor(), tol * 1e-2);
+        EXPECT_TRUE(A.SpMV(x).AllClose(b, tol, tol));
+        EXPECT_ANY_THROW(core::SolveCG(apply_A, b.Reshape({n, 1})));
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -26,9 +26,12 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <algorithm>
 #include <map>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/utility/CPUInfo.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -540,6 +543,157 @@ TEST(MemoryManagerPermuteDevices, CachedTooLargeAutoReleaseAll) {
     ExpectStatistic(dummy_mm, 3, 3, 0);
 }
 
+TEST(MemoryManagerPermuteDevices, CachedSizeClass) {
+    core::Device device = MakeDummyDevice();
+    auto dummy_mm = std::make_shared<DummyMemoryManager>(device);
+    auto cached_mm = std::make_shared<core::CachedMemoryManager>(dummy_mm);
+
+    core::CachedMemoryManager::ReleaseCache(device);
+    ExpectStatistic(dummy_mm, 0, 0, 0);
+
+    // Rounded up to 1 MiB + 256 KiB.
+    const size_t class_size = (1 << 20) + (1 << 18);
+    void* ptr = cached_mm->Malloc((1 << 20) + 1, device);
+    ExpectStatistic(dummy_mm, 1, 0, class_size);
+
+    cached_mm->Free(ptr, device);
+    ExpectStatistic(dummy_mm, 1, 0, class_size);
+
+    // Same size class, no split and no new allocation.
+    void* ptr2 = cached_mm->Malloc((1 << 20) + 200000, device);
+    ExpectStatistic(dummy_mm, 1, 0, class_size);
+    EXPECT_EQ(ptr2, ptr);
+    EXPECT_EQ(core::CachedMemoryManager::GetStatistics(device).num_free_blocks_,
+              0);
+
+    cached_mm->Free(ptr2, device);
+    core::CachedMemoryManager::ReleaseCache(device);
+    ExpectStatistic(dummy_mm, 1, 1, 0);
+}
+
+TEST(MemoryManagerPermuteDevices, CachedStatistics) {
+    core::Device device = MakeDummyDevice();
+    auto dummy_mm = std::make_shared<DummyMemoryManager>(device);
+    auto cached_mm = std::make_shared<core::CachedMemoryManager>(dummy_mm);
+
+    core::CachedMemoryManager::ReleaseCache(device);
+    core::CachedMemoryManager::ResetPeakStatistics(device);
+    core::CachedMemoryStatistics stats =
+            core::CachedMemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.reserved_bytes_, 0);
+    EXPECT_EQ(stats.peak_reserved_bytes_, 0);
+    EXPECT_EQ(stats.GetFragmentation(), 0.0);
+    const size_t num_hits = stats.num_cache_hits_;
+    const size_t num_misses = stats.num_cache_misses_;
+
+    void* ptr = cached_mm->Malloc(100, device);
+    void* ptr2 = cached_mm->Malloc(200, device);
+    stats = core::CachedMemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.reserved_bytes_, 304);
+    EXPECT_EQ(stats.allocated_bytes_, 304);
+    EXPECT_EQ(stats.free_bytes_, 0);
+    EXPECT_EQ(stats.num_real_blocks_, 2);
+
+    cached_mm->Free(ptr, device);
+    stats = core::CachedMemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.allocated_bytes_, 200);
+    EXPECT_EQ(stats.free_bytes_, 104);
+    EXPECT_EQ(stats.largest_free_block_bytes_, 104);
+    EXPECT_EQ(stats.GetFragmentation(), 0.0);
+
+    cached_mm->Free(ptr2, device);
+    stats = core::CachedMemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.allocated_bytes_, 0);
+    EXPECT_EQ(stats.peak_allocated_bytes_, 304);
+    EXPECT_EQ(stats.num_free_blocks_, 2);
+    EXPECT_DOUBLE_EQ(stats.GetFragmentation(), 1.0 - 200.0 / 304.0);
+
+    void* ptr3 = cached_mm->Malloc(100, device);
+    cached_mm->Free(ptr3, device);
+    stats = core::CachedMemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.num_cache_hits_, num_hits + 1);
+    EXPECT_EQ(stats.num_cache_misses_, num_misses + 2);
+    EXPECT_GT(stats.GetHitRate(), 0.0);
+
+    core::CachedMemoryManager::ReleaseCache(device);
+    stats = core::CachedMemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.reserved_bytes_, 0);
+    EXPECT_EQ(stats.peak_reserved_bytes_, 304);
+
+    core::CachedMemoryManager::ResetPeakStatistics(device);
+    stats = core::CachedMemoryManager::GetStatistics(device);
+    EXPECT_EQ(stats.peak_reserved_bytes_, 0);
+    EXPECT_EQ(stats.peak_allocated_bytes_, 0);
+    ExpectStatistic(dummy_mm, 2, 2, 0);
+}
+
+TEST(MemoryManagerPermuteDevices, CachedReservedLimit) {
+    core::Device device = MakeDummyDevice();
+    auto dummy_mm = std::make_shared<DummyMemoryManager>(device);
+    auto cached_mm = std::make_shared<core::CachedMemoryManager>(dummy_mm);
+
+    core::CachedMemoryManager::ReleaseCache(device);
+    core::CachedMemoryManager::SetReservedLimit(device, 8192);
+    ExpectStatistic(dummy_mm, 0, 0, 0);
+
+    void* ptr = cached_mm->Malloc(4096, device);
+    cached_mm->Free(ptr, device);
+    ExpectStatistic(dummy_mm, 1, 0, 4096);
+
+    // The cached block is released to stay within the limit.
+    void* ptr2 = cached_mm->Malloc(6144, device);
+    ExpectStatistic(dummy_mm, 2, 1, 6144);
+
+    EXPECT_THROW(cached_mm->Malloc(4096, device), std::runtime_error);
+    ExpectStatistic(dummy_mm, 2, 1, 6144);
+
+    cached_mm->Free(ptr2, device);
+    core::CachedMemoryManager::SetReservedLimit(
+            device, std::numeric_limits<size_t>::max());
+    core::CachedMemoryManager::ReleaseCache(device);
+    ExpectStatistic(dummy_mm, 2, 2, 0);
+}
+
+TEST_P(MemoryManagerPermuteDevices, PeakAllocatedBytes) {
+    core::Device device = GetParam();
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+
+    const size_t allocated_bytes = statistic.GetAllocatedBytes(device);
+    void* ptr = core::MemoryManager::Malloc(1000, device);
+    EXPECT_EQ(statistic.GetAllocatedBytes(device), allocated_bytes + 1000);
+    EXPECT_GE(statistic.GetPeakAllocatedBytes(device), allocated_bytes + 1000);
+
+    core::MemoryManager::Free(ptr, device);
+    EXPECT_EQ(statistic.GetAllocatedBytes(device), allocated_bytes);
+}
+
+TEST(MemoryManagerPermuteDevices, CPUNumaPolicy) {
+    const core::Device device("CPU:0");
+    const int num_nodes = utility::CPUInfo::GetInstance().NumNumaNodes();
+    EXPECT_EQ(core::CPUMemoryManager::GetNumaPolicy(),
+              core::NumaPolicy::FirstTouch);
+
+    for (core::NumaPolicy policy :
+         {core::NumaPolicy::Local, core::NumaPolicy::Interleave,
+          core::NumaPolicy::Bind, core::NumaPolicy::FirstTouch}) {
+        core::CPUMemoryManager::SetNumaPolicy(policy, num_nodes - 1);
+        EXPECT_EQ(core::CPUMemoryManager::GetNumaPolicy(), policy);
+        for (size_t byte_size : {0, 100, 1 << 20}) {
+            uint8_t* ptr = static_cast<uint8_t*>(
+                    core::MemoryManager::Malloc(byte_size, device));
+            std::fill(ptr, ptr + byte_size, 1);
+            core::MemoryManager::Free(ptr, device);
+        }
+    }
+    EXPECT_EQ(core::CPUMemoryManager::GetNumaNode(), num_nodes - 1);
+
+    EXPECT_ANY_THROW(core::CPUMemoryManager::SetNumaPolicy(
+            core::NumaPolicy::Bind, num_nodes));
+    EXPECT_EQ(core::CPUMemoryManager::GetNumaPolicy(),
+              core::NumaPolicy::FirstTouch);
+}
+
 // This must be the last test for core::CachedMemoryManager.
 TEST(MemoryManagerPermuteDevices, CachedFreeOnProgramEnd) {
     core::Device device = MakeDummyDevice();
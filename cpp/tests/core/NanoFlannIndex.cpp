@@ -27,6 +27,7 @@
 #include "open3d/core/nns/NanoFlannIndex.h"
 
 #include <cmath>
+#include <cstdio>
 #include <limits>
 
 #include "core/CoreTest.h"
@@ -99,6 +100,155 @@ TEST(NanoFlannIndex, SearchKnn) {
     EXPECT_TRUE(distances.AllClose(gt_distances));
 }
 
+TEST(NanoFlannIndex, SearchKnnApproximate) {
+    core::Device device = core::Device("CPU:0");
+    core::Tensor dataset_points =
+            core::Tensor::Init<double>({{0.0, 0.0, 0.0},
+                                        {0.0, 0.0, 0.1},
+                                        {0.0, 0.0, 0.2},
+                                        {0.0, 0.1, 0.0},
+                                        {0.0, 0.1, 0.1},
+                                        {0.0, 0.1, 0.2},
+                                        {0.0, 0.2, 0.0},
+                                        {0.0, 0.2, 0.1},
+                                        {0.0, 0.2, 0.2},
+                                        {0.1, 0.0, 0.0}},
+                                       device);
+    core::Tensor query_points = core::Tensor::Init<double>(
+            {{0.064705, 0.043921, 0.087843}}, device);
+    core::nns::NanoFlannIndex index(dataset_points);
+
+    EXPECT_THROW(index.SearchKnn(query_points, 3, -1.0), std::runtime_error);
+
+    // eps == 0 is exact search.
+    core::Tensor gt_indices, gt_distances, indices, distances;
+    std::tie(gt_indices, gt_distances) = index.SearchKnn(query_points, 3);
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3, 0.0);
+    EXPECT_TRUE(indices.AllClose(gt_indices));
+    EXPECT_TRUE(distances.AllClose(gt_distances));
+
+    // Approximate neighbors are never closer than the exact ones.
+    std::tie(indices, distances) = index.SearchKnn(query_points, 3, 1.0);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 3}));
+    EXPECT_TRUE(distances.Ge(gt_distances).All());
+}
+
+TEST(NanoFlannIndex, SearchKnnManyQueries) {
+    // Batched queries are processed in a spatially coherent order internally,
+    // but must be returned in the input order.
+    core::Device device = core::Device("CPU:0");
+    std::vector<double> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back((i * 7919 % 1000) / 1000.0);
+        values.push_back((i * 104729 % 1000) / 1000.0);
+        values.push_back((i * 1299709 % 1000) / 1000.0);
+    }
+    core::Tensor dataset_points(values, {1000, 3}, core::Float64, device);
+    core::Tensor query_points =
+            dataset_points.Slice(0, 0, 1000, 7).Add(0.001).Contiguous();
+    core::nns::NanoFlannIndex index(dataset_points);
+
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = index.SearchKnn(query_points, 4);
+    for (int64_t i = 0; i < query_points.GetLength(); ++i) {
+        core::Tensor gt_indices, gt_distances;
+        std::tie(gt_indices, gt_distances) =
+                index.SearchKnn(query_points.Slice(0, i, i + 1), 4);
+        EXPECT_TRUE(indices.Slice(0, i, i + 1).AllClose(gt_indices));
+        EXPECT_TRUE(distances.Slice(0, i, i + 1).AllClose(gt_distances));
+    }
+}
+
+TEST(NanoFlannIndex, SearchLargeDataset) {
+    // Large enough to be split into subtrees that are built in parallel.
+    const int64_t num_points = 1 << 18;
+    std::vector<float> values(num_points * 3);
+    uint32_t state = 1;
+    for (float &v : values) {
+        state = state * 1664525u + 1013904223u;
+        v = static_cast<float>(state >> 8) / static_cast<float>(1 << 24);
+    }
+    core::Tensor dataset_points(values, {num_points, 3}, core::Float32);
+    core::Tensor query_points = dataset_points.Slice(0, 0, num_points, 8191)
+                                        .Add(0.001f)
+                                        .Contiguous();
+    const int64_t num_queries = query_points.GetLength();
+
+    const int knn = 5;
+    const float radius = 0.01f;
+    core::nns::NanoFlannIndex index(dataset_points, /*leaf_size=*/32);
+    core::Tensor knn_indices, knn_distances;
+    std::tie(knn_indices, knn_distances) = index.SearchKnn(query_points, knn);
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            index.SearchRadius(query_points, radius);
+
+    for (int64_t i = 0; i < num_queries; ++i) {
+        core::Tensor gt_distances =
+                (dataset_points - query_points.Slice(0, i, i + 1))
+                        .Mul(dataset_points - query_points.Slice(0, i, i + 1))
+                        .Sum({1});
+        core::Tensor gt_order = gt_distances.Argsort();
+        EXPECT_TRUE(knn_distances.Slice(0, i, i + 1).Reshape({knn}).AllClose(
+                gt_distances.IndexGet({gt_order.Slice(0, 0, knn)})));
+
+        const int64_t gt_count = gt_distances.Lt(radius * radius)
+                                         .To(core::Int64)
+                                         .Sum({0})
+                                         .Item<int64_t>();
+        EXPECT_EQ(row_splits[i + 1].Item<int64_t>() -
+                          row_splits[i].Item<int64_t>(),
+                  gt_count);
+    }
+}
+
+TEST(NanoFlannIndex, SaveLoad) {
+    // Large enough to be split into more than one subtree.
+    const int64_t num_points = 1 << 17;
+    std::vector<double> values(num_points * 3);
+    uint32_t state = 7;
+    for (double &v : values) {
+        state = state * 1664525u + 1013904223u;
+        v = static_cast<double>(state >> 8) / static_cast<double>(1 << 24);
+    }
+    core::Tensor dataset_points(values, {num_points, 3}, core::Float64);
+    core::Tensor query_points = dataset_points.Slice(0, 0, num_points, 4099)
+                                        .Add(0.002)
+                                        .Contiguous();
+    const std::string file_name = "nanoflann_index.npz";
+
+    core::nns::NanoFlannIndex index(dataset_points);
+    index.Save(file_name);
+    core::Tensor gt_indices, gt_distances, gt_row_splits;
+    std::tie(gt_indices, gt_distances) = index.SearchKnn(query_points, 8);
+
+    for (bool use_mmap : {false, true}) {
+        core::nns::NanoFlannIndex loaded;
+        loaded.Load(file_name, use_mmap);
+        EXPECT_EQ(loaded.GetDatasetSize(), num_points);
+        EXPECT_EQ(loaded.GetDimension(), 3);
+        EXPECT_EQ(loaded.GetDtype(), core::Float64);
+
+        core::Tensor indices, distances, row_splits;
+        std::tie(indices, distances) = loaded.SearchKnn(query_points, 8);
+        EXPECT_TRUE(indices.AllClose(gt_indices));
+        EXPECT_TRUE(distances.AllClose(gt_distances));
+
+        std::tie(gt_indices, gt_distances, gt_row_splits) =
+                index.SearchRadius(query_points, 0.02);
+        std::tie(indices, distances, row_splits) =
+                loaded.SearchRadius(query_points, 0.02);
+        EXPECT_TRUE(indices.AllClose(gt_indices));
+        EXPECT_TRUE(distances.AllClose(gt_distances));
+        EXPECT_TRUE(row_splits.AllClose(gt_row_splits));
+        std::tie(gt_indices, gt_distances) = index.SearchKnn(query_points, 8);
+    }
+
+    core::nns::NanoFlannIndex empty;
+    EXPECT_THROW(empty.Save(file_name), std::runtime_error);
+    std::remove(file_name.c_str());
+}
+
 TEST(NanoFlannIndex, SearchRadius) {
     // Define test data.
     core::Device device = core::Device("CPU:0");
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/kernel/OpProfiler.h"
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class OpProfilerPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(OpProfiler,
+                         OpProfilerPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(OpProfilerPermuteDevices, Record) {
+    const core::Device device = GetParam();
+    core::kernel::OpProfiler& profiler =
+            core::kernel::OpProfiler::GetInstance();
+    profiler.Reset();
+
+    core::Tensor a = core::Tensor::Ones({100, 3}, core::Float32, device);
+    core::Tensor b = core::Tensor::Ones({3}, core::Float32, device);
+
+    // Disabled by default.
+    core::Tensor c = a + b;
+    EXPECT_TRUE(profiler.GetStatistics().empty());
+
+    profiler.SetEnabled(true);
+    c = a + b;
+    c = a + b;
+    c = c.Sum({0});
+    c = a.Matmul(core::Tensor::Ones({3, 2}, core::Float32, device));
+    profiler.SetEnabled(false);
+    c = a + b;
+
+    const std::vector<core::kernel::OpStatistics> statistics =
+            profiler.GetStatistics(/*group_by_shape=*/true);
+    auto find = [&](const std::string& op) {
+        for (const core::kernel::OpStatistics& stats : statistics) {
+            if (stats.op_ == op) {
+                return stats;
+            }
+        }
+        return core::kernel::OpStatistics();
+    };
+    const core::kernel::OpStatistics add = find("BinaryEW.Add");
+    EXPECT_EQ(add.count_, 2);
+    EXPECT_EQ(add.dtype_, "Float32");
+    EXPECT_EQ(add.device_, device.ToString());
+    EXPECT_EQ(add.shapes_, "[100, 3], [3] -> [100, 3]");
+    EXPECT_EQ(add.bytes_, 2 * (100 * 3 + 3 + 100 * 3) * 4);
+    EXPECT_GE(add.max_ms_, 0);
+    EXPECT_LE(add.max_ms_, add.total_ms_);
+
+    const core::kernel::OpStatistics sum = find("Reduction.Sum");
+    EXPECT_EQ(sum.count_, 1);
+    EXPECT_EQ(sum.shapes_, "[100, 3] -> [3]");
+
+    const core::kernel::OpStatistics matmul = find("Matmul");
+    EXPECT_EQ(matmul.count_, 1);
+    EXPECT_EQ(matmul.shapes_, "[100, 3], [3, 2] -> [100, 2]");
+
+    // Sorted by total time.
+    for (size_t i = 1; i < statistics.size(); ++i) {
+        EXPECT_GE(statistics[i - 1].total_ms_, statistics[i].total_ms_);
+    }
+    const std::string table = profiler.ToString();
+    EXPECT_NE(table.find("BinaryEW.Add"), std::string::npos);
+    EXPECT_NE(table.find("Matmul"), std::string::npos);
+
+    profiler.Reset();
+    EXPECT_TRUE(profiler.GetStatistics().empty());
+}
+
+TEST_P(OpProfilerPermuteDevices, IndexGetSet) {
+    const core::Device device = GetParam();
+    core::kernel::OpProfiler& profiler =
+            core::kernel::OpProfiler::GetInstance();
+    profiler.Reset();
+    profiler.SetEnabled(true);
+
+    core::Tensor src = core::Tensor::Ones({10, 3}, core::Float64, device);
+    core::Tensor index = core::Tensor::Init<int64_t>({0, 2, 4}, device);
+    core::Tensor dst = src.IndexGet({index});
+    src.IndexSet({index}, dst);
+    profiler.SetEnabled(false);
+
+    const std::vector<core::kernel::OpStatistics> statistics =
+            profiler.GetStatistics();
+    int64_t num_get = 0, num_set = 0;
+    for (const core::kernel::OpStatistics& stats : statistics) {
+        if (stats.op_ == "IndexGet") {
+            num_get += stats.count_;
+            EXPECT_EQ(stats.dtype_, "Float64");
+            EXPECT_TRUE(stats.shapes_.empty());
+        } else if (stats.op_ == "IndexSet") {
+            num_set += stats.count_;
+        }
+    }
+    EXPECT_EQ(num_get, 1);
+    EXPECT_EQ(num_set, 1);
+    profiler.Reset();
+}
+
+}  // namespace tests
+}  // namespace open3d
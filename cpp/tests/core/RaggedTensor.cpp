@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/core/RaggedTensor.h"
+
+#include <vector>
+
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class RaggedTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(RaggedTensor,
+                         RaggedTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(RaggedTensorPermuteDevices, Constructor) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor empty;
+    EXPECT_EQ(empty.GetNumRows(), 0);
+    EXPECT_EQ(empty.GetValues().GetLength(), 0);
+
+    core::Tensor values =
+            core::Tensor::Init<float>({{0, 0}, {1, 1}, {2, 2}}, device);
+    core::RaggedTensor rt(values,
+                          core::Tensor::Init<int64_t>({0, 2, 2, 3}, device));
+    EXPECT_EQ(rt.GetNumRows(), 3);
+    EXPECT_EQ(rt.GetDevice(), device);
+    EXPECT_EQ(rt.GetDtype(), core::Float32);
+    EXPECT_TRUE(rt.GetValues().IsSame(values));
+    EXPECT_TRUE(rt.GetRowLengths().AllEqual(
+            core::Tensor::Init<int64_t>({2, 0, 1}, device)));
+    EXPECT_TRUE(rt.GetValueRowIds().AllEqual(
+            core::Tensor::Init<int64_t>({0, 0, 2}, device)));
+    EXPECT_TRUE(rt[0].AllEqual(values.Slice(0, 0, 2)));
+    EXPECT_EQ(rt[1].GetLength(), 0);
+    EXPECT_TRUE(rt[-1].AllEqual(values.Slice(0, 2, 3)));
+    EXPECT_ANY_THROW(rt[3]);
+
+    core::RaggedTensor from_lengths = core::RaggedTensor::FromRowLengths(
+            values, core::Tensor::Init<int64_t>({2, 0, 1}, device));
+    EXPECT_TRUE(from_lengths.GetRowSplits().AllEqual(rt.GetRowSplits()));
+
+    // Invalid row splits.
+    EXPECT_ANY_THROW(core::RaggedTensor(
+            values, core::Tensor::Init<int64_t>({1, 2, 3}, device)));
+    EXPECT_ANY_THROW(core::RaggedTensor(
+            values, core::Tensor::Init<int64_t>({0, 2}, device)));
+    EXPECT_ANY_THROW(core::RaggedTensor(
+            values, core::Tensor::Init<int64_t>({0, 2, 1, 3}, device)));
+    EXPECT_ANY_THROW(core::RaggedTensor(
+            values, core::Tensor::Init<int32_t>({0, 3}, device)));
+    EXPECT_ANY_THROW(core::RaggedTensor::FromRowLengths(
+            values, core::Tensor::Init<int64_t>({1, 1}, device)));
+}
+
+TEST_P(RaggedTensorPermuteDevices, FromTensorsAndConcatenate) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<int32_t>({{0, 1}, {2, 3}}, device);
+    core::Tensor b = core::Tensor::Init<int32_t>({{4, 5}}, device);
+    core::RaggedTensor rt = core::RaggedTensor::FromTensors({a, b});
+    EXPECT_EQ(rt.GetNumRows(), 2);
+    EXPECT_TRUE(rt.GetRowSplits().AllEqual(
+            core::Tensor::Init<int64_t>({0, 2, 3}, device)));
+    std::vector<core::Tensor> tensors = rt.ToTensors();
+    ASSERT_EQ(tensors.size(), 2u);
+    EXPECT_TRUE(tensors[0].AllEqual(a));
+    EXPECT_TRUE(tensors[1].AllEqual(b));
+
+    core::RaggedTensor cat = core::RaggedTensor::Concatenate({rt, rt});
+    EXPECT_EQ(cat.GetNumRows(), 4);
+    EXPECT_TRUE(cat.GetRowSplits().AllEqual(
+            core::Tensor::Init<int64_t>({0, 2, 3, 5, 6}, device)));
+    EXPECT_TRUE(cat[3].AllEqual(b));
+
+    EXPECT_ANY_THROW(core::RaggedTensor::FromTensors({}));
+    EXPECT_ANY_THROW(core::RaggedTensor::FromTensors(
+            {a, core::Tensor::Init<float>({{4, 5}}, device)}));
+}
+
+TEST_P(RaggedTensorPermuteDevices, Gather) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor rt(core::Tensor::Init<float>({0, 1, 2, 3, 4}, device),
+                          core::Tensor::Init<int64_t>({0, 2, 2, 5}, device));
+
+    core::RaggedTensor gathered =
+            rt.Gather(core::Tensor::Init<int64_t>({2, 0, 1, 2}, device));
+    EXPECT_TRUE(gathered.GetRowSplits().AllEqual(
+            core::Tensor::Init<int64_t>({0, 3, 5, 5, 8}, device)));
+    EXPECT_TRUE(gathered.GetValues().AllEqual(
+            core::Tensor::Init<float>({2, 3, 4, 0, 1, 2, 3, 4}, device)));
+
+    core::RaggedTensor empty =
+            rt.Gather(core::Tensor::Init<int64_t>({1}, device));
+    EXPECT_EQ(empty.GetNumRows(), 1);
+    EXPECT_EQ(empty.GetValues().GetLength(), 0);
+}
+
+TEST_P(RaggedTensorPermuteDevices, RowReductions) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor rt(
+            core::Tensor::Init<float>({{1, 2}, {3, 4}, {5, 6}}, device),
+            core::Tensor::Init<int64_t>({0, 2, 2, 3}, device));
+    EXPECT_TRUE(rt.RowSum().AllClose(
+            core::Tensor::Init<float>({{4, 6}, {0, 0}, {5, 6}}, device)));
+    EXPECT_TRUE(rt.RowMean().AllClose(
+            core::Tensor::Init<float>({{2, 3}, {0, 0}, {5, 6}}, device)));
+    EXPECT_TRUE(rt.RowMax().AllClose(
+            core::Tensor::Init<float>({{3, 4}, {0, 0}, {5, 6}}, device)));
+    EXPECT_TRUE(rt.RowMin().AllClose(
+            core::Tensor::Init<float>({{1, 2}, {0, 0}, {5, 6}}, device)));
+}
+
+TEST_P(RaggedTensorPermuteDevices, ToAndClone) {
+    core::Device device = GetParam();
+
+    core::RaggedTensor rt(core::Tensor::Init<float>({0, 1, 2}, device),
+                          core::Tensor::Init<int64_t>({0, 1, 3}, device));
+    core::RaggedTensor same = rt.To(device);
+    EXPECT_TRUE(same.GetValues().IsSame(rt.GetValues()));
+
+    core::RaggedTensor clone = rt.Clone();
+    EXPECT_FALSE(clone.GetValues().IsSame(rt.GetValues()));
+    EXPECT_TRUE(clone.GetValues().AllEqual(rt.GetValues()));
+    EXPECT_TRUE(clone.GetRowSplits().AllEqual(rt.GetRowSplits()));
+
+    core::RaggedTensor host = rt.To(core::Device("CPU:0"));
+    EXPECT_EQ(host.GetDevice(), core::Device("CPU:0"));
+    EXPECT_TRUE(host.GetValues().AllEqual(
+            core::Tensor::Init<float>({0, 1, 2})));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/ScratchScope.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ScratchScopePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ScratchScope,
+                         ScratchScopePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ScratchScopePermuteDevices, Fallback) {
+    core::Device device = GetParam();
+
+    EXPECT_FALSE(core::ScratchScope::IsActive(device));
+    core::Tensor t = core::ScratchScope::Zeros({2, 3}, core::Float32, device);
+    EXPECT_TRUE(t.AllClose(core::Tensor::Zeros({2, 3}, core::Float32, device)));
+}
+
+TEST_P(ScratchScopePermuteDevices, Reuse) {
+    core::Device device = GetParam();
+
+    const void* first_ptr = nullptr;
+    for (int iter = 0; iter < 3; ++iter) {
+        core::ScratchScope scratch_scope(device);
+        EXPECT_TRUE(core::ScratchScope::IsActive(device));
+
+        core::Tensor a = core::ScratchScope::Zeros({29}, core::Float32, device);
+        core::Tensor b = core::ScratchScope::Empty({100}, core::Int64, device);
+        b.Fill(iter);
+        EXPECT_EQ(a.GetDevice(), device);
+        EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>(29, 0));
+        EXPECT_EQ(b.ToFlatVector<int64_t>(), std::vector<int64_t>(100, iter));
+
+        // Allocations are aligned and do not overlap.
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(a.GetDataPtr()) %
+                          core::ScratchScope::kAlignment,
+                  0);
+        EXPECT_GE(static_cast<const char*>(b.GetDataPtr()) -
+                          static_cast<const char*>(a.GetDataPtr()),
+                  29 * 4);
+
+        // The chunk of the first iteration is recycled.
+        if (iter == 0) {
+            first_ptr = a.GetDataPtr();
+        } else {
+            EXPECT_EQ(a.GetDataPtr(), first_ptr);
+        }
+    }
+    EXPECT_FALSE(core::ScratchScope::IsActive(device));
+    core::ScratchScope::ReleasePool();
+}
+
+TEST_P(ScratchScopePermuteDevices, Escape) {
+    core::Device device = GetParam();
+
+    core::Tensor escaped;
+    {
+        core::ScratchScope scratch_scope(device, /*chunk_byte_size=*/1024);
+        escaped = core::ScratchScope::Empty({4}, core::Int32, device);
+        escaped.Fill(7);
+
+        // Larger than a chunk.
+        core::Tensor large =
+                core::ScratchScope::Zeros({1000}, core::Float32, device);
+        EXPECT_EQ(large.ToFlatVector<float>(), std::vector<float>(1000, 0));
+    }
+    {
+        // The chunk of the escaped tensor must not be reused.
+        core::ScratchScope scratch_scope(device, /*chunk_byte_size=*/1024);
+        core::Tensor t = core::ScratchScope::Empty({4}, core::Int32, device);
+        t.Fill(1);
+        EXPECT_NE(t.GetDataPtr(), escaped.GetDataPtr());
+    }
+    EXPECT_EQ(escaped.ToFlatVector<int>(), std::vector<int>(4, 7));
+    core::ScratchScope::ReleasePool();
+
+    EXPECT_ANY_THROW(core::ScratchScope(device, 0));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Stream.h"
+
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class StreamPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Stream,
+                         StreamPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(StreamPermuteDevices, ScopedStream) {
+    core::Device device = GetParam();
+
+    core::Stream stream(device);
+    EXPECT_EQ(stream.GetDevice(), device);
+    EXPECT_TRUE(core::Stream::Default(device).IsDefault());
+
+    core::Tensor src = core::Tensor::Init<float>({0, 1, 2, 3, 4, 5}, device);
+    core::Tensor dst;
+    {
+        core::ScopedStream scoped_stream(stream);
+        if (device.GetType() == core::Device::DeviceType::CUDA) {
+            EXPECT_FALSE(core::Stream::Current(device).IsDefault());
+        }
+        dst = (src * 2).Reshape({2, 3});
+    }
+    stream.Synchronize();
+    EXPECT_TRUE(stream.Query());
+    EXPECT_TRUE(core::Stream::Current(device).IsDefault());
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 2, 4, 6, 8, 10}));
+}
+
+TEST_P(StreamPermuteDevices, Event) {
+    core::Device device = GetParam();
+
+    core::Stream stream(device);
+    core::Event start(device);
+    core::Event end(device);
+    EXPECT_ANY_THROW(start.ElapsedTime(end));
+
+    core::Tensor t = core::Tensor::Ones({100, 100}, core::Float32, device);
+    start.Record(stream);
+    {
+        core::ScopedStream scoped_stream(stream);
+        t = t + t;
+    }
+    end.Record(stream);
+
+    core::Stream::Default(device).WaitEvent(end);
+    end.Synchronize();
+    EXPECT_TRUE(end.Query());
+    EXPECT_GE(start.ElapsedTime(end), 0.f);
+    EXPECT_TRUE(t.AllClose(
+            core::Tensor::Full({100, 100}, 2, core::Float32, device)));
+}
+
+TEST_P(StreamPermuteDevices, MemcpyAsync) {
+    core::Device device = GetParam();
+    core::Device host("CPU:0");
+
+    core::Stream stream(device);
+    std::vector<int> src_vals = {1, 2, 3, 4};
+    std::vector<int> dst_vals(src_vals.size(), 0);
+    const size_t num_bytes = src_vals.size() * sizeof(int);
+
+    void* device_ptr = core::MemoryManager::Malloc(num_bytes, device);
+    core::MemoryManager::MemcpyAsync(device_ptr, device, src_vals.data(), host,
+                                     num_bytes, stream);
+    core::MemoryManager::MemcpyAsync(dst_vals.data(), host, device_ptr, device,
+                                     num_bytes, stream);
+    stream.Synchronize();
+    core::MemoryManager::Free(device_ptr, device);
+    EXPECT_EQ(dst_vals, src_vals);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,10 +26,12 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
 #include "open3d/core/AdvancedIndexing.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
@@ -370,6 +372,33 @@ TEST_P(TensorPermuteDevicePairs, ToDevice) {
     EXPECT_ANY_THROW(src_t.To(core::Device("CUDA:100000")));
 }
 
+TEST_P(TensorPermuteDevices, Pin) {
+    core::Device device = GetParam();
+
+    core::Tensor src_t =
+            core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor pinned_t = src_t.T().Pin();
+    EXPECT_EQ(pinned_t.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(pinned_t.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_TRUE(pinned_t.IsContiguous());
+    EXPECT_EQ(pinned_t.IsPinned(), core::cuda::IsAvailable());
+    EXPECT_TRUE(pinned_t.To(device).AllClose(src_t.T()));
+
+    core::Tensor empty_t = core::Tensor::EmptyPinned({0}, core::Float32);
+    EXPECT_EQ(empty_t.NumElements(), 0);
+
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        core::Tensor mapped_t = core::Tensor::EmptyPinned(
+                {2, 3}, core::Float32, /*mapped=*/true);
+        mapped_t.AsMappedDeviceTensor(device).Fill(2);
+        core::cuda::Synchronize(device);
+        EXPECT_EQ(mapped_t.ToFlatVector<float>(), std::vector<float>(6, 2));
+    } else {
+        EXPECT_ANY_THROW(pinned_t.AsMappedDeviceTensor(device));
+    }
+    EXPECT_ANY_THROW(src_t.AsMappedDeviceTensor(core::Device("CUDA:0")));
+}
+
 TEST_P(TensorPermuteDevicePairs, CopyBroadcast) {
     core::Device dst_device;
     core::Device src_device;
@@ -990,6 +1019,89 @@ TEST_P(TensorPermuteDevicePairs, CopyNonContiguous) {
     }
 }
 
+TEST_P(TensorPermuteDevicePairs, CopyStrided2D) {
+    core::Device dst_device;
+    core::Device src_device;
+    std::tie(dst_device, src_device) = GetParam();
+
+    // Large enough for several tiles and for rows copied with memcpy.
+    const int64_t rows = 45, cols = 70;
+    std::vector<int64_t> vals(rows * cols);
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        vals[i] = i % 128;
+    }
+    auto val = [&](int64_t row, int64_t col) { return vals[row * cols + col]; };
+
+    for (core::Dtype dtype :
+         {core::UInt8, core::Int16, core::Float32, core::Float64}) {
+        const core::Tensor t =
+                core::Tensor(vals, {rows, cols}, core::Int64, src_device)
+                        .To(dtype);
+        auto to_vector = [](const core::Tensor& tensor) {
+            return tensor.To(core::Device("CPU:0"), core::Int64)
+                    .ToFlatVector<int64_t>();
+        };
+
+        // Transpose.
+        std::vector<int64_t> expected;
+        for (int64_t col = 0; col < cols; ++col) {
+            for (int64_t row = 0; row < rows; ++row) {
+                expected.push_back(val(row, col));
+            }
+        }
+        core::Tensor t_copy = t.T().To(dst_device, /*copy=*/true);
+        EXPECT_TRUE(t_copy.IsContiguous());
+        EXPECT_EQ(t_copy.GetShape(), core::SizeVector({cols, rows}));
+        EXPECT_EQ(to_vector(t_copy), expected);
+
+        // Columns, a single column and a transposed block of columns.
+        expected.clear();
+        for (int64_t row = 0; row < rows; ++row) {
+            for (int64_t col = 1; col < cols - 1; ++col) {
+                expected.push_back(val(row, col));
+            }
+        }
+        EXPECT_EQ(to_vector(t.Slice(1, 1, cols - 1).To(dst_device, true)),
+                  expected);
+        expected.clear();
+        for (int64_t row = 0; row < rows; ++row) {
+            expected.push_back(val(row, 2));
+        }
+        EXPECT_EQ(to_vector(t.Slice(1, 2, 3).To(dst_device, true)), expected);
+        expected.clear();
+        for (int64_t col = 3; col < 6; ++col) {
+            for (int64_t row = 0; row < rows; ++row) {
+                expected.push_back(val(row, col));
+            }
+        }
+        EXPECT_EQ(to_vector(t.Slice(1, 3, 6).T().To(dst_device, true)),
+                  expected);
+
+        // Into columns and into a transposed view of dst.
+        core::Tensor dst =
+                core::Tensor::Zeros({rows, cols + 4}, dtype, dst_device);
+        dst.Slice(1, 2, cols + 2) = t;
+        expected.clear();
+        for (int64_t row = 0; row < rows; ++row) {
+            for (int64_t col = 0; col < cols + 4; ++col) {
+                expected.push_back(col < 2 || col >= cols + 2
+                                           ? 0
+                                           : val(row, col - 2));
+            }
+        }
+        EXPECT_EQ(to_vector(dst), expected);
+        dst = core::Tensor::Zeros({cols, rows}, dtype, dst_device);
+        dst.T() = t;
+        expected.clear();
+        for (int64_t col = 0; col < cols; ++col) {
+            for (int64_t row = 0; row < rows; ++row) {
+                expected.push_back(val(row, col));
+            }
+        }
+        EXPECT_EQ(to_vector(dst), expected);
+    }
+}
+
 TEST_P(TensorPermuteDevicePairs, IndexGet) {
     core::Device idx_device;
     core::Device src_device;
@@ -1471,6 +1583,62 @@ TEST_P(TensorPermuteDevices, Add_BroadcastException) {
                                   20, 22, 24, 26, 28, 30, 32, 34}));
 }
 
+TEST_P(TensorPermuteDevices, BinaryEWBroadcastLayouts) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>(
+            {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {10, 11, 12}}, device);
+    core::Tensor row = core::Tensor::Init<float>({1, 2, 4}, device);
+    core::Tensor column =
+            core::Tensor::Init<float>({{1}, {2}, {4}, {8}}, device);
+    core::Tensor scalar = core::Tensor::Init<float>(2, device);
+
+    // Row broadcast, e.g. translating a point cloud.
+    EXPECT_EQ((a + row).ToFlatVector<float>(),
+              std::vector<float>({2, 4, 7, 5, 7, 10, 8, 10, 13, 11, 13, 16}));
+    EXPECT_EQ((row - a).ToFlatVector<float>(),
+              std::vector<float>(
+                      {0, 0, 1, -3, -3, -2, -6, -6, -5, -9, -9, -8}));
+
+    // Column broadcast, e.g. normalizing points by their norms.
+    EXPECT_EQ((a * column).ToFlatVector<float>(),
+              std::vector<float>(
+                      {1, 2, 3, 8, 10, 12, 28, 32, 36, 80, 88, 96}));
+    EXPECT_EQ((column / a).ToFlatVector<float>(),
+              (column.Expand({4, 3}).Contiguous() / a).ToFlatVector<float>());
+
+    // Scalar broadcast.
+    EXPECT_EQ((a / scalar).ToFlatVector<float>(),
+              std::vector<float>(
+                      {0.5, 1, 1.5, 2, 2.5, 3, 3.5, 4, 4.5, 5, 5.5, 6}));
+    EXPECT_EQ((scalar - a).ToFlatVector<float>(),
+              std::vector<float>(
+                      {1, 0, -1, -2, -3, -4, -5, -6, -7, -8, -9, -10}));
+
+    // Row and column broadcast together.
+    EXPECT_EQ((row + column).ToFlatVector<float>(),
+              std::vector<float>({2, 3, 5, 3, 4, 6, 5, 6, 8, 9, 10, 12}));
+
+    // Long rows are split into blocks on the CPU.
+    core::Tensor b = core::Tensor::Ones({2, 5000}, core::Int32, device);
+    core::Tensor b_column = core::Tensor::Init<int32_t>({{1}, {2}}, device);
+    core::Tensor b_sum = b + b_column;
+    EXPECT_TRUE(b_sum.Slice(0, 0, 1).AllEqual(
+            core::Tensor::Full({1, 5000}, 2, core::Int32, device)));
+    EXPECT_TRUE(b_sum.Slice(0, 1, 2).AllEqual(
+            core::Tensor::Full({1, 5000}, 3, core::Int32, device)));
+
+    // In-place ops and non-contiguous outputs.
+    core::Tensor c = a.Clone();
+    c -= row;
+    EXPECT_EQ(c.ToFlatVector<float>(),
+              std::vector<float>({0, 0, -1, 3, 3, 2, 6, 6, 5, 9, 9, 8}));
+    core::Tensor d = a.T();
+    d *= core::Tensor::Init<float>({1, 2, 4, 8}, device);
+    EXPECT_EQ(a.ToFlatVector<float>(),
+              std::vector<float>(
+                      {1, 2, 3, 8, 10, 12, 28, 32, 36, 80, 88, 96}));
+}
+
 TEST_P(TensorPermuteDevices, Sub) {
     core::Device device = GetParam();
     core::Tensor a =
@@ -2066,6 +2234,65 @@ TEST_P(TensorPermuteDevices, ReduceMaxFloatLimit) {
     EXPECT_EQ(dst.ToFlatVector<int64_t>(), std::vector<int64_t>({1}));
 }
 
+TEST_P(TensorPermuteDevices, ReduceContiguous) {
+    // Reductions over the innermost or outermost dims of contiguous tensors
+    // take a vectorized path on CPU. Compare with the same values in a
+    // non-contiguous tensor. 37 is not a multiple of the vector width, and
+    // the values have many ties for arg-reductions.
+    core::Device device = GetParam();
+    std::vector<double> vals(7 * 5 * 37);
+    std::transform(vals.begin(), vals.end(), vals.begin(), [](double x) {
+        return double(utility::UniformRandIntGenerator(1, 2)());
+    });
+    for (const core::Dtype& dtype : {core::Float32, core::Float64}) {
+        const core::Tensor src =
+                core::Tensor(vals, {7, 5, 37}, core::Float64, device).To(dtype);
+        const core::Tensor strided =
+                src.Transpose(0, 1).Contiguous().Transpose(0, 1);
+        ASSERT_TRUE(src.IsContiguous());
+        ASSERT_FALSE(strided.IsContiguous());
+        for (const core::SizeVector& dims :
+             {core::SizeVector{2}, core::SizeVector{1, 2},
+              core::SizeVector{2, 1}, core::SizeVector{0},
+              core::SizeVector{1, 0}, core::SizeVector{0, 1, 2}}) {
+            EXPECT_TRUE(src.Sum(dims).AllEqual(strided.Sum(dims)));
+            EXPECT_TRUE(src.Min(dims).AllEqual(strided.Min(dims)));
+            EXPECT_TRUE(src.Max(dims).AllEqual(strided.Max(dims)));
+        }
+        for (const core::SizeVector& dims :
+             {core::SizeVector{2}, core::SizeVector{0},
+              core::SizeVector{0, 1, 2}}) {
+            EXPECT_TRUE(src.ArgMin(dims).AllEqual(strided.ArgMin(dims)));
+            EXPECT_TRUE(src.ArgMax(dims).AllEqual(strided.ArgMax(dims)));
+        }
+        EXPECT_TRUE(src.Prod({2}).AllEqual(strided.Prod({2})));
+        EXPECT_TRUE(src.Prod({0}).AllEqual(strided.Prod({0})));
+        EXPECT_EQ(src.Sum({0, 1, 2}).To(core::Float64).Item<double>(),
+                  std::accumulate(vals.begin(), vals.end(), 0.0));
+    }
+
+    // The first minimum is found across chunks of a large 1D tensor.
+    core::Tensor large = core::Tensor::Ones({100003}, core::Int32, device);
+    large[70001] = 0;
+    large[90001] = 0;
+    EXPECT_EQ(large.ArgMin({0}).Item<int64_t>(), 70001);
+    EXPECT_EQ(large.ArgMax({0}).Item<int64_t>(), 0);
+    EXPECT_EQ(large.Min({0}).Item<int32_t>(), 0);
+    EXPECT_EQ(large.Sum({0}).Item<int32_t>(), 100001);
+
+    const core::Tensor mask =
+            core::Tensor(vals, {7, 5, 37}, core::Float64, device).Gt(1.5);
+    const core::Tensor strided_mask =
+            mask.Transpose(0, 1).Contiguous().Transpose(0, 1);
+    EXPECT_EQ(mask.All(), strided_mask.All());
+    EXPECT_EQ(mask.Any(), strided_mask.Any());
+    core::Tensor ones = core::Tensor::Ones({1000}, core::Bool, device);
+    EXPECT_TRUE(ones.All());
+    ones[999] = false;
+    EXPECT_FALSE(ones.All());
+    EXPECT_TRUE(ones.Any());
+}
+
 TEST_P(TensorPermuteDevices, ReduceArgMin) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>(
@@ -2913,6 +3140,44 @@ TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
               std::vector<float>({12, 14, 20, 22}));
 }
 
+TEST_P(TensorPermuteDevices, ToDLPackStream) {
+    core::Device device = GetParam();
+    core::Tensor src_t = core::Tensor::Ones({3, 4}, core::Float32, device);
+
+    // -1 skips synchronization, 1 and 2 are the default streams.
+    const std::vector<int64_t> streams{-1, 1, 2,
+                                       core::cuda::GetDLPackStream()};
+    for (int64_t stream : streams) {
+        core::Tensor dst_t = core::Tensor::FromDLPack(src_t.ToDLPack(stream));
+        EXPECT_EQ(dst_t.GetDataPtr(), src_t.GetDataPtr());
+        EXPECT_TRUE(dst_t.AllClose(src_t));
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        // Stream 0 is ambiguous in the DLPack protocol.
+        EXPECT_ANY_THROW(src_t.ToDLPack(0));
+
+        // Produced on a side stream, consumed on the default stream.
+        core::Tensor produced;
+        int64_t producer_stream;
+        {
+            core::CUDAScopedStream scoped_stream(
+                    core::CUDAScopedStream::CreateNewStream);
+            producer_stream = core::cuda::GetDLPackStream();
+            EXPECT_NE(producer_stream, 1);
+            produced = src_t * 2;
+            core::Tensor consumed =
+                    core::Tensor::FromDLPack(produced.ToDLPack(1));
+            EXPECT_EQ(consumed.GetDataPtr(), produced.GetDataPtr());
+            core::cuda::StreamSynchronize();
+        }
+        EXPECT_TRUE(produced.AllClose(
+                core::Tensor::Full({3, 4}, 2.f, core::Float32, device)));
+    }
+#endif
+}
+
 TEST_P(TensorPermuteDevices, IsSame) {
     core::Device device = GetParam();
 
@@ -3316,5 +3581,234 @@ TEST_P(TensorPermuteDevices, ConstIterator) {
     }
 }
 
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+
+    core::Tensor t = core::Tensor::Init<float>(
+            {3.5, -1, 0, -7.25, 2, -0.f, 100, -100}, device);
+    EXPECT_TRUE(t.Sort().AllClose(core::Tensor::Init<float>(
+            {-100, -7.25, -1, -0.f, 0, 2, 3.5, 100}, device)));
+
+    // NaNs are ordered last.
+    t = core::Tensor::Init<double>({1, std::nan(""), -1}, device);
+    core::Tensor sorted = t.Sort();
+    EXPECT_EQ(sorted[0].Item<double>(), -1);
+    EXPECT_EQ(sorted[1].Item<double>(), 1);
+    EXPECT_TRUE(std::isnan(sorted[2].Item<double>()));
+
+    t = core::Tensor::Init<int8_t>({5, -128, 127, 0, -1}, device);
+    EXPECT_TRUE(t.Sort().AllEqual(
+            core::Tensor::Init<int8_t>({-128, -1, 0, 5, 127}, device)));
+
+    t = core::Tensor::Init<bool>({true, false, true, false}, device);
+    EXPECT_TRUE(t.Sort().AllEqual(
+            core::Tensor::Init<bool>({false, false, true, true}, device)));
+
+    // Large enough to be sorted in parallel chunks.
+    std::vector<int64_t> vals(100000);
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = static_cast<int64_t>((i * 2654435761u) % 1000003) - 500000;
+    }
+    t = core::Tensor(vals, {static_cast<int64_t>(vals.size())}, core::Int64,
+                     device);
+    std::sort(vals.begin(), vals.end());
+    EXPECT_EQ(t.Sort().ToFlatVector<int64_t>(), vals);
+
+    EXPECT_EQ(core::Tensor::Empty({0}, core::Float32, device).Sort().GetShape(),
+              core::SizeVector({0}));
+    EXPECT_ANY_THROW(core::Tensor::Ones({2, 2}, core::Float32, device).Sort());
+}
+
+TEST_P(TensorPermuteDevices, Argsort) {
+    core::Device device = GetParam();
+
+    // Stable: equal elements keep their order.
+    core::Tensor t = core::Tensor::Init<int32_t>({2, 1, 2, 0, 1, 2}, device);
+    core::Tensor indices = t.Argsort();
+    EXPECT_EQ(indices.GetDtype(), core::Int64);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({3, 1, 4, 0, 2, 5}));
+    EXPECT_TRUE(t.IndexGet({indices}).AllEqual(t.Sort()));
+
+    t = core::Tensor::Init<uint16_t>({65535, 0, 256, 255}, device);
+    EXPECT_EQ(t.Argsort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 2, 0}));
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor t = core::Tensor::Init<int32_t>({4, 1, 4, 4, -2, 1}, device);
+    EXPECT_TRUE(t.Unique().AllEqual(
+            core::Tensor::Init<int32_t>({-2, 1, 4}, device)));
+
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = t.UniqueWithInverseAndCounts();
+    EXPECT_TRUE(unique.AllEqual(
+            core::Tensor::Init<int32_t>({-2, 1, 4}, device)));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 1, 2, 2, 0, 1}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2, 3}));
+    EXPECT_TRUE(unique.IndexGet({inverse}).AllEqual(t));
+
+    std::tie(unique, inverse, counts) =
+            core::Tensor::Empty({0}, core::Float32, device)
+                    .UniqueWithInverseAndCounts();
+    EXPECT_EQ(unique.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, SortByKey) {
+    core::Device device = GetParam();
+
+    core::Tensor keys = core::Tensor::Init<uint32_t>({30, 10, 20, 10}, device);
+    core::Tensor values = core::Tensor::Init<float>(
+            {{3, 3}, {1, 1}, {2, 2}, {1.5, 1.5}}, device);
+    core::Tensor sorted_keys, sorted_values;
+    std::tie(sorted_keys, sorted_values) =
+            core::Tensor::SortByKey(keys, values);
+    EXPECT_TRUE(sorted_keys.AllEqual(
+            core::Tensor::Init<uint32_t>({10, 10, 20, 30}, device)));
+    EXPECT_TRUE(sorted_values.AllClose(core::Tensor::Init<float>(
+            {{1, 1}, {1.5, 1.5}, {2, 2}, {3, 3}}, device)));
+
+    EXPECT_ANY_THROW(core::Tensor::SortByKey(
+            keys, core::Tensor::Zeros({3}, core::Float32, device)));
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduction) {
+    core::Device device = GetParam();
+
+    core::Tensor t = core::Tensor::Init<float>(
+            {{1, 10}, {2, 20}, {3, 30}, {-4, 40}, {5, 50}}, device);
+    // Segments {0, 1, 2}, {} and {3, 4}.
+    core::Tensor splits = core::Tensor::Init<int64_t>({0, 3, 3, 5}, device);
+
+    EXPECT_TRUE(t.SegmentSum(splits).AllClose(core::Tensor::Init<float>(
+            {{6, 60}, {0, 0}, {1, 90}}, device)));
+    EXPECT_TRUE(t.SegmentMean(splits).AllClose(core::Tensor::Init<float>(
+            {{2, 20}, {0, 0}, {0.5, 45}}, device)));
+    EXPECT_TRUE(t.SegmentMax(splits).AllClose(core::Tensor::Init<float>(
+            {{3, 30}, {0, 0}, {5, 50}}, device)));
+    EXPECT_TRUE(t.SegmentMin(splits).AllClose(core::Tensor::Init<float>(
+            {{1, 10}, {0, 0}, {-4, 40}}, device)));
+
+    core::Tensor t_int = core::Tensor::Init<int32_t>({7, -1, 3, 2}, device);
+    core::Tensor splits_int = core::Tensor::Init<int64_t>({0, 1, 4}, device);
+    EXPECT_TRUE(t_int.SegmentSum(splits_int)
+                        .AllEqual(core::Tensor::Init<int32_t>({7, 4}, device)));
+    EXPECT_TRUE(t_int.SegmentMax(splits_int)
+                        .AllEqual(core::Tensor::Init<int32_t>({7, 3}, device)));
+
+    // Per-key means from SortByKey and Unique counts.
+    core::Tensor keys = core::Tensor::Init<int64_t>({2, 0, 2, 0, 2}, device);
+    core::Tensor values = core::Tensor::Init<double>({1, 2, 3, 4, 8}, device);
+    core::Tensor sorted_keys, sorted_values;
+    std::tie(sorted_keys, sorted_values) =
+            core::Tensor::SortByKey(keys, values);
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = keys.UniqueWithInverseAndCounts();
+    core::Tensor group_splits = core::Tensor::Init<int64_t>(
+            {0, counts[0].Item<int64_t>(), keys.GetLength()}, device);
+    EXPECT_TRUE(sorted_values.SegmentMean(group_splits)
+                        .AllClose(core::Tensor::Init<double>({3, 4}, device)));
+
+    // Invalid splits.
+    EXPECT_ANY_THROW(t.SegmentSum(core::Tensor::Init<int64_t>({0, 4}, device)));
+    EXPECT_ANY_THROW(
+            t.SegmentSum(core::Tensor::Init<int64_t>({0, 4, 2, 5}, device)));
+    EXPECT_ANY_THROW(t.SegmentSum(core::Tensor::Init<int32_t>({0, 5}, device)));
+}
+
+TEST_P(TensorPermuteDevices, IndexAdd) {
+    core::Device device = GetParam();
+
+    core::Tensor t = core::Tensor::Ones({3, 2}, core::Float32, device);
+    core::Tensor index = core::Tensor::Init<int64_t>({2, 0, 2, 2}, device);
+    core::Tensor src = core::Tensor::Init<float>(
+            {{1, 2}, {3, 4}, {5, 6}, {7, 8}}, device);
+    t.IndexAdd_(0, index, src);
+    core::Tensor expected = core::Tensor::Init<float>(
+            {{4, 5}, {1, 1}, {14, 17}}, device);
+    EXPECT_TRUE(t.AllClose(expected));
+
+    core::Tensor t_det = core::Tensor::Ones({3, 2}, core::Float32, device);
+    t_det.IndexAdd_(0, index, src, /*deterministic=*/true);
+    EXPECT_TRUE(t_det.AllClose(expected));
+
+    // Along the last dimension of a non-contiguous tensor.
+    core::Tensor t_cols = core::Tensor::Zeros({3, 2}, core::Int32, device).T();
+    core::Tensor src_cols =
+            core::Tensor::Init<int32_t>({{1, 2, 3, 4}, {5, 6, 7, 8}}, device);
+    t_cols.IndexAdd_(1, index, src_cols);
+    EXPECT_TRUE(t_cols.AllEqual(core::Tensor::Init<int32_t>(
+            {{2, 0, 8}, {6, 0, 20}}, device)));
+
+    // Many collisions on a single element.
+    core::Tensor counts = core::Tensor::Zeros({1}, core::Int64, device);
+    counts.IndexAdd_(0, core::Tensor::Zeros({10000}, core::Int64, device),
+                     core::Tensor::Ones({10000}, core::Int64, device));
+    EXPECT_EQ(counts[0].Item<int64_t>(), 10000);
+
+    core::Tensor half = core::Tensor::Zeros({2}, core::Float16, device);
+    half.IndexAdd_(0, core::Tensor::Init<int64_t>({1, 1, 1}, device),
+                   core::Tensor::Ones({3}, core::Float16, device));
+    EXPECT_TRUE(half.To(core::Float32).AllClose(
+            core::Tensor::Init<float>({0, 3}, device)));
+
+    // Invalid arguments.
+    EXPECT_ANY_THROW(t.IndexAdd_(0, core::Tensor::Init<int64_t>({3}, device),
+                                 src.Slice(0, 0, 1)));
+    EXPECT_ANY_THROW(t.IndexAdd_(0, index, src.Slice(1, 0, 1)));
+    EXPECT_ANY_THROW(t.IndexAdd_(0, index.To(core::Int32), src));
+    EXPECT_ANY_THROW(t.IndexAdd_(0, index, src.To(core::Float64)));
+}
+
+TEST_P(TensorPermuteDevices, IndexReduce) {
+    core::Device device = GetParam();
+
+    core::Tensor index = core::Tensor::Init<int64_t>({0, 2, 0, 2, 2}, device);
+    core::Tensor src = core::Tensor::Init<float>({4, -1, 2, 5, 3}, device);
+
+    for (bool deterministic : {false, true}) {
+        core::Tensor t = core::Tensor::Init<float>({3, 7, 0}, device);
+        t.IndexReduce_(0, index, src, "max", true, deterministic);
+        EXPECT_TRUE(
+                t.AllClose(core::Tensor::Init<float>({4, 7, 5}, device)));
+
+        t = core::Tensor::Init<float>({3, 7, 0}, device);
+        t.IndexReduce_(0, index, src, "min", false, deterministic);
+        EXPECT_TRUE(
+                t.AllClose(core::Tensor::Init<float>({2, 7, -1}, device)));
+
+        t = core::Tensor::Init<float>({3, 7, 0}, device);
+        t.IndexReduce_(0, index, src, "mean", true, deterministic);
+        EXPECT_TRUE(
+                t.AllClose(core::Tensor::Init<float>({3, 7, 1.75}, device)));
+
+        t = core::Tensor::Init<float>({3, 7, 0}, device);
+        t.IndexReduce_(0, index, src, "mean", false, deterministic);
+        EXPECT_TRUE(t.AllClose(
+                core::Tensor::Init<float>({3, 7, 7.0f / 3.0f}, device)));
+
+        t = core::Tensor::Init<float>({3, 7, 0}, device);
+        t.IndexReduce_(0, index, src, "sum", false, deterministic);
+        EXPECT_TRUE(
+                t.AllClose(core::Tensor::Init<float>({6, 7, 7}, device)));
+    }
+
+    core::Tensor t_int = core::Tensor::Init<int8_t>({{1, 1}, {1, 1}}, device);
+    t_int.IndexReduce_(1, core::Tensor::Init<int64_t>({1, 1, 1}, device),
+                       core::Tensor::Init<int8_t>({{-3, 4, 2}, {0, 0, 9}},
+                                                  device),
+                       "max");
+    EXPECT_TRUE(t_int.AllEqual(
+            core::Tensor::Init<int8_t>({{1, 4}, {1, 9}}, device)));
+
+    core::Tensor t = core::Tensor::Zeros({3}, core::Float32, device);
+    EXPECT_ANY_THROW(t.IndexReduce_(0, index, src, "prod"));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/TensorExpr.h"
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorExprPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorExpr,
+                         TensorExprPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(TensorExprPermuteDevices, Eval) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<float>({5, 1, -1}, device);
+    core::Tensor w = core::Tensor::Init<float>({{2}, {0.5}}, device);
+
+    core::TensorExpr expr = (core::TensorExpr(a) - b).Abs() * w + 1.f;
+    EXPECT_EQ(expr.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(expr.GetDtype(), core::Float32);
+    EXPECT_EQ(expr.GetDevice(), device);
+
+    core::Tensor result = expr.Eval();
+    core::Tensor expected = (a - b).Abs().Mul(w).Add(1.f);
+    EXPECT_TRUE(result.AllClose(expected));
+
+    // Functions that are only defined for floating point dtypes.
+    result = (core::TensorExpr(a).Sqrt() + core::TensorExpr(a).Exp() -
+              core::TensorExpr(b).Sin() * core::TensorExpr(b).Cos())
+                     .Eval();
+    expected = a.Sqrt() + a.Exp() - b.Sin() * b.Cos();
+    EXPECT_TRUE(result.AllClose(expected));
+
+    // Rounding.
+    core::Tensor c = core::Tensor::Init<double>({-1.5, -0.4, 0.6, 2.5}, device);
+    core::TensorExpr c_expr(c);
+    EXPECT_TRUE(c_expr.Floor().Eval().AllClose(c.Floor()));
+    EXPECT_TRUE(c_expr.Ceil().Eval().AllClose(c.Ceil()));
+    EXPECT_TRUE(c_expr.Round().Eval().AllClose(c.Round()));
+    EXPECT_TRUE(c_expr.Trunc().Eval().AllClose(c.Trunc()));
+    EXPECT_TRUE(c_expr.Neg().Div(2.).Eval().AllClose(c.Neg() / 2.));
+}
+
+TEST_P(TensorExprPermuteDevices, EvalNonContiguous) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Arange(0, 24, 1, core::Int64, device)
+                             .Reshape({2, 3, 4});
+    core::Tensor a_t = a.Transpose(0, 2);
+    core::Tensor b = core::Tensor::Ones({4, 3, 1}, core::Int64, device);
+
+    core::Tensor result = ((core::TensorExpr(a_t) + b) * a_t).Eval();
+    EXPECT_TRUE(result.AllEqual((a_t + b) * a_t));
+    EXPECT_TRUE(result.IsContiguous());
+}
+
+TEST_P(TensorExprPermuteDevices, Sum) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<float>({5, 1, -1}, device);
+    core::Tensor w = core::Tensor::Init<float>({{2}, {0.5}}, device);
+    core::Tensor eager = (a - b).Abs().Mul(w);
+    core::TensorExpr expr = (core::TensorExpr(a) - b).Abs().Mul(w);
+
+    EXPECT_TRUE(expr.Sum({0}).AllClose(eager.Sum({0})));
+    EXPECT_TRUE(expr.Sum({1}).AllClose(eager.Sum({1})));
+    EXPECT_TRUE(expr.Sum({0, 1}).AllClose(eager.Sum({0, 1})));
+    EXPECT_TRUE(expr.Sum({1}, true).AllClose(eager.Sum({1}, true)));
+    EXPECT_EQ(expr.Sum({0, 1}).GetShape(), core::SizeVector({}));
+    EXPECT_EQ(expr.Sum({0}, true).GetShape(), core::SizeVector({1, 3}));
+
+    // Integer sum of a larger tensor, exercising the parallel paths.
+    core::Tensor c = core::Tensor::Arange(0, 3000, 1, core::Int32, device)
+                             .Reshape({100, 30});
+    core::TensorExpr c_expr = core::TensorExpr(c) * 2 - 1;
+    EXPECT_TRUE(c_expr.Sum({0}).AllEqual((c * 2 - 1).Sum({0})));
+    EXPECT_TRUE(c_expr.Sum({1}).AllEqual((c * 2 - 1).Sum({1})));
+    EXPECT_EQ(c_expr.Sum({0, 1}).Item<int32_t>(),
+              (c * 2 - 1).Sum({0, 1}).Item<int32_t>());
+
+    // No reduction dims is the same as Eval().
+    EXPECT_TRUE(c_expr.Sum({}).AllEqual(c_expr.Eval()));
+}
+
+TEST_P(TensorExprPermuteDevices, SharedSubExpressions) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<double>({1, 2, 3, 4}, device);
+    core::TensorExpr a_expr(a);
+    core::TensorExpr sq = a_expr * a_expr;
+    core::Tensor result = (sq + sq).Div(sq).Eval();
+    EXPECT_TRUE(result.AllClose(core::Tensor::Full({4}, 2., core::Float64,
+                                                   device)));
+}
+
+TEST_P(TensorExprPermuteDevices, Errors) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Float32, device);
+    core::Tensor b = core::Tensor::Ones({2, 3}, core::Float64, device);
+    core::Tensor c = core::Tensor::Ones({4}, core::Float32, device);
+    core::Tensor i = core::Tensor::Ones({2, 3}, core::Int32, device);
+    core::Tensor bool_tensor = core::Tensor::Ones({2, 3}, core::Bool, device);
+
+    // Dtype mismatch.
+    EXPECT_ANY_THROW(core::TensorExpr(a) + b);
+    // Shapes are not broadcastable.
+    EXPECT_ANY_THROW(core::TensorExpr(a) + c);
+    // Float only ops.
+    EXPECT_ANY_THROW(core::TensorExpr(i).Sqrt());
+    // Bool is not supported.
+    EXPECT_ANY_THROW(core::TensorExpr(bool_tensor).Eval());
+
+    // Too many instructions.
+    core::TensorExpr long_expr(a);
+    for (int k = 0; k < 40; ++k) {
+        long_expr = long_expr + 1.f;
+    }
+    EXPECT_ANY_THROW(long_expr.Eval());
+}
+
+}  // namespace tests
+}  // namespace open3d
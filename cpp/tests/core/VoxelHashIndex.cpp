@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/VoxelHashIndex.h"
+
+#include <algorithm>
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static core::Tensor RandomPoints(int64_t n, std::mt19937 &rng) {
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> values(n * 3);
+    for (double &v : values) {
+        v = dist(rng);
+    }
+    return core::Tensor(values, {n, 3}, core::Float64);
+}
+
+/// Sorted (squared distance, index) pairs of the live points.
+static std::vector<std::pair<double, int>> BruteForceNeighbors(
+        const core::Tensor &points,
+        const std::vector<bool> &alive,
+        const double *query) {
+    const double *points_ptr = points.GetDataPtr<double>();
+    std::vector<std::pair<double, int>> neighbors;
+    for (int64_t i = 0; i < points.GetLength(); ++i) {
+        if (!alive[i]) continue;
+        double d = 0;
+        for (int c = 0; c < 3; ++c) {
+            double diff = points_ptr[3 * i + c] - query[c];
+            d += diff * diff;
+        }
+        neighbors.emplace_back(d, static_cast<int>(i));
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+TEST(VoxelHashIndex, InsertRemove) {
+    std::mt19937 rng(0);
+    core::Tensor points_a = RandomPoints(500, rng);
+    core::Tensor points_b = RandomPoints(300, rng);
+
+    core::nns::VoxelHashIndex index(points_a, 0.1);
+    EXPECT_EQ(index.Size(), 500);
+
+    core::Tensor ids = index.Insert(points_b);
+    EXPECT_TRUE(ids.AllEqual(
+            core::Tensor::Arange(500, 800, 1, core::Int32, ids.GetDevice())));
+    EXPECT_EQ(index.Size(), 800);
+    EXPECT_EQ(index.GetDatasetSize(), 800);
+
+    // Removed, repeated and out of range indices.
+    index.Remove(core::Tensor::Init<int64_t>({0, 10, 10, 799, 1000, -1}));
+    EXPECT_EQ(index.Size(), 797);
+    index.Remove(core::Tensor::Init<int32_t>({0}));
+    EXPECT_EQ(index.Size(), 797);
+    EXPECT_EQ(index.GetDatasetSize(), 800);
+
+    // Cleared by SetTensorData.
+    index.SetTensorData(points_b, 0.2);
+    EXPECT_EQ(index.Size(), 300);
+    EXPECT_EQ(index.GetVoxelSize(), 0.2);
+}
+
+TEST(VoxelHashIndex, Search) {
+    std::mt19937 rng(1);
+    core::Tensor points = core::Concatenate(
+            {RandomPoints(1000, rng), RandomPoints(1000, rng).Mul(3.0)});
+    core::Tensor query_points = RandomPoints(50, rng).Mul(2.0);
+
+    core::nns::VoxelHashIndex index(points.Slice(0, 0, 1000), 0.1);
+    index.Insert(points.Slice(0, 1000, 2000));
+
+    std::vector<bool> alive(2000, true);
+    std::vector<int64_t> removed;
+    for (int64_t i = 0; i < 2000; i += 3) {
+        removed.push_back(i);
+        alive[i] = false;
+    }
+    index.Remove(core::Tensor(removed, {int64_t(removed.size())},
+                              core::Int64));
+
+    EXPECT_THROW(index.SearchKnn(query_points, 0), std::runtime_error);
+    EXPECT_THROW(index.SearchHybrid(query_points, 0.0, 3), std::runtime_error);
+    EXPECT_THROW(index.SearchKnn(query_points.To(core::Float32), 3),
+                 std::runtime_error);
+
+    const int knn = 8;
+    const double radius = 0.3;
+    core::Tensor knn_indices, knn_distances;
+    std::tie(knn_indices, knn_distances) = index.SearchKnn(query_points, knn);
+    EXPECT_EQ(knn_indices.GetShape(), core::SizeVector({50, knn}));
+
+    core::Tensor radius_indices, radius_distances, row_splits;
+    std::tie(radius_indices, radius_distances, row_splits) =
+            index.SearchRadius(query_points, radius);
+
+    core::Tensor hybrid_indices, hybrid_distances, hybrid_counts;
+    std::tie(hybrid_indices, hybrid_distances, hybrid_counts) =
+            index.SearchHybrid(query_points, radius, knn);
+
+    const double *query_ptr = query_points.GetDataPtr<double>();
+    for (int64_t i = 0; i < 50; ++i) {
+        std::vector<std::pair<double, int>> gt =
+                BruteForceNeighbors(points, alive, query_ptr + 3 * i);
+
+        for (int k = 0; k < knn; ++k) {
+            EXPECT_EQ(knn_indices[i][k].Item<int32_t>(), gt[k].second);
+            EXPECT_NEAR(knn_distances[i][k].Item<double>(), gt[k].first,
+                        1e-12);
+        }
+
+        int64_t num_in_radius = std::count_if(
+                gt.begin(), gt.end(), [&](const std::pair<double, int> &n) {
+                    return n.first < radius * radius;
+                });
+        int64_t begin = row_splits[i].Item<int64_t>();
+        EXPECT_EQ(row_splits[i + 1].Item<int64_t>() - begin, num_in_radius);
+        for (int64_t k = 0; k < num_in_radius; ++k) {
+            EXPECT_EQ(radius_indices[begin + k].Item<int32_t>(), gt[k].second);
+        }
+
+        int64_t count = std::min<int64_t>(num_in_radius, knn);
+        EXPECT_EQ(hybrid_counts[i].Item<int32_t>(), count);
+        for (int k = 0; k < knn; ++k) {
+            EXPECT_EQ(hybrid_indices[i][k].Item<int32_t>(),
+                      k < count ? gt[k].second : -1);
+        }
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -891,6 +891,32 @@ TEST(Image, FilterHorizontal) {
     ExpectEQ(ref, output->data_);
 }
 
+TEST(Image, FilterBox) {
+    geometry::Image image;
+    const int width = 70;
+    const int height = 9;
+    image.Prepare(width, height, 1, 1);
+    Rand(image.data_, 0, 255, 0);
+    auto float_image = image.CreateFloatImage();
+
+    for (int half : {0, 1, 3}) {
+        const std::vector<double> box(2 * half + 1, 1.0 / (2 * half + 1));
+        auto ref = float_image->Filter(box, box);
+        auto output = float_image->FilterBox(half);
+
+        EXPECT_EQ(width, output->width_);
+        EXPECT_EQ(height, output->height_);
+        EXPECT_EQ(1, output->num_of_channels_);
+        EXPECT_EQ(4, output->bytes_per_channel_);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                EXPECT_NEAR(*ref->PointerAt<float>(x, y),
+                            *output->PointerAt<float>(x, y), 1e-5);
+            }
+        }
+    }
+}
+
 TEST(Image, Downsample) {
     // reference data used to validate the filtering of an image
     std::vector<uint8_t> ref = {172, 41, 59,  204, 93, 130, 242, 232,
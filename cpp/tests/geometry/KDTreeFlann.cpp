@@ -26,6 +26,8 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <cstdio>
+
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "tests/Tests.h"
@@ -72,6 +74,64 @@ TEST(KDTreeFlann, SearchKNN) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchKNNApproximate) {
+    // 33-dimensional data, the size of FPFH features.
+    std::srand(0);
+    Eigen::MatrixXd data = Eigen::MatrixXd::Random(33, 1000);
+    Eigen::VectorXd query = Eigen::VectorXd::Random(33);
+    geometry::KDTreeFlann kdtree(data);
+
+    int knn = 10;
+    std::vector<int> exact_indices, indices;
+    std::vector<double> exact_distance2, distance2;
+    EXPECT_EQ(kdtree.SearchKNN(query, knn, exact_indices, exact_distance2),
+              knn);
+
+    EXPECT_EQ(kdtree.SearchKNN(query, knn, indices, distance2, 0.0), knn);
+    ExpectEQ(exact_indices, indices);
+    ExpectEQ(exact_distance2, distance2);
+
+    // Approximate neighbors are never closer than the exact ones, and the
+    // k-th squared distance is within a factor of (1 + eps).
+    double eps = 0.5;
+    EXPECT_EQ(kdtree.SearchKNN(query, knn, indices, distance2, eps), knn);
+    for (int i = 0; i < knn; ++i) {
+        EXPECT_GE(distance2[i], exact_distance2[i] - 1e-12);
+    }
+    EXPECT_LE(distance2[knn - 1], (1.0 + eps) * exact_distance2[knn - 1]);
+
+    EXPECT_EQ(kdtree.SearchKNN(query, knn, indices, distance2, -1.0), -1);
+}
+
+TEST(KDTreeFlann, SaveLoad) {
+    geometry::PointCloud pc;
+    pc.points_.resize(100);
+    Rand(pc.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(10.0, 10.0, 10.0), 0);
+    geometry::KDTreeFlann kdtree(pc);
+    const std::string file_name = "kdtree_flann.npz";
+    EXPECT_TRUE(kdtree.Save(file_name));
+
+    Eigen::Vector3d query = {1.647059, 4.392157, 8.784314};
+    std::vector<int> ref_indices;
+    std::vector<double> ref_distance2;
+    EXPECT_EQ(kdtree.SearchKNN(query, 30, ref_indices, ref_distance2), 30);
+
+    for (bool use_mmap : {false, true}) {
+        geometry::KDTreeFlann loaded;
+        EXPECT_TRUE(loaded.Load(file_name, use_mmap));
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        EXPECT_EQ(loaded.SearchKNN(query, 30, indices, distance2), 30);
+        ExpectEQ(ref_indices, indices);
+        ExpectEQ(ref_distance2, distance2);
+    }
+
+    geometry::KDTreeFlann empty;
+    EXPECT_FALSE(empty.Save(file_name));
+    std::remove(file_name.c_str());
+}
+
 TEST(KDTreeFlann, SearchRadius) {
     std::vector<int> ref_indices = {27, 48, 4,  77, 90, 7, 54, 17, 76, 38, 39,
                                     60, 15, 84, 11, 57, 3, 32, 99, 36, 52};
@@ -28,9 +28,11 @@
 
 #include <json/json.h>
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "open3d/io/PointCloudIO.h"
@@ -373,6 +375,47 @@ TEST(Octree, FragmentPLYLocate) {
     }
 }
 
+TEST(Octree, FragmentPLYLinearOctreeLocate) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(utility::GetDataPathCommon("fragment.ply"), pcd);
+    size_t max_depth = 5;
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::LinearOctree linear_octree;
+    linear_octree.CreateFromPointCloud(pcd, max_depth, 0.01);
+    ExpectEQ(linear_octree.origin_, octree.origin_);
+    EXPECT_EQ(linear_octree.size_, octree.size_);
+    EXPECT_EQ(linear_octree.nodes_[0].point_end_, pcd.points_.size());
+
+    // The leaf of every located point matches the pointer-based octree.
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 200) {
+        const Eigen::Vector3d& point = pcd.points_[idx];
+        std::shared_ptr<geometry::OctreeLeafNode> node;
+        std::shared_ptr<geometry::OctreeNodeInfo> node_info;
+        std::tie(node, node_info) = octree.LocateLeafNode(point);
+        auto leaf_node =
+                std::dynamic_pointer_cast<geometry::OctreePointColorLeafNode>(
+                        node);
+        ASSERT_NE(leaf_node, nullptr);
+
+        int64_t leaf_idx = linear_octree.LocateLeafNode(point);
+        ASSERT_GE(leaf_idx, 0);
+        EXPECT_EQ(linear_octree.nodes_[leaf_idx].depth_, max_depth);
+        EXPECT_EQ(linear_octree.nodes_[leaf_idx].first_child_, -1);
+        ExpectEQ(linear_octree.GetNodeOrigin(leaf_idx), node_info->origin_);
+        EXPECT_EQ(linear_octree.GetNodeSize(leaf_idx), node_info->size_);
+
+        std::vector<size_t> indices =
+                linear_octree.GetNodePointIndices(leaf_idx);
+        std::sort(indices.begin(), indices.end());
+        EXPECT_EQ(indices, leaf_node->indices_);
+    }
+
+    EXPECT_EQ(linear_octree.LocateLeafNode(octree.origin_ +
+                                           Eigen::Vector3d(-1, 0, 0)),
+              -1);
+}
+
 TEST(Octree, ConvertFromPointCloudBoundSinglePoint) {
     geometry::Octree octree(10);
     geometry::PointCloud pcd;
@@ -27,6 +27,7 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <numeric>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/BoundingVolume.h"
@@ -1200,6 +1201,20 @@ TEST(PointCloud, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+TEST(PointCloud, ClusterDBSCANBorderAndNoise) {
+    // Two dense groups on the x axis sharing a border point at x = 0.8, plus
+    // an isolated point.
+    std::vector<Eigen::Vector3d> points = {
+            {0.0, 0, 0}, {0.1, 0, 0}, {0.2, 0, 0}, {0.3, 0, 0}, {0.8, 0, 0},
+            {1.3, 0, 0}, {1.4, 0, 0}, {1.5, 0, 0}, {1.6, 0, 0}, {9.0, 0, 0}};
+    geometry::PointCloud pcd(points);
+
+    // The point at x = 0.8 has only 3 neighbors within eps, so it is not core.
+    // It is reachable from both clusters and joins the first one.
+    std::vector<int> labels = pcd.ClusterDBSCAN(0.55, 4, false);
+    EXPECT_EQ(labels, std::vector<int>({0, 0, 0, 0, 0, 1, 1, 1, 1, -1}));
+}
+
 TEST(PointCloud, SegmentPlane) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(utility::GetDataPathCommon("fragment.pcd"), pcd);
@@ -1229,6 +1244,43 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlanes) {
+    // Two perpendicular 10x10 grids on the planes z = 0 and x = 2.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            pcd.points_.push_back(Eigen::Vector3d(i * 0.1, j * 0.1, 0.0));
+        }
+    }
+    for (int i = 0; i < 10; ++i) {
+        for (int j = 0; j < 10; ++j) {
+            pcd.points_.push_back(Eigen::Vector3d(2.0, i * 0.1, j * 0.1 + 1));
+        }
+    }
+
+    auto planes = pcd.SegmentPlanes(0.01, 3, 1000, 5);
+    ASSERT_EQ(planes.size(), 2u);
+
+    std::vector<size_t> all_inliers;
+    for (const auto &plane : planes) {
+        const Eigen::Vector4d &plane_model = std::get<0>(plane);
+        const std::vector<size_t> &inliers = std::get<1>(plane);
+        EXPECT_EQ(inliers.size(), 100u);
+        if (inliers.front() < 100) {
+            EXPECT_NEAR(std::abs(plane_model(2)), 1.0, 1e-6);
+            EXPECT_NEAR(plane_model(3), 0.0, 1e-6);
+        } else {
+            EXPECT_NEAR(std::abs(plane_model(0)), 1.0, 1e-6);
+            EXPECT_NEAR(std::abs(plane_model(3)), 2.0, 1e-6);
+        }
+        all_inliers.insert(all_inliers.end(), inliers.begin(), inliers.end());
+    }
+    std::sort(all_inliers.begin(), all_inliers.end());
+    std::vector<size_t> all_indices(200);
+    std::iota(all_indices.begin(), all_indices.end(), 0);
+    EXPECT_EQ(all_inliers, all_indices);
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             utility::GetDataPathCommon("RGBD/trajectory.log");
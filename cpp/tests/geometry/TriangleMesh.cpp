@@ -28,6 +28,8 @@
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TetraMesh.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -1072,6 +1074,48 @@ TEST(TriangleMesh, GetVolume) {
                 4.0 / 3.0 * M_PI, 0.05);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimationParallel) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    ASSERT_EQ(sphere->triangles_.size(), 1520u);
+
+    auto mesh = sphere->SimplifyQuadricDecimationParallel(
+            200, std::numeric_limits<double>::infinity(), 1.0);
+    // Collapses remove two triangles each, so the target is met exactly and
+    // the closed sphere keeps an Euler characteristic of 2.
+    EXPECT_EQ(mesh->triangles_.size(), 200u);
+    EXPECT_EQ(mesh->vertices_.size(), 102u);
+    for (const auto &triangle : mesh->triangles_) {
+        EXPECT_LT(triangle.maxCoeff(), int(mesh->vertices_.size()));
+        EXPECT_GE(triangle.minCoeff(), 0);
+    }
+    for (const auto &vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.1);
+    }
+}
+
+TEST(TriangleMesh, CreateFromPointCloudBallPivotingParallel) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    sphere->ComputeVertexNormals();
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertex_normals_;
+    const std::vector<double> radii = {0.2, 0.4};
+
+    auto serial = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, radii);
+    // A small cell size splits the sphere into many partitions.
+    auto mesh =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivotingParallel(
+                    pcd, radii, 0.5);
+    EXPECT_EQ(mesh->vertices_.size(), pcd.points_.size());
+    EXPECT_GT(mesh->triangles_.size(), serial->triangles_.size() * 8 / 10);
+    EXPECT_TRUE(mesh->IsEdgeManifold(true));
+    for (const auto &triangle : mesh->triangles_) {
+        EXPECT_LT(triangle.maxCoeff(), int(mesh->vertices_.size()));
+        EXPECT_GE(triangle.minCoeff(), 0);
+    }
+}
+
 TEST(TriangleMesh, ClusterConnectedTriangles) {
     // Test 1
 
@@ -1915,6 +1959,34 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudAlphaShapes) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(200);
+    Rand(pcd.points_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 0);
+    pcd.colors_.resize(200);
+    Rand(pcd.colors_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 1);
+
+    std::shared_ptr<geometry::TetraMesh> tetra_mesh;
+    std::vector<size_t> pt_map;
+    std::tie(tetra_mesh, pt_map) =
+            geometry::Qhull::ComputeDelaunayTetrahedralization(pcd.points_);
+
+    // Sweeping alpha on a shared tetrahedralization gives the same meshes as
+    // computing each alpha shape on its own.
+    const std::vector<double> alphas = {0.05, 0.1, 0.2, 0.5, 1e3};
+    const auto meshes = geometry::TriangleMesh::CreateFromPointCloudAlphaShapes(
+            pcd, alphas, tetra_mesh, &pt_map);
+    ASSERT_EQ(meshes.size(), alphas.size());
+    for (size_t i = 0; i < alphas.size(); ++i) {
+        auto mesh = geometry::TriangleMesh::CreateFromPointCloudAlphaShape(
+                pcd, alphas[i]);
+        ExpectMeshEQ(*meshes[i], *mesh);
+        EXPECT_TRUE(meshes[i]->HasVertexColors());
+    }
+    EXPECT_GT(meshes.back()->triangles_.size(), 0u);
+    EXPECT_TRUE(meshes.back()->IsWatertight());
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
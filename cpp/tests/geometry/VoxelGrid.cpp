@@ -26,7 +26,9 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/LineSet.h"
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/Tests.h"
@@ -62,6 +64,70 @@ TEST(VoxelGrid, GetVoxel) {
              Eigen::Vector3i(0, 1, 0));
 }
 
+TEST(VoxelGrid, CreateFromPointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0, 0, 0}, {0.1, 0.2, 0.3}, {2, 0, 0}, {0.4, 0.4, 0.4}};
+    pcd.colors_ = {{1, 0, 0}, {0, 1, 0}, {1, 1, 1}, {0, 0, 1}};
+    auto voxel_grid = geometry::VoxelGrid::CreateFromPointCloud(pcd, 1.0);
+    ExpectEQ(voxel_grid->origin_, Eigen::Vector3d(-0.5, -0.5, -0.5));
+    EXPECT_EQ(voxel_grid->voxels_.size(), 2u);
+    ExpectEQ(voxel_grid->voxels_.at(Eigen::Vector3i(0, 0, 0)).color_,
+             Eigen::Vector3d(1.0 / 3, 1.0 / 3, 1.0 / 3));
+    ExpectEQ(voxel_grid->voxels_.at(Eigen::Vector3i(2, 0, 0)).color_,
+             Eigen::Vector3d(1, 1, 1));
+}
+
+TEST(VoxelGrid, CreateFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    const double voxel_size = 0.15;
+    auto voxel_grid =
+            geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, voxel_size);
+
+    // Compare against testing every triangle with every voxel.
+    const Eigen::Vector3d min_bound = voxel_grid->origin_;
+    const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
+                                        voxel_size / 2);
+    const int num_voxels = int(std::round(
+            (mesh->GetMaxBound()(0) + voxel_size * 0.5 - min_bound(0)) /
+            voxel_size));
+    size_t num_occupied = 0;
+    for (int widx = 0; widx < num_voxels; widx++) {
+        for (int hidx = 0; hidx < num_voxels; hidx++) {
+            for (int didx = 0; didx < num_voxels; didx++) {
+                const Eigen::Vector3d box_center =
+                        min_bound +
+                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
+                bool occupied = false;
+                for (const Eigen::Vector3i &tria : mesh->triangles_) {
+                    if (geometry::IntersectionTest::TriangleAABB(
+                                box_center, box_half_size,
+                                mesh->vertices_[tria(0)],
+                                mesh->vertices_[tria(1)],
+                                mesh->vertices_[tria(2)])) {
+                        occupied = true;
+                        break;
+                    }
+                }
+                EXPECT_EQ(occupied, voxel_grid->voxels_.count(Eigen::Vector3i(
+                                            widx, hidx, didx)) > 0);
+                num_occupied += occupied;
+            }
+        }
+    }
+    EXPECT_GT(num_occupied, 0u);
+    EXPECT_EQ(voxel_grid->voxels_.size(), num_occupied);
+}
+
+TEST(VoxelGrid, CheckIfIncluded) {
+    geometry::VoxelGrid voxel_grid;
+    voxel_grid.origin_ = Eigen::Vector3d(0, 0, 0);
+    voxel_grid.voxel_size_ = 5;
+    voxel_grid.AddVoxel(geometry::Voxel(Eigen::Vector3i(0, 1, 0)));
+    EXPECT_EQ(voxel_grid.CheckIfIncluded(
+                      {{0, 5, 0}, {0, 4.9, 0}, {4.9, 9.9, 4.9}, {-1, 5, 0}}),
+              std::vector<bool>({true, false, true, false}));
+}
+
 TEST(VoxelGrid, Visualization) {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->origin_ = Eigen::Vector3d(0, 0, 0);
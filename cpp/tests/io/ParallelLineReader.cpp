@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ParallelLineReader.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+static bool ParseDoubleString(const std::string &str,
+                              double &value,
+                              size_t &length) {
+    const char *ptr = str.data();
+    const bool parsed =
+            io::ParseDouble(ptr, str.data() + str.size(), value);
+    length = ptr - str.data();
+    return parsed;
+}
+
+TEST(ParallelLineReader, ParseDouble) {
+    // Same value and length as strtod.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> mantissa(-1, 1);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::uniform_int_distribution<int> precision(1, 20);
+    const char *formats[] = {"%.*g", "%.*f", "%.*e"};
+    for (int i = 0; i < 30000; ++i) {
+        char buffer[512];
+        snprintf(buffer, sizeof(buffer), formats[i % 3], precision(rng),
+                 mantissa(rng) * std::pow(10.0, exponent(rng)));
+        double value;
+        size_t length;
+        EXPECT_TRUE(ParseDoubleString(buffer, value, length));
+        char *end;
+        EXPECT_EQ(value, std::strtod(buffer, &end)) << buffer;
+        EXPECT_EQ(length, size_t(end - buffer)) << buffer;
+    }
+
+    for (const std::string str :
+         {"0", "-0", "+3", ".5", "5.", "1e", "1e+", "12abc", "  \t7 8", "1e400",
+          "123456789012345678901234567890", "0.000000000000000000000000001",
+          "9007199254740993", "0x1p3", "inf", "-nan", "1,5"}) {
+        double value;
+        size_t length;
+        EXPECT_TRUE(ParseDoubleString(str, value, length)) << str;
+        char *end;
+        const double expected = std::strtod(str.c_str(), &end);
+        if (std::isnan(expected)) {
+            EXPECT_TRUE(std::isnan(value)) << str;
+        } else {
+            EXPECT_EQ(value, expected) << str;
+            EXPECT_EQ(std::signbit(value), std::signbit(expected)) << str;
+        }
+        EXPECT_EQ(length, size_t(end - str.c_str())) << str;
+    }
+
+    for (const std::string str : {"", " ", "abc", ".", "-", "e5"}) {
+        double value;
+        size_t length;
+        EXPECT_FALSE(ParseDoubleString(str, value, length)) << str;
+    }
+
+    double values[3];
+    const std::string line = "1 2.5\t-3 4";
+    EXPECT_EQ(io::ParseDoubles(line.data(), line.data() + line.size(), values,
+                               3),
+              3);
+    ExpectEQ(std::vector<double>(values, values + 3),
+             std::vector<double>({1, 2.5, -3}));
+    const std::string short_line = "1 2 x";
+    EXPECT_EQ(io::ParseDoubles(short_line.data(),
+                               short_line.data() + short_line.size(), values,
+                               3),
+              2);
+}
+
+TEST(ParallelLineReader, ForEachLine) {
+    const std::string filename = "test_parallel_line_reader.txt";
+    const std::string header = "header line\n";
+    std::vector<std::string> lines;
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file << header;
+        for (int i = 0; i < 100000; ++i) {
+            lines.push_back(std::to_string(i) + (i % 7 ? " a b" : ""));
+            file << lines.back() << (i % 5 ? "\n" : "\r\n");
+        }
+        // No newline at the end of the file.
+        lines.push_back("last");
+        file << lines.back();
+    }
+
+    io::ParallelLineReader reader(filename, header.size());
+    EXPECT_GT(reader.NumChunks(), 0);
+    std::vector<std::vector<std::string>> chunks(reader.NumChunks());
+    reader.ForEachLine([&](int64_t chunk, const char *begin, const char *end) {
+        chunks[chunk].emplace_back(begin, end);
+    });
+    EXPECT_EQ(io::ConcatenateChunks(chunks), lines);
+
+    // Rows are parsed up to the requested number of lines.
+    std::vector<double> values;
+    std::string invalid_line;
+    EXPECT_TRUE(io::ParseRows(reader, 1, 100000, values, invalid_line));
+    ASSERT_EQ(values.size(), 100000u);
+    for (int i = 0; i < 100000; ++i) {
+        EXPECT_EQ(values[i], i);
+    }
+    EXPECT_FALSE(io::ParseRows(reader, 2, 10, values, invalid_line));
+    EXPECT_EQ(invalid_line, "0");
+    EXPECT_TRUE(values.empty());
+    EXPECT_FALSE(io::ParseRows(reader, 1, 100001, values, invalid_line));
+    EXPECT_EQ(invalid_line, "last");
+    EXPECT_EQ(values.size(), 100000u);
+
+    // Nothing after the offset.
+    io::ParallelLineReader empty_reader(filename, 10000000);
+    EXPECT_EQ(empty_reader.NumChunks(), 0);
+    int num_lines = 0;
+    empty_reader.ForEachLine(
+            [&](int64_t, const char *, const char *) { ++num_lines; });
+    EXPECT_EQ(num_lines, 0);
+
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
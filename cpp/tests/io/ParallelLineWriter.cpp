@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ParallelLineWriter.h"
+
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/ProgressReporters.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ParallelLineWriter, WriteLinesInParallel) {
+    // Enough lines for several chunks and batches.
+    const int64_t num_lines = 1000003;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(-1000, 1000);
+    std::vector<double> values(num_lines);
+    for (double &value : values) {
+        value = dist(rng);
+    }
+
+    const std::string filename = "test_parallel_line_writer.txt";
+    int64_t last_progress = 0;
+    utility::CountingProgressReporter reporter([&](double percent) {
+        EXPECT_GE(percent, last_progress);
+        last_progress = int64_t(percent);
+        return true;
+    });
+    reporter.SetTotal(num_lines);
+    {
+        utility::filesystem::CFile file;
+        ASSERT_TRUE(file.Open(filename, "w"));
+        fputs("header\n", file.GetFILE());
+        EXPECT_TRUE(io::WriteLinesInParallel(
+                file.GetFILE(), num_lines,
+                [&](int64_t begin, int64_t end, std::string &text) {
+                    for (int64_t i = begin; i < end; ++i) {
+                        fmt::format_to(std::back_inserter(text), "{} {:.10f}\n",
+                                       i, values[i]);
+                    }
+                },
+                &reporter));
+    }
+    EXPECT_EQ(last_progress, 100);
+
+    // Same text as printf, in order.
+    std::ifstream file(filename);
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line, "header");
+    int64_t num_read = 0;
+    while (std::getline(file, line)) {
+        char expected[64];
+        snprintf(expected, sizeof(expected), "%lld %.10f",
+                 static_cast<long long>(num_read), values[num_read]);
+        if (line != expected) {
+            EXPECT_EQ(line, expected);
+            break;
+        }
+        ++num_read;
+    }
+    EXPECT_EQ(num_read, num_lines);
+    file.close();
+
+    // No lines.
+    {
+        utility::filesystem::CFile empty_file;
+        ASSERT_TRUE(empty_file.Open(filename, "w"));
+        EXPECT_TRUE(io::WriteLinesInParallel(
+                empty_file.GetFILE(), 0,
+                [](int64_t, int64_t, std::string &) { FAIL(); }));
+        EXPECT_EQ(empty_file.GetFileSize(), 0);
+    }
+
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
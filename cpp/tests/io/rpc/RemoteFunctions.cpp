@@ -26,15 +26,20 @@
 
 #include "open3d/io/rpc/RemoteFunctions.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <random>
+#include <thread>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
+#include "open3d/io/rpc/DummyMessageProcessor.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 using namespace open3d::io::rpc;
@@ -153,6 +158,186 @@ TEST_F(RemoteFunctions, SendReceiveUnpackMessages) {
     }
 }
 
+// Keeps the geometry of the last SetMeshData message.
+class GeometryProcessor : public DummyMessageProcessor {
+public:
+    std::shared_ptr<zmq::message_t> ProcessMessage(
+            const messages::Request& req,
+            const messages::SetMeshData& msg,
+            const msgpack::object_handle& obj) override {
+        geometry_ = MeshDataToGeometry(msg.data);
+        return CreateStatusOKMsg();
+    }
+    using DummyMessageProcessor::ProcessMessage;
+
+    std::shared_ptr<t::geometry::Geometry> geometry_;
+};
+
+TEST_F(RemoteFunctions, ArrayTransport) {
+    // Large enough to not be sent inline.
+    const core::Tensor points =
+            core::Tensor::Arange(0, 3000, 1, core::Float32).Reshape({1000, 3});
+    t::geometry::PointCloud pcd(points);
+    pcd.SetPointColors(core::Tensor::Ones({1000, 3}, core::Float32));
+
+    for (ArrayTransport transport :
+         {ArrayTransport::Inline, ArrayTransport::Frames,
+          ArrayTransport::SharedMemory}) {
+        ZMQReceiver receiver(connection_address, 500);
+        auto processor = std::make_shared<GeometryProcessor>();
+        receiver.SetMessageProcessor(processor);
+        receiver.Start();
+
+        auto connection = std::make_shared<Connection>(
+                connection_address, 500, 500, transport);
+        ASSERT_TRUE(SetMeshData(
+                "pcd", 0, "", pcd.GetPointPositions(),
+                {{"colors", pcd.GetPointColors()}},
+                core::Tensor({0}, core::Int32), {},
+                core::Tensor({0}, core::Int32), {}, "", {}, {}, {}, "",
+                connection));
+        receiver.Stop();
+
+        auto received = std::dynamic_pointer_cast<t::geometry::PointCloud>(
+                processor->geometry_);
+        ASSERT_TRUE(received);
+        EXPECT_TRUE(received->GetPointPositions().AllClose(points));
+        EXPECT_TRUE(received->GetPointColors().AllClose(
+                pcd.GetPointColors()));
+    }
+}
+
+TEST_F(RemoteFunctions, MeshDataEncoding) {
+    ZMQReceiver receiver(connection_address, 500);
+    auto processor = std::make_shared<GeometryProcessor>();
+    receiver.SetMessageProcessor(processor);
+    receiver.Start();
+
+    MeshDataEncodingOptions options;
+    options.quantize_positions = true;
+    options.colors_as_uint8 = true;
+    options.compress = true;
+    options.delta = true;
+    options.delta_block_size = 1024;
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    connection->SetMeshDataEncoding(options);
+
+    core::Tensor points =
+            core::Tensor::Arange(0, 3000, 1, core::Float32).Reshape({1000, 3});
+    const core::Tensor colors = core::Tensor::Ones({1000, 3}, core::Float32);
+    for (int time = 0; time < 3; ++time) {
+        // Only the first block changes after the first message.
+        points[0][0] = float(time);
+        ASSERT_TRUE(SetMeshData("pcd", time, "", points, {{"colors", colors}},
+                                core::Tensor({0}, core::Int32), {},
+                                core::Tensor({0}, core::Int32), {}, "", {},
+                                {}, {}, "", connection));
+        auto received = std::dynamic_pointer_cast<t::geometry::PointCloud>(
+                processor->geometry_);
+        ASSERT_TRUE(received);
+        // The quantization step is 2999 / 65535.
+        EXPECT_TRUE(received->GetPointPositions().AllClose(points, 0, 0.03));
+        EXPECT_TRUE(received->GetPointColors().AllClose(colors));
+    }
+    receiver.Stop();
+
+    // A new receiver has no base for the delta update, which is then sent in
+    // full.
+    ZMQReceiver new_receiver(connection_address, 500);
+    processor = std::make_shared<GeometryProcessor>();
+    new_receiver.SetMessageProcessor(processor);
+    new_receiver.Start();
+    points[0][0] = 3.f;
+    ASSERT_TRUE(SetMeshData("pcd", 3, "", points, {{"colors", colors}},
+                            core::Tensor({0}, core::Int32), {},
+                            core::Tensor({0}, core::Int32), {}, "", {}, {}, {},
+                            "", connection));
+    auto received = std::dynamic_pointer_cast<t::geometry::PointCloud>(
+            processor->geometry_);
+    ASSERT_TRUE(received);
+    EXPECT_TRUE(received->GetPointPositions().AllClose(points, 0, 0.03));
+    new_receiver.Stop();
+}
+
+TEST_F(RemoteFunctions, ReceiverWorkerPool) {
+    // Blocks set_mesh_data messages until released and counts them by path.
+    class BlockingProcessor : public DummyMessageProcessor {
+    public:
+        std::shared_ptr<zmq::message_t> ProcessMessage(
+                const messages::Request& req,
+                const messages::SetMeshData& msg,
+                const msgpack::object_handle& obj) override {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ++num_received_[msg.path];
+            changed_.notify_all();
+            changed_.wait(lock, [this]() { return released_; });
+            return CreateStatusOKMsg();
+        }
+        using DummyMessageProcessor::ProcessMessage;
+
+        void WaitForReceived(const std::string& path, int num) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            changed_.wait(lock, [&]() { return num_received_[path] >= num; });
+        }
+        void Release() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            released_ = true;
+            changed_.notify_all();
+        }
+
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        std::map<std::string, int> num_received_;
+        bool released_ = false;
+    };
+
+    ZMQReceiver receiver(connection_address, 500, 2);
+    auto processor = std::make_shared<BlockingProcessor>();
+    receiver.SetMessageProcessor(processor);
+    receiver.Start();
+
+    geometry::PointCloud pcd;
+    pcd.points_.push_back(Eigen::Vector3d(1, 2, 3));
+    auto send_async = [&](const std::string& path, bool& result) {
+        return std::thread([&, path]() {
+            auto connection = std::make_shared<Connection>(connection_address,
+                                                           500, 5000);
+            result = SetPointCloud(pcd, path, 0, "", connection);
+        });
+    };
+
+    // Both workers block on the meshes of a and b.
+    bool result_a = false, result_b1 = false;
+    std::thread sender_a = send_async("a", result_a);
+    processor->WaitForReceived("a", 1);
+    std::thread sender_b1 = send_async("b", result_b1);
+    processor->WaitForReceived("b", 1);
+
+    // Small messages do not wait for the meshes.
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    EXPECT_TRUE(SetTime(1, connection));
+
+    // The pending mesh of b is superseded by a newer one.
+    bool result_b2 = false, result_b3 = false;
+    std::thread sender_b2 = send_async("b", result_b2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::thread sender_b3 = send_async("b", result_b3);
+    sender_b2.join();
+    EXPECT_TRUE(result_b2);
+
+    processor->Release();
+    for (std::thread* sender : {&sender_a, &sender_b1, &sender_b3}) {
+        sender->join();
+    }
+    EXPECT_TRUE(result_a);
+    EXPECT_TRUE(result_b1);
+    EXPECT_TRUE(result_b3);
+    EXPECT_EQ(processor->num_received_["b"], 2);
+    receiver.Stop();
+}
+
 TEST_F(RemoteFunctions, SendGarbage) {
     std::mt19937 rng;
     rng.seed(123);
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/sensor/AsyncFrameWriter.h"
+
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(AsyncFrameWriter, Submit) {
+    std::vector<int> written;
+    {
+        io::AsyncFrameWriter writer(4, /*block_when_full=*/true);
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_TRUE(writer.Submit([&written, i]() {
+                written.push_back(i);
+                return i % 10 != 0;
+            }));
+        }
+        writer.Flush();
+        const io::AsyncFrameWriterStatistics statistics =
+                writer.GetStatistics();
+        EXPECT_EQ(statistics.num_written, 90);
+        EXPECT_EQ(statistics.num_failed, 10);
+        EXPECT_EQ(statistics.num_dropped, 0);
+        EXPECT_EQ(statistics.queue_depth, 0u);
+        EXPECT_LE(statistics.max_queue_depth, 4u);
+    }
+    ASSERT_EQ(written.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(written[i], i);
+    }
+}
+
+TEST(AsyncFrameWriter, DropWhenFull) {
+    std::mutex stall;
+    std::unique_lock<std::mutex> stall_lock(stall);
+    auto frame = std::make_shared<int>(0);
+    io::AsyncFrameWriter writer(2);
+    // Stalls the writer thread until stall_lock is released.
+    EXPECT_TRUE(writer.Submit([&stall]() {
+        std::lock_guard<std::mutex> lock(stall);
+        return true;
+    }));
+    while (writer.GetStatistics().queue_depth > 0) {
+        std::this_thread::yield();
+    }
+    int num_submitted = 0;
+    for (int i = 0; i < 5; ++i) {
+        num_submitted += writer.Submit([frame]() { return true; });
+    }
+    EXPECT_EQ(num_submitted, 2);
+    // Dropped functions release their frames.
+    EXPECT_EQ(frame.use_count(), 3);
+    EXPECT_EQ(writer.GetStatistics().num_dropped, 3);
+    EXPECT_EQ(writer.GetStatistics().queue_depth, 2u);
+
+    stall_lock.unlock();
+    writer.Flush();
+    EXPECT_EQ(frame.use_count(), 1);
+    EXPECT_EQ(writer.GetStatistics().num_written, 3);
+}
+
+}  // namespace tests
+}  // namespace open3d
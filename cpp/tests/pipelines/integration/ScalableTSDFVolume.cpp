@@ -24,6 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <set>
+#include <tuple>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -39,7 +46,59 @@ TEST(ScalableTSDFVolume, DISABLED_MemberData) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Reset) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { NotImplemented(); }
+TEST(ScalableTSDFVolume, Integrate) {
+    // A colored plane at depth 1, seen by a camera at the origin.
+    const int width = 64;
+    const int height = 48;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 60.0, 60.0, 31.5,
+                                             23.5);
+    geometry::Image depth;
+    depth.Prepare(width, height, 1, 4);
+    geometry::Image color;
+    color.Prepare(width, height, 3, 1);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *depth.PointerAt<float>(u, v) = 1.0f;
+            *color.PointerAt<uint8_t>(u, v, 0) = 255;
+            *color.PointerAt<uint8_t>(u, v, 1) = 51;
+            *color.PointerAt<uint8_t>(u, v, 2) = 0;
+        }
+    }
+    geometry::RGBDImage rgbd(color, depth);
+
+    const double voxel_length = 0.01;
+    pipelines::integration::ScalableTSDFVolume volume(
+            voxel_length, 0.04,
+            pipelines::integration::TSDFVolumeColorType::RGB8, 16, 1);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_GT(volume.volume_units_.size(), 1u);
+
+    // The vertices shared between the volume units must be merged.
+    auto mesh = volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+    ASSERT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    std::set<std::tuple<double, double, double>> positions;
+    for (size_t i = 0; i < mesh->vertices_.size(); ++i) {
+        const Eigen::Vector3d &vertex = mesh->vertices_[i];
+        EXPECT_NEAR(vertex(2), 1.0, voxel_length);
+        ExpectEQ(mesh->vertex_colors_[i], Eigen::Vector3d(1.0, 0.2, 0.0));
+        positions.emplace(vertex(0), vertex(1), vertex(2));
+    }
+    EXPECT_EQ(positions.size(), mesh->vertices_.size());
+    for (const auto &triangle : mesh->triangles_) {
+        EXPECT_GE(triangle.minCoeff(), 0);
+        EXPECT_LT(triangle.maxCoeff(), int(mesh->vertices_.size()));
+    }
+
+    auto pcd = volume.ExtractPointCloud();
+    ASSERT_GT(pcd->points_.size(), 0u);
+    ASSERT_EQ(pcd->normals_.size(), pcd->points_.size());
+    ASSERT_EQ(pcd->colors_.size(), pcd->points_.size());
+    for (size_t i = 0; i < pcd->points_.size(); ++i) {
+        EXPECT_NEAR(pcd->points_[i](2), 1.0, voxel_length);
+        ExpectEQ(pcd->colors_[i], Eigen::Vector3d(1.0, 0.2, 0.0));
+    }
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) { NotImplemented(); }
 
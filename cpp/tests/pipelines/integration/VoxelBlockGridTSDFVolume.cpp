@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/integration/VoxelBlockGridTSDFVolume.h"
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelBlockGridTSDFVolumePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelBlockGridTSDFVolume,
+                         VoxelBlockGridTSDFVolumePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(VoxelBlockGridTSDFVolumePermuteDevices, Integrate) {
+    const core::Device device = GetParam();
+
+    // A colored plane seen by a camera at the origin. The plane is off the
+    // voxel grid, so that the TSDF changes sign between two voxels.
+    const double plane_depth = 0.987;
+    const int width = 64;
+    const int height = 48;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 60.0, 60.0, 31.5,
+                                             23.5);
+    geometry::Image depth;
+    depth.Prepare(width, height, 1, 4);
+    geometry::Image color;
+    color.Prepare(width, height, 3, 1);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *depth.PointerAt<float>(u, v) = float(plane_depth);
+            *color.PointerAt<uint8_t>(u, v, 0) = 255;
+            *color.PointerAt<uint8_t>(u, v, 1) = 51;
+            *color.PointerAt<uint8_t>(u, v, 2) = 0;
+        }
+    }
+    geometry::RGBDImage rgbd(color, depth);
+
+    const double voxel_length = 0.01;
+    pipelines::integration::VoxelBlockGridTSDFVolume volume(
+            voxel_length, 0.04,
+            pipelines::integration::TSDFVolumeColorType::RGB8, 16, 1000,
+            device);
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    volume.Integrate(rgbd, intrinsic, Eigen::Matrix4d::Identity());
+    EXPECT_GT(volume.GetVoxelBlockGrid().GetHashMap().Size(), 1);
+
+    auto mesh = volume.ExtractTriangleMesh();
+    ASSERT_GT(mesh->triangles_.size(), 0u);
+    ASSERT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    for (size_t i = 0; i < mesh->vertices_.size(); ++i) {
+        EXPECT_NEAR(mesh->vertices_[i](2), plane_depth, voxel_length);
+        ExpectEQ(mesh->vertex_colors_[i], Eigen::Vector3d(1.0, 0.2, 0.0),
+                 1e-4);
+    }
+
+    auto pcd = volume.ExtractPointCloud();
+    ASSERT_GT(pcd->points_.size(), 0u);
+    ASSERT_EQ(pcd->colors_.size(), pcd->points_.size());
+    for (size_t i = 0; i < pcd->points_.size(); ++i) {
+        EXPECT_NEAR(pcd->points_[i](2), plane_depth, voxel_length);
+        ExpectEQ(pcd->colors_[i], Eigen::Vector3d(1.0, 0.2, 0.0), 1e-4);
+    }
+
+    volume.Reset();
+    EXPECT_EQ(volume.GetVoxelBlockGrid().GetHashMap().Size(), 0);
+    EXPECT_TRUE(volume.ExtractTriangleMesh()->IsEmpty());
+}
+
+}  // namespace tests
+}  // namespace open3d
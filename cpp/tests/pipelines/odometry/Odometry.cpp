@@ -24,12 +24,73 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include <cmath>
+
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/Tests.h"
 
 namespace open3d {
 namespace tests {
 
-TEST(Odometry, DISABLED_ComputeRGBDOdometry) { NotImplemented(); }
+// Textured slanted plane seen by a 64x48 camera.
+static geometry::RGBDImage CreateTexturedPlane() {
+    const int width = 64;
+    const int height = 48;
+    geometry::Image color;
+    geometry::Image depth;
+    color.Prepare(width, height, 1, 4);
+    depth.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; v++) {
+        for (int u = 0; u < width; u++) {
+            *color.PointerAt<float>(u, v) = float(
+                    0.5 + 0.25 * std::sin(0.3 * u) * std::cos(0.2 * v));
+            *depth.PointerAt<float>(u, v) = float(1.0 + 0.005 * u);
+        }
+    }
+    return geometry::RGBDImage(color, depth);
+}
+
+TEST(Odometry, ComputeRGBDOdometry) {
+    const geometry::RGBDImage rgbd = CreateTexturedPlane();
+    const camera::PinholeCameraIntrinsic intrinsic(64, 48, 60.0, 60.0, 31.5,
+                                                   23.5);
+    pipelines::odometry::OdometryOption option;
+    option.max_depth_diff_ = 0.07;
+
+    bool success;
+    Eigen::Matrix4d transformation;
+    Eigen::Matrix6d information;
+    std::tie(success, transformation, information) =
+            pipelines::odometry::ComputeRGBDOdometry(
+                    rgbd, rgbd, intrinsic, Eigen::Matrix4d::Identity(),
+                    pipelines::odometry::RGBDOdometryJacobianFromHybridTerm(),
+                    option);
+    EXPECT_TRUE(success);
+    ExpectEQ(transformation, Eigen::Matrix4d(Eigen::Matrix4d::Identity()),
+             1e-6);
+
+    // A frame prepared once gives the same result for every pair it is in.
+    const pipelines::odometry::RGBDOdometryFrame frame(rgbd, intrinsic,
+                                                       option);
+    EXPECT_EQ(frame.pyramid_.size(), 3u);
+    EXPECT_EQ(frame.xyz_pyramid_.size(), 3u);
+    for (int i = 0; i < 2; i++) {
+        bool frame_success;
+        Eigen::Matrix4d frame_transformation;
+        Eigen::Matrix6d frame_information;
+        std::tie(frame_success, frame_transformation, frame_information) =
+                pipelines::odometry::ComputeRGBDOdometry(
+                        frame, frame, Eigen::Matrix4d::Identity(),
+                        pipelines::odometry::
+                                RGBDOdometryJacobianFromHybridTerm(),
+                        option);
+        EXPECT_TRUE(frame_success);
+        ExpectEQ(frame_transformation, transformation);
+        ExpectEQ(frame_information, information);
+    }
+}
 
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { NotImplemented(); }
 
@@ -24,6 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/FastGlobalRegistration.h"
+
+#include <random>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/pipelines/registration/Registration.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -39,5 +46,41 @@ TEST(FastGlobalRegistration, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(FastGlobalRegistration, DISABLED_MemberData) { NotImplemented(); }
 
+TEST(FastGlobalRegistration, FastGlobalRegistration) {
+    const int num_points = 200;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    Eigen::Matrix4d transformation;
+    transformation << 0.8, -0.6, 0.0, 0.5, 0.6, 0.8, 0.0, -0.2, 0.0, 0.0, 1.0,
+            0.1, 0.0, 0.0, 0.0, 1.0;
+
+    geometry::PointCloud source;
+    pipelines::registration::Feature source_feature;
+    source_feature.Resize(8, num_points);
+    for (int i = 0; i < num_points; i++) {
+        source.points_.emplace_back(uniform(rng), uniform(rng), uniform(rng));
+        for (int k = 0; k < 8; k++) {
+            source_feature.data_(k, i) = uniform(rng);
+        }
+    }
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+    // The last 40 target points get unrelated features.
+    pipelines::registration::Feature target_feature = source_feature;
+    for (int i = 160; i < num_points; i++) {
+        for (int k = 0; k < 8; k++) {
+            target_feature.data_(k, i) = uniform(rng);
+        }
+    }
+
+    pipelines::registration::FastGlobalRegistrationOption option;
+    option.seed_ = 0;
+    pipelines::registration::RegistrationResult result =
+            pipelines::registration::FastGlobalRegistration(
+                    source, target, source_feature, target_feature, option);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-3);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-6);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -33,8 +41,71 @@ TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    NotImplemented();
+// A loop of nodes with exact odometry and loop closure edges. The initial
+// poses drift away from the loop, except for the reference node.
+static pipelines::registration::PoseGraph CreateLoopPoseGraph(
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &poses) {
+    const int n_nodes = 40;
+    poses.clear();
+    for (int i = 0; i < n_nodes; i++) {
+        const double angle = 2.0 * M_PI * i / n_nodes;
+        Eigen::Vector6d pose;
+        pose << 0.1 * std::sin(angle), 0.0, angle, std::cos(angle),
+                std::sin(angle), 0.05 * i;
+        poses.push_back(utility::TransformVector6dToMatrix4d(pose));
+    }
+
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d drift;
+        drift << 0.002 * i, -0.001 * i, 0.003 * i, 0.01 * i, 0.005 * i,
+                -0.01 * i;
+        pose_graph.nodes_.emplace_back(
+                utility::TransformVector6dToMatrix4d(drift) * poses[i]);
+    }
+    auto add_edge = [&](int s, int t, bool uncertain) {
+        pose_graph.edges_.emplace_back(s, t, poses[t].inverse() * poses[s],
+                                       Eigen::Matrix6d::Identity() * 100.0,
+                                       uncertain);
+    };
+    for (int i = 0; i + 1 < n_nodes; i++) {
+        add_edge(i, i + 1, false);
+    }
+    for (int i = 0; i + 5 < n_nodes; i += 3) {
+        add_edge(i, i + 5, true);
+    }
+    add_edge(n_nodes - 1, 0, true);
+    return pose_graph;
+}
+
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    pipelines::registration::PoseGraph pose_graph = CreateLoopPoseGraph(poses);
+    const size_t n_edges = pose_graph.edges_.size();
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationLevenbergMarquardt(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            pipelines::registration::GlobalOptimizationOption(0.075, 0.25, 1.0,
+                                                              0));
+    EXPECT_EQ(pose_graph.edges_.size(), n_edges);
+    for (size_t i = 0; i < poses.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-4);
+    }
+}
+
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    pipelines::registration::PoseGraph pose_graph = CreateLoopPoseGraph(poses);
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationGaussNewton(),
+            pipelines::registration::GlobalOptimizationConvergenceCriteria(),
+            pipelines::registration::GlobalOptimizationOption(0.075, 0.25, 1.0,
+                                                              0));
+    for (size_t i = 0; i < poses.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-4);
+    }
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/pipelines/registration/MultiwayRegistration.h"
+
+#include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(MultiwayRegistration, ComputeCandidateFragmentPairs) {
+    const geometry::AxisAlignedBoundingBox box(Eigen::Vector3d(0.0, 0.0, 0.0),
+                                               Eigen::Vector3d(1.0, 1.0, 1.0));
+    const std::vector<geometry::AxisAlignedBoundingBox> boxes(4, box);
+
+    // Without poses, all pairs are candidates.
+    EXPECT_EQ(pipelines::registration::ComputeCandidateFragmentPairs(boxes)
+                      .size(),
+              6u);
+
+    // Fragment 2 is far away from 0, but consecutive to 1 and 3. Fragment 3
+    // is rotated back next to 0.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses(
+            4, Eigen::Matrix4d::Identity());
+    poses[1].block<3, 1>(0, 3) = Eigen::Vector3d(0.5, 0.0, 0.0);
+    poses[2].block<3, 1>(0, 3) = Eigen::Vector3d(5.0, 0.0, 0.0);
+    poses[3].block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(M_PI, Eigen::Vector3d(0.0, 0.0, 1.0))
+                    .toRotationMatrix();
+    poses[3].block<3, 1>(0, 3) = Eigen::Vector3d(1.5, 1.0, 0.0);
+    std::vector<Eigen::Vector2i> pairs =
+            pipelines::registration::ComputeCandidateFragmentPairs(boxes,
+                                                                   poses);
+    ExpectEQ(pairs, std::vector<Eigen::Vector2i>({{0, 1}, {0, 3}, {1, 2},
+                                                  {1, 3}, {2, 3}}));
+
+    // A large enough margin makes the boxes of fragments 0 and 2 overlap.
+    poses[2].block<3, 1>(0, 3) = Eigen::Vector3d(1.6, 0.0, 1.6);
+    pairs = pipelines::registration::ComputeCandidateFragmentPairs(boxes,
+                                                                   poses, 0.1);
+    ExpectEQ(pairs, std::vector<Eigen::Vector2i>(
+                            {{0, 1}, {0, 3}, {1, 2}, {1, 3}, {2, 3}}));
+    pairs = pipelines::registration::ComputeCandidateFragmentPairs(boxes,
+                                                                   poses, 0.4);
+    ExpectEQ(pairs, std::vector<Eigen::Vector2i>({{0, 1}, {0, 2}, {0, 3},
+                                                  {1, 2}, {1, 3}, {2, 3}}));
+}
+
+// Three views of the same points, from known poses.
+static std::vector<std::shared_ptr<geometry::PointCloud>> CreateFragments(
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &poses) {
+    geometry::PointCloud points;
+    points.points_.resize(300);
+    Rand(points.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    poses.assign(3, Eigen::Matrix4d::Identity());
+    poses[1].block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(0.0, 0.0, 1.0))
+                    .toRotationMatrix();
+    poses[1].block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.01);
+    poses[2].block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(-0.04, Eigen::Vector3d(1.0, 0.0, 0.0))
+                    .toRotationMatrix();
+    poses[2].block<3, 1>(0, 3) = Eigen::Vector3d(-0.01, 0.03, 0.02);
+
+    std::vector<std::shared_ptr<geometry::PointCloud>> fragments;
+    for (const Eigen::Matrix4d &pose : poses) {
+        auto fragment = std::make_shared<geometry::PointCloud>(points);
+        fragment->Transform(pose.inverse());
+        fragments.push_back(fragment);
+    }
+    return fragments;
+}
+
+TEST(MultiwayRegistration, CreatePoseGraphFromPointClouds) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    const std::vector<std::shared_ptr<geometry::PointCloud>> fragments =
+            CreateFragments(poses);
+    pipelines::registration::MultiwayRegistrationOption option(0.2);
+    option.icp_criteria_ =
+            pipelines::registration::ICPConvergenceCriteria(1e-9, 1e-9, 100);
+
+    // ICP from identity, the nodes are chained from the odometry edges.
+    pipelines::registration::PoseGraph pose_graph =
+            pipelines::registration::CreatePoseGraphFromPointClouds(
+                    fragments, {}, {}, option);
+    ASSERT_EQ(pose_graph.nodes_.size(), 3u);
+    ASSERT_EQ(pose_graph.edges_.size(), 3u);
+    for (int i = 0; i < 3; i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-6);
+    }
+    const std::vector<Eigen::Vector2i> pairs({{0, 1}, {0, 2}, {1, 2}});
+    for (size_t i = 0; i < pairs.size(); i++) {
+        const pipelines::registration::PoseGraphEdge &edge =
+                pose_graph.edges_[i];
+        const int s = pairs[i](0), t = pairs[i](1);
+        EXPECT_EQ(edge.source_node_id_, s);
+        EXPECT_EQ(edge.target_node_id_, t);
+        EXPECT_EQ(edge.uncertain_, t != s + 1);
+        ExpectEQ(Eigen::Matrix4d(edge.transformation_),
+                 Eigen::Matrix4d(poses[t].inverse() * poses[s]), 1e-6);
+        EXPECT_GT(edge.information_(5, 5), 0.0);
+    }
+
+    // The feature of a point is its index, so features match exactly and
+    // RANSAC finds the poses.
+    std::vector<std::shared_ptr<pipelines::registration::Feature>> features;
+    for (size_t f = 0; f < fragments.size(); f++) {
+        auto feature = std::make_shared<pipelines::registration::Feature>();
+        feature->Resize(1, int(fragments[f]->points_.size()));
+        for (int i = 0; i < int(feature->Num()); i++) {
+            feature->data_(0, i) = i;
+        }
+        features.push_back(feature);
+    }
+    option.seed_ = 0;
+    pose_graph = pipelines::registration::CreatePoseGraphFromPointClouds(
+            fragments, features, {}, option);
+    ASSERT_EQ(pose_graph.edges_.size(), 3u);
+    for (size_t i = 0; i < pairs.size(); i++) {
+        const int s = pairs[i](0), t = pairs[i](1);
+        ExpectEQ(Eigen::Matrix4d(pose_graph.edges_[i].transformation_),
+                 Eigen::Matrix4d(poses[t].inverse() * poses[s]), 1e-6);
+    }
+
+    // Initial poses are kept as node poses. A fitness above 1 rejects all
+    // pairs.
+    option.min_fitness_ = 1.1;
+    pose_graph = pipelines::registration::CreatePoseGraphFromPointClouds(
+            fragments, {}, poses, option);
+    ASSERT_EQ(pose_graph.nodes_.size(), 3u);
+    EXPECT_EQ(pose_graph.edges_.size(), 0u);
+    for (int i = 0; i < 3; i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-12);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -24,6 +24,10 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Registration.h"
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -43,14 +47,86 @@ TEST(Registration, DISABLED_RegistrationResult) { NotImplemented(); }
 
 TEST(Registration, DISABLED_EvaluateRegistration) { NotImplemented(); }
 
-TEST(Registration, DISABLED_RegistrationICP) { NotImplemented(); }
+TEST(Registration, RegistrationICP) {
+    geometry::PointCloud target;
+    target.points_.resize(1000);
+    Rand(target.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(0.0, 0.0, 1.0))
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.01);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    const pipelines::registration::ICPConvergenceCriteria criteria(1e-9, 1e-9,
+                                                                   100);
+    const pipelines::registration::RegistrationResult result =
+            pipelines::registration::RegistrationICP(
+                    source, target, 0.2, Eigen::Matrix4d::Identity(),
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    criteria);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-6);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+
+    // A prebuilt target index gives the same result.
+    const geometry::KDTreeFlann target_kdtree(target);
+    const pipelines::registration::RegistrationResult result_kdtree =
+            pipelines::registration::RegistrationICP(
+                    source, target, target_kdtree, 0.2,
+                    Eigen::Matrix4d::Identity(),
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    criteria);
+    ExpectEQ(Eigen::Matrix4d(result_kdtree.transformation_),
+             Eigen::Matrix4d(result.transformation_), 1e-9);
+    EXPECT_EQ(result_kdtree.correspondence_set_.size(),
+              result.correspondence_set_.size());
+}
 
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
-    NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnCorrespondence) {
+    geometry::PointCloud target;
+    target.points_.resize(200);
+    Rand(target.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+         Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1.0, 1.0, 0.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.1);
+    geometry::PointCloud source = target;
+    source.Transform(transformation.inverse());
+
+    // The first 140 correspondences are right, the others are shifted.
+    pipelines::registration::CorrespondenceSet corres(target.points_.size());
+    for (int i = 0; i < int(corres.size()); i++) {
+        corres[i] = Eigen::Vector2i(i, i < 140 ? i : (i + 17) % 200);
+    }
+
+    // The distance checker is listed first, but the edge length checker
+    // runs before the transformation is estimated.
+    const pipelines::registration::CorrespondenceCheckerBasedOnDistance
+            distance_checker(0.05);
+    const pipelines::registration::CorrespondenceCheckerBasedOnEdgeLength
+            edge_length_checker(0.9);
+    const pipelines::registration::RegistrationResult result =
+            pipelines::registration::RegistrationRANSACBasedOnCorrespondence(
+                    source, target, corres, 0.05,
+                    pipelines::registration::
+                            TransformationEstimationPointToPoint(false),
+                    3, {distance_checker, edge_length_checker},
+                    pipelines::registration::RANSACConvergenceCriteria(1000,
+                                                                       0.999),
+                    0);
+    ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation, 1e-6);
+    EXPECT_NEAR(result.fitness_, 0.7, 1e-12);
+    EXPECT_EQ(result.correspondence_set_.size(), 140u);
 }
 
 TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/geometry/BoundingVolume.h"
+
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class BoundingVolumePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(BoundingVolume,
+                         BoundingVolumePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Three clusters: the corners of a box with extents {4, 2, 1} rotated by 30
+// degrees about z, a single point and an empty cluster.
+static core::RaggedTensor BoxClusters(const core::Dtype &dtype,
+                                      const core::Device &device) {
+    const double c = std::cos(M_PI / 6), s = std::sin(M_PI / 6);
+    std::vector<double> values;
+    for (int i = 0; i < 8; ++i) {
+        const double x = i & 1 ? 2 : -2;
+        const double y = i & 2 ? 1 : -1;
+        const double z = i & 4 ? 0.5 : -0.5;
+        values.insert(values.end(),
+                      {c * x - s * y + 1, s * x + c * y + 2, z + 3});
+    }
+    values.insert(values.end(), {5, 6, 7});
+    return core::RaggedTensor(
+            core::Tensor(values, {9, 3}, core::Float64, device).To(dtype),
+            core::Tensor::Init<int64_t>({0, 8, 9, 9}, device));
+}
+
+TEST_P(BoundingVolumePermuteDevices, ComputeAxisAlignedBoundingBoxes) {
+    const core::Device device = GetParam();
+
+    for (const core::Dtype &dtype : {core::Float32, core::Float64}) {
+        core::RaggedTensor points(
+                core::Tensor::Init<double>(
+                        {{0, 0, 0}, {1, -2, 3}, {-1, 4, 2}, {5, 5, 5}}, device)
+                        .To(dtype),
+                core::Tensor::Init<int64_t>({0, 3, 4, 4}, device));
+        core::Tensor min_bounds, max_bounds;
+        std::tie(min_bounds, max_bounds) =
+                t::geometry::bounding_volume::ComputeAxisAlignedBoundingBoxes(
+                        points);
+        EXPECT_TRUE(min_bounds.AllClose(
+                core::Tensor::Init<double>(
+                        {{-1, -2, 0}, {5, 5, 5}, {0, 0, 0}}, device)
+                        .To(dtype)));
+        EXPECT_TRUE(max_bounds.AllClose(
+                core::Tensor::Init<double>(
+                        {{1, 4, 3}, {5, 5, 5}, {0, 0, 0}}, device)
+                        .To(dtype)));
+    }
+}
+
+TEST_P(BoundingVolumePermuteDevices, ComputeOrientedBoundingBoxes) {
+    const core::Device device = GetParam();
+    const double c = std::cos(M_PI / 6), s = std::sin(M_PI / 6);
+
+    for (const core::Dtype &dtype : {core::Float32, core::Float64}) {
+        const core::RaggedTensor points = BoxClusters(dtype, device);
+        const core::Tensor expected_centers =
+                core::Tensor::Init<double>({{1, 2, 3}, {5, 6, 7}, {0, 0, 0}},
+                                           device)
+                        .To(dtype);
+        const core::Tensor expected_axes =
+                core::Tensor::Init<double>(
+                        {{c, -s, 0}, {s, c, 0}, {0, 0, 1}}, device)
+                        .To(dtype);
+
+        core::Tensor centers, rotations, extents;
+        std::tie(centers, rotations, extents) =
+                t::geometry::bounding_volume::ComputeOrientedBoundingBoxes(
+                        points,
+                        t::geometry::bounding_volume::
+                                OrientedBoundingBoxMethod::PCA);
+        EXPECT_EQ(rotations.GetShape(), core::SizeVector({3, 3, 3}));
+        EXPECT_TRUE(centers.AllClose(expected_centers, 1e-4, 1e-4));
+        EXPECT_TRUE(extents.AllClose(
+                core::Tensor::Init<double>({{4, 2, 1}, {0, 0, 0}, {0, 0, 0}},
+                                           device)
+                        .To(dtype),
+                1e-4, 1e-4));
+        // The axes are unique up to their sign.
+        EXPECT_TRUE(rotations[0]
+                            .T()
+                            .Matmul(expected_axes)
+                            .Abs()
+                            .AllClose(core::Tensor::Eye(3, dtype, device),
+                                      1e-4, 1e-4));
+        EXPECT_TRUE(rotations[0].Matmul(rotations[0].T()).AllClose(
+                core::Tensor::Eye(3, dtype, device), 1e-4, 1e-4));
+
+        // Add points inside the box, which do not change the minimal
+        // footprint.
+        core::Tensor values = points.GetValues();
+        const core::Tensor inner =
+                (values.Slice(0, 0, 8) - values.Slice(0, 0, 8).Mean({0})) *
+                        0.5 +
+                values.Slice(0, 0, 8).Mean({0});
+        const core::RaggedTensor upright_points(
+                core::Concatenate({inner, values}),
+                core::Tensor::Init<int64_t>({0, 16, 17, 17}, device));
+        std::tie(centers, rotations, extents) =
+                t::geometry::bounding_volume::ComputeOrientedBoundingBoxes(
+                        upright_points,
+                        t::geometry::bounding_volume::
+                                OrientedBoundingBoxMethod::MinimalUprightArea);
+        EXPECT_TRUE(centers.AllClose(expected_centers, 1e-4, 1e-4));
+        EXPECT_TRUE(rotations[0]
+                            .T()
+                            .Matmul(expected_axes)
+                            .Abs()
+                            .AllClose(core::Tensor::Eye(3, dtype, device),
+                                      1e-4, 1e-4));
+        EXPECT_TRUE(extents.AllClose(
+                core::Tensor::Init<double>({{4, 2, 1}, {0, 0, 0}, {0, 0, 0}},
+                                           device)
+                        .To(dtype),
+                1e-4, 1e-4));
+        EXPECT_TRUE(rotations[1].AllClose(core::Tensor::Eye(3, dtype, device)));
+    }
+}
+
+TEST_P(BoundingVolumePermuteDevices, ComputeConvexHulls) {
+    const core::Device device = GetParam();
+
+    // The box corners and the box center, then a single point.
+    const core::RaggedTensor box = BoxClusters(core::Float64, device);
+    const core::Tensor values = core::Concatenate(
+            {box.GetValues().Slice(0, 0, 8),
+             core::Tensor::Init<double>({{1, 2, 3}, {5, 6, 7}}, device)});
+    const core::RaggedTensor hulls =
+            t::geometry::bounding_volume::ComputeConvexHulls(
+                    core::RaggedTensor(values, core::Tensor::Init<int64_t>(
+                                                       {0, 9, 10}, device)));
+    EXPECT_EQ(hulls.GetDevice(), device);
+    EXPECT_EQ(hulls.GetRowLengths().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({12, 0}));
+    const core::Tensor triangles = hulls[0];
+    EXPECT_EQ(triangles.Min({0, 1}).Item<int64_t>(), 0);
+    EXPECT_EQ(triangles.Max({0, 1}).Item<int64_t>(), 7);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -31,6 +31,7 @@
 #include "core/CoreTest.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/utility/Preprocessor.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
@@ -174,9 +175,7 @@ TEST_P(ImagePermuteDevices, Copy) {
 
 // Test automatic scale determination for conversion from UInt8 / UInt16 ->
 // Float32/64 and LinearTransform().
-// Currently needs IPP.
-TEST_P(ImagePermuteDevices,
-       OPEN3D_CONCAT(IPP_CONDITIONAL_TEST_STR, To_LinearTransform)) {
+TEST_P(ImagePermuteDevices, To_LinearTransform) {
     using ::testing::ElementsAreArray;
     using ::testing::FloatEq;
     core::Device device = GetParam();
@@ -208,6 +207,26 @@ TEST_P(ImagePermuteDevices,
                 ElementsAreArray(input_data));
 }
 
+// Conversion to integer types rounds and saturates.
+TEST_P(ImagePermuteDevices, To_Saturate) {
+    core::Device device = GetParam();
+
+    t::geometry::Image input(core::Tensor::Init<float>(
+            {{{-1.f}, {0.4f}}, {{0.6f}, {300.f}}}, device));
+    t::geometry::Image output = input.To(core::UInt8);
+    EXPECT_EQ(output.AsTensor().ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({0, 0, 1, 255}));
+
+    output = input.To(core::Int32, false, 2.0, 1.0);
+    EXPECT_EQ(output.AsTensor().ToFlatVector<int>(),
+              std::vector<int>({-1, 2, 2, 601}));
+
+    // Int64 is not supported by IPP.
+    output = input.To(core::Int64);
+    EXPECT_EQ(output.AsTensor().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({-1, 0, 1, 300}));
+}
+
 TEST_P(ImagePermuteDevices, FilterBilateral) {
     core::Device device = GetParam();
 
@@ -531,6 +550,46 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
     }
 }
 
+TEST_P(ImagePermuteDevices, FilterPreallocated) {
+    core::Device device = GetParam();
+
+    core::Tensor data = core::Tensor::Arange(0, 25, 1, core::Float32, device)
+                                .Reshape({5, 5, 1});
+    t::geometry::Image im(data);
+
+    // Neighbourhood filters cannot write into their own input.
+    EXPECT_ANY_THROW(im.FilterGaussian(im));
+    t::geometry::Image im_alias(data);
+    EXPECT_ANY_THROW(im.Dilate(im_alias));
+
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        t::geometry::Image dst;
+        ASSERT_THROW(im.FilterGaussian(dst), std::runtime_error);
+        return;
+    }
+
+    // A matching output buffer is reused.
+    t::geometry::Image dst(5, 5, 1, core::Float32, device);
+    const void *dst_ptr = dst.AsTensor().GetDataPtr();
+    im.FilterGaussian(dst, 3, 1.0f);
+    EXPECT_EQ(dst.AsTensor().GetDataPtr(), dst_ptr);
+    EXPECT_TRUE(dst.AsTensor().AllClose(im.FilterGaussian(3).AsTensor()));
+    im.Dilate(dst, 3);
+    EXPECT_EQ(dst.AsTensor().GetDataPtr(), dst_ptr);
+    EXPECT_TRUE(dst.AsTensor().AllClose(im.Dilate(3).AsTensor()));
+
+    // A mismatching one is reallocated.
+    t::geometry::Image dx(5, 5, 1, core::UInt8, device), dy;
+    im.FilterSobel(dx, dy, 3);
+    EXPECT_EQ(dx.GetDtype(), core::Float32);
+    EXPECT_EQ(dy.GetDtype(), core::Float32);
+    auto grad = im.FilterSobel(3);
+    EXPECT_TRUE(dx.AsTensor().AllClose(grad.first.AsTensor()));
+    EXPECT_TRUE(dy.AsTensor().AllClose(grad.second.AsTensor()));
+    EXPECT_ANY_THROW(im.FilterSobel(dx, dx, 3));
+}
+
 TEST_P(ImagePermuteDevices, Resize) {
     core::Device device = GetParam();
 
@@ -552,17 +611,29 @@ TEST_P(ImagePermuteDevices, Resize) {
         core::Tensor data =
                 core::Tensor(input_data, {6, 6, 1}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(
-                    im.Resize(0.5, t::geometry::Image::InterpType::Nearest),
-                    std::runtime_error);
-        } else {
-            im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Float32, device)));
-        }
+        im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Float32, device)));
+
+        // Float64 is not supported by NPP and IPP.
+        im = t::geometry::Image(data.To(core::Float64));
+        im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
+        EXPECT_TRUE(im.AsTensor().To(core::Float32).AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Float32, device)));
+    }
+    {  // Int32, linear
+        // clang-format off
+        const std::vector<int> input_data =
+          {0, 4, 8, 12,
+           4, 8, 12, 16};
+        const std::vector<int> output_ref =
+          {4, 12};
+        // clang-format on
+
+        t::geometry::Image im(
+                core::Tensor(input_data, {2, 4, 1}, core::Int32, device));
+        im = im.Resize(0.5, t::geometry::Image::InterpType::Linear);
+        EXPECT_EQ(im.AsTensor().ToFlatVector<int>(), output_ref);
     }
     {  // UInt8
         // clang-format off
@@ -623,6 +694,89 @@ TEST_P(ImagePermuteDevices, Resize) {
     }
 }
 
+TEST_P(ImagePermuteDevices, Remap) {
+    core::Device device = GetParam();
+
+    // clang-format off
+    core::Tensor data(std::vector<uint8_t>{
+        0,  10,  20,  30,
+        40, 50,  60,  70,
+        80, 90, 100, 110}, {3, 4, 1}, core::UInt8, device);
+    // Identity for (0, 0), half pixel shifts for (0, 1) and (1, 0), outside
+    // for (1, 1).
+    core::Tensor map(std::vector<float>{
+        0.0f, 0.0f,   1.5f, 0.0f,
+        2.0f, 1.5f,   -2.0f, 0.0f}, {2, 2, 2}, core::Float32, device);
+    // clang-format on
+    t::geometry::Image im(data);
+
+    t::geometry::Image linear =
+            im.Remap(map, t::geometry::Image::InterpType::Linear);
+    EXPECT_EQ(linear.GetRows(), 2);
+    EXPECT_EQ(linear.GetCols(), 2);
+    EXPECT_TRUE(linear.AsTensor().AllEqual(core::Tensor(
+            std::vector<uint8_t>{0, 15, 80, 0}, {2, 2, 1}, core::UInt8,
+            device)));
+    t::geometry::Image nearest =
+            im.Remap(map, t::geometry::Image::InterpType::Nearest);
+    EXPECT_TRUE(nearest.AsTensor().AllEqual(core::Tensor(
+            std::vector<uint8_t>{0, 20, 100, 0}, {2, 2, 1}, core::UInt8,
+            device)));
+
+    // Preallocated output is reused.
+    const void *ptr = linear.AsTensor().GetDataPtr();
+    im.Remap(linear, map, t::geometry::Image::InterpType::Nearest);
+    EXPECT_EQ(linear.AsTensor().GetDataPtr(), ptr);
+    EXPECT_TRUE(linear.AsTensor().AllEqual(nearest.AsTensor()));
+
+    EXPECT_ANY_THROW(im.Remap(map.To(core::Float64)));
+    EXPECT_ANY_THROW(im.Remap(map, t::geometry::Image::InterpType::Cubic));
+}
+
+TEST_P(ImagePermuteDevices, Undistort) {
+    core::Device device = GetParam();
+
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{100, 0, 10}, {0, 100, 8}, {0, 0, 1}}, device);
+    const int64_t rows = 16, cols = 20;
+
+    // No distortion gives the identity map.
+    core::Tensor map = t::geometry::Image::CreateUndistortMap(
+            intrinsics, core::Tensor::Zeros({5}, core::Float64), rows, cols,
+            device);
+    EXPECT_EQ(map.GetShape(), core::SizeVector({rows, cols, 2}));
+    EXPECT_EQ(map.GetDevice(), device);
+    core::Tensor map_cpu = map.To(core::Device("CPU:0"));
+    EXPECT_EQ(map_cpu[3][5][0].Item<float>(), 5.0f);
+    EXPECT_EQ(map_cpu[3][5][1].Item<float>(), 3.0f);
+
+    // Radial and tangential distortion, the principal point is fixed.
+    core::Tensor distortion =
+            core::Tensor::Init<float>({0.1f, 0.01f, 0.001f, 0.002f});
+    map = t::geometry::Image::CreateUndistortMap(intrinsics, distortion, rows,
+                                                 cols, device);
+    map_cpu = map.To(core::Device("CPU:0"));
+    EXPECT_NEAR(map_cpu[8][10][0].Item<float>(), 10.0f, 1e-5);
+    EXPECT_NEAR(map_cpu[8][10][1].Item<float>(), 8.0f, 1e-5);
+    // Pixel (0, 0): x = -0.1, y = -0.08.
+    const double x = -0.1, y = -0.08, r2 = x * x + y * y;
+    const double radial = 1 + 0.1 * r2 + 0.01 * r2 * r2;
+    const double xd = x * radial + 2 * 0.001 * x * y + 0.002 * (r2 + 2 * x * x);
+    const double yd = y * radial + 0.001 * (r2 + 2 * y * y) + 2 * 0.002 * x * y;
+    EXPECT_NEAR(map_cpu[0][0][0].Item<float>(), 100 * xd + 10, 1e-4);
+    EXPECT_NEAR(map_cpu[0][0][1].Item<float>(), 100 * yd + 8, 1e-4);
+
+    t::geometry::Image im(core::Tensor::Arange(0, rows * cols, 1,
+                                               core::Float32, device)
+                                  .Reshape({rows, cols, 1}));
+    EXPECT_TRUE(im.Undistort(intrinsics, distortion)
+                        .AsTensor()
+                        .AllClose(im.Remap(map).AsTensor()));
+
+    EXPECT_ANY_THROW(t::geometry::Image::CreateUndistortMap(
+            intrinsics, core::Tensor::Zeros({3}, core::Float64), rows, cols));
+}
+
 TEST_P(ImagePermuteDevices, PyrDown) {
     core::Device device = GetParam();
 
@@ -852,6 +1006,79 @@ TEST_P(ImagePermuteDevices, DepthToVertexNormalMaps) {
     EXPECT_TRUE(normal_map.AsTensor().AllClose(t_normal_ref));
 }
 
+TEST_P(ImagePermuteDevices, CreateDepthPyramid) {
+    core::Device device = GetParam();
+
+    // clang-format off
+    core::Tensor t_depth(std::vector<uint16_t>{
+        0, 1, 2, 1, 0, 1,
+        0, 2, 4, 2, 0, 1,
+        0, 3, 6, 3, 29, 1,
+        0, 2, 4, 2, 0, 1,
+        0, 1, 2, 1, 0, 1,
+        1, 1, 1, 1, 1, 1}, {6, 6, 1}, core::UInt16, device);
+    core::Tensor intrinsic(std::vector<double>{
+            1.f, 0.f, 2.f,
+            0.f, 1.f, 2.f,
+            0.f, 0.f, 1.f}, {3, 3}, core::Float64, device);
+    // clang-format on
+    t::geometry::Image depth_in(t_depth);
+    t::geometry::RGBDImage rgbd(depth_in, depth_in);
+
+    t::geometry::DepthPyramidOption option;
+    option.num_levels = 2;
+    option.depth_scale = 10.0;
+    option.depth_max = 2.5;
+    option.invalid_fill = 0.0f;
+    // Without bilateral filter the pyramid must match the separate ops.
+    option.bilateral_kernel_size = 1;
+    t::geometry::DepthPyramid pyramid;
+    rgbd.CreateDepthPyramid(intrinsic, option, pyramid);
+    ASSERT_EQ(pyramid.depth_.size(), 2);
+
+    t::geometry::Image depth = rgbd.depth_.ClipTransform(
+            option.depth_scale, option.depth_min, option.depth_max,
+            option.invalid_fill);
+    core::Tensor intrinsic_level = intrinsic.To(core::Float64);
+    for (int level = 0; level < 2; ++level) {
+        if (level > 0) {
+            depth = depth.PyrDownDepth(option.depth_diff_threshold,
+                                       option.invalid_fill);
+            intrinsic_level = intrinsic_level / 2;
+            intrinsic_level[-1][-1] = 1;
+        }
+        t::geometry::Image vertex_map =
+                depth.CreateVertexMap(intrinsic_level, option.invalid_fill);
+        t::geometry::Image normal_map =
+                vertex_map.CreateNormalMap(option.invalid_fill);
+
+        EXPECT_TRUE(pyramid.depth_[level].AsTensor().AllClose(
+                depth.AsTensor()));
+        EXPECT_TRUE(pyramid.vertex_map_[level].AsTensor().AllClose(
+                vertex_map.AsTensor()));
+        EXPECT_TRUE(pyramid.normal_map_[level].AsTensor().AllClose(
+                normal_map.AsTensor()));
+        EXPECT_TRUE(pyramid.intrinsics_[level].AllClose(
+                intrinsic_level.To(core::Device("CPU:0"))));
+    }
+
+    // The buffers are reused for the next frame.
+    const void* depth_ptr = pyramid.depth_[0].AsTensor().GetDataPtr();
+    const void* normal_ptr = pyramid.normal_map_[1].AsTensor().GetDataPtr();
+    rgbd.CreateDepthPyramid(intrinsic, option, pyramid);
+    EXPECT_EQ(pyramid.depth_[0].AsTensor().GetDataPtr(), depth_ptr);
+    EXPECT_EQ(pyramid.normal_map_[1].AsTensor().GetDataPtr(), normal_ptr);
+
+    // The bilateral filter only changes the normals.
+    option.bilateral_kernel_size = 3;
+    t::geometry::DepthPyramid pyramid_smooth =
+            rgbd.CreateDepthPyramid(intrinsic, option);
+    EXPECT_TRUE(pyramid_smooth.depth_[0].AsTensor().AllClose(
+            pyramid.depth_[0].AsTensor()));
+    EXPECT_TRUE(pyramid_smooth.vertex_map_[0].AsTensor().AllClose(
+            pyramid.vertex_map_[0].AsTensor()));
+}
+
 TEST_P(ImagePermuteDevices, DISABLED_CreateVertexMap_Visual) {
     core::Device device = GetParam();
 
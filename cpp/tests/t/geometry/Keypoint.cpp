@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Keypoint.h"
+
+#include "core/CoreTest.h"
+#include "open3d/geometry/Keypoint.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class KeypointPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Keypoint,
+                         KeypointPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(KeypointPermuteDevices, ComputeISSKeypoints) {
+    const core::Device device = GetParam();
+
+    // Noisy samples of the faces of a box, whose corners are salient.
+    geometry::PointCloud legacy;
+    std::vector<Eigen::Vector3d> noise(3000);
+    Rand(noise, Eigen::Vector3d::Constant(-0.005),
+         Eigen::Vector3d::Constant(0.005), 0);
+    std::vector<Eigen::Vector3d> uv(3000);
+    Rand(uv, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 1);
+    const Eigen::Vector3d size(1.0, 0.6, 0.4);
+    for (size_t i = 0; i < uv.size(); i++) {
+        const int face = int(i % 6);
+        Eigen::Vector3d p;
+        p(face / 2) = face % 2;
+        p((face / 2 + 1) % 3) = uv[i](0);
+        p((face / 2 + 2) % 3) = uv[i](1);
+        legacy.points_.push_back(p.cwiseProduct(size) + noise[i]);
+    }
+    legacy.colors_.assign(legacy.points_.size(), Eigen::Vector3d(1, 0, 0));
+
+    const std::shared_ptr<geometry::PointCloud> legacy_keypoints =
+            geometry::keypoint::ComputeISSKeypoints(legacy, 0.1, 0.08);
+    ASSERT_GT(legacy_keypoints->points_.size(), 0u);
+
+    for (const core::Dtype &dtype : {core::Float32, core::Float64}) {
+        const t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::FromLegacy(legacy, dtype, device);
+        const t::geometry::PointCloud keypoints =
+                t::geometry::keypoint::ComputeISSKeypoints(pcd, 0.1, 0.08);
+        EXPECT_EQ(keypoints.GetDevice(), device);
+        EXPECT_TRUE(keypoints.HasPointColors());
+
+        // Float32 positions may flip a few borderline decisions.
+        const geometry::PointCloud result = keypoints.ToLegacy();
+        if (dtype == core::Float64) {
+            ExpectEQ(result.points_, legacy_keypoints->points_);
+        } else {
+            EXPECT_NEAR(double(result.points_.size()),
+                        double(legacy_keypoints->points_.size()),
+                        0.1 * legacy_keypoints->points_.size());
+        }
+    }
+
+    // Radii from the model resolution, which is summed in a different order
+    // than the legacy one.
+    const t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacy(legacy, core::Float64, device);
+    const size_t num_keypoints =
+            geometry::keypoint::ComputeISSKeypoints(legacy)->points_.size();
+    EXPECT_NEAR(double(t::geometry::keypoint::ComputeISSKeypoints(pcd)
+                               .GetPointPositions()
+                               .GetLength()),
+                double(num_keypoints), 0.05 * num_keypoints);
+
+    EXPECT_TRUE(t::geometry::keypoint::ComputeISSKeypoints(
+                        t::geometry::PointCloud(device))
+                        .IsEmpty());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,196 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PinholeCameraTrajectory.h"
+
+#include <Eigen/Geometry>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace tests {
+
+class PinholeCameraTrajectoryPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(PinholeCameraTrajectory,
+                         PinholeCameraTrajectoryPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Returns a world to camera transformation of a camera at \p center,
+/// rotated by \p angle around \p axis.
+static Eigen::Matrix4d CameraExtrinsic(const Eigen::Vector3d &axis,
+                                       double angle,
+                                       const Eigen::Vector3d &center) {
+    const Eigen::Matrix3d rotation =
+            Eigen::AngleAxisd(angle, axis.normalized()).toRotationMatrix();
+    Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+    pose.block<3, 3>(0, 0) = rotation;
+    pose.block<3, 1>(0, 3) = center;
+    return pose.inverse();
+}
+
+static camera::PinholeCameraTrajectory LegacyTrajectory() {
+    camera::PinholeCameraTrajectory trajectory;
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    for (int i = 0; i < 4; ++i) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_ = intrinsic;
+        parameters.extrinsic_ =
+                CameraExtrinsic(Eigen::Vector3d(1, i, 2), 0.3 * i,
+                                Eigen::Vector3d(0.1 * i, -0.2, 0.05 * i * i));
+        trajectory.parameters_.push_back(parameters);
+    }
+    return trajectory;
+}
+
+TEST_P(PinholeCameraTrajectoryPermuteDevices, FromLegacy) {
+    core::Device device = GetParam();
+
+    const camera::PinholeCameraTrajectory legacy = LegacyTrajectory();
+    const t::geometry::PinholeCameraTrajectory trajectory =
+            t::geometry::PinholeCameraTrajectory::FromLegacy(legacy, device);
+    EXPECT_EQ(trajectory.GetLength(), 4);
+    EXPECT_EQ(trajectory.GetDevice(), device);
+    EXPECT_EQ(trajectory.GetWidth(), 640);
+    EXPECT_EQ(trajectory.GetHeight(), 480);
+
+    const camera::PinholeCameraTrajectory result = trajectory.ToLegacy();
+    ASSERT_EQ(result.parameters_.size(), legacy.parameters_.size());
+    for (size_t i = 0; i < legacy.parameters_.size(); ++i) {
+        EXPECT_TRUE(result.parameters_[i].extrinsic_.isApprox(
+                legacy.parameters_[i].extrinsic_));
+        EXPECT_TRUE(result.parameters_[i].intrinsic_.intrinsic_matrix_.isApprox(
+                legacy.parameters_[i].intrinsic_.intrinsic_matrix_));
+    }
+
+    camera::PinholeCameraTrajectory mixed = legacy;
+    mixed.parameters_[2].intrinsic_.width_ = 320;
+    EXPECT_ANY_THROW(
+            t::geometry::PinholeCameraTrajectory::FromLegacy(mixed, device));
+}
+
+TEST_P(PinholeCameraTrajectoryPermuteDevices, ComposeAndGetPoses) {
+    core::Device device = GetParam();
+
+    const camera::PinholeCameraTrajectory legacy = LegacyTrajectory();
+    const t::geometry::PinholeCameraTrajectory trajectory =
+            t::geometry::PinholeCameraTrajectory::FromLegacy(legacy, device);
+
+    const core::Tensor poses = trajectory.GetPoses().To(core::Device("CPU:0"));
+    for (int64_t i = 0; i < trajectory.GetLength(); ++i) {
+        EXPECT_TRUE(core::eigen_converter::TensorToEigenMatrixXd(poses[i])
+                            .isApprox(legacy.parameters_[i].extrinsic_
+                                              .inverse()));
+    }
+
+    // A transformation shared by all frames and one per frame.
+    const Eigen::Matrix4d offset = CameraExtrinsic(
+            Eigen::Vector3d(0, 1, 0), 0.1, Eigen::Vector3d(0.02, 0, 0));
+    const t::geometry::PinholeCameraTrajectory composed = trajectory.Compose(
+            core::eigen_converter::EigenMatrixToTensor(offset).To(device));
+    const t::geometry::PinholeCameraTrajectory identity = trajectory.Compose(
+            core::Tensor::Eye(4, core::Float64, device)
+                    .Reshape({1, 4, 4})
+                    .Expand({4, 4, 4}));
+    for (int64_t i = 0; i < trajectory.GetLength(); ++i) {
+        const Eigen::Matrix4d expected =
+                offset * legacy.parameters_[i].extrinsic_;
+        EXPECT_TRUE(core::eigen_converter::TensorToEigenMatrixXd(
+                            composed.GetExtrinsic(i).To(core::Device("CPU:0")))
+                            .isApprox(expected));
+    }
+    EXPECT_TRUE(identity.GetExtrinsics().AllClose(trajectory.GetExtrinsics()));
+}
+
+TEST_P(PinholeCameraTrajectoryPermuteDevices, Interpolate) {
+    core::Device device = GetParam();
+
+    camera::PinholeCameraTrajectory legacy = LegacyTrajectory();
+    legacy.parameters_.resize(2);
+    legacy.parameters_[0].extrinsic_ = CameraExtrinsic(
+            Eigen::Vector3d(0, 0, 1), 0.0, Eigen::Vector3d(0, 0, 0));
+    legacy.parameters_[1].extrinsic_ = CameraExtrinsic(
+            Eigen::Vector3d(0, 0, 1), M_PI / 2, Eigen::Vector3d(2, 0, 0));
+    const t::geometry::PinholeCameraTrajectory trajectory =
+            t::geometry::PinholeCameraTrajectory::FromLegacy(legacy, device);
+
+    const t::geometry::PinholeCameraTrajectory result = trajectory.Interpolate(
+            core::Tensor::Init<double>({-1.0, 0.0, 0.5, 1.0, 3.0}, device));
+    EXPECT_EQ(result.GetLength(), 5);
+    EXPECT_EQ(result.GetDevice(), device);
+    const core::Tensor extrinsics =
+            result.GetExtrinsics().To(core::Device("CPU:0"));
+    const Eigen::Matrix4d expected[] = {
+            legacy.parameters_[0].extrinsic_, legacy.parameters_[0].extrinsic_,
+            CameraExtrinsic(Eigen::Vector3d(0, 0, 1), M_PI / 4,
+                            Eigen::Vector3d(1, 0, 0)),
+            legacy.parameters_[1].extrinsic_, legacy.parameters_[1].extrinsic_};
+    for (int64_t i = 0; i < 5; ++i) {
+        EXPECT_TRUE(core::eigen_converter::TensorToEigenMatrixXd(extrinsics[i])
+                            .isApprox(expected[i], 1e-9));
+    }
+}
+
+TEST_P(PinholeCameraTrajectoryPermuteDevices, ComputeVisibleBlocks) {
+    core::Device device = GetParam();
+
+    // A camera at the origin looking along +z, and one looking along -z.
+    const core::Tensor intrinsic = core::Tensor::Init<double>(
+            {{100, 0, 50}, {0, 100, 50}, {0, 0, 1}});
+    core::Tensor extrinsics = core::Tensor::Zeros({2, 4, 4}, core::Float64);
+    extrinsics[0] = core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    extrinsics[1] = core::eigen_converter::EigenMatrixToTensor(CameraExtrinsic(
+            Eigen::Vector3d(0, 1, 0), M_PI, Eigen::Vector3d::Zero()));
+    const t::geometry::PinholeCameraTrajectory trajectory(
+            intrinsic, 100, 100, extrinsics.To(device));
+
+    // Blocks of size 0.1 in front, behind, beyond depth_max, and to the
+    // side of the first camera.
+    const core::Tensor block_coords = core::Tensor::Init<int32_t>(
+            {{0, 0, 10}, {-1, -1, -10}, {0, 0, 40}, {20, 0, 10}, {8, 8, 10}},
+            device);
+    const core::Tensor visible = trajectory.ComputeVisibleBlocks(
+            block_coords, 0.1, 0.1, 3.0);
+    EXPECT_TRUE(visible.AllEqual(core::Tensor::Init<bool>(
+            {{true, false, false, false, false},
+             {false, true, false, false, false}},
+            device)));
+
+    // Only the first camera sees the blocks of the grid.
+    t::geometry::VoxelBlockGrid voxel_grid({"tsdf", "weight"},
+                                           {core::Float32, core::Float32},
+                                           {{1}, {1}}, 0.01, 10, 10, device);
+    core::HashMap hashmap = voxel_grid.GetHashMap();
+    core::Tensor buf_indices, masks;
+    hashmap.Activate(block_coords.Slice(0, 0, 1), buf_indices, masks);
+    EXPECT_TRUE(trajectory.SelectFrames(voxel_grid).AllEqual(
+            core::Tensor::Init<int64_t>({0}, device)));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -292,6 +292,76 @@ TEST_P(PointCloudPermuteDevices, EstimateNormals) {
     EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals, 1e-4, 1e-4));
 }
 
+TEST_P(PointCloudPermuteDevices, OrientNormalsConsistentTangentPlane) {
+    core::Device device = GetParam();
+
+    // Fibonacci sphere with randomly flipped outward normals.
+    const int64_t n = 1000;
+    std::vector<double> points, normals;
+    std::vector<int> flips(n);
+    Rand(flips, 0, 2, 0);
+    for (int64_t i = 0; i < n; ++i) {
+        const double z = 1 - (2 * i + 1) / double(n);
+        const double r = std::sqrt(1 - z * z);
+        const double phi = i * M_PI * (3 - std::sqrt(5.0));
+        const double p[3] = {r * std::cos(phi), r * std::sin(phi), z};
+        const double sign = flips[i] ? -1 : 1;
+        points.insert(points.end(), {p[0] + 2, p[1] + 3, p[2] + 4});
+        normals.insert(normals.end(),
+                       {sign * p[0], sign * p[1], sign * p[2]});
+    }
+    const core::Tensor outward_normals =
+            core::Tensor(points, {n, 3}, core::Float64, device) -
+            core::Tensor::Init<double>({2, 3, 4}, device);
+
+    for (const double tile_size : {0.0, 0.5}) {
+        t::geometry::PointCloud pcd(
+                core::Tensor(points, {n, 3}, core::Float64, device));
+        pcd.SetPointNormals(
+                core::Tensor(normals, {n, 3}, core::Float64, device));
+        pcd.OrientNormalsConsistentTangentPlane(10, tile_size);
+        EXPECT_TRUE(pcd.GetPointNormals().AllClose(outward_normals));
+    }
+
+    t::geometry::PointCloud pcd(device);
+    EXPECT_ANY_THROW(pcd.OrientNormalsConsistentTangentPlane(10));
+}
+
+TEST_P(PointCloudPermuteDevices, EstimateCovariances) {
+    core::Device device = GetParam();
+
+    core::Tensor points = core::Tensor::Init<double>({{0, 0, 0},
+                                                      {0, 0, 1},
+                                                      {0, 1, 0},
+                                                      {0, 1, 1},
+                                                      {1, 0, 0},
+                                                      {1, 0, 1},
+                                                      {1, 1, 0},
+                                                      {1, 1, 1}},
+                                                     device);
+    t::geometry::PointCloud pcd(points);
+
+    // Estimate covariances using KNN Search.
+    pcd.EstimateCovariances(4);
+    EXPECT_EQ(pcd.GetPointAttr("covariances").GetShape(),
+              core::SizeVector({8, 3, 3}));
+
+    const double c = 1.0 / 12.0;
+    core::Tensor covariance = core::Tensor::Init<double>(
+            {{0.25, -c, -c}, {-c, 0.25, -c}, {-c, -c, 0.25}}, device);
+    EXPECT_TRUE(pcd.GetPointAttr("covariances")[0].AllClose(covariance, 1e-4,
+                                                            1e-4));
+
+    // Covariances are rotated along with the points.
+    core::Tensor R = core::Tensor::Init<double>(
+            {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}, device);
+    pcd.Rotate(R, core::Tensor::Zeros({3}, core::Float64, device));
+    core::Tensor covariance_rotated = core::Tensor::Init<double>(
+            {{0.25, c, c}, {c, 0.25, -c}, {c, -c, 0.25}}, device);
+    EXPECT_TRUE(pcd.GetPointAttr("covariances")[0].AllClose(
+            covariance_rotated, 1e-4, 1e-4));
+}
+
 TEST_P(PointCloudPermuteDevices, FromLegacy) {
     core::Device device = GetParam();
     geometry::PointCloud legacy_pcd;
@@ -324,6 +394,63 @@ TEST_P(PointCloudPermuteDevices, FromLegacy) {
             core::Tensor::Ones({2, 3}, dtype, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, FromLegacyMove) {
+    core::Device device = GetParam();
+    geometry::PointCloud legacy_pcd;
+    legacy_pcd.points_ = std::vector<Eigen::Vector3d>{Eigen::Vector3d(0, 1, 2),
+                                                      Eigen::Vector3d(3, 4, 5)};
+    legacy_pcd.normals_ = std::vector<Eigen::Vector3d>{
+            Eigen::Vector3d(0, 0, 1), Eigen::Vector3d(0, 1, 0)};
+    const core::Tensor points = core::Tensor::Init<double>(
+            {{0, 1, 2}, {3, 4, 5}}, core::Device("CPU:0"));
+    const core::Tensor normals = core::Tensor::Init<double>(
+            {{0, 0, 1}, {0, 1, 0}}, core::Device("CPU:0"));
+
+    // Float64 on CPU: the buffers are moved into the tensors.
+    geometry::PointCloud legacy_copy = legacy_pcd;
+    const void *points_ptr = legacy_copy.points_.data();
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            std::move(legacy_copy), core::Float64, core::Device("CPU:0"));
+    EXPECT_EQ(pcd.GetPointPositions().GetDataPtr(), points_ptr);
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(points));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals));
+    EXPECT_FALSE(pcd.HasPointColors());
+    EXPECT_FALSE(legacy_copy.HasPoints());
+
+    // Other dtypes and devices fall back to copying.
+    legacy_copy = legacy_pcd;
+    pcd = t::geometry::PointCloud::FromLegacy(std::move(legacy_copy),
+                                              core::Float32, device);
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(
+            points.To(device, core::Float32)));
+    EXPECT_TRUE(legacy_copy.HasPoints());
+}
+
+TEST_P(PointCloudPermuteDevices, ComputeMetrics) {
+    core::Device device = GetParam();
+    t::geometry::PointCloud pcd1(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}, device));
+    t::geometry::PointCloud pcd2(core::Tensor::Init<float>(
+            {{0, 0, 0.1}, {1, 0, 0.1}, {0, 1, 0.1}, {0, 0, 1}}, device));
+
+    core::Tensor distance12 = pcd1.ComputePointCloudDistance(pcd2);
+    EXPECT_TRUE(distance12.AllClose(
+            core::Tensor::Init<float>({0.1, 0.1, 0.1}, device)));
+
+    // distance21 is {0.1, 0.1, 0.1, 1}.
+    t::geometry::MetricParameters params;
+    params.fscore_radius = {0.05f, 0.5f, 2.0f};
+    core::Tensor metrics = pcd1.ComputeMetrics(
+            pcd2,
+            {t::geometry::Metric::ChamferDistance,
+             t::geometry::Metric::HausdorffDistance,
+             t::geometry::Metric::FScore},
+            params);
+    // F-Score at 0.5: precision 1, recall 0.75.
+    EXPECT_TRUE(metrics.AllClose(core::Tensor::Init<float>(
+            {0.1 + 1.3 / 4, 1.0, 0.0, 2 * 0.75 / 1.75, 1.0})));
+}
+
 TEST_P(PointCloudPermuteDevices, ToLegacy) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Float32;
@@ -547,6 +674,119 @@ TEST_P(PointCloudPermuteDevices, CreateFromRGBDImage) {
     EXPECT_FALSE(pcd_out.HasPointNormals());
 }
 
+TEST_P(PointCloudPermuteDevices, CreateFromRGBDImages) {
+    core::Device device = GetParam();
+    const int64_t num_cameras = 3, rows = 6, cols = 8;
+    const float depth_scale = 1000.f, depth_max = 3.f;
+
+    core::Tensor depths =
+            core::Tensor::Empty({num_cameras, rows, cols}, core::UInt16);
+    core::Tensor colors =
+            core::Tensor::Empty({num_cameras, rows, cols, 3}, core::UInt8);
+    uint16_t* depths_ptr = depths.GetDataPtr<uint16_t>();
+    uint8_t* colors_ptr = colors.GetDataPtr<uint8_t>();
+    for (int64_t i = 0; i < depths.NumElements(); ++i) {
+        // Every 7th pixel is invalid and some are beyond depth_max.
+        depths_ptr[i] = i % 7 == 0 ? 0 : uint16_t(500 + (i * 37) % 3000);
+    }
+    for (int64_t i = 0; i < colors.NumElements(); ++i) {
+        colors_ptr[i] = uint8_t((i * 11) % 256);
+    }
+    depths = depths.To(device);
+    colors = colors.To(device);
+
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{{10, 0, 4}, {0, 10, 3}, {0, 0, 1}},
+             {{12, 0, 3.5}, {0, 11, 2.5}, {0, 0, 1}},
+             {{9, 0, 4}, {0, 9, 3}, {0, 0, 1}}},
+            device);
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"))
+                    .Reshape({1, 4, 4})
+                    .Append(core::Tensor::Init<double>({{{0, -1, 0, 0.1},
+                                                         {1, 0, 0, 0.2},
+                                                         {0, 0, 1, -0.3},
+                                                         {0, 0, 0, 1}},
+                                                        {{1, 0, 0, -1},
+                                                         {0, 0, -1, 0.5},
+                                                         {0, 1, 0, 2},
+                                                         {0, 0, 0, 1}}}),
+                            0)
+                    .To(device);
+
+    // Points of a cloud sorted by position, with their colors.
+    auto sorted_points = [](const t::geometry::PointCloud& pcd) {
+        const geometry::PointCloud legacy = pcd.ToLegacy();
+        std::vector<std::pair<Eigen::Vector3d, Eigen::Vector3d>> points;
+        for (size_t i = 0; i < legacy.points_.size(); ++i) {
+            points.emplace_back(legacy.points_[i], legacy.colors_[i]);
+        }
+        std::sort(points.begin(), points.end(),
+                  [](const std::pair<Eigen::Vector3d, Eigen::Vector3d>& a,
+                     const std::pair<Eigen::Vector3d, Eigen::Vector3d>& b) {
+                      return std::lexicographical_compare(
+                              a.first.data(), a.first.data() + 3,
+                              b.first.data(), b.first.data() + 3);
+                  });
+        return points;
+    };
+
+    for (int stride : {1, 2}) {
+        const t::geometry::PointCloud pcd =
+                t::geometry::PointCloud::CreateFromRGBDImages(
+                        depths, colors, intrinsics, extrinsics, depth_scale,
+                        depth_max, stride);
+        ASSERT_TRUE(pcd.HasPointAttr("camera_ids"));
+        const core::Tensor camera_ids = pcd.GetPointAttr("camera_ids");
+        EXPECT_EQ(camera_ids.GetDtype(), core::Int32);
+        EXPECT_EQ(camera_ids.GetShape(),
+                  core::SizeVector({pcd.GetPointPositions().GetLength(), 1}));
+
+        int64_t num_points = 0;
+        for (int64_t b = 0; b < num_cameras; ++b) {
+            const t::geometry::PointCloud ref =
+                    t::geometry::PointCloud::CreateFromRGBDImage(
+                            t::geometry::RGBDImage(
+                                    t::geometry::Image(colors[b]),
+                                    t::geometry::Image(depths[b].Reshape(
+                                            {rows, cols, 1}))),
+                            intrinsics[b], extrinsics[b], depth_scale,
+                            depth_max, stride);
+            const core::Tensor mask = camera_ids.Eq(b).Reshape({-1});
+            const t::geometry::PointCloud camera_pcd(
+                    {{"positions", pcd.GetPointPositions().IndexGet({mask})},
+                     {"colors", pcd.GetPointColors().IndexGet({mask})}});
+            num_points += ref.GetPointPositions().GetLength();
+
+            const auto points = sorted_points(camera_pcd);
+            const auto points_ref = sorted_points(ref);
+            ASSERT_EQ(points.size(), points_ref.size());
+            for (size_t i = 0; i < points.size(); ++i) {
+                ExpectEQ(points[i].first, points_ref[i].first, 1e-6);
+                ExpectEQ(points[i].second, points_ref[i].second, 1e-6);
+            }
+        }
+        EXPECT_EQ(pcd.GetPointPositions().GetLength(), num_points);
+    }
+
+    // Shared intrinsics and float depth without colors.
+    const t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::CreateFromDepthImages(
+                    depths.To(core::Float32).Reshape({num_cameras, rows, cols,
+                                                      1}),
+                    intrinsics[0], extrinsics, depth_scale, depth_max);
+    EXPECT_FALSE(pcd.HasPointColors());
+    const t::geometry::PointCloud ref =
+            t::geometry::PointCloud::CreateFromDepthImage(
+                    t::geometry::Image(depths[2].Reshape({rows, cols, 1})),
+                    intrinsics[0], extrinsics[2], depth_scale, depth_max);
+    EXPECT_EQ(pcd.GetPointAttr("camera_ids").Eq(2).NonZero().GetShape(1),
+              ref.GetPointPositions().GetLength());
+
+    EXPECT_ANY_THROW(t::geometry::PointCloud::CreateFromDepthImages(
+            depths, intrinsics, extrinsics[0]));
+}
+
 TEST_P(PointCloudPermuteDevices, CreateFromRGBDOrDepthImageWithNormals) {
     core::Device device = GetParam();
 
@@ -694,5 +934,212 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, UniformDownSample) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {4, 0, 0}}, device));
+    pcd.SetPointColors(pcd.GetPointPositions() * 0.1);
+
+    auto pcd_down = pcd.UniformDownSample(2);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {2, 0, 0}, {4, 0, 0}},
+                                      device)));
+    EXPECT_TRUE(pcd_down.GetPointColors().AllClose(
+            pcd_down.GetPointPositions() * 0.1));
+
+    EXPECT_ANY_THROW(pcd.UniformDownSample(0));
+}
+
+TEST_P(PointCloudPermuteDevices, RandomDownSample) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, 30, 1, core::Float32, device)
+                    .Reshape({10, 3}));
+
+    auto pcd_down = pcd.RandomDownSample(0.5);
+    EXPECT_EQ(pcd_down.GetPointPositions().GetLength(), 5);
+
+    // Kept points are a subset in their original order.
+    core::Tensor x = pcd_down.GetPointPositions().Slice(1, 0, 1).Reshape({5});
+    EXPECT_TRUE((x.Slice(0, 1, 5) > x.Slice(0, 0, 4)).All());
+
+    EXPECT_EQ(pcd.RandomDownSample(0).GetPointPositions().GetLength(), 0);
+    EXPECT_EQ(pcd.RandomDownSample(1).GetPointPositions().GetLength(), 10);
+    EXPECT_ANY_THROW(pcd.RandomDownSample(1.5));
+}
+
+TEST_P(PointCloudPermuteDevices, FarthestPointDownSample) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {0.1, 0, 0},
+                                                           {10, 0, 0},
+                                                           {10, 0.1, 0},
+                                                           {5, 5, 0}},
+                                                          device));
+
+    auto pcd_down = pcd.FarthestPointDownSample(3);
+    EXPECT_TRUE(pcd_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {10, 0.1, 0}, {5, 5, 0}},
+                                      device)));
+
+    EXPECT_ANY_THROW(pcd.FarthestPointDownSample(6));
+
+    // Large clouds are processed in parallel chunks on the CPU, which must
+    // pick the same points as the other devices.
+    std::vector<float> values;
+    for (int i = 0; i < 20000; ++i) {
+        values.push_back(std::sin(0.37f * i));
+        values.push_back(std::cos(1.13f * i));
+        values.push_back(std::sin(2.71f * i + 1.f));
+    }
+    const core::Tensor positions(values, {20000, 3}, core::Float32);
+    const core::Tensor expected =
+            t::geometry::PointCloud(positions)
+                    .FarthestPointDownSample(100)
+                    .GetPointPositions();
+    const core::Tensor actual =
+            t::geometry::PointCloud(positions.To(device))
+                    .FarthestPointDownSample(100)
+                    .GetPointPositions();
+    EXPECT_TRUE(actual.To(core::Device("CPU:0")).AllEqual(expected));
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {0.1, 0, 0},
+                                                           {0, 0.1, 0},
+                                                           {0, 0, 0.1},
+                                                           {5, 5, 5}},
+                                                          device));
+
+    t::geometry::PointCloud pcd_inlier;
+    core::Tensor mask;
+    std::tie(pcd_inlier, mask) = pcd.RemoveRadiusOutliers(3, 0.5);
+    EXPECT_TRUE(mask.AllEqual(core::Tensor::Init<bool>(
+            {true, true, true, true, false}, device)));
+    EXPECT_EQ(pcd_inlier.GetPointPositions().GetLength(), 4);
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveStatisticalOutliers) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{0, 0, 0},
+                                                           {0.1, 0, 0},
+                                                           {0, 0.1, 0},
+                                                           {0, 0, 0.1},
+                                                           {0.1, 0.1, 0},
+                                                           {5, 5, 5}},
+                                                          device));
+
+    t::geometry::PointCloud pcd_inlier;
+    core::Tensor mask;
+    std::tie(pcd_inlier, mask) = pcd.RemoveStatisticalOutliers(3, 1.0);
+    EXPECT_TRUE(mask.AllEqual(core::Tensor::Init<bool>(
+            {true, true, true, true, true, false}, device)));
+    EXPECT_EQ(pcd_inlier.GetPointPositions().GetLength(), 5);
+}
+
+TEST_P(PointCloudPermuteDevices, SortBySpatialLocality) {
+    core::Device device = GetParam();
+
+    // Corners of a cube in shuffled order.
+    const core::Tensor corners = core::Tensor::Init<float>({{1, 1, 0},
+                                                            {0, 0, 1},
+                                                            {1, 0, 1},
+                                                            {0, 0, 0},
+                                                            {0, 1, 1},
+                                                            {1, 0, 0},
+                                                            {1, 1, 1},
+                                                            {0, 1, 0}},
+                                                           device);
+    t::geometry::PointCloud pcd(corners);
+    pcd.SetPointColors(corners * 2);
+
+    // Morton codes order by z, then y, then x.
+    t::geometry::PointCloud pcd_sorted;
+    core::Tensor perm;
+    std::tie(pcd_sorted, perm) = pcd.SortBySpatialLocality();
+    EXPECT_TRUE(perm.AllEqual(
+            core::Tensor::Init<int64_t>({3, 5, 7, 0, 1, 2, 4, 6}, device)));
+    EXPECT_TRUE(pcd_sorted.GetPointColors().AllEqual(
+            pcd_sorted.GetPointPositions() * 2));
+    EXPECT_TRUE(pcd_sorted.GetPointPositions()
+                        .IndexGet({perm.Argsort()})
+                        .AllEqual(corners));
+
+    // Consecutive cells of the Hilbert curve are adjacent.
+    std::tie(pcd_sorted, perm) = pcd.SortBySpatialLocality(
+            t::geometry::PointCloud::SpatialSortMethod::Hilbert);
+    EXPECT_EQ(perm.GetLength(), 8);
+    EXPECT_TRUE(perm.Sort().AllEqual(
+            core::Tensor::Arange(0, 8, 1, core::Int64, device)));
+    const core::Tensor positions = pcd_sorted.GetPointPositions();
+    const core::Tensor steps =
+            (positions.Slice(0, 1, 8) - positions.Slice(0, 0, 7)).Abs();
+    EXPECT_TRUE(steps.Sum({1}).AllEqual(
+            core::Tensor::Ones({7}, core::Float32, device)));
+
+    std::tie(pcd_sorted, perm) =
+            t::geometry::PointCloud(device).SortBySpatialLocality();
+    EXPECT_EQ(perm.GetLength(), 0);
+}
+
+TEST_P(PointCloudPermuteDevices, ComputeVisibility) {
+    core::Device device = GetParam();
+
+    // A plane at z = 0 and a smaller patch above its center at z = 1.
+    std::vector<double> points;
+    for (int i = -20; i <= 20; ++i) {
+        for (int j = -20; j <= 20; ++j) {
+            points.insert(points.end(), {0.05 * i, 0.05 * j, 0.0});
+        }
+    }
+    for (int i = -5; i <= 5; ++i) {
+        for (int j = -5; j <= 5; ++j) {
+            points.insert(points.end(), {0.05 * i, 0.05 * j, 1.0});
+        }
+    }
+    const int64_t num_plane = 41 * 41;
+    const int64_t n = num_plane + 11 * 11;
+    const int64_t center = 20 * 41 + 20;
+    const int64_t corner = 0;
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {n, 3}, core::Float64, device));
+
+    for (const core::Dtype &dtype : {core::Float32, core::Float64}) {
+        const core::Tensor viewpoints = core::Tensor::Init<double>(
+                {{0, 0, 5}, {0, 0, -5}}, device);
+        const core::Tensor visible =
+                t::geometry::PointCloud(pcd.GetPointPositions().To(dtype))
+                        .ComputeVisibility(viewpoints.To(dtype), 0.05);
+        EXPECT_EQ(visible.GetShape(), core::SizeVector({2, n}));
+        EXPECT_EQ(visible.GetDtype(), core::Bool);
+
+        // From above, the patch hides the center of the plane.
+        const core::Tensor above = visible[0];
+        EXPECT_TRUE(above.Slice(0, num_plane, n).All());
+        EXPECT_FALSE(above[center].Item<bool>());
+        EXPECT_TRUE(above[corner].Item<bool>());
+
+        // From below, the plane hides the patch.
+        const core::Tensor below = visible[1];
+        EXPECT_TRUE(below.Slice(0, 0, num_plane).All());
+        EXPECT_FALSE(below.Slice(0, num_plane, n).Any());
+    }
+
+    EXPECT_EQ(pcd.ComputeVisibility(core::Tensor::Empty({0, 3}, core::Float64,
+                                                        device),
+                                     0.05)
+                      .GetShape(),
+              core::SizeVector({0, n}));
+    EXPECT_ANY_THROW(pcd.ComputeVisibility(
+            core::Tensor::Zeros({1, 3}, core::Float64, device), 0.0));
+}
+
 }  // namespace tests
 }  // namespace open3d
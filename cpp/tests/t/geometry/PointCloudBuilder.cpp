@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PointCloudBuilder.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class PointCloudBuilderPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(PointCloudBuilder,
+                         PointCloudBuilderPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(PointCloudBuilderPermuteDevices, Append) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloudBuilder builder(device);
+    t::geometry::PointCloud expected(device);
+    for (int64_t i = 0; i < 20; ++i) {
+        t::geometry::PointCloud pcd(device);
+        pcd.SetPointPositions(core::Tensor::Full({i + 1, 3}, float(i),
+                                                 core::Float32, device));
+        pcd.SetPointColors(core::Tensor::Full({i + 1, 3}, float(2 * i),
+                                              core::Float32, device));
+        builder.Append(pcd);
+        expected = i == 0 ? pcd : expected.Append(pcd);
+    }
+    EXPECT_EQ(builder.GetLength(), 210);
+
+    t::geometry::PointCloud pcd = builder.ToPointCloud();
+    EXPECT_TRUE(pcd.GetPointPositions().AllEqual(
+            expected.GetPointPositions()));
+    EXPECT_TRUE(pcd.GetPointColors().AllEqual(expected.GetPointColors()));
+
+    // Views stay unchanged by later appends.
+    builder.Append(pcd);
+    EXPECT_EQ(builder.GetLength(), 420);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), 210);
+    EXPECT_TRUE(pcd.GetPointPositions().AllEqual(
+            expected.GetPointPositions()));
+
+    builder.Clear();
+    EXPECT_EQ(builder.GetLength(), 0);
+    EXPECT_TRUE(builder.ToPointCloud().IsEmpty());
+}
+
+TEST_P(PointCloudBuilderPermuteDevices, AppendExceptions) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(device);
+    pcd.SetPointPositions(core::Tensor::Ones({2, 3}, core::Float32, device));
+    pcd.SetPointColors(core::Tensor::Ones({2, 3}, core::Float32, device));
+    t::geometry::PointCloudBuilder builder(device);
+    builder.Append(pcd);
+
+    // Missing attribute.
+    t::geometry::PointCloud no_colors(device);
+    no_colors.SetPointPositions(
+            core::Tensor::Ones({2, 3}, core::Float32, device));
+    EXPECT_ANY_THROW(builder.Append(no_colors));
+
+    // Dtype and shape mismatch.
+    t::geometry::PointCloud other = pcd.Clone();
+    other.SetPointColors(core::Tensor::Ones({2, 3}, core::Float64, device));
+    EXPECT_ANY_THROW(builder.Append(other));
+    other.SetPointAttr("colors",
+                       core::Tensor::Ones({2, 4}, core::Float32, device));
+    EXPECT_ANY_THROW(builder.Append(other));
+    EXPECT_EQ(builder.GetLength(), 2);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -118,5 +118,54 @@ TEST_P(TensorMapPermuteDevices, Contains) {
     EXPECT_FALSE(tm.Contains("normals"));
 }
 
+TEST_P(TensorMapPermuteDevices, IndexGet) {
+    core::Device device = GetParam();
+
+    // Mixed dtypes and row sizes, including a non-contiguous tensor.
+    const int64_t n = 7;
+    t::geometry::TensorMap tm(
+            "positions",
+            {{"positions", core::Tensor::Arange(0, n * 3, 1, core::Float32,
+                                                device)
+                                   .Reshape({n, 3})},
+             {"labels",
+              core::Tensor::Arange(0, n, 1, core::UInt8, device)},
+             {"flags", core::Tensor::Arange(0, n * 3, 1, core::Int64, device)
+                               .Reshape({n, 3})
+                               .Lt(10)},
+             {"transposed",
+              core::Tensor::Arange(0, n * 2, 1, core::Float64, device)
+                      .Reshape({2, n})
+                      .T()}});
+
+    const core::Tensor index =
+            core::Tensor::Init<int64_t>({6, 0, 3, 3}, device);
+    t::geometry::TensorMap selected = tm.IndexGet(index);
+    EXPECT_EQ(selected.GetPrimaryKey(), "positions");
+    EXPECT_EQ(selected.size(), tm.size());
+    for (const auto &kv : tm) {
+        EXPECT_TRUE(selected.at(kv.first).AllEqual(kv.second.IndexGet({index})))
+                << kv.first;
+    }
+
+    const core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, false, true, true, false,
+                                      true},
+                                     device);
+    selected = tm.IndexGet(mask);
+    for (const auto &kv : tm) {
+        EXPECT_TRUE(selected.at(kv.first).AllEqual(kv.second.IndexGet({mask})))
+                << kv.first;
+    }
+
+    EXPECT_EQ(tm.IndexGet(core::Tensor::Empty({0}, core::Int64, device))
+                      .at("labels")
+                      .GetShape(),
+              core::SizeVector({0}));
+    EXPECT_ANY_THROW(tm.IndexGet(core::Tensor::Init<int64_t>({n}, device)));
+    EXPECT_ANY_THROW(tm.IndexGet(core::Tensor::Zeros({n + 1}, core::Bool,
+                                                     device)));
+}
+
 }  // namespace tests
 }  // namespace open3d
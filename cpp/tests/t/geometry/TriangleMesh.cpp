@@ -26,8 +26,14 @@
 
 #include "open3d/t/geometry/TriangleMesh.h"
 
+#include <limits>
+
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/geometry/HalfEdgeTriangleMesh.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -426,5 +432,267 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
                       {Eigen::Vector3d(4, 4, 4), Eigen::Vector3d(4, 4, 4)}));
 }
 
+TEST_P(TriangleMeshPermuteDevices, ComputeVertexNormals) {
+    core::Device device = GetParam();
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *legacy_mesh, core::Float64, core::Int64, device);
+
+    legacy_mesh->ComputeVertexNormals();
+    mesh.ComputeVertexNormals();
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->triangle_normals_, core::Float64, device)));
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->vertex_normals_, core::Float64, device)));
+    EXPECT_NEAR(mesh.GetSurfaceArea(), legacy_mesh->GetSurfaceArea(), 1e-10);
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeHalfEdges) {
+    core::Device device = GetParam();
+
+    // A sphere with two holes, which the legacy conversion does not purge,
+    // so that the half-edges match one to one.
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    const size_t num_triangles = legacy_mesh->triangles_.size();
+    std::vector<Eigen::Vector3i> triangles;
+    for (size_t i = 0; i < num_triangles; ++i) {
+        if (i != 5 && i != num_triangles / 2) {
+            triangles.push_back(legacy_mesh->triangles_[i]);
+        }
+    }
+    legacy_mesh->triangles_ = triangles;
+    auto het_mesh =
+            geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+                    *legacy_mesh);
+    ASSERT_EQ(het_mesh->triangles_, legacy_mesh->triangles_);
+
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacy(*legacy_mesh, core::Float32,
+                                                  core::Int64, device);
+    core::Tensor half_edges, twins;
+    std::tie(half_edges, twins) = mesh.ComputeHalfEdges();
+    const int64_t num_half_edges = int64_t(het_mesh->half_edges_.size());
+    ASSERT_EQ(half_edges.GetShape(), core::SizeVector({num_half_edges, 2}));
+    ASSERT_EQ(twins.GetShape(), core::SizeVector({num_half_edges}));
+    const std::vector<int64_t> half_edges_vec =
+            half_edges.ToFlatVector<int64_t>();
+    const std::vector<int64_t> twins_vec = twins.ToFlatVector<int64_t>();
+    for (int64_t i = 0; i < num_half_edges; ++i) {
+        const auto &he = het_mesh->half_edges_[i];
+        EXPECT_EQ(half_edges_vec[2 * i], he.vertex_indices_(0));
+        EXPECT_EQ(half_edges_vec[2 * i + 1], he.vertex_indices_(1));
+        EXPECT_EQ(twins_vec[i], he.twin_);
+    }
+
+    // A lone triangle only has boundary half-edges.
+    t::geometry::TriangleMesh triangle(
+            core::Tensor::Init<float>({{0, 0, 0}, {1, 0, 0}, {0, 1, 0}},
+                                      device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device));
+    std::tie(half_edges, twins) = triangle.ComputeHalfEdges();
+    EXPECT_TRUE(twins.AllEqual(core::Tensor::Init<int64_t>({-1, -1, -1},
+                                                           device)));
+
+    // Two triangles with inconsistent orientations.
+    t::geometry::TriangleMesh flipped(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}}, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {1, 2, 3}}, device));
+    EXPECT_ANY_THROW(flipped.ComputeHalfEdges());
+}
+
+TEST_P(TriangleMeshPermuteDevices, RemoveDuplicatedVertices) {
+    core::Device device = GetParam();
+    // Two triangles that share an edge, stored with separate vertices.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>({{0, 0, 0},
+                                       {1, 0, 0},
+                                       {0, 1, 0},
+                                       {1, 0, 0},
+                                       {1, 1, 0},
+                                       {0, 1, 0}},
+                                      device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {3, 4, 5}}, device));
+
+    t::geometry::TriangleMesh merged = mesh.RemoveDuplicatedVertices();
+    EXPECT_EQ(merged.GetVertexPositions().GetLength(), 4);
+    EXPECT_EQ(merged.GetTriangleIndices().GetLength(), 2);
+    // The triangles still reference the same positions.
+    const core::Tensor before = mesh.GetVertexPositions().IndexGet(
+            {mesh.GetTriangleIndices().Reshape({6})});
+    const core::Tensor after = merged.GetVertexPositions().IndexGet(
+            {merged.GetTriangleIndices().Reshape({6})});
+    EXPECT_TRUE(before.AllClose(after));
+}
+
+TEST_P(TriangleMeshPermuteDevices, MergeCloseVertices) {
+    core::Device device = GetParam();
+    // Two triangles that share an edge, whose copies are slightly displaced.
+    // The copies of {0.1, 0, 0} fall into different cells of size eps.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {0.0999, 0, 0},
+                                        {0, 1, 0},
+                                        {0.1001, 0, 0},
+                                        {1, 1, 0},
+                                        {0, 1.0001, 0}},
+                                       device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {3, 4, 5}}, device));
+    mesh.SetVertexColors(core::Tensor::Init<double>({{0, 0, 0},
+                                                      {0, 0, 0},
+                                                      {0, 0, 0},
+                                                      {1, 1, 1},
+                                                      {0, 0, 0},
+                                                      {1, 1, 1}},
+                                                     device));
+
+    t::geometry::TriangleMesh merged = mesh.MergeCloseVertices(0.01);
+    EXPECT_EQ(merged.GetVertexPositions().GetLength(), 4);
+    EXPECT_TRUE(merged.GetVertexPositions().AllClose(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {0.1, 0, 0},
+                                        {0, 1.00005, 0},
+                                        {1, 1, 0}},
+                                       device)));
+    EXPECT_TRUE(merged.GetVertexColors().AllClose(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {0.5, 0.5, 0.5},
+                                        {0.5, 0.5, 0.5},
+                                        {0, 0, 0}},
+                                       device)));
+    EXPECT_TRUE(merged.GetTriangleIndices().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {1, 3, 2}}, device)));
+
+    // Vertices farther apart than eps are kept.
+    EXPECT_EQ(mesh.MergeCloseVertices(1e-5).GetVertexPositions().GetLength(),
+              6);
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyVertexClustering) {
+    core::Device device = GetParam();
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *legacy_mesh, core::Float64, core::Int64, device);
+
+    const double voxel_size = 0.25;
+    auto legacy_simplified = legacy_mesh->SimplifyVertexClustering(voxel_size);
+    t::geometry::TriangleMesh simplified =
+            mesh.SimplifyVertexClustering(voxel_size);
+    EXPECT_EQ(simplified.GetVertexPositions().GetLength(),
+              int64_t(legacy_simplified->vertices_.size()));
+    EXPECT_GE(simplified.GetTriangleIndices().GetLength(),
+              int64_t(legacy_simplified->triangles_.size()));
+    EXPECT_LT(simplified.GetTriangleIndices().GetLength(),
+              mesh.GetTriangleIndices().GetLength());
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsUniformly) {
+    core::Device device = GetParam();
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    legacy_mesh->ComputeVertexNormals();
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *legacy_mesh, core::Float32, core::Int64, device);
+
+    t::geometry::PointCloud pcd = mesh.SamplePointsUniformly(1000, false, 0);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), 1000);
+    EXPECT_EQ(pcd.GetPointPositions().GetDevice(), device);
+    EXPECT_TRUE(pcd.HasPointNormals());
+    const core::Tensor radii =
+            (pcd.GetPointPositions() * pcd.GetPointPositions())
+                    .Sum({1})
+                    .Sqrt();
+    EXPECT_TRUE(radii.Le(1.0001).All());
+    EXPECT_TRUE(radii.Ge(0.95).All());
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsPoissonDisk) {
+    core::Device device = GetParam();
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    legacy_mesh->ComputeVertexNormals();
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *legacy_mesh, core::Float32, core::Int64, device);
+
+    const int64_t num_points = 500;
+    t::geometry::PointCloud pcd =
+            mesh.SamplePointsPoissonDisk(num_points, 5, false, 0);
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(), num_points);
+    EXPECT_EQ(pcd.GetPointPositions().GetDevice(), device);
+    EXPECT_TRUE(pcd.HasPointNormals());
+
+    // Unlike uniform samples, the points keep a distance that is a fair
+    // fraction of the one of the densest packing.
+    const double packing_distance =
+            2 * std::sqrt((mesh.GetSurfaceArea() / num_points) /
+                          (2 * std::sqrt(3.)));
+    const std::vector<Eigen::Vector3d> points = pcd.ToLegacy().points_;
+    double min_distance = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (size_t j = i + 1; j < points.size(); ++j) {
+            min_distance =
+                    std::min(min_distance, (points[i] - points[j]).norm());
+        }
+    }
+    EXPECT_GT(min_distance, 0.5 * packing_distance);
+
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(
+            mesh.SamplePointsPoissonDisk(num_points, 5, false, 0)
+                    .GetPointPositions()));
+}
+
+TEST_P(TriangleMeshPermuteDevices, DeformAsRigidAsPossible) {
+    core::Device device = GetParam();
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+
+    // Pin the bottom cap and pull the top pole upwards.
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    for (size_t i = 0; i < legacy_mesh->vertices_.size(); ++i) {
+        const Eigen::Vector3d &v = legacy_mesh->vertices_[i];
+        if (v(2) < -0.7) {
+            constraint_ids.push_back(int(i));
+            constraint_pos.push_back(v);
+        } else if (v(2) > 0.99) {
+            constraint_ids.push_back(int(i));
+            constraint_pos.push_back(v + Eigen::Vector3d(0.2, 0, 0.4));
+        }
+    }
+
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *legacy_mesh, core::Float64, core::Int64, device);
+    const core::Tensor ids(constraint_ids, {int64_t(constraint_ids.size())},
+                           core::Int32, device);
+    const core::Tensor pos =
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    constraint_pos, core::Float64, device);
+    for (auto energy :
+         {geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+          geometry::MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed}) {
+        auto legacy_deformed = legacy_mesh->DeformAsRigidAsPossible(
+                constraint_ids, constraint_pos, 10, energy);
+        t::geometry::TriangleMesh deformed =
+                mesh.DeformAsRigidAsPossible(ids, pos, 10, energy);
+        EXPECT_EQ(deformed.GetDevice(), device);
+        EXPECT_TRUE(deformed.GetVertexPositions().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        legacy_deformed->vertices_, core::Float64, device),
+                1e-6, 1e-6));
+    }
+}
+
+TEST_P(TriangleMeshPermuteDevices, FilterSmoothTaubin) {
+    core::Device device = GetParam();
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *legacy_mesh, core::Float64, core::Int64, device);
+
+    auto legacy_smoothed = legacy_mesh->FilterSmoothTaubin(3);
+    t::geometry::TriangleMesh smoothed = mesh.FilterSmoothTaubin(3);
+    EXPECT_TRUE(smoothed.GetVertexPositions().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_smoothed->vertices_, core::Float64, device)));
+}
+
 }  // namespace tests
 }  // namespace open3d
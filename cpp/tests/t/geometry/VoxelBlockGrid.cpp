@@ -29,11 +29,16 @@
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
 #include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/MultiDeviceVoxelBlockGrid.h"
+#include "open3d/t/geometry/MultiResolutionVoxelBlockGrid.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/t/io/NumpyIO.h"
+#include "open3d/t/io/VoxelBlockGridIO.h"
 #include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 
 namespace open3d {
@@ -89,17 +94,19 @@ static std::vector<core::HashBackendType> EnumerateBackends(
     return backends;
 }
 
-static VoxelBlockGrid Integrate(const core::HashBackendType &backend,
-                                const core::Dtype &dtype,
-                                const core::Device &device,
-                                const int resolution) {
+static VoxelBlockGrid Integrate(
+        const core::HashBackendType &backend,
+        const core::Dtype &dtype,
+        const core::Device &device,
+        const int resolution,
+        const core::Dtype &tsdf_dtype = core::Float32) {
     core::Tensor intrinsic = GetIntrinsicTensor();
     std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
     const float depth_scale = 1000.0;
     const float depth_max = 3.0;
 
     auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
-                              {core::Float32, dtype, dtype}, {{1}, {1}, {3}},
+                              {tsdf_dtype, dtype, dtype}, {{1}, {1}, {3}},
                               3.0 / 512, resolution, 10000, device, backend);
 
     for (size_t i = 0; i < extrinsics.size(); ++i) {
@@ -278,6 +285,244 @@ TEST_P(VoxelBlockGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, IntegrateCompact) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::UInt16, device, 8);
+        auto vbg_compact =
+                Integrate(backend, core::UInt8, device, 8, core::Int16);
+        EXPECT_EQ(vbg_compact.GetHashMap().Size(), vbg.GetHashMap().Size());
+
+        // Quantization only moves the surface by a fraction of a voxel.
+        int64_t num_points =
+                vbg.ExtractPointCloud().GetPointPositions().GetLength();
+        int64_t num_compact_points =
+                vbg_compact.ExtractPointCloud().GetPointPositions().GetLength();
+        EXPECT_NEAR(num_compact_points, num_points, num_points * 0.01);
+
+        auto mesh = vbg_compact.ExtractTriangleMesh();
+        EXPECT_TRUE(mesh.HasVertexColors());
+        EXPECT_NEAR(mesh.GetVertexPositions().GetLength(),
+                    vbg.ExtractTriangleMesh().GetVertexPositions().GetLength(),
+                    num_points * 0.01);
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, ExtractDeterministic) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    // Hash map insertion order varies between runs, the extracted geometry
+    // must not.
+    utility::SetDeterministic(true);
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::Float32, device, 8);
+        auto vbg_other = Integrate(backend, core::Float32, device, 8);
+
+        auto pcd = vbg.ExtractPointCloud();
+        auto pcd_other = vbg_other.ExtractPointCloud();
+        EXPECT_TRUE(pcd.GetPointPositions().AllEqual(
+                pcd_other.GetPointPositions()));
+        EXPECT_TRUE(pcd.GetPointNormals().AllEqual(
+                pcd_other.GetPointNormals()));
+
+        auto mesh = vbg.ExtractTriangleMesh();
+        auto mesh_other = vbg_other.ExtractTriangleMesh();
+        EXPECT_TRUE(mesh.GetVertexPositions().AllEqual(
+                mesh_other.GetVertexPositions()));
+        EXPECT_TRUE(mesh.GetTriangleIndices().AllEqual(
+                mesh_other.GetTriangleIndices()));
+    }
+    utility::SetDeterministic(false);
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, IntegrateBatch) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+
+    std::vector<core::Tensor> depths, colors, poses;
+    for (size_t i = 0; i < extrinsics.size(); ++i) {
+        core::Tensor depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->AsTensor();
+        core::Tensor color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->AsTensor();
+        depths.push_back(depth.Reshape({1, depth.GetShape(0),
+                                        depth.GetShape(1), 1}));
+        colors.push_back(color.Reshape({1, color.GetShape(0),
+                                        color.GetShape(1), 3}));
+        poses.push_back(extrinsics[i].Reshape({1, 4, 4}));
+    }
+    core::Tensor depth_batch = core::Concatenate(depths).To(device);
+    core::Tensor color_batch = core::Concatenate(colors).To(device);
+    core::Tensor extrinsic_batch = core::Concatenate(poses);
+
+    for (auto backend : backends) {
+        for (auto &dtype :
+             std::vector<core::Dtype>{core::Float32, core::UInt16}) {
+            auto vbg_ref = Integrate(backend, dtype, device, 8);
+            auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                                      {core::Float32, dtype, dtype},
+                                      {{1}, {1}, {3}}, 3.0 / 512, 8, 10000,
+                                      device, backend);
+            vbg.IntegrateBatch(depth_batch, color_batch, intrinsic,
+                               extrinsic_batch);
+
+            // Frames are also fused into blocks touched by other frames of
+            // the batch, so allow a small difference.
+            int64_t n_ref = vbg_ref.ExtractPointCloud()
+                                    .GetPointPositions()
+                                    .GetLength();
+            int64_t n = vbg.ExtractPointCloud().GetPointPositions().GetLength();
+            EXPECT_NEAR(n, n_ref, n_ref / 100);
+
+            EXPECT_THROW(vbg.IntegrateBatch(depth_batch, color_batch,
+                                            intrinsic, extrinsics[0]),
+                         std::runtime_error);
+        }
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, EraseBlocks) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    Image depth = t::io::CreateImageFromFile(
+                          fmt::format("{}/RGBD/depth/{:05d}.png",
+                                      std::string(TEST_DATA_DIR), 0))
+                          ->To(device);
+
+    std::string file_name = "tmp.npz";
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::UInt16, device, 8);
+
+        // Build the cached neighbor blocks before modifying the grid.
+        vbg.ExtractPointCloud();
+
+        core::HashMap hashmap = vbg.GetHashMap();
+        core::Tensor active_keys = hashmap.GetKeyTensor().IndexGet(
+                {hashmap.GetActiveIndices().To(core::Int64)});
+        int64_t n = active_keys.GetLength();
+        vbg.EraseBlocks(active_keys.Slice(0, 0, n / 2));
+        EXPECT_EQ(vbg.GetHashMap().Size(), n - n / 2);
+
+        // Re-activate part of the erased blocks.
+        core::Tensor frustum_block_coords =
+                vbg.GetUniqueBlockCoordinates(depth, intrinsic, extrinsics[0]);
+        vbg.Integrate(frustum_block_coords, depth, intrinsic, extrinsics[0]);
+
+        auto pcd = vbg.ExtractPointCloud();
+        auto mesh = vbg.ExtractTriangleMesh();
+
+        // A loaded grid looks up its neighbor blocks from scratch.
+        vbg.Save(file_name);
+        auto vbg_loaded = VoxelBlockGrid::Load(file_name);
+        auto pcd_loaded = vbg_loaded.ExtractPointCloud();
+        auto mesh_loaded = vbg_loaded.ExtractTriangleMesh();
+
+        EXPECT_EQ(pcd.GetPointPositions().GetLength(),
+                  pcd_loaded.GetPointPositions().GetLength());
+        EXPECT_EQ(mesh.GetTriangleIndices().GetLength(),
+                  mesh_loaded.GetTriangleIndices().GetLength());
+        utility::filesystem::RemoveFile(file_name);
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, ExtractTriangleMeshIncremental) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    Image depth = t::io::CreateImageFromFile(
+                          fmt::format("{}/RGBD/depth/{:05d}.png",
+                                      std::string(TEST_DATA_DIR), 0))
+                          ->To(device);
+
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::UInt16, device, 8);
+
+        // The first call re-meshes every block.
+        core::Tensor keys, erased_keys;
+        std::vector<TriangleMesh> chunks;
+        std::tie(keys, chunks, erased_keys) =
+                vbg.ExtractTriangleMeshIncremental();
+        EXPECT_EQ(keys.GetLength(), vbg.GetHashMap().Size());
+        EXPECT_EQ(static_cast<int64_t>(chunks.size()), keys.GetLength());
+        EXPECT_EQ(erased_keys.GetLength(), 0);
+
+        int64_t num_triangles = 0;
+        for (const auto &chunk : chunks) {
+            num_triangles += chunk.GetTriangleIndices().GetLength();
+        }
+        EXPECT_EQ(num_triangles,
+                  vbg.ExtractTriangleMesh().GetTriangleIndices().GetLength());
+
+        // Nothing changed.
+        std::tie(keys, chunks, erased_keys) =
+                vbg.ExtractTriangleMeshIncremental();
+        EXPECT_EQ(keys.GetLength(), 0);
+        EXPECT_TRUE(chunks.empty());
+
+        // The blocks of one frame and their neighbors are re-meshed.
+        core::Tensor frustum_block_coords =
+                vbg.GetUniqueBlockCoordinates(depth, intrinsic, extrinsics[0]);
+        vbg.Integrate(frustum_block_coords, depth, intrinsic, extrinsics[0]);
+        std::tie(keys, chunks, erased_keys) =
+                vbg.ExtractTriangleMeshIncremental();
+        EXPECT_GE(keys.GetLength(), frustum_block_coords.GetLength());
+
+        // Erased blocks are reported once.
+        core::Tensor erased = frustum_block_coords.Slice(0, 0, 10);
+        vbg.EraseBlocks(erased);
+        std::tie(keys, chunks, erased_keys) =
+                vbg.ExtractTriangleMeshIncremental();
+        EXPECT_EQ(erased_keys.GetLength(), 10);
+        EXPECT_GT(keys.GetLength(), 0);
+        std::tie(keys, chunks, erased_keys) =
+                vbg.ExtractTriangleMeshIncremental();
+        EXPECT_EQ(erased_keys.GetLength(), 0);
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, RecycleBlocks) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::Float32, device, 8);
+        int64_t num_blocks = vbg.GetHashMap().Size();
+        int64_t num_points =
+                vbg.ExtractPointCloud().GetPointPositions().GetLength();
+
+        // Free-space blocks carry no surface.
+        int64_t num_recycled = vbg.RecycleBlocks();
+        EXPECT_GT(num_recycled, 0);
+        EXPECT_EQ(vbg.GetHashMap().Size(), num_blocks - num_recycled);
+        EXPECT_EQ(vbg.ExtractPointCloud().GetPointPositions().GetLength(),
+                  num_points);
+        EXPECT_EQ(vbg.RecycleBlocks(), 0);
+
+        // Decayed to zero, every block is recycled.
+        EXPECT_EQ(vbg.RecycleBlocks(0.0f, 0.0f), num_blocks - num_recycled);
+        EXPECT_EQ(vbg.GetHashMap().Size(), 0);
+
+        EXPECT_ANY_THROW(vbg.RecycleBlocks(0.0f, 2.0f));
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, IO) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends = EnumerateBackends(device);
@@ -295,10 +540,88 @@ TEST_P(VoxelBlockGridPermuteDevices, IO) {
 
         EXPECT_EQ(pcd.GetPointPositions().GetLength(),
                   pcd_loaded.GetPointPositions().GetLength());
+
+        // Load to an explicit device.
+        auto vbg_on_device = VoxelBlockGrid::Load(file_name, device);
+        EXPECT_EQ(vbg_on_device.GetHashMap().GetDevice(), device);
+        EXPECT_EQ(vbg_on_device.GetHashMap().Size(), vbg.GetHashMap().Size());
+        EXPECT_EQ(pcd.GetPointPositions().GetLength(),
+                  vbg_on_device.ExtractPointCloud()
+                          .GetPointPositions()
+                          .GetLength());
         utility::filesystem::RemoveFile(file_name);
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, ParallelIO) {
+    core::Device device = GetParam();
+    core::HashBackendType backend = EnumerateBackends(device)[0];
+
+    std::vector<VoxelBlockGrid> grids;
+    std::vector<std::string> file_names;
+    for (int64_t block_resolution : {8, 16, 8}) {
+        grids.push_back(
+                Integrate(backend, core::UInt16, device, block_resolution));
+        file_names.push_back(
+                fmt::format("tmp_fragment_{}.npz", file_names.size()));
+    }
+    t::io::WriteVoxelBlockGrids(file_names, grids, 2);
+
+    std::vector<VoxelBlockGrid> grids_loaded =
+            t::io::ReadVoxelBlockGrids(file_names, device, 2);
+    ASSERT_EQ(grids_loaded.size(), grids.size());
+    for (size_t i = 0; i < grids.size(); ++i) {
+        EXPECT_EQ(grids_loaded[i].GetHashMap().GetDevice(), device);
+        EXPECT_EQ(grids_loaded[i].GetHashMap().Size(),
+                  grids[i].GetHashMap().Size());
+        utility::filesystem::RemoveFile(file_names[i]);
+    }
+
+    // Missing files and mismatched lists raise errors.
+    EXPECT_ANY_THROW(t::io::ReadVoxelBlockGrids(file_names, device));
+    EXPECT_ANY_THROW(t::io::WriteVoxelBlockGrids({"tmp_fragment.npz"}, grids));
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, StreamTiles) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    std::string directory = "tmp_tiles";
+    for (auto backend : backends) {
+        auto vbg = Integrate(backend, core::UInt16, device, 8);
+        int64_t num_blocks = vbg.GetHashMap().Size();
+        int64_t num_points =
+                vbg.ExtractPointCloud().GetPointPositions().GetLength();
+
+        // Stream out the tiles beyond 1m, then the rest.
+        core::Tensor position = core::Tensor::Init<float>({1.5, 1.5, 1.5});
+        int64_t num_far = vbg.StreamOutTiles(directory, position, 1.0, 4);
+        EXPECT_GT(num_far, 0);
+        EXPECT_EQ(vbg.GetHashMap().Size(), num_blocks - num_far);
+        EXPECT_EQ(vbg.StreamOutTiles(directory, position, 0.0, 4),
+                  num_blocks - num_far);
+        EXPECT_EQ(vbg.GetHashMap().Size(), 0);
+        EXPECT_TRUE(utility::filesystem::FileExists(directory + "/tiles.npz"));
+
+        // Stream everything back, partly from prefetched tiles.
+        vbg.PrefetchTiles(directory, position.View({1, 3}), 1.0, 4);
+        EXPECT_EQ(vbg.StreamInTiles(directory, position, 1e3, 4), num_blocks);
+        EXPECT_EQ(vbg.GetHashMap().Size(), num_blocks);
+        EXPECT_EQ(vbg.StreamInTiles(directory, position, 1e3, 4), 0);
+        EXPECT_EQ(vbg.ExtractPointCloud().GetPointPositions().GetLength(),
+                  num_points);
+
+        EXPECT_ANY_THROW(vbg.StreamOutTiles(directory, position, 0.0, 8));
+
+        std::vector<std::string> filenames;
+        utility::filesystem::ListFilesInDirectory(directory, filenames);
+        for (const std::string &filename : filenames) {
+            utility::filesystem::RemoveFile(filename);
+        }
+        utility::filesystem::DeleteDirectory(directory);
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
@@ -342,6 +665,25 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
             EXPECT_TRUE(result_rendering.Contains("depth"));
             EXPECT_TRUE(result_rendering.Contains("color"));
 
+            // Skipping free blocks keeps the surface seen by the last frame.
+            core::Tensor depth_input =
+                    depth.AsTensor().To(core::Float32).Reshape(
+                            {depth.GetRows(), depth.GetCols()});
+            core::Tensor depth_rendered = result_rendering["depth"].Reshape(
+                    {depth.GetRows(), depth.GetCols()});
+            core::Tensor valid_input = depth_input.Gt(0).LogicalAnd(
+                    depth_input.Lt(depth_max * depth_scale));
+            core::Tensor valid = valid_input.LogicalAnd(depth_rendered.Gt(0));
+            int64_t num_valid_input = valid_input.NonZero().GetShape(1);
+            int64_t num_valid = valid.NonZero().GetShape(1);
+            EXPECT_GT(num_valid, num_valid_input / 2);
+            float mean_error = (depth_rendered.IndexGet({valid}) -
+                                depth_input.IndexGet({valid}))
+                                       .Abs()
+                                       .Mean({0})
+                                       .Item<float>();
+            EXPECT_LT(mean_error, 0.03 * depth_scale);
+
             auto result_diff_rendering = vbg.RayCast(
                     frustum_block_coords, intrinsic, extrinsics[i],
                     depth.GetCols(), depth.GetRows(),
@@ -359,6 +701,164 @@ TEST_P(VoxelBlockGridPermuteDevices, RayCasting) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, MultiResolution) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends =
+            EnumerateBackends(device, /* include_slab = */ false);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+
+    EXPECT_ANY_THROW(MultiResolutionVoxelBlockGrid(
+            {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+            3.0 / 512, {2.0, 1.0}, 8, 1000, device));
+
+    for (auto backend : backends) {
+        auto mrvbg = MultiResolutionVoxelBlockGrid(
+                {"tsdf", "weight", "color"},
+                {core::Float32, core::Float32, core::Float32},
+                {{1}, {1}, {3}}, 3.0 / 512, {1.5}, 8, 10000, device, backend);
+        EXPECT_EQ(mrvbg.GetLevelCount(), 2);
+        EXPECT_FLOAT_EQ(mrvbg.GetVoxelSize(1), 2 * mrvbg.GetVoxelSize(0));
+
+        for (size_t i = 0; i < extrinsics.size(); ++i) {
+            Image depth = t::io::CreateImageFromFile(
+                                  fmt::format("{}/RGBD/depth/{:05d}.png",
+                                              std::string(TEST_DATA_DIR), i))
+                                  ->To(device);
+            Image color = t::io::CreateImageFromFile(
+                                  fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                              std::string(TEST_DATA_DIR), i))
+                                  ->To(device);
+            mrvbg.Integrate(depth, color, intrinsic, extrinsics[i],
+                            depth_scale, depth_max);
+        }
+        EXPECT_GT(mrvbg.GetLevel(0).GetHashMap().Size(), 0);
+        EXPECT_GT(mrvbg.GetLevel(1).GetHashMap().Size(), 0);
+
+        // Points owned by a finer level are dropped from coarser levels.
+        int64_t num_level_points = 0;
+        for (int64_t l = 0; l < mrvbg.GetLevelCount(); ++l) {
+            num_level_points += mrvbg.GetLevel(l)
+                                        .ExtractPointCloud()
+                                        .GetPointPositions()
+                                        .GetLength();
+        }
+        PointCloud pcd = mrvbg.ExtractPointCloud();
+        EXPECT_GT(pcd.GetPointPositions().GetLength(), 0);
+        EXPECT_LE(pcd.GetPointPositions().GetLength(), num_level_points);
+        EXPECT_TRUE(pcd.HasPointColors());
+
+        TriangleMesh mesh = mrvbg.ExtractTriangleMesh();
+        EXPECT_GT(mesh.GetTriangleIndices().GetLength(), 0);
+        EXPECT_TRUE(mesh.HasVertexColors());
+
+        int i = extrinsics.size() - 1;
+        TensorMap result =
+                mrvbg.RayCast(intrinsic, extrinsics[i], 640, 480,
+                              {"vertex", "depth", "color"}, depth_scale, 0.1,
+                              depth_max, 1.0);
+        EXPECT_EQ(result["depth"].GetShape(), core::SizeVector({480, 640, 1}));
+        EXPECT_EQ(result["color"].GetShape(), core::SizeVector({480, 640, 3}));
+        EXPECT_GT(result["depth"].Gt(0).NonZero().GetShape(1), 0);
+
+        EXPECT_ANY_THROW(mrvbg.RayCast(intrinsic, extrinsics[i], 640, 480,
+                                       {"index"}));
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, MultiDevice) {
+    core::Device device = GetParam();
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+
+    EXPECT_ANY_THROW(MultiDeviceVoxelBlockGrid(
+            {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+            3.0 / 512, 8, 1000, {}));
+    EXPECT_ANY_THROW(MultiDeviceVoxelBlockGrid(
+            {"tsdf", "weight"}, {core::Float32, core::Float32}, {{1}, {1}},
+            3.0 / 512, 8, 1000, {device}, 0));
+
+    // Three partitions on the same device, compared to a single grid.
+    auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                              {core::Float32, core::Float32, core::Float32},
+                              {{1}, {1}, {3}}, 3.0 / 512, 8, 10000, device);
+    auto mdvbg = MultiDeviceVoxelBlockGrid(
+            {"tsdf", "weight", "color"},
+            {core::Float32, core::Float32, core::Float32}, {{1}, {1}, {3}},
+            3.0 / 512, 8, 10000, {device, device, device}, 4);
+    EXPECT_EQ(mdvbg.GetDeviceCount(), 3);
+
+    for (size_t i = 0; i < extrinsics.size(); ++i) {
+        Image depth = t::io::CreateImageFromFile(
+                              fmt::format("{}/RGBD/depth/{:05d}.png",
+                                          std::string(TEST_DATA_DIR), i))
+                              ->To(device);
+        Image color = t::io::CreateImageFromFile(
+                              fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                          std::string(TEST_DATA_DIR), i))
+                              ->To(device);
+        core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                depth, intrinsic, extrinsics[i], depth_scale, depth_max);
+        vbg.Integrate(block_coords, depth, color, intrinsic, extrinsics[i],
+                      depth_scale, depth_max, 4.0);
+        mdvbg.Integrate(depth, color, intrinsic, extrinsics[i], depth_scale,
+                        depth_max);
+    }
+
+    // Each block is stored by its owner, and by the devices whose regions
+    // are within one block.
+    core::HashMap hashmap = vbg.GetHashMap();
+    core::Tensor block_coords = hashmap.GetKeyTensor().IndexGet(
+            {hashmap.GetActiveIndices().To(core::Int64)});
+    core::Tensor owners = mdvbg.GetOwners(block_coords);
+    int64_t num_device_blocks = 0;
+    for (int64_t i = 0; i < mdvbg.GetDeviceCount(); ++i) {
+        core::HashMap device_hashmap = mdvbg.GetGrid(i).GetHashMap();
+        core::Tensor buf_indices, masks;
+        device_hashmap.Find(block_coords, buf_indices, masks);
+        EXPECT_TRUE(masks.IndexGet({owners.Eq(i)}).All());
+        num_device_blocks += device_hashmap.Size();
+    }
+    EXPECT_GT(num_device_blocks, hashmap.Size());
+
+    // The halo makes the parts meet exactly.
+    PointCloud pcd = mdvbg.ExtractPointCloud();
+    EXPECT_EQ(pcd.GetPointPositions().GetLength(),
+              vbg.ExtractPointCloud().GetPointPositions().GetLength());
+    EXPECT_TRUE(pcd.HasPointColors());
+
+    TriangleMesh mesh = mdvbg.ExtractTriangleMesh();
+    EXPECT_EQ(mesh.GetTriangleIndices().GetLength(),
+              vbg.ExtractTriangleMesh().GetTriangleIndices().GetLength());
+    EXPECT_TRUE(mesh.HasVertexColors());
+
+    int i = extrinsics.size() - 1;
+    TensorMap result = mdvbg.RayCast(intrinsic, extrinsics[i], 640, 480,
+                                     {"depth", "color"}, depth_scale, 0.1,
+                                     depth_max, 1.0);
+    TensorMap expected = vbg.RayCast(block_coords, intrinsic, extrinsics[i],
+                                     640, 480, {"depth", "color"}, depth_scale,
+                                     0.1, depth_max, 1.0);
+    EXPECT_EQ(result["color"].GetShape(), core::SizeVector({480, 640, 3}));
+    int64_t num_hits = expected["depth"].Gt(0).NonZero().GetShape(1);
+    int64_t num_mismatches = (result["depth"] - expected["depth"])
+                                     .Abs()
+                                     .Gt(0.01 * depth_scale)
+                                     .NonZero()
+                                     .GetShape(1);
+    EXPECT_GT(num_hits, 0);
+    EXPECT_LT(num_mismatches, 0.01 * num_hits);
+
+    EXPECT_ANY_THROW(mdvbg.RayCast(intrinsic, extrinsics[i], 640, 480,
+                                   {"index"}));
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, DISABLED_RayCastingVisualize) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends =
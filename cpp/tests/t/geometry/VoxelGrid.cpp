@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelGrid,
+                         VoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(VoxelGridPermuteDevices, CreateFromPointCloud) {
+    core::Device device = GetParam();
+
+    // Three points share a voxel, colors are averaged.
+    core::Tensor points = core::Tensor::Init<float>(
+            {{0, 0, 0}, {0.1, 0.2, 0.3}, {0.4, 0.4, 0.4}, {1, 0, 0}, {0, 0, 2}},
+            device);
+    core::Tensor colors = core::Tensor::Init<float>(
+            {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}, {0.5, 0.5, 0.5}},
+            device);
+    t::geometry::PointCloud pcd(points);
+    pcd.SetPointColors(colors);
+
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromPointCloud(pcd, 1.0);
+    EXPECT_EQ(voxel_grid.Size(), 3);
+    EXPECT_TRUE(voxel_grid.HasColors());
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    EXPECT_TRUE(voxel_grid.GetOrigin().AllClose(
+            core::Tensor::Init<double>({-0.5, -0.5, -0.5}, device)));
+
+    // Same voxels and colors as the legacy implementation.
+    geometry::PointCloud pcd_legacy = pcd.ToLegacy();
+    auto voxel_grid_legacy =
+            geometry::VoxelGrid::CreateFromPointCloud(pcd_legacy, 1.0);
+    geometry::VoxelGrid voxel_grid_converted = voxel_grid.ToLegacy();
+    ASSERT_EQ(voxel_grid_converted.voxels_.size(),
+              voxel_grid_legacy->voxels_.size());
+    for (const auto &it : voxel_grid_legacy->voxels_) {
+        auto found = voxel_grid_converted.voxels_.find(it.first);
+        ASSERT_TRUE(found != voxel_grid_converted.voxels_.end());
+        EXPECT_TRUE(found->second.color_.isApprox(it.second.color_, 1e-6));
+    }
+
+    // Inserting more points keeps accumulating.
+    voxel_grid.Insert(core::Tensor::Init<float>({{0.2, 0.2, 0.2}}, device),
+                      core::Tensor::Init<float>({{1, 1, 1}}, device));
+    EXPECT_EQ(voxel_grid.Size(), 3);
+    core::Tensor coordinates = voxel_grid.GetVoxelCoordinates();
+    core::Tensor voxel_colors = voxel_grid.GetVoxelColors();
+    core::Tensor centers = voxel_grid.GetVoxelCenters();
+    for (int64_t i = 0; i < voxel_grid.Size(); ++i) {
+        if (coordinates[i].AllEqual(
+                    core::Tensor::Init<int>({0, 0, 0}, device))) {
+            EXPECT_TRUE(voxel_colors[i].AllClose(
+                    core::Tensor::Init<float>({0.5, 0.5, 0.5}, device)));
+            EXPECT_TRUE(centers[i].AllClose(
+                    core::Tensor::Init<double>({0, 0, 0}, device)));
+        }
+    }
+}
+
+TEST_P(VoxelGridPermuteDevices, CheckIfIncluded) {
+    core::Device device = GetParam();
+
+    t::geometry::VoxelGrid voxel_grid(
+            0.5, core::Tensor::Init<double>({1, 1, 1}), 10, device);
+    EXPECT_TRUE(voxel_grid.IsEmpty());
+    voxel_grid.Insert(core::Tensor::Init<double>(
+            {{1.1, 1.1, 1.1}, {0.9, 1.1, 1.1}, {1.1, 1.1, 1.1}}, device));
+    EXPECT_EQ(voxel_grid.Size(), 2);
+    EXPECT_FALSE(voxel_grid.HasColors());
+
+    core::Tensor queries = core::Tensor::Init<float>({{1.0, 1.0, 1.0},
+                                                      {1.49, 1.49, 1.49},
+                                                      {1.5, 1.0, 1.0},
+                                                      {0.5, 1.0, 1.0},
+                                                      {0.49, 1.0, 1.0}},
+                                                     device);
+    EXPECT_TRUE(voxel_grid.GetVoxel(queries).AllEqual(core::Tensor::Init<int>(
+            {{0, 0, 0}, {0, 0, 0}, {1, 0, 0}, {-1, 0, 0}, {-2, 0, 0}},
+            device)));
+    EXPECT_TRUE(voxel_grid.CheckIfIncluded(queries).AllEqual(
+            core::Tensor::Init<bool>({true, true, false, true, false},
+                                     device)));
+
+    // The same answers as the legacy implementation.
+    geometry::VoxelGrid voxel_grid_legacy = voxel_grid.ToLegacy();
+    std::vector<bool> included_legacy = voxel_grid_legacy.CheckIfIncluded(
+            core::eigen_converter::TensorToEigenVector3dVector(queries));
+    EXPECT_EQ(included_legacy,
+              std::vector<bool>({true, true, false, true, false}));
+
+    t::geometry::VoxelGrid voxel_grid_from_legacy =
+            t::geometry::VoxelGrid::FromLegacy(voxel_grid_legacy, device);
+    EXPECT_EQ(voxel_grid_from_legacy.Size(), 2);
+    EXPECT_TRUE(voxel_grid_from_legacy.CheckIfIncluded(queries).AllEqual(
+            voxel_grid.CheckIfIncluded(queries)));
+}
+
+}  // namespace tests
+}  // namespace open3d
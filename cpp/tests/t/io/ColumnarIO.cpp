@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ColumnarIO.h"
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ColumnarIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ColumnarIO,
+                         ColumnarIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ColumnarIOPermuteDevices, ColumnsWriteRead) {
+    const core::Device device = GetParam();
+    const std::string file_name = "columns.o3dcols";
+
+    const core::Tensor a = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device);
+    // Non-contiguous columns are stored as contiguous columns.
+    const core::Tensor b =
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {3, 4, 5}}, device).T();
+    const core::Tensor c = core::Tensor::Init<bool>({true, false, true});
+    const core::Tensor empty({0, 3}, core::Float64);
+    t::io::WriteColumns(file_name,
+                        {{"a", a}, {"b", b}, {"c", c}, {"e", empty}});
+
+    std::map<std::string, core::Tensor> columns = t::io::ReadColumns(file_name);
+    ASSERT_EQ(columns.size(), 4u);
+    EXPECT_TRUE(columns.at("a").AllEqual(a.To(core::Device("CPU:0"))));
+    EXPECT_TRUE(columns.at("b").AllEqual(b.To(core::Device("CPU:0"))));
+    EXPECT_TRUE(columns.at("c").AllEqual(c));
+    EXPECT_EQ(columns.at("e").GetShape(), core::SizeVector({0, 3}));
+    EXPECT_EQ(columns.at("e").GetDtype(), core::Float64);
+    for (const auto &it : columns) {
+        EXPECT_EQ(it.second.GetDevice(), core::Device("CPU:0"));
+    }
+    // The columns stay valid after the file is deleted.
+    utility::filesystem::RemoveFile(file_name);
+    EXPECT_TRUE(columns.at("a").AllEqual(a.To(core::Device("CPU:0"))));
+
+    EXPECT_ANY_THROW(t::io::ReadColumns(file_name));
+}
+
+TEST_P(ColumnarIOPermuteDevices, FeaturesWriteRead) {
+    const core::Device device = GetParam();
+    const std::string file_name = "features.o3dcols";
+
+    std::vector<core::Tensor> features{
+            core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device),
+            core::Tensor({0, 3}, core::Float32, device),
+            core::Tensor::Init<float>({{7, 8, 9}}, device)};
+    t::io::WriteFeatures(file_name, features);
+    std::vector<core::Tensor> features_load = t::io::ReadFeatures(file_name);
+    ASSERT_EQ(features_load.size(), features.size());
+    for (size_t i = 0; i < features.size(); ++i) {
+        EXPECT_EQ(features_load[i].GetShape(), features[i].GetShape());
+        EXPECT_TRUE(features_load[i].AllEqual(
+                features[i].To(core::Device("CPU:0"))));
+    }
+
+    t::io::WriteFeatures(file_name, {});
+    EXPECT_TRUE(t::io::ReadFeatures(file_name).empty());
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(ColumnarIO, CorrespondencesWriteRead) {
+    const std::string file_name = "correspondences.o3dcols";
+
+    std::map<std::pair<int, int>, core::Tensor> correspondences{
+            {{0, 1}, core::Tensor::Init<int64_t>({{0, 1}, {2, 3}})},
+            {{0, 2}, core::Tensor({0, 2}, core::Int64)},
+            {{3, 5}, core::Tensor::Init<int64_t>({{4, 5}})}};
+    t::io::WriteCorrespondences(file_name, correspondences);
+    std::map<std::pair<int, int>, core::Tensor> correspondences_load =
+            t::io::ReadCorrespondences(file_name);
+    ASSERT_EQ(correspondences_load.size(), correspondences.size());
+    for (const auto &it : correspondences) {
+        const core::Tensor &load = correspondences_load.at(it.first);
+        EXPECT_EQ(load.GetShape(), it.second.GetShape());
+        EXPECT_TRUE(load.AllEqual(it.second));
+    }
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST(ColumnarIO, PoseGraphWriteRead) {
+    const std::string file_name = "pose_graph.o3dcols";
+
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < 3; ++i) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 1>(0, 3) = Eigen::Vector3d(i, 2 * i, 3 * i);
+        pose(0, 1) = 0.5 * i;
+        pose_graph.nodes_.emplace_back(pose);
+    }
+    Eigen::Matrix6d information = Eigen::Matrix6d::Identity();
+    information(1, 4) = 7;
+    pose_graph.edges_.emplace_back(0, 1, pose_graph.nodes_[1].pose_,
+                                   information, false, 1.0);
+    pose_graph.edges_.emplace_back(0, 2, pose_graph.nodes_[2].pose_,
+                                   information.transpose(), true, 0.25);
+    t::io::WritePoseGraphColumns(file_name, pose_graph);
+
+    pipelines::registration::PoseGraph pose_graph_load;
+    t::io::ReadPoseGraphColumns(file_name, pose_graph_load);
+    ASSERT_EQ(pose_graph_load.nodes_.size(), pose_graph.nodes_.size());
+    for (size_t i = 0; i < pose_graph.nodes_.size(); ++i) {
+        ExpectEQ(pose_graph_load.nodes_[i].pose_, pose_graph.nodes_[i].pose_);
+    }
+    ASSERT_EQ(pose_graph_load.edges_.size(), pose_graph.edges_.size());
+    for (size_t i = 0; i < pose_graph.edges_.size(); ++i) {
+        const auto &edge = pose_graph.edges_[i];
+        const auto &edge_load = pose_graph_load.edges_[i];
+        EXPECT_EQ(edge_load.source_node_id_, edge.source_node_id_);
+        EXPECT_EQ(edge_load.target_node_id_, edge.target_node_id_);
+        ExpectEQ(edge_load.transformation_, edge.transformation_);
+        ExpectEQ(edge_load.information_, edge.information_);
+        EXPECT_EQ(edge_load.uncertain_, edge.uncertain_);
+        EXPECT_EQ(edge_load.confidence_, edge.confidence_);
+    }
+    utility::filesystem::RemoveFile(file_name);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageReader.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/ImageIO.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class ImageReaderPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ImageReader,
+                         ImageReaderPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ImageReaderPermuteDevices, ReadNext) {
+    const core::Device device = GetParam();
+
+    // Frames filled with their index, and a missing file in the middle.
+    const int num_images = 10;
+    const int missing = 4;
+    std::vector<std::string> filenames;
+    for (int i = 0; i < num_images; ++i) {
+        filenames.push_back(utility::GetDataPathCommon(
+                "test_image_reader_" + std::to_string(i) + ".png"));
+        if (i != missing) {
+            t::geometry::Image image(
+                    core::Tensor::Full({8, 6, 3}, i, core::UInt8));
+            EXPECT_TRUE(t::io::WriteImage(filenames.back(), image));
+        }
+    }
+
+    for (int num_threads : {1, 3}) {
+        t::io::ImageReader reader;
+        EXPECT_TRUE(reader.Open(filenames, device, num_threads, 2));
+        EXPECT_EQ(reader.GetNumImages(), num_images);
+        t::geometry::Image image;
+        for (int i = 0; i < num_images; ++i) {
+            EXPECT_FALSE(reader.IsEOF());
+            EXPECT_EQ(reader.ReadNext(image), i != missing);
+            if (i == missing) {
+                EXPECT_TRUE(image.IsEmpty());
+                continue;
+            }
+            EXPECT_EQ(image.GetDevice(), device);
+            EXPECT_TRUE(image.AsTensor().AllEqual(
+                    core::Tensor::Full({8, 6, 3}, i, core::UInt8, device)));
+        }
+        EXPECT_TRUE(reader.IsEOF());
+        EXPECT_EQ(reader.GetNumImagesRead(), num_images);
+        EXPECT_FALSE(reader.ReadNext(image));
+    }
+
+    // Closing while images are being decoded.
+    t::io::ImageReader reader;
+    EXPECT_TRUE(reader.Open(filenames, device));
+    reader.Close();
+    EXPECT_FALSE(reader.IsOpened());
+
+    for (int i = 0; i < num_images; ++i) {
+        std::remove(filenames[i].c_str());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
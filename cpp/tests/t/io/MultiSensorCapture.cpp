@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/MultiSensorCapture.h"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Sensor returning \p num_frames frames filled with their index, with
+/// timestamps start + index * period.
+class FakeSensor : public t::io::RGBDSensor {
+public:
+    FakeSensor(uint64_t start, uint64_t period, int num_frames)
+        : start_(start), period_(period), num_frames_(num_frames) {}
+
+    bool InitSensor(const RGBDSensorConfig &sensor_config,
+                    size_t sensor_index,
+                    const std::string &filename) override {
+        return true;
+    }
+    bool StartCapture(bool start_record) override {
+        next_frame_ = 0;
+        return true;
+    }
+    void PauseRecord() override {}
+    void ResumeRecord() override {}
+    t::geometry::RGBDImage CaptureFrame(bool wait,
+                                        bool align_depth_to_color) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (next_frame_ >= num_frames_) {
+            return t::geometry::RGBDImage();
+        }
+        timestamp_ = start_ + next_frame_ * period_;
+        const int value = next_frame_++;
+        return t::geometry::RGBDImage(
+                core::Tensor::Full({4, 3, 3}, value, core::UInt8),
+                core::Tensor::Full({4, 3}, value, core::UInt16));
+    }
+    uint64_t GetTimestamp() const override { return timestamp_; }
+    void StopCapture() override {}
+    const t::io::RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+    std::string GetFilename() const override { return ""; }
+
+private:
+    uint64_t start_;
+    uint64_t period_;
+    int num_frames_;
+    int next_frame_ = 0;
+    uint64_t timestamp_ = 0;
+    t::io::RGBDVideoMetadata metadata_;
+};
+
+}  // namespace
+
+TEST(MultiSensorCapture, CaptureFrames) {
+    // The second sensor starts two frames later and is 1 ms behind.
+    const uint64_t period = 33333;
+    std::vector<std::shared_ptr<t::io::RGBDSensor>> sensors{
+            std::make_shared<FakeSensor>(0, period, 10),
+            std::make_shared<FakeSensor>(2 * period + 1000, period, 8)};
+    t::io::MultiSensorCapture capture(sensors, 16, 5000);
+    EXPECT_EQ(capture.GetNumSensors(), 2u);
+    EXPECT_FALSE(capture.IsCapturing());
+    EXPECT_TRUE(capture.StartCapture());
+    EXPECT_TRUE(capture.IsCapturing());
+
+    std::vector<t::geometry::RGBDImage> frames;
+    std::vector<uint64_t> timestamps;
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(capture.CaptureFrames(frames, timestamps));
+        ASSERT_EQ(frames.size(), 2u);
+        EXPECT_EQ(timestamps[0], (i + 2) * period);
+        EXPECT_EQ(timestamps[1], (i + 2) * period + 1000);
+        EXPECT_TRUE(frames[0].color_.AsTensor().AllEqual(
+                core::Tensor::Full({4, 3, 3}, i + 2, core::UInt8)));
+        EXPECT_TRUE(frames[1].depth_.AsTensor().AllEqual(
+                core::Tensor::Full({4, 3, 1}, i, core::UInt16)));
+    }
+    EXPECT_FALSE(capture.CaptureFrames(frames, timestamps, false));
+    EXPECT_EQ(capture.GetNumDroppedFrames(0), 2);
+    EXPECT_EQ(capture.GetNumDroppedFrames(1), 0);
+
+    capture.StopCapture();
+    EXPECT_FALSE(capture.IsCapturing());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -237,5 +237,68 @@ TEST_P(NumpyIOPermuteDevices, NpzReadCompressed) {
     EXPECT_EQ(t5.GetDtype(), t5_load.GetDtype());
 }
 
+TEST_P(NumpyIOPermuteDevices, NpyReadMmap) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, device);
+    t.Save(file_name);
+    core::Tensor t_load = core::Tensor::Load(file_name, /*use_mmap=*/true);
+    EXPECT_TRUE(t_load.IsContiguous());
+    EXPECT_EQ(t_load.GetDtype(), core::Float32);
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+    // Writes are copy-on-write and do not change the file.
+    t_load[0][0] = 100.f;
+    EXPECT_EQ(t_load[0][0].Item<float>(), 100.f);
+    EXPECT_TRUE(t.AllClose(core::Tensor::Load(file_name).To(device)));
+
+    // The mapping outlives the loaded tensor's views.
+    core::Tensor row = t_load[3];
+    t_load = core::Tensor();
+    EXPECT_EQ(row.ToFlatVector<float>(), std::vector<float>({9, 10, 11}));
+
+    // Empty tensors are not mapped.
+    core::Tensor::Ones({0, 3}, core::Float32, device).Save(file_name);
+    t_load = core::Tensor::Load(file_name, /*use_mmap=*/true);
+    EXPECT_EQ(t_load.GetShape(), core::SizeVector({0, 3}));
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(NumpyIOPermuteDevices, NpzFile) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensors_lazy.npz";
+
+    core::Tensor t0 = core::Tensor::Init<int32_t>({{1, 2}, {3, 4}}, device);
+    core::Tensor t1 = core::Tensor::Init<double>({5, 6, 7}, device);
+    core::Tensor t2 = core::Tensor::Ones({0, 1}, core::Float32, device);
+    t::io::WriteNpz(file_name, {{"t0", t0}, {"t1", t1}, {"t2", t2}});
+
+    for (bool use_mmap : {false, true}) {
+        t::io::NpzFile npz(file_name, use_mmap);
+        EXPECT_EQ(npz.GetKeys().size(), 3);
+        EXPECT_TRUE(npz.Contains("t0"));
+        EXPECT_TRUE(npz.Contains("t1"));
+        EXPECT_TRUE(npz.Contains("t2"));
+        EXPECT_FALSE(npz.Contains("t3"));
+
+        core::Tensor t1_load = npz.Get("t1");
+        EXPECT_EQ(t1_load.GetDtype(), core::Float64);
+        EXPECT_TRUE(t1.AllClose(t1_load.To(device)));
+        core::Tensor t0_load = npz.Get("t0");
+        EXPECT_EQ(t0_load.GetDtype(), core::Int32);
+        EXPECT_TRUE(t0.AllEqual(t0_load.To(device)));
+        EXPECT_EQ(npz.Get("t2").GetShape(), core::SizeVector({0, 1}));
+        EXPECT_ANY_THROW(npz.Get("t3"));
+    }
+
+    t::io::WriteNpz(file_name, {});
+    EXPECT_EQ(t::io::NpzFile(file_name).GetKeys().size(), 0);
+
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
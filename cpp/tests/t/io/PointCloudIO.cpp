@@ -28,6 +28,8 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
@@ -191,6 +193,90 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// Binary little endian vertices with a packed, unaligned record layout, read
+// through the memory-mapped path, match the same data read from ASCII by rply.
+TEST(TPointCloudIO, ReadPointCloudFromPLYMapped) {
+    const std::string header_begin =
+            "ply\n"
+            "comment fixed-size element before the vertices\n"
+            "element camera 1\n"
+            "property float focal\n"
+            "element vertex 3\n"
+            "property float x\n"
+            "property float y\n"
+            "property float z\n"
+            "property uchar red\n"
+            "property uchar green\n"
+            "property uchar blue\n"
+            "property short skipped\n"
+            "property double intensity\n"
+            "element face 1\n"
+            "property list uchar int vertex_indices\n"
+            "end_header\n";
+    const std::vector<float> positions = {0.5f, 1, 2, 3, 4.25f, 5, -6, 7, 8};
+    const std::vector<uint8_t> colors = {1, 2, 3, 4, 5, 6, 255, 128, 0};
+    const std::vector<double> intensities = {0.1, 0.2, 0.3};
+
+    const std::string filename_binary =
+            utility::GetDataPathCommon("test_mapped_binary.ply");
+    {
+        std::ofstream file(filename_binary, std::ios::binary);
+        file << "ply\nformat binary_little_endian 1.0\n"
+             << header_begin.substr(4);
+        const float focal = 500;
+        file.write(reinterpret_cast<const char *>(&focal), sizeof(float));
+        for (int i = 0; i < 3; ++i) {
+            const int16_t skipped = 0;
+            file.write(reinterpret_cast<const char *>(&positions[3 * i]),
+                       3 * sizeof(float));
+            file.write(reinterpret_cast<const char *>(&colors[3 * i]), 3);
+            file.write(reinterpret_cast<const char *>(&skipped),
+                       sizeof(int16_t));
+            file.write(reinterpret_cast<const char *>(&intensities[i]),
+                       sizeof(double));
+        }
+        const uint8_t face_size = 3;
+        const int32_t face[3] = {0, 1, 2};
+        file.write(reinterpret_cast<const char *>(&face_size), 1);
+        file.write(reinterpret_cast<const char *>(face), sizeof(face));
+    }
+    const std::string filename_ascii =
+            utility::GetDataPathCommon("test_mapped_ascii.ply");
+    {
+        std::ofstream file(filename_ascii);
+        file << "ply\nformat ascii 1.0\n" << header_begin.substr(4);
+        file << "500\n";
+        file.precision(17);
+        for (int i = 0; i < 3; ++i) {
+            file << positions[3 * i] << " " << positions[3 * i + 1] << " "
+                 << positions[3 * i + 2] << " " << int(colors[3 * i]) << " "
+                 << int(colors[3 * i + 1]) << " " << int(colors[3 * i + 2])
+                 << " 0 " << intensities[i] << "\n";
+        }
+        file << "3 0 1 2\n";
+    }
+
+    t::geometry::PointCloud pcd_binary, pcd_ascii;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename_binary, pcd_binary));
+    EXPECT_TRUE(t::io::ReadPointCloud(filename_ascii, pcd_ascii));
+    EXPECT_TRUE(pcd_binary.GetPointPositions().AllEqual(
+            core::Tensor(positions, {3, 3}, core::Float32)));
+    EXPECT_TRUE(pcd_binary.GetPointColors().AllEqual(
+            core::Tensor(colors, {3, 3}, core::UInt8)));
+    EXPECT_TRUE(pcd_binary.GetPointAttr("intensity")
+                        .AllEqual(core::Tensor(intensities, {3, 1},
+                                               core::Float64)));
+    EXPECT_FALSE(pcd_binary.HasPointAttr("skipped"));
+    for (const auto &kv : pcd_ascii.GetPointAttr()) {
+        EXPECT_TRUE(pcd_binary.GetPointAttr(kv.first).AllEqual(kv.second));
+    }
+    EXPECT_EQ(pcd_binary.GetPointAttr().size(),
+              pcd_ascii.GetPointAttr().size());
+
+    std::remove(filename_binary.c_str());
+    std::remove(filename_ascii.c_str());
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
@@ -479,5 +565,178 @@ TEST(TPointCloudIO, ReadWritePointCloudAsPCD) {
     std::remove(filename_ascii_uint32.c_str());
 }
 
+TEST(TPointCloudIO, ReadWriteLargeCompressedPCD) {
+    // Large enough for the compressed data to span several LZF blocks.
+    const int64_t num_points = 200000;
+    t::geometry::PointCloud input_pcd(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                    .Reshape({num_points, 3}));
+    input_pcd.SetPointNormals(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float32)
+                    .Reshape({num_points, 3})
+                    .Div(num_points * 3));
+    input_pcd.SetPointColors(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                    .Reshape({num_points, 3})
+                    .To(core::UInt8));
+    input_pcd.SetPointAttr(
+            "custom_attr_int32",
+            core::Tensor::Arange(0, num_points, 1, core::Int32)
+                    .Reshape({num_points, 1}));
+
+    std::string filename = utility::GetDataPathCommon(
+            "test_pcd_pointcloud_large_binary_compressed.pcd");
+    EXPECT_TRUE(t::io::WritePointCloud(
+            filename, input_pcd,
+            open3d::io::WritePointCloudOption(
+                    /*ascii*/ false, /*compressed*/ true, false, {})));
+
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd));
+    for (auto &kv : input_pcd.GetPointAttr()) {
+        EXPECT_TRUE(kv.second.AllClose(pcd.GetPointAttr(kv.first)));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(TPointCloudIO, ReadWriteO3DPC) {
+    // Points along the x axis, so that the chunks have disjoint bounds.
+    const int64_t num_points = 10000;
+    core::Tensor positions =
+            core::Tensor::Zeros({num_points, 3}, core::Float64);
+    positions.Slice(1, 0, 1) =
+            core::Tensor::Arange(0, num_points, 1, core::Float64)
+                    .Reshape({num_points, 1});
+    t::geometry::PointCloud pcd(positions);
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("labels",
+                     core::Tensor::Arange(0, num_points, 1, core::Int32)
+                             .Reshape({num_points, 1}));
+    pcd.SetPointAttr("features",
+                     core::Tensor::Ones({num_points, 2, 2}, core::Float32));
+
+    const std::string filename =
+            utility::GetDataPathCommon("test_pointcloud.o3dpc");
+    for (bool compressed : {false, true}) {
+        EXPECT_TRUE(t::io::WritePointCloudToO3DPCWithChunkSize(
+                filename, pcd, 1000,
+                open3d::io::WritePointCloudOption(
+                        /*ascii*/ false, compressed, false, {})));
+
+        t::geometry::PointCloud pcd_read;
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read));
+        EXPECT_EQ(pcd_read.GetPointAttr().size(), 4);
+        for (auto &kv : pcd.GetPointAttr()) {
+            EXPECT_TRUE(kv.second.AllEqual(pcd_read.GetPointAttr(kv.first)));
+        }
+
+        // Attribute and bounding box pushdown.
+        t::io::O3DPCReadFilter filter;
+        filter.attributes = {"labels"};
+        filter.min_bound = Eigen::Vector3d(2500.5, -1, -1);
+        filter.max_bound = Eigen::Vector3d(4200, 1, 1);
+        EXPECT_TRUE(t::io::ReadPointCloudFromO3DPCWithFilter(filename,
+                                                             pcd_read, filter));
+        EXPECT_EQ(pcd_read.GetPointAttr().size(), 2);
+        EXPECT_TRUE(pcd_read.GetPointPositions().AllEqual(
+                positions.Slice(0, 2501, 4201)));
+        EXPECT_TRUE(pcd_read.GetPointAttr("labels").AllEqual(
+                pcd.GetPointAttr("labels").Slice(0, 2501, 4201)));
+
+        filter.attributes = {"normals"};
+        EXPECT_FALSE(t::io::ReadPointCloudFromO3DPCWithFilter(
+                filename, pcd_read, filter));
+    }
+    std::remove(filename.c_str());
+}
+
+TEST(TPointCloudIO, ReadWriteLAS) {
+    const int64_t num_points = 1000;
+    core::Tensor positions =
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float64)
+                    .Reshape({num_points, 3}) *
+                    0.25 +
+            core::Tensor::Init<double>({{500000.0, 4000000.0, 100.0}});
+    std::vector<uint8_t> classification(num_points);
+    std::vector<uint8_t> return_number(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        classification[i] = uint8_t(i % 3 + 1);
+        return_number[i] = uint8_t(i % 2 + 1);
+    }
+    t::geometry::PointCloud pcd(positions);
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::UInt16)
+                             .Reshape({num_points, 1}));
+    pcd.SetPointAttr(
+            "classification",
+            core::Tensor(classification, {num_points, 1}, core::UInt8));
+    pcd.SetPointAttr(
+            "return_number",
+            core::Tensor(return_number, {num_points, 1}, core::UInt8));
+    pcd.SetPointAttr("number_of_returns",
+                     core::Tensor::Full({num_points, 1}, 2, core::UInt8));
+    pcd.SetPointAttr("gps_time",
+                     core::Tensor::Arange(0, num_points, 1, core::Float64)
+                                     .Reshape({num_points, 1}) *
+                             0.001);
+    pcd.SetPointColors(core::Tensor::Full({num_points, 3}, 255, core::UInt8));
+
+    const std::string filename = utility::GetDataPathCommon("test.las");
+    EXPECT_TRUE(t::io::WritePointCloud(filename, pcd));
+
+    t::geometry::PointCloud pcd_read;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename, pcd_read));
+    EXPECT_TRUE(pcd_read.GetPointPositions().AllClose(positions, 0, 1e-6));
+    for (const std::string key : {"intensities", "classification",
+                                  "return_number", "number_of_returns"}) {
+        const core::Tensor &attr = pcd_read.GetPointAttr(key);
+        EXPECT_TRUE(
+                attr.AllEqual(pcd.GetPointAttr(key).To(attr.GetDtype())));
+    }
+    EXPECT_TRUE(pcd_read.GetPointAttr("gps_time").AllClose(
+            pcd.GetPointAttr("gps_time")));
+    EXPECT_TRUE(pcd_read.GetPointColors().AllEqual(
+            core::Tensor::Full({num_points, 3}, 65535, core::UInt16)));
+
+    // Filters are applied while decoding, in chunks smaller than the file.
+    t::io::LASReadFilter filter;
+    filter.classifications = {2};
+    filter.return_numbers = {1};
+    filter.max_bound = Eigen::Vector3d(500000.0 + 0.25 * 1500, 1e7, 1e3);
+    filter.chunk_size = 64;
+    t::geometry::PointCloud pcd_filtered;
+    EXPECT_TRUE(t::io::ReadPointCloudFromLASWithFilter(filename, pcd_filtered,
+                                                       filter));
+    std::vector<int64_t> expected_indices;
+    for (int64_t i = 0; i < num_points; ++i) {
+        if (classification[i] == 2 && return_number[i] == 1 &&
+            3 * i <= 1500) {
+            expected_indices.push_back(i);
+        }
+    }
+    const int64_t num_expected = int64_t(expected_indices.size());
+    EXPECT_GT(num_expected, 0);
+    EXPECT_TRUE(pcd_filtered.GetPointPositions().AllClose(
+            positions.IndexGet({core::Tensor(expected_indices,
+                                             {num_expected}, core::Int64)}),
+            0, 1e-6));
+    EXPECT_TRUE(pcd_filtered.GetPointAttr("classification")
+                        .AllEqual(core::Tensor::Full({num_expected, 1}, 2,
+                                                     core::UInt8)));
+
+    // LAZ compressed point records are rejected.
+    {
+        std::fstream file(filename,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(104);
+        file.put(char(0x83));
+    }
+    EXPECT_FALSE(t::io::ReadPointCloud(filename, pcd_read));
+
+    std::remove(filename.c_str());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudReader.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Reads filename in chunks of max_points and concatenates the chunks.
+t::geometry::PointCloud ReadInChunks(const std::string &filename,
+                                     int64_t max_points,
+                                     bool prefetch,
+                                     int64_t &num_chunks) {
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(filename, "auto", prefetch));
+    std::unordered_map<std::string, std::vector<core::Tensor>> chunks;
+    t::geometry::PointCloud chunk;
+    num_chunks = 0;
+    while (reader.ReadNext(max_points, chunk)) {
+        EXPECT_LE(chunk.GetPointPositions().GetLength(), max_points);
+        for (const auto &kv : chunk.GetPointAttr()) {
+            chunks[kv.first].push_back(kv.second);
+        }
+        ++num_chunks;
+    }
+    EXPECT_TRUE(chunk.IsEmpty());
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_FALSE(reader.ReadNext(max_points, chunk));
+
+    t::geometry::PointCloud pointcloud;
+    for (const auto &kv : chunks) {
+        pointcloud.SetPointAttr(kv.first, core::Concatenate(kv.second, 0));
+    }
+    return pointcloud;
+}
+
+}  // namespace
+
+TEST(PointCloudReader, ReadNext) {
+    const int64_t num_points = 1000;
+    t::geometry::PointCloud pcd(
+            core::Tensor::Arange(0, num_points * 3, 1, core::Float64)
+                    .Reshape({num_points, 3}) *
+            0.1);
+    pcd.SetPointNormals(core::Tensor::Ones({num_points, 3}, core::Float64));
+    pcd.SetPointColors(core::Tensor::Arange(0, num_points * 3, 1, core::Int64)
+                               .Reshape({num_points, 3})
+                               .To(core::UInt8));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Arange(0, num_points, 1, core::Float64)
+                             .Reshape({num_points, 1}));
+
+    // The last four are not decoded in chunks but read whole.
+    const std::vector<std::pair<std::string, t::io::WritePointCloudOption>>
+            files{{"binary.ply", {false, false}}, {"ascii.pcd", {true, false}},
+                  {"binary.pcd", {false, false}}, {"test.xyzi", {true, false}},
+                  {"test.npz", {false, false}},   {"ascii.ply", {true, false}},
+                  {"compressed.pcd", {false, true}}};
+    for (const auto &file : files) {
+        const std::string filename =
+                utility::GetDataPathCommon("test_reader_" + file.first);
+        EXPECT_TRUE(t::io::WritePointCloud(filename, pcd, file.second));
+        t::geometry::PointCloud expected;
+        EXPECT_TRUE(t::io::ReadPointCloud(filename, expected));
+
+        for (bool prefetch : {false, true}) {
+            int64_t num_chunks;
+            const t::geometry::PointCloud read =
+                    ReadInChunks(filename, 64, prefetch, num_chunks);
+            EXPECT_EQ(num_chunks, 16) << file.first;
+            EXPECT_EQ(read.GetPointAttr().size(),
+                      expected.GetPointAttr().size())
+                    << file.first;
+            for (const auto &kv : expected.GetPointAttr()) {
+                EXPECT_TRUE(read.GetPointAttr(kv.first).AllEqual(kv.second))
+                        << file.first << " " << kv.first;
+            }
+        }
+        std::remove(filename.c_str());
+    }
+}
+
+TEST(PointCloudReader, ReadNextXYZ) {
+    const std::string filename = utility::GetDataPathCommon("test_reader.xyzn");
+    {
+        std::ofstream file(filename);
+        file << "0 1 2 0 0 1\n"
+             << "invalid line\n"
+             << "3 4 5 0 1 0\r\n"
+             << "6 7 8 1 0 0";
+    }
+
+    t::io::PointCloudReader reader;
+    EXPECT_TRUE(reader.Open(filename));
+    EXPECT_EQ(reader.GetNumPoints(), -1);
+    t::geometry::PointCloud chunk;
+    EXPECT_TRUE(reader.ReadNext(2, chunk));
+    EXPECT_TRUE(chunk.GetPointPositions().AllEqual(
+            core::Tensor::Init<double>({{0, 1, 2}, {3, 4, 5}})));
+    EXPECT_TRUE(chunk.GetPointNormals().AllEqual(
+            core::Tensor::Init<double>({{0, 0, 1}, {0, 1, 0}})));
+    EXPECT_FALSE(reader.IsEOF());
+    EXPECT_TRUE(reader.ReadNext(2, chunk));
+    EXPECT_TRUE(chunk.GetPointPositions().AllEqual(
+            core::Tensor::Init<double>({{6, 7, 8}})));
+    EXPECT_FALSE(reader.ReadNext(2, chunk));
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_EQ(reader.GetNumPointsRead(), 3);
+
+    reader.Close();
+    EXPECT_FALSE(reader.IsOpened());
+    EXPECT_FALSE(reader.Open(utility::GetDataPathCommon("missing.xyz")));
+    std::remove(filename.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
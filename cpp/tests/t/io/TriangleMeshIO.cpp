@@ -95,6 +95,106 @@ TEST(TriangleMeshIO, ReadWriteTriangleMeshOBJ) {
     std::remove(file_name.c_str());
 }
 
+TEST(TriangleMeshIO, ReadTriangleMeshSTL) {
+    geometry::TriangleMesh mesh_legacy;
+    EXPECT_TRUE(io::ReadTriangleMesh(utility::GetDataPathCommon("knot.ply"),
+                                     mesh_legacy));
+    mesh_legacy.ComputeTriangleNormals();
+    std::string file_name = utility::GetDataPathCommon("test_mesh.stl");
+    EXPECT_TRUE(io::WriteTriangleMesh(file_name, mesh_legacy));
+
+    // Binary STL stores 3 corners per triangle, which are merged again.
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh));
+    EXPECT_EQ(mesh.GetTriangleIndices().GetLength(), 2880);
+    EXPECT_EQ(mesh.GetVertexPositions().GetLength(), 1440);
+    t::geometry::TriangleMesh mesh_expected =
+            t::geometry::TriangleMesh::FromLegacy(mesh_legacy);
+    core::Tensor corners = mesh.GetVertexPositions().IndexGet(
+            {mesh.GetTriangleIndices().Reshape({-1})});
+    core::Tensor corners_expected =
+            mesh_expected.GetVertexPositions().IndexGet(
+                    {mesh_expected.GetTriangleIndices().Reshape({-1})});
+    EXPECT_TRUE(corners.AllClose(corners_expected));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            mesh_expected.GetTriangleNormals(), 1e-5, 1e-5));
+    std::remove(file_name.c_str());
+
+    file_name = utility::GetDataPathCommon("test_mesh_ascii.stl");
+    FILE *file = fopen(file_name.c_str(), "w");
+    fprintf(file,
+            "solid square\n"
+            "  facet normal 0 0 1\n    outer loop\n"
+            "      vertex 0 0 0\n      vertex 1 0 0\n      vertex 1 1 0\n"
+            "    endloop\n  endfacet\n"
+            "  facet normal 0 0 1\n    outer loop\n"
+            "      vertex 0 0 0\n      vertex 1 1 0\n      vertex 0 1 -0\n"
+            "    endloop\n  endfacet\n"
+            "endsolid square\n");
+    fclose(file);
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh));
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}})));
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}})));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor::Init<float>({{0, 0, 1}, {0, 0, 1}})));
+    std::remove(file_name.c_str());
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshOFF) {
+    geometry::TriangleMesh mesh_legacy;
+    EXPECT_TRUE(io::ReadTriangleMesh(utility::GetDataPathCommon("knot.ply"),
+                                     mesh_legacy));
+    mesh_legacy.ComputeVertexNormals();
+    mesh_legacy.PaintUniformColor({0.2, 0.4, 0.6});
+    std::string file_name = utility::GetDataPathCommon("test_mesh.off");
+    EXPECT_TRUE(io::WriteTriangleMesh(file_name, mesh_legacy));
+
+    EXPECT_TRUE(io::ReadTriangleMesh(file_name, mesh_legacy));
+    t::geometry::TriangleMesh mesh;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh));
+    t::geometry::TriangleMesh mesh_expected =
+            t::geometry::TriangleMesh::FromLegacy(mesh_legacy);
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+            mesh_expected.GetVertexPositions()));
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            mesh_expected.GetVertexNormals()));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(
+            mesh_expected.GetVertexColors()));
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(
+            mesh_expected.GetTriangleIndices()));
+    std::remove(file_name.c_str());
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshGLTF) {
+    geometry::TriangleMesh mesh_legacy;
+    EXPECT_TRUE(io::ReadTriangleMesh(utility::GetDataPathCommon("knot.ply"),
+                                     mesh_legacy));
+    mesh_legacy.ComputeVertexNormals();
+    const t::geometry::TriangleMesh mesh_expected =
+            t::geometry::TriangleMesh::FromLegacy(mesh_legacy);
+
+    for (const std::string ext : {"gltf", "glb"}) {
+        std::string file_name = utility::GetDataPathCommon("test_mesh." + ext);
+        EXPECT_TRUE(io::WriteTriangleMesh(file_name, mesh_legacy));
+
+        t::geometry::TriangleMesh mesh;
+        EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh));
+        EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+                mesh_expected.GetVertexPositions()));
+        EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+                mesh_expected.GetVertexNormals()));
+        EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(
+                mesh_expected.GetTriangleIndices()));
+
+        std::vector<t::geometry::TriangleMesh> meshes;
+        EXPECT_TRUE(t::io::ReadTriangleMeshesFromGLTF(file_name, meshes));
+        EXPECT_EQ(meshes.size(), size_t(1));
+        std::remove(file_name.c_str());
+    }
+}
+
 // TODO: Add tests for triangle_uvs, materials, triangle_material_ids and
 // textures once these are supported.
 TEST(TriangleMeshIO, TriangleMeshLegecyCompatibility) {
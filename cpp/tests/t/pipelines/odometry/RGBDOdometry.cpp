@@ -122,6 +122,67 @@ TEST_P(OdometryPermuteDevices, ComputeOdometryResultPointToPlane) {
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 3e-4);
 }
 
+TEST_P(OdometryPermuteDevices, ComputeOdometryResultHybridFused) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_diff = 0.07;
+
+    t::geometry::Image src_depth = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/depth/00000.png"));
+    t::geometry::Image dst_depth = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/depth/00002.png"));
+    t::geometry::Image src_color = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/color/00000.jpg"));
+    t::geometry::Image dst_color = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/color/00002.jpg"));
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+
+    t::geometry::Image src_depth_processed =
+            src_depth.To(device).ClipTransform(depth_scale, 0.0, 3.0, NAN);
+    t::geometry::Image dst_depth_processed =
+            dst_depth.To(device).ClipTransform(depth_scale, 0.0, 3.0, NAN);
+    t::geometry::Image src_intensity =
+            src_color.To(device).RGBToGray().To(core::Float32);
+    t::geometry::Image dst_intensity =
+            dst_color.To(device).RGBToGray().To(core::Float32);
+
+    t::geometry::Image src_vertex_map =
+            src_depth_processed.CreateVertexMap(intrinsic_t, NAN);
+    auto dst_depth_grad = dst_depth_processed.FilterSobel();
+    auto dst_intensity_grad = dst_intensity.FilterSobel();
+
+    core::Tensor trans =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    for (int i = 0; i < 3; ++i) {
+        auto result = t::pipelines::odometry::ComputeOdometryResultHybrid(
+                src_depth_processed.AsTensor(), dst_depth_processed.AsTensor(),
+                src_intensity.AsTensor(), dst_intensity.AsTensor(),
+                dst_depth_grad.first.AsTensor(),
+                dst_depth_grad.second.AsTensor(),
+                dst_intensity_grad.first.AsTensor(),
+                dst_intensity_grad.second.AsTensor(), src_vertex_map.AsTensor(),
+                intrinsic_t, trans, depth_diff, depth_diff * 0.5, 0.1);
+        auto fused_result =
+                t::pipelines::odometry::ComputeOdometryResultHybridFused(
+                        src_depth_processed.AsTensor(),
+                        dst_depth_processed.AsTensor(),
+                        src_intensity.AsTensor(), dst_intensity.AsTensor(),
+                        intrinsic_t, trans, depth_diff, depth_diff * 0.5, 0.1);
+
+        EXPECT_NEAR(fused_result.fitness_, result.fitness_, 1e-3);
+        EXPECT_NEAR(fused_result.inlier_rmse_, result.inlier_rmse_, 1e-4);
+        EXPECT_TRUE(fused_result.transformation_.AllClose(
+                result.transformation_, 1e-3, 1e-4));
+        trans = result.transformation_.Matmul(trans).Contiguous();
+    }
+}
+
 TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScalePointToPlane) {
     core::Device device = GetParam();
     if (!t::geometry::Image::HAVE_IPPICV &&
@@ -322,5 +383,64 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
+TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleOdometryFrame) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    t::geometry::Image src_depth = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/depth/00000.png"));
+    t::geometry::Image dst_depth = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/depth/00002.png"));
+    t::geometry::Image src_color = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/color/00000.jpg"));
+    t::geometry::Image dst_color = *t::io::CreateImageFromFile(
+            utility::GetDataPathCommon("RGBD/color/00002.jpg"));
+
+    t::geometry::RGBDImage src, dst;
+    src.color_ = src_color.To(device);
+    dst.color_ = dst_color.To(device);
+    src.depth_ = src_depth.To(device);
+    dst.depth_ = dst_depth.To(device);
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    core::Tensor trans =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    std::vector<t::pipelines::odometry::OdometryConvergenceCriteria> criteria{
+            10, 5, 3};
+    t::pipelines::odometry::OdometryLossParams params(depth_diff);
+
+    for (auto method : {t::pipelines::odometry::Method::PointToPlane,
+                        t::pipelines::odometry::Method::Intensity,
+                        t::pipelines::odometry::Method::Hybrid}) {
+        auto result = t::pipelines::odometry::RGBDOdometryMultiScale(
+                src, dst, intrinsic_t, trans, depth_scale, depth_max, criteria,
+                method, params);
+
+        // The keyframe pyramids are built once and reused.
+        t::pipelines::odometry::OdometryFrame dst_frame(
+                dst, intrinsic_t, depth_scale, depth_max, 3, method, params);
+        EXPECT_TRUE(dst_frame.IsTarget());
+        EXPECT_EQ(dst_frame.GetNumLevels(), 3);
+        for (int i = 0; i < 2; ++i) {
+            t::pipelines::odometry::OdometryFrame src_frame(
+                    src, intrinsic_t, depth_scale, depth_max, 3, method,
+                    params, /*as_target=*/false);
+            auto frame_result = t::pipelines::odometry::RGBDOdometryMultiScale(
+                    src_frame, dst_frame, trans, criteria, params);
+            EXPECT_TRUE(frame_result.transformation_.AllClose(
+                    result.transformation_));
+            EXPECT_NEAR(frame_result.fitness_, result.fitness_, 1e-6);
+            EXPECT_NEAR(frame_result.inlier_rmse_, result.inlier_rmse_, 1e-6);
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
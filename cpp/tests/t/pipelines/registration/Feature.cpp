@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace t_reg = open3d::t::pipelines::registration;
+namespace l_reg = open3d::pipelines::registration;
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    auto pcd_legacy = io::CreatePointCloudFromFile(
+            utility::GetDataPathCommon("ICP/cloud_bin_0.pcd"));
+    pcd_legacy = pcd_legacy->VoxelDownSample(0.05);
+
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            *pcd_legacy, core::Float64, device);
+    const int64_t num_points = pcd.GetPointPositions().GetLength();
+
+    // Hybrid search, with max_nn large enough to keep every neighbor in the
+    // radius, matches the legacy hybrid search parameter.
+    auto fpfh_legacy = l_reg::ComputeFPFHFeature(
+            *pcd_legacy, geometry::KDTreeSearchParamHybrid(0.25, 1000));
+    core::Tensor fpfh_ref = core::eigen_converter::EigenMatrixToTensor(
+            Eigen::MatrixXd(fpfh_legacy->data_.transpose()));
+
+    core::Tensor fpfh = t_reg::ComputeFPFHFeature(pcd, 1000, 0.25);
+    EXPECT_EQ(fpfh.GetShape(), core::SizeVector({num_points, 33}));
+    EXPECT_TRUE(fpfh.To(core::Device("CPU:0")).AllClose(fpfh_ref, 1e-4, 1e-4));
+
+    // KNN search.
+    fpfh_legacy = l_reg::ComputeFPFHFeature(
+            *pcd_legacy, geometry::KDTreeSearchParamKNN(30));
+    fpfh_ref = core::eigen_converter::EigenMatrixToTensor(
+            Eigen::MatrixXd(fpfh_legacy->data_.transpose()));
+
+    fpfh = t_reg::ComputeFPFHFeature(pcd, 30);
+    EXPECT_TRUE(fpfh.To(core::Device("CPU:0")).AllClose(fpfh_ref, 1e-4, 1e-4));
+
+    // The feature keeps the dtype of the point cloud.
+    fpfh = t_reg::ComputeFPFHFeature(
+            t::geometry::PointCloud::FromLegacy(*pcd_legacy, core::Float32,
+                                                device),
+            30);
+    EXPECT_EQ(fpfh.GetDtype(), core::Float32);
+    EXPECT_EQ(fpfh.GetShape(), core::SizeVector({num_points, 33}));
+
+    t::geometry::PointCloud pcd_no_normals(
+            core::Tensor::Zeros({4, 3}, core::Float32, device));
+    EXPECT_ANY_THROW(t_reg::ComputeFPFHFeature(pcd_no_normals));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,14 +26,20 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <algorithm>
+#include <random>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/pipelines/registration/ColoredICP.h"
+#include "open3d/pipelines/registration/GeneralizedICP.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/pipelines/registration/RobustKernel.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/kernel/Registration.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
 #include "open3d/t/pipelines/registration/RobustKernelImpl.h"
 #include "tests/Tests.h"
@@ -308,6 +314,226 @@ TEST_P(RegistrationPermuteDevices, ICPPointToPlane) {
     }
 }
 
+TEST_P(RegistrationPermuteDevices, MultiScaleICPScheduling) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        core::Tensor initial_transform_t =
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}},
+                                           core::Device("CPU:0"));
+
+        std::vector<double> voxel_sizes = {1.0, -1};
+        std::vector<double> max_correspondence_distances = {3.0, 1.5};
+
+        // Testing the convergence every iteration and every third one.
+        std::vector<t_reg::ICPScaleReport> reports_1, reports_3;
+        t_reg::RegistrationResult result_1 = t_reg::MultiScaleICP(
+                source_tpcd, target_tpcd, voxel_sizes,
+                {t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 20, 1),
+                 t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 20, 1)},
+                max_correspondence_distances, initial_transform_t,
+                t_reg::TransformationEstimationPointToPoint(), false,
+                &reports_1);
+        t_reg::RegistrationResult result_3 = t_reg::MultiScaleICP(
+                source_tpcd, target_tpcd, voxel_sizes,
+                {t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 20, 3),
+                 t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 20, 3)},
+                max_correspondence_distances, initial_transform_t,
+                t_reg::TransformationEstimationPointToPoint(), false,
+                &reports_3);
+
+        ASSERT_EQ(reports_1.size(), 2);
+        ASSERT_EQ(reports_3.size(), 2);
+        for (int i = 0; i < 2; ++i) {
+            EXPECT_EQ(reports_1[i].max_iteration_, 20);
+            EXPECT_LE(reports_1[i].iterations_, 20);
+            EXPECT_GE(reports_1[i].time_ms_, 0.0);
+
+            // Convergence is only tested on every third and the last
+            // iteration.
+            if (reports_3[i].converged_ && reports_3[i].iterations_ < 20) {
+                EXPECT_EQ(reports_3[i].iterations_ % 3, 0);
+            }
+        }
+        EXPECT_NEAR(result_1.fitness_, result_3.fitness_, 0.0005);
+        EXPECT_NEAR(result_1.inlier_rmse_, result_3.inlier_rmse_, 0.0005);
+
+        // A converged coarse scale bounds the budget of the finer one.
+        std::vector<t_reg::ICPScaleReport> reports_adaptive;
+        t_reg::MultiScaleICP(
+                source_tpcd, target_tpcd, voxel_sizes,
+                {t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 20),
+                 t_reg::ICPConvergenceCriteria(1e-6, 1e-6, 20)},
+                max_correspondence_distances, initial_transform_t,
+                t_reg::TransformationEstimationPointToPoint(), true,
+                &reports_adaptive);
+        ASSERT_EQ(reports_adaptive.size(), 2);
+        if (reports_adaptive[0].converged_) {
+            EXPECT_EQ(reports_adaptive[1].max_iteration_,
+                      std::min(20, 2 * reports_adaptive[0].iterations_));
+        } else {
+            EXPECT_EQ(reports_adaptive[1].max_iteration_, 20);
+        }
+        EXPECT_LE(reports_adaptive[1].iterations_,
+                  reports_adaptive[1].max_iteration_);
+    }
+}
+
+TEST_P(RegistrationPermuteDevices, ICPGeneralized) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        // Both implementations compute the covariances from the normals.
+        source_tpcd.EstimateNormals(20);
+
+        open3d::geometry::PointCloud source_lpcd = source_tpcd.ToLegacy();
+        open3d::geometry::PointCloud target_lpcd = target_tpcd.ToLegacy();
+
+        // Initial transformation input for tensor implementation.
+        core::Tensor initial_transform_t =
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}},
+                                           core::Device("CPU:0"));
+
+        // Initial transformation input for legacy implementation.
+        Eigen::Matrix4d initial_transform_l =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        initial_transform_t);
+
+        double max_correspondence_dist = 1.5;
+        double relative_fitness = 1e-6;
+        double relative_rmse = 1e-6;
+        int max_iterations = 2;
+        double epsilon = 1e-3;
+
+        // GeneralizedICP - Tensor.
+        t_reg::RegistrationResult reg_gicp_t = t_reg::ICP(
+                source_tpcd, target_tpcd, max_correspondence_dist,
+                initial_transform_t,
+                t_reg::TransformationEstimationForGeneralizedICP(epsilon),
+                t_reg::ICPConvergenceCriteria(relative_fitness, relative_rmse,
+                                              max_iterations));
+
+        // GeneralizedICP - Legacy.
+        l_reg::RegistrationResult reg_gicp_l =
+                l_reg::RegistrationGeneralizedICP(
+                        source_lpcd, target_lpcd, max_correspondence_dist,
+                        initial_transform_l,
+                        l_reg::TransformationEstimationForGeneralizedICP(
+                                epsilon),
+                        l_reg::ICPConvergenceCriteria(
+                                relative_fitness, relative_rmse,
+                                max_iterations));
+
+        EXPECT_NEAR(reg_gicp_t.fitness_, reg_gicp_l.fitness_, 0.0005);
+        EXPECT_NEAR(reg_gicp_t.inlier_rmse_, reg_gicp_l.inlier_rmse_, 0.0005);
+    }
+}
+
+TEST_P(RegistrationPermuteDevices, ComputePosePointToPlaneFused) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        const double max_correspondence_dist = 0.3;
+        const t_reg::RobustKernel kernel(t_reg::RobustKernelMethod::TukeyLoss,
+                                         /*scale parameter =*/0.5,
+                                         /*shape parameter =*/1.0);
+
+        // Separate correspondence search and reduction.
+        core::nns::NearestNeighborSearch target_nns(
+                target_tpcd.GetPointPositions());
+        target_nns.HybridIndex(max_correspondence_dist);
+        core::Tensor correspondences, distances, counts;
+        std::tie(correspondences, distances, counts) =
+                target_nns.HybridSearch(source_tpcd.GetPointPositions(),
+                                        max_correspondence_dist, 1);
+        core::Tensor pose = t::pipelines::kernel::ComputePosePointToPlane(
+                source_tpcd.GetPointPositions(),
+                target_tpcd.GetPointPositions(), target_tpcd.GetPointNormals(),
+                correspondences.To(core::Int64), kernel);
+
+        // Fused.
+        core::Tensor cell_splits, sorted_indices;
+        std::tie(cell_splits, sorted_indices) =
+                t::pipelines::kernel::BuildCorrespondenceHashTable(
+                        target_tpcd.GetPointPositions(),
+                        max_correspondence_dist);
+        int64_t inlier_count = 0;
+        double squared_error = 0;
+        core::Tensor pose_fused =
+                t::pipelines::kernel::ComputePosePointToPlaneFused(
+                        source_tpcd.GetPointPositions(),
+                        target_tpcd.GetPointPositions(),
+                        target_tpcd.GetPointNormals(), cell_splits,
+                        sorted_indices, max_correspondence_dist, kernel,
+                        inlier_count, squared_error);
+
+        EXPECT_EQ(inlier_count,
+                  counts.Sum({0}).To(core::Int64).Item<int64_t>());
+        EXPECT_NEAR(squared_error,
+                    distances.Sum({0}).To(core::Float64).Item<double>(),
+                    1e-3 * std::max(squared_error, 1.0));
+        EXPECT_TRUE(pose_fused.AllClose(pose, 1e-4, 1e-4));
+    }
+}
+
+TEST_P(RegistrationPermuteDevices, BatchedICP) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        const std::vector<core::Tensor> init_transforms = {
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}}),
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"))};
+        const std::vector<t::geometry::PointCloud> sources = {
+                source_tpcd, source_tpcd.Clone().Translate(
+                                     core::Tensor::Init<double>({0.1, 0, 0}))};
+        const std::vector<t::geometry::PointCloud> targets = {target_tpcd,
+                                                              target_tpcd};
+
+        const double max_correspondence_dist = 1.5;
+        const t_reg::TransformationEstimationPointToPlane estimation;
+        const t_reg::ICPConvergenceCriteria criteria(1e-6, 1e-6, 5);
+
+        std::vector<t_reg::RegistrationResult> batched = t_reg::BatchedICP(
+                sources, targets, max_correspondence_dist, init_transforms,
+                estimation, criteria);
+        ASSERT_EQ(batched.size(), 2u);
+
+        for (size_t b = 0; b < batched.size(); ++b) {
+            t_reg::RegistrationResult single = t_reg::ICP(
+                    sources[b], targets[b], max_correspondence_dist,
+                    init_transforms[b], estimation, criteria);
+
+            EXPECT_NEAR(batched[b].fitness_, single.fitness_, 1e-4);
+            EXPECT_NEAR(batched[b].inlier_rmse_, single.inlier_rmse_, 1e-4);
+            EXPECT_TRUE(batched[b].transformation_.AllClose(
+                    single.transformation_, 1e-3, 1e-3));
+            EXPECT_EQ(batched[b].correspondences_.GetShape(),
+                      single.correspondences_.GetShape());
+        }
+    }
+}
+
 TEST_P(RegistrationPermuteDevices, RegistrationColoredICP) {
     core::Device device = GetParam();
 
@@ -498,5 +724,116 @@ TEST_P(RegistrationPermuteDevices, GetInformationMatrixFromPointCloud) {
     }
 }
 
+TEST_P(RegistrationPermuteDevices, RANSAC) {
+    core::Device device = GetParam();
+
+    // Random source points and a known rigid transformation.
+    const int64_t num_points = 200;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::vector<double> source_values(num_points * 3);
+    for (double &v : source_values) v = uniform(rng);
+    std::vector<double> feature_values(num_points * 8);
+    for (double &v : feature_values) v = uniform(rng);
+
+    const core::Tensor transformation =
+            core::Tensor::Init<double>({{0.8, -0.6, 0.0, 0.5},
+                                        {0.6, 0.8, 0.0, -0.2},
+                                        {0.0, 0.0, 1.0, 0.1},
+                                        {0.0, 0.0, 0.0, 1.0}});
+    const core::Tensor source_points =
+            core::Tensor(source_values, {num_points, 3}, core::Float64);
+    const core::Tensor target_points =
+            source_points.Matmul(transformation.Slice(0, 0, 3)
+                                         .Slice(1, 0, 3)
+                                         .T()) +
+            transformation.Slice(0, 0, 3).Slice(1, 3, 4).Reshape({1, 3});
+
+    // 70% correct correspondences, the rest are outliers.
+    std::vector<int64_t> correspondence_values;
+    for (int64_t i = 0; i < num_points; ++i) {
+        correspondence_values.push_back(i);
+        correspondence_values.push_back(i < 140 ? i : (i * 7 + 3) % num_points);
+    }
+    const core::Tensor correspondences(correspondence_values, {num_points, 2},
+                                       core::Int64);
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source(source_points.To(device, dtype));
+        t::geometry::PointCloud target(target_points.To(device, dtype));
+
+        t_reg::RegistrationResult result = t_reg::RANSACFromCorrespondences(
+                source, target, correspondences, 0.01, 3,
+                t_reg::RANSACConvergenceCriteria(10000, 0.999), 256);
+        EXPECT_TRUE(result.transformation_.AllClose(transformation, 1e-3,
+                                                    1e-3));
+        EXPECT_NEAR(result.fitness_, 1.0, 1e-6);
+
+        // Identical features match every source point to the same target
+        // point.
+        const core::Tensor features =
+                core::Tensor(feature_values, {num_points, 8}, core::Float64)
+                        .To(device, dtype);
+        result = t_reg::RANSACFromFeatures(
+                source, target, features, features, 0.01, true, 3,
+                t_reg::RANSACConvergenceCriteria(10000, 0.999), 256);
+        EXPECT_TRUE(result.transformation_.AllClose(transformation, 1e-3,
+                                                    1e-3));
+        EXPECT_NEAR(result.fitness_, 1.0, 1e-6);
+    }
+}
+
+TEST_P(RegistrationPermuteDevices, FastGlobalRegistrationFromFeatures) {
+    core::Device device = GetParam();
+
+    const int64_t num_points = 200;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    std::vector<double> source_values(num_points * 3);
+    for (double &v : source_values) v = uniform(rng);
+    std::vector<double> feature_values(num_points * 8);
+    for (double &v : feature_values) v = uniform(rng);
+    // The last 40 target points get unrelated features.
+    std::vector<double> target_feature_values = feature_values;
+    for (int64_t i = 160 * 8; i < num_points * 8; ++i) {
+        target_feature_values[i] = uniform(rng);
+    }
+
+    const core::Tensor transformation =
+            core::Tensor::Init<double>({{0.8, -0.6, 0.0, 0.5},
+                                        {0.6, 0.8, 0.0, -0.2},
+                                        {0.0, 0.0, 1.0, 0.1},
+                                        {0.0, 0.0, 0.0, 1.0}});
+    const core::Tensor source_points =
+            core::Tensor(source_values, {num_points, 3}, core::Float64);
+    const core::Tensor target_points =
+            source_points.Matmul(transformation.Slice(0, 0, 3)
+                                         .Slice(1, 0, 3)
+                                         .T()) +
+            transformation.Slice(0, 0, 3).Slice(1, 3, 4).Reshape({1, 3});
+
+    l_reg::FastGlobalRegistrationOption option;
+    option.seed_ = 0;
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source(source_points.To(device, dtype));
+        t::geometry::PointCloud target(target_points.To(device, dtype));
+        const core::Tensor source_features =
+                core::Tensor(feature_values, {num_points, 8}, core::Float64)
+                        .To(device, dtype);
+        const core::Tensor target_features =
+                core::Tensor(target_feature_values, {num_points, 8},
+                             core::Float64)
+                        .To(device, dtype);
+
+        t_reg::RegistrationResult result =
+                t_reg::FastGlobalRegistrationFromFeatures(
+                        source, target, source_features, target_features,
+                        option);
+        EXPECT_TRUE(result.transformation_.AllClose(transformation, 1e-3,
+                                                    1e-3));
+        EXPECT_NEAR(result.fitness_, 1.0, 1e-6);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
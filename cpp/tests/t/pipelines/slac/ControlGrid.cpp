@@ -29,6 +29,7 @@
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
 #include "open3d/t/pipelines/slac/Visualization.h"
 #include "tests/Tests.h"
 
@@ -92,5 +93,71 @@ TEST_P(ControlGridPermuteDevices, Regularizer) {
     curr[2][1] += 0.2;
 }
 
+TEST_P(ControlGridPermuteDevices, RegularizerSparse) {
+    core::Device device = GetParam();
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+
+    t::geometry::PointCloud pcd = CreateTPCDFromFile(
+            utility::GetDataPathCommon("ICP/cloud_bin_0.pcd"), device);
+    cgrid.Touch(pcd);
+    cgrid.Compactify();
+    core::Tensor init = cgrid.GetInitPositions();
+    core::Tensor curr = cgrid.GetCurrPositions();
+    curr[0][0] += 0.2;
+    curr[1][2] -= 0.2;
+    curr[2][1] += 0.2;
+
+    core::Tensor active_buf_indices, nb_buf_indices, nb_masks;
+    std::tie(active_buf_indices, nb_buf_indices, nb_masks) =
+            cgrid.GetNeighborGridMap();
+
+    const int n_frags = 2;
+    const int64_t n_vars = 6 * n_frags + 3 * cgrid.Size();
+    core::Tensor AtA =
+            core::Tensor::Zeros({n_vars, n_vars}, core::Float32, device);
+    core::Tensor Atb = core::Tensor::Zeros({n_vars, 1}, core::Float32, device);
+    core::Tensor residual = core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::kernel::FillInSLACRegularizerTerm(
+            AtA, Atb, residual, active_buf_indices, nb_buf_indices, nb_masks,
+            init, curr, 1.0, n_frags, cgrid.GetAnchorIdx());
+
+    core::HashMap AtA_blocks(1000, core::Int32, {2}, core::Float32, {9},
+                             device);
+    core::Tensor Atb_sparse =
+            core::Tensor::Zeros({n_vars, 1}, core::Float32, device);
+    core::Tensor residual_sparse =
+            core::Tensor::Zeros({1}, core::Float32, device);
+    t::pipelines::kernel::FillInSLACRegularizerTermSparse(
+            AtA_blocks, Atb_sparse, residual_sparse, active_buf_indices,
+            nb_buf_indices, nb_masks, init, curr, 1.0, n_frags,
+            cgrid.GetAnchorIdx());
+
+    // Scatter the 3x3 blocks into a dense matrix.
+    core::Device host("CPU:0");
+    core::Tensor active = AtA_blocks.GetActiveIndices().To(core::Int64);
+    core::Tensor keys = AtA_blocks.GetKeyTensor().IndexGet({active}).To(host);
+    core::Tensor values =
+            AtA_blocks.GetValueTensor().IndexGet({active}).To(host);
+    core::Tensor AtA_sparse =
+            core::Tensor::Zeros({n_vars, n_vars}, core::Float32, host);
+    const int* keys_ptr = keys.GetDataPtr<int>();
+    const float* values_ptr = values.GetDataPtr<float>();
+    float* AtA_sparse_ptr = AtA_sparse.GetDataPtr<float>();
+    for (int64_t k = 0; k < keys.GetLength(); ++k) {
+        for (int u = 0; u < 3; ++u) {
+            for (int v = 0; v < 3; ++v) {
+                int64_t row = 3 * keys_ptr[2 * k] + u;
+                int64_t col = 3 * keys_ptr[2 * k + 1] + v;
+                AtA_sparse_ptr[row * n_vars + col] +=
+                        values_ptr[9 * k + 3 * u + v];
+            }
+        }
+    }
+
+    EXPECT_TRUE(AtA_sparse.AllClose(AtA.To(host), 1e-5, 1e-5));
+    EXPECT_TRUE(Atb_sparse.AllClose(Atb, 1e-4, 1e-5));
+    EXPECT_TRUE(residual_sparse.AllClose(residual, 1e-4, 1e-5));
+}
+
 }  // namespace tests
 }  // namespace open3d
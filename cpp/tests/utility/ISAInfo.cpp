@@ -26,6 +26,7 @@
 
 #include "open3d/utility/ISAInfo.h"
 
+#include "open3d/Macro.h"
 #include "open3d/utility/Logging.h"
 #include "tests/Tests.h"
 
@@ -37,5 +38,22 @@ TEST(ISAInfo, GetSelectedISATarget) {
               utility::ISATarget::UNKNOWN);
 }
 
+TEST(ISAInfo, CPUDispatchTarget) {
+    const utility::ISATarget target =
+            utility::ISAInfo::GetInstance().CPUDispatchTarget();
+#ifdef OPEN3D_CPU_DISPATCH_ENABLED
+    EXPECT_TRUE(target == utility::ISATarget::SSE2 ||
+                target == utility::ISATarget::AVX2 ||
+                target == utility::ISATarget::AVX512SKX);
+#else
+    EXPECT_EQ(target, utility::ISATarget::DISABLED);
+#endif
+}
+
+TEST(ISAInfo, ToString) {
+    EXPECT_EQ(utility::ToString(utility::ISATarget::AVX2), "AVX2");
+    EXPECT_EQ(utility::ToString(utility::ISATarget::DISABLED), "DISABLED");
+}
+
 }  // namespace tests
 }  // namespace open3d
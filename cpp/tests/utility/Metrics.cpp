@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Metrics.h"
+
+#include <thread>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+const utility::MetricFamily* FindFamily(
+        const std::vector<utility::MetricFamily>& families,
+        const std::string& name) {
+    for (const utility::MetricFamily& family : families) {
+        if (family.name == name) {
+            return &family;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+TEST(Metrics, CounterGaugeHistogram) {
+    utility::MetricsRegistry& registry =
+            utility::MetricsRegistry::GetInstance();
+
+    utility::Counter& counter = registry.GetCounter(
+            "test_events_total", "Events.", {{"kind", "a"}});
+    EXPECT_EQ(&counter, &registry.GetCounter("test_events_total", "Events.",
+                                             {{"kind", "a"}}));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&counter]() {
+            for (int i = 0; i < 1000; ++i) {
+                counter.Increment();
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.Get(), 4000);
+
+    utility::Gauge& gauge = registry.GetGauge("test_bytes", "Bytes.");
+    gauge.Set(10.0);
+    gauge.Add(-2.5);
+    EXPECT_DOUBLE_EQ(gauge.Get(), 7.5);
+
+    utility::Histogram& histogram =
+            registry.GetHistogram("test_ratio", "Ratio.", {0.5, 1.0});
+    for (double value : {0.25, 0.5, 0.75, 2.0}) {
+        histogram.Observe(value);
+    }
+    EXPECT_EQ(histogram.GetBucketCounts(), std::vector<int64_t>({2, 1, 1}));
+    EXPECT_EQ(histogram.GetCount(), 4);
+    EXPECT_DOUBLE_EQ(histogram.GetSum(), 3.5);
+
+    const std::vector<utility::MetricFamily> families = registry.Collect();
+    const utility::MetricFamily* family = FindFamily(families, "test_ratio");
+    ASSERT_NE(family, nullptr);
+    EXPECT_EQ(family->type, utility::MetricType::Histogram);
+    // Cumulative buckets, then _sum and _count.
+    ASSERT_EQ(family->samples.size(), 5u);
+    EXPECT_EQ(family->samples[1].labels.at("le"), "1");
+    EXPECT_DOUBLE_EQ(family->samples[1].value, 3.0);
+    EXPECT_EQ(family->samples[2].labels.at("le"), "+Inf");
+    EXPECT_DOUBLE_EQ(family->samples[2].value, 4.0);
+
+    EXPECT_THROW(registry.GetGauge("test_events_total", "Events."),
+                 std::runtime_error);
+}
+
+TEST(Metrics, CollectorAndPrometheusText) {
+    utility::MetricsRegistry& registry =
+            utility::MetricsRegistry::GetInstance();
+    const int id = registry.AddCollector(
+            [](std::vector<utility::MetricFamily>& families) {
+                utility::MetricFamily family;
+                family.name = "test_collected";
+                family.help = "Collected \"value\".";
+                family.samples.push_back(
+                        {"test_collected", {{"device", "CPU:0"}}, 42.0});
+                families.push_back(family);
+            });
+
+    const std::string text = registry.ToPrometheusText();
+    EXPECT_NE(text.find("# TYPE test_collected gauge\n"), std::string::npos);
+    EXPECT_NE(text.find("test_collected{device=\"CPU:0\"} 42\n"),
+              std::string::npos);
+
+    registry.RemoveCollector(id);
+    EXPECT_EQ(FindFamily(registry.Collect(), "test_collected"), nullptr);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include "open3d/utility/Parallel.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Parallel, ParallelForRange) {
+    const int64_t n = 100000;
+    std::vector<int> visits(n, 0);
+    utility::ParallelForRange(n, [&](int64_t begin, int64_t end) {
+        EXPECT_TRUE(utility::InParallel());
+        for (int64_t i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(visits[i], 1);
+    }
+    EXPECT_FALSE(utility::InParallel());
+
+    // Empty ranges are no-ops.
+    utility::ParallelForRange(0, [](int64_t, int64_t) { FAIL(); });
+}
+
+TEST(Parallel, ParallelForRangeGrainSize) {
+    const int64_t n = 1000;
+    const int64_t grain_size = 64;
+    std::atomic<int64_t> total(0);
+    utility::ParallelForRange(
+            n,
+            [&](int64_t begin, int64_t end) {
+                // simple_partitioner splits until a range is at most
+                // grain_size, but never below half of it.
+                EXPECT_LE(end - begin, grain_size);
+                EXPECT_GE(end - begin, grain_size / 2);
+                total += end - begin;
+            },
+            grain_size);
+    EXPECT_EQ(total.load(), n);
+
+    EXPECT_ANY_THROW(utility::ParallelForRange(
+            n, [](int64_t, int64_t) {}, -1));
+}
+
+TEST(Parallel, ParallelForRangeNested) {
+    const int64_t outer = 16;
+    const int64_t inner = 10000;
+    std::vector<std::atomic<int64_t>> sums(outer);
+    for (auto& sum : sums) {
+        sum = 0;
+    }
+    utility::ParallelForRange(outer, [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; ++i) {
+            utility::ParallelForRange(inner, [&](int64_t b, int64_t e) {
+                EXPECT_TRUE(utility::InParallel());
+                sums[i] += e - b;
+            });
+        }
+    });
+    for (int64_t i = 0; i < outer; ++i) {
+        EXPECT_EQ(sums[i].load(), inner);
+    }
+}
+
+TEST(Parallel, ParallelForRangeException) {
+    EXPECT_THROW(utility::ParallelForRange(
+                         1000,
+                         [](int64_t begin, int64_t end) {
+                             if (begin <= 500 && 500 < end) {
+                                 throw std::runtime_error("error");
+                             }
+                         }),
+                 std::runtime_error);
+    EXPECT_FALSE(utility::InParallel());
+}
+
+TEST(Parallel, ThreadAffinity) {
+    EXPECT_EQ(utility::GetThreadAffinity(), utility::ThreadAffinity::None);
+#ifdef __linux__
+    cpu_set_t original_mask;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(original_mask), &original_mask), 0);
+#endif
+
+    utility::SetThreadAffinity(utility::ThreadAffinity::Scatter);
+    EXPECT_EQ(utility::GetThreadAffinity(), utility::ThreadAffinity::Scatter);
+    const std::thread::id caller_id = std::this_thread::get_id();
+    utility::ParallelForRange(
+            1000,
+            [&](int64_t, int64_t) {
+#ifdef __linux__
+                // Workers are pinned, the calling thread is not.
+                cpu_set_t mask;
+                ASSERT_EQ(sched_getaffinity(0, sizeof(mask), &mask), 0);
+                if (std::this_thread::get_id() == caller_id) {
+                    EXPECT_TRUE(CPU_EQUAL(&original_mask, &mask));
+                } else {
+                    EXPECT_EQ(CPU_COUNT(&mask), 1);
+                }
+#endif
+            },
+            1);
+#ifdef __linux__
+    cpu_set_t caller_mask;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(caller_mask), &caller_mask), 0);
+    EXPECT_TRUE(CPU_EQUAL(&original_mask, &caller_mask));
+#endif
+
+    utility::SetThreadAffinity(utility::ThreadAffinity::None);
+    utility::ParallelForRange(1000, [](int64_t, int64_t) {}, 1);
+    EXPECT_EQ(utility::GetThreadAffinity(), utility::ThreadAffinity::None);
+}
+
+TEST(Parallel, SetMaxThreads) {
+    const int default_threads = utility::EstimateMaxThreads();
+
+    utility::SetMaxThreads(1);
+    EXPECT_EQ(utility::EstimateMaxThreads(), 1);
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    utility::ParallelForRange(
+            1000,
+            [&](int64_t, int64_t) {
+                std::lock_guard<std::mutex> lock(mutex);
+                thread_ids.insert(std::this_thread::get_id());
+            },
+            1);
+    EXPECT_EQ(thread_ids.size(), 1u);
+
+    utility::SetMaxThreads(0);
+    EXPECT_EQ(utility::EstimateMaxThreads(), default_threads);
+}
+
+TEST(Parallel, Deterministic) {
+    EXPECT_FALSE(utility::IsDeterministic());
+    utility::SetDeterministic(true);
+    EXPECT_TRUE(utility::IsDeterministic());
+    utility::SetDeterministic(false);
+    EXPECT_FALSE(utility::IsDeterministic());
+}
+
+}  // namespace tests
+}  // namespace open3d
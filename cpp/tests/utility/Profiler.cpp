@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/utility/Profiler.h"
+
+#include <thread>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+size_t CountOccurrences(const std::string& s, const std::string& pattern) {
+    size_t count = 0;
+    for (size_t pos = s.find(pattern); pos != std::string::npos;
+         pos = s.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+}  // namespace
+
+TEST(Profiler, ChromeTrace) {
+    utility::Profiler& profiler = utility::Profiler::GetInstance();
+    const bool was_enabled = profiler.IsEnabled();
+    profiler.Clear();
+
+    profiler.SetEnabled(false);
+    { utility::ProfileZone zone("disabled"); }
+
+    profiler.SetEnabled(true);
+    {
+        utility::ProfileZone outer("outer", "test");
+        { utility::ProfileZone inner("inner", "test"); }
+    }
+    std::thread worker([]() { utility::ProfileZone zone("worker", "test"); });
+    worker.join();
+    profiler.AddDeferred([&profiler]() {
+        profiler.RecordOnTrack("CUDA:0", "kernel", "test", 10, 20);
+    });
+    profiler.SetEnabled(was_enabled);
+
+    const std::string trace = profiler.ToChromeTrace();
+    EXPECT_EQ(trace.find("\"disabled\""), std::string::npos);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"outer\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"inner\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"worker\""), 1u);
+    EXPECT_EQ(CountOccurrences(trace, "\"name\":\"kernel\""), 1u);
+    EXPECT_NE(trace.find("\"name\":\"CUDA:0\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ts\":0.010,\"dur\":0.010"), std::string::npos);
+
+    profiler.Clear();
+    EXPECT_EQ(profiler.ToChromeTrace().find("\"ph\":\"X\""),
+              std::string::npos);
+}
+
+TEST(Profiler, RingBufferKeepsNewestZones) {
+    utility::Profiler& profiler = utility::Profiler::GetInstance();
+    profiler.SetBufferCapacity(4);
+    profiler.Clear();
+
+    std::thread worker([&profiler]() {
+        const char* names[] = {"z0", "z1", "z2", "z3", "z4", "z5"};
+        for (int i = 0; i < 6; ++i) {
+            profiler.Record(names[i], "test", i, i + 1);
+        }
+    });
+    worker.join();
+
+    const std::string trace = profiler.ToChromeTrace();
+    EXPECT_EQ(trace.find("\"z1\""), std::string::npos);
+    const size_t z2 = trace.find("\"z2\"");
+    const size_t z5 = trace.find("\"z5\"");
+    ASSERT_NE(z2, std::string::npos);
+    ASSERT_NE(z5, std::string::npos);
+    EXPECT_LT(z2, z5);
+
+    profiler.SetBufferCapacity(1 << 16);
+    profiler.Clear();
+}
+
+}  // namespace tests
+}  // namespace open3d
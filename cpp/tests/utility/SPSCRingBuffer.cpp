@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/SPSCRingBuffer.h"
+
+#include <thread>
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(SPSCRingBuffer, PushPop) {
+    utility::SPSCRingBuffer<int> buffer(2);
+    EXPECT_EQ(buffer.Capacity(), 2u);
+    EXPECT_TRUE(buffer.Empty());
+    int value = -1;
+    EXPECT_FALSE(buffer.Pop(value));
+
+    EXPECT_TRUE(buffer.Push(1));
+    EXPECT_TRUE(buffer.Push(2));
+    EXPECT_FALSE(buffer.Push(3));
+    EXPECT_EQ(buffer.Size(), 2u);
+    EXPECT_TRUE(buffer.Pop(value));
+    EXPECT_EQ(value, 1);
+    // Wraps around the end of the slots.
+    EXPECT_TRUE(buffer.Push(4));
+    EXPECT_TRUE(buffer.Pop(value));
+    EXPECT_EQ(value, 2);
+    EXPECT_TRUE(buffer.Pop(value));
+    EXPECT_EQ(value, 4);
+    EXPECT_TRUE(buffer.Empty());
+}
+
+TEST(SPSCRingBuffer, Threads) {
+    const int n = 100000;
+    utility::SPSCRingBuffer<int> buffer(16);
+    std::thread producer([&buffer] {
+        for (int i = 0; i < n;) {
+            if (buffer.Push(int(i))) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    while (expected < n) {
+        int value;
+        if (buffer.Pop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(buffer.Empty());
+}
+
+}  // namespace tests
+}  // namespace open3d
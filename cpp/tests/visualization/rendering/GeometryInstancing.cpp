@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/rendering/GeometryInstancing.h"
+
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+// Two instances: a translation by (1, 2, 3) and a scale by (2, 1, 1).
+core::Tensor CreateTransforms() {
+    return core::Tensor::Init<double>(
+            {{{1, 0, 0, 1}, {0, 1, 0, 2}, {0, 0, 1, 3}, {0, 0, 0, 1}},
+             {{2, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}}});
+}
+
+}  // namespace
+
+TEST(GeometryInstancing, InstanceTriangleMesh) {
+    t::geometry::TriangleMesh mesh;
+    mesh.SetVertexPositions(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}));
+    mesh.SetVertexNormals(core::Tensor::Init<float>(
+            {{1, 0, 0}, {1, 0, 0}, {1, 0, 0}}));
+    mesh.SetTriangleIndices(core::Tensor::Init<int32_t>({{0, 1, 2}}));
+    mesh.SetVertexColors(core::Tensor::Init<float>(
+            {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}));
+
+    const core::Tensor transforms = CreateTransforms();
+    auto instances = visualization::rendering::InstanceTriangleMesh(
+            mesh, transforms);
+    EXPECT_TRUE(instances.GetVertexPositions().AllClose(
+            core::Tensor::Init<float>({{1, 2, 3},
+                                       {2, 2, 3},
+                                       {1, 3, 3},
+                                       {0, 0, 0},
+                                       {2, 0, 0},
+                                       {0, 1, 0}})));
+    EXPECT_TRUE(instances.GetTriangleIndices().AllEqual(
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {3, 4, 5}})));
+    // Normals use the inverse transpose and stay unit length.
+    EXPECT_TRUE(instances.GetVertexNormals().AllClose(
+            core::Tensor::Init<float>({{1, 0, 0}, {1, 0, 0}, {1, 0, 0},
+                                       {1, 0, 0}, {1, 0, 0}, {1, 0, 0}})));
+    EXPECT_TRUE(instances.GetVertexColors().AllClose(
+            core::Tensor::Init<float>({{1, 0, 0}, {0, 1, 0}, {0, 0, 1},
+                                       {1, 0, 0}, {0, 1, 0}, {0, 0, 1}})));
+
+    // Per-instance colors replace the vertex colors.
+    instances = visualization::rendering::InstanceTriangleMesh(
+            mesh, transforms,
+            core::Tensor::Init<float>({{1, 1, 0}, {0, 1, 1}}));
+    EXPECT_TRUE(instances.GetVertexColors().AllClose(
+            core::Tensor::Init<float>({{1, 1, 0}, {1, 1, 0}, {1, 1, 0},
+                                       {0, 1, 1}, {0, 1, 1}, {0, 1, 1}})));
+
+    EXPECT_ANY_THROW(visualization::rendering::InstanceTriangleMesh(
+            mesh, core::Tensor::Zeros({2, 3, 3}, core::Float32)));
+    EXPECT_ANY_THROW(visualization::rendering::InstanceTriangleMesh(
+            mesh, transforms, core::Tensor::Zeros({3, 3}, core::Float32)));
+}
+
+TEST(GeometryInstancing, InstanceLineSet) {
+    t::geometry::LineSet lines;
+    lines.SetPointPositions(core::Tensor::Init<double>({{0, 0, 0}, {1, 1, 1}}));
+    lines.SetLineIndices(core::Tensor::Init<int64_t>({{0, 1}}));
+
+    auto instances = visualization::rendering::InstanceLineSet(
+            lines, CreateTransforms(),
+            core::Tensor::Init<uint8_t>({{255, 0, 0}, {0, 255, 0}}));
+    EXPECT_TRUE(instances.GetPointPositions().AllClose(
+            core::Tensor::Init<float>(
+                    {{1, 2, 3}, {2, 3, 4}, {0, 0, 0}, {2, 1, 1}})));
+    EXPECT_TRUE(instances.GetLineIndices().AllEqual(
+            core::Tensor::Init<int64_t>({{0, 1}, {2, 3}})));
+    EXPECT_TRUE(instances.GetLineColors().AllEqual(
+            core::Tensor::Init<uint8_t>({{255, 0, 0}, {0, 255, 0}})));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/rendering/PointCloudLOD.h"
+
+#include "open3d/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::rendering::PointCloudLOD;
+
+namespace {
+
+geometry::PointCloud CreateCloud(size_t num_points) {
+    geometry::PointCloud cloud;
+    cloud.points_.resize(num_points);
+    Rand(cloud.points_, Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1),
+         0);
+    cloud.colors_.resize(num_points);
+    Rand(cloud.colors_, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 1);
+    return cloud;
+}
+
+// Camera at (0, 0, 5) looking at the origin with a 60 degree field of view.
+Eigen::Matrix4f LookAtOrigin(Eigen::Matrix4f& projection) {
+    Eigen::Matrix4f view = Eigen::Matrix4f::Identity();
+    view(2, 3) = -5;
+    const float n = 0.1f, f = 100.f;
+    const float t = 1.f / std::tan(float(M_PI) / 6);
+    projection.setZero();
+    projection(0, 0) = t;
+    projection(1, 1) = t;
+    projection(2, 2) = -(f + n) / (f - n);
+    projection(2, 3) = -2 * f * n / (f - n);
+    projection(3, 2) = -1;
+    return view;
+}
+
+}  // namespace
+
+TEST(PointCloudLOD, Build) {
+    const geometry::PointCloud cloud = CreateCloud(10000);
+    PointCloudLOD lod(cloud, 8, 500);
+    EXPECT_EQ(lod.GetNumPoints(), cloud.points_.size());
+    ASSERT_GT(lod.GetNodes().size(), 1u);
+
+    // Every point is stored exactly once, inside of the cube of its node.
+    size_t num_points = 0;
+    for (const PointCloudLOD::Node& node : lod.GetNodes()) {
+        EXPECT_EQ(node.cloud->colors_.size(), node.cloud->points_.size());
+        for (const Eigen::Vector3d& p : node.cloud->points_) {
+            const Eigen::Vector3d max_bound =
+                    node.min_bound + Eigen::Vector3d::Constant(node.size);
+            EXPECT_TRUE((p.array() >= node.min_bound.array() - 1e-9).all());
+            EXPECT_TRUE((p.array() <= max_bound.array() + 1e-9).all());
+        }
+        // Inner nodes keep at most one point per grid cell.
+        bool is_leaf = true;
+        for (int child : node.children) {
+            is_leaf &= child < 0;
+        }
+        if (!is_leaf) {
+            EXPECT_LE(node.cloud->points_.size(), 8u * 8u * 8u);
+        }
+        num_points += node.cloud->points_.size();
+    }
+    EXPECT_EQ(num_points, cloud.points_.size());
+
+    EXPECT_TRUE(PointCloudLOD(geometry::PointCloud()).GetNodes().empty());
+}
+
+TEST(PointCloudLOD, SelectNodes) {
+    const geometry::PointCloud cloud = CreateCloud(10000);
+    PointCloudLOD lod(cloud, 8, 500);
+    Eigen::Matrix4f projection;
+    const Eigen::Matrix4f view = LookAtOrigin(projection);
+
+    // Without a size limit and budget all nodes are visible.
+    std::vector<size_t> selected =
+            lod.SelectNodes(view, projection, 1000, SIZE_MAX, 0);
+    EXPECT_EQ(selected.size(), lod.GetNodes().size());
+    EXPECT_EQ(selected[0], 0u);
+
+    // The point budget is respected and coarse nodes come first.
+    const size_t budget = 2000;
+    selected = lod.SelectNodes(view, projection, 1000, budget, 0);
+    size_t num_points = 0;
+    for (size_t node_idx : selected) {
+        num_points += lod.GetNodes()[node_idx].cloud->points_.size();
+    }
+    EXPECT_LE(num_points, budget);
+    ASSERT_FALSE(selected.empty());
+    EXPECT_EQ(selected[0], 0u);
+    EXPECT_LT(selected.size(), lod.GetNodes().size());
+
+    // A small viewport does not refine the root.
+    selected = lod.SelectNodes(view, projection, 10, SIZE_MAX);
+    EXPECT_EQ(selected, std::vector<size_t>({0}));
+
+    // Nothing is selected if the cloud is behind the camera.
+    Eigen::Matrix4f behind = view;
+    behind(2, 3) = 5;
+    EXPECT_TRUE(lod.SelectNodes(behind, projection, 1000, SIZE_MAX, 0).empty());
+}
+
+}  // namespace tests
+}  // namespace open3d
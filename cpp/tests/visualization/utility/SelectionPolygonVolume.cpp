@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/visualization/utility/SelectionPolygonVolume.h"
+
+#include "core/CoreTest.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+class SelectionPolygonVolumePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SelectionPolygonVolume,
+                         SelectionPolygonVolumePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(SelectionPolygonVolumePermuteDevices, CropPointCloud) {
+    const core::Device device = GetParam();
+
+    // A concave "L" shaped polygon in the xz plane.
+    visualization::SelectionPolygonVolume volume;
+    volume.orthogonal_axis_ = "Y";
+    volume.axis_min_ = -0.5;
+    volume.axis_max_ = 0.5;
+    volume.bounding_polygon_ = {{-1, 0, -1}, {1, 0, -1}, {1, 0, 0},
+                                {0, 0, 0},   {0, 0, 1},  {-1, 0, 1}};
+
+    geometry::PointCloud legacy;
+    legacy.points_.resize(2000);
+    Rand(legacy.points_, Eigen::Vector3d::Constant(-1.5),
+         Eigen::Vector3d::Constant(1.5), 0);
+    legacy.colors_.resize(legacy.points_.size());
+    Rand(legacy.colors_, Eigen::Vector3d::Zero(), Eigen::Vector3d::Ones(), 1);
+
+    const std::shared_ptr<geometry::PointCloud> legacy_cropped =
+            volume.CropPointCloud(legacy);
+    ASSERT_GT(legacy_cropped->points_.size(), 0u);
+    ASSERT_LT(legacy_cropped->points_.size(), legacy.points_.size());
+    for (const Eigen::Vector3d &p : legacy_cropped->points_) {
+        EXPECT_LE(std::abs(p(1)), 0.5);
+        EXPECT_FALSE(p(0) > 0 && p(2) > 0);
+    }
+
+    const t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            legacy, core::Float64, device);
+    const t::geometry::PointCloud cropped = volume.CropPointCloud(pcd);
+    EXPECT_EQ(cropped.GetDevice(), device);
+    EXPECT_TRUE(cropped.HasPointColors());
+    const geometry::PointCloud result = cropped.ToLegacy();
+    ExpectEQ(result.points_, legacy_cropped->points_);
+    ExpectEQ(result.colors_, legacy_cropped->colors_);
+
+    EXPECT_EQ(volume.GetPointMask(pcd.GetPointPositions())
+                      .To(core::Int64)
+                      .Sum({0})
+                      .Item<int64_t>(),
+              int64_t(legacy_cropped->points_.size()));
+
+    visualization::SelectionPolygonVolume empty_volume;
+    EXPECT_TRUE(empty_volume.CropPointCloud(pcd).IsEmpty());
+}
+
+}  // namespace tests
+}  // namespace open3d
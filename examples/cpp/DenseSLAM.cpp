@@ -135,12 +135,24 @@ int main(int argc, char* argv[]) {
     t::pipelines::slam::Frame raycast_frame(
             ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
 
+    // Decode the next frames in the background, directly onto the device.
+    t::io::ImageReader depth_reader, color_reader;
+    depth_reader.Open(std::vector<std::string>(depth_filenames.begin(),
+                                               depth_filenames.begin() +
+                                                       iterations),
+                      device);
+    color_reader.Open(std::vector<std::string>(color_filenames.begin(),
+                                               color_filenames.begin() +
+                                                       iterations),
+                      device);
+
     // Iterate over frames
     for (size_t i = 0; i < iterations; ++i) {
         utility::LogInfo("Processing {}/{}...", i, iterations);
         // Load image into frame
-        Image input_depth = *t::io::CreateImageFromFile(depth_filenames[i]);
-        Image input_color = *t::io::CreateImageFromFile(color_filenames[i]);
+        Image input_depth, input_color;
+        depth_reader.ReadNext(input_depth);
+        color_reader.ReadNext(input_color);
         input_frame.SetDataFromImage("depth", input_depth);
         input_frame.SetDataFromImage("color", input_color);
 
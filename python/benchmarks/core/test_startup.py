@@ -0,0 +1,63 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+# Startup costs are paid once per process, so each round runs a new
+# interpreter. Short-lived CPU workers should not pay for CUDA initialization.
+
+import open3d.core as o3c
+import pytest
+
+import subprocess
+import sys
+
+STARTUP_SCRIPTS = {
+    "import": "import open3d",
+    "first_cpu_tensor": ("import open3d.core as o3c\n"
+                         "o3c.Tensor.ones((1000, 3), "
+                         "device=o3c.Device('CPU:0'))"),
+    "first_cuda_tensor": ("import open3d.core as o3c\n"
+                          "o3c.Tensor.ones((1000, 3), "
+                          "device=o3c.Device('CUDA:0'))"),
+}
+
+
+def list_startup_scripts():
+    names = ["import", "first_cpu_tensor"]
+    if o3c.cuda.is_available():
+        names.append("first_cuda_tensor")
+    return names
+
+
+def run_script(script):
+    subprocess.run([sys.executable, "-c", script], check=True)
+
+
+@pytest.mark.parametrize("name", list_startup_scripts())
+def test_startup(benchmark, name):
+    benchmark.pedantic(run_script,
+                       args=(STARTUP_SCRIPTS[name],),
+                       rounds=5,
+                       iterations=1)
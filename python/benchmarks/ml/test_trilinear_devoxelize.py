@@ -0,0 +1,69 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import numpy as np
+import pytest
+
+torch = pytest.importorskip('torch')
+ml3d = pytest.importorskip('open3d.ml.torch')
+
+pytestmark = pytest.mark.skipif(not torch.cuda.is_available(),
+                                reason='trilinear_devoxelize requires CUDA')
+
+
+def make_inputs(distribution, dtype):
+    """Creates the inputs for the backward pass. 'clustered' puts all points
+    into a few voxels, which maximizes the contention of atomics."""
+    rng = np.random.RandomState(123)
+    b, c, n, r = 8, 64, 65536, 32
+    if distribution == 'uniform':
+        coords = rng.uniform(0, r - 1, size=(b, 3, n))
+    else:
+        coords = rng.uniform(r // 2, r // 2 + 1, size=(b, 3, n))
+    coords = torch.from_numpy(coords.astype(np.float32)).cuda()
+    features = torch.rand((b, c, r, r, r), dtype=dtype, device='cuda')
+    _, inds, wgts = ml3d.ops.trilinear_devoxelize_forward(
+        r, True, coords, features)
+    grad_y = torch.rand((b, c, n), dtype=dtype, device='cuda')
+    return grad_y, inds, wgts, r
+
+
+@pytest.mark.parametrize('distribution', ['uniform', 'clustered'])
+@pytest.mark.parametrize('dtype', [torch.float32, torch.float16])
+@pytest.mark.parametrize('sort_by_voxel', [False, True])
+def test_trilinear_devoxelize_backward(benchmark, distribution, dtype,
+                                       sort_by_voxel):
+    grad_y, inds, wgts, r = make_inputs(distribution, dtype)
+
+    def fn():
+        ml3d.ops.trilinear_devoxelize_backward(grad_y,
+                                               inds,
+                                               wgts,
+                                               r,
+                                               sort_by_voxel=sort_by_voxel)
+        torch.cuda.synchronize()
+
+    benchmark(fn)
@@ -355,12 +355,12 @@ class ContinuousConv(tf.keras.layers.Layer):
             extents_rank2 = tf.expand_dims(extents_rank2, axis=-1)
 
         self._conv_values = {
-            'filters': self.kernel,
+            'filters': tf.cast(self.kernel, tf.float32),
             'out_positions': out_positions,
             'extents': extents_rank2,
             'offset': offset,
             'inp_positions': inp_positions,
-            'inp_features': inp_features,
+            'inp_features': tf.cast(inp_features, tf.float32),
             'inp_importance': inp_importance,
             'neighbors_index': neighbors_index,
             'neighbors_row_splits': neighbors_row_splits,
@@ -371,7 +371,11 @@ class ContinuousConv(tf.keras.layers.Layer):
             'normalize': self.normalize,
         }
 
-        out_features = ops.continuous_conv(**self._conv_values)
+        # The ops only have float32 kernels. Cast the result back to the
+        # compute dtype so the layer works under a mixed precision policy;
+        # the computation itself runs in float32.
+        out_features = tf.cast(ops.continuous_conv(**self._conv_values),
+                               inp_features.dtype)
 
         self._conv_output = out_features
 
@@ -574,12 +578,12 @@ class SparseConv(tf.keras.layers.Layer):
         extents_rank2 = tf.fill([1, 1], voxel_size * self.kernel_size[0])
 
         self._conv_values = {
-            'filters': self.kernel,
+            'filters': tf.cast(self.kernel, tf.float32),
             'out_positions': out_positions,
             'extents': extents_rank2,
             'offset': offset,
             'inp_positions': inp_positions,
-            'inp_features': inp_features,
+            'inp_features': tf.cast(inp_features, tf.float32),
             'inp_importance': inp_importance,
             'neighbors_index': self.nns.neighbors_index,
             'neighbors_importance': tf.ones((0,), dtype=tf.float32),
@@ -590,7 +594,11 @@ class SparseConv(tf.keras.layers.Layer):
             'normalize': self.normalize,
         }
 
-        out_features = ops.continuous_conv(**self._conv_values)
+        # The ops only have float32 kernels. Cast the result back to the
+        # compute dtype so the layer works under a mixed precision policy;
+        # the computation itself runs in float32.
+        out_features = tf.cast(ops.continuous_conv(**self._conv_values),
+                               inp_features.dtype)
 
         self._conv_output = out_features
 
@@ -798,12 +806,12 @@ class SparseConvTranspose(tf.keras.layers.Layer):
         extents_rank2 = tf.fill([1, 1], voxel_size * self.kernel_size[0])
 
         self._conv_values = {
-            'filters': self.kernel,
+            'filters': tf.cast(self.kernel, tf.float32),
             'out_positions': out_positions,
             'extents': extents_rank2,
             'offset': offset,
             'inp_positions': inp_positions,
-            'inp_features': inp_features,
+            'inp_features': tf.cast(inp_features, tf.float32),
             'out_importance': out_importance,
             'inp_neighbors_index': self.nns_inp.neighbors_index,
             'inp_neighbors_importance_sum': empty_vec,
@@ -817,7 +825,12 @@ class SparseConvTranspose(tf.keras.layers.Layer):
             'normalize': self.normalize,
         }
 
-        out_features = ops.continuous_conv_transpose(**self._conv_values)
+        # The ops only have float32 kernels. Cast the result back to the
+        # compute dtype so the layer works under a mixed precision policy;
+        # the computation itself runs in float32.
+        out_features = tf.cast(
+            ops.continuous_conv_transpose(**self._conv_values),
+            inp_features.dtype)
 
         self._conv_output = out_features
 
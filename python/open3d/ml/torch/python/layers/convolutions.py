@@ -34,6 +34,45 @@ import numpy as np
 __all__ = ['ContinuousConv', 'SparseConv', 'SparseConvTranspose']
 
 
+def _fixed_radius_search(search, neighbors_cache, queries_key, points, queries,
+                         radius, **kwargs):
+    """Runs the fixed radius search or reuses the result from the cache.
+
+    queries_key identifies the queries in the cache because the queries are
+    often computed from other tensors in each call.
+    """
+    if neighbors_cache is None:
+        return search(points, queries=queries, radius=radius, **kwargs)
+    key = ('fixed_radius_search', search.metric, search.ignore_query_point,
+           search.return_distances, points, radius) + queries_key
+    return neighbors_cache.get(
+        key, lambda: search(points,
+                            queries=queries,
+                            radius=radius,
+                            neighbors_cache=neighbors_cache,
+                            **kwargs))
+
+
+def _inverted_neighbors_args(neighbors_cache, num_points, neighbors_index,
+                             neighbors_row_splits, *params):
+    """Returns the inverted neighbors list arguments for the conv ops.
+
+    The list is only needed for the backward pass. Without a cache the op
+    computes it in the backward pass.
+    """
+    if (neighbors_cache is None or not torch.is_grad_enabled() or
+            not any(p.requires_grad for p in params)):
+        return {}
+    inv_neighbors_index, inv_neighbors_row_splits, inv_arange = (
+        neighbors_cache.inverted_neighbors(num_points, neighbors_index,
+                                           neighbors_row_splits))
+    return {
+        'inv_neighbors_index': inv_neighbors_index,
+        'inv_neighbors_row_splits': inv_neighbors_row_splits,
+        'inv_arange': inv_arange,
+    }
+
+
 class ContinuousConv(torch.nn.Module):
     r"""Continuous Convolution.
 
@@ -215,7 +254,8 @@ class ContinuousConv(torch.nn.Module):
                 fixed_radius_search_hash_table=None,
                 user_neighbors_index=None,
                 user_neighbors_row_splits=None,
-                user_neighbors_importance=None):
+                user_neighbors_importance=None,
+                neighbors_cache=None):
         """This function computes the output features.
 
         Arguments:
@@ -255,6 +295,11 @@ class ContinuousConv(torch.nn.Module):
           user_neighbors_importance: Defines a scalar importance value for each
             element in 'user_neighbors_index'.
 
+          neighbors_cache: An optional NeighborsCache shared with other layers
+            that use the same point sets. The fixed radius search and the
+            inverted neighbors list for the backward pass are reused from the
+            cache.
+
 
         Returns: A tensor of shape [num output points, filters] with the output
           features.
@@ -286,10 +331,12 @@ class ContinuousConv(torch.nn.Module):
         else:
             if len(extents.shape) == 0:
                 radius = 0.5 * extents
-                self.nns = self.fixed_radius_search(
+                self.nns = _fixed_radius_search(
+                    self.fixed_radius_search,
+                    neighbors_cache, (out_positions,),
                     inp_positions,
-                    queries=out_positions,
-                    radius=radius,
+                    out_positions,
+                    radius,
                     hash_table=fixed_radius_search_hash_table)
                 if return_distances:
                     if self.radius_search_metric == 'L2':
@@ -340,6 +387,10 @@ class ContinuousConv(torch.nn.Module):
             'interpolation': self.interpolation,
             'normalize': self.normalize,
         }
+        self._conv_values.update(
+            _inverted_neighbors_args(neighbors_cache, inp_positions.shape[0],
+                                     neighbors_index, neighbors_row_splits,
+                                     inp_features, self.kernel))
 
         out_features = ops.continuous_conv(**self._conv_values)
 
@@ -453,7 +504,8 @@ class SparseConv(torch.nn.Module):
                 out_positions,
                 voxel_size,
                 inp_importance=None,
-                fixed_radius_search_hash_table=None):
+                fixed_radius_search_hash_table=None,
+                neighbors_cache=None):
         """This function computes the output features.
 
         Arguments:
@@ -476,6 +528,10 @@ class SparseConv(torch.nn.Module):
             Note that the hash table must have been generated with the same 'points'
             array. Note that this parameter is only used if 'extents' is a scalar.
 
+          neighbors_cache: An optional NeighborsCache shared with other layers
+            that use the same point sets. SparseConv and SparseConvTranspose
+            layers between the same two point sets share their neighbor search.
+
         Returns: A tensor of shape [num output points, filters] with the output
           features.
         """
@@ -498,10 +554,12 @@ class SparseConv(torch.nn.Module):
                                          device=self.kernel.device)
 
         hash_table_size_factor = 1 / 64
-        self.nns = self.fixed_radius_search(
+        self.nns = _fixed_radius_search(
+            self.fixed_radius_search,
+            neighbors_cache, (out_positions, tuple(offset.tolist())),
             inp_positions,
-            queries=out_positions - offset * voxel_size,
-            radius=self.kernel_size[0] * voxel_size * 0.51,
+            out_positions - offset * voxel_size,
+            self.kernel_size[0] * voxel_size * 0.51,
             hash_table_size_factor=hash_table_size_factor,
             hash_table=fixed_radius_search_hash_table)
 
@@ -534,6 +592,11 @@ class SparseConv(torch.nn.Module):
             'interpolation': 'nearest_neighbor',
             'normalize': self.normalize,
         }
+        self._conv_values.update(
+            _inverted_neighbors_args(neighbors_cache, inp_positions.shape[0],
+                                     self.nns.neighbors_index,
+                                     self.nns.neighbors_row_splits,
+                                     inp_features, self.kernel))
 
         out_features = ops.continuous_conv(**self._conv_values)
 
@@ -648,7 +711,8 @@ class SparseConvTranspose(torch.nn.Module):
                 out_positions,
                 voxel_size,
                 out_importance=None,
-                fixed_radius_search_hash_table=None):
+                fixed_radius_search_hash_table=None,
+                neighbors_cache=None):
         """This function computes the output features.
 
         Arguments:
@@ -671,6 +735,10 @@ class SparseConvTranspose(torch.nn.Module):
             Note that the hash table must have been generated with the same 'points'
             array. Note that this parameter is only used if 'extents' is a scalar.
 
+          neighbors_cache: An optional NeighborsCache shared with other layers
+            that use the same point sets. SparseConv and SparseConvTranspose
+            layers between the same two point sets share their neighbor search.
+
         Returns: A tensor of shape [num output points, filters] with the output
           features.
         """
@@ -697,10 +765,12 @@ class SparseConvTranspose(torch.nn.Module):
                                 device=self.kernel.device)
 
         hash_table_size_factor = 1 / 64
-        self.nns_inp = self.fixed_radius_search(
+        self.nns_inp = _fixed_radius_search(
+            self.fixed_radius_search,
+            neighbors_cache, (inp_positions, tuple(offset.tolist())),
             out_positions,
-            queries=inp_positions - offset * voxel_size,
-            radius=self.kernel_size[0] * voxel_size * 0.51,
+            inp_positions - offset * voxel_size,
+            self.kernel_size[0] * voxel_size * 0.51,
             hash_table_size_factor=hash_table_size_factor,
             hash_table=fixed_radius_search_hash_table)
 
@@ -713,9 +783,15 @@ class SparseConvTranspose(torch.nn.Module):
 
         num_out = out_positions.shape[0]
 
-        neighbors_index, neighbors_row_splits, _ = ops.invert_neighbors_list(
-            num_out, self.nns_inp.neighbors_index,
-            self.nns_inp.neighbors_row_splits, empty_vec)
+        if neighbors_cache is None:
+            neighbors_index, neighbors_row_splits, _ = ops.invert_neighbors_list(
+                num_out, self.nns_inp.neighbors_index,
+                self.nns_inp.neighbors_row_splits, empty_vec)
+        else:
+            neighbors_index, neighbors_row_splits, _ = (
+                neighbors_cache.inverted_neighbors(
+                    num_out, self.nns_inp.neighbors_index,
+                    self.nns_inp.neighbors_row_splits))
 
         # for stats and debugging
         num_pairs = neighbors_index.shape[0]
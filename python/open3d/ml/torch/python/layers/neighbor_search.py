@@ -28,7 +28,7 @@ from ...python import ops
 from ....torch import classes
 import torch
 
-__all__ = ['FixedRadiusSearch', 'RadiusSearch', 'KNNSearch']
+__all__ = ['FixedRadiusSearch', 'RadiusSearch', 'KNNSearch', 'NeighborsCache']
 
 
 class FixedRadiusSearch(torch.nn.Module):
@@ -82,7 +82,9 @@ class FixedRadiusSearch(torch.nn.Module):
                 points_row_splits=None,
                 queries_row_splits=None,
                 hash_table_size_factor=1 / 64,
-                hash_table=None):
+                hash_table=None,
+                neighbors_cache=None,
+                max_num_neighbors=-1):
         """This function computes the neighbors within a fixed radius for each query point.
 
         Arguments:
@@ -109,6 +111,17 @@ class FixedRadiusSearch(torch.nn.Module):
             cases and is usually not needed.
             Note that the hash table must have been generated with the same 'points' array.
 
+          neighbors_cache: An optional NeighborsCache. If given the hash table
+            is built once for each 'points' array and radius and reused by
+            all searches that use the same cache.
+
+          max_num_neighbors: If not negative the outputs 'neighbors_index' and
+            'neighbors_distance' have this fixed size. The CUDA op then does
+            not synchronize with the host, which allows capturing the search
+            in a CUDA graph. Neighbors beyond this size are dropped and the
+            last element of 'neighbors_row_splits' is the total number of
+            neighbors found.
+
         Returns:
           3 Tensors in the following order
 
@@ -126,6 +139,7 @@ class FixedRadiusSearch(torch.nn.Module):
             Note that the distances are squared if metric is L2.
             This is a zero length Tensor if 'return_distances' is False.
         """
+        points_key = points
         if isinstance(points, classes.RaggedTensor):
             points_row_splits = points.row_splits
             points = points.values
@@ -138,15 +152,22 @@ class FixedRadiusSearch(torch.nn.Module):
         if queries_row_splits is None:
             queries_row_splits = torch.LongTensor([0, queries.shape[0]])
 
-        if hash_table is None:
-            table = ops.build_spatial_hash_table(
+        def build_hash_table():
+            return ops.build_spatial_hash_table(
                 max_hash_table_size=self.max_hash_table_size,
                 points=points,
                 radius=radius,
                 points_row_splits=points_row_splits,
                 hash_table_size_factor=hash_table_size_factor)
-        else:
+
+        if hash_table is not None:
             table = hash_table
+        elif neighbors_cache is not None:
+            table = neighbors_cache.get(
+                ('hash_table', points_key, radius, hash_table_size_factor,
+                 self.max_hash_table_size), build_hash_table)
+        else:
+            table = build_hash_table()
 
         result = ops.fixed_radius_search(
             ignore_query_point=self.ignore_query_point,
@@ -159,7 +180,8 @@ class FixedRadiusSearch(torch.nn.Module):
             queries_row_splits=queries_row_splits,
             hash_table_splits=table.hash_table_splits,
             hash_table_index=table.hash_table_index,
-            hash_table_cell_splits=table.hash_table_cell_splits)
+            hash_table_cell_splits=table.hash_table_cell_splits,
+            max_num_neighbors=max_num_neighbors)
         return result
 
 
@@ -369,3 +391,89 @@ class KNNSearch(torch.nn.Module):
                                 points_row_splits=points_row_splits,
                                 queries_row_splits=queries_row_splits)
         return result
+
+
+class NeighborsCache:
+    """Cache for neighbor search structures shared by several layers.
+
+    Networks often apply several layers to the same point sets, e.g. a stack
+    of convolutions on the same voxel level or a transposed convolution that
+    mirrors a convolution of the encoder. Passing the same cache to these
+    layers computes the spatial hash table, the neighbor lists and the
+    inverted neighbor lists for the backward pass only once.
+
+    Tensors in keys are compared by identity and the cache keeps a reference
+    to them. Create a new cache for each forward pass.
+
+    Example:
+      This example shares the neighbor search of two sparse convolutions.::
+
+        import torch
+        import open3d.ml.torch as ml3d
+
+        points = torch.randint(0, 10, [20, 3]).float() + 0.5
+        feats = torch.randn([20, 8])
+        conv1 = ml3d.layers.SparseConv(in_channels=8, filters=16, kernel_size=[3,3,3])
+        conv2 = ml3d.layers.SparseConv(in_channels=16, filters=16, kernel_size=[3,3,3])
+
+        cache = ml3d.layers.NeighborsCache()
+        x = conv1(feats, points, points, 1.0, neighbors_cache=cache)
+        x = conv2(x, points, points, 1.0, neighbors_cache=cache)
+    """
+
+    def __init__(self):
+        self._values = {}
+        self._tensors = []
+
+    def _make_key(self, key):
+        result = []
+        for k in key:
+            if isinstance(k, torch.Tensor) and k.dim() == 0:
+                result.append(k.item())
+            elif isinstance(k, (torch.Tensor, classes.RaggedTensor)):
+                # keep the tensor alive so that its id is not reused
+                self._tensors.append(k)
+                result.append(('tensor', id(k)))
+            else:
+                result.append(k)
+        return tuple(result)
+
+    def get(self, key, compute):
+        """Returns the value for key and calls compute() if it is missing.
+
+        Arguments:
+          key: A tuple of tensors and hashable values.
+
+          compute: A function without arguments that returns the value.
+        """
+        key = self._make_key(key)
+        if key not in self._values:
+            self._values[key] = compute()
+        return self._values[key]
+
+    def inverted_neighbors(self, num_points, neighbors_index,
+                           neighbors_row_splits):
+        """Returns the inverted neighbors list.
+
+        Arguments:
+          num_points: The number of points that are indexed by neighbors_index.
+
+          neighbors_index: The neighbors list to invert.
+
+          neighbors_row_splits: The row splits of the neighbors list.
+
+        Returns:
+          A tuple (inv_neighbors_index, inv_neighbors_row_splits, inv_arange).
+          inv_arange stores the position of each entry of the inverted list
+          in neighbors_index.
+        """
+
+        def compute():
+            arange = torch.arange(neighbors_index.shape[0],
+                                  device=neighbors_index.device)
+            return tuple(
+                ops.invert_neighbors_list(num_points, neighbors_index,
+                                          neighbors_row_splits, arange))
+
+        return self.get(('inverted_neighbors', neighbors_index, num_points),
+                        compute)
@@ -446,6 +446,34 @@ def test_tensor_from_to_numpy():
     np.testing.assert_equal(dst_t, o3d_t.numpy())
 
 
+def test_tensor_from_buffer():
+    # Legacy vectors are shared without a copy.
+    np_points = np.random.rand(10, 3)
+    points = o3d.utility.Vector3dVector(np_points)
+    a = o3c.Tensor.from_buffer(points)
+    assert a.shape == o3c.SizeVector([10, 3])
+    assert a.dtype == o3c.float64
+    np.testing.assert_equal(a.numpy(), np_points)
+    a[0, 0] = 100
+    assert points[0][0] == 100
+
+    # The tensor keeps the legacy vector alive.
+    b = o3c.Tensor.from_buffer(o3d.utility.Vector3dVector(np_points))
+    np.testing.assert_equal(b.numpy(), np_points)
+
+    # Implicit conversion of buffers, e.g. for tensor geometry attributes.
+    pcd = o3d.t.geometry.PointCloud(points)
+    np.testing.assert_equal(pcd.point.positions.numpy(), a.numpy())
+
+    # The constructor always copies, fused with the dtype conversion.
+    c = o3c.Tensor(np_points, dtype=o3c.float32)
+    assert c.dtype == o3c.float32
+    np.testing.assert_allclose(c.numpy(), np_points, rtol=1e-6)
+    d = o3c.Tensor(np_points)
+    d[0, 0] = 100
+    assert np_points[0, 0] != 100
+
+
 def test_tensor_to_numpy_scope():
     src_t = np.array([[10., 11., 12.], [13., 14., 15.]])
 
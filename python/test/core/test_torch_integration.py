@@ -115,3 +115,37 @@ def test_tensor_numpy_to_open3d_to_pytorch():
     np.testing.assert_equal(r, a)
     np.testing.assert_equal(r, b.cpu().numpy())
     np.testing.assert_equal(r, c.cpu().numpy())
+
+
+@pytest.mark.parametrize("device", list_devices_with_torch())
+def test_tensor_dlpack_protocol(device):
+    if not torch_available():
+        return
+
+    device_id = device.get_id()
+    device_type = device.get_type()
+
+    # Open3D consumes a PyTorch tensor through __dlpack__, sharing memory.
+    a = torch.ones((2, 3))
+    if device_type == o3c.Device.DeviceType.CUDA:
+        a = a.cuda(device_id)
+    b = o3c.Tensor.from_dlpack(a)
+    a[0, 0] = 100
+    np.testing.assert_equal(b.cpu().numpy(), a.cpu().numpy())
+
+    # PyTorch consumes an Open3D tensor through __dlpack__.
+    c = o3c.Tensor.ones((2, 3), device=device)
+    if device_type == o3c.Device.DeviceType.CUDA:
+        assert c.__dlpack_device__() == (2, device_id)
+        # Consume on a side stream without synchronizing the device.
+        stream = torch.cuda.Stream(device_id)
+        with torch.cuda.stream(stream):
+            d = torch.utils.dlpack.from_dlpack(
+                c.__dlpack__(stream=stream.cuda_stream))
+            d *= 2
+        stream.synchronize()
+    else:
+        assert c.__dlpack_device__() == (1, 0)
+        d = torch.utils.dlpack.from_dlpack(c.__dlpack__())
+        d *= 2
+    np.testing.assert_equal(c.cpu().numpy(), np.full((2, 3), 2.0))
@@ -335,3 +335,37 @@ def test_fixed_radius_search_raggedtensor(dtype, ml, batch_size, radius,
                 else:
                     gt_dist = np.linalg.norm(q - points[j], ord=p_norm)
                 np.testing.assert_allclose(dist, gt_dist, rtol=1e-7, atol=1e-8)
+
+
+@mltest.parametrize.ml_torch_only
+@pytest.mark.parametrize('max_num_neighbors', [0, 50, 10000])
+def test_fixed_radius_search_max_num_neighbors(ml, max_num_neighbors):
+    rng = np.random.RandomState(123)
+
+    dtype = np.float32
+    radius = 0.3
+    points = rng.random(size=(200, 3)).astype(dtype)
+    queries = rng.random(size=(50, 3)).astype(dtype)
+
+    layer = ml.layers.FixedRadiusSearch(return_distances=True)
+    ans = mltest.run_op(ml, ml.device, True, layer, points, queries, radius)
+    ans_fixed = mltest.run_op(ml,
+                              ml.device,
+                              True,
+                              layer,
+                              points,
+                              queries,
+                              radius,
+                              max_num_neighbors=max_num_neighbors)
+
+    # the row splits still count all neighbors
+    np.testing.assert_equal(ans_fixed.neighbors_row_splits,
+                            ans.neighbors_row_splits)
+    assert ans_fixed.neighbors_index.shape == (max_num_neighbors,)
+    assert ans_fixed.neighbors_distance.shape == (max_num_neighbors,)
+
+    num = min(max_num_neighbors, ans.neighbors_index.shape[0])
+    np.testing.assert_equal(ans_fixed.neighbors_index[:num],
+                            ans.neighbors_index[:num])
+    np.testing.assert_allclose(ans_fixed.neighbors_distance[:num],
+                               ans.neighbors_distance[:num])
@@ -74,3 +74,114 @@ def test_nms_empty(ml):
 
     np.testing.assert_equal(keep_indices, keep_indices_ref)
     assert keep_indices.dtype == keep_indices_ref.dtype
+
+
+def nms_python(iou, scores, nms_overlap_thresh, labels=None):
+    order = np.argsort(-scores, kind='stable')
+    removed = np.zeros(scores.shape[0], dtype=bool)
+    keep_indices = []
+    for i, box_i in enumerate(order):
+        if removed[i]:
+            continue
+        keep_indices.append(box_i)
+        for j in range(i + 1, order.shape[0]):
+            box_j = order[j]
+            if labels is not None and labels[box_i] != labels[box_j]:
+                continue
+            if iou[box_i, box_j] > nms_overlap_thresh:
+                removed[j] = True
+    return np.array(keep_indices, dtype=np.int64)
+
+
+@mltest.parametrize.ml
+def test_nms_random(ml):
+    from open3d.ml.contrib import iou_bev_cpu
+
+    rng = np.random.RandomState(123)
+    num_boxes = 3000
+    corners = rng.uniform(0, 50, size=(num_boxes, 2))
+    sizes = rng.uniform(1, 3, size=(num_boxes, 2))
+    angles = rng.uniform(0, np.pi, size=(num_boxes, 1))
+    boxes = np.concatenate([corners, corners + sizes, angles],
+                           axis=1).astype(np.float32)
+    scores = rng.randint(0, 100, size=(num_boxes,)).astype(np.float32)
+    nms_overlap_thresh = 0.3
+
+    # iou_bev_cpu expects (x_center, y_center, x_size, y_size, rotate).
+    boxes_center = np.concatenate([corners + sizes / 2, sizes, angles],
+                                  axis=1).astype(np.float32)
+    iou = iou_bev_cpu(boxes_center, boxes_center)
+    keep_indices_ref = nms_python(iou, scores, nms_overlap_thresh)
+
+    keep_indices = mltest.run_op(ml,
+                                 ml.device,
+                                 True,
+                                 ml.ops.nms,
+                                 boxes,
+                                 scores,
+                                 nms_overlap_thresh=nms_overlap_thresh)
+
+    np.testing.assert_equal(keep_indices, keep_indices_ref)
+
+
+@mltest.parametrize.ml
+def test_nms_3d(ml):
+    # (x, y_max, z, x_size, y_size, z_size, y_rotate)
+    boxes = np.array([[0.0, 1.0, 0.0, 2.0, 2.0, 4.0, 0.1],
+                      [0.1, 1.0, 0.1, 2.0, 2.0, 4.0, 0.0],
+                      [0.0, 5.0, 0.0, 2.0, 2.0, 4.0, 0.1],
+                      [6.0, 1.0, 0.0, 2.0, 2.0, 4.0, 0.0]],
+                     dtype=np.float32)
+    scores = np.array([1, 2, 3, 4], dtype=np.float32)
+    keep_indices_ref = np.array([3, 2, 1], dtype=np.int64)
+
+    keep_indices = mltest.run_op(ml,
+                                 ml.device,
+                                 True,
+                                 ml.ops.nms,
+                                 boxes,
+                                 scores,
+                                 nms_overlap_thresh=0.5)
+
+    np.testing.assert_equal(keep_indices, keep_indices_ref)
+
+
+@mltest.parametrize.ml_torch_only
+def test_nms_labels(ml):
+    boxes = np.array([[15.0811, -7.9803, 15.6721, -6.8714, 0.5152],
+                      [15.1166, -7.9261, 15.7060, -6.8137, 0.6501],
+                      [15.1304, -7.8129, 15.7069, -6.8903, 0.7296],
+                      [15.2050, -7.8447, 15.8311, -6.7437, 1.0506],
+                      [15.1343, -7.8136, 15.7121, -6.8479, 1.0352],
+                      [15.0931, -7.9552, 15.6675, -7.0056, 0.5979]],
+                     dtype=np.float32)
+    scores = np.array([3, 1.1, 5, 2, 1, 0], dtype=np.float32)
+    labels = np.array([0, 1, 0, 1, 0, 1], dtype=np.int64)
+    nms_overlap_thresh = 0.7
+
+    # Boxes of different classes do not suppress each other.
+    keep_indices = mltest.run_op(ml,
+                                 ml.device,
+                                 True,
+                                 ml.ops.nms,
+                                 boxes,
+                                 scores,
+                                 nms_overlap_thresh=nms_overlap_thresh,
+                                 labels=labels)
+
+    keep_indices_ref = []
+    for label in (0, 1):
+        idx = np.nonzero(labels == label)[0]
+        keep = mltest.run_op(ml,
+                             ml.device,
+                             True,
+                             ml.ops.nms,
+                             boxes[idx],
+                             scores[idx],
+                             nms_overlap_thresh=nms_overlap_thresh)
+        keep_indices_ref.extend(idx[keep])
+    keep_indices_ref = np.array(sorted(keep_indices_ref,
+                                       key=lambda i: -scores[i]),
+                                dtype=np.int64)
+
+    np.testing.assert_equal(keep_indices, keep_indices_ref)
@@ -48,3 +48,19 @@ def test_furthest_point_sampling(ml):
         'https://storage.googleapis.com/isl-datasets/open3d-dev/test/ml_ops/data/sampling/out.npy'
     )
     np.testing.assert_equal(ans, expected)
+
+
+@mltest.parametrize.ml_torch_only
+def test_furthest_point_sampling_large_cloud(ml):
+    # A single large cloud uses multiple blocks per batch item on the gpu and
+    # multiple threads on the cpu.
+    rng = np.random.RandomState(123)
+    values = rng.rand(1, 100000, 3).astype(np.float32)
+    samples = 256
+
+    ans = mltest.run_op(ml, ml.device, True, ml.ops.furthest_point_sampling,
+                        values, samples)
+    expected = mltest.run_op(ml, 'cpu', True, ml.ops.furthest_point_sampling,
+                             values, samples)
+    np.testing.assert_equal(ans, expected)
+    assert len(np.unique(ans)) == samples
@@ -534,3 +534,52 @@ def test_compare_to_conv3dtranspose_batches(ml, dtype, kernel_size,
         y_conv3d += bias
 
         np.testing.assert_allclose(y_out, y_conv3d, rtol=1e-3, atol=1e-5)
+
+
+@mltest.parametrize.ml_torch_only
+def test_neighbors_cache(ml):
+    """Compares layers sharing a NeighborsCache to layers without a cache"""
+    torch = ml.module
+    np.random.seed(0)
+
+    inp_positions = np.unique(np.random.randint(0, 10, (256, 3)),
+                              axis=0).astype(np.float32) + 0.5
+    out_positions = np.unique(np.random.randint(0, 10, (64, 3)),
+                              axis=0).astype(np.float32) + 0.5
+    inp_features = np.random.rand(inp_positions.shape[0], 4).astype(np.float32)
+
+    conv = ml.layers.SparseConv(in_channels=4, filters=8, kernel_size=[3, 3, 3])
+    conv_transpose = ml.layers.SparseConvTranspose(in_channels=8,
+                                                   filters=4,
+                                                   kernel_size=[3, 3, 3])
+    conv.to(ml.device)
+    conv_transpose.to(ml.device)
+    inp_positions = torch.from_numpy(inp_positions).to(ml.device)
+    out_positions = torch.from_numpy(out_positions).to(ml.device)
+
+    def run(neighbors_cache):
+        features = torch.from_numpy(inp_features).to(ml.device)
+        features.requires_grad_()
+        y = conv(features,
+                 inp_positions,
+                 out_positions,
+                 1.0,
+                 neighbors_cache=neighbors_cache)
+        z = conv_transpose(y,
+                           out_positions,
+                           inp_positions,
+                           1.0,
+                           neighbors_cache=neighbors_cache)
+        z.sum().backward()
+        return mltest.to_numpy(z.detach()), mltest.to_numpy(features.grad)
+
+    z, features_grad = run(None)
+    z_cached, features_grad_cached = run(ml.layers.NeighborsCache())
+
+    # the transposed convolution reuses the neighbor search of the convolution
+    assert conv_transpose.nns_inp is conv.nns
+    np.testing.assert_allclose(z_cached, z, rtol=1e-5, atol=1e-6)
+    np.testing.assert_allclose(features_grad_cached,
+                               features_grad,
+                               rtol=1e-5,
+                               atol=1e-6)
@@ -28,6 +28,7 @@ import numpy as np
 import open3d as o3d
 import pytest
 import importlib
+import mltest
 
 
 @pytest.mark.skipif(not o3d._build_config['BUILD_TENSORFLOW_OPS'],
@@ -92,3 +93,55 @@ def test_tf_batch_subsampling():
 
     with pytest.raises(ValueError):
         ops.batch_grid_subsampling(points, None, 1)
+
+
+@mltest.parametrize.ml
+def test_batch_grid_subsampling_matches_contrib(ml):
+    from open3d.ml.contrib import subsample_batch
+
+    rng = np.random.RandomState(123)
+    points = rng.rand(1000, 3).astype(np.float32)
+    batches = np.array([300, 450, 250], dtype=np.int32)
+
+    sub_points_ref, sub_batch_ref = subsample_batch(points,
+                                                    batches,
+                                                    sampleDl=0.1)
+    ans = mltest.run_op(ml, ml.device, True, ml.ops.batch_grid_subsampling,
+                        points, batches, 0.1)
+
+    # cpu and gpu implementations return the cells in the same order
+    np.testing.assert_equal(ans[0], sub_points_ref)
+    np.testing.assert_equal(ans[1], sub_batch_ref)
+
+
+@mltest.parametrize.ml_torch_only
+def test_batch_grid_subsampling_features_classes(ml):
+    from open3d.ml.contrib import subsample_batch
+
+    rng = np.random.RandomState(123)
+    points = rng.rand(1000, 3).astype(np.float32)
+    features = rng.rand(1000, 4).astype(np.float32)
+    classes = rng.randint(0, 5, size=(1000,)).astype(np.int32)
+    batches = np.array([300, 450, 250], dtype=np.int32)
+
+    ref = subsample_batch(points,
+                          batches,
+                          features=features,
+                          classes=classes,
+                          sampleDl=0.2,
+                          max_p=100)
+    ans = mltest.run_op(ml,
+                        ml.device,
+                        True,
+                        ml.ops.batch_grid_subsampling,
+                        points,
+                        batches,
+                        0.2,
+                        features=features,
+                        classes=classes,
+                        max_p=100)
+
+    np.testing.assert_equal(ans.sub_points, ref[0])
+    np.testing.assert_equal(ans.sub_batches, ref[1])
+    np.testing.assert_equal(ans.sub_features, ref[2])
+    np.testing.assert_equal(ans.sub_classes, ref[3])
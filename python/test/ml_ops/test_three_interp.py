@@ -53,3 +53,42 @@ def test_three_interp(ml):
         'https://storage.googleapis.com/isl-datasets/open3d-dev/test/ml_ops/data/three_interp/out.npy'
     )
     np.testing.assert_equal(ans, expected)
+
+
+@mltest.parametrize.ml_gpu_only
+@pytest.mark.parametrize('deterministic', [False, True])
+def test_three_interp_grad(ml, deterministic):
+    if ml.module.__name__ != 'torch':
+        return
+    torch = ml.module
+    rng = np.random.RandomState(123)
+
+    b, c, n, m = 2, 4, 1000, 50
+    # few points receive many contributions to stress the scatter
+    idx = rng.randint(0, m, size=(b, n, 3)).astype(np.int32)
+    weight = rng.uniform(0, 1, size=(b, n, 3)).astype(np.float32)
+    grad_out = rng.uniform(-1, 1, size=(b, c, n)).astype(np.float32)
+
+    grad_ref = np.zeros((b, c, m), dtype=np.float64)
+    for i in range(b):
+        for k in range(3):
+            np.add.at(grad_ref[i].T, idx[i, :, k],
+                      (weight[i, :, k] * grad_out[i]).T)
+
+    args = (torch.from_numpy(grad_out).to(ml.device),
+            torch.from_numpy(idx).to(ml.device),
+            torch.from_numpy(weight).to(ml.device), m)
+    o3d.utility.set_deterministic(deterministic)
+    try:
+        grads = [
+            mltest.to_numpy(ml.ops.three_interpolate_grad(*args))
+            for _ in range(3)
+        ]
+    finally:
+        o3d.utility.set_deterministic(False)
+
+    for grad in grads:
+        np.testing.assert_allclose(grad, grad_ref, rtol=1e-5, atol=1e-4)
+    if deterministic:
+        for grad in grads[1:]:
+            np.testing.assert_equal(grad, grads[0])
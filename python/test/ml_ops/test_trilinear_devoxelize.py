@@ -0,0 +1,99 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+
+import open3d as o3d
+import numpy as np
+import pytest
+import mltest
+
+# Skip all tests if the ml ops were not built.
+pytestmark = mltest.default_marks
+
+
+def trilinear_devoxelize_python(r, coords, features, grad_y):
+    """Reference forward and backward for trilinear_devoxelize."""
+    b, c = features.shape[:2]
+    n = coords.shape[2]
+    features = features.reshape(b, c, -1)
+    lo = np.floor(coords).astype(np.int64)
+    frac = coords - lo
+    hi = np.where(frac > 0, lo + 1, lo)
+    outs = np.zeros((b, c, n), dtype=np.float64)
+    grad_x = np.zeros((b, c, r**3), dtype=np.float64)
+    for corner in range(8):
+        x, y, z = (corner >> 2) & 1, (corner >> 1) & 1, corner & 1
+        idx = [hi[:, d] if s else lo[:, d] for d, s in enumerate((x, y, z))]
+        wgt = np.ones((b, n))
+        for d, s in enumerate((x, y, z)):
+            wgt *= frac[:, d] if s else 1 - frac[:, d]
+        idx = idx[0] * r * r + idx[1] * r + idx[2]
+        for i in range(b):
+            outs[i] += wgt[i] * features[i][:, idx[i]]
+            np.add.at(grad_x[i].T, idx[i], (wgt[i] * grad_y[i]).T)
+    return outs, grad_x
+
+
+@mltest.parametrize.ml_gpu_only
+@pytest.mark.parametrize('dtype', [np.float32, np.float16])
+@pytest.mark.parametrize('sort_by_voxel', [False, True])
+def test_trilinear_devoxelize(ml, dtype, sort_by_voxel):
+    if ml.module.__name__ != 'torch':
+        return
+    torch = ml.module
+    rng = np.random.RandomState(123)
+
+    b, c, n, r = 2, 5, 1000, 8
+    coords = rng.uniform(0, r - 1, size=(b, 3, n)).astype(np.float32)
+    # many points in a few voxels to stress the backward pass
+    coords[:, :, :n // 2] = rng.uniform(2, 3, size=(b, 3, n // 2))
+    coords[:, :, 0] = 2.0
+    features = rng.uniform(-1, 1, size=(b, c, r, r, r)).astype(dtype)
+    grad_y = rng.uniform(-1, 1, size=(b, c, n)).astype(dtype)
+
+    outs_ref, grad_x_ref = trilinear_devoxelize_python(
+        r, coords, features.astype(np.float64), grad_y.astype(np.float64))
+
+    outs, inds, wgts = ml.ops.trilinear_devoxelize_forward(
+        r, True, torch.from_numpy(coords).to(ml.device),
+        torch.from_numpy(features).to(ml.device))
+    grad_x = ml.ops.trilinear_devoxelize_backward(
+        torch.from_numpy(grad_y).to(ml.device),
+        inds,
+        wgts,
+        r,
+        sort_by_voxel=sort_by_voxel)
+
+    assert outs.dtype == features.dtype
+    assert grad_x.dtype == features.dtype
+    tol = 1e-5 if dtype == np.float32 else 1e-2
+    np.testing.assert_allclose(mltest.to_numpy(outs),
+                               outs_ref,
+                               rtol=tol,
+                               atol=tol)
+    np.testing.assert_allclose(mltest.to_numpy(grad_x),
+                               grad_x_ref,
+                               rtol=tol,
+                               atol=tol * n)
@@ -0,0 +1,158 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+import numpy as np
+import pytest
+import mltest
+
+# skip all tests if the ml ops were not built
+pytestmark = mltest.default_marks
+
+
+def voxelize_pooling_python(points, row_splits, features, voxel_size,
+                            point_range_min, point_range_max, position_fn,
+                            feature_fn):
+    """Returns a list with a dict (voxel_coords -> (position, feature)) for
+    each batch item and the voxel coords of each point"""
+    ans = []
+    point_voxel_coords = [None] * points.shape[0]
+    for batch_id in range(row_splits.shape[0] - 1):
+        voxels = {}
+        for i in range(row_splits[batch_id], row_splits[batch_id + 1]):
+            p = points[i]
+            if np.any(p < point_range_min) or np.any(p > point_range_max):
+                continue
+            c = tuple(((p - point_range_min) / voxel_size).astype(np.int32))
+            voxels.setdefault(c, []).append(i)
+            point_voxel_coords[i] = (batch_id, c)
+
+        pooled = {}
+        for c, idxs in voxels.items():
+            if position_fn == 'center':
+                pos = point_range_min + (np.array(c) + 0.5) * voxel_size
+            else:
+                pos = np.mean(points[idxs], axis=0)
+            if feature_fn == 'max':
+                feat = np.max(features[idxs], axis=0)
+            else:
+                feat = np.mean(features[idxs], axis=0)
+            pooled[c] = (pos, feat)
+        ans.append(pooled)
+    return ans, point_voxel_coords
+
+
+@mltest.parametrize.ml_torch_only
+@pytest.mark.parametrize('point_dtype', [np.float32, np.float64])
+@pytest.mark.parametrize('position_fn', ['average', 'center'])
+@pytest.mark.parametrize('feature_fn', ['average', 'max'])
+def test_voxelize_pooling_random(ml, point_dtype, position_fn, feature_fn):
+    rng = np.random.RandomState(123)
+
+    points = rng.uniform(-0.5, 5.5, size=(500, 3)).astype(point_dtype)
+    features = rng.rand(500, 4).astype(np.float32)
+    row_splits = np.array([0, 150, 150, 500], dtype=np.int64)
+    voxel_size = np.array([1.0, 0.7, 1.3], dtype=point_dtype)
+    point_range_min = np.zeros((3,), dtype=point_dtype)
+    point_range_max = np.full((3,), 5, dtype=point_dtype)
+
+    ans = mltest.run_op(ml,
+                        ml.device,
+                        True,
+                        ml.ops.voxelize_pooling,
+                        points,
+                        row_splits,
+                        features,
+                        voxel_size,
+                        point_range_min,
+                        point_range_max,
+                        position_fn=position_fn,
+                        feature_fn=feature_fn)
+
+    expected, point_voxel_coords = voxelize_pooling_python(
+        points, row_splits, features, voxel_size, point_range_min,
+        point_range_max, position_fn, feature_fn)
+
+    assert ans.voxel_batch_splits.shape == (row_splits.shape[0],)
+    assert ans.voxel_batch_splits[-1] == ans.voxel_coords.shape[0]
+    for batch_id, ref in enumerate(expected):
+        start = ans.voxel_batch_splits[batch_id]
+        end = ans.voxel_batch_splits[batch_id + 1]
+        coords = [tuple(c) for c in ans.voxel_coords[start:end]]
+        # voxels are ordered like the voxels of the voxelize op
+        assert coords == sorted(ref.keys(), key=lambda x: x[::-1])
+        for i, c in enumerate(coords):
+            np.testing.assert_allclose(ans.pooled_positions[start + i],
+                                       ref[c][0],
+                                       rtol=1e-5,
+                                       atol=1e-5)
+            np.testing.assert_allclose(ans.pooled_features[start + i],
+                                       ref[c][1],
+                                       rtol=1e-5,
+                                       atol=1e-6)
+
+    for i, voxel_idx in enumerate(ans.point_voxel_index):
+        if point_voxel_coords[i] is None:
+            assert voxel_idx == -1
+        else:
+            batch_id, c = point_voxel_coords[i]
+            assert ans.voxel_batch_splits[batch_id] <= voxel_idx
+            assert voxel_idx < ans.voxel_batch_splits[batch_id + 1]
+            assert tuple(ans.voxel_coords[voxel_idx]) == c
+
+
+@mltest.parametrize.ml_torch_only
+@pytest.mark.parametrize('feature_fn', ['average', 'max'])
+def test_voxelize_pooling_grad(ml, feature_fn):
+    # yapf: disable
+    points = np.array([
+        [0.5, 0.5, 0.5],
+        [0.7, 0.2, 0.3],
+        [1.5, 0.5, 0.5],
+        [9.0, 0.5, 0.5],
+        ], dtype=np.float32)
+    features = np.array([
+        [1.0, 4.0],
+        [2.0, 3.0],
+        [5.0, 6.0],
+        [7.0, 8.0],
+        ], dtype=np.float32)
+    # yapf: enable
+    row_splits = np.array([0, 4], dtype=np.int64)
+    voxel_size = np.ones((3,), dtype=np.float32)
+    point_range_min = np.zeros((3,), dtype=np.float32)
+    point_range_max = np.full((3,), 2, dtype=np.float32)
+    pooled_features_bp = np.array([[1.0, 2.0], [3.0, 4.0]], dtype=np.float32)
+
+    grad = mltest.run_op_grad(ml, ml.device, True, ml.ops.voxelize_pooling,
+                              features, 'pooled_features', pooled_features_bp,
+                              points, row_splits, features, voxel_size,
+                              point_range_min, point_range_max, 'average',
+                              feature_fn)
+
+    if feature_fn == 'average':
+        expected = [[0.5, 1.0], [0.5, 1.0], [3.0, 4.0], [0.0, 0.0]]
+    else:
+        expected = [[0.0, 2.0], [1.0, 0.0], [3.0, 4.0], [0.0, 0.0]]
+    np.testing.assert_allclose(grad, expected)
@@ -67,6 +67,139 @@ def test_cast_lots_of_rays():
     _ = scene.cast_rays(rays)
 
 
+# the packet based coherent mode must give the same results as the default mode
+def test_cast_rays_coherent():
+    mesh = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_sphere())
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(mesh)
+
+    # use an odd image size to test packets with inactive rays
+    rays = scene.create_rays_pinhole(fov_deg=90,
+                                     center=[0, 0, 0],
+                                     eye=[3, 0, 0],
+                                     up=[0, 0, 1],
+                                     width_px=67,
+                                     height_px=33)
+    ans = scene.cast_rays(rays)
+    ans_coherent = scene.cast_rays(rays, coherent=True)
+
+    for k in ans:
+        np.testing.assert_allclose(ans[k].numpy(),
+                                   ans_coherent[k].numpy(),
+                                   rtol=1e-5,
+                                   atol=1e-6)
+
+
+# test moving, deforming and removing instances without rebuilding the scene
+# queries release the GIL and may be issued from several threads, including
+# the first query which commits the scene
+def test_cast_rays_from_threads():
+    from concurrent.futures import ThreadPoolExecutor
+
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(vertices, triangles)
+
+    rays = o3d.core.Tensor([[0.2, 0.1, 1, 0, 0, -1], [10, 10, 10, 1, 1, 1]],
+                           dtype=o3d.core.float32)
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(lambda _: scene.cast_rays(rays), range(8)))
+
+    for ans in results:
+        np.testing.assert_allclose(ans['t_hit'].numpy(),
+                                   np.array([1.0, np.inf]))
+
+
+def test_instances():
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    static_id = scene.add_triangles(vertices, triangles)
+    T = np.eye(4, dtype=np.float32)
+    T[2, 3] = 1
+    instance_id = scene.add_instance(vertices, triangles,
+                                     o3d.core.Tensor(T))
+
+    rays = o3d.core.Tensor([[0.8, 0.2, 10, 0, 0, -1]], dtype=o3d.core.float32)
+    ans = scene.cast_rays(rays)
+    assert instance_id == ans['geometry_ids'][0]
+    assert np.isclose(ans['t_hit'][0].item(), 9.0)
+
+    # rotate the instance by 180 deg around the x axis. The normal of the hit
+    # must be in world space.
+    T[1, 1] = T[2, 2] = -1
+    T[2, 3] = 2
+    scene.set_instance_transformation(instance_id, o3d.core.Tensor(T))
+    query = o3d.core.Tensor([[0.8, -0.2, 3]], dtype=o3d.core.float32)
+    ans = scene.cast_rays(o3d.core.Tensor([[0.8, -0.2, 10, 0, 0, -1]],
+                                          dtype=o3d.core.float32))
+    assert instance_id == ans['geometry_ids'][0]
+    assert np.isclose(ans['t_hit'][0].item(), 8.0)
+    np.testing.assert_allclose(np.abs(ans['primitive_normals'][0].numpy()),
+                               [0, 0, 1],
+                               atol=1e-6)
+    closest = scene.compute_closest_points(query)
+    assert instance_id == closest['geometry_ids'][0]
+    np.testing.assert_allclose(closest['points'][0].numpy(), [0.8, -0.2, 2],
+                               atol=1e-6)
+
+    # deform the instance
+    scene.update_vertex_positions(
+        instance_id,
+        o3d.core.Tensor([[0, 0, -1], [1, 0, -1], [1, 1, -1]],
+                        dtype=o3d.core.float32))
+    ans = scene.cast_rays(o3d.core.Tensor([[0.8, -0.2, 10, 0, 0, -1]],
+                                          dtype=o3d.core.float32))
+    assert np.isclose(ans['t_hit'][0].item(), 7.0)
+
+    # remove the instance
+    scene.remove_geometry(instance_id)
+    ans = scene.cast_rays(rays)
+    assert static_id == ans['geometry_ids'][0]
+    assert np.isclose(ans['t_hit'][0].item(), 10.0)
+
+
+# rendering must give the same results as casting rays from create_rays_pinhole
+def test_render():
+    mesh = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_sphere())
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(mesh)
+
+    intrinsic_matrix = o3d.core.Tensor([[50, 0, 33], [0, 50, 16], [0, 0, 1]],
+                                       dtype=o3d.core.float64)
+    extrinsic_matrix = o3d.core.Tensor(
+        [[1, 0, 0, 0], [0, 1, 0, 0], [0, 0, 1, 3], [0, 0, 0, 1]],
+        dtype=o3d.core.float64)
+    rays = scene.create_rays_pinhole(intrinsic_matrix, extrinsic_matrix, 67,
+                                     33)
+    ans = scene.cast_rays(rays)
+    hit = np.isfinite(ans['t_hit'].numpy())
+
+    depth = scene.render_depth(intrinsic_matrix, extrinsic_matrix, 67,
+                               33).as_tensor().numpy()[..., 0]
+    np.testing.assert_allclose(depth,
+                               np.where(hit, ans['t_hit'].numpy(), 0),
+                               rtol=1e-5)
+
+    normals = scene.render_normals(intrinsic_matrix, extrinsic_matrix, 67,
+                                   33).as_tensor().numpy()
+    np.testing.assert_allclose(normals,
+                               ans['primitive_normals'].numpy(),
+                               atol=1e-5)
+
+    primitive_ids = scene.render_primitive_ids(intrinsic_matrix,
+                                               extrinsic_matrix, 67,
+                                               33).as_tensor().numpy()[..., 0]
+    np.testing.assert_equal(primitive_ids, ans['primitive_ids'].numpy())
+
+
 # test occlusion with a single triangle
 def test_test_occlusions():
     vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
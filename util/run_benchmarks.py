@@ -0,0 +1,181 @@
+# ----------------------------------------------------------------------------
+# -                        Open3D: www.open3d.org                            -
+# ----------------------------------------------------------------------------
+# The MIT License (MIT)
+#
+# Copyright (c) 2018-2021 www.open3d.org
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+# ----------------------------------------------------------------------------
+"""Runs the C++ benchmarks and compares the results against a baseline.
+
+Examples:
+    # Record the scaling benchmarks and append them to a history file.
+    python util/run_benchmarks.py run --binary build/bin/benchmarks \\
+        --output current.json --history benchmarks_history.jsonl
+
+    # Fail if any benchmark is more than 10% slower than the baseline.
+    python util/run_benchmarks.py compare --baseline baseline.json \\
+        --current current.json --threshold 0.1
+"""
+
+import argparse
+import datetime
+import json
+import os
+import subprocess
+import sys
+
+# Context keys that must match for two results to be comparable. They are
+# recorded by cpp/benchmarks/Main.cpp.
+MACHINE_KEYS = ["host_name", "cpu_cores", "numa_nodes", "isa_target"]
+
+
+def run_benchmarks(binary, benchmark_filter, output, repetitions):
+    cmd = [
+        binary,
+        "--benchmark_filter={}".format(benchmark_filter),
+        "--benchmark_out={}".format(output),
+        "--benchmark_out_format=json",
+    ]
+    if repetitions > 1:
+        cmd += [
+            "--benchmark_repetitions={}".format(repetitions),
+            "--benchmark_report_aggregates_only=true",
+        ]
+    print(" ".join(cmd))
+    subprocess.run(cmd, check=True)
+    with open(output, "r") as f:
+        return json.load(f)
+
+
+def get_times(result):
+    """Returns {benchmark name: real time in ns}. With repetitions, the
+    median is used."""
+    times = {}
+    unit_to_ns = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    for b in result["benchmarks"]:
+        if b.get("run_type") == "aggregate":
+            if b.get("aggregate_name") != "median":
+                continue
+            name = b["run_name"]
+        else:
+            name = b["name"]
+        times[name] = b["real_time"] * unit_to_ns[b.get("time_unit", "ns")]
+    return times
+
+
+def append_history(history, result):
+    record = {
+        "date": datetime.datetime.now().isoformat(),
+        "context": result["context"],
+        "real_time_ns": get_times(result),
+    }
+    with open(history, "a") as f:
+        f.write(json.dumps(record) + "\n")
+
+
+def compare(baseline, current, threshold):
+    """Prints the relative change of each benchmark and returns the names of
+    the benchmarks that are more than threshold slower."""
+    for key in MACHINE_KEYS:
+        b = baseline["context"].get(key)
+        c = current["context"].get(key)
+        if b != c:
+            print("Warning: {} differs: baseline {}, current {}".format(
+                key, b, c))
+
+    baseline_times = get_times(baseline)
+    current_times = get_times(current)
+    regressions = []
+    for name in sorted(current_times):
+        if name not in baseline_times:
+            print("{:<70} new".format(name))
+            continue
+        change = current_times[name] / baseline_times[name] - 1.0
+        status = ""
+        if change > threshold:
+            status = "REGRESSION"
+            regressions.append(name)
+        print("{:<70} {:+7.1%} {}".format(name, change, status))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = subparsers.add_parser("run", help="Run the benchmarks.")
+    run_parser.add_argument("--binary",
+                            required=True,
+                            help="Path to the benchmarks executable.")
+    run_parser.add_argument("--filter",
+                            default="Scaling",
+                            help="Regex of the benchmarks to run.")
+    run_parser.add_argument("--output",
+                            required=True,
+                            help="JSON file for the results.")
+    run_parser.add_argument("--repetitions",
+                            type=int,
+                            default=1,
+                            help="Repetitions per benchmark, the median is "
+                            "compared.")
+    run_parser.add_argument("--history",
+                            help="JSON lines file the results are appended "
+                            "to.")
+    run_parser.add_argument("--baseline",
+                            help="Compare against this JSON file after the "
+                            "run.")
+    run_parser.add_argument("--threshold", type=float, default=0.1)
+
+    compare_parser = subparsers.add_parser(
+        "compare", help="Compare two benchmark results.")
+    compare_parser.add_argument("--baseline", required=True)
+    compare_parser.add_argument("--current", required=True)
+    compare_parser.add_argument("--threshold",
+                                type=float,
+                                default=0.1,
+                                help="Maximum allowed relative slowdown.")
+    args = parser.parse_args()
+
+    if args.command == "run":
+        current = run_benchmarks(os.path.abspath(args.binary), args.filter,
+                                 args.output, args.repetitions)
+        if args.history:
+            append_history(args.history, current)
+        if not args.baseline:
+            return 0
+        baseline_file = args.baseline
+    else:
+        with open(args.current, "r") as f:
+            current = json.load(f)
+        baseline_file = args.baseline
+
+    with open(baseline_file, "r") as f:
+        baseline = json.load(f)
+    regressions = compare(baseline, current, args.threshold)
+    if regressions:
+        print("{} benchmark(s) regressed by more than {:.0%}.".format(
+            len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())